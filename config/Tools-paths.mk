@@ -0,0 +1,10 @@
+-include $(XEN_ROOT)/config/Paths.mk
+
+XENSTORED                := /usr/local/sbin/xenstored
+XENSTORED_KVA            := /proc/xen/xsd_kva
+XENSTORED_PORT           := /proc/xen/xsd_port
+XEN_RUN_STORED           := /var/run/xenstored
+
+LINUX_BACKEND_MODULES    := xen-evtchn xen-gntdev xen-gntalloc xen-blkback xen-netback xen-pciback evtchn gntdev netbk blkbk xen-scsibk usbbk pciback xen-acpi-processor
+
+qemu_xen_path            := /bin/true
@@ -0,0 +1,72 @@
+-include $(XEN_ROOT)/config/Paths.mk
+
+CONFIG_WERROR       := y
+CONFIG_RUMP         := n
+ifeq ($(CONFIG_RUMP),y)
+XEN_OS              := NetBSDRump
+endif
+
+# Tools path
+BISON               := /usr/bin/bison
+FLEX                := 
+PYTHON              := python3
+PYTHON_PATH         := /root/.pyenv/shims/python3
+PY_NOOPT_CFLAGS     := 
+PERL                := /usr/bin/perl
+AS86                := 
+LD86                := 
+BCC                 := 
+IASL                := /bin/true
+AWK                 := /usr/bin/awk
+FETCHER             := /usr/bin/wget -c -O
+ABI_DUMPER          := 
+
+# Extra folder for libs/includes
+PREPEND_INCLUDES    := 
+PREPEND_LIB         := 
+APPEND_INCLUDES     := 
+APPEND_LIB          := 
+
+PTHREAD_CFLAGS      := -pthread
+PTHREAD_LDFLAGS     := -pthread
+PTHREAD_LIBS        := 
+
+LIBNL3_LIBS         := -lnl-route-3 -lnl-3 
+LIBNL3_CFLAGS       := -I/usr/include/libnl3 
+XEN_TOOLS_RPATH     := n
+
+# Optional components
+XENSTAT_XENTOP      := y
+OCAML_TOOLS         := n
+FLASK_POLICY        := n
+CONFIG_OVMF         := n
+CONFIG_ROMBIOS      := n
+CONFIG_SEABIOS      := n
+CONFIG_IPXE         := n
+CONFIG_QEMU_XEN     := n
+CONFIG_QEMUU_EXTRA_ARGS:= 
+CONFIG_LIBNL        := y
+CONFIG_GOLANG       := n
+CONFIG_PYGRUB       := y
+CONFIG_LIBFSIMAGE   := y
+
+CONFIG_SYSTEMD      := n
+XEN_SYSTEMD_DIR     := 
+XEN_SYSTEMD_MODULES_LOAD := 
+XEN_SYSTEMD_SLEEP_DIR := 
+CONFIG_9PFS         := 
+
+LINUX_BACKEND_MODULES := xen-evtchn xen-gntdev xen-gntalloc xen-blkback xen-netback xen-pciback evtchn gntdev netbk blkbk xen-scsibk usbbk pciback xen-acpi-processor
+
+#System options
+ZLIB_CFLAGS         :=  -DHAVE_BZLIB -DHAVE_LZMA
+ZLIB_LIBS           :=  -lbz2 -llzma
+EXTFS_LIBS          := 
+CURSES_LIBS         := -lncurses
+TINFO_LIBS          := -ltinfo
+ARGP_LDFLAGS        := 
+XEN_JSON_LIBS       := -lyajl 
+
+FILE_OFFSET_BITS    := 
+
+CONFIG_PV_SHIM      := y
@@ -0,0 +1 @@
+SUBSYSTEMS               :=  xen tools
@@ -0,0 +1 @@
+/root/repo/tools/include/../../xen/include/acpi/acglobal.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/tools/include/../../xen/include/acpi/acmacros.h
\ No newline at end of file
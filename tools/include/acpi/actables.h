@@ -0,0 +1 @@
+/root/repo/tools/include/../../xen/include/acpi/actables.h
\ No newline at end of file
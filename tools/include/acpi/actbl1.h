@@ -0,0 +1 @@
+/root/repo/tools/include/../../xen/include/acpi/actbl1.h
\ No newline at end of file
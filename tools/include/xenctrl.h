@@ -832,6 +832,34 @@ int xc_vcpu_getinfo(xc_interface *xch,
                     uint32_t vcpu,
                     xc_vcpuinfo_t *info);
 
+#if defined(__i386__) || defined(__x86_64__)
+typedef struct xen_domctl_exit_stat xc_exit_stat_t;
+
+/**
+ * This function returns the cumulative VM exit and hypercall statistics of
+ * a vcpu.  See XEN_DOMCTL_get_exit_stats for their meaning.
+ *
+ * @parm xch a handle to an open hypervisor interface
+ * @parm domid the domain to get information from
+ * @parm vcpu the vcpu number
+ * @parm type set to the XEN_DOMCTL_EXIT_STATS_* type of the vcpu
+ * @parm exits array of *nr_exits entries, may be NULL if *nr_exits is 0
+ * @parm nr_exits IN: size of exits, OUT: number of exit reasons
+ * @parm hypercalls array of *nr_hypercalls entries, may be NULL if
+ *       *nr_hypercalls is 0
+ * @parm nr_hypercalls IN: size of hypercalls, OUT: number of hypercalls
+ * @return 0 on success, -1 on failure
+ */
+int xc_vcpu_get_exit_stats(xc_interface *xch,
+                           uint32_t domid,
+                           uint32_t vcpu,
+                           uint32_t *type,
+                           xc_exit_stat_t *exits,
+                           uint32_t *nr_exits,
+                           xc_exit_stat_t *hypercalls,
+                           uint32_t *nr_hypercalls);
+#endif
+
 long long xc_domain_get_cpu_usage(xc_interface *xch,
                                   uint32_t domid,
                                   int vcpu);
@@ -1150,6 +1178,20 @@ int xc_microcode_update(xc_interface *xch, const void *buf,
 int xc_get_cpu_version(xc_interface *xch, struct xenpf_pcpu_version *cpu_ver);
 int xc_get_ucode_revision(xc_interface *xch,
                           struct xenpf_ucode_revision *ucode_rev);
+/*
+ * Read hypervisor symbol *@symnum into @name (of @namelen bytes), and advance
+ * *@symnum to the next symbol.  @name is empty past the last symbol.
+ */
+int xc_get_symbol(xc_interface *xch, uint32_t *symnum, char *name,
+                  uint32_t namelen, uint64_t *address, char *type);
+/*
+ * Read the whole hypervisor symbol table, in as few hypercalls as Xen
+ * allows.  *@entries and *@names are allocated, and must be freed by the
+ * caller; each entry's name is at *@names + entry->name.
+ */
+typedef xenpf_symtab_entry_t xc_symtab_entry_t;
+int xc_get_symtab(xc_interface *xch, xc_symtab_entry_t **entries,
+                  char **names, uint32_t *nr);
 int xc_numainfo(xc_interface *xch, unsigned *max_nodes,
                 xc_meminfo_t *meminfo, uint32_t *distance);
 int xc_pcitopoinfo(xc_interface *xch, unsigned num_devs,
@@ -1381,8 +1423,44 @@ int xc_perfc_query(xc_interface *xch,
                    xc_hypercall_buffer_t *desc,
                    xc_hypercall_buffer_t *val);
 
+/*
+ * Snapshot of the counters of all CPUs shared by Xen, and refreshed every
+ * period_ms (0 to stop refreshing).  Mapping sets the period, for all users
+ * of the snapshot.
+ */
+typedef xen_perfc_snapshot_t xc_perfc_snapshot_t;
+int xc_perfc_snapshot_period(xc_interface *xch, unsigned int period_ms);
+const xc_perfc_snapshot_t *xc_perfc_snapshot_map(xc_interface *xch,
+                                                 unsigned int period_ms);
+void xc_perfc_snapshot_unmap(const xc_perfc_snapshot_t *snap);
+
+typedef struct xc_perfc_sample {
+    uint64_t stime;
+    uint32_t resets;
+    uint32_t nr_cpus, nr_vals;
+    uint32_t *vals;             /* [cpu * nr_vals + val] */
+} xc_perfc_sample_t;
+
+/*
+ * Copy a consistent sample of the snapshot into @s, allocating s->vals if
+ * NULL.  Fails with EAGAIN if the snapshot has not been refreshed yet.
+ */
+int xc_perfc_sample(const xc_perfc_snapshot_t *snap, xc_perfc_sample_t *s);
+void xc_perfc_sample_free(xc_perfc_sample_t *s);
+
+/*
+ * For each of the nr_vals values, sum over all CPUs its increase from @prev
+ * to @cur into @delta, and the increase per second into @rate (either may be
+ * NULL).  Status values are reported as is, with a rate of 0.
+ */
+int xc_perfc_sample_delta(const xc_perfc_snapshot_t *snap,
+                          const xc_perfc_sample_t *prev,
+                          const xc_perfc_sample_t *cur,
+                          uint64_t *delta, double *rate);
+
 typedef xen_sysctl_lockprof_data_t xc_lockprof_data_t;
 int xc_lockprof_reset(xc_interface *xch);
+int xc_lockprof_enable(xc_interface *xch, bool enable);
 int xc_lockprof_query_number(xc_interface *xch,
                              uint32_t *n_elems);
 int xc_lockprof_query(xc_interface *xch,
@@ -1390,6 +1468,28 @@ int xc_lockprof_query(xc_interface *xch,
                       uint64_t *time,
                       xc_hypercall_buffer_t *data);
 
+#if defined(__i386__) || defined(__x86_64__)
+typedef xen_sysctl_sample_t xc_sample_t;
+int xc_sample_prof_enable(xc_interface *xch, uint32_t rate);
+int xc_sample_prof_disable(xc_interface *xch);
+/*
+ * Drain up to *nr samples of @cpu's ring into @samples.  On return, *nr is
+ * the number of samples written, *lost the number of samples dropped since
+ * the previous read and *rate the current sampling rate (0 if disabled).
+ */
+int xc_sample_prof_read(xc_interface *xch, uint32_t cpu, uint32_t *nr,
+                        uint32_t *lost, uint32_t *rate,
+                        xc_hypercall_buffer_t *samples);
+#endif
+
+typedef xen_sysctl_microbench_op_t xc_microbench_t;
+/*
+ * Describe, or run, benchmark op->index.  Both fill in op->name and
+ * op->nr_benchmarks; see XEN_SYSCTL_microbench_op for the other fields.
+ */
+int xc_microbench_info(xc_interface *xch, xc_microbench_t *op);
+int xc_microbench_run(xc_interface *xch, xc_microbench_t *op);
+
 void *xc_memalign(xc_interface *xch, size_t alignment, size_t size);
 
 /**
@@ -109,6 +109,15 @@ int xenevtchn_fd(xenevtchn_handle *xce);
  */
 int xenevtchn_notify(xenevtchn_handle *xce, evtchn_port_t port);
 
+/*
+ * Notify each of the <nr> event channels in <ports>, with as few hypercalls
+ * as the platform allows.  Ports listed more than once may only be notified
+ * once.  All the ports are notified even if some fail, in which case -1 is
+ * returned with errno set for the first failure.
+ */
+int xenevtchn_notify_batch(xenevtchn_handle *xce, const evtchn_port_t *ports,
+                           unsigned int nr);
+
 /*
  * Returns a new event port awaiting interdomain connection from the given
  * domain ID, or -1 on failure, in which case errno will be set appropriately.
@@ -446,6 +446,12 @@ struct precopy_stats
     unsigned int iteration;
     unsigned long total_written;
     long dirty_count; /* -1 if unknown */
+    unsigned long dirty_rate;  /* Pages dirtied per second, 0 if unknown. */
+    unsigned long send_rate;   /* Pages sent per second, 0 if unknown. */
+    unsigned long predicted_downtime_ms; /* Time to send dirty_count pages
+                                          * at send_rate, 0 if unknown. */
+    unsigned int throttle_pct; /* vCPU time allowed to the guest, in percent,
+                                * or 0 if throttling is unavailable. */
 };
 
 /*
@@ -474,6 +480,9 @@ struct save_callbacks {
 #define XGS_POLICY_CONTINUE_PRECOPY 0  /* Remain in the precopy phase. */
 #define XGS_POLICY_STOP_AND_COPY    1  /* Immediately suspend and transmit the
                                         * remaining dirty pages. */
+#define XGS_POLICY_THROTTLE         2  /* Remain in the precopy phase, but
+                                        * throttle the guest's vCPUs further
+                                        * to reduce its dirty rate. */
     precopy_policy_t precopy_policy;
 
     /*
@@ -42,7 +42,9 @@ void xenstat_uninit(xenstat_handle * handle);
 #define XENSTAT_NETWORK 0x2
 #define XENSTAT_XEN_VERSION 0x4
 #define XENSTAT_VBD 0x8
-#define XENSTAT_ALL (XENSTAT_VCPU|XENSTAT_NETWORK|XENSTAT_XEN_VERSION|XENSTAT_VBD)
+#define XENSTAT_EXITS 0x10
+#define XENSTAT_ALL (XENSTAT_VCPU|XENSTAT_NETWORK|XENSTAT_XEN_VERSION|XENSTAT_VBD|\
+		     XENSTAT_EXITS)
 
 /* Get all available information about a node */
 xenstat_node *xenstat_get_node(xenstat_handle * handle, unsigned int flags);
@@ -134,6 +136,27 @@ unsigned int xenstat_domain_num_vbds(xenstat_domain *);
 xenstat_vbd *xenstat_domain_vbd(xenstat_domain * domain,
 				    unsigned int vbd);
 
+/* Get the number of VM exit reasons for a given domain (0 if not HVM) */
+unsigned int xenstat_domain_num_exits(xenstat_domain * domain);
+
+/* Get the number of VM exits with a given reason, summed over all vcpus */
+unsigned long long xenstat_domain_exits(xenstat_domain * domain,
+					unsigned int reason);
+
+/* Get the name of a VM exit reason, or NULL if unknown */
+const char *xenstat_domain_exit_name(xenstat_domain * domain,
+				     unsigned int reason);
+
+/* Get the number of hypercall numbers for a given domain */
+unsigned int xenstat_domain_num_hypercalls(xenstat_domain * domain);
+
+/* Get the number of hypercalls with a given number, summed over all vcpus */
+unsigned long long xenstat_domain_hypercalls(xenstat_domain * domain,
+					     unsigned int nr);
+
+/* Get the name of a hypercall, or NULL if unknown */
+const char *xenstat_hypercall_name(unsigned int nr);
+
 /*
  * VCPU functions - extract information from a xenstat_vcpu
  */
@@ -1310,6 +1310,54 @@ int xc_vcpu_getinfo(xc_interface *xch,
     return rc;
 }
 
+#if defined(__i386__) || defined(__x86_64__)
+int xc_vcpu_get_exit_stats(xc_interface *xch,
+                           uint32_t domid,
+                           uint32_t vcpu,
+                           uint32_t *type,
+                           xc_exit_stat_t *exits,
+                           uint32_t *nr_exits,
+                           xc_exit_stat_t *hypercalls,
+                           uint32_t *nr_hypercalls)
+{
+    struct xen_domctl domctl = {};
+    DECLARE_HYPERCALL_BOUNCE(exits, *nr_exits * sizeof(*exits),
+                             XC_HYPERCALL_BUFFER_BOUNCE_OUT);
+    DECLARE_HYPERCALL_BOUNCE(hypercalls, *nr_hypercalls * sizeof(*hypercalls),
+                             XC_HYPERCALL_BUFFER_BOUNCE_OUT);
+    int rc = -1;
+
+    if ( xc_hypercall_bounce_pre(xch, exits) ||
+         xc_hypercall_bounce_pre(xch, hypercalls) )
+    {
+        PERROR("Could not bounce buffers for DOMCTL_get_exit_stats");
+        goto out;
+    }
+
+    domctl.cmd = XEN_DOMCTL_get_exit_stats;
+    domctl.domain = domid;
+    domctl.u.exit_stats.vcpu = vcpu;
+    domctl.u.exit_stats.nr_exits = *nr_exits;
+    domctl.u.exit_stats.nr_hypercalls = *nr_hypercalls;
+    set_xen_guest_handle(domctl.u.exit_stats.exits, exits);
+    set_xen_guest_handle(domctl.u.exit_stats.hypercalls, hypercalls);
+
+    rc = do_domctl(xch, &domctl);
+    if ( !rc )
+    {
+        *type = domctl.u.exit_stats.type;
+        *nr_exits = domctl.u.exit_stats.nr_exits;
+        *nr_hypercalls = domctl.u.exit_stats.nr_hypercalls;
+    }
+
+ out:
+    xc_hypercall_bounce_post(xch, exits);
+    xc_hypercall_bounce_post(xch, hypercalls);
+
+    return rc;
+}
+#endif
+
 int xc_domain_ioport_permission(xc_interface *xch,
                                 uint32_t domid,
                                 uint32_t first_port,
@@ -264,6 +264,136 @@ int xc_get_ucode_revision(xc_interface *xch,
     return 0;
 }
 
+int xc_get_symbol(xc_interface *xch, uint32_t *symnum, char *name,
+                  uint32_t namelen, uint64_t *address, char *type)
+{
+    int ret;
+    struct xen_platform_op op = {
+        .cmd = XENPF_get_symbol,
+        .u.symdata.namelen = namelen,
+        .u.symdata.symnum = *symnum,
+    };
+    DECLARE_HYPERCALL_BOUNCE(name, namelen, XC_HYPERCALL_BUFFER_BOUNCE_OUT);
+
+    if ( !namelen )
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    if ( xc_hypercall_bounce_pre(xch, name) )
+        return -1;
+
+    set_xen_guest_handle(op.u.symdata.name, name);
+    ret = do_platform_op(xch, &op);
+
+    xc_hypercall_bounce_post(xch, name);
+
+    if ( ret )
+        return ret;
+
+    /* The name may have been truncated. */
+    name[namelen - 1] = '\0';
+    *symnum = op.u.symdata.symnum;
+    *address = op.u.symdata.address;
+    *type = op.u.symdata.type;
+
+    return 0;
+}
+
+static int read_symtab(xc_interface *xch, struct xen_platform_op *op,
+                       xc_symtab_entry_t *entries, char *names)
+{
+    int ret = -1;
+    DECLARE_HYPERCALL_BOUNCE(entries,
+                             op->u.symtab.nr_entries * sizeof(*entries),
+                             XC_HYPERCALL_BUFFER_BOUNCE_OUT);
+    DECLARE_HYPERCALL_BOUNCE(names, op->u.symtab.names_size,
+                             XC_HYPERCALL_BUFFER_BOUNCE_OUT);
+
+    if ( xc_hypercall_bounce_pre(xch, entries) )
+        return -1;
+    if ( xc_hypercall_bounce_pre(xch, names) )
+        goto out;
+
+    set_xen_guest_handle(op->u.symtab.entries, entries);
+    set_xen_guest_handle(op->u.symtab.names, names);
+    ret = do_platform_op(xch, op);
+
+    xc_hypercall_bounce_post(xch, names);
+ out:
+    xc_hypercall_bounce_post(xch, entries);
+
+    return ret;
+}
+
+int xc_get_symtab(xc_interface *xch, xc_symtab_entry_t **entries,
+                  char **names, uint32_t *nr)
+{
+    int ret;
+    struct xen_platform_op op = {
+        .cmd = XENPF_get_symtab,
+    };
+    xc_symtab_entry_t *e;
+    char *n;
+    uint32_t nr_entries = 0, names_size = 0, read = 0, used = 0, i;
+
+    /*
+     * Size the table first, with a null entries handle.  Xen may return
+     * early, so carry on until it has no more symbols.
+     */
+    do {
+        set_xen_guest_handle(op.u.symtab.entries, HYPERCALL_BUFFER_NULL);
+        set_xen_guest_handle(op.u.symtab.names, HYPERCALL_BUFFER_NULL);
+        ret = do_platform_op(xch, &op);
+        if ( ret )
+            return ret;
+
+        nr_entries += op.u.symtab.nr_entries;
+        names_size += op.u.symtab.names_size;
+    } while ( op.u.symtab.nr_entries );
+
+    e = malloc(nr_entries * sizeof(*e) ?: 1);
+    n = malloc(names_size ?: 1);
+    if ( !e || !n )
+    {
+        PERROR("Could not allocate memory for the symbol table");
+        free(e);
+        free(n);
+        return -1;
+    }
+
+    op.u.symtab.first = 0;
+    while ( read < nr_entries )
+    {
+        op.u.symtab.nr_entries = nr_entries - read;
+        op.u.symtab.names_size = names_size - used;
+        ret = read_symtab(xch, &op, e + read, n + used);
+        if ( ret )
+        {
+            free(e);
+            free(n);
+            return ret;
+        }
+
+        if ( !op.u.symtab.nr_entries )
+            break;
+
+        /* Name offsets are relative to the names read by each call. */
+        for ( i = read; i < read + op.u.symtab.nr_entries; i++ )
+            e[i].name += used;
+
+        read += op.u.symtab.nr_entries;
+        used += op.u.symtab.names_size;
+    }
+
+    *entries = e;
+    *names = n;
+    *nr = read;
+
+    return 0;
+}
+
 int xc_cputopoinfo(xc_interface *xch, unsigned *max_cpus,
                    xc_cputopo_t *cputopo)
 {
@@ -502,6 +632,174 @@ int xc_perfc_query(xc_interface *xch,
     return do_sysctl(xch, &sysctl);
 }
 
+static int perfc_snapshot_op(xc_interface *xch, unsigned int period_ms,
+                             uint32_t *nr_frames,
+                             struct xc_hypercall_buffer *frames /* or NULL */)
+{
+    struct xen_sysctl sysctl = {};
+    int rc;
+
+    sysctl.cmd = XEN_SYSCTL_perfc_op;
+    sysctl.u.perfc_op.cmd = XEN_SYSCTL_PERFCOP_snapshot;
+    sysctl.u.perfc_op.period_ms = period_ms;
+    sysctl.u.perfc_op.nr_frames = *nr_frames;
+    set_xen_guest_handle(sysctl.u.perfc_op.desc, HYPERCALL_BUFFER_NULL);
+    set_xen_guest_handle(sysctl.u.perfc_op.val, HYPERCALL_BUFFER_NULL);
+    if ( frames )
+    {
+        DECLARE_HYPERCALL_BUFFER_ARGUMENT(frames);
+
+        set_xen_guest_handle(sysctl.u.perfc_op.frames, frames);
+    }
+    else
+        set_xen_guest_handle(sysctl.u.perfc_op.frames, HYPERCALL_BUFFER_NULL);
+
+    rc = do_sysctl(xch, &sysctl);
+    *nr_frames = sysctl.u.perfc_op.nr_frames;
+
+    return rc;
+}
+
+int xc_perfc_snapshot_period(xc_interface *xch, unsigned int period_ms)
+{
+    uint32_t nr_frames = 0;
+
+    return perfc_snapshot_op(xch, period_ms, &nr_frames, NULL);
+}
+
+const xc_perfc_snapshot_t *xc_perfc_snapshot_map(xc_interface *xch,
+                                                 unsigned int period_ms)
+{
+    DECLARE_HYPERCALL_BUFFER(uint64_t, frames);
+    xen_pfn_t *pfns = NULL;
+    const xc_perfc_snapshot_t *snap = NULL;
+    uint32_t i, nr_frames = 0;
+
+    if ( perfc_snapshot_op(xch, period_ms, &nr_frames, NULL) )
+        return NULL;
+
+    frames = xc_hypercall_buffer_alloc(xch, frames,
+                                       nr_frames * sizeof(*frames));
+    pfns = malloc(nr_frames * sizeof(*pfns));
+    if ( !frames || !pfns )
+    {
+        PERROR("Could not allocate memory for the perfc snapshot frames");
+        goto out;
+    }
+
+    if ( perfc_snapshot_op(xch, period_ms, &nr_frames, HYPERCALL_BUFFER(frames)) )
+        goto out;
+
+    for ( i = 0; i < nr_frames; i++ )
+        pfns[i] = frames[i];
+
+    snap = xc_map_foreign_pages(xch, DOMID_XEN, PROT_READ, pfns, nr_frames);
+
+ out:
+    free(pfns);
+    xc_hypercall_buffer_free(xch, frames);
+
+    return snap;
+}
+
+void xc_perfc_snapshot_unmap(const xc_perfc_snapshot_t *snap)
+{
+    size_t size = snap->vals_offset +
+                  (size_t)snap->nr_cpus * snap->nr_vals * sizeof(uint32_t);
+
+    munmap((void *)snap, (size + XC_PAGE_SIZE - 1) & ~(XC_PAGE_SIZE - 1));
+}
+
+int xc_perfc_sample(const xc_perfc_snapshot_t *snap, xc_perfc_sample_t *s)
+{
+    const volatile xc_perfc_snapshot_t *v = snap;
+    size_t size = (size_t)snap->nr_cpus * snap->nr_vals * sizeof(uint32_t);
+    uint32_t seq;
+
+    if ( !s->vals )
+    {
+        s->vals = malloc(size);
+        if ( !s->vals )
+            return -1;
+    }
+    s->nr_cpus = snap->nr_cpus;
+    s->nr_vals = snap->nr_vals;
+
+    do {
+        while ( (seq = v->seq) & 1 )
+            ;
+        xen_rmb();
+
+        memcpy(s->vals, (const void *)snap + snap->vals_offset, size);
+        s->resets = v->resets;
+        s->stime = v->stime;
+
+        xen_rmb();
+    } while ( seq != v->seq );
+
+    /* Not refreshed yet. */
+    if ( !s->stime )
+    {
+        errno = EAGAIN;
+        return -1;
+    }
+
+    return 0;
+}
+
+void xc_perfc_sample_free(xc_perfc_sample_t *s)
+{
+    free(s->vals);
+    s->vals = NULL;
+}
+
+int xc_perfc_sample_delta(const xc_perfc_snapshot_t *snap,
+                          const xc_perfc_sample_t *prev,
+                          const xc_perfc_sample_t *cur,
+                          uint64_t *delta, double *rate)
+{
+    double secs = (double)(cur->stime - prev->stime) / 1e9;
+    unsigned int c, i, j, cpu;
+
+    if ( cur->stime <= prev->stime || cur->nr_vals != prev->nr_vals ||
+         cur->nr_cpus != prev->nr_cpus || cur->nr_vals != snap->nr_vals )
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    for ( c = 0; c < snap->nr_counters; c++ )
+    {
+        const xen_perfc_snapshot_desc_t *d = &snap->desc[c];
+        bool status = d->flags & XEN_PERFC_SNAPSHOT_status;
+
+        for ( i = d->offset; i < d->offset + d->nr_vals; i++ )
+        {
+            uint64_t sum = 0;
+
+            for ( cpu = 0, j = i; cpu < cur->nr_cpus; cpu++, j += cur->nr_vals )
+            {
+                /*
+                 * Status values are levels rather than counts.  Counters
+                 * wrap at 2^32, and restart from 0 when reset.  CPUs which
+                 * went offline read as 0, and don't count.
+                 */
+                if ( status || cur->resets != prev->resets )
+                    sum += cur->vals[j];
+                else if ( cur->vals[j] )
+                    sum += (uint32_t)(cur->vals[j] - prev->vals[j]);
+            }
+
+            if ( delta )
+                delta[i] = sum;
+            if ( rate )
+                rate[i] = status ? 0 : sum / secs;
+        }
+    }
+
+    return 0;
+}
+
 int xc_lockprof_reset(xc_interface *xch)
 {
     struct xen_sysctl sysctl = {};
@@ -513,6 +811,18 @@ int xc_lockprof_reset(xc_interface *xch)
     return do_sysctl(xch, &sysctl);
 }
 
+int xc_lockprof_enable(xc_interface *xch, bool enable)
+{
+    struct xen_sysctl sysctl = {};
+
+    sysctl.cmd = XEN_SYSCTL_lockprof_op;
+    sysctl.u.lockprof_op.cmd = enable ? XEN_SYSCTL_LOCKPROF_enable
+                                      : XEN_SYSCTL_LOCKPROF_disable;
+    set_xen_guest_handle(sysctl.u.lockprof_op.data, HYPERCALL_BUFFER_NULL);
+
+    return do_sysctl(xch, &sysctl);
+}
+
 int xc_lockprof_query_number(xc_interface *xch,
                              uint32_t *n_elems)
 {
@@ -552,6 +862,80 @@ int xc_lockprof_query(xc_interface *xch,
     return rc;
 }
 
+#if defined(__i386__) || defined(__x86_64__)
+int xc_sample_prof_enable(xc_interface *xch, uint32_t rate)
+{
+    struct xen_sysctl sysctl = {};
+
+    sysctl.cmd = XEN_SYSCTL_sample_prof_op;
+    sysctl.u.sample_prof_op.cmd = XEN_SYSCTL_SAMPLE_PROF_enable;
+    sysctl.u.sample_prof_op.rate = rate;
+
+    return do_sysctl(xch, &sysctl);
+}
+
+int xc_sample_prof_disable(xc_interface *xch)
+{
+    struct xen_sysctl sysctl = {};
+
+    sysctl.cmd = XEN_SYSCTL_sample_prof_op;
+    sysctl.u.sample_prof_op.cmd = XEN_SYSCTL_SAMPLE_PROF_disable;
+
+    return do_sysctl(xch, &sysctl);
+}
+
+int xc_sample_prof_read(xc_interface *xch, uint32_t cpu, uint32_t *nr,
+                        uint32_t *lost, uint32_t *rate,
+                        struct xc_hypercall_buffer *samples)
+{
+    int rc;
+    struct xen_sysctl sysctl = {};
+    DECLARE_HYPERCALL_BUFFER_ARGUMENT(samples);
+
+    sysctl.cmd = XEN_SYSCTL_sample_prof_op;
+    sysctl.u.sample_prof_op.cmd = XEN_SYSCTL_SAMPLE_PROF_read;
+    sysctl.u.sample_prof_op.cpu = cpu;
+    sysctl.u.sample_prof_op.nr_samples = *nr;
+    set_xen_guest_handle(sysctl.u.sample_prof_op.samples, samples);
+
+    rc = do_sysctl(xch, &sysctl);
+    if ( rc )
+        return rc;
+
+    *nr = sysctl.u.sample_prof_op.nr_samples;
+    *lost = sysctl.u.sample_prof_op.lost;
+    *rate = sysctl.u.sample_prof_op.rate;
+
+    return 0;
+}
+#endif
+
+static int microbench_op(xc_interface *xch, uint32_t cmd, xc_microbench_t *op)
+{
+    int rc;
+    struct xen_sysctl sysctl = {};
+
+    sysctl.cmd = XEN_SYSCTL_microbench_op;
+    sysctl.u.microbench_op = *op;
+    sysctl.u.microbench_op.cmd = cmd;
+
+    rc = do_sysctl(xch, &sysctl);
+    if ( !rc )
+        *op = sysctl.u.microbench_op;
+
+    return rc;
+}
+
+int xc_microbench_info(xc_interface *xch, xc_microbench_t *op)
+{
+    return microbench_op(xch, XEN_SYSCTL_MICROBENCH_info, op);
+}
+
+int xc_microbench_run(xc_interface *xch, xc_microbench_t *op)
+{
+    return microbench_op(xch, XEN_SYSCTL_MICROBENCH_run, op);
+}
+
 int xc_getcpuinfo(xc_interface *xch, int max_cpus,
                   xc_cpuinfo_t *info, int *nr_cpus)
 {
@@ -130,6 +130,64 @@ int xenevtchn_restrict(xenevtchn_handle *xce, domid_t domid)
     return osdep_evtchn_restrict(xce, domid);
 }
 
+static int notify_batch(xenevtchn_handle *xce, const evtchn_port_t *ports,
+                        unsigned int nr)
+{
+    unsigned int i;
+    int rc, saved_errno = 0;
+
+    rc = osdep_evtchn_notify_batch(xce, ports, nr);
+    if ( !rc || errno != EOPNOTSUPP )
+        return rc;
+
+    /* No batch operation: notify the ports in turn. */
+    rc = 0;
+    for ( i = 0; i < nr; i++ )
+    {
+        if ( xenevtchn_notify(xce, ports[i]) && !rc )
+        {
+            rc = -1;
+            saved_errno = errno;
+        }
+    }
+
+    if ( rc )
+        errno = saved_errno;
+
+    return rc;
+}
+
+int xenevtchn_notify_batch(xenevtchn_handle *xce, const evtchn_port_t *ports,
+                           unsigned int nr)
+{
+    evtchn_port_t batch[EVTCHN_SEND_BATCH_MAX];
+    unsigned int i = 0, j, n;
+    int rc = 0, saved_errno = 0;
+
+    while ( i < nr )
+    {
+        /* Gather up to a hypercall's worth of distinct ports. */
+        for ( n = 0; i < nr && n < EVTCHN_SEND_BATCH_MAX; i++ )
+        {
+            for ( j = 0; j < n && batch[j] != ports[i]; j++ )
+                ;
+            if ( j == n )
+                batch[n++] = ports[i];
+        }
+
+        if ( notify_batch(xce, batch, n) && !rc )
+        {
+            rc = -1;
+            saved_errno = errno;
+        }
+    }
+
+    if ( rc )
+        errno = saved_errno;
+
+    return rc;
+}
+
 /*
  * Local variables:
  * mode: C
@@ -25,6 +25,7 @@
 #include <mini-os/os.h>
 #include <mini-os/lib.h>
 #include <mini-os/events.h>
+#include <mini-os/hypervisor.h>
 #include <mini-os/wait.h>
 
 #include <assert.h>
@@ -35,6 +36,7 @@
 #include <unistd.h>
 #include <inttypes.h>
 #include <malloc.h>
+#include <string.h>
 
 #include "private.h"
 
@@ -158,6 +160,25 @@ int osdep_evtchn_restrict(xenevtchn_handle *xce, domid_t domid)
     return -1;
 }
 
+int osdep_evtchn_notify_batch(xenevtchn_handle *xce,
+                              const evtchn_port_t *ports, unsigned int nr)
+{
+    evtchn_send_batch_t batch = { .nr_ports = nr };
+    int ret;
+
+    memcpy(batch.ports, ports, nr * sizeof(*ports));
+
+    ret = HYPERVISOR_event_channel_op(EVTCHNOP_send_batch, &batch);
+    if ( ret < 0 )
+    {
+        /* Xen without the operation. */
+        errno = ret == -ENOSYS ? EOPNOTSUPP : -ret;
+        ret = -1;
+    }
+
+    return ret;
+}
+
 int xenevtchn_notify(xenevtchn_handle *xce, evtchn_port_t port)
 {
     int ret;
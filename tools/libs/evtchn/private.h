@@ -17,6 +17,9 @@ struct xenevtchn_handle {
 int osdep_evtchn_open(xenevtchn_handle *xce, unsigned int flags);
 int osdep_evtchn_close(xenevtchn_handle *xce);
 int osdep_evtchn_restrict(xenevtchn_handle *xce, domid_t domid);
+/* At most EVTCHN_SEND_BATCH_MAX ports, fails with EOPNOTSUPP if unsupported. */
+int osdep_evtchn_notify_batch(xenevtchn_handle *xce,
+                              const evtchn_port_t *ports, unsigned int nr);
 
 #endif
 
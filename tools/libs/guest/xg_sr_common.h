@@ -239,11 +239,66 @@ struct xc_sr_context
 
             struct precopy_stats stats;
 
+            /* Start of the current precopy round, and of its log-dirty
+             * period, for dirty/send rate estimation. */
+            uint64_t round_start_ns;
+            uint64_t logdirty_start_ns;
+
+            /* Scheduler cap applied to throttle the guest, if any. */
+            struct
+            {
+                uint32_t sched_id;
+                uint16_t orig_cap;
+                bool active;
+            } throttle;
+
             xen_pfn_t *batch_pfns;
             unsigned int nr_batch_pfns;
             unsigned long *deferred_pages;
             unsigned long nr_deferred_pages;
             xc_hypercall_buffer_t dirty_bitmap_hbuf;
+
+            /*
+             * Pfns dirtied in the last precopy round, when few enough to be
+             * retrieved as a list.  nr_dirty_pfns is -1 when the dirty bitmap
+             * is in use instead, and dirty_pfns_size is 0 if Xen doesn't
+             * support retrieving a list.
+             */
+            xc_hypercall_buffer_t dirty_pfns_hbuf;
+            unsigned long dirty_pfns_size;
+            long nr_dirty_pfns;
+
+            /*
+             * Staging buffer for O_DIRECT writes, when saving to a regular
+             * file.  'head' bytes are written unbuffered first, to bring the
+             * file offset to an aligned boundary.
+             */
+            struct
+            {
+                void *buf;
+                size_t used;
+                size_t head;
+                int orig_flags;
+                bool active;
+                bool disabled; /* O_DIRECT rejected, write buffered. */
+            } direct;
+
+            /*
+             * Remus checkpoints are staged in memory while the guest is
+             * paused, and only transmitted once it has been resumed.  Also
+             * tracks per-epoch statistics for all checkpointed streams.
+             */
+            struct
+            {
+                void *buf;
+                size_t used;
+                size_t size;
+                bool staging;
+                unsigned int epoch;
+                uint64_t bytes;
+                uint64_t suspend_ns;
+                uint64_t written_ns;
+            } checkpoint;
         } save;
 
         struct /* Restore data. */
@@ -425,6 +480,13 @@ int write_split_record(struct xc_sr_context *ctx, struct xc_sr_record *rec,
  *
  * Returns 0 on success and non0 on failure.
  */
+/*
+ * Write data into the save stream, via the O_DIRECT staging buffer if in
+ * use.
+ */
+int write_stream(struct xc_sr_context *ctx, const struct iovec *iov,
+                 int iovcnt);
+
 static inline int write_record(struct xc_sr_context *ctx,
                                struct xc_sr_record *rec)
 {
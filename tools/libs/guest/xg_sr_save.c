@@ -1,8 +1,217 @@
 #include <assert.h>
+#include <fcntl.h>
+#include <time.h>
 #include <arpa/inet.h>
+#include <sys/stat.h>
 
 #include "xg_sr_common.h"
 
+/*
+ * Saves to a regular file are staged through a page-aligned buffer and
+ * written with O_DIRECT, so large streams neither get copied into nor
+ * evict everything else from the page cache.  Guest pages can't be handed
+ * to the kernel directly, as foreign mappings can't be pinned for I/O.
+ */
+#define DIRECT_ALIGN    XC_PAGE_SIZE
+#define DIRECT_BUF_SIZE (4U << 20)
+
+static void setup_direct_io(struct xc_sr_context *ctx)
+{
+#ifdef O_DIRECT
+    xc_interface *xch = ctx->xch;
+    struct stat st;
+    off_t off;
+    int flags;
+
+    if ( ctx->stream_type != XC_STREAM_PLAIN ||
+         fstat(ctx->fd, &st) || !S_ISREG(st.st_mode) )
+        return;
+
+    off = lseek(ctx->fd, 0, SEEK_CUR);
+    flags = fcntl(ctx->fd, F_GETFL);
+    if ( off < 0 || flags < 0 || (flags & (O_DIRECT | O_APPEND)) )
+        return;
+
+    if ( posix_memalign(&ctx->save.direct.buf, DIRECT_ALIGN,
+                        DIRECT_BUF_SIZE) )
+    {
+        ctx->save.direct.buf = NULL;
+        return;
+    }
+
+    ctx->save.direct.used = 0;
+    ctx->save.direct.head = -off & (DIRECT_ALIGN - 1);
+    ctx->save.direct.orig_flags = flags;
+    ctx->save.direct.active = false;
+    ctx->save.direct.disabled = false;
+
+    DPRINTF("Using O_DIRECT writes, after %zu unaligned bytes",
+            ctx->save.direct.head);
+#endif
+}
+
+/*
+ * Write out the staging buffer.  If the filesystem rejects O_DIRECT, carry
+ * on with buffered writes.
+ */
+static int write_direct_buf(struct xc_sr_context *ctx, size_t len)
+{
+#ifdef O_DIRECT
+    xc_interface *xch = ctx->xch;
+
+    if ( !ctx->save.direct.active && !ctx->save.direct.disabled )
+    {
+        if ( fcntl(ctx->fd, F_SETFL, ctx->save.direct.orig_flags | O_DIRECT) )
+            ctx->save.direct.disabled = true;
+        else
+            ctx->save.direct.active = true;
+    }
+
+    if ( ctx->save.direct.active )
+    {
+        if ( write_exact(ctx->fd, ctx->save.direct.buf, len) == 0 )
+            return 0;
+
+        if ( errno != EINVAL )
+            return -1;
+
+        DPRINTF("O_DIRECT write failed, falling back to buffered writes");
+        fcntl(ctx->fd, F_SETFL, ctx->save.direct.orig_flags);
+        ctx->save.direct.active = false;
+        ctx->save.direct.disabled = true;
+    }
+#endif
+
+    return write_exact(ctx->fd, ctx->save.direct.buf, len);
+}
+
+/*
+ * Flush the remainder of the staging buffer, with the unaligned tail written
+ * buffered, and put the fd back the way it was found.
+ */
+static int finish_direct_io(struct xc_sr_context *ctx, bool flush)
+{
+    size_t used = ctx->save.direct.used;
+    size_t aligned = used & ~(size_t)(DIRECT_ALIGN - 1);
+    int rc = 0;
+
+    if ( !ctx->save.direct.buf )
+        return 0;
+
+    if ( flush && aligned )
+        rc = write_direct_buf(ctx, aligned);
+
+    if ( ctx->save.direct.active )
+    {
+        fcntl(ctx->fd, F_SETFL, ctx->save.direct.orig_flags);
+        ctx->save.direct.active = false;
+    }
+
+    if ( flush && !rc && used > aligned )
+        rc = write_exact(ctx->fd, ctx->save.direct.buf + aligned,
+                         used - aligned);
+
+    free(ctx->save.direct.buf);
+    ctx->save.direct.buf = NULL;
+
+    return rc;
+}
+
+/*
+ * Append data to the checkpoint staging buffer, growing it as necessary.
+ */
+static int stage_checkpoint(struct xc_sr_context *ctx,
+                            const struct iovec *iov, int iovcnt)
+{
+    xc_interface *xch = ctx->xch;
+    int i;
+
+    for ( i = 0; i < iovcnt; ++i )
+    {
+        size_t need = ctx->save.checkpoint.used + iov[i].iov_len;
+
+        if ( need > ctx->save.checkpoint.size )
+        {
+            size_t size = max_t(size_t, ctx->save.checkpoint.size * 2,
+                                MB(1));
+            void *buf;
+
+            while ( size < need )
+                size *= 2;
+
+            buf = realloc(ctx->save.checkpoint.buf, size);
+            if ( !buf )
+            {
+                ERROR("Unable to grow checkpoint staging buffer to %zu bytes",
+                      size);
+                errno = ENOMEM;
+                return -1;
+            }
+
+            ctx->save.checkpoint.buf = buf;
+            ctx->save.checkpoint.size = size;
+        }
+
+        memcpy(ctx->save.checkpoint.buf + ctx->save.checkpoint.used,
+               iov[i].iov_base, iov[i].iov_len);
+        ctx->save.checkpoint.used = need;
+    }
+
+    return 0;
+}
+
+int write_stream(struct xc_sr_context *ctx, const struct iovec *iov,
+                 int iovcnt)
+{
+    int i;
+
+    for ( i = 0; i < iovcnt; ++i )
+        ctx->save.checkpoint.bytes += iov[i].iov_len;
+
+    if ( ctx->save.checkpoint.staging )
+        return stage_checkpoint(ctx, iov, iovcnt);
+
+    if ( !ctx->save.direct.buf )
+        return writev_exact(ctx->fd, iov, iovcnt);
+
+    for ( i = 0; i < iovcnt; ++i )
+    {
+        const char *data = iov[i].iov_base;
+        size_t len = iov[i].iov_len;
+
+        if ( ctx->save.direct.head )
+        {
+            size_t chunk = min(len, ctx->save.direct.head);
+
+            if ( write_exact(ctx->fd, data, chunk) )
+                return -1;
+
+            ctx->save.direct.head -= chunk;
+            data += chunk;
+            len -= chunk;
+        }
+
+        while ( len )
+        {
+            size_t chunk = min(len, DIRECT_BUF_SIZE - ctx->save.direct.used);
+
+            memcpy(ctx->save.direct.buf + ctx->save.direct.used, data, chunk);
+            ctx->save.direct.used += chunk;
+            data += chunk;
+            len -= chunk;
+
+            if ( ctx->save.direct.used == DIRECT_BUF_SIZE )
+            {
+                if ( write_direct_buf(ctx, DIRECT_BUF_SIZE) )
+                    return -1;
+                ctx->save.direct.used = 0;
+            }
+        }
+    }
+
+    return 0;
+}
+
 /*
  * Writes an Image header and Domain header into the stream.
  */
@@ -29,13 +238,13 @@ static int write_headers(struct xc_sr_context *ctx, uint16_t guest_type)
         return -1;
     }
 
-    if ( write_exact(ctx->fd, &ihdr, sizeof(ihdr)) )
+    if ( write_stream(ctx, &(struct iovec){ &ihdr, sizeof(ihdr) }, 1) )
     {
         PERROR("Unable to write Image Header to stream");
         return -1;
     }
 
-    if ( write_exact(ctx->fd, &dhdr, sizeof(dhdr)) )
+    if ( write_stream(ctx, &(struct iovec){ &dhdr, sizeof(dhdr) }, 1) )
     {
         PERROR("Unable to write Domain Header to stream");
         return -1;
@@ -253,7 +462,7 @@ static int write_batch(struct xc_sr_context *ctx)
         }
     }
 
-    if ( writev_exact(ctx->fd, iov, iovcnt) )
+    if ( write_stream(ctx, iov, iovcnt) )
     {
         PERROR("Failed to write page data to stream");
         goto err;
@@ -400,6 +609,44 @@ static int send_dirty_pages(struct xc_sr_context *ctx,
     return ctx->save.ops.check_vm_state(ctx);
 }
 
+/*
+ * Send the pages in ctx->save.dirty_pfns.  Used instead of send_dirty_pages()
+ * for precopy rounds which dirtied few enough pages to be retrieved as a list.
+ */
+static int send_dirty_pfn_list(struct xc_sr_context *ctx)
+{
+    xc_interface *xch = ctx->xch;
+    unsigned long i, entries = ctx->save.nr_dirty_pfns;
+    int rc;
+    DECLARE_HYPERCALL_BUFFER_SHADOW(uint64_t, dirty_pfns,
+                                    &ctx->save.dirty_pfns_hbuf);
+
+    for ( i = 0; i < entries; ++i )
+    {
+        if ( dirty_pfns[i] >= ctx->save.p2m_size )
+        {
+            DPRINTF("Dirty pfn %#"PRIx64" beyond p2m size", dirty_pfns[i]);
+            continue;
+        }
+
+        rc = add_to_batch(ctx, dirty_pfns[i]);
+        if ( rc )
+            return rc;
+
+        /* Update progress every 4MB worth of memory sent. */
+        if ( (i & ((1U << (22 - 12)) - 1)) == 0 )
+            xc_report_progress_step(xch, i, entries);
+    }
+
+    rc = flush_batch(ctx);
+    if ( rc )
+        return rc;
+
+    xc_report_progress_step(xch, entries, entries);
+
+    return ctx->save.ops.check_vm_state(ctx);
+}
+
 /*
  * Send all pages in the guests p2m.  Used as the first iteration of the live
  * migration loop, and for a non-live save.
@@ -448,6 +695,317 @@ static int enable_logdirty(struct xc_sr_context *ctx)
     return 0;
 }
 
+/*
+ * Retrieve and clean the pages dirtied during the last precopy round.  If few
+ * enough pages were dirtied, they are retrieved as a list into
+ * ctx->save.dirty_pfns, saving a scan of the whole bitmap on both sides.
+ * Otherwise they are retrieved into the dirty bitmap and nr_dirty_pfns is set
+ * to -1.
+ */
+static int get_dirty_pages(struct xc_sr_context *ctx,
+                           xc_shadow_op_stats_t *stats)
+{
+    xc_interface *xch = ctx->xch;
+    xc_shadow_op_stats_t bitmap_stats;
+    long long nr;
+    unsigned long i;
+    DECLARE_HYPERCALL_BUFFER_SHADOW(unsigned long, dirty_bitmap,
+                                    &ctx->save.dirty_bitmap_hbuf);
+    DECLARE_HYPERCALL_BUFFER_SHADOW(uint64_t, dirty_pfns,
+                                    &ctx->save.dirty_pfns_hbuf);
+
+    ctx->save.nr_dirty_pfns = -1;
+
+    if ( ctx->save.dirty_pfns_size )
+    {
+        nr = xc_logdirty_control(
+            xch, ctx->domid, XEN_DOMCTL_SHADOW_OP_CLEAN_LIST,
+            &ctx->save.dirty_pfns_hbuf, ctx->save.dirty_pfns_size, 0, stats);
+
+        if ( nr < 0 && (errno == EINVAL || errno == EOPNOTSUPP) )
+        {
+            DPRINTF("Dirty pfn lists unsupported, using the bitmap");
+            ctx->save.dirty_pfns_size = 0;
+        }
+        else if ( nr < 0 )
+        {
+            PERROR("Failed to retrieve dirty pfn list");
+            return -1;
+        }
+        else if ( nr < ctx->save.dirty_pfns_size )
+        {
+            ctx->save.nr_dirty_pfns = nr;
+            stats->dirty_count = nr;
+            return 0;
+        }
+    }
+
+    if ( xc_logdirty_control(
+             xch, ctx->domid, XEN_DOMCTL_SHADOW_OP_CLEAN,
+             &ctx->save.dirty_bitmap_hbuf, ctx->save.p2m_size,
+             0, &bitmap_stats) != ctx->save.p2m_size )
+    {
+        PERROR("Failed to retrieve logdirty bitmap");
+        return -1;
+    }
+
+    if ( !ctx->save.dirty_pfns_size )
+    {
+        *stats = bitmap_stats;
+        return 0;
+    }
+
+    /*
+     * The list filled up.  Merge it with the rest, now in the bitmap.  The
+     * list's stats cover everything dirty at the time, so only pages dirtied
+     * since need adding.
+     */
+    for ( i = 0; i < ctx->save.dirty_pfns_size; ++i )
+        if ( dirty_pfns[i] < ctx->save.p2m_size )
+            set_bit(dirty_pfns[i], dirty_bitmap);
+
+    stats->dirty_count += bitmap_stats.dirty_count;
+
+    return 0;
+}
+
+static uint64_t get_time_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/*
+ * Mark the start of a checkpoint epoch, with the guest about to be paused.
+ */
+static void start_checkpoint_epoch(struct xc_sr_context *ctx)
+{
+    ctx->save.checkpoint.bytes = 0;
+    ctx->save.checkpoint.suspend_ns = get_time_ns();
+    ctx->save.checkpoint.written_ns = 0;
+}
+
+/*
+ * Transmit a staged checkpoint.  The guest has been resumed by now, so this
+ * is no longer on the critical path of the epoch.
+ */
+static int flush_checkpoint(struct xc_sr_context *ctx)
+{
+    xc_interface *xch = ctx->xch;
+    int rc = 0;
+
+    ctx->save.checkpoint.staging = false;
+
+    if ( ctx->save.checkpoint.used &&
+         write_exact(ctx->fd, ctx->save.checkpoint.buf,
+                     ctx->save.checkpoint.used) )
+    {
+        PERROR("Failed to write checkpoint to stream");
+        rc = -1;
+    }
+
+    ctx->save.checkpoint.used = 0;
+    ctx->save.checkpoint.written_ns = get_time_ns();
+
+    return rc;
+}
+
+/*
+ * Per-epoch statistics, in the same form as the precopy ones.  pause_ms is
+ * how long the guest was paused for, and send_rate (bytes/s) covers the
+ * time from pausing the guest until the whole checkpoint was written.
+ */
+static void log_checkpoint_epoch(struct xc_sr_context *ctx,
+                                 uint64_t resume_ns)
+{
+    xc_interface *xch = ctx->xch;
+    uint64_t start = ctx->save.checkpoint.suspend_ns;
+    uint64_t written = ctx->save.checkpoint.written_ns ?: resume_ns;
+    uint64_t elapsed = max_t(uint64_t, written - start, 1);
+
+    IPRINTF("checkpoint: epoch=%u bytes=%"PRIu64" pause_ms=%"PRIu64
+            " transmit_ms=%"PRIu64" send_rate=%"PRIu64,
+            ctx->save.checkpoint.epoch++, ctx->save.checkpoint.bytes,
+            (resume_ns - start) / 1000000, elapsed / 1000000,
+            ctx->save.checkpoint.bytes * 1000000000 / elapsed);
+}
+
+/*
+ * Get or set the scheduler cap of the domain.  Only the credit and credit2
+ * schedulers support capping a domain's vCPU time.
+ */
+static int get_sched_cap(struct xc_sr_context *ctx, uint16_t *cap)
+{
+    xc_interface *xch = ctx->xch;
+    struct xen_domctl_sched_credit credit;
+    struct xen_domctl_sched_credit2 credit2;
+
+    switch ( ctx->save.throttle.sched_id )
+    {
+    case XEN_SCHEDULER_CREDIT:
+        if ( xc_sched_credit_domain_get(xch, ctx->domid, &credit) )
+            return -1;
+        *cap = credit.cap;
+        return 0;
+
+    case XEN_SCHEDULER_CREDIT2:
+        if ( xc_sched_credit2_domain_get(xch, ctx->domid, &credit2) )
+            return -1;
+        *cap = credit2.cap;
+        return 0;
+    }
+
+    errno = EOPNOTSUPP;
+    return -1;
+}
+
+static int set_sched_cap(struct xc_sr_context *ctx, uint16_t cap)
+{
+    xc_interface *xch = ctx->xch;
+    struct xen_domctl_sched_credit credit;
+    struct xen_domctl_sched_credit2 credit2;
+
+    switch ( ctx->save.throttle.sched_id )
+    {
+    case XEN_SCHEDULER_CREDIT:
+        if ( xc_sched_credit_domain_get(xch, ctx->domid, &credit) )
+            return -1;
+        credit.cap = cap;
+        return xc_sched_credit_domain_set(xch, ctx->domid, &credit);
+
+    case XEN_SCHEDULER_CREDIT2:
+        if ( xc_sched_credit2_domain_get(xch, ctx->domid, &credit2) )
+            return -1;
+        credit2.cap = cap;
+        return xc_sched_credit2_domain_set(xch, ctx->domid, &credit2);
+    }
+
+    errno = EOPNOTSUPP;
+    return -1;
+}
+
+/*
+ * Work out whether the guest can be throttled during precopy, by looking at
+ * the scheduler of its cpupool.  Sets stats.throttle_pct to 100 if so, or 0
+ * if throttling is unavailable.
+ */
+static void init_throttle(struct xc_sr_context *ctx)
+{
+    xc_interface *xch = ctx->xch;
+    xc_cpupoolinfo_t *info;
+
+    ctx->save.stats.throttle_pct = 0;
+    ctx->save.throttle.sched_id = 0;
+
+    info = xc_cpupool_getinfo(xch, ctx->dominfo.cpupool);
+    if ( info )
+    {
+        if ( info->cpupool_id == ctx->dominfo.cpupool )
+            ctx->save.throttle.sched_id = info->sched_id;
+        xc_cpupool_infofree(xch, info);
+    }
+
+    if ( get_sched_cap(ctx, &ctx->save.throttle.orig_cap) )
+    {
+        DPRINTF("vCPU throttling unavailable (scheduler %u)",
+                ctx->save.throttle.sched_id);
+        return;
+    }
+
+    ctx->save.stats.throttle_pct = 100;
+}
+
+/*
+ * Halve the vCPU time available to the guest, relative to its original cap
+ * (or to all of its vCPUs if it was uncapped).  Failure is not fatal; the
+ * migration carries on unthrottled.
+ */
+static void throttle_domain(struct xc_sr_context *ctx)
+{
+    xc_interface *xch = ctx->xch;
+    unsigned int pct = max(ctx->save.stats.throttle_pct / 2, 1U);
+    unsigned long full = ctx->save.throttle.orig_cap ?:
+        (ctx->dominfo.max_vcpu_id + 1) * 100UL;
+    uint16_t cap = min(max(full * pct / 100, 1UL), (unsigned long)UINT16_MAX);
+
+    if ( !ctx->save.stats.throttle_pct )
+        return;
+
+    if ( set_sched_cap(ctx, cap) )
+    {
+        PERROR("Failed to throttle guest to %u%%, continuing unthrottled",
+               pct);
+        ctx->save.stats.throttle_pct = 0;
+        return;
+    }
+
+    ctx->save.throttle.active = true;
+    ctx->save.stats.throttle_pct = pct;
+    DPRINTF("Throttled guest to %u%% (cap %u)", pct, cap);
+}
+
+static void unthrottle_domain(struct xc_sr_context *ctx)
+{
+    xc_interface *xch = ctx->xch;
+
+    if ( !ctx->save.throttle.active )
+        return;
+
+    if ( set_sched_cap(ctx, ctx->save.throttle.orig_cap) )
+        PERROR("Failed to restore scheduler cap %u",
+               ctx->save.throttle.orig_cap);
+
+    ctx->save.throttle.active = false;
+}
+
+/*
+ * Account for a precopy round having sent 'pages' pages since
+ * round_start_ns.
+ */
+static void update_send_rate(struct xc_sr_context *ctx, unsigned long pages)
+{
+    uint64_t elapsed = max_t(uint64_t,
+                             get_time_ns() - ctx->save.round_start_ns, 1);
+
+    ctx->save.stats.send_rate = pages * 1000000000ULL / elapsed;
+}
+
+/*
+ * Account for 'pages' having been dirtied since logdirty_start_ns, and
+ * predict how long a stop-and-copy of them would take at the current send
+ * rate.
+ */
+static void update_dirty_rate(struct xc_sr_context *ctx, unsigned long pages)
+{
+    struct precopy_stats *stats = &ctx->save.stats;
+    uint64_t now = get_time_ns();
+    uint64_t elapsed = max_t(uint64_t, now - ctx->save.logdirty_start_ns, 1);
+
+    ctx->save.logdirty_start_ns = now;
+    stats->dirty_rate = pages * 1000000000ULL / elapsed;
+    stats->predicted_downtime_ms =
+        stats->send_rate ? pages * 1000ULL / stats->send_rate : 0;
+}
+
+/*
+ * Per-round statistics, in a fixed key=value form so they can be picked out
+ * of the toolstack log.
+ */
+static void log_precopy_round(struct xc_sr_context *ctx, unsigned long sent)
+{
+    xc_interface *xch = ctx->xch;
+    const struct precopy_stats *stats = &ctx->save.stats;
+
+    IPRINTF("precopy: iteration=%u sent=%lu dirty=%ld dirty_rate=%lu "
+            "send_rate=%lu predicted_downtime_ms=%lu throttle_pct=%u",
+            stats->iteration, sent, stats->dirty_count, stats->dirty_rate,
+            stats->send_rate, stats->predicted_downtime_ms,
+            stats->throttle_pct);
+}
+
 static int update_progress_string(struct xc_sr_context *ctx, char **str)
 {
     xc_interface *xch = ctx->xch;
@@ -472,21 +1030,55 @@ static int update_progress_string(struct xc_sr_context *ctx, char **str)
  * the precopy phase of live migrations, and is responsible for deciding when
  * the precopy phase should terminate and what should be done next.
  *
- * The policy implemented here behaves identically to the policy previously
- * hard-coded into xc_domain_save() - it proceeds to the stop-and-copy phase of
- * the live migration when there are either fewer than 50 dirty pages, or more
- * than 5 precopy rounds have completed.
+ * The policy implemented here proceeds to the stop-and-copy phase of the live
+ * migration when there are fewer than 50 dirty pages, when the remaining
+ * dirty pages are predicted to be sent within 300ms, or when 10 precopy
+ * rounds have completed.  If the guest dirties memory at more than half the
+ * rate it can be sent, the precopy is not converging usefully; the guest is
+ * throttled further if possible, and stopped and copied otherwise.
  */
-#define SPP_MAX_ITERATIONS      5
-#define SPP_TARGET_DIRTY_COUNT 50
+#define SPP_MAX_ITERATIONS      10
+#define SPP_TARGET_DIRTY_COUNT  50
+#define SPP_TARGET_DOWNTIME_MS 300
+#define SPP_MIN_THROTTLE_PCT    20
 
 static int simple_precopy_policy(struct precopy_stats stats, void *user)
 {
-    return ((stats.dirty_count >= 0 &&
-             stats.dirty_count < SPP_TARGET_DIRTY_COUNT) ||
-            stats.iteration >= SPP_MAX_ITERATIONS)
-        ? XGS_POLICY_STOP_AND_COPY
-        : XGS_POLICY_CONTINUE_PRECOPY;
+    if ( stats.iteration >= SPP_MAX_ITERATIONS )
+        return XGS_POLICY_STOP_AND_COPY;
+
+    /* Nothing new to base a decision on until the dirty count is known. */
+    if ( stats.dirty_count < 0 || stats.send_rate == 0 )
+        return XGS_POLICY_CONTINUE_PRECOPY;
+
+    if ( stats.dirty_count < SPP_TARGET_DIRTY_COUNT ||
+         stats.predicted_downtime_ms <= SPP_TARGET_DOWNTIME_MS )
+        return XGS_POLICY_STOP_AND_COPY;
+
+    if ( stats.dirty_rate * 2 >= stats.send_rate )
+        return stats.throttle_pct > SPP_MIN_THROTTLE_PCT
+            ? XGS_POLICY_THROTTLE
+            : XGS_POLICY_STOP_AND_COPY;
+
+    return XGS_POLICY_CONTINUE_PRECOPY;
+}
+
+/*
+ * Ask the precopy policy what to do next, carrying out any throttling it
+ * asks for.
+ */
+static int precopy_decision(struct xc_sr_context *ctx,
+                            precopy_policy_t precopy_policy, void *data)
+{
+    int policy_decision = precopy_policy(ctx->save.stats, data);
+
+    if ( policy_decision == XGS_POLICY_THROTTLE )
+    {
+        throttle_domain(ctx);
+        policy_decision = XGS_POLICY_CONTINUE_PRECOPY;
+    }
+
+    return policy_decision;
 }
 
 /*
@@ -517,15 +1109,20 @@ static int send_memory_live(struct xc_sr_context *ctx)
         .dirty_count = ctx->save.p2m_size,
     };
     policy_stats = &ctx->save.stats;
+    init_throttle(ctx);
 
     if ( precopy_policy == NULL )
         precopy_policy = simple_precopy_policy;
 
     bitmap_set(dirty_bitmap, ctx->save.p2m_size);
+    ctx->save.nr_dirty_pfns = -1;
+    ctx->save.logdirty_start_ns = get_time_ns();
 
     for ( ; ; )
     {
-        policy_decision = precopy_policy(*policy_stats, data);
+        unsigned long sent;
+
+        policy_decision = precopy_decision(ctx, precopy_policy, data);
         x++;
 
         if ( stats.dirty_count > 0 && policy_decision != XGS_POLICY_ABORT )
@@ -534,35 +1131,38 @@ static int send_memory_live(struct xc_sr_context *ctx)
             if ( rc )
                 goto out;
 
-            rc = send_dirty_pages(ctx, stats.dirty_count);
+            ctx->save.round_start_ns = get_time_ns();
+
+            if ( ctx->save.nr_dirty_pfns < 0 )
+                rc = send_dirty_pages(ctx, stats.dirty_count);
+            else
+                rc = send_dirty_pfn_list(ctx);
             if ( rc )
                 goto out;
+
+            update_send_rate(ctx, stats.dirty_count);
         }
 
         if ( policy_decision != XGS_POLICY_CONTINUE_PRECOPY )
             break;
 
+        sent = policy_stats->dirty_count;
         policy_stats->iteration     = x;
         policy_stats->total_written += policy_stats->dirty_count;
         policy_stats->dirty_count   = -1;
 
-        policy_decision = precopy_policy(*policy_stats, data);
+        policy_decision = precopy_decision(ctx, precopy_policy, data);
 
         if ( policy_decision != XGS_POLICY_CONTINUE_PRECOPY )
             break;
 
-        if ( xc_logdirty_control(
-                 xch, ctx->domid, XEN_DOMCTL_SHADOW_OP_CLEAN,
-                 &ctx->save.dirty_bitmap_hbuf, ctx->save.p2m_size,
-                 0, &stats) != ctx->save.p2m_size )
-        {
-            PERROR("Failed to retrieve logdirty bitmap");
-            rc = -1;
+        rc = get_dirty_pages(ctx, &stats);
+        if ( rc )
             goto out;
-        }
 
         policy_stats->dirty_count = stats.dirty_count;
-
+        update_dirty_rate(ctx, stats.dirty_count);
+        log_precopy_round(ctx, sent);
     }
 
     if ( policy_decision == XGS_POLICY_ABORT )
@@ -644,10 +1244,22 @@ static int suspend_and_send_dirty(struct xc_sr_context *ctx)
     DECLARE_HYPERCALL_BUFFER_SHADOW(unsigned long, dirty_bitmap,
                                     &ctx->save.dirty_bitmap_hbuf);
 
+    if ( ctx->stream_type != XC_STREAM_PLAIN )
+        start_checkpoint_epoch(ctx);
+
     rc = suspend_domain(ctx);
     if ( rc )
         goto out;
 
+    /*
+     * For Remus, nothing else is written to the stream until the guest has
+     * been resumed, so stage the checkpoint and transmit it afterwards.
+     * COLO needs the checkpoint transmitted before the checkpoint callback
+     * adds device state to the stream, so can't benefit.
+     */
+    if ( ctx->stream_type == XC_STREAM_REMUS )
+        ctx->save.checkpoint.staging = true;
+
     if ( xc_logdirty_control(
              xch, ctx->domid, XEN_DOMCTL_SHADOW_OP_CLEAN,
              HYPERCALL_BUFFER(dirty_bitmap), ctx->save.p2m_size,
@@ -747,6 +1359,9 @@ static int send_domain_memory_live(struct xc_sr_context *ctx)
     if ( rc )
         goto out;
 
+    /* The guest is suspended; its original scheduler cap can be restored. */
+    unthrottle_domain(ctx);
+
     if ( ctx->save.debug && ctx->stream_type == XC_STREAM_PLAIN )
     {
         rc = verify_frames(ctx);
@@ -789,12 +1404,22 @@ static int send_domain_memory_nonlive(struct xc_sr_context *ctx)
     return rc;
 }
 
+/*
+ * The dirty pfn list takes an eighth of the memory of the dirty bitmap.
+ * Rounds dirtying more than 1/512th of the guest's pages fall back to the
+ * bitmap.
+ */
+#define DIRTY_PFNS_SIZE(p2m_size) \
+    (bitmap_size(p2m_size) / 8 / sizeof(uint64_t) ?: 1)
+
 static int setup(struct xc_sr_context *ctx)
 {
     xc_interface *xch = ctx->xch;
     int rc;
     DECLARE_HYPERCALL_BUFFER_SHADOW(unsigned long, dirty_bitmap,
                                     &ctx->save.dirty_bitmap_hbuf);
+    DECLARE_HYPERCALL_BUFFER_SHADOW(uint64_t, dirty_pfns,
+                                    &ctx->save.dirty_pfns_hbuf);
 
     rc = ctx->save.ops.setup(ctx);
     if ( rc )
@@ -802,19 +1427,26 @@ static int setup(struct xc_sr_context *ctx)
 
     dirty_bitmap = xc_hypercall_buffer_alloc_pages(
         xch, dirty_bitmap, NRPAGES(bitmap_size(ctx->save.p2m_size)));
+    ctx->save.dirty_pfns_size = DIRTY_PFNS_SIZE(ctx->save.p2m_size);
+    dirty_pfns = xc_hypercall_buffer_alloc_pages(
+        xch, dirty_pfns,
+        NRPAGES(ctx->save.dirty_pfns_size * sizeof(*dirty_pfns)));
     ctx->save.batch_pfns = malloc(MAX_BATCH_SIZE *
                                   sizeof(*ctx->save.batch_pfns));
     ctx->save.deferred_pages = bitmap_alloc(ctx->save.p2m_size);
 
-    if ( !ctx->save.batch_pfns || !dirty_bitmap || !ctx->save.deferred_pages )
+    if ( !ctx->save.batch_pfns || !dirty_bitmap || !dirty_pfns ||
+         !ctx->save.deferred_pages )
     {
-        ERROR("Unable to allocate memory for dirty bitmaps, batch pfns and"
-              " deferred pages");
+        ERROR("Unable to allocate memory for dirty bitmaps, dirty pfn list,"
+              " batch pfns and deferred pages");
         rc = -1;
         errno = ENOMEM;
         goto err;
     }
 
+    setup_direct_io(ctx);
+
     rc = 0;
 
  err:
@@ -826,16 +1458,25 @@ static void cleanup(struct xc_sr_context *ctx)
     xc_interface *xch = ctx->xch;
     DECLARE_HYPERCALL_BUFFER_SHADOW(unsigned long, dirty_bitmap,
                                     &ctx->save.dirty_bitmap_hbuf);
+    DECLARE_HYPERCALL_BUFFER_SHADOW(uint64_t, dirty_pfns,
+                                    &ctx->save.dirty_pfns_hbuf);
 
 
     xc_shadow_control(xch, ctx->domid, XEN_DOMCTL_SHADOW_OP_OFF,
                       NULL, 0);
 
+    unthrottle_domain(ctx);
+    finish_direct_io(ctx, false);
+    free(ctx->save.checkpoint.buf);
+
     if ( ctx->save.ops.cleanup(ctx) )
         PERROR("Failed to clean up");
 
     xc_hypercall_buffer_free_pages(xch, dirty_bitmap,
                                    NRPAGES(bitmap_size(ctx->save.p2m_size)));
+    xc_hypercall_buffer_free_pages(
+        xch, dirty_pfns,
+        NRPAGES(DIRTY_PFNS_SIZE(ctx->save.p2m_size) * sizeof(*dirty_pfns)));
     free(ctx->save.deferred_pages);
     free(ctx->save.batch_pfns);
 }
@@ -846,6 +1487,7 @@ static void cleanup(struct xc_sr_context *ctx)
 static int save(struct xc_sr_context *ctx, uint16_t guest_type)
 {
     xc_interface *xch = ctx->xch;
+    uint64_t resume_ns;
     int rc, saved_rc = 0, saved_errno = 0;
 
     IPRINTF("Saving domain %d, type %s",
@@ -918,6 +1560,8 @@ static int save(struct xc_sr_context *ctx, uint16_t guest_type)
 
             if ( ctx->stream_type == XC_STREAM_COLO )
             {
+                ctx->save.checkpoint.written_ns = get_time_ns();
+
                 rc = ctx->save.callbacks->checkpoint(ctx->save.callbacks->data);
                 if ( !rc )
                 {
@@ -930,6 +1574,17 @@ static int save(struct xc_sr_context *ctx, uint16_t guest_type)
             if ( rc <= 0 )
                 goto err;
 
+            resume_ns = get_time_ns();
+
+            if ( ctx->save.checkpoint.staging )
+            {
+                rc = flush_checkpoint(ctx);
+                if ( rc )
+                    goto err;
+            }
+
+            log_checkpoint_epoch(ctx, resume_ns);
+
             if ( ctx->stream_type == XC_STREAM_COLO )
             {
                 rc = ctx->save.callbacks->wait_checkpoint(
@@ -958,6 +1613,13 @@ static int save(struct xc_sr_context *ctx, uint16_t guest_type)
     if ( rc )
         goto err;
 
+    rc = finish_direct_io(ctx, true);
+    if ( rc )
+    {
+        PERROR("Unable to flush stream");
+        goto err;
+    }
+
     xc_report_progress_single(xch, "Complete");
     goto done;
 
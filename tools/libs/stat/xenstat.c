@@ -71,7 +71,9 @@ static xenstat_collector collectors[] = {
 	{ XENSTAT_XEN_VERSION, xenstat_collect_xen_version,
 	  xenstat_free_xen_version, xenstat_uninit_xen_version },
 	{ XENSTAT_VBD, xenstat_collect_vbds,
-	  xenstat_free_vbds, xenstat_uninit_vbds }
+	  xenstat_free_vbds, xenstat_uninit_vbds },
+	{ XENSTAT_EXITS, xenstat_collect_exits,
+	  xenstat_free_exits, xenstat_uninit_exits }
 };
 
 #define NUM_COLLECTORS (sizeof(collectors)/sizeof(xenstat_collector))
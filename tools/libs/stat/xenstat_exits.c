@@ -0,0 +1,338 @@
+/* libxenstat: statistics-collection library for Xen
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ */
+
+/*
+ * VM exit and hypercall counts, summed over the vcpus of each domain, from
+ * XEN_DOMCTL_get_exit_stats.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "xenstat_priv.h"
+
+#if defined(__i386__) || defined(__x86_64__)
+
+#define NR_EXITS      (XEN_DOMCTL_EXIT_STATS_SVM_NPF + 1)
+#define NR_HYPERCALLS 64
+
+static const char *const vmx_exit_names[] = {
+	[0]  = "EXCEPTION_NMI",
+	[1]  = "EXTERNAL_INTERRUPT",
+	[2]  = "TRIPLE_FAULT",
+	[3]  = "INIT",
+	[4]  = "SIPI",
+	[5]  = "IO_SMI",
+	[6]  = "OTHER_SMI",
+	[7]  = "PENDING_VIRT_INTR",
+	[8]  = "PENDING_VIRT_NMI",
+	[9]  = "TASK_SWITCH",
+	[10] = "CPUID",
+	[11] = "GETSEC",
+	[12] = "HLT",
+	[13] = "INVD",
+	[14] = "INVLPG",
+	[15] = "RDPMC",
+	[16] = "RDTSC",
+	[17] = "RSM",
+	[18] = "VMCALL",
+	[19] = "VMCLEAR",
+	[20] = "VMLAUNCH",
+	[21] = "VMPTRLD",
+	[22] = "VMPTRST",
+	[23] = "VMREAD",
+	[24] = "VMRESUME",
+	[25] = "VMWRITE",
+	[26] = "VMXOFF",
+	[27] = "VMXON",
+	[28] = "CR_ACCESS",
+	[29] = "DR_ACCESS",
+	[30] = "IO_INSTRUCTION",
+	[31] = "MSR_READ",
+	[32] = "MSR_WRITE",
+	[33] = "INVALID_GUEST_STATE",
+	[34] = "MSR_LOADING",
+	[36] = "MWAIT",
+	[37] = "MONITOR_TRAP_FLAG",
+	[39] = "MONITOR",
+	[40] = "PAUSE",
+	[41] = "MCE_DURING_VMENTRY",
+	[43] = "TPR_BELOW_THRESHOLD",
+	[44] = "APIC_ACCESS",
+	[45] = "EOI_INDUCED",
+	[46] = "ACCESS_GDTR_OR_IDTR",
+	[47] = "ACCESS_LDTR_OR_TR",
+	[48] = "EPT_VIOLATION",
+	[49] = "EPT_MISCONFIG",
+	[50] = "INVEPT",
+	[51] = "RDTSCP",
+	[52] = "PREEMPTION_TIMER",
+	[53] = "INVVPID",
+	[54] = "WBINVD",
+	[55] = "XSETBV",
+	[56] = "APIC_WRITE",
+	[58] = "INVPCID",
+	[59] = "VMFUNC",
+	[62] = "PML_FULL",
+	[63] = "XSAVES",
+	[64] = "XRSTORS",
+	[74] = "BUS_LOCK",
+	[75] = "NOTIFY",
+};
+
+static const char *const svm_exit_names[] = {
+	[0x60] = "INTR",
+	[0x61] = "NMI",
+	[0x62] = "SMI",
+	[0x63] = "INIT",
+	[0x64] = "VINTR",
+	[0x65] = "CR0_SEL_WRITE",
+	[0x66] = "IDTR_READ",
+	[0x67] = "GDTR_READ",
+	[0x68] = "LDTR_READ",
+	[0x69] = "TR_READ",
+	[0x6a] = "IDTR_WRITE",
+	[0x6b] = "GDTR_WRITE",
+	[0x6c] = "LDTR_WRITE",
+	[0x6d] = "TR_WRITE",
+	[0x6e] = "RDTSC",
+	[0x6f] = "RDPMC",
+	[0x70] = "PUSHF",
+	[0x71] = "POPF",
+	[0x72] = "CPUID",
+	[0x73] = "RSM",
+	[0x74] = "IRET",
+	[0x75] = "SWINT",
+	[0x76] = "INVD",
+	[0x77] = "PAUSE",
+	[0x78] = "HLT",
+	[0x79] = "INVLPG",
+	[0x7a] = "INVLPGA",
+	[0x7b] = "IOIO",
+	[0x7c] = "MSR",
+	[0x7d] = "TASK_SWITCH",
+	[0x7e] = "FERR_FREEZE",
+	[0x7f] = "SHUTDOWN",
+	[0x80] = "VMRUN",
+	[0x81] = "VMMCALL",
+	[0x82] = "VMLOAD",
+	[0x83] = "VMSAVE",
+	[0x84] = "STGI",
+	[0x85] = "CLGI",
+	[0x86] = "SKINIT",
+	[0x87] = "RDTSCP",
+	[0x88] = "ICEBP",
+	[0x89] = "WBINVD",
+	[0x8a] = "MONITOR",
+	[0x8b] = "MWAIT",
+	[0x8c] = "MWAIT_CONDITIONAL",
+	[0x8d] = "XSETBV",
+	[0x8e] = "RDPRU",
+	[0xa5] = "BUS_LOCK",
+	[XEN_DOMCTL_EXIT_STATS_SVM_NPF] = "NPF",
+};
+
+static const char *const hypercall_names[NR_HYPERCALLS] = {
+	[__HYPERVISOR_set_trap_table] = "set_trap_table",
+	[__HYPERVISOR_mmu_update] = "mmu_update",
+	[__HYPERVISOR_set_gdt] = "set_gdt",
+	[__HYPERVISOR_stack_switch] = "stack_switch",
+	[__HYPERVISOR_set_callbacks] = "set_callbacks",
+	[__HYPERVISOR_fpu_taskswitch] = "fpu_taskswitch",
+	[__HYPERVISOR_sched_op_compat] = "sched_op_compat",
+	[__HYPERVISOR_platform_op] = "platform_op",
+	[__HYPERVISOR_set_debugreg] = "set_debugreg",
+	[__HYPERVISOR_get_debugreg] = "get_debugreg",
+	[__HYPERVISOR_update_descriptor] = "update_descriptor",
+	[__HYPERVISOR_memory_op] = "memory_op",
+	[__HYPERVISOR_multicall] = "multicall",
+	[__HYPERVISOR_update_va_mapping] = "update_va_mapping",
+	[__HYPERVISOR_set_timer_op] = "set_timer_op",
+	[__HYPERVISOR_event_channel_op_compat] = "event_channel_op_compat",
+	[__HYPERVISOR_xen_version] = "xen_version",
+	[__HYPERVISOR_console_io] = "console_io",
+	[__HYPERVISOR_physdev_op_compat] = "physdev_op_compat",
+	[__HYPERVISOR_grant_table_op] = "grant_table_op",
+	[__HYPERVISOR_vm_assist] = "vm_assist",
+	[__HYPERVISOR_update_va_mapping_otherdomain] =
+		"update_va_mapping_otherdomain",
+	[__HYPERVISOR_iret] = "iret",
+	[__HYPERVISOR_vcpu_op] = "vcpu_op",
+	[__HYPERVISOR_set_segment_base] = "set_segment_base",
+	[__HYPERVISOR_mmuext_op] = "mmuext_op",
+	[__HYPERVISOR_xsm_op] = "xsm_op",
+	[__HYPERVISOR_nmi_op] = "nmi_op",
+	[__HYPERVISOR_sched_op] = "sched_op",
+	[__HYPERVISOR_callback_op] = "callback_op",
+	[__HYPERVISOR_event_channel_op] = "event_channel_op",
+	[__HYPERVISOR_physdev_op] = "physdev_op",
+	[__HYPERVISOR_hvm_op] = "hvm_op",
+	[__HYPERVISOR_sysctl] = "sysctl",
+	[__HYPERVISOR_domctl] = "domctl",
+	[__HYPERVISOR_kexec_op] = "kexec_op",
+	[__HYPERVISOR_argo_op] = "argo_op",
+	[__HYPERVISOR_xenpmu_op] = "xenpmu_op",
+	[__HYPERVISOR_dm_op] = "dm_op",
+	[__HYPERVISOR_hypfs_op] = "hypfs_op",
+	[__HYPERVISOR_arch_0] = "mca",
+};
+
+static void sum_stats(unsigned long long *sum, const xc_exit_stat_t *stats,
+		      unsigned int nr)
+{
+	unsigned int i;
+
+	for (i = 0; i < nr; i++)
+		sum[i] += stats[i].count;
+}
+
+/* Collect exit and hypercall counts of all domains */
+int xenstat_collect_exits(xenstat_node * node)
+{
+	xc_exit_stat_t exits[NR_EXITS], hypercalls[NR_HYPERCALLS];
+	unsigned int i, vcpu;
+
+	for (i = 0; i < node->num_domains; i++) {
+		xenstat_domain *domain = &node->domains[i];
+
+		domain->exits = calloc(NR_EXITS, sizeof(*domain->exits));
+		domain->hypercalls = calloc(NR_HYPERCALLS,
+					    sizeof(*domain->hypercalls));
+		if (domain->exits == NULL || domain->hypercalls == NULL)
+			return 0;
+
+		for (vcpu = 0; vcpu < domain->num_vcpus; vcpu++) {
+			uint32_t type, nr_exits = NR_EXITS;
+			uint32_t nr_hypercalls = NR_HYPERCALLS;
+
+			/*
+			 * Not all vcpus may exist, and the statistics may be
+			 * compiled out: report what is available.
+			 */
+			if (xc_vcpu_get_exit_stats(node->handle->xc_handle,
+						   domain->id, vcpu, &type,
+						   exits, &nr_exits,
+						   hypercalls, &nr_hypercalls))
+				continue;
+
+			domain->exit_type = type;
+			sum_stats(domain->exits, exits,
+				  nr_exits < NR_EXITS ? nr_exits : NR_EXITS);
+			sum_stats(domain->hypercalls, hypercalls,
+				  nr_hypercalls < NR_HYPERCALLS ?
+				  nr_hypercalls : NR_HYPERCALLS);
+			domain->num_exits = NR_EXITS;
+			domain->num_hypercalls = NR_HYPERCALLS;
+		}
+
+		if (domain->exit_type == XEN_DOMCTL_EXIT_STATS_pv)
+			domain->num_exits = 0;
+	}
+
+	return 1;
+}
+
+const char *xenstat_domain_exit_name(xenstat_domain * domain,
+				     unsigned int reason)
+{
+	switch (domain->exit_type) {
+	case XEN_DOMCTL_EXIT_STATS_vmx:
+		if (reason < sizeof(vmx_exit_names) / sizeof(*vmx_exit_names))
+			return vmx_exit_names[reason];
+		break;
+
+	case XEN_DOMCTL_EXIT_STATS_svm:
+		if (reason < 0x10)
+			return "CR_READ";
+		if (reason < 0x20)
+			return "CR_WRITE";
+		if (reason < 0x30)
+			return "DR_READ";
+		if (reason < 0x40)
+			return "DR_WRITE";
+		if (reason < 0x60)
+			return "EXCEPTION";
+		if (reason < sizeof(svm_exit_names) / sizeof(*svm_exit_names))
+			return svm_exit_names[reason];
+		break;
+	}
+
+	return NULL;
+}
+
+const char *xenstat_hypercall_name(unsigned int nr)
+{
+	return nr < NR_HYPERCALLS ? hypercall_names[nr] : NULL;
+}
+
+#else
+
+int xenstat_collect_exits(xenstat_node * node)
+{
+	return 1;
+}
+
+const char *xenstat_domain_exit_name(xenstat_domain * domain,
+				     unsigned int reason)
+{
+	return NULL;
+}
+
+const char *xenstat_hypercall_name(unsigned int nr)
+{
+	return NULL;
+}
+
+#endif
+
+/* Free exit information */
+void xenstat_free_exits(xenstat_node * node)
+{
+	unsigned int i;
+
+	for (i = 0; i < node->num_domains; i++) {
+		free(node->domains[i].exits);
+		free(node->domains[i].hypercalls);
+	}
+}
+
+/* Free exit information in handle - nothing to do */
+void xenstat_uninit_exits(xenstat_handle * handle)
+{
+}
+
+/* Get the number of exit reasons of a domain, 0 for PV domains */
+unsigned int xenstat_domain_num_exits(xenstat_domain * domain)
+{
+	return domain->num_exits;
+}
+
+/* Get the number of exits of a domain with a given reason */
+unsigned long long xenstat_domain_exits(xenstat_domain * domain,
+					unsigned int reason)
+{
+	return reason < domain->num_exits ? domain->exits[reason] : 0;
+}
+
+/* Get the number of hypercalls numbers of a domain */
+unsigned int xenstat_domain_num_hypercalls(xenstat_domain * domain)
+{
+	return domain->num_hypercalls;
+}
+
+/* Get the number of hypercalls of a domain with a given number */
+unsigned long long xenstat_domain_hypercalls(xenstat_domain * domain,
+					     unsigned int nr)
+{
+	return nr < domain->num_hypercalls ? domain->hypercalls[nr] : 0;
+}
@@ -66,6 +66,11 @@ struct xenstat_domain {
 	xenstat_network *networks;	/* Array of length num_networks */
 	unsigned int num_vbds;
 	xenstat_vbd *vbds;
+	unsigned int exit_type;		/* XEN_DOMCTL_EXIT_STATS_* */
+	unsigned int num_exits;
+	unsigned long long *exits;	/* Array of length num_exits */
+	unsigned int num_hypercalls;
+	unsigned long long *hypercalls;	/* Array of length num_hypercalls */
 };
 
 struct xenstat_vcpu {
@@ -121,5 +126,8 @@ extern int xenstat_collect_vbds(xenstat_node * node);
 extern void xenstat_uninit_vbds(xenstat_handle * handle);
 extern void read_attributes_qdisk(xenstat_node * node);
 extern xenstat_vbd *xenstat_save_vbd(xenstat_domain * domain, xenstat_vbd * vbd);
+extern int xenstat_collect_exits(xenstat_node * node);
+extern void xenstat_free_exits(xenstat_node * node);
+extern void xenstat_uninit_exits(xenstat_handle * handle);
 
 #endif /* XENSTAT_PRIV_H */
@@ -0,0 +1,249 @@
+/*
+ * xenbench.c: Run the hypervisor microbenchmarks (XEN_SYSCTL_microbench_op).
+ *
+ * Results are per operation: the fastest batch is the figure to compare,
+ * the average and slowest batch show how noisy the run was.
+ *
+ * With --notify, event channel notifications are instead timed from user
+ * space, through the evtchn driver, on a loopback channel.
+ */
+
+#include <errno.h>
+#include <getopt.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <xenctrl.h>
+#include <xenevtchn.h>
+
+static xc_interface *xch;
+static xenevtchn_handle *xce;
+static evtchn_port_t send_port;
+
+static void usage(const char *prog)
+{
+    printf("Usage: %s [OPTIONS] [BENCHMARK...]\n"
+           "Run microbenchmarks of hypervisor primitives (requires a Xen built\n"
+           "with CONFIG_MICROBENCH), by default all of them.\n"
+           "\n"
+           "  -l, --list            list the benchmarks and their defaults\n"
+           "  -n, --iterations=N    operations per batch\n"
+           "  -b, --batches=N       number of batches\n"
+           "  -N, --notify=N        time N event channel notifications from user\n"
+           "                        space, and N / 100 round trips\n"
+           "  -h, --help            this help\n", prog);
+}
+
+/*
+ * A loopback channel: sends on one end are delivered to the other, both
+ * bound by this process.
+ */
+static int setup_evtchn(void)
+{
+    xenevtchn_port_or_error_t port;
+
+    xce = xenevtchn_open(NULL, 0);
+    if ( !xce )
+        return -1;
+
+    port = xenevtchn_bind_unbound_port(xce, DOMID_SELF);
+    if ( port < 0 )
+        return -1;
+
+    if ( xenevtchn_bind_interdomain(xce, DOMID_SELF, port) < 0 )
+        return -1;
+    send_port = port;
+
+    return 0;
+}
+
+static double now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/*
+ * Throughput: back to back notifications, delivered to a port left pending.
+ * Latency: notify, wait for the event to be read from the driver, unmask.
+ */
+static int bench_notify(unsigned int count)
+{
+    unsigned int i, trips = count / 100 ?: 1;
+    double t0, t1, t2;
+
+    t0 = now_ns();
+    for ( i = 0; i < count; i++ )
+        if ( xenevtchn_notify(xce, send_port) )
+            return -1;
+    t1 = now_ns();
+
+    /* Drain the event left pending by the loop above. */
+    for ( i = 0; i <= trips; i++ )
+    {
+        xenevtchn_port_or_error_t port;
+
+        if ( i == 1 )
+            t1 = now_ns();
+        if ( i && xenevtchn_notify(xce, send_port) )
+            return -1;
+        port = xenevtchn_pending(xce);
+        if ( port < 0 || xenevtchn_unmask(xce, port) )
+            return -1;
+    }
+    t2 = now_ns();
+
+    printf("%-20s %10u %10.1f ns %10.0f /s\n", "notify", count,
+           (t1 - t0) / count, count * 1e9 / (t1 - t0));
+    printf("%-20s %10u %10.1f ns\n", "notify round trip", trips,
+           (t2 - t1) / trips);
+
+    return 0;
+}
+
+static bool selected(const char *name, int argc, char *argv[])
+{
+    int i;
+
+    if ( optind == argc )
+        return true;
+
+    for ( i = optind; i < argc; i++ )
+        if ( !strcmp(argv[i], name) )
+            return true;
+
+    return false;
+}
+
+int main(int argc, char *argv[])
+{
+    static const struct option opts[] = {
+        { "list",       no_argument,       NULL, 'l' },
+        { "iterations", required_argument, NULL, 'n' },
+        { "batches",    required_argument, NULL, 'b' },
+        { "notify",     required_argument, NULL, 'N' },
+        { "help",       no_argument,       NULL, 'h' },
+        { NULL, 0, NULL, 0 },
+    };
+    unsigned int iterations = 0, batches = 0, notify = 0, nr, i;
+    bool list = false;
+    xc_microbench_t op = {};
+    int c, rc = 1;
+
+    while ( (c = getopt_long(argc, argv, "ln:b:N:h", opts, NULL)) != -1 )
+    {
+        switch ( c )
+        {
+        case 'l': list = true; break;
+        case 'n': iterations = strtoul(optarg, NULL, 0); break;
+        case 'b': batches = strtoul(optarg, NULL, 0); break;
+        case 'N': notify = strtoul(optarg, NULL, 0); break;
+        case 'h': usage(argv[0]); return 0;
+        default:  usage(argv[0]); return 1;
+        }
+    }
+
+    if ( notify )
+    {
+        rc = setup_evtchn() || bench_notify(notify);
+        if ( rc )
+            fprintf(stderr, "Event channel notification failed: %d (%s)\n",
+                    errno, strerror(errno));
+
+        if ( xce )
+            xenevtchn_close(xce);
+
+        return rc;
+    }
+
+    xch = xc_interface_open(0, 0, 0);
+    if ( !xch )
+    {
+        fprintf(stderr, "Error opening xc interface: %d (%s)\n",
+                errno, strerror(errno));
+        return 1;
+    }
+
+    if ( xc_microbench_info(xch, &op) )
+    {
+        fprintf(stderr, "Error querying benchmarks: %d (%s)\n",
+                errno, strerror(errno));
+        goto out;
+    }
+    nr = op.nr_benchmarks;
+
+    if ( list )
+    {
+        printf("%-20s %10s %8s\n", "benchmark", "iterations", "batches");
+        for ( i = 0; i < nr; i++ )
+        {
+            op = (xc_microbench_t){ .index = i };
+            if ( xc_microbench_info(xch, &op) )
+                goto out;
+            printf("%-20s %10u %8u\n", op.name, op.iterations, op.nr_batches);
+        }
+        rc = 0;
+        goto out;
+    }
+
+    if ( setup_evtchn() )
+        fprintf(stderr, "No loopback event channel, evtchn_send skipped: "
+                "%d (%s)\n", errno, strerror(errno));
+
+    printf("%-20s %10s %8s %10s %10s %10s %10s\n", "benchmark", "iterations",
+           "batches", "min cyc", "avg cyc", "max cyc", "avg ns");
+
+    for ( i = 0; i < nr; i++ )
+    {
+        uint64_t ops;
+
+        op = (xc_microbench_t){ .index = i };
+        if ( xc_microbench_info(xch, &op) )
+            goto out;
+        if ( !selected(op.name, argc, argv) )
+            continue;
+
+        op.iterations = iterations;
+        op.nr_batches = batches;
+        op.evtchn_port = send_port;
+        if ( xc_microbench_run(xch, &op) )
+        {
+            printf("%-20s failed: %d (%s)\n", op.name, errno, strerror(errno));
+            continue;
+        }
+
+        ops = (uint64_t)op.iterations * op.nr_batches;
+        printf("%-20s %10u %8u %10"PRIu64" %10"PRIu64" %10"PRIu64" %10"PRIu64"\n",
+               op.name, op.iterations, op.nr_batches,
+               op.cycles_min / op.iterations, op.cycles_total / ops,
+               op.cycles_max / op.iterations,
+               op.cycles_khz ? op.cycles_total * 1000000 / op.cycles_khz / ops
+                             : 0);
+    }
+
+    rc = 0;
+
+ out:
+    if ( xce )
+        xenevtchn_close(xce);
+    xc_interface_close(xch);
+
+    return rc;
+}
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * tab-width: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
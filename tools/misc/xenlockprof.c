@@ -17,6 +17,55 @@
 #include <errno.h>
 #include <string.h>
 #include <inttypes.h>
+#include <unistd.h>
+
+static const char *hist_bound(unsigned int bucket, char *buf, size_t size)
+{
+    static const char *const units[] = { "ns", "us", "ms", "s" };
+    uint64_t val = 1ULL << bucket;
+    unsigned int u = 0;
+
+    while ( val >= 1000 && u < 3 )
+    {
+        val /= 1000;
+        u++;
+    }
+    snprintf(buf, size, "%"PRIu64"%s", val, units[u]);
+
+    return buf;
+}
+
+static void print_hist(const char *what, const uint32_t *hist)
+{
+    unsigned int i;
+    char lo[16], hi[16];
+
+    for ( i = 0; i < LOCKPROF_HIST_BUCKETS; i++ )
+    {
+        if ( !hist[i] )
+            continue;
+
+        if ( i == 0 )
+            printf("    %-5s %9s  %-6s: %u\n", what, "", "0", hist[i]);
+        else if ( i == LOCKPROF_HIST_BUCKETS - 1 )
+            printf("    %-5s %9s >= %-6s: %u\n", what, "",
+                   hist_bound(i - 1, lo, sizeof(lo)), hist[i]);
+        else
+            printf("    %-5s %6s .. < %-6s: %u\n", what,
+                   hist_bound(i - 1, lo, sizeof(lo)),
+                   hist_bound(i, hi, sizeof(hi)), hist[i]);
+    }
+}
+
+static void usage(const char *prog)
+{
+    printf("%s: [-r | -e | -d | -H]\n", prog);
+    printf("no args: print lock profile data\n");
+    printf("    -r : reset profile data\n");
+    printf("    -e : reset profile data and start collecting\n");
+    printf("    -d : stop collecting profile data\n");
+    printf("    -H : print hold and wait time histograms too\n");
+}
 
 int main(int argc, char *argv[])
 {
@@ -25,13 +74,36 @@ int main(int argc, char *argv[])
     uint64_t           time;
     double             l, b, sl, sb;
     char               name[100];
+    int                opt, cmd = 0;
+    bool               hist = false;
     DECLARE_HYPERCALL_BUFFER(xc_lockprof_data_t, data);
 
-    if ( (argc > 2) || ((argc == 2) && (strcmp(argv[1], "-r") != 0)) )
+    while ( (opt = getopt(argc, argv, "redH")) != -1 )
+    {
+        switch ( opt )
+        {
+        case 'r':
+        case 'e':
+        case 'd':
+            if ( cmd )
+            {
+                usage(argv[0]);
+                return 1;
+            }
+            cmd = opt;
+            break;
+        case 'H':
+            hist = true;
+            break;
+        default:
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if ( optind < argc || (cmd && hist) )
     {
-        printf("%s: [-r]\n", argv[0]);
-        printf("no args: print lock profile data\n");
-        printf("    -r : reset profile data\n");
+        usage(argv[0]);
         return 1;
     }
 
@@ -42,11 +114,16 @@ int main(int argc, char *argv[])
         return 1;
     }
 
-    if ( argc > 1 )
+    if ( cmd )
     {
-        if ( xc_lockprof_reset(xc_handle) != 0 )
+        int rc = cmd == 'r' ? xc_lockprof_reset(xc_handle)
+                            : xc_lockprof_enable(xc_handle, cmd == 'e');
+
+        if ( rc != 0 )
         {
-            fprintf(stderr, "Error resetting profile data: %d (%s)\n",
+            fprintf(stderr, "Error %s profile data: %d (%s)\n",
+                    cmd == 'r' ? "resetting" :
+                    cmd == 'e' ? "enabling" : "disabling",
                     errno, strerror(errno));
             return 1;
         }
@@ -108,6 +185,11 @@ int main(int argc, char *argv[])
         printf("%-50s: lock:%12"PRId64"(%20.9fs), "
                "block:%12"PRId64"(%20.9fs)\n",
                name, data[j].lock_cnt, l, data[j].block_cnt, b);
+        if ( hist )
+        {
+            print_hist("hold", data[j].hold_hist);
+            print_hist("wait", data[j].block_hist);
+        }
     }
     l = (double)time / 1E+09;
     printf("total profiling time: %20.9fs\n", l);
@@ -15,7 +15,9 @@
 #include <stdlib.h>
 #include <sys/mman.h>
 #include <errno.h>
+#include <inttypes.h>
 #include <string.h>
+#include <unistd.h>
 
 #define X(name) [__HYPERVISOR_##name] = #name
 static const char *const hypercall_name_table[64] =
@@ -78,6 +80,88 @@ static const char *const hypercall_name_table[64] =
 };
 #undef X
 
+/* Print the rate of each counter which changed, every interval seconds. */
+static int print_rates(xc_interface *xc_handle, unsigned int interval)
+{
+    const xc_perfc_snapshot_t *snap;
+    xc_perfc_sample_t prev = {}, cur = {}, tmp;
+    uint64_t *delta;
+    double *rate;
+    unsigned int i, k;
+
+    snap = xc_perfc_snapshot_map(xc_handle, interval * 1000);
+    if ( snap == NULL )
+    {
+        fprintf(stderr, "Error mapping perf counter snapshot: %d (%s)\n",
+                errno, strerror(errno));
+        return 1;
+    }
+
+    delta = calloc(snap->nr_vals, sizeof(*delta));
+    rate = calloc(snap->nr_vals, sizeof(*rate));
+    if ( delta == NULL || rate == NULL )
+    {
+        fprintf(stderr, "Could not allocate buffers: %d (%s)\n",
+                errno, strerror(errno));
+        return 1;
+    }
+
+    /* The first refresh is asynchronous. */
+    while ( xc_perfc_sample(snap, &prev) != 0 )
+    {
+        if ( errno != EAGAIN )
+            goto error;
+        usleep(1000);
+    }
+
+    for ( ; ; )
+    {
+        sleep(interval);
+
+        if ( xc_perfc_sample(snap, &cur) != 0 ||
+             xc_perfc_sample_delta(snap, &prev, &cur, delta, rate) != 0 )
+        {
+            /* No refresh since the last sample. */
+            if ( errno == EINVAL )
+                continue;
+            goto error;
+        }
+
+        printf("%-35s %12s %12s\n", "", "delta", "per second");
+        for ( i = 0; i < snap->nr_counters; i++ )
+        {
+            const xen_perfc_snapshot_desc_t *d = &snap->desc[i];
+
+            for ( k = 0; k < d->nr_vals; k++ )
+            {
+                char name[sizeof(d->name) + 16];
+
+                if ( !delta[d->offset + k] ||
+                     (d->flags & XEN_PERFC_SNAPSHOT_status) )
+                    continue;
+
+                if ( d->nr_vals > 1 )
+                    snprintf(name, sizeof(name), "%s[%u]", d->name, k);
+                else
+                    snprintf(name, sizeof(name), "%s", d->name);
+                printf("%-35s %12"PRIu64" %12.1f\n", name,
+                       delta[d->offset + k], rate[d->offset + k]);
+            }
+        }
+        printf("\n");
+        fflush(stdout);
+
+        tmp = prev;
+        prev = cur;
+        cur = tmp;
+    }
+
+ error:
+    fprintf(stderr, "Error sampling perf counters: %d (%s)\n",
+            errno, strerror(errno));
+    return 1;
+}
+
 int main(int argc, char *argv[])
 {
     int              i, j;
@@ -86,7 +170,7 @@ int main(int argc, char *argv[])
     DECLARE_HYPERCALL_BUFFER(xc_perfc_val_t, pcv);
     xc_perfc_val_t  *val;
     int num_desc, num_val;
-    unsigned int     reset = 0, full = 0, pretty = 0;
+    unsigned int     reset = 0, full = 0, pretty = 0, interval = 0;
     char hypercall_name[36];
 
     if ( argc > 1 )
@@ -106,6 +190,10 @@ int main(int argc, char *argv[])
             case 'r':
                 reset = 1;
                 break;
+            case 'i':
+                if ( argc < 3 || (interval = atoi(argv[2])) == 0 )
+                    goto error;
+                break;
             default:
                 goto error;
             }
@@ -113,11 +201,12 @@ int main(int argc, char *argv[])
         else
         {
         error:
-            printf("%s: [-r]\n", argv[0]);
+            printf("%s: [-r | -f | -p | -i secs]\n", argv[0]);
             printf("no args: print digested counters\n");
             printf("    -f : print full arrays/histograms\n");
             printf("    -p : print full arrays/histograms in pretty format\n");
             printf("    -r : reset counters\n");
+            printf("    -i secs : print counter rates every secs seconds\n");
             return 0;
         }
     }   
@@ -129,6 +218,9 @@ int main(int argc, char *argv[])
         return 1;
     }
     
+    if ( interval )
+        return print_rates(xc_handle, interval);
+
     if ( reset )
     {
         if ( xc_perfc_reset(xc_handle) != 0 )
@@ -0,0 +1,375 @@
+/*
+ * xensampleprof.c: Collect and symbolise samples from the hypervisor
+ * sampling profiler (XEN_SYSCTL_sample_prof_op).
+ *
+ * Samples of Xen code are attributed to the enclosing hypervisor symbol, as
+ * read with XENPF_get_symtab.  Guest samples are accounted per domain, as
+ * their addresses are meaningless without the guest's symbols.
+ */
+
+#include <errno.h>
+#include <getopt.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <xenctrl.h>
+
+#define SYM_NAME_LEN 128
+#define READ_BATCH   1024
+#define FOLD_BUCKETS 4096
+
+struct sym {
+    uint64_t addr;
+    char name[SYM_NAME_LEN];
+    unsigned long self;
+};
+
+struct fold {
+    struct fold *next;
+    unsigned long count;
+    char stack[];
+};
+
+static xc_interface *xch;
+static struct sym *syms;
+static unsigned int nr_syms;
+static unsigned long *guest_samples;
+static unsigned long nr_samples, nr_idle, nr_unknown, nr_lost;
+static struct fold *folds[FOLD_BUCKETS];
+static bool opt_fold;
+
+static int sym_cmp(const void *a, const void *b)
+{
+    const struct sym *x = a, *y = b;
+
+    return x->addr < y->addr ? -1 : x->addr > y->addr;
+}
+
+static int load_symbols(void)
+{
+    xc_symtab_entry_t *entries;
+    char *names;
+    uint32_t nr, i;
+
+    if ( xc_get_symtab(xch, &entries, &names, &nr) )
+        return -1;
+
+    syms = calloc(nr ?: 1, sizeof(*syms));
+    if ( !syms )
+        goto out;
+
+    for ( i = 0; i < nr; i++ )
+    {
+        /* Only text symbols can contain a sampled instruction pointer. */
+        if ( entries[i].type != 't' && entries[i].type != 'T' )
+            continue;
+
+        syms[nr_syms].addr = entries[i].address;
+        syms[nr_syms].self = 0;
+        snprintf(syms[nr_syms].name, sizeof(syms[nr_syms].name), "%s",
+                 names + entries[i].name);
+        nr_syms++;
+    }
+
+    qsort(syms, nr_syms, sizeof(*syms), sym_cmp);
+
+ out:
+    free(entries);
+    free(names);
+
+    return syms ? 0 : -1;
+}
+
+static struct sym *find_symbol(uint64_t addr)
+{
+    unsigned int lo = 0, hi = nr_syms;
+
+    /* Find the last symbol starting at or before addr. */
+    while ( lo < hi )
+    {
+        unsigned int mid = lo + (hi - lo) / 2;
+
+        if ( syms[mid].addr <= addr )
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    return lo ? &syms[lo - 1] : NULL;
+}
+
+static void fold_add(const char *stack)
+{
+    unsigned int hash = 5381;
+    const char *p;
+    struct fold *f;
+
+    for ( p = stack; *p; p++ )
+        hash = hash * 33 + *p;
+    hash %= FOLD_BUCKETS;
+
+    for ( f = folds[hash]; f; f = f->next )
+        if ( !strcmp(f->stack, stack) )
+        {
+            f->count++;
+            return;
+        }
+
+    f = malloc(sizeof(*f) + strlen(stack) + 1);
+    if ( !f )
+        return;
+    strcpy(f->stack, stack);
+    f->count = 1;
+    f->next = folds[hash];
+    folds[hash] = f;
+}
+
+static void fold_sample(const xc_sample_t *s)
+{
+    char stack[(SYM_NAME_LEN + 1) * (XEN_SYSCTL_SAMPLE_PROF_FRAMES + 2)];
+    size_t len = 0;
+    int i;
+
+    if ( s->flags & XEN_SYSCTL_SAMPLE_guest )
+    {
+        snprintf(stack, sizeof(stack), "d%u", s->domid);
+        fold_add(stack);
+        return;
+    }
+
+    len = snprintf(stack, sizeof(stack), "xen");
+
+    /* Outermost caller first, as expected by flame graph tools. */
+    for ( i = s->nr_frames; i >= 0; i-- )
+    {
+        uint64_t addr = i ? s->frames[i - 1] : s->rip;
+        const struct sym *sym = find_symbol(addr);
+
+        len += snprintf(stack + len, sizeof(stack) - len, ";%s",
+                        sym ? sym->name : "[unknown]");
+    }
+
+    fold_add(stack);
+}
+
+static void account(const xc_sample_t *s)
+{
+    struct sym *sym;
+
+    nr_samples++;
+
+    if ( opt_fold )
+        fold_sample(s);
+
+    if ( s->flags & XEN_SYSCTL_SAMPLE_guest )
+    {
+        if ( s->domid < DOMID_FIRST_RESERVED )
+            guest_samples[s->domid]++;
+        return;
+    }
+
+    if ( s->flags & XEN_SYSCTL_SAMPLE_idle )
+        nr_idle++;
+
+    sym = find_symbol(s->rip);
+    if ( sym )
+        sym->self++;
+    else
+        nr_unknown++;
+}
+
+static int drain(unsigned int nr_cpus, xc_sample_t *buf,
+                 xc_hypercall_buffer_t *hbuf)
+{
+    unsigned int cpu;
+
+    for ( cpu = 0; cpu < nr_cpus; cpu++ )
+    {
+        uint32_t nr, lost, rate, i;
+
+        do {
+            nr = READ_BATCH;
+            if ( xc_sample_prof_read(xch, cpu, &nr, &lost, &rate, hbuf) )
+            {
+                /* Offline CPU. */
+                if ( errno == EINVAL )
+                    break;
+                return -1;
+            }
+
+            nr_lost += lost;
+            for ( i = 0; i < nr; i++ )
+                account(&buf[i]);
+        } while ( nr == READ_BATCH );
+    }
+
+    return 0;
+}
+
+static int sym_self_cmp(const void *a, const void *b)
+{
+    const struct sym *x = a, *y = b;
+
+    return x->self > y->self ? -1 : x->self < y->self;
+}
+
+static void report(unsigned int top)
+{
+    unsigned int i;
+
+    if ( opt_fold )
+    {
+        for ( i = 0; i < FOLD_BUCKETS; i++ )
+        {
+            const struct fold *f;
+
+            for ( f = folds[i]; f; f = f->next )
+                printf("%s %lu\n", f->stack, f->count);
+        }
+        return;
+    }
+
+    printf("%lu samples, %lu lost, %lu in the idle vCPU\n",
+           nr_samples, nr_lost, nr_idle);
+    if ( !nr_samples )
+        return;
+
+    printf("\n%10s %7s  %s\n", "samples", "%", "context");
+    for ( i = 0; i < DOMID_FIRST_RESERVED; i++ )
+        if ( guest_samples[i] )
+            printf("%10lu %6.2f%%  d%u (guest)\n", guest_samples[i],
+                   100.0 * guest_samples[i] / nr_samples, i);
+    if ( nr_unknown )
+        printf("%10lu %6.2f%%  [unknown]\n", nr_unknown,
+               100.0 * nr_unknown / nr_samples);
+
+    qsort(syms, nr_syms, sizeof(*syms), sym_self_cmp);
+    for ( i = 0; i < nr_syms && i < top && syms[i].self; i++ )
+        printf("%10lu %6.2f%%  %s\n", syms[i].self,
+               100.0 * syms[i].self / nr_samples, syms[i].name);
+}
+
+static void usage(const char *prog)
+{
+    printf("Usage: %s [OPTIONS]\n"
+           "Sample the hypervisor with the NMI watchdog (requires the\n"
+           "'watchdog' Xen command line option) and report where time is spent.\n"
+           "\n"
+           "  -r, --rate=HZ      samples per second per pCPU (default 1000)\n"
+           "  -t, --time=SECS    duration of the profile (default 10)\n"
+           "  -n, --top=N        number of symbols to report (default 30)\n"
+           "  -f, --folded       print folded call chains, for flame graphs\n"
+           "  -h, --help         this help\n", prog);
+}
+
+int main(int argc, char *argv[])
+{
+    static const struct option opts[] = {
+        { "rate",   required_argument, NULL, 'r' },
+        { "time",   required_argument, NULL, 't' },
+        { "top",    required_argument, NULL, 'n' },
+        { "folded", no_argument,       NULL, 'f' },
+        { "help",   no_argument,       NULL, 'h' },
+        { NULL, 0, NULL, 0 },
+    };
+    unsigned int rate = 1000, secs = 10, top = 30, nr_cpus, i;
+    struct timespec period = { .tv_nsec = 100000000 };
+    xc_physinfo_t info;
+    int c, rc = 1;
+    DECLARE_HYPERCALL_BUFFER(xc_sample_t, buf);
+
+    while ( (c = getopt_long(argc, argv, "r:t:n:fh", opts, NULL)) != -1 )
+    {
+        switch ( c )
+        {
+        case 'r': rate = strtoul(optarg, NULL, 0); break;
+        case 't': secs = strtoul(optarg, NULL, 0); break;
+        case 'n': top = strtoul(optarg, NULL, 0); break;
+        case 'f': opt_fold = true; break;
+        case 'h': usage(argv[0]); return 0;
+        default:  usage(argv[0]); return 1;
+        }
+    }
+
+    xch = xc_interface_open(0, 0, 0);
+    if ( !xch )
+    {
+        fprintf(stderr, "Error opening xc interface: %d (%s)\n",
+                errno, strerror(errno));
+        return 1;
+    }
+
+    guest_samples = calloc(DOMID_FIRST_RESERVED, sizeof(*guest_samples));
+    buf = xc_hypercall_buffer_alloc(xch, buf, READ_BATCH * sizeof(*buf));
+    if ( !guest_samples || !buf )
+    {
+        fprintf(stderr, "Could not allocate buffers: %d (%s)\n",
+                errno, strerror(errno));
+        goto out;
+    }
+
+    if ( xc_physinfo(xch, &info) )
+    {
+        fprintf(stderr, "Error getting physinfo: %d (%s)\n",
+                errno, strerror(errno));
+        goto out;
+    }
+    nr_cpus = info.max_cpu_id + 1;
+
+    if ( load_symbols() )
+    {
+        fprintf(stderr, "Error reading hypervisor symbols: %d (%s)\n",
+                errno, strerror(errno));
+        goto out;
+    }
+
+    if ( xc_sample_prof_enable(xch, rate) )
+    {
+        fprintf(stderr, "Error enabling sampling at %u Hz: %d (%s)\n",
+                rate, errno, strerror(errno));
+        if ( errno == ENODEV )
+            fprintf(stderr, "Is the NMI watchdog enabled?\n");
+        goto out;
+    }
+
+    /* Drain often enough for the per-CPU rings not to overflow. */
+    for ( i = 0; i < secs * 10; i++ )
+    {
+        nanosleep(&period, NULL);
+        if ( drain(nr_cpus, buf, HYPERCALL_BUFFER(buf)) )
+            break;
+    }
+
+    xc_sample_prof_disable(xch);
+
+    if ( i < secs * 10 || drain(nr_cpus, buf, HYPERCALL_BUFFER(buf)) )
+    {
+        fprintf(stderr, "Error reading samples: %d (%s)\n",
+                errno, strerror(errno));
+        goto out;
+    }
+
+    report(top);
+    rc = 0;
+
+ out:
+    xc_hypercall_buffer_free(xch, buf);
+    xc_interface_close(xch);
+
+    return rc;
+}
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * tab-width: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
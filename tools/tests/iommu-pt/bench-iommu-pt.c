@@ -0,0 +1,437 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/*
+ * Hardware domain IOMMU setup on a large host, in a simulated 4-level page
+ * table laid out as VT-d's.  The identity map of the host's e820 is built as
+ * arch_iommu_hwdom_init() does for a PV dom0, through iommu_map()'s choice
+ * of page order, with the page sizes of an IOMMU without superpages, with 2M
+ * ones, and with 2M and 1G ones.  Single pages are then unmapped and mapped
+ * back, shattering superpages and coalescing them again as the drivers do.
+ *
+ * Usage: bench-iommu-pt [host GiB], 1024 by default.
+ */
+
+#include <time.h>
+
+#include "harness.h"
+
+#define PTE_PROT        0x3ULL              /* Read | write. */
+#define PTE_SP          (1ULL << 7)
+#define PTE_ADDR_MASK   0x000ffffffffff000ULL
+#define PTE_CONTIG_MASK (0xfULL << 52)
+
+#define CONTIG_MASK PTE_CONTIG_MASK
+#include "pt-contig-markers.h"
+
+#include "mapping-order.h"
+
+#define LEVELS     4
+#define PTE_NUM    CONTIG_NR
+#define LEVEL_MASK (PTE_NUM - 1ULL)
+
+#define PAGE_SIZE_4K (1UL << 12)
+#define PAGE_SIZE_2M (1UL << 21)
+#define PAGE_SIZE_1G (1UL << 30)
+
+#define level_shift(l)       (PAGE_SHIFT + ((l) - 1) * CONTIG_LEVEL_SHIFT)
+#define level_offset(dfn, l) \
+    (((dfn) >> (((l) - 1) * CONTIG_LEVEL_SHIFT)) & LEVEL_MASK)
+#define pte_table(pte)       ((uint64_t *)(uintptr_t)((pte) & PTE_ADDR_MASK))
+
+/* Pages unmapped, then mapped back, after the setup. */
+#define CHURN   4096
+/* Translations checked against the e820 at the end. */
+#define LOOKUPS 1000000
+
+static const struct {
+    const char *name;
+    unsigned long page_sizes;
+} configs[] = {
+    { "4K",       PAGE_SIZE_4K },
+    { "4K+2M",    PAGE_SIZE_4K | PAGE_SIZE_2M },
+    { "4K+2M+1G", PAGE_SIZE_4K | PAGE_SIZE_2M | PAGE_SIZE_1G },
+};
+
+/*
+ * RAM and reserved regions below 4G, all identity mapped for a non-strict
+ * dom0.  RAM above 4G is added to make up the host size, ending short of a
+ * 2M boundary.
+ */
+static struct {
+    uint64_t start, end;                    /* Bytes, end exclusive. */
+} e820[] = {
+    { 0,           0x9f000     },
+    { 0x9f000,     0x100000    },
+    { 0x100000,    0xbfe8f000  },
+    { 0xbfe8f000,  0xc0000000  },
+    { 0xe0000000,  0xf0000000  },           /* MMCONFIG */
+    { 0xfec00000,  0xfec01000  },           /* IO-APIC */
+    { 0xfed00000,  0xfed01000  },           /* HPET */
+    { 0xfee00000,  0xfee01000  },           /* LAPIC */
+    { 0xff000000,  0x100000000 },           /* Firmware */
+    { 0x100000000, 0           },
+};
+
+struct pt {
+    struct iommu_ops ops;
+    struct domain_iommu hd;
+    uint64_t *root;
+    unsigned long tables, calls, shatters, coalesces;
+};
+
+/*
+ * Tables come from 2M chunks and are recycled through a free list: a
+ * page-aligned allocation per table would double the footprint of the
+ * 4K-only table for a large host.
+ */
+#define CHUNK_TABLES 512
+
+static uint64_t **chunks, *free_tables;
+static unsigned int nr_chunks, chunk_used = CHUNK_TABLES;
+
+static uint64_t *alloc_table(struct pt *pt)
+{
+    uint64_t *p = free_tables;
+    unsigned int i;
+
+    if ( p )
+        free_tables = (uint64_t *)(uintptr_t)p[0];
+    else
+    {
+        if ( chunk_used == CHUNK_TABLES )
+        {
+            uint64_t **c = realloc(chunks, (nr_chunks + 1) * sizeof(*c));
+
+            if ( !c )
+                return NULL;
+            chunks = c;
+            if ( posix_memalign((void **)&chunks[nr_chunks], PAGE_SIZE,
+                                CHUNK_TABLES * PAGE_SIZE) )
+                return NULL;
+            nr_chunks++;
+            chunk_used = 0;
+        }
+        p = chunks[nr_chunks - 1] + chunk_used++ * PTE_NUM;
+    }
+
+    /* As iommu_alloc_pgtable(): the markers of an empty table. */
+    p[0] = MASK_INSR(CONTIG_LEVEL_SHIFT, PTE_CONTIG_MASK);
+    for ( i = 1; i < PTE_NUM; i++ )
+        p[i] = MASK_INSR(ffs(i) - 1, PTE_CONTIG_MASK);
+
+    pt->tables++;
+
+    return p;
+}
+
+static void free_table(struct pt *pt, uint64_t *table, unsigned int level)
+{
+    unsigned int i;
+
+    for ( i = 0; level > 1 && i < PTE_NUM; i++ )
+        if ( (table[i] & PTE_PROT) && !(table[i] & PTE_SP) )
+            free_table(pt, pte_table(table[i]), level - 1);
+
+    table[0] = (uintptr_t)free_tables;
+    free_tables = table;
+    pt->tables--;
+}
+
+static void free_chunks(void)
+{
+    while ( nr_chunks )
+        free(chunks[--nr_chunks]);
+    free(chunks);
+    chunks = NULL;
+    free_tables = NULL;
+    chunk_used = CHUNK_TABLES;
+}
+
+/*
+ * The table of @level covering @dfn, as addr_to_dma_page_maddr(): missing
+ * tables are allocated if @alloc, superpages in the way are shattered.
+ */
+static uint64_t *walk(struct pt *pt, unsigned long dfn, unsigned int level,
+                      bool alloc)
+{
+    uint64_t *table = pt->root;
+    unsigned int l;
+
+    for ( l = LEVELS; l > level; l-- )
+    {
+        unsigned int idx = level_offset(dfn, l);
+        uint64_t *pte = &table[idx];
+
+        if ( !(*pte & PTE_PROT) || (*pte & PTE_SP) )
+        {
+            uint64_t *split;
+
+            if ( !alloc && !(*pte & PTE_PROT) )
+                return NULL;
+
+            split = alloc_table(pt);
+            if ( !split )
+                return NULL;
+
+            if ( *pte & PTE_PROT )
+            {
+                uint64_t inc = 1ULL << level_shift(l - 1);
+                unsigned int i;
+
+                split[0] |= *pte & ~PTE_CONTIG_MASK;
+                if ( l == 2 )
+                    split[0] &= ~PTE_SP;
+                for ( i = 1; i < PTE_NUM; i++ )
+                    split[i] |= (split[i - 1] & ~PTE_CONTIG_MASK) + inc;
+
+                pt->shatters++;
+            }
+
+            *pte = (uintptr_t)split | PTE_PROT;
+            pt_update_contig_markers(table, idx, l, PTE_kind_table);
+        }
+
+        table = pte_table(*pte);
+    }
+
+    return table;
+}
+
+/* As intel_iommu_map_page(). */
+static int map_page(struct pt *pt, unsigned long dfn, unsigned long mfn,
+                    unsigned int order)
+{
+    unsigned int level = order / CONTIG_LEVEL_SHIFT + 1;
+    uint64_t *table = walk(pt, dfn, level, true), *pte, old, new;
+
+    if ( !table )
+        return -1;
+
+    pte = &table[level_offset(dfn, level)];
+    old = *pte;
+    new = ((uint64_t)mfn << PAGE_SHIFT) | PTE_PROT | (order ? PTE_SP : 0);
+    if ( !((old ^ new) & ~PTE_CONTIG_MASK) )
+        return 0;
+
+    *pte = new;
+
+    while ( pt_update_contig_markers(table, level_offset(dfn, level), level,
+                                     (pt->ops.page_sizes &
+                                      (1UL << level_shift(level + 1))
+                                      ? PTE_kind_leaf : PTE_kind_table)) )
+    {
+        uint64_t *leaves = table;
+
+        new &= ~(LEVEL_MASK << level_shift(level));
+        new |= PTE_SP;
+
+        table = walk(pt, dfn, ++level, false);
+        table[level_offset(dfn, level)] = new;
+
+        free_table(pt, leaves, level - 1);
+        pt->coalesces++;
+    }
+
+    if ( (old & PTE_PROT) && order && !(old & PTE_SP) )
+        free_table(pt, pte_table(old), order / CONTIG_LEVEL_SHIFT);
+
+    return 0;
+}
+
+/* As intel_iommu_unmap_page(). */
+static void unmap_page(struct pt *pt, unsigned long dfn, unsigned int order)
+{
+    unsigned int level = order / CONTIG_LEVEL_SHIFT + 1;
+    uint64_t *table = walk(pt, dfn, level, false), old;
+
+    if ( !table || !(table[level_offset(dfn, level)] & PTE_PROT) )
+        return;
+
+    old = table[level_offset(dfn, level)];
+    table[level_offset(dfn, level)] = 0;
+
+    while ( pt_update_contig_markers(table, level_offset(dfn, level), level,
+                                     PTE_kind_null) &&
+            ++level < LEVELS )
+    {
+        uint64_t *empty = table;
+
+        table = walk(pt, dfn, level, false);
+        table[level_offset(dfn, level)] = 0;
+
+        free_table(pt, empty, level - 1);
+        pt->coalesces++;
+    }
+
+    if ( order && !(old & PTE_SP) )
+        free_table(pt, pte_table(old), order / CONTIG_LEVEL_SHIFT);
+}
+
+/* As iommu_map(): the largest pages alignment and length allow. */
+static int map_range(struct pt *pt, unsigned long dfn, unsigned long mfn,
+                     unsigned long nr)
+{
+    unsigned long i;
+    unsigned int order;
+
+    for ( i = 0; i < nr; i += 1UL << order )
+    {
+        order = mapping_order(&pt->hd, dfn + i, mfn + i, nr - i);
+        if ( map_page(pt, dfn + i, mfn + i, order) )
+            return -1;
+        pt->calls++;
+    }
+
+    return 0;
+}
+
+/* The frame @dfn translates to, or ~0UL if it isn't mapped. */
+static unsigned long translate(const struct pt *pt, unsigned long dfn)
+{
+    const uint64_t *table = pt->root;
+    unsigned int level;
+
+    for ( level = LEVELS; ; level-- )
+    {
+        uint64_t pte = table[level_offset(dfn, level)];
+
+        if ( !(pte & PTE_PROT) )
+            return ~0UL;
+        if ( level == 1 || (pte & PTE_SP) )
+            return ((pte & PTE_ADDR_MASK) >> PAGE_SHIFT) +
+                   (dfn & ((1UL << ((level - 1) * CONTIG_LEVEL_SHIFT)) - 1));
+        table = pte_table(pte);
+    }
+}
+
+static bool in_e820(unsigned long dfn)
+{
+    unsigned int i;
+
+    for ( i = 0; i < ARRAY_SIZE(e820); i++ )
+        if ( dfn >= e820[i].start >> PAGE_SHIFT &&
+             dfn < e820[i].end >> PAGE_SHIFT )
+            return true;
+
+    return false;
+}
+
+static double now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+int main(int argc, char **argv)
+{
+    unsigned long gib = argc > 1 ? strtoul(argv[1], NULL, 0) : 1024;
+    uint64_t size = (uint64_t)gib << 30;
+    uint64_t high = e820[ARRAY_SIZE(e820) - 1].start;
+    unsigned long *churn = malloc(CHURN * sizeof(*churn));
+    unsigned int i, j;
+
+    if ( gib < 4 || gib > (1UL << 18) || !churn )
+    {
+        printf("Usage: %s [host GiB, 4 to 262144]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    /* The last 1984K of the host are left out, as a tail of 4K pages. */
+    e820[ARRAY_SIZE(e820) - 1].end = high + size - GB(3) - 0x1f0000;
+
+    srand(gib);
+    for ( j = 0; j < CHURN; j++ )
+        churn[j] = (high >> PAGE_SHIFT) +
+                   (((unsigned long)rand() << 16) ^ rand()) %
+                   ((size - GB(4)) >> PAGE_SHIFT);
+
+    printf("%lu GiB host, %u pages unmapped and mapped back after setup\n",
+           gib, CHURN);
+    printf("%-10s %10s %12s %10s %10s %10s %10s %10s\n", "page sizes",
+           "setup ms", "map calls", "tables", "table KiB", "churn ns",
+           "shatters", "coalesces");
+
+    for ( i = 0; i < ARRAY_SIZE(configs); i++ )
+    {
+        struct pt pt = {
+            .ops.page_sizes = configs[i].page_sizes,
+            .hd.platform_ops = &pt.ops,
+        };
+        unsigned long tables, calls;
+        double t0, t1, t2;
+
+        pt.root = alloc_table(&pt);
+        if ( !pt.root )
+            goto nomem;
+
+        t0 = now_ns();
+        for ( j = 0; j < ARRAY_SIZE(e820); j++ )
+        {
+            unsigned long s = e820[j].start >> PAGE_SHIFT;
+
+            if ( map_range(&pt, s, s, (e820[j].end >> PAGE_SHIFT) - s) )
+                goto nomem;
+        }
+        t1 = now_ns();
+
+        /* Adjacent e820 regions may coalesce, only count the churn. */
+        tables = pt.tables;
+        calls = pt.calls;
+        pt.shatters = pt.coalesces = 0;
+
+        for ( j = 0; j < CHURN; j++ )
+            unmap_page(&pt, churn[j], 0);
+        for ( j = 0; j < CHURN; j++ )
+            if ( map_range(&pt, churn[j], churn[j], 1) )
+                goto nomem;
+        t2 = now_ns();
+
+        /* Every superpage shattered above must have been coalesced again. */
+        if ( pt.tables != tables )
+        {
+            printf("%s: %lu tables after setup, %lu after unmap and map\n",
+                   configs[i].name, tables, pt.tables);
+            return EXIT_FAILURE;
+        }
+
+        for ( j = 0; j < LOOKUPS; j++ )
+        {
+            unsigned long dfn = (((unsigned long)rand() << 16) ^ rand()) %
+                                ((size + GB(1)) >> PAGE_SHIFT);
+            unsigned long mfn = translate(&pt, dfn);
+
+            if ( mfn != (in_e820(dfn) ? dfn : ~0UL) )
+            {
+                printf("%s: dfn %#lx translates to %#lx\n", configs[i].name,
+                       dfn, mfn);
+                return EXIT_FAILURE;
+            }
+        }
+
+        printf("%-10s %10.1f %12lu %10lu %10lu %10.1f %10lu %10lu\n",
+               configs[i].name, (t1 - t0) / 1e6, calls, tables,
+               tables * (PAGE_SIZE / 1024), (t2 - t1) / CHURN,
+               pt.shatters, pt.coalesces);
+
+        free_chunks();
+    }
+
+    free(churn);
+
+    return 0;
+
+ nomem:
+    printf("%s: out of memory\n", configs[i].name);
+    return EXIT_FAILURE;
+}
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
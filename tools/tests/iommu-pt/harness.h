@@ -0,0 +1,51 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/*
+ * Userspace environment for the IOMMU page table helpers shared with the
+ * hypervisor: the superpage order selection of iommu_map(), and the
+ * contiguity markers used by the AMD-Vi and VT-d drivers.
+ */
+
+#ifndef _TEST_HARNESS_
+#define _TEST_HARNESS_
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <xen-tools/common-macros.h>
+
+#define ASSERT(x) assert(x)
+
+#define PAGE_SHIFT 12
+#define PAGE_SIZE  (1UL << PAGE_SHIFT)
+
+#define ffs  __builtin_ffs
+#define ffsl __builtin_ffsl
+
+typedef unsigned long dfn_t;
+typedef unsigned long mfn_t;
+#define dfn_x(dfn) (dfn)
+#define mfn_x(mfn) (mfn)
+
+/* For mapping_order() */
+struct iommu_ops {
+    unsigned long page_sizes;
+};
+
+struct domain_iommu {
+    const struct iommu_ops *platform_ops;
+};
+
+#endif
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
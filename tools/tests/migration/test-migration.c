@@ -0,0 +1,801 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/*
+ * Migration stream benchmark.
+ *
+ * Runs the common libxenguest save and restore logic (xg_sr_save.c,
+ * xg_sr_restore.c and xg_sr_common.c) back to back over a pipe, against a
+ * fake libxenctrl backend and synthetic guest, and reports the throughput
+ * and CPU cost of the stream, and the resulting downtime.
+ *
+ * The synthetic guest's memory is a shared memory file, mapped piecewise in
+ * the same way as foreign mappings of a real guest.  Guest writes are
+ * modelled at a configurable rate over a configurable working set, and are
+ * reported through the log-dirty interface.  The restored memory is checked
+ * against the source once the stream is complete.
+ */
+
+#include <err.h>
+#include <getopt.h>
+#include <pthread.h>
+#include <sys/mman.h>
+
+#include "xg_sr_common.h"
+
+#define SRC_DOMID 1
+#define DST_DOMID 2
+
+static struct fake_dom {
+    uint32_t domid;
+    int fd;
+    uint8_t *mem;
+
+    bool suspended;
+    bool logdirty;
+    uint16_t cap;
+
+    /* Pages dirtied, and not yet reported by a CLEAN operation. */
+    unsigned long *dirty;
+    unsigned long dirty_count;
+    uint64_t dirty_until_ns;
+    double dirty_carry;
+
+    unsigned long pages_mapped;
+    unsigned long cleans;
+    uint64_t suspend_ns;
+} doms[] = {
+    { .domid = SRC_DOMID },
+    { .domid = DST_DOMID },
+};
+
+/* Parameters of the synthetic guest. */
+static unsigned long nr_pages;
+static unsigned long ws_pages;
+static double dirty_pps;
+static unsigned int sparse_pct;
+static bool verbose;
+
+/* The save or restore half of the migration, each run in its own thread. */
+struct side {
+    struct xc_interface_core xch;
+    const char *name;
+    int fd;
+    int rc;
+    uint64_t start_ns, end_ns, cpu_ns;
+};
+
+static uint64_t rng_state = 0x2545f4914f6cdd1dULL;
+
+static uint64_t rng(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+
+    return rng_state;
+}
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static uint64_t thread_cpu_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/* Unpopulated pages, in a fixed pseudo-random pattern. */
+static bool pfn_is_sparse(xen_pfn_t pfn)
+{
+    return ((pfn * 0x9e3779b97f4a7c15ULL) >> 32) % 100 < sparse_pct;
+}
+
+static struct fake_dom *get_dom(uint32_t domid)
+{
+    for ( unsigned int i = 0; i < ARRAY_SIZE(doms); ++i )
+        if ( doms[i].domid == domid )
+            return &doms[i];
+
+    errx(1, "No such domain %u", domid);
+}
+
+static int open_memory(void)
+{
+    int fd;
+
+#ifdef MFD_CLOEXEC
+    fd = memfd_create("test-migration", MFD_CLOEXEC);
+#else
+    FILE *f = tmpfile();
+
+    fd = f ? dup(fileno(f)) : -1;
+    if ( f )
+        fclose(f);
+#endif
+    if ( fd < 0 )
+        err(1, "Unable to create guest memory");
+
+    if ( ftruncate(fd, (off_t)nr_pages << PAGE_SHIFT) )
+        err(1, "Unable to size guest memory");
+
+    return fd;
+}
+
+static void init_dom(struct fake_dom *d)
+{
+    d->fd = open_memory();
+    d->mem = mmap(NULL, nr_pages << PAGE_SHIFT, PROT_READ | PROT_WRITE,
+                  MAP_SHARED, d->fd, 0);
+    if ( d->mem == MAP_FAILED )
+        err(1, "Unable to map guest memory");
+
+    d->dirty = bitmap_alloc(nr_pages);
+    if ( !d->dirty )
+        err(1, "Unable to allocate dirty bitmap");
+}
+
+/*
+ * Account for guest writes since the last update, unless the guest isn't
+ * running.  A scheduler cap limits the guest (of one vCPU) to that
+ * percentage of its time.
+ */
+static void advance_guest(struct fake_dom *d)
+{
+    uint64_t now = now_ns();
+    double pages;
+    unsigned long nr, i;
+
+    if ( !d->logdirty || d->suspended )
+    {
+        d->dirty_until_ns = now;
+        return;
+    }
+
+    pages = dirty_pps * (now - d->dirty_until_ns) / 1e9 + d->dirty_carry;
+    if ( d->cap && d->cap < 100 )
+        pages = pages * d->cap / 100;
+
+    nr = pages;
+    d->dirty_carry = pages - nr;
+    d->dirty_until_ns = now;
+
+    for ( i = 0; i < min(nr, 2 * ws_pages); ++i )
+    {
+        xen_pfn_t pfn = rng() % ws_pages;
+        uint64_t *p = (uint64_t *)(d->mem + (pfn << PAGE_SHIFT));
+
+        if ( pfn_is_sparse(pfn) )
+            continue;
+
+        p[rng() % (PAGE_SIZE / sizeof(*p))] = rng();
+        if ( !test_and_set_bit(pfn, d->dirty) )
+            d->dirty_count++;
+    }
+}
+
+/* Fake libxenctrl / libxenforeignmemory interfaces used by the stream. */
+
+void xc_report(xc_interface *xch, xentoollog_logger *lg,
+               xentoollog_level level, int code, const char *fmt, ...)
+{
+    va_list args;
+
+    if ( !verbose && level < XTL_ERROR )
+        return;
+
+    va_start(args, fmt);
+    fprintf(stderr, "%s: ", container_of(xch, struct side, xch)->name);
+    vfprintf(stderr, fmt, args);
+    fputc('\n', stderr);
+    va_end(args);
+}
+
+void xc_report_error(xc_interface *xch, int code, const char *fmt, ...)
+{
+    va_list args;
+
+    va_start(args, fmt);
+    fprintf(stderr, "%s: error: ", container_of(xch, struct side, xch)->name);
+    vfprintf(stderr, fmt, args);
+    fputc('\n', stderr);
+    va_end(args);
+}
+
+const char *xc_set_progress_prefix(xc_interface *xch, const char *doing)
+{
+    const char *old = xch->currently_progress_reporting;
+
+    xch->currently_progress_reporting = doing;
+
+    return old;
+}
+
+void xc_report_progress_single(xc_interface *xch, const char *doing)
+{
+    xc_report(xch, NULL, XTL_PROGRESS, 0, "%s", doing);
+}
+
+void xc_report_progress_step(xc_interface *xch,
+                             unsigned long done, unsigned long total)
+{
+}
+
+const char *xc_strerror(xc_interface *xch, int errcode)
+{
+    return strerror(errcode);
+}
+
+int xc_version(xc_interface *xch, int cmd, void *arg)
+{
+    return (4 << 16) | 22;
+}
+
+void *xc__hypercall_buffer_alloc_pages(xc_interface *xch,
+                                       xc_hypercall_buffer_t *b, int nr_pages)
+{
+    void *p;
+
+    if ( posix_memalign(&p, PAGE_SIZE, (size_t)nr_pages << PAGE_SHIFT) )
+        return NULL;
+
+    memset(p, 0, (size_t)nr_pages << PAGE_SHIFT);
+    b->hbuf = p;
+
+    return p;
+}
+
+void xc__hypercall_buffer_free_pages(xc_interface *xch,
+                                     xc_hypercall_buffer_t *b, int nr_pages)
+{
+    free(b->hbuf);
+    b->hbuf = NULL;
+}
+
+int xc_domain_getinfo_single(xc_interface *xch, uint32_t domid,
+                             xc_domaininfo_t *info)
+{
+    struct fake_dom *d = get_dom(domid);
+
+    memset(info, 0, sizeof(*info));
+    info->domain = domid;
+    info->flags = XEN_DOMINF_hvm_guest;
+    if ( d->suspended )
+        info->flags |= XEN_DOMINF_shutdown |
+            (SHUTDOWN_suspend << XEN_DOMINF_shutdownshift);
+    info->tot_pages = nr_pages;
+
+    return 0;
+}
+
+int xc_domain_nr_gpfns(xc_interface *xch, uint32_t domid, xen_pfn_t *gpfns)
+{
+    *gpfns = nr_pages;
+
+    return 0;
+}
+
+int xc_domain_populate_physmap_exact(xc_interface *xch, uint32_t domid,
+                                     unsigned long nr_extents,
+                                     unsigned int extent_order,
+                                     unsigned int mem_flags,
+                                     xen_pfn_t *extent_start)
+{
+    /* Memory is always present; gfns are mfns. */
+    return 0;
+}
+
+int xc_get_pfn_type_batch(xc_interface *xch, uint32_t dom,
+                          unsigned int num, xen_pfn_t *arr)
+{
+    for ( unsigned int i = 0; i < num; ++i )
+        arr[i] = (arr[i] >= nr_pages || pfn_is_sparse(arr[i]))
+            ? XEN_DOMCTL_PFINFO_XTAB : XEN_DOMCTL_PFINFO_NOTAB;
+
+    return 0;
+}
+
+int xc_shadow_control(xc_interface *xch, uint32_t domid, unsigned int sop,
+                      unsigned int *mb, unsigned int mode)
+{
+    struct fake_dom *d = get_dom(domid);
+
+    switch ( sop )
+    {
+    case XEN_DOMCTL_SHADOW_OP_ENABLE_LOGDIRTY:
+        d->logdirty = true;
+        d->dirty_until_ns = now_ns();
+        bitmap_clear(d->dirty, nr_pages);
+        d->dirty_count = 0;
+        return 0;
+
+    case XEN_DOMCTL_SHADOW_OP_OFF:
+        d->logdirty = false;
+        return 0;
+
+    default:
+        errno = EOPNOTSUPP;
+        return -1;
+    }
+}
+
+long long xc_logdirty_control(xc_interface *xch, uint32_t domid,
+                              unsigned int sop,
+                              xc_hypercall_buffer_t *dirty_bitmap,
+                              unsigned long pages, unsigned int mode,
+                              xc_shadow_op_stats_t *stats)
+{
+    struct fake_dom *d = get_dom(domid);
+    unsigned long i, nr = 0;
+
+    if ( !d->logdirty )
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    advance_guest(d);
+    d->cleans++;
+
+    /* As with Xen, the count of pages dirtied since the last CLEAN. */
+    if ( stats )
+    {
+        stats->fault_count = 0;
+        stats->dirty_count = d->dirty_count;
+    }
+
+    if ( sop != XEN_DOMCTL_SHADOW_OP_PEEK )
+        d->dirty_count = 0;
+
+    switch ( sop )
+    {
+    case XEN_DOMCTL_SHADOW_OP_CLEAN_LIST:
+    {
+        uint64_t *list = dirty_bitmap->hbuf;
+
+        for ( i = 0; i < nr_pages && nr < pages; ++i )
+        {
+            if ( !test_bit(i, d->dirty) )
+                continue;
+
+            list[nr++] = i;
+            clear_bit(i, d->dirty);
+        }
+
+        pages = nr;
+        break;
+    }
+
+    case XEN_DOMCTL_SHADOW_OP_CLEAN:
+    case XEN_DOMCTL_SHADOW_OP_PEEK:
+        pages = min(pages, nr_pages);
+        memcpy(dirty_bitmap->hbuf, d->dirty, bitmap_size(pages));
+        if ( sop == XEN_DOMCTL_SHADOW_OP_CLEAN )
+            bitmap_clear(d->dirty, nr_pages);
+        break;
+
+    default:
+        errno = EOPNOTSUPP;
+        return -1;
+    }
+
+    return pages;
+}
+
+xc_cpupoolinfo_t *xc_cpupool_getinfo(xc_interface *xch, uint32_t poolid)
+{
+    xc_cpupoolinfo_t *info = calloc(1, sizeof(*info));
+
+    if ( info )
+    {
+        info->cpupool_id = poolid;
+        info->sched_id = XEN_SCHEDULER_CREDIT2;
+    }
+
+    return info;
+}
+
+void xc_cpupool_infofree(xc_interface *xch, xc_cpupoolinfo_t *info)
+{
+    free(info);
+}
+
+int xc_sched_credit2_domain_get(xc_interface *xch, uint32_t domid,
+                                struct xen_domctl_sched_credit2 *sdom)
+{
+    sdom->weight = 256;
+    sdom->cap = get_dom(domid)->cap;
+
+    return 0;
+}
+
+int xc_sched_credit2_domain_set(xc_interface *xch, uint32_t domid,
+                                struct xen_domctl_sched_credit2 *sdom)
+{
+    struct fake_dom *d = get_dom(domid);
+
+    /* Writes so far happened at the old cap. */
+    advance_guest(d);
+    d->cap = sdom->cap;
+
+    return 0;
+}
+
+int xc_sched_credit_domain_get(xc_interface *xch, uint32_t domid,
+                               struct xen_domctl_sched_credit *sdom)
+{
+    errno = EINVAL;
+    return -1;
+}
+
+int xc_sched_credit_domain_set(xc_interface *xch, uint32_t domid,
+                               struct xen_domctl_sched_credit *sdom)
+{
+    errno = EINVAL;
+    return -1;
+}
+
+/*
+ * Map runs of contiguous gfns from the memory file, over a reservation for
+ * the whole mapping.
+ */
+void *xenforeignmemory_map(xenforeignmemory_handle *fmem, uint32_t dom,
+                           int prot, size_t pages,
+                           const xen_pfn_t arr[], int err[])
+{
+    struct fake_dom *d = get_dom(dom);
+    uint8_t *addr = mmap(NULL, pages << PAGE_SHIFT, PROT_NONE,
+                         MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    size_t i, run;
+
+    if ( addr == MAP_FAILED )
+        return NULL;
+
+    for ( i = 0; i < pages; i += run )
+    {
+        for ( run = 1; i + run < pages && arr[i + run] == arr[i] + run; )
+            ++run;
+
+        if ( arr[i] + run > nr_pages )
+        {
+            for ( ; run; --run, ++i )
+                err[i] = -EINVAL;
+            run = 0;
+            continue;
+        }
+
+        if ( mmap(addr + (i << PAGE_SHIFT), run << PAGE_SHIFT, prot,
+                  MAP_SHARED | MAP_FIXED, d->fd,
+                  (off_t)arr[i] << PAGE_SHIFT) == MAP_FAILED )
+        {
+            munmap(addr, pages << PAGE_SHIFT);
+            return NULL;
+        }
+
+        memset(&err[i], 0, run * sizeof(*err));
+    }
+
+    d->pages_mapped += pages;
+
+    return addr;
+}
+
+int xenforeignmemory_unmap(xenforeignmemory_handle *fmem,
+                           void *addr, size_t pages)
+{
+    return munmap(addr, pages << PAGE_SHIFT);
+}
+
+int read_exact(int fd, void *data, size_t size)
+{
+    size_t offset = 0;
+    ssize_t len;
+
+    while ( offset < size )
+    {
+        len = read(fd, (char *)data + offset, size - offset);
+        if ( len == -1 && errno == EINTR )
+            continue;
+        if ( len == 0 )
+            errno = 0;
+        if ( len <= 0 )
+            return -1;
+        offset += len;
+    }
+
+    return 0;
+}
+
+int write_exact(int fd, const void *data, size_t size)
+{
+    size_t offset = 0;
+    ssize_t len;
+
+    while ( offset < size )
+    {
+        len = write(fd, (const char *)data + offset, size - offset);
+        if ( len == -1 && errno == EINTR )
+            continue;
+        if ( len <= 0 )
+            return -1;
+        offset += len;
+    }
+
+    return 0;
+}
+
+int writev_exact(int fd, const struct iovec *iov, int iovcnt)
+{
+    for ( int i = 0; i < iovcnt; ++i )
+        if ( write_exact(fd, iov[i].iov_base, iov[i].iov_len) )
+            return -1;
+
+    return 0;
+}
+
+/* Synthetic guest type, in place of the x86 PV and HVM ones. */
+
+static xen_pfn_t fake_pfn_to_gfn(const struct xc_sr_context *ctx,
+                                 xen_pfn_t pfn)
+{
+    return pfn;
+}
+
+static int fake_normalise_page(struct xc_sr_context *ctx, xen_pfn_t type,
+                               void **page)
+{
+    return 0;
+}
+
+static int fake_save_setup(struct xc_sr_context *ctx)
+{
+    ctx->save.p2m_size = nr_pages;
+
+    return 0;
+}
+
+static int fake_save_nop(struct xc_sr_context *ctx)
+{
+    return 0;
+}
+
+static bool fake_pfn_is_valid(const struct xc_sr_context *ctx, xen_pfn_t pfn)
+{
+    return pfn < ctx->restore.p2m_size;
+}
+
+static void fake_set_gfn(struct xc_sr_context *ctx, xen_pfn_t pfn,
+                         xen_pfn_t gfn)
+{
+}
+
+static void fake_set_page_type(struct xc_sr_context *ctx, xen_pfn_t pfn,
+                               xen_pfn_t type)
+{
+}
+
+static int fake_localise_page(struct xc_sr_context *ctx, uint32_t type,
+                              void *page)
+{
+    return 0;
+}
+
+static int fake_process_record(struct xc_sr_context *ctx,
+                               struct xc_sr_record *rec)
+{
+    return RECORD_NOT_PROCESSED;
+}
+
+static int fake_static_data_complete(struct xc_sr_context *ctx,
+                                     unsigned int *missing)
+{
+    *missing = 0;
+
+    return 0;
+}
+
+static int fake_restore_nop(struct xc_sr_context *ctx)
+{
+    return 0;
+}
+
+#define FAKE_SAVE_OPS {                                 \
+    .pfn_to_gfn          = fake_pfn_to_gfn,             \
+    .normalise_page      = fake_normalise_page,         \
+    .setup               = fake_save_setup,             \
+    .static_data         = fake_save_nop,               \
+    .start_of_stream     = fake_save_nop,               \
+    .start_of_checkpoint = fake_save_nop,               \
+    .end_of_checkpoint   = fake_save_nop,               \
+    .check_vm_state      = fake_save_nop,               \
+    .cleanup             = fake_save_nop,               \
+}
+
+#define FAKE_RESTORE_OPS {                              \
+    .pfn_is_valid         = fake_pfn_is_valid,          \
+    .pfn_to_gfn           = fake_pfn_to_gfn,            \
+    .set_gfn              = fake_set_gfn,               \
+    .set_page_type        = fake_set_page_type,         \
+    .localise_page        = fake_localise_page,         \
+    .setup                = fake_restore_nop,           \
+    .process_record       = fake_process_record,        \
+    .static_data_complete = fake_static_data_complete,  \
+    .stream_complete      = fake_restore_nop,           \
+    .cleanup              = fake_restore_nop,           \
+}
+
+struct xc_sr_save_ops save_ops_x86_pv = FAKE_SAVE_OPS;
+struct xc_sr_save_ops save_ops_x86_hvm = FAKE_SAVE_OPS;
+struct xc_sr_restore_ops restore_ops_x86_pv = FAKE_RESTORE_OPS;
+struct xc_sr_restore_ops restore_ops_x86_hvm = FAKE_RESTORE_OPS;
+
+/* Save and restore sides. */
+
+static int suspend_cb(void *data)
+{
+    struct fake_dom *d = get_dom(SRC_DOMID);
+
+    advance_guest(d);
+    d->suspended = true;
+    d->suspend_ns = now_ns();
+
+    return 1;
+}
+
+static int switch_qemu_logdirty_cb(uint32_t domid, unsigned int enable,
+                                   void *data)
+{
+    return 0;
+}
+
+static bool live = true;
+
+static void *save_thread(void *arg)
+{
+    struct side *s = arg;
+    struct save_callbacks cb = {
+        .suspend = suspend_cb,
+        .switch_qemu_logdirty = switch_qemu_logdirty_cb,
+    };
+
+    s->start_ns = now_ns();
+    s->rc = xc_domain_save(&s->xch, s->fd, SRC_DOMID,
+                           live ? XCFLAGS_LIVE : 0, &cb,
+                           XC_STREAM_PLAIN, -1);
+    s->end_ns = now_ns();
+    s->cpu_ns = thread_cpu_ns();
+    close(s->fd);
+
+    return NULL;
+}
+
+static void *restore_thread(void *arg)
+{
+    struct side *s = arg;
+    struct restore_callbacks cb = { 0 };
+    unsigned long store_mfn, console_mfn;
+
+    s->start_ns = now_ns();
+    s->rc = xc_domain_restore(&s->xch, s->fd, DST_DOMID, 0, &store_mfn, 0,
+                              0, &console_mfn, 0, XC_STREAM_PLAIN, &cb, -1,
+                              0);
+    s->end_ns = now_ns();
+    s->cpu_ns = thread_cpu_ns();
+
+    return NULL;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s [options]\n"
+            "  -m MiB    guest memory size (default 256)\n"
+            "  -d MiB/s  guest dirty rate (default 0)\n"
+            "  -w pct    working set, as a percentage of memory (default 10)\n"
+            "  -s pct    unpopulated pages, as a percentage (default 0)\n"
+            "  -n        non-live save\n"
+            "  -v        verbose libxenguest logging\n", prog);
+    exit(1);
+}
+
+int main(int argc, char **argv)
+{
+    struct side save = { .name = "save" };
+    struct side restore = { .name = "restore" };
+    struct fake_dom *src = get_dom(SRC_DOMID), *dst = get_dom(DST_DOMID);
+    pthread_t save_tid, restore_tid;
+    unsigned long mib = 256, dirty_mib = 0, ws_pct = 10;
+    double gib, save_s;
+    int opt, pipefd[2];
+    xen_pfn_t pfn;
+
+    while ( (opt = getopt(argc, argv, "m:d:w:s:nv")) != -1 )
+    {
+        switch ( opt )
+        {
+        case 'm': mib = strtoul(optarg, NULL, 0); break;
+        case 'd': dirty_mib = strtoul(optarg, NULL, 0); break;
+        case 'w': ws_pct = strtoul(optarg, NULL, 0); break;
+        case 's': sparse_pct = strtoul(optarg, NULL, 0); break;
+        case 'n': live = false; break;
+        case 'v': verbose = true; break;
+        default: usage(argv[0]);
+        }
+    }
+
+    if ( !mib || !ws_pct || ws_pct > 100 || sparse_pct > 100 )
+        usage(argv[0]);
+
+    nr_pages = mib << (20 - PAGE_SHIFT);
+    ws_pages = max(nr_pages * ws_pct / 100, 1UL);
+    dirty_pps = (double)(dirty_mib << (20 - PAGE_SHIFT));
+
+    init_dom(src);
+    init_dom(dst);
+
+    for ( pfn = 0; pfn < nr_pages; ++pfn )
+    {
+        uint64_t *p = (uint64_t *)(src->mem + (pfn << PAGE_SHIFT));
+
+        if ( pfn_is_sparse(pfn) )
+            continue;
+
+        for ( unsigned int i = 0; i < PAGE_SIZE / sizeof(*p); ++i )
+            p[i] = rng();
+    }
+
+    printf("Guest: %lu MiB, dirty rate %lu MiB/s over %lu%%, %u%% sparse, %s\n",
+           mib, dirty_mib, ws_pct, sparse_pct, live ? "live" : "non-live");
+
+    if ( pipe(pipefd) )
+        err(1, "pipe");
+
+    save.fd = pipefd[1];
+    restore.fd = pipefd[0];
+
+    if ( pthread_create(&restore_tid, NULL, restore_thread, &restore) ||
+         pthread_create(&save_tid, NULL, save_thread, &save) )
+        errx(1, "Unable to create threads");
+
+    pthread_join(save_tid, NULL);
+    pthread_join(restore_tid, NULL);
+
+    if ( save.rc || restore.rc )
+        errx(1, "Migration failed: save %d, restore %d", save.rc, restore.rc);
+
+    if ( memcmp(src->mem, dst->mem, nr_pages << PAGE_SHIFT) )
+        errx(1, "Restored memory differs from the source");
+
+    gib = (double)nr_pages / (1UL << (30 - PAGE_SHIFT));
+    save_s = (save.end_ns - save.start_ns) / 1e9;
+
+    printf("Pages sent:   %lu (%.2fx memory) in %lu log-dirty rounds\n",
+           src->pages_mapped, (double)src->pages_mapped / nr_pages,
+           src->cleans);
+    printf("Throughput:   %.0f pages/s, %.1f MiB/s\n",
+           src->pages_mapped / save_s,
+           src->pages_mapped / save_s / (1UL << (20 - PAGE_SHIFT)));
+    printf("CPU per GiB:  save %.3f s, restore %.3f s\n",
+           save.cpu_ns / 1e9 / gib, restore.cpu_ns / 1e9 / gib);
+    printf("Downtime:     %.3f ms\n",
+           (restore.end_ns - src->suspend_ns) / 1e6);
+
+    return 0;
+}
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * tab-width: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1,117 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/*
+ * Lookup cost of rangesets of increasing sizes, compared with a linear walk
+ * of an ordered list of the same ranges.
+ */
+
+#include <time.h>
+
+#include "harness.h"
+
+struct list_range {
+    struct list_head list;
+    unsigned long s, e;
+};
+
+static const unsigned int sizes[] = { 10, 1000, 100000 };
+
+/* Ranges are [4i, 4i + 1]: half of the lookups hit. */
+#define STRIDE 4
+
+static double now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static bool list_contains(const struct list_head *head, unsigned long s)
+{
+    const struct list_range *x = NULL, *y;
+
+    list_for_each_entry ( y, head, list )
+    {
+        if ( y->s > s )
+            break;
+        x = y;
+    }
+
+    return x && x->e >= s;
+}
+
+int main(int argc, char **argv)
+{
+    unsigned int i;
+
+    printf("%10s %10s %14s %14s\n", "ranges", "lookups", "rangeset ns",
+           "list walk ns");
+
+    for ( i = 0; i < ARRAY_SIZE(sizes); i++ )
+    {
+        unsigned int n = sizes[i], j, hits = 0, list_hits = 0;
+        /* Keep the linear walk to ~10^8 range visits per size. */
+        unsigned int lookups = min(1000000U, 200000000U / n);
+        struct rangeset *r = rangeset_new(NULL, NULL, 0);
+        struct list_range *ranges = calloc(n, sizeof(*ranges));
+        unsigned long *addrs = malloc(lookups * sizeof(*addrs));
+        LIST_HEAD(head);
+        double t0, t1, t2;
+
+        if ( !r || !ranges || !addrs )
+        {
+            printf("Allocation failed\n");
+            return EXIT_FAILURE;
+        }
+
+        for ( j = 0; j < n; j++ )
+        {
+            if ( rangeset_add_range(r, j * STRIDE, j * STRIDE + 1) )
+            {
+                printf("Failed to add range %u\n", j);
+                return EXIT_FAILURE;
+            }
+            ranges[j].s = j * STRIDE;
+            ranges[j].e = j * STRIDE + 1;
+            list_add_tail(&ranges[j].list, &head);
+        }
+
+        srand(n);
+        for ( j = 0; j < lookups; j++ )
+            addrs[j] = rand() % (n * STRIDE);
+
+        t0 = now_ns();
+        for ( j = 0; j < lookups; j++ )
+            hits += rangeset_contains_singleton(r, addrs[j]);
+        t1 = now_ns();
+        for ( j = 0; j < lookups; j++ )
+            list_hits += list_contains(&head, addrs[j]);
+        t2 = now_ns();
+
+        if ( hits != list_hits )
+        {
+            printf("Mismatch at %u ranges: %u vs %u hits\n", n, hits,
+                   list_hits);
+            return EXIT_FAILURE;
+        }
+
+        printf("%10u %10u %14.1f %14.1f\n", n, lookups,
+               (t1 - t0) / lookups, (t2 - t1) / lookups);
+
+        rangeset_destroy(r);
+        free(ranges);
+        free(addrs);
+    }
+
+    return 0;
+}
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
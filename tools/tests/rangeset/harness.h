@@ -28,6 +28,7 @@
 
 #include "list.h"
 #include "rangeset.h"
+#include "rbtree.h"
 
 typedef bool rwlock_t;
 typedef bool spinlock_t;
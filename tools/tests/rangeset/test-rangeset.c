@@ -140,6 +140,105 @@ static void print_both(struct rangeset *r, const struct range *expected,
         printf("[%ld, %ld]\n", expected[i].start, expected[i].end);
 }
 
+/*
+ * Random adds and removes, checking lookups and the reported ranges against
+ * a bitmap of the expected contents.
+ */
+#define RANDOM_SPACE 2048
+#define RANDOM_OPS   20000
+static bool present[RANDOM_SPACE];
+
+static int check_present(unsigned long s, unsigned long e, void *data)
+{
+    unsigned long *next = data;
+
+    /* Ranges must be ascending, merged, and match the bitmap. */
+    if ( s < *next || (s && *next == s && present[s - 1]) )
+        return -EINVAL;
+    for ( ; *next < s; ++*next )
+        if ( present[*next] )
+            return -EINVAL;
+    for ( ; *next <= e; ++*next )
+        if ( !present[*next] )
+            return -EINVAL;
+
+    return 0;
+}
+
+/* Whether [s, e] is all present (or all absent) in the bitmap. */
+static bool bitmap_all(unsigned long s, unsigned long e, bool val)
+{
+    for ( ; s <= e; s++ )
+        if ( present[s] != val )
+            return false;
+
+    return true;
+}
+
+static int test_random(struct rangeset *r)
+{
+    struct rangeset *tmp = rangeset_new(NULL, NULL, 0);
+    unsigned int i;
+
+    ASSERT(tmp);
+    rangeset_purge(r);
+    memset(present, 0, sizeof(present));
+    srand(1);
+
+    for ( i = 0; i < RANDOM_OPS; i++ )
+    {
+        unsigned long s = rand() % RANDOM_SPACE;
+        unsigned long e = min(s + rand() % 64, RANDOM_SPACE - 1UL), next = 0;
+        bool add = rand() % 3, j;
+        int rc;
+
+        rc = add ? rangeset_add_range(r, s, e) : rangeset_remove_range(r, s, e);
+        if ( rc )
+        {
+            printf("Random test failed to %s range [%lu, %lu]\n",
+                   add ? "add" : "remove", s, e);
+            return -1;
+        }
+        memset(&present[s], add, e - s + 1);
+
+        /* Exercise swapping the underlying list and tree. */
+        if ( !(i % 1000) )
+        {
+            rangeset_swap(r, tmp);
+            rangeset_swap(r, tmp);
+        }
+
+        s = rand() % RANDOM_SPACE;
+        e = min(s + rand() % 16, RANDOM_SPACE - 1UL);
+        j = rangeset_contains_range(r, s, e);
+        if ( j != bitmap_all(s, e, true) )
+        {
+            printf("Random test op %u: contains [%lu, %lu] returned %d\n",
+                   i, s, e, j);
+            return -1;
+        }
+        j = rangeset_overlaps_range(r, s, e);
+        if ( j == bitmap_all(s, e, false) )
+        {
+            printf("Random test op %u: overlaps [%lu, %lu] returned %d\n",
+                   i, s, e, j);
+            return -1;
+        }
+
+        if ( rangeset_report_ranges(r, 0, ~0UL, check_present, &next) ||
+             !bitmap_all(next, RANDOM_SPACE - 1, false) )
+        {
+            printf("Random test op %u: unexpected ranges\n", i);
+            rangeset_report_ranges(r, 0, ~0UL, print_range, NULL);
+            return -1;
+        }
+    }
+
+    rangeset_destroy(tmp);
+
+    return 0;
+}
+
 int main(int argc, char **argv)
 {
     struct rangeset *r = rangeset_new(NULL, NULL, 0);
@@ -215,6 +314,9 @@ int main(int argc, char **argv)
         }
     }
 
+    if ( test_random(r) )
+        ret_code = EXIT_FAILURE;
+
     return ret_code;
 }
 
@@ -0,0 +1,39 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx_aes_x86_32_D_16[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0xc9eff1c5, 0xec83e589, 0x7ff9c538, 0x4488d84d,
+0x8340c805, 0xf67510f8, 0x1d6ff9c5, 0x001000d0,
+0x156ff9c5, 0x001000e0, 0xdb79e2c4, 0xf9c5c865,
+0xc4c84d6f, 0x6ddd71e2, 0x51e2c4d8, 0xc5d86dde,
+0xc5e574d9, 0x81d4d7f9, 0x00fffffa, 0xc4557500,
+0x4ddf71e2, 0x71e2c4d8, 0xc5d84ddc, 0xe84d7ff9,
+0xdb79e2c4, 0xf1c5e84d, 0xc5c84d74, 0x81d1d7f9,
+0x00fffffa, 0xc4347500, 0x4ddf79e3, 0xe2c400c8,
+0xc5e30071, 0xc5cc74f1, 0x81d1d7f9, 0x00fffffa,
+0xc51f7500, 0xc84dfce9, 0x7ff9c548, 0x8875c84d,
+0x13ebc031, 0x00004ab8, 0xb80ceb00, 0x00000053,
+0x5eb805eb, 0xc9000000, 0x000000c3, 0x00000000,
+0x06050407, 0x00030201, 0x0e0d0c0f, 0x080b0a09,
+0x10101010, 0x10101010, 0x10101010, 0x10101010,
+0000360,
+};
+asm(".type avx_aes_x86_32_D_16, STT_NOTYPE;");
+asm(".type avx_aes_x86_32_D_16, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx_aes_x86_64_D_16[] = {
+0xc55500eb, 0x31c9eff1, 0xe58948c0, 0x4d7ff9c5,
+0x054488e0, 0xc0ff48d0, 0x10f88348, 0xf9c5f375,
+0x009a2d6f, 0xf9c50000, 0x00a2256f, 0xe2c40000,
+0xd055db79, 0x4d6ff9c5, 0x71e2c4d0, 0xc4e05ddd,
+0x5dde61e2, 0x74e9c5e0, 0xd7f9c5d3, 0xfffa81d2,
+0x750000ff, 0x71e2c456, 0xc4e04ddf, 0x4ddc71e2,
+0x7ff9c5e0, 0xe2c4f04d, 0xf04ddb79, 0x4d74f1c5,
+0xd7f9c5d0, 0xfffa81d1, 0x750000ff, 0x79e3c435,
+0x00d04ddf, 0x0071e2c4, 0x74f1c5d5, 0xd7f9c5ca,
+0xfffa81d1, 0x750000ff, 0xfcd9c520, 0xf9c5d04d,
+0xffd04d7f, 0x318775c8, 0xb813ebc0, 0x0000004a,
+0x53b80ceb, 0xeb000000, 0x005eb805, 0xc35d0000,
+0x06050407, 0x00030201, 0x0e0d0c0f, 0x080b0a09,
+0x10101010, 0x10101010, 0x10101010, 0x10101010,
+0000340,
+};
+asm(".type avx_aes_x86_64_D_16, STT_NOTYPE;");
+asm(".type avx_aes_x86_64_D_16, STT_FUNC;");
@@ -0,0 +1 @@
+simd-clmul.c
\ No newline at end of file
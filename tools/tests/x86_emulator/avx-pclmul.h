@@ -0,0 +1,94 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx_pclmul_x86_32_D_16[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x01b955c3,
+0xc5000000, 0x89c9eff1, 0x535657e5, 0x008cec81,
+0xf9c50000, 0x88a84d7f, 0x41a80d4c, 0x7510f983,
+0x6ff9c5f6, 0xf9c5a875, 0xc598757f, 0xc5e4efd9,
+0xb8657ff9, 0x6d6ff9c5, 0x51e3c498, 0x00b84d44,
+0x2971e2c4, 0xf9c5b84d, 0xff3dc1d7, 0x0f0000ff,
+0x00021b85, 0xb845c700, 0x00000001, 0x4589c031,
+0x6ff9c5bc, 0xe3c4b875, 0x984d4449, 0x7ff9c500,
+0xe3c4c84d, 0x984d4449, 0x79e3c410, 0x8901ca16,
+0xf9c5d455, 0xc5d04d7e, 0x985d6ff9, 0x2961e2c4,
+0xf9c5c84d, 0xff3dc1d7, 0x0f0000ff, 0x0001d685,
+0x61e3c400, 0x10984d44, 0x4461e3c4, 0xc4019855,
+0xca2971e2, 0xc1d7f9c5, 0x00ffff3d, 0xbb850f00,
+0xc4000001, 0x654461e3, 0xf9c50098, 0xc4c8657f,
+0x5d4461e3, 0xf9c51198, 0xc5d85d7f, 0x31edefd1,
+0x51e3c4db, 0xc408f40f, 0xcb0f51e3, 0xc5f63108,
+0xc5d46ff9, 0xc5fb6ff9, 0x88757ff9, 0x8d7ff9c5,
+0xffffff78, 0xd8f7d889, 0xc53fe083, 0xc5c86ef9,
+0xc5c9f3c1, 0xc5fb6ef9, 0xc5ffd3e1, 0xc4cfebf1,
+0x7d2969e2, 0xd7f9c5c8, 0xffff3dc7, 0xdf890000,
+0x014f850f, 0xe2c40000, 0xd87d2971, 0xc7d7f9c5,
+0x00ffff3d, 0x41850f00, 0xc5000001, 0xc5fe6ef9,
+0x98756ff9, 0xffd3c9c5, 0xf9c5d231, 0xe083f87e,
+0x70858901, 0xc5ffffff, 0x83d07ef9, 0xd28503e0,
+0x011d850f, 0x85390000, 0xffffff70, 0x0111850f,
+0xf8c50000, 0xff70bd17, 0x858bffff, 0xffffff70,
+0xe083d231, 0x70858901, 0xc5ffffff, 0x83c87ef9,
+0xd28503e0, 0x00f0850f, 0x85390000, 0xffffff70,
+0x00e4850f, 0xe3c40000, 0xc8550f51, 0x6ff9c508,
+0xf1c5c875, 0xc502d673, 0x3ef273e9, 0xcaebf1c5,
+0x4d7ff9c5, 0x51e3c4c8, 0x08d8550f, 0x6ff9c546,
+0xc383d875, 0x73f1c502, 0xfe8302d6, 0x73e9c540,
+0xf1c53ef2, 0xf9c5caeb, 0x74d84d7f, 0x3ffb8356,
+0xbd6ff9c5, 0xffffff78, 0xfeb82877, 0xc5ffffff,
+0x88756ff9, 0xcb6ef9c5, 0xd9c5f829, 0xe083c9d3,
+0x6ef9c53f, 0xf3c9c5d0, 0xebe9c5d2, 0xfed2e9d1,
+0x478dffff, 0x6ff9c5c2, 0xf9c58875, 0xff78bd6f,
+0xf9c5ffff, 0xc9c5c86e, 0xc1c5d1d3, 0xcce9c9d3,
+0xc5fffffe, 0xc00d6ff9, 0xc5001002, 0x984dd4f1,
+0x7ff9c549, 0x850f984d, 0xfffffdbf, 0x2febc031,
+0x000056b8, 0xb828eb00, 0x00000064, 0x73b821eb,
+0xeb000000, 0x0081b81a, 0x13eb0000, 0x000082b8,
+0xb80ceb00, 0x00000088, 0x89b805eb, 0x81000000,
+0x00008cc4, 0x5f5e5b00, 0x0000c35d, 0x00000000,
+0x10101010, 0x10101010, 0x10101010, 0x10101010,
+0001320,
+};
+asm(".type avx_pclmul_x86_32_D_16, STT_NOTYPE;");
+asm(".type avx_pclmul_x86_32_D_16, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx_pclmul_x86_64_D_16[] = {
+0xc55500eb, 0xb8c9eff1, 0x00000001, 0xc5e58948,
+0xc04d7ff9, 0xc0054488, 0x48c0ff48, 0x7510f883,
+0x6ff9c5f3, 0x10bfc07d, 0xc4000000, 0xc9ef3141,
+0x7d7ff9c5, 0x7f79c5b0, 0xf9c5d04d, 0xc4b06d6f,
+0x4d4451e3, 0xe2c400d0, 0xd04d2971, 0xc1d7f9c5,
+0x00ffff3d, 0xde850f00, 0x48000001, 0x01d045c7,
+0xc5000000, 0xd04d6ff9, 0x4471e3c4, 0xc500b055,
+0xe0557ff9, 0x4471e3c4, 0xc510b04d, 0xb0656ff9,
+0x4dd6f9c5, 0x59e2c4e8, 0xc5e04d29, 0x3dc1d7f9,
+0x0000ffff, 0x01a6850f, 0xe3c40000, 0xb04d4459,
+0x59e3c410, 0x01b05544, 0x2971e2c4, 0xd7f9c5ca,
+0xffff3dc1, 0x850f0000, 0x0000018b, 0x4459e3c4,
+0xc500b06d, 0xe06d7ff9, 0x4459e3c4, 0xc511b065,
+0xf0657ff9, 0xf6efc9c5, 0xd56ff9c5, 0xcc6ff9c5,
+0x63c4c931, 0x08c40f49, 0xb941f631, 0xfffffffe,
+0x0f49e3c4, 0x41c408fd, 0x89d06f79, 0x83d8f7c8,
+0xe1c43fe0, 0xc5d86ef9, 0xc5cbf3f1, 0xc5d96ef9,
+0xc5dbd3d9, 0xc4cbebf1, 0x5d2969e2, 0xc88941e0,
+0xc3d7f9c5, 0x00ffff3d, 0x1f850f00, 0xc4000001,
+0x5d2971e2, 0xd7f9c5f0, 0xffff3dc3, 0x850f0000,
+0x00000111, 0xf9c5f089, 0xc4b05d6f, 0xd86ef961,
+0x7ef9e1c4, 0x61c1c4d0, 0xe083dbd3, 0xf9e1c403,
+0xe283da7e, 0xc2394801, 0x00ee850f, 0xe3c40000,
+0x01da16f9, 0x7ef9e1c4, 0x01e283c8, 0x4803e083,
+0x850fc239, 0x000000db, 0x4d6ff9c5, 0x49e3c4e0,
+0xc508d10f, 0x02d173f1, 0xf273e9c5, 0xebf1c53e,
+0x7ff9c5ca, 0xf9c5e04d, 0xfff04d6f, 0x02c183c6,
+0x0f49e3c4, 0xf1c508d1, 0xc502d173, 0x3ef273e9,
+0xcaebf1c5, 0x4d7ff9c5, 0x40fe83f0, 0x79c54274,
+0xf983d17f, 0x4423773f, 0x2944c889, 0x3fe083c0,
+0x6ef9e1c4, 0xf3c1c5d8, 0x6ef9c5d3, 0xd3d1c5d9,
+0xebe9c5db, 0xff01e9d3, 0x8d41ffff, 0xe1c4c240,
+0xc5c86ef9, 0xc5d1d3c1, 0xe9c9d3b9, 0xffffff07,
+0x1010b848, 0x10101010, 0xe1c41010, 0xc5c86ef9,
+0xc5c96cf1, 0xb04dd4f1, 0x4d7ff9c5, 0x0fcfffb0,
+0xfffe0085, 0xebc031ff, 0x0056b82f, 0x28eb0000,
+0x000064b8, 0xb821eb00, 0x00000073, 0x81b81aeb,
+0xeb000000, 0x0082b813, 0x0ceb0000, 0x000088b8,
+0xb805eb00, 0x00000089, 0x0000c35d,
+0001152,
+};
+asm(".type avx_pclmul_x86_64_D_16, STT_NOTYPE;");
+asm(".type avx_pclmul_x86_64_D_16, STT_FUNC;");
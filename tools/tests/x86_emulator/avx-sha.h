@@ -0,0 +1,256 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx_sha_x86_32_D_16[] = {
+0x83e58955, 0x88e8f0e4, 0xc9000000, 0xf9c555c3,
+0xf9c5c86f, 0xe589d16f, 0xc548ec83, 0xc5d96ff9,
+0x40056ff9, 0xc5001007, 0xb8457ff9, 0x056ff9c5,
+0x00100750, 0x457ff9c5, 0x6ff9c5c8, 0x10076005,
+0x7ff9c500, 0xf9c5d845, 0x0770056f, 0xf9c50010,
+0xc5e8457f, 0x66c16ff9, 0xb845d20f, 0x55f20f66,
+0xeb0f66e8, 0x6ff9c5c2, 0x10078015, 0x7ff9c500,
+0xf9c5e855, 0x0f66d16f, 0x66d84dd2, 0xc855d20f,
+0x5df20f66, 0xeb0f66e8, 0xf9c5c9d3, 0xf9c5c2ef,
+0x55c3c1ef, 0x000001ba, 0x56e58900, 0x00ec8153,
+0xc5000001, 0x90056ff9, 0xc5001007, 0x68857ff9,
+0xc5ffffff, 0xc5c0eff9, 0x78857ff9, 0x88ffffff,
+0xff781594, 0x8342ffff, 0xf37510fa, 0xad6ff9c5,
+0xffffff78, 0xf6efc9c5, 0xad7ff9c5, 0xffffff58,
+0xf6cc3a0f, 0x7ff9c501, 0xffff28b5, 0xefd1c5ff,
+0xfad1c5ed, 0xffff5885, 0x7ff9c5ff, 0xf9c59845,
+0x380fd06f, 0xff5895c9, 0xe3c4ffff, 0x588d0f79,
+0x08ffffff, 0xc9eff9c5, 0xca76f1c5, 0xc1d7f9c5,
+0x00ffff3d, 0x90850f00, 0xc5000005, 0x0fd86ff9,
+0x589dca38, 0xc5ffffff, 0x58b56ff9, 0xc4ffffff,
+0xc80f49e3, 0xeff9c50c, 0x7ff9c5c9, 0xf9c5884d,
+0xc5887d6f, 0x01f772e9, 0xd772f1c5, 0xebe9c51f,
+0x49e3c4d1, 0xc50cd20f, 0xc5d0efe9, 0x88557ff9,
+0x7d6ff9c5, 0x72f1c588, 0xe9c501f7, 0xc51fd772,
+0xc5caebf1, 0xc5cb76f1, 0x3dc1d7f9, 0x0000ffff,
+0x052c850f, 0xf9c50000, 0x380fd86f, 0xff589dca,
+0xf9c5ffff, 0x07a0356f, 0xc9c50010, 0xff688dfa,
+0xf9c5ffff, 0xff58bd6f, 0xe3c4ffff, 0x0cd00f41,
+0xd2eff9c5, 0x4d7ff9c5, 0x6ff9c5e8, 0xf20f66ca,
+0xffff688d, 0xd20f66ff, 0x0f66e855, 0xe3c4caeb,
+0x0cc90f41, 0xc9eff9c5, 0xd16ff9c5, 0x95f20f66,
+0xffffff68, 0x4dd20f66, 0xeb0f66e8, 0x76e1c5d1,
+0xd7f9c5da, 0xffff3dc3, 0x850f0000, 0x000004b9,
+0x85c8380f, 0xffffff58, 0xf9c5c031, 0xc5984d6f,
+0x1ef172e9, 0xd172e1c5, 0x6ff9c502, 0xffff58b5,
+0xebe9c5ff, 0x7ff9c5d3, 0x45898855, 0x8c458988,
+0xc5904589, 0x8855fec9, 0xc076e9c5, 0xc0d7f9c5,
+0x00ffff3d, 0x75850f00, 0x0f000004, 0x588dcc3a,
+0x01ffffff, 0x8d7ff9c5, 0xffffff18, 0x7d6ff9c5,
+0x73e9c598, 0xe1c50cdf, 0xc508df73, 0x986d6ff9,
+0xf572f9c5, 0x72f1c51e, 0xc03102d5, 0xb56ff9c5,
+0xffffff28, 0xc1ebf9c5, 0xa56ff9c5, 0xffffff28,
+0x0e79e3c4, 0xc50f9845, 0x02f472d9, 0xf873c1c5,
+0x73d1c504, 0xf9c504d8, 0xff48857f, 0xf9c5ffff,
+0xc51ed672, 0x38bd7ff9, 0xc5ffffff, 0x58b570f9,
+0x1bffffff, 0xe0ebd9c5, 0xe470f9c5, 0x72f1c500,
+0xc1c505f2, 0xc51bd272, 0xc5c5efe1, 0xc5cfebf1,
+0x4885eff9, 0xc5ffffff, 0xc5c1fef9, 0x83c6fef9,
+0xf9c501f8, 0xff3885fe, 0xf9c5ffff, 0x4674c4fe,
+0x7402f883, 0x75c08533, 0x72f1c551, 0xc1c51ef0,
+0xc502d072, 0xc5cfebf1, 0xc4c87ef9, 0xe82251e3,
+0x7ef9c503, 0x61e3c4c0, 0xc402d822, 0xd02269e3,
+0x0001b801, 0x95eb0000, 0x1679e3c4, 0xe3c402c1,
+0x03d12269, 0xe3c428eb, 0x01c11679, 0x2261e3c4,
+0xe3c403d9, 0x02d12269, 0xe3c436eb, 0x02c11679,
+0x1679e3c4, 0xd93903d3, 0x0359850f, 0xe3c40000,
+0x01c11679, 0x1679e3c4, 0xcb3902d3, 0x034c850f,
+0xe3c40000, 0x03d91679, 0x850fd939, 0x00000345,
+0xc17ef9c5, 0x1679e3c4, 0xcb3901d3, 0x033a850f,
+0xe3c40000, 0x02d91679, 0x850fd939, 0x00000333,
+0xf072f1c5, 0x72c1c51e, 0xe3c402d0, 0x03e91679,
+0xcfebf1c5, 0xcb7ef9c5, 0x850fd939, 0x0000031a,
+0x04f88340, 0xfef3850f, 0xe3c4ffff, 0xf0c80e71,
+0x8d76f1c5, 0xffffff18, 0xc1d7f9c5, 0x00ffff3d,
+0xfa850f00, 0xc5000002, 0x98656ff9, 0xdc6ff9c5,
+0x9dcc380f, 0xffffff58, 0xad6ff9c5, 0xffffff58,
+0x0f51e3c4, 0xf9c504c4, 0xc5e8457f, 0xe8756ff9,
+0xd672e9c5, 0x72f9c507, 0xe9c519f6, 0xf9c5d0eb,
+0xc5e86d6f, 0x0ef572f9, 0xd572f1c5, 0xebf9c512,
+0xeff9c5c1, 0x6ff9c5c2, 0xf1c5e87d, 0xc503d772,
+0xc5c1eff9, 0xc5c4fef9, 0xc5c376f9, 0x3dc0d7f9,
+0x0000ffff, 0x028e850f, 0xf9c50000, 0x380fec6f,
+0xff58adcd, 0xf9c5ffff, 0xff58b56f, 0xe3c4ffff,
+0x08c60f59, 0xfffb74e8, 0xfed9c5ff, 0x79e3c4c0,
+0xe808c60f, 0xfffffb65, 0xc0fed9c5, 0xc576f9c5,
+0xc0d7f9c5, 0x00ffff3d, 0x50850f00, 0x8b000002,
+0xd0f79c45, 0xd86ef9c5, 0x5d7ff9c5, 0x6ff9c588,
+0xffff58ad, 0x6ff9c5ff, 0x6ff9c5f4, 0x7ff9c5c5,
+0xffff38ad, 0xcb380fff, 0xf9c58875, 0xff18b57f,
+0xf9c5ffff, 0xdb31c0ef, 0x0f79e3c4, 0xf9c508f4,
+0xc59c7d6e, 0x44e470f9, 0x2241e3c4, 0xc5018845,
+0x48b57ff9, 0xc5ffffff, 0xc5d86cf9, 0xf8a57ff9,
+0xc5fffffe, 0x089d7ff9, 0xc5ffffff, 0xc5c0eff9,
+0x06d072c1, 0xf072c9c5, 0x70f9c515, 0xffff38a5,
+0xe1c544ff, 0xc51af072, 0x0bd072e9, 0xf072f1c5,
+0x72d1c507, 0xc1c519d0, 0xe9c5dbeb, 0xf1c5d6eb,
+0xe1c5cdeb, 0xe9c5d2ef, 0xf9c5c9ef, 0xff0895df,
+0xf1c5ffff, 0xe9c5d2fe, 0xf9c5d4fe, 0x07b0356f,
+0xf9c50010, 0xff48a56f, 0xf9c5ffff, 0x07c03d6f,
+0xf9c50010, 0x07d01d6f, 0xe9c50010, 0xfef895fe,
+0xf9c5ffff, 0xc5a8657f, 0xb8757ff9, 0x7d7ff9c5,
+0x7ff9c5c8, 0xc031d85d, 0xb8854c8b, 0xa885748b,
+0x7489ced3, 0x8340e885, 0xec7504f8, 0x4d6ff9c5,
+0x8bc031e8, 0x8bc8854c, 0xd3a88574, 0x857489ce,
+0xf88340e8, 0xc5ec7504, 0xe84deff1, 0x4c8bc031,
+0x748bd885, 0xc6d3a885, 0xe8857489, 0x04f88340,
+0xf1c5ec75, 0x85e84def, 0xfef1c5db, 0x79e3c4ca,
+0x7502c916, 0x6ff9c530, 0xffff48ad, 0x7ef9c5ff,
+0x51e3c4c8, 0xc403e122, 0xc02279e3, 0x0001bb01,
+0xf9c50000, 0xff48a57f, 0xe3c4ffff, 0x03c02279,
+0xfffeeae9, 0x6ff9c5ff, 0xffff48b5, 0x79e3c4ff,
+0x3903f016, 0xbb850fc8, 0xc5000000, 0xc4c87ef9,
+0xc11679e3, 0x0fc13901, 0x0000b085, 0x79e3c400,
+0x3903c016, 0xa9850fc8, 0xc5000000, 0x188d76f1,
+0xc5ffffff, 0x3dc1d7f9, 0x0000ffff, 0x0099850f,
+0x10b80000, 0x4a101010, 0xd86ef9c5, 0xc370f9c5,
+0xfef9c500, 0xffff5885, 0x7ff9c5ff, 0xffff5885,
+0x36850fff, 0x31fffffa, 0xb875ebc0, 0x0000009a,
+0xa6b86eeb, 0xeb000000, 0x00aeb867, 0x60eb0000,
+0x0000b7b8, 0xb859eb00, 0x00000108, 0x0bb852eb,
+0xeb000001, 0x010cb84b, 0x44eb0000, 0x00010fb8,
+0xb83deb00, 0x00000110, 0x11b836eb, 0xeb000001,
+0x0118b82f, 0x28eb0000, 0x00011fb8, 0xb821eb00,
+0x00000127, 0x7bb81aeb, 0xeb000001, 0x017db813,
+0x0ceb0000, 0x00017fb8, 0xb805eb00, 0x00000182,
+0x0100c481, 0x5e5b0000, 0x0000c35d, 0x00000000,
+0x00000011, 0x00000000, 0x00000000, 0x00000000,
+0x00000013, 0x00000000, 0x00000000, 0x00000000,
+0x0000000a, 0x00000000, 0x00000000, 0x00000000,
+0x0000000f, 0x00000000, 0x00000000, 0x00000000,
+0x0000000d, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000000, 0x00000000, 0x00000000,
+0x00000020, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000002, 0x00000002,
+0x00000000, 0x00000000, 0x0000000d, 0x0000000d,
+0x00000000, 0x00000000, 0x0000000a, 0x0000000a,
+0003740,
+};
+asm(".type avx_sha_x86_32_D_16, STT_NOTYPE;");
+asm(".type avx_sha_x86_32_D_16, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx_sha_x86_64_D_16[] = {
+0x000080e9, 0xf9c55500, 0xf9c5d06f, 0x8948d86f,
+0x6ff9c5e5, 0x0006b70d, 0x7ff9c500, 0xf9c5c04d,
+0x06ba0d6f, 0xf9c50000, 0xc5d04d7f, 0xbd0d6ff9,
+0xc5000006, 0xe04d7ff9, 0x0d6ff9c5, 0x000006c0,
+0x4d7ff9c5, 0x6ff9c5f0, 0xd20f66c8, 0x0f66c04d,
+0x66f055f2, 0xc5caeb0f, 0xb1156ff9, 0xc5000006,
+0xf0557ff9, 0xd06ff9c5, 0x45d20f66, 0xd20f66e0,
+0x0f66d055, 0x66f05df2, 0xc5d3eb0f, 0xc5caeff1,
+0x5dc0eff1, 0x01b855c3, 0x48000000, 0x8148e589,
+0x0000d0ec, 0x6ff9c500, 0x00068305, 0x7ff9c500,
+0xffff7085, 0xeff9c5ff, 0x7ff9c5c0, 0x44888045,
+0xff488005, 0xf88348c0, 0xc4f37510, 0xc0ef3941,
+0x7d6ff9c5, 0x6f79c580, 0x00066325, 0x0010ba00,
+0x79c50000, 0x79c5c07f, 0x06622d6f, 0x79c50000,
+0x066a356f, 0x0f410000, 0x01c0cc3a, 0x3d6f79c5,
+0x0000066c, 0xbd7ff9c5, 0xffffff60, 0xf072f1c5,
+0x72f9c502, 0xf1c51ed0, 0xf9c5c0eb, 0xc500e870,
+0x30ad7ff9, 0xc5ffffff, 0x6085fab9, 0xc5ffffff,
+0xa0457ff9, 0xd06ff9c5, 0x95c9380f, 0xffffff60,
+0x0f79e3c4, 0xffff608d, 0xf9c508ff, 0xf1c5c9ef,
+0xf9c5ca76, 0xff3dc1d7, 0x0f0000ff, 0x00050185,
+0x6ff9c500, 0xca380fd8, 0xffff609d, 0x6ff9c5ff,
+0xffff608d, 0x71e3c4ff, 0xc50cd00f, 0xc5d2eff9,
+0x90557ff9, 0x556ff9c5, 0x72d9c590, 0xe9c501f2,
+0xc51fd272, 0xc4d2ebd9, 0xca0f71e3, 0xeff1c50c,
+0x7ff9c5c8, 0xf9c5904d, 0xc590556f, 0x01f272f1,
+0xd272e9c5, 0xebf1c51f, 0x76f1c5ca, 0xd7f9c5cb,
+0xffff3dc1, 0x850f0000, 0x0000049d, 0xd86ff9c5,
+0x9dca380f, 0xffffff60, 0x8dfa99c5, 0xffffff70,
+0x4d7ff9c5, 0x6ff9c5f0, 0xffff608d, 0x71e3c4ff,
+0xc50cd00f, 0xc5d2eff9, 0x66e26ff9, 0x70a5f20f,
+0x66ffffff, 0xf055d20f, 0xe2eb0f66, 0x0f71e3c4,
+0xf9c50ccc, 0xf9c5c9ef, 0x0f66d16f, 0xff7095f2,
+0x0f66ffff, 0x66f04dd2, 0xc5d1eb0f, 0xc5da76e1,
+0x3dc3d7f9, 0x0000ffff, 0x0432850f, 0x380f0000,
+0xff6085c8, 0xf9c5ffff, 0x31a06d6f, 0xc5c931c0,
+0x60bd6ff9, 0xc5ffffff, 0x1ef572f1, 0xd572e9c5,
+0xebf1c502, 0x7ff9c5ca, 0x8948904d, 0x4d899045,
+0xfec1c598, 0xf1c5904d, 0xf9c5c076, 0xff3dc0d7,
+0x0f0000ff, 0x0003ee85, 0xcc3a0f00, 0xffff60ad,
+0xf9c501ff, 0xc5a05d6f, 0x0cdb73f1, 0xdb73e1c5,
+0x6ff9c508, 0xd9c5a045, 0xc51ef072, 0x02d072f9,
+0x8d7079c5, 0xffffff60, 0xebd9c51b, 0xc4c031e0,
+0x650e59e3, 0xf9c50fa0, 0xc9c5fc6f, 0xc504dc73,
+0x04fc73d9, 0xf172e9c5, 0x72a9c505, 0xe1c51bd1,
+0xf9c5c6ef, 0xc1c4c7ef, 0xc5d2eb69, 0xc4c2fef9,
+0xc1fe79c1, 0xc4fef9c5, 0x85fef9c5, 0xffffff30,
+0x7401f883, 0x02f88347, 0xc0853474, 0xe9c55275,
+0xc51ef072, 0x02d072a9, 0xeb69c1c4, 0x7ef9c5d2,
+0x49e3c4d0, 0xc503f022, 0xc4c07ef9, 0xd82261e3,
+0x71e3c402, 0xb801c822, 0x00000001, 0xe3c496eb,
+0x02c11679, 0x2271e3c4, 0x28eb03c9, 0x1679e3c4,
+0xe3c401c1, 0x03d92261, 0x2271e3c4, 0x36eb02c9,
+0x1679e3c4, 0xe3c402c1, 0x03ce1679, 0x850ff139,
+0x0000030a, 0x1679e3c4, 0xe3c401c1, 0x02ce1679,
+0x850fce39, 0x000002fd, 0x1679e3c4, 0xf13903d9,
+0x02f6850f, 0xf9c50000, 0xe3c4c17e, 0x01ce1679,
+0x850fce39, 0x000002eb, 0x1679e3c4, 0xf13902d9,
+0x02e4850f, 0xe9c50000, 0xc51ef072, 0x02d072a9,
+0x1679e3c4, 0xc1c403f1, 0xc5d2eb69, 0x39d67ef9,
+0xca850ff1, 0xff000002, 0x04f883c0, 0xfef2850f,
+0xe3c4ffff, 0xf0d00e69, 0xd576e9c5, 0xc2d7f9c5,
+0x00ffff3d, 0xad850f00, 0xc5000002, 0xa0756ff9,
+0xd66ff9c5, 0x95cc380f, 0xffffff60, 0xad6ff9c5,
+0xffffff60, 0x0f51e3c4, 0xf9c504c6, 0xc5f0457f,
+0xf0456ff9, 0xd072e1c5, 0x72f9c507, 0xe1c519f0,
+0xf9c5d8eb, 0xc5f04d6f, 0x0ef172f9, 0xd172f1c5,
+0xebf9c512, 0xeff9c5c1, 0x6ff9c5c3, 0xf1c5f07d,
+0xc503d772, 0xc5c1eff9, 0xc5c6fef9, 0xc5c276f9,
+0x3dc0d7f9, 0x0000ffff, 0x0241850f, 0xf9c50000,
+0x380fe66f, 0xff60a5cd, 0xf9c5ffff, 0xff60ad6f,
+0xe3c4ffff, 0x08c50f49, 0xfffb88e8, 0xfec9c5ff,
+0x79e3c4c0, 0xe808c50f, 0xfffffb79, 0xc0fec9c5,
+0xc476f9c5, 0xc0d7f9c5, 0x00ffff3d, 0x03850f00,
+0x8b000002, 0xd0f7a445, 0xe86ef9c5, 0x6d7ff9c5,
+0x6ff9c590, 0xffff6085, 0x6ff9c5ff, 0xcb380ffe,
+0xf9c5907d, 0xff50bd7f, 0xf9c5ffff, 0xc5a47d6e,
+0xc5e4efd9, 0x44de70f9, 0xe3c4f631, 0x906d2241,
+0x59e3c401, 0xc508e60f, 0xc5c9eff1, 0x44c070f9,
+0xed6cd1c5, 0xd172a1c5, 0x72c1c506, 0xf9c51af1,
+0xc5b0657f, 0x0bd172e9, 0xf172a9c5, 0xeba1c515,
+0x7f79c5ff, 0xc9c5c06d, 0xc507f172, 0x19d172b1,
+0xeb69c1c4, 0x7f79c5d2, 0xc1c5d075, 0xc1c4d2ef,
+0xc5f1eb49, 0xe07d7f79, 0xf6efe9c5, 0xd5dff1c5,
+0xf2fec9c5, 0xf0fec9c5, 0xf3fec9c5, 0x7c8bc031,
+0x4c8bb028, 0x8348c005, 0xbd8904c0, 0xffffff4c,
+0x7c89cfd3, 0x8348ec28, 0xe27510f8, 0x556ff9c5,
+0x8bc031f0, 0x8bb0057c, 0x89d0054c, 0xffff4cbd,
+0x89cfd3ff, 0x48f0057c, 0x4804c083, 0x7510f883,
+0xefe9c5e2, 0xc031f055, 0xb0057c8b, 0xe0054c8b,
+0xff4cbd89, 0xc7d3ffff, 0xf0057c89, 0x04c08348,
+0x10f88348, 0xe9c5e275, 0x85f055ef, 0xfee9c5f6,
+0x79e3c4d6, 0x7502d116, 0x7ef9c520, 0x59e3c4d0,
+0xbe03e122, 0x00000001, 0x2271e3c4, 0xe3c401c8,
+0x03c82271, 0xffff0be9, 0x79e3c4ff, 0x3903e016,
+0xb6850fc8, 0xc5000000, 0xc4d07ef9, 0xc91679e3,
+0x0fc13901, 0x0000ab85, 0x79e3c400, 0x3903c816,
+0xa4850fc8, 0xc5000000, 0x509576e9, 0xc5ffffff,
+0x3dc2d7f9, 0x0000ffff, 0x0094850f, 0xf9c50000,
+0x013a056f, 0xf9c50000, 0xff6085fe, 0xf9c5ffff,
+0xff60857f, 0xcaffffff, 0xfac9850f, 0xc031ffff,
+0x9ab875eb, 0xeb000000, 0x00a6b86e, 0x67eb0000,
+0x0000aeb8, 0xb860eb00, 0x000000b7, 0x08b859eb,
+0xeb000001, 0x010bb852, 0x4beb0000, 0x00010cb8,
+0xb844eb00, 0x0000010f, 0x10b83deb, 0xeb000001,
+0x0111b836, 0x2feb0000, 0x000118b8, 0xb828eb00,
+0x0000011f, 0x27b821eb, 0xeb000001, 0x017bb81a,
+0x13eb0000, 0x00017db8, 0xb80ceb00, 0x0000017f,
+0x82b805eb, 0xc9000001, 0x000000c3, 0x00000000,
+0x00000011, 0x00000000, 0x00000000, 0x00000000,
+0x00000013, 0x00000000, 0x00000000, 0x00000000,
+0x0000000a, 0x00000000, 0x00000000, 0x00000000,
+0x0000000f, 0x00000000, 0x00000000, 0x00000000,
+0x0000000d, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000000, 0x00000000, 0x00000000,
+0x00000020, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000002, 0x00000002,
+0x00000000, 0x00000000, 0x0000000d, 0x0000000d,
+0x00000000, 0x00000000, 0x0000000a, 0x0000000a,
+0x10101010, 0x10101010, 0x10101010, 0x10101010,
+0003600,
+};
+asm(".type avx_sha_x86_64_D_16, STT_NOTYPE;");
+asm(".type avx_sha_x86_64_D_16, STT_FUNC;");
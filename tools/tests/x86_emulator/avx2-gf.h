@@ -0,0 +1,69 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_gf_x86_32_D_16[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0xec83e589, 0x05448838, 0x0544c6c8, 0x834001d8,
+0xf17510f8, 0x00d845c6, 0x00000fb8, 0x76e1c500,
+0x79e2c4db, 0x00b02559, 0xf9c50010, 0xc5e8657f,
+0xc8756ff9, 0xcfc9e3c4, 0xc500e84d, 0xe84d7ff9,
+0x7d6ff9c5, 0x41e2c4c8, 0xc5e84dcf, 0xd8556ff9,
+0xc974e9c5, 0x1779e2c4, 0xc53573cb, 0xc84d6ff9,
+0xcf71e2c4, 0xe9c5e86d, 0xe2c4d574, 0x73d31779,
+0xd845c626, 0x4810b201, 0xd26ef9c5, 0x7879e2c4,
+0xfcf1c5d2, 0x7ff9c5ca, 0x9e75c84d, 0x0cebc031,
+0x000043b8, 0xb805eb00, 0x00000047, 0x0000c3c9,
+0x10204080, 0x01020408,
+0000270,
+};
+asm(".type avx2_gf_x86_32_D_16, STT_NOTYPE;");
+asm(".type avx2_gf_x86_32_D_16, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_gf_x86_32_D_32[] = {
+0x315500eb, 0x83e589c0, 0xec83e0e4, 0x04048860,
+0x200444c6, 0xf8834001, 0xc6f27520, 0x00202444,
+0x000007b8, 0x76e5c500, 0x7de2c4db, 0x00b02559,
+0xfdc50010, 0x4024647f, 0x346ffdc5, 0xcde3c424,
+0x40244ccf, 0x7ffdc500, 0xc540244c, 0x243c6ffd,
+0xcf45e2c4, 0xc540244c, 0x24546ffd, 0x74edc520,
+0x7de2c4c9, 0x3773cb17, 0x0c6ffdc5, 0x75e2c424,
+0x40246ccf, 0xd574edc5, 0x177de2c4, 0xc62773d3,
+0x01202444, 0xc54820b2, 0xc4d26ef9, 0xd2787de2,
+0xcafcf5c5, 0x0c7ffdc5, 0x31977524, 0xb80cebc0,
+0x00000043, 0x47b805eb, 0xc9000000, 0x000000c3,
+0x10204080, 0x01020408,
+0000270,
+};
+asm(".type avx2_gf_x86_32_D_32, STT_NOTYPE;");
+asm(".type avx2_gf_x86_32_D_32, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_gf_x86_64_D_16[] = {
+0x315500eb, 0xe58948c0, 0xd0054488, 0xe00544c6,
+0xc0ff4801, 0x10f88348, 0x45c6ee75, 0xf9c500e0,
+0x009a2d6f, 0x0fb80000, 0xc5000000, 0xc4e476d9,
+0x355979e2, 0x00000078, 0x757ff9c5, 0x6ff9c5f0,
+0xe3c4d07d, 0xf04dcfc1, 0x7ff9c500, 0xf9c5f04d,
+0xc5d05d6f, 0xe0556ff9, 0xcf61e2c4, 0xe9c5f04d,
+0xe2c4c974, 0x73cc1779, 0x6ff9c52b, 0xe2c4d04d,
+0xf05dcf71, 0xd374e9c5, 0x1779e2c4, 0xc51c73d4,
+0xc6cdfcf1, 0xc501e045, 0xd04d7ff9, 0xa875c8ff,
+0x0cebc031, 0x000043b8, 0xb805eb00, 0x00000047,
+0x0000c35d, 0x00000000, 0x00000000, 0x00000000,
+0x10204080, 0x01020408, 0x00000000, 0x00000000,
+0x10101010, 0x10101010, 0x10101010, 0x10101010,
+0000320,
+};
+asm(".type avx2_gf_x86_64_D_16, STT_NOTYPE;");
+asm(".type avx2_gf_x86_64_D_16, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_gf_x86_64_D_32[] = {
+0x315500eb, 0xe58948c0, 0xe0e48348, 0xa0044488,
+0xc00444c6, 0xc0ff4801, 0x20f88348, 0x20b2ee75,
+0xc02444c6, 0x0007b800, 0xd5c50000, 0xf9c5ed76,
+0xe2c4da6e, 0xc4db787d, 0x35597de2, 0x00000078,
+0x747ffdc5, 0xfdc5e024, 0xa0247c6f, 0xcfc5e3c4,
+0x00e0244c, 0x4c7ffdc5, 0xfdc5e024, 0xa024646f,
+0x546ffdc5, 0xe2c4c024, 0x244ccf5d, 0x74edc5e0,
+0x7de2c4c9, 0x2f73cd17, 0x4c6ffdc5, 0xe2c4a024,
+0x2464cf75, 0x74edc5e0, 0x7de2c4d4, 0x1e73d517,
+0xcbfcf5c5, 0xc02444c6, 0x7ffdc501, 0xffa0244c,
+0x319d75c8, 0xb80cebc0, 0x00000043, 0x47b805eb,
+0xc9000000, 0x000000c3, 0x10204080, 0x01020408,
+0000300,
+};
+asm(".type avx2_gf_x86_64_D_32, STT_NOTYPE;");
+asm(".type avx2_gf_x86_64_D_32, STT_FUNC;");
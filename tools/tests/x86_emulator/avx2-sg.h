@@ -0,0 +1,2078 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_32_D_16x4i4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xe58955c3,
+0x54ec8353, 0x01d845c7, 0xc7000000, 0x0004e845,
+0x45c70000, 0x000002dc, 0xec45c700, 0x00000003,
+0x03e045c7, 0xc7000000, 0x0002f045, 0x45c70000,
+0x000004e4, 0xf445c700, 0x00000001, 0xe9c5c031,
+0xe1c5d276, 0xf9c5dbef, 0xe2c4fa6f, 0x1d0c9041,
+0x00100240, 0x4d7ff9c5, 0x857c83b8, 0x850f01b8,
+0x00000198, 0x04f88340, 0xf9c5ef75, 0xc5d85d6f,
+0xc4f26ff9, 0x0c9049e2, 0x1002409d, 0x7ef9c500,
+0x02fa83ca, 0x0000efb8, 0x87850f00, 0xc4000001,
+0xca1679e3, 0x03fa8301, 0x0178850f, 0xe3c40000,
+0x02ca1679, 0x0f04fa83, 0x00016985, 0x79e3c400,
+0x8303ca16, 0x850f05fa, 0x0000015a, 0xf372d9c5,
+0x6ff9c502, 0x00f7b8fa, 0xe2c40000, 0x650c9041,
+0x00100240, 0xca7ef9c5, 0x0f03fa83, 0x00013585,
+0x79e3c400, 0x8301ca16, 0x850f05fa, 0x00000126,
+0x1679e3c4, 0xfa8302ca, 0x17850f07, 0xc4000001,
+0xca1679e3, 0x09fa8303, 0x0108850f, 0xc0310000,
+0x4d6ff9c5, 0x6ff9c5e8, 0x49e2c4f2, 0x408d2490,
+0xc5001002, 0xb8657ff9, 0xe8854c8b, 0x8db44d89,
+0x54390151, 0x850fb885, 0x000000c7, 0x04f88340,
+0x01b8e675, 0xc5000000, 0xc5edefd1, 0xc5ebfad1,
+0xc4fa6ff9, 0x349041e2, 0x100250ad, 0x6ef9c500,
+0x70f9c5f8, 0xd9c500ef, 0x07b8e5fa, 0xc5000001,
+0xc5e676d9, 0xc4ed76d1, 0xe51779e2, 0x0094830f,
+0xd1c50000, 0x3101f172, 0x69e2c4c0, 0x406d2490,
+0xc5001002, 0xb8657ff9, 0xe8854c8b, 0x8db44d89,
+0x54390151, 0x6275b885, 0x04f88340, 0xc031ea75,
+0x000005b9, 0xefe9c500, 0xdbe1c5d2, 0x76f1c5c9,
+0x76f1c5ca, 0x71e2c4ca, 0x409d2490, 0xc5001002,
+0xc8657ff9, 0xc8855c8b, 0x2940ca89, 0x74c285c2,
+0x85548b06, 0x8b07ebd4, 0x89e48554, 0x3942b455,
+0x831e75d3, 0xdc7504f8, 0x1aebc031, 0x0000e7b8,
+0xb813eb00, 0x000000ff, 0x15b80ceb, 0xeb000001,
+0x011eb805, 0xc4830000, 0xc35d5b54, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000002, 0x00000003, 0x00000004,
+0x00000005, 0x00000006, 0x00000007, 0x00000008,
+0x00000009, 0x0000000a, 0x0000000b, 0x0000000c,
+0x0000000d, 0x0000000e, 0x0000000f, 0x00000010,
+0x00000011, 0x00000012, 0x00000013, 0x00000014,
+0x00000015, 0x00000016, 0x00000017, 0x00000018,
+0x00000019, 0x0000001a, 0x0000001b, 0x0000001c,
+0x0000001d, 0x0000001e, 0x0000001f, 0x00000020,
+0001300,
+};
+asm(".type avx2_sg_x86_32_D_16x4i4, STT_NOTYPE;");
+asm(".type avx2_sg_x86_32_D_16x4i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_32_D_16x4i8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc93155c3,
+0x5657e589, 0x3cec8353, 0x01c845c7, 0xc7000000,
+0x0002d845, 0x45c70000, 0x000002cc, 0xdc45c700,
+0x00000001, 0x03d045c7, 0x89000000, 0x45c7e04d,
+0x000004d4, 0xe445c700, 0xffffffff, 0xc976f1c5,
+0xdbefe1c5, 0xf16ff9c5, 0x90c9e2c4, 0x02201d14,
+0xf9c50010, 0xe3c4d17e, 0x01d31679, 0xe7c045c7,
+0x89000000, 0x01f083c8, 0x850fd809, 0x00000178,
+0x5517f8c5, 0xb8458bb8, 0x0b01f083, 0x850fbc45,
+0x00000164, 0x6d6ff9c5, 0x6ff9c5c8, 0xc1e2c4f9,
+0x20ed1490, 0xc5001002, 0xc4d17ef9, 0xd31679e3,
+0xc045c701, 0x000000ef, 0xf083c889, 0x0fd80902,
+0x00013385, 0x17f8c500, 0x458bb855, 0x03f083b8,
+0x0fbc450b, 0x00011f85, 0x72e1c500, 0xf9c503f5,
+0xe2c4f16f, 0x5d1490c9, 0x00100220, 0xd17ef9c5,
+0x1679e3c4, 0x45c701d3, 0x0000f7c0, 0x83c88900,
+0xd80903f0, 0x00ee850f, 0xf8c50000, 0x8bb85517,
+0xf083b845, 0xbc450b05, 0x00da850f, 0x458b0000,
+0x6ff9c5d8, 0xf9c5d85d, 0xe2c4f96f, 0xdd1490c1,
+0x00100220, 0x1679e3c4, 0x588d01d2, 0x7ef9c501,
+0xc1df89d0, 0xd7391fff, 0x009a850f, 0xc3390000,
+0x0092850f, 0x458b0000, 0x17f8c5dc, 0x558bc055,
+0x01488dc4, 0x89b84d89, 0x1ff8c1c8, 0x8bbc4589,
+0x5539c045, 0x397175bc, 0xc56d75c1, 0x2015fbe9,
+0xc5001003, 0xc5e4efd9, 0xc5e5fad9, 0xc4f16ff9,
+0x2c90c9e2, 0x100230e5, 0xc045c700, 0x00000107,
+0x2969e2c4, 0x79e2c4d5, 0x4c73d117, 0xf372e1c5,
+0xf1e2c401, 0x209d1490, 0xc4001002, 0xd21679e3,
+0xc5d73901, 0x75d07ef9, 0x75c33928, 0x17f8c524,
+0x558bc055, 0xbc5539c4, 0x75c0458b, 0x39d23114,
+0xc05589c1, 0x10eb0b75, 0xffc045c7, 0xeb000000,
+0xc045c707, 0x00000115, 0x83c0458b, 0x5e5b3cc4,
+0x00c35d5f, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000000, 0x00000002, 0x00000000,
+0x00000003, 0x00000000, 0x00000004, 0x00000000,
+0x00000005, 0x00000000, 0x00000006, 0x00000000,
+0x00000007, 0x00000000, 0x00000008, 0x00000000,
+0x00000009, 0x00000000, 0x0000000a, 0x00000000,
+0x0000000b, 0x00000000, 0x0000000c, 0x00000000,
+0x0000000d, 0x00000000, 0x0000000e, 0x00000000,
+0x0000000f, 0x00000000, 0x00000010, 0x00000000,
+0x00000011, 0x00000000, 0x00000012, 0x00000000,
+0x00000013, 0x00000000, 0x00000014, 0x00000000,
+0x00000015, 0x00000000, 0x00000016, 0x00000000,
+0x00000017, 0x00000000, 0x00000018, 0x00000000,
+0x00000019, 0x00000000, 0x0000001a, 0x00000000,
+0x0000001b, 0x00000000, 0x0000001c, 0x00000000,
+0x0000001d, 0x00000000, 0x0000001e, 0x00000000,
+0x0000001f, 0x00000000, 0x00000020, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0001460,
+};
+asm(".type avx2_sg_x86_32_D_16x4i8, STT_NOTYPE;");
+asm(".type avx2_sg_x86_32_D_16x4i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_32_D_16x4f4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xe58955c3,
+0xc758ec83, 0x0001d845, 0x45c70000, 0x000004e8,
+0xdc45c700, 0x00000002, 0x03ec45c7, 0xc7000000,
+0x0003e045, 0x45c70000, 0x000002f0, 0xe445c700,
+0x00000004, 0x01f445c7, 0xc5000000, 0xc5d276e9,
+0x31dbefe1, 0x28f8c5c0, 0x41e2c4fa, 0x001d0c92,
+0xc5001003, 0xb84d29f8, 0x44d9e8d9, 0xe9dfb885,
+0x8a0fd8dd, 0x00000239, 0x0233850f, 0x83400000,
+0xe47504f8, 0xf228f8c5, 0x5d6ff9c5, 0x49e2c4d8,
+0x009d0c92, 0xc5001003, 0xb44d11fa, 0x038005d9,
+0x45d90010, 0xdde9dfb4, 0x238a0fd8, 0x0f000002,
+0x00021d85, 0x79e3c400, 0xd901c817, 0x10038405,
+0xb4458900, 0xdfb445d9, 0xe98a0fe9, 0x0f000001,
+0x0001e785, 0x79e3c400, 0xd902c817, 0x10038805,
+0xb4458900, 0xdfb445d9, 0x0fd8dde9, 0x0001cf8a,
+0xcd850f00, 0xd9000001, 0x10038c05, 0x79e3c400,
+0x03b44d17, 0xdfb445d9, 0xb98a0fe9, 0x0f000001,
+0x0001b985, 0x28f8c500, 0x72d9c5fa, 0xe2c402f3,
+0x650c9241, 0x00100300, 0x4d11fac5, 0xb445d9b4,
+0xd9ddeadf, 0x019f8a0f, 0x850f0000, 0x0000019d,
+0x1779e3c4, 0xd901b44d, 0xe9dfb445, 0x8a0fd8dd,
+0x0000018b, 0x0185850f, 0xe3c40000, 0x02c81779,
+0x039005d9, 0x45890010, 0xb445d9b4, 0xd8dde9df,
+0x01698a0f, 0x850f0000, 0x00000163, 0x039405d9,
+0xe3c40010, 0xb44d1779, 0xb445d903, 0xd8dde9df,
+0x01498a0f, 0x850f0000, 0x00000143, 0xf228f8c5,
+0x4d6ff9c5, 0xc4c031e8, 0x249249e2, 0x1003008d,
+0x29f8c500, 0x4c8bb865, 0x518de885, 0xb4558901,
+0xd9b445db, 0xdfb88544, 0x0fd8dde9, 0x0001158a,
+0x0f850f00, 0x40000001, 0x7504f883, 0x28f8c5d9,
+0xefd1c5fa, 0xfad1c5ed, 0x41e2c4eb, 0x10ad3492,
+0xc4001003, 0x2d1879e2, 0x00100398, 0x000107b8,
+0x58d8c500, 0x76d1c5e5, 0xc2d8c5ed, 0xe2c400e6,
+0x0fe51779, 0x0000e083, 0x72d1c500, 0xc03101f1,
+0x9269e2c4, 0x03006d24, 0xf8c50010, 0x8bb86529,
+0x8de8854c, 0x55890151, 0xb445dbb4, 0xb88544d9,
+0xd8dde9df, 0x00a38a0f, 0x850f0000, 0x0000009d,
+0x04f88340, 0xe9c5d975, 0xe1c5d2ef, 0xf1c5c9db,
+0xf1c5ca76, 0xf8c5f276, 0xc031fe28, 0x9241e2c4,
+0x03009d24, 0xf8c50010, 0xb9c86529, 0x00000005,
+0xc88544d9, 0x2940ca89, 0x74c285c2, 0x85548b06,
+0x8b04ebd4, 0x42e48554, 0xdbb45589, 0xc9d9b445,
+0xd8dde9df, 0x4c754e7a, 0x7504f883, 0xebc031d3,
+0x00e7b848, 0x41eb0000, 0x16ebd8dd, 0x12ebd8dd,
+0x0eebd8dd, 0x0aebd8dd, 0xd8ddd8dd, 0xd8dd04eb,
+0xefb8d8dd, 0xeb000000, 0xebd8dd20, 0xb8d8dd02,
+0x000000f7, 0xffb813eb, 0xeb000000, 0x0115b80c,
+0x05eb0000, 0x00011eb8, 0x00c3c900, 0x00000000,
+0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+0x40a00000, 0x40c00000, 0x40e00000, 0x41000000,
+0x41100000, 0x41200000, 0x41300000, 0x41400000,
+0x41500000, 0x41600000, 0x41700000, 0x41800000,
+0x41880000, 0x41900000, 0x41980000, 0x41a00000,
+0x41a80000, 0x41b00000, 0x41b80000, 0x41c00000,
+0x41c80000, 0x41d00000, 0x41d80000, 0x41e00000,
+0x41e80000, 0x41f00000, 0x41f80000, 0x42000000,
+0x40000000, 0x40400000, 0x40800000, 0x40a00000,
+0x40e00000, 0x41100000, 0xbf800000,
+0001634,
+};
+asm(".type avx2_sg_x86_32_D_16x4f4, STT_NOTYPE;");
+asm(".type avx2_sg_x86_32_D_16x4f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_32_D_16x4f8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0xec83e589, 0xd845c738, 0x00000001, 0x02e845c7,
+0xc7000000, 0x0002dc45, 0x45c70000, 0x000001ec,
+0xe045c700, 0x00000003, 0xc7f04589, 0x0004e445,
+0x45c70000, 0xfffffff4, 0x76f1c5ff, 0xefe1c5c9,
+0x28f9c5db, 0xc9e2c4f1, 0x601d1492, 0xc5001002,
+0xd05513f9, 0x45dde8d9, 0x0fe9dfd0, 0x0001848a,
+0x82850f00, 0xc5000001, 0xd05517f9, 0xdfd045dd,
+0x0fd8dde9, 0x0001728a, 0x6c850f00, 0xc5000001,
+0xd86d6ff9, 0xf928f9c5, 0x92c1e2c4, 0x0260ed14,
+0xf9c50010, 0xd9d05513, 0x10036005, 0xd045dd00,
+0xd8dde9df, 0x014e8a0f, 0x850f0000, 0x00000148,
+0x5517f9c5, 0x6405d9d0, 0xdd001003, 0xe9dfd045,
+0x012c8a0f, 0x850f0000, 0x0000012a, 0xf572e1c5,
+0x28f9c503, 0xc9e2c4f1, 0x605d1492, 0xc5001002,
+0xd05513f9, 0xdfd045dd, 0x0fd8dde9, 0x00010e8a,
+0x08850f00, 0xc5000001, 0xd05517f9, 0x036805d9,
+0x45dd0010, 0xdde9dfd0, 0xf08a0fd8, 0x0f000000,
+0x0000ea85, 0xe8458b00, 0x5d6ff9c5, 0x28f9c5e8,
+0xc1e2c4f9, 0x60dd1492, 0x40001002, 0xdbd04589,
+0xf9c5d045, 0xddd05513, 0xc9d9d045, 0xd9dde9db,
+0x00c08a0f, 0x850f0000, 0x000000be, 0x40ec458b,
+0xdbd04589, 0xf9c5d045, 0xddd05517, 0xc9d9d045,
+0xd9dde9db, 0x00a48a0f, 0x850f0000, 0x000000a4,
+0xe4efd9c5, 0xe5fad9c5, 0xf128f9c5, 0x000107b8,
+0xc9e2c400, 0x70e52c92, 0xc5001002, 0x702512fb,
+0xc5001003, 0xc5d458e9, 0xc5e476d9, 0x00d5c2e9,
+0x1779e2c4, 0x81830fd4, 0xc5000000, 0x01f372e1,
+0x92f1e2c4, 0x02609d14, 0xf9c50010, 0xddd05513,
+0xcad9d045, 0xd9ddeadf, 0x5775557a, 0x5517f9c5,
+0xd045ddd0, 0xe9dfc9d9, 0x497ad8dd, 0x000000b8,
+0xeb4d7400, 0xebd8dd40, 0xb8d8dd02, 0x000000e7,
+0xd8dd3eeb, 0xd8dd02eb, 0x0000efb8, 0xb831eb00,
+0x000000f7, 0xd8dd2aeb, 0xd8dd0eeb, 0xd8dd0aeb,
+0x04ebd8dd, 0xd8ddd8dd, 0x0000ffb8, 0xdd11eb00,
+0xdd02ebd8, 0x0115b8d8, 0x04eb0000, 0xd8ddd8dd,
+0x0000c3c9, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40100000,
+0x00000000, 0x40140000, 0x00000000, 0x40180000,
+0x00000000, 0x401c0000, 0x00000000, 0x40200000,
+0x00000000, 0x40220000, 0x00000000, 0x40240000,
+0x00000000, 0x40260000, 0x00000000, 0x40280000,
+0x00000000, 0x402a0000, 0x00000000, 0x402c0000,
+0x00000000, 0x402e0000, 0x00000000, 0x40300000,
+0x00000000, 0x40310000, 0x00000000, 0x40320000,
+0x00000000, 0x40330000, 0x00000000, 0x40340000,
+0x00000000, 0x40350000, 0x00000000, 0x40360000,
+0x00000000, 0x40370000, 0x00000000, 0x40380000,
+0x00000000, 0x40390000, 0x00000000, 0x403a0000,
+0x00000000, 0x403b0000, 0x00000000, 0x403c0000,
+0x00000000, 0x403d0000, 0x00000000, 0x403e0000,
+0x00000000, 0x403f0000, 0x00000000, 0x40400000,
+0x40000000, 0x40400000, 0x40a00000, 0x00000000,
+0x00000000, 0xbff00000,
+0001570,
+};
+asm(".type avx2_sg_x86_32_D_16x4f8, STT_NOTYPE;");
+asm(".type avx2_sg_x86_32_D_16x4f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_32_D_16x8i4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0xd231e589, 0x56c93157, 0x83db3153, 0x45c73cec,
+0x000001c8, 0xcc458900, 0x02d845c7, 0x89000000,
+0x45c7dc55, 0x000002d0, 0xd44d8900, 0x01e045c7,
+0x89000000, 0xf1c5e45d, 0xe1c5c976, 0xf9c5dbef,
+0xe2c4f16f, 0x1d149149, 0x00100260, 0xd27ef9c5,
+0x00e7b84a, 0x850f0000, 0x000001e2, 0x1679e3c4,
+0x0f4a01d2, 0x0001d585, 0x79e3c400, 0xc402d116,
+0xd21679e3, 0xb8d10903, 0x000000ea, 0x01bc850f,
+0xf9c50000, 0xc5c86d6f, 0xc4f96ff9, 0x149141e2,
+0x100260ad, 0x7ef9c500, 0x02fa83d2, 0x0000efb8,
+0x97850f00, 0xc4000001, 0xd21679e3, 0x03fa8301,
+0x0188850f, 0xe3c40000, 0x02d11679, 0x1679e3c4,
+0xd10903d2, 0x0000f2b8, 0x6f850f00, 0xc5000001,
+0x02f573e1, 0xf16ff9c5, 0x0000f7b8, 0x49e2c400,
+0x605d1491, 0xc5001002, 0x83d27ef9, 0x850f03fa,
+0x0000014a, 0x1679e3c4, 0xfa8301d2, 0x3b850f05,
+0xc4000001, 0xd11679e3, 0x79e3c402, 0x0903d216,
+0x00fab8d1, 0x850f0000, 0x00000122, 0xc5d8458b,
+0xd8556ff9, 0xf96ff9c5, 0xc4dc558b, 0x1c9141e2,
+0x10026095, 0x7ef9c500, 0x01c083db, 0x83c04589,
+0xd88900d2, 0x99c45589, 0x39c47d8b, 0xdf850ffa,
+0x8b000000, 0xc339c045, 0x00d4850f, 0x758b0000,
+0x79e3c4e0, 0x8901d916, 0xe47d8bc8, 0x8301c683,
+0x399900d7, 0xb7850ffa, 0x39000000, 0xaf850ff1,
+0xc4000000, 0x5d1679e3, 0xe3c403bc, 0x02da1679,
+0xb8bc550b, 0x00000102, 0x00a0850f, 0xc54b0000,
+0xc5e4efd9, 0xc5e5fbd9, 0xc4e96ff9, 0x1c9151e2,
+0x100268a5, 0x7ef9c500, 0xb8d339da, 0x0000010b,
+0xc4497c75, 0xda1679e3, 0x75d13901, 0x79e3c471,
+0xc403d916, 0xda1679e3, 0xb8ca0902, 0x0000010e,
+0x5d8b5c75, 0x73e9c5c4, 0xf9c501f2, 0xe2c4e16f,
+0x550c9159, 0x00100260, 0xc97ef9c5, 0x3999c889,
+0x8b3675da, 0xc139c045, 0xe3c42f75, 0x01c91679,
+0x3999c889, 0x392275fa, 0xc41e75f1, 0xc81679e3,
+0x79e3c403, 0x0902ca16, 0xb81374d0, 0x00000118,
+0xffb80ceb, 0xeb000000, 0x0115b805, 0xc4830000,
+0x5f5e5b3c, 0x0000c35d, 0x00000000, 0x00000000,
+0x00000001, 0x00000002, 0x00000003, 0x00000004,
+0x00000005, 0x00000006, 0x00000007, 0x00000008,
+0x00000009, 0x0000000a, 0x0000000b, 0x0000000c,
+0x0000000d, 0x0000000e, 0x0000000f, 0x00000010,
+0x00000011, 0x00000012, 0x00000013, 0x00000014,
+0x00000015, 0x00000016, 0x00000017, 0x00000018,
+0x00000019, 0x0000001a, 0x0000001b, 0x0000001c,
+0x0000001d, 0x0000001e, 0x0000001f, 0x00000020,
+0001340,
+};
+asm(".type avx2_sg_x86_32_D_16x8i4, STT_NOTYPE;");
+asm(".type avx2_sg_x86_32_D_16x8i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_32_D_16x8i8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc93155c3,
+0x3157e589, 0xf63156ff, 0x83db3153, 0x45c73cec,
+0x000001c8, 0xcc4d8900, 0x02d845c7, 0x89000000,
+0x45c7dc5d, 0x000002d0, 0xd4758900, 0x01e045c7,
+0x89000000, 0xe9c5e47d, 0xe1c5d276, 0xf9c5dbef,
+0xe2c4fa6f, 0x1d0c91c1, 0x00100260, 0xc97ef9c5,
+0x1679e3c4, 0x45c701cb, 0x0000e7c0, 0x83c88900,
+0xd80901f0, 0x01cc850f, 0xf8c50000, 0x8bb84d17,
+0xf083b845, 0xbc450b01, 0x01b8850f, 0xf9c50000,
+0xc5c85d6f, 0xc4ea6ff9, 0x0c91d1e2, 0x100260dd,
+0x7ef9c500, 0x79e3c4c9, 0xc701cb16, 0x00efc045,
+0xc8890000, 0x0902f083, 0x87850fd8, 0xc5000001,
+0xb84d17f8, 0x83b8458b, 0x450b03f0, 0x73850fbc,
+0xc5000001, 0x03f373d9, 0xf26ff9c5, 0x91c9e2c4,
+0x0260650c, 0xf9c50010, 0xe3c4c97e, 0x01cb1679,
+0xf7c045c7, 0x89000000, 0x03f083c8, 0x850fd809,
+0x00000142, 0x4d17f8c5, 0xb8458bb8, 0x0b05f083,
+0x850fbc45, 0x0000012e, 0xc5d84d8b, 0xd84d6ff9,
+0xfa6ff9c5, 0xc4dc5d8b, 0x1491c1e2, 0x100260cd,
+0x79e3c400, 0xc501d216, 0x83d07ef9, 0xd38301c1,
+0x0fd33900, 0x0000e485, 0x0fc13900, 0x0000dc85,
+0xe0758b00, 0x5517f8c5, 0xe47d8bc0, 0x8bc4558b,
+0xc683c045, 0x00d78301, 0x850fd739, 0x000000bd,
+0x850fc639, 0x000000b5, 0x15fbe9c5, 0x00100360,
+0xf6efc9c5, 0xf3fbc9c5, 0xe476d9c5, 0xec6ff9c5,
+0x91d1e2c4, 0x0270f53c, 0x45c70010, 0x000107c0,
+0x69e2c400, 0xe2c4d729, 0x0fd41779, 0x00009583,
+0x73c9c500, 0xe2c401f1, 0xb51491d9, 0x00100260,
+0x1679e3c4, 0xd33901d2, 0xd07ef9c5, 0xc1396875,
+0xf8c56475, 0x8bc05517, 0x458bc455, 0x75d739c0,
+0x75c63955, 0xefd1c551, 0xdbe1c5ed, 0x71e2c4c9,
+0xe2c4cd29, 0xc4cd2971, 0x1491f1e2, 0x100260dd,
+0x79e3c400, 0x3901d216, 0x7ef9c5d3, 0x393075d0,
+0xc52c75c1, 0xc05517f8, 0x8bc4558b, 0xd739c045,
+0xd2311d75, 0x5589c639, 0xeb1475c0, 0xc045c719,
+0x000000ff, 0x45c710eb, 0x000115c0, 0xc707eb00,
+0x011ec045, 0x458b0000, 0x3cc483c0, 0x5d5f5e5b,
+0x000000c3, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000000, 0x00000002, 0x00000000,
+0x00000003, 0x00000000, 0x00000004, 0x00000000,
+0x00000005, 0x00000000, 0x00000006, 0x00000000,
+0x00000007, 0x00000000, 0x00000008, 0x00000000,
+0x00000009, 0x00000000, 0x0000000a, 0x00000000,
+0x0000000b, 0x00000000, 0x0000000c, 0x00000000,
+0x0000000d, 0x00000000, 0x0000000e, 0x00000000,
+0x0000000f, 0x00000000, 0x00000010, 0x00000000,
+0x00000011, 0x00000000, 0x00000012, 0x00000000,
+0x00000013, 0x00000000, 0x00000014, 0x00000000,
+0x00000015, 0x00000000, 0x00000016, 0x00000000,
+0x00000017, 0x00000000, 0x00000018, 0x00000000,
+0x00000019, 0x00000000, 0x0000001a, 0x00000000,
+0x0000001b, 0x00000000, 0x0000001c, 0x00000000,
+0x0000001d, 0x00000000, 0x0000001e, 0x00000000,
+0x0000001f, 0x00000000, 0x00000020, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0001560,
+};
+asm(".type avx2_sg_x86_32_D_16x8i8, STT_NOTYPE;");
+asm(".type avx2_sg_x86_32_D_16x8i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_32_D_16x8f4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0xd231e589, 0x3138ec83, 0xdc4589c9, 0x45c7c031,
+0x000001d8, 0xe845c700, 0x00000002, 0xc7ec5589,
+0x0002e045, 0x4d890000, 0xf045c7e4, 0x00000001,
+0xc5f44589, 0xc5c976f1, 0xc5dbefe1, 0xc4f128f8,
+0x149349e2, 0x1004c01d, 0x11fac500, 0xe8d9d055,
+0xdfd045d9, 0xf38a0fe9, 0x0f000002, 0x0002f185,
+0x79e3c400, 0x01d05517, 0xdfd045d9, 0x0fd8dde9,
+0x0002df8a, 0xd9850f00, 0xd9000002, 0x79e3c4ee,
+0x02d05517, 0xdfd045d9, 0xcf8a0fe9, 0x0f000002,
+0x0002cd85, 0x79e3c400, 0x03d05517, 0xdfd045d9,
+0xbf8a0fe9, 0x0f000002, 0x0002bd85, 0x28f8c500,
+0x6ff9c5f9, 0xe2c4d86d, 0xad149341, 0x001004c0,
+0x5511fac5, 0x4005d9d0, 0xd9001005, 0xe9dfd045,
+0x8a0fd8dd, 0x0000029e, 0x029c850f, 0xe3c40000,
+0x01d01779, 0x054405d9, 0x45890010, 0xd045d9d0,
+0x8a0fe9df, 0x00000286, 0x0286850f, 0xe3c40000,
+0xd0551779, 0xd045d902, 0x8a0feadf, 0x00000282,
+0x0282850f, 0xe3c40000, 0xd0551779, 0xd045d903,
+0x8a0feadf, 0x00000276, 0x0276850f, 0xf8c50000,
+0xe1c5f128, 0xc402f573, 0x149349e2, 0x1004c05d,
+0x11fac500, 0x45d9d055, 0xdde9dfd0, 0x5f8a0fd8,
+0x0f000002, 0x00025d85, 0x79e3c400, 0xd901d017,
+0x10054805, 0xd0458900, 0xdfd045d9, 0x0fd8dde9,
+0x0002458a, 0x43850f00, 0xc4000002, 0x551779e3,
+0x45d902d0, 0x0fe9dfd0, 0x00023d8a, 0x3b850f00,
+0xc4000002, 0x551779e3, 0x45d903d0, 0x0fe9dfd0,
+0x00022d8a, 0x2b850f00, 0x8b000002, 0xf9c5e845,
+0xc4e8556f, 0x1c9371e2, 0x1004c095, 0xec558b00,
+0x5d11fac5, 0x01c083d0, 0x89d045d9, 0xd283d045,
+0xd4558900, 0xd9d06ddf, 0x0fe9dbc9, 0x0002018a,
+0x03850f00, 0x8b000002, 0xe3c4f045, 0xd05d1779,
+0xf4558b01, 0x8901c083, 0xd283c845, 0xcc558900,
+0xd9c86ddf, 0xe9dfd045, 0x01e48a0f, 0x850f0000,
+0x000001e8, 0x1779e3c4, 0xd902c85d, 0xecdfc845,
+0x01e88a0f, 0x850f0000, 0x000001ec, 0x1779e3c4,
+0xd903c85d, 0xecdfc845, 0x01e48a0f, 0x850f0000,
+0x000001e8, 0xdb76e1c5, 0xe4efd9c5, 0xe5fbd9c5,
+0xfb28f8c5, 0x9341e2c4, 0x04c8a50c, 0xfac50010,
+0xd9c84d11, 0xe8d9c845, 0xc9d9ebdc, 0xdaddebdf,
+0x01c58a0f, 0x850f0000, 0x000001c9, 0xc4d045d9,
+0xc81779e3, 0x89e2de01, 0x45d9d045, 0xddeadfd0,
+0xb88a0fd9, 0x0f000001, 0x0001ba85, 0x79e3c400,
+0x02d04d17, 0xdfd045d9, 0xb58a0feb, 0x0f000001,
+0x0001b785, 0x79e3c400, 0x03d04d17, 0xdfd045d9,
+0x0fdaddeb, 0x0001ab8a, 0xab850f00, 0xc5000001,
+0x01f273e9, 0x9361e2c4, 0x04c0550c, 0xfac50010,
+0xd9d04d11, 0xe9dfd045, 0x8a0fd8dd, 0x00000195,
+0x0193850f, 0xe3c40000, 0xd04d1779, 0xd045d901,
+0xd8dde9df, 0x01818a0f, 0x850f0000, 0x0000017b,
+0xe3c4eed9, 0xd04d1779, 0xd045d902, 0x8a0fe9df,
+0x0000016e, 0x016c850f, 0xe3c40000, 0xd04d1779,
+0xd045d903, 0xd8dde9df, 0x015a8a0f, 0x00b80000,
+0x0f000000, 0x00015484, 0x014ae900, 0xd8dd0000,
+0xd8dd02eb, 0x0000e7b8, 0x013fe900, 0xd8dd0000,
+0xd8dd0aeb, 0xd8dd06eb, 0xd8dd02eb, 0x0000eab8,
+0x0127e900, 0xd8dd0000, 0xd8dd0eeb, 0xd8dd0aeb,
+0x04ebd8dd, 0xd8ddd8dd, 0x0000efb8, 0x010be900,
+0xd8dd0000, 0x10ebd8dd, 0xd8ddd8dd, 0xd8dd0aeb,
+0x04ebd8dd, 0xd8ddd8dd, 0x0000f2b8, 0x00ebe900,
+0xd8dd0000, 0xd8dd0aeb, 0xd8dd06eb, 0xd8dd02eb,
+0x0000f7b8, 0x00d3e900, 0xd8dd0000, 0xd8dd0aeb,
+0xd8dd06eb, 0xd8dd02eb, 0x0000fab8, 0x00bbe900,
+0xd8dd0000, 0xd8ddd8dd, 0xd8dd1aeb, 0xd8ddd8dd,
+0xd8dd12eb, 0xd8ddd8dd, 0x08ebd8dd, 0xd8ddd8dd,
+0xd8ddd8dd, 0x0000ffb8, 0x008fe900, 0xd8dd0000,
+0xd8ddd8dd, 0x1cebd8dd, 0xd8ddd8dd, 0xd8ddd8dd,
+0xd8dd12eb, 0xd8ddd8dd, 0x08ebd8dd, 0xd8ddd8dd,
+0xd8ddd8dd, 0x000102b8, 0xdd62eb00, 0xddd8ddd8,
+0xebd8ddd8, 0xddd8dd18, 0xddd8ddd8, 0xdd0eebd8,
+0xddd8ddd8, 0xdd06ebd8, 0xddd8ddd8, 0x010bb8d8,
+0x39eb0000, 0xd8ddd8dd, 0x12ebd8dd, 0xd8ddd8dd,
+0x0aebd8dd, 0xd8ddd8dd, 0xd8dd04eb, 0x0eb8d8dd,
+0xeb000001, 0xebd8dd18, 0xb8d8dd02, 0x00000115,
+0xd8dd0beb, 0xd8dd02eb, 0x000118b8, 0x00c3c900,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+0x40a00000, 0x40c00000, 0x40e00000, 0x41000000,
+0x41100000, 0x41200000, 0x41300000, 0x41400000,
+0x41500000, 0x41600000, 0x41700000, 0x41800000,
+0x41880000, 0x41900000, 0x41980000, 0x41a00000,
+0x41a80000, 0x41b00000, 0x41b80000, 0x41c00000,
+0x41c80000, 0x41d00000, 0x41d80000, 0x41e00000,
+0x41e80000, 0x41f00000, 0x41f80000, 0x42000000,
+0x40000000, 0x40400000, 0x40a00000,
+0002514,
+};
+asm(".type avx2_sg_x86_32_D_16x8f4, STT_NOTYPE;");
+asm(".type avx2_sg_x86_32_D_16x8f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_32_D_16x8f8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0xd231e589, 0x3138ec83, 0xdc4589c9, 0x45c7c031,
+0x000001d8, 0xe845c700, 0x00000002, 0xc7ec5589,
+0x0002e045, 0x4d890000, 0xf045c7e4, 0x00000001,
+0xc5f44589, 0xc5d276e9, 0xc5dbefe1, 0xc4fa28f9,
+0x0c93c1e2, 0x1002e01d, 0x13f9c500, 0xe8d9d04d,
+0xdfd045dd, 0xf28a0fe9, 0x0f000001, 0x0001f085,
+0x17f9c500, 0x45ddd04d, 0xdde9dfd0, 0xe08a0fd8,
+0x0f000001, 0x0001da85, 0x6ff9c500, 0xf9c5d85d,
+0xe2c4f228, 0xdd0c93c9, 0x001002e0, 0x4d13f9c5,
+0xe005d9d0, 0xdd001003, 0xe9dfd045, 0x8a0fd8dd,
+0x000001bc, 0x01b6850f, 0xf9c50000, 0xd9d04d17,
+0x1003e405, 0xd045dd00, 0x8a0fe9df, 0x0000019a,
+0x0198850f, 0xd9c50000, 0xc503f373, 0xc4fa28f9,
+0x0c93c1e2, 0x1002e065, 0x13f9c500, 0x45ddd04d,
+0xdde9dfd0, 0x7c8a0fd8, 0x0f000001, 0x00017685,
+0x17f9c500, 0x05d9d04d, 0x001003e8, 0xdfd045dd,
+0x0fd8dde9, 0x00015e8a, 0x58850f00, 0x8b000001,
+0xf9c5e845, 0xc5e84d6f, 0x8bf228f9, 0xe2c4ec55,
+0xcd2493c9, 0x001002e0, 0x8901c083, 0xd283d045,
+0xd4558900, 0xc5d06ddf, 0xd06513f9, 0xd9d045dd,
+0xdde9dbc9, 0x238a0fd9, 0x0f000001, 0x00012185,
+0xf0458b00, 0x83f4558b, 0x458901c0, 0x00d283d0,
+0xdfd45589, 0xf9c5d06d, 0xddd06517, 0xc9d9d045,
+0xd9dde9db, 0x00fc8a0f, 0x850f0000, 0x000000fc,
+0xedefd1c5, 0xebfbd1c5, 0xfa28f9c5, 0x000107b8,
+0xc1e2c400, 0xf0ed3493, 0xc5001002, 0xf02d12fb,
+0xc5001003, 0xc5e558d9, 0xc5ed76d1, 0x00e6c2d9,
+0x1779e2c4, 0xf6830fe5, 0xc5000000, 0x01f173d9,
+0xf228f9c5, 0x93c9e2c4, 0x02e0a514, 0xf9c50010,
+0xddd05513, 0xcad9d045, 0xdaddeadb, 0x00a58a0f,
+0x850f0000, 0x000000a5, 0x5517f9c5, 0xd045ddd0,
+0xe9dbc9d9, 0x8a0fd9dd, 0x00000097, 0x0097850f,
+0xd9c50000, 0xe1c5e4ef, 0xe2c4c9db, 0xc4cc2971,
+0xfc2971e2, 0xef28f9c5, 0x93d1e2c4, 0x02e0dd14,
+0xf9c50010, 0xddd05513, 0xcad9d045, 0xd9ddeadf,
+0x7475727a, 0x5517f9c5, 0xd045ddd0, 0xe9dfc9d9,
+0x667ad8dd, 0x000000b8, 0xeb6a7400, 0xebd8dd5d,
+0xb8d8dd02, 0x000000e7, 0xd8dd5beb, 0xd8dd02eb,
+0x0000efb8, 0xb84eeb00, 0x000000f7, 0xd8dd47eb,
+0xd8dd0eeb, 0xd8dd0aeb, 0x04ebd8dd, 0xd8ddd8dd,
+0x0000ffb8, 0xdd2eeb00, 0xebd8ddd8, 0xddd8dd10,
+0xdd0aebd8, 0xebd8ddd8, 0xddd8dd04, 0x0115b8d8,
+0x11eb0000, 0x02ebd8dd, 0x1eb8d8dd, 0xeb000001,
+0xddd8dd04, 0x00c3c9d8, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40100000,
+0x00000000, 0x40140000, 0x00000000, 0x40180000,
+0x00000000, 0x401c0000, 0x00000000, 0x40200000,
+0x00000000, 0x40220000, 0x00000000, 0x40240000,
+0x00000000, 0x40260000, 0x00000000, 0x40280000,
+0x00000000, 0x402a0000, 0x00000000, 0x402c0000,
+0x00000000, 0x402e0000, 0x00000000, 0x40300000,
+0x00000000, 0x40310000, 0x00000000, 0x40320000,
+0x00000000, 0x40330000, 0x00000000, 0x40340000,
+0x00000000, 0x40350000, 0x00000000, 0x40360000,
+0x00000000, 0x40370000, 0x00000000, 0x40380000,
+0x00000000, 0x40390000, 0x00000000, 0x403a0000,
+0x00000000, 0x403b0000, 0x00000000, 0x403c0000,
+0x00000000, 0x403d0000, 0x00000000, 0x403e0000,
+0x00000000, 0x403f0000, 0x00000000, 0x40400000,
+0x40000000, 0x40400000, 0x40a00000, 0x00000000,
+0x00000000, 0xbff00000,
+0001770,
+};
+asm(".type avx2_sg_x86_32_D_16x8f8, STT_NOTYPE;");
+asm(".type avx2_sg_x86_32_D_16x8f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_32_D_32x4i4[] = {
+0x315500eb, 0x53e589c0, 0x81e0e483, 0x0000a0ec,
+0x09ba4000, 0x89000000, 0x295c8444, 0x08f883c2,
+0x7c845489, 0xc031eb75, 0xd276edc5, 0xdbefe1c5,
+0xfa6ffdc5, 0x9045e2c4, 0x01e01d0c, 0xfdc50010,
+0x20244c7f, 0x20847c83, 0x63850f01, 0x40000001,
+0x7508f883, 0x0002b8ef, 0xfdc50000, 0x60245c6f,
+0xf26ffdc5, 0x904de2c4, 0x01e09d0c, 0xfdc50010,
+0x20244c7f, 0x18844439, 0x013b850f, 0x83400000,
+0xf0750af8, 0xf372ddc5, 0x0003b802, 0xfdc50000,
+0xe2c4fa6f, 0x650c9045, 0x001001e0, 0x4c7ffdc5,
+0x44392024, 0x850f1a44, 0x00000114, 0x8302c083,
+0xee7513f8, 0xfdc5c031, 0x80248c6f, 0xc5000000,
+0xc4f26ffd, 0x24904de2, 0x1001e08d, 0x7ffdc500,
+0x8b202464, 0x0080848c, 0x4c890000, 0x518d1c24,
+0x84543901, 0xdc850f20, 0x40000000, 0x7508f883,
+0x0001b8e2, 0xd1c50000, 0xd5c5edef, 0xfdc5ebfa,
+0xe2c4fa6f, 0xad349045, 0x00100200, 0xe86ef9c5,
+0x587de2c4, 0xfaddc5ed, 0x0107b8e5, 0xddc50000,
+0xd5c5e676, 0xe2c4ed76, 0x0fe5177d, 0x0000a983,
+0x72d5c500, 0xc03101f1, 0x906de2c4, 0x01e06d24,
+0xfdc50010, 0x2024647f, 0x80848c8b, 0x89000000,
+0x8d1c244c, 0x54390151, 0x72752084, 0x08f88340,
+0xc031e675, 0x000009b9, 0xefe9c500, 0xdbe5c5d2,
+0x76f5c5c9, 0x76f5c5ca, 0x75e2c4ca, 0xe09d2490,
+0xc5001001, 0x24647ffd, 0x845c8b40, 0x40ca8940,
+0xc285c229, 0x548b0674, 0x04eb5c84, 0x7c84548b,
+0x1c245489, 0x75d33942, 0x08f8832c, 0xc031db75,
+0xe7b828eb, 0xeb000000, 0x00efb821, 0x1aeb0000,
+0x0000f7b8, 0xb813eb00, 0x000000ff, 0x15b80ceb,
+0xeb000001, 0x011eb805, 0x5d8b0000, 0x00c3c9fc,
+0x00000001, 0x00000002, 0x00000003, 0x00000004,
+0x00000005, 0x00000006, 0x00000007, 0x00000008,
+0x00000009, 0x0000000a, 0x0000000b, 0x0000000c,
+0x0000000d, 0x0000000e, 0x0000000f, 0x00000010,
+0x00000011, 0x00000012, 0x00000013, 0x00000014,
+0x00000015, 0x00000016, 0x00000017, 0x00000018,
+0x00000019, 0x0000001a, 0x0000001b, 0x0000001c,
+0x0000001d, 0x0000001e, 0x0000001f, 0x00000020,
+0x00000021, 0x00000022, 0x00000023, 0x00000024,
+0x00000025, 0x00000026, 0x00000027, 0x00000028,
+0x00000029, 0x0000002a, 0x0000002b, 0x0000002c,
+0x0000002d, 0x0000002e, 0x0000002f, 0x00000030,
+0x00000031, 0x00000032, 0x00000033, 0x00000034,
+0x00000035, 0x00000036, 0x00000037, 0x00000038,
+0x00000039, 0x0000003a, 0x0000003b, 0x0000003c,
+0x0000003d, 0x0000003e, 0x0000003f, 0x00000040,
+0001340,
+};
+asm(".type avx2_sg_x86_32_D_32x4i4, STT_NOTYPE;");
+asm(".type avx2_sg_x86_32_D_32x4i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_32_D_32x4i8[] = {
+0x895500eb, 0xe48353e5, 0x60ec83e0, 0x202444c7,
+0x00000001, 0x302444c7, 0x00000004, 0x242444c7,
+0x00000002, 0x342444c7, 0x00000003, 0x282444c7,
+0x00000003, 0x382444c7, 0x00000002, 0x2c2444c7,
+0x00000004, 0x3c2444c7, 0x00000001, 0xf5c5c031,
+0xe1c5c976, 0xfdc5dbef, 0xe2c4f16f, 0x1d1490cd,
+0x00100220, 0x547ffdc5, 0x5c8b4024, 0x5c8940c4,
+0xda891824, 0x0b01f283, 0x0f44c454, 0x00017585,
+0xf8834000, 0xb8e37504, 0x00000002, 0xf9c5d231,
+0x20246c6f, 0xf96ffdc5, 0x90c5e2c4, 0x0220ed14,
+0xfdc50010, 0x4024547f, 0x00c50c8d, 0x8d000000,
+0x0140245c, 0xf45139d9, 0x013f850f, 0x413b0000,
+0x36850ff0, 0x83000001, 0xc18901c0, 0x8300d283,
+0xd10906f1, 0xe1c5d275, 0xc503f572, 0xbbf16ffd,
+0x000000f7, 0x90cde2c4, 0x02205d14, 0xf9c50010,
+0xc189d07e, 0xc403f183, 0xd21679e3, 0x0fd10901,
+0x00010b85, 0x17f8c500, 0x8b182454, 0x83182454,
+0x540b05f2, 0x850f1c24, 0x000000f4, 0x397de3c4,
+0xf9c501d2, 0xc189d07e, 0xc407f183, 0xd21679e3,
+0x0fd10901, 0x0000d785, 0x17f8c500, 0x8b182454,
+0x83182454, 0x540b09f2, 0x850f1c24, 0x000000c0,
+0xf9c5c031, 0x30245c6f, 0xf96ffdc5, 0x90c5e2c4,
+0x0220dd14, 0xfdc50010, 0x4024547f, 0x30845c8b,
+0x8901538d, 0x1ffbc1d3, 0x44c45c39, 0x0082850f,
+0x54390000, 0x7c7540c4, 0x04f88340, 0xedc5de75,
+0x042015fb, 0xd9c50010, 0xd9c5e4ef, 0xfdc5e5fa,
+0x07bbf16f, 0xc4000001, 0x2c90cde2, 0x100240e5,
+0x6de2c400, 0xe2c4d529, 0x73d1177d, 0x72e1c553,
+0xc03101f3, 0x90f5e2c4, 0x02209d14, 0xfdc50010,
+0x4024547f, 0x30845c8b, 0x8901538d, 0x1ffbc1d3,
+0x44c45c39, 0x54392575, 0x1f7540c4, 0x04f88340,
+0xdb31e275, 0xe7bb1aeb, 0xeb000000, 0x00efbb13,
+0x0ceb0000, 0x0000ffbb, 0xbb05eb00, 0x00000115,
+0x5d8bd889, 0x00c3c9fc, 0x00000000, 0x00000000,
+0x00000001, 0x00000000, 0x00000002, 0x00000000,
+0x00000003, 0x00000000, 0x00000004, 0x00000000,
+0x00000005, 0x00000000, 0x00000006, 0x00000000,
+0x00000007, 0x00000000, 0x00000008, 0x00000000,
+0x00000009, 0x00000000, 0x0000000a, 0x00000000,
+0x0000000b, 0x00000000, 0x0000000c, 0x00000000,
+0x0000000d, 0x00000000, 0x0000000e, 0x00000000,
+0x0000000f, 0x00000000, 0x00000010, 0x00000000,
+0x00000011, 0x00000000, 0x00000012, 0x00000000,
+0x00000013, 0x00000000, 0x00000014, 0x00000000,
+0x00000015, 0x00000000, 0x00000016, 0x00000000,
+0x00000017, 0x00000000, 0x00000018, 0x00000000,
+0x00000019, 0x00000000, 0x0000001a, 0x00000000,
+0x0000001b, 0x00000000, 0x0000001c, 0x00000000,
+0x0000001d, 0x00000000, 0x0000001e, 0x00000000,
+0x0000001f, 0x00000000, 0x00000020, 0x00000000,
+0x00000021, 0x00000000, 0x00000022, 0x00000000,
+0x00000023, 0x00000000, 0x00000024, 0x00000000,
+0x00000025, 0x00000000, 0x00000026, 0x00000000,
+0x00000027, 0x00000000, 0x00000028, 0x00000000,
+0x00000029, 0x00000000, 0x0000002a, 0x00000000,
+0x0000002b, 0x00000000, 0x0000002c, 0x00000000,
+0x0000002d, 0x00000000, 0x0000002e, 0x00000000,
+0x0000002f, 0x00000000, 0x00000030, 0x00000000,
+0x00000031, 0x00000000, 0x00000032, 0x00000000,
+0x00000033, 0x00000000, 0x00000034, 0x00000000,
+0x00000035, 0x00000000, 0x00000036, 0x00000000,
+0x00000037, 0x00000000, 0x00000038, 0x00000000,
+0x00000039, 0x00000000, 0x0000003a, 0x00000000,
+0x0000003b, 0x00000000, 0x0000003c, 0x00000000,
+0x0000003d, 0x00000000, 0x0000003e, 0x00000000,
+0x0000003f, 0x00000000, 0x00000040, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0002100,
+};
+asm(".type avx2_sg_x86_32_D_32x4i8, STT_NOTYPE;");
+asm(".type avx2_sg_x86_32_D_32x4i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_32_D_32x4f4[] = {
+0x315500eb, 0x83e589c0, 0xec81e0e4, 0x000000a0,
+0x0009ba40, 0x44890000, 0xc2295c84, 0x8908f883,
+0x757c8454, 0xc5c031eb, 0xc5d276ed, 0xc5dbefe1,
+0xc4fa28fc, 0x0c9245e2, 0x1002401d, 0x29fcc500,
+0xd920244c, 0x8444d9e8, 0xdde9df20, 0xbb8a0fd8,
+0x0f000001, 0x0001b585, 0xf8834000, 0xb8e47508,
+0x00000002, 0x5c6ffdc5, 0xfcc56024, 0xe2c4f228,
+0x9d0c924d, 0x00100240, 0x4c29fcc5, 0x44892024,
+0x44d91c24, 0x44db1884, 0xc9d91c24, 0xd8dde9df,
+0x017f8a0f, 0x850f0000, 0x00000179, 0x0af88340,
+0xddc5dc75, 0xb802f372, 0x00000003, 0xfa28fcc5,
+0x9245e2c4, 0x0240650c, 0xfcc50010, 0x20244c29,
+0x1c244489, 0x1a4444d9, 0x1c2444db, 0xe9dfc9d9,
+0x8a0fd8dd, 0x00000144, 0x013e850f, 0xc0830000,
+0x13f88302, 0xc031da75, 0x8c6ffdc5, 0x00008024,
+0x28fcc500, 0x4de2c4f2, 0x408d2492, 0xc5001002,
+0x246429fc, 0x848c8b20, 0x00000080, 0x8901518d,
+0xdb1c2454, 0xd91c2444, 0xdf208444, 0x0fd8dde9,
+0x0000fe8a, 0xf8850f00, 0x40000000, 0x7508f883,
+0xefd1c5d4, 0xfad5c5ed, 0x28fcc5eb, 0x0107b8fa,
+0xe2c40000, 0xad349245, 0x00100260, 0x187de2c4,
+0x1003402d, 0x58dcc500, 0x76d5c5e5, 0xc2dcc5ed,
+0xe2c400e6, 0x0fe5177d, 0x0000c983, 0x72d5c500,
+0xc03101f1, 0x926de2c4, 0x02406d24, 0xfcc50010,
+0x20246429, 0x80848c8b, 0x8d000000, 0x54890151,
+0x44db1c24, 0x44d91c24, 0xe9df2084, 0x8a0fd8dd,
+0x00000086, 0x0080850f, 0x83400000, 0xd47508f8,
+0x09b9c031, 0xc5000000, 0xc5d2efe9, 0xc5c9dbe5,
+0xc5ca76f5, 0xc5f276f5, 0xc4fe28fc, 0x249245e2,
+0x1002409d, 0x29fcc500, 0xd9402464, 0x89408444,
+0xc22940ca, 0x0674c285, 0x5c84548b, 0x548b04eb,
+0x89427c84, 0xdb1c2454, 0xd91c2444, 0xdde9dfc9,
+0x752e7ad8, 0x08f8832c, 0xc031d175, 0xe7b828eb,
+0xeb000000, 0x00efb821, 0x1aeb0000, 0x0000f7b8,
+0xb813eb00, 0x000000ff, 0x15b80ceb, 0xeb000001,
+0x011eb805, 0xc3c90000, 0x00000000, 0x00000000,
+0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+0x40a00000, 0x40c00000, 0x40e00000, 0x41000000,
+0x41100000, 0x41200000, 0x41300000, 0x41400000,
+0x41500000, 0x41600000, 0x41700000, 0x41800000,
+0x41880000, 0x41900000, 0x41980000, 0x41a00000,
+0x41a80000, 0x41b00000, 0x41b80000, 0x41c00000,
+0x41c80000, 0x41d00000, 0x41d80000, 0x41e00000,
+0x41e80000, 0x41f00000, 0x41f80000, 0x42000000,
+0x42040000, 0x42080000, 0x420c0000, 0x42100000,
+0x42140000, 0x42180000, 0x421c0000, 0x42200000,
+0x42240000, 0x42280000, 0x422c0000, 0x42300000,
+0x42340000, 0x42380000, 0x423c0000, 0x42400000,
+0x42440000, 0x42480000, 0x424c0000, 0x42500000,
+0x42540000, 0x42580000, 0x425c0000, 0x42600000,
+0x42640000, 0x42680000, 0x426c0000, 0x42700000,
+0x42740000, 0x42780000, 0x427c0000, 0x42800000,
+0xbf800000,
+0001504,
+};
+asm(".type avx2_sg_x86_32_D_32x4f4, STT_NOTYPE;");
+asm(".type avx2_sg_x86_32_D_32x4f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_32_D_32x4f8[] = {
+0x895500eb, 0xe0e483e5, 0xc760ec83, 0x01202444,
+0xc7000000, 0x04302444, 0xc7000000, 0x02242444,
+0xc7000000, 0x03342444, 0xc7000000, 0x03282444,
+0xc7000000, 0x02382444, 0xc7000000, 0x042c2444,
+0xc7000000, 0x013c2444, 0x31000000, 0x76edc5c0,
+0xefe1c5d2, 0x28fdc5db, 0xcde2c4f2, 0xc01d0c92,
+0xc5001002, 0x244c29fd, 0xc444dd40, 0x2454dd40,
+0xd9e8d918, 0xdde9dfc9, 0xfa8a0fd8, 0x0f000001,
+0x0001f485, 0xf8834000, 0xc5de7504, 0x245c6ff9,
+0x28fdc520, 0xc5e2c4fa, 0xc0dd0c92, 0xc5001002,
+0x244c13f9, 0xc005d918, 0xdd001004, 0xdf182444,
+0x0fd8dde9, 0x0001e18a, 0xdb850f00, 0xc5000001,
+0x244c17f9, 0xc405d918, 0xdd001004, 0xdf182444,
+0xa98a0fe9, 0x0f000001, 0x0001a785, 0x7de3c400,
+0xc501c919, 0x244c13f9, 0xc805d918, 0xdd001004,
+0xdf182444, 0x0fd8dde9, 0x00018b8a, 0x89850f00,
+0xc5000001, 0x244c17f9, 0x2444dd18, 0xcc05d918,
+0xd9001004, 0xdfcad9c0, 0x0fd9ddea, 0x00016f8a,
+0x6f850f00, 0xc5000001, 0x03f372d9, 0xf228fdc5,
+0x92cde2c4, 0x02c0650c, 0xf9c50010, 0x18244c13,
+0x182444dd, 0xd9ddeadf, 0x01538a0f, 0x850f0000,
+0x00000151, 0x4c17f9c5, 0x44dd1824, 0xe9df1824,
+0x8a0fd8dd, 0x0000013f, 0x0139850f, 0xe3c40000,
+0x01c9197d, 0x4c13f9c5, 0x05d91824, 0x001004d0,
+0x182444dd, 0xd8dde9df, 0x01198a0f, 0x850f0000,
+0x00000113, 0x4c17f9c5, 0x05d91824, 0x001004d4,
+0x182444dd, 0xd8dde9df, 0x00f98a0f, 0x850f0000,
+0x000000f3, 0xf9c5c031, 0x3024646f, 0xfa28fdc5,
+0x92c5e2c4, 0x02c0e50c, 0xfdc50010, 0x40244c29,
+0x30844c8b, 0x8901518d, 0xdb182454, 0xdd182444,
+0xdd40c444, 0xdf182454, 0x0fd8dde9, 0x0000bd8a,
+0xb7850f00, 0x40000000, 0x7504f883, 0xefd1c5d3,
+0xfad1c5ed, 0x28fdc5db, 0x0107b8f2, 0xe2c40000,
+0xdd2c92cd, 0x001002e0, 0x197de2c4, 0x1004d81d,
+0x58f5c500, 0x76e5c5cb, 0xc2f5c5db, 0xe2c400cd,
+0x0fcb177d, 0x00008183, 0x72d9c500, 0xc03101f4,
+0x92ede2c4, 0x02c0a50c, 0xfdc50010, 0x40244c29,
+0x30844c8b, 0x8901518d, 0xdb182454, 0xdd182444,
+0xdd40c444, 0xdf182454, 0x7ad8dde9, 0x40467548,
+0x7504f883, 0xebc031db, 0x00e7b841, 0x3aeb0000,
+0x16ebd8dd, 0x12ebd8dd, 0x0eebd8dd, 0x0aebd8dd,
+0xd8ddd8dd, 0xd8dd04eb, 0xefb8d8dd, 0xeb000000,
+0xebd8dd19, 0xb8d8dd02, 0x000000f7, 0xffb80ceb,
+0xeb000000, 0x0115b805, 0xc3c90000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40100000,
+0x00000000, 0x40140000, 0x00000000, 0x40180000,
+0x00000000, 0x401c0000, 0x00000000, 0x40200000,
+0x00000000, 0x40220000, 0x00000000, 0x40240000,
+0x00000000, 0x40260000, 0x00000000, 0x40280000,
+0x00000000, 0x402a0000, 0x00000000, 0x402c0000,
+0x00000000, 0x402e0000, 0x00000000, 0x40300000,
+0x00000000, 0x40310000, 0x00000000, 0x40320000,
+0x00000000, 0x40330000, 0x00000000, 0x40340000,
+0x00000000, 0x40350000, 0x00000000, 0x40360000,
+0x00000000, 0x40370000, 0x00000000, 0x40380000,
+0x00000000, 0x40390000, 0x00000000, 0x403a0000,
+0x00000000, 0x403b0000, 0x00000000, 0x403c0000,
+0x00000000, 0x403d0000, 0x00000000, 0x403e0000,
+0x00000000, 0x403f0000, 0x00000000, 0x40400000,
+0x00000000, 0x40408000, 0x00000000, 0x40410000,
+0x00000000, 0x40418000, 0x00000000, 0x40420000,
+0x00000000, 0x40428000, 0x00000000, 0x40430000,
+0x00000000, 0x40438000, 0x00000000, 0x40440000,
+0x00000000, 0x40448000, 0x00000000, 0x40450000,
+0x00000000, 0x40458000, 0x00000000, 0x40460000,
+0x00000000, 0x40468000, 0x00000000, 0x40470000,
+0x00000000, 0x40478000, 0x00000000, 0x40480000,
+0x00000000, 0x40488000, 0x00000000, 0x40490000,
+0x00000000, 0x40498000, 0x00000000, 0x404a0000,
+0x00000000, 0x404a8000, 0x00000000, 0x404b0000,
+0x00000000, 0x404b8000, 0x00000000, 0x404c0000,
+0x00000000, 0x404c8000, 0x00000000, 0x404d0000,
+0x00000000, 0x404d8000, 0x00000000, 0x404e0000,
+0x00000000, 0x404e8000, 0x00000000, 0x404f0000,
+0x00000000, 0x404f8000, 0x00000000, 0x40500000,
+0x40000000, 0x40400000, 0x40800000, 0x40a00000,
+0x40e00000, 0x41100000, 0x00000000, 0xbff00000,
+0002340,
+};
+asm(".type avx2_sg_x86_32_D_32x4f8, STT_NOTYPE;");
+asm(".type avx2_sg_x86_32_D_32x4f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_32_D_32x8i4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x01b855c3,
+0x89000000, 0x57d231e5, 0xe4835356, 0x60ec83e0,
+0x1cc45489, 0x000005be, 0x89ff3100, 0x2918c444,
+0xc47489c6, 0x89d71938, 0x833cc47c, 0xc68901c0,
+0x8300d283, 0xd60905f6, 0xc031d675, 0xc976f1c5,
+0xdbefe1c5, 0xf16ff9c5, 0x914de2c4, 0x02201d14,
+0xf9c50010, 0x1024547f, 0x10847c83, 0x74850f01,
+0x40000001, 0x7504f883, 0x6ffdc5ef, 0xc520246c,
+0xc4f96ff9, 0x149145e2, 0x100220ad, 0x7ef9c500,
+0x02fa83d2, 0x0000efb8, 0x5b850f00, 0xc4000001,
+0xd21679e3, 0x03fa8301, 0x014c850f, 0xe3c40000,
+0x02d21679, 0x0f04fa83, 0x00013d85, 0x79e3c400,
+0x8303d216, 0x850f05fa, 0x0000012e, 0xf573e5c5,
+0x6ff9c502, 0x00f7b8f1, 0xe2c40000, 0x5d14914d,
+0x00100220, 0xd27ef9c5, 0x0f03fa83, 0x00010985,
+0x79e3c400, 0x8301d216, 0x850f05fa, 0x000000fa,
+0x1679e3c4, 0xfa8302d2, 0xeb850f07, 0xc4000000,
+0xd21679e3, 0x09fa8303, 0x00dc850f, 0xc0310000,
+0x5c6ffdc5, 0xf9c54024, 0xe2c4f96f, 0x9d149145,
+0x00100220, 0x547ff9c5, 0x548b1024, 0x4c8b1084,
+0x5c8b40c4, 0xd78944c4, 0x831fffc1, 0xd38301c1,
+0x0fdf3900, 0x00009585, 0x0fca3900, 0x00008d85,
+0xf8834000, 0xb8d37504, 0x00000001, 0xe4efd9c5,
+0xe5fbddc5, 0xf16ff9c5, 0x914de2c4, 0x0230a52c,
+0xf9c50010, 0xf9c5e06e, 0xc500e470, 0xb8d4fae9,
+0x00000107, 0xd576e9c5, 0xe476d9c5, 0x1779e2c4,
+0xc55773d4, 0x01f373e5, 0xf9c5c031, 0xe2c4e96f,
+0x5d149155, 0x00100220, 0x547ff9c5, 0x548b1024,
+0x4c8b1084, 0x5c8b40c4, 0xd78944c4, 0x831fffc1,
+0xd38301c1, 0x75df3900, 0x75ca391c, 0xf8834018,
+0x31db7504, 0xb813ebc0, 0x000000e7, 0xffb80ceb,
+0xeb000000, 0x0115b805, 0x658d0000, 0x5f5e5bf4,
+0x0000c35d, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000002, 0x00000003, 0x00000004,
+0x00000005, 0x00000006, 0x00000007, 0x00000008,
+0x00000009, 0x0000000a, 0x0000000b, 0x0000000c,
+0x0000000d, 0x0000000e, 0x0000000f, 0x00000010,
+0x00000011, 0x00000012, 0x00000013, 0x00000014,
+0x00000015, 0x00000016, 0x00000017, 0x00000018,
+0x00000019, 0x0000001a, 0x0000001b, 0x0000001c,
+0x0000001d, 0x0000001e, 0x0000001f, 0x00000020,
+0x00000021, 0x00000022, 0x00000023, 0x00000024,
+0x00000025, 0x00000026, 0x00000027, 0x00000028,
+0x00000029, 0x0000002a, 0x0000002b, 0x0000002c,
+0x0000002d, 0x0000002e, 0x0000002f, 0x00000030,
+0x00000031, 0x00000032, 0x00000033, 0x00000034,
+0x00000035, 0x00000036, 0x00000037, 0x00000038,
+0x00000039, 0x0000003a, 0x0000003b, 0x0000003c,
+0x0000003d, 0x0000003e, 0x0000003f, 0x00000040,
+0001440,
+};
+asm(".type avx2_sg_x86_32_D_32x8i4, STT_NOTYPE;");
+asm(".type avx2_sg_x86_32_D_32x8i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_32_D_32x8i8[] = {
+0xb85500eb, 0x00000001, 0xd231e589, 0x83535657,
+0xec81e0e4, 0x000000a0, 0x5cc45489, 0x000005b9,
+0x89db3100, 0x2958c444, 0xc44c89c1, 0x89d31978,
+0x837cc45c, 0xc18901c0, 0x8300d283, 0xd10905f1,
+0xc031d675, 0xd276edc5, 0xdbefe1c5, 0xfa6ffdc5,
+0x91c5e2c4, 0x02c01d0c, 0xfdc50010, 0x20244c7f,
+0x20c47c8b, 0x18247c89, 0xf283fa89, 0xc4540b01,
+0x17850f24, 0x40000002, 0x7504f883, 0x0002b8e3,
+0xd2310000, 0x5c6ffdc5, 0xfdc56024, 0xe2c4f26f,
+0xdd0c91cd, 0x001002c0, 0x4c7ffdc5, 0x0c8d2024,
+0x000000c5, 0x245c8d00, 0x39d90120, 0x850ff451,
+0x000001e1, 0x0ff04139, 0x0001d885, 0x01c08300,
+0xd283c189, 0x06f18300, 0xd275d109, 0xf373ddc5,
+0x6ffdc503, 0x00f7bffa, 0xe2c40000, 0x650c91c5,
+0x001002c0, 0xc87ef9c5, 0xf183c189, 0x79e3c403,
+0x0901ca16, 0xb4850fd1, 0xc5000001, 0x244c17f8,
+0x24548b18, 0x05f28318, 0x1c24540b, 0x019d850f,
+0xe3c40000, 0x01c9397d, 0xc87ef9c5, 0xf183c189,
+0x79e3c407, 0x0901ca16, 0x80850fd1, 0xc5000001,
+0x244c17f8, 0x24548b18, 0x09f28318, 0x1c24540b,
+0x0169850f, 0xc0310000, 0x8c6ffdc5, 0x00008024,
+0x6ffdc500, 0xcde2c4f2, 0xc0cd2491, 0xc5001002,
+0x24647ffd, 0xc4b48b20, 0x00000080, 0x84c4bc8b,
+0x89000000, 0x89182474, 0x247c89f1, 0x01c1831c,
+0xd383fb89, 0xc45c3900, 0x0d850f24, 0x39000001,
+0x0f20c44c, 0x00010385, 0xf8834000, 0xc5c67504,
+0xc025fbdd, 0xc5001004, 0xc5edefd1, 0xc5ebfbd5,
+0xbffa6ffd, 0x00000107, 0x91c5e2c4, 0x02e0ed34,
+0xe2c40010, 0xc4e6295d, 0xe2177de2, 0x00dd830f,
+0xd5c50000, 0x3101f173, 0xede2c4c0, 0xc0ad2491,
+0xc5001002, 0x24647ffd, 0xc4b48b20, 0x00000080,
+0x84c4bc8b, 0x89000000, 0x89182474, 0x247c89f1,
+0x01c1831c, 0xd383fb89, 0xc45c3900, 0x90850f24,
+0x39000000, 0x0f20c44c, 0x00008685, 0xf8834000,
+0x31c67504, 0x0005bac0, 0xe9c50000, 0xe5c5d2ef,
+0xe2c4c9db, 0xc4ca2975, 0xca2975e2, 0x91f5e2c4,
+0x02c0dd24, 0xfdc50010, 0x4024647f, 0x40c4748b,
+0x7c8bd189, 0x294044c4, 0x74c185c1, 0xc44c8b12,
+0xc45c8b58, 0x244c895c, 0x245c8918, 0x8b08eb1c,
+0x8b78c44c, 0x837cc45c, 0xd38301c1, 0x75df3900,
+0x75ce3929, 0x04f88325, 0xff31c275, 0xe7bf21eb,
+0xeb000000, 0x00efbf1a, 0x13eb0000, 0x0000ffbf,
+0xbf0ceb00, 0x00000115, 0x1ebf05eb, 0x8d000001,
+0xf889f465, 0x5d5f5e5b, 0x000000c3, 0x00000000,
+0x00000001, 0x00000000, 0x00000002, 0x00000000,
+0x00000003, 0x00000000, 0x00000004, 0x00000000,
+0x00000005, 0x00000000, 0x00000006, 0x00000000,
+0x00000007, 0x00000000, 0x00000008, 0x00000000,
+0x00000009, 0x00000000, 0x0000000a, 0x00000000,
+0x0000000b, 0x00000000, 0x0000000c, 0x00000000,
+0x0000000d, 0x00000000, 0x0000000e, 0x00000000,
+0x0000000f, 0x00000000, 0x00000010, 0x00000000,
+0x00000011, 0x00000000, 0x00000012, 0x00000000,
+0x00000013, 0x00000000, 0x00000014, 0x00000000,
+0x00000015, 0x00000000, 0x00000016, 0x00000000,
+0x00000017, 0x00000000, 0x00000018, 0x00000000,
+0x00000019, 0x00000000, 0x0000001a, 0x00000000,
+0x0000001b, 0x00000000, 0x0000001c, 0x00000000,
+0x0000001d, 0x00000000, 0x0000001e, 0x00000000,
+0x0000001f, 0x00000000, 0x00000020, 0x00000000,
+0x00000021, 0x00000000, 0x00000022, 0x00000000,
+0x00000023, 0x00000000, 0x00000024, 0x00000000,
+0x00000025, 0x00000000, 0x00000026, 0x00000000,
+0x00000027, 0x00000000, 0x00000028, 0x00000000,
+0x00000029, 0x00000000, 0x0000002a, 0x00000000,
+0x0000002b, 0x00000000, 0x0000002c, 0x00000000,
+0x0000002d, 0x00000000, 0x0000002e, 0x00000000,
+0x0000002f, 0x00000000, 0x00000030, 0x00000000,
+0x00000031, 0x00000000, 0x00000032, 0x00000000,
+0x00000033, 0x00000000, 0x00000034, 0x00000000,
+0x00000035, 0x00000000, 0x00000036, 0x00000000,
+0x00000037, 0x00000000, 0x00000038, 0x00000000,
+0x00000039, 0x00000000, 0x0000003a, 0x00000000,
+0x0000003b, 0x00000000, 0x0000003c, 0x00000000,
+0x0000003d, 0x00000000, 0x0000003e, 0x00000000,
+0x0000003f, 0x00000000, 0x00000040, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0002340,
+};
+asm(".type avx2_sg_x86_32_D_32x8i8, STT_NOTYPE;");
+asm(".type avx2_sg_x86_32_D_32x8i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_32_D_32x8f4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x01b855c3,
+0x89000000, 0x56d231e5, 0xe0e48353, 0x8960ec83,
+0xb91cc454, 0x00000005, 0x4489db31, 0xc12918c4,
+0x38c44c89, 0x5c89d319, 0xc0833cc4, 0x83c18901,
+0xf18300d2, 0x75d10905, 0x76f1c5d6, 0xefe1c5c9,
+0xc5c031db, 0xc4f128f8, 0x14934de2, 0x1002e01d,
+0x29f8c500, 0xd9102454, 0x8444d9e8, 0xdde9df10,
+0x0c8a0fd8, 0x0f000002, 0x00020685, 0xf8834000,
+0xc5e47504, 0xc5f928f8, 0x246c6ffd, 0x45e2c420,
+0xe0ad1493, 0xc5001002, 0x245411fa, 0xe005d908,
+0xd9001003, 0xdf082444, 0x0fd8dde9, 0x0001f38a,
+0xed850f00, 0xc4000001, 0xd01779e3, 0xe405d901,
+0x89001003, 0xd9082444, 0xdf082444, 0xb78a0fe9,
+0x0f000001, 0x0001b585, 0x79e3c400, 0xd902d017,
+0x1003e805, 0x24448900, 0x2444d908, 0xdde9df08,
+0x9b8a0fd8, 0x0f000001, 0x00019985, 0xec05d900,
+0xc4001003, 0x541779e3, 0xd9030824, 0xdf082444,
+0x838a0fe9, 0x0f000001, 0x00018385, 0x28f8c500,
+0x73e5c5f1, 0xe2c402f5, 0x5d14934d, 0x001002e0,
+0x5411fac5, 0x44d90824, 0xeadf0824, 0x8a0fd9dd,
+0x00000167, 0x0165850f, 0xe3c40000, 0x24541779,
+0x44d90108, 0xe9df0824, 0x8a0fd8dd, 0x00000151,
+0x014b850f, 0xe3c40000, 0x02d01779, 0x03f005d9,
+0x44890010, 0x44d90824, 0xe9df0824, 0x8a0fd8dd,
+0x0000012d, 0x0127850f, 0x05d90000, 0x001003f4,
+0x1779e3c4, 0x03082454, 0x082444d9, 0xd8dde9df,
+0x010b8a0f, 0x850f0000, 0x00000105, 0xf928f8c5,
+0x5c6ffdc5, 0xc9314024, 0x9345e2c4, 0x02e09d14,
+0xf8c50010, 0x10245429, 0x40cc448b, 0x44cc548b,
+0x8901c083, 0x83082444, 0x548900d2, 0x6cdf0c24,
+0x44d90824, 0xe9df108c, 0x8a0fd8dd, 0x000000c8,
+0x00c2850f, 0x83410000, 0xcc7504f9, 0xf128f8c5,
+0xe4efd9c5, 0xe5fbddc5, 0x934de2c4, 0x02f0a52c,
+0xe2c40010, 0xf8251879, 0xb8001003, 0x00000107,
+0xd458e8c5, 0xe476d9c5, 0xd5c2e8c5, 0x79e2c400,
+0x830fd417, 0x0000008c, 0xf373e5c5, 0xc5c93101,
+0xc4e928f8, 0x149355e2, 0x1002e05d, 0x29f8c500,
+0x8b102454, 0x8b40cc44, 0x8344cc54, 0x448901c0,
+0xd2830824, 0x24548900, 0x246cdf0c, 0x8c44d908,
+0xdde9df10, 0x75487ad8, 0xf9834146, 0x31d47504,
+0xb841ebc0, 0x000000e7, 0xd8dd3aeb, 0xd8dd16eb,
+0xd8dd12eb, 0xd8dd0eeb, 0xd8dd0aeb, 0x04ebd8dd,
+0xd8ddd8dd, 0x0000efb8, 0xdd19eb00, 0xdd02ebd8,
+0x00f7b8d8, 0x0ceb0000, 0x0000ffb8, 0xb805eb00,
+0x00000115, 0x5bf8658d, 0x00c35d5e, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+0x40a00000, 0x40c00000, 0x40e00000, 0x41000000,
+0x41100000, 0x41200000, 0x41300000, 0x41400000,
+0x41500000, 0x41600000, 0x41700000, 0x41800000,
+0x41880000, 0x41900000, 0x41980000, 0x41a00000,
+0x41a80000, 0x41b00000, 0x41b80000, 0x41c00000,
+0x41c80000, 0x41d00000, 0x41d80000, 0x41e00000,
+0x41e80000, 0x41f00000, 0x41f80000, 0x42000000,
+0x42040000, 0x42080000, 0x420c0000, 0x42100000,
+0x42140000, 0x42180000, 0x421c0000, 0x42200000,
+0x42240000, 0x42280000, 0x422c0000, 0x42300000,
+0x42340000, 0x42380000, 0x423c0000, 0x42400000,
+0x42440000, 0x42480000, 0x424c0000, 0x42500000,
+0x42540000, 0x42580000, 0x425c0000, 0x42600000,
+0x42640000, 0x42680000, 0x426c0000, 0x42700000,
+0x42740000, 0x42780000, 0x427c0000, 0x42800000,
+0x40000000, 0x40400000, 0x40800000, 0x40a00000,
+0x40e00000, 0x41100000, 0xbf800000,
+0001774,
+};
+asm(".type avx2_sg_x86_32_D_32x8f4, STT_NOTYPE;");
+asm(".type avx2_sg_x86_32_D_32x8f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_32_D_32x8f8[] = {
+0xb85500eb, 0x00000001, 0xd231e589, 0xe4835356,
+0xa0ec81e0, 0x89000000, 0xb95cc454, 0x00000005,
+0x4489db31, 0xc12958c4, 0x78c44c89, 0x5c89d319,
+0xc0837cc4, 0x83c18901, 0xf18300d2, 0x75d10905,
+0xc5c031d6, 0xc5db76e5, 0xc5d2efe9, 0xc4fb28fd,
+0x0c93c5e2, 0x10036015, 0x29fdc500, 0xdd20244c,
+0xdd20c444, 0xd9182454, 0xdfc9d9e8, 0x0fd8dde9,
+0x0002948a, 0x8e850f00, 0x40000002, 0x7504f883,
+0x6ffdc5de, 0xc5602454, 0xc4f328fd, 0x0c93cde2,
+0x100360d5, 0x13f9c500, 0xd918244c, 0x10056005,
+0x2444dd00, 0xdde9df18, 0x7b8a0fd8, 0x0f000002,
+0x00027585, 0x17f9c500, 0xd918244c, 0x10056405,
+0x2444dd00, 0x0fe9df18, 0x0002438a, 0x41850f00,
+0xc4000002, 0xc9197de3, 0x13f9c501, 0xd918244c,
+0x10056805, 0x2444dd00, 0xdde9df18, 0x258a0fd8,
+0x0f000002, 0x00022385, 0x17f9c500, 0xdd18244c,
+0xd9182444, 0x10056c05, 0xd9c0d900, 0xddeadfca,
+0x098a0fd9, 0x0f000002, 0x00020985, 0x73ddc500,
+0xfdc503f2, 0xe2c4fb28, 0x650c93c5, 0x00100360,
+0x4c13f9c5, 0x44dd1824, 0xeadf1824, 0x8a0fd9dd,
+0x000001ed, 0x01eb850f, 0xf9c50000, 0x18244c17,
+0x182444dd, 0xd8dde9df, 0x01d98a0f, 0x850f0000,
+0x000001d3, 0x197de3c4, 0xf9c501c9, 0x18244c13,
+0x057005d9, 0x44dd0010, 0xe9df1824, 0x8a0fd8dd,
+0x000001b3, 0x01ad850f, 0xf9c50000, 0x18244c17,
+0x057405d9, 0x44dd0010, 0xe9df1824, 0x8a0fd8dd,
+0x00000193, 0x018d850f, 0xc9310000, 0x8c6ffdc5,
+0x00008024, 0x28fdc500, 0xcde2c4f3, 0x60cd2493,
+0xc5001003, 0x246429fd, 0xcc848b20, 0x00000080,
+0x84cc948b, 0x83000000, 0x448901c0, 0xd2831824,
+0x24548900, 0x246cdf1c, 0xcc44dd18, 0x2454dd20,
+0xdde9df18, 0x438a0fd8, 0x0f000001, 0x00013d85,
+0xf9834100, 0xc5c27504, 0xc5edefd1, 0xc5eafbd5,
+0xb8fb28fd, 0x00000107, 0x93c5e2c4, 0x0380ed34,
+0xe2c40010, 0x782d197d, 0xc5001005, 0xc5e558dd,
+0xc5ed76d5, 0x00e6c2dd, 0x177de2c4, 0x0e830fe5,
+0xc5000001, 0x01f173d5, 0xe2c4c931, 0xad2493e5,
+0x00100360, 0x6429fdc5, 0x848b2024, 0x000080cc,
+0xcc948b00, 0x00000084, 0x8901c083, 0x83182444,
+0x548900d2, 0x6cdf1c24, 0x44dd1824, 0x54dd20cc,
+0xe9df1824, 0x8a0fd8dd, 0x000000b9, 0x00b3850f,
+0x83410000, 0xc27504f9, 0x05bbc931, 0xc5000000,
+0xc5dbefe1, 0xc4c9dbed, 0xcb2975e2, 0x2975e2c4,
+0x28fdc5f3, 0xc5e2c4fe, 0x60d52493, 0xc5001003,
+0x246429fd, 0xcc44dd40, 0x41d88940, 0xc885c829,
+0x448b0a74, 0x548b58cc, 0x08eb5ccc, 0x78cc448b,
+0x7ccc548b, 0x8901c083, 0x83182444, 0x548900d2,
+0x6cdf1c24, 0xc9d91824, 0xd8dde9df, 0x4c754e7a,
+0x7504f983, 0xebc031c0, 0x00e7b848, 0x41eb0000,
+0x16ebd8dd, 0x12ebd8dd, 0x0eebd8dd, 0x0aebd8dd,
+0xd8ddd8dd, 0xd8dd04eb, 0xefb8d8dd, 0xeb000000,
+0xebd8dd20, 0xb8d8dd02, 0x000000f7, 0xffb813eb,
+0xeb000000, 0x0115b80c, 0x05eb0000, 0x00011eb8,
+0xf8658d00, 0xc35d5e5b, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40100000,
+0x00000000, 0x40140000, 0x00000000, 0x40180000,
+0x00000000, 0x401c0000, 0x00000000, 0x40200000,
+0x00000000, 0x40220000, 0x00000000, 0x40240000,
+0x00000000, 0x40260000, 0x00000000, 0x40280000,
+0x00000000, 0x402a0000, 0x00000000, 0x402c0000,
+0x00000000, 0x402e0000, 0x00000000, 0x40300000,
+0x00000000, 0x40310000, 0x00000000, 0x40320000,
+0x00000000, 0x40330000, 0x00000000, 0x40340000,
+0x00000000, 0x40350000, 0x00000000, 0x40360000,
+0x00000000, 0x40370000, 0x00000000, 0x40380000,
+0x00000000, 0x40390000, 0x00000000, 0x403a0000,
+0x00000000, 0x403b0000, 0x00000000, 0x403c0000,
+0x00000000, 0x403d0000, 0x00000000, 0x403e0000,
+0x00000000, 0x403f0000, 0x00000000, 0x40400000,
+0x00000000, 0x40408000, 0x00000000, 0x40410000,
+0x00000000, 0x40418000, 0x00000000, 0x40420000,
+0x00000000, 0x40428000, 0x00000000, 0x40430000,
+0x00000000, 0x40438000, 0x00000000, 0x40440000,
+0x00000000, 0x40448000, 0x00000000, 0x40450000,
+0x00000000, 0x40458000, 0x00000000, 0x40460000,
+0x00000000, 0x40468000, 0x00000000, 0x40470000,
+0x00000000, 0x40478000, 0x00000000, 0x40480000,
+0x00000000, 0x40488000, 0x00000000, 0x40490000,
+0x00000000, 0x40498000, 0x00000000, 0x404a0000,
+0x00000000, 0x404a8000, 0x00000000, 0x404b0000,
+0x00000000, 0x404b8000, 0x00000000, 0x404c0000,
+0x00000000, 0x404c8000, 0x00000000, 0x404d0000,
+0x00000000, 0x404d8000, 0x00000000, 0x404e0000,
+0x00000000, 0x404e8000, 0x00000000, 0x404f0000,
+0x00000000, 0x404f8000, 0x00000000, 0x40500000,
+0x40000000, 0x40400000, 0x40800000, 0x40a00000,
+0x40e00000, 0x41100000, 0x00000000, 0xbff00000,
+0002600,
+};
+asm(".type avx2_sg_x86_32_D_32x8f8, STT_NOTYPE;");
+asm(".type avx2_sg_x86_32_D_32x8f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_64_D_16x4i4[] = {
+0xb84800eb, 0x00000001, 0x00000002, 0xe5894855,
+0xe0458948, 0x0003b848, 0x00040000, 0x89480000,
+0x01b8e845, 0x48c00000, 0x4802e0c1, 0xb8f04589,
+0x80000001, 0x48c00148, 0xc5f84589, 0xc5d276e9,
+0x48dbefe1, 0xc5c0458d, 0x48fa6ff9, 0x48d04d8d,
+0xe2c4c689, 0x1d0c9041, 0x00100240, 0x4d7ff9c5,
+0x013883c0, 0x019e850f, 0x83480000, 0x394804c0,
+0xc5ee75c8, 0xe0656ff9, 0xf26ff9c5, 0x0000efb8,
+0x49e2c400, 0x40a50c90, 0xc5001002, 0x83ca7ef9,
+0x850f02fa, 0x0000018a, 0x1679e3c4, 0xfa8301ca,
+0x7b850f03, 0xc4000001, 0xca1679e3, 0x04fa8302,
+0x016c850f, 0xe3c40000, 0x03ca1679, 0x0f05fa83,
+0x00015d85, 0x72e1c500, 0xf9c502f4, 0xf7b8fa6f,
+0xc4000000, 0x0c9041e2, 0x1002405d, 0x7ef9c500,
+0x03fa83ca, 0x0138850f, 0xe3c40000, 0x01ca1679,
+0x0f05fa83, 0x00012985, 0x79e3c400, 0x8302ca16,
+0x850f07fa, 0x0000011a, 0x1679e3c4, 0xfa8303ca,
+0x0b850f09, 0xc5000001, 0xf04d6ff9, 0xf26ff9c5,
+0xe2c4c031, 0x8d1c9049, 0x00100240, 0x5d7ff9c5,
+0x287c8bc0, 0xbc7d89f0, 0x3901578d, 0x850f0614,
+0x000000cb, 0x04c08348, 0x10f88348, 0xd1c5e375,
+0xf9c5edef, 0x07b8fa6f, 0xc5000001, 0xc5ecfad1,
+0x591dfae1, 0xc4000001, 0x349041e2, 0x100250ad,
+0x76d1c500, 0x76e1c5ed, 0x79e2c4de, 0x830fdd17,
+0x0000009e, 0xf172d1c5, 0xc4c03101, 0x1c9069e2,
+0x1002406d, 0x7ff9c500, 0x7c8bc05d, 0x7d89f005,
+0x01578dbc, 0x75061439, 0xc083486d, 0xf8834804,
+0xc5e77510, 0xc5d2efe9, 0xb8c9dbd9, 0x00000001,
+0x000005be, 0x76f1c500, 0x76f1c5ca, 0x71e2c4ca,
+0x40a51c90, 0xc5001002, 0xd05d7ff9, 0x7c8bf289,
+0xc229fc81, 0x0674c285, 0xdc85548b, 0x548b07eb,
+0x5589ec85, 0x48c2ffbc, 0xd739c0ff, 0x83481f75,
+0xd87505f8, 0x1aebc031, 0x0000e7b8, 0xb813eb00,
+0x000000ff, 0x15b80ceb, 0xeb000001, 0x011eb805,
+0xc35d0000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000002, 0x00000003, 0x00000004,
+0x00000005, 0x00000006, 0x00000007, 0x00000008,
+0x00000009, 0x0000000a, 0x0000000b, 0x0000000c,
+0x0000000d, 0x0000000e, 0x0000000f, 0x00000010,
+0x00000011, 0x00000012, 0x00000013, 0x00000014,
+0x00000015, 0x00000016, 0x00000017, 0x00000018,
+0x00000019, 0x0000001a, 0x0000001b, 0x0000001c,
+0x0000001d, 0x0000001e, 0x0000001f, 0x00000020,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0001320,
+};
+asm(".type avx2_sg_x86_64_D_16x4i4, STT_NOTYPE;");
+asm(".type avx2_sg_x86_64_D_16x4i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_64_D_16x4i8[] = {
+0xb84800eb, 0x00000001, 0x00000002, 0xe5894855,
+0xe0458948, 0x0003b848, 0x00040000, 0x89480000,
+0x01b8e845, 0x48800000, 0x8948c001, 0xffb8f045,
+0x48ffffff, 0x4820e0c1, 0xc5f84589, 0xc5c976f1,
+0xb8dbefe1, 0x000000e7, 0xf16ff9c5, 0x90c9e2c4,
+0x01a01d14, 0xe1c40010, 0x48d27ef9, 0x850fcaff,
+0x00000126, 0x16f9e3c4, 0x834801d2, 0x850f01fa,
+0x00000116, 0x6d6ff9c5, 0x6ff9c5e0, 0x00efb8f9,
+0xe2c40000, 0xed1490c1, 0x001001a0, 0x7ef9e1c4,
+0xf98348d1, 0xef850f02, 0xc4000000, 0xd116f9e3,
+0xf9834801, 0xdf850f03, 0xc5000000, 0x03f572d9,
+0xf16ff9c5, 0x0000f7b8, 0xc9e2c400, 0xa0651490,
+0xc4001001, 0xd17ef9e1, 0x03f98348, 0x00b8850f,
+0xe3c40000, 0x01d116f9, 0x05f98348, 0x00a8850f,
+0x458b0000, 0x6ff9c5f0, 0xf9c5f065, 0xe2c4f96f,
+0xe51490c1, 0x001001a0, 0xb801708d, 0x000000ff,
+0xc4f66348, 0xd17ef9e1, 0x75ce3948, 0xf4458b7d,
+0x16f9e3c4, 0x488d01d7, 0x00ffb801, 0x63480000,
+0xf93948c9, 0xe1c56475, 0xf9c5ddfa, 0xe1c4f16f,
+0xb8fa6ef9, 0x00000107, 0x90c9e2c4, 0x01b0dd2c,
+0xc1c50010, 0xe9c5df6c, 0xe2c4d3fb, 0xc4d52969,
+0xd11779e2, 0xd9c53473, 0xb801f472, 0x00000115,
+0x90f1e2c4, 0x01a0a514, 0xe1c40010, 0x48d27ef9,
+0x1675d639, 0x16f9e3c4, 0x15ba01d0, 0x48000001,
+0x00b8c139, 0x0f000000, 0xc35dc245, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000000, 0x00000002, 0x00000000,
+0x00000003, 0x00000000, 0x00000004, 0x00000000,
+0x00000005, 0x00000000, 0x00000006, 0x00000000,
+0x00000007, 0x00000000, 0x00000008, 0x00000000,
+0x00000009, 0x00000000, 0x0000000a, 0x00000000,
+0x0000000b, 0x00000000, 0x0000000c, 0x00000000,
+0x0000000d, 0x00000000, 0x0000000e, 0x00000000,
+0x0000000f, 0x00000000, 0x00000010, 0x00000000,
+0x00000011, 0x00000000, 0x00000012, 0x00000000,
+0x00000013, 0x00000000, 0x00000014, 0x00000000,
+0x00000015, 0x00000000, 0x00000016, 0x00000000,
+0x00000017, 0x00000000, 0x00000018, 0x00000000,
+0x00000019, 0x00000000, 0x0000001a, 0x00000000,
+0x0000001b, 0x00000000, 0x0000001c, 0x00000000,
+0x0000001d, 0x00000000, 0x0000001e, 0x00000000,
+0x0000001f, 0x00000000, 0x00000020, 0x00000000,
+0001240,
+};
+asm(".type avx2_sg_x86_64_D_16x4i8, STT_NOTYPE;");
+asm(".type avx2_sg_x86_64_D_16x4i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_64_D_16x4f4[] = {
+0xb84800eb, 0x00000001, 0x00000002, 0xe5894855,
+0xe0458948, 0x0003b848, 0x00040000, 0x89480000,
+0x01b8e845, 0x48c00000, 0x4802e0c1, 0xb8f04589,
+0x80000001, 0x48c00148, 0xc5f84589, 0xc5d276e9,
+0x48dbefe1, 0xc5c0458d, 0x48fa28f8, 0x48d04d8d,
+0xe2c4c689, 0x1d0c9241, 0x001002c0, 0x4d29f8c5,
+0x10fac5c0, 0x0002d70d, 0x2ef8c500, 0x138a0f08,
+0x0f000002, 0x00020d85, 0xc0834800, 0xc8394804,
+0xf9c5e775, 0xc5e0656f, 0xc4f228f8, 0x0c9249e2,
+0x1002c0a5, 0x2ef8c500, 0x0002a70d, 0xea8a0f00,
+0x0f000001, 0x0001e485, 0xc6f0c500, 0xf8c555d9,
+0x02921d2e, 0x8a0f0000, 0x000001d1, 0x01cb850f,
+0xf0c50000, 0xf8c5d915, 0x027e1d2e, 0x8a0f0000,
+0x000001b9, 0x01b3850f, 0xf0c50000, 0xc5ffc9c6,
+0x690d2ef8, 0x0f000002, 0x0001a08a, 0x9a850f00,
+0xc5000001, 0x02f472e1, 0xfa28f8c5, 0x9241e2c4,
+0x02c05d0c, 0xf8c50010, 0x023a0d2e, 0x8a0f0000,
+0x00000180, 0x017a850f, 0xf0c50000, 0xc555d9c6,
+0x291d2ef8, 0x0f000002, 0x0001678a, 0x61850f00,
+0xc5000001, 0xc5d915f0, 0x151d2ef8, 0x0f000002,
+0x00014f8a, 0x49850f00, 0xc5000001, 0xffc9c6f0,
+0x0d2ef8c5, 0x00000200, 0x01368a0f, 0x850f0000,
+0x00000130, 0x4d6ff9c5, 0x28f8c5f0, 0xc4c031f2,
+0x1c9249e2, 0x1002c08d, 0x29f8c500, 0x7c8bc05d,
+0x578df028, 0xbc7d8901, 0xea2ad2c5, 0x2c2ef8c5,
+0x048a0f06, 0x0f000001, 0x0000fe85, 0xc0834800,
+0xf8834804, 0xc5d77510, 0xc5edefd1, 0xb8fa28f8,
+0x00000107, 0xecfad1c5, 0x9241e2c4, 0x02d0ad34,
+0xe2c40010, 0x912d1879, 0xc5000001, 0xc5dd58e0,
+0xc5ed76d1, 0x00dec2e0, 0x1779e2c4, 0xcb830fdd,
+0xc5000000, 0x01f172d1, 0xe2c4c031, 0x6d1c9269,
+0x001002c0, 0x5d29f8c5, 0x057c8bc0, 0x01578df0,
+0xc5bc7d89, 0xc5d22aea, 0x06142ef8, 0x00908a0f,
+0x850f0000, 0x0000008a, 0x04c08348, 0x10f88348,
+0xe9c5d775, 0xd9c5d2ef, 0x01b8c9db, 0xbe000000,
+0x00000005, 0xca76f1c5, 0xf276f1c5, 0xfe28f8c5,
+0x9241e2c4, 0x02c0a51c, 0xf8c50010, 0x89d05d29,
+0x10fac5f2, 0x29fc8154, 0x74c285c2, 0x857c8b06,
+0x8b07ebdc, 0x89ec857c, 0x578dbc7d, 0xc0ff4801,
+0xca2af2c5, 0xd12ef8c5, 0x2d752f7a, 0x05f88348,
+0xc031cd75, 0xe7b828eb, 0xeb000000, 0x00efb821,
+0x1aeb0000, 0x0000f7b8, 0xb813eb00, 0x000000ff,
+0x15b80ceb, 0xeb000001, 0x011eb805, 0xc35d0000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+0x40a00000, 0x40c00000, 0x40e00000, 0x41000000,
+0x41100000, 0x41200000, 0x41300000, 0x41400000,
+0x41500000, 0x41600000, 0x41700000, 0x41800000,
+0x41880000, 0x41900000, 0x41980000, 0x41a00000,
+0x41a80000, 0x41b00000, 0x41b80000, 0x41c00000,
+0x41c80000, 0x41d00000, 0x41d80000, 0x41e00000,
+0x41e80000, 0x41f00000, 0x41f80000, 0x42000000,
+0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+0x40a00000, 0x40e00000, 0x41100000, 0xbf800000,
+0001540,
+};
+asm(".type avx2_sg_x86_64_D_16x4f4, STT_NOTYPE;");
+asm(".type avx2_sg_x86_64_D_16x4f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_64_D_16x4f8[] = {
+0xb84800eb, 0x00000001, 0x00000002, 0xe5894855,
+0xe0458948, 0x0003b848, 0x00040000, 0x89480000,
+0x01b8e845, 0x48800000, 0x8948c001, 0xffb8f045,
+0x48ffffff, 0x4820e0c1, 0xc5f84589, 0xc5c976f1,
+0xc5dbefe1, 0xc4f128f9, 0x1492c9e2, 0x1001c01d,
+0x10fbc500, 0x0002671d, 0x2ef9c500, 0x3a8a0fd3,
+0x0f000001, 0x00013485, 0x15e9c500, 0x2ef9c5d2,
+0x268a0fd3, 0x0f000001, 0x00012085, 0x6ff9c500,
+0xf9c5e06d, 0xe2c4f928, 0xed1492c1, 0x001001c0,
+0x152ef9c5, 0x00000230, 0x01068a0f, 0x850f0000,
+0x00000100, 0x1d10fbc5, 0x00000224, 0xd215e9c5,
+0xd32ef9c5, 0x00ea8a0f, 0x850f0000, 0x000000e4,
+0xf572d9c5, 0x28f9c503, 0xc9e2c4f1, 0xc0651492,
+0xc5001001, 0x0fd32ef9, 0x0000ce8a, 0xc8850f00,
+0xc5000000, 0xc5d215e9, 0xe9152ef9, 0x0f000001,
+0x0000b68a, 0xb0850f00, 0x8b000000, 0xf9c5f045,
+0xc5f05d6f, 0xc4f928f9, 0x1492c1e2, 0x1001c0dd,
+0xc5c0ff00, 0xc5f82ac3, 0x0ffa2ef9, 0x0000918a,
+0x8b850f00, 0x8b000000, 0xe9c5f445, 0xc0ffe215,
+0xf02acbc5, 0xf42ef9c5, 0x7675787a, 0xe4efd9c5,
+0xc12879c5, 0x000107b8, 0xfad9c500, 0xb9e2c4e5,
+0xd0e52c92, 0xc5001001, 0x812512fb, 0xc5000001,
+0xc5d458e9, 0xc5e476d9, 0x00d5c2e9, 0x1779e2c4,
+0xc54b73d4, 0x01f372e1, 0x92f1e2c4, 0x01c09d14,
+0xf9c50010, 0x317afa2e, 0xe9c52f75, 0xf9c5d215,
+0x257af22e, 0x000000b8, 0xeb237400, 0x00e7b81c,
+0x1aeb0000, 0x0000efb8, 0xb813eb00, 0x000000f7,
+0xffb80ceb, 0xeb000000, 0x0115b805, 0xc35d0000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40100000,
+0x00000000, 0x40140000, 0x00000000, 0x40180000,
+0x00000000, 0x401c0000, 0x00000000, 0x40200000,
+0x00000000, 0x40220000, 0x00000000, 0x40240000,
+0x00000000, 0x40260000, 0x00000000, 0x40280000,
+0x00000000, 0x402a0000, 0x00000000, 0x402c0000,
+0x00000000, 0x402e0000, 0x00000000, 0x40300000,
+0x00000000, 0x40310000, 0x00000000, 0x40320000,
+0x00000000, 0x40330000, 0x00000000, 0x40340000,
+0x00000000, 0x40350000, 0x00000000, 0x40360000,
+0x00000000, 0x40370000, 0x00000000, 0x40380000,
+0x00000000, 0x40390000, 0x00000000, 0x403a0000,
+0x00000000, 0x403b0000, 0x00000000, 0x403c0000,
+0x00000000, 0x403d0000, 0x00000000, 0x403e0000,
+0x00000000, 0x403f0000, 0x00000000, 0x40400000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40140000,
+0x00000000, 0xbff00000,
+0001350,
+};
+asm(".type avx2_sg_x86_64_D_16x4f8, STT_NOTYPE;");
+asm(".type avx2_sg_x86_64_D_16x4f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_64_D_16x8i4[] = {
+0x485500eb, 0xc748e589, 0x0001e045, 0xc7480000,
+0x0002f045, 0xc7480000, 0x0002e845, 0xc7480000,
+0x0001f845, 0xf1c50000, 0xe1c5c976, 0xe7b8dbef,
+0xc5000000, 0xc4f16ff9, 0x149149e2, 0x1002201d,
+0x7ef9c500, 0x0fcaffd2, 0x0001b785, 0x79e3c400,
+0xff01d216, 0xa9850fca, 0xc4000001, 0xd11679e3,
+0x79e3c402, 0xb803d216, 0x000000ea, 0x850fd109,
+0x00000190, 0x6d6ff9c5, 0x6ff9c5e0, 0x00efb8f9,
+0xe2c40000, 0xad149141, 0x00100220, 0xd27ef9c5,
+0x0f02fa83, 0x00016b85, 0x79e3c400, 0x8301d216,
+0x850f03fa, 0x0000015c, 0x1679e3c4, 0xe3c402d1,
+0x03d21679, 0x0000f2b8, 0x0fd10900, 0x00014385,
+0x73e1c500, 0xf9c502f5, 0xf7b8f16f, 0xc4000000,
+0x149149e2, 0x1002205d, 0x7ef9c500, 0x03fa83d2,
+0x011e850f, 0xe3c40000, 0x01d21679, 0x0f05fa83,
+0x00010f85, 0x79e3c400, 0xc402d116, 0xd21679e3,
+0x00fab803, 0xd1090000, 0x00f6850f, 0xf9c50000,
+0xc5f05d6f, 0x48f96ff9, 0xc4f0458b, 0x149141e2,
+0x1002209d, 0x488d4800, 0x00ffb801, 0xf9c50000,
+0x6348d77e, 0xca3948d7, 0x00c6850f, 0x8b480000,
+0xe3c4f845, 0x01d61679, 0x48c6634c, 0xb801508d,
+0x000000ff, 0x0fd03949, 0x0000a785, 0x79c3c400,
+0xc403d116, 0xd21679e3, 0x0102b802, 0x09410000,
+0x8d850fd1, 0xc5000000, 0xffe4efd9, 0x010bb8cf,
+0xd9c50000, 0xf9c5e5fb, 0xe2c4e96f, 0xa5149151,
+0x00100228, 0xd27ef9c5, 0x6875d739, 0xe3c4ceff,
+0x01d21679, 0x5c75d639, 0x1679e3c4, 0xe3c403d6,
+0x02d21679, 0x00010eb8, 0x75d60900, 0x73e1c547,
+0xf9c501f3, 0x15b8e16f, 0xc4000001, 0x0c9159e2,
+0x1002205d, 0x7ef9c500, 0xd26348ca, 0x75ca3948,
+0x79e3c423, 0x4801ca16, 0x394cd263, 0xc41575c2,
+0xc81679e3, 0x79e3c403, 0x0902ca16, 0xb80574d0,
+0x00000118, 0x0000c35d, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000002, 0x00000003, 0x00000004,
+0x00000005, 0x00000006, 0x00000007, 0x00000008,
+0x00000009, 0x0000000a, 0x0000000b, 0x0000000c,
+0x0000000d, 0x0000000e, 0x0000000f, 0x00000010,
+0x00000011, 0x00000012, 0x00000013, 0x00000014,
+0x00000015, 0x00000016, 0x00000017, 0x00000018,
+0x00000019, 0x0000001a, 0x0000001b, 0x0000001c,
+0x0000001d, 0x0000001e, 0x0000001f, 0x00000020,
+0001240,
+};
+asm(".type avx2_sg_x86_64_D_16x8i4, STT_NOTYPE;");
+asm(".type avx2_sg_x86_64_D_16x8i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_64_D_16x8i8[] = {
+0x485500eb, 0xc748e589, 0x0001e045, 0xc7480000,
+0x0002f045, 0xc7480000, 0x0002e845, 0xc7480000,
+0x0001f845, 0xd1c50000, 0xe1c5ed76, 0xe7b8dbef,
+0xc5000000, 0xc4fd6ff9, 0x0c91c1e2, 0x1001c01d,
+0xf9e1c400, 0xff48ca7e, 0x62850fca, 0xc4000001,
+0xca16f9e3, 0xfa834801, 0x52850f01, 0xc5000001,
+0xe0656ff9, 0xf56ff9c5, 0x0000efb8, 0xc9e2c400,
+0xc0e50c91, 0xc4001001, 0xc97ef9e1, 0x02f98348,
+0x012b850f, 0xe3c40000, 0x01c916f9, 0x03f98348,
+0x011b850f, 0xe9c50000, 0xc503f473, 0xb8fd6ff9,
+0x000000f7, 0x91c1e2c4, 0x01c0550c, 0xe1c40010,
+0x48c97ef9, 0x0f03f983, 0x0000f485, 0xf9e3c400,
+0x4801c916, 0x0f05f983, 0x0000e485, 0x6ff9c500,
+0x8b48f04d, 0xf9c5f045, 0xe2c4f56f, 0xcd1491c9,
+0x001001c0, 0x01708d48, 0x0000ffb8, 0xf9e1c400,
+0x3948d17e, 0xb6850fce, 0x48000000, 0xc4f8458b,
+0xd716f9e3, 0x488d4801, 0x00ffb801, 0x39480000,
+0x9a850ff9, 0xc5000000, 0xc5dcfbe1, 0xb8fd6ff9,
+0x00000107, 0x91c1e2c4, 0x01d0dd34, 0xe1c40010,
+0xc5fa6ef9, 0xc5df6cc1, 0xc4d3fbe9, 0xd62969e2,
+0x1779e2c4, 0xc56a73d5, 0x01f173e1, 0x000115b8,
+0xd1e2c400, 0xc09d1491, 0xc4001001, 0xd27ef9e1,
+0x75d63948, 0xf9e3c44c, 0x4801d216, 0x4175d139,
+0xdbefe1c5, 0xc9dbd9c5, 0x00011eb8, 0x71e2c400,
+0xe2c4cb29, 0xc4cb2971, 0x1491f1e2, 0x1001c0e5,
+0xf9e1c400, 0x3948d27e, 0xc41675d6, 0xd016f9e3,
+0x011eba01, 0x39480000, 0x0000b8c1, 0x450f0000,
+0x00c35dc2, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000000, 0x00000002, 0x00000000,
+0x00000003, 0x00000000, 0x00000004, 0x00000000,
+0x00000005, 0x00000000, 0x00000006, 0x00000000,
+0x00000007, 0x00000000, 0x00000008, 0x00000000,
+0x00000009, 0x00000000, 0x0000000a, 0x00000000,
+0x0000000b, 0x00000000, 0x0000000c, 0x00000000,
+0x0000000d, 0x00000000, 0x0000000e, 0x00000000,
+0x0000000f, 0x00000000, 0x00000010, 0x00000000,
+0x00000011, 0x00000000, 0x00000012, 0x00000000,
+0x00000013, 0x00000000, 0x00000014, 0x00000000,
+0x00000015, 0x00000000, 0x00000016, 0x00000000,
+0x00000017, 0x00000000, 0x00000018, 0x00000000,
+0x00000019, 0x00000000, 0x0000001a, 0x00000000,
+0x0000001b, 0x00000000, 0x0000001c, 0x00000000,
+0x0000001d, 0x00000000, 0x0000001e, 0x00000000,
+0x0000001f, 0x00000000, 0x00000020, 0x00000000,
+0001300,
+};
+asm(".type avx2_sg_x86_64_D_16x8i8, STT_NOTYPE;");
+asm(".type avx2_sg_x86_64_D_16x8i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_64_D_16x8f4[] = {
+0x485500eb, 0xc748e589, 0x0001e045, 0xc7480000,
+0x0002f045, 0xc7480000, 0x0002e845, 0xc7480000,
+0x0001f845, 0xe9c50000, 0xe1c5d276, 0xf8c5dbef,
+0xe2c4fa28, 0x1d0c9341, 0x00100300, 0x1d10fac5,
+0x0000033c, 0xcb2ef8c5, 0x025c8a0f, 0x850f0000,
+0x00000256, 0xe1c6f0c5, 0x2ef8c555, 0x478a0fe3,
+0x0f000002, 0x00024185, 0x15f0c500, 0x57e0c5e1,
+0x2ef8c5db, 0x368a0fe3, 0x0f000002, 0x00023085,
+0xc6f0c500, 0xf8c5ffc9, 0x8a0fcb2e, 0x00000221,
+0x021b850f, 0xf9c50000, 0xc5e06d6f, 0xc4fa28f8,
+0x0c9341e2, 0x100300ad, 0x2ef8c500, 0x0002d30d,
+0x018a0f00, 0x0f000002, 0x0001fb85, 0xc6f0c500,
+0xf8c555d9, 0x02be1d2e, 0x8a0f0000, 0x000001e8,
+0x01e2850f, 0xf0c50000, 0xe0c5e115, 0xf8c5db57,
+0x8a0fe32e, 0x000001d7, 0x01d1850f, 0xf0c50000,
+0xc5ffc9c6, 0x0fcb2ef8, 0x0001c28a, 0xbc850f00,
+0xc5000001, 0x02f573e1, 0xfa28f8c5, 0x9341e2c4,
+0x03005d0c, 0xf8c50010, 0x026a0d2e, 0x8a0f0000,
+0x000001a2, 0x019c850f, 0xf0c50000, 0xc555d9c6,
+0x551d2ef8, 0x0f000002, 0x0001898a, 0x83850f00,
+0xc5000001, 0xc5d915f0, 0xc5f657c8, 0x0fde2ef8,
+0x0001788a, 0x72850f00, 0xc5000001, 0xffc9c6f0,
+0xce2ef8c5, 0x01638a0f, 0x850f0000, 0x0000015d,
+0xf0458b48, 0x5d6ff9c5, 0x69e2c4f0, 0x009d0c93,
+0x48001003, 0x61c4c0ff, 0xc5c02aba, 0xc4e128f8,
+0xc82e78c1, 0x013a8a0f, 0x850f0000, 0x00000134,
+0xf8458b48, 0xd1c6f0c5, 0xc0ff4855, 0x2ac2e1c4,
+0x2ef8c5f8, 0x198a0fd7, 0x0f000001, 0x00011385,
+0x1570c500, 0x2e78c5c9, 0x0c8a0fce, 0x0f000001,
+0x00010685, 0xc6f0c500, 0xf8c5ffc9, 0x8a0fce2e,
+0x000000f7, 0x00f1850f, 0x41c40000, 0xc5c9ef31,
+0xc5cdfb31, 0xc5ed76d1, 0xc4dd2878, 0x0c9321a2,
+0x1003088d, 0x107ac500, 0x0001730d, 0x5ac1c400,
+0xf8c5e15c, 0x8a0fcc2e, 0x000000c6, 0x00c0850f,
+0xc1c40000, 0xc5d15c6a, 0x55e1c6f0, 0xe22ef8c5,
+0x00ac8a0f, 0x850f0000, 0x000000a6, 0xd115f0c5,
+0xd62ef8c5, 0x009f8a0f, 0x850f0000, 0x00000099,
+0xc9c6f0c5, 0x2ef8c5ff, 0x8a8a0fce, 0x0f000000,
+0x00008485, 0x73e1c500, 0xe2c401f3, 0x5d0c9351,
+0x00100300, 0x2e78c1c4, 0x75757ac8, 0xc6f0c573,
+0xf8c555d1, 0x687ad72e, 0xf0c56675, 0xf8c5d915,
+0x637ade2e, 0xf0c56175, 0xc5ffc9c6, 0x7ace2ef8,
+0x0000b856, 0x54740000, 0xe7b84deb, 0xeb000000,
+0x00eab84b, 0x44eb0000, 0x0000efb8, 0xb83deb00,
+0x000000f2, 0xf7b836eb, 0xeb000000, 0x00fab82f,
+0x28eb0000, 0x0000ffb8, 0xb821eb00, 0x00000102,
+0x0bb81aeb, 0xeb000001, 0x010eb813, 0x0ceb0000,
+0x000115b8, 0xb805eb00, 0x00000118, 0x0000c35d,
+0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+0x40a00000, 0x40c00000, 0x40e00000, 0x41000000,
+0x41100000, 0x41200000, 0x41300000, 0x41400000,
+0x41500000, 0x41600000, 0x41700000, 0x41800000,
+0x41880000, 0x41900000, 0x41980000, 0x41a00000,
+0x41a80000, 0x41b00000, 0x41b80000, 0x41c00000,
+0x41c80000, 0x41d00000, 0x41d80000, 0x41e00000,
+0x41e80000, 0x41f00000, 0x41f80000, 0x42000000,
+0x3f800000, 0x40000000, 0x40400000, 0x40a00000,
+0001620,
+};
+asm(".type avx2_sg_x86_64_D_16x8f4, STT_NOTYPE;");
+asm(".type avx2_sg_x86_64_D_16x8f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_64_D_16x8f8[] = {
+0x485500eb, 0xc748e589, 0x0001e045, 0xc7480000,
+0x0002f045, 0xc7480000, 0x0002e845, 0xc7480000,
+0x0001f845, 0xe9c50000, 0xe1c5d276, 0xf9c5dbef,
+0xe2c4f228, 0x1d0c93c9, 0x00100200, 0x1d10fbc5,
+0x000002bc, 0xcb2ef9c5, 0x01818a0f, 0x850f0000,
+0x0000017b, 0xc915f1c5, 0xcb2ef9c5, 0x016d8a0f,
+0x850f0000, 0x00000167, 0x656ff9c5, 0x28f9c5e0,
+0xc9e2c4f2, 0x00e50c93, 0xc5001002, 0x850d2ef9,
+0x0f000002, 0x00014d8a, 0x47850f00, 0xc5000001,
+0x791d10fb, 0xc5000002, 0xc5c915f1, 0x0fcb2ef9,
+0x0001318a, 0x2b850f00, 0xc5000001, 0x03f473d1,
+0xf228f9c5, 0x93c9e2c4, 0x02006d0c, 0xf9c50010,
+0x8a0fcb2e, 0x00000115, 0x010f850f, 0xf1c50000,
+0xf9c5c915, 0x023e0d2e, 0x8a0f0000, 0x000000fd,
+0x00f7850f, 0x8b480000, 0xf9c5f045, 0xc5f04d6f,
+0xc4ea28f9, 0x1c93d1e2, 0x100200cd, 0xc0ff4800,
+0x2acbe1c4, 0x2ef9c5f0, 0xd58a0ff3, 0x0f000000,
+0x0000cf85, 0x458b4800, 0x15e1c5f8, 0xc0ff48fb,
+0x2ad3e1c4, 0x2ef9c5e8, 0xb58a0fef, 0x0f000000,
+0x0000af85, 0xefc1c500, 0x2879c5ff, 0x0107b8ca,
+0xc1c50000, 0x62c4fcfb, 0xfd0493b1, 0x00100210,
+0x3d12fbc5, 0x000001c8, 0xdf58e1c5, 0xff76c1c5,
+0xc261c1c4, 0xe2c400d8, 0x0fdf1779, 0x00008683,
+0x73e1c500, 0xf9c501f1, 0xe2c4fa28, 0x9d1493c1,
+0x00100200, 0xf22ef9c5, 0x5f75617a, 0xda15e9c5,
+0xeb2ef9c5, 0x5375557a, 0xdbefe1c5, 0xc9dbd9c5,
+0x2971e2c4, 0x71e2c4cb, 0xe2c4fb29, 0xe51493c1,
+0x00100200, 0xf22ef9c5, 0x3675387a, 0xd215e9c5,
+0xea2ef9c5, 0x00b82c7a, 0x74000000, 0xb823eb2a,
+0x000000e7, 0xefb821eb, 0xeb000000, 0x00f7b81a,
+0x13eb0000, 0x0000ffb8, 0xb80ceb00, 0x00000115,
+0x1eb805eb, 0x5d000001, 0x000000c3, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40100000,
+0x00000000, 0x40140000, 0x00000000, 0x40180000,
+0x00000000, 0x401c0000, 0x00000000, 0x40200000,
+0x00000000, 0x40220000, 0x00000000, 0x40240000,
+0x00000000, 0x40260000, 0x00000000, 0x40280000,
+0x00000000, 0x402a0000, 0x00000000, 0x402c0000,
+0x00000000, 0x402e0000, 0x00000000, 0x40300000,
+0x00000000, 0x40310000, 0x00000000, 0x40320000,
+0x00000000, 0x40330000, 0x00000000, 0x40340000,
+0x00000000, 0x40350000, 0x00000000, 0x40360000,
+0x00000000, 0x40370000, 0x00000000, 0x40380000,
+0x00000000, 0x40390000, 0x00000000, 0x403a0000,
+0x00000000, 0x403b0000, 0x00000000, 0x403c0000,
+0x00000000, 0x403d0000, 0x00000000, 0x403e0000,
+0x00000000, 0x403f0000, 0x00000000, 0x40400000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40140000,
+0x00000000, 0xbff00000,
+0001450,
+};
+asm(".type avx2_sg_x86_64_D_16x8f8, STT_NOTYPE;");
+asm(".type avx2_sg_x86_64_D_16x8f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_64_D_32x4i4[] = {
+0xb85500eb, 0x00000001, 0x000009b9, 0xe5894800,
+0xe0e48348, 0x28ec8348, 0x4489ca89, 0xc229e484,
+0x04845489, 0x48c0ff48, 0x7509f883, 0x76edc5eb,
+0xefe1c5d2, 0x448d48db, 0xfdc5a824, 0x8d48fa6f,
+0x48c8244c, 0x8948c289, 0x45e2c4c6, 0x001d0c90,
+0xc5001002, 0x244c7ffd, 0x013a83a8, 0x016e850f,
+0x83480000, 0x394804c2, 0xc5ee75ca, 0x24646ffd,
+0x6ffdc5e8, 0xc4d231f2, 0x0c904de2, 0x100200a5,
+0x7ffdc500, 0x8da8244c, 0x3c39027a, 0x44850f90,
+0x48000001, 0x8348c2ff, 0xeb7508fa, 0xf472e5c5,
+0x6ffdc502, 0x0003bafa, 0xe2c40000, 0x5d0c9045,
+0x00100200, 0x4c7ffdc5, 0x1039a824, 0x011c850f,
+0xc2830000, 0xc0834802, 0x13fa8304, 0xfdc5ec75,
+0x08244c6f, 0xf26ffdc5, 0xe2c4c031, 0x8d1c904d,
+0x00100200, 0x5c7ffdc5, 0x7c8ba824, 0x7c890804,
+0x578da424, 0x06143901, 0x00e7850f, 0x83480000,
+0x834804c0, 0xe27520f8, 0xedefd1c5, 0x000001b8,
+0x6ffdc500, 0xfad5c5fa, 0x45e2c4ec, 0x20ad3490,
+0xc5001002, 0xb8e86ef9, 0x00000107, 0x587de2c4,
+0xfae5c5ed, 0x76d5c5dd, 0x76e5c5ed, 0x7de2c4de,
+0x830fdd17, 0x000000b0, 0xf172d5c5, 0xc4c03101,
+0x1c906de2, 0x1002006d, 0x7ffdc500, 0x8ba8245c,
+0x8908047c, 0x8da4247c, 0x14390157, 0x487d7506,
+0x4804c083, 0x7520f883, 0xefe9c5e6, 0xdbddc5d2,
+0x0001b8c9, 0x09be0000, 0xc5000000, 0xc5ca76f5,
+0xc4ca76f5, 0x1c9075e2, 0x100200a5, 0x7ffdc500,
+0x89c8245c, 0x817c8bf2, 0x85c229fc, 0x8b0674c2,
+0xebe48454, 0x84548b04, 0x24548904, 0x48c2ffa4,
+0xd739c0ff, 0x83482d75, 0xd77509f8, 0x28ebc031,
+0x0000e7b8, 0xb821eb00, 0x000000ef, 0xf7b81aeb,
+0xeb000000, 0x00ffb813, 0x0ceb0000, 0x000115b8,
+0xb805eb00, 0x0000011e, 0x0000c3c9, 0x00000000,
+0x00000001, 0x00000002, 0x00000003, 0x00000004,
+0x00000005, 0x00000006, 0x00000007, 0x00000008,
+0x00000009, 0x0000000a, 0x0000000b, 0x0000000c,
+0x0000000d, 0x0000000e, 0x0000000f, 0x00000010,
+0x00000011, 0x00000012, 0x00000013, 0x00000014,
+0x00000015, 0x00000016, 0x00000017, 0x00000018,
+0x00000019, 0x0000001a, 0x0000001b, 0x0000001c,
+0x0000001d, 0x0000001e, 0x0000001f, 0x00000020,
+0x00000021, 0x00000022, 0x00000023, 0x00000024,
+0x00000025, 0x00000026, 0x00000027, 0x00000028,
+0x00000029, 0x0000002a, 0x0000002b, 0x0000002c,
+0x0000002d, 0x0000002e, 0x0000002f, 0x00000030,
+0x00000031, 0x00000032, 0x00000033, 0x00000034,
+0x00000035, 0x00000036, 0x00000037, 0x00000038,
+0x00000039, 0x0000003a, 0x0000003b, 0x0000003c,
+0x0000003d, 0x0000003e, 0x0000003f, 0x00000040,
+0001400,
+};
+asm(".type avx2_sg_x86_64_D_32x4i4, STT_NOTYPE;");
+asm(".type avx2_sg_x86_64_D_32x4i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_64_D_32x4i8[] = {
+0xb84800eb, 0x00000001, 0x00000002, 0xe5894855,
+0xe0e48348, 0x24448948, 0x03b848c0, 0x04000000,
+0x48000000, 0xc8244489, 0x000001b8, 0xe0c148c0,
+0x44894802, 0x01b8d024, 0x48800000, 0x8948c001,
+0xc5d82444, 0xc5c976f5, 0x48dbefe1, 0xe024448d,
+0xc5e28948, 0x48f16ffd, 0xe2c4c189, 0x1d1490cd,
+0x00100200, 0x547ffdc5, 0x8348e024, 0x850f0138,
+0x00000171, 0x08c08348, 0x75c23948, 0x6ff9c5ed,
+0xc5c0246c, 0xb8f96ffd, 0x000000ef, 0x90c5e2c4,
+0x0200ed14, 0xe1c40010, 0x48d27ef9, 0x0f02fa83,
+0x00015385, 0xf9e3c400, 0x4801d216, 0x0f03fa83,
+0x00014385, 0x7de3c400, 0xc401d239, 0xd27ef9e1,
+0x04fa8348, 0x012e850f, 0xe3c40000, 0x01d216f9,
+0x05fa8348, 0x011e850f, 0xe1c50000, 0xc503f572,
+0xb8f16ffd, 0x000000f7, 0x90cde2c4, 0x02005d14,
+0xe1c40010, 0x48d27ef9, 0x0f03fa83, 0x0000f785,
+0xf9e3c400, 0x4801d216, 0x0f05fa83, 0x0000e785,
+0x7de3c400, 0xc401d239, 0xd27ef9e1, 0x07fa8348,
+0x00d2850f, 0xe3c40000, 0x01d216f9, 0x09fa8348,
+0x00c2850f, 0xf9c50000, 0xd0245c6f, 0xf96ffdc5,
+0xe2c4c031, 0xdd1490c5, 0x00100200, 0x547ffdc5,
+0x748be024, 0x568dd084, 0x24748901, 0xd26348bc,
+0xc1143948, 0x0082850f, 0xff480000, 0xf88348c0,
+0xb8df7504, 0x00000001, 0xe4efd9c5, 0xf16ffdc5,
+0xe5fad9c5, 0x6ef9e1c4, 0x0107b8f8, 0xe2c40000,
+0xe52c90cd, 0x00100220, 0x597de2c4, 0xfbedc5e7,
+0x6de2c4d4, 0xe2c4d529, 0x73d1177d, 0x72e1c54b,
+0xc03101f3, 0x90f5e2c4, 0x02009d14, 0xfdc50010,
+0xe024547f, 0xd084748b, 0x8901568d, 0x48bc2474,
+0x3948d263, 0x1b75c114, 0x48c0ff48, 0x7504f883,
+0xebc031e3, 0x00e7b813, 0x0ceb0000, 0x0000ffb8,
+0xb805eb00, 0x00000115, 0x0000c3c9, 0x00000000,
+0x00000001, 0x00000000, 0x00000002, 0x00000000,
+0x00000003, 0x00000000, 0x00000004, 0x00000000,
+0x00000005, 0x00000000, 0x00000006, 0x00000000,
+0x00000007, 0x00000000, 0x00000008, 0x00000000,
+0x00000009, 0x00000000, 0x0000000a, 0x00000000,
+0x0000000b, 0x00000000, 0x0000000c, 0x00000000,
+0x0000000d, 0x00000000, 0x0000000e, 0x00000000,
+0x0000000f, 0x00000000, 0x00000010, 0x00000000,
+0x00000011, 0x00000000, 0x00000012, 0x00000000,
+0x00000013, 0x00000000, 0x00000014, 0x00000000,
+0x00000015, 0x00000000, 0x00000016, 0x00000000,
+0x00000017, 0x00000000, 0x00000018, 0x00000000,
+0x00000019, 0x00000000, 0x0000001a, 0x00000000,
+0x0000001b, 0x00000000, 0x0000001c, 0x00000000,
+0x0000001d, 0x00000000, 0x0000001e, 0x00000000,
+0x0000001f, 0x00000000, 0x00000020, 0x00000000,
+0x00000021, 0x00000000, 0x00000022, 0x00000000,
+0x00000023, 0x00000000, 0x00000024, 0x00000000,
+0x00000025, 0x00000000, 0x00000026, 0x00000000,
+0x00000027, 0x00000000, 0x00000028, 0x00000000,
+0x00000029, 0x00000000, 0x0000002a, 0x00000000,
+0x0000002b, 0x00000000, 0x0000002c, 0x00000000,
+0x0000002d, 0x00000000, 0x0000002e, 0x00000000,
+0x0000002f, 0x00000000, 0x00000030, 0x00000000,
+0x00000031, 0x00000000, 0x00000032, 0x00000000,
+0x00000033, 0x00000000, 0x00000034, 0x00000000,
+0x00000035, 0x00000000, 0x00000036, 0x00000000,
+0x00000037, 0x00000000, 0x00000038, 0x00000000,
+0x00000039, 0x00000000, 0x0000003a, 0x00000000,
+0x0000003b, 0x00000000, 0x0000003c, 0x00000000,
+0x0000003d, 0x00000000, 0x0000003e, 0x00000000,
+0x0000003f, 0x00000000, 0x00000040, 0x00000000,
+0002000,
+};
+asm(".type avx2_sg_x86_64_D_32x4i8, STT_NOTYPE;");
+asm(".type avx2_sg_x86_64_D_32x4i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_64_D_32x4f4[] = {
+0xb85500eb, 0x00000001, 0x000009b9, 0xe5894800,
+0xe0e48348, 0x28ec8348, 0x4489ca89, 0xc229e484,
+0x04845489, 0x48c0ff48, 0x7509f883, 0x76edc5eb,
+0xefe1c5d2, 0x448d48db, 0xfcc5a824, 0x8d48fa28,
+0x48c8244c, 0x8948c289, 0x45e2c4c6, 0x601d0c92,
+0xc5001002, 0x244c29fc, 0x10fac5a8, 0x0002ff0d,
+0x2ef8c500, 0xb38a0f0a, 0x0f000001, 0x0001ad85,
+0xc2834800, 0xca394804, 0xfdc5e775, 0xe824646f,
+0xf228fcc5, 0xe2c4d231, 0xa50c924d, 0x00100260,
+0x4c29fcc5, 0x7a8da824, 0x2af2c502, 0x2ef8c5cf,
+0x8a0f900c, 0x0000017d, 0x0177850f, 0xff480000,
+0xfa8348c2, 0xc5df7508, 0x02f472e5, 0xfa28fcc5,
+0x000003ba, 0x45e2c400, 0x605d0c92, 0xc5001002,
+0x244c29fc, 0x2af2c5a8, 0x2ef8c5ca, 0x498a0f08,
+0x0f000001, 0x00014385, 0x02c28300, 0x04c08348,
+0x7513fa83, 0x6ffdc5e0, 0xc508244c, 0x31f228fc,
+0x4de2c4c0, 0x608d1c92, 0xc5001002, 0x245c29fc,
+0x047c8ba8, 0x01578d08, 0xa4247c89, 0xea2ad2c5,
+0x2c2ef8c5, 0x088a0f06, 0x0f000001, 0x00010285,
+0xc0834800, 0xf8834804, 0xc5d67520, 0xc5edefd1,
+0xb8fa28fc, 0x00000107, 0xecfad5c5, 0x9245e2c4,
+0x0280ad34, 0xe2c40010, 0x052d187d, 0xc5000002,
+0xc5dd58e4, 0xc5ed76d5, 0x00dec2e4, 0x177de2c4,
+0xcf830fdd, 0xc5000000, 0x01f172d5, 0xe2c4c031,
+0x6d1c926d, 0x00100260, 0x5c29fcc5, 0x7c8ba824,
+0x578d0804, 0x247c8901, 0x2aeac5a4, 0x2ef8c5d2,
+0x8a0f0614, 0x00000092, 0x008c850f, 0x83480000,
+0x834804c0, 0xd67520f8, 0xd2efe9c5, 0xc9dbddc5,
+0x000001b8, 0x0009be00, 0xf5c50000, 0xf5c5ca76,
+0xfcc5f276, 0xe2c4fe28, 0xa51c9245, 0x00100260,
+0x5c29fcc5, 0xf289c824, 0x5410fac5, 0xc229fc81,
+0x0674c285, 0xe4847c8b, 0x7c8b04eb, 0x578d0484,
+0xc0ff4801, 0xa4247c89, 0xca2af2c5, 0xd12ef8c5,
+0x2d752f7a, 0x09f88348, 0xc031cc75, 0xe7b828eb,
+0xeb000000, 0x00efb821, 0x1aeb0000, 0x0000f7b8,
+0xb813eb00, 0x000000ff, 0x15b80ceb, 0xeb000001,
+0x011eb805, 0xc3c90000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+0x40a00000, 0x40c00000, 0x40e00000, 0x41000000,
+0x41100000, 0x41200000, 0x41300000, 0x41400000,
+0x41500000, 0x41600000, 0x41700000, 0x41800000,
+0x41880000, 0x41900000, 0x41980000, 0x41a00000,
+0x41a80000, 0x41b00000, 0x41b80000, 0x41c00000,
+0x41c80000, 0x41d00000, 0x41d80000, 0x41e00000,
+0x41e80000, 0x41f00000, 0x41f80000, 0x42000000,
+0x42040000, 0x42080000, 0x420c0000, 0x42100000,
+0x42140000, 0x42180000, 0x421c0000, 0x42200000,
+0x42240000, 0x42280000, 0x422c0000, 0x42300000,
+0x42340000, 0x42380000, 0x423c0000, 0x42400000,
+0x42440000, 0x42480000, 0x424c0000, 0x42500000,
+0x42540000, 0x42580000, 0x425c0000, 0x42600000,
+0x42640000, 0x42680000, 0x426c0000, 0x42700000,
+0x42740000, 0x42780000, 0x427c0000, 0x42800000,
+0x3f800000, 0xbf800000,
+0001550,
+};
+asm(".type avx2_sg_x86_64_D_32x4f4, STT_NOTYPE;");
+asm(".type avx2_sg_x86_64_D_32x4f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_64_D_32x4f8[] = {
+0xb84800eb, 0x00000001, 0x00000002, 0xe5894855,
+0xe0e48348, 0x24448948, 0x03b848c0, 0x04000000,
+0x48000000, 0xc8244489, 0x000001b8, 0xe0c148c0,
+0x44894802, 0x01b8d024, 0x48800000, 0x8948c001,
+0xc5d82444, 0xc5c976f5, 0x48dbefe1, 0xe024448d,
+0xc5e28948, 0x48f928fd, 0xe2c4c189, 0x1d1492c5,
+0x00100260, 0x5429fdc5, 0xfbc5e024, 0x03ee1510,
+0xf9c50000, 0x8a0f102e, 0x000001ab, 0x01a5850f,
+0x83480000, 0x394808c0, 0xc5e775c2, 0x246c6ff9,
+0x28fdc5c0, 0xcde2c4f1, 0x60ed1492, 0xc5001002,
+0xc1152ef9, 0x0f000003, 0x0001818a, 0x7b850f00,
+0xc5000001, 0xb53510fb, 0xc5000003, 0xc5da15e9,
+0x0fde2ef9, 0x0001658a, 0x5f850f00, 0xc4000001,
+0xd2197de3, 0x2ef9c501, 0x00039b15, 0x4b8a0f00,
+0x0f000001, 0x00014585, 0x10fbc500, 0x00038f25,
+0x15e9c500, 0x2ef9c5d2, 0x2f8a0fd4, 0x0f000001,
+0x00012985, 0x72e1c500, 0xfdc503f5, 0xe2c4f928,
+0x5d1492c5, 0x00100260, 0xd62ef9c5, 0x01138a0f,
+0x850f0000, 0x0000010d, 0xda15e9c5, 0xdc2ef9c5,
+0x00ff8a0f, 0x850f0000, 0x000000f9, 0x197de3c4,
+0xf9c501d2, 0x033e152e, 0x8a0f0000, 0x000000e5,
+0x00df850f, 0xe9c50000, 0xf9c5d215, 0x032e152e,
+0x8a0f0000, 0x000000cd, 0x00c7850f, 0xf9c50000,
+0xd0245c6f, 0xf128fdc5, 0xe2c4c031, 0xdd1492cd,
+0x00100260, 0x5429fdc5, 0x748be024, 0x568dd084,
+0x24748901, 0x2adbc5bc, 0x2ef9c5e2, 0x8a0fc124,
+0x00000098, 0x0092850f, 0xff480000, 0xf88348c0,
+0xc5d77504, 0xc5e4efd9, 0xb8f928fd, 0x00000107,
+0xe5fad9c5, 0x92c5e2c4, 0x0280e52c, 0xe2c40010,
+0xc125197d, 0xc5000002, 0xc5d458ed, 0xc5e476dd,
+0x00d5c2ed, 0x177de2c4, 0xc55d73d4, 0x01f372e1,
+0xe2c4c031, 0x9d1492f5, 0x00100260, 0x5429fdc5,
+0x748be024, 0x568dd084, 0x24748901, 0x2af3c5bc,
+0x2ef9c5ca, 0x2b7ac10c, 0xff482975, 0xf88348c0,
+0x31df7504, 0xb821ebc0, 0x000000e7, 0xefb81aeb,
+0xeb000000, 0x00f7b813, 0x0ceb0000, 0x0000ffb8,
+0xb805eb00, 0x00000115, 0x0000c3c9, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40100000,
+0x00000000, 0x40140000, 0x00000000, 0x40180000,
+0x00000000, 0x401c0000, 0x00000000, 0x40200000,
+0x00000000, 0x40220000, 0x00000000, 0x40240000,
+0x00000000, 0x40260000, 0x00000000, 0x40280000,
+0x00000000, 0x402a0000, 0x00000000, 0x402c0000,
+0x00000000, 0x402e0000, 0x00000000, 0x40300000,
+0x00000000, 0x40310000, 0x00000000, 0x40320000,
+0x00000000, 0x40330000, 0x00000000, 0x40340000,
+0x00000000, 0x40350000, 0x00000000, 0x40360000,
+0x00000000, 0x40370000, 0x00000000, 0x40380000,
+0x00000000, 0x40390000, 0x00000000, 0x403a0000,
+0x00000000, 0x403b0000, 0x00000000, 0x403c0000,
+0x00000000, 0x403d0000, 0x00000000, 0x403e0000,
+0x00000000, 0x403f0000, 0x00000000, 0x40400000,
+0x00000000, 0x40408000, 0x00000000, 0x40410000,
+0x00000000, 0x40418000, 0x00000000, 0x40420000,
+0x00000000, 0x40428000, 0x00000000, 0x40430000,
+0x00000000, 0x40438000, 0x00000000, 0x40440000,
+0x00000000, 0x40448000, 0x00000000, 0x40450000,
+0x00000000, 0x40458000, 0x00000000, 0x40460000,
+0x00000000, 0x40468000, 0x00000000, 0x40470000,
+0x00000000, 0x40478000, 0x00000000, 0x40480000,
+0x00000000, 0x40488000, 0x00000000, 0x40490000,
+0x00000000, 0x40498000, 0x00000000, 0x404a0000,
+0x00000000, 0x404a8000, 0x00000000, 0x404b0000,
+0x00000000, 0x404b8000, 0x00000000, 0x404c0000,
+0x00000000, 0x404c8000, 0x00000000, 0x404d0000,
+0x00000000, 0x404d8000, 0x00000000, 0x404e0000,
+0x00000000, 0x404e8000, 0x00000000, 0x404f0000,
+0x00000000, 0x404f8000, 0x00000000, 0x40500000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40100000,
+0x00000000, 0x40140000, 0x00000000, 0x401c0000,
+0x00000000, 0x40220000, 0x00000000, 0xbff00000,
+0002240,
+};
+asm(".type avx2_sg_x86_64_D_32x4f8, STT_NOTYPE;");
+asm(".type avx2_sg_x86_64_D_32x4f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_64_D_32x8i4[] = {
+0x485500eb, 0x8348e589, 0xc748e0e4, 0x01c02444,
+0x48000000, 0xe02444c7, 0x00000004, 0x2444c748,
+0x000002c8, 0x44c74800, 0x0003e824, 0xc7480000,
+0x03d02444, 0x48000000, 0xf02444c7, 0x00000002,
+0x2444c748, 0x000004d8, 0x44c74800, 0x0001f824,
+0xf1c50000, 0xe1c5c976, 0x8d48dbef, 0xc5b02444,
+0x48f16ff9, 0xc024548d, 0xc4c18948, 0x14914de2,
+0x1002001d, 0x7ff9c500, 0x83b02454, 0x850f0138,
+0x0000015f, 0x04c08348, 0x75d03948, 0x6ffdc5ee,
+0xc5c0246c, 0xb8f96ff9, 0x000000ef, 0x9145e2c4,
+0x0200ad14, 0xf9c50010, 0xfa83d27e, 0x43850f02,
+0xc4000001, 0xd21679e3, 0x03fa8301, 0x0134850f,
+0xe3c40000, 0x02d21679, 0x0f04fa83, 0x00012585,
+0x79e3c400, 0x8303d216, 0x850f05fa, 0x00000116,
+0xf573e5c5, 0x6ff9c502, 0x00f7b8f1, 0xe2c40000,
+0x5d14914d, 0x00100200, 0xd27ef9c5, 0x0f03fa83,
+0x0000f185, 0x79e3c400, 0x8301d216, 0x850f05fa,
+0x000000e2, 0x1679e3c4, 0xfa8302d2, 0xd3850f07,
+0xc4000000, 0xd21679e3, 0x09fa8303, 0x00c4850f,
+0xfdc50000, 0xe0245c6f, 0xf96ff9c5, 0xe2c4c031,
+0x9d149145, 0x00100200, 0x547ff9c5, 0x8b48b024,
+0x48e0c47c, 0x48813463, 0x4801578d, 0xa8247c89,
+0x0fd63948, 0x00008185, 0xc0ff4800, 0x04f88348,
+0xd9c5dc75, 0xf9c5e4ef, 0x07b8f16f, 0xc5000001,
+0xc5e5fbdd, 0x7515fae9, 0xc4000001, 0x2c914de2,
+0x100210a5, 0x76d9c500, 0x76e9c5e4, 0x79e2c4d5,
+0x5273d417, 0xf373e5c5, 0x6ff9c501, 0xc4c031e1,
+0x14915de2, 0x1002005d, 0x7ff9c500, 0x48b02454,
+0xe0c47c8b, 0x81346348, 0x01578d48, 0x247c8948,
+0xd63948a8, 0xff481b75, 0xf88348c0, 0x31e07504,
+0xb813ebc0, 0x000000e7, 0xffb80ceb, 0xeb000000,
+0x0115b805, 0xc3c90000, 0x00000000, 0x00000000,
+0x00000001, 0x00000002, 0x00000003, 0x00000004,
+0x00000005, 0x00000006, 0x00000007, 0x00000008,
+0x00000009, 0x0000000a, 0x0000000b, 0x0000000c,
+0x0000000d, 0x0000000e, 0x0000000f, 0x00000010,
+0x00000011, 0x00000012, 0x00000013, 0x00000014,
+0x00000015, 0x00000016, 0x00000017, 0x00000018,
+0x00000019, 0x0000001a, 0x0000001b, 0x0000001c,
+0x0000001d, 0x0000001e, 0x0000001f, 0x00000020,
+0x00000021, 0x00000022, 0x00000023, 0x00000024,
+0x00000025, 0x00000026, 0x00000027, 0x00000028,
+0x00000029, 0x0000002a, 0x0000002b, 0x0000002c,
+0x0000002d, 0x0000002e, 0x0000002f, 0x00000030,
+0x00000031, 0x00000032, 0x00000033, 0x00000034,
+0x00000035, 0x00000036, 0x00000037, 0x00000038,
+0x00000039, 0x0000003a, 0x0000003b, 0x0000003c,
+0x0000003d, 0x0000003e, 0x0000003f, 0x00000040,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0001420,
+};
+asm(".type avx2_sg_x86_64_D_32x8i4, STT_NOTYPE;");
+asm(".type avx2_sg_x86_64_D_32x8i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_64_D_32x8i8[] = {
+0x485500eb, 0x8348e589, 0x8348e0e4, 0xc74828ec,
+0x00042404, 0xc7480000, 0x01e82444, 0x48000000,
+0x082444c7, 0x00000004, 0x2444c748, 0x000002f0,
+0x44c74800, 0x00031024, 0xc7480000, 0x03f82444,
+0x48000000, 0x182444c7, 0x00000002, 0x2444c748,
+0x00000120, 0x76edc500, 0xefe1c5d2, 0x448d48db,
+0xfdc5a824, 0x8d48fa6f, 0x48c8244c, 0xe2c4c689,
+0x1d0c91c5, 0x00100280, 0x4c7ffdc5, 0x8348a824,
+0x850f0138, 0x000001d1, 0x08c08348, 0x75c83948,
+0x6ffdc5ed, 0xc5e82464, 0xb8f26ffd, 0x000000ef,
+0x91cde2c4, 0x0280e50c, 0xe1c40010, 0x48ca7ef9,
+0x0f02fa83, 0x0001ba85, 0xf9e3c400, 0x4801ca16,
+0x0f03fa83, 0x0001aa85, 0x7de3c400, 0xc401c939,
+0xca7ef9e1, 0x04fa8348, 0x0195850f, 0xe3c40000,
+0x01ca16f9, 0x05fa8348, 0x0185850f, 0xe5c50000,
+0xc503f473, 0xb8fa6ffd, 0x000000f7, 0x91c5e2c4,
+0x02805d0c, 0xe1c40010, 0x48ca7ef9, 0x0f03fa83,
+0x00015e85, 0xf9e3c400, 0x4801ca16, 0x0f05fa83,
+0x00014e85, 0x7de3c400, 0xc401c939, 0xca7ef9e1,
+0x07fa8348, 0x0139850f, 0xe3c40000, 0x01ca16f9,
+0x09fa8348, 0x0129850f, 0xfdc50000, 0x08244c6f,
+0xf26ffdc5, 0xe2c4c031, 0xcd1c91cd, 0x00100280,
+0x5c7ffdc5, 0x8b48a824, 0x4808047c, 0xa0247c89,
+0x01578d48, 0x06143948, 0x00e2850f, 0x83480000,
+0x834808c0, 0xde7520f8, 0xedefd1c5, 0xfa6ffdc5,
+0x000001b8, 0xfbd5c500, 0xc5e2c4ec, 0xa0ed3491,
+0xc4001002, 0xf86ef9e1, 0x000107b8, 0x7de2c400,
+0xe5c5ef59, 0xe2c4ddfb, 0xc4de2965, 0xda177de2,
+0x00ad830f, 0xd5c50000, 0x3101f173, 0xede2c4c0,
+0x80ad1c91, 0xc5001002, 0x245c7ffd, 0x7c8b48a8,
+0x89480804, 0x48a0247c, 0x4801578d, 0x75061439,
+0xc0834876, 0xf8834808, 0xc5e27520, 0xc5d2efe9,
+0xb8c9dbdd, 0x00000001, 0x000005be, 0x75e2c400,
+0xe2c4ca29, 0xc4ca2975, 0x1c91f5e2, 0x100280e5,
+0x7ffdc500, 0x89c8245c, 0x7c8b48f2, 0xc229f8c1,
+0x0774c285, 0xc4548b48, 0x4809ebe0, 0x48c4148b,
+0xa0245489, 0x48c2ff48, 0x3948c0ff, 0x481f75d7,
+0x7505f883, 0xebc031d2, 0x00e7b81a, 0x13eb0000,
+0x0000ffb8, 0xb80ceb00, 0x00000115, 0x1eb805eb,
+0xc9000001, 0x000000c3, 0x00000000, 0x00000000,
+0x00000001, 0x00000000, 0x00000002, 0x00000000,
+0x00000003, 0x00000000, 0x00000004, 0x00000000,
+0x00000005, 0x00000000, 0x00000006, 0x00000000,
+0x00000007, 0x00000000, 0x00000008, 0x00000000,
+0x00000009, 0x00000000, 0x0000000a, 0x00000000,
+0x0000000b, 0x00000000, 0x0000000c, 0x00000000,
+0x0000000d, 0x00000000, 0x0000000e, 0x00000000,
+0x0000000f, 0x00000000, 0x00000010, 0x00000000,
+0x00000011, 0x00000000, 0x00000012, 0x00000000,
+0x00000013, 0x00000000, 0x00000014, 0x00000000,
+0x00000015, 0x00000000, 0x00000016, 0x00000000,
+0x00000017, 0x00000000, 0x00000018, 0x00000000,
+0x00000019, 0x00000000, 0x0000001a, 0x00000000,
+0x0000001b, 0x00000000, 0x0000001c, 0x00000000,
+0x0000001d, 0x00000000, 0x0000001e, 0x00000000,
+0x0000001f, 0x00000000, 0x00000020, 0x00000000,
+0x00000021, 0x00000000, 0x00000022, 0x00000000,
+0x00000023, 0x00000000, 0x00000024, 0x00000000,
+0x00000025, 0x00000000, 0x00000026, 0x00000000,
+0x00000027, 0x00000000, 0x00000028, 0x00000000,
+0x00000029, 0x00000000, 0x0000002a, 0x00000000,
+0x0000002b, 0x00000000, 0x0000002c, 0x00000000,
+0x0000002d, 0x00000000, 0x0000002e, 0x00000000,
+0x0000002f, 0x00000000, 0x00000030, 0x00000000,
+0x00000031, 0x00000000, 0x00000032, 0x00000000,
+0x00000033, 0x00000000, 0x00000034, 0x00000000,
+0x00000035, 0x00000000, 0x00000036, 0x00000000,
+0x00000037, 0x00000000, 0x00000038, 0x00000000,
+0x00000039, 0x00000000, 0x0000003a, 0x00000000,
+0x0000003b, 0x00000000, 0x0000003c, 0x00000000,
+0x0000003d, 0x00000000, 0x0000003e, 0x00000000,
+0x0000003f, 0x00000000, 0x00000040, 0x00000000,
+0002200,
+};
+asm(".type avx2_sg_x86_64_D_32x8i8, STT_NOTYPE;");
+asm(".type avx2_sg_x86_64_D_32x8i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_64_D_32x8f4[] = {
+0x485500eb, 0x8348e589, 0xc748e0e4, 0x01c02444,
+0x48000000, 0xe02444c7, 0x00000004, 0x2444c748,
+0x000002c8, 0x44c74800, 0x0003e824, 0xc7480000,
+0x03d02444, 0x48000000, 0xf02444c7, 0x00000002,
+0x2444c748, 0x000004d8, 0x44c74800, 0x0001f824,
+0xf1c50000, 0xe1c5c976, 0x8d48dbef, 0xc5b02444,
+0x48f128f8, 0xc024548d, 0xc4c18948, 0x14934de2,
+0x1002801d, 0x29f8c500, 0xc5b02454, 0xfd1510fa,
+0xc5000002, 0x0f102ef8, 0x0001b78a, 0xb1850f00,
+0x48000001, 0x4804c083, 0xe775c239, 0x6c6ffdc5,
+0xf8c5c024, 0xe2c4f928, 0xad149345, 0x00100280,
+0x152ef8c5, 0x000002cc, 0x018d8a0f, 0x850f0000,
+0x00000187, 0xdac6e8c5, 0x2ef8c555, 0x0002b71d,
+0x748a0f00, 0x0f000001, 0x00016e85, 0x15e8c500,
+0x2ef8c5da, 0x0002a31d, 0x5c8a0f00, 0x0f000001,
+0x00015685, 0xc6e8c500, 0xf8c5ffd2, 0x028e152e,
+0x8a0f0000, 0x00000143, 0x013d850f, 0xe5c50000,
+0xc502f573, 0xc4f128f8, 0x14934de2, 0x1002805d,
+0x2ef8c500, 0x00025f15, 0x238a0f00, 0x0f000001,
+0x00011d85, 0xc6e8c500, 0xf8c555da, 0x024e1d2e,
+0x8a0f0000, 0x0000010a, 0x0104850f, 0xe8c50000,
+0xf8c5da15, 0x023a1d2e, 0x8a0f0000, 0x000000f2,
+0x00ec850f, 0xe8c50000, 0xc5ffd2c6, 0x25152ef8,
+0x0f000002, 0x0000d98a, 0xd3850f00, 0xc5000000,
+0x245c6ffd, 0x28f8c5e0, 0xc4c031f9, 0x149345e2,
+0x1002809d, 0x29f8c500, 0x48b02454, 0xe0c4748b,
+0x01568d48, 0x24748948, 0xdae1c4a8, 0xf8c5e22a,
+0x0f81242e, 0x0000a08a, 0x9a850f00, 0x48000000,
+0x8348c0ff, 0xd37504f8, 0xe4efd9c5, 0xf128f8c5,
+0x000107b8, 0xfbddc500, 0x4de2c4e5, 0x90a52c93,
+0xc4001002, 0x251879e2, 0x000001b0, 0xd458e8c5,
+0xe476d9c5, 0xd5c2e8c5, 0x79e2c400, 0x6573d417,
+0xf373e5c5, 0x28f8c501, 0xc4c031e9, 0x149355e2,
+0x1002805d, 0x29f8c500, 0x48b02454, 0xe0c4748b,
+0x01568d48, 0x24748948, 0xf2e1c4a8, 0xf8c5ca2a,
+0x7a810c2e, 0x4829752b, 0x8348c0ff, 0xdb7504f8,
+0x21ebc031, 0x0000e7b8, 0xb81aeb00, 0x000000ef,
+0xf7b813eb, 0xeb000000, 0x00ffb80c, 0x05eb0000,
+0x000115b8, 0x00c3c900, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+0x40a00000, 0x40c00000, 0x40e00000, 0x41000000,
+0x41100000, 0x41200000, 0x41300000, 0x41400000,
+0x41500000, 0x41600000, 0x41700000, 0x41800000,
+0x41880000, 0x41900000, 0x41980000, 0x41a00000,
+0x41a80000, 0x41b00000, 0x41b80000, 0x41c00000,
+0x41c80000, 0x41d00000, 0x41d80000, 0x41e00000,
+0x41e80000, 0x41f00000, 0x41f80000, 0x42000000,
+0x42040000, 0x42080000, 0x420c0000, 0x42100000,
+0x42140000, 0x42180000, 0x421c0000, 0x42200000,
+0x42240000, 0x42280000, 0x422c0000, 0x42300000,
+0x42340000, 0x42380000, 0x423c0000, 0x42400000,
+0x42440000, 0x42480000, 0x424c0000, 0x42500000,
+0x42540000, 0x42580000, 0x425c0000, 0x42600000,
+0x42640000, 0x42680000, 0x426c0000, 0x42700000,
+0x42740000, 0x42780000, 0x427c0000, 0x42800000,
+0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+0x40a00000, 0x40e00000, 0x41100000, 0xbf800000,
+0001640,
+};
+asm(".type avx2_sg_x86_64_D_32x8f4, STT_NOTYPE;");
+asm(".type avx2_sg_x86_64_D_32x8f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_64_D_32x8f8[] = {
+0x485500eb, 0x8348e589, 0x8348e0e4, 0xc74828ec,
+0x00042404, 0xc7480000, 0x01e82444, 0x48000000,
+0x082444c7, 0x00000004, 0x2444c748, 0x000002f0,
+0x44c74800, 0x00031024, 0xc7480000, 0x03f82444,
+0x48000000, 0x182444c7, 0x00000002, 0x2444c748,
+0x00000120, 0x76edc500, 0xefe1c5d2, 0x448d48db,
+0xfdc5a824, 0x8d48fa28, 0x48c8244c, 0xe2c4c689,
+0x1d0c93c5, 0x001002e0, 0x4c29fdc5, 0xfbc5a824,
+0x045a0d10, 0xf9c50000, 0x8a0f082e, 0x00000225,
+0x021f850f, 0x83480000, 0x394808c0, 0xc5e775c8,
+0x24646ffd, 0x28fdc5e8, 0xc5e2c4fa, 0xe0e50c93,
+0xc5001002, 0x2d0d2ef9, 0x0f000004, 0x0001fb8a,
+0xf5850f00, 0xc5000001, 0x213510fb, 0xc5000004,
+0xc5d915f1, 0x0fde2ef9, 0x0001df8a, 0xd9850f00,
+0xc4000001, 0xc9197de3, 0x2ef9c501, 0x0004070d,
+0xc58a0f00, 0x0f000001, 0x0001bf85, 0x10fbc500,
+0x0003fb2d, 0x15f1c500, 0x2ef9c5c9, 0xa98a0fcd,
+0x0f000001, 0x0001a385, 0x73e5c500, 0xfdc503f4,
+0xe2c4fa28, 0x5d0c93c5, 0x001002e0, 0xce2ef9c5,
+0x018d8a0f, 0x850f0000, 0x00000187, 0xd915f1c5,
+0xdd2ef9c5, 0x01798a0f, 0x850f0000, 0x00000173,
+0x197de3c4, 0xf9c501c9, 0x03aa0d2e, 0x8a0f0000,
+0x0000015f, 0x0159850f, 0xf1c50000, 0xf9c5c915,
+0x039a0d2e, 0x8a0f0000, 0x00000147, 0x0141850f,
+0xfdc50000, 0x08244c6f, 0xf228fdc5, 0xe2c4c031,
+0xcd1c93cd, 0x001002e0, 0x5c29fdc5, 0x8b48a824,
+0x4808047c, 0x4801578d, 0xa0247c89, 0x2ad3e1c4,
+0x2ef9c5ea, 0x8a0f062c, 0x0000010e, 0x0108850f,
+0x83480000, 0x834808c0, 0xd27520f8, 0xedefd1c5,
+0xfa28fdc5, 0x000107b8, 0xfbd5c500, 0xc5e2c4ec,
+0x00ed3493, 0xc4001003, 0x2d197de2, 0x00000328,
+0xdd58e5c5, 0xed76d5c5, 0xdec2e5c5, 0x7de2c400,
+0x830fdd17, 0x000000d5, 0xf173d5c5, 0xc4c03101,
+0x1c93ede2, 0x1002e0ad, 0x29fdc500, 0x48a8245c,
+0x08047c8b, 0x01578d48, 0x247c8948, 0xebe1c4a0,
+0xf9c5d22a, 0x0f06142e, 0x0000948a, 0x8e850f00,
+0x48000000, 0x4808c083, 0x7520f883, 0xefe9c5d2,
+0xdbddc5d2, 0x0001b8c9, 0x05be0000, 0xc4000000,
+0xca2975e2, 0x2975e2c4, 0xcde2c4f2, 0xe0e51c93,
+0xc5001002, 0x245c29fd, 0xc5f289c8, 0xc15410fb,
+0x85c229f8, 0x480774c2, 0xe0c47c8b, 0x8b4809eb,
+0x8948c43c, 0x48a0247c, 0x4801578d, 0xe1c4c0ff,
+0xc5ca2af3, 0x7ad12ef9, 0x482d752f, 0x7505f883,
+0xebc031c8, 0x00e7b828, 0x21eb0000, 0x0000efb8,
+0xb81aeb00, 0x000000f7, 0xffb813eb, 0xeb000000,
+0x0115b80c, 0x05eb0000, 0x00011eb8, 0x00c3c900,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40100000,
+0x00000000, 0x40140000, 0x00000000, 0x40180000,
+0x00000000, 0x401c0000, 0x00000000, 0x40200000,
+0x00000000, 0x40220000, 0x00000000, 0x40240000,
+0x00000000, 0x40260000, 0x00000000, 0x40280000,
+0x00000000, 0x402a0000, 0x00000000, 0x402c0000,
+0x00000000, 0x402e0000, 0x00000000, 0x40300000,
+0x00000000, 0x40310000, 0x00000000, 0x40320000,
+0x00000000, 0x40330000, 0x00000000, 0x40340000,
+0x00000000, 0x40350000, 0x00000000, 0x40360000,
+0x00000000, 0x40370000, 0x00000000, 0x40380000,
+0x00000000, 0x40390000, 0x00000000, 0x403a0000,
+0x00000000, 0x403b0000, 0x00000000, 0x403c0000,
+0x00000000, 0x403d0000, 0x00000000, 0x403e0000,
+0x00000000, 0x403f0000, 0x00000000, 0x40400000,
+0x00000000, 0x40408000, 0x00000000, 0x40410000,
+0x00000000, 0x40418000, 0x00000000, 0x40420000,
+0x00000000, 0x40428000, 0x00000000, 0x40430000,
+0x00000000, 0x40438000, 0x00000000, 0x40440000,
+0x00000000, 0x40448000, 0x00000000, 0x40450000,
+0x00000000, 0x40458000, 0x00000000, 0x40460000,
+0x00000000, 0x40468000, 0x00000000, 0x40470000,
+0x00000000, 0x40478000, 0x00000000, 0x40480000,
+0x00000000, 0x40488000, 0x00000000, 0x40490000,
+0x00000000, 0x40498000, 0x00000000, 0x404a0000,
+0x00000000, 0x404a8000, 0x00000000, 0x404b0000,
+0x00000000, 0x404b8000, 0x00000000, 0x404c0000,
+0x00000000, 0x404c8000, 0x00000000, 0x404d0000,
+0x00000000, 0x404d8000, 0x00000000, 0x404e0000,
+0x00000000, 0x404e8000, 0x00000000, 0x404f0000,
+0x00000000, 0x404f8000, 0x00000000, 0x40500000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40100000,
+0x00000000, 0x40140000, 0x00000000, 0x401c0000,
+0x00000000, 0x40220000, 0x00000000, 0xbff00000,
+0002440,
+};
+asm(".type avx2_sg_x86_64_D_32x8f8, STT_NOTYPE;");
+asm(".type avx2_sg_x86_64_D_32x8f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_sg_x86_64_D_high[] = {
+0xb84800eb, 0x00000001, 0x00000002, 0xe5894855,
+0xe0458948, 0x0003b848, 0x00040000, 0x89480000,
+0x01b8e845, 0x48c00000, 0x4802e0c1, 0xb8f04589,
+0x80000001, 0x48c00148, 0xc4f84589, 0xc9763141,
+0xef2941c4, 0x458d48d2, 0x7941c4c0, 0x8d48f16f,
+0x8948d04d, 0x0922c4c6, 0x40150490, 0xc5001002,
+0xc0457f79, 0x0f013883, 0x0001ac85, 0xc0834800,
+0xc8394804, 0x79c5ee75, 0xc4e05d6f, 0xf96f7941,
+0x0000efb8, 0x0122c400, 0x409d0490, 0xc5001002,
+0x83c27e79, 0x850f02fa, 0x00000197, 0x167963c4,
+0xfa8301c2, 0x88850f03, 0xc4000001, 0xc2167963,
+0x04fa8302, 0x0179850f, 0x63c40000, 0x03c21679,
+0x0f05fa83, 0x00016a85, 0x29c1c400, 0xc402f372,
+0xe96f7941, 0x0000f7b8, 0x1122c400, 0x40550490,
+0xc5001002, 0x83c27e79, 0x850f03fa, 0x00000143,
+0x167963c4, 0xfa8301c2, 0x34850f05, 0xc4000001,
+0xc2167963, 0x07fa8302, 0x0125850f, 0x63c40000,
+0x03c21679, 0x0f09fa83, 0x00011685, 0x6f79c500,
+0x41c4f045, 0x31f16f79, 0x0922c4c0, 0x40851490,
+0xc5001002, 0xc0557f79, 0xf0287c8b, 0x8dbc7d89,
+0x14390157, 0xd5850f06, 0x48000000, 0x4804c083,
+0x7510f883, 0x1941c4e3, 0x41c4e4ef, 0xb8f96f79,
+0x00000107, 0xfa1941c4, 0xfa29c5e3, 0x00014f15,
+0x0122c400, 0x50a52c90, 0xc4001002, 0xe4761941,
+0x762941c4, 0x7942c4d5, 0x830fd417, 0x000000a3,
+0x7219c1c4, 0xc03101f0, 0x903122c4, 0x02406514,
+0x79c50010, 0x8bc0557f, 0x89f0057c, 0x578dbc7d,
+0x06143901, 0x83487175, 0x834804c0, 0xe77510f8,
+0xef3141c4, 0x2141c4c9, 0x01b8c0db, 0xbe000000,
+0x00000005, 0x763941c4, 0x3941c4c1, 0x22c4c176,
+0x9d149039, 0x00100240, 0x557f79c5, 0x8bf289d0,
+0x29fc817c, 0x74c285c2, 0x85548b06, 0x8b07ebdc,
+0x89ec8554, 0xc2ffbc55, 0x39c0ff48, 0x481f75d7,
+0x7505f883, 0xebc031d8, 0x00e7b81a, 0x13eb0000,
+0x0000ffb8, 0xb80ceb00, 0x00000115, 0x1eb805eb,
+0x5d000001, 0x000000c3, 0x00000000, 0x00000000,
+0x00000001, 0x00000002, 0x00000003, 0x00000004,
+0x00000005, 0x00000006, 0x00000007, 0x00000008,
+0x00000009, 0x0000000a, 0x0000000b, 0x0000000c,
+0x0000000d, 0x0000000e, 0x0000000f, 0x00000010,
+0x00000011, 0x00000012, 0x00000013, 0x00000014,
+0x00000015, 0x00000016, 0x00000017, 0x00000018,
+0x00000019, 0x0000001a, 0x0000001b, 0x0000001c,
+0x0000001d, 0x0000001e, 0x0000001f, 0x00000020,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0001320,
+};
+asm(".type avx2_sg_x86_64_D_high, STT_NOTYPE;");
+asm(".type avx2_sg_x86_64_D_high, STT_FUNC;");
@@ -0,0 +1,4540 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_16i1[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x01b255c3,
+0x08b9e589, 0x56000000, 0xb353f631, 0x10ec8111,
+0x88000001, 0x88b83554, 0x88d028d8, 0x89c83544,
+0x01e083f0, 0x1901f883, 0xfe0224c0, 0x354488c8,
+0x01468dd8, 0xfe83c621, 0x00d98301, 0x4c88c2fe,
+0xf883e705, 0x89047410, 0xc5c8ebc6, 0xb87d6ff9,
+0x7d7ff9c5, 0x0539b888, 0xf9c50000, 0xc588556f,
+0xc4cf74e9, 0x0d1779e2, 0x00100770, 0x06e2830f,
+0xe9c50000, 0xc5b84dfc, 0x984d7ff9, 0x7d6ff9c5,
+0xfcc1c5b8, 0x053fb8cf, 0xf1c50000, 0xc4984d74,
+0x0d1779e2, 0x00100770, 0x06b6830f, 0xf9c50000,
+0xc5987d6f, 0xb84df8c1, 0x4d7ff9c5, 0x0544b8a8,
+0xe9c50000, 0xc4a85574, 0x151779e2, 0x00100770,
+0x068e830f, 0xf9c50000, 0xc5d84d6f, 0xb87d6ff9,
+0xf168f1c5, 0xbd7ff9c5, 0xffffff68, 0xb57ff9c5,
+0xffffff38, 0xf960f1c5, 0xb56ff9c5, 0xffffff68,
+0xbd7ff9c5, 0xffffff48, 0xd660c9c5, 0xce68c9c5,
+0x95d5e9c5, 0xffffff48, 0x0000ffb8, 0xd5f1c500,
+0xffff388d, 0x6ef9c5ff, 0x79e2c4f8, 0xf9c5ff79,
+0xff78bd7f, 0xe9c5ffff, 0xf1c5d7db, 0xf9c5cfdb,
+0xc5e87d6f, 0xc5f167e9, 0xc5c9eff1, 0x58b57ff9,
+0xc5ffffff, 0xc5c964c1, 0xc5f6dbf1, 0xa8757ff9,
+0x88a8458a, 0xffff1885, 0xe84d8aff, 0x8aaa5d8a,
+0xe0d2ac55, 0x88e94d8a, 0xffff2885, 0xa9458aff,
+0x4d8ae0d2, 0x178588ea, 0x8affffff, 0xe3d2ab45,
+0xc5eb4d8a, 0xd2cb6ef9, 0xec4d8ae0, 0xff108588,
+0x458affff, 0x8ae2d2ad, 0xf9c5ed4d, 0xe0d2e26e,
+0x88ee4d8a, 0xffff1685, 0xae458aff, 0x4d8ae0d2,
+0x0c8588ef, 0x8affffff, 0xe0d2af45, 0x88f04d8a,
+0xffff1585, 0xb0458aff, 0x4d8ae0d2, 0x088588f1,
+0x8affffff, 0xe0d2b145, 0x88f24d8a, 0xffff1485,
+0xb2458aff, 0x4d8ae0d2, 0x048588f3, 0x8affffff,
+0xe0d2b345, 0xff038588, 0x4d8affff, 0x71e3c4f4,
+0xff10b520, 0x8a01ffff, 0xe3c4b445, 0x16a52059,
+0x01ffffff, 0xff28b58b, 0xf9c5ffff, 0xff28b57f,
+0xe0d2ffff, 0x88f54d8a, 0xfffefc85, 0xb5458aff,
+0xd66ef9c5, 0x2069e3c4, 0xffff1795, 0xe9c501ff,
+0xff289561, 0xe0d2ffff, 0x88f64d8a, 0xffff0285,
+0xb6458aff, 0x4d8ae0d2, 0xf88588f7, 0x8afffffe,
+0xe0d2b745, 0x858bc188, 0xffffff0c, 0xf86ef9c5,
+0xff08858b, 0xe3c4ffff, 0x15bd2041, 0x01ffffff,
+0xe761d9c5, 0xd462e9c5, 0xc86ef9c5, 0xff04858b,
+0xe3c4ffff, 0x148d2071, 0x01ffffff, 0xf06ef9c5,
+0xfefc858b, 0xe3c4ffff, 0x03b52049, 0x01ffffff,
+0xce61f1c5, 0xd86ef9c5, 0xfef8858b, 0xe3c4ffff,
+0x029d2061, 0x01ffffff, 0xe86ef9c5, 0x2051e3c4,
+0xe1c501e9, 0xf1c5dd61, 0xe9c5cb62, 0xf9c5f96c,
+0xfee8bd7f, 0x01b0ffff, 0x756ff9c5, 0x6ef9c5e8,
+0x79e2c4e8, 0xc9c5ed78, 0xf9c5cdf8, 0xff28ad7f,
+0xf9c5ffff, 0x8ae84d7f, 0x858ae84d, 0xffffff18,
+0x4d8ae0d2, 0x188588e9, 0x8affffff, 0xe0d2a945,
+0x88ea4d8a, 0xffff1785, 0xaa458aff, 0x4d8ae0d2,
+0x108588eb, 0x8affffff, 0xe0d2ab45, 0x88ec4d8a,
+0xffff1685, 0xac458aff, 0x4d8ae0d2, 0x0c8588ed,
+0x8affffff, 0xe0d2ad45, 0x88ee4d8a, 0xffff1585,
+0xae458aff, 0x4d8ae0d2, 0x088588ef, 0x8affffff,
+0xe0d2af45, 0x88f04d8a, 0xffff1485, 0xb0458aff,
+0x4d8ae0d2, 0x048588f1, 0x8affffff, 0xe0d2b145,
+0x88f24d8a, 0xffff0385, 0xb2458aff, 0x8588e0d2,
+0xfffffefc, 0x8af34d8a, 0xb58bb345, 0xffffff18,
+0x8ab45d8a, 0xe0d2b555, 0xc5f44d8a, 0x88ce6ef9,
+0xffff0285, 0x10b58bff, 0x8affffff, 0xe3c4b645,
+0x178d2071, 0x01ffffff, 0x4d8ae3d2, 0x6ef9c5f5,
+0x0cb58bd6, 0xc4ffffff, 0xad2069e3, 0xffffff16,
+0x7ff9c501, 0xffff18ad, 0x6ef9c5ff, 0x61f1c5e3,
+0xffff188d, 0x8ae2d2ff, 0xf9c5f64d, 0xb58bee6e,
+0xffffff08, 0x2051e3c4, 0xffff15ad, 0xe3c401ff,
+0x01e22059, 0x4d8ae0d2, 0xf88588f7, 0x8afffffe,
+0xf9c5b745, 0xb58bfe6e, 0xffffff04, 0x2041e3c4,
+0xffff14bd, 0xd1c501ff, 0xf1c5ef61, 0xe0d2cd62,
+0xf9c5c188, 0x858bd66e, 0xfffffef8, 0xfefcb58b,
+0xe3c4ffff, 0x03952069, 0x01ffffff, 0xd86ef9c5,
+0x2061e3c4, 0xd9c501d9, 0xf9c5e361, 0xe3c4f66e,
+0x02b52049, 0x01ffffff, 0xd661e9c5, 0xd462e9c5,
+0xca6cf1c5, 0xc9fcf1c5, 0x8d74f1c5, 0xfffffee8,
+0x000621b8, 0x79e2c400, 0x07700d17, 0x830f0010,
+0x000002a0, 0x4d6ff9c5, 0x60f1c5c8, 0x68f1c5d1,
+0xd5e9c5d9, 0xffff4895, 0x6ff9c5ff, 0xffff58bd,
+0x7ff9c5ff, 0xe1c5887d, 0xff389dd5, 0xe9c5ffff,
+0xff7895db, 0xe1c5ffff, 0xff789ddb, 0xe9c5ffff,
+0xf9c5d367, 0xc498557f, 0x553c41e2, 0x41e2c498,
+0xc5985d38, 0x985d7ff9, 0x55fce9c5, 0x6ff9c598,
+0xffff68ad, 0x063db8ff, 0xe9c50000, 0xe9c5da60,
+0xe1c5d268, 0xff489dd5, 0xe9c5ffff, 0xff3895d5,
+0xe1c5ffff, 0xff789ddb, 0xe9c5ffff, 0xff7895db,
+0xe1c5ffff, 0xd1c5da67, 0xe1c5d1fc, 0xe2c4da74,
+0x701d1779, 0x0f001007, 0x0001f783, 0x0644b800,
+0xe2c40000, 0x88551c79, 0xd574e9c5, 0x1779e2c4,
+0x10077015, 0xd9830f00, 0xb8000001, 0x00000649,
+0x556ff9c5, 0x6ff9c5d8, 0xffff28bd, 0x41e2c4ff,
+0xe9c5da08, 0xe2c4db74, 0x701d1779, 0x0f001007,
+0x0001af83, 0xf8f1c500, 0x6ff9c5df, 0x4eb8b875,
+0xc4000006, 0xdb0049e2, 0xdb74f1c5, 0x1779e2c4,
+0x1007701d, 0x89830f00, 0xc5000001, 0xb86560f1,
+0x5d68f1c5, 0xf8d9c5b8, 0xc508b0e3, 0xc5f260e9,
+0xc5dc60d9, 0xc5ea68e9, 0xc5e468d9, 0xc5dbd5c9,
+0xc5ecd5d1, 0x78a5dbd1, 0xc5ffffff, 0x789ddbe1,
+0xc5ffffff, 0xc5dc67e1, 0xb8e06ef9, 0x000006a8,
+0x7879e2c4, 0x74e1c5e4, 0x79e2c4dc, 0x07701d17,
+0x830f0010, 0x0000012c, 0x5d6ff9c5, 0x00ffb8b8,
+0xe1c50000, 0xe1c5eb68, 0xe9c5e360, 0xd9c5fa68,
+0xd1c5e6d5, 0xf9c5f7d5, 0xe2c4e86e, 0xc5ed7979,
+0xc5e4dbd1, 0xc5eedbd1, 0xc5e567d9, 0xc5edefd1,
+0x88657ff9, 0xea64d1c5, 0xe560d9c5, 0x756ff9c5,
+0x79e2c488, 0xc1c5f620, 0xd9c5ff76, 0xb3b8e674,
+0xc4000006, 0xe71779e2, 0x00c6830f, 0xd1c50000,
+0xc9c5ed60, 0xf9c5f560, 0xc488656f, 0xe42179e2,
+0x0006bbb8, 0x74c9c500, 0x79e2c4f4, 0x830ff717,
+0x000000a0, 0xed60d1c5, 0xe560d9c5, 0x6d6ff9c5,
+0x79e2c488, 0xf9c5ed22, 0xb8a86d7f, 0x000006c4,
+0xe474d1c5, 0x1779e2c4, 0xb87973e7, 0x00000001,
+0x5d7ff9c5, 0x05548a98, 0x055488c8, 0x02c08398,
+0x7511f883, 0xefd9c5f0, 0x072ab8e4, 0xe9c50000,
+0xe3c4d464, 0x20cb4c71, 0xd276e9c5, 0x4d74f1c5,
+0x79e2c498, 0x3c73ca17, 0xe3c40fb0, 0x01e30f61,
+0xc86ef9c5, 0xe2c401b0, 0xc5c97879, 0xc5d9dbe1,
+0x31c86ef9, 0x79e2c4c0, 0xe1c5c978, 0xe1c5d9fc,
+0xe2c4dc74, 0x0fda1779, 0xf883c092, 0x25c01901,
+0x0000074a, 0x0110c481, 0x5e5b0000, 0x0000c35d,
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+0003600,
+};
+asm(".type avx2_x86_32_D_16i1, STT_NOTYPE;");
+asm(".type avx2_x86_32_D_16i1, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_16u1[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x01b055c3,
+0x08bae589, 0x56000000, 0xb353f631, 0xe0ec8111,
+0x88000000, 0x88b83544, 0x88c128d9, 0x89c8354c,
+0x01e183f1, 0x4c88c9fe, 0xf189d835, 0x83f12146,
+0xda8301f9, 0x88c0fe00, 0x83e73554, 0xd37510fe,
+0x756ff9c5, 0x7ff9c5b8, 0xe1c58875, 0xf9c5db76,
+0xb888556f, 0x00000539, 0xce74e9c5, 0x1779e2c4,
+0xae830fcb, 0xc5000005, 0xb84dfce9, 0x4d7ff9c5,
+0x6ff9c598, 0xc9c5b875, 0x3fb8cefc, 0xc5000005,
+0x984d74f1, 0x1779e2c4, 0x86830fcb, 0xc5000005,
+0x987d6ff9, 0x4df8c1c5, 0x7ff9c5b8, 0x44b8a84d,
+0xc5000005, 0xa86574e9, 0x1779e2c4, 0x62830fe3,
+0xc5000005, 0xc855ebe9, 0x557ff9c5, 0xdbf1c588,
+0xf9c5c84d, 0xc5a8756f, 0xc855efc9, 0x000550b8,
+0xdff1c500, 0xf1c5884d, 0xe2c4ca74, 0x0fcb1779,
+0x00053083, 0xefe9c500, 0x74e9c5d2, 0xf1c5e84d,
+0xf1c5ca74, 0xc5b87ddb, 0xa87d7ff9, 0x88a8458a,
+0xffff7885, 0xe84d8aff, 0xd2b25d8a, 0xe94d8ae0,
+0xff688588, 0x458affff, 0x8ae0d2a9, 0x8588ea4d,
+0xffffff58, 0xd2aa458a, 0xeb4d8ae0, 0xff548588,
+0x458affff, 0x8ae0d2ab, 0x8588ec4d, 0xffffff50,
+0xd2ac458a, 0xed4d8ae0, 0xff4c8588, 0x458affff,
+0x8ae0d2ad, 0x8588ee4d, 0xffffff48, 0xd2ae458a,
+0xef4d8ae0, 0xff448588, 0x458affff, 0x8ae0d2af,
+0x8588f04d, 0xffffff40, 0xd2b0458a, 0xf14d8ae0,
+0xff3c8588, 0x458affff, 0x8ae0d2b1, 0x8588f24d,
+0xffffff38, 0x4d8ae3d2, 0xb3458af3, 0xe36ef9c5,
+0x8bb4558a, 0xffff68b5, 0x8ae0d2ff, 0x8588f44d,
+0xffffff37, 0xc5b5458a, 0x8bd66ef9, 0xffff54b5,
+0x69e3c4ff, 0xff589520, 0xd201ffff, 0xf54d8ae2,
+0xfe6ef9c5, 0xff4cb58b, 0xe3c4ffff, 0x50bd2041,
+0x01ffffff, 0xd761e9c5, 0x4d8ae0d2, 0x308588f6,
+0x8affffff, 0xf9c5b645, 0xb58bee6e, 0xffffff44,
+0x2051e3c4, 0xffff48ad, 0xe0d201ff, 0x88f74d8a,
+0xffff1885, 0xb7458aff, 0xce6ef9c5, 0xff3cb58b,
+0xe3c4ffff, 0x40b52071, 0x01ffffff, 0xb57ff9c5,
+0xffffff68, 0x2059e3c4, 0xffff37b5, 0xd1c501ff,
+0xff68ad61, 0xf9c5ffff, 0xff58b57f, 0xf9c5ffff,
+0xe9c5e26e, 0xe3c4d562, 0x30a52059, 0x01ffffff,
+0xc188e0d2, 0xff18858b, 0xf9c5ffff, 0xe3c4ce6e,
+0x388d2071, 0x01ffffff, 0x8d61f1c5, 0xffffff58,
+0xf06ef9c5, 0x2049e3c4, 0xd9c501f1, 0xf1c5e661,
+0xe9c5cc62, 0xf9c5e96c, 0xff18ad7f, 0xc1c5ffff,
+0xc1c5ff76, 0xc5e84dfc, 0xe84d7ff9, 0x8ae84d8a,
+0xffff7885, 0x8ae0d2ff, 0x8588e94d, 0xffffff78,
+0xd2a9458a, 0xea4d8ae0, 0xff688588, 0x458affff,
+0x8ae0d2aa, 0x8588eb4d, 0xffffff58, 0xd2ab458a,
+0xec4d8ae0, 0xff548588, 0x458affff, 0x8ae0d2ac,
+0x8588ed4d, 0xffffff50, 0xd2ad458a, 0xee4d8ae0,
+0xff4c8588, 0x458affff, 0x8ae0d2ae, 0x8588ef4d,
+0xffffff48, 0xd2af458a, 0xf04d8ae0, 0xff448588,
+0x458affff, 0x8ae0d2b0, 0x8588f14d, 0xffffff40,
+0xd2b1458a, 0xf24d8ae0, 0xff3c8588, 0x458affff,
+0x88e0d2b2, 0xffff3885, 0xf34d8aff, 0x8bb3458a,
+0xffff78b5, 0xb45d8aff, 0xd2b5558a, 0xf44d8ae0,
+0xce6ef9c5, 0xff378588, 0xb58bffff, 0xffffff58,
+0xc4b6458a, 0x8d2071e3, 0xffffff68, 0x8ae3d201,
+0xf9c5f54d, 0xb58bd66e, 0xffffff50, 0x2069e3c4,
+0xffff54ad, 0xf9c501ff, 0xff78ad7f, 0xf1c5ffff,
+0xff788d61, 0xe2d2ffff, 0xc5f64d8a, 0x8be66ef9,
+0xffff48b5, 0x59e3c4ff, 0xff4ca520, 0xd201ffff,
+0xf74d8ae0, 0xff308588, 0x458affff, 0x6ef9c5b7,
+0x40b58bd6, 0xc4ffffff, 0xad2069e3, 0xffffff44,
+0x7ff9c501, 0xffff68ad, 0x6ef9c5ff, 0x61d9c5eb,
+0xffff68a5, 0x51e3c4ff, 0xc501ea20, 0xd2cc62f1,
+0x6ef9c5e0, 0x8bc188d6, 0xffff38b5, 0x30858bff,
+0xc4ffffff, 0xbd2069e3, 0xffffff3c, 0x6ef9c501,
+0x49e3c4f6, 0xff37b520, 0xc501ffff, 0xc5fe61c1,
+0xc4d06ef9, 0xd12069e3, 0x61d1c501, 0x62c1c5d2,
+0x6cf1c5fa, 0xfcf1c5cf, 0x74f1c5c9, 0xffff188d,
+0x0621b8ff, 0xe2c40000, 0x0fcb1779, 0x0001b483,
+0x6ff9c500, 0xe9c5b855, 0xc5c84dda, 0xc865dee9,
+0x55fce9c5, 0xfcf1c5c8, 0x0634b8cc, 0xf1c50000,
+0xe2c4ca74, 0x0fcb1779, 0x00018883, 0xc501b000,
+0xd8656ff9, 0xc86ef9c5, 0x000649b8, 0x79e2c400,
+0xe2c4c978, 0xc5cc0871, 0xc4cc74f1, 0xcb1779e2,
+0x015f830f, 0xf9c50000, 0xc5c8556f, 0x300dfce9,
+0xc5001006, 0xb87d6ff9, 0x00064eb8, 0x41e2c400,
+0xf1c5c900, 0xe2c4ca74, 0x0fcb1779, 0x00013483,
+0x60e9c500, 0xe9c5b86d, 0xc5b84d68, 0x300dfcf1,
+0xb0001006, 0xf8f1c508, 0xeff1c5cd, 0xefd9c5cc,
+0x10063025, 0xf8f1c500, 0x6ef9c5cc, 0x06a8b8e0,
+0xe2c40000, 0xc5e47879, 0xc4cc74f1, 0xcb1779e2,
+0x00ef830f, 0xe2c40000, 0xb85d3079, 0x3079e2c4,
+0x7ff9c5e3, 0xf9c5a865, 0xc4b86d6f, 0xcd3079e2,
+0x0006d3b8, 0x74f1c500, 0x76e1c5cb, 0x79e2c4db,
+0x830fcb17, 0x000000bd, 0x756ff9c5, 0x79e2c4b8,
+0xdab8ce31, 0xc5000006, 0xc4cc74f1, 0xcb1779e2,
+0x009f830f, 0xf9c50000, 0xc4b87d6f, 0xcf3279e2,
+0x4d7ff9c5, 0x06e1b888, 0xe2c40000, 0xc5e43079,
+0xc4cc74f1, 0xcb1779e2, 0x01b87b73, 0xc5000000,
+0xb84d6ff9, 0x4d7ff9c5, 0x05548a98, 0x055488c8,
+0x02c08398, 0x7511f883, 0xefd9c5f0, 0x072ab8e4,
+0xd9c50000, 0xc4d86564, 0xd14c69e3, 0x74e9c540,
+0xe2c49855, 0x73d31779, 0xc40fb03c, 0xe10f71e3,
+0x6ef9c501, 0xc401b0d0, 0xd27879e2, 0xcadbf1c5,
+0xd06ef9c5, 0xe2c4c031, 0xc5d27879, 0xc5cafcf1,
+0xc4cc74f1, 0xcb1779e2, 0x83c0920f, 0xc01901f8,
+0x00074a25, 0xe0c48100, 0x5b000000, 0x00c35d5e,
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+0003100,
+};
+asm(".type avx2_x86_32_D_16u1, STT_NOTYPE;");
+asm(".type avx2_x86_32_D_16u1, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_16i2[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc93155c3,
+0x5657e589, 0x0010bb53, 0xec810000, 0x000000dc,
+0xbec1b70f, 0x00000008, 0x2901788d, 0x0fc889c6,
+0xe083ffbf, 0xf6bf0f01, 0x8d01f883, 0xd2190141,
+0x4a02e283, 0x0175c885, 0x7c89664b, 0xf883a645,
+0x74896608, 0x8966b645, 0x66c64554, 0xd6455c89,
+0xc1890474, 0xf9c5baeb, 0xc5a87d6f, 0x78bd7ff9,
+0xc5ffffff, 0xc5e476d9, 0x788d6ff9, 0xb8ffffff,
+0x00000539, 0xd775f1c5, 0x1779e2c4, 0x40830fd4,
+0xc5000006, 0xa855fdf1, 0x557ff9c5, 0x6ff9c588,
+0xe9c5a875, 0xb801f671, 0x0000053f, 0x5575e9c5,
+0x79e2c488, 0x830fd417, 0x00000617, 0x7d6ff9c5,
+0xf9c1c588, 0xf9c5a855, 0xb898557f, 0x00000544,
+0x5575f1c5, 0x79e2c498, 0x830fd417, 0x000005f3,
+0x756ff9c5, 0xd5f1c5b8, 0xc9c5a855, 0xf9c5ded5,
+0xc5a84d6f, 0xc5f6fdf1, 0xb86df9f1, 0xd3f9e9c5,
+0x00055bb8, 0xd5d1c500, 0x75e9c5ee, 0x79e2c4d5,
+0x830fd417, 0x000005bb, 0x55d5f1c5, 0x05c8b8b8,
+0xe9c50000, 0x06e01575, 0xe2c40010, 0x0fd41779,
+0x00059e83, 0xe5f1c500, 0xe1c5c86d, 0xf9c5dbef,
+0xb8c8556f, 0x000005cf, 0xda65e1c5, 0xdd75e1c5,
+0x1779e2c4, 0x78830fdc, 0xc5000005, 0xc5d9d5e9,
+0x985d7ff9, 0x7d6ff9c5, 0x71d1c598, 0xf9c503f7,
+0xff78ad7f, 0xf9c5ffff, 0xc598756f, 0x02f671e1,
+0x5d7ff9c5, 0xfde1c588, 0x05edb8db, 0xe1c50000,
+0xe2c4dd75, 0x0fdc1779, 0x00053683, 0x6ff9c500,
+0xffff78bd, 0x71e1c5ff, 0xe1c502e7, 0xf2b8dbfd,
+0xc5000005, 0x885d75e1, 0x1779e2c4, 0x10830fdc,
+0xc7000005, 0xffff7485, 0x000003ff, 0xd5f1c500,
+0x74858bea, 0x89ffffff, 0xffff5885, 0x1ff8c1ff,
+0xff5c8589, 0xfac5ffff, 0xff58b57e, 0xd1c5ffff,
+0x85c7def1, 0xffffff74, 0x00000002, 0xff74858b,
+0x8589ffff, 0xffffff58, 0x891ff8c1, 0xffff5c85,
+0x7efac5ff, 0xffff58bd, 0xf1d1c5ff, 0x7ff9c5ef,
+0xd1c5886d, 0x05b8edfd, 0xc5000006, 0xc4eb75d1,
+0xec1779e2, 0x0499830f, 0x858b0000, 0xffffff74,
+0xff588589, 0xf8c1ffff, 0x5c85891f, 0xc5ffffff,
+0x58b57efa, 0xc5ffffff, 0xc5dee1e1, 0xb8dbfde1,
+0x00000609, 0x5d75e1c5, 0x79e2c488, 0x830fdc17,
+0x0000045f, 0xe2d5f1c5, 0x7d6ff9c5, 0xefc9c5d8,
+0x65c1c5f6, 0xdbe1c5de, 0x7ff9c5fc, 0x458b987d,
+0x85896698, 0xffffff4c, 0xd84dbf0f, 0xff4c858b,
+0x7d8bffff, 0x758b669c, 0xa05d8b9e, 0xbf0fe0d3,
+0x8589da4d, 0xffffff38, 0x9a458b66, 0xa2558b66,
+0x9d6ef9c5, 0xffffff38, 0x58858966, 0x8bffffff,
+0xffff5885, 0x0fe0d3ff, 0x89dc4dbf, 0xffff4885,
+0xc5f889ff, 0x48a5c4e1, 0x01ffffff, 0xbf0fe0d3,
+0x8589de4d, 0xffffff34, 0xf9c5f089, 0xff349d6e,
+0xe0d3ffff, 0xe04dbf0f, 0xff308589, 0xd889ffff,
+0xbf0fe0d3, 0x8589e24d, 0xffffff2c, 0xe0d3d089,
+0xe44dbf0f, 0xff288589, 0x458bffff, 0x858966a4,
+0xffffff54, 0xff54858b, 0xe0d3ffff, 0xe64dbf0f,
+0xff248589, 0x8b66ffff, 0x8966a645, 0xffff5085,
+0x50858bff, 0xc5ffffff, 0x30b5c4e1, 0x01ffffff,
+0xad6ef9c5, 0xffffff2c, 0xbd6ef9c5, 0xffffff24,
+0x9dc4d1c5, 0xffffff28, 0x62d9c501, 0xc5e0d3e6,
+0x01e8c4c1, 0xdd62e1c5, 0xf36cd9c5, 0xb57ff9c5,
+0xffffff38, 0x000001b8, 0x6ff9c500, 0xf9c5d87d,
+0xe2c4d86e, 0xc5db7979, 0xc5e3f9c1, 0xd8657ff9,
+0xd84dbf0f, 0xff4c858b, 0xe0d3ffff, 0xda4dbf0f,
+0xff4c8589, 0x858bffff, 0xffffff58, 0xa56ef9c5,
+0xffffff4c, 0xbf0fe0d3, 0x8589dc4d, 0xffffff58,
+0xff54858b, 0xd9c5ffff, 0xff58bdc4, 0xd301ffff,
+0x4dbf0fe7, 0x6ef9c5de, 0x0fe6d3e7, 0xc5e04dbf,
+0x01f6c4d9, 0xb57ff9c5, 0xffffff58, 0xbd62c1c5,
+0xffffff58, 0xbf0fe3d3, 0xf9c5e24d, 0xe2d3eb6e,
+0xe44dbf0f, 0xe2c4d1c5, 0x0fe0d301, 0x89e64dbf,
+0xffff5485, 0x50858bff, 0xc5ffffff, 0x54b56ef9,
+0xd3ffffff, 0xc4c9c5e0, 0xd9c501e8, 0xc1c5e562,
+0xc1c5fc6c, 0xd9c5fffd, 0x21b8e476, 0xc5000006,
+0x38bd75c1, 0xc4ffffff, 0xfc1779e2, 0x0261830f,
+0xe9c50000, 0xc5b86dd5, 0xc5f1d5e9, 0x886d7ff9,
+0x6deec9c5, 0xeac9c588, 0xf9c58875, 0xc588757f,
+0x886dfdd1, 0x00063db8, 0xfdf1c500, 0xd1c5b875,
+0xd1c5ead5, 0xe2c4ee75, 0x0fec1779, 0x00022283,
+0xd5e9c500, 0x7ff9c5d1, 0xffff7895, 0x0644b8ff,
+0xe2c40000, 0x78951d79, 0xc5ffffff, 0xc4ca75f1,
+0xcc1779e2, 0x01f9830f, 0x49b80000, 0xc5000006,
+0xc84d6ff9, 0x0961e2c4, 0x75f1c5d9, 0x79e2c4db,
+0x830fdc17, 0x000001db, 0x00064eb8, 0x70fbc500,
+0xc51ba855, 0xb85d6ff9, 0xd270fac5, 0x70f9c51b,
+0xe1c54ed2, 0xe2c4d275, 0x0fd41779, 0x0001b283,
+0x61e1c500, 0xe1c5a855, 0xc5a85d69, 0xb8d3f9e9,
+0x00000004, 0xd1d5e9c5, 0xd86ef9c5, 0x0006a8b8,
+0x79e2c400, 0xe9c5db79, 0xe2c4d375, 0x0fd41779,
+0x00017e83, 0xd5f1c500, 0xc1c5a85d, 0xc1c5ffef,
+0xf9c5e965, 0xff789d7f, 0xe1c5ffff, 0xf9c5dd61,
+0xff78bd6f, 0xe2c4ffff, 0xb8d72379, 0x000006b3,
+0xda75e1c5, 0x1779e2c4, 0x44830fdc, 0xc5000001,
+0xc5ed61d1, 0xc5d561e9, 0x78b56ff9, 0xc4ffffff,
+0xde2479e2, 0x0006bbb8, 0x75e1c500, 0x79e2c4d2,
+0x830fd417, 0x0000011b, 0xba458b66, 0x7d6ff9c5,
+0x7ff9c5a8, 0xc9c5887d, 0xf9c5f6ef, 0xc5b87d6f,
+0xc4ce65f1, 0x4d4c41e3, 0x896610a8, 0x8b668a45,
+0x8966be45, 0x8b668e45, 0x8966c245, 0x8b669245,
+0x8966c645, 0x2ab89645, 0xc5000007, 0x885d6ff9,
+0xc975e1c5, 0x1779e2c4, 0xc4830fcc, 0xb8000000,
+0x0000073a, 0x556ff9c5, 0x69e3c4a8, 0xaab84d0e,
+0xd975e1c5, 0x1779e2c4, 0xa4830fdc, 0xb8000000,
+0x00000007, 0x0f69e3c4, 0xf9c502da, 0x01b8c86e,
+0xc4000000, 0xc97979e2, 0xe06ef9c5, 0xc9dbe9c5,
+0x7979e2c4, 0xfdf1c5e4, 0x074ab8cc, 0xe1c50000,
+0xe1c5c975, 0xe2c4db76, 0x73cb1779, 0x0003b866,
+0xf9c50000, 0xff78957f, 0xf9c5ffff, 0xe2c4d66f,
+0x788d0169, 0x48ffffff, 0x8d7ff9c5, 0xffffff78,
+0xf9c5ec75, 0x8307d1c5, 0x5eb824fa, 0x75000007,
+0x6ff9c532, 0xe2c4a875, 0xb84d0549, 0xe2c4c031,
+0xc4ca0171, 0xca0171e2, 0x0171e2c4, 0x75f1c5ca,
+0x79e2c4ca, 0x920fcb17, 0x01f883c0, 0x6725c019,
+0x81000007, 0x0000dcc4, 0x5f5e5b00, 0x0000c35d,
+0x000e0008, 0x00140012, 0x00120014, 0x0008000e,
+0003360,
+};
+asm(".type avx2_x86_32_D_16i2, STT_NOTYPE;");
+asm(".type avx2_x86_32_D_16i2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_16u2[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x10b955c3,
+0x89000000, 0x57c031e5, 0xec815356, 0x000000cc,
+0xbbd0b70f, 0x00000008, 0xc789d329, 0x8901728d,
+0x01e283c2, 0xf8854a40, 0x0ff6b70f, 0xb70fdbb7,
+0x490175d2, 0x45748966, 0x08f883a6, 0x455c8966,
+0x548966b6, 0x8966c645, 0x75d6454c, 0x6ff9c5c3,
+0xf9c5a875, 0xff78b57f, 0xf1c5ffff, 0xf9c5c976,
+0xff789d6f, 0x39b8ffff, 0xc5000005, 0xc4d675e1,
+0xd11779e2, 0x0595830f, 0xe1c50000, 0xc5a855fd,
+0x88557ff9, 0x7d6ff9c5, 0x71e9c5a8, 0x3fb801f7,
+0xc5000005, 0x885575e9, 0x1779e2c4, 0x6c830fd1,
+0xc5000005, 0x88756ff9, 0x55f9c9c5, 0x7ff9c5a8,
+0x44b89855, 0xc5000005, 0x986575e1, 0x1779e2c4,
+0x48830fe1, 0xc5000005, 0xb85debe1, 0x9d7ff9c5,
+0xffffff78, 0x55dbe9c5, 0x6ff9c5b8, 0xc1c5987d,
+0xb8b85def, 0x00000550, 0x95dfe9c5, 0xffffff78,
+0xd375e9c5, 0x1779e2c4, 0x10830fd1, 0xc5000005,
+0xa8556ff9, 0x5dd5e9c5, 0x05c8b8b8, 0xe1c50000,
+0x06301d75, 0xe2c40010, 0x0fd91779, 0x0004ee83,
+0xe4e9c500, 0xe9c5c865, 0xc5c85ddb, 0xc85dfde1,
+0x0005d1b8, 0x75e1c500, 0x79e2c4dc, 0x830fd917,
+0x000004cb, 0x557ff9c5, 0x6ff9c598, 0xd9c59875,
+0xc503f671, 0x78a57ff9, 0xc5ffffff, 0x987d6ff9,
+0xf771e1c5, 0x7ff9c502, 0xe1c5885d, 0xedb8dbfd,
+0xc5000005, 0xc4dc75e1, 0xd91779e2, 0x048d830f,
+0xf9c50000, 0xff78b56f, 0xe1c5ffff, 0xc502d671,
+0xb8dbfde1, 0x000005f2, 0x5d75e1c5, 0x79e2c488,
+0x830fd917, 0x00000467, 0xff7485c7, 0x0003ffff,
+0xf9c50000, 0xff749d6e, 0xe9c5ffff, 0x85c7dbf1,
+0xffffff74, 0x00000002, 0xa56ef9c5, 0xffffff74,
+0xe4f1e9c5, 0x657ff9c5, 0xfdd9c588, 0x0605b8e4,
+0xd9c50000, 0xe2c4e375, 0x0fe11779, 0x00041e83,
+0x6ef9c500, 0xffff74a5, 0xd1e1c5ff, 0xfde1c5dc,
+0x0609b8db, 0xe1c50000, 0xc4885d75, 0xd91779e2,
+0x03f9830f, 0xd9c50000, 0xd9c5e4ef, 0xc5d85d75,
+0xc5dc75e1, 0xc5fadbe1, 0x987d7ff9, 0x6698458b,
+0xff588589, 0xb70fffff, 0x858bd84d, 0xffffff58,
+0xb70fe0d3, 0x8589da4d, 0xffffff48, 0x9a458b66,
+0x9d6ef9c5, 0xffffff48, 0x64858966, 0x8bffffff,
+0xffff6485, 0x0fe0d3ff, 0x89dc4db7, 0xffff4485,
+0x9c458bff, 0xa5c4e1c5, 0xffffff44, 0x85896601,
+0xffffff60, 0xff60bd8b, 0xe7d3ffff, 0xde4db70f,
+0xff40bd89, 0x8b66ffff, 0xf9c59e7d, 0xff409d6e,
+0xfe89ffff, 0xb70fe6d3, 0xb589e04d, 0xffffff3c,
+0x89a0758b, 0x0fe3d3f3, 0x89e24db7, 0xffff389d,
+0x5d8b66ff, 0xd3da89a2, 0x4db70fe2, 0x349589e4,
+0x8bffffff, 0xd089a455, 0xb70fe0d3, 0x8589e64d,
+0xffffff30, 0xa6458b66, 0x5c858966, 0x8bffffff,
+0xffff5c85, 0xc4e1c5ff, 0xffff3cb5, 0xf9c501ff,
+0xff38ad6e, 0xf9c5ffff, 0xff30bd6e, 0xd1c5ffff,
+0xff349dc4, 0xc501ffff, 0xd3e662d9, 0xc4c1c5e0,
+0xe1c501e8, 0xd9c5dd62, 0xf9c5f36c, 0xff48b57f,
+0xc1c5ffff, 0xc1c5ff76, 0xc5d85dfd, 0xd85d7ff9,
+0xd84db70f, 0xff58858b, 0xe0d3ffff, 0xda4db70f,
+0xff588589, 0x858bffff, 0xffffff64, 0xa56ef9c5,
+0xffffff58, 0xb70fe0d3, 0x8589dc4d, 0xffffff64,
+0xff60858b, 0xd9c5ffff, 0xff649dc4, 0xd301ffff,
+0x4db70fe0, 0x608589de, 0x8bffffff, 0xffff5c85,
+0x6ef9c5ff, 0xffff60a5, 0x0fe7d3ff, 0xc5e04db7,
+0x01ffc4d9, 0xdf62e1c5, 0xb70fe6d3, 0xf9c5e24d,
+0xe3d3ee6e, 0xe44db70f, 0xe3c4d1c5, 0x0fe2d301,
+0xc5e64db7, 0xd3f26ef9, 0xc4c9c5e0, 0xd9c501e8,
+0xe1c5e562, 0xe1c5dc6c, 0x21b8dbfd, 0xc5000006,
+0x489d75e1, 0xc4ffffff, 0xd91779e2, 0x021d830f,
+0xe2c40000, 0xb85d3a69, 0x3e69e2c4, 0xe9c5b865,
+0xc5b855fd, 0xb8dcfde1, 0x00000634, 0xd275e1c5,
+0x1779e2c4, 0xf4830fd1, 0xb8000001, 0x00000001,
+0x656ff9c5, 0x6ef9c5c8, 0x0649b8d8, 0xe2c40000,
+0xc4db7979, 0xd40961e2, 0xd475e9c5, 0x1779e2c4,
+0xc8830fd1, 0xb8000001, 0x0000064e, 0x6d70fbc5,
+0xf9c51ba8, 0xc5b8556f, 0x1bed70fa, 0xed70f9c5,
+0x75e9c54e, 0x79e2c4ed, 0x830fe917, 0x0000019f,
+0x6d61e9c5, 0x69e9c5a8, 0xe9c5a855, 0x064015fd,
+0x04b80010, 0xc5000000, 0xc5d5f9e9, 0xc5d4efe9,
+0x4025efd9, 0xc5001006, 0xc5d4f9e9, 0xb8e06ef9,
+0x000006a8, 0x7979e2c4, 0x75e9c5e4, 0x79e2c4d4,
+0x830fd117, 0x00000157, 0x3379e2c4, 0xe2c4a865,
+0xc5d43379, 0x98557ff9, 0x756ff9c5, 0x79e2c4a8,
+0xd3b8d633, 0xc5000006, 0xc4d475e9, 0xd11779e2,
+0x0129830f, 0xf9c50000, 0xc4a87d6f, 0xd73479e2,
+0x0006dab8, 0x75e9c500, 0xe2c49855, 0x0fd11779,
+0x00010a83, 0x458b6600, 0x6ff9c5ba, 0xf9c5a875,
+0xc588757f, 0xc5d2efe9, 0xb87d6ff9, 0x5564e9c5,
+0x41e3c4c8, 0x20a8554c, 0x8a458966, 0xbe458b66,
+0x8e458966, 0xc2458b66, 0x92458966, 0xc6458b66,
+0x96458966, 0x00072ab8, 0x6ff9c500, 0xd1c5886d,
+0xe2c4d275, 0x0fd11779, 0x0000b283, 0x073ab800,
+0xf9c50000, 0xc4a8656f, 0x550e59e3, 0xd1c5aab8,
+0xe2c4ea75, 0x0fe91779, 0x00009283, 0x0007b800,
+0xe3c40000, 0x02ec0f59, 0xd06ef9c5, 0x7979e2c4,
+0xdbd9c5d2, 0xfde9c5d2, 0x074ab8d3, 0xd1c50000,
+0xe2c4d275, 0x73d11779, 0x0003b866, 0xf9c50000,
+0xff78a57f, 0xe1c5ffff, 0xe2c4dbef, 0x78950161,
+0x48ffffff, 0x957ff9c5, 0xffffff78, 0xf9c5ec75,
+0x8307d2c5, 0x5eb824fa, 0x75000007, 0x6ff9c532,
+0xe2c4a875, 0xb8550549, 0xe2c4c031, 0xc4d30169,
+0xd30169e2, 0x0169e2c4, 0x75e9c5d3, 0x79e2c4d3,
+0x920fd117, 0x01f883c0, 0x6725c019, 0x81000007,
+0x0000ccc4, 0x5f5e5b00, 0x0000c35d, 0x00000000,
+0x000e0008, 0x00140012, 0x00120014, 0x0008000e,
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+0003120,
+};
+asm(".type avx2_x86_32_D_16u2, STT_NOTYPE;");
+asm(".type avx2_x86_32_D_16u2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_16i4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x20b955c3,
+0x89000000, 0x57c031e5, 0x000005bf, 0x81535600,
+0x00009cec, 0x89c38900, 0x40da89fe, 0x2901e283,
+0x01fa83c6, 0xe283d219, 0xd8854a02, 0x89490175,
+0x83a48544, 0x748904f8, 0x5489b485, 0x4c89c485,
+0xd175d485, 0x7d6ff9c5, 0x7ff9c5a8, 0xffff78bd,
+0x76f1c5ff, 0x6ff9c5c9, 0xffff7895, 0x0539b8ff,
+0xe9c50000, 0xe2c4df76, 0x0fd91779, 0x00049183,
+0xfee9c500, 0xf9c5a85d, 0xc5885d7f, 0xa86d6ff9,
+0xf572e1c5, 0x053fb801, 0xe1c50000, 0xc4885d76,
+0xd91779e2, 0x0468830f, 0xf9c50000, 0xc5887d6f,
+0xa85dfac1, 0x5d7ff9c5, 0x0544b898, 0xe9c50000,
+0xc4985d76, 0xd91779e2, 0x0444830f, 0xf9c50000,
+0xc4b86d6f, 0x554069e2, 0x51e2c4a8, 0xf9c5e540,
+0xc5a85d6f, 0xc5f5fee1, 0xb86dfae1, 0xd4fae9c5,
+0x00055bb8, 0x51e2c400, 0xe9c5ee40, 0xe2c4d576,
+0x0fd11779, 0x00040983, 0x61e2c400, 0xb8b85540,
+0x000005c8, 0x1576e9c5, 0x00100520, 0x1779e2c4,
+0xeb830fd1, 0xc5000003, 0xc855efe1, 0xd07ef9c5,
+0x957ff9c5, 0xffffff78, 0x2869e2c4, 0x6df7b855,
+0x984589b8, 0x89c0458b, 0x6df79c55, 0xa0458980,
+0x0005e1b8, 0xa4558900, 0x5576e9c5, 0x79e2c498,
+0x830fd117, 0x000003aa, 0x4061e2c4, 0xf9c5c865,
+0xc598657f, 0x987d6ff9, 0xf772d1c5, 0x7ff9c503,
+0xffff78ad, 0x6ff9c5ff, 0xe9c59875, 0xc502f672,
+0x88557ff9, 0xd2fee9c5, 0x0005edb8, 0x76e9c500,
+0x79e2c4d5, 0x830fd117, 0x00000366, 0xad6ff9c5,
+0xffffff78, 0xe572e9c5, 0xfee9c502, 0x05f2b8d2,
+0xe9c50000, 0xc4885576, 0xd11779e2, 0x0340830f,
+0x85c70000, 0xffffff74, 0x00000003, 0xff74858b,
+0x8589ffff, 0xffffff60, 0x891ff8c1, 0xffff6485,
+0x7efac5ff, 0xffff60bd, 0xf2d9c5ff, 0x7485c7d7,
+0x02ffffff, 0x8b000000, 0xffff7485, 0x608589ff,
+0xc1ffffff, 0x85891ff8, 0xffffff64, 0xad7efac5,
+0xffffff60, 0xe5f2d9c5, 0x657ff9c5, 0xfed9c588,
+0x0605b8e4, 0xd9c50000, 0xe2c4e276, 0x0fe11779,
+0x0002cd83, 0x74858b00, 0x89ffffff, 0xffff6085,
+0x1ff8c1ff, 0xff648589, 0xfac5ffff, 0xff60b57e,
+0xe9c5ffff, 0xe9c5d6e2, 0x09b8d2fe, 0xc5000006,
+0x885576e9, 0x1779e2c4, 0x93830fd1, 0xc4000002,
+0x654061e2, 0xefd1c5c8, 0x6ff9c5ed, 0xc1c5d87d,
+0xe9c5d566, 0xf9c5d4db, 0xc498557f, 0x7d4769e2,
+0x0001b8d8, 0xf9c50000, 0xf9c5f06e, 0xc500e670,
+0xd8756ff9, 0xf4fac9c5, 0x757ff9c5, 0x69e2c4d8,
+0xb8d85547, 0x00000621, 0xf2fee9c5, 0xf776c9c5,
+0x1779e2c4, 0x37830ff1, 0xc4000002, 0x554669e2,
+0x0626b8d8, 0xe9c50000, 0xc4985576, 0xd11779e2,
+0x021c830f, 0xf9c50000, 0xc4c8756f, 0x554049e2,
+0x49e2c4b8, 0xf9c5fb40, 0xc488557f, 0x553d41e2,
+0x41e2c488, 0xc5887d39, 0x887d7ff9, 0x55fee9c5,
+0x063db888, 0xe1c50000, 0xc4b87dfe, 0xd64069e2,
+0xd776e9c5, 0x1779e2c4, 0xd3830fd1, 0xc4000001,
+0xf34049e2, 0xb57ff9c5, 0xffffff78, 0x000644b8,
+0x79e2c400, 0xff78951e, 0xe1c5ffff, 0xe2c4da76,
+0x0fd91779, 0x0001a983, 0x0649b800, 0xf9c50000,
+0xc4c8556f, 0xe20a59e2, 0xe476e9c5, 0x1779e2c4,
+0x8b830fe1, 0xb8000001, 0x0000064e, 0x5d70f9c5,
+0xf9c51ba8, 0xc5b8656f, 0xc4db76d9, 0xd91779e2,
+0x016c830f, 0xd9c50000, 0xc5a85d62, 0xa8656ad9,
+0xdcfae1c5, 0x000002b8, 0x61e2c400, 0xf9c5da40,
+0xa8b8f86e, 0xc5000006, 0x00e770f9, 0xdc76e1c5,
+0x1779e2c4, 0x37830fd9, 0xc4000001, 0x5d4069e2,
+0x66d1c5a8, 0x7ff9c5e2, 0xffff789d, 0x62e1c5ff,
+0x6ff9c5e4, 0xffff78bd, 0x79e2c4ff, 0xb3b8df25,
+0xc5000006, 0xc4dc76e1, 0xd91779e2, 0x0100830f,
+0x458b0000, 0x6ff9c5bc, 0xf9c5a875, 0xc588757f,
+0xc5d566e9, 0xb86d6ff9, 0x4c51e3c4, 0x8920a855,
+0x458b8c45, 0x944589c4, 0x00072ab8, 0x6ff9c500,
+0xe1c5885d, 0xe2c4d276, 0x0fd11779, 0x0000c183,
+0x073ab800, 0xf9c50000, 0xc4a8556f, 0x650e69e3,
+0xe1c5ccb8, 0xe2c4dc76, 0x0fd91779, 0x0000a183,
+0x0003b800, 0xe3c40000, 0x04da0f69, 0xe86ef9c5,
+0x000001b8, 0x70f9c500, 0xf9c500cd, 0xe9c5e86e,
+0xf9c5c9db, 0xc500e570, 0xb8ccfef1, 0x0000074a,
+0xc976e1c5, 0xdb76e1c5, 0x1779e2c4, 0xc56373cb,
+0x78957ff9, 0xc5ffffff, 0xc4d2efe9, 0x8d0269e2,
+0xffffff78, 0x8d7ff9c5, 0xffffff78, 0x0269e2c4,
+0xffff788d, 0x075eb8ff, 0xe3c40000, 0x03ca1679,
+0x750afa83, 0x6ff9c52d, 0xe2c4a87d, 0xb84d0641,
+0xe2c4c031, 0xc4ca0271, 0xca0271e2, 0xca76f1c5,
+0x1779e2c4, 0xc0920fcb, 0x1901f883, 0x076725c0,
+0xc4810000, 0x0000009c, 0x5d5f5e5b, 0x000000c3,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0002460,
+};
+asm(".type avx2_x86_32_D_16i4, STT_NOTYPE;");
+asm(".type avx2_x86_32_D_16i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_16u4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x20ba55c3,
+0x89000000, 0x57c031e5, 0x000005bf, 0x81535600,
+0x00008cec, 0x89c38900, 0x40d989fe, 0x2901e183,
+0xd88549c6, 0x894a0175, 0x83a48544, 0x748904f8,
+0x4c89b485, 0x5489c485, 0xd975d485, 0x7d6ff9c5,
+0x7ff9c5a8, 0xffff78bd, 0x76f1c5ff, 0x6ff9c5c9,
+0xffff789d, 0x0539b8ff, 0xe1c50000, 0xe2c4d776,
+0x0fd11779, 0x0003e283, 0xfee1c500, 0xf9c5a855,
+0xc588557f, 0xa87d6ff9, 0xf772e9c5, 0x053fb801,
+0xe9c50000, 0xc4885576, 0xd11779e2, 0x03b9830f,
+0xf9c50000, 0xc5887d6f, 0xa855fac1, 0x557ff9c5,
+0x0544b898, 0xe1c50000, 0xc4986576, 0xe11779e2,
+0x0395830f, 0xe1c50000, 0xc5b85deb, 0x789d7ff9,
+0xc5ffffff, 0xb855dbe9, 0x7d6ff9c5, 0xefc1c598,
+0x50b8b85d, 0xc5000005, 0x7895dfe9, 0xc5ffffff,
+0xc5ed76d1, 0xc4d376e9, 0xd11779e2, 0x0359830f,
+0xf9c50000, 0xc4a8556f, 0x5d4069e2, 0x05c8b8b8,
+0xe1c50000, 0x04701d76, 0xe2c40010, 0x0fd91779,
+0x00033683, 0xefe9c500, 0xf9c5c85d, 0xf9c5d87e,
+0xff789d7f, 0xe1c5ffff, 0xf7b85df4, 0x4589b865,
+0xc0458b98, 0xf79c5589, 0x45898065, 0x05e1b8a0,
+0x55890000, 0x76e1c5a4, 0xe2c4985d, 0x0fd91779,
+0x0002f683, 0x7ff9c500, 0xf9c59855, 0xc598756f,
+0x03f672d9, 0xa57ff9c5, 0xffffff78, 0x7d6ff9c5,
+0x72e1c598, 0xf9c502f7, 0xc5885d7f, 0xb8dbfee1,
+0x000005ed, 0xdc76e1c5, 0x1779e2c4, 0xb8830fd9,
+0xc5000002, 0x78b56ff9, 0xc5ffffff, 0x02d672e1,
+0xdbfee1c5, 0x0005f2b8, 0x76e1c500, 0xe2c4885d,
+0x0fd91779, 0x00029283, 0x7485c700, 0x03ffffff,
+0xc5000000, 0x749d6ef9, 0xc5ffffff, 0xc7dbf2e9,
+0xffff7485, 0x000002ff, 0x6ef9c500, 0xffff74a5,
+0xf2e9c5ff, 0x7ff9c5e4, 0xd9c58865, 0x05b8e4fe,
+0xc5000006, 0xc4e376d9, 0xe11779e2, 0x0249830f,
+0xf9c50000, 0xff74a56e, 0xe1c5ffff, 0xe1c5dcd2,
+0x09b8dbfe, 0xc5000006, 0x885d76e1, 0x1779e2c4,
+0x24830fd9, 0xc5000002, 0xc5e4efd9, 0xd85d76d9,
+0xdc76e1c5, 0xdadbe1c5, 0x4761e2c4, 0xd1c5d87d,
+0xc5d865fe, 0xd8657ff9, 0x4761e2c4, 0x21b8d865,
+0xc5000006, 0xc5f4fed9, 0xc4f776c9, 0xf11779e2,
+0x01e5830f, 0xe2c40000, 0xd8654559, 0x000626b8,
+0x76e1c500, 0x79e2c4dc, 0x830fd917, 0x000001cb,
+0x3b69e2c4, 0xe2c4b85d, 0xb8653f69, 0x55fee9c5,
+0xfee1c5b8, 0x0634b8dc, 0xe1c50000, 0xe2c4d276,
+0x0fd11779, 0x0001a283, 0x0001b800, 0xf9c50000,
+0xc5c8656f, 0xb8f86ef9, 0x00000649, 0xdf70f9c5,
+0x61e2c400, 0xe9c5d40a, 0xe2c4d476, 0x0fd11779,
+0x00017683, 0x064eb800, 0xf9c50000, 0x1ba87570,
+0x556ff9c5, 0x76e9c5b8, 0x79e2c4f6, 0x830ff117,
+0x00000157, 0x7562e9c5, 0x6ae9c5a8, 0xd1c5a855,
+0x02b8d2fe, 0xc5000000, 0xc5d6fae9, 0xc5d4efe9,
+0xc5e5efd9, 0xc5d4fae9, 0xb8e86ef9, 0x000006a8,
+0xe570f9c5, 0x76e9c500, 0x79e2c4d4, 0x830fd117,
+0x00000117, 0x3579e2c4, 0xf9c5a865, 0xc4a86d6f,
+0xd53579e2, 0x0006d3b8, 0x76e9c500, 0x79e2c4d4,
+0x830fd117, 0x000000f3, 0xc5bc458b, 0xa8756ff9,
+0x757ff9c5, 0xefe9c588, 0x6ff9c5d2, 0xe9c5b87d,
+0xc4c85564, 0x554c41e3, 0x458920a8, 0xc4458b8c,
+0xb8944589, 0x0000072a, 0x6d6ff9c5, 0x76d1c588,
+0x79e2c4d2, 0x830fd117, 0x000000af, 0x00073ab8,
+0x6ff9c500, 0xe3c4a865, 0xb8550e59, 0x76d1c5cc,
+0x79e2c4ea, 0x830fe917, 0x0000008f, 0x000003b8,
+0x59e3c400, 0xc504ec0f, 0xc5f06ef9, 0x00d670f9,
+0xd2dbd9c5, 0xd3fee9c5, 0x00074ab8, 0x76d1c500,
+0x79e2c4d2, 0x6373d117, 0xa57ff9c5, 0xffffff78,
+0xdbefe1c5, 0x0261e2c4, 0xffff7895, 0x7ff9c5ff,
+0xffff7895, 0x61e2c4ff, 0xff789502, 0x5eb8ffff,
+0xc4000007, 0xd21679e3, 0x0afa8303, 0xf9c52d75,
+0xc4a86d6f, 0x550651e2, 0xc4c031b8, 0xd30269e2,
+0x0269e2c4, 0x76e9c5d3, 0x79e2c4d3, 0x920fd117,
+0x01f883c0, 0x6725c019, 0x81000007, 0x00008cc4,
+0x5f5e5b00, 0x0000c35d, 0x00000000, 0x00000000,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0002200,
+};
+asm(".type avx2_x86_32_D_16u4, STT_NOTYPE;");
+asm(".type avx2_x86_32_D_16u4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_16i8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0xec81e589, 0x000000a8, 0x31ec4589, 0x89d231c0,
+0xc031d445, 0x4589c931, 0xc7c031e4, 0x0001c845,
+0x55890000, 0xd845c7cc, 0x00000002, 0xc7dc4d89,
+0x003fe845, 0x45c70000, 0x000002d0, 0xe045c700,
+0x00000001, 0x3ef045c7, 0x89000000, 0xf9c5f445,
+0xc5c87d6f, 0x987d7ff9, 0xc976f1c5, 0x656ff9c5,
+0x0539b898, 0xe2c40000, 0xc4d72959, 0xd11779e2,
+0x046c830f, 0xd9c50000, 0xc5c855d4, 0xa8557ff9,
+0x6d6ff9c5, 0x73e9c5c8, 0x3fb801f5, 0xc4000005,
+0x552969e2, 0x79e2c4a8, 0x830fd117, 0x00000442,
+0x7d6ff9c5, 0xfbc1c5a8, 0xf9c5c855, 0xb8b8557f,
+0x00000544, 0x2959e2c4, 0xe2c4b855, 0x0fd11779,
+0x00041d83, 0x6ff9c500, 0xe9c5c86d, 0xc520d473,
+0x20d573d1, 0x55f4e9c5, 0xf4d9c5c8, 0xd1c5c85d,
+0xe9c5e4f4, 0xf9c5d4d4, 0xc5d8656f, 0xc5ecf4d9,
+0x20f273e9, 0xdad4e1c5, 0xd473e9c5, 0xf4e9c520,
+0xd4e9c5d4, 0x73e9c5d2, 0xd1c520f2, 0xf9c5fad4,
+0xff78bd7f, 0xf9c5ffff, 0xc5c8556f, 0xc5fcd4e9,
+0xd875fbe9, 0x00055bb8, 0xfbe1c500, 0xffff789d,
+0xf4c9c5ff, 0x73d9c5ef, 0xf9c520d6, 0xff68ad7f,
+0xd1c5ffff, 0xc520d773, 0xc5e7f4d9, 0xc5eef4d1,
+0xc5e5d4d9, 0x20f473d9, 0xa5d4d9c5, 0xffffff68,
+0x2961e2c4, 0x79e2c4dc, 0x830fd917, 0x00000372,
+0x5d6ff9c5, 0x73d9c5d8, 0xc9c520d2, 0xc520d373,
+0xd85df4d9, 0xf2f4c9c5, 0x6df4e9c5, 0xd4e1c5d8,
+0x73e1c5de, 0xd1c520f3, 0xc8b8dbd4, 0xc4000005,
+0x1d2961e2, 0x00100500, 0x1779e2c4, 0x2f830fd9,
+0xc7000003, 0xffff7885, 0x000001ff, 0x89c03100,
+0xffff7c85, 0x7efac5ff, 0xffff789d, 0x16e0c5ff,
+0x1005301d, 0x73c1c500, 0xe9c520d3, 0xd9c5ebf4,
+0xc1c5f3f4, 0xc9c5d2f4, 0xc9c5f2d4, 0xc520f673,
+0xc5f6d4d1, 0xb8757ff9, 0x7d6ff9c5, 0x73c1c5b8,
+0xf9c503f7, 0xc5987d7f, 0xb8756ff9, 0xf673c9c5,
+0x7ff9c502, 0xc9c5a875, 0xedb8f6d4, 0xc4000005,
+0xf72949e2, 0xfbf4d9c5, 0x1779e2c4, 0x7ff9c5f1,
+0xffff78bd, 0xa7830fff, 0xc5000002, 0x987d6ff9,
+0xd773c9c5, 0x6ff9c502, 0xc1c5987d, 0xc402e772,
+0xf70e49e3, 0xd4c9c5cc, 0x05f2b8f6, 0xe2c40000,
+0xa8752949, 0x1779e2c4, 0x73830ff1, 0xc5000002,
+0x78bdd4e9, 0xc7ffffff, 0x00039445, 0xc1c50000,
+0xc520f773, 0x8bffd4d1, 0x85899445, 0xffffff68,
+0x891ff8c1, 0xffff6c85, 0x7efac5ff, 0xffff68b5,
+0xf3c1c5ff, 0x9445c7f6, 0x00000002, 0x8994458b,
+0xffff6885, 0x1ff8c1ff, 0xff6c8589, 0xfac5ffff,
+0xff68a57e, 0xc1c5ffff, 0xf9c5fcf3, 0xc5a87d7f,
+0xb8ffd4c1, 0x00000605, 0x2941e2c4, 0x79e2c4fe,
+0x830ff917, 0x000001fa, 0xc594558b, 0xc4ffefc1,
+0xe63741e2, 0xa57ff9c5, 0xffffff58, 0xff689589,
+0xd089ffff, 0x891ff8c1, 0xffff6c85, 0x0040b8ff,
+0xfac50000, 0xff68a57e, 0xd029ffff, 0xe4d3c9c5,
+0xa57ff9c5, 0xffffff68, 0xf06ef9c5, 0xa56ff9c5,
+0xffffff58, 0xf6f3d9c5, 0xb5ebc9c5, 0xffffff68,
+0xf6d4c9c5, 0x000609b8, 0x49e2c400, 0xc4a87529,
+0xf11779e2, 0x0188830f, 0xe9c50000, 0xff7895d4,
+0xe9c5ffff, 0xc520f273, 0xc5d2d4d1, 0xe86d6ff9,
+0x3751e2c4, 0xdbd1c5ef, 0x7ff9c5ea, 0xe2c4b86d,
+0xe86547d1, 0x156ff9c5, 0x00100510, 0x7d6ff9c5,
+0xfbc1c5e8, 0x7ff9c5f2, 0xe2c4e875, 0xe86d47d1,
+0x000621b8, 0x7ff9c500, 0xd1c5a86d, 0xe2c4edd4,
+0xc4ec2951, 0xe91779e2, 0x0124830f, 0xf9c50000,
+0x0520256f, 0xf9c50010, 0xc4a86d6f, 0x6545d9e2,
+0xd1e2c4e8, 0xb8e84d45, 0x00000626, 0xcceff1c5,
+0xccfbf1c5, 0xe476d9c5, 0x2971e2c4, 0xe2c4b84d,
+0x0fcc1779, 0x0000e983, 0x064eb800, 0xf9c50000,
+0x4ec86d70, 0x4d6ff9c5, 0x71e2c4d8, 0xe2c4ed29,
+0x0fec1779, 0x0000c983, 0x6cf1c500, 0xf1c5c87d,
+0xc5c84d6d, 0xc5f9fbc1, 0x20d373c9, 0xd773f1c5,
+0xf4c9c520, 0xf4f1c5f7, 0xf4c1c5cb, 0xd4f1c5eb,
+0x06a8b8ce, 0xf1c50000, 0xc520f173, 0xc4c9d4d1,
+0xca2971e2, 0x1779e2c4, 0x83830fcc, 0xc5000000,
+0xc86d6ff9, 0x4d7efac5, 0x7ff9c5e0, 0x2ab8a86d,
+0xc5000007, 0xb04dd6f9, 0x6d6ff9c5, 0xeff1c5d8,
+0x61e2c4c9, 0xe3c4d937, 0xc84d4c51, 0x6ff9c530,
+0xe2c4a85d, 0xc4c92961, 0xcc1779e2, 0x3ab84473,
+0xc5000007, 0xc84d6ff9, 0x0e71e3c4, 0xc4f0d86d,
+0xdd2961e2, 0x1779e2c4, 0xc42773dc, 0xd90f71e3,
+0xc5c03108, 0xc5cadbf1, 0xc4cad4f1, 0xcb2971e2,
+0x1779e2c4, 0xc0920fcc, 0x1901f883, 0x074a25c0,
+0xc3c90000, 0x00000000, 0x00000000, 0x00000000,
+0x00000002, 0x00000000, 0x00000002, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x80000000,
+0xffffffff, 0xffffffff,
+0002470,
+};
+asm(".type avx2_x86_32_D_16i8, STT_NOTYPE;");
+asm(".type avx2_x86_32_D_16i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_16u8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0xec81e589, 0x00000088, 0x31cc4589, 0x89d231c0,
+0xc031d445, 0x4589c931, 0xc7c031e4, 0x0001c845,
+0x45c70000, 0x000002d8, 0xdc558900, 0x3fe845c7,
+0x89000000, 0x45c7ec4d, 0x000002d0, 0xe045c700,
+0x00000001, 0x3ef045c7, 0x89000000, 0xf9c5f445,
+0xc5c8756f, 0x98757ff9, 0xc976f1c5, 0x5d6ff9c5,
+0x0539b898, 0xe2c40000, 0xc4d62961, 0xd11779e2,
+0x02e5830f, 0xe1c50000, 0xc5c855d4, 0xa8557ff9,
+0x7d6ff9c5, 0x73e9c5c8, 0x3fb801f7, 0xc4000005,
+0x552969e2, 0x79e2c4a8, 0x830fd117, 0x000002bb,
+0x756ff9c5, 0xfbc9c5a8, 0xf9c5c855, 0xb8b8557f,
+0x00000544, 0x2961e2c4, 0xe2c4b865, 0x0fe11779,
+0x00029683, 0xebe1c500, 0xf9c5d85d, 0xc5985d7f,
+0xd855dbe9, 0x7d6ff9c5, 0xefc1c5b8, 0x50b8d85d,
+0xc5000005, 0xc5d1efe9, 0x9855dbe9, 0x2969e2c4,
+0x79e2c4d3, 0x830fd117, 0x0000025f, 0x556ff9c5,
+0x6ff9c5c8, 0xe1c5d875, 0xc520d273, 0xd85df4e1,
+0xd673d1c5, 0xf4e9c520, 0xd1c5d865, 0xe1c5eaf4,
+0xe1c5ddd4, 0xc520f373, 0xb8dbd4d9, 0x000005c8,
+0x2961e2c4, 0x1003701d, 0x79e2c400, 0x830fd917,
+0x00000217, 0x557ff9c5, 0x6ff9c5b8, 0xd9c5b87d,
+0xc503f773, 0x98657ff9, 0x6d6ff9c5, 0x73e1c5b8,
+0xf9c502f5, 0xc5a85d7f, 0xb8dbd4e1, 0x000005ed,
+0x2961e2c4, 0x79e2c4dc, 0x830fd917, 0x000001db,
+0x756ff9c5, 0x73e1c598, 0xe1c502d6, 0xf2b8dbd4,
+0xc4000005, 0x5d2961e2, 0x79e2c4a8, 0x830fd917,
+0x000001b7, 0x039445c7, 0xc5000000, 0x945d6ef9,
+0xdbf3e9c5, 0x029445c7, 0xc5000000, 0x94656ef9,
+0xd4f3e9c5, 0x557ff9c5, 0xd4e9c5a8, 0x0605b8d2,
+0xe2c40000, 0xc4d32969, 0xd11779e2, 0x0179830f,
+0xf9c50000, 0xc594556e, 0xc5d2d3e1, 0xb8d2d4e9,
+0x00000609, 0x2969e2c4, 0xe2c4a855, 0x0fd11779,
+0x00015683, 0xefe1c500, 0x61e2c4db, 0xc4e85529,
+0xd32969e2, 0x55dbe9c5, 0x7ff9c5c8, 0xe2c4b855,
+0xe85d47e9, 0x65d4f1c5, 0x7ff9c5e8, 0xe2c4e865,
+0xe85547e9, 0x000621b8, 0x7ff9c500, 0xe9c5a855,
+0xe2c4d2d4, 0xc4d32969, 0xd11779e2, 0x0109830f,
+0xf9c50000, 0xc4a87d6f, 0x5545c1e2, 0x0626b8e8,
+0xe2c40000, 0xb8552969, 0x1779e2c4, 0xe8830fd1,
+0xb8000000, 0x0000064e, 0x5d70f9c5, 0xf9c54ec8,
+0xc4d8556f, 0xdb2969e2, 0x1779e2c4, 0xc8830fd9,
+0xc7000000, 0xffff8045, 0x45c7ffff, 0xffffff84,
+0x7efac5ff, 0xfac5805d, 0xe9c5db7e, 0xc5c8656c,
+0xc8556de9, 0xd2d4f1c5, 0x0006a8b8, 0xfbe9c500,
+0xefe1c5d4, 0xefe9c5e1, 0xfbe9c5d3, 0x6ff9c5d4,
+0x10038025, 0x69e2c400, 0xe2c4d429, 0x73d11779,
+0x7efac57a, 0xf9c5e055, 0xc5c86d6f, 0xd8756ff9,
+0x6d7ff9c5, 0x072ab8a8, 0xf9c50000, 0xc4b055d6,
+0x554c49e3, 0xf9c530c8, 0xc4a85d6f, 0xd22961e2,
+0x1779e2c4, 0xb84473d1, 0x0000073a, 0x556ff9c5,
+0x69e3c4c8, 0xf0d86d0e, 0x2961e2c4, 0x79e2c4dd,
+0x2773d917, 0x0f69e3c4, 0xc03108da, 0xd4dbe9c5,
+0xd4d4e9c5, 0x2969e2c4, 0x79e2c4d3, 0x920fd117,
+0x01f883c0, 0x4a25c019, 0xc9000007, 0x000000c3,
+0x00000002, 0x00000000, 0x00000002, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0001620,
+};
+asm(".type avx2_x86_32_D_16u8, STT_NOTYPE;");
+asm(".type avx2_x86_32_D_16u8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_16f4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xe8d955c3,
+0xec83e589, 0xc855d978, 0x04c005d9, 0x55d90010,
+0xd9c9d9d8, 0x05d9e855, 0x00100510, 0xd9cc55d9,
+0x1004c405, 0xdc55d900, 0xe0d9e8d9, 0xd9ec55d9,
+0xd05dd9c9, 0x5dd9c9d9, 0xd9c9d9e0, 0xcad9f055,
+0xd9d45dd9, 0xe45dd9c9, 0xc5f45dd9, 0xc87d28f8,
+0x7d29f8c5, 0x28f8c598, 0xf1c59855, 0x39b8c976,
+0xc5000005, 0x00dfc2e8, 0x0e79e2c4, 0x36830fd9,
+0xc5000004, 0xc85d58e8, 0x5d29f8c5, 0x28f8c5a8,
+0x3fb8c87d, 0xc5000005, 0xc5df58c0, 0xa85dc2e0,
+0x79e2c400, 0x830fd90e, 0x0000040d, 0x6528f8c5,
+0x5cd8c5a8, 0xf8c5c85d, 0xc5b85d29, 0xb85dc2e8,
+0x0544b800, 0xe2c40000, 0x0fd90e79, 0x0003e883,
+0x28f8c500, 0xe8c5d87d, 0xc5c85559, 0xc5e759c0,
+0xc85d28f8, 0xf758e0c5, 0x6d5ce0c5, 0x055bb8d8,
+0xe8c50000, 0xd0c5d45c, 0xe8c5ee59, 0xc400d5c2,
+0xd10e79e2, 0x03af830f, 0xe0c50000, 0xc5e85559,
+0x985529f8, 0x5d5ee0c5, 0x0564b8e8, 0xe8c50000,
+0xc400d3c2, 0xd10e79e2, 0x038b830f, 0xe2c40000,
+0xcc1d1879, 0xb8001004, 0x00000567, 0x6528f8c5,
+0x57d8c5e8, 0x59e8c5d3, 0xe0c59855, 0xc5c85d57,
+0x00d3c2e8, 0x0e79e2c4, 0x5a830fd1, 0xc5000003,
+0xc8555bf9, 0xd25bf8c5, 0x55c2e8c5, 0x6eb800c8,
+0xc4000005, 0xd10e79e2, 0x033b830f, 0xf8c50000,
+0xc5c85553, 0x985529f8, 0x5553f8c5, 0x0575b898,
+0xf8c50000, 0xc5c85d28, 0xc5d25bf9, 0xc5d25bf8,
+0x00d3c2e8, 0x0e79e2c4, 0x0a830fd1, 0xc5000003,
+0xc5d359e0, 0x985529f8, 0x5552f8c5, 0x29f8c598,
+0xf8c5a855, 0xb8a85528, 0x0000057c, 0xea53f8c5,
+0xed5bf9c5, 0xed5bf8c5, 0xddc2e0c5, 0x79e2c400,
+0x830fd90e, 0x000002d1, 0xda5bf9c5, 0x5528f8c5,
+0x057eb8c8, 0xf8c50000, 0xf8c5db5b, 0xf9c5ea53,
+0xf8c5ed5b, 0xe0c5ed5b, 0xc400ddc2, 0xd90e79e2,
+0x02a3830f, 0xe8c50000, 0xf8c5da59, 0xc5985d29,
+0x985d51f8, 0x00059cb8, 0xc2e0c500, 0xe2c400da,
+0x0fd90e79, 0x00028083, 0x79e2c400, 0x04e02d18,
+0xd0c50010, 0xf8c5da5e, 0xc4985d29, 0x5d0879e3,
+0xe0c50b98, 0x04e01dc2, 0xb8000010, 0x000005a4,
+0x0e79e2c4, 0x4e830fd9, 0xc5000002, 0xd85d59d8,
+0xf259d8c5, 0x5d29f8c5, 0x5fc8c5a8, 0xc8c5a85d,
+0xc5a8755d, 0xa87529f8, 0x5d58e0c5, 0x063db8a8,
+0xe8c50000, 0xc5d85558, 0xc5dc59e0, 0x00d2c2e0,
+0x0e79e2c4, 0x0e830fd1, 0xc4000002, 0x550479e3,
+0x4eb81bc8, 0xc5000006, 0xd855c2e8, 0x79e2c400,
+0x830fd10e, 0x000001f1, 0x5528f8c5, 0x0001b8d8,
+0xf9c50000, 0xf9c5f86e, 0xb800ff70, 0x00000653,
+0x7528f8c5, 0x5bf9c5c8, 0xfae1c5da, 0x49e2c4df,
+0xe8c5db0c, 0xc400dbc2, 0xd90e79e2, 0x01b7830f,
+0xe8c50000, 0x5db8f658, 0xc5000006, 0x0035c2c8,
+0x00001005, 0x0e79e2c4, 0x9a830ff1, 0xc5000001,
+0xc85d14e8, 0x7515e8c5, 0x5ce0c5c8, 0x06a6b8de,
+0xe0c50000, 0xe0c5dc59, 0x05101dc2, 0xc4000010,
+0xd90e79e2, 0x016f830f, 0xfac50000, 0xc4c85d12,
+0x351879e2, 0x001004c8, 0x000717b8, 0x58c8c500,
+0x79e2c4f4, 0x04d03d18, 0xc8c50010, 0xe0c5f759,
+0xc5c85d5c, 0x00dec2e0, 0x0e79e2c4, 0x36830fd9,
+0xc5000001, 0xc85d16fa, 0xed58d8c5, 0x00071eb8,
+0x28f8c500, 0xd0c5c875, 0xe0c5ef59, 0xe0c5de5c,
+0xc400ddc2, 0xd90e79e2, 0x010b830f, 0x45d90000,
+0x57e0c5dc, 0x072ab8db, 0xf8c50000, 0xc5a87529,
+0x01dcc2e0, 0xd9ac5dd9, 0x5dd9e445, 0x69e3c4b4,
+0xc530d64a, 0xa85d28f8, 0xd2c2e0c5, 0x79e2c400,
+0x830fd10e, 0x000000d1, 0x6528f8c5, 0x073ab8c8,
+0xe3c40000, 0xd84d0c59, 0xc2e0c50a, 0xe1c500c9,
+0xe2c4db76, 0x0fcb0e79, 0x0000ac83, 0x28f8c500,
+0xdbc5c865, 0xc5d84dd0, 0xc87d28f8, 0x000743b8,
+0xd0c3c500, 0xf0c5d855, 0xc400cac2, 0xcb0e79e2,
+0x0083830f, 0xf8c50000, 0xb8c85528, 0x00000752,
+0x4069e3c4, 0xc5f1d84d, 0xf00dc2f0, 0x00001004,
+0x0e79e2c4, 0xc56273cb, 0x985529f8, 0xd257e8c5,
+0x4d7cebc5, 0x29f8c598, 0xebc5984d, 0xd9984d7c,
+0x1004d405, 0x79e3c400, 0x03944d17, 0xdf9445d9,
+0x7ad8dde9, 0xc52d752f, 0xc86528f8, 0xdbc5c031,
+0xc5d84d7d, 0xc5ca7cf3, 0xc5ca7cf3, 0x00cac2f0,
+0x0e79e2c4, 0xc0920fcb, 0x1901f883, 0x076725c0,
+0x05eb0000, 0x00075eb8, 0x00c3c900, 0x00000000,
+0x40800000, 0x40400000, 0xbf800000, 0x80000000,
+0x3f000000, 0x41200000, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x41a00000, 0x00000000, 0x00000000, 0x00000000,
+0x40a00000, 0x40a00000, 0x40a00000, 0x40a00000,
+0x40000000, 0x40000000, 0x40000000, 0x40000000,
+0002440,
+};
+asm(".type avx2_x86_32_D_16f4, STT_NOTYPE;");
+asm(".type avx2_x86_32_D_16f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_16f8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0xe589e8d9, 0xdd78ec83, 0x05d9c855, 0x00100470,
+0xd9d855dd, 0xf04589c9, 0xd9e855dd, 0xf445c7c9,
+0xbff00000, 0xddd05ddd, 0xf9c5e05d, 0xc5c87d28,
+0x987d29f9, 0xc976f1c5, 0x5528f9c5, 0x0539b898,
+0xe9c50000, 0xc400dfc2, 0xd90f79e2, 0x0406830f,
+0xe9c50000, 0xc5c85d58, 0xa85d29f9, 0x00053fb8,
+0x28f9c500, 0xc1c5c87d, 0xe1c5df58, 0x00a85dc2,
+0x0f79e2c4, 0xdd830fd9, 0xc5000003, 0xa87d28f9,
+0x5d5cc1c5, 0x29f9c5c8, 0x44b8b85d, 0xc5000005,
+0xb85dc2e9, 0x79e2c400, 0x830fd90f, 0x000003b8,
+0x7d28f9c5, 0x59e9c5d8, 0xc1c5c855, 0xf9c5e759,
+0xc5c85d28, 0xb8f758e1, 0x0000055b, 0x6d5ce1c5,
+0x5ce9c5d8, 0x59d1c5d4, 0xc2e9c5ee, 0xe2c400d5,
+0x0fd10f79, 0x00037f83, 0x59e1c500, 0xf9c5e855,
+0xb8985529, 0x00000564, 0x5d5ee1c5, 0xc2e9c5e8,
+0xe2c400d3, 0x0fd10f79, 0x00035b83, 0x12fbc500,
+0x10047825, 0x28f9c500, 0x67b8e85d, 0xc5000005,
+0xc5d457e1, 0xc86557d9, 0x5559e9c5, 0xc2e9c598,
+0xe2c400d4, 0x0fd10f79, 0x00032b83, 0xe6fbc500,
+0xfac5c855, 0x6eb8d2e6, 0xc5000005, 0xc855c2e9,
+0x79e2c400, 0x830fd10f, 0x0000030c, 0x555af9c5,
+0x53f8c5c8, 0x5af8c5d2, 0x29f9c5d2, 0xf9c59855,
+0xc598555a, 0xc5d253f8, 0xc86528f9, 0x000575b8,
+0x5af8c500, 0xe6fbc5d2, 0xe6fac5d2, 0xc2e9c5d2,
+0xe2c400d4, 0x0fd10f79, 0x0002cb83, 0x59d9c500,
+0x29f9c5d4, 0xf9c59855, 0xc598555a, 0xc5d252f8,
+0xc5d25af8, 0xa85529f9, 0x6d28f9c5, 0x5af9c5a8,
+0x057cb8d5, 0xf8c50000, 0xf8c5d253, 0xfbc5d25a,
+0xfac5d2e6, 0xd9c5d2e6, 0xc400e2c2, 0xe10f79e2,
+0x0282830f, 0xf9c50000, 0xc5c86528, 0xc5d45af9,
+0xb8ede6fb, 0x0000057e, 0xede6fac5, 0xd253f8c5,
+0xd25af8c5, 0xd2e6fbc5, 0xd2e6fac5, 0xeac2d1c5,
+0x79e2c400, 0x830fe90f, 0x0000024c, 0xd459d9c5,
+0x5529f9c5, 0x059cb898, 0xf9c50000, 0xc5985551,
+0x00d4c2e9, 0x0f79e2c4, 0x29830fd1, 0xc5000002,
+0x902d12fb, 0xc5001004, 0xc5d45ed1, 0x985529f9,
+0x0005a4b8, 0x79e3c400, 0x0b985509, 0x15c2e9c5,
+0x00100490, 0x79e2c400, 0x830fd10f, 0x000001f8,
+0x5559e1c5, 0x59e1c5d8, 0x29f9c5f4, 0xc9c5a855,
+0xc5a8555f, 0xa8755dc9, 0x7529f9c5, 0x063db8a8,
+0xe9c50000, 0xc5a85558, 0xd86558d9, 0xd359e9c5,
+0xd4c2e9c5, 0x79e2c400, 0x830fd10f, 0x000001b8,
+0x00064eb8, 0x79e3c400, 0x01c85505, 0x55c2e9c5,
+0xe2c400d8, 0x0fd10f79, 0x00019b83, 0x0001b800,
+0xf9c50000, 0xc5d85528, 0xc5e2e6fb, 0xc5f86ef9,
+0x00f770f9, 0xe6fad9c5, 0x2579e2c4, 0x73d9c5e4,
+0xf9c501f4, 0xb8c87d28, 0x00000653, 0x0d41e2c4,
+0xc2e9c5e4, 0xe2c400e4, 0x0fe10f79, 0x00015783,
+0x16e9c500, 0xf9c5c865, 0xc5c87d28, 0xb8f715e9,
+0x000006a8, 0xe65cd9c5, 0xe359d9c5, 0xe5c2d9c5,
+0x79e2c400, 0x830fe10f, 0x0000012c, 0x65120ff2,
+0x12fbc5c8, 0x1004802d, 0x28f9c500, 0xe1c5c875,
+0xd9c5ed58, 0xfbc5e65c, 0x04883d12, 0x17b80010,
+0xc5000007, 0xc5ef59d1, 0x00e5c2d9, 0x0f79e2c4,
+0xf1830fe1, 0xc5000000, 0xa87529f9, 0x7d10fbc5,
+0x57d9c5e0, 0x11fbc5e4, 0xd9c5b07d, 0xb801dbc2,
+0x0000072a, 0x4b69e3c4, 0xf9c530d6, 0xc5a85d28,
+0x00d2c2e1, 0x0f79e2c4, 0xb9830fd1, 0xb8000000,
+0x0000073a, 0x7528f9c5, 0x49e3c4c8, 0x02d8550d,
+0xdac2e1c5, 0x79e2c400, 0x830fd90f, 0x00000098,
+0x7528f9c5, 0xd0c9c5c8, 0x43b8d855, 0xc5000007,
+0xc87d28f9, 0x5dd0c1c5, 0xc2e9c5d8, 0xe2c400d3,
+0x73d10f79, 0x76e1c573, 0x28f9c5db, 0x52b8c855,
+0xc4000007, 0x4d4169e3, 0xf1c531d8, 0x04a00dc2,
+0xc4000010, 0xcb0f79e2, 0xf9c54e73, 0xc5985529,
+0x984d7cd9, 0x4d17f9c5, 0x7405d990, 0xdd001004,
+0xe9df9045, 0x2b7ad8dd, 0xc0312975, 0x7528f9c5,
+0x7dc9c5c8, 0xf1c5d84d, 0xf1c5cc7c, 0xc400ccc2,
+0xcb0f79e2, 0x83c0920f, 0xc01901f8, 0x00076725,
+0xb805eb00, 0x0000075e, 0x0000c3c9, 0x00000000,
+0x40000000, 0x40400000, 0x00000000, 0x80000000,
+0x00000000, 0xbff00000, 0x00000000, 0x3fe00000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x40100000, 0x00000000, 0x00000000,
+0002260,
+};
+asm(".type avx2_x86_32_D_16f8, STT_NOTYPE;");
+asm(".type avx2_x86_32_D_16f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_32i1[] = {
+0xb25500eb, 0xb9e58901, 0x00000008, 0x53f63156,
+0xe48321b3, 0x40ec81e0, 0x88000002, 0x01c03494,
+0xd8880000, 0x8488d028, 0x0001e034, 0x83f08900,
+0xf88301e0, 0x24c01901, 0x88c8fe02, 0x02003484,
+0x468d0000, 0x83c62101, 0xd98301fe, 0x88c2fe00,
+0x021f048c, 0xf8830000, 0x89047420, 0xc5bcebc6,
+0x24ac6ffd, 0x000001c0, 0xac7ffdc5, 0x00016024,
+0x0539b800, 0xfdc50000, 0x6024946f, 0xc5000001,
+0xc4cd74ed, 0x0d177de2, 0x00100ba0, 0x0ab7830f,
+0xedc50000, 0xc0248cfc, 0xc5000001, 0x248c7ffd,
+0x00000180, 0xb46ffdc5, 0x0001c024, 0xfccdc500,
+0x053fb8ce, 0xf5c50000, 0x80248c74, 0xc4000001,
+0x0d177de2, 0x00100ba0, 0x0a7b830f, 0xfdc50000,
+0x8024bc6f, 0xc5000001, 0x248cf8c5, 0x000001c0,
+0x8c7ffdc5, 0x0001a024, 0x0544b800, 0xedc50000,
+0xa0249474, 0xc4000001, 0x15177de2, 0x00100ba0,
+0x0a43830f, 0xfdc50000, 0x0024bc6f, 0xc5000002,
+0x24ac6ffd, 0x000001c0, 0xf760c5c5, 0xac7ffdc5,
+0x00012024, 0x7ffdc500, 0x00e024b4, 0xc5c50000,
+0xfdc5ef68, 0x2024b46f, 0xc5000001, 0x24ac7ffd,
+0x000000c0, 0xce60cdc5, 0xd668cdc5, 0x8cd5f5c5,
+0x0000e024, 0x6ffdc500, 0x022024bc, 0xedc50000,
+0xc02494d5, 0xc4000000, 0x0d0075e2, 0x00100b60,
+0x006de2c4, 0x100b8015, 0x75e3c400, 0xc5ccf202,
+0xc5c9eff1, 0x24b47ffd, 0x00000100, 0xc964c5c5,
+0x9cdbf5c5, 0x00010024, 0x7ffdc500, 0x01a0249c,
+0x848a0000, 0x0001a024, 0x24848800, 0x00000140,
+0x20248c8a, 0x8a000002, 0x01a2249c, 0x948a0000,
+0x0001a424, 0x8ae0d200, 0x0221248c, 0x84880000,
+0x0000a024, 0x24848a00, 0x000001a1, 0x8c8ae0d2,
+0x00022224, 0x24848800, 0x00000080, 0xa324848a,
+0xd2000001, 0x248c8ae3, 0x00000223, 0xcb6ef9c5,
+0x8c8ae0d2, 0x00022424, 0x24448800, 0x24848a70,
+0x000001a5, 0x8c8ae2d2, 0x00022524, 0x8ae0d200,
+0x0226248c, 0x44880000, 0x848a6c24, 0x0001a624,
+0x8ae0d200, 0x0227248c, 0x44880000, 0x848a6824,
+0x0001a724, 0x8ae0d200, 0x0228248c, 0x44880000,
+0x848a6424, 0x0001a824, 0x8ae0d200, 0x0229248c,
+0x44880000, 0x848a6024, 0x0001a924, 0x8ae0d200,
+0x022a248c, 0x44880000, 0x848a5c24, 0x0001aa24,
+0x8ae0d200, 0x022b248c, 0x44880000, 0x848a5824,
+0x0001ab24, 0x88e0d200, 0x8a542444, 0x022c248c,
+0x848a0000, 0x0001ac24, 0x8ae0d200, 0x022d248c,
+0x44880000, 0x848a5024, 0x0001ad24, 0x8ae0d200,
+0x022e248c, 0x44880000, 0x848a4c24, 0x0001ae24,
+0x8ae0d200, 0x022f248c, 0x44880000, 0x848a4824,
+0x0001af24, 0x8ae0d200, 0x0230248c, 0x44880000,
+0x848a4424, 0x0001b024, 0x8ae0d200, 0x0231248c,
+0x44880000, 0x848a4024, 0x0001b124, 0x8ae0d200,
+0x0232248c, 0x44880000, 0x848a3f24, 0x0001b224,
+0x8ae0d200, 0x0233248c, 0x44880000, 0x848a3824,
+0x0001b324, 0x8ae0d200, 0x0234248c, 0x44880000,
+0x848a3e24, 0x0001b424, 0x8ae0d200, 0x0235248c,
+0x44880000, 0x848a3424, 0x0001b524, 0x8ae0d200,
+0x0236248c, 0x44880000, 0x848a3d24, 0x0001b624,
+0x88e0d200, 0x8a302444, 0x0237248c, 0xe3c40000,
+0x24642071, 0x848a0170, 0x0001b724, 0x24b48b00,
+0x000000a0, 0xa47ff9c5, 0x0000a024, 0x6ef9c500,
+0x59e3c4e2, 0x6c246420, 0x8ae0d201, 0x0238248c,
+0x44880000, 0x848a3c24, 0x0001b824, 0x6ef9c500,
+0x69e3c4d6, 0x80249420, 0x01000000, 0x8c8ae0d2,
+0x00023924, 0x24448800, 0x24848a2c, 0x000001b9,
+0x8c8ae0d2, 0x00023a24, 0x24448800, 0x24848a2b,
+0x000001ba, 0x8c8ae0d2, 0x00023b24, 0x24448800,
+0x24848a24, 0x000001bb, 0x8c8ae0d2, 0x00023c24,
+0x24448800, 0x24848a2a, 0x000001bc, 0x8c8ae0d2,
+0x00023d24, 0x24448800, 0x24848a20, 0x000001bd,
+0x8c8ae0d2, 0x00023e24, 0x24448800, 0x24848a29,
+0x000001be, 0x8c8ae0d2, 0x00023f24, 0x24448800,
+0x24848a1c, 0x000001bf, 0xc188e0d2, 0x6824448b,
+0xf86ef9c5, 0x2041e3c4, 0x0164247c, 0x6024448b,
+0x9461e9c5, 0x0000a024, 0x61d9c500, 0x62e9c5e7,
+0x6ef9c5d4, 0x24448bc8, 0x71e3c458, 0x5c244c20,
+0x6ef9c501, 0x24448bf0, 0x49e3c450, 0x54247420,
+0x61f1c501, 0x6ef9c5ce, 0x24448bd8, 0x61e3c448,
+0x4c245c20, 0x6ef9c501, 0x24448be8, 0x51e3c440,
+0x44246c20, 0x61e1c501, 0x62f1c5dd, 0x6ce9c5cb,
+0x7ff9c5e9, 0x00a024ac, 0xf9c50000, 0x448bc86e,
+0xe3c43824, 0x244c2071, 0xf9c5013f, 0x448bd06e,
+0xe3c43424, 0x24742069, 0xf9c5013e, 0x8024b47f,
+0xc5000000, 0x248c61f1, 0x00000080, 0xe06ef9c5,
+0x3024448b, 0x2059e3c4, 0x013d2464, 0xf86ef9c5,
+0x2c24448b, 0x2041e3c4, 0x013c247c, 0xe761d9c5,
+0xcc62f1c5, 0xd06ef9c5, 0x2424448b, 0x2069e3c4,
+0x012b2454, 0xf06ef9c5, 0x2024448b, 0x2049e3c4,
+0x012a2474, 0xd661e9c5, 0xd86ef9c5, 0x1c24448b,
+0x2061e3c4, 0x0129245c, 0xe86ef9c5, 0x2051e3c4,
+0xe1c501e9, 0xe9c5dd61, 0xf9c5d362, 0xa0249c6f,
+0xc5000000, 0xc4ca6cf1, 0xf93865e3, 0x7ffdc501,
+0x008024bc, 0x01b00000, 0xac6ffdc5, 0x00022024,
+0x6ef9c500, 0x7de2c4e0, 0xd5c5e478, 0xfdc5ccf8,
+0xa024a47f, 0xc5000000, 0x248c7ffd, 0x00000220,
+0x20248c8a, 0x8a000002, 0x01402484, 0xe0d20000,
+0x21248c8a, 0x88000002, 0x01402484, 0x848a0000,
+0x0001a124, 0x8ae0d200, 0x0222248c, 0x44880000,
+0x848a7024, 0x0001a224, 0x8ae0d200, 0x0223248c,
+0x44880000, 0x848a6c24, 0x0001a324, 0x8ae0d200,
+0x0224248c, 0x44880000, 0x848a6824, 0x0001a424,
+0x8ae0d200, 0x0225248c, 0x44880000, 0x848a6424,
+0x0001a524, 0x8ae0d200, 0x0226248c, 0x44880000,
+0x848a6024, 0x0001a624, 0x8ae0d200, 0x0227248c,
+0x44880000, 0x848a5c24, 0x0001a724, 0x8ae0d200,
+0x0228248c, 0x44880000, 0x848a5824, 0x0001a824,
+0x8ae0d200, 0x0229248c, 0x44880000, 0x848a5424,
+0x0001a924, 0x8ae0d200, 0x022a248c, 0x44880000,
+0x848a5024, 0x0001aa24, 0x88e0d200, 0x8a4c2444,
+0x022b248c, 0x848a0000, 0x0001ab24, 0x249c8a00,
+0x000001ae, 0x8c8ae0d2, 0x00022c24, 0x24448800,
+0x24848a48, 0x000001ac, 0x8c8ae0d2, 0x00022d24,
+0x24448800, 0x24848a44, 0x000001ad, 0x8c8ae0d2,
+0x00022e24, 0x24448800, 0x24848a40, 0x000001af,
+0x8c8ae3d2, 0x00022f24, 0x6ef9c500, 0x8ae0d2eb,
+0x0230248c, 0x44880000, 0x848a3f24, 0x0001b024,
+0x8ae0d200, 0x0231248c, 0x44880000, 0x848a3824,
+0x0001b124, 0x8ae0d200, 0x0232248c, 0x44880000,
+0x848a3e24, 0x0001b224, 0x8ae0d200, 0x0233248c,
+0x44880000, 0x848a3424, 0x0001b324, 0x8ae0d200,
+0x0234248c, 0x44880000, 0x848a3d24, 0x0001b424,
+0x8ae0d200, 0x0235248c, 0x44880000, 0x848a3024,
+0x0001b524, 0x88e0d200, 0x8a3c2444, 0x0236248c,
+0x848a0000, 0x0001b624, 0x24948a00, 0x000001bc,
+0x4024b48b, 0xd2000001, 0x248c8ae0, 0x00000237,
+0x2c244488, 0xb724848a, 0xc5000001, 0x8bd66ef9,
+0xc46c2474, 0x542069e3, 0xd2017024, 0x248c8ae0,
+0x00000238, 0x2b244488, 0xb824848a, 0xc5000001,
+0xc4ce6ef9, 0x7c2071e3, 0xd2016824, 0x248c8ae0,
+0x00000239, 0x24244488, 0xb924848a, 0xd2000001,
+0x248c8ae0, 0x0000023a, 0x2a244488, 0xba24848a,
+0xd2000001, 0x248c8ae0, 0x0000023b, 0x20244488,
+0xbb24848a, 0xd2000001, 0x248c8ae0, 0x0000023c,
+0x29244488, 0xbd24848a, 0xd2000001, 0x248c8ae2,
+0x0000023d, 0x8c8ae0d2, 0x00023e24, 0x24448800,
+0x24848a1c, 0x000001be, 0x8c8ae0d2, 0x00023f24,
+0x24448800, 0x24848a18, 0x000001bf, 0xbc7ff9c5,
+0x00014024, 0x24748b00, 0x51e3c464, 0x3f246c20,
+0x61e9c501, 0x01402494, 0x5c8b0000, 0xe0d23824,
+0xe66ef9c5, 0x5c24748b, 0x2059e3c4, 0x01602464,
+0x448bc188, 0xf9c51824, 0x748bfe6e, 0xe3c45424,
+0x247c2041, 0xd9c50158, 0xe9c5e761, 0xf9c5d462,
+0x748bce6e, 0xe3c44c24, 0x244c2071, 0xf9c50150,
+0x748bf66e, 0xe3c44424, 0x24742049, 0xf1c50148,
+0xf9c5ce61, 0xe3c4de6e, 0x245c2061, 0xe1c50140,
+0xf1c5dd61, 0xe9c5cb62, 0xf9c5d96c, 0x5c8bcb6e,
+0xf9c53424, 0x40249c7f, 0xc5000001, 0xc4e86ef9,
+0x4c2071e3, 0xc4013e24, 0xe92051e3, 0x6ef9c501,
+0x61e3c4da, 0x1c245c20, 0x61e1c501, 0x6ff9c5dd,
+0x014024ac, 0x21b80000, 0xc5000006, 0x8bd36ef9,
+0xc430245c, 0x642069e3, 0xc5013d24, 0x24647ff9,
+0x61f1c570, 0xc570244c, 0x8be36ef9, 0xc42c245c,
+0x642059e3, 0xc5013c24, 0x8bfb6ef9, 0xc424245c,
+0x7c2041e3, 0xc5012b24, 0xc5e761d9, 0xc5cc62f1,
+0x8bd36ef9, 0xc420245c, 0x542069e3, 0xc5012a24,
+0xc4f36ef9, 0x742049e3, 0xc5012924, 0xc5d661e9,
+0xc5d362e9, 0xc4ca6cf1, 0xc93855e3, 0xfcf5c501,
+0x74f5c5c9, 0x0080248c, 0xe2c40000, 0xa00d177d,
+0x0f00100b, 0x00019083, 0x6ffdc500, 0x01e0249c,
+0xe5c50000, 0xe5c5d360, 0xedc5cb68, 0xe02494d5,
+0xc5000000, 0x24bc6ffd, 0x00000100, 0xbc7ffdc5,
+0x00016024, 0xd5f5c500, 0x00c0248c, 0xe2c40000,
+0x6015006d, 0xc400100b, 0x0d0075e2, 0x00100b80,
+0x026de3c4, 0xfdc5ccd1, 0x8024947f, 0xc4000001,
+0x8c3c45e2, 0x00018024, 0x45e2c400, 0x80249438,
+0xc5000001, 0x24947ffd, 0x00000180, 0x8cfcf5c5,
+0x00018024, 0x6ffdc500, 0x012024bc, 0x3db80000,
+0xc5000006, 0xc5d160f5, 0xc5c968f5, 0x2494d5ed,
+0x000000e0, 0x8cd5f5c5, 0x0000c024, 0x6de2c400,
+0x0b601500, 0xe2c40010, 0x800d0075, 0xc400100b,
+0xd1026de3, 0xfcc5c5cc, 0x74edc5cb, 0x7de2c4d1,
+0x0ba01517, 0x830f0010, 0x000000bd, 0x000644b8,
+0x7de2c400, 0x6024941c, 0xc5000001, 0xc4d774ed,
+0x15177de2, 0x00100ba0, 0x009b830f, 0x49b80000,
+0xc5000006, 0x24a46ffd, 0x000000a0, 0x085de2c4,
+0x02002494, 0xedc50000, 0x00249474, 0xc4000002,
+0x15177de2, 0x00100ba0, 0x84c66f73, 0x00015f24,
+0x5db82100, 0xc4000006, 0x94787de2, 0x00015f24,
+0x74f5c500, 0x7de2c4ca, 0x0ba00d17, 0x49730010,
+0xac6ffdc5, 0x00012024, 0x55e3c400, 0xc401d546,
+0x940f6de3, 0x00012024, 0x1fb00100, 0xc86ef9c5,
+0xe2c4c031, 0xc5c9787d, 0xc5cfdbf5, 0xc5ccfcf5,
+0xc4ca74f5, 0x0d177de2, 0x00100ba0, 0x83c0920f,
+0xc01901f8, 0x00074a25, 0xf8658d00, 0xc35d5e5b,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x06040200, 0x0e0c0a08, 0x0b0a0908, 0x0f0e0d0c,
+0x06040200, 0x0e0c0a08, 0x0b0a0908, 0x0f0e0d0c,
+0x03020100, 0x07060504, 0x06040200, 0x0e0c0a08,
+0x03020100, 0x07060504, 0x06040200, 0x0e0c0a08,
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+0005700,
+};
+asm(".type avx2_x86_32_D_32i1, STT_NOTYPE;");
+asm(".type avx2_x86_32_D_32i1, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_32u1[] = {
+0xb05500eb, 0xbae58901, 0x00000008, 0x53f63156,
+0xe48321b3, 0x80ec81e0, 0x88000001, 0x01003484,
+0xd9880000, 0x8c88c128, 0x00012034, 0x83f18900,
+0xc9fe01e1, 0x40348c88, 0x89000001, 0xf12146f1,
+0x8301f983, 0xc0fe00da, 0x5f349488, 0x83000001,
+0xc77520fe, 0xbc6ffdc5, 0x00010024, 0x7ffdc500,
+0x00a024bc, 0x39b80000, 0xc5000005, 0x24946ffd,
+0x000000a0, 0xcf74edc5, 0x177de2c4, 0x100a200d,
+0x8b830f00, 0xc5000009, 0x248cfced, 0x00000100,
+0x8c7ffdc5, 0x0000c024, 0x6ffdc500, 0x010024bc,
+0xc5c50000, 0x3fb8cffc, 0xc5000005, 0x248c74f5,
+0x000000c0, 0x177de2c4, 0x100a200d, 0x4f830f00,
+0xc5000009, 0x24b46ffd, 0x000000c0, 0x8cf8cdc5,
+0x00010024, 0x7ffdc500, 0x00e0248c, 0x44b80000,
+0xc5000005, 0x249c74ed, 0x000000e0, 0x177de2c4,
+0x100a201d, 0x17830f00, 0xc5000009, 0x2494ebed,
+0x00000120, 0x947ffdc5, 0x0000a024, 0xdbf5c500,
+0x0120248c, 0xfdc50000, 0xe024bc6f, 0xc5000000,
+0x2494efc5, 0x00000120, 0x000550b8, 0xdff5c500,
+0x00a0248c, 0xf5c50000, 0xe2c4ca74, 0x200d177d,
+0x0f00100a, 0x0008c983, 0xefe9c500, 0x74edc5d2,
+0x0160248c, 0xf5c50000, 0xf5c5ca74, 0x0024acdb,
+0xc5000001, 0x24ac7ffd, 0x000000e0, 0xe024848a,
+0x88000000, 0x00802484, 0x8c8a0000, 0x00016024,
+0x249c8a00, 0x000000ea, 0x8c8ae0d2, 0x00016124,
+0x24448800, 0x24848a60, 0x000000e1, 0x8c8ae0d2,
+0x00016224, 0x24448800, 0x24848a50, 0x000000e2,
+0x8c8ae0d2, 0x00016324, 0x24448800, 0x24848a4c,
+0x000000e3, 0x8c8ae0d2, 0x00016424, 0x24448800,
+0x24848a4b, 0x000000e4, 0x8c8ae0d2, 0x00016524,
+0x24448800, 0x24848a44, 0x000000e5, 0x8c8ae0d2,
+0x00016624, 0x24448800, 0x24848a40, 0x000000e6,
+0x8c8ae0d2, 0x00016724, 0x24448800, 0x24848a3c,
+0x000000e7, 0x8c8ae0d2, 0x00016824, 0x24448800,
+0x24848a38, 0x000000e8, 0x8c8ae0d2, 0x00016924,
+0x24448800, 0x24848a34, 0x000000e9, 0x8c8ae0d2,
+0x00016a24, 0x24448800, 0x8ae3d24a, 0x016b248c,
+0x848a0000, 0x0000eb24, 0x6ef9c500, 0x24948adb,
+0x000000ec, 0x8c8ae0d2, 0x00016c24, 0x24448800,
+0x24848a30, 0x000000ed, 0x8c8ae2d2, 0x00016d24,
+0x8ae0d200, 0x016e248c, 0x44880000, 0x848a4924,
+0x0000ee24, 0x8ae0d200, 0x016f248c, 0x44880000,
+0x848a2c24, 0x0000ef24, 0x8ae0d200, 0x0170248c,
+0x44880000, 0x848a4824, 0x0000f024, 0x8ae0d200,
+0x0171248c, 0x44880000, 0x848a2824, 0x0000f124,
+0x8ae0d200, 0x0172248c, 0x44880000, 0x848a2724,
+0x0000f224, 0x8ae0d200, 0x0173248c, 0x44880000,
+0x848a2024, 0x0000f324, 0x8ae0d200, 0x0174248c,
+0x44880000, 0x848a2624, 0x0000f424, 0x8ae0d200,
+0x0175248c, 0x44880000, 0x848a1c24, 0x0000f524,
+0x8ae0d200, 0x0176248c, 0x44880000, 0x848a2524,
+0x0000f624, 0x24748b00, 0x8ae0d260, 0x0177248c,
+0x44880000, 0x848a1824, 0x0000f724, 0x6ef9c500,
+0x24748bce, 0x71e3c44c, 0x50244c20, 0x8ae0d201,
+0x0178248c, 0x44880000, 0x848a2424, 0x0000f824,
+0x6ef9c500, 0x41e3c4fe, 0x4b247c20, 0x61f1c501,
+0x8ae0d2cf, 0x0179248c, 0x44880000, 0x848a1424,
+0x0000f924, 0x8ae0d200, 0x017a248c, 0x44880000,
+0x848a1324, 0x0000fa24, 0x8ae0d200, 0x017b248c,
+0x44880000, 0x848a0c24, 0x0000fb24, 0x8ae0d200,
+0x017c248c, 0x44880000, 0x848a1224, 0x0000fc24,
+0x8ae0d200, 0x017d248c, 0x44880000, 0x848a0824,
+0x0000fd24, 0x8ae0d200, 0x017e248c, 0x44880000,
+0x848a1124, 0x0000fe24, 0x8ae0d200, 0x017f248c,
+0x44880000, 0x848a0424, 0x0000ff24, 0x24748b00,
+0x61e3c444, 0x30246c20, 0x7ff9c501, 0xc560246c,
+0xc4da6ef9, 0x5c2061e3, 0xd2014924, 0x8bc188e0,
+0xc52c2444, 0x8bf66ef9, 0xc43c2474, 0x742049e3,
+0xc5014024, 0x8be86ef9, 0xc4282444, 0x6c2051e3,
+0xc5014824, 0xc5dd61e1, 0x8be66ef9, 0xc4342474,
+0x642059e3, 0xc5013824, 0xc5e461c9, 0xc5cc62f1,
+0x8be86ef9, 0xc4202444, 0x6c2051e3, 0xc5012724,
+0xc4d66ef9, 0x542069e3, 0xc5014a24, 0x245461e9,
+0x62e9c560, 0x6cf1c5d3, 0x6ef9c5ca, 0x24448be0,
+0x59e3c41c, 0x26246420, 0x61d1c501, 0x6ef9c5ec,
+0x24448bd8, 0x61e3c418, 0x25245c20, 0x6ef9c501,
+0x24448bd0, 0x69e3c414, 0x24247420, 0x7ff9c501,
+0xc5602474, 0x245c61e1, 0x62d1c560, 0x6ef9c5eb,
+0x24448bf0, 0x49e3c40c, 0x13247420, 0x6ef9c501,
+0x24448bd0, 0x69e3c408, 0x12247c20, 0x7ff9c501,
+0xc550247c, 0x247461c9, 0x6ef9c550, 0x24448bf8,
+0x41e3c404, 0x11247c20, 0x6ef9c501, 0x69e3c4d0,
+0xc501d120, 0xc5fa61c1, 0xc5f762c9, 0xc4ee6cd1,
+0xf53875e3, 0x7ffdc501, 0xc5602474, 0xc5c976f5,
+0x248cfcf5, 0x00000160, 0x8c7ffdc5, 0x00016024,
+0x248c8a00, 0x00000160, 0x8024848a, 0x8a000000,
+0x00e4249c, 0x948a0000, 0x0000ea24, 0x8ae0d200,
+0x0161248c, 0x84880000, 0x00008024, 0x24848a00,
+0x000000e1, 0x8c8ae0d2, 0x00016224, 0x24448800,
+0x24848a50, 0x000000e2, 0x8c8ae0d2, 0x00016324,
+0x24448800, 0x24848a4c, 0x000000e3, 0x8c8ae0d2,
+0x00016424, 0x24448800, 0x24848a4b, 0x000000e5,
+0x8c8ae3d2, 0x00016524, 0x6ef9c500, 0x8ae0d2e3,
+0x0166248c, 0x44880000, 0x848a4424, 0x0000e624,
+0x8ae0d200, 0x0167248c, 0x44880000, 0x848a4024,
+0x0000e724, 0x8ae0d200, 0x0168248c, 0x44880000,
+0x848a3c24, 0x0000e824, 0x8ae0d200, 0x0169248c,
+0x44880000, 0x848a3824, 0x0000e924, 0x8ae0d200,
+0x016a248c, 0x44880000, 0xe2d23424, 0x6b248c8a,
+0x8a000001, 0x00eb2484, 0xf9c50000, 0xe0d2da6e,
+0x6c248c8a, 0x88000001, 0x8a4a2444, 0x00ec2484,
+0xe0d20000, 0x6d248c8a, 0x88000001, 0x8a302444,
+0x00ed2484, 0xe0d20000, 0x6e248c8a, 0x88000001,
+0x8a492444, 0x00ee2484, 0xe0d20000, 0x6f248c8a,
+0x88000001, 0x8a2c2444, 0x00ef2484, 0xe0d20000,
+0x70248c8a, 0x88000001, 0x8a482444, 0x00f02484,
+0xe0d20000, 0x71248c8a, 0x88000001, 0x8a282444,
+0x00f12484, 0xe0d20000, 0x72248c8a, 0x88000001,
+0x8a272444, 0x00f22484, 0xe0d20000, 0x73248c8a,
+0x88000001, 0x8a202444, 0x00f32484, 0xe0d20000,
+0x74248c8a, 0x88000001, 0x8a262444, 0x00f42484,
+0xe0d20000, 0x75248c8a, 0x88000001, 0x8a1c2444,
+0x00f52484, 0xe0d20000, 0x25244488, 0x76248c8a,
+0x8a000001, 0x00f62484, 0xb48b0000, 0x00008024,
+0x8ae0d200, 0x0177248c, 0x44880000, 0x848a1824,
+0x0000f724, 0x6ef9c500, 0x24748bd6, 0x69e3c44c,
+0x50245420, 0x8ae0d201, 0x0178248c, 0x44880000,
+0x848a2424, 0x0000f824, 0x6ef9c500, 0x8ae0d2fe,
+0x0179248c, 0x44880000, 0x848a1424, 0x0000f924,
+0x8ae0d200, 0x017a248c, 0x44880000, 0x848a1324,
+0x0000fa24, 0x8ae0d200, 0x017b248c, 0x44880000,
+0x848a0c24, 0x0000fb24, 0x8ae0d200, 0x017c248c,
+0x44880000, 0x848a1224, 0x0000fc24, 0x8ae0d200,
+0x017d248c, 0x44880000, 0x848a0824, 0x0000fd24,
+0x8ae0d200, 0x017e248c, 0x44880000, 0x848a1124,
+0x0000fe24, 0x8ae0d200, 0x017f248c, 0x44880000,
+0x848a0424, 0x0000ff24, 0x41e3c400, 0x4b247c20,
+0x61e3c401, 0x4a246c20, 0x245c8b01, 0x7ff9c540,
+0x008024ac, 0xe3c40000, 0x24642059, 0xe9c50144,
+0xe0d2d761, 0x448bc188, 0xf9c53024, 0x5c8bf36e,
+0xe3c43824, 0x24742049, 0xd9c5013c, 0xe9c5e661,
+0xf9c5d462, 0x448bd86e, 0xe3c42c24, 0x245c2061,
+0xf9c50149, 0xe3c4cb6e, 0x244c2071, 0xf1c50134,
+0x80248c61, 0xc5000000, 0x8be86ef9, 0xc4282444,
+0x6c2051e3, 0xc5014824, 0xc5dd61e1, 0xc5cb62f1,
+0xc5f96ce9, 0x8bc86ef9, 0xc4202444, 0x4c2071e3,
+0xc5012724, 0x8bd06ef9, 0xc41c2444, 0x742069e3,
+0xc5012624, 0x24b47ff9, 0x00000080, 0x8c61f1c5,
+0x00008024, 0x6ef9c500, 0x24448be0, 0x59e3c418,
+0x25246420, 0x6ef9c501, 0x24448bd0, 0x69e3c414,
+0x24246c20, 0x7ff9c501, 0xc550246c, 0x246461d9,
+0x62f1c550, 0x6ef9c5cc, 0x24448bd0, 0x69e3c40c,
+0x13245420, 0x6ef9c501, 0x24448bf0, 0x49e3c408,
+0x12247420, 0x61e9c501, 0x6ef9c5d6, 0x24448be8,
+0x51e3c404, 0x11246c20, 0x6ef9c501, 0x61e3c4d8,
+0xc501d920, 0xc5db61d1, 0xc5d362e9, 0xc4ca6cf1,
+0xc93845e3, 0xfcf5c501, 0x0621b8c9, 0xf5c50000,
+0x60244c74, 0x177de2c4, 0x100a200d, 0xcf830f00,
+0xc5000000, 0x248c6ffd, 0x00000100, 0x94daf5c5,
+0x00012024, 0xdef5c500, 0x0120249c, 0xedc50000,
+0x34b8d3fc, 0xc5000006, 0x249cfcf5, 0x00000120,
+0xd374edc5, 0x177de2c4, 0x100a2015, 0x8f830f00,
+0xb0000000, 0x6ef9c501, 0x0649b8d0, 0xe2c40000,
+0xc4d2787d, 0xa4086de2, 0x00014024, 0x74ddc500,
+0x014024a4, 0xe2c40000, 0x2025177d, 0x7300100a,
+0x2484c661, 0x0000009f, 0x065db821, 0xe2c40000,
+0x24a4787d, 0x0000009f, 0xdc74e5c5, 0x177de2c4,
+0x100a201d, 0xb03b7300, 0x75e3c41f, 0xc401d946,
+0xd90f65e3, 0x6ef9c501, 0xc4c031e0, 0xe4787de2,
+0xccdbf5c5, 0xcafcf5c5, 0xcb74f5c5, 0x177de2c4,
+0x100a200d, 0xc0920f00, 0x1901f883, 0x074a25c0,
+0x658d0000, 0x5d5e5bf8, 0x000000c3, 0x00000000,
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+0005100,
+};
+asm(".type avx2_x86_32_D_32u1, STT_NOTYPE;");
+asm(".type avx2_x86_32_D_32u1, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_32i2[] = {
+0x315500eb, 0x57e589c9, 0x0010be56, 0x31530000,
+0xe0e483db, 0x01e0ec81, 0x84c70000, 0x0000fc24,
+0x00001000, 0xc1b70f00, 0x0f01508d, 0xbc89fabf,
+0x0000c024, 0x0010bf00, 0xc7290000, 0xe083c889,
+0xffbf0f01, 0x8d01f883, 0xd2190141, 0x4a02e283,
+0x0375c885, 0x6601b34e, 0x7e44bc89, 0x8b000001,
+0x00c0248c, 0xf8830000, 0x94896610, 0x00019e44,
+0xb4896600, 0x0001be44, 0x8c896600, 0x00015e44,
+0x89047400, 0x849eebc1, 0x890774db, 0x00fc24b4,
+0xfdc50000, 0x6024bc6f, 0xc5000001, 0x24bc7ffd,
+0x00000100, 0xc976f5c5, 0x946ffdc5, 0x00010024,
+0x0539ba00, 0xedc50000, 0xe2c4df75, 0x0fd9177d,
+0x000a0983, 0xfdedc500, 0x0160249c, 0xfdc50000,
+0x20249c7f, 0xc5000001, 0x24bc6ffd, 0x00000160,
+0xf771e5c5, 0x053fba01, 0xe5c50000, 0x20249c75,
+0xc4000001, 0xd9177de2, 0x09d0830f, 0xfdc50000,
+0x2024bc6f, 0xc5000001, 0x249cf9c5, 0x00000160,
+0x9c7ffdc5, 0x00014024, 0x0544ba00, 0xedc50000,
+0x40249c75, 0xc4000001, 0xd9177de2, 0x099c830f,
+0xfdc50000, 0x8024bc6f, 0xc5000001, 0x249cd5ed,
+0x00000160, 0xe7d5c5c5, 0xa47ffdc5, 0x00012024,
+0x6ffdc500, 0x01602494, 0xedc50000, 0xedc5f7fd,
+0x8024acf9, 0xc5000001, 0xbadcf9e5, 0x0000055b,
+0xeed5d5c5, 0xdd75e5c5, 0xac7ffdc5, 0x00014024,
+0x7de2c400, 0x830fd917, 0x00000942, 0x9cd5edc5,
+0x00018024, 0x7ffdc500, 0x0100249c, 0xc7660000,
+0x01202484, 0x00100000, 0x20248c8d, 0x66000001,
+0x3e2484c7, 0x10000001, 0x118b6600, 0x8302e883,
+0x016602c1, 0xd2bf0fc2, 0x83118966, 0x896602f8,
+0x012e0494, 0xe1750000, 0x24948966, 0x00000130,
+0xbc6ffdc5, 0x00010024, 0x05c8ba00, 0xc5c50000,
+0x20249c75, 0xc4000001, 0xd9177de2, 0x08cc830f,
+0xedc50000, 0xa024a4e5, 0xba000001, 0x000005cf,
+0xb46ffdc5, 0x0001a024, 0x7ffdc500, 0x00c024b4,
+0xc9c50000, 0xcdc5f6ef, 0xc0249c65, 0xc5000000,
+0xc4dc75e5, 0xd9177de2, 0x0890830f, 0xfdc50000,
+0xc024bc6f, 0xc5000000, 0x24bcd5c5, 0x00000160,
+0xbc7ffdc5, 0x0000a024, 0x7ffdc500, 0x014024bc,
+0xfdc50000, 0x4024bc6f, 0xc5000001, 0x03f771dd,
+0xa47ffdc5, 0x00010024, 0x6ffdc500, 0x014024bc,
+0xe5c50000, 0xc502f771, 0x249c7ffd, 0x00000120,
+0xdbfde5c5, 0x0005edba, 0x75e5c500, 0x7de2c4dc,
+0x830fd917, 0x00000826, 0xbc6ffdc5, 0x00010024,
+0x71e5c500, 0xe5c502e7, 0xf2badbfd, 0xc5000005,
+0x249c75e5, 0x00000120, 0x177de2c4, 0xfb830fd9,
+0xc5000007, 0x24acd5ed, 0x000001a0, 0xfc2484c7,
+0x03000000, 0x8b000000, 0x00fc2484, 0x84890000,
+0x0000e024, 0x1ff8c100, 0xe4248489, 0xc5000000,
+0x24bc7efa, 0x000000e0, 0xdff1d5c5, 0xfc2484c7,
+0x02000000, 0x8b000000, 0x00fc2484, 0x84890000,
+0x0000e024, 0x1ff8c100, 0xe4248489, 0xc5000000,
+0x24bc7efa, 0x000000e0, 0xe7f1d5c5, 0xa47ffdc5,
+0x00012024, 0xfdddc500, 0x0605bae4, 0xddc50000,
+0xe2c4e375, 0x0fe1177d, 0x00077183, 0x24848b00,
+0x000000fc, 0xe0248489, 0xc1000000, 0x84891ff8,
+0x0000e424, 0x7efac500, 0x00e024bc, 0xe5c50000,
+0xe5c5dfe1, 0x09badbfd, 0xc5000006, 0x249c75e5,
+0x00000120, 0x177de2c4, 0x2f830fd9, 0xc5000007,
+0x24bc6ffd, 0x000001c0, 0xde65c5c5, 0xf5dbe5c5,
+0xb47ffdc5, 0x00014024, 0x24848b00, 0x00000140,
+0x24448966, 0x8cbf0f74, 0x0001c024, 0x24448b00,
+0xbc8b6674, 0x00014224, 0x24b48b00, 0x00000144,
+0xbf0fe0d3, 0x01c2248c, 0x44890000, 0xfb894024,
+0xbf0fe3d3, 0x01c4248c, 0x5c890000, 0xf3897024,
+0xbf0fe3d3, 0x01c6248c, 0x5c890000, 0x8b666c24,
+0x0146249c, 0xda890000, 0xbf0fe2d3, 0x01c8248c,
+0x54890000, 0x948b6824, 0x00014824, 0xd3d08900,
+0x8cbf0fe0, 0x0001ca24, 0x24448900, 0x848b6664,
+0x00014a24, 0x84896600, 0x0000e024, 0x24848b00,
+0x000000e0, 0xbf0fe0d3, 0x01cc248c, 0x44890000,
+0x848b6024, 0x00014c24, 0x84896600, 0x00009c24,
+0x24848b00, 0x0000009c, 0xbf0fe0d3, 0x01ce248c,
+0x44890000, 0x8b663c24, 0x014e2484, 0x89660000,
+0x00982484, 0x848b0000, 0x00009824, 0x89e0d300,
+0x8b382444, 0x01502484, 0x89660000, 0x00942484,
+0xbf0f0000, 0x01d0248c, 0x848b0000, 0x00009424,
+0x0fe0d300, 0xd2248cbf, 0x89000001, 0x66342444,
+0x5224848b, 0x66000001, 0x90248489, 0x8b000000,
+0x00902484, 0xe0d30000, 0x248cbf0f, 0x000001d4,
+0x30244489, 0x5424848b, 0x66000001, 0x8c248489,
+0x8b000000, 0x008c2484, 0xe0d30000, 0x248cbf0f,
+0x000001d6, 0x2c244489, 0x24848b66, 0x00000156,
+0x24848966, 0x00000088, 0x8824848b, 0xd3000000,
+0x8cbf0fe0, 0x0001d824, 0x24448900, 0x24848b28,
+0x00000158, 0x24848966, 0x00000084, 0x8424848b,
+0xd3000000, 0x8cbf0fe0, 0x0001da24, 0x24448900,
+0x848b6624, 0x00015a24, 0x84896600, 0x00008024,
+0x24848b00, 0x00000080, 0xbf0fe0d3, 0x01dc248c,
+0x44890000, 0x848b2024, 0x00015c24, 0x44896600,
+0x448b7c24, 0xe0d37c24, 0x1c244489, 0x24848b66,
+0x0000015e, 0x5c6ef9c5, 0xbf0f4024, 0x01de248c,
+0xe1c50000, 0x702474c4, 0x6ef9c501, 0xc564246c,
+0x245c6ef9, 0x6ef9c56c, 0xc53c247c, 0x2464c4e1,
+0xd1c50168, 0x60245cc4, 0x62c9c501, 0xc4c1c5e4,
+0x0138246c, 0x24448966, 0x62e1c578, 0x6ef9c5dd,
+0x8b1c247c, 0xc5782444, 0xc5e36cd9, 0x246c6ef9,
+0xc4d1c534, 0x0130245c, 0x6c6ef9c5, 0xd1c52c24,
+0x282474c4, 0x7ff9c501, 0xc5402474, 0x24746ef9,
+0x62e1c524, 0xc540245c, 0x246cc4c9, 0xe0d30120,
+0xf0c4c1c5, 0x62d1c501, 0x6ce1c5ee, 0x5de3c4dd,
+0xc501f338, 0x24747ffd, 0x0001b840, 0xfdc50000,
+0xc024b46f, 0xc5000001, 0xc4d86ef9, 0xdb797de2,
+0xdbf9cdc5, 0x9c7ffdc5, 0x0001c024, 0x8cbf0f00,
+0x0001c024, 0x24448b00, 0x0fe0d374, 0xc2248cbf,
+0x89000001, 0x8b742444, 0x00e02484, 0xe7d30000,
+0x248cbf0f, 0x000001c4, 0xbf0fe6d3, 0x01c6248c,
+0xe3d30000, 0x248cbf0f, 0x000001c8, 0xbf0fe2d3,
+0x01ca248c, 0xf9c50000, 0x21baf26e, 0xd3000006,
+0x8cbf0fe0, 0x0001cc24, 0x24848900, 0x000000e0,
+0x9c24848b, 0xd3000000, 0x8cbf0fe0, 0x0001ce24,
+0x24848900, 0x0000009c, 0x9824848b, 0xd3000000,
+0x8cbf0fe0, 0x0001d024, 0x24848900, 0x00000098,
+0x9424848b, 0xd3000000, 0x8cbf0fe0, 0x0001d224,
+0x24848900, 0x00000094, 0x9024848b, 0xd3000000,
+0x8cbf0fe0, 0x0001d424, 0x24848900, 0x00000090,
+0x8c24848b, 0xd3000000, 0x8cbf0fe0, 0x0001d624,
+0x24848900, 0x0000008c, 0x8824848b, 0xd3000000,
+0x8cbf0fe0, 0x0001d824, 0x24848900, 0x00000088,
+0x8424848b, 0xd3000000, 0x8cbf0fe0, 0x0001da24,
+0x24848900, 0x00000084, 0x8024848b, 0xc5000000,
+0x245c6ef9, 0x6ef9c574, 0x009c24bc, 0xe1c50000,
+0xc501e7c4, 0xc5de6ef9, 0x01ebc4e1, 0x9cc4c9c5,
+0x0000e024, 0xd9c50100, 0xc1c5e562, 0x9824b4c4,
+0x01000000, 0xde62e1c5, 0xf36cd9c5, 0xbf0fe0d3,
+0x01dc248c, 0xf9c50000, 0x9424a46e, 0x89000000,
+0x00802484, 0x448b0000, 0xd9c57c24, 0x90249cc4,
+0x01000000, 0xa46ef9c5, 0x00008c24, 0xc4d9c500,
+0x008824ac, 0xc5010000, 0x24a46ef9, 0x00000084,
+0xac7ff9c5, 0x0000e024, 0xc4d9c500, 0x008024ac,
+0xc5010000, 0x249c62e1, 0x000000e0, 0xbf0fe0d3,
+0x01de248c, 0x44890000, 0x448b7c24, 0xf9c57824,
+0x7c247c6e, 0xc1c5e0d3, 0xc501e0c4, 0xc5ec62d1,
+0xc4dd6ce1, 0xdb384de3, 0xfde5c501, 0x75e5c5db,
+0xc440245c, 0xd9177de2, 0x0270830f, 0xfdc50000,
+0xc024b46f, 0xc5000000, 0x249cd5cd, 0x00000180,
+0x9c7ffdc5, 0x00012024, 0x6ffdc500, 0x00a024b4,
+0xcdc50000, 0x20249cee, 0xc5000001, 0x249c7ffd,
+0x00000140, 0xa4eacdc5, 0x00012024, 0x7ffdc500,
+0x012024a4, 0xe5c50000, 0x20249cfd, 0xba000001,
+0x0000063d, 0xa4fdedc5, 0x00018024, 0xd5e5c500,
+0x00c0249c, 0xe5c50000, 0xe2c4dc75, 0x0fd9177d,
+0x0001f983, 0xd5edc500, 0x00c0249c, 0xfdc50000,
+0x00249c7f, 0xba000001, 0x00000644, 0x1d7de2c4,
+0x0100249c, 0xedc50000, 0xe2c4db75, 0x0fd9177d,
+0x0001c983, 0x0001b800, 0xe5c50000, 0x49badb76,
+0xc5000006, 0xc4c86ef9, 0xc9797de2, 0x0975e2c4,
+0x01a0248c, 0xf5c50000, 0xa0248c75, 0xc4000001,
+0xcb177de2, 0x0194830f, 0xedc50000, 0x80248cfd,
+0xba000001, 0x0000065d, 0x2484c766, 0x000000fa,
+0xe2c40011, 0x24a4797d, 0x000000fa, 0xcc75f5c5,
+0x177de2c4, 0x63830fcb, 0xb8000001, 0x00000001,
+0x947ffdc5, 0x00012024, 0x948b6600, 0x00018044,
+0x94896600, 0x00012044, 0x02c08300, 0x7511f883,
+0x073abae8, 0xfdc50000, 0x6024946f, 0xc4000001,
+0x8c0e6de3, 0x00018024, 0xf5c5aa00, 0x20248c75,
+0xc4000001, 0xcb177de2, 0x0110830f, 0x0fb80000,
+0xc4000000, 0xca466de3, 0x75e3c401, 0xc502e20f,
+0xb8c86ef9, 0x00000001, 0x797de2c4, 0x6ef9c5c9,
+0xdbedc5e8, 0x7de2c4c9, 0xf5c5ed79, 0x4abacdfd,
+0xc5000007, 0xc4c975dd, 0xcb177de2, 0x00cc830f,
+0x04b80000, 0xc5000000, 0x24947ffd, 0x00000100,
+0xe4efd9c5, 0xedefd1c5, 0x8c6ff9c5, 0x00010024,
+0x6ffdc500, 0x01002494, 0xe3c40000, 0x01c93855,
+0x386de3c4, 0xc44800d4, 0xca0175e2, 0x8c7ffdc5,
+0x00010024, 0xc4d17500, 0xc9397de3, 0xc5f9c501,
+0x883d07c1, 0xba000000, 0x0000075e, 0x04b87075,
+0xc5000000, 0x24946ffd, 0x00000160, 0x8c6ff9c5,
+0x00018024, 0x6ffdc500, 0x018024ac, 0xe3c40000,
+0x01c9386d, 0x397de3c4, 0xe3c401d2, 0x00d23855,
+0x0575e2c4, 0xefd9c5ca, 0xe3c448e4, 0x01d43875,
+0x397de3c4, 0xf9c501c9, 0xe2c4c96f, 0x75c9016d,
+0xc5c031e8, 0xc5d2efe9, 0xc4ca75f5, 0xcb177de2,
+0x83c0920f, 0xd21901f8, 0x0767e281, 0x658d0000,
+0x5bd089f4, 0xc35d5f5e,
+0005330,
+};
+asm(".type avx2_x86_32_D_32i2, STT_NOTYPE;");
+asm(".type avx2_x86_32_D_32i2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_32u2[] = {
+0xb95500eb, 0x00000010, 0xc031e589, 0x31535657,
+0xe0e483db, 0x01a0ec81, 0x84c70000, 0x0000bc24,
+0x00001000, 0x24848900, 0x000000a0, 0x8dd0b70f,
+0xb70f0172, 0x0010befe, 0xd6290000, 0xe283c289,
+0x0f4a4001, 0x8485f6b7, 0x0000a024, 0xd2b70f00,
+0xb3490375, 0xbc896601, 0x00011e44, 0x10f88300,
+0x44b48966, 0x0000013e, 0x44948966, 0x0000015e,
+0x448c8966, 0x0000017e, 0xdb84ab75, 0x8c890774,
+0x0000bc24, 0x6ffdc500, 0x012024bc, 0xfdc50000,
+0xc024bc7f, 0xc5000000, 0xc5c976f5, 0x249c6ffd,
+0x000000c0, 0x000539ba, 0x75e5c500, 0x7de2c4d7,
+0x830fd117, 0x0000091c, 0x94fde5c5, 0x00012024,
+0x7ffdc500, 0x00e02494, 0xfdc50000, 0x2024b46f,
+0xc5000001, 0x01f671ed, 0x00053fba, 0x75edc500,
+0x00e02494, 0xe2c40000, 0x0fd1177d, 0x0008e383,
+0x6ffdc500, 0x00e024bc, 0xc5c50000, 0x202494f9,
+0xc5000001, 0x24947ffd, 0x00000100, 0x000544ba,
+0x75e5c500, 0x010024a4, 0xe2c40000, 0x0fe1177d,
+0x0008af83, 0xebe5c500, 0x0140249c, 0xfdc50000,
+0xc0249c7f, 0xc5000000, 0x2494dbed, 0x00000140,
+0x947ffdc5, 0x0000e024, 0x6ffdc500, 0x010024b4,
+0xcdc50000, 0x40249cef, 0xc5000001, 0x249c7ffd,
+0x00000100, 0x000550ba, 0xdfedc500, 0x00c02494,
+0xedc50000, 0xe2c4d375, 0x0fd1177d, 0x00085383,
+0x6ffdc500, 0x01202494, 0xedc50000, 0x40249cd5,
+0xc5000001, 0x249c7ffd, 0x000000c0, 0x2484c766,
+0x000000e0, 0x8c8d0010, 0x0000e024, 0x84c76600,
+0x0000fe24, 0x66001000, 0xe883118b, 0x02c18302,
+0x0fc20166, 0x8966d2b7, 0x02f88311, 0x04948966,
+0x000000ee, 0x8966e175, 0x00f02494, 0xfdc50000,
+0xc024bc6f, 0xba000000, 0x000005c8, 0x9c75c5c5,
+0x0000e024, 0x7de2c400, 0x830fd917, 0x000007d4,
+0xa4e4edc5, 0x00016024, 0xdbedc500, 0x0160249c,
+0xe5c50000, 0x60249cfd, 0xba000001, 0x000005d1,
+0xdc75e5c5, 0x177de2c4, 0xa5830fd9, 0xc5000007,
+0x24947ffd, 0x00000100, 0xb46ffdc5, 0x00010024,
+0x71ddc500, 0xfdc503f6, 0xc024a47f, 0xc5000000,
+0x24bc6ffd, 0x00000100, 0xf771e5c5, 0x7ffdc502,
+0x00e0249c, 0xe5c50000, 0xedbadbfd, 0xc5000005,
+0xc4dc75e5, 0xd9177de2, 0x0756830f, 0xfdc50000,
+0xc024b46f, 0xc5000000, 0x02d671e5, 0xdbfde5c5,
+0x0005f2ba, 0x75e5c500, 0x00e0249c, 0xe2c40000,
+0x0fd9177d, 0x00072b83, 0x2484c700, 0x000000bc,
+0x00000003, 0x9c6ef9c5, 0x0000bc24, 0xf1edc500,
+0x2484c7db, 0x000000bc, 0x00000002, 0xa46ef9c5,
+0x0000bc24, 0xf1edc500, 0x7ffdc5e4, 0x00e024a4,
+0xddc50000, 0x05bae4fd, 0xc5000006, 0xc4e375dd,
+0xe1177de2, 0x06da830f, 0xf9c50000, 0xbc24a46e,
+0xc5000000, 0xc5dcd1e5, 0xbadbfde5, 0x00000609,
+0x9c75e5c5, 0x0000e024, 0x7de2c400, 0x830fd917,
+0x000006b0, 0xe4efd9c5, 0x9c75ddc5, 0x00018024,
+0x75e5c500, 0xdbe5c5dc, 0x012024bc, 0xfdc50000,
+0x0024bc7f, 0x8b000001, 0x01002484, 0x89660000,
+0x0f742444, 0x80248cb7, 0x8b000001, 0x8b742444,
+0x010c24bc, 0x8b660000, 0x010e24b4, 0xe0d30000,
+0x248cb70f, 0x00000182, 0x40244489, 0x24848b66,
+0x00000102, 0x24848966, 0x000000a0, 0xa024848b,
+0xd3000000, 0x8cb70fe0, 0x00018424, 0x24448900,
+0x24848b70, 0x00000104, 0x24848966, 0x0000009c,
+0x9c24848b, 0xd3000000, 0x8cb70fe0, 0x00018624,
+0x24448900, 0x848b666c, 0x00010624, 0x84896600,
+0x00009824, 0x24848b00, 0x00000098, 0xb70fe0d3,
+0x0188248c, 0x44890000, 0x848b6824, 0x00010824,
+0x84896600, 0x00009424, 0x24848b00, 0x00000094,
+0xb70fe0d3, 0x018a248c, 0x44890000, 0x8b666424,
+0x010a2484, 0x89660000, 0x00902484, 0x848b0000,
+0x00009024, 0x0fe0d300, 0x8c248cb7, 0x89000001,
+0x89602444, 0x89e0d3f8, 0x0f3c2444, 0x8e248cb7,
+0x89000001, 0x249c8bf0, 0x00000118, 0xb70fe0d3,
+0x0190248c, 0x44890000, 0x848b3824, 0x00011024,
+0x84896600, 0x00008c24, 0x24848b00, 0x0000008c,
+0xb70fe0d3, 0x0192248c, 0x44890000, 0x8b663424,
+0x01122484, 0x89660000, 0x00882484, 0x848b0000,
+0x00008824, 0x0fe0d300, 0x94248cb7, 0x89000001,
+0x8b302444, 0x01142484, 0x89660000, 0x00842484,
+0x848b0000, 0x00008424, 0x0fe0d300, 0x96248cb7,
+0x89000001, 0x662c2444, 0x1624848b, 0x66000001,
+0x80248489, 0x8b000000, 0x00802484, 0xe0d30000,
+0x248cb70f, 0x00000198, 0x28244489, 0xe0d3d889,
+0x248cb70f, 0x0000019a, 0x24244489, 0x24848b66,
+0x0000011a, 0x24448966, 0x24448b7c, 0x0fe0d37c,
+0x9c248cb7, 0x89000001, 0x8b202444, 0x011c2484,
+0xc2890000, 0x5489e2d3, 0x8b661c24, 0x011e248c,
+0xf9c50000, 0x40245c6e, 0x6c6ef9c5, 0xe1c56424,
+0x702464c4, 0x6ef9c501, 0xc56c245c, 0x247cc4e1,
+0xd1c50168, 0x60245cc4, 0x62d9c501, 0x6ef9c5e7,
+0xc53c246c, 0x247c6ef9, 0xc4d1c524, 0x01382474,
+0x244c8966, 0x8cb70f78, 0x00019e24, 0x62e1c500,
+0x24548bde, 0x6cd9c578, 0x6ef9c5e3, 0xc534246c,
+0x245cc4d1, 0xf9c50130, 0x2c246c6e, 0x74c4d1c5,
+0xc5012824, 0x246cc4c1, 0xe1c50120, 0xf9c5de62,
+0x1c247c6e, 0xc1c5e2d3, 0xc501fac4, 0xc5ef62d1,
+0xc4dd6ce1, 0xf3385de3, 0x7ffdc501, 0xc5402474,
+0xc5db76e5, 0x249cfde5, 0x00000180, 0x9c7ffdc5,
+0x00018024, 0x8cb70f00, 0x00018024, 0x24548b00,
+0x0fe2d374, 0x82248cb7, 0x89000001, 0x8b742454,
+0x00a02494, 0xe2d30000, 0x248cb70f, 0x00000184,
+0xa0249489, 0x8b000000, 0x009c2494, 0xe2d30000,
+0x248cb70f, 0x00000186, 0x9c249489, 0x8b000000,
+0x00982494, 0xe2d30000, 0x248cb70f, 0x00000188,
+0x98249489, 0x8b000000, 0x00942494, 0xe2d30000,
+0x248cb70f, 0x0000018a, 0x94249489, 0x8b000000,
+0x00902494, 0xe2d30000, 0x248cb70f, 0x0000018c,
+0x90249489, 0x8b000000, 0x008c2494, 0xe7d30000,
+0x248cb70f, 0x0000018e, 0xef6ef9c5, 0xb70fe6d3,
+0x0190248c, 0xe2d30000, 0x248cb70f, 0x00000192,
+0x8c249489, 0x8b000000, 0x00882494, 0xe2d30000,
+0x248cb70f, 0x00000194, 0x88249489, 0x8b000000,
+0x00842494, 0xe2d30000, 0x248cb70f, 0x00000196,
+0x84249489, 0x8b000000, 0x00802494, 0xe2d30000,
+0x80249489, 0x0f000000, 0x98248cb7, 0xc5000001,
+0x24646ef9, 0x24548b74, 0xc4d9c57c, 0x00a0249c,
+0xc5010000, 0x24a46ef9, 0x0000009c, 0xbcc4d9c5,
+0x00009824, 0xf9c50100, 0x9424a46e, 0xc5000000,
+0xc5df62e1, 0x24b4c4d9, 0x00000090, 0xc4d1c501,
+0xc9c501e6, 0xe3d3f462, 0x248cb70f, 0x0000019a,
+0xde6ce1c5, 0xa46ef9c5, 0x00008c24, 0xc4d9c500,
+0x008824ac, 0xc5010000, 0x24a46ef9, 0x00000084,
+0xb4c4d9c5, 0x00008024, 0xf9c50100, 0xa024b47f,
+0xc5000000, 0xc5f36ef9, 0x24ac62d1, 0x000000a0,
+0xb70fe2d3, 0x019c248c, 0xc9c50000, 0xba01e2c4,
+0x00000621, 0xb70fe0d3, 0x019e248c, 0x44890000,
+0x448b7c24, 0xf9c57824, 0x7c247c6e, 0xc1c5e0d3,
+0xc501f0c4, 0xc5e662d9, 0xc4ec6cd1, 0xdd3865e3,
+0xfde5c501, 0x75e5c5db, 0xc440245c, 0xd9177de2,
+0x01fe830f, 0xe2c40000, 0x249c3a6d, 0x00000140,
+0x9c7ffdc5, 0x0000c024, 0x6de2c400, 0x4024a43e,
+0xc5000001, 0xbadcfde5, 0x00000634, 0xa4fdedc5,
+0x00014024, 0x75e5c500, 0x7de2c4dc, 0x830fd917,
+0x000001c0, 0x000001b8, 0x0649ba00, 0xf9c50000,
+0xe2c4d86e, 0xc4db797d, 0x9c0965e2, 0x00016024,
+0x75e5c500, 0x0160249c, 0xe2c40000, 0x0fd9177d,
+0x00018f83, 0x84c76600, 0x0000ba24, 0xba001100,
+0x0000065d, 0x797de2c4, 0x00ba249c, 0xddc50000,
+0xe5c5cb75, 0xe2c4db76, 0x0fcb177d, 0x00016383,
+0x0001b800, 0xfdc50000, 0xe024947f, 0x66000000,
+0x4044948b, 0x66000001, 0xe0449489, 0x83000000,
+0xf88302c0, 0xbae87511, 0x0000073a, 0x946ffdc5,
+0x00012024, 0x6de3c400, 0x40248c0e, 0xaa000001,
+0x8c75f5c5, 0x0000e024, 0x7de2c400, 0x830fcb17,
+0x00000110, 0x00000fb8, 0x6de3c400, 0xc401ca46,
+0xe20f75e3, 0x6ef9c502, 0x0001b8c8, 0xe2c40000,
+0xc5c9797d, 0xc5e86ef9, 0xc4c9dbed, 0xed797de2,
+0xcdfdf5c5, 0x00074aba, 0x75ddc500, 0x7de2c4c9,
+0x830fcb17, 0x000000cc, 0x000004b8, 0x7ffdc500,
+0x00c02494, 0xd9c50000, 0xd1c5e4ef, 0xf9c5edef,
+0xc0248c6f, 0xc5000000, 0x24b46ffd, 0x000000c0,
+0x3855e3c4, 0xe3c401c9, 0x00d4384d, 0x75e2c448,
+0xfdc5ca01, 0xc0248c7f, 0x75000000, 0x7de3c4d1,
+0xc501c939, 0x07c1c5f9, 0x0000883d, 0x075eba00,
+0x70750000, 0x000004b8, 0x6ffdc500, 0x012024ac,
+0xf9c50000, 0x40248c6f, 0xc4000001, 0xea397de3,
+0x55e3c401, 0xc501c938, 0x24ac6ffd, 0x00000140,
+0x3855e3c4, 0xe2c400d2, 0xc5ca0575, 0x48e4efd9,
+0x3875e3c4, 0xe3c401d4, 0x01c9397d, 0xc96ff9c5,
+0x016de2c4, 0x31e875c9, 0xefe9c5c0, 0x75f5c5d2,
+0x7de2c4ca, 0x920fcb17, 0x01f883c0, 0xe281d219,
+0x00000767, 0x89f4658d, 0x5f5e5bd0, 0x0000c35d,
+0004736,
+};
+asm(".type avx2_x86_32_D_32u2, STT_NOTYPE;");
+asm(".type avx2_x86_32_D_32u2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_32i4[] = {
+0xb95500eb, 0x00000020, 0xc031e589, 0x0009bf57,
+0x53560000, 0x81e0e483, 0x000100ec, 0x89c38900,
+0x40da89fe, 0x2901e283, 0x01fa83c6, 0xe283d219,
+0xd8854a02, 0x89490175, 0x837c8444, 0xb48908f8,
+0x00009c84, 0x84948900, 0x000000bc, 0xdc848c89,
+0x75000000, 0x6ffdc5c8, 0x008024bc, 0xfdc50000,
+0x20247c7f, 0xc976f5c5, 0x546ffdc5, 0x39b82024,
+0xc5000005, 0xc4df76ed, 0xd9177de2, 0x0503830f,
+0xedc50000, 0x80249cfe, 0xc5000000, 0x245c7ffd,
+0x6ffdc540, 0x008024bc, 0xe5c50000, 0xb801f772,
+0x0000053f, 0x5c76e5c5, 0xe2c44024, 0x0fd9177d,
+0x0004d083, 0x6ffdc500, 0xc540247c, 0x249cfac5,
+0x00000080, 0x5c7ffdc5, 0x44b86024, 0xc5000005,
+0x245c76ed, 0x7de2c460, 0x830fd917, 0x000004a5,
+0xbc6ffdc5, 0x0000a024, 0x6de2c400, 0x80249440,
+0xc4000000, 0xe74045e2, 0x9c6ffdc5, 0x00008024,
+0xfee5c500, 0xfae5c5f7, 0x00a024ac, 0xedc50000,
+0x5bb8d4fa, 0xc4000005, 0xee4055e2, 0xd576edc5,
+0x177de2c4, 0x5a830fd1, 0xc4000004, 0x944065e2,
+0x0000a024, 0x05c8b800, 0xedc50000, 0x05a01576,
+0xe2c40010, 0x0fd1177d, 0x00043883, 0x65e2c400,
+0xc024a440, 0xc5000000, 0x24647ffd, 0x6ffdc560,
+0xc5602474, 0x03f672d5, 0x6c7ffdc5, 0xfdc52024,
+0x60247c6f, 0xf772edc5, 0x7ffdc502, 0xc5402454,
+0xb8d2feed, 0x000005ed, 0xd576edc5, 0x177de2c4,
+0xee830fd1, 0xc5000003, 0x24746ffd, 0x72edc520,
+0xedc502e6, 0xf2b8d2fe, 0xc5000005, 0x245476ed,
+0x7de2c440, 0x830fd117, 0x000003c9, 0x182444c7,
+0x00000003, 0x1824448b, 0x08244489, 0x891ff8c1,
+0xc50c2444, 0x247c7efa, 0xf2ddc508, 0x2444c7d7,
+0x00000218, 0x24448b00, 0x24448918, 0x1ff8c108,
+0x0c244489, 0x747efac5, 0xddc50824, 0xfdc5eef2,
+0x40246c7f, 0xedfed5c5, 0x000605b8, 0x76d5c500,
+0x7de2c4ea, 0x830fe917, 0x00000369, 0x1824448b,
+0x08244489, 0x891ff8c1, 0xc50c2444, 0x247c7efa,
+0xe2edc508, 0xfeedc5d7, 0x0609b8d2, 0xedc50000,
+0x40245476, 0x177de2c4, 0x36830fd1, 0xc5000003,
+0x24b46ffd, 0x000000e0, 0xd2efe9c5, 0xd266cdc5,
+0xd4dbedc5, 0x547ffdc5, 0xe2c46024, 0x24ac476d,
+0x000000e0, 0x000001b8, 0x6ffdc500, 0x00e024bc,
+0xf9c50000, 0xe2c4e06e, 0xc5e4587d, 0xc5e4fac5,
+0x24a47ffd, 0x000000e0, 0x476de2c4, 0x00e02494,
+0x21b80000, 0xc5000006, 0x24547ffd, 0xfeedc540,
+0x76edc5d2, 0x7de2c4d5, 0x830fd117, 0x000002c5,
+0x746ffdc5, 0xe2c44024, 0x2494464d, 0x000000e0,
+0x000626b8, 0x76edc500, 0xc4602454, 0xd1177de2,
+0x029f830f, 0xfdc50000, 0xc024a46f, 0xc4000000,
+0x94405de2, 0x0000a024, 0x5de2c400, 0xfdc5eb40,
+0x4024547f, 0x3d55e2c4, 0xc4402454, 0x6c3955e2,
+0xfdc54024, 0x40246c7f, 0x54feedc5, 0x3db84024,
+0xc5000006, 0x24acfee5, 0x000000a0, 0x406de2c4,
+0x76edc5d4, 0x7de2c4d5, 0x830fd117, 0x00000245,
+0x405de2c4, 0x7ffdc5e3, 0xb8202464, 0x00000644,
+0x1e7de2c4, 0xc5202454, 0xc4da76e5, 0xd9177de2,
+0x021f830f, 0x01b80000, 0xc5000000, 0x24946ffd,
+0x000000c0, 0xe06ef9c5, 0x000649b8, 0x7de2c400,
+0xe2c4e458, 0xc5da0a5d, 0xc4db76ed, 0xd9177de2,
+0x01ef830f, 0xfdc50000, 0xa024ac6f, 0xc5000000,
+0xc5dcfad5, 0x24b46ffd, 0x00000080, 0x00064eb8,
+0x65e2c400, 0xd5c5de36, 0xe2c4db76, 0x0fd9177d,
+0x0001c083, 0x2444c700, 0x0000091c, 0xfed5c500,
+0x065db8de, 0xe2c40000, 0x247c587d, 0x76e5c51c,
+0x7de2c4df, 0x830fd917, 0x00000199, 0xa424848b,
+0xc5000000, 0x24747ffd, 0xefc9c540, 0x66edc5f6,
+0x6de2c4d6, 0x80249c8c, 0xc5000000, 0x245c7ffd,
+0x76e5c560, 0x65e3c4db, 0xc420d64c, 0x6c8e6de2,
+0xfdc56024, 0x60247c6f, 0x44244489, 0xac24848b,
+0x89000000, 0x8b4c2444, 0x00b42484, 0x44890000,
+0x848b5424, 0x0000bc24, 0x24448900, 0x072ab85c,
+0xc5c50000, 0x40245476, 0x177de2c4, 0x22830fd1,
+0xb8000001, 0x0000073a, 0x9c6ffdc5, 0x00008024,
+0x65e3c400, 0xa0249402, 0xaa000000, 0x5476edc5,
+0xe2c44024, 0x0fd1177d, 0x0000f883, 0x0007b800,
+0xe3c40000, 0x01d34665, 0x0f6de3c4, 0xf9c504eb,
+0xe2c4d06e, 0xc5d2587d, 0xc5d2dbe5, 0xb8d4feed,
+0x0000074a, 0xd276d5c5, 0x177de2c4, 0xc2830fd1,
+0xb8000000, 0x00000003, 0x5c7ffdc5, 0xd9c52024,
+0xe1c5e4ef, 0xf9c5dbef, 0x20244c6f, 0x746ffdc5,
+0xe3c42024, 0x01c9385d, 0x384de3c4, 0xc44800d3,
+0xca0275e2, 0x4c7ffdc5, 0xda752024, 0x397de3c4,
+0xe3c401c9, 0x03ca1679, 0xb824fa83, 0x0000075e,
+0x03b87375, 0xc5000000, 0x24bc6ffd, 0x00000080,
+0x8c6ff9c5, 0x0000a024, 0x7de3c400, 0xc401fa39,
+0xc93845e3, 0x6ffdc501, 0x00a024bc, 0xe3c40000,
+0x00d23845, 0x0675e2c4, 0xefe1c5ca, 0xe3c448db,
+0x01d33875, 0x397de3c4, 0xf9c501c9, 0xe2c4c96f,
+0x75c9026d, 0xc5c031e8, 0xc5d2efe9, 0xc5ca76f5,
+0xc4d276ed, 0xca177de2, 0x83c0920f, 0xc01901f8,
+0x00076725, 0xf4658d00, 0x5d5f5e5b, 0x000000c3,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000008, 0x0000000e, 0x00000012, 0x00000014,
+0x00000014, 0x00000012, 0x0000000e, 0x00000008,
+0002700,
+};
+asm(".type avx2_x86_32_D_32i4, STT_NOTYPE;");
+asm(".type avx2_x86_32_D_32i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_32u4[] = {
+0xba5500eb, 0x00000020, 0xc031e589, 0xe4835356,
+0x20ec81e0, 0x89000001, 0x0009bbc6, 0xf1890000,
+0x01e18340, 0x8549c329, 0x4a0175f0, 0x9c848489,
+0x83000000, 0x9c8908f8, 0x0000bc84, 0x848c8900,
+0x000000dc, 0xfc849489, 0x75000000, 0x6ffdc5ca,
+0x00a024b4, 0xfdc50000, 0x4024747f, 0xc976f5c5,
+0x5c6ffdc5, 0x39b84024, 0xc5000005, 0xc4d676e5,
+0xd1177de2, 0x04f1830f, 0xe5c50000, 0xa02494fe,
+0xc5000000, 0x24547ffd, 0x6ffdc560, 0x00a024b4,
+0xedc50000, 0xb801f672, 0x0000053f, 0x5476edc5,
+0xe2c46024, 0x0fd1177d, 0x0004be83, 0x6ffdc500,
+0xc560247c, 0x2494fac5, 0x000000a0, 0x947ffdc5,
+0x00008024, 0x0544b800, 0xe5c50000, 0x8024a476,
+0xc4000000, 0xe1177de2, 0x048d830f, 0xe5c50000,
+0xc0249ceb, 0xc5000000, 0x245c7ffd, 0xdbedc540,
+0x00c02494, 0xfdc50000, 0x8024b46f, 0xc5000000,
+0x249cefcd, 0x000000c0, 0x9c7ffdc5, 0x00008024,
+0x0550b800, 0xedc50000, 0x402454df, 0xf676cdc5,
+0xd376edc5, 0x177de2c4, 0x3c830fd1, 0xc5000004,
+0x24946ffd, 0x000000a0, 0x406de2c4, 0x00c0249c,
+0xe5c50000, 0x05801d76, 0x44c70010, 0x00023824,
+0xc8b80000, 0xc4000005, 0xd9177de2, 0x0409830f,
+0xedc50000, 0xe0249cef, 0xc5000000, 0x245c7ffd,
+0xf4e5c540, 0x00c0249c, 0xfdc50000, 0x60245c7f,
+0x848bc931, 0x0000c08c, 0x8c64f700, 0x8c848940,
+0x00000080, 0x848c9489, 0x83000000, 0xf98302c1,
+0xc5df7508, 0x247c6ffd, 0x05e1b860, 0xc5c50000,
+0x80249c76, 0xc4000000, 0xd9177de2, 0x03a9830f,
+0xfdc50000, 0x8024947f, 0xc5000000, 0x24bc6ffd,
+0x00000080, 0xf772ddc5, 0x7ffdc503, 0xc5402464,
+0x24bc6ffd, 0x00000080, 0xf772e5c5, 0x7ffdc502,
+0xc560245c, 0xb8dbfee5, 0x000005ed, 0xdc76e5c5,
+0x177de2c4, 0x60830fd9, 0xc5000003, 0x247c6ffd,
+0x72e5c540, 0xe5c502d7, 0xf2b8dbfe, 0xc5000005,
+0x245c76e5, 0x7de2c460, 0x830fd917, 0x0000033b,
+0x382444c7, 0x00000003, 0x5c6ef9c5, 0xedc53824,
+0x44c7dbf2, 0x00023824, 0xf9c50000, 0x3824646e,
+0xe4f2edc5, 0x647ffdc5, 0xddc56024, 0x05b8e4fe,
+0xc5000006, 0xc4e376dd, 0xe1177de2, 0x02f9830f,
+0xf9c50000, 0x3824646e, 0xdcd2e5c5, 0xdbfee5c5,
+0x000609b8, 0x76e5c500, 0xc460245c, 0xd9177de2,
+0x02d5830f, 0xd9c50000, 0xddc5e4ef, 0x00249c76,
+0xc5000001, 0xc5dc76e5, 0x249cdbe5, 0x000000a0,
+0x4765e2c4, 0x010024bc, 0xcdc50000, 0x0024a4fe,
+0xc5000001, 0x24a47ffd, 0x00000100, 0x4765e2c4,
+0x010024a4, 0x21b80000, 0xc5000006, 0xc5ecfedd,
+0xc4ef76d5, 0xe9177de2, 0x027d830f, 0xe2c40000,
+0x24a4455d, 0x00000100, 0x000626b8, 0x76e5c500,
+0x7de2c4dc, 0x830fd917, 0x0000025f, 0x3b6de2c4,
+0x00c0249c, 0xe2c40000, 0x24a43f6d, 0x000000c0,
+0x94feedc5, 0x0000c024, 0xfee5c500, 0x0634b8dc,
+0xe5c50000, 0xe2c4d276, 0x0fd1177d, 0x00022a83,
+0x0001b800, 0xfdc50000, 0xe024946f, 0xc5000000,
+0xb8d86ef9, 0x00000649, 0x587de2c4, 0x65e2c4db,
+0xe5c5da0a, 0xe2c4da76, 0x0fd9177d, 0x0001fa83,
+0x0001b800, 0xfdc50000, 0xc0249c6f, 0xc5000000,
+0x24a46ffd, 0x000000a0, 0xf86ef9c5, 0x587de2c4,
+0xfae5c5ff, 0x55e2c4ef, 0x4eb8ec36, 0xc5000006,
+0xc4eb76d5, 0xe9177de2, 0x01bd830f, 0x44c70000,
+0x00093c24, 0x5db80000, 0xc4000006, 0x6c587de2,
+0xfdc53c24, 0xc5242c7f, 0xc5ecfee5, 0x242c76d5,
+0x177de2c4, 0x90830fe9, 0x8b000001, 0x00c42484,
+0xfdc50000, 0x6024647f, 0x8c6de2c4, 0x00a024a4,
+0xedc50000, 0xfdc5d6ef, 0x8024a47f, 0xc4000000,
+0x9c8e6de2, 0x00008024, 0x6ffdc500, 0x008024b4,
+0x44890000, 0x848b6424, 0x0000cc24, 0x24448900,
+0x24848b6c, 0x000000d4, 0x74244489, 0xdc24848b,
+0x89000000, 0xb87c2444, 0x0000072a, 0x5476cdc5,
+0xe2c46024, 0x0fd1177d, 0x00011e83, 0x073ab800,
+0xfdc50000, 0xa0249c6f, 0xc4000000, 0x940265e3,
+0x0000c024, 0xedc5aa00, 0x60245476, 0x177de2c4,
+0xf4830fd1, 0xb8000000, 0x00000007, 0x4665e3c4,
+0xe3c401d3, 0x04e30f6d, 0xd06ef9c5, 0x587de2c4,
+0xdbe5c5d2, 0xfeedc5d2, 0x074ab8d7, 0xddc50000,
+0xe2c4d276, 0x0fd1177d, 0x0000be83, 0x0003b800,
+0xfdc50000, 0x40245c7f, 0xe4efd9c5, 0xedefd1c5,
+0x546ff9c5, 0xfdc54024, 0x4024746f, 0x3855e3c4,
+0xe3c401d2, 0x00dc384d, 0x6de2c448, 0xfdc5d302,
+0x4024547f, 0xe3c4da75, 0x01d2397d, 0x1679e3c4,
+0xfa8303d2, 0x075eb824, 0x6f750000, 0x000003b8,
+0x6ffdc500, 0x00a024b4, 0xf9c50000, 0xc024946f,
+0xc4000000, 0xf3397de3, 0x4de3c401, 0xc501d238,
+0x24bc6ffd, 0x000000c0, 0x3845e3c4, 0xe2c400db,
+0xc5d3066d, 0x48e4efd9, 0x386de3c4, 0xe3c401dc,
+0x01d2397d, 0xd26ff9c5, 0x0265e2c4, 0x31e875d2,
+0xefe1c5c0, 0x76edc5db, 0x7de2c4d3, 0x920fd117,
+0x01f883c0, 0x6725c019, 0x8d000007, 0x5e5bf865,
+0x0000c35d, 0x00000000, 0x00000000, 0x00000000,
+0x00000008, 0x0000000e, 0x00000012, 0x00000014,
+0x00000014, 0x00000012, 0x0000000e, 0x00000008,
+0002640,
+};
+asm(".type avx2_x86_32_D_32u4, STT_NOTYPE;");
+asm(".type avx2_x86_32_D_32u4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_32i8[] = {
+0xb85500eb, 0x00000001, 0xd231e589, 0xbb535657,
+0x00000040, 0x81e0e483, 0x000160ec, 0xff788d00,
+0x000005be, 0x247c8900, 0x29ff3120, 0x247489c6,
+0x83d71940, 0x7c89ffce, 0x01a84424, 0xf789c189,
+0x01be0774, 0x31000000, 0x244c85ff, 0x4b017520,
+0xd8cc8489, 0xc5000000, 0x246c7efa, 0xd6f9c540,
+0x00f8ccac, 0xb4890000, 0x000118cc, 0x83f63100,
+0x948901c0, 0x0000dccc, 0x00d28300, 0x1cccbc89,
+0x89000001, 0x0138cc9c, 0xb4890000, 0x00013ccc,
+0x83c18900, 0xd10905f1, 0xfdc58375, 0xe024ac6f,
+0xc5000000, 0x24ac7ffd, 0x00000080, 0xc976f5c5,
+0xa46ffdc5, 0x00008024, 0x0539b800, 0xe2c40000,
+0xc4d5295d, 0xd1177de2, 0x0545830f, 0xddc50000,
+0xe02494d4, 0xc5000000, 0x24947ffd, 0x000000a0,
+0xac6ffdc5, 0x0000e024, 0x73edc500, 0x3fb801f5,
+0xc4000005, 0x94296de2, 0x0000a024, 0x7de2c400,
+0x830fd117, 0x0000050b, 0xbc6ffdc5, 0x0000a024,
+0xfbc5c500, 0x00e02494, 0xfdc50000, 0xc024947f,
+0xb8000000, 0x00000544, 0x295de2c4, 0x00c02494,
+0xe2c40000, 0x0fd1177d, 0x0004d683, 0x6ffdc500,
+0x00e024ac, 0xedc50000, 0xc520d473, 0x20d573d5,
+0x94f4edc5, 0x0000e024, 0x6ffdc500, 0x010024bc,
+0xddc50000, 0xe0249cf4, 0xc5000000, 0xc5e4f4d5,
+0x24ac6ffd, 0x00000100, 0xd4d4edc5, 0xe7f4c5c5,
+0xf273edc5, 0xd4e5c520, 0x73edc5da, 0xedc520d5,
+0xedc5d7f4, 0xedc5d2d4, 0xc520f273, 0xc5fad4dd,
+0x247c7ffd, 0x6ffdc540, 0x00e02494, 0xedc50000,
+0xedc5fdd4, 0x0024b4fb, 0xb8000001, 0x0000055b,
+0x5cfbe5c5, 0xcdc54024, 0xddc5eff4, 0xc520d673,
+0x246c7ffd, 0x73d5c520, 0xddc520d7, 0xd5c5e7f4,
+0xddc5eef4, 0xddc5e5d4, 0xc520f473, 0x2464d4dd,
+0x65e2c420, 0xe2c4dc29, 0x0fd9177d, 0x00041283,
+0x6ffdc500, 0x0100249c, 0xc5c50000, 0xc520d273,
+0x20d373d5, 0x9cf4c5c5, 0x00010024, 0xf4d5c500,
+0xf4edc5ea, 0x010024a4, 0xe5c50000, 0xe5c5ddd4,
+0xc520f373, 0xb8dbd4dd, 0x000005c8, 0x2965e2c4,
+0x1006201d, 0x7de2c400, 0x830fd917, 0x000003c3,
+0x9c6ffdc5, 0x00012024, 0x73d5c500, 0xc5c520d3,
+0xd5c5f3f4, 0xedc5eaf4, 0xcdc5e3f4, 0xcdc5f5d4,
+0xc520f673, 0xc5f6d4dd, 0x24b47ffd, 0x000000c0,
+0x946ffdc5, 0x0000c024, 0x73edc500, 0xfdc503f2,
+0x8024947f, 0xc5000000, 0x24b46ffd, 0x000000c0,
+0xf673cdc5, 0x7ffdc502, 0x00a024b4, 0xcdc50000,
+0xc5c5f6d4, 0xe2c4fbf4, 0xb8f2294d, 0x000005ed,
+0x177de2c4, 0x7ffdc5f1, 0x0f40247c, 0x00034283,
+0x6ffdc500, 0x008024bc, 0xcdc50000, 0xc502d773,
+0x24bc6ffd, 0x00000080, 0xe772c5c5, 0x4de3c402,
+0xc5aaf702, 0xb8f6d4cd, 0x000005f2, 0x294de2c4,
+0x00a024b4, 0xe2c40000, 0x0ff1177d, 0x00030283,
+0xd4d5c500, 0xc740247c, 0x03642444, 0xc5000000,
+0x20f773c5, 0xffd4ddc5, 0x6424448b, 0x20244489,
+0x24548999, 0x7efac524, 0xc5202474, 0xc7f6f3c5,
+0x02642444, 0x8b000000, 0x89642444, 0xc1202444,
+0x44891ff8, 0xfac52424, 0x2024547e, 0xfaf3c5c5,
+0xbc7ffdc5, 0x0000a024, 0xd4c5c500, 0x0605b8ff,
+0xe2c40000, 0xc4fe2945, 0xf9177de2, 0x0291830f,
+0x548b0000, 0xc1c56424, 0xe2c4ffef, 0xc5d63745,
+0x24147ffd, 0x20245489, 0xf8c1d089, 0x2444891f,
+0x0040b824, 0xfac50000, 0x2024547e, 0xcdc5d029,
+0xfdc5d2d3, 0x2024547f, 0xf06ef9c5, 0x146ffdc5,
+0xf3edc524, 0xebcdc5f6, 0xc5202474, 0xb8f6d4cd,
+0x00000609, 0x294de2c4, 0x00a024b4, 0xe2c40000,
+0x0ff1177d, 0x00022a83, 0xd4d5c500, 0xc5402454,
+0x24ac6ffd, 0x00000140, 0xf273edc5, 0xd4ddc520,
+0x55e2c4d2, 0xddc5e737, 0xfdc5e2db, 0xc024a47f,
+0xc4000000, 0xac47dde2, 0x00014024, 0x6ffdc500,
+0x10064015, 0x6ffdc500, 0x014024bc, 0xc5c50000,
+0xfdc5f2fb, 0x4024b47f, 0xc4000001, 0xa447dde2,
+0x00014024, 0x0621b800, 0xfdc50000, 0xa024a47f,
+0xc5000000, 0xc4e4d4dd, 0xe5295de2, 0x177de2c4,
+0xac830fe1, 0xc5000001, 0x60256ffd, 0xc5001006,
+0x24ac6ffd, 0x000000a0, 0x45dde2c4, 0x014024a4,
+0xe2c40000, 0x248c45d5, 0x00000140, 0x000626b8,
+0xeff5c500, 0xfbf5c5cc, 0x76ddc5cc, 0x75e2c4e4,
+0xc0248c29, 0xc4000000, 0xcc177de2, 0x0161830f,
+0x4eb80000, 0xc4000006, 0x8c00fde3, 0x0000e024,
+0xfdc51b00, 0x0024ac6f, 0xc4000001, 0xc92955e2,
+0x177de2c4, 0x38830fcc, 0xb8000001, 0x00000653,
+0xb46ffdc5, 0x0000e024, 0xfde3c400, 0xc4b1ce00,
+0xc94675e3, 0x55e2c401, 0xe2c4c929, 0x0fcc177d,
+0x00010e83, 0x2444c700, 0x00000568, 0x89c03100,
+0xb86c2444, 0x0000065d, 0x5979e2c4, 0xc568244c,
+0x244c7ff9, 0xd4cdc570, 0x7de2c4cd, 0x70247c5a,
+0x2975e2c4, 0x7de2c4cf, 0x830fcc17, 0x000000d3,
+0xb47ffdc5, 0x0000a024, 0x7efac500, 0x0108248c,
+0x2ab80000, 0xc5000007, 0x248cd6f9, 0x000000a8,
+0x8c7efac5, 0x00011824, 0xd6f9c500, 0x00b8248c,
+0xf1c50000, 0xe2c4c9ef, 0xc4d93765, 0xc94c5de3,
+0xe5e2c430, 0xe024b48c, 0xc5000000, 0x24b47ffd,
+0x000000c0, 0x8ef5e2c4, 0x00c024ac, 0xfdc50000,
+0xc0249c6f, 0xc4000000, 0x8c2965e2, 0x0000a024,
+0x7de2c400, 0x5b73cc17, 0x00073ab8, 0x6ffdc500,
+0x00e0248c, 0xe3c40000, 0x249c0275, 0x00000100,
+0x65e2c4cc, 0xa0249c29, 0xc4000000, 0xdc177de2,
+0xc0313173, 0x4675e3c4, 0xe3c401d9, 0x08d90f65,
+0x0ddbf5c5, 0x00100680, 0xcad4f5c5, 0x2975e2c4,
+0x7de2c4cb, 0x920fcc17, 0x01f883c0, 0x4a25c019,
+0x8d000007, 0x5e5bf465, 0x00c35d5f, 0x00000000,
+0x00000004, 0x00000000, 0x00000006, 0x00000000,
+0x00000006, 0x00000000, 0x00000004, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x80000000,
+0x00000000, 0x80000000, 0x00000000, 0x80000000,
+0x00000003, 0x00000000, 0x00000003, 0x00000000,
+0x00000003, 0x00000000, 0x00000003, 0x00000000,
+0003240,
+};
+asm(".type avx2_x86_32_D_32i8, STT_NOTYPE;");
+asm(".type avx2_x86_32_D_32i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_32u8[] = {
+0xba5500eb, 0x00000040, 0x3157e589, 0x01be56ff,
+0x53000000, 0x81e0e483, 0x000100ec, 0xff5e8d00,
+0x000005b9, 0x245c8900, 0x29db310c, 0x240c89f1,
+0x0c244c8b, 0x5c89fb19, 0xf0890424, 0x4901e183,
+0xfbc1cb89, 0x2474851f, 0x4a01750c, 0x78c47489,
+0x347efac5, 0xd6f9c524, 0x0098c4b4, 0x8c890000,
+0x0000b8c4, 0x83c93100, 0x7c8901c6, 0xd7837cc4,
+0xc49c8900, 0x000000bc, 0xd8c49489, 0x89000000,
+0x00dcc48c, 0xf0890000, 0x0905f083, 0xc58e75f8,
+0x24bc6ffd, 0x00000080, 0x7c7ffdc5, 0xf5c52024,
+0xfdc5c976, 0x20245c6f, 0x000539b8, 0x65e2c400,
+0xe2c4d729, 0x0fd1177d, 0x00039983, 0xd4e5c500,
+0x00802494, 0xfdc50000, 0x4024547f, 0xb46ffdc5,
+0x00008024, 0x73edc500, 0x3fb801f6, 0xc4000005,
+0x54296de2, 0xe2c44024, 0x0fd1177d, 0x00036583,
+0x6ffdc500, 0xc540247c, 0x2494fbc5, 0x00000080,
+0x547ffdc5, 0x44b86024, 0xc4000005, 0x642965e2,
+0xe2c46024, 0x0fe1177d, 0x00033983, 0xebe5c500,
+0x00a0249c, 0xfdc50000, 0x20245c7f, 0x94dbedc5,
+0x0000a024, 0x6ffdc500, 0xc5602474, 0x249cefcd,
+0x000000a0, 0x000550b8, 0xefedc500, 0xdbedc5d1,
+0xc4202454, 0xd3296de2, 0x177de2c4, 0xf3830fd1,
+0xc5000002, 0x24946ffd, 0x00000080, 0xbc6ffdc5,
+0x0000a024, 0x73e5c500, 0xe5c520d2, 0xa0249cf4,
+0xc5000000, 0x20d773d5, 0xa4f4edc5, 0x0000a024,
+0xf4d5c500, 0xd4e5c5ea, 0x73e5c5dd, 0xddc520f3,
+0xc8b8dbd4, 0xc4000005, 0x1d2965e2, 0x00100460,
+0x177de2c4, 0x9b830fd9, 0xc5000002, 0x24547ffd,
+0x6ffdc560, 0xc560246c, 0x03f573dd, 0x647ffdc5,
+0xfdc52024, 0x6024746f, 0xf673e5c5, 0x7ffdc502,
+0xc540245c, 0xb8dbd4e5, 0x000005ed, 0x2965e2c4,
+0x7de2c4dc, 0x830fd917, 0x0000025a, 0x7c6ffdc5,
+0xe5c52024, 0xc502d773, 0xb8dbd4e5, 0x000005f2,
+0x2965e2c4, 0xc440245c, 0xd9177de2, 0x0234830f,
+0x44c70000, 0x00031424, 0xf9c50000, 0x14245c6e,
+0xdbf3edc5, 0x142444c7, 0x00000002, 0x646ef9c5,
+0xedc51424, 0xfdc5d4f3, 0x4024547f, 0xd2d4edc5,
+0x000605b8, 0x6de2c400, 0xe2c4d329, 0x0fd1177d,
+0x0001f183, 0x6ef9c500, 0xc5142454, 0xc5d2d3e5,
+0xb8d2d4ed, 0x00000609, 0x296de2c4, 0xc4402454,
+0xd1177de2, 0x01cc830f, 0xe1c50000, 0xe2c4dbef,
+0x24942965, 0x000000e0, 0x296de2c4, 0xdbedc5d3,
+0x00802494, 0xfdc50000, 0x6024547f, 0x47ede2c4,
+0x00e0249c, 0xf5c50000, 0xe024a4d4, 0xc5000000,
+0x24a47ffd, 0x000000e0, 0x47ede2c4, 0x00e02494,
+0x21b80000, 0xc5000006, 0x24547ffd, 0xd4edc540,
+0x6de2c4d2, 0xe2c4d329, 0x0fd1177d, 0x00016583,
+0x6ffdc500, 0xc440246c, 0x9445d5e2, 0x0000e024,
+0x0626b800, 0xe2c40000, 0x2454296d, 0x7de2c460,
+0x830fd117, 0x0000013e, 0x00064eb8, 0xfde3c400,
+0x80249400, 0x1b000000, 0x9c6ffdc5, 0x0000a024,
+0x65e2c400, 0xe2c4d229, 0x0fd1177d, 0x00011583,
+0x0653b800, 0xfdc50000, 0x8024a46f, 0xc4000000,
+0xd400fde3, 0x6de3c4b1, 0xc401d246, 0xd3296de2,
+0x177de2c4, 0xeb830fd1, 0xc7000000, 0x05182444,
+0x31000000, 0xd4ddc5c0, 0x244489d3, 0x065db81c,
+0xe2c40000, 0x246c597d, 0x6de2c418, 0xe2c4d529,
+0x0fd1177d, 0x0000bd83, 0x7ffdc500, 0xc5402464,
+0x24947efa, 0x000000a8, 0xb46ffdc5, 0x0000c024,
+0xd6f9c500, 0xb8482454, 0x0000072a, 0x947efac5,
+0x0000b824, 0xd6f9c500, 0xc4582454, 0x948ccde2,
+0x00008024, 0x7ffdc500, 0xc5602454, 0xc4d6eff5,
+0x5c8eede2, 0xfdc56024, 0x60247c6f, 0x2945e2c4,
+0xc4402454, 0xd1177de2, 0x3ab85c73, 0xc5000007,
+0x24946ffd, 0x00000080, 0x026de3c4, 0x00a0249c,
+0xc4cc0000, 0x5c2965e2, 0xe2c44024, 0x73d9177d,
+0x6de3c435, 0xc401da46, 0xda0f65e3, 0xdbedc508,
+0x10048015, 0xd4edc500, 0x1004a015, 0xc4c03100,
+0xd3296de2, 0x177de2c4, 0xc0920fd1, 0x1901f883,
+0x074a25c0, 0x658d0000, 0x5f5e5bf4, 0x0000c35d,
+0x00000004, 0x00000000, 0x00000006, 0x00000000,
+0x00000006, 0x00000000, 0x00000004, 0x00000000,
+0x00000003, 0x00000000, 0x00000003, 0x00000000,
+0x00000003, 0x00000000, 0x00000003, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0002300,
+};
+asm(".type avx2_x86_32_D_32u8, STT_NOTYPE;");
+asm(".type avx2_x86_32_D_32u8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_32f4[] = {
+0x315500eb, 0x53e589c0, 0x000009bb, 0xe0e48300,
+0x00e0ec81, 0xc2890000, 0x24448940, 0xdbd9891c,
+0x291c2444, 0x01c2f6c1, 0x1c244c89, 0x7c845cd9,
+0x1c2444db, 0x9c849cd9, 0xd9000000, 0xd9e0d9e8,
+0xddc9dbe8, 0x08f883d9, 0xbc849cd9, 0x75000000,
+0x28fcc5c5, 0x008024bc, 0xfcc50000, 0x20247c29,
+0xc976f5c5, 0x5428fcc5, 0x39b82024, 0xc5000005,
+0x00dfc2ec, 0x177de2c4, 0x7a830fd9, 0xc5000005,
+0x249c58ec, 0x00000080, 0x5c29fcc5, 0x3fb84024,
+0xc5000005, 0x24bc28fc, 0x00000080, 0xdf58c4c5,
+0x5cc2e4c5, 0xc4004024, 0xd9177de2, 0x0547830f,
+0xfcc50000, 0x40247428, 0x9c5cccc5, 0x00008024,
+0x29fcc500, 0xb860245c, 0x00000544, 0x5cc2ecc5,
+0xc4006024, 0xd9177de2, 0x051b830f, 0xfcc50000,
+0xa024bc28, 0xc5000000, 0x249459ec, 0x00000080,
+0xe759c4c5, 0x9c28fcc5, 0x00008024, 0x58e4c500,
+0x055bb8f7, 0xe4c50000, 0xa024ac5c, 0xc5000000,
+0xc5d45cec, 0xc5ee59d4, 0x00d5c2ec, 0x177de2c4,
+0xd2830fd1, 0xc5000004, 0x249459e4, 0x000000c0,
+0x5429fcc5, 0x64b82024, 0xc5000005, 0x249c5ee4,
+0x000000c0, 0xd3c2ecc5, 0x7de2c400, 0x830fd117,
+0x000004a5, 0x187de2c4, 0x1006041d, 0x28fcc500,
+0x00c024b4, 0x67b80000, 0xc5000005, 0xc5d357cc,
+0x249c57e4, 0x00000080, 0x5459ecc5, 0xecc52024,
+0xc400d3c2, 0xd1177de2, 0x046b830f, 0xfdc50000,
+0x8024945b, 0xc5000000, 0xb8d25bfc, 0x0000056e,
+0x94c2ecc5, 0x00008024, 0xe2c40000, 0x0fd1177d,
+0x00044483, 0x53fcc500, 0x00802494, 0xfcc50000,
+0x20245429, 0x000575b8, 0x53fcc500, 0xc5202454,
+0x249c28fc, 0x00000080, 0xd25bfdc5, 0xd25bfcc5,
+0xd3c2ecc5, 0x7de2c400, 0x830fd117, 0x00000409,
+0xd359e4c5, 0x5429fcc5, 0xfcc52024, 0x20245452,
+0x5429fcc5, 0x7cb84024, 0xc5000005, 0x245428fc,
+0x53fcc540, 0x5bfdc5e2, 0x5bfcc5e4, 0xc2e4c5e4,
+0xe2c400dc, 0x0fd9177d, 0x0003cc83, 0x057eb800,
+0xfdc50000, 0xfcc5da5b, 0x80249428, 0xc5000000,
+0xc5db5bfc, 0xc5e253fc, 0xc5e45bfd, 0xc5e45bfc,
+0x00dcc2e4, 0x177de2c4, 0x9a830fd9, 0xc5000003,
+0xc5da59ec, 0x245c29fc, 0x059cb820, 0xfcc50000,
+0x20245c51, 0xdac2e4c5, 0x7de2c400, 0x830fd917,
+0x00000375, 0x187de2c4, 0x10062025, 0x5edcc500,
+0x29fcc5da, 0xb820245c, 0x000005a4, 0x087de3c4,
+0x0b20245c, 0x1dc2e4c5, 0x00100620, 0x7de2c400,
+0x830fd917, 0x00000341, 0x9c59ccc5, 0x0000a024,
+0x59ccc500, 0x29fcc5ea, 0xc540245c, 0x245c5fd4,
+0x5dd4c540, 0xc540246c, 0x246c29fc, 0x063db840,
+0xe4c50000, 0x40245c58, 0x9458ecc5, 0x0000a024,
+0x59e4c500, 0xc2e4c5de, 0xe2c400d2, 0x0fd1177d,
+0x0002f483, 0x064eb800, 0xe3c40000, 0x2494047d,
+0x00000080, 0x28fcc51b, 0x00a0249c, 0xe3c40000,
+0x01d2066d, 0xd2c2e4c5, 0x7de2c400, 0x830fd117,
+0x000002c5, 0x000001b8, 0x5bfdc500, 0x28fcc5d3,
+0x008024ac, 0xf9c50000, 0xe2c4f86e, 0xc5ff587d,
+0xc4d7faed, 0xd5166de2, 0x000653b8, 0xc2e4c500,
+0xe2c400d2, 0x0fd1177d, 0x00028c83, 0x10fac500,
+0x10068015, 0x58e4c500, 0x065db8ed, 0xe2c40000,
+0xc5d2187d, 0x00eac2d4, 0x177de2c4, 0x66830fe9,
+0xc5000002, 0x249412fe, 0x00000080, 0x187de2c4,
+0x1006002d, 0x5cecc500, 0x00802494, 0xd4c50000,
+0xe2c4ee58, 0x083d187d, 0xb8001006, 0x00000717,
+0xef59d4c5, 0xd5c2ecc5, 0x7de2c400, 0x830fd117,
+0x00000225, 0xac16fec5, 0x00008024, 0x071eb800,
+0xfcc50000, 0x80249428, 0xc5000000, 0xc5e458cc,
+0xc5ea5cd4, 0xc5e759dc, 0x00ecc2d4, 0x177de2c4,
+0xf2830fe9, 0xd9000001, 0x00a42484, 0xfcc50000,
+0x40245429, 0xe457d8c5, 0x00072ab8, 0xc2dcc500,
+0xe3c401e6, 0x40d24a65, 0x44245cd9, 0xac2484d9,
+0xd9000000, 0xd94c245c, 0x00b42484, 0x5cd90000,
+0x84d95424, 0x0000bc24, 0x245cd900, 0x28fcc55c,
+0xc540246c, 0x00d2c2d4, 0x177de2c4, 0x96830fd1,
+0xc4000001, 0x8c2c5de2, 0x00008024, 0xefe9c500,
+0x29fcc5d2, 0xb860244c, 0x00000733, 0xc976f5c5,
+0x4c75e3c4, 0xedc540ca, 0xe2c4d276, 0x245c2e75,
+0x28fcc560, 0xc5602474, 0x00cdc2cc, 0x177de2c4,
+0x52830fca, 0xb8000001, 0x0000073a, 0xbc28fcc5,
+0x00008024, 0x45e3c400, 0xa0248c0c, 0xaa000000,
+0xe9c2d4c5, 0x7de2c400, 0x830fea17, 0x00000129,
+0xb428fcc5, 0x00008024, 0xd0cfc500, 0x00a0248c,
+0x43b80000, 0xc5000007, 0x24bc28fc, 0x00000080,
+0x9cd0c7c5, 0x0000a024, 0xc2f4c500, 0xe2c400cb,
+0x0fca177d, 0x0000f083, 0x28fcc500, 0x008024a4,
+0xe3c40000, 0x249c405d, 0x000000a0, 0x11fac5f1,
+0xc41c245c, 0xdb197de3, 0x0752b801, 0x44d90000,
+0xfac51c24, 0x1c245c11, 0x1c2444d9, 0x5cd9c1de,
+0xfac51c24, 0x1c244c10, 0x0dc2f4c5, 0x00100640,
+0x7de2c400, 0x830fca17, 0x0000009d, 0x000003b8,
+0x29fcc500, 0xc5202464, 0xc5db57e0, 0x60256ffd,
+0x48001006, 0x4c7ce7c5, 0xe2c42024, 0xc5c9165d,
+0x244c29fc, 0xd9ec7520, 0x10060c05, 0x7de3c400,
+0xc401c919, 0x4c1779e3, 0xd9031c24, 0xdf1c2444,
+0x7ad8dde9, 0x314d754f, 0x28fcc5c0, 0x008024b4,
+0xcfc50000, 0xa0248c7d, 0xc4000000, 0xc9165de2,
+0xcb7cf7c5, 0x165de2c4, 0x7cf7c5c9, 0x5de2c4cb,
+0xf7c5c916, 0xe2c4cb7c, 0xc5c9165d, 0x00cbc2f4,
+0x177de2c4, 0xc0920fca, 0x1901f883, 0x076725c0,
+0x05eb0000, 0x00075eb8, 0xfc5d8b00, 0x0000c3c9,
+0xbf800000, 0x80000000, 0x3f000000, 0x42100000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x42f00000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000001, 0x00000004, 0x00000005,
+0x00000002, 0x00000003, 0x00000006, 0x00000007,
+0x41100000, 0x00000000, 0x00000000, 0x00000000,
+0003220,
+};
+asm(".type avx2_x86_32_D_32f4, STT_NOTYPE;");
+asm(".type avx2_x86_32_D_32f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_32f8[] = {
+0xd95500eb, 0x83e589e8, 0xec81e0e4, 0x000000e0,
+0x802494dd, 0xd9000000, 0x1005e005, 0x2494dd00,
+0x000000a0, 0x94ddc9d9, 0x0000c024, 0xe405d900,
+0xdd001005, 0x00882494, 0x05d90000, 0x001005e8,
+0xa82494dd, 0xd9000000, 0xdde0d9e8, 0x00c82494,
+0xc9d90000, 0x90249cdd, 0xd9000000, 0x249cddc9,
+0x000000b0, 0x94ddc9d9, 0x0000d024, 0xddcad900,
+0x0098249c, 0xc9d90000, 0xb8249cdd, 0xdd000000,
+0x00d8249c, 0xfdc50000, 0x8024bc28, 0xc5000000,
+0x247c29fd, 0x76f5c520, 0x28fdc5c9, 0xb8202454,
+0x00000539, 0xdfc2edc5, 0x7de2c400, 0x830fd917,
+0x0000051e, 0x9c58edc5, 0x00008024, 0x29fdc500,
+0xb840245c, 0x0000053f, 0xbc28fdc5, 0x00008024,
+0x58c5c500, 0xc2e5c5df, 0x0040245c, 0x177de2c4,
+0xeb830fd9, 0xc5000004, 0x247c28fd, 0x5cc5c540,
+0x0080249c, 0xfdc50000, 0x60245c29, 0x000544b8,
+0xc2edc500, 0x0060245c, 0x177de2c4, 0xbf830fd9,
+0xc5000004, 0x24b428fd, 0x000000a0, 0x9459edc5,
+0x00008024, 0x59cdc500, 0x28fdc5e6, 0x0080249c,
+0xe5c50000, 0x5bb8f658, 0xc5000005, 0x24ac5ce5,
+0x000000a0, 0xd45cedc5, 0xee59d5c5, 0xd5c2edc5,
+0x7de2c400, 0x830fd117, 0x00000476, 0x9459e5c5,
+0x0000c024, 0x29fdc500, 0xb8202454, 0x00000564,
+0x9c5ee5c5, 0x0000c024, 0xc2edc500, 0xe2c400d3,
+0x0fd1177d, 0x00044983, 0x7de2c400, 0x05f02519,
+0xfdc50010, 0xc0249c28, 0xb8000000, 0x00000567,
+0xd457e5c5, 0xa457ddc5, 0x00008024, 0x59edc500,
+0xc5202454, 0x00d4c2ed, 0x177de2c4, 0x0f830fd1,
+0xc5000004, 0x2494e6ff, 0x00000080, 0xd2e6fec5,
+0x00056eb8, 0xc2edc500, 0x00802494, 0xc4000000,
+0xd1177de2, 0x03e8830f, 0xfdc50000, 0x8024945a,
+0xc4000000, 0xd2186de3, 0x53fcc501, 0x5afcc5d2,
+0x29fdc5d2, 0xb8202454, 0x00000575, 0x545afdc5,
+0xfdc52024, 0x8024a428, 0xc5000000, 0x245429f8,
+0x6de3c410, 0xc501d218, 0xc5d253fc, 0xc5d25afc,
+0xc5d2e6ff, 0xc5d2e6fe, 0x00d4c2ed, 0x177de2c4,
+0x8b830fd1, 0xc5000003, 0xc5d459dd, 0x245429fd,
+0x5afdc520, 0xc4202454, 0xd2186de3, 0x52fcc501,
+0x5afcc5d2, 0x29fdc5d2, 0xc5402454, 0x246c28fd,
+0x5afdc540, 0x057cb8d5, 0xf8c50000, 0x10245429,
+0x186de3c4, 0xfcc501d2, 0xfcc5d253, 0xffc5d25a,
+0xfec5d2e6, 0xddc5d2e6, 0xc400e2c2, 0xe1177de2,
+0x032c830f, 0xfdc50000, 0x8024a428, 0xc5000000,
+0xc5d45afd, 0xb8ede6ff, 0x0000057e, 0xede6fec5,
+0x5429f8c5, 0xe3c41024, 0x01d2186d, 0xd253fcc5,
+0xd25afcc5, 0xd2e6ffc5, 0xd2e6fec5, 0xeac2d5c5,
+0x7de2c400, 0x830fe917, 0x000002e6, 0xd459ddc5,
+0x5429fdc5, 0x9cb82024, 0xc5000005, 0x245451fd,
+0xc2edc520, 0xe2c400d4, 0x0fd1177d, 0x0002c183,
+0x7de2c400, 0x06201519, 0xedc50010, 0xfdc5d45e,
+0x20245429, 0x0005a4b8, 0x7de3c400, 0x20245409,
+0xc2edc50b, 0x10062015, 0xe2c40000, 0x0fd1177d,
+0x00028d83, 0x59e5c500, 0x00a02494, 0xe5c50000,
+0xfdc5ec59, 0x40245429, 0x545fd5c5, 0xd5c54024,
+0x40246c5d, 0x6c29fdc5, 0x3db84024, 0xc5000006,
+0x245458ed, 0x58ddc540, 0x00a024a4, 0xedc50000,
+0xedc5d359, 0xc400d4c2, 0xd1177de2, 0x0240830f,
+0x4eb80000, 0xc4000006, 0x94057de3, 0x00008024,
+0xfdc50500, 0xa024a428, 0xc4000000, 0xd2066de3,
+0xc2ddc501, 0xe2c400d2, 0x0fd1177d, 0x00021183,
+0x0653b800, 0xfdc50000, 0x80249428, 0xc4000000,
+0xea01fde3, 0xc2d5c51b, 0xe2c400ec, 0x0fe9177d,
+0x0001ed83, 0x58edc500, 0x7efac5d4, 0x1006402d,
+0x065db800, 0xe2c40000, 0xc5ed197d, 0x00d5c2ed,
+0x177de2c4, 0xc7830fd1, 0xc5000001, 0x24ac12ff,
+0x00000080, 0x197de2c4, 0x1005f835, 0x28fdc500,
+0x00802494, 0xe5c50000, 0xd5c5f658, 0xe2c4ea5c,
+0x003d197d, 0xb8001006, 0x00000717, 0xf759cdc5,
+0xeec2d5c5, 0x7de2c400, 0x830fe917, 0x00000182,
+0x5429fdc5, 0xd1c54024, 0xfbc5ed57, 0xa824bc10,
+0xc5000000, 0x01dbc2d5, 0x7c11fbc5, 0xfbc54824,
+0xb824b410, 0xc4000000, 0xd24b5de3, 0x11fbc530,
+0xb8582474, 0x0000072a, 0x6c28fdc5, 0xd5c54024,
+0xc400d2c2, 0xd1177de2, 0x0134830f, 0xe2c40000,
+0x24942d65, 0x00000080, 0x000733b8, 0x29fdc500,
+0xc5602454, 0xc4d2efe9, 0xd24c75e3, 0x6de2c430,
+0x6024642f, 0x7c28fdc5, 0xc5c56024, 0xc400d5c2,
+0xd1177de2, 0x00f8830f, 0x3ab80000, 0xc5000007,
+0x24b428fd, 0x00000080, 0x0d4de3c4, 0x00a02494,
+0xc50a0000, 0x00eac2d5, 0x177de2c4, 0xcf830fe9,
+0xc5000000, 0x24bc28fd, 0x00000080, 0x8cd0c5c5,
+0x0000a024, 0x0743b800, 0xfdc50000, 0x80249c28,
+0xc5000000, 0x2494d0e5, 0x000000a0, 0xcac2f5c5,
+0x76edc500, 0x7de2c4d2, 0x830fca17, 0x00000092,
+0x5c29fdc5, 0xe1c52024, 0xe5c5db57, 0x20244c7c,
+0x01fde3c4, 0xfdc5d8c9, 0x20244c29, 0x4c7ce5c5,
+0xe3c42024, 0xd8c901fd, 0x197de3c4, 0xf9c501c9,
+0x08244c17, 0x05ec05d9, 0x44dd0010, 0xe9df0824,
+0x497ad8dd, 0xc0314775, 0xb428fdc5, 0x00008024,
+0x7dcdc500, 0x00a0248c, 0xe3c40000, 0xd8c901fd,
+0xcb7cf5c5, 0x01fde3c4, 0xf5c5d8c9, 0xe3c4cb7c,
+0xd8c901fd, 0xcbc2f5c5, 0x7de2c400, 0x920fca17,
+0x01f883c0, 0x6725c019, 0xeb000007, 0x075eb805,
+0xc3c90000, 0x00000000, 0x00000000, 0x00000000,
+0x40800000, 0x40000000, 0x40400000, 0x41200000,
+0x00000000, 0x80000000, 0x00000000, 0xbff00000,
+0x00000000, 0x3fe00000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x40140000, 0x00000000, 0x00000000,
+0003120,
+};
+asm(".type avx2_x86_32_D_32f8, STT_NOTYPE;");
+asm(".type avx2_x86_32_D_32f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_f4[] = {
+0x31551aeb, 0x80e589c0, 0xff08287c, 0x83400a75,
+0xf37504f8, 0x02eb01b0, 0xc35dc031, 0x04244c8d,
+0xffe0e483, 0x8955fc71, 0xec8151e5, 0x00000124,
+0x0d10fac5, 0x00100560, 0x8d11fac5, 0xffffff28,
+0x8d11fac5, 0xffffff2c, 0x8d11fac5, 0xffffff30,
+0xff28858b, 0x8589ffff, 0xffffff1c, 0x9510fac5,
+0xffffff28, 0x00bac031, 0xc5000000, 0x1c952ef8,
+0x0fffffff, 0x450fc09b, 0x89d8f7c2, 0x7fe82404,
+0x83ffffff, 0xc18810c4, 0x000539b8, 0x0fc98400,
+0x0004c384, 0x10fac500, 0xffff1c95, 0x58eac5ff,
+0xffff2895, 0x11fac5ff, 0xffff2095, 0x10fac5ff,
+0xffff2895, 0x10ec83ff, 0xeac5c031, 0xf8c5d258,
+0xff20952e, 0x9b0fffff, 0xc2450fc0, 0x0489d8f7,
+0xff2ce824, 0xc483ffff, 0xb8c18810, 0x0000053f,
+0x840fc984, 0x00000470, 0x9510fac5, 0xffffff20,
+0x955ceac5, 0xffffff28, 0x9511fac5, 0xfffffee8,
+0xfee8858b, 0x8589ffff, 0xffffff5c, 0xff208589,
+0x8589ffff, 0xffffff24, 0x9510fac5, 0xffffff1c,
+0x3110ec83, 0x2ef8c5c0, 0xffff2495, 0xc09b0fff,
+0xf7c2450f, 0x240489d8, 0xfffec5e8, 0x10c483ff,
+0x44b8c188, 0x84000005, 0x09840fc9, 0xc5000004,
+0x1c9510fa, 0xc5ffffff, 0x289559ea, 0xc5ffffff,
+0x1c9511fa, 0xc5ffffff, 0x2c9510fa, 0xc5ffffff,
+0xc5d259ea, 0x209511fa, 0xc5ffffff, 0x289510fa,
+0xc5ffffff, 0x2c9558ea, 0xc5ffffff, 0x249511fa,
+0xc5ffffff, 0x289510fa, 0x83ffffff, 0xfac510ec,
+0xff1ca510, 0xc031ffff, 0x9d5ceac5, 0xffffff2c,
+0xa55cdac5, 0xffffff20, 0x9d59e2c5, 0xffffff24,
+0x9d11fac5, 0xffffff24, 0xe32ef8c5, 0x0fc09b0f,
+0xd8f7c245, 0xe8240489, 0xfffffe26, 0x8810c483,
+0x055bb8c1, 0xc9840000, 0x036a840f, 0xeac50000,
+0xff309559, 0xfac5ffff, 0xff1c9511, 0xfac5ffff,
+0xff289510, 0xec83ffff, 0xc5c03110, 0x30955eea,
+0xc5ffffff, 0x1c952ef8, 0xc5ffffff, 0x209511fa,
+0x0fffffff, 0x450fc09b, 0x89d8f7c2, 0xcfe82404,
+0x83fffffd, 0xc18810c4, 0x000564b8, 0x0fc98400,
+0x00031384, 0x10fac500, 0x10057025, 0x10ec8300,
+0x9510fac5, 0xffffff30, 0xfac5c031, 0xff289d10,
+0xe8c5ffff, 0xeac5d457, 0xff1c9559, 0xe0c5ffff,
+0xf8c5dc57, 0x9b0fd32e, 0xc2450fc0, 0x0489d8f7,
+0xfd7ce824, 0xc483ffff, 0xb8c18810, 0x00000567,
+0x840fc984, 0x000002c0, 0x852cfac5, 0xffffff28,
+0xff348589, 0xeac5ffff, 0xff34952a, 0xfac5ffff,
+0xff1c9511, 0xfac5ffff, 0xff1c9510, 0xec83ffff,
+0xc5c03110, 0x28952ef8, 0x0fffffff, 0x450fc09b,
+0x89d8f7c2, 0x27e82404, 0x83fffffd, 0xc18810c4,
+0x00056eb8, 0x0fc98400, 0x00026b84, 0x530ff300,
+0xffff2895, 0x11fac5ff, 0xffff1c95, 0x530ff3ff,
+0xffff1c95, 0x2cfac5ff, 0x348589c2, 0xc5ffffff,
+0x349d2ae2, 0x83ffffff, 0xc03110ec, 0x9510fac5,
+0xffffff28, 0xda2ef8c5, 0x0fc09b0f, 0xd8f7c245,
+0xe8240489, 0xfffffcca, 0x8810c483, 0x0575b8c1,
+0xc9840000, 0x020e840f, 0xeac50000, 0xfac5d259,
+0xff1c9511, 0x0ff3ffff, 0xff1c9552, 0xfac5ffff,
+0xff209511, 0x0ff3ffff, 0xff209553, 0xfac5ffff,
+0x8589c22c, 0xffffff34, 0x952aeac5, 0xffffff34,
+0x3110ec83, 0x2ef8c5c0, 0xffff2895, 0xc09b0fff,
+0xf7c2450f, 0x240489d8, 0xfffc65e8, 0x10c483ff,
+0x7cb8c188, 0x84000005, 0xa9840fc9, 0xc5000001,
+0x20852cfa, 0x89ffffff, 0xffff3485, 0x530ff3ff,
+0xffff2895, 0x2cfac5ff, 0x2ae2c5c2, 0xffff349d,
+0x348589ff, 0xc5ffffff, 0x34952aea, 0x83ffffff,
+0xc03110ec, 0xda2ef8c5, 0x0fc09b0f, 0xd8f7c245,
+0xe8240489, 0xfffffc0a, 0x8810c483, 0x057eb8c2,
+0xd2840000, 0x014e840f, 0xfac50000, 0xff289510,
+0xeac5ffff, 0xfac5d259, 0xff1c9511, 0xfac5ffff,
+0xff289510, 0xec83ffff, 0xbac03110, 0x00000000,
+0x9d510ff3, 0xffffff1c, 0xda2ef8c5, 0x0fc09b0f,
+0xd8f7c245, 0xe8240489, 0xfffffbb6, 0x8810c483,
+0x059cb8c1, 0xc9840000, 0x00fa840f, 0xf2c50000,
+0xfac5d25e, 0xff208d11, 0xfac5ffff, 0xff1c9511,
+0xc031ffff, 0x6610ec83, 0x8d0a3a0f, 0xffffff1c,
+0x2ef8c50b, 0xffff208d, 0x11fac5ff, 0xffff248d,
+0xc09b0fff, 0xf7c2450f, 0x240489d8, 0xfffb61e8,
+0x10c483ff, 0xa4b8c188, 0x84000005, 0xa5840fc9,
+0xc5000000, 0x308d10fa, 0xc5ffffff, 0x289559f2,
+0xc5ffffff, 0x2c8d59f2, 0xc5ffffff, 0x1c9511fa,
+0xc5ffffff, 0x208d11fa, 0xc5ffffff, 0x1c8d10fa,
+0xc5ffffff, 0x208d5ff2, 0xc5ffffff, 0x248d11fa,
+0xc5ffffff, 0x1c8d10fa, 0xc5ffffff, 0x208d5df2,
+0xc5ffffff, 0x208d11fa, 0xc5ffffff, 0x208d10fa,
+0x83ffffff, 0xfac510ec, 0xff289510, 0xc031ffff,
+0x8d58f2c5, 0xffffff24, 0x9558eac5, 0xffffff2c,
+0x8d59f2c5, 0xffffff30, 0xca2ef8c5, 0x0fc09b0f,
+0xd8f7c245, 0xe8240489, 0xfffffab6, 0x3c10c483,
+0x25c01901, 0x0000063d, 0xc9fc4d8b, 0xc3fc618d,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0002600,
+};
+asm(".type avx2_x86_32_D_f4, STT_NOTYPE;");
+asm(".type avx2_x86_32_D_f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_32_D_f8[] = {
+0x895500eb, 0xe0e483e5, 0x01e0ec81, 0xfbc50000,
+0x05900d10, 0xfbc50010, 0x68244c11, 0x4c11fbc5,
+0xfbc57024, 0x78244c11, 0x6824448b, 0x50244489,
+0x6c24448b, 0x54244489, 0x6c10fbc5, 0xf9c56824,
+0x50246c2e, 0x01b80c7a, 0xba000000, 0x00000000,
+0xc0310474, 0xd8f7d231, 0x18244489, 0xb800d283,
+0x00000539, 0x5489daf7, 0x6f0f1c24, 0x0f182444,
+0xfa81d0d7, 0x000000ff, 0x0506850f, 0xfbc50000,
+0x50247410, 0x5458cbc5, 0xfbc56824, 0x58245411,
+0xfbc5d231, 0x68245410, 0x000001b8, 0x58ebc500,
+0x2ef9c5d2, 0x7a582454, 0x31047402, 0xf7d231c0,
+0x244489d8, 0x00d28318, 0x00053fb8, 0x89daf700,
+0x0f1c2454, 0x18244c6f, 0x81d1d70f, 0x0000fffa,
+0xad850f00, 0xc5000004, 0x247c10fb, 0x5cc3c558,
+0xc5682454, 0x245411fb, 0x24548b20, 0x24448b20,
+0x24948924, 0x000000c8, 0xcc248489, 0x89000000,
+0x89582454, 0x895c2444, 0x89602454, 0x31642444,
+0x10fbc5d2, 0xb8502464, 0x00000001, 0x642ef9c5,
+0x027a6024, 0xc0310474, 0xd8f7d231, 0x18244489,
+0xb800d283, 0x00000544, 0x5489daf7, 0x6f0f1c24,
+0x0f182454, 0xfa81d2d7, 0x000000ff, 0x0432850f,
+0xfbc50000, 0x50246c10, 0x5459d3c5, 0xfbc56824,
+0x50245411, 0x5410fbc5, 0xebc57024, 0xfbc5d259,
+0x58245411, 0x7410fbc5, 0xcbc56824, 0x70245458,
+0x5411fbc5, 0xd2316024, 0x5410fbc5, 0xfbc56824,
+0x50247c10, 0x5c5cebc5, 0xc3c57024, 0x5824645c,
+0x5c59e3c5, 0x01b86024, 0xc5000000, 0x245c11fb,
+0x2ef9c560, 0x74027ae3, 0x31c03104, 0x89d8f7d2,
+0x83182444, 0x5bb800d2, 0xf7000005, 0x245489da,
+0x5c6f0f1c, 0xd70f1824, 0xfffa81d3, 0x0f000000,
+0x00039f85, 0x59ebc500, 0xc5782454, 0x245411fb,
+0xc5d23150, 0x246410fb, 0x0001b868, 0xdbc50000,
+0x7824545e, 0x5411fbc5, 0xf9c55824, 0x5024542e,
+0x0474027a, 0xd231c031, 0x4489d8f7, 0xd2831824,
+0x0564b800, 0xdaf70000, 0x1c245489, 0x24646f0f,
+0xd4d70f18, 0x00fffa81, 0x850f0000, 0x00000344,
+0x1d7efac5, 0x001005a0, 0xfbc5d231, 0x78246c10,
+0x7410fbc5, 0xd1c56824, 0x01b8d357, 0xc5000000,
+0x245459eb, 0x57c9c550, 0x2ef9c5db, 0x74027ad3,
+0x31c03104, 0x89d8f7d2, 0x83182444, 0x67b800d2,
+0xf7000005, 0x245489da, 0x6c6f0f1c, 0xd70f1824,
+0xfffa81d5, 0x0f000000, 0x0002e785, 0x2cfbc500,
+0x89682444, 0xc54c2444, 0x24542aeb, 0x11fbc54c,
+0x31502454, 0x10fbc5d2, 0xb850247c, 0x00000001,
+0x7c2ef9c5, 0x027a6824, 0xc0310474, 0xd8f7d231,
+0x18244489, 0xb800d283, 0x0000056e, 0x5489daf7,
+0x6f0f1c24, 0x0f182474, 0xfa81d6d7, 0x000000ff,
+0x028e850f, 0x0ff20000, 0x6824545a, 0xd2530ff3,
+0xd25a0ff3, 0x5413f9c5, 0x0ff25024, 0x5024545a,
+0xd2530ff3, 0xd25a0ff3, 0xc22cfbc5, 0x4c244489,
+0x5c2ae3c5, 0xd2314c24, 0x5410fbc5, 0x01b86824,
+0xc5000000, 0x7ada2ef9, 0x31047402, 0xf7d231c0,
+0x244489d8, 0x00d28318, 0x000575b8, 0x89daf700,
+0x0f1c2454, 0x18247c6f, 0x81d7d70f, 0x0000fffa,
+0x1d850f00, 0xc5000002, 0xc5d259eb, 0x245411fb,
+0x5a0ff250, 0xf3502454, 0xf3d2520f, 0xc5d25a0f,
+0x245413f9, 0x5a0ff258, 0xf3582454, 0xf3d2530f,
+0xc5d25a0f, 0x89c22cfb, 0xc54c2444, 0x24542aeb,
+0xb8d2314c, 0x00000001, 0x542ef9c5, 0x027a6824,
+0xc0310474, 0xd8f7d231, 0x18244489, 0xb800d283,
+0x0000057c, 0x5489daf7, 0x6f0f1c24, 0x0f182444,
+0xfa81d0d7, 0x000000ff, 0x01a6850f, 0xfbc50000,
+0x5824442c, 0x4c244489, 0x545a0ff2, 0x0ff36824,
+0x0ff3d253, 0xfbc5d25a, 0x448bd22c, 0x54894c24,
+0x443b4c24, 0x940f4c24, 0x0fd231c0, 0xd8f7c0b6,
+0x18244489, 0xb800d283, 0x0000057e, 0x5489daf7,
+0x6f0f1c24, 0x0f18244c, 0xfa81d1d7, 0x000000ff,
+0x014e850f, 0xfbc50000, 0x68245410, 0xd259ebc5,
+0x5411fbc5, 0xd2315024, 0x5410fbc5, 0x01b86824,
+0xf2000000, 0x245c510f, 0x2ef9c550, 0x74027ada,
+0x31c03104, 0x89d8f7d2, 0x83182444, 0x9cb800d2,
+0xf7000005, 0x245489da, 0x546f0f1c, 0xd70f1824,
+0xfffa81d2, 0x0f000000, 0x0000f785, 0x5ef3c500,
+0x11fbc5d2, 0xc558244c, 0x245411fb, 0xb8d23150,
+0x00000001, 0x0b3a0f66, 0x0b50244c, 0x4c11fbc5,
+0xf9c56024, 0x58244c2e, 0x0474027a, 0xd231c031,
+0x4489d8f7, 0xd2831824, 0x05a4b800, 0xdaf70000,
+0x1c245489, 0x245c6f0f, 0xd3d70f18, 0x00fffa81,
+0x850f0000, 0x0000009c, 0x4c10fbc5, 0xf3c57824,
+0x68245459, 0x4c59f3c5, 0xfbc57024, 0x50245411,
+0x4c11fbc5, 0xfbc55824, 0x50246410, 0x4c5fdbc5,
+0xfbc55824, 0x60244c11, 0x6c10fbc5, 0xd3c55024,
+0x58244c5d, 0x4c11fbc5, 0xd2315824, 0x7410fbc5,
+0xfbc55824, 0x68247c10, 0x4c58cbc5, 0xc3c56024,
+0x70245458, 0x4c59f3c5, 0x01b87824, 0xc5000000,
+0x7aca2ef9, 0x31047402, 0xf7d231c0, 0x244489d8,
+0x00d28318, 0x5489daf7, 0x00ba1c24, 0x0f000000,
+0x1824646f, 0x3dc4d70f, 0x000000ff, 0x00063db8,
+0xc2440f00, 0x0000c3c9, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x00000000,
+0002660,
+};
+asm(".type avx2_x86_32_D_f8, STT_NOTYPE;");
+asm(".type avx2_x86_32_D_f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_16i1[] = {
+0xb85500eb, 0x00000001, 0x000008be, 0x11b74000,
+0x41e58948, 0x41564157, 0x53544155, 0x20ec8348,
+0x488dfa89, 0x054488ff, 0x88c2298f, 0x899f0554,
+0x01e283ca, 0x1901fa83, 0x83c121d2, 0xcaff02e2,
+0x8301f983, 0x548800de, 0x8840af05, 0x48bf0574,
+0x8348c0ff, 0xc87511f8, 0x7d6ff9c5, 0x7ff9c590,
+0xffff60bd, 0x6ff9c5ff, 0xffff6095, 0x0539b8ff,
+0xe9c50000, 0xc1c5cf74, 0xe2c4ff76, 0x0fcf1779,
+0x00058983, 0xfce9c500, 0xf9c5904d, 0xff708d7f,
+0xf9c5ffff, 0xb8904d6f, 0x0000053f, 0xc9fcf1c5,
+0x8d74f1c5, 0xffffff70, 0x1779e2c4, 0x5b830fcf,
+0xc5000005, 0x709d6ff9, 0xc5ffffff, 0x904df8e1,
+0x4d7ff9c5, 0x74e9c580, 0x44b88055, 0xc4000005,
+0xd71779e2, 0x0534830f, 0x79c50000, 0xc590456f,
+0xb04d6f79, 0x256ff9c5, 0x00000534, 0x6d6ff9c5,
+0x3141c4c0, 0xc1c4f960, 0xc4d06039, 0xc9683141,
+0x6839c1c4, 0xd581c5c8, 0xd5b1c5d2, 0xdbd9c5c9,
+0xdbd9c5d2, 0x67e9c5c9, 0xeff1c5d1, 0x64d1c5c9,
+0xdbf1c5c9, 0x7ff9c5da, 0x458a805d, 0xc04d8a80,
+0x8a44c289, 0x8a44817d, 0x8a448255, 0xe2d38375,
+0x40c14d8a, 0x44847d8a, 0x8a856d8a, 0x9588865d,
+0xffffff5c, 0x8ae7d341, 0x8a40c24d, 0x8a448775,
+0x8a448965, 0xd3418a4d, 0xc34d8ae2, 0x8d5d8a44,
+0x6e79c1c4, 0xe6d341ea, 0xc4c44d8a, 0xee2051c3,
+0x8ae7d301, 0x79c5c54d, 0xd341ef6e, 0xc64d8ae5,
+0x201143c4, 0xe3d301ed, 0x88c74d8a, 0xffff589d,
+0x885d8aff, 0x4d8ae6d3, 0xb58840c8, 0xffffff54,
+0x8c758a40, 0x4d8ae3d3, 0x409d88c9, 0x8affffff,
+0xd3418b5d, 0xca4d8ae4, 0x8ae1d341, 0x41c4cb4d,
+0xd3e16e79, 0xcc4d8ae3, 0x201963c4, 0xe6d301e3,
+0xc5cd4d8a, 0x41d66e79, 0x4d8ae3d3, 0x458a44ce,
+0x6ef9c58e, 0xffff408d, 0x8f558aff, 0xb56ef9c5,
+0xffffff5c, 0x9d6ef9c5, 0xffffff58, 0x2061e3c4,
+0xffff549d, 0xd34101ff, 0xcf4d8ae0, 0x2049c3c4,
+0xc3c401f7, 0x01cc2071, 0x6e7941c4, 0x2943c4d8,
+0xc501d320, 0xd3f561c9, 0x6191c5e2, 0x71c1c4eb,
+0x63c4cc61, 0x01da2021, 0xf562c9c5, 0x6129c1c4,
+0x62f1c5db, 0x6cc9c5cb, 0x7ff9c5f1, 0xffff40b5,
+0x6f79c5ff, 0x0003c72d, 0x6ff9c500, 0xc1c4c06d,
+0xc5cdf851, 0xc04d7ff9, 0x44c04d8a, 0x44824d8a,
+0x44837d8a, 0xd384458a, 0xc14d8ae0, 0x85758a44,
+0x867d8a40, 0x876d8a44, 0xff5c8588, 0x458affff,
+0x758a4081, 0x658a4488, 0x8a558a89, 0x4d8ae0d3,
+0x8b5d8ac2, 0x8d5d8a44, 0x8e558a44, 0xff588588,
+0xd341ffff, 0xc34d8ae1, 0xc48c458a, 0xc96e79c1,
+0x8ae7d341, 0xc3c4c44d, 0x01cf2071, 0x8ae0d341,
+0x41c4c54d, 0x41e06e79, 0x4d8ae6d3, 0x1943c4c6,
+0xd301e620, 0xc74d8ae7, 0xf76ef9c5, 0x8ae5d341,
+0xc3c4c84d, 0x01f52049, 0x4d8ae6d3, 0x6199c5c9,
+0x6ef9c5f6, 0xe4d341de, 0xc4ca4d8a, 0xdc2061c3,
+0x8ae2d301, 0x79c5cb4d, 0xe3d3da6e, 0xc4cc4d8a,
+0xdb202163, 0x8ae0d301, 0xc1c4cd4d, 0x88db6161,
+0xffff5485, 0xe3d341ff, 0x41ce4d8a, 0x4d8ae2d3,
+0x8f458acf, 0xb56e79c5, 0xffffff5c, 0xad6ef9c5,
+0xffffff54, 0x6e7941c4, 0x0963c4d2, 0xff58b520,
+0xd301ffff, 0x51c3c4e0, 0xc401eb20, 0xd0202963,
+0x6189c501, 0x0621b8c9, 0xc1c40000, 0xc5ea6151,
+0xc5ce62f1, 0xc5dd62e1, 0xc5cb6cf1, 0xc5c9fcf1,
+0x408d74f1, 0xc4ffffff, 0xcf1779e2, 0x025c830f,
+0xf9c50000, 0xc5a05d6f, 0x60957ff9, 0xc5ffffff,
+0xc5cb60e1, 0xc4eb68e1, 0xcfd571c1, 0xd551c1c4,
+0xdbd9c5e9, 0xdbd9c5c9, 0x67f1c5ed, 0x7ff9c5cd,
+0xffff708d, 0x69e2c4ff, 0xff708d3c, 0xe2c4ffff,
+0x70953869, 0xc5ffffff, 0x70957ff9, 0xc5ffffff,
+0x708dfcf1, 0xb8ffffff, 0x0000063d, 0xd160f1c5,
+0xc968f1c5, 0xd569c1c4, 0x71c1c4d7, 0xd9c5c9d5,
+0xd9c5d2db, 0xe9c5c9db, 0xb9c5c967, 0xf1c5d3fc,
+0xe2c4ca74, 0x0fcf1779, 0x0001d183, 0x79e2c400,
+0xff608d1c, 0x39c5ffff, 0x44b8c174, 0xc4000006,
+0xc7177962, 0x01b4830f, 0xf9c50000, 0xb8b06d6f,
+0x00000649, 0x0811e2c4, 0x74d1c5cd, 0x79e2c4c9,
+0x830fcf17, 0x00000196, 0x756ff9c5, 0x6141c490,
+0x4eb8edf8, 0xc4000006, 0xed004942, 0x746141c4,
+0x7962c4ed, 0x830fef17, 0x00000172, 0x4d60e1c5,
+0x68e1c590, 0xf1c59055, 0x51c5caf8, 0xd1c5c560,
+0xa8b8f568, 0xc5000006, 0xc5d160f1, 0xc5c968f1,
+0xc5c9d5c9, 0xc5d2d5b9, 0xc5d2dbd9, 0xc5e1dbd9,
+0xc5cc67e9, 0x650d74f1, 0xc4000001, 0xcf1779e2,
+0x0128830f, 0xf9c50000, 0xc5904d6f, 0xc5e168f1,
+0xc5d160f1, 0xc4f6d5d9, 0xd0d569c1, 0x256ff9c5,
+0x0000011c, 0xd2dbd9c5, 0xe6dbd9c5, 0xd467e9c5,
+0xe4efd9c5, 0xe564d9c5, 0x957ff9c5, 0xffffff60,
+0xd460e9c5, 0xbd6ff9c5, 0xffffff60, 0x2079e2c4,
+0x74e9c5f7, 0x76c1c5d6, 0x06b3b8ff, 0xe2c40000,
+0x0fd71779, 0x0000c583, 0x60d9c500, 0x60c9c5d4,
+0x6ff9c5f2, 0xffff60a5, 0x79e2c4ff, 0xc9c5e421,
+0xbbb8f474, 0xc4000006, 0xf71779e2, 0x009c830f,
+0xe9c50000, 0xd9c5d260, 0xf9c5e260, 0xff60b56f,
+0xe2c4ffff, 0xc5d62279, 0x80557ff9, 0xd474e9c5,
+0x0006c4b8, 0x79e2c400, 0x7273d717, 0x8d7ff9c5,
+0xffffff70, 0x000001b8, 0x05548a00, 0x059488a0,
+0xffffff70, 0x02c08348, 0x11f88348, 0xe9c5eb75,
+0x2ab8d2ef, 0xc5000007, 0xc4ea64d1, 0xd94c61e3,
+0x74e1c550, 0xffff709d, 0x79e2c4ff, 0x2e73df17,
+0x0f71e3c4, 0xf1c501d1, 0x00620ddb, 0xc0310000,
+0x0dfcf1c5, 0x00000038, 0xca74f1c5, 0x1779e2c4,
+0xc0920fcf, 0x1901f883, 0x074a25c0, 0x83480000,
+0x415b20c4, 0x415d415c, 0x5d5f415e, 0x000000c3,
+0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff,
+0x01010101, 0x01010101, 0x01010101, 0x01010101,
+0x08080808, 0x08080808, 0x08080808, 0x08080808,
+0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f,
+0003140,
+};
+asm(".type avx2_x86_64_D_16i1, STT_NOTYPE;");
+asm(".type avx2_x86_64_D_16i1, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_16u1[] = {
+0xb85500eb, 0x00000001, 0x000008b9, 0x11b74000,
+0x41e58948, 0x41564157, 0x53544155, 0x10ec8348,
+0x508dfe89, 0x054488ff, 0x40c6298f, 0x9f057488,
+0xc221d689, 0xff01e683, 0x01fa83ce, 0x4000d983,
+0xaf057488, 0xbf054c88, 0x48c0ff48, 0x7511f883,
+0x6ff9c5cf, 0xf9c5907d, 0xff60bd7f, 0xf9c5ffff,
+0xff609d6f, 0xe9c5ffff, 0x39b8d276, 0xc5000005,
+0xc4cf74e1, 0xca1779e2, 0x04b2830f, 0xe1c50000,
+0xc5904dfc, 0x708d7ff9, 0xc5ffffff, 0x904d6ff9,
+0x00053fb8, 0xfcf1c500, 0x74f1c5c9, 0xffff708d,
+0x79e2c4ff, 0x830fca17, 0x00000484, 0xbd6ff9c5,
+0xffffff70, 0x4df8c1c5, 0x7ff9c590, 0xe1c5804d,
+0xb8806574, 0x00000544, 0x1779e2c4, 0x5d830fe2,
+0xc5000004, 0xa05debe1, 0x9d7ff9c5, 0xffffff60,
+0x4ddbf1c5, 0x6ff9c5a0, 0xc1c5807d, 0xc5a05def,
+0x608ddff1, 0xc5ffffff, 0xb8e476d9, 0x00000550,
+0xcb74f1c5, 0x1779e2c4, 0x21830fca, 0xc5000004,
+0xc5dbefe1, 0xc04d74e1, 0xcb74f1c5, 0x75dbf1c5,
+0x7ff9c590, 0x458a8075, 0xc04d8a80, 0x8a44c389,
+0x8a44817d, 0x8a448255, 0xe3d38375, 0x40c14d8a,
+0x44847d8a, 0x8a856d8a, 0x9d888855, 0xffffff5c,
+0x8ae7d341, 0x5d8ac24d, 0x658a4486, 0x4d8a4489,
+0xe2d3418a, 0x40c34d8a, 0x448c758a, 0xc48d5d8a,
+0xd26e7941, 0x8ae6d341, 0x43c4c44d, 0x01d62029,
+0x4d8ae7d3, 0x6ef9c5c5, 0xe5d341f7, 0xc4c64d8a,
+0xf52049c3, 0x8ae3d301, 0x9d88c74d, 0xffffff58,
+0xd3875d8a, 0xc84d8ae3, 0xff549d88, 0x5d8affff,
+0x8ae2d38b, 0x9588c94d, 0xffffff50, 0x8ae4d341,
+0xd341ca4d, 0xcb4d8ae1, 0x6e7941c4, 0x8ae3d3c1,
+0x63c4cc4d, 0x01c32039, 0x4d8ae6d3, 0x6ef9c5cd,
+0xe3d341ee, 0x44ce4d8a, 0xc58e458a, 0x5c9d6ef9,
+0x8affffff, 0x79c58f55, 0xff588d6e, 0xf9c5ffff,
+0xff508d6e, 0x63c4ffff, 0x548d2031, 0x01ffffff,
+0x8ae0d341, 0xc3c4cf4d, 0x01df2061, 0x2071c3c4,
+0xc1c401cc, 0xc4f86e79, 0xeb2051c3, 0x61c1c401,
+0xe2d3da61, 0x6149c1c4, 0x71c1c4f1, 0xe3c4c861,
+0x01fa2041, 0xde62e1c5, 0xef61d1c5, 0xcd62f1c5,
+0xd96ce1c5, 0x4dfcd9c5, 0x7ff9c5c0, 0x4d8ac04d,
+0x558a44c0, 0x7d8a4482, 0x758a4083, 0x8ae0d384,
+0x8a44c14d, 0x8a448575, 0x8a44864d, 0x8588876d,
+0xffffff5c, 0x4481458a, 0x4489658a, 0x8a8a458a,
+0xe0d38b5d, 0x8ac24d8a, 0x8a448c55, 0x8a408d5d,
+0x85888e7d, 0xffffff58, 0x8ae2d341, 0x458ac34d,
+0x7941c488, 0xd341d26e, 0xc44d8ae7, 0x202943c4,
+0xe6d301d7, 0xc5c54d8a, 0x41ce6e79, 0x4d8ae6d3,
+0x3143c4c6, 0x4101de20, 0x4d8ae1d3, 0x7941c4c7,
+0xd341c96e, 0xc84d8ae5, 0x203143c4, 0xe0d301cd,
+0xc4c94d8a, 0xc9612141, 0xff548588, 0xd341ffff,
+0xca4d8ae4, 0x8ae0d341, 0x41c4cb4d, 0xd3c06e79,
+0xcc4d8ae3, 0x203963c4, 0xe2d301c3, 0xc5cd4d8a,
+0x41ea6ef9, 0x4d8ae3d3, 0x51c3c4ce, 0xd301eb20,
+0xcf4d8ae7, 0xc58f458a, 0x5c8d6ef9, 0xc5ffffff,
+0x54b56ef9, 0xc5ffffff, 0xc4ff6ef9, 0x8d2071e3,
+0xffffff58, 0xc4e0d301, 0xf42049c3, 0x41e3c401,
+0xc401f820, 0xca6171c1, 0x6149c1c4, 0x0621b8f0,
+0xd1c50000, 0xc1c4ef61, 0xc5c96271, 0xc5ed62c9,
+0xc5cd6cf1, 0xc5c9fcf1, 0xc4cb74f1, 0xca1779e2,
+0x019a830f, 0xf9c50000, 0xc5905d6f, 0xa04ddae1,
+0x6ddee1c5, 0xfce1c5a0, 0xf1c5a05d, 0x34b8cdfc,
+0xc5000006, 0xc4cb74f1, 0xca1779e2, 0x016e830f,
+0xf9c50000, 0x01760d6f, 0xf9c50000, 0xb8b06d6f,
+0x00000649, 0x0871e2c4, 0x74f1c5cd, 0x79e2c4cd,
+0x830fca17, 0x00000148, 0x5d6ff9c5, 0x6ff9c5a0,
+0x4eb8907d, 0xc5000006, 0xc4ccfce1, 0xc90041e2,
+0xcb74f1c5, 0x1779e2c4, 0x21830fca, 0xc5000001,
+0x907560e1, 0x4d68e1c5, 0xfcd9c590, 0x06a8b8c9,
+0xf1c50000, 0xf1c5cef8, 0xd1c5cdef, 0xf1c5ecef,
+0xf1c5cdf8, 0x01160d74, 0xe2c40000, 0x0fca1779,
+0x0000eb83, 0x79e2c400, 0xc4906d30, 0xe53079e2,
+0x657ff9c5, 0x6ff9c580, 0xe2c49075, 0xc5ce3079,
+0xb8cd74f1, 0x000006d3, 0x1779e2c4, 0xbd830fca,
+0xc5000000, 0x907d6ff9, 0x3179e2c4, 0x74f1c5cf,
+0x06dab8cc, 0xe2c40000, 0x0fca1779, 0x00009f83,
+0x6ff9c500, 0xe2c49075, 0xc5ce3279, 0x608d7ff9,
+0xc4ffffff, 0xe43079e2, 0x0006e1b8, 0x74f1c500,
+0x79e2c4cc, 0x7873ca17, 0x4d6ff9c5, 0x0001b890,
+0xf9c50000, 0xff708d7f, 0x548affff, 0x9488a005,
+0xffff7005, 0xc08348ff, 0xf8834802, 0xc5eb7511,
+0xb8e4efd9, 0x0000072a, 0x6564d9c5, 0x61e3c4b0,
+0xc540d94c, 0x709d74e1, 0xc4ffffff, 0xda1779e2,
+0xe3c42e73, 0x01d90f71, 0x0ddbf1c5, 0x00000050,
+0xf1c5c031, 0x00260dfc, 0xf1c50000, 0xe2c4cb74,
+0x0fca1779, 0xf883c092, 0x25c01901, 0x0000074a,
+0x415b595a, 0x415d415c, 0x5d5f415e, 0x000000c3,
+0x01010101, 0x01010101, 0x01010101, 0x01010101,
+0x08080808, 0x08080808, 0x08080808, 0x08080808,
+0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f,
+0002560,
+};
+asm(".type avx2_x86_64_D_16u1, STT_NOTYPE;");
+asm(".type avx2_x86_64_D_16u1, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_16i2[] = {
+0xb85500eb, 0x00000001, 0x000010b9, 0x09b94100,
+0x48000000, 0x5741e589, 0x55415641, 0x48535441,
+0x8d10ec83, 0x8944ff70, 0x448966cf, 0xf2898e45,
+0xe283c729, 0x7c896601, 0xfa839e45, 0x83d21901,
+0xcaff02e2, 0x0f40c685, 0x8966c694, 0x40ae4554,
+0x29f6b60f, 0x4c8966f1, 0xff48be45, 0xf88348c0,
+0xc5c07509, 0x90756ff9, 0xb57ff9c5, 0xffffff60,
+0x956ff9c5, 0xffffff60, 0xc976f1c5, 0x000539b8,
+0x75e9c500, 0x79e2c4de, 0x830fd917, 0x00000569,
+0x5dfde9c5, 0x7ff9c590, 0xffff709d, 0x6ff9c5ff,
+0x3fb89075, 0xc5000005, 0x01f671e1, 0x9d75e1c5,
+0xffffff70, 0x1779e2c4, 0x3a830fd9, 0xc5000005,
+0x70bd6ff9, 0xc5ffffff, 0x905df9c1, 0x5d7ff9c5,
+0x75e9c580, 0x44b8805d, 0xc4000005, 0xd91779e2,
+0x0513830f, 0xf9c50000, 0xc5a05d6f, 0x9055d5e9,
+0xe3d5e1c5, 0x5d6ff9c5, 0xfde1c590, 0xe1c5a075,
+0xc5a06df9, 0xb8d4f9e9, 0x0000055b, 0xeed5d1c5,
+0xd575e9c5, 0x1779e2c4, 0xda830fd1, 0xc5000004,
+0xa055d5e1, 0x1575e9c5, 0x000004e4, 0x0005c8b8,
+0x79e2c400, 0x830fd117, 0x000004bd, 0x65e5e1c5,
+0x6ff9c5b0, 0xe9c5b06d, 0xcfb8d2ef, 0xc5000005,
+0xc5d565e9, 0xc4d475e9, 0xd11779e2, 0x0497830f,
+0xd1c50000, 0xf9c5d3d5, 0xc580557f, 0x80756ff9,
+0xf671d9c5, 0x7ff9c503, 0xffff60a5, 0x6ff9c5ff,
+0xe9c5807d, 0xc502f771, 0x70957ff9, 0xc5ffffff,
+0xb8d2fde9, 0x000005ed, 0xd475e9c5, 0x1779e2c4,
+0x52830fd1, 0xc5000004, 0x60b56ff9, 0xc5ffffff,
+0x02e671e9, 0xd2fde9c5, 0x0005f2b8, 0x75e9c500,
+0xffff7095, 0x79e2c4ff, 0x830fd117, 0x00000429,
+0xff5c85c7, 0x0003ffff, 0xe1c50000, 0x6348e5d5,
+0xffff5c85, 0xf9e1c4ff, 0xd9c5d06e, 0x85c7d2f1,
+0xffffff5c, 0x00000002, 0x5c856348, 0xc4ffffff,
+0xf86ef9e1, 0xe7f1d9c5, 0xa57ff9c5, 0xffffff70,
+0xe4fdd9c5, 0x000605b8, 0x75d9c500, 0x79e2c4e2,
+0x830fe117, 0x000003d1, 0x5c856348, 0xc4ffffff,
+0xf06ef9e1, 0xd6e1e9c5, 0xd2fde9c5, 0x000609b8,
+0x75e9c500, 0xffff7095, 0x79e2c4ff, 0x830fd117,
+0x000003a5, 0x7d6ff9c5, 0xd5e1c5c0, 0xefc9c5e5,
+0x65c1c5f6, 0xdbe9c5d6, 0x7ff9c5fc, 0x8b44807d,
+0x4d8b8055, 0xd78945c0, 0x82758b66, 0x844d8b44,
+0x867d8b66, 0x66e7d341, 0x44c24d8b, 0x4588458b,
+0xfb89ce89, 0x8a558b66, 0x8c658b44, 0x4d8be6d3,
+0xc58945c4, 0x8e458b66, 0xc4d38941, 0xd76e79c1,
+0x66e6d341, 0xc5c64d8b, 0x01c6c469, 0x6e79c1c4,
+0x8be3d3d6, 0xe9c5c84d, 0x4101fbc4, 0x8b66e5d3,
+0x39c5ca4d, 0xc1c4c762, 0x41e56e79, 0x4d8be3d3,
+0x59c1c4cc, 0x4101d3c4, 0x8b66e4d3, 0x41c4ce4d,
+0xd3cc6e79, 0xc4b1c5e0, 0xe9c501e0, 0x39c5d462,
+0xf9c5c26c, 0x03163d6f, 0xf9c50000, 0xc5c0656f,
+0xc5d7f9d9, 0xc0557ff9, 0x66c04d8b, 0x8b82458b,
+0x8b668c75, 0xd3418e5d, 0x4d8b66e2, 0x79c1c4c2,
+0xe0d3e26e, 0xc5c44d8b, 0x01d0c4d9, 0x000621b8,
+0xe1d34100, 0xc64d8b66, 0x6e79c1c4, 0x8be7d3e1,
+0x59c5c84d, 0x4101d7c4, 0x8b66e0d3, 0xc1c4ca4d,
+0xc4d26269, 0xc86e7941, 0x4d8be2d3, 0xc4b1c5cc,
+0xe6d301e2, 0xce4d8b66, 0xde6e79c5, 0x21c5e3d3,
+0xc401cbc4, 0xe16259c1, 0xd46ce9c5, 0xd2fde9c5,
+0x7569c1c4, 0x79e2c4d0, 0x830fd117, 0x00000259,
+0x55d5d1c5, 0xd5d1c5a0, 0x7ff9c5e3, 0xffff7095,
+0xeed9c5ff, 0xffff7095, 0xead9c5ff, 0xffff70a5,
+0x7ff9c5ff, 0xffff70a5, 0xfde9c5ff, 0xffff7095,
+0xfde1c5ff, 0x3db8a065, 0xc5000006, 0xc5d5d5e9,
+0xc4d475e9, 0xd11779e2, 0x020b830f, 0xd1c50000,
+0xf9c5ebd5, 0xff60ad7f, 0xe2c4ffff, 0x60951d79,
+0xc5ffffff, 0xb8da75e1, 0x00000644, 0x1779e2c4,
+0xe2830fd9, 0xc5000001, 0xb0556ff9, 0x000649b8,
+0x41e2c400, 0xe9c5fa09, 0xe2c4ff75, 0x0ff91779,
+0x0001c483, 0x70fbc500, 0xc51b905d, 0xa0656ff9,
+0x00064eb8, 0x70fac500, 0xf9c51bdb, 0xc54edb70,
+0xc4db75d9, 0xd91779e2, 0x019b830f, 0xd9c50000,
+0xc5905d61, 0x906569d9, 0xdcf9e1c5, 0x0006a8b8,
+0xd5e1c500, 0x75e1c5da, 0x0001b31d, 0x79e2c400,
+0x830fd917, 0x00000171, 0xea65c9c5, 0x5dd5e9c5,
+0x7ff9c590, 0xffff609d, 0x61e1c5ff, 0x6ff9c5e5,
+0xffff60bd, 0x79e2c4ff, 0xd9c5df23, 0xb3b8e375,
+0xc4000006, 0xe11779e2, 0x013b830f, 0xd1c50000,
+0xe1c5ed61, 0xf9c5dd61, 0xff60ad6f, 0xe2c4ffff,
+0xc5e52479, 0xb8db75d9, 0x000006bb, 0x1779e2c4,
+0x12830fd9, 0xc5000001, 0x905d6ff9, 0xa2458b66,
+0xd665e9c5, 0x756ff9c5, 0x7ff9c5a0, 0xffff709d,
+0x858966ff, 0xffffff72, 0xa6458b66, 0x4c49e3c4,
+0x896620d3, 0xffff7685, 0x458b66ff, 0x858966aa,
+0xffffff7a, 0xae458b66, 0x7e858966, 0xc5ffffff,
+0x709d6ff9, 0xb8ffffff, 0x0000072a, 0xd275e1c5,
+0x1779e2c4, 0xae830fd1, 0xc5000000, 0x90556ff9,
+0x00073ab8, 0x69e3c400, 0xaaa0650e, 0xdc75e1c5,
+0x1779e2c4, 0x8e830fd9, 0xc5000000, 0xcd25dbe9,
+0xc4000000, 0xda0f69e3, 0x074ab802, 0xd9c50000,
+0x009a25fd, 0xe1c50000, 0xe2c4dc75, 0x73d91779,
+0x7ff9c568, 0xffff6095, 0x0003b8ff, 0xe1c50000,
+0xe2c4dbef, 0x60950161, 0xc5ffffff, 0x60957ff9,
+0xffffffff, 0xc5eb75c8, 0x07d2c5f9, 0x00075eb8,
+0xfa836600, 0xc5327524, 0x90756ff9, 0x0549e2c4,
+0xc031a055, 0x0169e2c4, 0x69e2c4d3, 0xe2c4d301,
+0xc5d30169, 0xc4d375e9, 0xd11779e2, 0x83c0920f,
+0xc01901f8, 0x00076725, 0x5b595a00, 0x5d415c41,
+0x5f415e41, 0x0000c35d, 0x00000000, 0x00000000,
+0x000e0008, 0x00140012, 0x00120014, 0x0008000e,
+0x00010001, 0x00010001, 0x00010001, 0x00010001,
+0x00040004, 0x00040004, 0x00040004, 0x00040004,
+0x00070007, 0x00070007, 0x00070007, 0x00070007,
+0003120,
+};
+asm(".type avx2_x86_64_D_16i2, STT_NOTYPE;");
+asm(".type avx2_x86_64_D_16i2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_16u2[] = {
+0xb85500eb, 0x00000001, 0x000010ba, 0x09b94100,
+0x48000000, 0x5741e589, 0x55415641, 0x48535441,
+0x8d10ec83, 0x8944ff70, 0x448966cf, 0xf1898e45,
+0xe183c729, 0x7c896601, 0xc9ff9e45, 0x0f40c685,
+0x8966c694, 0x40ae454c, 0x29f6b60f, 0x548966f2,
+0xff48be45, 0xf88348c0, 0xc5c87509, 0x907d6ff9,
+0xbd7ff9c5, 0xffffff60, 0x9d6ff9c5, 0xffffff60,
+0xc976f1c5, 0x000539b8, 0x75e1c500, 0x79e2c4d7,
+0x830fd117, 0x00000500, 0x55fde1c5, 0x7ff9c590,
+0xffff7095, 0x6ff9c5ff, 0x3fb8907d, 0xc5000005,
+0x01f771e9, 0x9575e9c5, 0xffffff70, 0x1779e2c4,
+0xd1830fd1, 0xc5000004, 0x70bd6ff9, 0xc5ffffff,
+0x9055f9c1, 0x557ff9c5, 0x75e1c580, 0x44b88065,
+0xc4000005, 0xe11779e2, 0x04aa830f, 0xe1c50000,
+0xc5a05deb, 0x609d7ff9, 0xc5ffffff, 0xa055dbe9,
+0x756ff9c5, 0xefc9c580, 0xe9c5a05d, 0xff6095df,
+0xd9c5ffff, 0x50b8e476, 0xc5000005, 0xc4d375e9,
+0xd11779e2, 0x046e830f, 0xf9c50000, 0xc5905d6f,
+0xa055d5e1, 0x1575e9c5, 0x00000474, 0x0005c8b8,
+0x79e2c400, 0x830fd117, 0x0000044c, 0x75e4e1c5,
+0x6ff9c5b0, 0xd1b8b06d, 0xc5000005, 0xc5d5dbe1,
+0xc5d5fde9, 0xc4d675e9, 0xd11779e2, 0x0426830f,
+0xf9c50000, 0xc5805d7f, 0x807d6ff9, 0xf771d1c5,
+0x7ff9c503, 0xffff60ad, 0x6ff9c5ff, 0xe9c58075,
+0xc502f671, 0x70957ff9, 0xc5ffffff, 0xb8d2fde9,
+0x000005ed, 0xd575e9c5, 0x1779e2c4, 0xe5830fd1,
+0xc5000003, 0x60bd6ff9, 0xc5ffffff, 0x02d771e9,
+0xd2fde9c5, 0x0005f2b8, 0x75e9c500, 0xffff7095,
+0x79e2c4ff, 0x830fd117, 0x000003bc, 0xff5c85c7,
+0x0003ffff, 0xf9c50000, 0xff5c956e, 0xe1c5ffff,
+0x85c7d2f1, 0xffffff5c, 0x00000002, 0xad6ef9c5,
+0xffffff5c, 0xedf1e1c5, 0xad7ff9c5, 0xffffff70,
+0xedfdd1c5, 0x000605b8, 0x75d1c500, 0x79e2c4ea,
+0x830fe917, 0x00000370, 0xad6ef9c5, 0xffffff5c,
+0xd5d1e9c5, 0xd2fde9c5, 0x000609b8, 0x75e9c500,
+0xffff7095, 0x79e2c4ff, 0x830fd117, 0x00000348,
+0xedefd1c5, 0x5575d1c5, 0x75e9c5c0, 0xdbe9c5d5,
+0x7ff9c5f3, 0x8b448075, 0x4d8b8055, 0xd78945c0,
+0x82758b66, 0x844d8b44, 0x867d8b66, 0x66e7d341,
+0x44c24d8b, 0x4588458b, 0xfb89ce89, 0x8a558b66,
+0x8c658b44, 0x4d8be6d3, 0xc58945c4, 0x8e458b66,
+0xc4d38941, 0xd76e79c1, 0x66e6d341, 0xc5c64d8b,
+0x01f6c4e9, 0x6e79c1c4, 0x8be3d3d6, 0xe9c5c84d,
+0x4101fbc4, 0x8b66e5d3, 0xc9c5ca4d, 0xc1c4f762,
+0x41ed6e79, 0x4d8be3d3, 0x51c1c4cc, 0x4101d3c4,
+0x8b66e4d3, 0x41c4ce4d, 0xd3c46e79, 0xc4b9c5e0,
+0xe9c501e8, 0xc9c5d562, 0xd9c5f26c, 0xc5c055fd,
+0xc0557ff9, 0x66c04d8b, 0x8b82458b, 0x8b668c75,
+0xd3418e5d, 0x4d8b66e2, 0x79c1c4c2, 0xe0d3ea6e,
+0xc5c44d8b, 0x01d0c4d1, 0x000621b8, 0xe1d34100,
+0xc64d8b66, 0x6e79c1c4, 0x8be7d3e9, 0x51c5c84d,
+0x4101c7c4, 0x8b66e0d3, 0xc1c4ca4d, 0xc4d06269,
+0xf86e79c1, 0x4d8be2d3, 0xc4c1c5cc, 0xe6d301ea,
+0xce4d8b66, 0xce6e79c5, 0xb1c5e3d3, 0xc501fbc4,
+0xc5ef62d1, 0xc5d56ce9, 0xc5d2fde9, 0xc4d675e9,
+0xd11779e2, 0x020e830f, 0xe2c40000, 0xa0553a61,
+0x3e61e2c4, 0xe1c5a06d, 0xc5a05dfd, 0xb8d5fde9,
+0x00000634, 0xd375e9c5, 0x1779e2c4, 0xe5830fd1,
+0xc5000001, 0x05356ff9, 0xc5000002, 0xb06d6ff9,
+0x000649b8, 0x49e2c400, 0xe9c5d509, 0xe2c4d575,
+0x0fd11779, 0x0001bf83, 0x70fbc500, 0xc51b905d,
+0xa0556ff9, 0x00064eb8, 0x70fac500, 0xf9c51bdb,
+0xc54edb70, 0xc4db75e9, 0xd91779e2, 0x0196830f,
+0xe9c50000, 0xc5905d61, 0x905569e9, 0xd2fdd9c5,
+0x0006a8b8, 0xf9e9c500, 0xefe9c5d3, 0xefd1c5d5,
+0xf9e9c5ec, 0x75e9c5d5, 0x0001a315, 0x79e2c400,
+0x830fd117, 0x00000160, 0x3379e2c4, 0xe2c4905d,
+0xc5d33379, 0x80557ff9, 0x656ff9c5, 0x79e2c490,
+0xe9c5d433, 0xd3b8d375, 0xc4000006, 0xd11779e2,
+0x0132830f, 0xf9c50000, 0xc490656f, 0xd43479e2,
+0x5575e9c5, 0x06dab880, 0xe2c40000, 0x0fd11779,
+0x00011383, 0x6ff9c500, 0x8b66905d, 0xe9c5a245,
+0xe9c5d2ef, 0xc5b05564, 0xa0656ff9, 0x9d7ff9c5,
+0xffffff70, 0x72858966, 0x66ffffff, 0xc4a6458b,
+0xd34c59e3, 0x85896620, 0xffffff76, 0xaa458b66,
+0x7a858966, 0x66ffffff, 0x66ae458b, 0xff7e8589,
+0xf9c5ffff, 0xff709d6f, 0x2ab8ffff, 0xc5000007,
+0xc4d275e1, 0xd11779e2, 0x00aa830f, 0xf9c50000,
+0xb890556f, 0x0000073a, 0x0e69e3c4, 0xc5aaa065,
+0xc4dc75e1, 0xd91779e2, 0x008a830f, 0xe9c50000,
+0x00ca25db, 0xe3c40000, 0x02da0f69, 0x00074ab8,
+0xfdd9c500, 0x75e1c5e6, 0x79e2c4dc, 0x6873d917,
+0x957ff9c5, 0xffffff60, 0x000003b8, 0xefe1c500,
+0x61e2c4db, 0xff609501, 0xf9c5ffff, 0xff60957f,
+0xc8ffffff, 0xf9c5eb75, 0xb807d2c5, 0x0000075e,
+0x24fa8366, 0xf9c53275, 0xc4907d6f, 0x550541e2,
+0xc4c031a0, 0xd30169e2, 0x0169e2c4, 0x69e2c4d3,
+0xe9c5d301, 0xe2c4d375, 0x0fd11779, 0xf883c092,
+0x25c01901, 0x00000767, 0x415b595a, 0x415d415c,
+0x5d5f415e, 0x000000c3, 0x00000000, 0x00000000,
+0x000e0008, 0x00140012, 0x00120014, 0x0008000e,
+0x00010001, 0x00010001, 0x00010001, 0x00010001,
+0x00040004, 0x00040004, 0x00040004, 0x00040004,
+0x00070007, 0x00070007, 0x00070007, 0x00070007,
+0002740,
+};
+asm(".type avx2_x86_64_D_16u2, STT_NOTYPE;");
+asm(".type avx2_x86_64_D_16u2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_16i4[] = {
+0xb85500eb, 0x00000001, 0x000020b9, 0x05b94100,
+0x48000000, 0x8348e589, 0x788d08ec, 0xc88945ff,
+0xbc854489, 0x2941fa89, 0x01e283c0, 0x85448944,
+0x01fa83cc, 0xe283d219, 0x85caff02, 0x940f40f8,
+0x855489c7, 0xb60f40dc, 0x89f929ff, 0x48ec854c,
+0x8348c0ff, 0xc27505f8, 0x7d6ff9c5, 0x7ff9c5c0,
+0xf9c5907d, 0xc590556f, 0xb8c976f1, 0x00000539,
+0xdf76e9c5, 0x1779e2c4, 0x0b830fd9, 0xc5000004,
+0xc05dfee9, 0x5d7ff9c5, 0x6ff9c5a0, 0x3fb8c07d,
+0xc5000005, 0x01f772e1, 0x5d76e1c5, 0x79e2c4a0,
+0x830fd917, 0x000003e2, 0x7d6ff9c5, 0xfac1c5a0,
+0xf9c5c05d, 0xc5b05d7f, 0xb05d76e9, 0x000544b8,
+0x79e2c400, 0x830fd917, 0x000003be, 0x5d6ff9c5,
+0x69e2c4d0, 0xc4c05540, 0xe34061e2, 0x5d6ff9c5,
+0xfee1c5c0, 0xe1c5d075, 0xc5d06dfa, 0xb8d4fae9,
+0x0000055b, 0x4051e2c4, 0x76e9c5ee, 0x79e2c4d5,
+0x830fd117, 0x00000382, 0x4061e2c4, 0xe9c5d055,
+0x037a1576, 0xc8b80000, 0xc4000005, 0xd11779e2,
+0x0364830f, 0xe1c50000, 0xc5e055ef, 0xc5d07ef9,
+0x90557ff9, 0x2869e2c4, 0x6348d055, 0x9848d055,
+0xc2af0f48, 0xd8556348, 0xb0458948, 0x98456348,
+0xc2af0f48, 0xb8458948, 0x0005e1b8, 0x76e9c500,
+0xe2c4b055, 0x0fd11779, 0x00031d83, 0x61e2c400,
+0xc5e06540, 0xb0657ff9, 0x756ff9c5, 0x72d1c5b0,
+0xf9c503f6, 0xc5906d7f, 0xb07d6ff9, 0xf772e9c5,
+0x7ff9c502, 0xe9c5a055, 0xedb8d2fe, 0xc5000005,
+0xc4d576e9, 0xd11779e2, 0x02dc830f, 0xf9c50000,
+0xc590756f, 0x02e672e9, 0xd2fee9c5, 0x0005f2b8,
+0x76e9c500, 0xe2c4a055, 0x0fd11779, 0x0002b983,
+0x8c45c700, 0x00000003, 0x8c456348, 0x6ef9e1c4,
+0xf2d9c5d0, 0x8c45c7d2, 0x00000002, 0x8c456348,
+0x6ef9e1c4, 0xf2d9c5f8, 0x7ff9c5e7, 0xd9c5a065,
+0x05b8e4fe, 0xc5000006, 0xc4e276d9, 0xe11779e2,
+0x0274830f, 0x63480000, 0xe1c48c45, 0xc5f06ef9,
+0xc5d6e2e9, 0xb8d2fee9, 0x00000609, 0x5576e9c5,
+0x79e2c4a0, 0x830fd117, 0x0000024e, 0x7d6ff9c5,
+0xefd9c5f0, 0x61e2c4e4, 0xc5e06d40, 0xc5d466c1,
+0xc5d5dbe9, 0xb0557ff9, 0x4769e2c4, 0xf9c5f07d,
+0x023a2d6f, 0xf9c50000, 0xc5f0756f, 0xc5f5fac9,
+0xf0757ff9, 0x4769e2c4, 0x21b8f055, 0xc5000006,
+0xc5f2fee9, 0xc4f776c9, 0xf11779e2, 0x01f8830f,
+0xe2c40000, 0xf0554669, 0x000626b8, 0x76e9c500,
+0xe2c4b055, 0x0fd11779, 0x0001dd83, 0x6ff9c500,
+0xe2c4e075, 0xd0554049, 0x557ff9c5, 0x49e2c4a0,
+0xe2c4fb40, 0xa0553d41, 0x3941e2c4, 0xf9c5a07d,
+0xc5a07d7f, 0xa055fee9, 0x7dfee1c5, 0x063db8d0,
+0xe2c40000, 0xc5d64069, 0xc4d776e9, 0xd11779e2,
+0x0194830f, 0xe2c40000, 0xc5f34049, 0x90757ff9,
+0x1e79e2c4, 0xe1c59055, 0x44b8da76, 0xc4000006,
+0xd91779e2, 0x0170830f, 0xf9c50000, 0xb8e0556f,
+0x00000649, 0x0a51e2c4, 0x76e9c5ea, 0x79e2c4ed,
+0x830fe917, 0x00000152, 0x6d6ff9c5, 0x70f9c5d0,
+0xb81bc05d, 0x0000064e, 0xdb76d1c5, 0x1779e2c4,
+0x33830fd9, 0xc5000001, 0xc05d62d1, 0x6d6ad1c5,
+0xfae1c5c0, 0x06a8b8dd, 0xe2c40000, 0xc5da4061,
+0x391d76e1, 0xc4000001, 0xd91779e2, 0x0108830f,
+0xd9c50000, 0xe2c4ea66, 0xc05d4069, 0x5d7ff9c5,
+0x62e1c590, 0x6ff9c5ed, 0xe2c4907d, 0xc5df2579,
+0xb8dd76e1, 0x000006b3, 0x1779e2c4, 0xd7830fd9,
+0xc5000000, 0xc05d6ff9, 0xc5d4458b, 0xc5d466e9,
+0xd0656ff9, 0x5d7ff9c5, 0xa44589a0, 0xc4dc458b,
+0xd34c59e3, 0xac458920, 0x5d6ff9c5, 0x072ab8a0,
+0xe1c50000, 0xe2c4d276, 0x0fd11779, 0x00009983,
+0x6ff9c500, 0x3ab8c055, 0xc4000007, 0x650e69e3,
+0xe1c5ccd0, 0xe2c4dc76, 0x73d91779, 0xdbe9c57d,
+0x0000ab25, 0x69e3c400, 0xb804da0f, 0x0000074a,
+0x25fed9c5, 0x00000078, 0xdc76e1c5, 0x1779e2c4,
+0xc55773d9, 0x90557ff9, 0xdbefe1c5, 0x0261e2c4,
+0xf9c59055, 0xc490557f, 0x550261e2, 0x075eb890,
+0xe3c40000, 0x03d21679, 0x750afa83, 0x6ff9c52d,
+0xe2c4c075, 0xd0550649, 0xe2c4c031, 0xc4d30269,
+0xd30269e2, 0xd376e9c5, 0x1779e2c4, 0xc0920fd1,
+0x1901f883, 0x076725c0, 0xc3c90000, 0x00000000,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x00000002, 0x00000002, 0x00000002, 0x00000002,
+0x00000003, 0x00000003, 0x00000003, 0x00000003,
+0002320,
+};
+asm(".type avx2_x86_64_D_16i4, STT_NOTYPE;");
+asm(".type avx2_x86_64_D_16i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_16u4[] = {
+0x315500eb, 0x0020bac0, 0xb9410000, 0x00000004,
+0x48e58948, 0x8908ec83, 0x01708dc1, 0x45cf8944,
+0xe183c031, 0x89c72901, 0xffc08574, 0x89c685c9,
+0x41d0857c, 0x89c0940f, 0x44e0854c, 0x5489c229,
+0xff48f085, 0xf88348c0, 0xc5cc7504, 0xc07d6ff9,
+0x7d7ff9c5, 0x6ff9c590, 0xf1c5905d, 0x39b8c976,
+0xc5000005, 0xc4d776e1, 0xd11779e2, 0x039d830f,
+0xe1c50000, 0xc5c055fe, 0xa0557ff9, 0x7d6ff9c5,
+0x053fb8c0, 0xe9c50000, 0xc501f772, 0xa05576e9,
+0x1779e2c4, 0x74830fd1, 0xc5000003, 0xa07d6ff9,
+0x55fac1c5, 0x7ff9c5c0, 0xe1c5b055, 0xb8b06576,
+0x00000544, 0x1779e2c4, 0x50830fe1, 0xc5000003,
+0xd05debe1, 0x5d7ff9c5, 0xdbe9c590, 0xf9c5d055,
+0xc5b07d6f, 0xd05defc1, 0x55dfe9c5, 0x76d9c590,
+0x0550b8e4, 0xe9c50000, 0xe2c4d376, 0x0fd11779,
+0x00031a83, 0x6ff9c500, 0xe2c4c05d, 0xd0554061,
+0x1576e9c5, 0x00000318, 0x0005c8b8, 0x79e2c400,
+0x830fd117, 0x000002f7, 0x55efe1c5, 0x7ef9c5e0,
+0x7ff9c5d0, 0xe9c59055, 0x8bd055f4, 0x0f48d055,
+0x558bc2af, 0x458948d8, 0x98458bb0, 0xc2af0f48,
+0xb8458948, 0x0005e1b8, 0x76e9c500, 0xe2c4b055,
+0x0fd11779, 0x0002b683, 0x7ff9c500, 0xf9c5b05d,
+0xc5b0756f, 0x03f672d1, 0x6d7ff9c5, 0x6ff9c590,
+0xe9c5b07d, 0xc502f772, 0xa0557ff9, 0xd2fee9c5,
+0x0005edb8, 0x76e9c500, 0x79e2c4d5, 0x830fd117,
+0x0000027b, 0x756ff9c5, 0x72e9c590, 0xe9c502d6,
+0xf2b8d2fe, 0xc5000005, 0xa05576e9, 0x1779e2c4,
+0x58830fd1, 0xc7000002, 0x00038c45, 0xf9c50000,
+0xc58c556e, 0xc7d2f2e1, 0x00028c45, 0xf9c50000,
+0xc58c6d6e, 0xc5edf2e1, 0xa06d7ff9, 0xedfed1c5,
+0x000605b8, 0x76d1c500, 0x79e2c4ea, 0x830fe917,
+0x0000021b, 0x6d6ef9c5, 0xd2e9c58c, 0xfee9c5d5,
+0x0609b8d2, 0xe9c50000, 0xc4a05576, 0xd11779e2,
+0x01f9830f, 0xd1c50000, 0xd1c5edef, 0xc5f05576,
+0xc5d576e9, 0xc4d3dbe9, 0x7d4769e2, 0xfed9c5f0,
+0xf9c5f06d, 0xc4f06d7f, 0x6d4769e2, 0x0621b8f0,
+0xd1c50000, 0xc9c5f5fe, 0xe2c4f776, 0x0ff11779,
+0x0001ba83, 0x51e2c400, 0xb8f06d45, 0x00000626,
+0xd576e9c5, 0x1779e2c4, 0xa0830fd1, 0xc4000001,
+0x553b61e2, 0x61e2c4d0, 0xc5d06d3f, 0xd05dfee1,
+0xd5fee9c5, 0x000634b8, 0x76e9c500, 0x79e2c4d3,
+0x830fd117, 0x00000177, 0x2d6ff9c5, 0x00000190,
+0x5d6ff9c5, 0x0649b8e0, 0xe2c40000, 0xc5d30a51,
+0xc4d376e9, 0xd11779e2, 0x0151830f, 0xf9c50000,
+0xc5d0556f, 0xc07570f9, 0x064eb81b, 0xe9c50000,
+0xe2c4f676, 0x0ff11779, 0x00013283, 0x62e9c500,
+0xe9c5c075, 0xc5c0556a, 0xb8d2fed9, 0x000006a8,
+0xd6fae9c5, 0xd3efe9c5, 0xdcefe1c5, 0xd3fae9c5,
+0x1576e9c5, 0x00000138, 0x1779e2c4, 0xfc830fd1,
+0xc4000000, 0x5d3579e2, 0x6ff9c5c0, 0xe2c4c065,
+0xc5d43579, 0xb8d376e9, 0x000006d3, 0x1779e2c4,
+0xd8830fd1, 0xc5000000, 0xc05d6ff9, 0xc5d4458b,
+0xc5d2efe9, 0xe05564e9, 0x7d6ff9c5, 0x7ff9c5d0,
+0x4589a05d, 0xdc458ba4, 0x4c41e3c4, 0x458920d3,
+0x6ff9c5ac, 0x2ab8a05d, 0xc5000007, 0xc4d276e1,
+0xd11779e2, 0x0095830f, 0xf9c50000, 0xb8c0556f,
+0x0000073a, 0x0e69e3c4, 0xc5ccd065, 0xc4dc76e1,
+0xd91779e2, 0xe9c57973, 0x00b225db, 0xe3c40000,
+0x04da0f69, 0x00074ab8, 0xfed9c500, 0x76e1c5e5,
+0x79e2c4dc, 0x5773d917, 0x557ff9c5, 0xefe1c590,
+0x61e2c4db, 0xc5905502, 0x90557ff9, 0x0261e2c4,
+0x5eb89055, 0xc4000007, 0xd21679e3, 0x0afa8303,
+0xf9c52d75, 0xc4c0656f, 0x550659e2, 0xc4c031d0,
+0xd30269e2, 0x0269e2c4, 0x76e9c5d3, 0x79e2c4d3,
+0x920fd117, 0x01f883c0, 0x6725c019, 0xc9000007,
+0x000000c3, 0x00000000, 0x00000000, 0x00000000,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x00000002, 0x00000002, 0x00000002, 0x00000002,
+0x00000003, 0x00000003, 0x00000003, 0x00000003,
+0002140,
+};
+asm(".type avx2_x86_64_D_16u4, STT_NOTYPE;");
+asm(".type avx2_x86_64_D_16u4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_16i8[] = {
+0x485500eb, 0xc748e589, 0x0001d045, 0xc7480000,
+0x0002e045, 0xc7480000, 0x003ff045, 0xc7480000,
+0x0002d845, 0xc7480000, 0x0001e845, 0xc7480000,
+0x003ef845, 0xf9c50000, 0xc5d07d6f, 0xa07d7ff9,
+0x5d6ff9c5, 0x76f1c5a0, 0x0539b8c9, 0xe2c40000,
+0xc4d72961, 0xd11779e2, 0x03e0830f, 0xe1c50000,
+0xc5d055d4, 0xb0557ff9, 0x7d6ff9c5, 0x053fb8d0,
+0xe9c50000, 0xc401f773, 0x552969e2, 0x79e2c4b0,
+0x830fd117, 0x000003b6, 0x7d6ff9c5, 0xfbc1c5b0,
+0xf9c5d055, 0xc4c0557f, 0x552961e2, 0x0544b8c0,
+0xe2c40000, 0x0fd11779, 0x00039183, 0x6ff9c500,
+0xe9c5d075, 0xc520d373, 0x20d673d1, 0xd6f4e9c5,
+0xebf4d1c5, 0xe6f4e1c5, 0x5d6ff9c5, 0xf4e1c5e0,
+0xd4e9c5f3, 0x73e9c5d5, 0xd9c520f2, 0xe9c5e2d4,
+0xc520d373, 0xc5d3f4e9, 0xc5d2d4e9, 0x20f273e9,
+0xf2d4c9c5, 0x556ff9c5, 0xd469c5d0, 0xfb69c5cb,
+0xc1c4e045, 0x20d17341, 0x00055bb8, 0x61c1c400,
+0xc420d073, 0xf8f441c1, 0xf461c1c4, 0x39c1c4d9,
+0xe1c5e9f4, 0xe1c5dfd4, 0xc520f373, 0xc5ebd4d1,
+0xc4defbd9, 0xdd2961e2, 0x1779e2c4, 0xfb830fd9,
+0xc5000002, 0xe05d6ff9, 0xd273c1c5, 0x73d1c520,
+0xe9c520d3, 0xd1c5e3f4, 0xc1c5eaf4, 0xe1c5dbf4,
+0xe1c5ddd4, 0xc520f373, 0xc4dbd4d9, 0x1d2961e2,
+0x000002cc, 0x0005c8b8, 0x79e2c400, 0x830fd917,
+0x000002ba, 0x256ff9c5, 0x000002d4, 0xd473d1c5,
+0xf469c520, 0xf4c1c5c4, 0xf4d1c5dc, 0xd4e1c5d2,
+0x73e1c5da, 0xb9c520f3, 0xf9c5dbd4, 0xc5c05d7f,
+0xc0756ff9, 0xf673c9c5, 0x7ff9c503, 0xf9c5a075,
+0xc5c05d6f, 0x02f373e1, 0x5d7ff9c5, 0xd4e1c5b0,
+0xf4c1c5db, 0x05edb8fc, 0xe2c40000, 0xc4de2961,
+0xd91779e2, 0x0254830f, 0xf9c50000, 0xc5a0756f,
+0x02d673e1, 0xe672c9c5, 0x61e3c402, 0xc5ccde0e,
+0xb8dbd4e1, 0x000005f2, 0x2961e2c4, 0xe2c4b05d,
+0x0fd91779, 0x00022583, 0xd4c1c500, 0x9c45c7f2,
+0x00000003, 0xf673c9c5, 0xd4b9c520, 0x456348f6,
+0xf9e1c49c, 0xc9c5d86e, 0x45c7dbf3, 0x0000029c,
+0x45634800, 0xf961c49c, 0xc1c4d06e, 0xc5f2f349,
+0xb0757ff9, 0xf6d4c9c5, 0x000605b8, 0x49e2c400,
+0xe2c4f329, 0x0ff11779, 0x0001d183, 0x55634800,
+0x3141c49c, 0x40b8c9ef, 0xc4000000, 0xf33731e2,
+0xc4d02948, 0xda6ef961, 0x6ef961c4, 0x61c1c4e0,
+0xc1c4dbd3, 0xc5f4f349, 0xc5deebe1, 0xb8dbd4e1,
+0x00000609, 0x2961e2c4, 0xe2c4b05d, 0x0fd91779,
+0x00018983, 0xd4e9c500, 0x6ff9c5d7, 0xe9c5f07d,
+0xc520f273, 0xc4c2d439, 0xd13741c2, 0xdb69c1c4,
+0x7ff9c5d0, 0xe2c4c055, 0xf07547e9, 0x000001b8,
+0x6ff9c500, 0xe1c4f07d, 0xc5d86ef9, 0xc5db6ce1,
+0xc5dbfbc1, 0xf05d7ff9, 0x47e9e2c4, 0x21b8f055,
+0xc5000006, 0xb0557ff9, 0xd2d4e9c5, 0x2969e2c4,
+0x79e2c4d6, 0x830fd117, 0x00000122, 0x000001b8,
+0x6ff9c500, 0xe2c4b07d, 0xf05545c1, 0x3fe0c148,
+0x6ef9e1c4, 0x0626b8d8, 0xe1c50000, 0xe2c4db6c,
+0xf05d45e1, 0xd3efe9c5, 0xd3fbe9c5, 0x2969e2c4,
+0xe2c4c055, 0x0fd11779, 0x0000e183, 0x6ff9c500,
+0xf9c5e055, 0x4ed05d70, 0x00064eb8, 0x69e2c400,
+0xe2c4db29, 0x0fd91779, 0x0000c183, 0x6ce9c500,
+0xe9c5d075, 0xc5d0556d, 0xb8f2fbc9, 0x000006a8,
+0xd673e9c5, 0xf4d1c520, 0xf4e9c5ee, 0xf4c9c5d4,
+0xd4e9c5dc, 0x6ff9c5d5, 0x0000a32d, 0x73e9c500,
+0xe1c520f2, 0xe2c4d2d4, 0xc4d52969, 0xd11779e2,
+0xf9c57c73, 0x48d0556f, 0xc4e8458b, 0xe13759c2,
+0x7d6ff9c5, 0x7ff9c5e0, 0x8948b055, 0xf9c5b845,
+0xc4b05d6f, 0xd24c41e3, 0x072ab840, 0xe2c40000,
+0xc4d22961, 0xd11779e2, 0xf9c54473, 0xb8d0556f,
+0x0000073a, 0x0e69e3c4, 0xc4f0e065, 0xdc2961e2,
+0x1779e2c4, 0xc42773d9, 0xda0f69e3, 0xdbe9c508,
+0xc5c031d5, 0xc4d5d4e9, 0xd32969e2, 0x1779e2c4,
+0xc0920fd1, 0x1901f883, 0x074a25c0, 0xc35d0000,
+0x00000002, 0x00000000, 0x00000002, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0x00000001, 0x00000000, 0xffffffff, 0xffffffff,
+0002160,
+};
+asm(".type avx2_x86_64_D_16i8, STT_NOTYPE;");
+asm(".type avx2_x86_64_D_16i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_16u8[] = {
+0x485500eb, 0xc748e589, 0x0001d045, 0xc7480000,
+0x0002e045, 0xc7480000, 0x003ff045, 0xc7480000,
+0x0002d845, 0xc7480000, 0x0001e845, 0xc7480000,
+0x003ef845, 0xf9c50000, 0xc5d07d6f, 0xa07d7ff9,
+0x5d6ff9c5, 0x76f1c5a0, 0x0539b8c9, 0xe2c40000,
+0xc4d72961, 0xd11779e2, 0x02d1830f, 0xe1c50000,
+0xc5d055d4, 0xb0557ff9, 0x7d6ff9c5, 0x053fb8d0,
+0xe9c50000, 0xc401f773, 0x552969e2, 0x79e2c4b0,
+0x830fd117, 0x000002a7, 0x756ff9c5, 0xfbc9c5b0,
+0xf9c5d055, 0xc4c0557f, 0x652961e2, 0x0544b8c0,
+0xe2c40000, 0x0fe11779, 0x00028283, 0xebe1c500,
+0xf9c5e05d, 0xc5a05d7f, 0xe055dbe9, 0x7d6ff9c5,
+0xefc1c5c0, 0xe9c5e05d, 0xe9c5d1ef, 0xb8a055db,
+0x00000550, 0x2969e2c4, 0x79e2c4d3, 0x830fd117,
+0x0000024b, 0x556ff9c5, 0x6ff9c5d0, 0xe1c5e075,
+0xc520d273, 0x20d673d1, 0xdef4e1c5, 0xeaf4d1c5,
+0xe6f4e9c5, 0xddd4e1c5, 0xf373e1c5, 0xd4d9c520,
+0x61e2c4db, 0x02261d29, 0xc8b80000, 0xc4000005,
+0xd91779e2, 0x0205830f, 0xf9c50000, 0xc5c0557f,
+0xc06d6ff9, 0xf573d9c5, 0x7ff9c503, 0xf9c5a065,
+0xc5c0756f, 0x02f673e1, 0x5d7ff9c5, 0xd4e1c5b0,
+0x05edb8db, 0xe2c40000, 0xc4dc2961, 0xd91779e2,
+0x01c9830f, 0xf9c50000, 0xc5a07d6f, 0x02d773e1,
+0xdbd4e1c5, 0x0005f2b8, 0x61e2c400, 0xc4b05d29,
+0xd91779e2, 0x01a5830f, 0x45c70000, 0x0000039c,
+0x6ef9c500, 0xe9c59c5d, 0x45c7dbf3, 0x0000029c,
+0x6ef9c500, 0xe9c59c65, 0xf9c5d4f3, 0xc5b0557f,
+0xb8d2d4e9, 0x00000605, 0x2969e2c4, 0x79e2c4d3,
+0x830fd117, 0x00000167, 0x556ef9c5, 0xd3e1c59c,
+0xd4e9c5d2, 0x0609b8d2, 0xe2c40000, 0xb0552969,
+0x1779e2c4, 0x44830fd1, 0xc5000001, 0xc4dbefe1,
+0x552961e2, 0x69e2c4f0, 0xe9c5d329, 0xc5d055db,
+0xc0557ff9, 0x47e9e2c4, 0xf1c5f05d, 0xc5f065d4,
+0xf0657ff9, 0x47e9e2c4, 0x21b8f055, 0xc5000006,
+0xb0557ff9, 0xd2d4e9c5, 0x2969e2c4, 0x79e2c4d3,
+0x830fd117, 0x000000f7, 0x6d6ff9c5, 0xd1e2c4b0,
+0xb8f05545, 0x00000626, 0x2969e2c4, 0xe2c4c055,
+0x0fd11779, 0x0000d683, 0x6ff9c500, 0xf9c5e055,
+0x4ed05d70, 0x00064eb8, 0x69e2c400, 0xe2c4db29,
+0x0fd91779, 0x0000b683, 0x6ff9c500, 0x0000df1d,
+0x6ce9c500, 0xe9c5d065, 0xc5d0556d, 0xb8d2d4f1,
+0x000006a8, 0xd4fbe9c5, 0xe1efe1c5, 0xd3efe9c5,
+0xd4fbe9c5, 0x256ff9c5, 0x000000a4, 0x2969e2c4,
+0x79e2c4d4, 0x7773d117, 0x556ff9c5, 0x458b48d0,
+0x6ff9c5e8, 0xf9c5e075, 0x48b0557f, 0xc4b84589,
+0xd24c49e3, 0x6ff9c530, 0x2ab8b05d, 0xc4000007,
+0xd22961e2, 0x1779e2c4, 0xc54473d1, 0xd0556ff9,
+0x00073ab8, 0x69e3c400, 0xf0e06d0e, 0x2961e2c4,
+0x79e2c4dd, 0x2773d917, 0x0f69e3c4, 0xe9c508da,
+0xc031d4db, 0xd4d4e9c5, 0x2969e2c4, 0x79e2c4d3,
+0x920fd117, 0x01f883c0, 0x4a25c019, 0x5d000007,
+0x000000c3, 0x00000000, 0x00000000, 0x00000000,
+0x00000002, 0x00000000, 0x00000002, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+0001560,
+};
+asm(".type avx2_x86_64_D_16u8, STT_NOTYPE;");
+asm(".type avx2_x86_64_D_16u8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_16f4[] = {
+0xb84800eb, 0x3f800000, 0x40000000, 0xe5894855,
+0xd0458948, 0x0000b848, 0x00004040, 0x89484080,
+0xb848d845, 0x40800000, 0x40400000, 0xe0458948,
+0x000001b8, 0xe0c148fe, 0x4589481e, 0x00b848e8,
+0x003f8000, 0x48bf8000, 0x48f04589, 0xc5f84589,
+0xd07d28f8, 0x7d29f8c5, 0x28f8c5a0, 0xf1c5a055,
+0x39b8c976, 0xc5000005, 0x00dfc2e8, 0x0e79e2c4,
+0x26830fd9, 0xc5000004, 0xd05d58e8, 0x5d29f8c5,
+0x28f8c5b0, 0x3fb8d05d, 0xc5000005, 0xc5db58e0,
+0xb05dc2e0, 0x79e2c400, 0x830fd90e, 0x000003fd,
+0x7d28f8c5, 0x5cc0c5b0, 0xf8c5d05d, 0xc5c05d29,
+0xc05dc2e8, 0x0544b800, 0xe2c40000, 0x0fd90e79,
+0x0003d883, 0x28f8c500, 0xe8c5e05d, 0xc5d05559,
+0xc5e359e0, 0xd05d28f8, 0x7558e0c5, 0x5ce0c5e0,
+0xe8c5e06d, 0x5bb8d45c, 0xc5000005, 0xc5ee59d0,
+0x00d5c2e8, 0x0e79e2c4, 0x9e830fd1, 0xc5000003,
+0xf05559e0, 0x5529f8c5, 0x5ee0c5a0, 0xe8c5f05d,
+0xb800d3c2, 0x00000564, 0x0e79e2c4, 0x7a830fd1,
+0xc4000003, 0x1d1879e2, 0x00000374, 0x6528f8c5,
+0x0567b8f0, 0xd8c50000, 0xe0c5d357, 0xc5d05d57,
+0xa05559e8, 0xd3c2e8c5, 0x79e2c400, 0x830fd10e,
+0x00000349, 0x555bf9c5, 0x5bf8c5d0, 0xc2e8c5d2,
+0xb800d055, 0x0000056e, 0x0e79e2c4, 0x2a830fd1,
+0xc5000003, 0xd05553f8, 0x5529f8c5, 0x53f8c5a0,
+0xf8c5a055, 0xb8d05d28, 0x00000575, 0xd25bf9c5,
+0xd25bf8c5, 0xd3c2e8c5, 0x79e2c400, 0x830fd10e,
+0x000002f9, 0xd359e0c5, 0x5529f8c5, 0x52f8c5a0,
+0xf8c5a055, 0xc5b05529, 0xb05528f8, 0x00057cb8,
+0x53f8c500, 0x5bf9c5ea, 0x5bf8c5ed, 0xc2e0c5ed,
+0xe2c400dd, 0x0fd90e79, 0x0002c083, 0x5bf9c500,
+0x28f8c5da, 0xf8c5d055, 0x7eb8db5b, 0xc5000005,
+0xc5ea53f8, 0xc5ed5bf9, 0xc5ed5bf8, 0x00ddc2e0,
+0x0e79e2c4, 0x92830fd9, 0xc5000002, 0xc5da59e8,
+0xa05d29f8, 0x5d51f8c5, 0x059cb8a0, 0xe0c50000,
+0xc400dac2, 0xd90e79e2, 0x026f830f, 0xe2c40000,
+0x792d1879, 0xc5000002, 0xc5da5ed0, 0xa05d29f8,
+0x0879e3c4, 0xb80ba05d, 0x000005a4, 0x1dc2e0c5,
+0x0000025b, 0x79e2c400, 0x830fd90e, 0x0000023d,
+0x5d59d8c5, 0x59d8c5e0, 0x29f8c5f2, 0xc8c5b05d,
+0xc5b05d5f, 0xb0755dc8, 0x7529f8c5, 0x58e0c5b0,
+0xe8c5b05d, 0xb8e05558, 0x0000063d, 0xdc59e0c5,
+0xd2c2e0c5, 0x79e2c400, 0x830fd10e, 0x000001fd,
+0x0479e3c4, 0xb81bd055, 0x0000064e, 0x55c2e8c5,
+0xe2c400e0, 0x0fd10e79, 0x0001e083, 0x28f8c500,
+0xf8c5e055, 0xb8d07528, 0x00000653, 0xda5bf9c5,
+0x1dfae1c5, 0x000001e8, 0x0c49e2c4, 0xc2e8c5db,
+0xe2c400db, 0x0fd90e79, 0x0001b083, 0x58e8c500,
+0x065db8f6, 0xc8c50000, 0x01e135c2, 0xc4000000,
+0xf10e79e2, 0x0193830f, 0xe8c50000, 0xc5d05d14,
+0xd07515e8, 0xde5ce0c5, 0x0006a6b8, 0x59e0c500,
+0xc2e0c5dc, 0x0001c61d, 0xe2c40000, 0x0fd90e79,
+0x00016883, 0x12fac500, 0xe2c4d05d, 0x61351879,
+0xc5000001, 0xd05d5ce0, 0x000717b8, 0x79e2c400,
+0x01523d18, 0xc8c50000, 0xc8c5f458, 0xe0c5f759,
+0xc400dec2, 0xd90e79e2, 0x012f830f, 0xfac50000,
+0xc5d05d16, 0xc5ed58d8, 0xd07528f8, 0x00071eb8,
+0x5ce0c500, 0x59d0c5de, 0xc2e0c5ef, 0xe2c400dd,
+0x0fd90e79, 0x00010483, 0x10fac500, 0xf8c5e45d,
+0xb8b07529, 0x0000072a, 0x5d11fac5, 0x10fac5b4,
+0xfac5ec5d, 0xc5bc5d11, 0xc5db57e0, 0x01dcc2e0,
+0x4a69e3c4, 0xf8c530d6, 0xc5b05d28, 0x00d2c2e0,
+0x0e79e2c4, 0xc2830fd1, 0xc5000000, 0xd07d28f8,
+0x00073ab8, 0x41e3c400, 0x0ae0550c, 0xdac2e0c5,
+0x79e2c400, 0x830fd90e, 0x000000a1, 0x6528f8c5,
+0xd0dbc5d0, 0xf8c5e055, 0xc5d07d28, 0xe05dd0c3,
+0x000743b8, 0xc2e8c500, 0xe2c400d3, 0x73d10e79,
+0x28f8c57c, 0xe3c4d05d, 0xe0554061, 0x0752b8f1,
+0xe8c50000, 0x009515c2, 0xc4000000, 0xd10e79e2,
+0xf8c55b73, 0xc5a05d29, 0xc5db57e0, 0xa0557ce3,
+0x5529f8c5, 0x7ce3c5a0, 0xe8c5a055, 0xc5ffd2c6,
+0x45152ef8, 0x7a000000, 0xc52d752f, 0xd06528f8,
+0x557ddbc5, 0xc5c031e0, 0xc5d37ceb, 0xc5d37ceb,
+0x00d3c2e8, 0x0e79e2c4, 0xc0920fd1, 0x1901f883,
+0x076725c0, 0x05eb0000, 0x00075eb8, 0x00c35d00,
+0x80000000, 0xbf800000, 0x3f000000, 0x41200000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x41a00000, 0x00000000, 0x00000000, 0x00000000,
+0x40a00000, 0x40a00000, 0x40a00000, 0x40a00000,
+0x40000000, 0x40000000, 0x40000000, 0x40000000,
+0002400,
+};
+asm(".type avx2_x86_64_D_16f4, STT_NOTYPE;");
+asm(".type avx2_x86_64_D_16f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_16f8[] = {
+0x485500eb, 0xfbc5e589, 0x04820d10, 0xfbc50000,
+0x044a1510, 0x8b480000, 0x00044b05, 0x11fbc500,
+0x8948d04d, 0xfbc5f845, 0xc5e05511, 0xf04d11fb,
+0x5511fbc5, 0x11fbc5d8, 0xf9c5e84d, 0xc5d07d28,
+0xa07d29f9, 0x5528f9c5, 0x76f1c5a0, 0x0539b8c9,
+0xe9c50000, 0xc400dfc2, 0xd90f79e2, 0x03f3830f,
+0xe9c50000, 0xc5d05d58, 0xb05d29f9, 0x5d28f9c5,
+0x053fb8d0, 0xe1c50000, 0xe1c5db58, 0x00b05dc2,
+0x0f79e2c4, 0xca830fd9, 0xc5000003, 0xb07d28f9,
+0x5d5cc1c5, 0x29f9c5d0, 0xe9c5c05d, 0x00c05dc2,
+0x000544b8, 0x79e2c400, 0x830fd90f, 0x000003a5,
+0x5d28f9c5, 0x59e9c5e0, 0xe1c5d055, 0xf9c5e359,
+0xc5d05d28, 0xe07558e1, 0x6d5ce1c5, 0x5ce9c5e0,
+0x055bb8d4, 0xd1c50000, 0xe9c5ee59, 0xc400d5c2,
+0xd10f79e2, 0x036b830f, 0xe1c50000, 0xc5f05559,
+0xa05529f9, 0x5d5ee1c5, 0xc2e9c5f0, 0x64b800d3,
+0xc4000005, 0xd10f79e2, 0x0347830f, 0xf9c50000,
+0xc5f05d28, 0x552512fb, 0xb8000003, 0x00000567,
+0xd457e1c5, 0x6557d9c5, 0x59e9c5d0, 0xe9c5a055,
+0xc400d4c2, 0xd10f79e2, 0x0317830f, 0xfbc50000,
+0xc5d055e6, 0xc5d2e6fa, 0xd055c2e9, 0x056eb800,
+0xe2c40000, 0x0fd10f79, 0x0002f883, 0x5af9c500,
+0xf8c5d055, 0xf8c5d253, 0xf9c5d25a, 0xc5a05529,
+0xa0555af9, 0xd253f8c5, 0x6d28f9c5, 0x0575b8d0,
+0xf8c50000, 0xfbc5d25a, 0xfac5d2e6, 0xe9c5d2e6,
+0xc400d5c2, 0xd10f79e2, 0x02b7830f, 0xd1c50000,
+0xf9c5d559, 0xc5a05529, 0xa0555af9, 0xd252f8c5,
+0xd25af8c5, 0x5529f9c5, 0x28f9c5b0, 0x7cb8b065,
+0xc5000005, 0xc5d45af9, 0xc5d253f8, 0xc5d25af8,
+0xc5d2e6fb, 0xc5d2e6fa, 0x00eac2d1, 0x0f79e2c4,
+0x6e830fe9, 0xc5000002, 0xc5e4e6fb, 0xc5ece6fa,
+0xd06528f9, 0x00057eb8, 0x5af9c500, 0x53f8c5d4,
+0x5af8c5d2, 0xe6fbc5d2, 0xe6fac5d2, 0xc2d1c5d2,
+0xe2c400d2, 0x0fd10f79, 0x00023883, 0x59d9c500,
+0x29f9c5d4, 0xf9c5a055, 0xc5a05551, 0x00d4c2e9,
+0x00059cb8, 0x79e2c400, 0x830fd10f, 0x00000215,
+0x2d12fbc5, 0x00000248, 0xd45ed1c5, 0x5529f9c5,
+0x79e3c4a0, 0x0ba05509, 0x0005a4b8, 0xc2e9c500,
+0x00022a15, 0xe2c40000, 0x0fd10f79, 0x0001e483,
+0x59e1c500, 0xe1c5e055, 0xf9c5f459, 0xc5b05529,
+0xb0555fc9, 0x755dc9c5, 0x29f9c5b0, 0xe9c5b075,
+0xc5b05558, 0xe06558d9, 0x00063db8, 0x59e9c500,
+0xc2e9c5d3, 0xe2c400d4, 0x0fd10f79, 0x0001a483,
+0x79e3c400, 0x01d05505, 0x00064eb8, 0xc2e9c500,
+0xc400e055, 0xd10f79e2, 0x0187830f, 0xf9c50000,
+0xc5e05528, 0xd07d28f9, 0x000653b8, 0xe6fbc500,
+0xfad9c5e2, 0x0001b725, 0x79e2c400, 0xd9c5e425,
+0xc401f473, 0xe40d41e2, 0xe4c2e9c5, 0x79e2c400,
+0x830fe10f, 0x0000014d, 0x6516e9c5, 0x28f9c5d0,
+0xe9c5d07d, 0xd9c5f715, 0xa8b8e65c, 0xc5000006,
+0xc5e359d9, 0x00e5c2d9, 0x0f79e2c4, 0x22830fe1,
+0xf2000001, 0xd065120f, 0x2d12fbc5, 0x00000128,
+0xed58e1c5, 0x7528f9c5, 0x12fbc5d0, 0x0001273d,
+0x0717b800, 0xd9c50000, 0xd1c5e65c, 0xd9c5ef59,
+0xc400e5c2, 0xe10f79e2, 0x00e7830f, 0xfbc50000,
+0xc5e86510, 0xb07529f9, 0x00072ab8, 0x11fbc500,
+0xd9c5b865, 0xd9c5e457, 0xc401dbc2, 0xd64b69e3,
+0x28f9c530, 0xe1c5b05d, 0xc400d2c2, 0xd10f79e2,
+0x00af830f, 0xf9c50000, 0xb8d07d28, 0x0000073a,
+0x0d41e3c4, 0xc502e055, 0x00dac2e1, 0x0f79e2c4,
+0x8e830fd9, 0xc5000000, 0xd07d28f9, 0x55d0c1c5,
+0x28f9c5e0, 0xc9c5d075, 0xb8e05dd0, 0x00000743,
+0xd3c2e9c5, 0x79e2c400, 0x6973d10f, 0x5d28f9c5,
+0x61e3c4d0, 0x31e05541, 0x000752b8, 0xc2e9c500,
+0x0000aa15, 0xe2c40000, 0x73d10f79, 0x29f9c548,
+0xd9c5a05d, 0xc5a0557c, 0xc5d215e9, 0x5d152ef9,
+0x7a000000, 0xc529752b, 0xd07d28f9, 0x557dc1c5,
+0xc5c031e0, 0xc5d47ce9, 0x00d4c2e9, 0x0f79e2c4,
+0xc0920fd1, 0x1901f883, 0x076725c0, 0x05eb0000,
+0x00075eb8, 0x00c35d00, 0x00000000, 0x00000000,
+0x00000000, 0x40000000, 0x00000000, 0xbff00000,
+0x00000000, 0x80000000, 0x00000000, 0x3fe00000,
+0x00000000, 0x40080000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x00000000, 0x40100000, 0x00000000, 0x00000000,
+0002300,
+};
+asm(".type avx2_x86_64_D_16f8, STT_NOTYPE;");
+asm(".type avx2_x86_64_D_16f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_32i1[] = {
+0xb85500eb, 0x00000001, 0x000008be, 0x21b74000,
+0x41e58948, 0x41564157, 0x53544155, 0xe0e48348,
+0xe8ec8148, 0x89000000, 0xff488dfa, 0x67044488,
+0x9488c229, 0x00008704, 0x83ca8900, 0xfa8301e2,
+0x21d21901, 0x02e283c1, 0xf983caff, 0x00de8301,
+0xa7049488, 0x40000000, 0xc704b488, 0x48000000,
+0x8348c0ff, 0xbf7521f8, 0x7c6ffdc5, 0xfdc56824,
+0x08247c7f, 0x546ffdc5, 0xd5c50824, 0x39b8ed76,
+0xc5000005, 0xc4cf74ed, 0xcd177de2, 0x0861830f,
+0xedc50000, 0x68244cfc, 0x4c7ffdc5, 0xfdc52824,
+0x68247c6f, 0x00053fb8, 0xfcc5c500, 0x74f5c5cf,
+0xc428244c, 0xcd177de2, 0x0835830f, 0xfdc50000,
+0x28247c6f, 0x4cf8c5c5, 0xfdc56824, 0x48244c7f,
+0x5474edc5, 0x44b84824, 0xc4000005, 0xd5177de2,
+0x080d830f, 0xfdc50000, 0xa824bc6f, 0xc5000000,
+0x24546ffd, 0x6ffdc568, 0x00c824b4, 0x45c50000,
+0xedc5ff60, 0xc5c5da60, 0xedc5ff68, 0x85c5ca68,
+0xc5c5dbd5, 0xe2c4c9d5, 0x011d0065, 0xc4000008,
+0x0d0075e2, 0x00000818, 0x0265e3c4, 0xf1c5ccd9,
+0xcdc5c9ef, 0xf5c5c964, 0xfdc5f3db, 0x4824747f,
+0x4824548a, 0xc8248c8a, 0x89000000, 0x8ae0d3d0,
+0x00c9248c, 0x44880000, 0x448ac824, 0xe0d34924,
+0xca248c8a, 0x88000000, 0x8af42444, 0xd34a2444,
+0x248c8ae0, 0x000000cb, 0xf0244488, 0x4b24448a,
+0x8c8ae0d3, 0x0000cc24, 0x24448800, 0x24448aec,
+0x8ae0d34c, 0x00cd248c, 0x44880000, 0x448ae824,
+0xe0d34d24, 0xce248c8a, 0x88000000, 0x8ac42444,
+0xd34e2444, 0x248c8ae0, 0x000000cf, 0xc0244488,
+0x4f24448a, 0x8c8ae0d3, 0x0000d024, 0x24448800,
+0x24448abf, 0x8ae0d350, 0x00d1248c, 0x44880000,
+0x448ab824, 0xe0d35124, 0xd2248c8a, 0x88000000,
+0x8abe2444, 0xd3522444, 0x244488e0, 0x248c8ab4,
+0x000000d3, 0x5324448a, 0x247c8a44, 0x748a4457,
+0x8a445b24, 0xd35c2444, 0x248c8ae0, 0x000000d4,
+0x246c8a44, 0x2444885d, 0x24448abd, 0x7c8a4054,
+0xe0d35e24, 0xd5248c8a, 0x88000000, 0x8ab02444,
+0xd3552444, 0x248c8ae0, 0x000000d6, 0xbc244488,
+0x5624448a, 0x8c8ae0d3, 0x0000d724, 0x24448800,
+0x24448aac, 0xe7d34158, 0xd8248c8a, 0xd3000000,
+0x248c8ae0, 0x000000d9, 0xa8244488, 0x5924448a,
+0x8c8ae0d3, 0x0000da24, 0x24448800, 0x24448aa4,
+0x8ae0d35a, 0x00db248c, 0x44880000, 0xd341a024,
+0x248c8ae6, 0x000000dc, 0x8ae0d341, 0x00dd248c,
+0xd3410000, 0x248c8ae5, 0x000000de, 0x8c8ae7d3,
+0x0000df24, 0x648a4400, 0xf9c55f24, 0xc824646e,
+0x24748a40, 0x245c8a60, 0x6ef9c561, 0xc5f02474,
+0x244c6e79, 0xe4d341e8, 0xe0248c8a, 0x8a000000,
+0xc5622444, 0x24646e79, 0x5c8a44c0, 0x8a446324,
+0xc5652454, 0x244c6ef9, 0x6e79c5b8, 0xd3b4245c,
+0x248c8ae6, 0x000000e1, 0x244c8a44, 0x6e79c566,
+0xc4b02444, 0x742049e3, 0xc401ec24, 0x64201963,
+0xd301bf24, 0x248c8ae3, 0x000000e2, 0x202163c4,
+0x01bd245c, 0x2059e3c4, 0x01f42464, 0x203163c4,
+0x01c4244c, 0x8c8ae0d3, 0x0000e324, 0x71e3c400,
+0xbe244c20, 0x24448801, 0x24448a9c, 0x3141c464,
+0xd9c5cc61, 0xc1c4e661, 0x41cb6171, 0xc1c4e3d3,
+0xc4e16259, 0xe06e7941, 0xe4248c8a, 0xc5000000,
+0xc5cf6e79, 0xc4f66ef9, 0xe5201943, 0x3143c401,
+0xc401cc20, 0xf32049e3, 0x8ae0d301, 0x00e5248c,
+0x41c40000, 0x88c96119, 0x8a982444, 0x41672444,
+0x8c8ae2d3, 0x0000e624, 0xe1d34100, 0xe7248c8a,
+0xc4000000, 0x44203963, 0xc501bc24, 0x24546e79,
+0x2943c4ac, 0xc501d720, 0x246c6e79, 0x6e79c5a8,
+0xc49c245c, 0xc2613941, 0x201163c4, 0x01a4246c,
+0x41c4e0d3, 0xc4d16e79, 0xc86271c1, 0x446e79c5,
+0x43c49824, 0x01db2021, 0xe16cd9c5, 0x4c6ef9c5,
+0x43c4a024, 0x01c22039, 0x2071c3c4, 0x63c401ce,
+0x01d02029, 0x6149c1c4, 0x6191c5f3, 0x3941c4c9,
+0xc1c4c261, 0xc4f06249, 0xc96271c1, 0xce6cf1c5,
+0x385de3c4, 0xfdc501f1, 0xc824747f, 0xb46ffdc5,
+0x0000c824, 0xc501b000, 0xc4d86e79, 0xdb787d42,
+0xf84dc1c4, 0x7ffdc5cb, 0x00c8248c, 0x8c8a0000,
+0x0000c824, 0x24448a00, 0x7c8a4049, 0x8a444c24,
+0xd34d247c, 0x248c8ae2, 0x000000c9, 0x24748a40,
+0x748a444e, 0x8a444f24, 0x8851246c, 0xd3f42454,
+0x248c8ae0, 0x000000ca, 0x5024548a, 0x24648a44,
+0x245c8a53, 0x24448854, 0x24448af0, 0x5c8a444a,
+0xe0d35524, 0xcb248c8a, 0x88000000, 0x8aec2444,
+0xd34b2444, 0x248c8ae0, 0x000000cc, 0xe8244488,
+0x5224448a, 0x8c8ae7d3, 0x0000cd24, 0x6e79c500,
+0xe7d341e7, 0xce248c8a, 0xc4000000, 0xe7201943,
+0x8ae6d301, 0x00cf248c, 0x79c50000, 0xd341c66e,
+0x248c8ae6, 0x000000d0, 0x203943c4, 0xe2d301c6,
+0xd1248c8a, 0xc4000000, 0xc0611941, 0xd26e79c5,
+0x8ae5d341, 0x00d2248c, 0x43c40000, 0x01d52029,
+0x8c8ae0d3, 0x0000d324, 0x24448800, 0xe4d341c4,
+0xd4248c8a, 0xd3000000, 0x248c8ae3, 0x000000d5,
+0xf36ef9c5, 0x8ae3d341, 0x00d6248c, 0x8a440000,
+0x44562454, 0x57244c8a, 0x24448a44, 0x49c3c458,
+0x4101f320, 0x8c8ae2d3, 0x0000d724, 0x7941c400,
+0xd341ca6e, 0x248c8ae1, 0x000000d8, 0x203143c4,
+0xd34101c9, 0x248c8ae0, 0x000000d9, 0x6149c1c4,
+0x448844f1, 0x8a44c024, 0x41592444, 0x8c8ae0d3,
+0x0000da24, 0x44884400, 0x8a44bf24, 0x415a2444,
+0x8c8ae0d3, 0x0000db24, 0x44884400, 0x8a44b824,
+0x415b2444, 0x8c8ae0d3, 0x0000dc24, 0x44884400,
+0x8a44be24, 0x415c2444, 0x8c8ae0d3, 0x0000dd24,
+0x44884400, 0x8a44b424, 0x415d2444, 0x8c8ae0d3,
+0x0000de24, 0x44884400, 0x8a44bd24, 0x415e2444,
+0x8c8ae0d3, 0x0000df24, 0x44884400, 0x8a44b024,
+0x415f2444, 0x8c8ae0d3, 0x0000e024, 0x44884400,
+0x8a44bc24, 0x41602444, 0x8c8ae0d3, 0x0000e124,
+0x44884400, 0x8a44ac24, 0xc5612444, 0x244c6ef9,
+0x6e79c5f4, 0xc5ec246c, 0x24646ef9, 0x1163c4c4,
+0xe8246c20, 0x24448a01, 0x6e79c567, 0x41b82474,
+0x8c8ae0d3, 0x0000e224, 0x71e3c400, 0xf0244c20,
+0x59c3c401, 0x4401e420, 0xa8244488, 0x24448a44,
+0x61a9c562, 0x6e79c5e4, 0xc4ac2464, 0xcd6171c1,
+0xe662d9c5, 0x200963c4, 0x01be2474, 0xc4e0d341,
+0xc86271c1, 0xe3248c8a, 0xc5000000, 0x24546e79,
+0x448844b4, 0x8a44a424, 0xc5632444, 0xc5cc6cf1,
+0x246c6e79, 0x2963c4b0, 0xbd245420, 0x1163c401,
+0xbc246c20, 0x6ef9c501, 0x41c02464, 0x8c8ae0d3,
+0x0000e424, 0x59e3c400, 0xbf246420, 0x44884401,
+0x8a44a024, 0xc4642444, 0xd5612941, 0x6159c1c4,
+0xe0d341e6, 0xe5248c8a, 0xc4000000, 0xe26259c1,
+0x24448844, 0x448a449c, 0xd3416524, 0x248c8ae0,
+0x000000e6, 0x24448844, 0x448a4498, 0xd3416624,
+0x248c8ae0, 0x000000e7, 0x201963c4, 0x01a82464,
+0x746ef9c5, 0x79c5a424, 0x9c244c6e, 0x2049e3c4,
+0x01a02474, 0x203163c4, 0x0198244c, 0x41c4e0d3,
+0xc4c06e79, 0xc0203963, 0x6199c501, 0x0621b8f6,
+0x41c40000, 0xc4c86131, 0xf16249c1, 0xe66cd9c5,
+0x3875e3c4, 0xf5c501cc, 0xf5c5c9fc, 0xc8244c74,
+0x177de2c4, 0x28830fcd, 0xc5000001, 0x248c6ffd,
+0x00000088, 0x5c7ffdc5, 0xf5c50824, 0xf5c5e160,
+0xc1c4c968, 0xc5e7d55d, 0xc4cfd5f5, 0x25005de2,
+0x0000012c, 0x0075e2c4, 0x0001430d, 0x5de3c400,
+0xc5ccc902, 0x244c7ffd, 0x65e2c428, 0x28244c3c,
+0x3865e2c4, 0xc528245c, 0x245c7ffd, 0xfcf5c528,
+0xb828244c, 0x0000063d, 0xd960f5c5, 0xc968f5c5,
+0xd565c1c4, 0xd5f5c5df, 0x65e2c4cf, 0x00de1d00,
+0xe2c40000, 0xf50d0075, 0xc4000000, 0xc90265e3,
+0xfcedc5cc, 0x0088249c, 0xf5c50000, 0xe2c4cb74,
+0x0fcd177d, 0x00008a83, 0x7de2c400, 0x08244c1c,
+0xc974edc5, 0x000644b8, 0x7de2c400, 0x7373cd17,
+0x0825e2c4, 0x00a8248c, 0x49b80000, 0xc5000006,
+0x248c74f5, 0x000000a8, 0x177de2c4, 0xc65473cd,
+0x21072444, 0x00065db8, 0x7de2c400, 0x07244c78,
+0xd974e5c5, 0x177de2c4, 0xb03873dd, 0x6de3c41f,
+0xc501ca46, 0xc4d86ef9, 0xca0f75e3, 0xc4c03101,
+0xdb787de2, 0xd3dbedc5, 0xfc6dc1c4, 0x74edc5d3,
+0x7de2c4d1, 0x920fd517, 0x01f883c0, 0x4a25c019,
+0x48000007, 0x5bd8658d, 0x5d415c41, 0x5f415e41,
+0x0000c35d, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x06040200, 0x0e0c0a08, 0x0b0a0908, 0x0f0e0d0c,
+0x06040200, 0x0e0c0a08, 0x0b0a0908, 0x0f0e0d0c,
+0x03020100, 0x07060504, 0x06040200, 0x0e0c0a08,
+0x03020100, 0x07060504, 0x06040200, 0x0e0c0a08,
+0004540,
+};
+asm(".type avx2_x86_64_D_32i1, STT_NOTYPE;");
+asm(".type avx2_x86_64_D_32i1, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_32u1[] = {
+0xb85500eb, 0x00000001, 0x000008b9, 0x21b74000,
+0x41e58948, 0x41564157, 0x53544155, 0xe0e48348,
+0xc8ec8148, 0x89000000, 0xff508dfe, 0x47044488,
+0x8840c629, 0x89670474, 0x83c221d6, 0xceff01e6,
+0x8301fa83, 0x884000d9, 0x008704b4, 0x8c880000,
+0x0000a704, 0xc0ff4800, 0x21f88348, 0xfdc5c975,
+0x4824546f, 0x547ffdc5, 0xfdc5e824, 0xe8245c6f,
+0x000539b8, 0x74e5c500, 0x76edc5ca, 0x7de2c4d2,
+0x830fca17, 0x000007a9, 0x4cfce5c5, 0xfdc54824,
+0x08244c7f, 0x7c6ffdc5, 0x3fb84824, 0xc5000005,
+0xc5cffcc5, 0x244c74f5, 0x7de2c408, 0x830fca17,
+0x0000077d, 0x7c6ffdc5, 0xc5c50824, 0x48244cf8,
+0x4c7ffdc5, 0xe5c52824, 0x28246474, 0x000544b8,
+0x7de2c400, 0x830fe217, 0x00000755, 0x5cebe5c5,
+0xfdc56824, 0xe8245c7f, 0x4cdbf5c5, 0xfdc56824,
+0x28247c6f, 0x5cefc5c5, 0xf5c56824, 0xe8244cdf,
+0x000550b8, 0x74f5c500, 0x7de2c4cb, 0x830fca17,
+0x0000071d, 0xdbefe1c5, 0x8c74e5c5, 0x0000a824,
+0x74f5c500, 0xdbf5c5cb, 0xc5482474, 0x24747ffd,
+0x24448a28, 0x248c8a28, 0x000000a8, 0x8a40c389,
+0x8a29247c, 0xd32b2454, 0x248c8ae3, 0x000000a9,
+0xd4245c88, 0x2a245c8a, 0x8c8ae7d3, 0x0000aa24,
+0x7c884000, 0x8a40d324, 0xd32c247c, 0x248c8ae3,
+0x000000ab, 0xcc245c88, 0x2d245c8a, 0x8c8ae2d3,
+0x0000ac24, 0x24548800, 0x24548ad2, 0x8ae7d32e,
+0x00ad248c, 0x88400000, 0x40c8247c, 0x2f247c8a,
+0x8c8ae3d3, 0x0000ae24, 0x245c8800, 0x245c8ad1,
+0x8ae2d330, 0x00af248c, 0x54880000, 0x548ac424,
+0xe7d33124, 0xb0248c8a, 0x40000000, 0xd0247c88,
+0x247c8a40, 0x8ae3d332, 0x00b1248c, 0x5c880000,
+0xe2d3c024, 0xb2248c8a, 0x88000000, 0xd3bf2454,
+0x7c8840e7, 0x8c8ab824, 0x0000b324, 0x748a4000,
+0x5c8a3324, 0x548a3424, 0x8a403524, 0xd336247c,
+0x7c8a44e6, 0x8a443724, 0x443b2474, 0x3d246c8a,
+0x244c8a44, 0x7488403e, 0x8c8abe24, 0x0000b424,
+0x748a4000, 0xe3d33824, 0xb5248c8a, 0x88000000,
+0x8ab4245c, 0xd339245c, 0x248c8ae2, 0x000000b6,
+0xbd245488, 0x3a24548a, 0x8c8ae7d3, 0x0000b724,
+0x7c884000, 0xd341b024, 0x248c8ae7, 0x000000b8,
+0x8c8ae6d3, 0x0000b924, 0x74884000, 0x8a40ac24,
+0xd33c2474, 0x248c8ae3, 0x000000ba, 0xa8245c88,
+0x8c8ae2d3, 0x0000bb24, 0x24548800, 0xe6d341a4,
+0xbc248c8a, 0xd3000000, 0x248c8ae6, 0x000000bd,
+0x8ae5d341, 0x00be248c, 0xd3410000, 0x248c8ae1,
+0x000000bf, 0x24648a44, 0x6ef9c53f, 0x40d4245c,
+0x40247c8a, 0x41245c8a, 0x4c6e79c5, 0xf9c5cc24,
+0xc8246c6e, 0x8ae4d341, 0x00c0248c, 0x8a440000,
+0xc5422444, 0x24446e79, 0x5c8a44c4, 0x548a4324,
+0xf9c54424, 0xc0244c6e, 0x7c6ef9c5, 0xe7d3b824,
+0xc1248c8a, 0x44000000, 0x4524548a, 0x646ef9c5,
+0x8840b424, 0x40a0247c, 0x46247c8a, 0x8c8ae3d3,
+0x0000c224, 0x3163c400, 0xd2244c20, 0x3963c401,
+0xd0244420, 0x41e3c401, 0xbe247c20, 0xe0d34101,
+0xc3248c8a, 0xc4000000, 0x5c2061e3, 0xc401d324,
+0x6c2051e3, 0xc401d124, 0x4c2071e3, 0x4101bf24,
+0x8c8ae3d3, 0x0000c424, 0x61c1c400, 0x41c4d961,
+0xc4c96e79, 0xe86151c1, 0xcf61f1c5, 0x6e7941c4,
+0xc5e2d3c0, 0x8add62e1, 0x00c5248c, 0x43c40000,
+0x01cc2031, 0x9c245488, 0x4724548a, 0x203943c4,
+0xd34101c3, 0x248c8ae2, 0x000000c6, 0x8c8ae7d3,
+0x0000c724, 0x59e3c400, 0xbd246420, 0x6ef9c501,
+0xc4b02474, 0xf72049c3, 0x6e79c501, 0xc5a42454,
+0x246c6ef9, 0x61d9c59c, 0xc5e2d3e6, 0xc5f66ef9,
+0xc5ff6ef9, 0xc5cc62f1, 0x24646ef9, 0x59e3c4ac,
+0xa8246420, 0x6ce1c501, 0x6ef9c5d9, 0xc4a0244c,
+0xd6202943, 0x49c3c401, 0xc401f520, 0xcb2071e3,
+0x51c3c401, 0xc401ea20, 0xfa2041e3, 0x59c1c401,
+0xc1c4e261, 0xc4f16149, 0xc86171c1, 0xef61d1c5,
+0xe662d9c5, 0xcd62f1c5, 0xc96cd9c5, 0x3865e3c4,
+0xf5c501d9, 0xf5c5c976, 0xa8248cfc, 0xc5000000,
+0x248c7ffd, 0x000000a8, 0xa8248c8a, 0xd3000000,
+0x248c8ae0, 0x000000a9, 0xd4244488, 0x2924448a,
+0x8c8ae0d3, 0x0000aa24, 0x24448800, 0x24448ad3,
+0x8ae0d32a, 0x00ab248c, 0x44880000, 0x448acc24,
+0xe0d32b24, 0xac248c8a, 0x88000000, 0x8ad22444,
+0xd32c2444, 0x248c8ae0, 0x000000ad, 0xc8244488,
+0x2d24448a, 0x8c8ae0d3, 0x0000ae24, 0x24448800,
+0x24448ad1, 0x8ae0d32e, 0x00af248c, 0x44880000,
+0x448ac424, 0xe0d32f24, 0xb0248c8a, 0x88000000,
+0x8ad02444, 0xd3302444, 0x248c8ae0, 0x000000b1,
+0xc0244488, 0x3124448a, 0x8c8ae0d3, 0x0000b224,
+0x24448800, 0x24448abf, 0x88e0d332, 0x8ab82444,
+0x00b3248c, 0x448a0000, 0x8a443324, 0x44362454,
+0x37247c8a, 0x24748a40, 0x8ae0d33c, 0x00b4248c,
+0x8a440000, 0x883d2474, 0x8abe2444, 0x44342444,
+0x3e244c8a, 0x8c8ae0d3, 0x0000b524, 0x24448800,
+0x24448ab4, 0x8ae0d335, 0x00b6248c, 0x44880000,
+0x448abd24, 0xd3413824, 0x248c8ae2, 0x000000b7,
+0x6e79c1c4, 0xe7d341fa, 0xb8248c8a, 0xc4000000,
+0xff2041c3, 0x8ae0d301, 0x00b9248c, 0x44880000,
+0x448ab024, 0xe0d33924, 0xba248c8a, 0x88000000,
+0x8aac2444, 0xd33a2444, 0x248c8ae0, 0x000000bb,
+0xa8244488, 0x3b24448a, 0x8c8ae0d3, 0x0000bc24,
+0x24448800, 0x8ae6d3a4, 0x00bd248c, 0xd3410000,
+0x248c8ae6, 0x000000be, 0x8ae1d341, 0x00bf248c,
+0x8a440000, 0xc53f246c, 0x246c6ef9, 0x24448ad4,
+0x648a4440, 0x79c54124, 0xcc24546e, 0x746ef9c5,
+0xd341c824, 0x248c8ae5, 0x000000c0, 0x24448a44,
+0x6e79c542, 0x8ac4244c, 0x8a43245c, 0xc5442454,
+0x244c6ef9, 0x6e79c5c0, 0xd3b82444, 0x248c8ae0,
+0x000000c1, 0x245c8a44, 0x6ef9c545, 0xc4b42464,
+0x54202963, 0x4001d224, 0x46247c8a, 0xa0244488,
+0x8ae4d341, 0x00c2248c, 0x63c40000, 0x244c2031,
+0x63c401d0, 0x24442039, 0xe3c401be, 0x246c2051,
+0xd34101d3, 0x248c8ae0, 0x000000c3, 0x2049e3c4,
+0x01d12474, 0x2071e3c4, 0x01bf244c, 0x2059e3c4,
+0x01bd2464, 0x6151c1c4, 0x8ae3d3ea, 0x00c4248c,
+0xc1c40000, 0x8af16149, 0xc5472444, 0xc4e761d9,
+0xc86171c1, 0xee62d1c5, 0xcc62f1c5, 0x79c5e2d3,
+0x41c4ce6e, 0xc5c06e79, 0xc4c96cd1, 0xde203143,
+0x6ef9c501, 0x248c8aea, 0x000000c5, 0x6e7941c4,
+0x3963c4c9, 0x4101c320, 0x8c8ae3d3, 0x0000c624,
+0x3143c400, 0xc401cd20, 0xeb2051c3, 0x2141c401,
+0xe7d3c961, 0xc7248c8a, 0xc5000000, 0x24646ef9,
+0x6e79c5b0, 0xc4a82454, 0x642059e3, 0xc401ac24,
+0x54202963, 0xc501a424, 0xd3ff6ef9, 0x6ef9c5e0,
+0xc4a02474, 0xf82041e3, 0x49c3c401, 0xc401f420,
+0xe26159c1, 0x000621b8, 0x49c1c400, 0xd1c5f061,
+0xc1c4ef61, 0xc5e16259, 0xc5ed62c9, 0xc4e56cd9,
+0xcc3875e3, 0xfcf5c501, 0x74f5c5c9, 0x7de2c4cb,
+0x830fca17, 0x000000a9, 0x4c6ffdc5, 0xf5c54824,
+0x68245cda, 0x64def5c5, 0xe5c56824, 0xf5c5dcfc,
+0x682464fc, 0x000634b8, 0x74e5c500, 0x7de2c4dc,
+0x7d73da17, 0xf9c501b0, 0x49b8d86e, 0xc4000006,
+0xdb787de2, 0x0865e2c4, 0x008824ac, 0xd5c50000,
+0x8824ac74, 0xc4000000, 0xea177de2, 0x44c65373,
+0xb821e724, 0x0000065d, 0x787de2c4, 0xc5e7246c,
+0xc4e574dd, 0xe2177de2, 0x1fb03773, 0x4675e3c4,
+0xf9c501e1, 0xe3c4e86e, 0x01e10f5d, 0xe2c4c031,
+0xc5ed787d, 0xc5cddbf5, 0xc5cbfcf5, 0xc4cc74f5,
+0xca177de2, 0x83c0920f, 0xc01901f8, 0x00074a25,
+0x658d4800, 0x5c415bd8, 0x5e415d41, 0xc35d5f41,
+0004100,
+};
+asm(".type avx2_x86_64_D_32u1, STT_NOTYPE;");
+asm(".type avx2_x86_64_D_32u1, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_32i2[] = {
+0xb85500eb, 0x00000001, 0x10b9f631, 0x41000000,
+0x000011ba, 0xe5894800, 0x56415741, 0x54415541,
+0xe4834853, 0xec8148e0, 0x00000088, 0xa42444c7,
+0x00000010, 0x45ff788d, 0x8941d089, 0x41fa89c1,
+0xe283c029, 0x01fa8301, 0xe283d219, 0x85caff02,
+0xff0575c7, 0x01b640c9, 0x4c894466, 0x44660644,
+0x26444489, 0x44548966, 0x4c896646, 0xff486644,
+0xf88348c0, 0x40bd7511, 0x0474f684, 0xa4244c89,
+0x746ffdc5, 0xfdc50824, 0xa824747f, 0x546ffdc5,
+0xf5c5a824, 0x39b8c976, 0xc5000005, 0xc4de75ed,
+0xd9177de2, 0x0701830f, 0xedc50000, 0x08245cfd,
+0x5c7ffdc5, 0xfdc5c824, 0x0824746f, 0x00053fb8,
+0x71e5c500, 0xe5c501f6, 0xc8245c75, 0x177de2c4,
+0xd4830fd9, 0xc5000006, 0x24746ffd, 0xf9cdc5c8,
+0xc508245c, 0x245c7ffd, 0x75edc5e8, 0xb8e8245c,
+0x00000544, 0x177de2c4, 0xac830fd9, 0xc5000006,
+0x24746ffd, 0xd5edc528, 0xc5082454, 0xc5e6d5cd,
+0x24647ffd, 0x6ffdc5c8, 0xc508245c, 0xc5f6fde5,
+0x246cf9e5, 0xf9edc528, 0x055bb8d4, 0xd5c50000,
+0xedc5eed5, 0xfdc5d575, 0xe8246c7f, 0x177de2c4,
+0x64830fd1, 0xc5000006, 0x2454d5e5, 0x7ffdc528,
+0x66a82454, 0xc82444c7, 0xc0310010, 0x00000ebf,
+0x748d4800, 0xc766e424, 0x10e62444, 0x48fa8900,
+0xc229f189, 0x04540366, 0xc12948c8, 0x04548966,
+0xc08348ca, 0x11896602, 0x0ef88348, 0x8966df75,
+0xc5d82454, 0x24746ffd, 0x05c8b8a8, 0xcdc50000,
+0xc8245475, 0x177de2c4, 0xfc830fd1, 0xc5000005,
+0x2464e5e5, 0x6ffdc548, 0xc548246c, 0xb8ffefc1,
+0x000005cf, 0xd565c5c5, 0xd475edc5, 0x177de2c4,
+0xd4830fd1, 0xc5000005, 0x2474d5d5, 0x7ffdc508,
+0xc5e82474, 0x24646ffd, 0x71ddc5e8, 0xfdc503f4,
+0xa824647f, 0x546ffdc5, 0xedc5e824, 0xc502f271,
+0x24547ffd, 0xfdedc5c8, 0x05edb8d2, 0xedc50000,
+0xe2c4d475, 0x0fd1177d, 0x00058e83, 0x6ffdc500,
+0xc5a82464, 0x02e471ed, 0xd2fdedc5, 0x0005f2b8,
+0x75edc500, 0xc4c82454, 0xd1177de2, 0x0569830f,
+0x65c50000, 0x44c7c5d5, 0x0003a424, 0x63480000,
+0xc4a42444, 0xd06ef9e1, 0xd2f1bdc5, 0xa42444c7,
+0x00000002, 0x24446348, 0xf9e1c4a4, 0xbdc5e06e,
+0xfdc5e4f1, 0xc824647f, 0xe4fdddc5, 0x000605b8,
+0x75ddc500, 0x7de2c4e2, 0x830fe117, 0x0000051b,
+0x24446348, 0xf9e1c4a4, 0xedc5e06e, 0xedc5d4e1,
+0x09b8d2fd, 0xc5000006, 0x245475ed, 0x7de2c4c8,
+0x830fd117, 0x000004f3, 0x646ffdc5, 0xddc56824,
+0xc1c4d765, 0xc5f8db6d, 0x247c7ffd, 0x24548be8,
+0x244c8be8, 0xd7894168, 0x24448b66, 0x748b44ea,
+0x4466ec24, 0xee24648b, 0x66e7d341, 0x6a244c8b,
+0x246c8b44, 0x7c8b66f0, 0x5c8bf224, 0xc1c4f424,
+0xd3d76e79, 0x244c8be0, 0x24748b6c, 0x5c8b44f8,
+0x4466fc24, 0xfe24448b, 0x24448966, 0xe6d34194,
+0x244c8b66, 0x148b446e, 0xe4d34124, 0x70244c8b,
+0x66e5d341, 0x72244c8b, 0x6e79c1c4, 0x8be7d3fd,
+0xd374244c, 0x4c8b66e3, 0x89667624, 0x6690245c,
+0xf6245c8b, 0x4c8be3d3, 0xe6d37824, 0x244c8b66,
+0x7489667a, 0x8b668c24, 0xd3fa2474, 0x244c8be6,
+0x7489667c, 0x8b668a24, 0x41022474, 0x8b66e3d3,
+0x417e244c, 0x8c8be0d3, 0x00008024, 0xe2d34100,
+0x248c8b66, 0x00000082, 0x8c8be6d3, 0x00008424,
+0x4c8b4400, 0x79c50424, 0x90244c6e, 0x64c4e9c5,
+0xc4019424, 0xd66e79c1, 0x24448b66, 0x6941c406,
+0x4101c4c4, 0xc1c5e1d3, 0x6601d7c4, 0x86248c8b,
+0xc5000000, 0x01fbc4b1, 0x6259c1c4, 0x7941c4e0,
+0xe9c5d16e, 0x41c4d762, 0xc5c26e79, 0x247c6ef9,
+0xc5e0d38c, 0xc5e26cd9, 0x2454c4c1, 0xc1c4018a,
+0xc4fb6e79, 0xc8c44141, 0xc4b9c501, 0x29c501fe,
+0xc401c0c4, 0xd16269c1, 0x6241c1c4, 0x6ce9c5f8,
+0x5de3c4d7, 0xb801e238, 0x00000001, 0x7c6ffdc5,
+0xf9c56824, 0xe2c4d06e, 0xc5d2797d, 0xc5d2f9c5,
+0x24547ffd, 0x244c8b68, 0x448b6668, 0x8b44ea24,
+0x66ec247c, 0x24648b44, 0x66e2d3ee, 0x6a244c8b,
+0x24748b44, 0x748b66f0, 0x8b44f224, 0x66f4246c,
+0x94245489, 0x4c8be0d3, 0x8b666c24, 0x44f6245c,
+0xf8245c8b, 0x24548b44, 0x448966fc, 0xd3419024,
+0x4c8b66e7, 0x8b666e24, 0x66fa2444, 0xfe247c8b,
+0x240c8b44, 0x8be4d341, 0x6670244c, 0x0224548b,
+0x24448b44, 0xe6d34104, 0x244c8b66, 0x7941c472,
+0xe6d3c66e, 0x74244c8b, 0x66e5d341, 0x76244c8b,
+0x6e7941c4, 0x8be3d3d5, 0x4178244c, 0x8b66e3d3,
+0xd37a244c, 0x244c8be0, 0x4489667c, 0xd3418c24,
+0x4c8b66e2, 0xe7d37e24, 0x80248c8b, 0x41000000,
+0x8b66e1d3, 0x0082248c, 0xe2d30000, 0x84248c8b,
+0x41000000, 0x8b66e0d3, 0x0086248c, 0x8b660000,
+0xc5062444, 0x247c6ef9, 0xc4c1c594, 0x01902454,
+0x6e79c1c4, 0x7941c4ff, 0x41c4d86e, 0x01ccc441,
+0xfec4b9c5, 0xc5e0d301, 0x01c3c429, 0x6241c1c4,
+0x69c1c4f8, 0x41c4d162, 0xc5c36e79, 0xc5d76ce9,
+0x247cc4b9, 0x41c4018c, 0xc5c26e79, 0x01d7c439,
+0x6e7941c4, 0xc439c5c1, 0x21c501ca, 0xc401c0c4,
+0xfa6241c1, 0x000621b8, 0x3141c400, 0xc1c4c062,
+0xc4f86c41, 0xd7386de3, 0xfdedc501, 0x75edc5d2,
+0x7de2c4d4, 0x830fd117, 0x000001ff, 0x54d5d5c5,
+0xfdc52824, 0xc824547f, 0x54eecdc5, 0xfdc5c824,
+0xe824547f, 0x74eacdc5, 0xfdc5c824, 0xc824747f,
+0x54fdedc5, 0xe5c5c824, 0x282464fd, 0x00063db8,
+0xd5edc500, 0x75edc5d5, 0x7de2c4d4, 0x830fd117,
+0x000001b7, 0xebd5d5c5, 0x6c7ffdc5, 0xe2c4a824,
+0x24541d7d, 0x75e5c5a8, 0x0644b8d2, 0xe2c40000,
+0x0fd1177d, 0x00019283, 0x0001b800, 0xf9c50000,
+0x49b8d06e, 0xc4000006, 0xd2797de2, 0x096de2c4,
+0xc5482454, 0x245475ed, 0x7de2c448, 0x830fd117,
+0x00000167, 0x54fde5c5, 0xc7662824, 0x11a22444,
+0x065db800, 0xe2c40000, 0x2464797d, 0x75edc5a2,
+0x7de2c4d4, 0x830fd117, 0x0000013f, 0x5c7ffdc5,
+0x02b8c824, 0x66000000, 0x2804548b, 0x04548966,
+0xc08348c8, 0xf8834804, 0xc5ec7522, 0x245c6ffd,
+0x073ab808, 0xe3c40000, 0x24540e65, 0xedc5aa28,
+0xc8245475, 0x177de2c4, 0xfc830fd1, 0xc4000000,
+0xd34665e3, 0x000fb801, 0xe3c40000, 0x02e30f6d,
+0xd06ef9c5, 0x000001b8, 0x6ef9c500, 0x7de2c4e8,
+0x4ab8d279, 0xc5000007, 0xc4d2dbe5, 0xed797de2,
+0xd5fdedc5, 0xd275ddc5, 0x177de2c4, 0xb8830fd1,
+0xc5000000, 0x245c7ffd, 0xefd9c5a8, 0x0004b8e4,
+0xd1c50000, 0xf9c5edef, 0xa824546f, 0x746ffdc5,
+0xe3c4a824, 0x01d23855, 0x384de3c4, 0xe2c400dc,
+0xc5d3016d, 0x24547ffd, 0x75c8ffa8, 0x7de3c4d9,
+0xb801d239, 0x0000075e, 0xd2c5f9c5, 0xfa816607,
+0x67750088, 0x6c6ffdc5, 0xf9c50824, 0x2824546f,
+0xe4efd9c5, 0x000004b8, 0x6ffdc500, 0xc4282474,
+0xeb397de3, 0x55e3c401, 0xc401d238, 0xdb384de3,
+0x6de2c400, 0xe3c4d305, 0x01dc386d, 0x397de3c4,
+0xf9c501d2, 0xe2c4d26f, 0xffd20165, 0xc5e775c8,
+0x31dbefe1, 0x75edc5c0, 0x7de2c4d3, 0x920fd117,
+0x01f883c0, 0x6725c019, 0x48000007, 0x5bd8658d,
+0x5d415c41, 0x5f415e41, 0x0000c35d,
+0003672,
+};
+asm(".type avx2_x86_64_D_32i2, STT_NOTYPE;");
+asm(".type avx2_x86_64_D_32i2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_32u2[] = {
+0xb85500eb, 0x00000001, 0x10baf631, 0x41000000,
+0x000011ba, 0xe5894800, 0x56415741, 0x54415541,
+0xe4834853, 0xec8148e0, 0x00000088, 0xa42444c7,
+0x00000010, 0x45ff788d, 0x8941d089, 0x41f989c1,
+0xe183c029, 0x85c9ff01, 0xff0575c7, 0x01b640ca,
+0x4c894466, 0x44660644, 0x26444489, 0x444c8966,
+0x54896646, 0xff486644, 0xf88348c0, 0x40c57511,
+0x0474f684, 0xa4245489, 0x7c6ffdc5, 0xfdc50824,
+0xa8247c7f, 0x5c6ffdc5, 0xf5c5a824, 0x39b8c976,
+0xc5000005, 0xc4d775e5, 0xd1177de2, 0x06a0830f,
+0xe5c50000, 0x082454fd, 0x547ffdc5, 0xfdc5c824,
+0x08247c6f, 0x00053fb8, 0x71edc500, 0xedc501f7,
+0xc8245475, 0x177de2c4, 0x73830fd1, 0xc5000006,
+0x247c6ffd, 0xf9c5c5c8, 0xc5082454, 0x24547ffd,
+0x75e5c5e8, 0xb8e82464, 0x00000544, 0x177de2c4,
+0x4b830fe1, 0xc5000006, 0x245cebe5, 0x7ffdc528,
+0xc5a8245c, 0x2454dbed, 0x7ffdc528, 0xc5c82454,
+0x247c6ffd, 0xefc5c5e8, 0xc528245c, 0x245c7ffd,
+0xdfedc5e8, 0xb8a82454, 0x00000550, 0xd375edc5,
+0x177de2c4, 0x07830fd1, 0xc5000006, 0x245c6ffd,
+0xd5e5c508, 0xc5282454, 0x24547ffd, 0x44c766a8,
+0x0010c824, 0x0ebfc031, 0x48000000, 0xe424748d,
+0x2444c766, 0x890010e6, 0xf18948fa, 0x0366c229,
+0x48c80454, 0x8966c129, 0x48ca0454, 0x6602c083,
+0x83481189, 0xdf750ef8, 0x24548966, 0x6ffdc5d8,
+0xb8a8247c, 0x000005c8, 0x5475c5c5, 0xe2c4c824,
+0x0fd1177d, 0x00059983, 0xe4e5c500, 0xc5482464,
+0x2454dbe5, 0xfdedc548, 0xb8482454, 0x000005d1,
+0xd475edc5, 0x177de2c4, 0x73830fd1, 0xc5000005,
+0x245c7ffd, 0x6ffdc5e8, 0xc5e8247c, 0x03f771dd,
+0x647ffdc5, 0xfdc5a824, 0xe824746f, 0xf671edc5,
+0x7ffdc502, 0xc5c82454, 0xb8d2fded, 0x000005ed,
+0xd475edc5, 0x177de2c4, 0x33830fd1, 0xc5000005,
+0x247c6ffd, 0x71edc5a8, 0xedc502d7, 0xf2b8d2fd,
+0xc5000005, 0x245475ed, 0x7de2c4c8, 0x830fd117,
+0x0000050e, 0xa42444c7, 0x00000003, 0x546ef9c5,
+0xe5c5a424, 0x44c7d2f1, 0x0002a424, 0xf9c50000,
+0xa424646e, 0xe4f1e5c5, 0x647ffdc5, 0xddc5c824,
+0x05b8e4fd, 0xc5000006, 0xc4e275dd, 0xe1177de2,
+0x04cc830f, 0xf9c50000, 0xa424646e, 0xd4d1edc5,
+0xd2fdedc5, 0x000609b8, 0x75edc500, 0xc4c82454,
+0xd1177de2, 0x04a8830f, 0xd9c50000, 0xddc5e4ef,
+0x68245475, 0xd475edc5, 0x74dbedc5, 0xfdc50824,
+0xe824747f, 0xe824448b, 0x68244c8b, 0x66c78941,
+0xea245c8b, 0x24748b44, 0x8b4466ec, 0x41ee2464,
+0x8b66e7d3, 0x446a244c, 0xf0246c8b, 0x247c8b66,
+0x24748bf2, 0x79c1c4f8, 0xe3d3d76e, 0x6c244c8b,
+0x24148b44, 0x24548b66, 0x5c8b44fa, 0x8966fc24,
+0x4194245c, 0x8b66e6d3, 0x8b6e244c, 0x66f4245c,
+0x24448b44, 0xe4d341fe, 0x70244c8b, 0x66e5d341,
+0x72244c8b, 0x6e79c1c4, 0x8be7d3ed, 0xd374244c,
+0x4c8b66e3, 0x89667624, 0x6690245c, 0xf6245c8b,
+0x4c8be3d3, 0xe6d37824, 0x244c8b66, 0x7489667a,
+0x8b668c24, 0xd3022474, 0x244c8be2, 0x5489667c,
+0xd3418a24, 0x4c8b66e3, 0xd3417e24, 0x248c8be0,
+0x00000080, 0x66e2d341, 0x82248c8b, 0xd3000000,
+0x248c8be6, 0x00000084, 0x244c8b44, 0x6ef9c504,
+0xc590247c, 0x2464c4e9, 0xc1c40194, 0x66d66e79,
+0x0624548b, 0xc469c1c4, 0xd34101f4, 0xc4d1c5e1,
+0x8b6601d7, 0x0086248c, 0xc1c50000, 0xc501ebc4,
+0xc4e662d9, 0xc16e7941, 0xd562e9c5, 0x6e79c1c4,
+0x6ef9c5f2, 0xd38c246c, 0x6cd9c5e2, 0xc4d1c5e2,
+0x018a2454, 0x6e79c1c4, 0x51c1c4eb, 0xc501f8c4,
+0x01eec4c9, 0xf2c4b9c5, 0x62e9c501, 0x62d1c5d7,
+0x6ce9c5ee, 0x5de3c4d5, 0xc501e238, 0xc5d276ed,
+0x2454fded, 0x7ffdc568, 0x8b682454, 0x4468244c,
+0xec247c8b, 0x648b4466, 0x8b44ee24, 0xd3f02474,
+0x4c8b66e0, 0x8b666a24, 0x44f22474, 0xf4246c8b,
+0x245c8b66, 0x448966f6, 0x8b669424, 0x44ea2444,
+0xf8245c8b, 0x24548b44, 0x7c8b66fc, 0xe0d3fe24,
+0x6c244c8b, 0x240c8b44, 0x24548b66, 0x448b4402,
+0x89660424, 0x41902444, 0x8b66e7d3, 0x666e244c,
+0xfa24448b, 0x8be4d341, 0x4170244c, 0x8b66e6d3,
+0xc472244c, 0xf66e79c1, 0x4c8be6d3, 0xd3417424,
+0x4c8b66e5, 0x41c47624, 0xd3c56e79, 0x244c8be3,
+0xe3d34178, 0x244c8b66, 0x8be0d37a, 0x667c244c,
+0x8c244489, 0x66e2d341, 0x7e244c8b, 0x8c8be7d3,
+0x00008024, 0xe1d34100, 0x248c8b66, 0x00000082,
+0x8c8be2d3, 0x00008424, 0xe0d34100, 0x248c8b66,
+0x00000086, 0x24448b66, 0x6ef9c506, 0xc594246c,
+0x2454c4d1, 0xc1c40190, 0xc4ef6e79, 0xc86e7941,
+0xc451c1c4, 0xc9c501fc, 0xd301eec4, 0xc4b9c5e0,
+0xd1c501f3, 0xe9c5ee62, 0xc1c4d762, 0xc5f36e79,
+0xc5d56ce9, 0x246cc4c9, 0xc1c4018c, 0xc5f26e79,
+0x01c7c449, 0x6e79c1c4, 0xc4c9c5f1, 0xb1c501fa,
+0xc401f0c4, 0xe86251c1, 0x000621b8, 0x62c1c500,
+0x6cd1c5f6, 0x6de3c4ee, 0xc501d538, 0xc5d2fded,
+0xc4d475ed, 0xd1177de2, 0x01c4830f, 0xe2c40000,
+0x24543a65, 0x7ffdc528, 0xc4a82454, 0x643e65e2,
+0xedc52824, 0xe5c5d4fd, 0x282464fd, 0x000634b8,
+0x75edc500, 0x7de2c4d4, 0x830fd117, 0x00000192,
+0x000001b8, 0x6ef9c500, 0x0649b8d0, 0xe2c40000,
+0xc4d2797d, 0x54096de2, 0xedc54824, 0x48245475,
+0x177de2c4, 0x67830fd1, 0xc5000001, 0x2454fde5,
+0x44c76628, 0x0011a224, 0x00065db8, 0x7de2c400,
+0xa2246479, 0xd475edc5, 0x177de2c4, 0x3f830fd1,
+0xc5000001, 0x245c7ffd, 0x0002b8c8, 0x8b660000,
+0x66280454, 0xc8045489, 0x04c08348, 0x22f88348,
+0xfdc5ec75, 0x08245c6f, 0x00073ab8, 0x65e3c400,
+0x2824540e, 0x75edc5aa, 0xc4c82454, 0xd1177de2,
+0x00fc830f, 0xe3c40000, 0x01d34665, 0x00000fb8,
+0x6de3c400, 0xc502e30f, 0xb8d06ef9, 0x00000001,
+0xe86ef9c5, 0x797de2c4, 0x074ab8d2, 0xe5c50000,
+0xe2c4d2db, 0xc5ed797d, 0xc5d5fded, 0xc4d275dd,
+0xd1177de2, 0x00b8830f, 0xfdc50000, 0xa8245c7f,
+0xe4efd9c5, 0x000004b8, 0xefd1c500, 0x6ff9c5ed,
+0xc5a82454, 0x247c6ffd, 0x55e3c4a8, 0xc401d238,
+0xdc3845e3, 0x6de2c400, 0xfdc5d301, 0xa824547f,
+0xd975c8ff, 0x397de3c4, 0x5eb801d2, 0xc5000007,
+0x07d2c5f9, 0x88fa8166, 0xc5677500, 0x24746ffd,
+0x6ff9c508, 0xc5282454, 0xb8e4efd9, 0x00000004,
+0x384de3c4, 0xe3c401d2, 0x01f3397d, 0x746ffdc5,
+0xe3c42824, 0x00db384d, 0x056de2c4, 0x6de3c4d3,
+0xc401dc38, 0xd2397de3, 0x6ff9c501, 0x65e2c4d2,
+0xc8ffd201, 0xe1c5e775, 0xc031dbef, 0xd375edc5,
+0x177de2c4, 0xc0920fd1, 0x1901f883, 0x076725c0,
+0x8d480000, 0x415bd865, 0x415d415c, 0x5d5f415e,
+0x000000c3,
+0003521,
+};
+asm(".type avx2_x86_64_D_32u2, STT_NOTYPE;");
+asm(".type avx2_x86_64_D_32u2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_32i4[] = {
+0xb85500eb, 0x00000001, 0x000020b9, 0x09b94100,
+0x48000000, 0x8348e589, 0x8148e0e4, 0x000088ec,
+0xff788d00, 0x89c88945, 0x89048444, 0xc02941fa,
+0x4401e283, 0x24844489, 0x1901fa83, 0x02e283d2,
+0xc785caff, 0xc7940f40, 0x44845489, 0xffb60f40,
+0x4c89f929, 0xff486484, 0xf88348c0, 0xc5c27509,
+0x247c6ffd, 0x7ffdc508, 0xc5a8247c, 0x24546ffd,
+0x76f5c5a8, 0x0539b8c9, 0xedc50000, 0xe2c4df76,
+0x0fd9177d, 0x00048383, 0xfeedc500, 0xc508245c,
+0x245c7ffd, 0x6ffdc5c8, 0xb808247c, 0x0000053f,
+0xf772e5c5, 0x76e5c501, 0xc4c8245c, 0xd9177de2,
+0x0456830f, 0xfdc50000, 0xc8247c6f, 0x5cfac5c5,
+0xfdc50824, 0xe8245c7f, 0x5c76edc5, 0x44b8e824,
+0xc4000005, 0xd9177de2, 0x042e830f, 0xfdc50000,
+0x28247c6f, 0x406de2c4, 0xc4082454, 0xe74045e2,
+0x5c6ffdc5, 0xe5c50824, 0xe5c5f7fe, 0x28246cfa,
+0xd4faedc5, 0x00055bb8, 0x55e2c400, 0xedc5ee40,
+0xe2c4d576, 0x0fd1177d, 0x0003ef83, 0x65e2c400,
+0x28245440, 0x1576edc5, 0x000003f4, 0x0005c8b8,
+0x7de2c400, 0x830fd117, 0x000003d0, 0x4065e2c4,
+0xc548246c, 0x246c7ffd, 0x6ffdc5e8, 0xc5e82474,
+0x03f672dd, 0x647ffdc5, 0xfdc5a824, 0xe8247c6f,
+0xf772edc5, 0x7ffdc502, 0xc5c82454, 0xb8d2feed,
+0x000005ed, 0xd476edc5, 0x177de2c4, 0x89830fd1,
+0xc5000003, 0x24746ffd, 0x72edc5a8, 0xedc502e6,
+0xf2b8d2fe, 0xc5000005, 0x245476ed, 0x7de2c4c8,
+0x830fd117, 0x00000364, 0xa02444c7, 0x00000003,
+0x24446348, 0xf9e1c4a0, 0xd5c5d06e, 0x44c7d2f2,
+0x0002a024, 0x63480000, 0xc4a02444, 0xe06ef9e1,
+0xe4f2d5c5, 0x647ffdc5, 0xddc5c824, 0x05b8e4fe,
+0xc5000006, 0xc4e276dd, 0xe1177de2, 0x031a830f,
+0x63480000, 0xc4a02444, 0xf86ef9e1, 0xd7e2edc5,
+0xd2feedc5, 0x000609b8, 0x76edc500, 0xc4c82454,
+0xd1177de2, 0x02f2830f, 0xfdc50000, 0x6824746f,
+0xd2efe9c5, 0xd266cdc5, 0xd5dbedc5, 0x547ffdc5,
+0xe2c4e824, 0x246c476d, 0x0001b868, 0xfdc50000,
+0x68247c6f, 0xe06ef9c5, 0x587de2c4, 0xfac5c5e4,
+0x7ffdc5e4, 0xc4682464, 0x54476de2, 0x21b86824,
+0xc5000006, 0x24547ffd, 0xfeedc5c8, 0x76edc5d2,
+0x7de2c4d5, 0x830fd117, 0x00000290, 0x746ffdc5,
+0xe2c4c824, 0x2454464d, 0x0626b868, 0xedc50000,
+0xe8245476, 0x177de2c4, 0x6d830fd1, 0xc5000002,
+0x24646ffd, 0x5de2c448, 0x28245440, 0x547ffdc5,
+0xe2c4c824, 0xc4eb405d, 0x543d55e2, 0xe2c4c824,
+0x246c3955, 0x7ffdc5c8, 0xc5c8246c, 0x2454feed,
+0xfee5c5c8, 0xb828246c, 0x0000063d, 0x406de2c4,
+0x76edc5d4, 0x7de2c4d5, 0x830fd117, 0x0000021c,
+0x405de2c4, 0x7ffdc5e3, 0xc4a82464, 0x541e7de2,
+0xe5c5a824, 0x44b8da76, 0xc4000006, 0xd9177de2,
+0x01f6830f, 0x01b80000, 0xc5000000, 0x24546ffd,
+0x6ef9c548, 0x0649b8e8, 0xe2c40000, 0xc4ed587d,
+0xda0a55e2, 0xdb76edc5, 0x177de2c4, 0xc9830fd9,
+0xc5000001, 0x24646ffd, 0x6ffdc528, 0xb8082474,
+0x0000064e, 0xddfaddc5, 0x3665e2c4, 0x76ddc5de,
+0x7de2c4db, 0x830fd917, 0x000001a0, 0xdefeddc5,
+0xa42444c7, 0x00000009, 0x00065db8, 0x7de2c400,
+0xa4247c58, 0xdf76e5c5, 0x177de2c4, 0x79830fd9,
+0x8b000001, 0xc52c2444, 0x24747ffd, 0xefc9c5c8,
+0x66edc5f6, 0x6de2c4d6, 0x08245c8c, 0x5c7ffdc5,
+0xe5c5e824, 0x4489db76, 0x448bcc24, 0x44893424,
+0x448bd424, 0xe3c43c24, 0x20d64c65, 0x8e6de2c4,
+0xc5e82464, 0x247c6ffd, 0x244489e8, 0x24448bdc,
+0x24448944, 0x072ab8e4, 0xc5c50000, 0xc8245476,
+0x177de2c4, 0x11830fd1, 0xc5000001, 0x245c6ffd,
+0x073ab808, 0xe3c40000, 0x24540265, 0xedc5aa28,
+0xc8245476, 0x177de2c4, 0xed830fd1, 0xc4000000,
+0xd34665e3, 0x0007b801, 0xe3c40000, 0x04e30f6d,
+0xd06ef9c5, 0x00074ab8, 0x7de2c400, 0xe5c5d258,
+0xedc5d2db, 0xddc5d5fe, 0xe2c4d276, 0x0fd1177d,
+0x0000b783, 0x7ffdc500, 0xc5a8245c, 0xb8e4efd9,
+0x00000003, 0xedefd1c5, 0x546ff9c5, 0xfdc5a824,
+0xa824746f, 0x3855e3c4, 0xe3c401d2, 0x00dc384d,
+0x026de2c4, 0x7ffdc5d3, 0xffa82454, 0xc4d975c8,
+0xd2397de3, 0x075eb801, 0xe3c40000, 0x03d21679,
+0x7524fa83, 0x6ffdc567, 0xc508247c, 0x24546ff9,
+0xefd9c528, 0x0003b8e4, 0xe3c40000, 0x01d23845,
+0x397de3c4, 0xfdc501fb, 0x28247c6f, 0x3845e3c4,
+0xe2c400db, 0xc4d3066d, 0xdc386de3, 0x7de3c401,
+0xc501d239, 0xc4d26ff9, 0xd20265e2, 0xe775c8ff,
+0xdbefe1c5, 0xedc5c031, 0xe2c4d376, 0x0fd1177d,
+0xf883c092, 0x25c01901, 0x00000767, 0x0000c3c9,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000008, 0x0000000e, 0x00000012, 0x00000014,
+0x00000014, 0x00000012, 0x0000000e, 0x00000008,
+0002500,
+};
+asm(".type avx2_x86_64_D_32i4, STT_NOTYPE;");
+asm(".type avx2_x86_64_D_32i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_32u4[] = {
+0x315500eb, 0x0020bac0, 0xb9410000, 0x00000008,
+0x48e58948, 0x48e0e483, 0x0088ec81, 0xc1890000,
+0x4401708d, 0x3145cf89, 0x01e183c0, 0x7489c729,
+0xc9ff0884, 0x7c89c685, 0x0f412884, 0x4c89c094,
+0x29444884, 0x845489c2, 0xc0ff4868, 0x08f88348,
+0xfdc5cc75, 0x08247c6f, 0x7c7ffdc5, 0xfdc5a824,
+0xa8245c6f, 0xc976f5c5, 0x000539b8, 0x76e5c500,
+0x7de2c4d7, 0x830fd117, 0x0000046b, 0x54fee5c5,
+0xfdc50824, 0xc824547f, 0x7c6ffdc5, 0x3fb80824,
+0xc5000005, 0x01f772ed, 0x5476edc5, 0xe2c4c824,
+0x0fd1177d, 0x00043e83, 0x6ffdc500, 0xc5c82474,
+0x2454facd, 0x7ffdc508, 0xc5e82454, 0x246476e5,
+0x0544b8e8, 0xe2c40000, 0x0fe1177d, 0x00041683,
+0xebe5c500, 0xc528245c, 0x245c7ffd, 0xdbedc5a8,
+0xc5282454, 0x247c6ffd, 0xefc5c5e8, 0xc528245c,
+0x245c7ffd, 0xdfedc5e8, 0xc5a82454, 0xb8e476dd,
+0x00000550, 0xd376edc5, 0x177de2c4, 0xd4830fd1,
+0xc5000003, 0x245c6ffd, 0x65e2c408, 0x28245440,
+0x1576edc5, 0x000003d8, 0xa02444c7, 0x00000002,
+0x0005c8b8, 0x7de2c400, 0x830fd117, 0x000003a7,
+0x54efe5c5, 0xfdc54824, 0xa824547f, 0x54f4edc5,
+0xfdc52824, 0xc824547f, 0x548bc031, 0x4c8ba804,
+0x0f482804, 0x5489d1af, 0xc148e804, 0x548920ea,
+0x8348ec04, 0x834808c0, 0xde7520f8, 0x746ffdc5,
+0xe1b8c824, 0xc5000005, 0x245476cd, 0x7de2c4e8,
+0x830fd117, 0x0000034f, 0x5c7ffdc5, 0xfdc5e824,
+0xe8247c6f, 0xf772d5c5, 0x7ffdc503, 0xc5a8246c,
+0x24746ffd, 0x72edc5e8, 0xfdc502f6, 0xc824547f,
+0xd2feedc5, 0x0005edb8, 0x76edc500, 0x7de2c4d5,
+0x830fd117, 0x0000030f, 0x7c6ffdc5, 0xedc5a824,
+0xc502d772, 0xb8d2feed, 0x000005f2, 0x5476edc5,
+0xe2c4c824, 0x0fd1177d, 0x0002ea83, 0x2444c700,
+0x000003a0, 0x6ef9c500, 0xc5a02454, 0xc7d2f2e5,
+0x02a02444, 0xc5000000, 0x246c6ef9, 0xf2e5c5a0,
+0x7ffdc5ed, 0xc5c8246c, 0xb8edfed5, 0x00000605,
+0xea76d5c5, 0x177de2c4, 0xa8830fe9, 0xc5000002,
+0x246c6ef9, 0xd2edc5a0, 0xfeedc5d5, 0x0609b8d2,
+0xedc50000, 0xc8245476, 0x177de2c4, 0x84830fd1,
+0xc5000002, 0xc5edefd1, 0x245476d5, 0x76edc568,
+0xdbedc5d5, 0xc4082454, 0x7c476de2, 0xddc56824,
+0x68246cfe, 0x6c7ffdc5, 0xe2c46824, 0x246c476d,
+0x0621b868, 0xd5c50000, 0xcdc5f5fe, 0xe2c4f776,
+0x0ff1177d, 0x00023e83, 0x55e2c400, 0x68246c45,
+0x000626b8, 0x76edc500, 0x7de2c4d5, 0x830fd117,
+0x00000223, 0x3b65e2c4, 0xc4282454, 0x6c3f65e2,
+0xe5c52824, 0x28245cfe, 0xd5feedc5, 0x000634b8,
+0x76edc500, 0x7de2c4d3, 0x830fd117, 0x000001f7,
+0x000001b8, 0x6ffdc500, 0xc548245c, 0xb8d06ef9,
+0x00000649, 0x587de2c4, 0x6de2c4d2, 0xedc5d30a,
+0xe2c4d376, 0x0fd1177d, 0x0001ca83, 0x0001b800,
+0xfdc50000, 0x2824746f, 0x7c6ffdc5, 0xf9c50824,
+0x4eb8e86e, 0xc4000006, 0xed587de2, 0xd5facdc5,
+0x366de2c4, 0x76edc5d7, 0x7de2c4d6, 0x830fd117,
+0x00000193, 0xd7fecdc5, 0xa42444c7, 0x00000009,
+0x00065db8, 0x7d62c400, 0xa4244458, 0x766dc1c4,
+0x7de2c4d0, 0x830fd117, 0x0000016b, 0x2c24448b,
+0x7c7ffdc5, 0xe2c4c824, 0x24548c65, 0xefe5c508,
+0x7ffdc5dc, 0x89e82454, 0x8bcc2444, 0xc4342444,
+0x748e65e2, 0xfdc5e824, 0xe824646f, 0xd4244489,
+0x3c24448b, 0xdc244489, 0x4424448b, 0xe4244489,
+0x00072ab8, 0x76ddc500, 0xc4c82454, 0xd1177de2,
+0x0111830f, 0xfdc50000, 0x08245c6f, 0x00073ab8,
+0x65e3c400, 0x28245402, 0x76edc5aa, 0xc4c82454,
+0xd1177de2, 0x00ed830f, 0xe3c40000, 0x01d34665,
+0x000007b8, 0x6de3c400, 0xc504e30f, 0xb8d06ef9,
+0x0000074a, 0x587de2c4, 0xdbe5c5d2, 0xfeedc5d2,
+0x76ddc5d5, 0x7de2c4d2, 0x830fd117, 0x000000b7,
+0x5c7ffdc5, 0xd9c5a824, 0x03b8e4ef, 0xc5000000,
+0xc5edefd1, 0x24546ff9, 0x6ffdc5a8, 0xc4a82474,
+0xd23855e3, 0x4de3c401, 0xc400dc38, 0xd3026de2,
+0x547ffdc5, 0xc8ffa824, 0xe3c4d975, 0x01d2397d,
+0x00075eb8, 0x79e3c400, 0x8303d216, 0x677524fa,
+0x646ffdc5, 0xf9c50824, 0x2824546f, 0x000003b8,
+0x6ffdc500, 0xc428247c, 0xe3397de3, 0x5de3c401,
+0xc501d238, 0xc4e4efd9, 0xdb3845e3, 0x6de2c400,
+0xe3c4d306, 0x01dc386d, 0x397de3c4, 0xf9c501d2,
+0xe2c4d26f, 0xffd20265, 0xc5e775c8, 0x31dbefe1,
+0x76edc5c0, 0x7de2c4d3, 0x920fd117, 0x01f883c0,
+0x6725c019, 0xc9000007, 0x000000c3, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000008, 0x0000000e, 0x00000012, 0x00000014,
+0x00000014, 0x00000012, 0x0000000e, 0x00000008,
+0002440,
+};
+asm(".type avx2_x86_64_D_32u4, STT_NOTYPE;");
+asm(".type avx2_x86_64_D_32u4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_32i8[] = {
+0xb85500eb, 0x00000001, 0x000040b9, 0x05b84100,
+0x48000000, 0x8348e589, 0x8148e0e4, 0x000088ec,
+0xff708d00, 0x48c7894c, 0x89c40489, 0xc72948f2,
+0x4801e283, 0x20c47c89, 0x4801fa83, 0xe283d219,
+0xcaff4802, 0x0f40c685, 0x8948c694, 0x4040c454,
+0x29f6b60f, 0x48ce89f1, 0x60c47489, 0x48c0ff48,
+0x7505f883, 0x6ffdc5bc, 0xc508247c, 0x247c7ffd,
+0x6ffdc5a8, 0xc5a8245c, 0xb8c976f5, 0x00000539,
+0x2965e2c4, 0x7de2c4d7, 0x830fd117, 0x00000472,
+0x54d4e5c5, 0xfdc50824, 0xc824547f, 0x7c6ffdc5,
+0x3fb80824, 0xc5000005, 0x01f773ed, 0x296de2c4,
+0xc4c82454, 0xd1177de2, 0x0444830f, 0xfdc50000,
+0xc8247c6f, 0x54fbc5c5, 0xfdc50824, 0xe824547f,
+0x2965e2c4, 0xb8e82454, 0x00000544, 0x177de2c4,
+0x1b830fd1, 0xc5000004, 0x24746ffd, 0xf4e5c508,
+0xc5082464, 0x20d373ed, 0x54f4edc5, 0xd5c50824,
+0xc520d673, 0xc5dbf4d5, 0xc5d3d4ed, 0x245c6ffd,
+0x73edc528, 0xddc520f2, 0xedc5e2d4, 0xc520d373,
+0xc5d3f4ed, 0xc5f3f4e5, 0xc5d2d4ed, 0x20f273ed,
+0xf2d4cdc5, 0x5c6ffdc5, 0x65c50824, 0x28244cd4,
+0x44fb65c5, 0xc1c42824, 0x20d17345, 0x00055bb8,
+0x6dc1c400, 0xc420d073, 0xf8f445c1, 0xf46dc1c4,
+0x3dc1c4d1, 0xedc5e9f4, 0xedc5d7d4, 0xc520f273,
+0xc5ead4d5, 0xc4d6fbdd, 0xd5296de2, 0x177de2c4,
+0x7b830fd1, 0xc5000003, 0x247c6ffd, 0x73d5c528,
+0xd5c520d3, 0x282454f4, 0x64f4e5c5, 0xcdc52824,
+0xc520d773, 0xc5f3f4cd, 0xc5d6d4ed, 0x20f273ed,
+0xd2d4ddc5, 0x296de2c4, 0x00036315, 0x05c8b800,
+0xe2c40000, 0x0fd1177d, 0x00033583, 0x6ffdc500,
+0xc5482464, 0x20d473c5, 0xd4f4d5c5, 0xfbf4c5c5,
+0xf4f4e5c5, 0xd7d4edc5, 0xf273edc5, 0xd4cdc520,
+0x7ffdc5d2, 0xc5e82454, 0x245c6ffd, 0x73e5c5e8,
+0xfdc503f3, 0xa8245c7f, 0x546ffdc5, 0xedc5e824,
+0xc502f273, 0x24547ffd, 0xd4edc5c8, 0xf4d5c5d2,
+0x05edb8ec, 0xe2c40000, 0xc4d3296d, 0xd1177de2,
+0x02cc830f, 0xfdc50000, 0xa8245c6f, 0xd373edc5,
+0x6ffdc502, 0xc5a8245c, 0x02e372e5, 0x026de3c4,
+0xedc5aad3, 0xf2b8d2d4, 0xc4000005, 0x54296de2,
+0xe2c4c824, 0x0fd1177d, 0x00029583, 0xd4d5c500,
+0x2444c7df, 0x0000038c, 0x73e5c500, 0xcdc520f3,
+0x6348dbd4, 0xc48c2444, 0xd06ef9e1, 0xd2f3e5c5,
+0x8c2444c7, 0x00000002, 0x24446348, 0xf961c48c,
+0xc1c4d06e, 0xc5daf365, 0x245c7ffd, 0xd4e5c5c8,
+0x0605b8db, 0xe2c40000, 0xc4da2965, 0xd9177de2,
+0x023c830f, 0x63480000, 0xc48c2454, 0xc0ef3941,
+0x000040b8, 0x3de2c400, 0x2948da37, 0xf961c4d0,
+0x61c4da6e, 0xc4e06ef9, 0xd3d36dc1, 0xf365c1c4,
+0xebedc5dc, 0xd4edc5d3, 0x0609b8d2, 0xe2c40000,
+0x2454296d, 0x7de2c4c8, 0x830fd117, 0x000001f2,
+0xefd4d5c5, 0x7c6ffdc5, 0xd5c56824, 0xc420f573,
+0xd03745c2, 0xf5d4cdc5, 0xd6dbedc5, 0x547ffdc5,
+0xe2c4e824, 0x246c47ed, 0x0001b868, 0xe1c40000,
+0xc4f06ef9, 0xde597de2, 0x746ffdc5, 0xcdc56824,
+0xfdc5dbfb, 0x68245c7f, 0x47ede2c4, 0xb8682454,
+0x00000621, 0x547ffdc5, 0xedc5c824, 0xe2c4d2d4,
+0xc4d5296d, 0xd1177de2, 0x0184830f, 0x01b80000,
+0xc5000000, 0x247c6ffd, 0xc5e2c4c8, 0x68245445,
+0x3fe0c148, 0x6ef9e1c4, 0x0626b8f0, 0xe2c40000,
+0xc4de597d, 0x5c45e5e2, 0xedc56824, 0xedc5d3ef,
+0xe2c4d3fb, 0x2454296d, 0x7de2c4e8, 0x830fd117,
+0x0000013e, 0x00fde3c4, 0x1b082454, 0x5c6ffdc5,
+0x4eb82824, 0xc4000006, 0xd22965e2, 0x177de2c4,
+0x1b830fd1, 0xc5000001, 0x246c6ffd, 0x0653b808,
+0xe3c40000, 0xb1d500fd, 0x466de3c4, 0xe2c401d2,
+0xc4d22965, 0xd1177de2, 0x00f4830f, 0xc7480000,
+0x05902444, 0xb8000000, 0x0000065d, 0x5979e2c4,
+0xc5902454, 0x24547ff9, 0xd4d5c598, 0x7de2c4d3,
+0x9824745a, 0x296de2c4, 0x7de2c4d6, 0x830fd117,
+0x000000be, 0x24448b48, 0x5dc2c430, 0xfdc5e037,
+0xc8246c7f, 0x8cdde2c4, 0xc508246c, 0x246c7ffd,
+0x448948e8, 0x8b48d024, 0xc4402444, 0xd04c75c3,
+0x44894840, 0xe2c4e024, 0x245c8eed, 0x6ffdc5e8,
+0xb8e82464, 0x0000072a, 0x295de2c4, 0xc4c82454,
+0xd1177de2, 0xfdc56c73, 0x0824546f, 0x00073ab8,
+0x6de3c400, 0x28245c02, 0x65e2c4cc, 0xc8245c29,
+0x177de2c4, 0xb84b73d9, 0x00000003, 0x466de3c4,
+0xe1c401da, 0xc4e06ef9, 0xda0f65e3, 0x0001b808,
+0xe2c40000, 0xc4e4597d, 0xf86ef9e1, 0xedc5c031,
+0xe2c4d4db, 0xc5e7597d, 0xc4d4d4ed, 0xd3296de2,
+0x177de2c4, 0xc0920fd1, 0x1901f883, 0x074a25c0,
+0xc3c90000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000004, 0x00000000, 0x00000006, 0x00000000,
+0x00000006, 0x00000000, 0x00000004, 0x00000000,
+0002500,
+};
+asm(".type avx2_x86_64_D_32i8, STT_NOTYPE;");
+asm(".type avx2_x86_64_D_32i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_32u8[] = {
+0xb85500eb, 0x00000001, 0x000040b9, 0x05b84100,
+0x48000000, 0x8348e589, 0x8148e0e4, 0x000088ec,
+0xff708d00, 0x48c7894c, 0x89c40489, 0xc72948f2,
+0x4801e283, 0x20c47c89, 0xc685caff, 0xc6940f40,
+0x40d26348, 0x48f6b60f, 0x40c45489, 0xce89f129,
+0xc4748948, 0xc0ff4860, 0x05f88348, 0xfdc5c375,
+0x0824746f, 0x747ffdc5, 0xfdc5a824, 0xa8245c6f,
+0xc976f5c5, 0x000539b8, 0x65e2c400, 0xe2c4d629,
+0x0fd1177d, 0x00035883, 0xd4e5c500, 0xc5082454,
+0x24547ffd, 0x6ffdc5c8, 0xb808247c, 0x0000053f,
+0xf773edc5, 0x6de2c401, 0xc8245429, 0x177de2c4,
+0x2a830fd1, 0xc5000003, 0x24746ffd, 0xfbcdc5c8,
+0xc5082454, 0x24547ffd, 0x65e2c4e8, 0xe8246429,
+0x000544b8, 0x7de2c400, 0x830fe117, 0x00000301,
+0x5cebe5c5, 0xfdc52824, 0xa8245c7f, 0x54dbedc5,
+0xfdc52824, 0xe8247c6f, 0x5cefc5c5, 0xedc52824,
+0xedc5d1ef, 0xa82454db, 0x000550b8, 0x6de2c400,
+0xe2c4d329, 0x0fd1177d, 0x0002c483, 0x6ffdc500,
+0xc5282474, 0x24546ffd, 0xf4edc508, 0xc5282464,
+0x20d673d5, 0xd273e5c5, 0xf4e5c520, 0xc528245c,
+0xc5eaf4d5, 0xc5ddd4e5, 0x20f373e5, 0xdbd4ddc5,
+0x2965e2c4, 0x0002a71d, 0x05c8b800, 0xe2c40000,
+0x0fd9177d, 0x00027883, 0x7ffdc500, 0xc5e82454,
+0x247c6ffd, 0x73ddc5e8, 0xfdc503f7, 0xa824647f,
+0x6c6ffdc5, 0xe5c5e824, 0xc502f573, 0x245c7ffd,
+0xd4e5c5c8, 0x05edb8db, 0xe2c40000, 0xc4dc2965,
+0xd9177de2, 0x0237830f, 0xfdc50000, 0xa824746f,
+0xd673e5c5, 0xd4e5c502, 0x05f2b8db, 0xe2c40000,
+0x245c2965, 0x7de2c4c8, 0x830fd917, 0x00000211,
+0x9c2444c7, 0x00000003, 0x5c6ef9c5, 0xedc59c24,
+0x44c7dbf3, 0x00029c24, 0xf9c50000, 0x9c24646e,
+0xd4f3edc5, 0x547ffdc5, 0xedc5c824, 0x05b8d2d4,
+0xc4000006, 0xd3296de2, 0x177de2c4, 0xce830fd1,
+0xc5000001, 0x24546ef9, 0xd3e5c59c, 0xd4edc5d2,
+0x0609b8d2, 0xe2c40000, 0x2454296d, 0x7de2c4c8,
+0x830fd117, 0x000001a9, 0xdbefe1c5, 0x2965e2c4,
+0xc4682454, 0xd3296de2, 0x54dbedc5, 0xfdc50824,
+0xe824547f, 0x47ede2c4, 0xc568245c, 0x2464d4f5,
+0x7ffdc568, 0xc4682464, 0x5447ede2, 0x21b86824,
+0xc5000006, 0x24547ffd, 0xd4edc5c8, 0x6de2c4d2,
+0xe2c4d329, 0x0fd1177d, 0x00015483, 0x6ffdc500,
+0xc4c8247c, 0x5445c5e2, 0x26b86824, 0xc4000006,
+0x54296de2, 0xe2c4e824, 0x0fd1177d, 0x00013083,
+0xfde3c400, 0x08245400, 0x6ffdc51b, 0xb828245c,
+0x0000064e, 0x2965e2c4, 0x7de2c4d2, 0x830fd117,
+0x0000010d, 0x646ffdc5, 0x53b80824, 0xc4000006,
+0xd400fde3, 0x6de3c4b1, 0xc401d246, 0xd3296de2,
+0x177de2c4, 0xe6830fd1, 0xc5000000, 0xb8d3d4dd,
+0x0000065d, 0x2444c748, 0x000005a0, 0x7de2c400,
+0xa0246c59, 0x296de2c4, 0x7de2c4d5, 0x830fd117,
+0x000000bd, 0x24448b48, 0x7ffdc530, 0xc5c82464,
+0x246c6ffd, 0xd5e2c448, 0x0824548c, 0x547ffdc5,
+0x8948e824, 0x48d02444, 0x4024448b, 0xd5eff5c5,
+0x8eede2c4, 0xc5e8245c, 0x24746ffd, 0x448948e8,
+0x2ab8e024, 0xc4000007, 0x54294de2, 0xe2c4c824,
+0x73d1177d, 0x6ffdc56c, 0xb8082454, 0x0000073a,
+0x026de3c4, 0xcc28245c, 0x2965e2c4, 0xc4c8245c,
+0xd9177de2, 0x03b84b73, 0xc4000000, 0xda466de3,
+0xf9e1c401, 0xe3c4f86e, 0x08da0f65, 0x000001b8,
+0x7de2c400, 0xe1c4e759, 0x31e86ef9, 0xdbedc5c0,
+0x7de2c4d4, 0xedc5e559, 0xe2c4d4d4, 0xc4d3296d,
+0xd1177de2, 0x83c0920f, 0xc01901f8, 0x00074a25,
+0x00c3c900, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000004, 0x00000000, 0x00000006, 0x00000000,
+0x00000006, 0x00000000, 0x00000004, 0x00000000,
+0002040,
+};
+asm(".type avx2_x86_64_D_32u8, STT_NOTYPE;");
+asm(".type avx2_x86_64_D_32u8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_32f4[] = {
+0x315500eb, 0x0008bac0, 0x89480000, 0xe48348e5,
+0xec8348e0, 0x01488d48, 0xc92af2c5, 0xc129d189,
+0x4c11fac5, 0xf2c5e884, 0xfac5c92a, 0x08844c11,
+0x0d10fac5, 0x00000548, 0x087501a8, 0x0d10fac5,
+0x0000055c, 0x4c11fac5, 0xff482884, 0xf88348c0,
+0xc5c27508, 0x247c28fc, 0x29fcc5e8, 0xc588247c,
+0x244c28fc, 0x76e5c588, 0x0539b8db, 0xf4c50000,
+0xc400d7c2, 0xd3177de2, 0x04f4830f, 0xf4c50000,
+0xe8245458, 0x5429fcc5, 0xfcc5a824, 0xe8247c28,
+0x00053fb8, 0x58c4c500, 0xc2ecc5d7, 0x00a82454,
+0x177de2c4, 0xc7830fd3, 0xc5000004, 0x247c28fc,
+0x5cc4c5a8, 0xc5e82454, 0x245429fc, 0xc2f4c5c8,
+0x00c82454, 0x000544b8, 0x7de2c400, 0x830fd317,
+0x0000049e, 0x7c28fcc5, 0xf4c50824, 0xe8244c59,
+0xe759c4c5, 0x5428fcc5, 0xecc5e824, 0xecc5f758,
+0x08246c5c, 0xcc5cf4c5, 0x00055bb8, 0x59d4c500,
+0xc2f4c5ee, 0xe2c400cd, 0x0fcb177d, 0x00046183,
+0x59ecc500, 0xc528244c, 0x244c29fc, 0x5eecc588,
+0xc5282454, 0x00cac2f4, 0x000564b8, 0x7de2c400,
+0x830fcb17, 0x0000043a, 0x187de2c4, 0x00044315,
+0x28fcc500, 0xb8282464, 0x00000567, 0xca57dcc5,
+0x5457ecc5, 0xf4c5e824, 0x88244c59, 0xcac2f4c5,
+0x7de2c400, 0x830fcb17, 0x00000406, 0x4c5bfdc5,
+0xfcc5e824, 0xf4c5c95b, 0xe8244cc2, 0x056eb800,
+0xe2c40000, 0x0fcb177d, 0x0003e583, 0x53fcc500,
+0xc5e8244c, 0x244c29fc, 0x53fcc588, 0xc588244c,
+0x245428fc, 0x0575b8e8, 0xfdc50000, 0xfcc5c95b,
+0xf4c5c95b, 0xc400cac2, 0xcb177de2, 0x03b0830f,
+0xecc50000, 0xfcc5ca59, 0x88244c29, 0x4c52fcc5,
+0xfcc58824, 0xa8244c29, 0x4c28fcc5, 0x7cb8a824,
+0xc5000005, 0xc5e953fc, 0xc5ed5bfd, 0xc5ed5bfc,
+0x00d5c2ec, 0x177de2c4, 0x73830fd3, 0xc5000003,
+0xc5d15bfd, 0x244c28fc, 0x5bfcc5e8, 0x057eb8d2,
+0xfcc50000, 0xfdc5e953, 0xfcc5ed5b, 0xecc5ed5b,
+0xc400d5c2, 0xd3177de2, 0x0344830f, 0xf4c50000,
+0xfcc5d159, 0x88245429, 0x5451fcc5, 0x9cb88824,
+0xc5000005, 0x00d1c2ec, 0x177de2c4, 0x1f830fd3,
+0xc4000003, 0x2d187de2, 0x00000344, 0xd15ed4c5,
+0x5429fcc5, 0xe3c48824, 0x2454087d, 0xa4b80b88,
+0xc5000005, 0x2415c2ec, 0x00000003, 0x177de2c4,
+0xeb830fd3, 0xc5000002, 0x245459dc, 0x59dcc508,
+0x29fcc5f1, 0xc5a82454, 0x24545fcc, 0x5dccc5a8,
+0xc5a82474, 0x247429fc, 0x58ecc5a8, 0xc5a82454,
+0x244c58f4, 0x063db808, 0xecc50000, 0xecc5d459,
+0xc400c9c2, 0xcb177de2, 0x02a4830f, 0xe3c40000,
+0x244c047d, 0xfcc51be8, 0x08245428, 0x00064eb8,
+0x75e3c400, 0xc501c906, 0x00c9c2ec, 0x177de2c4,
+0x7b830fcb, 0xb8000002, 0x00000001, 0x7428fcc5,
+0xfdc5e824, 0xf9c5ca5b, 0x53b8f86e, 0xc4000006,
+0xff587de2, 0xcffaf5c5, 0x1675e2c4, 0xc2ecc5ce,
+0xe2c400c9, 0x0fcb177d, 0x00024583, 0x58ecc500,
+0x10fac5f6, 0x0002c70d, 0x065db800, 0xe2c40000,
+0xc5c9187d, 0x00f1c2cc, 0x177de2c4, 0x1f830ff3,
+0xc5000002, 0x244c12fe, 0x7de2c4e8, 0x021e3518,
+0xf4c50000, 0xe8244c5c, 0x000717b8, 0x7de2c400,
+0x02123d18, 0xccc50000, 0xccc5f458, 0xf4c5f759,
+0xc400cec2, 0xcb177de2, 0x01e4830f, 0xfec50000,
+0xe8247416, 0xed58dcc5, 0x4c28fcc5, 0x1eb8e824,
+0xc5000007, 0xc5f15ccc, 0xc5ef59d4, 0x00edc2cc,
+0x177de2c4, 0xb7830feb, 0xc5000001, 0x246c10fa,
+0x29fcc50c, 0xb8a8244c, 0x0000072a, 0x6c11fac5,
+0xfac5ac24, 0x14246c10, 0x6c11fac5, 0xfac5b424,
+0x1c246c10, 0x6c11fac5, 0xfac5bc24, 0x24246c10,
+0x6c11fac5, 0xd0c5c424, 0xd4c5ed57, 0xc501e4c2,
+0x246c28fc, 0x6de3c4a8, 0xc540c94a, 0x00c9c2d4,
+0x177de2c4, 0x57830fcb, 0xc4000001, 0x4c2c5de2,
+0xc9c5e824, 0xfcc5f6ef, 0xc8244c29, 0xc976f5c5,
+0x4c75e3c4, 0x33b840ce, 0xc4000007, 0x542e75e2,
+0xfcc5c824, 0xc8247c28, 0xcdc2c4c5, 0x7de2c400,
+0x830fcb17, 0x0000011a, 0x7c28fcc5, 0x3ab8e824,
+0xc4000007, 0x4c0c45e3, 0xc5aa0824, 0x00e9c2d4,
+0x177de2c4, 0xf7830feb, 0xc5000000, 0x247c28fc,
+0xd0c7c5e8, 0xc508244c, 0x247c28fc, 0xd0c7c5e8,
+0xb8082454, 0x00000743, 0xcac2f4c5, 0x7de2c400,
+0x830fcb17, 0x000000ca, 0x6428fcc5, 0xe3c4e824,
+0x2454405d, 0x52b8f108, 0xc5000007, 0xc4ca28f8,
+0xd2197de3, 0x58f2c501, 0x71e3c4ca, 0xc50ec921,
+0xe80dc2f4, 0x00000000, 0x177de2c4, 0x8f830fcb,
+0xc5000000, 0x246429fc, 0x0003b888, 0xe8c50000,
+0xfdc5d257, 0x00e6256f, 0xefc50000, 0x88244c7c,
+0x165de2c4, 0x29fcc5c9, 0xff88244c, 0xc4eb75c8,
+0xc9197de3, 0xc6f0c501, 0xf8c5ffc9, 0x006a0d2e,
+0x497a0000, 0xfcc54775, 0xe8247c28, 0x4c7dc7c5,
+0xc0310824, 0x165de2c4, 0x7cf7c5c9, 0x5de2c4ca,
+0xf7c5c916, 0xe2c4ca7c, 0xc5c9165d, 0xc4ca7cf7,
+0xc9165de2, 0xcac2f4c5, 0x7de2c400, 0x920fcb17,
+0x01f883c0, 0x6725c019, 0xeb000007, 0x075eb805,
+0xc3c90000, 0x00000000, 0x00000000, 0x00000000,
+0xbf800000, 0x80000000, 0x3f000000, 0x42100000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x42f00000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000001, 0x00000004, 0x00000005,
+0x00000002, 0x00000003, 0x00000006, 0x00000007,
+0x41100000, 0x00000000, 0x00000000, 0x00000000,
+0003020,
+};
+asm(".type avx2_x86_64_D_32f4, STT_NOTYPE;");
+asm(".type avx2_x86_64_D_32f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_32f8[] = {
+0x485500eb, 0x8348e589, 0x8348e0e4, 0xfbc568ec,
+0x058a0d10, 0xfbc50000, 0x05421d10, 0xfbc50000,
+0x05422510, 0xfbc50000, 0x05422d10, 0xfbc50000,
+0x05421510, 0xfbc50000, 0x08244c11, 0x5c11fbc5,
+0xfbc52824, 0x48244c11, 0x6411fbc5, 0xfbc51024,
+0x30246c11, 0x5411fbc5, 0xfbc55024, 0x18246c11,
+0x6411fbc5, 0xfbc53824, 0x58244c11, 0x5c11fbc5,
+0xfbc52024, 0x40244c11, 0x5411fbc5, 0xfdc56024,
+0x08247c28, 0x7c29fdc5, 0xfdc5a824, 0xa8244c28,
+0xd276edc5, 0x000539b8, 0xc2f5c500, 0xe2c400df,
+0x0fda177d, 0x0004ac83, 0x58f5c500, 0xc508245c,
+0x245c29fd, 0x28fdc5c8, 0xb808247c, 0x0000053f,
+0xdf58c5c5, 0x5cc2e5c5, 0xc400c824, 0xda177de2,
+0x047f830f, 0xfdc50000, 0xc8247c28, 0x5c5cc5c5,
+0xfdc50824, 0xe8245c29, 0x5cc2f5c5, 0xb800e824,
+0x00000544, 0x177de2c4, 0x56830fda, 0xc5000004,
+0x247428fd, 0x59f5c528, 0xc508244c, 0xc5e659cd,
+0x245c28fd, 0x58e5c508, 0x5ce5c5f6, 0xc528246c,
+0xb8cc5cf5, 0x0000055b, 0xee59d5c5, 0xcdc2f5c5,
+0x7de2c400, 0x830fca17, 0x00000419, 0x4c59e5c5,
+0xfdc54824, 0xa8244c29, 0x5c5ee5c5, 0xf5c54824,
+0xb800cbc2, 0x00000564, 0x177de2c4, 0xf2830fca,
+0xc4000003, 0x25197de2, 0x00000414, 0x5c28fdc5,
+0x67b84824, 0xc5000005, 0xc5cc57e5, 0x246457dd,
+0x59f5c508, 0xc5a8244c, 0x00ccc2f5, 0x177de2c4,
+0xbe830fca, 0xc5000003, 0x244ce6ff, 0xe6fec508,
+0xc2f5c5c9, 0x0008244c, 0x00056eb8, 0x7de2c400,
+0x830fca17, 0x0000039d, 0x4c5afdc5, 0xe3c40824,
+0x01c91875, 0xc953fcc5, 0xc95afcc5, 0x4c29fdc5,
+0xfdc5a824, 0xa8244c5a, 0x4c29f8c5, 0xe3c49824,
+0x01c91875, 0x6c28fdc5, 0xfcc50824, 0x75b8c953,
+0xc5000005, 0xc5c95afc, 0xc5c9e6ff, 0xc5c9e6fe,
+0x00cdc2f5, 0x177de2c4, 0x46830fca, 0xc5000003,
+0xc5cd59d5, 0x244c29fd, 0x5afdc5a8, 0xc4a8244c,
+0xc91875e3, 0x52fcc501, 0x5afcc5c9, 0x29fdc5c9,
+0xc5c8244c, 0x246428fd, 0x057cb8c8, 0xfdc50000,
+0xf8c5cc5a, 0x98244c29, 0x1875e3c4, 0xfcc501c9,
+0xfcc5c953, 0xffc5c95a, 0xfec5c9e6, 0xd5c5c9e6,
+0xc400e9c2, 0xea177de2, 0x02e7830f, 0xffc50000,
+0xfec5e4e6, 0xfdc5ece6, 0x08246428, 0x00057eb8,
+0x5afdc500, 0x29f8c5cc, 0xc498244c, 0xc91875e3,
+0x53fcc501, 0x5afcc5c9, 0xe6ffc5c9, 0xe6fec5c9,
+0xc2d5c5c9, 0xe2c400c9, 0x0fca177d, 0x0002a483,
+0x59ddc500, 0x29fdc5cc, 0xc5a8244c, 0x244c51fd,
+0x059cb8a8, 0xf5c50000, 0xc400ccc2, 0xca177de2,
+0x027f830f, 0xe2c40000, 0xc10d197d, 0xc5000002,
+0xc5cc5ef5, 0x244c29fd, 0x7de3c4a8, 0xa8244c09,
+0x05a4b80b, 0xf5c50000, 0x02a10dc2, 0xc4000000,
+0xca177de2, 0x024b830f, 0xe5c50000, 0x28244c59,
+0xec59e5c5, 0x4c29fdc5, 0xd5c5c824, 0xc8244c5f,
+0x6c5dd5c5, 0xfdc5c824, 0xc8246c29, 0x4c58f5c5,
+0xddc5c824, 0x28246458, 0x00063db8, 0x59f5c500,
+0xc2f5c5cb, 0xe2c400cc, 0x0fca177d, 0x00020483,
+0x7de3c400, 0x08244c05, 0x28fdc505, 0xb8282464,
+0x0000064e, 0x0675e3c4, 0xddc501c9, 0xc400c9c2,
+0xca177de2, 0x01db830f, 0xfdc50000, 0x08244c28,
+0x000653b8, 0xfde3c400, 0xc51be901, 0x00ecc2d5,
+0x177de2c4, 0xba830fea, 0xc5000001, 0xc5cc58f5,
+0x192d7efa, 0xb8000002, 0x0000065d, 0x197de2c4,
+0xc2f5c5ed, 0xe2c400cd, 0x0fca177d, 0x00019483,
+0x12ffc500, 0xc408246c, 0x35197de2, 0x000001a8,
+0x4c28fdc5, 0x17b80824, 0xc4000007, 0x3d197de2,
+0x000001a4, 0xf658e5c5, 0xe95cd5c5, 0xf759cdc5,
+0xeec2d5c5, 0x7de2c400, 0x830fea17, 0x00000155,
+0x6c10fbc5, 0xfdc53024, 0xc8244c29, 0x00072ab8,
+0x11fbc500, 0xc5d0246c, 0x246c10fb, 0x11fbc540,
+0xc5e0246c, 0xc5ed57d1, 0x01dbc2d5, 0x6c28fdc5,
+0xe3c4c824, 0x30c94b5d, 0xc9c2d5c5, 0x7de2c400,
+0x830fca17, 0x0000010d, 0x2d65e2c4, 0xc508244c,
+0x244c29fd, 0xeff1c5e8, 0x0733b8c9, 0xe3c40000,
+0x30c94c6d, 0x2f75e2c4, 0xc5e82464, 0x247c28fd,
+0xc2c5c5e8, 0xe2c400cd, 0x0fca177d, 0x0000d483,
+0x28fdc500, 0xb8082474, 0x0000073a, 0x0d4de3c4,
+0x0a28244c, 0xe9c2d5c5, 0x7de2c400, 0x830fea17,
+0x000000b1, 0x7c28fdc5, 0xc5c50824, 0x28244cd0,
+0x5c28fdc5, 0xe5c50824, 0x282464d0, 0x000743b8,
+0xc2f5c500, 0xe2c400cc, 0x0fca177d, 0x00008483,
+0x29fdc500, 0xc5a8245c, 0xc5db57e1, 0x244c7ce5,
+0xfde3c4a8, 0xc5d8c901, 0x244c29fd, 0x7ce5c5a8,
+0xc4a8244c, 0xc901fde3, 0x7de3c4d8, 0xc501c919,
+0xc5c915f1, 0x850d2ef9, 0x7a000000, 0xc5417543,
+0x247428fd, 0x7dcdc508, 0x3128244c, 0xfde3c4c0,
+0xc5d8c901, 0xc4cb7cf5, 0xc901fde3, 0x7cf5c5d8,
+0xfde3c4cb, 0xc5d8c901, 0x00cbc2f5, 0x177de2c4,
+0xc0920fca, 0x1901f883, 0x076725c0, 0x05eb0000,
+0x00075eb8, 0x00c3c900, 0x00000000, 0x00000000,
+0x00000000, 0x40100000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0xbff00000,
+0x00000000, 0x80000000, 0x00000000, 0x3fe00000,
+0x00000000, 0x40240000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x40140000, 0x00000000, 0x00000000,
+0002720,
+};
+asm(".type avx2_x86_64_D_32f8, STT_NOTYPE;");
+asm(".type avx2_x86_64_D_32f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_f4[] = {
+0x485523eb, 0x7d89e589, 0x458d48fc, 0xea8948fc,
+0x75ff3880, 0xc0ff480c, 0x75d03948, 0xeb01b0f3,
+0x5dc03102, 0x894855c3, 0xe48348e5, 0xec8148e0,
+0x00000100, 0x0d10fac5, 0x00000464, 0x4c11fac5,
+0xfac53824, 0x3c244c11, 0x4c11fac5, 0x448b4024,
+0x44893824, 0xff312c24, 0x5410fac5, 0xf8c53824,
+0x2c24542e, 0x000000b9, 0x9b0f4000, 0xf9450fc7,
+0x8be8dff7, 0x89ffffff, 0x0539b8c2, 0xd2840000,
+0x040c840f, 0xfac50000, 0x2c245410, 0x5458eac5,
+0xfac53824, 0x30245411, 0x5410fac5, 0xff313824,
+0xd258eac5, 0x542ef8c5, 0x0f403024, 0x450fc79b,
+0xe8dff7f9, 0xffffff4a, 0x3fb8c289, 0x84000005,
+0xcb840fd2, 0xc5000003, 0x245410fa, 0x5ceac530,
+0xc5382454, 0x241411fa, 0x8924048b, 0x89682444,
+0x89302444, 0x31342444, 0x10fac5ff, 0xc52c2454,
+0x24542ef8, 0x9b0f4034, 0xf9450fc7, 0xffe8dff7,
+0x89fffffe, 0x0544b8c2, 0xd2840000, 0x0380840f,
+0xfac50000, 0x2c245410, 0x5459eac5, 0xfac53824,
+0x2c245411, 0x5410fac5, 0xeac53c24, 0xfac5d259,
+0x30245411, 0x5410fac5, 0xeac53824, 0x3c245458,
+0x5411fac5, 0xfac53424, 0x38245410, 0x5c5ceac5,
+0xff313c24, 0x5c59e2c5, 0xfac53424, 0x2c246410,
+0x645cdac5, 0xf8c53024, 0xfac5e32e, 0x34245c11,
+0xc79b0f40, 0xf7f9450f, 0xfe84e8df, 0xc289ffff,
+0x00055bb8, 0x0fd28400, 0x00030584, 0x59eac500,
+0xc5402454, 0x245411fa, 0xc5ff312c, 0x245410fa,
+0x5eeac538, 0xc5402454, 0x24542ef8, 0x11fac52c,
+0x40302454, 0x0fc79b0f, 0xdff7f945, 0xfffe41e8,
+0xb8c289ff, 0x00000564, 0x840fd284, 0x000002c2,
+0x5410fac5, 0xfac54024, 0x02d22510, 0xfac50000,
+0x38245c10, 0xe8c5ff31, 0xe0c5d457, 0xeac5dc57,
+0x2c245459, 0xd32ef8c5, 0xc79b0f40, 0xf7f9450f,
+0xfdfce8df, 0xc289ffff, 0x000567b8, 0x0fd28400,
+0x00027d84, 0x2cfac500, 0x89382444, 0x00f82484,
+0xeac50000, 0xf824942a, 0xc5000000, 0x245411fa,
+0xc5ff312c, 0x245410fa, 0x2ef8c52c, 0x40382454,
+0x0fc79b0f, 0xdff7f945, 0xfffdb5e8, 0xb8c289ff,
+0x0000056e, 0x840fd284, 0x00000236, 0x54530ff3,
+0xfac53824, 0x2c245411, 0x54530ff3, 0xfac52c24,
+0x8489c22c, 0x0000f824, 0x2ae2c500, 0x00f8249c,
+0xfac50000, 0x38245410, 0xf8c5ff31, 0x0f40da2e,
+0x450fc79b, 0xe8dff7f9, 0xfffffd66, 0x75b8c289,
+0x84000005, 0xe7840fd2, 0xc5000001, 0xc5d259ea,
+0x245411fa, 0x520ff32c, 0xc52c2454, 0x245411fa,
+0x530ff330, 0xc5302454, 0x89c22cfa, 0x00f82484,
+0xeac50000, 0xf824942a, 0x31000000, 0x2ef8c5ff,
+0x40382454, 0x0fc79b0f, 0xdff7f945, 0xfffd11e8,
+0xb8c289ff, 0x0000057c, 0x840fd284, 0x00000192,
+0x442cfac5, 0x84893024, 0x0000f824, 0x530ff300,
+0xc5382454, 0xc5c22cfa, 0x249c2ae2, 0x000000f8,
+0xf8248489, 0xc5000000, 0x24942aea, 0x000000f8,
+0xf8c5ff31, 0x0f40da2e, 0x450fc79b, 0xe8dff7f9,
+0xfffffcbe, 0x7eb8c289, 0x84000005, 0x3f840fd2,
+0xc4000001, 0x442cfae1, 0x89483824, 0x00f82484,
+0xe1c40000, 0x24942aea, 0x000000f8, 0x5411fac5,
+0xff312c24, 0x5410fac5, 0xf8c53824, 0x2c24542e,
+0xc79b0f40, 0xf7f9450f, 0xfc74e8df, 0xc289ffff,
+0x000588b8, 0x0fd28400, 0x0000f584, 0x59eac500,
+0x11fac5d2, 0xc52c2454, 0x245410fa, 0xf3ff3138,
+0x245c510f, 0x2ef8c52c, 0x9b0f40da, 0xf9450fc7,
+0x3be8dff7, 0x89fffffc, 0x059cb8c2, 0xd2840000,
+0x00bc840f, 0xf2c50000, 0xfac5d25e, 0x30244c11,
+0x5411fac5, 0xff312c24, 0x0a3a0f66, 0x0b2c244c,
+0x4c2ef8c5, 0xfac53024, 0x34244c11, 0xc79b0f40,
+0xf7f9450f, 0xfbf8e8df, 0xc289ffff, 0x0005a4b8,
+0x74d28400, 0x10fac57d, 0xc540244c, 0x245459f2,
+0x59f2c538, 0xc53c244c, 0x245411fa, 0x11fac52c,
+0xc530244c, 0x244c10fa, 0x5ff2c52c, 0xc530244c,
+0x244c11fa, 0x10fac534, 0xc52c244c, 0x244c5df2,
+0x11fac530, 0xc530244c, 0x244c10fa, 0x58f2c530,
+0x3134244c, 0x59f2c5ff, 0xc540244c, 0x245410fa,
+0x58eac538, 0xc53c2454, 0x40ca2ef8, 0x0fc79b0f,
+0xdff7f945, 0xfffb79e8, 0x19013cff, 0x063d25c0,
+0xc3c90000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0002300,
+};
+asm(".type avx2_x86_64_D_f4, STT_NOTYPE;");
+asm(".type avx2_x86_64_D_f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx2_x86_64_D_f8[] = {
+0x485500eb, 0x8348e589, 0x8148e0e4, 0x000148ec,
+0x10fbc500, 0x0004f70d, 0x11fbc500, 0xc5c0244c,
+0x244c11fb, 0x11fbc5c8, 0x48d0244c, 0xc024448b,
+0x24448948, 0xc5c031a8, 0x245410fb, 0x2ef9c5c0,
+0xbaa82454, 0x00000000, 0x48c09b0f, 0x48c2450f,
+0xe1c4d8f7, 0xb8e86ef9, 0x00000539, 0xcdd7f9c5,
+0x81c9b60f, 0x0000fff9, 0x98850f00, 0xc5000004,
+0x245410fb, 0x58ebc5a8, 0xc5c02454, 0x245411fb,
+0x10fbc5b0, 0x31c02454, 0x58ebc5c0, 0x2ef9c5d2,
+0x0fb02454, 0x0f48c09b, 0xf748c245, 0xf9e1c4d8,
+0x3fb8f06e, 0xc5000005, 0x0fced7f9, 0xf981c9b6,
+0x000000ff, 0x044d850f, 0xfbc50000, 0xb0245410,
+0x545cebc5, 0xfbc5c024, 0x88245411, 0x24448b48,
+0x44894888, 0x89482824, 0x48b02444, 0xb8244489,
+0xfbc5c031, 0xa8245410, 0x542ef9c5, 0x9b0fb824,
+0x450f48c0, 0xd8f748c2, 0x6ef9e1c4, 0x0544b8f8,
+0xf9c50000, 0xb60fcfd7, 0xfff981c9, 0x0f000000,
+0x0003f285, 0x10fbc500, 0xc5a82454, 0x245459eb,
+0x11fbc5c0, 0xc5a82454, 0x245410fb, 0x59ebc5c8,
+0x11fbc5d2, 0xc5b02454, 0x245410fb, 0x58ebc5c0,
+0xc5c82454, 0x245411fb, 0x10fbc5b8, 0xc5c02454,
+0x245c5ceb, 0xc5c031c8, 0x245c59e3, 0x10fbc5b8,
+0xc5a82464, 0x24645cdb, 0x2ef9c5b0, 0x11fbc5e3,
+0x0fb8245c, 0x0f48c09b, 0xf748c245, 0xf9e1c4d8,
+0x5bb8e86e, 0xc5000005, 0x0fcdd7f9, 0xf981c9b6,
+0x000000ff, 0x036d850f, 0xebc50000, 0xd0245459,
+0x5411fbc5, 0xc031a824, 0x5410fbc5, 0xebc5c024,
+0xd024545e, 0x542ef9c5, 0xfbc5a824, 0xb0245411,
+0x48c09b0f, 0x48c2450f, 0xe1c4d8f7, 0xb8f06ef9,
+0x00000564, 0xced7f9c5, 0x81c9b60f, 0x0000fff9,
+0x20850f00, 0xc5000003, 0x31257efa, 0xc5000003,
+0x245410fb, 0xc5c031d0, 0x245c10fb, 0x57e9c5c0,
+0x59ebc5d4, 0xc5a82454, 0xc5dc57e1, 0x0fd32ef9,
+0x0f48c09b, 0xf748c245, 0xf9e1c4d8, 0x67b8f86e,
+0xc5000005, 0x0fcfd7f9, 0xf981c9b6, 0x000000ff,
+0x02d1850f, 0xfbc50000, 0xc024442c, 0xd8244489,
+0x542aebc5, 0xfbc5d824, 0xa8245411, 0xfbc5c031,
+0xa8245410, 0x542ef9c5, 0x9b0fc024, 0x450f48c0,
+0xd8f748c2, 0x6ef9e1c4, 0x056eb8e8, 0xf9c50000,
+0xb60fcdd7, 0xfff981c9, 0x0f000000, 0x00028685,
+0x5a0ff200, 0xf3c02454, 0xf3d2530f, 0xc5d25a0f,
+0x245413f9, 0x5a0ff2a8, 0xf3a82454, 0xf3d2530f,
+0xc5d25a0f, 0x89c22cfb, 0xc5d82444, 0x245c2ae3,
+0x10fbc5d8, 0x31c02454, 0x2ef9c5c0, 0xc09b0fda,
+0xc2450f48, 0xc4d8f748, 0xf06ef9e1, 0x000575b8,
+0xd7f9c500, 0xc9b60fce, 0x00fff981, 0x850f0000,
+0x00000223, 0xd259ebc5, 0x5411fbc5, 0x0ff2a824,
+0xa824545a, 0xd2520ff3, 0xd25a0ff3, 0x5413f9c5,
+0x0ff2b024, 0xb024545a, 0xd2530ff3, 0xd25a0ff3,
+0xc22cfbc5, 0xd8244489, 0xebc5c031, 0xd824542a,
+0x542ef9c5, 0x9b0fc024, 0x450f48c0, 0xd8f748c2,
+0x6ef9e1c4, 0x057cb8f8, 0xf9c50000, 0xb60fd7d7,
+0xfffa81d2, 0x0f000000, 0x0001ba85, 0x2cfbc500,
+0x89b02444, 0xf2d82444, 0x24545a0f, 0x530ff3c0,
+0x5a0ff3d2, 0x2cfbc5d2, 0x24448bd2, 0x245489d8,
+0x24443bd8, 0xc0940fd8, 0x48c0b60f, 0xe1c4d8f7,
+0xb8e86ef9, 0x0000057e, 0xd5d7f9c5, 0x81d2b60f,
+0x0000fffa, 0x6c850f00, 0xc4000001, 0x442cfbe1,
+0x8948c024, 0xc4d82444, 0x542aebe1, 0xfbc5d824,
+0xa8245411, 0xfbc5c031, 0xc0245410, 0x542ef9c5,
+0x00baa824, 0x0f000000, 0x0f48c09b, 0xf748c245,
+0xf9e1c4d8, 0x88b8f06e, 0xc5000005, 0x0fced7f9,
+0xf981c9b6, 0x000000ff, 0x0119850f, 0xebc50000,
+0xfbc5d259, 0xa8245411, 0x5410fbc5, 0xc031c024,
+0x5c510ff2, 0xf9c5a824, 0x9b0fda2e, 0x450f48c0,
+0xd8f748c2, 0x6ef9e1c4, 0x059cb8f8, 0xf9c50000,
+0xb60fcfd7, 0xfff981c9, 0x0f000000, 0x0000d685,
+0x5ef3c500, 0x11fbc5d2, 0xc5b0244c, 0x245411fb,
+0x66c031a8, 0x4c0b3a0f, 0xc50ba824, 0x244c2ef9,
+0x11fbc5b0, 0x0fb8244c, 0x0f48c09b, 0xf748c245,
+0xf9e1c4d8, 0xa4b8e06e, 0xc5000005, 0x0fccd7f9,
+0xf981c9b6, 0x000000ff, 0x0089850f, 0xfbc50000,
+0xd0244c10, 0x5459f3c5, 0xf3c5c024, 0xc8244c59,
+0x5411fbc5, 0xfbc5a824, 0xb0244c11, 0x4c10fbc5,
+0xf3c5a824, 0xb0244c5f, 0x4c11fbc5, 0xfbc5b824,
+0xa8244c10, 0x4c5df3c5, 0xfbc5b024, 0xb0244c11,
+0x4c10fbc5, 0xf3c5b024, 0xb8244c58, 0xf3c5c031,
+0xd0244c59, 0x5410fbc5, 0xebc5c024, 0xc8245458,
+0xca2ef9c5, 0x48c09b0f, 0x48c2450f, 0xe1c4d8f7,
+0xc5e86ef9, 0x0fc5d7f9, 0xff3dc0b6, 0xb8000000,
+0x0000063d, 0xc9c2440f, 0x000000c3, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x00000000,
+0002460,
+};
+asm(".type avx2_x86_64_D_f8, STT_NOTYPE;");
+asm(".type avx2_x86_64_D_f8, STT_FUNC;");
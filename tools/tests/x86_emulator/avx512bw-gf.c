@@ -0,0 +1 @@
+simd-gf.c
\ No newline at end of file
@@ -0,0 +1,113 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_gf_x86_32_D_64[] = {
+0x315500eb, 0x83e589c0, 0xec81c0e4, 0x00000100,
+0x40044488, 0x800484c6, 0x01000000, 0x40f88340,
+0x84c6ee75, 0x00008024, 0x40b20000, 0x000003b8,
+0x7df26200, 0x62d27a48, 0x6f48fdf1, 0x6201246c,
+0xcf58d5f3, 0x1000e80d, 0xf1620000, 0x4c7f48fd,
+0xf1620324, 0x746f48fd, 0xf2620124, 0x4ccf484d,
+0xf1620324, 0x646f48fd, 0xf3620224, 0xc43f4875,
+0xf8e1c400, 0x38244491, 0x3c244c8b, 0x3824548b,
+0x42507541, 0xf1624d75, 0x4c6f48fd, 0xf2620124,
+0x5ccf4875, 0xf3620324, 0xcc3f4865, 0xf8e1c400,
+0x38244c91, 0x3c244c8b, 0x3824548b, 0x422b7541,
+0x84c62875, 0x00008024, 0xf1620100, 0xcafc4875,
+0xfdf16248, 0x244c7f48, 0x68850f01, 0x31ffffff,
+0xb80cebc0, 0x00000043, 0x47b805eb, 0xc9000000,
+0x000000c3, 0x00000000, 0x10204080, 0x01020408,
+0000360,
+};
+asm(".type avx512bw_gf_x86_32_D_64, STT_NOTYPE;");
+asm(".type avx512bw_gf_x86_32_D_64, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_gf_x86_32_D_16[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0xec83e589, 0x05448838, 0x0544c6c8, 0x834001d8,
+0xf17510f8, 0x00d845c6, 0x0fb810b2, 0x62000000,
+0x7a087df2, 0x7ff162d2, 0xc8ad6f08, 0x62ffffff,
+0xcf18d5f3, 0x1000e00d, 0xf1620000, 0x8d7f087f,
+0xffffffe8, 0x087ff162, 0xffc8b56f, 0xf262ffff,
+0x8dcf084d, 0xffffffe8, 0x087ff162, 0xffd8a56f,
+0xf362ffff, 0xc43f0875, 0x93f8c500, 0xfffa81d0,
+0x750000ff, 0x7ff16246, 0xc88d6f08, 0x62ffffff,
+0xcf0875f2, 0xffffe89d, 0x65f362ff, 0x00cc3f08,
+0xd193f8c5, 0xfffffa81, 0x26750000, 0x01d845c6,
+0x0875f162, 0x6248cafc, 0x7f087ff1, 0xffffc88d,
+0x6e850fff, 0x31ffffff, 0xb80cebc0, 0x00000043,
+0x47b805eb, 0xc9000000, 0x000000c3, 0x00000000,
+0x10204080, 0x01020408,
+0000350,
+};
+asm(".type avx512bw_gf_x86_32_D_16, STT_NOTYPE;");
+asm(".type avx512bw_gf_x86_32_D_16, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_gf_x86_32_D_32[] = {
+0x315500eb, 0x83e589c0, 0xec83e0e4, 0x04048860,
+0x200444c6, 0xf8834001, 0xc6f27520, 0x00202444,
+0x07b820b2, 0x62000000, 0x7a287df2, 0x7ff162d2,
+0x242c6f28, 0x38d5f362, 0x00b00dcf, 0x62000010,
+0x7f287ff1, 0x6202244c, 0x6f287ff1, 0xf2622434,
+0x4ccf284d, 0xf1620224, 0x646f287f, 0xf3620124,
+0xc43f2875, 0x93fbc500, 0x367542d0, 0x287ff162,
+0x62240c6f, 0xcf2875f2, 0x6202245c, 0x3f2865f3,
+0xfbc500cc, 0x7542d193, 0x2444c620, 0xf1620120,
+0xcafc2875, 0x7ff16248, 0x240c7f28, 0xc0318f75,
+0x43b80ceb, 0xeb000000, 0x0047b805, 0xc3c90000,
+0x10204080, 0x01020408,
+0000270,
+};
+asm(".type avx512bw_gf_x86_32_D_32, STT_NOTYPE;");
+asm(".type avx512bw_gf_x86_32_D_32, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_gf_x86_64_D_64[] = {
+0x315500eb, 0xe58948c0, 0xc0e48348, 0x48ec8348,
+0x88044488, 0xc80444c6, 0xc0ff4801, 0x40f88348,
+0x44c6ee75, 0xb200c824, 0x0003b840, 0xf2620000,
+0xd27a487d, 0x48fdf162, 0x8824ac6f, 0x62ffffff,
+0xcf58d5f3, 0x0000960d, 0xf1620000, 0x8c7f48fd,
+0x00000824, 0xfdf16200, 0x24b46f48, 0xffffff88,
+0x48fdf162, 0xc824a46f, 0x62ffffff, 0xcf484df2,
+0x0008248c, 0xf3620000, 0xc43f4875, 0xfbe1c400,
+0xff48d093, 0x624975c2, 0x6f48fdf1, 0xff88248c,
+0xf262ffff, 0x9ccf4875, 0x00000824, 0x65f36200,
+0x00cc3f48, 0x93fbe1c4, 0xc2ff48d1, 0xf1622975,
+0xcafc4875, 0xc82444c6, 0xfdf16201, 0x248c7f48,
+0xffffff88, 0x850fc8ff, 0xffffff68, 0x0cebc031,
+0x000043b8, 0xb805eb00, 0x00000047, 0x0000c3c9,
+0x10204080, 0x01020408,
+0000350,
+};
+asm(".type avx512bw_gf_x86_64_D_64, STT_NOTYPE;");
+asm(".type avx512bw_gf_x86_64_D_64, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_gf_x86_64_D_16[] = {
+0x315500eb, 0xe58948c0, 0xd0054488, 0xe00544c6,
+0xc0ff4801, 0x10f88348, 0x45c6ee75, 0x0fb800e0,
+0x62000000, 0x6f087ff1, 0x00009325, 0x7ff16200,
+0xfd6d6f08, 0x18d5f362, 0x00710dcf, 0x62000000,
+0x7f087ff1, 0xf162ff4d, 0x756f087f, 0x7ff162fd,
+0xfe5d6f08, 0x084df262, 0x62ff4dcf, 0x3f0875f3,
+0xf8c500c3, 0xff66d093, 0x623775c2, 0x6f087ff1,
+0xf262fd4d, 0x55cf0875, 0x6df362ff, 0x00cb3f08,
+0xd193f8c5, 0x75c2ff66, 0x75f16220, 0xc6ccfc08,
+0x6201e045, 0x7f087ff1, 0xc8fffd4d, 0xc0318f75,
+0x43b80ceb, 0xeb000000, 0x0047b805, 0xc35d0000,
+0x10204080, 0x01020408, 0x00000000, 0x00000000,
+0x10101010, 0x10101010, 0x10101010, 0x10101010,
+0000320,
+};
+asm(".type avx512bw_gf_x86_64_D_16, STT_NOTYPE;");
+asm(".type avx512bw_gf_x86_64_D_16, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_gf_x86_64_D_32[] = {
+0x315500eb, 0xe58948c0, 0xe0e48348, 0xa0044488,
+0xc00444c6, 0xc0ff4801, 0x20f88348, 0x44c6ee75,
+0xb200c024, 0x0007b820, 0xf2620000, 0xd27a287d,
+0x287ff162, 0xfd246c6f, 0x38d5f362, 0x007d0dcf,
+0x62000000, 0x7f287ff1, 0x62ff244c, 0x6f287ff1,
+0x62fd2474, 0x6f287ff1, 0x62fe2464, 0xcf284df2,
+0x62ff244c, 0x3f2875f3, 0xfbc500c4, 0xc2ffd093,
+0xf1623a75, 0x4c6f287f, 0xf262fd24, 0x5ccf2875,
+0xf362ff24, 0xcc3f2865, 0x93fbc500, 0x75c2ffd1,
+0x75f16222, 0xc6cafc28, 0x01c02444, 0x287ff162,
+0xfd244c7f, 0x8875c8ff, 0x0cebc031, 0x000043b8,
+0xb805eb00, 0x00000047, 0x0000c3c9, 0x00000000,
+0x10204080, 0x01020408,
+0000310,
+};
+asm(".type avx512bw_gf_x86_64_D_32, STT_NOTYPE;");
+asm(".type avx512bw_gf_x86_64_D_32, STT_FUNC;");
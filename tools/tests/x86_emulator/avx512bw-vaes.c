@@ -0,0 +1 @@
+simd-aes.c
\ No newline at end of file
@@ -0,0 +1,129 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_vaes_x86_32_D_64[] = {
+0x315500eb, 0xeff1c5c0, 0x53e589c9, 0x81c0e483,
+0x000100ec, 0x24548d00, 0xfdf16240, 0x244c7f48,
+0x10048802, 0x40f88340, 0x40b1f775, 0x000004b8,
+0x7df26200, 0xc4d17a48, 0x22db79e2, 0xdb79e2c4,
+0xf362104a, 0xe138485d, 0x79e2c401, 0x62204adb,
+0x38485df3, 0xe2c402e1, 0x304adb79, 0x485df362,
+0x6203e138, 0x6f48fdf1, 0x6201244c, 0xdd4875f2,
+0x6202245c, 0xde4865f2, 0x6202245c, 0x3f485df3,
+0xe1c400c3, 0x244491f8, 0x245c8b38, 0x244c8b3c,
+0x850f4338, 0x00000087, 0x80850f41, 0x62000000,
+0xdf4875f2, 0x6202245c, 0xdc4865f2, 0x6202245c,
+0x7f48fdf1, 0x8d03245c, 0x00c0248c, 0xe2c40000,
+0xc419db79, 0x61db79e2, 0x65f36210, 0x01dc3848,
+0xdb79e2c4, 0xf3622061, 0xdc384865, 0x79e2c402,
+0x623061db, 0x384865f3, 0xf36203dc, 0xc93f4865,
+0xf8e1c400, 0x38244c91, 0x3c245c8b, 0x38244c8b,
+0x41237543, 0xf1622075, 0xcafc4875, 0xfdf16248,
+0x244c7f48, 0x1c850f01, 0x31ffffff, 0xb80cebc0,
+0x0000004a, 0x53b805eb, 0x8b000000, 0xc3c9fc5d,
+0000460,
+};
+asm(".type avx512bw_vaes_x86_32_D_64, STT_NOTYPE;");
+asm(".type avx512bw_vaes_x86_32_D_64, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_vaes_x86_32_D_16[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0x0875f162, 0xe589c9ef, 0x6238ec83, 0x7f087ff1,
+0xffffd88d, 0x054488ff, 0xf88340c8, 0xb2f67510,
+0x7ff16210, 0x10156f08, 0xc4001001, 0x4ddb79e2,
+0x7ff162c8, 0xc89d6f08, 0x62ffffff, 0xdd0865f2,
+0xffffd8a5, 0x5df262ff, 0xd8a5de08, 0x62ffffff,
+0x3f0875f3, 0xf8c500c4, 0xf981c893, 0x0000ffff,
+0xf2627c75, 0x8ddf0865, 0xffffffd8, 0x0875f262,
+0xffd88ddc, 0xf162ffff, 0x8d7f087f, 0xffffffe8,
+0xdb79e2c4, 0xf362e84d, 0xcb3f0875, 0x93f8c500,
+0xfff981c9, 0x750000ff, 0x79e3c44c, 0x00c84ddf,
+0x0875f262, 0xf362da00, 0xd33f0875, 0x93f8c500,
+0xfff981ca, 0x750000ff, 0x7df26233, 0x62ca7a08,
+0xfc0875f1, 0xffffc88d, 0xf16248ff, 0x8d7f087f,
+0xffffffc8, 0xff51850f, 0xc031ffff, 0x4ab813eb,
+0xeb000000, 0x0053b80c, 0x05eb0000, 0x00005eb8,
+0x00c3c900, 0x00000000, 0x00000000, 0x00000000,
+0x06050407, 0x00030201, 0x0e0d0c0f, 0x080b0a09,
+0000440,
+};
+asm(".type avx512bw_vaes_x86_32_D_16, STT_NOTYPE;");
+asm(".type avx512bw_vaes_x86_32_D_16, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_vaes_x86_32_D_32[] = {
+0x315500eb, 0x75f162c0, 0x89c9ef08, 0xe0e483e5,
+0x8960ec83, 0x7ff162e2, 0x244c7f28, 0x10048801,
+0x20f88340, 0x20b1f775, 0x000008b8, 0x7df26200,
+0xc4d17a28, 0x22db79e2, 0xdb79e2c4, 0xf362104a,
+0xe138285d, 0x7ff16201, 0x240c6f28, 0x2875f262,
+0x01245cdd, 0x2865f262, 0x01245cde, 0x285df362,
+0xc500c33f, 0x41c893fb, 0xf2625475, 0x5cdf2875,
+0xf2620124, 0x5cdc2865, 0xf1620124, 0x5c7f287f,
+0x4c8d0224, 0xe2c44024, 0xc419db79, 0x61db79e2,
+0x65f36210, 0x01dc3828, 0x2865f362, 0xc500c93f,
+0x41c993fb, 0xf1621f75, 0xcafc2875, 0x7ff16248,
+0x240c7f28, 0xff79850f, 0xc031ffff, 0x4ab80ceb,
+0xeb000000, 0x0053b805, 0xc3c90000,
+0000314,
+};
+asm(".type avx512bw_vaes_x86_32_D_32, STT_NOTYPE;");
+asm(".type avx512bw_vaes_x86_32_D_32, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_vaes_x86_64_D_64[] = {
+0xc55500eb, 0x31c9eff1, 0xe58948c0, 0xc0e48348,
+0x48ec8348, 0x244c8d48, 0xfdf16288, 0x248c7f48,
+0xffffffc8, 0x48080488, 0x8348c0ff, 0xf47540f8,
+0x04b840b2, 0x48000000, 0x0824748d, 0x487df262,
+0xe2c4d27a, 0xc421db79, 0x49db79e2, 0x5df36210,
+0x01e13848, 0xdb79e2c4, 0xf3622049, 0xe138485d,
+0x79e2c402, 0x623049db, 0x38485df3, 0xf16203e1,
+0x8c6f48fd, 0xffff8824, 0x75f262ff, 0x249cdd48,
+0xffffffc8, 0x4865f262, 0xc8249cde, 0x62ffffff,
+0x3f485df3, 0xe1c400c3, 0x48d093fb, 0x7b75c2ff,
+0x4875f262, 0xc8249cdf, 0x62ffffff, 0xdc4865f2,
+0xffc8249c, 0xf162ffff, 0x9c7f48fd, 0x00000824,
+0x79e2c400, 0xe2c41edb, 0x1066db79, 0x4865f362,
+0xc401dc38, 0x66db79e2, 0x65f36220, 0x02dc3848,
+0xdb79e2c4, 0xf3623066, 0xdc384865, 0x65f36203,
+0x00c93f48, 0x93fbe1c4, 0xc2ff48d1, 0xf1622475,
+0xcafc4875, 0x48fdf162, 0x88248c7f, 0xffffffff,
+0x2b850fc8, 0x31ffffff, 0xb80cebc0, 0x0000004a,
+0x53b805eb, 0xc9000000, 0x000000c3,
+0000451,
+};
+asm(".type avx512bw_vaes_x86_64_D_64, STT_NOTYPE;");
+asm(".type avx512bw_vaes_x86_64_D_64, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_vaes_x86_64_D_16[] = {
+0x625500eb, 0xef0875f1, 0x48c031c9, 0xf162e589,
+0x4d7f087f, 0x054488fe, 0xc0ff48d0, 0x10f88348,
+0xf162f375, 0x256f087f, 0x000000b4, 0x087ff162,
+0x00ba1d6f, 0xe2c40000, 0xd06ddb79, 0x087ff162,
+0x62fd4d6f, 0xdd0875f2, 0xf262fe55, 0x55de086d,
+0x55f362fe, 0x00c23f08, 0xd093f8c5, 0x75c2ff66,
+0x75f26262, 0xfe55df08, 0x086df262, 0x62fe55dc,
+0x7f087ff1, 0xe2c4ff55, 0xf055db79, 0x086df362,
+0xc500c93f, 0x66d193f8, 0x3e75c2ff, 0xdf79e3c4,
+0x6200d04d, 0x000875f2, 0x75f362d4, 0x00d23f08,
+0xd293f8c5, 0x75c2ff66, 0x65f16228, 0xfd4dfc08,
+0x087ff162, 0xfffd4d7f, 0x77850fc8, 0x31ffffff,
+0xb813ebc0, 0x0000004a, 0x53b80ceb, 0xeb000000,
+0x005eb805, 0xc35d0000, 0x00000000, 0x00000000,
+0x06050407, 0x00030201, 0x0e0d0c0f, 0x080b0a09,
+0x10101010, 0x10101010, 0x10101010, 0x10101010,
+0000400,
+};
+asm(".type avx512bw_vaes_x86_64_D_16, STT_NOTYPE;");
+asm(".type avx512bw_vaes_x86_64_D_16, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512bw_vaes_x86_64_D_32[] = {
+0x625500eb, 0xef0875f1, 0x48c031c9, 0x8348e589,
+0xf162e0e4, 0x4c7f287f, 0x8d48fe24, 0x88a0244c,
+0xff480804, 0xf88348c0, 0xb2f47520, 0x0008b820,
+0x8d480000, 0x62e02474, 0x7a287df2, 0x79e2c4d2,
+0xe2c421db, 0x1049db79, 0x285df362, 0x6201e138,
+0x6f287ff1, 0x62fd244c, 0xdd2875f2, 0x62fe245c,
+0xde2865f2, 0x62fe245c, 0x3f285df3, 0xfbc500c3,
+0xc2ffd093, 0xf2625375, 0x5cdf2875, 0xf262fe24,
+0x5cdc2865, 0xf162fe24, 0x5c7f287f, 0xe2c4ff24,
+0xc41edb79, 0x66db79e2, 0x65f36210, 0x01dc3828,
+0x2865f362, 0xc500c93f, 0xffd193fb, 0x622175c2,
+0xfc2875f1, 0x7ff162ca, 0x244c7f28, 0x0fc8fffd,
+0xffff7885, 0xebc031ff, 0x004ab80c, 0x05eb0000,
+0x000053b8, 0x00c3c900,
+0000327,
+};
+asm(".type avx512bw_vaes_x86_64_D_32, STT_NOTYPE;");
+asm(".type avx512bw_vaes_x86_64_D_32, STT_FUNC;");
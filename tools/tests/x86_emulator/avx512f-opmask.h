@@ -0,0 +1,47 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_opmask_x86_32_D_2[] = {
+0x0d90f8c5, 0x00100108, 0x100110a1, 0x92f8c500,
+0x45ecc5d0, 0x41ecc5d9, 0x42dcc5e1, 0x47ecc5eb,
+0x91f8c5f1, 0x1001182d, 0x93f8c500, 0x18153bd6,
+0x74001001, 0x0044b806, 0xc5c30000, 0xc5de44f8,
+0xc5e146ec, 0x181d91f8, 0xc5001001, 0x3bd493f8,
+0x10011815, 0xb8067400, 0x00000048, 0xf9e3c4c3,
+0xc401d932, 0xe332f9e3, 0xf9e3c402, 0xc503e932,
+0x182591f8, 0xc5001001, 0x3bd593f8, 0x10011815,
+0xb8067400, 0x0000004d, 0xf9e3c4c3, 0xc401d930,
+0xe330f9e3, 0xf9e3c402, 0xc503e930, 0x182591f8,
+0xc5001001, 0x3bd593f8, 0x10011815, 0xb8067400,
+0x00000052, 0x98f8c5c3, 0xb80677f6, 0x00000056,
+0x47fcc5c3, 0x98f8c5d8, 0xb80674db, 0x0000005d,
+0x46fcc5c3, 0x98f8c5d8, 0xb80672db, 0x00000064,
+0xf9e3c4c3, 0xc508e330, 0xc5ec4bdd, 0x181d91f8,
+0xc5001001, 0x3bd593f8, 0x10011815, 0xb8067400,
+0x0000006c, 0xc3c031c3, 0x830f8fb3, 0xff803ff0,
+0x0ffc01ff, 0xcdf1f0c1, 0x00000000, 0x00000000,
+0000440,
+};
+asm(".type avx512f_opmask_x86_32_D_2, STT_NOTYPE;");
+asm(".type avx512f_opmask_x86_32_D_2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_opmask_x86_64_D_2[] = {
+0x0d90f8c5, 0x00000108, 0x010a058b, 0xf8c50000,
+0xecc5d092, 0xecc5d945, 0xdcc5e141, 0xecc5eb42,
+0xf8c5f147, 0x00f62d91, 0xf8c50000, 0x153bd693,
+0x000000ec, 0x44b80674, 0xc3000000, 0xde44f8c5,
+0xe146ecc5, 0x1d91f8c5, 0x000000d4, 0xd493f8c5,
+0x00ca153b, 0x06740000, 0x000048b8, 0xe3c4c300,
+0x01d932f9, 0x32f9e3c4, 0xe3c402e3, 0x03e932f9,
+0x2591f8c5, 0x000000a8, 0xd593f8c5, 0x009e153b,
+0x06740000, 0x00004db8, 0xe3c4c300, 0x01d930f9,
+0x30f9e3c4, 0xe3c402e3, 0x03e930f9, 0x2591f8c5,
+0x0000007c, 0xd593f8c5, 0x0072153b, 0x06740000,
+0x000052b8, 0xf8c5c300, 0x0677f698, 0x000056b8,
+0xfcc5c300, 0xf8c5d847, 0x0674db98, 0x00005db8,
+0xfcc5c300, 0xf8c5d846, 0x0672db98, 0x000064b8,
+0xe3c4c300, 0x08e330f9, 0xec4bddc5, 0x1d91f8c5,
+0x0000002c, 0xd593f8c5, 0x0022153b, 0x06740000,
+0x00006cb8, 0xc031c300, 0x000000c3, 0x00000000,
+0x830f8fb3, 0xff803ff0, 0x0ffc01ff, 0xcdf1f0c1,
+0x00000000, 0x00000000,
+0000450,
+};
+asm(".type avx512f_opmask_x86_64_D_2, STT_NOTYPE;");
+asm(".type avx512f_opmask_x86_64_D_2, STT_FUNC;");
@@ -0,0 +1 @@
+simd-sg.c
\ No newline at end of file
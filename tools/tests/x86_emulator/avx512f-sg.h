@@ -0,0 +1,5734 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_32_D_64x4i4[] = {
+0x315500eb, 0x53e589c0, 0x81c0e483, 0x000140ec,
+0x11ba4000, 0x89000000, 0x00bc8484, 0xc2290000,
+0x8910f883, 0x00fc8494, 0xe5750000, 0x4875f362,
+0x62ffc925, 0x274875f2, 0xefe1c5c9, 0x7df162db,
+0xc5d16f48, 0x98c193f8, 0xd190f8c5, 0x3c244489,
+0xf262c031, 0x14904a7d, 0x1003c01d, 0x7df16200,
+0x24547f48, 0x847c8301, 0x850f0140, 0x000002e4,
+0x10f88340, 0x02b8ef75, 0x62000000, 0x6f487df1,
+0x62032454, 0x6f487df1, 0x90f8c5d9, 0x7df262d9,
+0x951c904b, 0x001003c0, 0x487df162, 0x01245c7f,
+0x38844439, 0x02b1850f, 0x83400000, 0xf07512f8,
+0x485df162, 0xb802f272, 0x00000003, 0x487df162,
+0xf8c5d96f, 0xf262e190, 0x1c904c7d, 0x1003c065,
+0x7df16200, 0x245c7f48, 0x44443901, 0x7f850f3a,
+0x83000002, 0xf88302c0, 0x31ee7523, 0x7df162c0,
+0x245c6f48, 0x7df16204, 0xc5e16f48, 0x62e990f8,
+0x904d7df2, 0x03c09d24, 0xf1620010, 0x647f487d,
+0x8c8b0124, 0x00010084, 0x244c8900, 0x01518d38,
+0x40845439, 0x023f850f, 0x83400000, 0xe27510f8,
+0x000001b8, 0xefd1c500, 0x55f162ed, 0x62eafa48,
+0x6f487df1, 0x90f8c5f1, 0x7df262f1, 0xad34904e,
+0x00100400, 0x487df262, 0xf162e87c, 0xe5fa485d,
+0x000107b8, 0x4df36200, 0x00c41f48, 0xd093f8c5,
+0xfffffa81, 0x850f0000, 0x0000021c, 0x4855f162,
+0x3101f372, 0x7df162c0, 0x62e16f48, 0x90497df2,
+0x03c06d24, 0xf1620010, 0x647f487d, 0x9c8b0124,
+0x00010084, 0x245c8900, 0x01538d38, 0x40845439,
+0x01ba850f, 0x83400000, 0xe27510f8, 0x486df162,
+0xd1c5dbdb, 0xf362edef, 0xcd1f4865, 0x55f26204,
+0x62d96449, 0x274865f2, 0xb9c031cb, 0x00000011,
+0x497df262, 0xc0952490, 0x62001003, 0x7f487df1,
+0x8b022464, 0x0080849c, 0xca890000, 0x85c22940,
+0x8b0974c2, 0x00bc8494, 0x07eb0000, 0xfc84948b,
+0x89000000, 0x42382454, 0x850fd339, 0x00000157,
+0x7510f883, 0x31c031ce, 0x851489d2, 0x00100600,
+0x00803d40, 0xef750000, 0x8940c031, 0x833c8444,
+0xf67510f8, 0x487df162, 0x05c00d6f, 0xf2620010,
+0xc9274875, 0x487df162, 0x01247c6f, 0xc9eff1c5,
+0x000131b8, 0x7df26200, 0x0d3ca049, 0x00100600,
+0x06003d83, 0x0f010010, 0x00011b85, 0x0001b800,
+0x3c830000, 0x10060085, 0x850f0000, 0x000000ee,
+0x10f88340, 0xf1c5ec75, 0xf8c5c9ef, 0x3c247c90,
+0x487df162, 0x01247c6f, 0x4f7df262, 0x000d3ca0,
+0x83001006, 0x1006003d, 0x38b81000, 0x0f000001,
+0x0000d385, 0x0001ba00, 0x048b0000, 0x10060095,
+0x0fc08500, 0x0000ac85, 0xfa834200, 0xbaeb7510,
+0x00000001, 0x5490f8c5, 0xf1623c24, 0x7c6f487d,
+0xf1620324, 0x746f487d, 0xf2620124, 0x34a04a7d,
+0x100600bd, 0x95143900, 0x00100600, 0x83427e75,
+0xf17511fa, 0x000001ba, 0x0011b900, 0xf8c50000,
+0x3c245c90, 0x487df162, 0x04247c6f, 0x487df162,
+0x0124746f, 0x4b7df262, 0x00bd34a0, 0x89001006,
+0x39d329cb, 0x0600951c, 0x47750010, 0x11fa8342,
+0x44ebed75, 0x0000e7b8, 0xb83deb00, 0x000000ef,
+0xf7b836eb, 0xeb000000, 0x00ffb82f, 0x28eb0000,
+0x000115b8, 0xb821eb00, 0x0000011e, 0x34b81aeb,
+0xeb000001, 0x013bb813, 0x0ceb0000, 0x000140b8,
+0xb805eb00, 0x00000145, 0xc9fc5d8b, 0x000000c3,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000002, 0x00000003, 0x00000004,
+0x00000005, 0x00000006, 0x00000007, 0x00000008,
+0x00000009, 0x0000000a, 0x0000000b, 0x0000000c,
+0x0000000d, 0x0000000e, 0x0000000f, 0x00000010,
+0x00000011, 0x00000012, 0x00000013, 0x00000014,
+0x00000015, 0x00000016, 0x00000017, 0x00000018,
+0x00000019, 0x0000001a, 0x0000001b, 0x0000001c,
+0x0000001d, 0x0000001e, 0x0000001f, 0x00000020,
+0x00000021, 0x00000022, 0x00000023, 0x00000024,
+0x00000025, 0x00000026, 0x00000027, 0x00000028,
+0x00000029, 0x0000002a, 0x0000002b, 0x0000002c,
+0x0000002d, 0x0000002e, 0x0000002f, 0x00000030,
+0x00000031, 0x00000032, 0x00000033, 0x00000034,
+0x00000035, 0x00000036, 0x00000037, 0x00000038,
+0x00000039, 0x0000003a, 0x0000003b, 0x0000003c,
+0x0000003d, 0x0000003e, 0x0000003f, 0x00000040,
+0x00000041, 0x00000042, 0x00000043, 0x00000044,
+0x00000045, 0x00000046, 0x00000047, 0x00000048,
+0x00000049, 0x0000004a, 0x0000004b, 0x0000004c,
+0x0000004d, 0x0000004e, 0x0000004f, 0x00000050,
+0x00000051, 0x00000052, 0x00000053, 0x00000054,
+0x00000055, 0x00000056, 0x00000057, 0x00000058,
+0x00000059, 0x0000005a, 0x0000005b, 0x0000005c,
+0x0000005d, 0x0000005e, 0x0000005f, 0x00000060,
+0x00000061, 0x00000062, 0x00000063, 0x00000064,
+0x00000065, 0x00000066, 0x00000067, 0x00000068,
+0x00000069, 0x0000006a, 0x0000006b, 0x0000006c,
+0x0000006d, 0x0000006e, 0x0000006f, 0x00000070,
+0x00000071, 0x00000072, 0x00000073, 0x00000074,
+0x00000075, 0x00000076, 0x00000077, 0x00000078,
+0x00000079, 0x0000007a, 0x0000007b, 0x0000007c,
+0x0000007d, 0x0000007e, 0x0000007f, 0x00000080,
+0xffffffff, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0003000,
+};
+asm(".type avx512f_sg_x86_32_D_64x4i4, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_32_D_64x4i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_32_D_64x4i8[] = {
+0x315500eb, 0x53e589c0, 0x81c0e483, 0x0000c0ec,
+0x09ba4000, 0x89000000, 0x293c8444, 0x08f883c2,
+0x5c845489, 0xf362eb75, 0xc9254875, 0xf5f262ff,
+0xc5c92748, 0x62dbefe1, 0x6f48fdf1, 0x93f8c5d1,
+0xc0be0fc1, 0xd190f8c5, 0x3c244489, 0xf262c031,
+0x14904afd, 0x1004801d, 0xfdf16200, 0x24547f48,
+0xc49c8b02, 0x00000080, 0x38245c89, 0xf283da89,
+0xc4940b01, 0x00000084, 0x03ac850f, 0x83400000,
+0xdd7508f8, 0x000002b8, 0xc5d23100, 0x246c6ffd,
+0xfdf16240, 0xc5d16f48, 0x62d990f8, 0x904bfdf2,
+0x0480ed14, 0xf1620010, 0x547f48fd, 0x0c8d0224,
+0x000000c5, 0x249c8d00, 0x00000080, 0x5139d901,
+0x6a850ff4, 0x39000003, 0x850ff041, 0x00000361,
+0x8901c083, 0x00d283c1, 0x090af183, 0xc5cf75d1,
+0x03f572e5, 0x000003b8, 0xfdf16200, 0x31d16f48,
+0x90f8c5d2, 0xfdf262e1, 0x5d14904c, 0x00100480,
+0x48fdf162, 0x0224547f, 0x00850c8d, 0x8d000000,
+0x0080249c, 0xd9010000, 0x0ff85139, 0x00031785,
+0xf4413900, 0x030e850f, 0xc0830000, 0x83c18902,
+0xf18300d2, 0x75d10913, 0xc5c031cf, 0x24546ffd,
+0xfdf16260, 0xc5d96f48, 0x62e990f8, 0x904dfdf2,
+0x0480d51c, 0xf1620010, 0x5c7f48fd, 0x5c8b0224,
+0x5c896084, 0x538d3824, 0xc1d38901, 0x9c391ffb,
+0x000084c4, 0xc4850f00, 0x39000002, 0x0080c494,
+0x850f0000, 0x000002b7, 0x08f88340, 0xf162d075,
+0x1dfb58e5, 0x001008c0, 0xe4efd9c5, 0xe5faddc5,
+0xf190f8c5, 0x48fdf162, 0xf262e96f, 0x2c904efd,
+0x1004c0e5, 0xd5f36200, 0x00c31f48, 0xd093f8c5,
+0x07b8c2fe, 0x0f000001, 0x00029a85, 0x72edc500,
+0xc03101f2, 0x49fdf262, 0x80950c90, 0x62001004,
+0x7f48fdf1, 0x8b02244c, 0x8960845c, 0x8d38245c,
+0xd3890153, 0x391ffbc1, 0x0084c49c, 0x850f0000,
+0x00000242, 0x80c49439, 0x0f000000, 0x00023585,
+0xf8834000, 0x31d07508, 0x89d231c0, 0x08e0c514,
+0x14890010, 0x1008e4c5, 0x803d4000, 0x75000000,
+0x31c031e8, 0x248489d2, 0x00000084, 0xc931c031,
+0xa4248489, 0x31000000, 0x89db31c0, 0x00ac2484,
+0xc0310000, 0xb4248489, 0x31000000, 0x2484c7c0,
+0x00000080, 0x00000001, 0x882484c7, 0x02000000,
+0x89000000, 0x008c2494, 0x84c70000, 0x00009024,
+0x00000300, 0x248c8900, 0x00000094, 0x982484c7,
+0x04000000, 0x89000000, 0x009c249c, 0x84c70000,
+0x0000a024, 0x00000500, 0x2484c700, 0x000000a8,
+0x00000006, 0xb02484c7, 0x07000000, 0xc7000000,
+0x00b82484, 0x00080000, 0x84890000, 0x0000bc24,
+0xfdf16200, 0x800d6f48, 0x62001008, 0x2748f5f2,
+0xfdf162c9, 0x24746f48, 0xeff1c502, 0x0131b8c9,
+0xf2620000, 0x34a049fd, 0x1008e00d, 0xe0158b00,
+0x83001008, 0x150b01f2, 0x001008e4, 0x0155850f,
+0x01b80000, 0x8b000000, 0x08e4c514, 0x140b0010,
+0x1008e0c5, 0x22850f00, 0x40000001, 0x7508f883,
+0x24448ae6, 0xeff1c53c, 0xfdf162c9, 0x247c6f48,
+0x92f8c502, 0xfdf262f8, 0x0d3ca04f, 0x001008e0,
+0x08e0158b, 0x38b80010, 0x83000001, 0x150b08f2,
+0x001008e4, 0x00fd850f, 0x01b80000, 0x8b000000,
+0x08e4c514, 0x140b0010, 0x1008e0c5, 0xd1850f00,
+0x40000000, 0x7508f883, 0x24448ae6, 0xc5d2313c,
+0x24746ffd, 0xfdf16240, 0x247c6f48, 0x92f8c502,
+0x0001b8d0, 0xf2620000, 0x3ca04afd, 0x1008e0f5,
+0xc50c8d00, 0x00000000, 0x08e49139, 0x850f0010,
+0x00000097, 0x08e08139, 0x850f0010, 0x0000008b,
+0x8901c083, 0x00d283c1, 0x0909f183, 0x8ad275d1,
+0x313c2444, 0x6ffdc5d2, 0x62602464, 0x6f48fdf1,
+0xc5022474, 0xb8d892f8, 0x00000008, 0x4bfdf262,
+0xe0e534a0, 0x6b001008, 0x9139f8c8, 0x0010092c,
+0x81395075, 0x00100928, 0xc0834875, 0xffd283ff,
+0xc309d389, 0xc031e175, 0xe7b83deb, 0xeb000000,
+0x00efb836, 0x2feb0000, 0x0000f7b8, 0xb828eb00,
+0x000000ff, 0x15b821eb, 0xeb000001, 0x0134b81a,
+0x13eb0000, 0x00013bb8, 0xb80ceb00, 0x00000140,
+0x45b805eb, 0x8b000001, 0xc3c9fc5d, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000000, 0x00000002, 0x00000000,
+0x00000003, 0x00000000, 0x00000004, 0x00000000,
+0x00000005, 0x00000000, 0x00000006, 0x00000000,
+0x00000007, 0x00000000, 0x00000008, 0x00000000,
+0x00000009, 0x00000000, 0x0000000a, 0x00000000,
+0x0000000b, 0x00000000, 0x0000000c, 0x00000000,
+0x0000000d, 0x00000000, 0x0000000e, 0x00000000,
+0x0000000f, 0x00000000, 0x00000010, 0x00000000,
+0x00000011, 0x00000000, 0x00000012, 0x00000000,
+0x00000013, 0x00000000, 0x00000014, 0x00000000,
+0x00000015, 0x00000000, 0x00000016, 0x00000000,
+0x00000017, 0x00000000, 0x00000018, 0x00000000,
+0x00000019, 0x00000000, 0x0000001a, 0x00000000,
+0x0000001b, 0x00000000, 0x0000001c, 0x00000000,
+0x0000001d, 0x00000000, 0x0000001e, 0x00000000,
+0x0000001f, 0x00000000, 0x00000020, 0x00000000,
+0x00000021, 0x00000000, 0x00000022, 0x00000000,
+0x00000023, 0x00000000, 0x00000024, 0x00000000,
+0x00000025, 0x00000000, 0x00000026, 0x00000000,
+0x00000027, 0x00000000, 0x00000028, 0x00000000,
+0x00000029, 0x00000000, 0x0000002a, 0x00000000,
+0x0000002b, 0x00000000, 0x0000002c, 0x00000000,
+0x0000002d, 0x00000000, 0x0000002e, 0x00000000,
+0x0000002f, 0x00000000, 0x00000030, 0x00000000,
+0x00000031, 0x00000000, 0x00000032, 0x00000000,
+0x00000033, 0x00000000, 0x00000034, 0x00000000,
+0x00000035, 0x00000000, 0x00000036, 0x00000000,
+0x00000037, 0x00000000, 0x00000038, 0x00000000,
+0x00000039, 0x00000000, 0x0000003a, 0x00000000,
+0x0000003b, 0x00000000, 0x0000003c, 0x00000000,
+0x0000003d, 0x00000000, 0x0000003e, 0x00000000,
+0x0000003f, 0x00000000, 0x00000040, 0x00000000,
+0x00000041, 0x00000000, 0x00000042, 0x00000000,
+0x00000043, 0x00000000, 0x00000044, 0x00000000,
+0x00000045, 0x00000000, 0x00000046, 0x00000000,
+0x00000047, 0x00000000, 0x00000048, 0x00000000,
+0x00000049, 0x00000000, 0x0000004a, 0x00000000,
+0x0000004b, 0x00000000, 0x0000004c, 0x00000000,
+0x0000004d, 0x00000000, 0x0000004e, 0x00000000,
+0x0000004f, 0x00000000, 0x00000050, 0x00000000,
+0x00000051, 0x00000000, 0x00000052, 0x00000000,
+0x00000053, 0x00000000, 0x00000054, 0x00000000,
+0x00000055, 0x00000000, 0x00000056, 0x00000000,
+0x00000057, 0x00000000, 0x00000058, 0x00000000,
+0x00000059, 0x00000000, 0x0000005a, 0x00000000,
+0x0000005b, 0x00000000, 0x0000005c, 0x00000000,
+0x0000005d, 0x00000000, 0x0000005e, 0x00000000,
+0x0000005f, 0x00000000, 0x00000060, 0x00000000,
+0x00000061, 0x00000000, 0x00000062, 0x00000000,
+0x00000063, 0x00000000, 0x00000064, 0x00000000,
+0x00000065, 0x00000000, 0x00000066, 0x00000000,
+0x00000067, 0x00000000, 0x00000068, 0x00000000,
+0x00000069, 0x00000000, 0x0000006a, 0x00000000,
+0x0000006b, 0x00000000, 0x0000006c, 0x00000000,
+0x0000006d, 0x00000000, 0x0000006e, 0x00000000,
+0x0000006f, 0x00000000, 0x00000070, 0x00000000,
+0x00000071, 0x00000000, 0x00000072, 0x00000000,
+0x00000073, 0x00000000, 0x00000074, 0x00000000,
+0x00000075, 0x00000000, 0x00000076, 0x00000000,
+0x00000077, 0x00000000, 0x00000078, 0x00000000,
+0x00000079, 0x00000000, 0x0000007a, 0x00000000,
+0x0000007b, 0x00000000, 0x0000007c, 0x00000000,
+0x0000007d, 0x00000000, 0x0000007e, 0x00000000,
+0x0000007f, 0x00000000, 0x00000080, 0x00000000,
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000000,
+0004310,
+};
+asm(".type avx512f_sg_x86_32_D_64x4i8, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_32_D_64x4i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_32_D_64x4f4[] = {
+0x315500eb, 0x83e589c0, 0xec81c0e4, 0x00000140,
+0x0011ba40, 0x84890000, 0x0000bc84, 0x83c22900,
+0x948910f8, 0x0000fc84, 0x62e57500, 0x254855f3,
+0xf262ffed, 0xcd274855, 0x4865f362, 0xc5ffdb25,
+0x62d2efe9, 0x28487cf1, 0x93f8c5cb, 0xf8c598c1,
+0x4489d190, 0xc0313c24, 0x4a7df262, 0xc0150c92,
+0x62001004, 0x29487cf1, 0xeb01244c, 0xd9d8dd02,
+0x8444d9e8, 0x0fe9df40, 0x00038c8a, 0x8a850f00,
+0x40000003, 0x7510f883, 0x0002b8e4, 0xf1620000,
+0x646f487d, 0xf1620324, 0xcb28487c, 0xd990f8c5,
+0x4b7df262, 0xc0a50c92, 0x62001004, 0x29487cf1,
+0x8901244c, 0xd9382444, 0xdb388444, 0xd9382444,
+0xdde9dfc9, 0x4e8a0fd8, 0x0f000003, 0x00034c85,
+0xf8834000, 0x62dc7512, 0x72486df1, 0x03b802f4,
+0x62000000, 0x28487cf1, 0x90f8c5cb, 0x7df262e1,
+0x550c924c, 0x001004c0, 0x487cf162, 0x01244c29,
+0x38244489, 0x3a4444d9, 0x382444db, 0xe9dfc9d9,
+0x8a0fd8dd, 0x0000030e, 0x030c850f, 0xc0830000,
+0x23f88302, 0xc031da75, 0x487df162, 0x04244c6f,
+0xe990f8c5, 0x4d7df262, 0xc08d1c92, 0x62001004,
+0x29487cf1, 0x8b01245c, 0x0100848c, 0x518d0000,
+0x24548901, 0x2444db38, 0x8444d938, 0xdde9df40,
+0xcc8a0fd8, 0x0f000002, 0x0002ca85, 0xf8834000,
+0xc5d47510, 0x62ffefc1, 0xfa4845f1, 0x6df362fc,
+0xffd22548, 0xf190f8c5, 0x487cf162, 0xf162f228,
+0x1d585864, 0x00100700, 0x4e7df262, 0x00bd3492,
+0x62001005, 0x1f484df3, 0xf8c500c3, 0xfa81d093,
+0x0000ffff, 0x000107b8, 0xdd850f00, 0x62000002,
+0x724865f1, 0xc03101f1, 0x497df262, 0xc05d1492,
+0x62001004, 0x29487cf1, 0x8b012454, 0x0100848c,
+0x518d0000, 0x24548901, 0x2444db38, 0x8444d938,
+0xdde9df40, 0x458a0fd8, 0x0f000002, 0x00024385,
+0xf8834000, 0x62d47510, 0xdb485df1, 0xefe1c5c9,
+0x75f362db, 0x04cb1f48, 0x4965f262, 0xf262cd64,
+0xc9274875, 0x11b9c031, 0x62000000, 0x92497df2,
+0x04c0a514, 0xf1620010, 0x5429487c, 0x84d90224,
+0x00008084, 0x40ca8900, 0xc285c229, 0x948b0974,
+0x0000bc84, 0x8b07eb00, 0x00fc8494, 0x89420000,
+0xdb382454, 0xd9382444, 0xdde9dfc9, 0xda8a0fd8,
+0x0f000001, 0x0001d885, 0x10f88300, 0xc031c075,
+0xd8dd02eb, 0x14d9eed9, 0x10072085, 0x803d4000,
+0x75000000, 0x40c031ed, 0x38244489, 0xdb10f883,
+0xd9382444, 0x753c845c, 0x7df162ee, 0xc00d6f48,
+0x62001006, 0x274875f2, 0x7cf162c9, 0x246c2848,
+0xeff1c501, 0x7df262c9, 0x0d2ca249, 0x00100720,
+0x072005d9, 0xeadf0010, 0x8a0fd9dd, 0x0000017a,
+0x000001b8, 0x73850f00, 0xd9000001, 0x07208504,
+0xe9df0010, 0x016d8a0f, 0x850f0000, 0x0000016b,
+0x10f88340, 0xf1c5e575, 0xf8c5c9ef, 0x3c247c90,
+0x487cf162, 0x01247c28, 0x4f7df262, 0x200d3ca2,
+0xd9001007, 0x10070405, 0x2005d900, 0xdf001007,
+0x0fd8dde9, 0x00013b8a, 0x0001b800, 0x850f0000,
+0x00000134, 0x208504d9, 0xdf001007, 0x2e8a0fe9,
+0x0f000001, 0x00012c85, 0xf8834000, 0xdde57510,
+0x0001b8d8, 0xf8c50000, 0x3c245490, 0x487df162,
+0x03246c6f, 0x487cf162, 0x01247428, 0x4a7df262,
+0x20ad34a2, 0x89001007, 0xd9382444, 0x07208504,
+0x44db0010, 0xc9d93824, 0xd8dde9df, 0x00ec8a0f,
+0x850f0000, 0x000000e6, 0x11f88340, 0x01b8d975,
+0xba000000, 0x00000011, 0x5c90f8c5, 0xf1623c24,
+0x646f487d, 0xf1620424, 0x7c28487c, 0xf2620124,
+0x3ca24b7d, 0x100720a5, 0x29d18900, 0x244c89c1,
+0x2444db3c, 0x8504d93c, 0x00100720, 0xd8dde9df,
+0x009f8a0f, 0x850f0000, 0x00000099, 0x11f88340,
+0xc031d775, 0x000095e9, 0xebd8dd00, 0xb8d8dd02,
+0x000000e7, 0x000085e9, 0xebd8dd00, 0xb8d8dd02,
+0x000000ef, 0xd8dd78eb, 0xd8dd02eb, 0x0000f7b8,
+0xdd6beb00, 0xdd02ebd8, 0x00ffb8d8, 0x5eeb0000,
+0x02ebd8dd, 0x15b8d8dd, 0xeb000001, 0xebd8dd51,
+0xb8d8dd02, 0x0000011e, 0xd8dd44eb, 0xd8dd02eb,
+0x000131b8, 0xdd37eb00, 0xdd02ebd8, 0x0134b8d8,
+0x2aeb0000, 0x02ebd8dd, 0x38b8d8dd, 0xeb000001,
+0xebd8dd1d, 0xb8d8dd02, 0x0000013b, 0x40b810eb,
+0xeb000001, 0x0145b809, 0x02eb0000, 0xc3c9d8dd,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+0x40a00000, 0x40c00000, 0x40e00000, 0x41000000,
+0x41100000, 0x41200000, 0x41300000, 0x41400000,
+0x41500000, 0x41600000, 0x41700000, 0x41800000,
+0x41880000, 0x41900000, 0x41980000, 0x41a00000,
+0x41a80000, 0x41b00000, 0x41b80000, 0x41c00000,
+0x41c80000, 0x41d00000, 0x41d80000, 0x41e00000,
+0x41e80000, 0x41f00000, 0x41f80000, 0x42000000,
+0x42040000, 0x42080000, 0x420c0000, 0x42100000,
+0x42140000, 0x42180000, 0x421c0000, 0x42200000,
+0x42240000, 0x42280000, 0x422c0000, 0x42300000,
+0x42340000, 0x42380000, 0x423c0000, 0x42400000,
+0x42440000, 0x42480000, 0x424c0000, 0x42500000,
+0x42540000, 0x42580000, 0x425c0000, 0x42600000,
+0x42640000, 0x42680000, 0x426c0000, 0x42700000,
+0x42740000, 0x42780000, 0x427c0000, 0x42800000,
+0x42820000, 0x42840000, 0x42860000, 0x42880000,
+0x428a0000, 0x428c0000, 0x428e0000, 0x42900000,
+0x42920000, 0x42940000, 0x42960000, 0x42980000,
+0x429a0000, 0x429c0000, 0x429e0000, 0x42a00000,
+0x42a20000, 0x42a40000, 0x42a60000, 0x42a80000,
+0x42aa0000, 0x42ac0000, 0x42ae0000, 0x42b00000,
+0x42b20000, 0x42b40000, 0x42b60000, 0x42b80000,
+0x42ba0000, 0x42bc0000, 0x42be0000, 0x42c00000,
+0x42c20000, 0x42c40000, 0x42c60000, 0x42c80000,
+0x42ca0000, 0x42cc0000, 0x42ce0000, 0x42d00000,
+0x42d20000, 0x42d40000, 0x42d60000, 0x42d80000,
+0x42da0000, 0x42dc0000, 0x42de0000, 0x42e00000,
+0x42e20000, 0x42e40000, 0x42e60000, 0x42e80000,
+0x42ea0000, 0x42ec0000, 0x42ee0000, 0x42f00000,
+0x42f20000, 0x42f40000, 0x42f60000, 0x42f80000,
+0x42fa0000, 0x42fc0000, 0x42fe0000, 0x43000000,
+0xffffffff, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0xbf800000, 0x41800000,
+0003410,
+};
+asm(".type avx512f_sg_x86_32_D_64x4f4, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_32_D_64x4f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_32_D_64x4f8[] = {
+0x315500eb, 0x83e589c0, 0xec81c0e4, 0x000000c0,
+0x0009ba40, 0x44890000, 0xc2293c84, 0x8908f883,
+0x755c8454, 0x75f362eb, 0xffc92548, 0x48f5f262,
+0xe1c5c927, 0xf362dbef, 0xc9254875, 0xfdf162ff,
+0xc5d12848, 0x0fc193f8, 0xf8c5c0be, 0x4489d190,
+0xc0313c24, 0x4afdf262, 0xc01d1492, 0x62001004,
+0x2948fdf1, 0xeb022454, 0xddd8dd02, 0x0080c484,
+0x54dd0000, 0xe8d93024, 0xe9dfc9d9, 0x03748a0f,
+0x850f0000, 0x00000372, 0x08f88340, 0x02b8db75,
+0xc5000000, 0x246c6ffd, 0xfdf16240, 0xc5d12848,
+0x62d990f8, 0x924bfdf2, 0x04c0ed14, 0xf1620010,
+0x542948fd, 0x44890224, 0x44dd3824, 0x54dd70c4,
+0x44db3024, 0xc9d93824, 0xd8dde9df, 0x03318a0f,
+0x850f0000, 0x0000032f, 0x0af88340, 0xe5c5d875,
+0xb803f572, 0x00000003, 0x48fdf162, 0xf8c5d128,
+0xf262e190, 0x14924cfd, 0x1004c05d, 0xfdf16200,
+0x24542948, 0x24448902, 0x8444dd38, 0x2454dd74,
+0x2444db30, 0xdfc9d938, 0x0fd8dde9, 0x0002ef8a,
+0xed850f00, 0x83000002, 0xf88302c0, 0x31d67513,
+0x6ffdc5c0, 0x62602454, 0x2848fdf1, 0x90f8c5d9,
+0xfdf262e9, 0xd51c924d, 0x001004c0, 0x48fdf162,
+0x02245c29, 0x60844c8b, 0x8901518d, 0xdb302454,
+0xdd302444, 0x0080c484, 0x54dd0000, 0xe9df3024,
+0x8a0fd8dd, 0x000002a5, 0x02a3850f, 0x83400000,
+0xd07508f8, 0xe4efd9c5, 0xe5faddc5, 0xf190f8c5,
+0x48fdf162, 0xf162e928, 0x1d5858e5, 0x00100900,
+0x4efdf262, 0x00e52c92, 0x62001005, 0x1f48d5f3,
+0xf8c500c3, 0xc2fed093, 0x000107b8, 0xba850f00,
+0xc5000002, 0x01f272ed, 0xf262c031, 0x0c9249fd,
+0x1004c095, 0xfdf16200, 0x244c2948, 0x844c8b02,
+0x01518d60, 0x30245489, 0x302444db, 0x80c484dd,
+0xdd000000, 0xdf302454, 0x0fd8dde9, 0x0002298a,
+0x27850f00, 0x40000002, 0x7508f883, 0x31c031d0,
+0xc51489d2, 0x00100940, 0x44c51489, 0x40001009,
+0x0000803d, 0xc7e87500, 0x00842484, 0x00000000,
+0x05d93ff0, 0x00100908, 0x8489c031, 0x00008024,
+0x249cdd00, 0x00000088, 0x090c05d9, 0x9cdd0010,
+0x00009024, 0x1005d900, 0xdd001009, 0x0098249c,
+0x05d90000, 0x00100914, 0xa0249cdd, 0xd9000000,
+0x10091805, 0x249cdd00, 0x000000a8, 0x091c05d9,
+0x9cdd0010, 0x0000b024, 0x2005d900, 0xdd001009,
+0x00b82494, 0xf1620000, 0x0d6f48fd, 0x001008c0,
+0x48f5f262, 0xf162c927, 0x742848fd, 0xf1c50224,
+0xf262c9ef, 0x34a249fd, 0x1009400d, 0x4005dd00,
+0xdf001009, 0x0fd9ddea, 0x00016a8a, 0x0001b800,
+0x850f0000, 0x00000163, 0xd8dd02eb, 0x04ddeed9,
+0x100940c5, 0x0fe9df00, 0x0001578a, 0x57850f00,
+0x40000001, 0x7508f883, 0x24448ae1, 0xeff1c53c,
+0xfdf162c9, 0x247c2848, 0x92f8c502, 0xfdf262f8,
+0x0d3ca24f, 0x00100940, 0x094005dd, 0xeadf0010,
+0x8a0fd9dd, 0x0000012d, 0x000001b8, 0x26850f00,
+0xdd000001, 0x0940c504, 0xe9df0010, 0x01208a0f,
+0x850f0000, 0x0000011e, 0x08f88340, 0xd8dde575,
+0x3c24448a, 0x746ffdc5, 0xf1624024, 0x7c2848fd,
+0xf8c50224, 0x01b8d092, 0x62000000, 0xa24afdf2,
+0x0940f53c, 0x44890010, 0x44db3024, 0x04dd3024,
+0x100940c5, 0xdde9df00, 0xe08a0fd8, 0x0f000000,
+0x0000da85, 0xf8834000, 0x8adb7509, 0xba3c2444,
+0x00000009, 0x646ffdc5, 0xf1626024, 0x742848fd,
+0xf8c50224, 0x01b8d892, 0x62000000, 0xa24bfdf2,
+0x0940e534, 0xd1890010, 0x4c89c129, 0x44db3c24,
+0x04dd3c24, 0x100940c5, 0xdde9df00, 0x938a0fd8,
+0x0f000000, 0x00008d85, 0xf8834000, 0x31d77509,
+0x0089e9c0, 0xd8dd0000, 0xd8dd02eb, 0x0000e7b8,
+0xdd7ceb00, 0xdd02ebd8, 0x00efb8d8, 0x6feb0000,
+0x02ebd8dd, 0xf7b8d8dd, 0xeb000000, 0xebd8dd62,
+0xb8d8dd02, 0x000000ff, 0xd8dd55eb, 0xd8dd02eb,
+0x000115b8, 0xdd48eb00, 0xdd02ebd8, 0x0131b8d8,
+0x3beb0000, 0xd8ddd8dd, 0xd8dd04eb, 0x34b8d8dd,
+0xeb000001, 0xebd8dd2a, 0xb8d8dd02, 0x00000138,
+0xd8dd1deb, 0xd8dd02eb, 0x00013bb8, 0xb810eb00,
+0x00000140, 0x45b809eb, 0xeb000001, 0xc9d8dd02,
+0x000000c3, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40100000,
+0x00000000, 0x40140000, 0x00000000, 0x40180000,
+0x00000000, 0x401c0000, 0x00000000, 0x40200000,
+0x00000000, 0x40220000, 0x00000000, 0x40240000,
+0x00000000, 0x40260000, 0x00000000, 0x40280000,
+0x00000000, 0x402a0000, 0x00000000, 0x402c0000,
+0x00000000, 0x402e0000, 0x00000000, 0x40300000,
+0x00000000, 0x40310000, 0x00000000, 0x40320000,
+0x00000000, 0x40330000, 0x00000000, 0x40340000,
+0x00000000, 0x40350000, 0x00000000, 0x40360000,
+0x00000000, 0x40370000, 0x00000000, 0x40380000,
+0x00000000, 0x40390000, 0x00000000, 0x403a0000,
+0x00000000, 0x403b0000, 0x00000000, 0x403c0000,
+0x00000000, 0x403d0000, 0x00000000, 0x403e0000,
+0x00000000, 0x403f0000, 0x00000000, 0x40400000,
+0x00000000, 0x40408000, 0x00000000, 0x40410000,
+0x00000000, 0x40418000, 0x00000000, 0x40420000,
+0x00000000, 0x40428000, 0x00000000, 0x40430000,
+0x00000000, 0x40438000, 0x00000000, 0x40440000,
+0x00000000, 0x40448000, 0x00000000, 0x40450000,
+0x00000000, 0x40458000, 0x00000000, 0x40460000,
+0x00000000, 0x40468000, 0x00000000, 0x40470000,
+0x00000000, 0x40478000, 0x00000000, 0x40480000,
+0x00000000, 0x40488000, 0x00000000, 0x40490000,
+0x00000000, 0x40498000, 0x00000000, 0x404a0000,
+0x00000000, 0x404a8000, 0x00000000, 0x404b0000,
+0x00000000, 0x404b8000, 0x00000000, 0x404c0000,
+0x00000000, 0x404c8000, 0x00000000, 0x404d0000,
+0x00000000, 0x404d8000, 0x00000000, 0x404e0000,
+0x00000000, 0x404e8000, 0x00000000, 0x404f0000,
+0x00000000, 0x404f8000, 0x00000000, 0x40500000,
+0x00000000, 0x40504000, 0x00000000, 0x40508000,
+0x00000000, 0x4050c000, 0x00000000, 0x40510000,
+0x00000000, 0x40514000, 0x00000000, 0x40518000,
+0x00000000, 0x4051c000, 0x00000000, 0x40520000,
+0x00000000, 0x40524000, 0x00000000, 0x40528000,
+0x00000000, 0x4052c000, 0x00000000, 0x40530000,
+0x00000000, 0x40534000, 0x00000000, 0x40538000,
+0x00000000, 0x4053c000, 0x00000000, 0x40540000,
+0x00000000, 0x40544000, 0x00000000, 0x40548000,
+0x00000000, 0x4054c000, 0x00000000, 0x40550000,
+0x00000000, 0x40554000, 0x00000000, 0x40558000,
+0x00000000, 0x4055c000, 0x00000000, 0x40560000,
+0x00000000, 0x40564000, 0x00000000, 0x40568000,
+0x00000000, 0x4056c000, 0x00000000, 0x40570000,
+0x00000000, 0x40574000, 0x00000000, 0x40578000,
+0x00000000, 0x4057c000, 0x00000000, 0x40580000,
+0x00000000, 0x40584000, 0x00000000, 0x40588000,
+0x00000000, 0x4058c000, 0x00000000, 0x40590000,
+0x00000000, 0x40594000, 0x00000000, 0x40598000,
+0x00000000, 0x4059c000, 0x00000000, 0x405a0000,
+0x00000000, 0x405a4000, 0x00000000, 0x405a8000,
+0x00000000, 0x405ac000, 0x00000000, 0x405b0000,
+0x00000000, 0x405b4000, 0x00000000, 0x405b8000,
+0x00000000, 0x405bc000, 0x00000000, 0x405c0000,
+0x00000000, 0x405c4000, 0x00000000, 0x405c8000,
+0x00000000, 0x405cc000, 0x00000000, 0x405d0000,
+0x00000000, 0x405d4000, 0x00000000, 0x405d8000,
+0x00000000, 0x405dc000, 0x00000000, 0x405e0000,
+0x00000000, 0x405e4000, 0x00000000, 0x405e8000,
+0x00000000, 0x405ec000, 0x00000000, 0x405f0000,
+0x00000000, 0x405f4000, 0x00000000, 0x405f8000,
+0x00000000, 0x405fc000, 0x00000000, 0x40600000,
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0xbff00000, 0x40000000, 0x40400000,
+0x40800000, 0x40a00000, 0x40c00000, 0x40e00000,
+0x41000000,
+0004444,
+};
+asm(".type avx512f_sg_x86_32_D_64x4f8, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_32_D_64x4f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_32_D_64x8i4[] = {
+0xb85500eb, 0x00000001, 0xd231e589, 0x83535657,
+0xec81c0e4, 0x000000c0, 0x3cc45489, 0x000009be,
+0x89ff3100, 0x2938c444, 0xc47489c6, 0x89d71978,
+0x837cc47c, 0xc68901c0, 0x8300d283, 0xd60909f6,
+0xf5c5d675, 0xf262c976, 0xd135487d, 0x48edf262,
+0xe1c5ca27, 0xfdc5dbef, 0xf8c5d16f, 0xbe0fc193,
+0x90f8c5c0, 0x244489d1, 0x62c0311c, 0x914a7df2,
+0x03a01d14, 0xfdc50010, 0x2024547f, 0x20847c83,
+0xd0850f01, 0x40000002, 0x7508f883, 0x0002b8ef,
+0xf1620000, 0x5c6f48fd, 0xfdc50124, 0xf8c5d16f,
+0xf262d990, 0x14914b7d, 0x1003a09d, 0x7ffdc500,
+0x39202454, 0x0f188444, 0x0002a185, 0xf8834000,
+0x62f0750a, 0x7348ddf1, 0x03b802f3, 0xc5000000,
+0xc5d16ffd, 0x62e190f8, 0x914c7df2, 0x03a06514,
+0xfdc50010, 0x2024547f, 0x1a444439, 0x0273850f,
+0xc0830000, 0x13f88302, 0xc031ee75, 0x48fdf162,
+0x0224646f, 0xd16ffdc5, 0xe990f8c5, 0x4d7df262,
+0xa0a51491, 0xc5001003, 0x24547ffd, 0x84548b20,
+0xc48c8b20, 0x00000080, 0x84c49c8b, 0x89000000,
+0x1fffc1d7, 0x8301c183, 0xdf3900d3, 0x022a850f,
+0xca390000, 0x0222850f, 0x83400000, 0xcd7508f8,
+0x000001b8, 0xefd1c500, 0xd5f162ed, 0xc5ebfb48,
+0xc5f190f8, 0x62d96ffd, 0x914e7df2, 0x03c0ad1c,
+0xf1620010, 0xe86e087d, 0x587de2c4, 0xfaedc5ed,
+0x7df262d5, 0x62d23548, 0x35487df2, 0xe5f362db,
+0x00c21f48, 0xd093f8c5, 0x07b8c2fe, 0x0f000001,
+0x0001ef85, 0xddf16200, 0x01f47348, 0xfdc5c031,
+0xf262f16f, 0x3491497d, 0x1003a065, 0x7ffdc500,
+0x8b202474, 0x8b208454, 0x0080c48c, 0x9c8b0000,
+0x000084c4, 0xc1d78900, 0xc1831fff, 0x00d38301,
+0x850fdf39, 0x0000018b, 0x850fca39, 0x00000183,
+0x08f88340, 0xc031cd75, 0x1489d231, 0x1005c085,
+0x803d4000, 0x75000000, 0x2444c7ef, 0x00000120,
+0x2444c700, 0x00000224, 0x2444c700, 0x00000328,
+0x2444c700, 0x0000042c, 0x2444c700, 0x00000530,
+0x2444c700, 0x00000634, 0x2444c700, 0x00000738,
+0x2444c700, 0x0000083c, 0x7df26200, 0xa00d3548,
+0x62001005, 0x2748f5f2, 0x6ffdc5c9, 0xc520247c,
+0xb8c9eff1, 0x00000131, 0x497df262, 0xc00d3ca1,
+0x83001005, 0x1005c03d, 0x850f0100, 0x00000114,
+0x000001b8, 0x853c8300, 0x001005c0, 0xe7850f00,
+0x40000000, 0x7508f883, 0x24448aec, 0xeff1c51c,
+0x6ffdc5c9, 0xc520247c, 0x62f892f8, 0xa14f7df2,
+0x05c00d3c, 0x3d830010, 0x001005c0, 0x0138b808,
+0x850f0000, 0x000000cc, 0x000001ba, 0x95048b00,
+0x001005c0, 0x850fc085, 0x000000a5, 0x08fa8342,
+0x5c8aeb75, 0x01ba1c24, 0x62000000, 0x6f48fdf1,
+0xc501247c, 0x24746ffd, 0x92f8c520, 0x7df262d3,
+0xbd34a14a, 0x001005c0, 0xc0951439, 0x75001005,
+0xfa834277, 0x8af17509, 0xba1c245c, 0x00000001,
+0x000009b9, 0xfdf16200, 0x246c6f48, 0x6ffdc502,
+0xc520247c, 0x62db92f8, 0xa14b7df2, 0x05c0ad3c,
+0xcb890010, 0x1c39d329, 0x1005c095, 0x42407500,
+0x7509fa83, 0xb83debed, 0x000000e7, 0xefb836eb,
+0xeb000000, 0x00f7b82f, 0x28eb0000, 0x0000ffb8,
+0xb821eb00, 0x00000115, 0x34b81aeb, 0xeb000001,
+0x013bb813, 0x0ceb0000, 0x000140b8, 0xb805eb00,
+0x00000145, 0x5bf4658d, 0xc35d5f5e, 0x00000000,
+0x00000001, 0x00000002, 0x00000003, 0x00000004,
+0x00000005, 0x00000006, 0x00000007, 0x00000008,
+0x00000009, 0x0000000a, 0x0000000b, 0x0000000c,
+0x0000000d, 0x0000000e, 0x0000000f, 0x00000010,
+0x00000011, 0x00000012, 0x00000013, 0x00000014,
+0x00000015, 0x00000016, 0x00000017, 0x00000018,
+0x00000019, 0x0000001a, 0x0000001b, 0x0000001c,
+0x0000001d, 0x0000001e, 0x0000001f, 0x00000020,
+0x00000021, 0x00000022, 0x00000023, 0x00000024,
+0x00000025, 0x00000026, 0x00000027, 0x00000028,
+0x00000029, 0x0000002a, 0x0000002b, 0x0000002c,
+0x0000002d, 0x0000002e, 0x0000002f, 0x00000030,
+0x00000031, 0x00000032, 0x00000033, 0x00000034,
+0x00000035, 0x00000036, 0x00000037, 0x00000038,
+0x00000039, 0x0000003a, 0x0000003b, 0x0000003c,
+0x0000003d, 0x0000003e, 0x0000003f, 0x00000040,
+0x00000041, 0x00000042, 0x00000043, 0x00000044,
+0x00000045, 0x00000046, 0x00000047, 0x00000048,
+0x00000049, 0x0000004a, 0x0000004b, 0x0000004c,
+0x0000004d, 0x0000004e, 0x0000004f, 0x00000050,
+0x00000051, 0x00000052, 0x00000053, 0x00000054,
+0x00000055, 0x00000056, 0x00000057, 0x00000058,
+0x00000059, 0x0000005a, 0x0000005b, 0x0000005c,
+0x0000005d, 0x0000005e, 0x0000005f, 0x00000060,
+0x00000061, 0x00000062, 0x00000063, 0x00000064,
+0x00000065, 0x00000066, 0x00000067, 0x00000068,
+0x00000069, 0x0000006a, 0x0000006b, 0x0000006c,
+0x0000006d, 0x0000006e, 0x0000006f, 0x00000070,
+0x00000071, 0x00000072, 0x00000073, 0x00000074,
+0x00000075, 0x00000076, 0x00000077, 0x00000078,
+0x00000079, 0x0000007a, 0x0000007b, 0x0000007c,
+0x0000007d, 0x0000007e, 0x0000007f, 0x00000080,
+0xffffffff, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0002700,
+};
+asm(".type avx512f_sg_x86_32_D_64x8i4, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_32_D_64x8i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_32_D_64x8i8[] = {
+0xb85500eb, 0x00000001, 0xd231e589, 0x83535657,
+0xec81c0e4, 0x00000140, 0xbcc49489, 0xb9000000,
+0x00000009, 0x8489db31, 0x0000b8c4, 0x89c12900,
+0x00f8c48c, 0xd3190000, 0xfcc49c89, 0x83000000,
+0xc18901c0, 0x8300d283, 0xd10909f1, 0xf362ca75,
+0xc9254875, 0xf5f262ff, 0xc5c92748, 0x62dbefe1,
+0x6f48fdf1, 0x93f8c5d1, 0xc0be0fc1, 0xd190f8c5,
+0x3c244489, 0xf262c031, 0x14914afd, 0x1005401d,
+0xfdf16200, 0x24547f48, 0xc47c8b01, 0x247c8940,
+0x83fa8930, 0x540b01f2, 0x850f44c4, 0x0000042d,
+0x08f88340, 0x02b8e375, 0x31000000, 0xfdf162d2,
+0x24546f48, 0xfdf16203, 0xc5d96f48, 0x62d990f8,
+0x914bfdf2, 0x0540d51c, 0xf1620010, 0x5c7f48fd,
+0x0c8d0124, 0x000000c5, 0x245c8d00, 0x39d90140,
+0x850ff451, 0x000003ec, 0x0ff04139, 0x0003e385,
+0x01c08300, 0xd283c189, 0x0af18300, 0xd275d109,
+0x48ddf162, 0xb803f273, 0x00000003, 0x48fdf162,
+0xd231d96f, 0xe190f8c5, 0x4cfdf262, 0x40651c91,
+0x62001005, 0x7f48fdf1, 0x8d01245c, 0x0000850c,
+0x5c8d0000, 0xd9014024, 0x0ff85139, 0x00039a85,
+0xf4413900, 0x0391850f, 0xc0830000, 0x83c18902,
+0xf18300d2, 0x75d10913, 0x62c031d2, 0x6f48fdf1,
+0x6204245c, 0x6f48fdf1, 0x90f8c5e1, 0xfdf262e9,
+0xdd24914d, 0x00100540, 0x48fdf162, 0x0124647f,
+0x00c4b48b, 0x8b000001, 0x0104c4bc, 0x74890000,
+0xf1893024, 0x34247c89, 0x8901c183, 0x00d383fb,
+0x44c45c39, 0x0338850f, 0x4c390000, 0x850f40c4,
+0x0000032e, 0x08f88340, 0xf162c675, 0x25fb58dd,
+0x00100980, 0xedefd1c5, 0x48d5f162, 0xf162eafb,
+0xf16f48fd, 0xf190f8c5, 0x4efdf262, 0x80ed3491,
+0x62001005, 0x1f48cdf3, 0xf8c500c4, 0xc2fed093,
+0x000107b8, 0x16850f00, 0x62000003, 0x7348d5f1,
+0xc03101f3, 0x48fdf162, 0xf262e16f, 0x249149fd,
+0x100540ad, 0xfdf16200, 0x24647f48, 0xc4b48b01,
+0x00000100, 0x04c4bc8b, 0x89000001, 0x89302474,
+0x247c89f1, 0x01c18334, 0xd383fb89, 0xc45c3900,
+0xa2850f44, 0x39000002, 0x0f40c44c, 0x00029885,
+0xf8834000, 0x62c67508, 0xdb48edf1, 0xefd1c5db,
+0xe5f362ed, 0x04cd1f48, 0x49d5f262, 0xf262d964,
+0xcb2748e5, 0x09bac031, 0x62000000, 0x9149fdf2,
+0x0540d524, 0xf1620010, 0x647f48fd, 0xb48b0224,
+0x000080c4, 0x8bd18900, 0x0084c4bc, 0x29400000,
+0x74c185c1, 0xc48c8b18, 0x000000b8, 0xbcc49c8b,
+0x89000000, 0x8930244c, 0xeb34245c, 0xc48c8b0e,
+0x000000f8, 0xfcc49c8b, 0x83000000, 0xd38301c1,
+0x0fdf3900, 0x00021785, 0x0fce3900, 0x00020f85,
+0x08f88300, 0xc031a875, 0x1489d231, 0x1009a0c5,
+0xc5148900, 0x001009a4, 0x00803d40, 0xe8750000,
+0xd231c031, 0x44244489, 0xc931c031, 0xf631db31,
+0x74244489, 0xc031ff31, 0x402444c7, 0x00000001,
+0x482444c7, 0x00000002, 0x4c245489, 0x502444c7,
+0x00000003, 0x54244c89, 0x582444c7, 0x00000004,
+0x5c245c89, 0x602444c7, 0x00000005, 0x64247489,
+0x682444c7, 0x00000006, 0x6c247c89, 0x702444c7,
+0x00000007, 0x782444c7, 0x00000008, 0x7c244489,
+0x48fdf162, 0x09400d6f, 0xf2620010, 0xc92748f5,
+0x48fdf162, 0x01247c6f, 0xc9eff1c5, 0x000131b8,
+0xfdf26200, 0x0d3ca149, 0x001009a0, 0x09a0158b,
+0xf2830010, 0xa4150b01, 0x0f001009, 0x00016085,
+0x0001b800, 0x148b0000, 0x1009a4c5, 0xc5140b00,
+0x001009a0, 0x012d850f, 0x83400000, 0xe67508f8,
+0x3c24448a, 0xc9eff1c5, 0x48fdf162, 0x01247c6f,
+0xf892f8c5, 0x4ffdf262, 0xa00d3ca1, 0x8b001009,
+0x1009a015, 0x0138b800, 0xf2830000, 0xa4150b08,
+0x0f001009, 0x00010885, 0x0001b800, 0x148b0000,
+0x1009a4c5, 0xc5140b00, 0x001009a0, 0x00dc850f,
+0x83400000, 0xe67508f8, 0x3c24448a, 0xf162d231,
+0x7c6f48fd, 0xf1620324, 0x746f48fd, 0xf8c50124,
+0x01b8d092, 0x62000000, 0xa14afdf2, 0x09a0fd34,
+0x0c8d0010, 0x000000c5, 0xa4913900, 0x0f001009,
+0x0000a085, 0xa0813900, 0x0f001009, 0x00009485,
+0x01c08300, 0xd283c189, 0x09f18300, 0xd275d109,
+0x3c24448a, 0xf162d231, 0x7c6f48fd, 0xf1620424,
+0x746f48fd, 0xf8c50124, 0x08b8d892, 0x62000000,
+0xa14bfdf2, 0x09a0fd34, 0xc86b0010, 0xec9139f8,
+0x75001009, 0xe8813957, 0x75001009, 0xffc0834f,
+0x89ffd283, 0x75c709d7, 0xebc031e1, 0x00e7b844,
+0x3deb0000, 0x0000efb8, 0xb836eb00, 0x000000f7,
+0xffb82feb, 0xeb000000, 0x0115b828, 0x21eb0000,
+0x00011eb8, 0xb81aeb00, 0x00000134, 0x3bb813eb,
+0xeb000001, 0x0140b80c, 0x05eb0000, 0x000145b8,
+0xf4658d00, 0x5d5f5e5b, 0x000000c3, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000000, 0x00000002, 0x00000000,
+0x00000003, 0x00000000, 0x00000004, 0x00000000,
+0x00000005, 0x00000000, 0x00000006, 0x00000000,
+0x00000007, 0x00000000, 0x00000008, 0x00000000,
+0x00000009, 0x00000000, 0x0000000a, 0x00000000,
+0x0000000b, 0x00000000, 0x0000000c, 0x00000000,
+0x0000000d, 0x00000000, 0x0000000e, 0x00000000,
+0x0000000f, 0x00000000, 0x00000010, 0x00000000,
+0x00000011, 0x00000000, 0x00000012, 0x00000000,
+0x00000013, 0x00000000, 0x00000014, 0x00000000,
+0x00000015, 0x00000000, 0x00000016, 0x00000000,
+0x00000017, 0x00000000, 0x00000018, 0x00000000,
+0x00000019, 0x00000000, 0x0000001a, 0x00000000,
+0x0000001b, 0x00000000, 0x0000001c, 0x00000000,
+0x0000001d, 0x00000000, 0x0000001e, 0x00000000,
+0x0000001f, 0x00000000, 0x00000020, 0x00000000,
+0x00000021, 0x00000000, 0x00000022, 0x00000000,
+0x00000023, 0x00000000, 0x00000024, 0x00000000,
+0x00000025, 0x00000000, 0x00000026, 0x00000000,
+0x00000027, 0x00000000, 0x00000028, 0x00000000,
+0x00000029, 0x00000000, 0x0000002a, 0x00000000,
+0x0000002b, 0x00000000, 0x0000002c, 0x00000000,
+0x0000002d, 0x00000000, 0x0000002e, 0x00000000,
+0x0000002f, 0x00000000, 0x00000030, 0x00000000,
+0x00000031, 0x00000000, 0x00000032, 0x00000000,
+0x00000033, 0x00000000, 0x00000034, 0x00000000,
+0x00000035, 0x00000000, 0x00000036, 0x00000000,
+0x00000037, 0x00000000, 0x00000038, 0x00000000,
+0x00000039, 0x00000000, 0x0000003a, 0x00000000,
+0x0000003b, 0x00000000, 0x0000003c, 0x00000000,
+0x0000003d, 0x00000000, 0x0000003e, 0x00000000,
+0x0000003f, 0x00000000, 0x00000040, 0x00000000,
+0x00000041, 0x00000000, 0x00000042, 0x00000000,
+0x00000043, 0x00000000, 0x00000044, 0x00000000,
+0x00000045, 0x00000000, 0x00000046, 0x00000000,
+0x00000047, 0x00000000, 0x00000048, 0x00000000,
+0x00000049, 0x00000000, 0x0000004a, 0x00000000,
+0x0000004b, 0x00000000, 0x0000004c, 0x00000000,
+0x0000004d, 0x00000000, 0x0000004e, 0x00000000,
+0x0000004f, 0x00000000, 0x00000050, 0x00000000,
+0x00000051, 0x00000000, 0x00000052, 0x00000000,
+0x00000053, 0x00000000, 0x00000054, 0x00000000,
+0x00000055, 0x00000000, 0x00000056, 0x00000000,
+0x00000057, 0x00000000, 0x00000058, 0x00000000,
+0x00000059, 0x00000000, 0x0000005a, 0x00000000,
+0x0000005b, 0x00000000, 0x0000005c, 0x00000000,
+0x0000005d, 0x00000000, 0x0000005e, 0x00000000,
+0x0000005f, 0x00000000, 0x00000060, 0x00000000,
+0x00000061, 0x00000000, 0x00000062, 0x00000000,
+0x00000063, 0x00000000, 0x00000064, 0x00000000,
+0x00000065, 0x00000000, 0x00000066, 0x00000000,
+0x00000067, 0x00000000, 0x00000068, 0x00000000,
+0x00000069, 0x00000000, 0x0000006a, 0x00000000,
+0x0000006b, 0x00000000, 0x0000006c, 0x00000000,
+0x0000006d, 0x00000000, 0x0000006e, 0x00000000,
+0x0000006f, 0x00000000, 0x00000070, 0x00000000,
+0x00000071, 0x00000000, 0x00000072, 0x00000000,
+0x00000073, 0x00000000, 0x00000074, 0x00000000,
+0x00000075, 0x00000000, 0x00000076, 0x00000000,
+0x00000077, 0x00000000, 0x00000078, 0x00000000,
+0x00000079, 0x00000000, 0x0000007a, 0x00000000,
+0x0000007b, 0x00000000, 0x0000007c, 0x00000000,
+0x0000007d, 0x00000000, 0x0000007e, 0x00000000,
+0x0000007f, 0x00000000, 0x00000080, 0x00000000,
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000000,
+0004610,
+};
+asm(".type avx512f_sg_x86_32_D_64x8i8, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_32_D_64x8i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_32_D_64x8f4[] = {
+0xb85500eb, 0x00000001, 0xd231e589, 0xe4835356,
+0xc0ec81c0, 0x89000000, 0xb93cc454, 0x00000009,
+0x4489db31, 0xc12938c4, 0x78c44c89, 0x5c89d319,
+0xc0837cc4, 0x83c18901, 0xf18300d2, 0x75d10909,
+0x76f5c5d6, 0x7df262c9, 0x62c93548, 0x2748f5f2,
+0xefe1c5c9, 0x76f5c5db, 0x28fcc5c9, 0x93f8c5d1,
+0xc0be0fc1, 0xd190f8c5, 0x1c244489, 0xf262c031,
+0x14934a7d, 0x1004801d, 0x29fcc500, 0xeb202454,
+0xd9d8dd02, 0x8444d9e8, 0x0fe9df20, 0x0003538a,
+0x51850f00, 0x40000003, 0x7508f883, 0x0002b8e4,
+0xf1620000, 0x5c6f48fd, 0xfcc50124, 0xf8c5d128,
+0xf262d990, 0x14934b7d, 0x1004809d, 0x29fcc500,
+0x89202454, 0xd9102444, 0xdb188444, 0xd9102444,
+0xdde9dfc9, 0x198a0fd8, 0x0f000003, 0x00031785,
+0xf8834000, 0x62dc750a, 0x7348ddf1, 0x03b802f3,
+0xc5000000, 0xc5d128fc, 0x62e190f8, 0x934c7df2,
+0x04806514, 0xfcc50010, 0x20245429, 0x10244489,
+0x1a4444d9, 0x102444db, 0xe9dfc9d9, 0x8a0fd8dd,
+0x000002dd, 0x02db850f, 0xc0830000, 0x13f88302,
+0xc931da75, 0x48fdf162, 0x0224646f, 0xd128fcc5,
+0xe990f8c5, 0x4d7df262, 0x80a51493, 0xc5001004,
+0x245429fc, 0xcc848b20, 0x00000080, 0x84cc948b,
+0x83000000, 0x448901c0, 0xd2831024, 0x24548900,
+0x246cdf14, 0x8c44d910, 0xdde9df20, 0x8b8a0fd8,
+0x0f000002, 0x00028985, 0xf9834100, 0xc5c67508,
+0x62edefd1, 0xfb48d5f1, 0x90f8c5eb, 0x28fcc5f1,
+0x7df262d9, 0xad1c934e, 0x001004a0, 0x187de2c4,
+0x1006802d, 0x7df26200, 0xc5db3548, 0x62d558ec,
+0x35487df2, 0xe5f362d2, 0x00c21f48, 0xd093f8c5,
+0x07b8c2fe, 0x0f000001, 0x00029585, 0xddf16200,
+0x01f47348, 0xfcc5c931, 0xf262f128, 0x3493497d,
+0x10048065, 0x29fcc500, 0x8b202474, 0x0080cc84,
+0x948b0000, 0x000084cc, 0x01c08300, 0x10244489,
+0x8900d283, 0xdf142454, 0xd910246c, 0xdf208c44,
+0x0fd8dde9, 0x0001f28a, 0xf0850f00, 0x41000001,
+0x7508f983, 0xebc031c6, 0xd9d8dd02, 0x8514d9ee,
+0x001006c0, 0x00803d40, 0xed750000, 0x44c7c9d9,
+0x00002424, 0x54d94000, 0x44c72024, 0x00002824,
+0x05d94040, 0x00100684, 0x2c2444c7, 0x40800000,
+0x302444c7, 0x40a00000, 0x3c2454d9, 0x342444c7,
+0x40c00000, 0x382444c7, 0x40e00000, 0x487df262,
+0x06a00d35, 0xf2620010, 0xc92748f5, 0x7c28fcc5,
+0xf1c52024, 0xf262c9ef, 0x3ca3497d, 0x1006c00d,
+0xc005d900, 0xdf001006, 0x0fd9ddea, 0x0001678a,
+0x0001b800, 0x850f0000, 0x00000162, 0xc08504d9,
+0xdf001006, 0x5e8a0fea, 0x0f000001, 0x00015e85,
+0xf8834000, 0x8ae57508, 0xc51c2444, 0xc5c9eff1,
+0x247c28fc, 0x92f8c520, 0x7df262f8, 0x0d3ca34f,
+0x001006c0, 0x06c005d9, 0xe9df0010, 0x8a0fd8dd,
+0x00000136, 0x000001b8, 0x2f850f00, 0xd9000001,
+0x06c08504, 0xe9df0010, 0x01298a0f, 0x850f0000,
+0x00000127, 0x08f88340, 0xd8dde575, 0x1c24448a,
+0x48fdf162, 0x01247c6f, 0x7428fcc5, 0xf8c52024,
+0x01b8d092, 0x62000000, 0xa34a7df2, 0x06c0bd34,
+0x44890010, 0x04d91024, 0x1006c085, 0x2444db00,
+0xdfc9d910, 0x0fd8dde9, 0x0000e78a, 0xe1850f00,
+0x40000000, 0x7509f883, 0x24448ad9, 0x0009ba1c,
+0xf1620000, 0x6c6f48fd, 0xfcc50224, 0x20247c28,
+0xd892f8c5, 0x000001b8, 0x7df26200, 0xad3ca34b,
+0x001006c0, 0xc129d189, 0x1c244c89, 0x1c2444db,
+0xc08504d9, 0xdf001006, 0x0fd8dde9, 0x00009a8a,
+0x94850f00, 0x40000000, 0x7509f883, 0xe9c031d7,
+0x00000090, 0x02ebd8dd, 0xe7b8d8dd, 0xe9000000,
+0x00000080, 0x02ebd8dd, 0xefb8d8dd, 0xeb000000,
+0xebd8dd73, 0xb8d8dd02, 0x000000f7, 0xd8dd66eb,
+0xd8dd02eb, 0x0000ffb8, 0xdd59eb00, 0xdd02ebd8,
+0x0115b8d8, 0x4ceb0000, 0xd8ddd8dd, 0xd8dd04eb,
+0x31b8d8dd, 0xeb000001, 0xddd8dd3b, 0xdd04ebd8,
+0xb8d8ddd8, 0x00000134, 0xd8dd2aeb, 0xd8dd02eb,
+0x000138b8, 0xdd1deb00, 0xdd02ebd8, 0x013bb8d8,
+0x10eb0000, 0x000140b8, 0xb809eb00, 0x00000145,
+0xd8dd02eb, 0x5bf8658d, 0x00c35d5e, 0x00000000,
+0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+0x40a00000, 0x40c00000, 0x40e00000, 0x41000000,
+0x41100000, 0x41200000, 0x41300000, 0x41400000,
+0x41500000, 0x41600000, 0x41700000, 0x41800000,
+0x41880000, 0x41900000, 0x41980000, 0x41a00000,
+0x41a80000, 0x41b00000, 0x41b80000, 0x41c00000,
+0x41c80000, 0x41d00000, 0x41d80000, 0x41e00000,
+0x41e80000, 0x41f00000, 0x41f80000, 0x42000000,
+0x42040000, 0x42080000, 0x420c0000, 0x42100000,
+0x42140000, 0x42180000, 0x421c0000, 0x42200000,
+0x42240000, 0x42280000, 0x422c0000, 0x42300000,
+0x42340000, 0x42380000, 0x423c0000, 0x42400000,
+0x42440000, 0x42480000, 0x424c0000, 0x42500000,
+0x42540000, 0x42580000, 0x425c0000, 0x42600000,
+0x42640000, 0x42680000, 0x426c0000, 0x42700000,
+0x42740000, 0x42780000, 0x427c0000, 0x42800000,
+0x42820000, 0x42840000, 0x42860000, 0x42880000,
+0x428a0000, 0x428c0000, 0x428e0000, 0x42900000,
+0x42920000, 0x42940000, 0x42960000, 0x42980000,
+0x429a0000, 0x429c0000, 0x429e0000, 0x42a00000,
+0x42a20000, 0x42a40000, 0x42a60000, 0x42a80000,
+0x42aa0000, 0x42ac0000, 0x42ae0000, 0x42b00000,
+0x42b20000, 0x42b40000, 0x42b60000, 0x42b80000,
+0x42ba0000, 0x42bc0000, 0x42be0000, 0x42c00000,
+0x42c20000, 0x42c40000, 0x42c60000, 0x42c80000,
+0x42ca0000, 0x42cc0000, 0x42ce0000, 0x42d00000,
+0x42d20000, 0x42d40000, 0x42d60000, 0x42d80000,
+0x42da0000, 0x42dc0000, 0x42de0000, 0x42e00000,
+0x42e20000, 0x42e40000, 0x42e60000, 0x42e80000,
+0x42ea0000, 0x42ec0000, 0x42ee0000, 0x42f00000,
+0x42f20000, 0x42f40000, 0x42f60000, 0x42f80000,
+0x42fa0000, 0x42fc0000, 0x42fe0000, 0x43000000,
+0xbf800000, 0x41000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0xffffffff, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0003300,
+};
+asm(".type avx512f_sg_x86_32_D_64x8f4, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_32_D_64x8f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_32_D_64x8f8[] = {
+0xb85500eb, 0x00000001, 0xd231e589, 0xe4835356,
+0x40ec81c0, 0x89000001, 0x00bcc494, 0x09b90000,
+0x31000000, 0xc48489db, 0x000000b8, 0x8c89c129,
+0x0000f8c4, 0x89d31900, 0x00fcc49c, 0xc0830000,
+0x83c18901, 0xf18300d2, 0x75d10909, 0x55f362ca,
+0xffed2548, 0x48d5f262, 0xf362cd27, 0xdb254865,
+0xefe9c5ff, 0xfdf162d2, 0xc5cb2848, 0x0fc193f8,
+0xf8c5c0be, 0x4489d190, 0xc0313c24, 0x4afdf262,
+0x80150c93, 0x62001005, 0x2948fdf1, 0xeb01244c,
+0xddd8dd02, 0xdd40c444, 0xd9302454, 0xdfc9d9e8,
+0x0a8a0fe9, 0x0f000004, 0x00040885, 0xf8834000,
+0xb8de7508, 0x00000002, 0x48fdf162, 0x0324646f,
+0x48fdf162, 0xf8c5cb28, 0xf262d990, 0x0c934bfd,
+0x100580e5, 0xfdf16200, 0x244c2948, 0x24448901,
+0xc444dd38, 0x2454dd30, 0x2444db30, 0xdfc9d938,
+0x0fd8dde9, 0x0003c88a, 0xc6850f00, 0x40000003,
+0x750af883, 0xedf162d8, 0x03f47348, 0x000003b8,
+0xfdf16200, 0xc5cb2848, 0x62e190f8, 0x934cfdf2,
+0x0580550c, 0xf1620010, 0x4c2948fd, 0x44890124,
+0x44dd3824, 0x54dd3484, 0x44db3024, 0xc9d93824,
+0xd8dde9df, 0x03848a0f, 0x850f0000, 0x00000382,
+0x8302c083, 0xd67513f8, 0xf162c931, 0x4c6f48fd,
+0xf8c50424, 0xf262e990, 0x1c934dfd, 0x100580cd,
+0xfdf16200, 0x245c2948, 0xcc848b01, 0x00000100,
+0x04cc948b, 0x83000001, 0x448901c0, 0xd2833024,
+0x24548900, 0x246cdf34, 0xcc44dd30, 0xdde9df40,
+0x348a0fd8, 0x0f000003, 0x00033285, 0xf9834100,
+0xc5c67508, 0x62ffefc1, 0xfb48c5f1, 0x6df362fc,
+0xffd22548, 0xf190f8c5, 0x48fdf162, 0xf162f228,
+0x1d5858e5, 0x001009c0, 0x4efdf262, 0xc0fd3493,
+0x62001005, 0x1f48cdf3, 0xf8c500c3, 0xc2fed093,
+0x000107b8, 0x4d850f00, 0x62000003, 0x7348e5f1,
+0xc93101f1, 0x49fdf262, 0x809d1493, 0x62001005,
+0x2948fdf1, 0x8b012454, 0x0100cc84, 0x948b0000,
+0x000104cc, 0x01c08300, 0x30244489, 0x8900d283,
+0xdf342454, 0xdd30246c, 0xdf40cc44, 0x0fd8dde9,
+0x0002a38a, 0xa1850f00, 0x41000002, 0x7508f983,
+0xddf162c6, 0xc5c9db48, 0x62dbefe1, 0x1f48f5f3,
+0xf26204cb, 0xcd6449e5, 0x48f5f262, 0xc931c927,
+0x000009bb, 0xfdf26200, 0xe5149349, 0x00100580,
+0x48fdf162, 0x02245429, 0x80cc84dd, 0x89000000,
+0xc82941d8, 0x1074c885, 0xb8cc848b, 0x8b000000,
+0x00bccc94, 0x0eeb0000, 0xf8cc848b, 0x8b000000,
+0x00fccc94, 0xc0830000, 0x24448901, 0x00d28330,
+0x34245489, 0x30246cdf, 0xe9dfc9d9, 0x8a0fd8dd,
+0x00000221, 0x021f850f, 0xf9830000, 0x31a97508,
+0x89d231c0, 0x0a00c514, 0x14890010, 0x100a04c5,
+0x803d4000, 0x75000000, 0x2444c7e8, 0xf0000044,
+0xc805d93f, 0x31001009, 0x244489c0, 0x245cdd40,
+0xcc05d948, 0xdd001009, 0xd950245c, 0x1009d005,
+0x245cdd00, 0xd405d958, 0xdd001009, 0xd960245c,
+0x1009d805, 0x245cdd00, 0xdc05d968, 0xdd001009,
+0xd970245c, 0x1009e005, 0x2454dd00, 0xfdf16278,
+0x800d6f48, 0x62001009, 0x2748f5f2, 0xfdf162c9,
+0x246c2848, 0xeff1c501, 0xfdf262c9, 0x0d2ca349,
+0x00100a00, 0x0a0005dd, 0xeadf0010, 0x8a0fd9dd,
+0x0000017e, 0x000001b8, 0x77850f00, 0xeb000001,
+0xd9d8dd02, 0xc504ddee, 0x00100a00, 0x8a0fe9df,
+0x0000016b, 0x016b850f, 0x83400000, 0xe17508f8,
+0x3c24448a, 0xc9eff1c5, 0x48fdf162, 0x01247c28,
+0xf892f8c5, 0x4ffdf262, 0x000d3ca3, 0xdd00100a,
+0x100a0005, 0xddeadf00, 0x418a0fd9, 0xb8000001,
+0x00000001, 0x013a850f, 0x04dd0000, 0x100a00c5,
+0x0fe9df00, 0x0001348a, 0x32850f00, 0x40000001,
+0x7508f883, 0x8ad8dde5, 0x623c2444, 0x6f48fdf1,
+0x6203246c, 0x2848fdf1, 0xc5012474, 0xb8d092f8,
+0x00000001, 0x4afdf262, 0x00ed34a3, 0x8900100a,
+0xdb302444, 0xdd302444, 0x0a00c504, 0xe9df0010,
+0x8a0fd8dd, 0x000000f2, 0x00ec850f, 0x83400000,
+0xdb7509f8, 0x3c24448a, 0x000009ba, 0xfdf16200,
+0x24646f48, 0xfdf16204, 0x247c2848, 0x92f8c501,
+0x0001b8d8, 0xf2620000, 0x3ca34bfd, 0x100a00e5,
+0x29d18900, 0x244c89c1, 0x2444db3c, 0xc504dd3c,
+0x00100a00, 0xd8dde9df, 0x00a38a0f, 0x850f0000,
+0x0000009d, 0x09f88340, 0xc031d775, 0x000099e9,
+0xebd8dd00, 0xb8d8dd02, 0x000000e7, 0x000089e9,
+0xebd8dd00, 0xb8d8dd02, 0x000000ef, 0xd8dd7ceb,
+0xd8dd02eb, 0x0000f7b8, 0xdd6feb00, 0xdd02ebd8,
+0x00ffb8d8, 0x62eb0000, 0x02ebd8dd, 0x15b8d8dd,
+0xeb000001, 0xebd8dd55, 0xb8d8dd02, 0x0000011e,
+0xd8dd48eb, 0xd8dd02eb, 0x000131b8, 0xdd3beb00,
+0xebd8ddd8, 0xddd8dd04, 0x0134b8d8, 0x2aeb0000,
+0x02ebd8dd, 0x38b8d8dd, 0xeb000001, 0xebd8dd1d,
+0xb8d8dd02, 0x0000013b, 0x40b810eb, 0xeb000001,
+0x0145b809, 0x02eb0000, 0x658dd8dd, 0x5d5e5bf8,
+0x000000c3, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40100000,
+0x00000000, 0x40140000, 0x00000000, 0x40180000,
+0x00000000, 0x401c0000, 0x00000000, 0x40200000,
+0x00000000, 0x40220000, 0x00000000, 0x40240000,
+0x00000000, 0x40260000, 0x00000000, 0x40280000,
+0x00000000, 0x402a0000, 0x00000000, 0x402c0000,
+0x00000000, 0x402e0000, 0x00000000, 0x40300000,
+0x00000000, 0x40310000, 0x00000000, 0x40320000,
+0x00000000, 0x40330000, 0x00000000, 0x40340000,
+0x00000000, 0x40350000, 0x00000000, 0x40360000,
+0x00000000, 0x40370000, 0x00000000, 0x40380000,
+0x00000000, 0x40390000, 0x00000000, 0x403a0000,
+0x00000000, 0x403b0000, 0x00000000, 0x403c0000,
+0x00000000, 0x403d0000, 0x00000000, 0x403e0000,
+0x00000000, 0x403f0000, 0x00000000, 0x40400000,
+0x00000000, 0x40408000, 0x00000000, 0x40410000,
+0x00000000, 0x40418000, 0x00000000, 0x40420000,
+0x00000000, 0x40428000, 0x00000000, 0x40430000,
+0x00000000, 0x40438000, 0x00000000, 0x40440000,
+0x00000000, 0x40448000, 0x00000000, 0x40450000,
+0x00000000, 0x40458000, 0x00000000, 0x40460000,
+0x00000000, 0x40468000, 0x00000000, 0x40470000,
+0x00000000, 0x40478000, 0x00000000, 0x40480000,
+0x00000000, 0x40488000, 0x00000000, 0x40490000,
+0x00000000, 0x40498000, 0x00000000, 0x404a0000,
+0x00000000, 0x404a8000, 0x00000000, 0x404b0000,
+0x00000000, 0x404b8000, 0x00000000, 0x404c0000,
+0x00000000, 0x404c8000, 0x00000000, 0x404d0000,
+0x00000000, 0x404d8000, 0x00000000, 0x404e0000,
+0x00000000, 0x404e8000, 0x00000000, 0x404f0000,
+0x00000000, 0x404f8000, 0x00000000, 0x40500000,
+0x00000000, 0x40504000, 0x00000000, 0x40508000,
+0x00000000, 0x4050c000, 0x00000000, 0x40510000,
+0x00000000, 0x40514000, 0x00000000, 0x40518000,
+0x00000000, 0x4051c000, 0x00000000, 0x40520000,
+0x00000000, 0x40524000, 0x00000000, 0x40528000,
+0x00000000, 0x4052c000, 0x00000000, 0x40530000,
+0x00000000, 0x40534000, 0x00000000, 0x40538000,
+0x00000000, 0x4053c000, 0x00000000, 0x40540000,
+0x00000000, 0x40544000, 0x00000000, 0x40548000,
+0x00000000, 0x4054c000, 0x00000000, 0x40550000,
+0x00000000, 0x40554000, 0x00000000, 0x40558000,
+0x00000000, 0x4055c000, 0x00000000, 0x40560000,
+0x00000000, 0x40564000, 0x00000000, 0x40568000,
+0x00000000, 0x4056c000, 0x00000000, 0x40570000,
+0x00000000, 0x40574000, 0x00000000, 0x40578000,
+0x00000000, 0x4057c000, 0x00000000, 0x40580000,
+0x00000000, 0x40584000, 0x00000000, 0x40588000,
+0x00000000, 0x4058c000, 0x00000000, 0x40590000,
+0x00000000, 0x40594000, 0x00000000, 0x40598000,
+0x00000000, 0x4059c000, 0x00000000, 0x405a0000,
+0x00000000, 0x405a4000, 0x00000000, 0x405a8000,
+0x00000000, 0x405ac000, 0x00000000, 0x405b0000,
+0x00000000, 0x405b4000, 0x00000000, 0x405b8000,
+0x00000000, 0x405bc000, 0x00000000, 0x405c0000,
+0x00000000, 0x405c4000, 0x00000000, 0x405c8000,
+0x00000000, 0x405cc000, 0x00000000, 0x405d0000,
+0x00000000, 0x405d4000, 0x00000000, 0x405d8000,
+0x00000000, 0x405dc000, 0x00000000, 0x405e0000,
+0x00000000, 0x405e4000, 0x00000000, 0x405e8000,
+0x00000000, 0x405ec000, 0x00000000, 0x405f0000,
+0x00000000, 0x405f4000, 0x00000000, 0x405f8000,
+0x00000000, 0x405fc000, 0x00000000, 0x40600000,
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0xbff00000, 0x40000000, 0x40400000,
+0x40800000, 0x40a00000, 0x40c00000, 0x40e00000,
+0x41000000,
+0004744,
+};
+asm(".type avx512f_sg_x86_32_D_64x8f8, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_32_D_64x8f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_32_D_16x4i4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xe58955c3,
+0x54ec8353, 0x01d845c7, 0xc7000000, 0x0004e845,
+0x45c70000, 0x000002dc, 0xec45c700, 0x00000003,
+0x03e045c7, 0xc7000000, 0x0002f045, 0x45c70000,
+0x000004e4, 0xf445c700, 0x00000001, 0xd276e9c5,
+0x086df262, 0xf162ca27, 0xdbef0865, 0x087df162,
+0xf8c5ca6f, 0xbe0fc193, 0x90f8c5c0, 0xb44589d1,
+0xf262c031, 0x0c900a7d, 0x1004401d, 0x7df16200,
+0xb88d7f08, 0x83ffffff, 0x01b8857c, 0x036f850f,
+0x83400000, 0xef7504f8, 0x087df162, 0xffd89d6f,
+0xf162ffff, 0xca6f087d, 0xd990f8c5, 0x0b7df262,
+0x409d0c90, 0x62001004, 0x7e087df1, 0x02fa83ca,
+0x0000efb8, 0x7df16200, 0xb88d7f08, 0x0fffffff,
+0x00035b85, 0x79e3c400, 0x8301ca16, 0x850f03fa,
+0x0000034c, 0x1679e3c4, 0xfa8302ca, 0x3d850f04,
+0xc4000003, 0xca1679e3, 0x05fa8303, 0x032e850f,
+0xf1620000, 0xf372085d, 0x7df16202, 0xc5ca6f08,
+0x62e190f8, 0x900c7df2, 0x0440650c, 0xf1620010,
+0xca7e087d, 0xb803fa83, 0x000000f7, 0x087df162,
+0xffb88d7f, 0x850fffff, 0x000002f4, 0x1679e3c4,
+0xfa8301ca, 0xe5850f05, 0xc4000002, 0xca1679e3,
+0x07fa8302, 0x02d6850f, 0xe3c40000, 0x03ca1679,
+0x0f09fa83, 0x0002c785, 0x62c03100, 0x6f087df1,
+0xffffe88d, 0x7df162ff, 0xc5e26f08, 0x62e990f8,
+0x900d7df2, 0x04408d24, 0xf1620010, 0xa57f087d,
+0xffffffb8, 0xe8854c8b, 0x8db04d89, 0x54390151,
+0x850fb885, 0x00000260, 0x04f88340, 0xf162e675,
+0xe4ef085d, 0x085df162, 0xffd8a5fa, 0x01b8ffff,
+0x62000000, 0x6f087df1, 0x90f8c5ea, 0x7df162f1,
+0xb8b56f08, 0x62ffffff, 0x900e7df2, 0x0450a52c,
+0xf2620010, 0xe07c087d, 0x084df162, 0xf362e4fa,
+0xc41f0855, 0x93f8c500, 0x0ffa80d0, 0x000107b8,
+0x29850f00, 0x62000002, 0x720875f1, 0xc03101f1,
+0x087df162, 0xf262e26f, 0x2490097d, 0x1004404d,
+0x7df16200, 0xb8a57f08, 0x8bffffff, 0x89e8854c,
+0x518db04d, 0x85543901, 0xd0850fb8, 0x40000001,
+0x7504f883, 0x65f162e6, 0xe88ddb08, 0x62ffffff,
+0xef0855f1, 0x76f1c5ed, 0x75f162cd, 0x62cadf08,
+0x270875f2, 0xb9c031c9, 0x00000005, 0x097df262,
+0x409d2490, 0x62001004, 0x7f087df1, 0xffffc8a5,
+0x855c8bff, 0x40ca89c8, 0xc285c229, 0x548b0674,
+0x07ebd485, 0xe485548b, 0x42b05589, 0x850fd339,
+0x00000172, 0x7504f883, 0x31c031d8, 0x851489d2,
+0x001004e0, 0x20f88340, 0x45c7f175, 0x000001b8,
+0xbc45c700, 0x00000002, 0x03c045c7, 0xc7000000,
+0x0004c445, 0xf1620000, 0x0d6f087d, 0x001004c0,
+0x0875f262, 0xf162c927, 0xbd6f087d, 0xffffffb8,
+0x0875f162, 0x31b8c9ef, 0x62000001, 0xa0097df2,
+0x04e00d3c, 0x3d830010, 0x001004e0, 0x1d850f01,
+0x8b000001, 0x1004e415, 0x0134b800, 0x150b0000,
+0x001004e8, 0x04ec150b, 0x850f0010, 0x00000100,
+0x62b4458a, 0x6f087df1, 0xffffb8b5, 0x92f8c5ff,
+0x7df262f8, 0x0d34a00f, 0x001004e0, 0x04e03d83,
+0xb8040010, 0x00000138, 0x00d2850f, 0xe4a10000,
+0x0b001004, 0x1004e805, 0xec050b00, 0x0f001004,
+0x0000a885, 0xb44d8a00, 0x000001ba, 0x7df16200,
+0xd8bd6f08, 0x62ffffff, 0x6f087df1, 0xffffb8b5,
+0x92f8c5ff, 0x7df262d1, 0xbd34a00a, 0x001004e0,
+0xe0951439, 0x75001004, 0xfa83427b, 0x8af17505,
+0xf162b45d, 0xbd6f087d, 0xffffffe8, 0x087df162,
+0xffb8b56f, 0xf8c5ffff, 0xf262db92, 0x34a00b7d,
+0x1004e0bd, 0xe43d8300, 0x04001004, 0x3d834d75,
+0x001004e8, 0x83447503, 0x1004ec3d, 0x3b750200,
+0x04f03d83, 0xba010010, 0x00000145, 0xebc2450f,
+0x00e7b82f, 0x28eb0000, 0x0000ffb8, 0xb821eb00,
+0x00000115, 0x1eb81aeb, 0xeb000001, 0x013bb813,
+0x0ceb0000, 0x000140b8, 0xb805eb00, 0x00000145,
+0x5b54c483, 0x0000c35d, 0x00000000, 0x00000000,
+0x00000001, 0x00000002, 0x00000003, 0x00000004,
+0x00000005, 0x00000006, 0x00000007, 0x00000008,
+0x00000009, 0x0000000a, 0x0000000b, 0x0000000c,
+0x0000000d, 0x0000000e, 0x0000000f, 0x00000010,
+0x00000011, 0x00000012, 0x00000013, 0x00000014,
+0x00000015, 0x00000016, 0x00000017, 0x00000018,
+0x00000019, 0x0000001a, 0x0000001b, 0x0000001c,
+0x0000001d, 0x0000001e, 0x0000001f, 0x00000020,
+0xffffffff, 0x00000000, 0x00000000, 0x00000000,
+0002320,
+};
+asm(".type avx512f_sg_x86_32_D_16x4i4, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_32_D_16x4i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_32_D_16x4i8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xe58955c3,
+0x31535657, 0x5cec83db, 0x01c845c7, 0xc7000000,
+0x0002d845, 0x45c70000, 0x000002cc, 0xdc45c700,
+0x00000001, 0x03d045c7, 0x89000000, 0x45c7e05d,
+0x000004d4, 0xe445c700, 0xffffffff, 0xc976f1c5,
+0x08f5f262, 0xf162c927, 0xdbef08e5, 0x08fdf162,
+0xe7bfd16f, 0xc5000000, 0x0fc193f8, 0xf8c5c0be,
+0x4589d190, 0xfdf262b4, 0x1d14900a, 0x00100440,
+0x087df162, 0xc189d07e, 0xc401f183, 0xd21679e3,
+0xfdf16201, 0xb8957f08, 0x09ffffff, 0x78850fd1,
+0x62000003, 0x17087cf1, 0x558bf555, 0x01f283a8,
+0x0fac550b, 0x00036285, 0xfdf16200, 0xc8956f08,
+0x62ffffff, 0x6f08fdf1, 0x90f8c5d9, 0xfdf262d9,
+0xd51c900b, 0x00100440, 0x087df162, 0xc189d87e,
+0xc402f183, 0xda1679e3, 0x00efbf01, 0xd1090000,
+0x08fdf162, 0xffb89d7f, 0x850fffff, 0x0000031b,
+0x087cf162, 0x8bf55d17, 0xf283a855, 0xac550b03,
+0x0305850f, 0xf1620000, 0xf272086d, 0xfdf16203,
+0xc5d96f08, 0x62e190f8, 0x900cfdf2, 0x0440551c,
+0xf1620010, 0xd87e087d, 0xf183c189, 0x79e3c403,
+0xbf01da16, 0x000000f7, 0xf162d109, 0x9d7f08fd,
+0xffffffb8, 0x02c1850f, 0xf1620000, 0x5d17087c,
+0xa8558bf5, 0x0b05f283, 0x850fac55, 0x000002ab,
+0x62d84d8b, 0x6f08fdf1, 0xffffd895, 0xfdf162ff,
+0xc5d96f08, 0x62e990f8, 0x900dfdf2, 0x0440d51c,
+0xe3c40010, 0x01da1679, 0x08fdf162, 0xffb89d7f,
+0xf162ffff, 0xd87e087d, 0x8901598d, 0x1fffc1df,
+0x850fd739, 0x00000257, 0x850fc339, 0x0000024f,
+0x62dc458b, 0x17087cf1, 0x558bf45d, 0xa84589a4,
+0x8b01588d, 0xdf89a045, 0x391fffc1, 0x2c850fd7,
+0x39000002, 0x24850fc3, 0x62000002, 0xef08e5f1,
+0x65f162db, 0xc89dfa08, 0x62ffffff, 0x6f08fdf1,
+0x90f8c5e1, 0xfdf162f1, 0xb8ad6f08, 0xbfffffff,
+0x00000107, 0x0efdf262, 0x50dd2490, 0x62001004,
+0xfb18d5f1, 0x1005401d, 0xddf36200, 0x00c31f08,
+0xd093f8c5, 0x0f03fa80, 0x0001de85, 0xf1624100,
+0xf272086d, 0x62cf8901, 0x9009fdf2, 0x0440950c,
+0xe3c40010, 0x01ca1679, 0x621fffc1, 0x7e087df1,
+0x0fd739c8, 0x0001ad85, 0x0fc13900, 0x0001a585,
+0x7cf16200, 0xf54d1708, 0x89ac558b, 0x1fffc1df,
+0x39a8458b, 0x8b850fd7, 0x39000001, 0x83850fc3,
+0x31000001, 0x89c931c0, 0x0560c50c, 0x0c890010,
+0x100564c5, 0xf8834000, 0xc7ea7520, 0x0001b845,
+0xc0310000, 0x4589d231, 0xc045c7bc, 0x00000002,
+0x62c45589, 0x6f08fdf1, 0x1005500d, 0xf5f26200,
+0x62c92708, 0x6f08fdf1, 0xffffb8b5, 0xf5f162ff,
+0xbfc9ef08, 0x00000131, 0x09fdf262, 0x600d34a0,
+0x8b001005, 0x10056015, 0x01f28300, 0x0564150b,
+0x850f0010, 0x00000113, 0x056c158b, 0x34bf0010,
+0x0b000001, 0x10056815, 0xfc850f00, 0x8a000000,
+0xf162b445, 0xbd6f08fd, 0xffffffb8, 0x000138bf,
+0x92f8c500, 0xfdf262f8, 0x0d3ca00f, 0x00100560,
+0x0560158b, 0xf2830010, 0x64150b02, 0x0f001005,
+0x0000c685, 0x6c158b00, 0xbf001005, 0x0000013b,
+0x0568150b, 0x850f0010, 0x000000af, 0x62b4458a,
+0x6f08fdf1, 0xffffc8ad, 0xfdf162ff, 0xb8b56f08,
+0xbfffffff, 0x00000140, 0xd092f8c5, 0x0afdf262,
+0x60ed34a0, 0x8b001005, 0x10056815, 0x01f28300,
+0x056c150b, 0x73750010, 0x0570158b, 0xf2830010,
+0x74150b02, 0x75001005, 0xb4458a62, 0x08fdf162,
+0xffd8bd6f, 0xf162ffff, 0xad6f08fd, 0xffffffb8,
+0x000145bf, 0x92f8c500, 0xfdf262d8, 0xfd2ca00b,
+0x00100560, 0x0568158b, 0xf2830010, 0x6c150b02,
+0x75001005, 0x0570a126, 0xf0830010, 0x74050b01,
+0xf7001005, 0x81ff19d8, 0x000145e7, 0xbf0ceb00,
+0x000000ff, 0x15bf05eb, 0x83000001, 0xf8895cc4,
+0x5d5f5e5b, 0x000000c3, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000000, 0x00000002, 0x00000000,
+0x00000003, 0x00000000, 0x00000004, 0x00000000,
+0x00000005, 0x00000000, 0x00000006, 0x00000000,
+0x00000007, 0x00000000, 0x00000008, 0x00000000,
+0x00000009, 0x00000000, 0x0000000a, 0x00000000,
+0x0000000b, 0x00000000, 0x0000000c, 0x00000000,
+0x0000000d, 0x00000000, 0x0000000e, 0x00000000,
+0x0000000f, 0x00000000, 0x00000010, 0x00000000,
+0x00000011, 0x00000000, 0x00000012, 0x00000000,
+0x00000013, 0x00000000, 0x00000014, 0x00000000,
+0x00000015, 0x00000000, 0x00000016, 0x00000000,
+0x00000017, 0x00000000, 0x00000018, 0x00000000,
+0x00000019, 0x00000000, 0x0000001a, 0x00000000,
+0x0000001b, 0x00000000, 0x0000001c, 0x00000000,
+0x0000001d, 0x00000000, 0x0000001e, 0x00000000,
+0x0000001f, 0x00000000, 0x00000020, 0x00000000,
+0x00000001, 0x00000000, 0x00000000, 0x00000000,
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+0002540,
+};
+asm(".type avx512f_sg_x86_32_D_16x4i8, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_32_D_16x4i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_32_D_16x4f4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xe58955c3,
+0xc758ec83, 0x0001d845, 0x45c70000, 0x000004e8,
+0xdc45c700, 0x00000002, 0x03ec45c7, 0xc7000000,
+0x0003e045, 0x45c70000, 0x000002f0, 0xe445c700,
+0x00000004, 0x01f445c7, 0xc5000000, 0x62e476d9,
+0x27085df2, 0x76f1c5cc, 0x65f162c9, 0x62dbef08,
+0x28087cf1, 0x93f8c5d1, 0xc0be0fc1, 0xd190f8c5,
+0x31b44589, 0x7df262c0, 0x1d14920a, 0x00100760,
+0x087cf162, 0xffb89529, 0xe8d9ffff, 0xb88544d9,
+0xd8dde9df, 0x04d38a0f, 0x850f0000, 0x000004cd,
+0x04f88340, 0xf162e475, 0xd128087c, 0x087df162,
+0xffd89d6f, 0xf8c5ffff, 0xf262d990, 0x14920b7d,
+0x1007609d, 0x7ef16200, 0xec551108, 0x087cf162,
+0xffb89529, 0x05d9ffff, 0x001007e0, 0xdfb045d9,
+0x0fd8dde9, 0x0004b08a, 0xaa850f00, 0x62000004,
+0x17087df3, 0x05d901d0, 0x001007e4, 0xd9b04589,
+0xe9dfb045, 0x046d8a0f, 0x850f0000, 0x0000046b,
+0x087df362, 0xd902d017, 0x1007e805, 0xb0458900,
+0xdfb045d9, 0x548a0fe9, 0x0f000004, 0x00045485,
+0xec05d900, 0x62001007, 0x17087df3, 0xd903ec55,
+0xe9dfb045, 0x04418a0f, 0x850f0000, 0x00000443,
+0x087cf162, 0xf162d128, 0xf3720855, 0x90f8c502,
+0x7df262e1, 0x6d14920c, 0x00100760, 0x087ef162,
+0x62ec5511, 0x29087cf1, 0xffffb895, 0xb045d9ff,
+0x8a0febdf, 0x0000041b, 0x041d850f, 0xf3620000,
+0x5517087d, 0x45d901ec, 0xdde9dfb0, 0x108a0fd8,
+0x0f000004, 0x00041085, 0x7df36200, 0x02d01708,
+0x07f005d9, 0x45890010, 0xb045d9b0, 0xd8dde9df,
+0x03f98a0f, 0x850f0000, 0x000003f9, 0x07f405d9,
+0xf3620010, 0x5517087d, 0x45d903ec, 0xdde9dfb0,
+0xe48a0fd8, 0x0f000003, 0x0003e485, 0x7cf16200,
+0x62e92808, 0x6f087df1, 0xffffe895, 0x90f8c5ff,
+0x7df262e9, 0x952c920d, 0x00100760, 0x087cf162,
+0xffb8ad29, 0xc031ffff, 0xe8854c8b, 0x8901518d,
+0x45dbb055, 0x8544d9b0, 0xdde9dfb8, 0xac8a0fd8,
+0x0f000003, 0x0003ac85, 0xf8834000, 0x62d97504,
+0xef0855f1, 0x55f162ed, 0xd8adfa08, 0xc5ffffff,
+0x62f190f8, 0x28087cf1, 0x0107b8f1, 0xf2620000,
+0x34920e7d, 0x100770ad, 0x7df26200, 0xf82d1808,
+0x62001007, 0x580854f1, 0xffffb8ad, 0x4df362ff,
+0x00c51f08, 0xd093f8c5, 0x0f0ffa80, 0x0004b985,
+0x6df16200, 0x01f27208, 0xf262c031, 0x0c92097d,
+0x10076055, 0x7cf16200, 0xb88d2908, 0x8bffffff,
+0x8de8854c, 0x55890151, 0xb045dbb0, 0xb88544d9,
+0xd8dde9df, 0x03298a0f, 0x850f0000, 0x00000329,
+0x04f88340, 0xf162d975, 0x95db0865, 0xffffffe8,
+0x0855f162, 0xe9c5edef, 0xf162d576, 0xd4df086d,
+0x086df262, 0xc031ca27, 0x000005b9, 0x7df26200,
+0x9d0c9209, 0x00100760, 0x087cf162, 0xffc88d29,
+0x44d9ffff, 0xca89c885, 0x85c22940, 0x8b0674c2,
+0xebd48554, 0x85548b04, 0x558942e4, 0xb045dbb0,
+0xe9dfc9d9, 0x8a0fd8dd, 0x000002cb, 0x02cb850f,
+0xf8830000, 0x31cb7504, 0xdd02ebc0, 0xd9eed9d8,
+0x08208514, 0x83400010, 0xef7520f8, 0x55d9e8d9,
+0xe005d9b8, 0xd9001007, 0xccd9bc55, 0xd9c05dd9,
+0xc455d9ca, 0x087df162, 0x08000d6f, 0xf2620010,
+0xc9270875, 0x0875f162, 0xf162c9ef, 0xbd28087c,
+0xffffffb8, 0x097df262, 0x200d3ca2, 0xd9001008,
+0x10082005, 0x0febdf00, 0x00026e8a, 0x72850f00,
+0xd9000002, 0x10082405, 0x0feadf00, 0x0002768a,
+0x7a850f00, 0xd9000002, 0x10082805, 0x0feadf00,
+0x0002768a, 0x7a850f00, 0xd9000002, 0x10082c05,
+0x0feadf00, 0x0002768a, 0x7a850f00, 0x8a000002,
+0xf162b445, 0xbd28087c, 0xffffffb8, 0xf892f8c5,
+0x0f7df262, 0x200d3ca2, 0xd9001008, 0x10082005,
+0xdde9db00, 0x608a0fd9, 0xd9000002, 0x1007e805,
+0xdde9db00, 0x5a850fd9, 0xd9000002, 0x10082405,
+0x0feadf00, 0x00025e8a, 0x62850f00, 0xd9000002,
+0x10082805, 0x0feadf00, 0x00025e8a, 0x62850f00,
+0xd9000002, 0x10082c05, 0xddeadf00, 0x5c8a0fd9,
+0x0f000002, 0x00025e85, 0xb4458a00, 0x087df162,
+0xffd8a56f, 0xf162ffff, 0xbd28087c, 0xffffffb8,
+0xd092f8c5, 0x0a7df262, 0x20a53ca2, 0xd9001008,
+0x10082405, 0x0feadf00, 0x0002378a, 0x39850f00,
+0xd9000002, 0x10082805, 0x0febdf00, 0x0002338a,
+0x35850f00, 0xd9000002, 0x1007e405, 0x2c05d900,
+0xdf001008, 0x298a0fe9, 0x0f000002, 0x00022d85,
+0x3005d900, 0xdf001008, 0x298a0fea, 0x0f000002,
+0x00022d85, 0xb4458a00, 0x087df162, 0xffe8a56f,
+0xf162ffff, 0xb528087c, 0xffffffb8, 0xd892f8c5,
+0x0b7df262, 0x20a534a2, 0xd9001008, 0x10082405,
+0xddeadf00, 0x068a0fd9, 0x0f000002, 0x00020885,
+0x2805d900, 0xdf001008, 0x0fd8dde9, 0x0002008a,
+0x00850f00, 0xd9000002, 0x10082c05, 0xddeadf00,
+0xf68a0fd9, 0x0f000001, 0x0001f485, 0x3005d900,
+0xdf001008, 0x0fd8dde9, 0x0001e68a, 0x0000b800,
+0x840f0000, 0x000001e6, 0x0001d6e9, 0x00e7b800,
+0xd7e90000, 0xdd000001, 0xdd1eebd8, 0xdd1aebd8,
+0xebd8ddd8, 0xddd8dd14, 0xdd0eebd8, 0xddd8ddd8,
+0xdd06ebd8, 0xddd8ddd8, 0x00efb8d8, 0xabe90000,
+0xdd000001, 0xddd8ddd8, 0xdd2aebd8, 0xddd8ddd8,
+0xdd22ebd8, 0xebd8ddd8, 0xddd8dd1c, 0xdd16ebd8,
+0xebd8ddd8, 0xddd8dd10, 0xdd0aebd8, 0xebd8ddd8,
+0xddd8dd04, 0x00f7b8d8, 0x6fe90000, 0xdd000001,
+0xebd8ddd8, 0xddd8dd04, 0x00ffb8d8, 0x5be90000,
+0xdd000001, 0xebd8ddd8, 0xddd8dd04, 0x0115b8d8,
+0x47e90000, 0xdd000001, 0xebd8ddd8, 0xddd8dd04,
+0x011eb8d8, 0x33e90000, 0xdd000001, 0xddd8ddd8,
+0xebd8ddd8, 0xddd8dd08, 0xddd8ddd8, 0x0131b8d8,
+0x17e90000, 0xdd000001, 0xddd8ddd8, 0xebd8ddd8,
+0xddd8dd30, 0xddd8ddd8, 0xdd26ebd8, 0xddd8ddd8,
+0xebd8ddd8, 0xddd8dd1c, 0xddd8ddd8, 0xdd12ebd8,
+0xddd8ddd8, 0xebd8ddd8, 0xddd8dd08, 0xddd8ddd8,
+0x0134b8d8, 0xd3e90000, 0xdd000000, 0xddd8ddd8,
+0xebd8ddd8, 0xddd8dd08, 0xddd8ddd8, 0x0138b8d8,
+0xb7e90000, 0xdd000000, 0xddd8ddd8, 0xebd8ddd8,
+0xddd8dd2c, 0xddd8ddd8, 0xdd22ebd8, 0xddd8ddd8,
+0xebd8ddd8, 0xddd8dd18, 0xddd8ddd8, 0xdd0eebd8,
+0xddd8ddd8, 0xdd06ebd8, 0xddd8ddd8, 0x013bb8d8,
+0x7aeb0000, 0xd8ddd8dd, 0x3eebd8dd, 0xd8ddd8dd,
+0x36ebd8dd, 0xd8ddd8dd, 0x2eebd8dd, 0xd8ddd8dd,
+0x26ebd8dd, 0xd8ddd8dd, 0xd8ddd8dd, 0xd8dd1ceb,
+0xd8ddd8dd, 0x12ebd8dd, 0xd8ddd8dd, 0xd8ddd8dd,
+0xd8dd08eb, 0xd8ddd8dd, 0x40b8d8dd, 0xeb000001,
+0xddd8dd2d, 0xebd8ddd8, 0xddd8dd1a, 0xebd8ddd8,
+0xddd8dd12, 0xdd0cebd8, 0xebd8ddd8, 0xebd8dd06,
+0xb8d8dd02, 0x00000145, 0xd8dd04eb, 0xc3c9d8dd,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+0x40a00000, 0x40c00000, 0x40e00000, 0x41000000,
+0x41100000, 0x41200000, 0x41300000, 0x41400000,
+0x41500000, 0x41600000, 0x41700000, 0x41800000,
+0x41880000, 0x41900000, 0x41980000, 0x41a00000,
+0x41a80000, 0x41b00000, 0x41b80000, 0x41c00000,
+0x41c80000, 0x41d00000, 0x41d80000, 0x41e00000,
+0x41e80000, 0x41f00000, 0x41f80000, 0x42000000,
+0x40000000, 0x40400000, 0x40800000, 0x40a00000,
+0x40e00000, 0x41100000, 0xbf800000, 0x00000000,
+0xffffffff, 0x00000000, 0x00000000, 0x00000000,
+0004020,
+};
+asm(".type avx512f_sg_x86_32_D_16x4f4, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_32_D_16x4f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_32_D_16x4f8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xd23155c3,
+0xec83e589, 0xd845c748, 0x00000001, 0x02e845c7,
+0xc7000000, 0x0002dc45, 0x45c70000, 0x000001ec,
+0xe045c700, 0x00000003, 0xc7f05589, 0x0004e445,
+0x45c70000, 0xfffffff4, 0x76f1c5ff, 0xf5f262c9,
+0x62c92708, 0xef08e5f1, 0x76f1c5db, 0xfdf162c9,
+0xc5d12808, 0x0fc193f8, 0xf8c5c0be, 0x4589d190,
+0xfdf262c4, 0x1d14920a, 0x00100560, 0x08fdf162,
+0xd9f75513, 0xb845dde8, 0x08fdf162, 0xffc89529,
+0xe9dfffff, 0x03708a0f, 0x850f0000, 0x0000036e,
+0x08fdf162, 0xddf75517, 0xe9dfb845, 0x03608a0f,
+0x850f0000, 0x0000035e, 0x08fdf162, 0xffd89d6f,
+0xf162ffff, 0xd12808fd, 0xd990f8c5, 0x0bfdf262,
+0x60dd1492, 0x62001005, 0x1308fdf1, 0x45ddf755,
+0x6005d9b8, 0x62001006, 0x2908fdf1, 0xffffc895,
+0xd9c0d9ff, 0xddeadfca, 0x0fc0d9d9, 0x0003218a,
+0x23850f00, 0x62000003, 0x1708fdf1, 0x05d9f755,
+0x00100664, 0xdfb845dd, 0x138a0fe9, 0x0f000003,
+0x00031785, 0x65f16200, 0x03f37208, 0x08fdf162,
+0xf8c5d128, 0xf262e190, 0x14920cfd, 0x1005605d,
+0xfdf16200, 0xf7551308, 0xdfb845dd, 0x62d8dde9,
+0x2908fdf1, 0xffffc895, 0xef8a0fff, 0x0f000002,
+0x0002f185, 0xfdf16200, 0xf7551708, 0x066805d9,
+0x45dd0010, 0xdde9dfb8, 0xdf8a0fd8, 0x0f000002,
+0x0002e185, 0xe8458b00, 0x08fdf162, 0xffe89d6f,
+0xf162ffff, 0xd12808fd, 0xe990f8c5, 0x0dfdf262,
+0x60dd1492, 0x62001005, 0x2908fdf1, 0xffffc895,
+0x458940ff, 0xb845dbb8, 0x08fdf162, 0xddf75513,
+0xc9d9b845, 0xd9dde9db, 0x02a88a0f, 0x850f0000,
+0x000002ac, 0x40ec458b, 0xdbb84589, 0xf162b845,
+0x551708fd, 0xb845ddf7, 0xe9dbc9d9, 0x8a0fd9dd,
+0x00000296, 0x029c850f, 0xf1620000, 0xd2ef08ed,
+0x086df162, 0xffd895fa, 0xf162ffff, 0xe12808fd,
+0xf190f8c5, 0x000107b8, 0xfdf26200, 0xd524920e,
+0x00100570, 0x08fff162, 0x06701512, 0xf1620010,
+0x955808ed, 0xffffffc8, 0x08ddf362, 0xc500c21f,
+0x80d093f8, 0x850f03fa, 0x00000304, 0x0865f162,
+0x6201f372, 0x9209fdf2, 0x05609d0c, 0xf1620010,
+0x4d1308fd, 0xb845ddf7, 0xeadfcad9, 0x8a0fd9dd,
+0x00000236, 0x023a850f, 0xf1620000, 0x4d1708fd,
+0xb845ddf7, 0xe9dfc9d9, 0x8a0fd8dd, 0x0000022e,
+0x000000b8, 0x2b850f00, 0xeb000002, 0xd9d8dd02,
+0xc514ddee, 0x001006a0, 0x20f88340, 0xcad9ef75,
+0x31d05ddd, 0xc84589c0, 0x00cc45c7, 0x623ff000,
+0x6f08fdf1, 0x1006800d, 0xf5f26200, 0x62c92708,
+0x2808fdf1, 0xffffc8ad, 0xf5f162ff, 0x62c9ef08,
+0xa209fdf2, 0x06a00d2c, 0x05dd0010, 0x001006a0,
+0x8a0febdf, 0x000001de, 0x01e0850f, 0x05dd0000,
+0x001006a8, 0x8a0feadf, 0x000001df, 0x01e1850f,
+0x458a0000, 0xfdf162c4, 0xc8b52808, 0xc5ffffff,
+0x62f892f8, 0xa20ffdf2, 0x06a00d34, 0x05dd0010,
+0x001006a0, 0x8a0fe9df, 0x000001c4, 0x01c6850f,
+0x05dd0000, 0x001006a8, 0xd9ddeadf, 0x01c38a0f,
+0x850f0000, 0x000001c3, 0x62c4458a, 0x6f08fdf1,
+0xffffd8bd, 0xfdf162ff, 0xc8ad2808, 0xc5ffffff,
+0x62d092f8, 0xa20afdf2, 0x06a0fd2c, 0x05dd0010,
+0x001006a8, 0xdaddeadb, 0x01988a0f, 0xe8d90000,
+0xdaddeadb, 0x0192850f, 0x05dd0000, 0x001006b0,
+0x8a0fe9df, 0x0000018a, 0x018a850f, 0x458a0000,
+0xfdf162c4, 0xe8b56f08, 0x62ffffff, 0x2808fdf1,
+0xffffc8bd, 0x92f8c5ff, 0xfdf262d8, 0xf53ca20b,
+0x001006a0, 0x06a805dd, 0xe9df0010, 0x8a0fd8dd,
+0x0000015f, 0x015d850f, 0x05dd0000, 0x001006b0,
+0xd8dde9df, 0x014f8a0f, 0x00b80000, 0x0f000000,
+0x00015584, 0x013fe900, 0xd8dd0000, 0xd8dd0aeb,
+0xd8dd06eb, 0xd8dd02eb, 0x0000e7b8, 0x0138e900,
+0xd8dd0000, 0xd8ddd8dd, 0xd8dd1aeb, 0xd8ddd8dd,
+0xd8dd12eb, 0xd8ddd8dd, 0x08ebd8dd, 0xd8ddd8dd,
+0xd8ddd8dd, 0x0000efb8, 0x010ce900, 0xd8dd0000,
+0xd8ddd8dd, 0xd8dd16eb, 0xd8ddd8dd, 0xd8dd0eeb,
+0xd8ddd8dd, 0xd8dd06eb, 0xd8ddd8dd, 0x0000f7b8,
+0x00e4e900, 0xd8dd0000, 0xd8ddd8dd, 0x20ebd8dd,
+0xd8ddd8dd, 0xd8ddd8dd, 0xd8dd16eb, 0xd8ddd8dd,
+0xd8ddd8dd, 0xd8dd0aeb, 0xd8ddd8dd, 0xd8ddd8dd,
+0x0000ffb8, 0x00b0e900, 0xd8dd0000, 0xd8ddd8dd,
+0x18ebd8dd, 0xd8ddd8dd, 0xd8ddd8dd, 0xd8dd0eeb,
+0xd8ddd8dd, 0xd8dd06eb, 0xd8ddd8dd, 0x000115b8,
+0x0084e900, 0xd8dd0000, 0xd8ddd8dd, 0xd8dd06eb,
+0xd8ddd8dd, 0x000131b8, 0xdd6feb00, 0xddd8ddd8,
+0xdd06ebd8, 0xddd8ddd8, 0x0134b8d8, 0x5aeb0000,
+0xd8ddd8dd, 0x06ebd8dd, 0xd8ddd8dd, 0x38b8d8dd,
+0xeb000001, 0xddd8dd45, 0xdd04ebd8, 0xb8d8ddd8,
+0x0000013b, 0xd8dd34eb, 0x10ebd8dd, 0xd8ddd8dd,
+0xd8dd0aeb, 0x04ebd8dd, 0xd8ddd8dd, 0x000140b8,
+0xdd17eb00, 0xdd02ebd8, 0x0145b8d8, 0x0aeb0000,
+0xd8ddd8dd, 0xd8ddd8dd, 0xc3c9d8dd, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40100000,
+0x00000000, 0x40140000, 0x00000000, 0x40180000,
+0x00000000, 0x401c0000, 0x00000000, 0x40200000,
+0x00000000, 0x40220000, 0x00000000, 0x40240000,
+0x00000000, 0x40260000, 0x00000000, 0x40280000,
+0x00000000, 0x402a0000, 0x00000000, 0x402c0000,
+0x00000000, 0x402e0000, 0x00000000, 0x40300000,
+0x00000000, 0x40310000, 0x00000000, 0x40320000,
+0x00000000, 0x40330000, 0x00000000, 0x40340000,
+0x00000000, 0x40350000, 0x00000000, 0x40360000,
+0x00000000, 0x40370000, 0x00000000, 0x40380000,
+0x00000000, 0x40390000, 0x00000000, 0x403a0000,
+0x00000000, 0x403b0000, 0x00000000, 0x403c0000,
+0x00000000, 0x403d0000, 0x00000000, 0x403e0000,
+0x00000000, 0x403f0000, 0x00000000, 0x40400000,
+0x40000000, 0x40400000, 0x40a00000, 0x00000000,
+0x00000000, 0xbff00000, 0x00000000, 0x00000000,
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+0003220,
+};
+asm(".type avx512f_sg_x86_32_D_16x4f8, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_32_D_16x4f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_32_D_16x8i4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc93155c3,
+0x3157e589, 0xf63156ff, 0x83db3153, 0x45c75cec,
+0x000001c8, 0xcc4d8900, 0x02d845c7, 0x89000000,
+0x45c7dc5d, 0x000002d0, 0xd4758900, 0x01e045c7,
+0x89000000, 0xf1c5e47d, 0xf262c976, 0xc9270875,
+0x0865f162, 0xf162dbef, 0xd16f087d, 0xc193f8c5,
+0xc5c0be0f, 0x89d190f8, 0xe7b8b445, 0x62000000,
+0x910a7df2, 0x04601d14, 0xf1620010, 0xd27e087d,
+0x7df1624a, 0xb8957f08, 0x0fffffff, 0x0003b585,
+0x79e3c400, 0x4a01d216, 0x03a8850f, 0xe3c40000,
+0x02d11679, 0x1679e3c4, 0xd10903d2, 0x0000eab8,
+0x8f850f00, 0x62000003, 0x6f087df1, 0xffffc89d,
+0x7df162ff, 0xc5d16f08, 0x62d990f8, 0x910b7df2,
+0x04609d14, 0xf1620010, 0xd27e087d, 0xb802fa83,
+0x000000ef, 0x087df162, 0xffb8957f, 0x850fffff,
+0x00000352, 0x1679e3c4, 0xfa8301d2, 0x43850f03,
+0xc4000003, 0xd11679e3, 0x79e3c402, 0x0903d216,
+0x00f2b8d1, 0x850f0000, 0x0000032a, 0x08e5f162,
+0x6202f373, 0x6f087df1, 0x90f8c5d1, 0x7df262e1,
+0x5d14910c, 0x00100460, 0x087df162, 0xfa83d27e,
+0x00f7b803, 0xf1620000, 0x957f087d, 0xffffffb8,
+0x02f0850f, 0xe3c40000, 0x01d21679, 0x0f05fa83,
+0x0002e185, 0x79e3c400, 0xc402d116, 0xd21679e3,
+0xb8d10903, 0x000000fa, 0x02c8850f, 0x458b0000,
+0x7df162d8, 0xd89d6f08, 0x62ffffff, 0x6f087df1,
+0xdc558bd1, 0xe990f8c5, 0x0d7df262, 0x609d1491,
+0x62001004, 0x7e087df1, 0x62cf89d1, 0x7f087df1,
+0xffffb895, 0x1fffc1ff, 0x83a84589, 0x558901c0,
+0x00d283ac, 0x850fd739, 0x00000259, 0x850fc139,
+0x00000251, 0xc4e0758b, 0xd01679e3, 0x8bc38901,
+0xfbc1e47d, 0x01c6831f, 0x3900d783, 0x32850ffb,
+0x39000002, 0x2a850ff0, 0xc4000002, 0xd11679e3,
+0x79e3c402, 0x0903d216, 0x0102b8ca, 0x850f0000,
+0x00000232, 0x62b8458b, 0xef085df1, 0x7df162e4,
+0x62d16f08, 0xfb08ddf1, 0xffffc8a5, 0x90f8c5ff,
+0xff508df1, 0x0e7df262, 0x68a51491, 0x62001004,
+0x7e087df1, 0xb8d139d1, 0x0000010b, 0x01f4850f,
+0x458b0000, 0x79e3c4bc, 0x8d01d116, 0x0bb8ff50,
+0x39000001, 0xdb850fd1, 0xc4000001, 0xd11679e3,
+0x79e3c402, 0x0903d216, 0x010eb8ca, 0x850f0000,
+0x000001c2, 0x08e5f162, 0x8b01f373, 0xf262ac55,
+0x0c91097d, 0x1004605d, 0x7df16200, 0x89c97e08,
+0x1ff8c1c8, 0x087df162, 0xffb88d7f, 0xf162ffff,
+0x4d7e087d, 0xa44589e8, 0x83a8458b, 0xd28301c0,
+0xa4553900, 0x0162850f, 0xc1390000, 0x015a850f,
+0xe3c40000, 0x01c91679, 0x3999c889, 0x49850ffa,
+0x39000001, 0x41850ff1, 0xc4000001, 0xc91679e3,
+0x79e3c402, 0x0903ca16, 0x0118b8d1, 0x850f0000,
+0x00000142, 0xd231c031, 0x00851489, 0x40001005,
+0x7520f883, 0xb845c7f1, 0x00000001, 0x02bc45c7,
+0x62000000, 0x6f087df1, 0x1004e00d, 0x75f26200,
+0x62c92708, 0x6f087df1, 0xffffb8ad, 0x75f162ff,
+0xb8c9ef08, 0x00000131, 0x097df262, 0x000d2ca1,
+0x83001005, 0x1005003d, 0x850f0100, 0x000000e6,
+0x05043d83, 0xb8000010, 0x00000134, 0x00d4850f,
+0x458a0000, 0x7df162b4, 0xb8b56f08, 0xc5ffffff,
+0x62f892f8, 0xa10f7df2, 0x05000d34, 0x3d830010,
+0x00100500, 0x0138b802, 0x850f0000, 0x000000a6,
+0x100504a1, 0x0fc08500, 0x00008685, 0xb45d8a00,
+0x087df162, 0xffc8bd6f, 0xf162ffff, 0xad6f087d,
+0xffffffb8, 0xd392f8c5, 0x0a7df262, 0x00bd2ca1,
+0x83001005, 0x1005043d, 0x5e750100, 0x05083d83,
+0x75020010, 0xb45d8a55, 0x087df162, 0xffd8b56f,
+0xf162ffff, 0xbd6f087d, 0xffffffb8, 0xdb92f8c5,
+0x0b7df262, 0x00b53ca1, 0x83001005, 0x1005043d,
+0x2d750200, 0x05083d83, 0xba010010, 0x00000145,
+0xebc2450f, 0x00ffb821, 0x1aeb0000, 0x000115b8,
+0xb813eb00, 0x0000013b, 0x40b80ceb, 0xeb000001,
+0x0145b805, 0xc4830000, 0x5f5e5b5c, 0x0000c35d,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000002, 0x00000003, 0x00000004,
+0x00000005, 0x00000006, 0x00000007, 0x00000008,
+0x00000009, 0x0000000a, 0x0000000b, 0x0000000c,
+0x0000000d, 0x0000000e, 0x0000000f, 0x00000010,
+0x00000011, 0x00000012, 0x00000013, 0x00000014,
+0x00000015, 0x00000016, 0x00000017, 0x00000018,
+0x00000019, 0x0000001a, 0x0000001b, 0x0000001c,
+0x0000001d, 0x0000001e, 0x0000001f, 0x00000020,
+0xffffffff, 0x00000000, 0x00000000, 0x00000000,
+0002360,
+};
+asm(".type avx512f_sg_x86_32_D_16x8i4, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_32_D_16x8i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_32_D_16x8i8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0x3157e589, 0xf63156ff, 0x83db3153, 0x45c75cec,
+0x000001c8, 0xcc5d8900, 0x02d845c7, 0x89000000,
+0x45c7dc75, 0x000002d0, 0xd47d8900, 0x01e045c7,
+0x89000000, 0xf1c5e445, 0xf262c976, 0xc92708f5,
+0x08e5f162, 0xf162dbef, 0xd16f08fd, 0x0000e7bb,
+0x93f8c500, 0xc0be0fc1, 0xd190f8c5, 0x62b44589,
+0x910afdf2, 0x04c01d14, 0xf1620010, 0xd07e087d,
+0xf183c189, 0x79e3c401, 0x6201d216, 0x7f08fdf1,
+0xffffb895, 0x0fd109ff, 0x0003fe85, 0x7cf16200,
+0xf5551708, 0x83a8558b, 0x550b01f2, 0xe8850fac,
+0x62000003, 0x6f08fdf1, 0xffffc8a5, 0xfdf162ff,
+0xc5d16f08, 0x62d990f8, 0x910bfdf2, 0x04c0e514,
+0xf1620010, 0xd07e087d, 0xf183c189, 0x79e3c402,
+0xbb01d216, 0x000000ef, 0xf162d109, 0x957f08fd,
+0xffffffb8, 0x03a1850f, 0xf1620000, 0x5517087c,
+0xa8558bf5, 0x0b03f283, 0x850fac55, 0x0000038b,
+0x08e5f162, 0x6203f473, 0x6f08fdf1, 0x90f8c5d1,
+0xfdf262e1, 0x5d14910c, 0x001004c0, 0x087df162,
+0xc189d07e, 0xc403f183, 0xd21679e3, 0x00f7bb01,
+0xd1090000, 0x08fdf162, 0xffb8957f, 0x850fffff,
+0x00000347, 0x087cf162, 0x8bf55517, 0xf283a855,
+0xac550b05, 0x0331850f, 0x458b0000, 0xfdf162d8,
+0xd8956f08, 0x62ffffff, 0x6f08fdf1, 0xdc558bd9,
+0xe990f8c5, 0x0dfdf262, 0xc0d51c91, 0x62001004,
+0x7f08fdf1, 0xffffb89d, 0xa84589ff, 0xf162c689,
+0xd87e087d, 0x89ac5589, 0x01c683d7, 0xc400d783,
+0xda1679e3, 0x0fd73901, 0x0002cb85, 0x0fc63900,
+0x0002c385, 0xe0758b00, 0x087cf162, 0x8bf45d17,
+0x5d8be47d, 0x83f089a4, 0xfa8901c0, 0x3900d283,
+0xa1850fda, 0x8b000002, 0xd839a05d, 0x0296850f,
+0xf1620000, 0xedef08d5, 0x08d5f162, 0xf162dcfb,
+0xf16f08fd, 0xf190f8c5, 0x08fdf162, 0xffb8bd6f,
+0xf262ffff, 0x34910efd, 0x1004d0dd, 0xc5f16200,
+0xc01dfb18, 0xbb001005, 0x00000107, 0x08cdf362,
+0xc500c31f, 0x80d093f8, 0x850f03fa, 0x0000025b,
+0x62a84d8b, 0x7308e5f1, 0xf16201f2, 0xd16f08fd,
+0x62ac5d8b, 0x9109fdf2, 0x04c09d14, 0xe3c40010,
+0x01d21679, 0x08fdf162, 0xffb8957f, 0xf162ffff,
+0xd07e087d, 0x8301c183, 0xd33900d3, 0x020d850f,
+0xc1390000, 0x0205850f, 0xf1620000, 0x5517087c,
+0xac558bf5, 0x8301c683, 0x458b00d7, 0x0fd739a8,
+0x0001ea85, 0x0fc63900, 0x0001e285, 0xddf16200,
+0xd89ddb08, 0xc4ffffff, 0xdd2961e2, 0x08e5f162,
+0xf262c9df, 0xc92708f5, 0x09fdf262, 0xc0e51491,
+0xc4001004, 0xd21679e3, 0x62d33901, 0x7e087df1,
+0xaf850fd0, 0x39000001, 0xa7850fc1, 0x62000001,
+0x17087cf1, 0x558bf555, 0xa8458bac, 0x850fd739,
+0x00000192, 0x850fc639, 0x0000018a, 0xc931c031,
+0xe0c50c89, 0x89001005, 0x05e4c50c, 0x83400010,
+0xea7520f8, 0x01b845c7, 0x31000000, 0x89d231c0,
+0x45c7bc45, 0x000002c0, 0xc4558900, 0x08fdf162,
+0x05d00d6f, 0xf2620010, 0xc92708f5, 0x08fdf162,
+0xffb8bd6f, 0xf162ffff, 0xc9ef08f5, 0x000131bb,
+0xfdf26200, 0x0d3ca109, 0x001005e0, 0x05e0158b,
+0xf2830010, 0xe4150b01, 0x0f001005, 0x00011a85,
+0xec158b00, 0xbb001005, 0x00000134, 0x05e8150b,
+0x850f0010, 0x00000103, 0x62b4458a, 0x6f08fdf1,
+0xffffb8ad, 0x0138bbff, 0xf8c50000, 0xf262f892,
+0x2ca10ffd, 0x1005e00d, 0xe0158b00, 0x83001005,
+0x150b02f2, 0x001005e4, 0x00cd850f, 0x158b0000,
+0x001005ec, 0x00013bbb, 0xe8150b00, 0x0f001005,
+0x0000b685, 0xb4458a00, 0x08fdf162, 0xffc8bd6f,
+0xf162ffff, 0xa56f08fd, 0xffffffb8, 0x000140bb,
+0x92f8c500, 0xfdf262d0, 0xfd24a10a, 0x001005e0,
+0x05e8158b, 0xf2830010, 0xec150b01, 0x75001005,
+0xf0158b7a, 0x83001005, 0x150b02f2, 0x001005f4,
+0x458a6975, 0xfdf162b4, 0xd8ad6f08, 0x62ffffff,
+0x6f08fdf1, 0xffffb8b5, 0x0145bbff, 0xf8c50000,
+0xf262d892, 0x34a10bfd, 0x1005e0ed, 0xe8158b00,
+0x83001005, 0x150b02f2, 0x001005ec, 0xf0a12d75,
+0x83001005, 0x050b01f0, 0x001005f4, 0xdb19d8f7,
+0x0145e381, 0x13eb0000, 0x0000ffbb, 0xbb0ceb00,
+0x00000115, 0x1ebb05eb, 0x83000001, 0xd8895cc4,
+0x5d5f5e5b, 0x000000c3, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000000, 0x00000002, 0x00000000,
+0x00000003, 0x00000000, 0x00000004, 0x00000000,
+0x00000005, 0x00000000, 0x00000006, 0x00000000,
+0x00000007, 0x00000000, 0x00000008, 0x00000000,
+0x00000009, 0x00000000, 0x0000000a, 0x00000000,
+0x0000000b, 0x00000000, 0x0000000c, 0x00000000,
+0x0000000d, 0x00000000, 0x0000000e, 0x00000000,
+0x0000000f, 0x00000000, 0x00000010, 0x00000000,
+0x00000011, 0x00000000, 0x00000012, 0x00000000,
+0x00000013, 0x00000000, 0x00000014, 0x00000000,
+0x00000015, 0x00000000, 0x00000016, 0x00000000,
+0x00000017, 0x00000000, 0x00000018, 0x00000000,
+0x00000019, 0x00000000, 0x0000001a, 0x00000000,
+0x0000001b, 0x00000000, 0x0000001c, 0x00000000,
+0x0000001d, 0x00000000, 0x0000001e, 0x00000000,
+0x0000001f, 0x00000000, 0x00000020, 0x00000000,
+0x00000001, 0x00000000, 0x00000000, 0x00000000,
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+0002740,
+};
+asm(".type avx512f_sg_x86_32_D_16x8i8, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_32_D_16x8i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_32_D_16x8f4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0xd231e589, 0x56c93157, 0x83db3153, 0x45c74cec,
+0x000001c8, 0xcc458900, 0x02d845c7, 0x89000000,
+0x45c7dc55, 0x000002d0, 0xd44d8900, 0x01e045c7,
+0x89000000, 0xf1c5e45d, 0xf262c976, 0xc9270875,
+0xc976f1c5, 0x0865f162, 0xf162dbef, 0xd128087c,
+0xc193f8c5, 0xc5c0be0f, 0x89d190f8, 0xf262b445,
+0x14930a7d, 0x1007401d, 0x7ef16200, 0xea551108,
+0x087cf162, 0xffb89529, 0xe8d9ffff, 0xdfa845d9,
+0xec8a0fe9, 0x0f000004, 0x0004ea85, 0x7df36200,
+0xea551708, 0xa845d901, 0xd8dde9df, 0x04d78a0f,
+0x850f0000, 0x000004d1, 0xf362eed9, 0x5517087d,
+0x45d902ea, 0x0fe9dfa8, 0x0004c68a, 0xc4850f00,
+0x62000004, 0x17087df3, 0xd903ea55, 0xe9dfa845,
+0x04b58a0f, 0x850f0000, 0x000004b3, 0x087cf162,
+0xf162d128, 0x9d6f087d, 0xffffffc8, 0xd990f8c5,
+0x0b7df262, 0x409d1493, 0x62001007, 0x11087ef1,
+0xf162ea55, 0x9529087c, 0xffffffb8, 0x07c005d9,
+0x45d90010, 0xdde9dfa8, 0x7c8a0fd8, 0x0f000004,
+0x00047a85, 0x7df36200, 0x01d01708, 0x07c405d9,
+0x45890010, 0xa845d9a8, 0x8a0fe9df, 0x00000463,
+0x0463850f, 0xf3620000, 0x5517087d, 0x45d902ea,
+0x0feadfa8, 0x00045e8a, 0x5e850f00, 0x62000004,
+0x17087df3, 0xd903ea55, 0xeadfa845, 0x04518a0f,
+0x850f0000, 0x00000451, 0x087cf162, 0xf162d128,
+0xf37308e5, 0x90f8c502, 0x7df262e1, 0x5d14930c,
+0x00100740, 0x087ef162, 0x62ea5511, 0x29087cf1,
+0xffffb895, 0xa845d9ff, 0xd8dde9df, 0x04258a0f,
+0x850f0000, 0x00000423, 0x087df362, 0xd901d017,
+0x1007c805, 0xa8458900, 0xdfa845d9, 0x0fd8dde9,
+0x00040a8a, 0x08850f00, 0x62000004, 0x17087df3,
+0xd902ea55, 0xe9dfa845, 0x04018a0f, 0x850f0000,
+0x000003ff, 0x087df362, 0x03ea5517, 0xdfa845d9,
+0xf08a0fe9, 0x0f000003, 0x0003ee85, 0xd84d8b00,
+0x087df162, 0xffd8956f, 0xf8c5ffff, 0xf262e990,
+0x0c930d7d, 0x10074095, 0xdc5d8b00, 0x087cf162,
+0xffb88d29, 0xc889ffff, 0x8901c083, 0xa84589da,
+0x8900d283, 0x6ddfac55, 0x7ef162a8, 0xea4d1108,
+0xd9a845d9, 0xdde9dfc9, 0xa88a0fd8, 0x0f000003,
+0x0003a685, 0xe0458b00, 0x89e4558b, 0x01c683c6,
+0x7589d789, 0x00d783a8, 0xdfac7d89, 0xf362a86d,
+0x4d17087d, 0x45d901ea, 0xdfc9d9a8, 0x0fd8dde9,
+0x00037a8a, 0x78850f00, 0x62000003, 0x17087df3,
+0xd902ea4d, 0xe9dfa845, 0x03718a0f, 0x850f0000,
+0x0000036f, 0x087df362, 0x03ea4d17, 0xdfa845d9,
+0x608a0fe9, 0x0f000003, 0x00035e85, 0x76f1c500,
+0x5df162c9, 0xd9e4ef08, 0xddf162e8, 0xc8a5fb08,
+0xc5ffffff, 0x62f190f8, 0x28087cf1, 0xb845d9d9,
+0x0e7df262, 0x48a51c93, 0x62001007, 0x11087ef1,
+0xe1d8ea5d, 0xd9a845d9, 0xdde9dfc9, 0x248a0fd8,
+0x0f000003, 0x00032485, 0xbc45d900, 0x087df362,
+0x01ea5d17, 0x45d9e1d8, 0xdfc9d9a8, 0x0fd8dde9,
+0x00030e8a, 0x0e850f00, 0x62000003, 0x17087df3,
+0xd902ea5d, 0xeadfa845, 0x03098a0f, 0x850f0000,
+0x00000309, 0x087df362, 0x03ea5d17, 0xdfa845d9,
+0x0fd9ddea, 0x0002fa8a, 0xf8850f00, 0x83000002,
+0xf16201c1, 0xf27308ed, 0x7df26201, 0x550c9309,
+0x00100740, 0x8900d383, 0x5d89a84d, 0x7cf162ac,
+0xb88d2908, 0xdfffffff, 0xf162a86d, 0x4d11087e,
+0xa845d9ea, 0xe9dfc9d9, 0x8a0fd8dd, 0x000002c3,
+0x02c1850f, 0x75890000, 0xac7d89a8, 0x62a86ddf,
+0x17087df3, 0xd901ea4d, 0xc9d9a845, 0xd8dde9df,
+0x02a58a0f, 0x850f0000, 0x000002a3, 0xf362eed9,
+0x4d17087d, 0x45d902ea, 0x0fe9dfa8, 0x00029a8a,
+0x9a850f00, 0x62000002, 0x17087df3, 0xd903ea4d,
+0xe9dfa845, 0x028d8a0f, 0x00b80000, 0x0f000000,
+0x00028885, 0x8514d900, 0x001007e0, 0x20f88340,
+0xc9d9f375, 0xd9b855d9, 0x1007c005, 0xbc55d900,
+0x087df162, 0x07d00d6f, 0xf2620010, 0xc9270875,
+0x0875f162, 0xf162c9ef, 0xad28087c, 0xffffffb8,
+0x097df262, 0xe00d2ca3, 0xd9001007, 0x1007e005,
+0x0feadf00, 0x00023f8a, 0x41850f00, 0xd9000002,
+0x1007e405, 0x0febdf00, 0x0002408a, 0x42850f00,
+0x8a000002, 0xf162b445, 0xb528087c, 0xffffffb8,
+0xf892f8c5, 0x0f7df262, 0xe00d34a3, 0xd9001007,
+0x1007e005, 0x0fe9df00, 0x0002258a, 0x27850f00,
+0xd9000002, 0x1007e405, 0xddebdf00, 0x248a0fda,
+0x0f000002, 0x00022485, 0xb4458a00, 0x087df162,
+0xffc8bd6f, 0xf162ffff, 0xad28087c, 0xffffffb8,
+0xd092f8c5, 0x0a7df262, 0xe0bd2ca3, 0xd9001007,
+0x1007e405, 0x0fe9df00, 0x0001fb8a, 0xfb850f00,
+0xd9000001, 0x1007e805, 0x0feadf00, 0x0001f38a,
+0xf3850f00, 0x8a000001, 0xf162b445, 0xb56f087d,
+0xffffffd8, 0x087cf162, 0xffb8bd28, 0xf8c5ffff,
+0xf262d892, 0x3ca30b7d, 0x1007e0b5, 0xe405d900,
+0xdf001007, 0x0fd9ddea, 0x0001c88a, 0xc6850f00,
+0xd9000001, 0x1007e805, 0xdde9df00, 0xb88a0fd8,
+0xb8000001, 0x00000000, 0x01b2840f, 0xa8e90000,
+0xdd000001, 0xdd02ebd8, 0x00e7b8d8, 0x9de90000,
+0xdd000001, 0xdd0aebd8, 0xdd06ebd8, 0xdd02ebd8,
+0x00eab8d8, 0x85e90000, 0xdd000001, 0xdd0eebd8,
+0xdd0aebd8, 0xebd8ddd8, 0xddd8dd04, 0x00efb8d8,
+0x69e90000, 0xdd000001, 0xebd8ddd8, 0xddd8dd10,
+0xdd0aebd8, 0xebd8ddd8, 0xddd8dd04, 0x00f2b8d8,
+0x49e90000, 0xdd000001, 0xdd0aebd8, 0xdd06ebd8,
+0xdd02ebd8, 0x00f7b8d8, 0x31e90000, 0xdd000001,
+0xdd0aebd8, 0xdd06ebd8, 0xdd02ebd8, 0x00fab8d8,
+0x19e90000, 0xdd000001, 0xdd0aebd8, 0xdd06ebd8,
+0xdd02ebd8, 0x00ffb8d8, 0x01e90000, 0xdd000001,
+0xdd0aebd8, 0xdd06ebd8, 0xdd02ebd8, 0x0102b8d8,
+0xe9e90000, 0xdd000000, 0xebd8ddd8, 0xddd8dd10,
+0xdd0aebd8, 0xebd8ddd8, 0xddd8dd04, 0x010bb8d8,
+0xc9e90000, 0xdd000000, 0xebd8ddd8, 0xddd8dd0c,
+0xdd06ebd8, 0xdd02ebd8, 0x010eb8d8, 0xade90000,
+0xdd000000, 0xdd0aebd8, 0xdd06ebd8, 0xdd02ebd8,
+0x0115b8d8, 0x95e90000, 0xdd000000, 0xebd8ddd8,
+0xddd8dd10, 0xdd0aebd8, 0xebd8ddd8, 0xddd8dd04,
+0x0118b8d8, 0x78eb0000, 0xd8ddd8dd, 0x06ebd8dd,
+0xd8ddd8dd, 0x31b8d8dd, 0xeb000001, 0xddd8dd63,
+0xebd8ddd8, 0xddd8dd06, 0xb8d8ddd8, 0x00000134,
+0xd8dd4eeb, 0xd8ddd8dd, 0xd8dd06eb, 0xd8ddd8dd,
+0x000138b8, 0xdd39eb00, 0xebd8ddd8, 0xddd8dd04,
+0x013bb8d8, 0x28eb0000, 0xd8ddd8dd, 0xd8dd10eb,
+0x0aebd8dd, 0xd8ddd8dd, 0xd8dd04eb, 0x40b8d8dd,
+0xeb000001, 0xebd8dd0b, 0xb8d8dd02, 0x00000145,
+0x5b4cc483, 0xc35d5f5e, 0x00000000, 0x00000000,
+0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+0x40a00000, 0x40c00000, 0x40e00000, 0x41000000,
+0x41100000, 0x41200000, 0x41300000, 0x41400000,
+0x41500000, 0x41600000, 0x41700000, 0x41800000,
+0x41880000, 0x41900000, 0x41980000, 0x41a00000,
+0x41a80000, 0x41b00000, 0x41b80000, 0x41c00000,
+0x41c80000, 0x41d00000, 0x41d80000, 0x41e00000,
+0x41e80000, 0x41f00000, 0x41f80000, 0x42000000,
+0x40000000, 0x40400000, 0x40a00000, 0x00000000,
+0xffffffff, 0x00000000, 0x00000000, 0x00000000,
+0003740,
+};
+asm(".type avx512f_sg_x86_32_D_16x8f4, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_32_D_16x8f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_32_D_16x8f8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xd23155c3,
+0xc931e589, 0x53f63156, 0xec83db31, 0xd845c750,
+0x00000001, 0xc7dc5589, 0x0002e845, 0x4d890000,
+0xe045c7ec, 0x00000002, 0xc7e45d89, 0x0001f045,
+0x75890000, 0x76d9c5f4, 0xddf262e4, 0xc5cc2708,
+0x62c976f1, 0xef08e5f1, 0xfdf162db, 0xc5d12808,
+0x0fc193f8, 0xf8c5c0be, 0x4589d190, 0xfdf262c4,
+0x1d14930a, 0x00100640, 0x08fdf162, 0xd9f75513,
+0xb845dde8, 0x08fdf162, 0xffc89529, 0xe9dfffff,
+0x04168a0f, 0x850f0000, 0x00000414, 0x08fdf162,
+0xddf75517, 0xe9dfb845, 0x04068a0f, 0x850f0000,
+0x00000404, 0x08fdf162, 0xffd89d6f, 0xf162ffff,
+0xd12808fd, 0xd990f8c5, 0x0bfdf262, 0x40dd1493,
+0x62001006, 0x1308fdf1, 0x45ddf755, 0x4005d9b8,
+0x62001007, 0x2908fdf1, 0xffffc895, 0xd9c0d9ff,
+0xddeadfca, 0x0fc0d9d9, 0x0003c78a, 0xc9850f00,
+0x62000003, 0x1708fdf1, 0x05d9f755, 0x00100744,
+0xdfb845dd, 0xb98a0fe9, 0x0f000003, 0x0003bd85,
+0xd5f16200, 0x03f37308, 0x08fdf162, 0xf8c5d128,
+0xf262e190, 0x14930cfd, 0x1006406d, 0xfdf16200,
+0xf7551308, 0xdfb845dd, 0x62d8dde9, 0x2908fdf1,
+0xffffc895, 0x958a0fff, 0x0f000003, 0x00039785,
+0xfdf16200, 0xf7551708, 0x074805d9, 0x45dd0010,
+0xdde9dfb8, 0x858a0fd8, 0x0f000003, 0x00038785,
+0xe84d8b00, 0x08fdf162, 0xffe8ad6f, 0xf162ffff,
+0xd12808fd, 0xc5ec5d8b, 0x62e990f8, 0x930dfdf2,
+0x0640ed14, 0xf1620010, 0x952908fd, 0xffffffc8,
+0xc083c889, 0x89da8901, 0xd283b845, 0xbc558900,
+0x62b86ddf, 0x1308fdf1, 0x45ddf755, 0xdbc9d9b8,
+0x0fd9dde9, 0x00033f8a, 0x43850f00, 0x8b000003,
+0x558bf045, 0xb84589f4, 0x8901c083, 0xd283bc55,
+0xb0458900, 0xdfb45589, 0xf162b06d, 0x551708fd,
+0xb045ddf6, 0xe9dbc9d9, 0x8a0fd9dd, 0x0000031c,
+0x0322850f, 0xf1620000, 0xd2ef08ed, 0x08edf162,
+0xf162d3fb, 0xf12808fd, 0xf190f8c5, 0x0efdf262,
+0x50d53493, 0x62001006, 0x1208fff1, 0x10075015,
+0xedf16200, 0xc8955808, 0x62ffffff, 0x1f08cdf3,
+0xf8c500c2, 0x033cc093, 0x000107be, 0xb0850f00,
+0x62000003, 0x7308d5f1, 0xf26201f5, 0x0c9309fd,
+0x100640ad, 0xfdf16200, 0xf64d1308, 0xd9b045dd,
+0xddeadbca, 0xfdf162da, 0xc88d2908, 0x0fffffff,
+0x0002b78a, 0xbd850f00, 0x62000002, 0x1708fdf1,
+0x45ddf64d, 0xdfc9d9b0, 0x0fd8dde9, 0x0002b38a,
+0xb7850f00, 0x62000002, 0xdb08e5f1, 0xffffe895,
+0xd5f162ff, 0xc4edef08, 0xd52969e2, 0x08edf162,
+0xf262d4df, 0xca2708ed, 0x09fdf262, 0x40dd0c93,
+0x62001006, 0x1308fdf1, 0x45ddf64d, 0xdfc9d9b0,
+0x0fd8dde9, 0x0002878a, 0x89850f00, 0x8b000002,
+0x558bb845, 0x01c083bc, 0x83b84589, 0x558900d2,
+0xb86ddfbc, 0x08fdf162, 0xddf74d17, 0xc9d9b845,
+0xd8dde9df, 0x02668a0f, 0x00b80000, 0x0f000000,
+0x00026385, 0xdd02eb00, 0xddeed9d8, 0x0780c514,
+0x83400010, 0xef7520f8, 0x5dddcad9, 0x89c031d0,
+0x45c7c845, 0xf00000cc, 0xfdf1623f, 0x600d6f08,
+0x62001007, 0x2708f5f2, 0xfdf162c9, 0xc8bd2808,
+0x62ffffff, 0xef08f5f1, 0xfdf262c9, 0x0d3ca309,
+0x00100780, 0x078005dd, 0xebdf0010, 0x02138a0f,
+0x850f0000, 0x00000215, 0x078805dd, 0xeadf0010,
+0x02148a0f, 0x850f0000, 0x00000216, 0x62c4458a,
+0x2808fdf1, 0xffffc8bd, 0x92f8c5ff, 0xfdf262f8,
+0x0d3ca30f, 0x00100780, 0x078005dd, 0xe9df0010,
+0x8a0fd8dd, 0x000001f7, 0x01f7850f, 0x05dd0000,
+0x00100788, 0xd8dde9df, 0x01f28a0f, 0x850f0000,
+0x000001f0, 0x62c4458a, 0x6f08fdf1, 0xffffd8a5,
+0xfdf162ff, 0xc8bd2808, 0xc5ffffff, 0x62d092f8,
+0xa30afdf2, 0x0780e53c, 0x05dd0010, 0x00100788,
+0xd9dde9db, 0x01c38a0f, 0xe8d90000, 0xd9dde9db,
+0x01bb850f, 0x05d90000, 0x00100740, 0x079005dd,
+0xe9df0010, 0x01ab8a0f, 0x850f0000, 0x000001ab,
+0x62c4458a, 0x6f08fdf1, 0xffffe8a5, 0xfdf162ff,
+0xc8b52808, 0xc5ffffff, 0x62d892f8, 0xa30bfdf2,
+0x0780e534, 0x05dd0010, 0x00100788, 0xd8dde9df,
+0x01808a0f, 0x850f0000, 0x0000017e, 0x079005dd,
+0xe9df0010, 0x8a0fd8dd, 0x00000170, 0x000000be,
+0x76840f00, 0xe9000001, 0x00000160, 0x0aebd8dd,
+0x06ebd8dd, 0x02ebd8dd, 0xe7bed8dd, 0xe9000000,
+0x00000159, 0xd8ddd8dd, 0x1aebd8dd, 0xd8ddd8dd,
+0x12ebd8dd, 0xd8ddd8dd, 0xd8ddd8dd, 0xd8dd08eb,
+0xd8ddd8dd, 0xefbed8dd, 0xe9000000, 0x0000012d,
+0xd8ddd8dd, 0x16ebd8dd, 0xd8ddd8dd, 0x0eebd8dd,
+0xd8ddd8dd, 0x06ebd8dd, 0xd8ddd8dd, 0xf7bed8dd,
+0xe9000000, 0x00000105, 0xd8ddd8dd, 0xd8ddd8dd,
+0xd8dd20eb, 0xd8ddd8dd, 0x16ebd8dd, 0xd8ddd8dd,
+0xd8ddd8dd, 0x0aebd8dd, 0xd8ddd8dd, 0xd8ddd8dd,
+0xffbed8dd, 0xe9000000, 0x000000d1, 0xd8ddd8dd,
+0xd8ddd8dd, 0x1eebd8dd, 0xd8ddd8dd, 0xd8ddd8dd,
+0x12ebd8dd, 0xd8ddd8dd, 0xd8ddd8dd, 0xd8dd08eb,
+0xd8ddd8dd, 0x15bed8dd, 0xe9000001, 0x0000009d,
+0xd8ddd8dd, 0x16ebd8dd, 0xd8ddd8dd, 0x0eebd8dd,
+0xd8ddd8dd, 0x06ebd8dd, 0xd8ddd8dd, 0x1ebed8dd,
+0xeb000001, 0xddd8dd78, 0xebd8ddd8, 0xddd8dd06,
+0xbed8ddd8, 0x00000131, 0xd8dd63eb, 0xd8ddd8dd,
+0xd8dd06eb, 0xd8ddd8dd, 0x000134be, 0xdd4eeb00,
+0xebd8ddd8, 0xddd8dd04, 0x0138bed8, 0x3deb0000,
+0x02ebd8dd, 0x3bbed8dd, 0xeb000001, 0xebd8dd30,
+0xebd8dd0e, 0xddd8dd0a, 0xdd04ebd8, 0xbed8ddd8,
+0x00000140, 0xd8dd17eb, 0xd8dd02eb, 0x000145be,
+0xdd0aeb00, 0xddd8ddd8, 0xddd8ddd8, 0x50c483d8,
+0x5e5bf089, 0x0000c35d, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40100000,
+0x00000000, 0x40140000, 0x00000000, 0x40180000,
+0x00000000, 0x401c0000, 0x00000000, 0x40200000,
+0x00000000, 0x40220000, 0x00000000, 0x40240000,
+0x00000000, 0x40260000, 0x00000000, 0x40280000,
+0x00000000, 0x402a0000, 0x00000000, 0x402c0000,
+0x00000000, 0x402e0000, 0x00000000, 0x40300000,
+0x00000000, 0x40310000, 0x00000000, 0x40320000,
+0x00000000, 0x40330000, 0x00000000, 0x40340000,
+0x00000000, 0x40350000, 0x00000000, 0x40360000,
+0x00000000, 0x40370000, 0x00000000, 0x40380000,
+0x00000000, 0x40390000, 0x00000000, 0x403a0000,
+0x00000000, 0x403b0000, 0x00000000, 0x403c0000,
+0x00000000, 0x403d0000, 0x00000000, 0x403e0000,
+0x00000000, 0x403f0000, 0x00000000, 0x40400000,
+0x40000000, 0x40400000, 0x40a00000, 0x00000000,
+0x00000000, 0xbff00000, 0x00000000, 0x00000000,
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+0003560,
+};
+asm(".type avx512f_sg_x86_32_D_16x8f8, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_32_D_16x8f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_32_D_32x4i4[] = {
+0x315500eb, 0x53e589c0, 0x81e0e483, 0x0000a0ec,
+0x09ba4000, 0x89000000, 0x295c8444, 0x08f883c2,
+0x7c845489, 0xf5c5eb75, 0xf262c976, 0xc9272875,
+0x0865f162, 0xf162dbef, 0xd16f287d, 0xc193f8c5,
+0xc5c0be0f, 0x89d190f8, 0x311c2444, 0x7df262c0,
+0x1d14902a, 0x001003e0, 0x287df162, 0x0124547f,
+0x20847c83, 0x24850f01, 0x40000003, 0x7508f883,
+0x0002b8ef, 0xf1620000, 0x646f287d, 0xf1620324,
+0xd16f287d, 0xd990f8c5, 0x2b7df262, 0xe0a51490,
+0x62001003, 0x7f287df1, 0x39012454, 0x0f188444,
+0x0002f185, 0xf8834000, 0x62f0750a, 0x722865f1,
+0x03b802f4, 0x62000000, 0x6f287df1, 0x90f8c5d1,
+0x7df262e1, 0x5d14902c, 0x001003e0, 0x287df162,
+0x0124547f, 0x1a444439, 0x02bf850f, 0xc0830000,
+0x13f88302, 0xc031ee75, 0x287df162, 0x0424546f,
+0x287df162, 0xf8c5d96f, 0xf262e990, 0x1c902d7d,
+0x1003e095, 0x7df16200, 0x245c7f28, 0x848c8b01,
+0x00000080, 0x18244c89, 0x3901518d, 0x0f208454,
+0x00027f85, 0xf8834000, 0x62e27508, 0xef0865f1,
+0x65f162db, 0x245cfa28, 0x0001b803, 0xf1620000,
+0xe96f287d, 0xf190f8c5, 0x287df162, 0x0124746f,
+0x2e7df262, 0x009d2c90, 0x62001004, 0x7c287df2,
+0x4df162d8, 0x62dbfa28, 0x1f2855f3, 0xf8c500c3,
+0xc2fed093, 0x000107b8, 0x54850f00, 0x62000002,
+0x72286df1, 0xc03101f2, 0x287df162, 0xf262d96f,
+0x1c90297d, 0x1003e055, 0x7df16200, 0x245c7f28,
+0x849c8b01, 0x00000080, 0x18245c89, 0x3901538d,
+0x0f208454, 0x0001f285, 0xf8834000, 0x62e27508,
+0xdb285df1, 0x62042454, 0xef0855f1, 0x76edc5ed,
+0x6df162d5, 0x62c9df28, 0x272875f2, 0xb9c031c9,
+0x00000009, 0x297df262, 0xe0a51c90, 0x62001003,
+0x7f287df1, 0x8b02245c, 0x8940845c, 0xc22940ca,
+0x0674c285, 0x5c84548b, 0x548b04eb, 0x54897c84,
+0x39421824, 0x97850fd3, 0x83000001, 0xd77508f8,
+0xd231c031, 0x00851489, 0x40001005, 0x7540f883,
+0x2444c7f1, 0x00000120, 0x2444c700, 0x00000224,
+0x2444c700, 0x00000328, 0x2444c700, 0x0000042c,
+0x2444c700, 0x00000530, 0x2444c700, 0x00000634,
+0x2444c700, 0x00000738, 0x2444c700, 0x0000083c,
+0x7df16200, 0xe00d6f28, 0x62001004, 0x272875f2,
+0x7df162c9, 0x247c6f28, 0x75f16201, 0xb8c9ef08,
+0x00000131, 0x297df262, 0x000d3ca0, 0x83001005,
+0x1005003d, 0x850f0100, 0x00000127, 0x000001b8,
+0x853c8300, 0x00100500, 0xfa850f00, 0x40000000,
+0x7508f883, 0x24448aec, 0x75f1621c, 0x62c9ef08,
+0x6f287df1, 0xc5012474, 0x62f892f8, 0xa02f7df2,
+0x05000d34, 0x3d830010, 0x00100500, 0x0138b808,
+0x850f0000, 0x000000db, 0x000001ba, 0x95048b00,
+0x00100500, 0x850fc085, 0x000000b4, 0x08fa8342,
+0x4c8aeb75, 0x01ba1c24, 0x62000000, 0x6f287df1,
+0x6203247c, 0x6f287df1, 0xc5012474, 0x62d192f8,
+0xa02a7df2, 0x0500bd34, 0x14390010, 0x10050095,
+0x80850f00, 0x42000000, 0x7509fa83, 0x245c8aed,
+0x0001ba1c, 0x09b90000, 0x62000000, 0x6f287df1,
+0x6204247c, 0x6f287df1, 0xc5012464, 0x62db92f8,
+0xa02b7df2, 0x0500bd24, 0xcb890010, 0x1c39d329,
+0x10050095, 0x42477500, 0x7509fa83, 0xb844ebed,
+0x000000e7, 0xefb83deb, 0xeb000000, 0x00f7b836,
+0x2feb0000, 0x0000ffb8, 0xb828eb00, 0x00000115,
+0x1eb821eb, 0xeb000001, 0x0134b81a, 0x13eb0000,
+0x00013bb8, 0xb80ceb00, 0x00000140, 0x45b805eb,
+0x8b000001, 0xc3c9fc5d, 0x00000000, 0x00000000,
+0x00000001, 0x00000002, 0x00000003, 0x00000004,
+0x00000005, 0x00000006, 0x00000007, 0x00000008,
+0x00000009, 0x0000000a, 0x0000000b, 0x0000000c,
+0x0000000d, 0x0000000e, 0x0000000f, 0x00000010,
+0x00000011, 0x00000012, 0x00000013, 0x00000014,
+0x00000015, 0x00000016, 0x00000017, 0x00000018,
+0x00000019, 0x0000001a, 0x0000001b, 0x0000001c,
+0x0000001d, 0x0000001e, 0x0000001f, 0x00000020,
+0x00000021, 0x00000022, 0x00000023, 0x00000024,
+0x00000025, 0x00000026, 0x00000027, 0x00000028,
+0x00000029, 0x0000002a, 0x0000002b, 0x0000002c,
+0x0000002d, 0x0000002e, 0x0000002f, 0x00000030,
+0x00000031, 0x00000032, 0x00000033, 0x00000034,
+0x00000035, 0x00000036, 0x00000037, 0x00000038,
+0x00000039, 0x0000003a, 0x0000003b, 0x0000003c,
+0x0000003d, 0x0000003e, 0x0000003f, 0x00000040,
+0xffffffff, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0002400,
+};
+asm(".type avx512f_sg_x86_32_D_32x4i4, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_32_D_32x4i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_32_D_32x4i8[] = {
+0x895500eb, 0xe48353e5, 0x60ec83e0, 0x202444c7,
+0x00000001, 0x302444c7, 0x00000004, 0x242444c7,
+0x00000002, 0x342444c7, 0x00000003, 0x282444c7,
+0x00000003, 0x382444c7, 0x00000002, 0x2c2444c7,
+0x00000004, 0x3c2444c7, 0x00000001, 0xc976f5c5,
+0x28f5f262, 0xf162c927, 0xdbef08e5, 0x28fdf162,
+0xf8c5d16f, 0xbe0fc193, 0x90f8c5c0, 0x244489d1,
+0x62c0311c, 0x902afdf2, 0x05001d14, 0xf1620010,
+0x547f28fd, 0x5c8b0224, 0x5c8940c4, 0xda891024,
+0x0b01f283, 0x0f44c454, 0x00042f85, 0xf8834000,
+0x62e37504, 0x6f08fdf1, 0x62022454, 0x6f28fdf1,
+0x90f8c5d9, 0xfdf262d9, 0xd51c902b, 0x00100500,
+0x087df162, 0xc189d87e, 0xc402f183, 0xda1679e3,
+0x00efbb01, 0xd1090000, 0x28fdf162, 0x02245c7f,
+0x0400850f, 0xf1620000, 0x5c17087c, 0x548b0224,
+0xf2831024, 0x24540b03, 0xe7850f14, 0x62000003,
+0x3928fdf3, 0xf36201dd, 0xdc39287d, 0xfdf16201,
+0x246cd608, 0x24548b02, 0x04f28310, 0x1424540b,
+0x03c0850f, 0xf1620000, 0x6417087c, 0x548b0224,
+0xf2831024, 0x24540b05, 0xa7850f14, 0x62000003,
+0x720865f1, 0xf8c503f2, 0xf162e190, 0xd16f28fd,
+0x2cfdf262, 0x005d1490, 0x62001005, 0x7e087df1,
+0x83c189d0, 0xe3c403f1, 0x01d21679, 0x0000f7bb,
+0x62d10900, 0x7f28fdf1, 0x0f022454, 0x00036585,
+0x7cf16200, 0x24541708, 0x24548b02, 0x05f28310,
+0x1424540b, 0x034c850f, 0xf3620000, 0xd63928fd,
+0x7df36201, 0x01d33928, 0x08fdf162, 0x022474d6,
+0x1024548b, 0x0b07f283, 0x0f142454, 0x00032585,
+0x7cf16200, 0x245c1708, 0x24548b02, 0x09f28310,
+0x1424540b, 0x030c850f, 0xc0310000, 0x08fdf162,
+0x0324546f, 0x28fdf162, 0xf8c5d96f, 0xf262e990,
+0x1c902dfd, 0x100500d5, 0xfdf16200, 0x245c7f28,
+0x845c8b02, 0x01538d30, 0xfbc1d389, 0xc45c391f,
+0xbc850f44, 0x39000002, 0x0f40c454, 0x0002b285,
+0xf8834000, 0x62da7504, 0xef08e5f1, 0x65f162db,
+0x245cfa08, 0xfdf16202, 0xc5e16f28, 0x62f190f8,
+0x6f28fdf1, 0xbb02247c, 0x00000107, 0x2efdf262,
+0x20dd2490, 0x62001005, 0xfb38c5f1, 0x1007001d,
+0xddf36200, 0x00c31f28, 0xd093f8c5, 0x0f0ffa80,
+0x00027185, 0x6df16200, 0x01f27208, 0xf262c031,
+0x0c9029fd, 0x10050095, 0xfdf16200, 0x244c7f28,
+0x845c8b02, 0x01538d30, 0xfbc1d389, 0xc45c391f,
+0x33850f44, 0x39000002, 0x0f40c454, 0x00022985,
+0xf8834000, 0x31da7504, 0x89d231c0, 0x0740c514,
+0x14890010, 0x100744c5, 0xf8834000, 0x31ea7540,
+0xc7d231c0, 0x01402444, 0x31000000, 0x89db31c9,
+0xc7442444, 0x02482444, 0x89000000, 0xc74c2454,
+0x03502444, 0x89000000, 0xc754244c, 0x04582444,
+0x89000000, 0x625c245c, 0x6f28fdf1, 0x1007200d,
+0xf5f26200, 0x62c92728, 0xef08edf1, 0xfdf162d2,
+0x246c6f28, 0x0131bb02, 0xf2620000, 0x2ca029fd,
+0x10074015, 0x40158b00, 0x83001007, 0x150b01f2,
+0x00100744, 0x019c850f, 0xf1620000, 0x1d7e08fe,
+0x00100750, 0x08fef162, 0x07480d7e, 0x34bb0010,
+0x62000001, 0xeb08f5f1, 0xfef162cb, 0x581d7e08,
+0x62001007, 0xeb08f5f1, 0xf5f162cb, 0xc4c96c08,
+0xc91779e2, 0x015c850f, 0x448a0000, 0xf1621c24,
+0x746f28fd, 0x38bb0224, 0xc5000001, 0x62f892f8,
+0xa02ffdf2, 0x07401534, 0x158b0010, 0x00100740,
+0x0b04f283, 0x10074415, 0x27850f00, 0x62000001,
+0x7e08fef1, 0x10075015, 0xfef16200, 0x480d7e08,
+0xbb001007, 0x0000013b, 0x08f5f162, 0xf162caeb,
+0x157e08fe, 0x00100758, 0x08f5f162, 0xf162caeb,
+0xc96c08f5, 0x1779e2c4, 0xe7850fc9, 0x8a000000,
+0x311c2444, 0xfdf162d2, 0x247c6f08, 0xfdf16202,
+0x246c6f28, 0x92f8c502, 0x0001b8d0, 0xf2620000,
+0x2ca02afd, 0x100740fd, 0xc50c8d00, 0x00000000,
+0x07449139, 0x850f0010, 0x000000a5, 0x07408139,
+0x850f0010, 0x00000099, 0x8901c083, 0x00d283c1,
+0x0905f183, 0x8ad275d1, 0x621c2444, 0x6f08fdf1,
+0x62032474, 0x6f28fdf1, 0xbb02247c, 0x00000145,
+0xd892f8c5, 0x2bfdf262, 0x40f53ca0, 0x8b001007,
+0x10074815, 0x04f28300, 0x074c150b, 0x56750010,
+0x0750158b, 0xf2830010, 0x54150b03, 0x75001007,
+0x58158b45, 0x83001007, 0x150b02f2, 0x0010075c,
+0x60a13475, 0x83001007, 0x050b01f0, 0x00100764,
+0xdb19d8f7, 0x0145e381, 0x1aeb0000, 0x0000e7bb,
+0xbb13eb00, 0x000000ff, 0x15bb0ceb, 0xeb000001,
+0x0140bb05, 0xd8890000, 0xc9fc5d8b, 0x000000c3,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000000, 0x00000002, 0x00000000,
+0x00000003, 0x00000000, 0x00000004, 0x00000000,
+0x00000005, 0x00000000, 0x00000006, 0x00000000,
+0x00000007, 0x00000000, 0x00000008, 0x00000000,
+0x00000009, 0x00000000, 0x0000000a, 0x00000000,
+0x0000000b, 0x00000000, 0x0000000c, 0x00000000,
+0x0000000d, 0x00000000, 0x0000000e, 0x00000000,
+0x0000000f, 0x00000000, 0x00000010, 0x00000000,
+0x00000011, 0x00000000, 0x00000012, 0x00000000,
+0x00000013, 0x00000000, 0x00000014, 0x00000000,
+0x00000015, 0x00000000, 0x00000016, 0x00000000,
+0x00000017, 0x00000000, 0x00000018, 0x00000000,
+0x00000019, 0x00000000, 0x0000001a, 0x00000000,
+0x0000001b, 0x00000000, 0x0000001c, 0x00000000,
+0x0000001d, 0x00000000, 0x0000001e, 0x00000000,
+0x0000001f, 0x00000000, 0x00000020, 0x00000000,
+0x00000021, 0x00000000, 0x00000022, 0x00000000,
+0x00000023, 0x00000000, 0x00000024, 0x00000000,
+0x00000025, 0x00000000, 0x00000026, 0x00000000,
+0x00000027, 0x00000000, 0x00000028, 0x00000000,
+0x00000029, 0x00000000, 0x0000002a, 0x00000000,
+0x0000002b, 0x00000000, 0x0000002c, 0x00000000,
+0x0000002d, 0x00000000, 0x0000002e, 0x00000000,
+0x0000002f, 0x00000000, 0x00000030, 0x00000000,
+0x00000031, 0x00000000, 0x00000032, 0x00000000,
+0x00000033, 0x00000000, 0x00000034, 0x00000000,
+0x00000035, 0x00000000, 0x00000036, 0x00000000,
+0x00000037, 0x00000000, 0x00000038, 0x00000000,
+0x00000039, 0x00000000, 0x0000003a, 0x00000000,
+0x0000003b, 0x00000000, 0x0000003c, 0x00000000,
+0x0000003d, 0x00000000, 0x0000003e, 0x00000000,
+0x0000003f, 0x00000000, 0x00000040, 0x00000000,
+0x00000001, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0003500,
+};
+asm(".type avx512f_sg_x86_32_D_32x4i8, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_32_D_32x4i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_32_D_32x4f4[] = {
+0x315500eb, 0x83e589c0, 0xec81e0e4, 0x000000a0,
+0x0009ba40, 0x44890000, 0xc2295c84, 0x8908f883,
+0x757c8454, 0x76ddc5eb, 0x5df262e4, 0xc5cc2728,
+0x62c976f5, 0xef0865f1, 0x7cf162db, 0xc5d12828,
+0x0fc193f8, 0xf8c5c0be, 0x4489d190, 0xc0311c24,
+0x2a7df262, 0xe01d1492, 0x62001004, 0x29287cf1,
+0xeb012454, 0xd9d8dd02, 0x8444d9e8, 0x0fe9df20,
+0x0003b98a, 0xb7850f00, 0x40000003, 0x7508f883,
+0x0002b8e4, 0xf1620000, 0x5c6f287d, 0xf1620324,
+0xd128287c, 0xd990f8c5, 0x2b7df262, 0xe09d1492,
+0x62001004, 0x29287cf1, 0x89012454, 0xd9182444,
+0xdb188444, 0xd9182444, 0xdde9dfc9, 0x7b8a0fd8,
+0x0f000003, 0x00037985, 0xf8834000, 0x62dc750a,
+0x722855f1, 0x03b802f3, 0x62000000, 0x28287cf1,
+0x90f8c5d1, 0x7df262e1, 0x6d14922c, 0x001004e0,
+0x287cf162, 0x01245429, 0x18244489, 0x1a4444d9,
+0x182444db, 0xe9dfc9d9, 0x8a0fd8dd, 0x0000033e,
+0x033c850f, 0xc0830000, 0x13f88302, 0xc031da75,
+0x287df162, 0x0424546f, 0x287cf162, 0xf8c5e928,
+0xf262e990, 0x2c922d7d, 0x1004e095, 0x7cf16200,
+0x246c2928, 0x848c8b01, 0x00000080, 0x8901518d,
+0xdb182454, 0xd9182444, 0xdf208444, 0x0fd8dde9,
+0x0002f68a, 0xf4850f00, 0x40000002, 0x7508f883,
+0x55f162d4, 0x62edef08, 0xfa2855f1, 0x6203246c,
+0x28287cf1, 0x90f8c5f1, 0x0107b8f1, 0xf2620000,
+0x34922e7d, 0x100500ad, 0x7df26200, 0xe02d1828,
+0x62001005, 0x582854f1, 0x6201246c, 0x1f284df3,
+0xf8c500c5, 0xc2fed093, 0x030e850f, 0xf1620000,
+0xf272286d, 0x62c03101, 0x92297df2, 0x04e0550c,
+0xf1620010, 0x4c29287c, 0x8c8b0124, 0x00008084,
+0x01518d00, 0x18245489, 0x182444db, 0x208444d9,
+0xd8dde9df, 0x026e8a0f, 0x850f0000, 0x0000026c,
+0x08f88340, 0xf162d475, 0x54db2865, 0xf1620424,
+0xedef0855, 0xd576edc5, 0x286df162, 0xf262d4df,
+0xca27286d, 0x09b9c031, 0x62000000, 0x92297df2,
+0x04e09d0c, 0xf1620010, 0x4c29287c, 0x44d90224,
+0xca894084, 0x85c22940, 0x8b0674c2, 0xeb5c8454,
+0x84548b04, 0x5489427c, 0x44db1824, 0xc9d91824,
+0xd8dde9df, 0x020b8a0f, 0x850f0000, 0x00000209,
+0x7508f883, 0xebc031c9, 0xd9d8dd02, 0x8514d9ee,
+0x00100620, 0x40f88340, 0xc9d9ef75, 0x242444c7,
+0x40000000, 0x202454d9, 0x282444c7, 0x40400000,
+0x05e405d9, 0x44c70010, 0x00002c24, 0x44c74080,
+0x00003024, 0x54d940a0, 0x44c73c24, 0x00003424,
+0x44c740c0, 0x00003824, 0xf16240e0, 0x0d6f287d,
+0x00100600, 0x2875f262, 0xf162c927, 0x7c28287c,
+0xf1620124, 0xc9ef0875, 0x297df262, 0x200d3ca2,
+0xd9001006, 0x10062005, 0xddeadf00, 0x7f8a0fd9,
+0xb8000001, 0x00000001, 0x017a850f, 0x04d90000,
+0x10062085, 0x0feadf00, 0x0001768a, 0x76850f00,
+0x40000001, 0x7508f883, 0x24448ae5, 0x75f1621c,
+0x62c9ef08, 0x28287cf1, 0xc501247c, 0x62f892f8,
+0xa22f7df2, 0x06200d3c, 0x05d90010, 0x00100620,
+0xd8dde9df, 0x014a8a0f, 0x01b80000, 0x0f000000,
+0x00014385, 0x8504d900, 0x00100620, 0x8a0fe9df,
+0x0000013d, 0x013b850f, 0x83400000, 0xe57508f8,
+0x448ad8dd, 0xf1621c24, 0x646f287d, 0xf1620324,
+0x7c28287c, 0xf8c50124, 0x01b8d092, 0x62000000,
+0xa22a7df2, 0x0620a53c, 0x44890010, 0x04d91824,
+0x10062085, 0x2444db00, 0xdfc9d918, 0x0fd8dde9,
+0x0000f98a, 0xf3850f00, 0x40000000, 0x7509f883,
+0x24448ad9, 0x0009ba1c, 0xf1620000, 0x646f287d,
+0xf1620424, 0x7428287c, 0xf8c50124, 0x01b8d892,
+0x62000000, 0xa22b7df2, 0x0620a534, 0xd1890010,
+0x4c89c129, 0x44db1c24, 0x04d91c24, 0x10062085,
+0xdde9df00, 0xaa8a0fd8, 0x0f000000, 0x0000a485,
+0xf8834000, 0x31d77509, 0x00a0e9c0, 0xd8dd0000,
+0xd8dd02eb, 0x0000e7b8, 0x0090e900, 0xd8dd0000,
+0xd8dd02eb, 0x0000efb8, 0x0080e900, 0xd8dd0000,
+0xd8dd02eb, 0x0000f7b8, 0xdd73eb00, 0xdd02ebd8,
+0x00ffb8d8, 0x66eb0000, 0x02ebd8dd, 0x15b8d8dd,
+0xeb000001, 0xebd8dd59, 0xb8d8dd02, 0x0000011e,
+0xd8dd4ceb, 0x04ebd8dd, 0xd8ddd8dd, 0x000131b8,
+0xdd3beb00, 0xebd8ddd8, 0xddd8dd04, 0x0134b8d8,
+0x2aeb0000, 0x02ebd8dd, 0x38b8d8dd, 0xeb000001,
+0xebd8dd1d, 0xb8d8dd02, 0x0000013b, 0x40b810eb,
+0xeb000001, 0x0145b809, 0x02eb0000, 0xc3c9d8dd,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+0x40a00000, 0x40c00000, 0x40e00000, 0x41000000,
+0x41100000, 0x41200000, 0x41300000, 0x41400000,
+0x41500000, 0x41600000, 0x41700000, 0x41800000,
+0x41880000, 0x41900000, 0x41980000, 0x41a00000,
+0x41a80000, 0x41b00000, 0x41b80000, 0x41c00000,
+0x41c80000, 0x41d00000, 0x41d80000, 0x41e00000,
+0x41e80000, 0x41f00000, 0x41f80000, 0x42000000,
+0x42040000, 0x42080000, 0x420c0000, 0x42100000,
+0x42140000, 0x42180000, 0x421c0000, 0x42200000,
+0x42240000, 0x42280000, 0x422c0000, 0x42300000,
+0x42340000, 0x42380000, 0x423c0000, 0x42400000,
+0x42440000, 0x42480000, 0x424c0000, 0x42500000,
+0x42540000, 0x42580000, 0x425c0000, 0x42600000,
+0x42640000, 0x42680000, 0x426c0000, 0x42700000,
+0x42740000, 0x42780000, 0x427c0000, 0x42800000,
+0xbf800000, 0x41000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0xffffffff, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0003040,
+};
+asm(".type avx512f_sg_x86_32_D_32x4f4, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_32_D_32x4f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_32_D_32x4f8[] = {
+0x895500eb, 0xe0e483e5, 0xc760ec83, 0x01202444,
+0xc7000000, 0x04302444, 0xc7000000, 0x02242444,
+0xc7000000, 0x03342444, 0xc7000000, 0x03282444,
+0xc7000000, 0x02382444, 0xc7000000, 0x042c2444,
+0xc7000000, 0x013c2444, 0xc5000000, 0x62c976f5,
+0x2728f5f2, 0xe5f162c9, 0xc5dbef08, 0x62c976f5,
+0x2828fdf1, 0x93f8c5d1, 0xc0be0fc1, 0xd190f8c5,
+0x1c244489, 0xf262c031, 0x14922afd, 0x1007401d,
+0xfdf16200, 0x24542928, 0xdd02eb02, 0xc444ddd8,
+0x2454dd40, 0xd9e8d910, 0x0fe9dfc9, 0x0004a38a,
+0xa1850f00, 0x40000004, 0x7504f883, 0xfdf162de,
+0x24546f08, 0xfdf16202, 0xc5d92828, 0x62d990f8,
+0x922bfdf2, 0x0740d51c, 0xf1620010, 0x5c1308fd,
+0x44dd0224, 0x05d91024, 0x00100940, 0x28fdf162,
+0x02245c29, 0xcad9c0d9, 0xd9ddeadf, 0x04628a0f,
+0x850f0000, 0x00000462, 0x08fdf162, 0x02245c17,
+0x102444dd, 0x094405d9, 0xc0d90010, 0xeadfcad9,
+0xc0d9d9dd, 0x04468a0f, 0x850f0000, 0x0000044a,
+0x28fdf362, 0xd901dd19, 0x10094805, 0x7df36200,
+0x01dc1928, 0xf162c0d9, 0x6c1108ff, 0x44dd0224,
+0xe9df1024, 0x8a0fd8dd, 0x00000428, 0x042e850f,
+0xf1620000, 0x641708fd, 0x44dd0224, 0x05d91024,
+0x0010094c, 0xcad9c0d9, 0xd9ddeadf, 0x041a8a0f,
+0x850f0000, 0x00000422, 0x0865f162, 0xc503f272,
+0x62e190f8, 0x2828fdf1, 0xfdf262d1, 0x5d14922c,
+0x00100740, 0x08fdf162, 0x02245413, 0x102444dd,
+0xdaddebdf, 0x28fdf162, 0x02245429, 0x03fe8a0f,
+0x850f0000, 0x00000404, 0x08fdf162, 0x02245417,
+0x102444dd, 0xd9ddeadf, 0x03fa8a0f, 0x850f0000,
+0x000003fe, 0x28fdf362, 0xd901d619, 0x10095005,
+0x7df36200, 0x01d31928, 0x08fff162, 0x02247411,
+0x102444dd, 0xd8dde9df, 0x03de8a0f, 0x850f0000,
+0x000003e2, 0x08fdf162, 0x02245c17, 0x095405d9,
+0x44dd0010, 0xe9df1024, 0x8a0fd8dd, 0x000003d0,
+0x03d4850f, 0xc0310000, 0x08fdf162, 0x0324546f,
+0x28fdf162, 0xf8c5d928, 0xf262e990, 0x1c922dfd,
+0x100740d5, 0xfdf16200, 0x245c2928, 0x844c8b02,
+0x01518d30, 0x10245489, 0x102444db, 0x40c444dd,
+0x102454dd, 0xd8dde9df, 0x039e8a0f, 0x850f0000,
+0x000003a2, 0x04f88340, 0xf162d375, 0xdbef08e5,
+0x0865f162, 0x02245cfa, 0x28fdf162, 0xf8c5e128,
+0x07b8f190, 0x62000001, 0x922efdf2, 0x0760dd24,
+0xf2620010, 0x1d1928fd, 0x00100958, 0x28e5f162,
+0x02245c58, 0x28ddf362, 0xc500c31f, 0x80d093f8,
+0x850f0ffa, 0x00000469, 0x086df162, 0x3101f272,
+0xfdf262c0, 0x950c9229, 0x00100740, 0x28fdf162,
+0x02244c29, 0x3084548b, 0x24548942, 0x2444db10,
+0xc444dd10, 0x2454dd40, 0xdde9df10, 0x258a0fd8,
+0x0f000003, 0x00032985, 0xf8834000, 0x31d57504,
+0xdd02ebc0, 0xddeed9d8, 0x0980c514, 0x83400010,
+0xef7540f8, 0x5cddcbd9, 0xc9d94824, 0x4489c031,
+0x5cdd4024, 0x44c75024, 0x00004424, 0x54dd3ff0,
+0xf1625824, 0x0d6f28fd, 0x00100960, 0x28f5f262,
+0xf162c927, 0x7c2828fd, 0xf1620224, 0xc9ef08f5,
+0x29fdf262, 0x800d3ca2, 0xdd001009, 0x10098005,
+0xddebdf00, 0xc98a0fda, 0x0f000002, 0x0002c985,
+0xddc0d900, 0x10098805, 0xdde9df00, 0xc58a0fd8,
+0x0f000002, 0x0002c585, 0x9005dd00, 0xdf001009,
+0xbd8a0fe9, 0x0f000002, 0x0002bd85, 0x9805dd00,
+0xdf001009, 0xb58a0fe9, 0x0f000002, 0x0002b585,
+0x24448a00, 0xfdf1621c, 0x246c2828, 0x92f8c502,
+0xfdf262f8, 0x0d2ca22f, 0x00100980, 0x098005dd,
+0xeadb0010, 0x05d9dadd, 0x00100948, 0x02928a0f,
+0xeadb0000, 0x850fdadd, 0x00000290, 0x098805dd,
+0xe9df0010, 0x02908a0f, 0x850f0000, 0x00000290,
+0x099005dd, 0xe9df0010, 0x02888a0f, 0x850f0000,
+0x00000288, 0x099805dd, 0xe9df0010, 0x8a0fd8dd,
+0x0000027e, 0x027c850f, 0x448a0000, 0xe8d91c24,
+0x08fdf162, 0x0224746f, 0x28fdf162, 0x02247c28,
+0xd092f8c5, 0x2afdf262, 0x80f53ca2, 0xdd001009,
+0x10098805, 0x0fe9df00, 0x0002528a, 0x52850f00,
+0xd9000002, 0x10094005, 0xddc0d900, 0x10099005,
+0xdde9df00, 0x408a0fd8, 0x0f000002, 0x00024285,
+0x4405d900, 0xdd001009, 0x10099805, 0x0fe9df00,
+0x0002368a, 0x3a850f00, 0xdd000002, 0x1009a005,
+0x0fecdf00, 0x0002368a, 0x3a850f00, 0x8a000002,
+0x621c2444, 0x6f08fdf1, 0x6203246c, 0x2828fdf1,
+0xc5022474, 0x62d892f8, 0xa22bfdf2, 0x0980ed34,
+0x05dd0010, 0x00100988, 0xdbddecdf, 0x02168a0f,
+0x850f0000, 0x00000218, 0x099005dd, 0xebdf0010,
+0x8a0fdadd, 0x00000210, 0x0210850f, 0x05dd0000,
+0x00100998, 0xd9ddeadf, 0x02068a0f, 0x850f0000,
+0x00000204, 0x09a005dd, 0xe9df0010, 0x8a0fd8dd,
+0x000001f6, 0x000000b8, 0xfa840f00, 0xe9000001,
+0x000001e6, 0x02ebd8dd, 0xe7b8d8dd, 0xe9000000,
+0x000001e5, 0xd8ddd8dd, 0xd8dd4ceb, 0x46ebd8dd,
+0xd8ddd8dd, 0xd8ddd8dd, 0xd8dd3ceb, 0xd8ddd8dd,
+0x32ebd8dd, 0xd8ddd8dd, 0xd8ddd8dd, 0x26ebd8dd,
+0xd8ddd8dd, 0xd8ddd8dd, 0x1aebd8dd, 0xd8ddd8dd,
+0xd8ddd8dd, 0xd8ddd8dd, 0xd8dd0ceb, 0xd8ddd8dd,
+0xd8ddd8dd, 0xefb8d8dd, 0xe9000000, 0x00000189,
+0xd8ddd8dd, 0xd8ddd8dd, 0x46ebd8dd, 0xd8ddd8dd,
+0xd8ddd8dd, 0x3aebd8dd, 0xd8ddd8dd, 0xd8ddd8dd,
+0xd8dd30eb, 0xd8ddd8dd, 0x26ebd8dd, 0xd8ddd8dd,
+0xd8ddd8dd, 0xd8dd1ceb, 0xd8ddd8dd, 0x12ebd8dd,
+0xd8ddd8dd, 0xd8ddd8dd, 0xd8dd08eb, 0xd8ddd8dd,
+0xf7b8d8dd, 0xe9000000, 0x0000012d, 0xd8ddd8dd,
+0xd8ddd8dd, 0xd8dd08eb, 0xd8ddd8dd, 0xffb8d8dd,
+0xe9000000, 0x00000111, 0xd8ddd8dd, 0xd8ddd8dd,
+0xd8dd08eb, 0xd8ddd8dd, 0x15b8d8dd, 0xe9000001,
+0x000000f5, 0xd8ddd8dd, 0xd8dd04eb, 0x31b8d8dd,
+0xe9000001, 0x000000e1, 0xd8ddd8dd, 0xd8dd1ceb,
+0x16ebd8dd, 0xd8ddd8dd, 0xd8dd10eb, 0x0aebd8dd,
+0xd8ddd8dd, 0xd8dd04eb, 0x34b8d8dd, 0xe9000001,
+0x000000b5, 0xd8ddd8dd, 0x04ebd8dd, 0xd8ddd8dd,
+0x000138b8, 0x009fe900, 0xd8dd0000, 0x18ebd8dd,
+0xd8ddd8dd, 0xd8dd12eb, 0x0cebd8dd, 0xd8ddd8dd,
+0xd8dd06eb, 0xd8dd02eb, 0x00013bb8, 0xdd7aeb00,
+0xebd8ddd8, 0xddd8dd3c, 0xdd36ebd8, 0xddd8ddd8,
+0xdd2eebd8, 0xddd8ddd8, 0xdd26ebd8, 0xddd8ddd8,
+0xebd8ddd8, 0xddd8dd1c, 0xddd8ddd8, 0xdd12ebd8,
+0xddd8ddd8, 0xebd8ddd8, 0xddd8dd08, 0xddd8ddd8,
+0x0140b8d8, 0x31eb0000, 0xd8ddd8dd, 0x1aebd8dd,
+0xd8ddd8dd, 0x12ebd8dd, 0xd8ddd8dd, 0xd8dd0ceb,
+0x06ebd8dd, 0x02ebd8dd, 0x45b8d8dd, 0xeb000001,
+0xddd8dd08, 0xddd8ddd8, 0x00c3c9d8, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40100000,
+0x00000000, 0x40140000, 0x00000000, 0x40180000,
+0x00000000, 0x401c0000, 0x00000000, 0x40200000,
+0x00000000, 0x40220000, 0x00000000, 0x40240000,
+0x00000000, 0x40260000, 0x00000000, 0x40280000,
+0x00000000, 0x402a0000, 0x00000000, 0x402c0000,
+0x00000000, 0x402e0000, 0x00000000, 0x40300000,
+0x00000000, 0x40310000, 0x00000000, 0x40320000,
+0x00000000, 0x40330000, 0x00000000, 0x40340000,
+0x00000000, 0x40350000, 0x00000000, 0x40360000,
+0x00000000, 0x40370000, 0x00000000, 0x40380000,
+0x00000000, 0x40390000, 0x00000000, 0x403a0000,
+0x00000000, 0x403b0000, 0x00000000, 0x403c0000,
+0x00000000, 0x403d0000, 0x00000000, 0x403e0000,
+0x00000000, 0x403f0000, 0x00000000, 0x40400000,
+0x00000000, 0x40408000, 0x00000000, 0x40410000,
+0x00000000, 0x40418000, 0x00000000, 0x40420000,
+0x00000000, 0x40428000, 0x00000000, 0x40430000,
+0x00000000, 0x40438000, 0x00000000, 0x40440000,
+0x00000000, 0x40448000, 0x00000000, 0x40450000,
+0x00000000, 0x40458000, 0x00000000, 0x40460000,
+0x00000000, 0x40468000, 0x00000000, 0x40470000,
+0x00000000, 0x40478000, 0x00000000, 0x40480000,
+0x00000000, 0x40488000, 0x00000000, 0x40490000,
+0x00000000, 0x40498000, 0x00000000, 0x404a0000,
+0x00000000, 0x404a8000, 0x00000000, 0x404b0000,
+0x00000000, 0x404b8000, 0x00000000, 0x404c0000,
+0x00000000, 0x404c8000, 0x00000000, 0x404d0000,
+0x00000000, 0x404d8000, 0x00000000, 0x404e0000,
+0x00000000, 0x404e8000, 0x00000000, 0x404f0000,
+0x00000000, 0x404f8000, 0x00000000, 0x40500000,
+0x40000000, 0x40400000, 0x40800000, 0x40a00000,
+0x40e00000, 0x41100000, 0x00000000, 0xbff00000,
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0004600,
+};
+asm(".type avx512f_sg_x86_32_D_32x4f8, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_32_D_32x4f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_32_D_32x8i4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0xc931e589, 0x56ff3157, 0x3153f631, 0xe0e483db,
+0x8960ec83, 0x31342444, 0x244489c0, 0x89c03154,
+0x313c2444, 0x2444c7c0, 0x00000120, 0x244c8900,
+0x2444c724, 0x00000440, 0x245c8900, 0x2444c744,
+0x00000228, 0x24748900, 0x2444c72c, 0x00000348,
+0x247c8900, 0x2444c74c, 0x00000330, 0x2444c700,
+0x00000250, 0x2444c700, 0x00000438, 0x2444c700,
+0x00000158, 0x24448900, 0x76f1c55c, 0x75f262c9,
+0x62c92708, 0xef0865f1, 0x7df162db, 0xc5d16f08,
+0x0fc193f8, 0xf8c5c0be, 0x4489d190, 0xc0310c24,
+0x2a7df262, 0x201d1491, 0x62001004, 0x7f087df1,
+0x83012454, 0x0110847c, 0x031c850f, 0x83400000,
+0xef7504f8, 0x287df162, 0x01245c6f, 0x087df162,
+0xf8c5d16f, 0xf262d990, 0x14912b7d, 0x1004209d,
+0x7df16200, 0x83d27e08, 0xefb802fa, 0x62000000,
+0x7f087df1, 0x0f012454, 0x00030585, 0x79e3c400,
+0x8301d216, 0x850f03fa, 0x000002f6, 0x1679e3c4,
+0xfa8302d2, 0xe7850f04, 0xc4000002, 0xd21679e3,
+0x05fa8303, 0x02d8850f, 0xf1620000, 0xf37328e5,
+0x7df16202, 0xc5d16f08, 0x62e190f8, 0x912c7df2,
+0x04205d14, 0xf1620010, 0xd27e087d, 0xb803fa83,
+0x000000f7, 0x087df162, 0x0124547f, 0x02a0850f,
+0xe3c40000, 0x01d21679, 0x0f05fa83, 0x00029185,
+0x79e3c400, 0x8302d216, 0x850f07fa, 0x00000282,
+0x1679e3c4, 0xfa8303d2, 0x73850f09, 0x31000002,
+0x7df162c0, 0x24546f28, 0x7df16202, 0xc5d96f08,
+0x62e990f8, 0x912d7df2, 0x0420951c, 0xf1620010,
+0x5c7f087d, 0x548b0124, 0x4c8b1084, 0x5c8b40c4,
+0xd78944c4, 0x831fffc1, 0xd38301c1, 0x0fdf3900,
+0x00020c85, 0x0fca3900, 0x00020485, 0xf8834000,
+0x62d37504, 0xef085df1, 0xddf162e4, 0x2464fb28,
+0x0001b801, 0xf1620000, 0xd96f087d, 0xf190f8c5,
+0x087df162, 0x0124746f, 0x2e7df262, 0x30a51c91,
+0x62001004, 0x7c087df2, 0x4df162e0, 0x62e4fa08,
+0x1f0865f3, 0xf8c500c4, 0xfa80d093, 0x0107b80f,
+0x850f0000, 0x000001ca, 0x28edf162, 0x3101f273,
+0x7df162c0, 0x62e96f08, 0x91297df2, 0x0420552c,
+0xf1620010, 0x6c7f087d, 0x548b0124, 0x4c8b1084,
+0x5c8b40c4, 0xd78944c4, 0x831fffc1, 0xd38301c1,
+0x0fdf3900, 0x00016f85, 0x0fca3900, 0x00016785,
+0xf8834000, 0x31d37504, 0x89d231c0, 0x05408514,
+0x83400010, 0xf17540f8, 0x102444c7, 0x00000001,
+0x142444c7, 0x00000002, 0x182444c7, 0x00000003,
+0x1c2444c7, 0x00000004, 0x087df162, 0x05200d6f,
+0xf2620010, 0xc9270875, 0x087df162, 0x01247c6f,
+0x0875f162, 0x31b8c9ef, 0x62000001, 0xa1297df2,
+0x05400d3c, 0x3d830010, 0x00100540, 0x0f850f01,
+0x8b000001, 0x10054415, 0x0134b800, 0x150b0000,
+0x00100548, 0x054c150b, 0x850f0010, 0x000000f2,
+0x0c24448a, 0x087df162, 0x0124746f, 0xf892f8c5,
+0x2f7df262, 0x400d34a1, 0x83001005, 0x1005403d,
+0x38b80400, 0x0f000001, 0x0000c585, 0x0544a100,
+0x050b0010, 0x00100548, 0x054c050b, 0x850f0010,
+0x0000009b, 0x0c245c8a, 0x000001ba, 0x7df16200,
+0x247c6f28, 0x7df16201, 0x24746f08, 0x92f8c501,
+0x7df262d3, 0xbd34a12a, 0x00100540, 0x40951439,
+0x75001005, 0xfa834271, 0x8af17505, 0x620c245c,
+0x6f287df1, 0x6202247c, 0x6f087df1, 0xc501246c,
+0x62db92f8, 0xa12b7df2, 0x0540bd2c, 0x3d830010,
+0x00100544, 0x83467504, 0x1005483d, 0x3d750300,
+0x054c3d83, 0x75020010, 0x503d8334, 0x01001005,
+0x000145ba, 0xc2450f00, 0xe7b828eb, 0xeb000000,
+0x00ffb821, 0x1aeb0000, 0x000115b8, 0xb813eb00,
+0x0000013b, 0x40b80ceb, 0xeb000001, 0x0145b805,
+0x658d0000, 0x5f5e5bf4, 0x0000c35d, 0x00000000,
+0x00000001, 0x00000002, 0x00000003, 0x00000004,
+0x00000005, 0x00000006, 0x00000007, 0x00000008,
+0x00000009, 0x0000000a, 0x0000000b, 0x0000000c,
+0x0000000d, 0x0000000e, 0x0000000f, 0x00000010,
+0x00000011, 0x00000012, 0x00000013, 0x00000014,
+0x00000015, 0x00000016, 0x00000017, 0x00000018,
+0x00000019, 0x0000001a, 0x0000001b, 0x0000001c,
+0x0000001d, 0x0000001e, 0x0000001f, 0x00000020,
+0x00000021, 0x00000022, 0x00000023, 0x00000024,
+0x00000025, 0x00000026, 0x00000027, 0x00000028,
+0x00000029, 0x0000002a, 0x0000002b, 0x0000002c,
+0x0000002d, 0x0000002e, 0x0000002f, 0x00000030,
+0x00000031, 0x00000032, 0x00000033, 0x00000034,
+0x00000035, 0x00000036, 0x00000037, 0x00000038,
+0x00000039, 0x0000003a, 0x0000003b, 0x0000003c,
+0x0000003d, 0x0000003e, 0x0000003f, 0x00000040,
+0xffffffff, 0x00000000, 0x00000000, 0x00000000,
+0002460,
+};
+asm(".type avx512f_sg_x86_32_D_32x8i4, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_32_D_32x8i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_32_D_32x8i8[] = {
+0x315500eb, 0x31e589c0, 0xc93157d2, 0x53ff3156,
+0x81e0e483, 0x0000a0ec, 0x24848900, 0x00000084,
+0x4489c031, 0xc0316c24, 0x8c248489, 0x31000000,
+0x244489c0, 0xc7c03174, 0x01602444, 0x89000000,
+0xc764247c, 0x00802484, 0x00040000, 0x44c70000,
+0x00026824, 0x84c70000, 0x00008824, 0x00000300,
+0x2444c700, 0x00000370, 0x2484c700, 0x00000090,
+0x00000002, 0x94248489, 0xc7000000, 0x04782444,
+0x89000000, 0xc77c2454, 0x00982484, 0x00010000,
+0x8c890000, 0x00009c24, 0x76f5c500, 0xf5f262c9,
+0x62c92728, 0xef08e5f1, 0xfdf162db, 0xc5d16f28,
+0x0fc193f8, 0xf8c5c0be, 0x4489d190, 0xc0311c24,
+0x2afdf262, 0x001d1491, 0x62001006, 0x7f28fdf1,
+0x8b012454, 0x8920c474, 0x89102474, 0x01f283f2,
+0x24c4540b, 0x04dc850f, 0x83400000, 0xe37504f8,
+0x28fdf162, 0x0324646f, 0x28fdf162, 0xf8c5d16f,
+0xf262d990, 0x14912bfd, 0x100600e5, 0x7df16200,
+0x89d07e08, 0x02f183c1, 0x1679e3c4, 0xefbf01d2,
+0x09000000, 0xfdf162d1, 0x24547f28, 0xb4850f01,
+0x62000004, 0x17087cf1, 0x8b022454, 0x83102454,
+0x540b03f2, 0x850f1424, 0x0000049b, 0x28fdf362,
+0x6201d639, 0x39287df3, 0xf16201d3, 0x74d608fd,
+0x548b0224, 0xf2831024, 0x24540b04, 0x74850f14,
+0x62000004, 0x17087cf1, 0x8b02245c, 0x83102454,
+0x540b05f2, 0x850f1424, 0x0000045b, 0x28e5f162,
+0x6203f473, 0x6f28fdf1, 0x90f8c5d1, 0xfdf262e1,
+0x5d14912c, 0x00100600, 0x087df162, 0xc189d07e,
+0xc403f183, 0xd21679e3, 0x00f7bf01, 0xd1090000,
+0x28fdf162, 0x0124547f, 0x0419850f, 0xf1620000,
+0x5417087c, 0x548b0224, 0xf2831024, 0x24540b05,
+0x00850f14, 0x62000004, 0x3928fdf3, 0xf36201d7,
+0xd339287d, 0xfdf16201, 0x247cd608, 0x24548b02,
+0x07f28310, 0x1424540b, 0x03d9850f, 0xf1620000,
+0x5c17087c, 0x548b0224, 0xf2831024, 0x24540b09,
+0xc0850f14, 0x31000003, 0xfdf162c0, 0x24546f28,
+0xfdf16204, 0xc5d96f28, 0x62e990f8, 0x912dfdf2,
+0x0600d51c, 0xf1620010, 0x5c7f28fd, 0xb48b0124,
+0x000080c4, 0xc4bc8b00, 0x00000084, 0x10247489,
+0x7c89f189, 0xc1831424, 0x83fb8901, 0x5c3900d3,
+0x850f24c4, 0x00000355, 0x20c44c39, 0x034b850f,
+0x83400000, 0xc67504f8, 0x08e5f162, 0xf162dbef,
+0x5cfb28e5, 0xf1620324, 0xe96f28fd, 0xf190f8c5,
+0x28fdf162, 0x0124746f, 0x000107bf, 0xfdf26200,
+0xdd2c912e, 0x00100620, 0x38cdf162, 0x08001dfb,
+0xf3620010, 0xc31f28d5, 0x93f8c500, 0x0ffa80d0,
+0x0311850f, 0xf1620000, 0xf27328ed, 0x62c03101,
+0x6f28fdf1, 0xfdf262d9, 0x951c9129, 0x00100600,
+0x28fdf162, 0x01245c7f, 0x80c4b48b, 0x8b000000,
+0x0084c4bc, 0x74890000, 0xf1891024, 0x14247c89,
+0x8901c183, 0x00d383fb, 0x24c45c39, 0x02b2850f,
+0x4c390000, 0x850f20c4, 0x000002a8, 0x04f88340,
+0xf162c675, 0x54db28dd, 0xf1620424, 0xedef08d5,
+0x296de2c4, 0xedf162d5, 0x62c9df28, 0x2728f5f2,
+0xbac031c9, 0x00000005, 0x29fdf262, 0x00e51c91,
+0x62001006, 0x7f28fdf1, 0x8b02245c, 0x8940c474,
+0xc47c8bd1, 0xc1294044, 0x0a74c185, 0x58c44c8b,
+0x5cc45c8b, 0x4c8b10eb, 0x5c8b78c4, 0x4c897cc4,
+0x5c891024, 0xc1831424, 0x00d38301, 0x850fdf39,
+0x00000237, 0x850fce39, 0x0000022f, 0x7504f883,
+0x31c031ba, 0xc53489f6, 0x00100840, 0x44c53489,
+0x40001008, 0x7540f883, 0x31c031ea, 0x2444c7d2,
+0x00000120, 0x31c93100, 0x244489db, 0x2444c724,
+0x00000228, 0x24548900, 0x2444c72c, 0x00000330,
+0x244c8900, 0x2444c734, 0x00000438, 0x245c8900,
+0xfdf1623c, 0x200d6f28, 0x62001008, 0x2728f5f2,
+0xedf162c9, 0x62d2ef08, 0x6f28fdf1, 0xbf01247c,
+0x00000131, 0x29fdf262, 0x40153ca1, 0x8b001008,
+0x10084015, 0x01f28300, 0x0844150b, 0x850f0010,
+0x000001a3, 0x08fef162, 0x08501d7e, 0xf1620010,
+0x0d7e08fe, 0x00100848, 0x000134bf, 0xf5f16200,
+0x62cbeb08, 0x7e08fef1, 0x1008581d, 0xf5f16200,
+0x62cbeb08, 0x6c08f5f1, 0x79e2c4c9, 0x850fc917,
+0x00000163, 0x1c24448a, 0x28fdf162, 0x0124746f,
+0x000138bf, 0x92f8c500, 0xfdf262f8, 0x1534a12f,
+0x00100840, 0x0840158b, 0xf2830010, 0x44150b04,
+0x0f001008, 0x00012e85, 0xfef16200, 0x50157e08,
+0x62001008, 0x7e08fef1, 0x1008480d, 0x013bbf00,
+0xf1620000, 0xcaeb08f5, 0x08fef162, 0x0858157e,
+0xf1620010, 0xcaeb08f5, 0x08f5f162, 0xe2c4c96c,
+0x0fc91779, 0x0000ee85, 0x24448a00, 0x62d2311c,
+0x6f28fdf1, 0x6203247c, 0x6f28fdf1, 0xc5012464,
+0xb8d092f8, 0x00000001, 0x2afdf262, 0x40fd24a1,
+0x8d001008, 0x0000c50c, 0x91390000, 0x00100844,
+0x00ac850f, 0x81390000, 0x00100840, 0x00a0850f,
+0xc0830000, 0x83c18901, 0xf18300d2, 0x75d10905,
+0x24448ad2, 0xfdf1621c, 0x24746f28, 0xfdf16204,
+0x247c6f28, 0x0145bf01, 0xf8c50000, 0xf262d892,
+0x3ca12bfd, 0x100840f5, 0x48158b00, 0x83001008,
+0x150b04f2, 0x0010084c, 0x158b5d75, 0x00100850,
+0x0b03f283, 0x10085415, 0x8b4c7500, 0x10085815,
+0x02f28300, 0x085c150b, 0x3b750010, 0x100860a1,
+0x01f08300, 0x0864050b, 0xd8f70010, 0xe781ff19,
+0x00000145, 0xe7bf21eb, 0xeb000000, 0x00ffbf1a,
+0x13eb0000, 0x000115bf, 0xbf0ceb00, 0x0000011e,
+0x40bf05eb, 0x8d000001, 0xf889f465, 0x5d5f5e5b,
+0x000000c3, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000000, 0x00000002, 0x00000000,
+0x00000003, 0x00000000, 0x00000004, 0x00000000,
+0x00000005, 0x00000000, 0x00000006, 0x00000000,
+0x00000007, 0x00000000, 0x00000008, 0x00000000,
+0x00000009, 0x00000000, 0x0000000a, 0x00000000,
+0x0000000b, 0x00000000, 0x0000000c, 0x00000000,
+0x0000000d, 0x00000000, 0x0000000e, 0x00000000,
+0x0000000f, 0x00000000, 0x00000010, 0x00000000,
+0x00000011, 0x00000000, 0x00000012, 0x00000000,
+0x00000013, 0x00000000, 0x00000014, 0x00000000,
+0x00000015, 0x00000000, 0x00000016, 0x00000000,
+0x00000017, 0x00000000, 0x00000018, 0x00000000,
+0x00000019, 0x00000000, 0x0000001a, 0x00000000,
+0x0000001b, 0x00000000, 0x0000001c, 0x00000000,
+0x0000001d, 0x00000000, 0x0000001e, 0x00000000,
+0x0000001f, 0x00000000, 0x00000020, 0x00000000,
+0x00000021, 0x00000000, 0x00000022, 0x00000000,
+0x00000023, 0x00000000, 0x00000024, 0x00000000,
+0x00000025, 0x00000000, 0x00000026, 0x00000000,
+0x00000027, 0x00000000, 0x00000028, 0x00000000,
+0x00000029, 0x00000000, 0x0000002a, 0x00000000,
+0x0000002b, 0x00000000, 0x0000002c, 0x00000000,
+0x0000002d, 0x00000000, 0x0000002e, 0x00000000,
+0x0000002f, 0x00000000, 0x00000030, 0x00000000,
+0x00000031, 0x00000000, 0x00000032, 0x00000000,
+0x00000033, 0x00000000, 0x00000034, 0x00000000,
+0x00000035, 0x00000000, 0x00000036, 0x00000000,
+0x00000037, 0x00000000, 0x00000038, 0x00000000,
+0x00000039, 0x00000000, 0x0000003a, 0x00000000,
+0x0000003b, 0x00000000, 0x0000003c, 0x00000000,
+0x0000003d, 0x00000000, 0x0000003e, 0x00000000,
+0x0000003f, 0x00000000, 0x00000040, 0x00000000,
+0x00000001, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0004100,
+};
+asm(".type avx512f_sg_x86_32_D_32x8i8, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_32_D_32x8i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_32_D_32x8f4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0xe483e589, 0x60ec83e0, 0x4489d231, 0xc0312424,
+0x4489c931, 0xc0314c24, 0x34244489, 0x4489c031,
+0xc0315424, 0x3c244489, 0x44c7c031, 0x00012024,
+0x44c70000, 0x00044024, 0x54890000, 0x44c74424,
+0x00022824, 0x4c890000, 0x44c72c24, 0x00034824,
+0x44c70000, 0x00033024, 0x44c70000, 0x00025024,
+0x44c70000, 0x00043824, 0x44c70000, 0x00015824,
+0x44890000, 0xf1c55c24, 0xf262c976, 0xc9270875,
+0xc976f1c5, 0x0865f162, 0xf162dbef, 0xd128087c,
+0xc193f8c5, 0xc5c0be0f, 0x89d190f8, 0x310c2444,
+0x7df262c0, 0x1d14932a, 0x00100740, 0x087cf162,
+0x01245429, 0xd8dd02eb, 0x44d9e8d9, 0xe9df1084,
+0x046f8a0f, 0x850f0000, 0x0000046d, 0x04f88340,
+0xf162e475, 0xd128087c, 0x287df162, 0x01245c6f,
+0xd990f8c5, 0x2b7df262, 0x409d1493, 0x62001007,
+0x11087ef1, 0xf1622414, 0x5429087c, 0x05d90124,
+0x00100840, 0xdf2404d9, 0x368a0fe9, 0x0f000004,
+0x00043685, 0x7df36200, 0x01d01708, 0x084405d9,
+0x04890010, 0x2404d924, 0x8a0fe9df, 0x00000421,
+0x0423850f, 0xf3620000, 0xd017087d, 0x4805d902,
+0x89001008, 0x04d92404, 0x0fe9df24, 0x0004108a,
+0x14850f00, 0xd9000004, 0x10084c05, 0x7df36200,
+0x24141708, 0x2404d903, 0x8a0fe9df, 0x00000405,
+0x040b850f, 0xf1620000, 0xd128087c, 0x28e5f162,
+0xc502f373, 0x62e190f8, 0x932c7df2, 0x07405d14,
+0xf1620010, 0x1411087e, 0x7cf16224, 0x24542908,
+0x2404d901, 0x8a0febdf, 0x000003e9, 0x03ef850f,
+0xf3620000, 0x1417087d, 0x04d90124, 0xdde9df24,
+0xe68a0fd8, 0x0f000003, 0x0003ea85, 0x7df36200,
+0x02d01708, 0x085005d9, 0x04890010, 0x2404d924,
+0xd8dde9df, 0x03d78a0f, 0x850f0000, 0x000003db,
+0x085405d9, 0xf3620010, 0x1417087d, 0x04d90324,
+0xdde9df24, 0xca8a0fd8, 0x0f000003, 0x0003ce85,
+0x7cf16200, 0x62d92808, 0x6f287df1, 0xc5022454,
+0x62e990f8, 0x932d7df2, 0x0740951c, 0xf1620010,
+0x5c29087c, 0xc9310124, 0x40cc448b, 0x44cc548b,
+0x8901c083, 0xd2832404, 0x24548900, 0x242cdf04,
+0x108c44d9, 0xd8dde9df, 0x03938a0f, 0x850f0000,
+0x00000397, 0x04f98341, 0xf162ce75, 0xe4ef085d,
+0x28ddf162, 0x012464fb, 0xf190f8c5, 0x087cf162,
+0x07b8d928, 0x62000001, 0x932e7df2, 0x0750a51c,
+0xf2620010, 0x2518087d, 0x00100858, 0x085cf162,
+0x01246458, 0x0865f362, 0xc500c41f, 0x80d093f8,
+0x850f0ffa, 0x00000454, 0x28edf162, 0x3101f273,
+0x7cf162c9, 0x62e92808, 0x93297df2, 0x0740552c,
+0xf1620010, 0x6c29087c, 0x448b0124, 0x548b40cc,
+0xc08344cc, 0x24048901, 0x8900d283, 0xdf042454,
+0x44d9242c, 0xe9df108c, 0x8a0fd8dd, 0x0000030d,
+0x0311850f, 0x83410000, 0xce7504f9, 0x02ebc031,
+0xeed9d8dd, 0x808514d9, 0x40001008, 0x7540f883,
+0xd9ccd9ef, 0xd9102454, 0x245cd9cb, 0xd9c9d914,
+0xd918245c, 0x621c2454, 0x6f087df1, 0x1008600d,
+0x75f26200, 0x62c92708, 0xef0875f1, 0x7cf162c9,
+0x24742808, 0x7df26201, 0x0d34a329, 0x00100880,
+0x088005d9, 0xeadf0010, 0x8a0fd9dd, 0x000002b9,
+0x02b9850f, 0x05d90000, 0x00100884, 0x8a0feadf,
+0x000002b9, 0x02b9850f, 0x05d90000, 0x00100888,
+0x8a0feadf, 0x000002b1, 0x02b1850f, 0x05d90000,
+0x0010088c, 0xd9ddeadf, 0x02a78a0f, 0x850f0000,
+0x000002a5, 0x0c24448a, 0x087cf162, 0x01247c28,
+0xf892f8c5, 0x2f7df262, 0x800d3ca3, 0xd9001008,
+0x10088005, 0xdde9db00, 0x868a0fd9, 0xd9000002,
+0x10084805, 0xdde9db00, 0x7a850fd9, 0xd9000002,
+0x8405d9ee, 0xdf001008, 0x768a0fe9, 0x0f000002,
+0x00027685, 0x8805d900, 0xdf001008, 0x6e8a0fe9,
+0x0f000002, 0x00026e85, 0x8c05d900, 0xdf001008,
+0x0fd8dde9, 0x0002648a, 0x62850f00, 0x8a000002,
+0xd90c2444, 0x7df162e8, 0x24746f28, 0x7cf16201,
+0x247c2808, 0x92f8c501, 0x7df262d0, 0xb53ca32a,
+0x00100880, 0x088405d9, 0xe9df0010, 0x02388a0f,
+0x850f0000, 0x00000238, 0x084005d9, 0x05d90010,
+0x00100888, 0x8a0fe9df, 0x0000022a, 0x022c850f,
+0x05d90000, 0x00100844, 0x088c05d9, 0xe9df0010,
+0x02208a0f, 0x850f0000, 0x00000224, 0x089005d9,
+0xecdf0010, 0x02208a0f, 0x850f0000, 0x00000224,
+0x0c24448a, 0x287df162, 0x0224746f, 0x087cf162,
+0x01247c28, 0xd892f8c5, 0x2b7df262, 0x80b53ca3,
+0xd9001008, 0x10088405, 0xddecdf00, 0x008a0fdb,
+0x0f000002, 0x00020285, 0x8805d900, 0xdf001008,
+0x0fdaddeb, 0x0001fa8a, 0xfa850f00, 0xd9000001,
+0x10088c05, 0xddeadf00, 0xf08a0fd9, 0x0f000001,
+0x0001ee85, 0x9005d900, 0xdf001008, 0x0fd8dde9,
+0x0001e08a, 0x0000b800, 0x840f0000, 0x000001e4,
+0x0001d0e9, 0xebd8dd00, 0xb8d8dd02, 0x000000e7,
+0x0001cfe9, 0xddd8dd00, 0xdd40ebd8, 0xebd8ddd8,
+0xddd8dd3a, 0xebd8ddd8, 0xddd8dd32, 0xebd8ddd8,
+0xddd8dd2a, 0xddd8ddd8, 0xdd20ebd8, 0xddd8ddd8,
+0xebd8ddd8, 0xddd8dd16, 0xddd8ddd8, 0xebd8ddd8,
+0xddd8dd0a, 0xddd8ddd8, 0xb8d8ddd8, 0x000000ef,
+0x00017fe9, 0xddd8dd00, 0xddd8ddd8, 0xebd8ddd8,
+0xddd8dd46, 0xddd8ddd8, 0xebd8ddd8, 0xddd8dd3a,
+0xddd8ddd8, 0xdd30ebd8, 0xddd8ddd8, 0xebd8ddd8,
+0xddd8dd26, 0xddd8ddd8, 0xdd1cebd8, 0xddd8ddd8,
+0xebd8ddd8, 0xddd8dd12, 0xddd8ddd8, 0xdd08ebd8,
+0xddd8ddd8, 0xb8d8ddd8, 0x000000f7, 0x000123e9,
+0xddd8dd00, 0xddd8ddd8, 0xdd08ebd8, 0xddd8ddd8,
+0xb8d8ddd8, 0x000000ff, 0x000107e9, 0xddd8dd00,
+0xddd8ddd8, 0xdd08ebd8, 0xddd8ddd8, 0xb8d8ddd8,
+0x00000115, 0x0000ebe9, 0xddd8dd00, 0xdd04ebd8,
+0xb8d8ddd8, 0x00000131, 0x0000d7e9, 0xddd8dd00,
+0xdd18ebd8, 0xebd8ddd8, 0xddd8dd12, 0xdd0cebd8,
+0xebd8ddd8, 0xebd8dd06, 0xb8d8dd02, 0x00000134,
+0x0000afe9, 0xebd8dd00, 0xb8d8dd02, 0x00000138,
+0x00009fe9, 0xddd8dd00, 0xdd18ebd8, 0xebd8ddd8,
+0xddd8dd12, 0xdd0cebd8, 0xebd8ddd8, 0xebd8dd06,
+0xb8d8dd02, 0x0000013b, 0xd8dd7aeb, 0x3cebd8dd,
+0xd8ddd8dd, 0xd8dd36eb, 0xd8ddd8dd, 0xd8dd2eeb,
+0xd8ddd8dd, 0xd8dd26eb, 0xd8ddd8dd, 0x1cebd8dd,
+0xd8ddd8dd, 0xd8ddd8dd, 0xd8dd12eb, 0xd8ddd8dd,
+0x08ebd8dd, 0xd8ddd8dd, 0xd8ddd8dd, 0x000140b8,
+0xdd31eb00, 0xddd8ddd8, 0xdd1aebd8, 0xddd8ddd8,
+0xdd12ebd8, 0xebd8ddd8, 0xddd8dd0c, 0xdd06ebd8,
+0xdd02ebd8, 0x0145b8d8, 0x08eb0000, 0xd8ddd8dd,
+0xd8ddd8dd, 0x0000c3c9, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+0x40a00000, 0x40c00000, 0x40e00000, 0x41000000,
+0x41100000, 0x41200000, 0x41300000, 0x41400000,
+0x41500000, 0x41600000, 0x41700000, 0x41800000,
+0x41880000, 0x41900000, 0x41980000, 0x41a00000,
+0x41a80000, 0x41b00000, 0x41b80000, 0x41c00000,
+0x41c80000, 0x41d00000, 0x41d80000, 0x41e00000,
+0x41e80000, 0x41f00000, 0x41f80000, 0x42000000,
+0x42040000, 0x42080000, 0x420c0000, 0x42100000,
+0x42140000, 0x42180000, 0x421c0000, 0x42200000,
+0x42240000, 0x42280000, 0x422c0000, 0x42300000,
+0x42340000, 0x42380000, 0x423c0000, 0x42400000,
+0x42440000, 0x42480000, 0x424c0000, 0x42500000,
+0x42540000, 0x42580000, 0x425c0000, 0x42600000,
+0x42640000, 0x42680000, 0x426c0000, 0x42700000,
+0x42740000, 0x42780000, 0x427c0000, 0x42800000,
+0x40000000, 0x40400000, 0x40800000, 0x40a00000,
+0x40e00000, 0x41100000, 0xbf800000, 0x00000000,
+0xffffffff, 0x00000000, 0x00000000, 0x00000000,
+0004160,
+};
+asm(".type avx512f_sg_x86_32_D_32x8f4, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_32_D_32x8f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_32_D_32x8f8[] = {
+0x315500eb, 0x31e589c0, 0xc93153d2, 0x31e0e483,
+0xa0ec81db, 0x89000000, 0x31642444, 0x244489c0,
+0x89c03174, 0x00942484, 0xc0310000, 0x7c244489,
+0x44c7c031, 0x00016024, 0x84c70000, 0x00008024,
+0x00000400, 0x24948900, 0x00000084, 0x682444c7,
+0x00000002, 0x6c244c89, 0x882484c7, 0x03000000,
+0x89000000, 0x008c249c, 0x44c70000, 0x00037024,
+0x84c70000, 0x00009024, 0x00000200, 0x2444c700,
+0x00000478, 0x2484c700, 0x00000098, 0x00000001,
+0x9c248489, 0xc5000000, 0x62e476dd, 0x2728ddf2,
+0x76f5c5cc, 0xe5f162c9, 0x62dbef08, 0x2828fdf1,
+0x93f8c5d1, 0xc0be0fc1, 0xd190f8c5, 0x1c244489,
+0xf262c031, 0x14932afd, 0x1008201d, 0xfdf16200,
+0x24542928, 0xc444dd01, 0x2454dd20, 0xd9e8d910,
+0xdde9dfc9, 0x388a0fd8, 0x0f000005, 0x00053285,
+0xf8834000, 0x62de7504, 0x6f28fdf1, 0x6203245c,
+0x2828fdf1, 0x90f8c5e9, 0xfdf262d9, 0xdd2c932b,
+0x00100820, 0x08fdf162, 0x02246c13, 0x0a2005d9,
+0x44dd0010, 0xf1621024, 0x6c2928fd, 0xe9df0124,
+0x8a0fd8dd, 0x00000523, 0x051d850f, 0xf1620000,
+0x6c1708fd, 0x44dd0224, 0x05d91024, 0x00100a24,
+0xcad9c0d9, 0xd9ddeadf, 0x8a0fc0d9, 0x000004cd,
+0x04cd850f, 0xf3620000, 0xef1928fd, 0x2805d901,
+0x6200100a, 0x19287df3, 0xc0d901ea, 0x08fff162,
+0x02247c11, 0x102444dd, 0xd8dde9df, 0x04a78a0f,
+0x850f0000, 0x000004a9, 0x08fdf162, 0x02245417,
+0x102444dd, 0x0a2c05d9, 0xc0d90010, 0xeadfcad9,
+0x8a0fd9dd, 0x00000491, 0x0495850f, 0xf1620000,
+0xf37328d5, 0xfdf16203, 0xc5d12828, 0x62e190f8,
+0x932cfdf2, 0x08206d14, 0xf1620010, 0x541308fd,
+0x44dd0224, 0xebdf1024, 0xf162dadd, 0x542928fd,
+0x8a0f0124, 0x0000046d, 0x046f850f, 0xf1620000,
+0x541708fd, 0x44dd0224, 0xeadf1024, 0x8a0fd9dd,
+0x00000461, 0x0461850f, 0xf3620000, 0xd71928fd,
+0x3005d901, 0x6200100a, 0x19287df3, 0xf16201d5,
+0x7c1108ff, 0x44dd0224, 0xe9df1024, 0x8a0fd8dd,
+0x0000043d, 0x043d850f, 0xf1620000, 0x6c1708fd,
+0x05d90224, 0x00100a34, 0x102444dd, 0xd8dde9df,
+0x04278a0f, 0x850f0000, 0x00000427, 0xf162c931,
+0x546f28fd, 0xf1620424, 0xe92828fd, 0xe990f8c5,
+0x2dfdf262, 0x20d52c93, 0x62001008, 0x2928fdf1,
+0x8b01246c, 0x0080cc84, 0x948b0000, 0x000084cc,
+0x01c08300, 0x10244489, 0x8900d283, 0xdf142454,
+0xdd10246c, 0xdd20cc44, 0xdf102454, 0x0fd8dde9,
+0x0003dc8a, 0xdc850f00, 0x41000003, 0x7504f983,
+0xd5f162c2, 0x62edef08, 0xfb28d5f1, 0x6203246c,
+0x2828fdf1, 0x90f8c5f1, 0x0107b8f1, 0xf2620000,
+0x34932efd, 0x100840ed, 0xfdf26200, 0x382d1928,
+0x6200100a, 0x5828d5f1, 0x6201246c, 0x1f28cdf3,
+0xf8c500c5, 0xfa80d093, 0xef850f0f, 0x62000004,
+0x7328edf1, 0xc93101f2, 0x29fdf262, 0x20950c93,
+0x62001008, 0x2928fdf1, 0x8b01244c, 0x0080cc84,
+0x948b0000, 0x000084cc, 0x01c08300, 0x10244489,
+0x8900d283, 0xdf142454, 0xdd10246c, 0xdd20cc44,
+0xdf102454, 0x0fd8dde9, 0x0003488a, 0x48850f00,
+0x41000003, 0x7504f983, 0xe5f162c2, 0x2454db28,
+0xd5f16204, 0xc4edef08, 0xd5296de2, 0x28edf162,
+0xf262d4df, 0xca2728ed, 0x05bbc931, 0x62000000,
+0x9329fdf2, 0x0820dd0c, 0xf1620010, 0x4c2928fd,
+0x44dd0224, 0xd88940cc, 0x85c82941, 0x8b0a74c8,
+0x8b58cc44, 0xeb5ccc54, 0xcc448b08, 0xcc548b78,
+0x01c0837c, 0x10244489, 0x8900d283, 0xdf142454,
+0xd910246c, 0xdde9dfc9, 0xda8a0fd8, 0x0f000002,
+0x0002da85, 0x04f98300, 0xc031b875, 0xd8dd02eb,
+0x14ddeed9, 0x100a60c5, 0xf8834000, 0xd9ef7540,
+0x2454dde8, 0x2005d920, 0xdd00100a, 0xd9282454,
+0x245cddcc, 0xddcad930, 0x62382454, 0x6f28fdf1,
+0x100a400d, 0xf5f26200, 0xd9c92728, 0xf5f162c2,
+0x62c9ef08, 0x2828fdf1, 0x62012464, 0xa329fdf2,
+0x0a600d24, 0x05dd0010, 0x00100a60, 0xd8dde9df,
+0x02778a0f, 0x850f0000, 0x0000027b, 0x05ddc1d9,
+0x00100a68, 0xd8dde9df, 0x027b8a0f, 0x850f0000,
+0x0000027f, 0x0a7005dd, 0xeadf0010, 0x027b8a0f,
+0x850f0000, 0x0000027f, 0x0a7805dd, 0xeadf0010,
+0x027b8a0f, 0x850f0000, 0x0000027f, 0x1c24448a,
+0x28fdf162, 0x01247c28, 0xf892f8c5, 0x2ffdf262,
+0x600d3ca3, 0xdd00100a, 0x100a6005, 0xdde9db00,
+0x2805d9d9, 0x0f00100a, 0x0002608a, 0xdde9db00,
+0x62850fd9, 0xdd000002, 0x100a6805, 0x0feadf00,
+0x0002668a, 0x6a850f00, 0xdd000002, 0x100a7005,
+0x0feadf00, 0x0002668a, 0x6a850f00, 0xdd000002,
+0x100a7805, 0xddeadf00, 0x648a0fd9, 0x0f000002,
+0x00026685, 0x24448a00, 0xfdf1621c, 0x24646f28,
+0xfdf16203, 0x24742828, 0x92f8c501, 0xfdf262d0,
+0xe534a32a, 0x00100a60, 0x0a6805dd, 0xeadf0010,
+0x02428a0f, 0x850f0000, 0x00000244, 0x0a7005dd,
+0xebdf0010, 0x023e8a0f, 0x850f0000, 0x00000240,
+0x0a2405d9, 0x05dd0010, 0x00100a78, 0x8a0fe9df,
+0x00000234, 0x0238850f, 0x05dd0000, 0x00100a80,
+0x8a0feadf, 0x00000234, 0x0238850f, 0x448a0000,
+0xf1621c24, 0x7c6f28fd, 0xf1620424, 0x5c2828fd,
+0xf8c50124, 0xf262d892, 0x1ca32bfd, 0x100a60fd,
+0x6805dd00, 0xdf00100a, 0x0fd9ddea, 0x0002148a,
+0x16850f00, 0xdd000002, 0x100a7005, 0xdde9df00,
+0x0e8a0fd8, 0x0f000002, 0x00020e85, 0x7805dd00,
+0xdf00100a, 0x0fd9ddea, 0x0002048a, 0x02850f00,
+0xdd000002, 0x100a8005, 0xdde9df00, 0xf48a0fd8,
+0xb8000001, 0x00000000, 0x01f4840f, 0xe4e90000,
+0xb8000001, 0x000000e7, 0x0001e5e9, 0xddd8dd00,
+0xdd28ebd8, 0xebd8ddd8, 0xddd8dd22, 0xebd8ddd8,
+0xddd8dd1a, 0xebd8ddd8, 0xddd8dd12, 0xddd8ddd8,
+0xdd08ebd8, 0xddd8ddd8, 0xb8d8ddd8, 0x000000ef,
+0x0001ade9, 0xddd8dd00, 0xebd8ddd8, 0xddd8dd2a,
+0xebd8ddd8, 0xddd8dd22, 0xdd1cebd8, 0xebd8ddd8,
+0xddd8dd16, 0xdd10ebd8, 0xebd8ddd8, 0xddd8dd0a,
+0xdd04ebd8, 0xb8d8ddd8, 0x000000f7, 0x000171e9,
+0xddd8dd00, 0xdd04ebd8, 0xb8d8ddd8, 0x000000ff,
+0x00015de9, 0xddd8dd00, 0xdd04ebd8, 0xb8d8ddd8,
+0x00000115, 0x000149e9, 0xddd8dd00, 0xdd04ebd8,
+0xb8d8ddd8, 0x0000011e, 0x000135e9, 0xddd8dd00,
+0xddd8ddd8, 0xdd08ebd8, 0xddd8ddd8, 0xb8d8ddd8,
+0x00000131, 0x000119e9, 0xddd8dd00, 0xddd8ddd8,
+0xdd30ebd8, 0xddd8ddd8, 0xebd8ddd8, 0xddd8dd26,
+0xddd8ddd8, 0xdd1cebd8, 0xddd8ddd8, 0xebd8ddd8,
+0xddd8dd12, 0xddd8ddd8, 0xdd08ebd8, 0xddd8ddd8,
+0xb8d8ddd8, 0x00000134, 0x0000d5e9, 0xddd8dd00,
+0xddd8ddd8, 0xebd8ddd8, 0xddd8dd08, 0xddd8ddd8,
+0x0138b8d8, 0xb7e90000, 0xdd000000, 0xddd8ddd8,
+0xebd8ddd8, 0xddd8dd2c, 0xddd8ddd8, 0xdd22ebd8,
+0xddd8ddd8, 0xebd8ddd8, 0xddd8dd18, 0xddd8ddd8,
+0xdd0eebd8, 0xddd8ddd8, 0xdd06ebd8, 0xddd8ddd8,
+0x013bb8d8, 0x7aeb0000, 0xd8ddd8dd, 0x3eebd8dd,
+0xd8ddd8dd, 0x36ebd8dd, 0xd8ddd8dd, 0x2eebd8dd,
+0xd8ddd8dd, 0x26ebd8dd, 0xd8ddd8dd, 0xd8ddd8dd,
+0xd8dd1ceb, 0xd8ddd8dd, 0x12ebd8dd, 0xd8ddd8dd,
+0xd8ddd8dd, 0xd8dd08eb, 0xd8ddd8dd, 0x40b8d8dd,
+0xeb000001, 0xddd8dd2d, 0xebd8ddd8, 0xddd8dd1a,
+0xebd8ddd8, 0xddd8dd12, 0xdd0cebd8, 0xebd8ddd8,
+0xebd8dd06, 0xb8d8dd02, 0x00000145, 0xd8dd04eb,
+0x5d8bd8dd, 0x00c3c9fc, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40100000,
+0x00000000, 0x40140000, 0x00000000, 0x40180000,
+0x00000000, 0x401c0000, 0x00000000, 0x40200000,
+0x00000000, 0x40220000, 0x00000000, 0x40240000,
+0x00000000, 0x40260000, 0x00000000, 0x40280000,
+0x00000000, 0x402a0000, 0x00000000, 0x402c0000,
+0x00000000, 0x402e0000, 0x00000000, 0x40300000,
+0x00000000, 0x40310000, 0x00000000, 0x40320000,
+0x00000000, 0x40330000, 0x00000000, 0x40340000,
+0x00000000, 0x40350000, 0x00000000, 0x40360000,
+0x00000000, 0x40370000, 0x00000000, 0x40380000,
+0x00000000, 0x40390000, 0x00000000, 0x403a0000,
+0x00000000, 0x403b0000, 0x00000000, 0x403c0000,
+0x00000000, 0x403d0000, 0x00000000, 0x403e0000,
+0x00000000, 0x403f0000, 0x00000000, 0x40400000,
+0x00000000, 0x40408000, 0x00000000, 0x40410000,
+0x00000000, 0x40418000, 0x00000000, 0x40420000,
+0x00000000, 0x40428000, 0x00000000, 0x40430000,
+0x00000000, 0x40438000, 0x00000000, 0x40440000,
+0x00000000, 0x40448000, 0x00000000, 0x40450000,
+0x00000000, 0x40458000, 0x00000000, 0x40460000,
+0x00000000, 0x40468000, 0x00000000, 0x40470000,
+0x00000000, 0x40478000, 0x00000000, 0x40480000,
+0x00000000, 0x40488000, 0x00000000, 0x40490000,
+0x00000000, 0x40498000, 0x00000000, 0x404a0000,
+0x00000000, 0x404a8000, 0x00000000, 0x404b0000,
+0x00000000, 0x404b8000, 0x00000000, 0x404c0000,
+0x00000000, 0x404c8000, 0x00000000, 0x404d0000,
+0x00000000, 0x404d8000, 0x00000000, 0x404e0000,
+0x00000000, 0x404e8000, 0x00000000, 0x404f0000,
+0x00000000, 0x404f8000, 0x00000000, 0x40500000,
+0x40000000, 0x40400000, 0x40800000, 0x40a00000,
+0x40e00000, 0x41100000, 0x00000000, 0xbff00000,
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0005140,
+};
+asm(".type avx512f_sg_x86_32_D_32x8f8, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_32_D_32x8f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_64_D_64x4i4[] = {
+0xb85500eb, 0x00000001, 0x000011b9, 0xe5894800,
+0xc0e48348, 0xc8ec8148, 0x89000000, 0x844489ca,
+0x89c22944, 0x00848494, 0xff480000, 0xf88348c0,
+0x62e87511, 0x254875f3, 0xe1c5ffc9, 0x8d48dbef,
+0x62082474, 0x274875f2, 0x7df162c9, 0xc5d16f48,
+0x98c193f8, 0xd190f8c5, 0xc4244489, 0x24448d48,
+0xc28948c8, 0x62c18948, 0x904a7df2, 0x04001d14,
+0xf1620010, 0x947f487d, 0xffffc824, 0x013a83ff,
+0x0331850f, 0x83480000, 0x394804c2, 0x62ee75f2,
+0x6f487df1, 0x00482494, 0xf1620000, 0xd96f487d,
+0xd990f8c5, 0xf262d231, 0x1c904b7d, 0x10040095,
+0x7df16200, 0x249c7f48, 0xffffffc8, 0x39027a8d,
+0x850f903c, 0x000002f6, 0x48c2ff48, 0x7510fa83,
+0x5df162eb, 0x02f27248, 0x487df162, 0xf8c5d96f,
+0x03bae190, 0x62000000, 0x904c7df2, 0x0400651c,
+0xf1620010, 0x9c7f487d, 0xffffc824, 0x0f1039ff,
+0x0002c085, 0x02c28300, 0x04c08348, 0x7523fa83,
+0x7df162ec, 0xc5e16f48, 0x31e990f8, 0x7df162c0,
+0x249c6f48, 0x00000088, 0x4d7df262, 0x009d2490,
+0x62001004, 0x7f487df1, 0xffc824a4, 0xbc8bffff,
+0x00008804, 0x247c8900, 0x01578dc0, 0x0f011439,
+0x00027785, 0xc0834800, 0xf8834804, 0xc5df7540,
+0xb8edefd1, 0x00000001, 0x487df162, 0xf8c5f16f,
+0xf162f190, 0xeafa4855, 0x4e7df262, 0x40ad3490,
+0x62001004, 0x7c487df2, 0x0107b8e8, 0xf1620000,
+0xe5fa485d, 0x484df362, 0xc500c41f, 0x66d093f8,
+0x850fc2ff, 0x00000253, 0x4855f162, 0x6201f372,
+0x6f487df1, 0x62c031e1, 0x90497df2, 0x04006d24,
+0xf1620010, 0xa47f487d, 0xffffc824, 0x04bc8bff,
+0x00000088, 0xc0247c89, 0x3901578d, 0x850f0114,
+0x000001ef, 0x04c08348, 0x40f88348, 0xf162df75,
+0xdbdb486d, 0xedefd1c5, 0x000001b8, 0x0011bf00,
+0xf3620000, 0xcd1f4865, 0x55f26204, 0x62d96449,
+0x274865f2, 0x7df262cb, 0x95249049, 0x00100400,
+0x487df162, 0x0824a47f, 0x89000000, 0x448b44fa,
+0xc229fc86, 0x0674c285, 0x4484548b, 0x948b07eb,
+0x00008484, 0x24548900, 0x48c2ffc0, 0x3941c0ff,
+0x83850fd0, 0x48000001, 0x7511f883, 0x31c031ce,
+0x851489d2, 0x00100640, 0x48c0ff48, 0x0000803d,
+0xb8ec7500, 0x00000001, 0xfc814489, 0x48c0ff48,
+0x7511f883, 0x7df162f3, 0x710d6f48, 0x62000003,
+0x6f487df1, 0xffc824bc, 0x31b8ffff, 0x62000001,
+0x274875f2, 0xeff1c5c9, 0x7df262c9, 0x0d3ca049,
+0x00100640, 0x03853d83, 0x0f010000, 0x00013a85,
+0x0001b800, 0x3c830000, 0x10064085, 0x850f0000,
+0x0000010d, 0x48c0ff48, 0x7510f883, 0x7df162e9,
+0x24bc6f48, 0xffffffc8, 0xc9eff1c5, 0x7c90f8c5,
+0x38b8c424, 0x62000001, 0xa04f7df2, 0x06400d3c,
+0x3d830010, 0x00000337, 0xec850f10, 0xba000000,
+0x00000001, 0x4095048b, 0x85001006, 0xc5850fc0,
+0x48000000, 0x8348c2ff, 0xe87510fa, 0x487df162,
+0x4824bc6f, 0xc5000000, 0x245490f8, 0x0001bac4,
+0xf1620000, 0xb46f487d, 0xffffc824, 0x7df262ff,
+0xbd34a04a, 0x00100640, 0x40951439, 0x0f001006,
+0x00008a85, 0xc2ff4800, 0x11fa8348, 0xf8c5ea75,
+0xc4245c90, 0x000001ba, 0x0011b900, 0xf1620000,
+0xbc6f487d, 0x00008824, 0x7df16200, 0x24b46f48,
+0xffffffc8, 0x4b7df262, 0x40bd34a0, 0x89001006,
+0x39d629ce, 0x06409534, 0x4a750010, 0x48c2ff48,
+0x7511fa83, 0xb844ebea, 0x000000e7, 0xefb83deb,
+0xeb000000, 0x00f7b836, 0x2feb0000, 0x0000ffb8,
+0xb828eb00, 0x00000115, 0x1eb821eb, 0xeb000001,
+0x0134b81a, 0x13eb0000, 0x00013bb8, 0xb80ceb00,
+0x00000140, 0x45b805eb, 0xc9000001, 0x000000c3,
+0x00000001, 0x00000002, 0x00000003, 0x00000004,
+0x00000005, 0x00000006, 0x00000007, 0x00000008,
+0x00000009, 0x0000000a, 0x0000000b, 0x0000000c,
+0x0000000d, 0x0000000e, 0x0000000f, 0x00000010,
+0x00000011, 0x00000012, 0x00000013, 0x00000014,
+0x00000015, 0x00000016, 0x00000017, 0x00000018,
+0x00000019, 0x0000001a, 0x0000001b, 0x0000001c,
+0x0000001d, 0x0000001e, 0x0000001f, 0x00000020,
+0x00000021, 0x00000022, 0x00000023, 0x00000024,
+0x00000025, 0x00000026, 0x00000027, 0x00000028,
+0x00000029, 0x0000002a, 0x0000002b, 0x0000002c,
+0x0000002d, 0x0000002e, 0x0000002f, 0x00000030,
+0x00000031, 0x00000032, 0x00000033, 0x00000034,
+0x00000035, 0x00000036, 0x00000037, 0x00000038,
+0x00000039, 0x0000003a, 0x0000003b, 0x0000003c,
+0x0000003d, 0x0000003e, 0x0000003f, 0x00000040,
+0x00000041, 0x00000042, 0x00000043, 0x00000044,
+0x00000045, 0x00000046, 0x00000047, 0x00000048,
+0x00000049, 0x0000004a, 0x0000004b, 0x0000004c,
+0x0000004d, 0x0000004e, 0x0000004f, 0x00000050,
+0x00000051, 0x00000052, 0x00000053, 0x00000054,
+0x00000055, 0x00000056, 0x00000057, 0x00000058,
+0x00000059, 0x0000005a, 0x0000005b, 0x0000005c,
+0x0000005d, 0x0000005e, 0x0000005f, 0x00000060,
+0x00000061, 0x00000062, 0x00000063, 0x00000064,
+0x00000065, 0x00000066, 0x00000067, 0x00000068,
+0x00000069, 0x0000006a, 0x0000006b, 0x0000006c,
+0x0000006d, 0x0000006e, 0x0000006f, 0x00000070,
+0x00000071, 0x00000072, 0x00000073, 0x00000074,
+0x00000075, 0x00000076, 0x00000077, 0x00000078,
+0x00000079, 0x0000007a, 0x0000007b, 0x0000007c,
+0x0000007d, 0x0000007e, 0x0000007f, 0x00000080,
+0xffffffff, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0003100,
+};
+asm(".type avx512f_sg_x86_64_D_64x4i4, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_64_D_64x4i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_64_D_64x4i8[] = {
+0xb85500eb, 0x00000001, 0x000009b9, 0xe5894800,
+0xc0e48348, 0x48ec8348, 0x4489ca89, 0xc229c484,
+0xe4845489, 0x48c0ff48, 0x7509f883, 0x75f362eb,
+0xffc92548, 0xdbefe1c5, 0x24548d48, 0xf5f26248,
+0x62c92748, 0x6f48fdf1, 0x93f8c5d1, 0xc0be0fc1,
+0xd190f8c5, 0xc4244489, 0x24448d48, 0xc1894808,
+0x4afdf262, 0xc01d1490, 0x62001003, 0x7f48fdf1,
+0x00082494, 0x83480000, 0x850f0138, 0x000002ea,
+0x08c08348, 0x75d03948, 0xfdf162ed, 0xc5d16f48,
+0xb8d990f8, 0x00000002, 0x6c6ffdc5, 0xf262c824,
+0x14904bfd, 0x1003c0ed, 0xfdf16200, 0x24947f48,
+0x00000008, 0xc1443948, 0xb2850ff0, 0x48000002,
+0x8348c0ff, 0xec750af8, 0xf572e5c5, 0xfdf16203,
+0xc5d16f48, 0xb8e190f8, 0x00000003, 0x4cfdf262,
+0xc05d1490, 0x62001003, 0x7f48fdf1, 0x00082494,
+0x39480000, 0x0ff48144, 0x00027b85, 0xc0834800,
+0xf8834802, 0xc5eb7513, 0x24546ffd, 0xfdf162e8,
+0xc5d96f48, 0x31e990f8, 0xfdf262c0, 0xd51c904d,
+0x001003c0, 0x48fdf162, 0x08249c7f, 0x8b000000,
+0x8de88474, 0x74890156, 0x6348c024, 0x143948d2,
+0x38850fc1, 0x48000002, 0x8348c0ff, 0xdf7508f8,
+0xe4efd9c5, 0x000001b8, 0x90f8c500, 0xfaddc5f1,
+0xfdf162e5, 0x62e96f48, 0x904efdf2, 0x0400e52c,
+0xf2620010, 0xe07c48fd, 0x000107b8, 0xe5f16200,
+0x62dcfb48, 0x1f48d5f3, 0xf8c500c3, 0xc2fed093,
+0x0211850f, 0xedc50000, 0x3101f272, 0xfdf262c0,
+0x950c9049, 0x001003c0, 0x48fdf162, 0x08248c7f,
+0x8b000000, 0x8de88474, 0x74890156, 0x6348c024,
+0x143948d2, 0xbb850fc1, 0x48000001, 0x8348c0ff,
+0xdf7508f8, 0xd231c031, 0xc5148948, 0x00100800,
+0x48c0ff48, 0x0000803d, 0x48eb7500, 0x082444c7,
+0x00000001, 0x2444c748, 0x00000210, 0x44c74800,
+0x00031824, 0xc7480000, 0x04202444, 0x48000000,
+0x282444c7, 0x00000005, 0x2444c748, 0x00000630,
+0x44c74800, 0x00073824, 0xc7480000, 0x08402444,
+0x62000000, 0x6f48fdf1, 0x0005830d, 0xfdf16200,
+0x24b46f48, 0x00000008, 0x000131b8, 0xf5f26200,
+0xc5c92748, 0x62c9eff1, 0xa049fdf2, 0x08000d34,
+0x83480010, 0x0005963d, 0x850f0100, 0x00000137,
+0x000001b8, 0x3c834800, 0x100800c5, 0x850f0000,
+0x00000109, 0x48c0ff48, 0x7508f883, 0x24448ae8,
+0xfdf162c4, 0x24bc6f48, 0x00000008, 0xc9eff1c5,
+0xf892f8c5, 0x000138b8, 0xfdf26200, 0x0d3ca04f,
+0x00100800, 0x443d8348, 0x08000005, 0x00e5850f,
+0x01b80000, 0x48000000, 0x00c53c83, 0x00001008,
+0x00be850f, 0xff480000, 0xf88348c0, 0x8ae87508,
+0xc5c42444, 0x24746ffd, 0xfdf162c8, 0x24bc6f48,
+0x00000008, 0xd092f8c5, 0x000001b8, 0xfdf26200,
+0xf53ca04a, 0x00100800, 0xc5043948, 0x00100800,
+0x0085850f, 0xff480000, 0xf88348c0, 0x8ae97509,
+0xc5c42444, 0x24746ffd, 0x0009bae8, 0xf1620000,
+0xbc6f48fd, 0x00000824, 0x92f8c500, 0x0001b8d8,
+0xf2620000, 0x3ca04bfd, 0x100800f5, 0xd1894800,
+0x48c12948, 0x00c50c39, 0x75001008, 0xc0ff4845,
+0x09f88348, 0xc031e775, 0xe7b83deb, 0xeb000000,
+0x00efb836, 0x2feb0000, 0x0000f7b8, 0xb828eb00,
+0x000000ff, 0x15b821eb, 0xeb000001, 0x0134b81a,
+0x13eb0000, 0x00013bb8, 0xb80ceb00, 0x00000140,
+0x45b805eb, 0xc9000001, 0x000000c3, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000000, 0x00000002, 0x00000000,
+0x00000003, 0x00000000, 0x00000004, 0x00000000,
+0x00000005, 0x00000000, 0x00000006, 0x00000000,
+0x00000007, 0x00000000, 0x00000008, 0x00000000,
+0x00000009, 0x00000000, 0x0000000a, 0x00000000,
+0x0000000b, 0x00000000, 0x0000000c, 0x00000000,
+0x0000000d, 0x00000000, 0x0000000e, 0x00000000,
+0x0000000f, 0x00000000, 0x00000010, 0x00000000,
+0x00000011, 0x00000000, 0x00000012, 0x00000000,
+0x00000013, 0x00000000, 0x00000014, 0x00000000,
+0x00000015, 0x00000000, 0x00000016, 0x00000000,
+0x00000017, 0x00000000, 0x00000018, 0x00000000,
+0x00000019, 0x00000000, 0x0000001a, 0x00000000,
+0x0000001b, 0x00000000, 0x0000001c, 0x00000000,
+0x0000001d, 0x00000000, 0x0000001e, 0x00000000,
+0x0000001f, 0x00000000, 0x00000020, 0x00000000,
+0x00000021, 0x00000000, 0x00000022, 0x00000000,
+0x00000023, 0x00000000, 0x00000024, 0x00000000,
+0x00000025, 0x00000000, 0x00000026, 0x00000000,
+0x00000027, 0x00000000, 0x00000028, 0x00000000,
+0x00000029, 0x00000000, 0x0000002a, 0x00000000,
+0x0000002b, 0x00000000, 0x0000002c, 0x00000000,
+0x0000002d, 0x00000000, 0x0000002e, 0x00000000,
+0x0000002f, 0x00000000, 0x00000030, 0x00000000,
+0x00000031, 0x00000000, 0x00000032, 0x00000000,
+0x00000033, 0x00000000, 0x00000034, 0x00000000,
+0x00000035, 0x00000000, 0x00000036, 0x00000000,
+0x00000037, 0x00000000, 0x00000038, 0x00000000,
+0x00000039, 0x00000000, 0x0000003a, 0x00000000,
+0x0000003b, 0x00000000, 0x0000003c, 0x00000000,
+0x0000003d, 0x00000000, 0x0000003e, 0x00000000,
+0x0000003f, 0x00000000, 0x00000040, 0x00000000,
+0x00000041, 0x00000000, 0x00000042, 0x00000000,
+0x00000043, 0x00000000, 0x00000044, 0x00000000,
+0x00000045, 0x00000000, 0x00000046, 0x00000000,
+0x00000047, 0x00000000, 0x00000048, 0x00000000,
+0x00000049, 0x00000000, 0x0000004a, 0x00000000,
+0x0000004b, 0x00000000, 0x0000004c, 0x00000000,
+0x0000004d, 0x00000000, 0x0000004e, 0x00000000,
+0x0000004f, 0x00000000, 0x00000050, 0x00000000,
+0x00000051, 0x00000000, 0x00000052, 0x00000000,
+0x00000053, 0x00000000, 0x00000054, 0x00000000,
+0x00000055, 0x00000000, 0x00000056, 0x00000000,
+0x00000057, 0x00000000, 0x00000058, 0x00000000,
+0x00000059, 0x00000000, 0x0000005a, 0x00000000,
+0x0000005b, 0x00000000, 0x0000005c, 0x00000000,
+0x0000005d, 0x00000000, 0x0000005e, 0x00000000,
+0x0000005f, 0x00000000, 0x00000060, 0x00000000,
+0x00000061, 0x00000000, 0x00000062, 0x00000000,
+0x00000063, 0x00000000, 0x00000064, 0x00000000,
+0x00000065, 0x00000000, 0x00000066, 0x00000000,
+0x00000067, 0x00000000, 0x00000068, 0x00000000,
+0x00000069, 0x00000000, 0x0000006a, 0x00000000,
+0x0000006b, 0x00000000, 0x0000006c, 0x00000000,
+0x0000006d, 0x00000000, 0x0000006e, 0x00000000,
+0x0000006f, 0x00000000, 0x00000070, 0x00000000,
+0x00000071, 0x00000000, 0x00000072, 0x00000000,
+0x00000073, 0x00000000, 0x00000074, 0x00000000,
+0x00000075, 0x00000000, 0x00000076, 0x00000000,
+0x00000077, 0x00000000, 0x00000078, 0x00000000,
+0x00000079, 0x00000000, 0x0000007a, 0x00000000,
+0x0000007b, 0x00000000, 0x0000007c, 0x00000000,
+0x0000007d, 0x00000000, 0x0000007e, 0x00000000,
+0x0000007f, 0x00000000, 0x00000080, 0x00000000,
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0004000,
+};
+asm(".type avx512f_sg_x86_64_D_64x4i8, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_64_D_64x4i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_64_D_64x4f4[] = {
+0xb85500eb, 0x00000001, 0x000011b9, 0xe5894800,
+0xc0e48348, 0xc8ec8148, 0x89000000, 0x844489ca,
+0x89c22944, 0x00848494, 0xff480000, 0xf88348c0,
+0x62e87511, 0x254855f3, 0xf362ffed, 0xc9254875,
+0xefe1c5ff, 0x7ef162db, 0xb13d1008, 0x62000006,
+0x274855f2, 0x7cf162cd, 0x48d12848, 0x0824748d,
+0xc193f8c5, 0x90f8c598, 0x244489d1, 0x448d48c4,
+0x8948c824, 0xc18948c2, 0x4a7df262, 0xc01d1492,
+0x62001004, 0x29487cf1, 0xffc82494, 0xf162ffff,
+0x3a2e087c, 0x03c18a0f, 0x850f0000, 0x000003bb,
+0x04c28348, 0x75f23948, 0x7df162e5, 0x24946f48,
+0x00000048, 0x487cf162, 0xf8c5d928, 0xd231d990,
+0x4b7df262, 0xc0951c92, 0x62001004, 0x29487cf1,
+0xffc8249c, 0x7a8dffff, 0x2ae2c502, 0x7cf162df,
+0x901c2e08, 0x03788a0f, 0x850f0000, 0x00000372,
+0x48c2ff48, 0x7510fa83, 0x5df162dd, 0x02f27248,
+0x487cf162, 0xf8c5d928, 0x03bae190, 0x62000000,
+0x924c7df2, 0x04c0651c, 0xf1620010, 0x9c29487c,
+0xffffc824, 0x2ae2c5ff, 0x7cf162da, 0x0f182e08,
+0x0003348a, 0x2e850f00, 0x83000003, 0x834802c2,
+0xfa8304c0, 0x62de7523, 0x28487cf1, 0x90f8c5e1,
+0x62c031e9, 0x6f487df1, 0x0088249c, 0xf2620000,
+0x24924d7d, 0x1004c09d, 0x7cf16200, 0x24a42948,
+0xffffffc8, 0x8804bc8b, 0x8d000000, 0x7c890157,
+0xcac5c024, 0xf162f22a, 0x342e087c, 0xdd8a0f01,
+0x0f000002, 0x0002d785, 0xc0834800, 0xf8834804,
+0x62d17540, 0x58585cf1, 0x00055725, 0xefc9c500,
+0x7c7162f6, 0xc5c12848, 0x62f190f8, 0xfa484df1,
+0x0107b8f2, 0x72620000, 0x04924e7d, 0x100500b5,
+0x3df36200, 0x00c41f48, 0xd093f8c5, 0x0fc2ff66,
+0x0002c885, 0x5df16200, 0x01f37248, 0xf262c031,
+0x0c92497d, 0x1004c065, 0x7cf16200, 0x248c2948,
+0xffffffc8, 0x8804bc8b, 0x8d000000, 0x7c890157,
+0xdac5c024, 0xf162e22a, 0x242e087c, 0x548a0f01,
+0x0f000002, 0x00024e85, 0xc0834800, 0xf8834804,
+0x62d17540, 0xdb486df1, 0xefd9c5db, 0x0001b8e4,
+0x11bf0000, 0x62000000, 0x1f4865f3, 0xf26204cc,
+0xdd64495d, 0x4865f262, 0xf262cb27, 0x0c92497d,
+0x1004c095, 0x7cf16200, 0x248c2948, 0x00000008,
+0xf162fa89, 0x5410087e, 0xc229ff86, 0x0674c285,
+0x4484548b, 0x948b07eb, 0x00008484, 0x24548900,
+0x48c2ffc0, 0xf2c5c0ff, 0xf162ca2a, 0xd12e087c,
+0x01d88a0f, 0x850f0000, 0x000001d2, 0x11f88348,
+0xc031be75, 0x208504c7, 0x00001007, 0x48000000,
+0x3d48c0ff, 0x00000080, 0x01b8ea75, 0xc5000000,
+0x62c82af2, 0x11087ef1, 0x48ff814c, 0x8348c0ff,
+0xeb7511f8, 0x487df162, 0x03d20d6f, 0xf1620000,
+0xac28487c, 0xffffc824, 0x75f262ff, 0xc5c92748,
+0x62c9eff1, 0xa2497df2, 0x07200d2c, 0xf1620010,
+0x3d2e087c, 0x00000408, 0x01678a0f, 0x01b80000,
+0xc5000000, 0x0fc957f0, 0x00015885, 0x7cf16200,
+0x850c2e08, 0x00100720, 0x014e8a0f, 0x850f0000,
+0x00000148, 0x48c0ff48, 0x7510f883, 0x7cf162e0,
+0x24bc2848, 0xffffffc8, 0xc9eff1c5, 0x7c90f8c5,
+0xf262c424, 0x3ca24f7d, 0x1007200d, 0x7ef16200,
+0xa90d1008, 0x62000003, 0x2e087cf1, 0x0003870d,
+0x0c8a0f00, 0xb8000001, 0x00000001, 0xc957f0c5,
+0x00fd850f, 0xf1620000, 0x0c2e087c, 0x10072085,
+0xf38a0f00, 0x0f000000, 0x0000ed85, 0xc0ff4800,
+0x10f88348, 0xf162e075, 0xac6f487d, 0x00004824,
+0x90f8c500, 0xb8c42454, 0x00000001, 0x487cf162,
+0xc824bc28, 0x62ffffff, 0xa24a7df2, 0x0720ad3c,
+0xf2c50010, 0xf162c82a, 0x0c2e087c, 0x10072085,
+0xaa8a0f00, 0x0f000000, 0x0000a485, 0xc0ff4800,
+0x11f88348, 0xf8c5dc75, 0xc4245c90, 0x000001b8,
+0x0011ba00, 0xf1620000, 0xb46f487d, 0x00008824,
+0x7cf16200, 0x24ac2848, 0xffffffc8, 0x4b7df262,
+0x20b52ca2, 0x89001007, 0xc5c129d1, 0x62c92af2,
+0x2e087cf1, 0x0720850c, 0x5c7a0010, 0xff485a75,
+0xf88348c0, 0x31e07511, 0xb852ebc0, 0x000000e7,
+0xefb84beb, 0xeb000000, 0x00f7b844, 0x3deb0000,
+0x0000ffb8, 0xb836eb00, 0x00000115, 0x1eb82feb,
+0xeb000001, 0x0131b828, 0x21eb0000, 0x000134b8,
+0xb81aeb00, 0x00000138, 0x3bb813eb, 0xeb000001,
+0x0140b80c, 0x05eb0000, 0x000145b8, 0x00c3c900,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+0x40a00000, 0x40c00000, 0x40e00000, 0x41000000,
+0x41100000, 0x41200000, 0x41300000, 0x41400000,
+0x41500000, 0x41600000, 0x41700000, 0x41800000,
+0x41880000, 0x41900000, 0x41980000, 0x41a00000,
+0x41a80000, 0x41b00000, 0x41b80000, 0x41c00000,
+0x41c80000, 0x41d00000, 0x41d80000, 0x41e00000,
+0x41e80000, 0x41f00000, 0x41f80000, 0x42000000,
+0x42040000, 0x42080000, 0x420c0000, 0x42100000,
+0x42140000, 0x42180000, 0x421c0000, 0x42200000,
+0x42240000, 0x42280000, 0x422c0000, 0x42300000,
+0x42340000, 0x42380000, 0x423c0000, 0x42400000,
+0x42440000, 0x42480000, 0x424c0000, 0x42500000,
+0x42540000, 0x42580000, 0x425c0000, 0x42600000,
+0x42640000, 0x42680000, 0x426c0000, 0x42700000,
+0x42740000, 0x42780000, 0x427c0000, 0x42800000,
+0x42820000, 0x42840000, 0x42860000, 0x42880000,
+0x428a0000, 0x428c0000, 0x428e0000, 0x42900000,
+0x42920000, 0x42940000, 0x42960000, 0x42980000,
+0x429a0000, 0x429c0000, 0x429e0000, 0x42a00000,
+0x42a20000, 0x42a40000, 0x42a60000, 0x42a80000,
+0x42aa0000, 0x42ac0000, 0x42ae0000, 0x42b00000,
+0x42b20000, 0x42b40000, 0x42b60000, 0x42b80000,
+0x42ba0000, 0x42bc0000, 0x42be0000, 0x42c00000,
+0x42c20000, 0x42c40000, 0x42c60000, 0x42c80000,
+0x42ca0000, 0x42cc0000, 0x42ce0000, 0x42d00000,
+0x42d20000, 0x42d40000, 0x42d60000, 0x42d80000,
+0x42da0000, 0x42dc0000, 0x42de0000, 0x42e00000,
+0x42e20000, 0x42e40000, 0x42e60000, 0x42e80000,
+0x42ea0000, 0x42ec0000, 0x42ee0000, 0x42f00000,
+0x42f20000, 0x42f40000, 0x42f60000, 0x42f80000,
+0x42fa0000, 0x42fc0000, 0x42fe0000, 0x43000000,
+0xffffffff, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0xbf800000, 0x41800000,
+0003414,
+};
+asm(".type avx512f_sg_x86_64_D_64x4f4, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_64_D_64x4f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_64_D_64x4f8[] = {
+0xb85500eb, 0x00000001, 0x000009b9, 0xe5894800,
+0xc0e48348, 0x48ec8348, 0x4489ca89, 0xc229c484,
+0xe4845489, 0x48c0ff48, 0x7509f883, 0x75f362eb,
+0xffc92548, 0xdbefe1c5, 0x24748d48, 0xfff16248,
+0x79251008, 0x62000008, 0x2748f5f2, 0x75f362c9,
+0xffc92548, 0x48fdf162, 0xf8c5d128, 0xbe0fc193,
+0x90f8c5c0, 0x244489d1, 0x448d48c4, 0x89480824,
+0xc18948c2, 0x4afdf262, 0x801d1492, 0x62001004,
+0x2948fdf1, 0x00082494, 0xf1620000, 0x222e08fd,
+0x03648a0f, 0x850f0000, 0x0000035e, 0x08c28348,
+0x75f23948, 0x6ffdc5e5, 0x62c82474, 0x2848fdf1,
+0x90f8c5d1, 0x62d231d9, 0x924bfdf2, 0x0480f514,
+0xf1620010, 0x942948fd, 0x00000824, 0x02728d00,
+0xd62aebc5, 0x08fdf162, 0x0fd0142e, 0x0003208a,
+0x1a850f00, 0x48000003, 0x8348c2ff, 0xdd7508fa,
+0xf672e5c5, 0xfdf16203, 0xc5d12848, 0xbae190f8,
+0x00000003, 0x4cfdf262, 0x805d1492, 0x62001004,
+0x2948fdf1, 0x00082494, 0xebc50000, 0xf162d22a,
+0x102e08fd, 0x02de8a0f, 0x850f0000, 0x000002d8,
+0x4802c283, 0x8308c083, 0xde7513fa, 0x546ffdc5,
+0xf162e824, 0xd92848fd, 0xe990f8c5, 0xf262c031,
+0x1c924dfd, 0x100480d5, 0xfdf16200, 0x249c2948,
+0x00000008, 0xe8847c8b, 0x8901578d, 0xc5c0247c,
+0x62ea2ad3, 0x2e08fdf1, 0x8a0fc12c, 0x0000028f,
+0x0289850f, 0xff480000, 0xf88348c0, 0x62d57508,
+0x5858e5f1, 0x00072f1d, 0xefd1c500, 0x90f8c5ed,
+0x0107b8f1, 0xd5c50000, 0xf162eefa, 0xf12848fd,
+0x4efdf262, 0xc0ed3492, 0x62001004, 0x1f48cdf3,
+0xf8c500c3, 0xc2fed093, 0x0277850f, 0xedc50000,
+0x3101f272, 0xfdf262c0, 0x950c9249, 0x00100480,
+0x48fdf162, 0x08248c29, 0x8b000000, 0x8de88474,
+0x74890156, 0xf3c5c024, 0xf162ca2a, 0x0c2e08fd,
+0x0f8a0fc1, 0x0f000002, 0x00020985, 0xc0ff4800,
+0x08f88348, 0xc031d575, 0xc504c748, 0x00100920,
+0x00000000, 0x48c0ff48, 0x0000803d, 0x48e97500,
+0x069a058b, 0xf1620000, 0x641108ff, 0xf1620124,
+0x0d1008ff, 0x000006b8, 0x24448948, 0x058b4810,
+0x00000684, 0x08fff162, 0x08244c11, 0x24448948,
+0x058b4818, 0x00000678, 0x24448948, 0x058b4820,
+0x00000674, 0x24448948, 0x058b4828, 0x00000670,
+0x24448948, 0x058b4830, 0x0000066c, 0x24448948,
+0xfdf16238, 0xe5156f48, 0x62000005, 0x2848fdf1,
+0x000824bc, 0xf2620000, 0xca2748ed, 0xd2efe9c5,
+0x49fdf262, 0x20153ca2, 0x62001009, 0x2e08fdf1,
+0x00065b25, 0x528a0f00, 0xb8000001, 0x00000001,
+0xd257e9c5, 0x0143850f, 0xf1620000, 0x142e08fd,
+0x100920c5, 0x398a0f00, 0x0f000001, 0x00013385,
+0xc0ff4800, 0x08f88348, 0x448ae075, 0xf162c424,
+0xbc2848fd, 0x00000824, 0xefe9c500, 0x92f8c5d2,
+0xfdf262f8, 0x153ca24f, 0x00100920, 0x08fdf162,
+0x05fa0d2e, 0x8a0f0000, 0x000000ff, 0x000001b8,
+0x57f1c500, 0xf0850fc9, 0x62000000, 0x2e08fdf1,
+0x0920c50c, 0x8a0f0010, 0x000000e6, 0x00e0850f,
+0xff480000, 0xf88348c0, 0x8ae07508, 0xc5c42444,
+0x24646ffd, 0xfdf162c8, 0x24bc2848, 0x00000008,
+0xd092f8c5, 0x000001b8, 0xfdf26200, 0xe53ca24a,
+0x00100920, 0xc82af3c5, 0x08fdf162, 0x20c50c2e,
+0x0f001009, 0x0000a08a, 0x9a850f00, 0x48000000,
+0x8348c0ff, 0xdc7509f8, 0xc424448a, 0x646ffdc5,
+0x09bae824, 0x62000000, 0x2848fdf1, 0x000824ac,
+0xf8c50000, 0x01b8d892, 0x62000000, 0xa24bfdf2,
+0x0920e52c, 0xd1890010, 0xf3c5c129, 0xf162c92a,
+0x0c2e08fd, 0x100920c5, 0x75557a00, 0xc0ff4853,
+0x09f88348, 0xc031e075, 0xe7b84beb, 0xeb000000,
+0x00efb844, 0x3deb0000, 0x0000f7b8, 0xb836eb00,
+0x000000ff, 0x15b82feb, 0xeb000001, 0x0131b828,
+0x21eb0000, 0x000134b8, 0xb81aeb00, 0x00000138,
+0x3bb813eb, 0xeb000001, 0x0140b80c, 0x05eb0000,
+0x000145b8, 0x00c3c900, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40100000,
+0x00000000, 0x40140000, 0x00000000, 0x40180000,
+0x00000000, 0x401c0000, 0x00000000, 0x40200000,
+0x00000000, 0x40220000, 0x00000000, 0x40240000,
+0x00000000, 0x40260000, 0x00000000, 0x40280000,
+0x00000000, 0x402a0000, 0x00000000, 0x402c0000,
+0x00000000, 0x402e0000, 0x00000000, 0x40300000,
+0x00000000, 0x40310000, 0x00000000, 0x40320000,
+0x00000000, 0x40330000, 0x00000000, 0x40340000,
+0x00000000, 0x40350000, 0x00000000, 0x40360000,
+0x00000000, 0x40370000, 0x00000000, 0x40380000,
+0x00000000, 0x40390000, 0x00000000, 0x403a0000,
+0x00000000, 0x403b0000, 0x00000000, 0x403c0000,
+0x00000000, 0x403d0000, 0x00000000, 0x403e0000,
+0x00000000, 0x403f0000, 0x00000000, 0x40400000,
+0x00000000, 0x40408000, 0x00000000, 0x40410000,
+0x00000000, 0x40418000, 0x00000000, 0x40420000,
+0x00000000, 0x40428000, 0x00000000, 0x40430000,
+0x00000000, 0x40438000, 0x00000000, 0x40440000,
+0x00000000, 0x40448000, 0x00000000, 0x40450000,
+0x00000000, 0x40458000, 0x00000000, 0x40460000,
+0x00000000, 0x40468000, 0x00000000, 0x40470000,
+0x00000000, 0x40478000, 0x00000000, 0x40480000,
+0x00000000, 0x40488000, 0x00000000, 0x40490000,
+0x00000000, 0x40498000, 0x00000000, 0x404a0000,
+0x00000000, 0x404a8000, 0x00000000, 0x404b0000,
+0x00000000, 0x404b8000, 0x00000000, 0x404c0000,
+0x00000000, 0x404c8000, 0x00000000, 0x404d0000,
+0x00000000, 0x404d8000, 0x00000000, 0x404e0000,
+0x00000000, 0x404e8000, 0x00000000, 0x404f0000,
+0x00000000, 0x404f8000, 0x00000000, 0x40500000,
+0x00000000, 0x40504000, 0x00000000, 0x40508000,
+0x00000000, 0x4050c000, 0x00000000, 0x40510000,
+0x00000000, 0x40514000, 0x00000000, 0x40518000,
+0x00000000, 0x4051c000, 0x00000000, 0x40520000,
+0x00000000, 0x40524000, 0x00000000, 0x40528000,
+0x00000000, 0x4052c000, 0x00000000, 0x40530000,
+0x00000000, 0x40534000, 0x00000000, 0x40538000,
+0x00000000, 0x4053c000, 0x00000000, 0x40540000,
+0x00000000, 0x40544000, 0x00000000, 0x40548000,
+0x00000000, 0x4054c000, 0x00000000, 0x40550000,
+0x00000000, 0x40554000, 0x00000000, 0x40558000,
+0x00000000, 0x4055c000, 0x00000000, 0x40560000,
+0x00000000, 0x40564000, 0x00000000, 0x40568000,
+0x00000000, 0x4056c000, 0x00000000, 0x40570000,
+0x00000000, 0x40574000, 0x00000000, 0x40578000,
+0x00000000, 0x4057c000, 0x00000000, 0x40580000,
+0x00000000, 0x40584000, 0x00000000, 0x40588000,
+0x00000000, 0x4058c000, 0x00000000, 0x40590000,
+0x00000000, 0x40594000, 0x00000000, 0x40598000,
+0x00000000, 0x4059c000, 0x00000000, 0x405a0000,
+0x00000000, 0x405a4000, 0x00000000, 0x405a8000,
+0x00000000, 0x405ac000, 0x00000000, 0x405b0000,
+0x00000000, 0x405b4000, 0x00000000, 0x405b8000,
+0x00000000, 0x405bc000, 0x00000000, 0x405c0000,
+0x00000000, 0x405c4000, 0x00000000, 0x405c8000,
+0x00000000, 0x405cc000, 0x00000000, 0x405d0000,
+0x00000000, 0x405d4000, 0x00000000, 0x405d8000,
+0x00000000, 0x405dc000, 0x00000000, 0x405e0000,
+0x00000000, 0x405e4000, 0x00000000, 0x405e8000,
+0x00000000, 0x405ec000, 0x00000000, 0x405f0000,
+0x00000000, 0x405f4000, 0x00000000, 0x405f8000,
+0x00000000, 0x405fc000, 0x00000000, 0x40600000,
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0xbff00000,
+0x00000000, 0x40000000, 0x00000000, 0x40080000,
+0x00000000, 0x40100000, 0x00000000, 0x40140000,
+0x00000000, 0x40180000, 0x00000000, 0x401c0000,
+0x00000000, 0x40200000,
+0004410,
+};
+asm(".type avx512f_sg_x86_64_D_64x4f8, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_64_D_64x4f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_64_D_64x8i4[] = {
+0xb85500eb, 0x00000001, 0x000009b9, 0xe5894800,
+0xc0e48348, 0x48ec8348, 0x24748d48, 0xca8948c8,
+0xc6448948, 0xc22948f8, 0xc4148948, 0x48c0ff48,
+0x7509f883, 0x76f5c5e8, 0xefe1c5c9, 0x7df262db,
+0x62d13548, 0x2748edf2, 0x6ffdc5ca, 0x93f8c5d1,
+0xc0be0fc1, 0xd190f8c5, 0xa4244489, 0x24448d48,
+0xc28948a8, 0x62c18948, 0x914a7df2, 0x03a01d14,
+0xfdc50010, 0xa824547f, 0x0f013a83, 0x0002d485,
+0xc2834800, 0xf2394804, 0xf162ee75, 0x9c6f48fd,
+0xffffc824, 0x6ffdc5ff, 0x90f8c5d1, 0x62d231d9,
+0x914b7df2, 0x03a09d14, 0xfdc50010, 0xa824547f,
+0x3902728d, 0x850f9034, 0x000002a0, 0x48c2ff48,
+0x7508fa83, 0xddf162eb, 0x02f37348, 0xd16ffdc5,
+0xe190f8c5, 0x000003ba, 0x7df26200, 0x6514914c,
+0x001003a0, 0x547ffdc5, 0x1039a824, 0x0271850f,
+0xc2830000, 0xc0834802, 0x13fa8304, 0xf162ec75,
+0xa46f48fd, 0x00000824, 0x6ffdc500, 0x90f8c5d1,
+0x62c031e9, 0x914d7df2, 0x03a0a514, 0xfdc50010,
+0xa824547f, 0xc47c8b48, 0x34634808, 0x578d4881,
+0x7c894801, 0x39489824, 0x2b850fd6, 0x48000002,
+0x8348c0ff, 0xdc7508f8, 0xedefd1c5, 0x000001b8,
+0x90f8c500, 0xd5f162f1, 0xc5ebfb48, 0x62d96ffd,
+0x914e7df2, 0x03c0ad1c, 0xf1620010, 0xe86e087d,
+0x000107b8, 0x7de2c400, 0xf262ed58, 0xdb35487d,
+0xd5faedc5, 0x487df262, 0xf362d235, 0xc21f48e5,
+0x93f8c500, 0x0fc2fed0, 0x0001f585, 0xddf16200,
+0x01f47348, 0xf16ffdc5, 0xf262c031, 0x3491497d,
+0x1003a065, 0x7ffdc500, 0x48a82474, 0x08c47c8b,
+0x81346348, 0x01578d48, 0x247c8948, 0xd6394898,
+0x019b850f, 0xff480000, 0xf88348c0, 0x31dc7508,
+0x89d231c0, 0x05c08514, 0xff480010, 0x803d48c0,
+0x75000000, 0x01b848ec, 0x02000000, 0x48000000,
+0xa8244489, 0x0003b848, 0x00040000, 0x89480000,
+0x48b02444, 0x000005b8, 0x00000600, 0x44894800,
+0xb848b824, 0x00000007, 0x00000008, 0x24448948,
+0x7df262c0, 0x650d3548, 0xc5000003, 0x247c6ffd,
+0x0131b8a8, 0xf2620000, 0xc92748f5, 0xc9eff1c5,
+0x497df262, 0xc00d3ca1, 0x83001005, 0x00035e3d,
+0x850f0100, 0x0000012a, 0x000001b8, 0x853c8300,
+0x001005c0, 0xfd850f00, 0x48000000, 0x8348c0ff,
+0xe97508f8, 0xa424448a, 0x7c6ffdc5, 0xf1c5a824,
+0xf8c5c9ef, 0x38b8f892, 0x62000001, 0xa14f7df2,
+0x05c00d3c, 0x3d830010, 0x00000313, 0xdf850f08,
+0xba000000, 0x00000001, 0xc095048b, 0x85001005,
+0xb8850fc0, 0x48000000, 0x8348c2ff, 0xe87508fa,
+0xa4244c8a, 0x48fdf162, 0xc824bc6f, 0xbaffffff,
+0x00000001, 0x746ffdc5, 0xf8c5a824, 0xf262d192,
+0x34a14a7d, 0x1005c0bd, 0x95143900, 0x001005c0,
+0x0080850f, 0xff480000, 0xfa8348c2, 0x8aea7509,
+0x62a4244c, 0x6f48fdf1, 0x000824ac, 0x01ba0000,
+0xc5000000, 0x247c6ffd, 0x92f8c5a8, 0x0009b9d9,
+0xf2620000, 0x3ca14b7d, 0x1005c0ad, 0x29ce8900,
+0x953439d6, 0x001005c0, 0xff484375, 0xfa8348c2,
+0xebea7509, 0x00e7b83d, 0x36eb0000, 0x0000efb8,
+0xb82feb00, 0x000000f7, 0xffb828eb, 0xeb000000,
+0x0115b821, 0x1aeb0000, 0x000134b8, 0xb813eb00,
+0x0000013b, 0x40b80ceb, 0xeb000001, 0x0145b805,
+0xc3c90000, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000002, 0x00000003, 0x00000004,
+0x00000005, 0x00000006, 0x00000007, 0x00000008,
+0x00000009, 0x0000000a, 0x0000000b, 0x0000000c,
+0x0000000d, 0x0000000e, 0x0000000f, 0x00000010,
+0x00000011, 0x00000012, 0x00000013, 0x00000014,
+0x00000015, 0x00000016, 0x00000017, 0x00000018,
+0x00000019, 0x0000001a, 0x0000001b, 0x0000001c,
+0x0000001d, 0x0000001e, 0x0000001f, 0x00000020,
+0x00000021, 0x00000022, 0x00000023, 0x00000024,
+0x00000025, 0x00000026, 0x00000027, 0x00000028,
+0x00000029, 0x0000002a, 0x0000002b, 0x0000002c,
+0x0000002d, 0x0000002e, 0x0000002f, 0x00000030,
+0x00000031, 0x00000032, 0x00000033, 0x00000034,
+0x00000035, 0x00000036, 0x00000037, 0x00000038,
+0x00000039, 0x0000003a, 0x0000003b, 0x0000003c,
+0x0000003d, 0x0000003e, 0x0000003f, 0x00000040,
+0x00000041, 0x00000042, 0x00000043, 0x00000044,
+0x00000045, 0x00000046, 0x00000047, 0x00000048,
+0x00000049, 0x0000004a, 0x0000004b, 0x0000004c,
+0x0000004d, 0x0000004e, 0x0000004f, 0x00000050,
+0x00000051, 0x00000052, 0x00000053, 0x00000054,
+0x00000055, 0x00000056, 0x00000057, 0x00000058,
+0x00000059, 0x0000005a, 0x0000005b, 0x0000005c,
+0x0000005d, 0x0000005e, 0x0000005f, 0x00000060,
+0x00000061, 0x00000062, 0x00000063, 0x00000064,
+0x00000065, 0x00000066, 0x00000067, 0x00000068,
+0x00000069, 0x0000006a, 0x0000006b, 0x0000006c,
+0x0000006d, 0x0000006e, 0x0000006f, 0x00000070,
+0x00000071, 0x00000072, 0x00000073, 0x00000074,
+0x00000075, 0x00000076, 0x00000077, 0x00000078,
+0x00000079, 0x0000007a, 0x0000007b, 0x0000007c,
+0x0000007d, 0x0000007e, 0x0000007f, 0x00000080,
+0xffffffff, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0002700,
+};
+asm(".type avx512f_sg_x86_64_D_64x8i4, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_64_D_64x8i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_64_D_64x8i8[] = {
+0xb85500eb, 0x00000001, 0x000009b9, 0xe5894800,
+0xc0e48348, 0xc8ec8148, 0x48000000, 0x8948ca89,
+0x4840c444, 0x8948c229, 0x0080c494, 0xff480000,
+0xf88348c0, 0x62e47509, 0x254875f3, 0xe1c5ffc9,
+0x8d48dbef, 0x62082474, 0x2748f5f2, 0xfdf162c9,
+0xc5d16f48, 0x0fc193f8, 0xf8c5c0be, 0x4489d190,
+0x8d48c424, 0x48c82444, 0xf262c289, 0x14914afd,
+0x1004801d, 0xfdf16200, 0x24947f48, 0xffffffc8,
+0x01388348, 0x0384850f, 0x83480000, 0x394808c0,
+0x62ed75f0, 0x6f48fdf1, 0x90f8c5d9, 0x0002b8d9,
+0xf1620000, 0x946f48fd, 0x00004824, 0xfdf26200,
+0xd51c914b, 0x00100480, 0x48fdf162, 0xc8249c7f,
+0x48ffffff, 0xf0c24439, 0x0347850f, 0xff480000,
+0xf88348c0, 0x62ec750a, 0x7348ddf1, 0xf16203f2,
+0xd96f48fd, 0xe190f8c5, 0x000003b8, 0xfdf26200,
+0x651c914c, 0x00100480, 0x48fdf162, 0xc8249c7f,
+0x48ffffff, 0xf4824439, 0x030e850f, 0x83480000,
+0x834802c0, 0xeb7513f8, 0x48fdf162, 0xf8c5e16f,
+0xc031e990, 0x48fdf162, 0x88249c6f, 0x62000000,
+0x914dfdf2, 0x0480dd24, 0xf1620010, 0xa47f48fd,
+0xffffc824, 0xbc8b48ff, 0x00008804, 0x7c894800,
+0x8d48b824, 0x3948014f, 0x850f020c, 0x000002c3,
+0x08c08348, 0x40f88348, 0xd1c5db75, 0x01b8edef,
+0x62000000, 0x6f48fdf1, 0x90f8c5f1, 0xd5f162f1,
+0x62eafb48, 0x914efdf2, 0x04c0ed34, 0xf2620010,
+0xe87c48fd, 0x000107b8, 0xddf16200, 0x62e5fb48,
+0x1f48cdf3, 0xf8c500c4, 0xc1fec893, 0x02a0850f,
+0xf1620000, 0xf37348d5, 0xfdf16201, 0x31e16f48,
+0xfdf262c0, 0xad249149, 0x00100480, 0x48fdf162,
+0xc824a47f, 0x48ffffff, 0x8804bc8b, 0x48000000,
+0xb8247c89, 0x014f8d48, 0x020c3948, 0x0238850f,
+0x83480000, 0x834808c0, 0xdb7540f8, 0x48edf162,
+0xd1c5dbdb, 0x01b8edef, 0xb9000000, 0x00000009,
+0x48e5f362, 0x6204cd1f, 0x6449d5f2, 0xe5f262d9,
+0x62cb2748, 0x9149fdf2, 0x0480d524, 0xf1620010,
+0xa47f48fd, 0x00000824, 0x48ca8900, 0xf8c67c8b,
+0xc285c229, 0x8b480774, 0xeb40c454, 0x948b4808,
+0x000080c4, 0x54894800, 0xff48b824, 0xc0ff48c2,
+0x0fd73948, 0x0001c885, 0xf8834800, 0x31ca7509,
+0x48d231c0, 0xc0c51489, 0x48001008, 0x3d48c0ff,
+0x00000080, 0xc748eb75, 0x01c82444, 0x48000000,
+0xd02444c7, 0x00000002, 0x2444c748, 0x000003d8,
+0x44c74800, 0x0004e024, 0xc7480000, 0x05e82444,
+0x48000000, 0xf02444c7, 0x00000006, 0x2444c748,
+0x000007f8, 0x04c74800, 0x00000824, 0xfdf16200,
+0xa90d6f48, 0x62000005, 0x6f48fdf1, 0xffc824bc,
+0x31b8ffff, 0x62000001, 0x2748f5f2, 0xeff1c5c9,
+0xfdf262c9, 0x0d3ca149, 0x001008c0, 0xbc3d8348,
+0x01000005, 0x0148850f, 0x01b80000, 0x48000000,
+0xc0c53c83, 0x00001008, 0x011a850f, 0xff480000,
+0xf88348c0, 0x8ae87508, 0x62c42444, 0x6f48fdf1,
+0xffc824bc, 0xf1c5ffff, 0xf8c5c9ef, 0x38b8f892,
+0x62000001, 0xa14ffdf2, 0x08c00d3c, 0x83480010,
+0x00056a3d, 0x850f0800, 0x000000f6, 0x000001b8,
+0x3c834800, 0x1008c0c5, 0x850f0000, 0x000000cf,
+0x48c0ff48, 0x7508f883, 0x24448ae8, 0xfdf162c4,
+0x24bc6f48, 0x00000048, 0x48fdf162, 0xc824b46f,
+0xc5ffffff, 0xb8d092f8, 0x00000001, 0x4afdf262,
+0xc0fd34a1, 0x48001008, 0xc0c50439, 0x0f001008,
+0x00009185, 0xc0ff4800, 0x09f88348, 0x448ae975,
+0xf162c424, 0xb46f48fd, 0xffffc824, 0x0009baff,
+0xf1620000, 0xbc6f48fd, 0x00008824, 0x92f8c500,
+0x0001b8d8, 0xf2620000, 0x34a14bfd, 0x1008c0fd,
+0xd1894800, 0x48c12948, 0xc0c50c39, 0x75001008,
+0xc0ff484c, 0x09f88348, 0xc031e775, 0xe7b844eb,
+0xeb000000, 0x00efb83d, 0x36eb0000, 0x0000f7b8,
+0xb82feb00, 0x000000ff, 0x15b828eb, 0xeb000001,
+0x011eb821, 0x1aeb0000, 0x000134b8, 0xb813eb00,
+0x0000013b, 0x40b80ceb, 0xeb000001, 0x0145b805,
+0xc3c90000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000000, 0x00000002, 0x00000000,
+0x00000003, 0x00000000, 0x00000004, 0x00000000,
+0x00000005, 0x00000000, 0x00000006, 0x00000000,
+0x00000007, 0x00000000, 0x00000008, 0x00000000,
+0x00000009, 0x00000000, 0x0000000a, 0x00000000,
+0x0000000b, 0x00000000, 0x0000000c, 0x00000000,
+0x0000000d, 0x00000000, 0x0000000e, 0x00000000,
+0x0000000f, 0x00000000, 0x00000010, 0x00000000,
+0x00000011, 0x00000000, 0x00000012, 0x00000000,
+0x00000013, 0x00000000, 0x00000014, 0x00000000,
+0x00000015, 0x00000000, 0x00000016, 0x00000000,
+0x00000017, 0x00000000, 0x00000018, 0x00000000,
+0x00000019, 0x00000000, 0x0000001a, 0x00000000,
+0x0000001b, 0x00000000, 0x0000001c, 0x00000000,
+0x0000001d, 0x00000000, 0x0000001e, 0x00000000,
+0x0000001f, 0x00000000, 0x00000020, 0x00000000,
+0x00000021, 0x00000000, 0x00000022, 0x00000000,
+0x00000023, 0x00000000, 0x00000024, 0x00000000,
+0x00000025, 0x00000000, 0x00000026, 0x00000000,
+0x00000027, 0x00000000, 0x00000028, 0x00000000,
+0x00000029, 0x00000000, 0x0000002a, 0x00000000,
+0x0000002b, 0x00000000, 0x0000002c, 0x00000000,
+0x0000002d, 0x00000000, 0x0000002e, 0x00000000,
+0x0000002f, 0x00000000, 0x00000030, 0x00000000,
+0x00000031, 0x00000000, 0x00000032, 0x00000000,
+0x00000033, 0x00000000, 0x00000034, 0x00000000,
+0x00000035, 0x00000000, 0x00000036, 0x00000000,
+0x00000037, 0x00000000, 0x00000038, 0x00000000,
+0x00000039, 0x00000000, 0x0000003a, 0x00000000,
+0x0000003b, 0x00000000, 0x0000003c, 0x00000000,
+0x0000003d, 0x00000000, 0x0000003e, 0x00000000,
+0x0000003f, 0x00000000, 0x00000040, 0x00000000,
+0x00000041, 0x00000000, 0x00000042, 0x00000000,
+0x00000043, 0x00000000, 0x00000044, 0x00000000,
+0x00000045, 0x00000000, 0x00000046, 0x00000000,
+0x00000047, 0x00000000, 0x00000048, 0x00000000,
+0x00000049, 0x00000000, 0x0000004a, 0x00000000,
+0x0000004b, 0x00000000, 0x0000004c, 0x00000000,
+0x0000004d, 0x00000000, 0x0000004e, 0x00000000,
+0x0000004f, 0x00000000, 0x00000050, 0x00000000,
+0x00000051, 0x00000000, 0x00000052, 0x00000000,
+0x00000053, 0x00000000, 0x00000054, 0x00000000,
+0x00000055, 0x00000000, 0x00000056, 0x00000000,
+0x00000057, 0x00000000, 0x00000058, 0x00000000,
+0x00000059, 0x00000000, 0x0000005a, 0x00000000,
+0x0000005b, 0x00000000, 0x0000005c, 0x00000000,
+0x0000005d, 0x00000000, 0x0000005e, 0x00000000,
+0x0000005f, 0x00000000, 0x00000060, 0x00000000,
+0x00000061, 0x00000000, 0x00000062, 0x00000000,
+0x00000063, 0x00000000, 0x00000064, 0x00000000,
+0x00000065, 0x00000000, 0x00000066, 0x00000000,
+0x00000067, 0x00000000, 0x00000068, 0x00000000,
+0x00000069, 0x00000000, 0x0000006a, 0x00000000,
+0x0000006b, 0x00000000, 0x0000006c, 0x00000000,
+0x0000006d, 0x00000000, 0x0000006e, 0x00000000,
+0x0000006f, 0x00000000, 0x00000070, 0x00000000,
+0x00000071, 0x00000000, 0x00000072, 0x00000000,
+0x00000073, 0x00000000, 0x00000074, 0x00000000,
+0x00000075, 0x00000000, 0x00000076, 0x00000000,
+0x00000077, 0x00000000, 0x00000078, 0x00000000,
+0x00000079, 0x00000000, 0x0000007a, 0x00000000,
+0x0000007b, 0x00000000, 0x0000007c, 0x00000000,
+0x0000007d, 0x00000000, 0x0000007e, 0x00000000,
+0x0000007f, 0x00000000, 0x00000080, 0x00000000,
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0004300,
+};
+asm(".type avx512f_sg_x86_64_D_64x8i8, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_64_D_64x8i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_64_D_64x8f4[] = {
+0xb85500eb, 0x00000001, 0x000009b9, 0xe5894800,
+0xc0e48348, 0x48ec8348, 0x24748d48, 0xca8948c8,
+0xc6448948, 0xc22948f8, 0xc4148948, 0x48c0ff48,
+0x7509f883, 0x76f5c5e8, 0xefe1c5c9, 0x7ef162db,
+0xf9351008, 0x62000005, 0x35487df2, 0xf5f262c9,
+0xc5c92748, 0xc5c976f5, 0xc5d128fc, 0x0fc193f8,
+0xf8c5c0be, 0x4489d190, 0x8d48a424, 0x48a82444,
+0x8948c289, 0x7df262c1, 0x1d14934a, 0x00100440,
+0x5429fcc5, 0xf162a824, 0x322e087c, 0x034c8a0f,
+0x850f0000, 0x00000346, 0x04c28348, 0x75f23948,
+0xfdf162e5, 0x249c6f48, 0xffffffc8, 0xd128fcc5,
+0xd990f8c5, 0xf262d231, 0x14934b7d, 0x1004409d,
+0x29fcc500, 0x8da82454, 0xeac50272, 0xf162d62a,
+0x142e087c, 0x0a8a0f90, 0x0f000003, 0x00030485,
+0xc2ff4800, 0x08fa8348, 0xf162dd75, 0xf37348dd,
+0x28fcc502, 0x90f8c5d1, 0x0003bae1, 0xf2620000,
+0x14934c7d, 0x10044065, 0x29fcc500, 0xc5a82454,
+0x62d22aea, 0x2e087cf1, 0xcd8a0f10, 0x0f000002,
+0x0002c785, 0x02c28300, 0x04c08348, 0x7513fa83,
+0xfdf162de, 0x24a46f48, 0x00000008, 0xd128fcc5,
+0xe990f8c5, 0xf262c031, 0x14934d7d, 0x100440a5,
+0x29fcc500, 0x48a82454, 0x08c47c8b, 0x01578d48,
+0x247c8948, 0xd2e1c498, 0xf162ea2a, 0x2c2e087c,
+0x7c8a0f81, 0x0f000002, 0x00027685, 0xc0ff4800,
+0x08f88348, 0xd1c5d175, 0xf8c5edef, 0x07b8f190,
+0x62000001, 0xfb48d5f1, 0x28fcc5eb, 0x7df262d9,
+0xad1c934e, 0x00100460, 0x187de2c4, 0x0004932d,
+0x7df26200, 0xc5db3548, 0x62d558ec, 0x35487df2,
+0xe5f362d2, 0x00c21f48, 0xd093f8c5, 0x850fc2fe,
+0x00000255, 0x48ddf162, 0xc501f473, 0x31f928fc,
+0x7df262c0, 0x653c9349, 0x00100440, 0x7c29fcc5,
+0x8b48a824, 0x4808c47c, 0x4801578d, 0x98247c89,
+0x2af2e1c4, 0x7cf162ca, 0x810c2e08, 0x01e88a0f,
+0x850f0000, 0x000001e2, 0x48c0ff48, 0x7508f883,
+0xc7c031d1, 0x06808504, 0x00000010, 0xff480000,
+0x803d48c0, 0x75000000, 0x00b848ea, 0x003f8000,
+0x48400000, 0xa8244489, 0x0000b848, 0x00004040,
+0x89484080, 0x48b02444, 0xa00000b8, 0xc0000040,
+0x44894840, 0xb848b824, 0x40e00000, 0x41000000,
+0x24448948, 0x7df262c0, 0xe10d3548, 0xc5000003,
+0x247c28fc, 0xf5f262a8, 0xc5c92748, 0x62c9eff1,
+0xa3497df2, 0x06800d3c, 0xf1620010, 0x352e087c,
+0x000003dc, 0x01578a0f, 0x01b80000, 0xc5000000,
+0x0fc957f0, 0x00014885, 0x7cf16200, 0x850c2e08,
+0x00100680, 0x013e8a0f, 0x850f0000, 0x00000138,
+0x48c0ff48, 0x7508f883, 0x24448ae0, 0x28fcc5a4,
+0xc5a82474, 0xc5c9eff1, 0x62f892f8, 0xa34f7df2,
+0x06800d34, 0xf1620010, 0x0d10087e, 0x00000380,
+0x087cf162, 0x033e0d2e, 0x8a0f0000, 0x000000ff,
+0x000001b8, 0x57f0c500, 0xf0850fc9, 0x62000000,
+0x2e087cf1, 0x0680850c, 0x8a0f0010, 0x000000e6,
+0x00e0850f, 0xff480000, 0xf88348c0, 0x8ae07508,
+0x62a42444, 0x6f48fdf1, 0xffc824b4, 0xfcc5ffff,
+0xa8246428, 0xd092f8c5, 0x000001b8, 0x7df26200,
+0xb524a34a, 0x00100680, 0xc82af2c5, 0x087cf162,
+0x80850c2e, 0x0f001006, 0x0000a08a, 0x9a850f00,
+0x48000000, 0x8348c0ff, 0xdc7509f8, 0xa424448a,
+0x48fdf162, 0x0824b46f, 0xba000000, 0x00000009,
+0x7c28fcc5, 0xf8c5a824, 0x01b8d892, 0x62000000,
+0xa34b7df2, 0x0680b53c, 0xd1890010, 0xf2c5c129,
+0xf162c92a, 0x0c2e087c, 0x10068085, 0x75557a00,
+0xc0ff4853, 0x09f88348, 0xc031e075, 0xe7b84beb,
+0xeb000000, 0x00efb844, 0x3deb0000, 0x0000f7b8,
+0xb836eb00, 0x000000ff, 0x15b82feb, 0xeb000001,
+0x0131b828, 0x21eb0000, 0x000134b8, 0xb81aeb00,
+0x00000138, 0x3bb813eb, 0xeb000001, 0x0140b80c,
+0x05eb0000, 0x000145b8, 0x00c3c900, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+0x40a00000, 0x40c00000, 0x40e00000, 0x41000000,
+0x41100000, 0x41200000, 0x41300000, 0x41400000,
+0x41500000, 0x41600000, 0x41700000, 0x41800000,
+0x41880000, 0x41900000, 0x41980000, 0x41a00000,
+0x41a80000, 0x41b00000, 0x41b80000, 0x41c00000,
+0x41c80000, 0x41d00000, 0x41d80000, 0x41e00000,
+0x41e80000, 0x41f00000, 0x41f80000, 0x42000000,
+0x42040000, 0x42080000, 0x420c0000, 0x42100000,
+0x42140000, 0x42180000, 0x421c0000, 0x42200000,
+0x42240000, 0x42280000, 0x422c0000, 0x42300000,
+0x42340000, 0x42380000, 0x423c0000, 0x42400000,
+0x42440000, 0x42480000, 0x424c0000, 0x42500000,
+0x42540000, 0x42580000, 0x425c0000, 0x42600000,
+0x42640000, 0x42680000, 0x426c0000, 0x42700000,
+0x42740000, 0x42780000, 0x427c0000, 0x42800000,
+0x42820000, 0x42840000, 0x42860000, 0x42880000,
+0x428a0000, 0x428c0000, 0x428e0000, 0x42900000,
+0x42920000, 0x42940000, 0x42960000, 0x42980000,
+0x429a0000, 0x429c0000, 0x429e0000, 0x42a00000,
+0x42a20000, 0x42a40000, 0x42a60000, 0x42a80000,
+0x42aa0000, 0x42ac0000, 0x42ae0000, 0x42b00000,
+0x42b20000, 0x42b40000, 0x42b60000, 0x42b80000,
+0x42ba0000, 0x42bc0000, 0x42be0000, 0x42c00000,
+0x42c20000, 0x42c40000, 0x42c60000, 0x42c80000,
+0x42ca0000, 0x42cc0000, 0x42ce0000, 0x42d00000,
+0x42d20000, 0x42d40000, 0x42d60000, 0x42d80000,
+0x42da0000, 0x42dc0000, 0x42de0000, 0x42e00000,
+0x42e20000, 0x42e40000, 0x42e60000, 0x42e80000,
+0x42ea0000, 0x42ec0000, 0x42ee0000, 0x42f00000,
+0x42f20000, 0x42f40000, 0x42f60000, 0x42f80000,
+0x42fa0000, 0x42fc0000, 0x42fe0000, 0x43000000,
+0x3f800000, 0xbf800000, 0x41000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0xffffffff, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0003200,
+};
+asm(".type avx512f_sg_x86_64_D_64x8f4, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_64_D_64x8f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_64_D_64x8f8[] = {
+0xb85500eb, 0x00000001, 0x000009b9, 0xe5894800,
+0xc0e48348, 0xc8ec8148, 0x48000000, 0x8948ca89,
+0x4840c444, 0x8948c229, 0x0080c494, 0xff480000,
+0xf88348c0, 0x62e47509, 0x25484df3, 0xf362fff6,
+0xc9254875, 0xefe1c5ff, 0xfff162db, 0x2d2d1008,
+0x62000009, 0x2748cdf2, 0xfdf162ce, 0x48d12848,
+0x08244c8d, 0xc193f8c5, 0xc5c0be0f, 0x89d190f8,
+0x48c42444, 0xc824448d, 0x48c28948, 0xf262c689,
+0x14934afd, 0x1005401d, 0xfdf16200, 0x24942948,
+0xffffffc8, 0x08fdf162, 0x8a0f2a2e, 0x00000412,
+0x040c850f, 0x83480000, 0x394808c2, 0x62e575ca,
+0x6f48fdf1, 0x00482494, 0xf1620000, 0xd92848fd,
+0xd990f8c5, 0xf262d231, 0x1c934bfd, 0x100540d5,
+0xfdf16200, 0x249c2948, 0xffffffc8, 0xc5027a8d,
+0x62df2ae3, 0x2e08fdf1, 0x8a0fd01c, 0x000003c9,
+0x03c3850f, 0xff480000, 0xfa8348c2, 0x62dd7508,
+0x7348ddf1, 0xf16203f2, 0xd92848fd, 0xe190f8c5,
+0x000003ba, 0xfdf26200, 0x651c934c, 0x00100540,
+0x48fdf162, 0xc8249c29, 0xc5ffffff, 0x62da2ae3,
+0x2e08fdf1, 0x858a0f18, 0x0f000003, 0x00037f85,
+0x02c28300, 0x08c08348, 0x7513fa83, 0xfdf162de,
+0xc5e12848, 0x31e990f8, 0xfdf162c0, 0x249c6f48,
+0x00000088, 0x4dfdf262, 0x40dd2493, 0x62001005,
+0x2948fdf1, 0xffc824a4, 0x8b48ffff, 0x008804bc,
+0x8d480000, 0x89480157, 0xc4b8247c, 0xfa2ac3e1,
+0x08fdf162, 0x0f063c2e, 0x00032a8a, 0x24850f00,
+0x48000003, 0x4808c083, 0x7540f883, 0xddf162cd,
+0xd1255858, 0xc5000007, 0x62ffefc1, 0x2848fd71,
+0x90f8c5c1, 0xc5f162f1, 0xb8fafb48, 0x00000107,
+0x4efd7262, 0x80fd0493, 0x62001005, 0x1f48bdf3,
+0xf8c500c4, 0xc2fed093, 0x0316850f, 0xf1620000,
+0xf37348dd, 0x62c03101, 0x9349fdf2, 0x0540a50c,
+0xf1620010, 0x8c2948fd, 0xffffc824, 0xbc8b48ff,
+0x00008804, 0x578d4800, 0x7c894801, 0xe1c4b824,
+0x62e22adb, 0x2e08fdf1, 0x8a0f0624, 0x0000029e,
+0x0298850f, 0x83480000, 0x834808c0, 0xcd7540f8,
+0x48edf162, 0xd9c5dbdb, 0x01b8e4ef, 0xbe000000,
+0x00000009, 0x48e5f362, 0x6204cc1f, 0x6449ddf2,
+0xe5f262de, 0x62cb2748, 0x9349fdf2, 0x0540d50c,
+0xf1620010, 0x8c2948fd, 0x00000824, 0x62f28900,
+0x1008fff1, 0x29ffc154, 0x74c285c2, 0x7c8b4807,
+0x08eb40c4, 0xc4bc8b48, 0x00000080, 0x01578d48,
+0x48c0ff48, 0xb8247c89, 0x2af3e1c4, 0xfdf162ca,
+0x0fd12e08, 0x00021c8a, 0x16850f00, 0x48000002,
+0x7509f883, 0x48c031b8, 0xe0c504c7, 0x00001009,
+0x48000000, 0x3d48c0ff, 0x00000080, 0x8b48e975,
+0x0006ab05, 0xfff16200, 0x246c1108, 0xfff162f9,
+0xc90d1008, 0x48000006, 0xd0244489, 0x95058b48,
+0x62000006, 0x1108fff1, 0x8948240c, 0x48d82444,
+0x068a058b, 0x89480000, 0x48e02444, 0x0686058b,
+0x89480000, 0x48e82444, 0x0682058b, 0x89480000,
+0x48f02444, 0x067e058b, 0x89480000, 0x62f82444,
+0x6f48fdf1, 0x0005f715, 0xfdf16200, 0x24b42848,
+0xffffffc8, 0x48edf262, 0xe9c5ca27, 0xf262d2ef,
+0x34a349fd, 0x1009e015, 0xfdf16200, 0x6d2d2e08,
+0x0f000006, 0x0001638a, 0x0001b800, 0xe9c50000,
+0x850fd257, 0x00000154, 0x08fdf162, 0xe0c5142e,
+0x0f001009, 0x00014a8a, 0x44850f00, 0x48000001,
+0x8348c0ff, 0xe07508f8, 0xc424448a, 0x48fdf162,
+0xc824ac28, 0xc5ffffff, 0xc5d2efe9, 0x62f892f8,
+0xa34ffdf2, 0x09e0152c, 0xf1620010, 0x0d2e08fd,
+0x0000060c, 0x01108a0f, 0x01b80000, 0xc5000000,
+0x0fc957f1, 0x00010185, 0xfdf16200, 0xc50c2e08,
+0x001009e0, 0x00f78a0f, 0x850f0000, 0x000000f1,
+0x48c0ff48, 0x7508f883, 0x24448ae0, 0xfdf162c4,
+0x24b46f48, 0x00000048, 0x48fdf162, 0xc824ac28,
+0xc5ffffff, 0xb8d092f8, 0x00000001, 0x4afdf262,
+0xe0f52ca3, 0xc5001009, 0x62c82af3, 0x2e08fdf1,
+0x09e0c50c, 0x8a0f0010, 0x000000ac, 0x00a6850f,
+0xff480000, 0xf88348c0, 0x8adc7509, 0x62c42444,
+0x2848fdf1, 0xffc824b4, 0x09baffff, 0x62000000,
+0x6f48fdf1, 0x008824bc, 0xf8c50000, 0x01b8d892,
+0x62000000, 0xa34bfdf2, 0x09e0fd34, 0xd1890010,
+0xf3c5c129, 0xf162c92a, 0x0c2e08fd, 0x1009e0c5,
+0x755c7a00, 0xc0ff485a, 0x09f88348, 0xc031e075,
+0xe7b852eb, 0xeb000000, 0x00efb84b, 0x44eb0000,
+0x0000f7b8, 0xb83deb00, 0x000000ff, 0x15b836eb,
+0xeb000001, 0x011eb82f, 0x28eb0000, 0x000131b8,
+0xb821eb00, 0x00000134, 0x38b81aeb, 0xeb000001,
+0x013bb813, 0x0ceb0000, 0x000140b8, 0xb805eb00,
+0x00000145, 0x0000c3c9, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40100000,
+0x00000000, 0x40140000, 0x00000000, 0x40180000,
+0x00000000, 0x401c0000, 0x00000000, 0x40200000,
+0x00000000, 0x40220000, 0x00000000, 0x40240000,
+0x00000000, 0x40260000, 0x00000000, 0x40280000,
+0x00000000, 0x402a0000, 0x00000000, 0x402c0000,
+0x00000000, 0x402e0000, 0x00000000, 0x40300000,
+0x00000000, 0x40310000, 0x00000000, 0x40320000,
+0x00000000, 0x40330000, 0x00000000, 0x40340000,
+0x00000000, 0x40350000, 0x00000000, 0x40360000,
+0x00000000, 0x40370000, 0x00000000, 0x40380000,
+0x00000000, 0x40390000, 0x00000000, 0x403a0000,
+0x00000000, 0x403b0000, 0x00000000, 0x403c0000,
+0x00000000, 0x403d0000, 0x00000000, 0x403e0000,
+0x00000000, 0x403f0000, 0x00000000, 0x40400000,
+0x00000000, 0x40408000, 0x00000000, 0x40410000,
+0x00000000, 0x40418000, 0x00000000, 0x40420000,
+0x00000000, 0x40428000, 0x00000000, 0x40430000,
+0x00000000, 0x40438000, 0x00000000, 0x40440000,
+0x00000000, 0x40448000, 0x00000000, 0x40450000,
+0x00000000, 0x40458000, 0x00000000, 0x40460000,
+0x00000000, 0x40468000, 0x00000000, 0x40470000,
+0x00000000, 0x40478000, 0x00000000, 0x40480000,
+0x00000000, 0x40488000, 0x00000000, 0x40490000,
+0x00000000, 0x40498000, 0x00000000, 0x404a0000,
+0x00000000, 0x404a8000, 0x00000000, 0x404b0000,
+0x00000000, 0x404b8000, 0x00000000, 0x404c0000,
+0x00000000, 0x404c8000, 0x00000000, 0x404d0000,
+0x00000000, 0x404d8000, 0x00000000, 0x404e0000,
+0x00000000, 0x404e8000, 0x00000000, 0x404f0000,
+0x00000000, 0x404f8000, 0x00000000, 0x40500000,
+0x00000000, 0x40504000, 0x00000000, 0x40508000,
+0x00000000, 0x4050c000, 0x00000000, 0x40510000,
+0x00000000, 0x40514000, 0x00000000, 0x40518000,
+0x00000000, 0x4051c000, 0x00000000, 0x40520000,
+0x00000000, 0x40524000, 0x00000000, 0x40528000,
+0x00000000, 0x4052c000, 0x00000000, 0x40530000,
+0x00000000, 0x40534000, 0x00000000, 0x40538000,
+0x00000000, 0x4053c000, 0x00000000, 0x40540000,
+0x00000000, 0x40544000, 0x00000000, 0x40548000,
+0x00000000, 0x4054c000, 0x00000000, 0x40550000,
+0x00000000, 0x40554000, 0x00000000, 0x40558000,
+0x00000000, 0x4055c000, 0x00000000, 0x40560000,
+0x00000000, 0x40564000, 0x00000000, 0x40568000,
+0x00000000, 0x4056c000, 0x00000000, 0x40570000,
+0x00000000, 0x40574000, 0x00000000, 0x40578000,
+0x00000000, 0x4057c000, 0x00000000, 0x40580000,
+0x00000000, 0x40584000, 0x00000000, 0x40588000,
+0x00000000, 0x4058c000, 0x00000000, 0x40590000,
+0x00000000, 0x40594000, 0x00000000, 0x40598000,
+0x00000000, 0x4059c000, 0x00000000, 0x405a0000,
+0x00000000, 0x405a4000, 0x00000000, 0x405a8000,
+0x00000000, 0x405ac000, 0x00000000, 0x405b0000,
+0x00000000, 0x405b4000, 0x00000000, 0x405b8000,
+0x00000000, 0x405bc000, 0x00000000, 0x405c0000,
+0x00000000, 0x405c4000, 0x00000000, 0x405c8000,
+0x00000000, 0x405cc000, 0x00000000, 0x405d0000,
+0x00000000, 0x405d4000, 0x00000000, 0x405d8000,
+0x00000000, 0x405dc000, 0x00000000, 0x405e0000,
+0x00000000, 0x405e4000, 0x00000000, 0x405e8000,
+0x00000000, 0x405ec000, 0x00000000, 0x405f0000,
+0x00000000, 0x405f4000, 0x00000000, 0x405f8000,
+0x00000000, 0x405fc000, 0x00000000, 0x40600000,
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0xbff00000,
+0x00000000, 0x40000000, 0x00000000, 0x40080000,
+0x00000000, 0x40100000, 0x00000000, 0x40140000,
+0x00000000, 0x40180000, 0x00000000, 0x401c0000,
+0x00000000, 0x40200000,
+0004710,
+};
+asm(".type avx512f_sg_x86_64_D_64x8f8, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_64_D_64x8f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_64_D_16x4i4[] = {
+0xb84800eb, 0x00000001, 0x00000002, 0xe5894855,
+0xe0458948, 0x0003b848, 0x00040000, 0x89480000,
+0x01b8e845, 0x48c00000, 0x4802e0c1, 0xb8f04589,
+0x80000001, 0x48c00148, 0xc5f84589, 0x62c976f1,
+0xef0865f1, 0x4d8d48db, 0x75f262d0, 0x62c92708,
+0x6f087df1, 0x93f8c5d1, 0xc0be0fc1, 0xd190f8c5,
+0x48bc4589, 0x48c0458d, 0xf262c689, 0x14900a7d,
+0x1004201d, 0x7df16200, 0xfc557f08, 0x0f013883,
+0x00034f85, 0xc0834800, 0xc8394804, 0xf162ee75,
+0x656f087d, 0x7df162fe, 0xc5d16f08, 0xb8d990f8,
+0x000000ef, 0x0b7df262, 0x20a51490, 0x62001004,
+0x7e087df1, 0x7df162d2, 0xfc557f08, 0x0f02fa83,
+0x00033e85, 0x79e3c400, 0x8301d216, 0x850f03fa,
+0x0000032f, 0x1679e3c4, 0xfa8302d2, 0x20850f04,
+0xc4000003, 0xd21679e3, 0x05fa8303, 0x0311850f,
+0xf1620000, 0xf4720865, 0x7df16202, 0xc5d16f08,
+0xb8e190f8, 0x000000f7, 0x0c7df262, 0x205d1490,
+0x62001004, 0x7e087df1, 0x7df162d2, 0xfc557f08,
+0x0f03fa83, 0x0002da85, 0x79e3c400, 0x8301d216,
+0x850f05fa, 0x000002cb, 0x1679e3c4, 0xfa8302d2,
+0xbc850f07, 0xc4000002, 0xd21679e3, 0x09fa8303,
+0x02ad850f, 0xf1620000, 0x556f087d, 0x7df162ff,
+0xc5d96f08, 0x31e990f8, 0x7df262c0, 0x951c900d,
+0x00100420, 0x087df162, 0x8bfc5d7f, 0x89f0287c,
+0x578db87d, 0x06143901, 0x024d850f, 0x83480000,
+0x834804c0, 0xe37510f8, 0x0865f162, 0xf162dbef,
+0x5dfa0865, 0x7df162fe, 0x62e96f08, 0x6f087df1,
+0xf8c5fc75, 0x07b8f190, 0x62000001, 0x900e7df2,
+0x04309d2c, 0xf1620010, 0x1dfa084d, 0x000002d0,
+0x0855f362, 0xc500c31f, 0x80d093f8, 0x850f0ffa,
+0x0000021f, 0x086df162, 0x6201f272, 0x6f087df1,
+0x62c031d9, 0x90097df2, 0x0420551c, 0xf1620010,
+0x5d7f087d, 0x057c8bfc, 0xb87d89f0, 0x3901578d,
+0x850f0614, 0x000001ca, 0x04c08348, 0x10f88348,
+0xf162e375, 0x55db085d, 0x55f162ff, 0xb8edef08,
+0x00000001, 0x000005be, 0x76e9c500, 0x6df162d5,
+0x62c9df08, 0x270875f2, 0x7df262c9, 0xa51c9009,
+0x00100420, 0x087df162, 0x89fd5d7f, 0x817c8bf2,
+0x85c229fc, 0x8b0674c2, 0xebdc8554, 0x85548b07,
+0xb85589ec, 0xff48c2ff, 0x0fd739c0, 0x00016885,
+0xf8834800, 0x31d47505, 0x89d231c0, 0x04c08514,
+0xff480010, 0xf88348c0, 0x48ee7520, 0x000001b8,
+0x00000200, 0x45894800, 0x03b848c0, 0x04000000,
+0x48000000, 0x62c84589, 0x6f087df1, 0x0001ef0d,
+0x7df16200, 0xfc7d6f08, 0x000131b8, 0x75f26200,
+0x62c92708, 0xef0875f1, 0x7df262c9, 0x0d3ca009,
+0x001004c0, 0x01d53d83, 0x0f010000, 0x00011285,
+0xcd158b00, 0x0b000001, 0x0001cb15, 0x0134b800,
+0x150b0000, 0x000001c4, 0x00f5850f, 0x458a0000,
+0x7df162bc, 0xfc756f08, 0xf892f8c5, 0x000138b8,
+0x7df26200, 0x0d34a00f, 0x001004c0, 0x018d3d83,
+0x0f040000, 0x0000ca85, 0x85058b00, 0x0b000001,
+0x00018305, 0x81050b00, 0x0f000001, 0x00009f85,
+0xbc4d8a00, 0x087df162, 0xbafe7d6f, 0x00000001,
+0x087df162, 0xc5fc756f, 0x62d192f8, 0xa00a7df2,
+0x04c0bd34, 0x14390010, 0x1004c095, 0x48787500,
+0x8348c2ff, 0xee7505fa, 0x62bc4d8a, 0x6f087df1,
+0xf162ff7d, 0x656f087d, 0x92f8c5fc, 0x7df262d9,
+0xbd24a00b, 0x001004c0, 0x01153d83, 0x75040000,
+0x103d834d, 0x03000001, 0x3d834475, 0x0000010b,
+0x833b7502, 0x0001063d, 0x45ba0100, 0x0f000001,
+0x2febc245, 0x0000e7b8, 0xb828eb00, 0x000000ff,
+0x15b821eb, 0xeb000001, 0x011eb81a, 0x13eb0000,
+0x00013bb8, 0xb80ceb00, 0x00000140, 0x45b805eb,
+0x5d000001, 0x000000c3, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000002, 0x00000003, 0x00000004,
+0x00000005, 0x00000006, 0x00000007, 0x00000008,
+0x00000009, 0x0000000a, 0x0000000b, 0x0000000c,
+0x0000000d, 0x0000000e, 0x0000000f, 0x00000010,
+0x00000011, 0x00000012, 0x00000013, 0x00000014,
+0x00000015, 0x00000016, 0x00000017, 0x00000018,
+0x00000019, 0x0000001a, 0x0000001b, 0x0000001c,
+0x0000001d, 0x0000001e, 0x0000001f, 0x00000020,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0xffffffff, 0x00000000, 0x00000000, 0x00000000,
+0002300,
+};
+asm(".type avx512f_sg_x86_64_D_16x4i4, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_64_D_16x4i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_64_D_16x4i8[] = {
+0xb84800eb, 0x00000001, 0x00000002, 0xe5894855,
+0xe0458948, 0x0003b848, 0x00040000, 0x89480000,
+0x01b8e845, 0x48800000, 0x8948c001, 0xffb8f045,
+0x48ffffff, 0x4820e0c1, 0xc5f84589, 0x62c976f1,
+0xef08d5f1, 0xf5f262ed, 0x62c92708, 0x6f08fdf1,
+0x93f8c5d1, 0xc0be0fc1, 0xd190f8c5, 0xb8cc4589,
+0x000000e7, 0x0afdf262, 0x202d1490, 0x62001003,
+0x7e08fdf1, 0xfdf162d2, 0xfd557f08, 0x0fcaff48,
+0x00029785, 0xf9e3c400, 0x4801d216, 0x0f01fa83,
+0x00028785, 0xfdf16200, 0xfe5d6f08, 0x08fdf162,
+0xf8c5d16f, 0xefb8d990, 0x62000000, 0x900bfdf2,
+0x0320dd14, 0xf1620010, 0xd17e08fd, 0x08fdf162,
+0x48fd557f, 0x0f02f983, 0x00024f85, 0xf9e3c400,
+0x4801d116, 0x0f03f983, 0x00023f85, 0x65f16200,
+0x03f37208, 0x08fdf162, 0xf8c5d16f, 0xf7b8e190,
+0x62000000, 0x900cfdf2, 0x03205d14, 0xf1620010,
+0xd17e08fd, 0x08fdf162, 0x48fd557f, 0x0f03f983,
+0x00020785, 0xf9e3c400, 0x4801d116, 0x0f05f983,
+0x0001f785, 0xf0458b00, 0x08fdf162, 0x62ff656f,
+0x6f08fdf1, 0x90f8c5d9, 0xfdf262e9, 0xe51c900d,
+0x00100320, 0xb801708d, 0x000000ff, 0x62f66348,
+0x7e08fdf1, 0xfdf162d9, 0xfd5d7f08, 0x0fce3948,
+0x0001b785, 0xf44d8b00, 0x16f9e3c4, 0x8d4401df,
+0x634d0141, 0xf83949c0, 0x019e850f, 0xf1620000,
+0x6dfa0855, 0xfdf262fe, 0x62d27c08, 0x6f08fdf1,
+0x90f8c5f1, 0xe5f162f1, 0xb8dafb08, 0x00000107,
+0x0efdf262, 0x30ed3490, 0x62001003, 0x1f08cdf3,
+0xf8c500c3, 0xfa80d093, 0x5d850f03, 0x62000001,
+0x72085df1, 0x15b801f4, 0x62000001, 0x9009fdf2,
+0x0320a50c, 0xf1620010, 0xca7e08fd, 0x0fd63948,
+0x00013785, 0xf9e3c400, 0x4901ca16, 0x850fd039,
+0x00000128, 0xd231c031, 0xc5148948, 0x00100440,
+0x48c0ff48, 0x7520f883, 0x45c748ed, 0x000001d0,
+0x45c74800, 0x000002d8, 0xfdf16200, 0xfd0d6f08,
+0x62000001, 0x6f08fdf1, 0x31b8fd7d, 0x62000001,
+0x2708f5f2, 0xf5f162c9, 0x62c9ef08, 0xa009fdf2,
+0x04400d3c, 0x83480010, 0x0001f23d, 0x850f0100,
+0x000000c8, 0xec3d8348, 0x00000001, 0x000134b8,
+0xb5850f00, 0x8a000000, 0xf162cc45, 0x7d6f08fd,
+0x92f8c5fd, 0x0138b8f8, 0xf2620000, 0x3ca00ffd,
+0x1004400d, 0x3d834800, 0x000001b3, 0x89850f02,
+0x48000000, 0x01ad3d83, 0xb8000000, 0x0000013b,
+0x458a7a75, 0xfdf162cc, 0xfe7d6f08, 0x08fdf162,
+0xc5fd656f, 0xb8d092f8, 0x00000140, 0x0afdf262,
+0x40fd24a0, 0x48001004, 0x01793d83, 0x75010000,
+0x3d83484b, 0x00000177, 0x8a417502, 0xf162cc45,
+0x6d6f08fd, 0xfdf162ff, 0xfd756f08, 0xd892f8c5,
+0x000145b8, 0xfdf26200, 0xed34a00b, 0x00100440,
+0x403d8348, 0x02000001, 0xc0311275, 0x000145ba,
+0x3d834800, 0x00000137, 0xc2450f01, 0x0000c35d,
+0x00000001, 0x00000000, 0x00000002, 0x00000000,
+0x00000003, 0x00000000, 0x00000004, 0x00000000,
+0x00000005, 0x00000000, 0x00000006, 0x00000000,
+0x00000007, 0x00000000, 0x00000008, 0x00000000,
+0x00000009, 0x00000000, 0x0000000a, 0x00000000,
+0x0000000b, 0x00000000, 0x0000000c, 0x00000000,
+0x0000000d, 0x00000000, 0x0000000e, 0x00000000,
+0x0000000f, 0x00000000, 0x00000010, 0x00000000,
+0x00000011, 0x00000000, 0x00000012, 0x00000000,
+0x00000013, 0x00000000, 0x00000014, 0x00000000,
+0x00000015, 0x00000000, 0x00000016, 0x00000000,
+0x00000017, 0x00000000, 0x00000018, 0x00000000,
+0x00000019, 0x00000000, 0x0000001a, 0x00000000,
+0x0000001b, 0x00000000, 0x0000001c, 0x00000000,
+0x0000001d, 0x00000000, 0x0000001e, 0x00000000,
+0x0000001f, 0x00000000, 0x00000020, 0x00000000,
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+0002060,
+};
+asm(".type avx512f_sg_x86_64_D_16x4i8, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_64_D_16x4i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_64_D_16x4f4[] = {
+0xb84800eb, 0x00000001, 0x00000002, 0xe5894855,
+0xe0458948, 0x0003b848, 0x00040000, 0x89480000,
+0x01b8e845, 0x48c00000, 0x4802e0c1, 0xb8f04589,
+0x80000001, 0x48c00148, 0xc5f84589, 0xc5e476d9,
+0x62c976f1, 0xef0865f1, 0x5df262db, 0x62cc2708,
+0x28087cf1, 0x4d8d48d1, 0x93f8c5d0, 0xc0be0fc1,
+0xd190f8c5, 0x48bc4589, 0x48c0458d, 0xf262c689,
+0x14920a7d, 0x1005e01d, 0x7cf16200, 0xfc552908,
+0x087ef162, 0x05d61510, 0xf1620000, 0x102e087c,
+0x04e78a0f, 0x850f0000, 0x000004e1, 0x04c08348,
+0x75c83948, 0x7df162e5, 0xfe5d6f08, 0x087cf162,
+0xf8c5d128, 0xf262d990, 0x14920b7d, 0x1005e09d,
+0x7cf16200, 0x99152e08, 0x62000005, 0x29087cf1,
+0x8a0ffc55, 0x000004ac, 0x04a6850f, 0xf1620000,
+0xeac6086c, 0x7cf16255, 0x792d2e08, 0x0f000005,
+0x00048f8a, 0x89850f00, 0x62000004, 0x15086cf1,
+0x7cf162ea, 0x612d2e08, 0x0f000005, 0x0004738a,
+0x6d850f00, 0x62000004, 0xc6086cf1, 0xf162ffd2,
+0x152e087c, 0x00000548, 0x04568a0f, 0x850f0000,
+0x00000450, 0x0855f162, 0x6202f372, 0x28087cf1,
+0x90f8c5d1, 0x7df262e1, 0x6d14920c, 0x001005e0,
+0x087cf162, 0x050e152e, 0xf1620000, 0x5529087c,
+0x248a0ffc, 0x0f000004, 0x00041e85, 0x6cf16200,
+0x55eac608, 0x087cf162, 0x04f22d2e, 0x8a0f0000,
+0x00000407, 0x0401850f, 0xf1620000, 0xea15086c,
+0x087cf162, 0x04da2d2e, 0x8a0f0000, 0x000003eb,
+0x03e5850f, 0xf1620000, 0xd2c6086c, 0x7cf162ff,
+0xc1152e08, 0x0f000004, 0x0003ce8a, 0xc8850f00,
+0x62000003, 0x6f087df1, 0xf162ff55, 0xe928087c,
+0xe990f8c5, 0xf262c031, 0x2c920d7d, 0x1005e095,
+0x7cf16200, 0xfc6d2908, 0xf0287c8b, 0x8901578d,
+0xf162b87d, 0xea2a0856, 0x087cf162, 0x0f062c2e,
+0x00038d8a, 0x87850f00, 0x48000003, 0x4804c083,
+0x7510f883, 0x55f162d3, 0x62edef08, 0xfa0855f1,
+0xf162fe6d, 0xf128087c, 0xf190f8c5, 0x000107b8,
+0x7df26200, 0xad34920e, 0x001005f0, 0x087df262,
+0x04362d18, 0xf1620000, 0x6d580854, 0x4df362fc,
+0x00c51f08, 0xd093f8c5, 0x0f0ffa80, 0x00036e85,
+0x6df16200, 0x01f27208, 0xf262c031, 0x0c92097d,
+0x1005e055, 0x7cf16200, 0xfc4d2908, 0xf0057c8b,
+0x8901578d, 0xf162b87d, 0xd22a086e, 0x087cf162,
+0x0f06142e, 0x0003008a, 0xfa850f00, 0x48000002,
+0x4804c083, 0x7510f883, 0x65f162d3, 0xff55db08,
+0x0855f162, 0x01b8edef, 0xbe000000, 0x00000005,
+0xd576e9c5, 0x086df162, 0xf262d4df, 0xca27086d,
+0x097df262, 0xe09d0c92, 0x62001005, 0x29087cf1,
+0xf289fd4d, 0x087ef162, 0xff815410, 0xc285c229,
+0x7c8b0674, 0x07ebdc85, 0xec857c8b, 0x8db87d89,
+0xff480157, 0x76f162c0, 0x62ca2a08, 0x2e087cf1,
+0x898a0fd1, 0x0f000002, 0x00028385, 0xf8834800,
+0x31bf7505, 0x57e8c5c0, 0x8504c7d2, 0x001006a0,
+0x00000000, 0x48c0ff48, 0x7520f883, 0x00b848ec,
+0x003f8000, 0x48400000, 0x48c04589, 0x400000b8,
+0x80000040, 0x45894840, 0x7df162c8, 0x1d0d6f08,
+0x62000003, 0x28087cf1, 0xf162fc7d, 0xdbef0865,
+0x0875f262, 0xf162c927, 0x0d10087e, 0x000002e0,
+0x097df262, 0xa01d3ca2, 0x62001006, 0x2e087cf1,
+0x00030b0d, 0x0c8a0f00, 0x0f000002, 0x00020685,
+0x7cf16200, 0xf9152e08, 0x0f000002, 0x0001fd8a,
+0xf7850f00, 0x62000001, 0x2e087cf1, 0x0002e715,
+0xe78a0f00, 0x0f000001, 0x0001e185, 0x7cf16200,
+0xd5152e08, 0x0f000002, 0x0001d18a, 0xcb850f00,
+0x8a000001, 0xf162bc45, 0x7d28087c, 0x92f8c5fc,
+0x7df262f8, 0x1d3ca20f, 0x001006a0, 0x087ef162,
+0x029a1510, 0xf1620000, 0x152e087c, 0x0000025c,
+0x019f8a0f, 0x850f0000, 0x00000199, 0xd257e8c5,
+0x087cf162, 0x027a152e, 0x8a0f0000, 0x0000018c,
+0x0186850f, 0xf1620000, 0x152e087c, 0x00000268,
+0x01768a0f, 0x850f0000, 0x00000170, 0x087cf162,
+0x0256152e, 0x8a0f0000, 0x00000160, 0x015a850f,
+0x458a0000, 0x7df162bc, 0xfe656f08, 0x087cf162,
+0xc5fc7d28, 0x62d092f8, 0xa20a7df2, 0x06a0a53c,
+0xf1620010, 0x0d2e087c, 0x00000218, 0x01318a0f,
+0x850f0000, 0x0000012b, 0x087ef162, 0x02061510,
+0xf1620000, 0x152e087c, 0x000001b8, 0x01118a0f,
+0x850f0000, 0x0000010b, 0x087ef162, 0x01ea1510,
+0xf1620000, 0x152e087c, 0x0000019c, 0x00f18a0f,
+0x850f0000, 0x000000eb, 0x087ef162, 0x01ce1510,
+0xf1620000, 0x152e087c, 0x00000180, 0x00d18a0f,
+0x850f0000, 0x000000cb, 0x62bc458a, 0x6f087df1,
+0xf162ff65, 0x7528087c, 0x92f8c5fc, 0x7df262d8,
+0xa534a20b, 0x001006a0, 0x087ef162, 0x01821510,
+0xf1620000, 0x152e087c, 0x00000140, 0x00988a0f,
+0x850f0000, 0x00000092, 0x087ef162, 0x01661510,
+0xf1620000, 0x152e087c, 0x0000011c, 0x7a757c7a,
+0x087ef162, 0x01521510, 0xf1620000, 0x152e087c,
+0x00000100, 0x6275647a, 0x087cf162, 0x013e0d2e,
+0x567a0000, 0x000000b8, 0xeb547400, 0x00e7b84d,
+0x4beb0000, 0x0000efb8, 0xb844eb00, 0x000000f7,
+0xffb83deb, 0xeb000000, 0x0115b836, 0x2feb0000,
+0x00011eb8, 0xb828eb00, 0x00000131, 0x34b821eb,
+0xeb000001, 0x0138b81a, 0x13eb0000, 0x00013bb8,
+0xb80ceb00, 0x00000140, 0x45b805eb, 0x5d000001,
+0x000000c3, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+0x40a00000, 0x40c00000, 0x40e00000, 0x41000000,
+0x41100000, 0x41200000, 0x41300000, 0x41400000,
+0x41500000, 0x41600000, 0x41700000, 0x41800000,
+0x41880000, 0x41900000, 0x41980000, 0x41a00000,
+0x41a80000, 0x41b00000, 0x41b80000, 0x41c00000,
+0x41c80000, 0x41d00000, 0x41d80000, 0x41e00000,
+0x41e80000, 0x41f00000, 0x41f80000, 0x42000000,
+0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+0x40a00000, 0x40e00000, 0x41100000, 0xbf800000,
+0xffffffff, 0x00000000, 0x00000000, 0x00000000,
+0003220,
+};
+asm(".type avx512f_sg_x86_64_D_16x4f4, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_64_D_16x4f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_64_D_16x4f8[] = {
+0xb84800eb, 0x00000001, 0x00000002, 0xe5894855,
+0xe0458948, 0x0003b848, 0x00040000, 0x89480000,
+0x01b8e845, 0x48800000, 0x8948c001, 0xffb8f045,
+0x48ffffff, 0x4820e0c1, 0xc5f84589, 0x62c976f1,
+0xef08e5f1, 0xf5f262db, 0xc5c92708, 0x62c976f1,
+0x2808fdf1, 0x93f8c5d1, 0xc0be0fc1, 0xd190f8c5,
+0x62cc4589, 0x920afdf2, 0x04001d14, 0xf1620010,
+0x1d1008ff, 0x00000488, 0x08fdf162, 0x62fd5529,
+0x2e08fdf1, 0x238a0fd3, 0x0f000003, 0x00031d85,
+0xedf16200, 0x62d21508, 0x2e08fdf1, 0x0b8a0fd3,
+0x0f000003, 0x00030585, 0xfdf16200, 0xfe6d6f08,
+0x08fdf162, 0xf8c5e128, 0xf162d990, 0x151008ff,
+0x00000444, 0x0bfdf262, 0x00ed2492, 0x62001004,
+0x2e08fdf1, 0xfdf162e2, 0xfd652908, 0x02d38a0f,
+0x850f0000, 0x000002cd, 0x08fff162, 0x041e3510,
+0xf1620000, 0xe41508dd, 0x08fdf162, 0x8a0fe62e,
+0x000002b1, 0x02ab850f, 0xf1620000, 0xf5720855,
+0xfdf16203, 0xc5e12808, 0x62e190f8, 0x920cfdf2,
+0x04006d24, 0xf1620010, 0xe62e08fd, 0x08fdf162,
+0x0ffd6529, 0x0002838a, 0x7d850f00, 0x62000002,
+0x1508ddf1, 0xfdf162e4, 0xc9252e08, 0x0f000003,
+0x0002678a, 0x61850f00, 0x8b000002, 0xf162f045,
+0x6d6f08fd, 0xfdf162ff, 0xc5e12808, 0x62e990f8,
+0x920dfdf2, 0x0400ed24, 0xc0ff0010, 0x0847f162,
+0xf162f82a, 0x652908fd, 0xfdf162fd, 0x0ffc2e08,
+0x00022e8a, 0x28850f00, 0x8b000002, 0xf162f445,
+0xe41508dd, 0xf162c0ff, 0xf02a084f, 0x08fdf162,
+0x8a0ff42e, 0x0000020b, 0x0205850f, 0xf1620000,
+0xe4ef08dd, 0x085df162, 0x62fe65fa, 0x2808fd71,
+0x90f8c5c1, 0x0107b8f1, 0x72620000, 0x04920efd,
+0x100410e5, 0xfff16200, 0x31251208, 0x62000003,
+0x5808ddf1, 0xf362fd65, 0xc41f08bd, 0x93f8c500,
+0x03fa80d0, 0x01ef850f, 0xf1620000, 0xf5720855,
+0xfdf26201, 0xad0c9209, 0x00100400, 0x08fdf162,
+0x8a0ff92e, 0x000001a2, 0x019c850f, 0xf1620000,
+0xc91508f5, 0x08fdf162, 0x8a0ff12e, 0x0000018a,
+0x000000b8, 0x57f1c500, 0x7b850fc9, 0x48000001,
+0x40c504c7, 0x00001005, 0x48000000, 0x8348c0ff,
+0xeb7520f8, 0x08fff162, 0x62fa5d11, 0x1108fff1,
+0xf162fb55, 0x256f08fd, 0x000002b4, 0x08fdf162,
+0x62fd7d28, 0x2708ddf2, 0xddf162cc, 0x62e4ef08,
+0xa209fdf2, 0x0540253c, 0xf1620010, 0x1d2e08fd,
+0x0000029c, 0x01278a0f, 0x850f0000, 0x00000121,
+0x08fdf162, 0x028e0d2e, 0x8a0f0000, 0x00000118,
+0x0112850f, 0x458a0000, 0xfdf162cc, 0xfd7d2808,
+0xf892f8c5, 0x0ffdf262, 0x40253ca2, 0x62001005,
+0x2e08fdf1, 0x00025715, 0xf08a0f00, 0x0f000000,
+0x0000ea85, 0xfdf16200, 0x490d2e08, 0x0f000002,
+0x0000e18a, 0xdb850f00, 0x8a000000, 0xf162cc45,
+0x7d6f08fd, 0xfdf162fe, 0xfd752808, 0xd092f8c5,
+0x0afdf262, 0x40fd34a2, 0x62001005, 0x2e08fdf1,
+0x0002131d, 0xb28a0f00, 0x62000000, 0x1008fff1,
+0x0001bb0d, 0xfdf16200, 0xf90d2e08, 0x0f000001,
+0x00009885, 0xfdf16200, 0xf1152e08, 0x0f000001,
+0x0000888a, 0x82850f00, 0x8a000000, 0xf162cc45,
+0x5d6f08fd, 0xfdf162ff, 0xfd7d2808, 0xd892f8c5,
+0x0bfdf262, 0x40dd3ca2, 0x62001005, 0x2e08fdf1,
+0x0001b315, 0x755d7a00, 0xfdf1625b, 0xad0d2e08,
+0x7a000001, 0x0000b84f, 0x4d740000, 0xe7b846eb,
+0xeb000000, 0x00efb844, 0x3deb0000, 0x0000f7b8,
+0xb836eb00, 0x000000ff, 0x15b82feb, 0xeb000001,
+0x0131b828, 0x21eb0000, 0x000134b8, 0xb81aeb00,
+0x00000138, 0x3bb813eb, 0xeb000001, 0x0140b80c,
+0x05eb0000, 0x000145b8, 0x00c35d00, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40100000,
+0x00000000, 0x40140000, 0x00000000, 0x40180000,
+0x00000000, 0x401c0000, 0x00000000, 0x40200000,
+0x00000000, 0x40220000, 0x00000000, 0x40240000,
+0x00000000, 0x40260000, 0x00000000, 0x40280000,
+0x00000000, 0x402a0000, 0x00000000, 0x402c0000,
+0x00000000, 0x402e0000, 0x00000000, 0x40300000,
+0x00000000, 0x40310000, 0x00000000, 0x40320000,
+0x00000000, 0x40330000, 0x00000000, 0x40340000,
+0x00000000, 0x40350000, 0x00000000, 0x40360000,
+0x00000000, 0x40370000, 0x00000000, 0x40380000,
+0x00000000, 0x40390000, 0x00000000, 0x403a0000,
+0x00000000, 0x403b0000, 0x00000000, 0x403c0000,
+0x00000000, 0x403d0000, 0x00000000, 0x403e0000,
+0x00000000, 0x403f0000, 0x00000000, 0x40400000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40140000,
+0x00000000, 0xbff00000, 0x00000000, 0x00000000,
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+0002500,
+};
+asm(".type avx512f_sg_x86_64_D_16x4f8, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_64_D_16x4f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_64_D_16x8i4[] = {
+0x485500eb, 0xc748e589, 0x0001e045, 0xc7480000,
+0x0002f045, 0xc7480000, 0x0002e845, 0xc7480000,
+0x0001f845, 0xf1c50000, 0xf162c976, 0xdbef0865,
+0x0875f262, 0xf162c927, 0xd16f087d, 0xc193f8c5,
+0xc5c0be0f, 0x89d190f8, 0xe7b8cc45, 0x62000000,
+0x910a7df2, 0x03c01d14, 0xf1620010, 0xd27e087d,
+0x087df162, 0xfffd557f, 0x4c850fca, 0xc4000003,
+0xd21679e3, 0x0fcaff01, 0x00033e85, 0x79e3c400,
+0xc402d116, 0xd21679e3, 0x00eab803, 0xd1090000,
+0x0325850f, 0xf1620000, 0x5d6f087d, 0x7df162fe,
+0xc5d16f08, 0xb8d990f8, 0x000000ef, 0x0b7df262,
+0xc09d1491, 0x62001003, 0x7e087df1, 0x7df162d2,
+0xfd557f08, 0x0f02fa83, 0x0002ee85, 0x79e3c400,
+0x8301d216, 0x850f03fa, 0x000002df, 0x1679e3c4,
+0xe3c402d1, 0x03d21679, 0x0000f2b8, 0x0fd10900,
+0x0002c685, 0xe5f16200, 0x02f37308, 0x087df162,
+0xf8c5d16f, 0xf7b8e190, 0x62000000, 0x910c7df2,
+0x03c05d14, 0xf1620010, 0xd27e087d, 0x087df162,
+0x83fd557f, 0x850f03fa, 0x0000028f, 0x1679e3c4,
+0xfa8301d2, 0x80850f05, 0xc4000002, 0xd11679e3,
+0x79e3c402, 0xb803d216, 0x000000fa, 0x850fd109,
+0x00000267, 0x087df162, 0x62ff5d6f, 0x6f087df1,
+0x758b48d1, 0x90f8c5f0, 0x00ffb8e9, 0xf2620000,
+0x14910d7d, 0x1003c09d, 0x4e8d4800, 0x7df16201,
+0x62d27e08, 0x7f087df1, 0x6348fd55, 0xca3948d2,
+0x0225850f, 0x8b480000, 0xe3c4f845, 0x01d11679,
+0x48c96348, 0xb801508d, 0x000000ff, 0x0fd13948,
+0x00020685, 0x79e3c400, 0xc402d716, 0xd21679e3,
+0x0102b803, 0xd7090000, 0x01ed850f, 0xf1620000,
+0xe4ef085d, 0x08ddf162, 0x8bfe65fb, 0xf8c5d045,
+0xf162f190, 0xd16f087d, 0x0e7df262, 0xc8a51491,
+0x8d001003, 0x0bb8ff50, 0x62000001, 0x7e087df1,
+0x0fd739d7, 0x0001b285, 0xd4458b00, 0x1679e3c4,
+0x508d01d7, 0x010bb8ff, 0xd7390000, 0x0199850f,
+0xe3c40000, 0x02d71679, 0x1679e3c4, 0x0eb803d2,
+0x09000001, 0x80850fd7, 0x62000001, 0x7308e5f1,
+0xff4801f3, 0x0115b8c6, 0xf2620000, 0x0c91097d,
+0x1003c05d, 0x7df16200, 0x62ca7e08, 0x7f087df1,
+0x6348fd4d, 0xf23948d2, 0x014d850f, 0xe3c40000,
+0x01ca1679, 0x48d26348, 0x850fca39, 0x0000013b,
+0x1679e3c4, 0xe3c402c9, 0x03ca1679, 0x000118b8,
+0x0fd10900, 0x00012285, 0x31c03100, 0x851489d2,
+0x00100460, 0x48c0ff48, 0x7520f883, 0x01b848ee,
+0x02000000, 0x48000000, 0x62d04589, 0x6f087df1,
+0x00017b0d, 0x7df16200, 0xfd6d6f08, 0x000131b8,
+0x75f26200, 0x62c92708, 0xef0875f1, 0x7df262c9,
+0x0d2ca109, 0x00100460, 0x01713d83, 0x0f010000,
+0x0000c685, 0x683d8300, 0x00000001, 0x000134b8,
+0xb4850f00, 0x8a000000, 0xf162cc45, 0x756f087d,
+0x92f8c5fd, 0x0138b8f8, 0xf2620000, 0x34a10f7d,
+0x1004600d, 0x343d8300, 0x02000001, 0x0089850f,
+0x058b0000, 0x0000012c, 0x6c75c085, 0x62cc4d8a,
+0x6f087df1, 0xf162fe7d, 0x6d6f087d, 0x92f8c5fd,
+0x7df262d1, 0xbd2ca10a, 0x00100460, 0x01013d83,
+0x75010000, 0xfc3d834a, 0x02000000, 0x4d8a4175,
+0x7df162cc, 0xff756f08, 0x087df162, 0xc5fd7d6f,
+0x62d992f8, 0xa10b7df2, 0x0460b53c, 0x3d830010,
+0x000000cf, 0x831f7502, 0x0000ca3d, 0x45ba0100,
+0x0f000001, 0x13ebc245, 0x00013bb8, 0xb80ceb00,
+0x00000140, 0x45b805eb, 0x5d000001, 0x000000c3,
+0x00000001, 0x00000002, 0x00000003, 0x00000004,
+0x00000005, 0x00000006, 0x00000007, 0x00000008,
+0x00000009, 0x0000000a, 0x0000000b, 0x0000000c,
+0x0000000d, 0x0000000e, 0x0000000f, 0x00000010,
+0x00000011, 0x00000012, 0x00000013, 0x00000014,
+0x00000015, 0x00000016, 0x00000017, 0x00000018,
+0x00000019, 0x0000001a, 0x0000001b, 0x0000001c,
+0x0000001d, 0x0000001e, 0x0000001f, 0x00000020,
+0xffffffff, 0x00000000, 0x00000000, 0x00000000,
+0002120,
+};
+asm(".type avx512f_sg_x86_64_D_16x8i4, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_64_D_16x8i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_64_D_16x8i8[] = {
+0x485500eb, 0xc748e589, 0x0001e045, 0xc7480000,
+0x0002f045, 0xc7480000, 0x0002e845, 0xc7480000,
+0x0001f845, 0xe9c50000, 0xf162d276, 0xf6ef08cd,
+0x08edf262, 0xf162ca27, 0xca6f08fd, 0xc193f8c5,
+0xc5c0be0f, 0x89d190f8, 0xe7b8cc45, 0x62000000,
+0x910afdf2, 0x0360350c, 0xf1620010, 0xca7e08fd,
+0x08fdf162, 0x48fd4d7f, 0x850fcaff, 0x000002ec,
+0x16f9e3c4, 0x834801ca, 0x850f01fa, 0x000002dc,
+0x08fdf162, 0x62fe656f, 0x6f08fdf1, 0x90f8c5ca,
+0x00efb8d9, 0xf2620000, 0x0c910bfd, 0x100360e5,
+0xfdf16200, 0x62c97e08, 0x7f08fdf1, 0x8348fd4d,
+0x850f02f9, 0x000002a4, 0x16f9e3c4, 0x834801c9,
+0x850f03f9, 0x00000294, 0x08e5f162, 0x6203f473,
+0x6f08fdf1, 0x90f8c5ca, 0x00f7b8e1, 0xf2620000,
+0x0c910cfd, 0x1003605d, 0xfdf16200, 0x62c97e08,
+0x7f08fdf1, 0x8348fd4d, 0x850f03f9, 0x0000025c,
+0x16f9e3c4, 0x834801c9, 0x850f05f9, 0x0000024c,
+0x08fdf162, 0x48ff6d6f, 0x62f0758b, 0x6f08fdf1,
+0x90f8c5da, 0x00ffb8e9, 0xf2620000, 0x1c910dfd,
+0x100360ed, 0x468d4c00, 0xfdf16201, 0x62d97e08,
+0x7f08fdf1, 0x3949fd5d, 0x0d850fc8, 0x48000002,
+0xc4f84d8b, 0xdf16f9e3, 0x498d4c01, 0xf9394901,
+0x01f6850f, 0xf2620000, 0xca7c08fd, 0x08cdf162,
+0xf162f4fb, 0xfa6f08fd, 0xf190f8c5, 0x08e5f162,
+0x07b8d9fb, 0x62000001, 0x910efdf2, 0x0370f53c,
+0xf3620010, 0xc31f08c5, 0x93f8c500, 0x03fa80d0,
+0x01b6850f, 0xf1620000, 0xf57308d5, 0xfdf16201,
+0xb8ca6f08, 0x00000115, 0x09fdf262, 0x60ad0c91,
+0x62001003, 0x7e08fdf1, 0xfdf162ca, 0xfd4d7f08,
+0x0fd03949, 0x00018385, 0xf9e3c400, 0x4901ca16,
+0x850fd139, 0x00000174, 0x08ddf162, 0x62ff5ddb,
+0xef08d5f1, 0x011eb8ed, 0xe2c40000, 0x62dd2961,
+0xdf08e5f1, 0xedf262d2, 0x62ca2708, 0x9109fdf2,
+0x0360e50c, 0xf1620010, 0xca7e08fd, 0x0fd03949,
+0x00013785, 0xf9e3c400, 0x4901ca16, 0x850fd139,
+0x00000128, 0xd231c031, 0xc5148948, 0x00100480,
+0x48c0ff48, 0x7520f883, 0x45c748ed, 0x000001d0,
+0x45c74800, 0x000002d8, 0xfdf16200, 0xfd0d6f08,
+0x62000001, 0x6f08fdf1, 0x31b8fd65, 0x62000001,
+0x2708f5f2, 0xf5f162c9, 0x62c9ef08, 0xa109fdf2,
+0x04800d24, 0x83480010, 0x0001f23d, 0x850f0100,
+0x000000c8, 0xec3d8348, 0x00000001, 0x000134b8,
+0xb5850f00, 0x8a000000, 0xf162cc45, 0x756f08fd,
+0x92f8c5fd, 0x0138b8f8, 0xf2620000, 0x34a10ffd,
+0x1004800d, 0x3d834800, 0x000001b3, 0x89850f02,
+0x48000000, 0x01ad3d83, 0xb8000000, 0x0000013b,
+0x458a7a75, 0xfdf162cc, 0xfe7d6f08, 0x08fdf162,
+0xc5fd656f, 0xb8d092f8, 0x00000140, 0x0afdf262,
+0x80fd24a1, 0x48001004, 0x01793d83, 0x75010000,
+0x3d83484b, 0x00000177, 0x8a417502, 0xf162cc45,
+0x6d6f08fd, 0xfdf162ff, 0xfd756f08, 0xd892f8c5,
+0x000145b8, 0xfdf26200, 0xed34a10b, 0x00100480,
+0x403d8348, 0x02000001, 0xc0311275, 0x000145ba,
+0x3d834800, 0x00000137, 0xc2450f01, 0x0000c35d,
+0x00000001, 0x00000000, 0x00000002, 0x00000000,
+0x00000003, 0x00000000, 0x00000004, 0x00000000,
+0x00000005, 0x00000000, 0x00000006, 0x00000000,
+0x00000007, 0x00000000, 0x00000008, 0x00000000,
+0x00000009, 0x00000000, 0x0000000a, 0x00000000,
+0x0000000b, 0x00000000, 0x0000000c, 0x00000000,
+0x0000000d, 0x00000000, 0x0000000e, 0x00000000,
+0x0000000f, 0x00000000, 0x00000010, 0x00000000,
+0x00000011, 0x00000000, 0x00000012, 0x00000000,
+0x00000013, 0x00000000, 0x00000014, 0x00000000,
+0x00000015, 0x00000000, 0x00000016, 0x00000000,
+0x00000017, 0x00000000, 0x00000018, 0x00000000,
+0x00000019, 0x00000000, 0x0000001a, 0x00000000,
+0x0000001b, 0x00000000, 0x0000001c, 0x00000000,
+0x0000001d, 0x00000000, 0x0000001e, 0x00000000,
+0x0000001f, 0x00000000, 0x00000020, 0x00000000,
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+0002160,
+};
+asm(".type avx512f_sg_x86_64_D_16x8i8, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_64_D_16x8i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_64_D_16x8f4[] = {
+0x485500eb, 0xc748e589, 0x0001e045, 0xc7480000,
+0x0002f045, 0xc7480000, 0x0002e845, 0xc7480000,
+0x0001f845, 0xf1c50000, 0xf162c976, 0xdbef0865,
+0x0875f262, 0xf1c5c927, 0xf162c976, 0xd128087c,
+0xc193f8c5, 0xc5c0be0f, 0x89d190f8, 0xf262cc45,
+0x14930a7d, 0x1005c01d, 0x7ef16200, 0xdd1d1008,
+0x62000005, 0x29087cf1, 0xf162fd55, 0xd32e087c,
+0x04ae8a0f, 0x850f0000, 0x000004a8, 0x086cf162,
+0x6255e2c6, 0x2e087cf1, 0x958a0fe3, 0x0f000004,
+0x00048f85, 0x6cf16200, 0xc5e21508, 0x62db57e0,
+0x2e087cf1, 0x808a0fe3, 0x0f000004, 0x00047a85,
+0x6cf16200, 0xffd2c608, 0x087cf162, 0x8a0fd32e,
+0x00000467, 0x0461850f, 0xf1620000, 0x5d6f087d,
+0x7cf162fe, 0xc5d12808, 0x62d990f8, 0x930b7df2,
+0x05c09d14, 0xf1620010, 0x152e087c, 0x00000554,
+0x087cf162, 0x0ffd5529, 0x0004358a, 0x2f850f00,
+0x62000004, 0xc6086cf1, 0xf16255e2, 0x252e087c,
+0x00000534, 0x04188a0f, 0x850f0000, 0x00000412,
+0x086cf162, 0xd8c5ea15, 0xf162e457, 0xec2e087c,
+0x04038a0f, 0x850f0000, 0x000003fd, 0x086cf162,
+0x62ffd2c6, 0x2e087cf1, 0xea8a0fd4, 0x0f000003,
+0x0003e485, 0xe5f16200, 0x02f37308, 0x087cf162,
+0xf8c5d128, 0xf262e190, 0x14930c7d, 0x1005c05d,
+0x7cf16200, 0xcd152e08, 0x62000004, 0x29087cf1,
+0x8a0ffd55, 0x000003b8, 0x03b2850f, 0xf1620000,
+0xdac6086c, 0x7cf16255, 0xad1d2e08, 0x0f000004,
+0x00039b8a, 0x95850f00, 0x62000003, 0x15086cf1,
+0x57e0c5e2, 0x7cf162db, 0x0fe32e08, 0x0003868a,
+0x80850f00, 0x62000003, 0xc6086cf1, 0xf162ffd2,
+0xd32e087c, 0x036d8a0f, 0x850f0000, 0x00000367,
+0xf0558b48, 0x087df162, 0xc5ff656f, 0x62e990f8,
+0x930d7df2, 0x05c0a50c, 0x8d480010, 0xf1620142,
+0xe82a08d6, 0x087cf162, 0x62fd4d29, 0x2e087cf1,
+0x378a0fe9, 0x0f000003, 0x00033185, 0x458b4800,
+0x74f162f8, 0x55d1c608, 0x01488d48, 0x08d6f162,
+0xf162e92a, 0xea2e087c, 0x03108a0f, 0x850f0000,
+0x0000030a, 0x0874f162, 0xf162d115, 0xd32e087c,
+0x02ff8a0f, 0x850f0000, 0x000002f9, 0x0874f162,
+0x62ffc9c6, 0x2e087cf1, 0x7cf162cb, 0x0feb2808,
+0x0002e08a, 0xda850f00, 0x62000002, 0xef0865f1,
+0x76f1c5db, 0xe5f162c9, 0xfe5dfb08, 0xf190f8c5,
+0x087cf162, 0xf162d128, 0x7510087e, 0x7df262f4,
+0x9d14930e, 0x001005c8, 0x087ef162, 0x038e1d10,
+0xf1620000, 0xf35c084e, 0x087cf162, 0x8a0ff22e,
+0x00000298, 0x0292850f, 0xf1620000, 0x7510087e,
+0x6cf162f5, 0x55fac608, 0x084ef162, 0xf162f35c,
+0xf72e087c, 0x02728a0f, 0x850f0000, 0x0000026c,
+0x086cf162, 0xf162f215, 0xf52e087c, 0x02618a0f,
+0x850f0000, 0x0000025b, 0x086cf162, 0x62ffd2c6,
+0x2e087cf1, 0x488a0fd5, 0x0f000002, 0x00024285,
+0xddf16200, 0x01f47308, 0x62c2ff48, 0x93097df2,
+0x05c0650c, 0xf1620010, 0xe22a08de, 0x087cf162,
+0x62fd4d29, 0x2e087cf1, 0x1b8a0fe1, 0x0f000002,
+0x00021585, 0xdef16200, 0x62e12a08, 0xc60874f1,
+0xf16255d1, 0xe22e087c, 0x01fc8a0f, 0x850f0000,
+0x000001f6, 0x0874f162, 0xf162e115, 0xe52e087c,
+0x01eb8a0f, 0x850f0000, 0x000001e5, 0x0874f162,
+0x62ffc9c6, 0x2e087cf1, 0xd28a0fcd, 0xb8000001,
+0x00000000, 0x087cf162, 0x850fcd28, 0x000001c1,
+0x608504c7, 0x00001006, 0x48000000, 0x8348c0ff,
+0xec7520f8, 0x0000b848, 0x00003f80, 0x89484000,
+0xf162d045, 0x156f087d, 0x00000274, 0x087cf162,
+0x62fd7d28, 0x27086df2, 0x6df162ca, 0x62d2ef08,
+0xa3097df2, 0x0660153c, 0xf1620010, 0x1d2e087c,
+0x0000025c, 0x016e8a0f, 0x850f0000, 0x00000168,
+0x087cf162, 0x024a0d2e, 0x8a0f0000, 0x0000015f,
+0x0159850f, 0x458a0000, 0x7cf162cc, 0xfd7d2808,
+0xf892f8c5, 0x0f7df262, 0x60153ca3, 0x62001006,
+0x10087ef1, 0x00021715, 0x7cf16200, 0xf1152e08,
+0x0f000001, 0x00012d8a, 0x27850f00, 0x62000001,
+0x2e087cf1, 0x0001fb0d, 0x1e8a0f00, 0x0f000001,
+0x00011885, 0xcc458a00, 0x087df162, 0x62fe7d6f,
+0x28087cf1, 0xf8c5fd6d, 0xf262d092, 0x2ca30a7d,
+0x100660bd, 0x7cf16200, 0xc51d2e08, 0x0f000001,
+0x0000ef8a, 0xe9850f00, 0x62000000, 0x10087ef1,
+0x0001b30d, 0x7cf16200, 0x850d2e08, 0x0f000001,
+0x0000cf8a, 0xc9850f00, 0x8a000000, 0xf162cc45,
+0x756f087d, 0x7cf162ff, 0xfd7d2808, 0xd892f8c5,
+0x0b7df262, 0x60b53ca3, 0x62001006, 0x10087ef1,
+0x00016f0d, 0x7cf16200, 0x450d2e08, 0x0f000001,
+0x0000968a, 0x90850f00, 0x62000000, 0x2e087cf1,
+0x0001531d, 0x808a0f00, 0xb8000000, 0x00000000,
+0x77eb7e74, 0x0000e7b8, 0xb875eb00, 0x000000ea,
+0xefb86eeb, 0xeb000000, 0x00f2b867, 0x60eb0000,
+0x0000f7b8, 0xb859eb00, 0x000000fa, 0xffb852eb,
+0xeb000000, 0x0102b84b, 0x44eb0000, 0x00010bb8,
+0xb83deb00, 0x0000010e, 0x15b836eb, 0xeb000001,
+0x0118b82f, 0x28eb0000, 0x000131b8, 0xb821eb00,
+0x00000134, 0x38b81aeb, 0xeb000001, 0x013bb813,
+0x0ceb0000, 0x000140b8, 0xb805eb00, 0x00000145,
+0x0000c35d, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+0x40a00000, 0x40c00000, 0x40e00000, 0x41000000,
+0x41100000, 0x41200000, 0x41300000, 0x41400000,
+0x41500000, 0x41600000, 0x41700000, 0x41800000,
+0x41880000, 0x41900000, 0x41980000, 0x41a00000,
+0x41a80000, 0x41b00000, 0x41b80000, 0x41c00000,
+0x41c80000, 0x41d00000, 0x41d80000, 0x41e00000,
+0x41e80000, 0x41f00000, 0x41f80000, 0x42000000,
+0x3f800000, 0x40000000, 0x40400000, 0x40a00000,
+0xffffffff, 0x00000000, 0x00000000, 0x00000000,
+0003140,
+};
+asm(".type avx512f_sg_x86_64_D_16x8f4, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_64_D_16x8f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_64_D_16x8f8[] = {
+0x485500eb, 0xc748e589, 0x0001e045, 0xc7480000,
+0x0002f045, 0xc7480000, 0x0002e845, 0xc7480000,
+0x0001f845, 0xc1c50000, 0xf1c5ff76, 0xf162c976,
+0xdbef08e5, 0x08c5f262, 0xf162cf27, 0xd12808fd,
+0xc193f8c5, 0xc5c0be0f, 0x89d190f8, 0xf262cc45,
+0x14930afd, 0x1004601d, 0xfff16200, 0xfd1d1008,
+0x62000004, 0x2908fdf1, 0xf162fd55, 0xd32e08fd,
+0x038d8a0f, 0x850f0000, 0x00000387, 0x08edf162,
+0xf162d215, 0xd32e08fd, 0x03758a0f, 0x850f0000,
+0x0000036f, 0x08fdf162, 0x62fe656f, 0x2808fdf1,
+0x90f8c5d1, 0xfff162d9, 0xb9351008, 0x62000004,
+0x930bfdf2, 0x0460e514, 0xf1620010, 0xd62e08fd,
+0x08fdf162, 0x0ffd5529, 0x00033d8a, 0x37850f00,
+0x62000003, 0x1008fff1, 0x0004932d, 0xedf16200,
+0x62d21508, 0x2e08fdf1, 0x1b8a0fd5, 0x0f000003,
+0x00031585, 0xbdf16200, 0x03f47308, 0x08fdf162,
+0xf8c5d128, 0xb262e190, 0x14930cfd, 0x10046045,
+0xfdf16200, 0x62d52e08, 0x2908fdf1, 0x8a0ffd55,
+0x000002ed, 0x02e7850f, 0xf1620000, 0xd21508ed,
+0x08fdf162, 0x043e152e, 0x8a0f0000, 0x000002d1,
+0x02cb850f, 0x8b480000, 0xf162f04d, 0x6d6f08fd,
+0xfdf162ff, 0xc5d12808, 0x62e990f8, 0x930dfdf2,
+0x0460ed14, 0x8d480010, 0x71620141, 0xc82a08b7,
+0x08fdf162, 0x62fd5529, 0x2e08fd71, 0x958a0fca,
+0x0f000002, 0x00028f85, 0x558b4800, 0xedf162f8,
+0x48d21508, 0x6201428d, 0x2a08bf71, 0xfd7162c0,
+0x0fc22e08, 0x00026f8a, 0x69850f00, 0x62000002,
+0xef08edf1, 0xfd7162d2, 0xc5d12808, 0xb8f190f8,
+0x00000107, 0x08edf162, 0x7262d4fb, 0x14930efd,
+0x100470d5, 0xfff16200, 0xa1151208, 0x62000003,
+0x5808edf1, 0xf362fd55, 0xc21f08ad, 0x93f8c500,
+0xfe8040f0, 0x5a850f03, 0x62000002, 0x7308d5f1,
+0xf26201f5, 0x0c9309fd, 0x100460ad, 0xfd716200,
+0x62c92e08, 0x2908fdf1, 0x8a0ffd4d, 0x000001ff,
+0x01f9850f, 0xf1620000, 0xd11508f5, 0x08fd7162,
+0x8a0fc22e, 0x000001e7, 0x01e1850f, 0xf1620000,
+0x55db08dd, 0xd5f162ff, 0xc4edef08, 0xd52969e2,
+0x08edf162, 0xf262d7df, 0xca2708ed, 0x09fdf262,
+0x60e50c93, 0x62001004, 0x2e08fd71, 0xb38a0fc9,
+0x0f000001, 0x0001ad85, 0xf5f16200, 0x62c91508,
+0x2e08fd71, 0x9b8a0fc1, 0xb8000001, 0x00000000,
+0xc957f1c5, 0x018c850f, 0xc7480000, 0x05a0c504,
+0x00000010, 0xff480000, 0xf88348c0, 0x62eb7520,
+0x1108fff1, 0xf162fa5d, 0x751108ff, 0xfdf162fb,
+0xc9156f08, 0x62000002, 0x2808fdf1, 0xf262fd7d,
+0xca2708ed, 0x08edf162, 0xf262d2ef, 0x3ca309fd,
+0x1005a015, 0xfdf16200, 0xb11d2e08, 0x0f000002,
+0x0001388a, 0x32850f00, 0x62000001, 0x2e08fdf1,
+0x0002a30d, 0x298a0f00, 0x0f000001, 0x00012385,
+0xcc458a00, 0x08fdf162, 0xc5fd7d28, 0x62f892f8,
+0xa30ffdf2, 0x05a0153c, 0xf1620010, 0x352e08fd,
+0x0000026c, 0x01018a0f, 0x850f0000, 0x000000fb,
+0x08fdf162, 0x025e0d2e, 0x8a0f0000, 0x000000f2,
+0x00ec850f, 0x458a0000, 0xfdf162cc, 0xfe756f08,
+0x08fdf162, 0xc5fd7d28, 0x62d092f8, 0xa30afdf2,
+0x05a0f53c, 0xf1620010, 0x1d2e08fd, 0x00000228,
+0x00c38a0f, 0xf1620000, 0x0d1008ff, 0x000001d0,
+0x08fdf162, 0x020e0d2e, 0x850f0000, 0x000000a9,
+0x08fff162, 0x01be1510, 0xf1620000, 0x152e08fd,
+0x000001fc, 0x008f8a0f, 0x850f0000, 0x00000089,
+0x62cc458a, 0x6f08fdf1, 0xf162ff75, 0x5d2808fd,
+0x92f8c5fd, 0xfdf262d8, 0xf51ca30b, 0x001005a0,
+0x08fdf162, 0x01be152e, 0x647a0000, 0xf1626275,
+0x0d2e08fd, 0x000001b8, 0x00b8567a, 0x74000000,
+0xb84deb54, 0x000000e7, 0xefb84beb, 0xeb000000,
+0x00f7b844, 0x3deb0000, 0x0000ffb8, 0xb836eb00,
+0x00000115, 0x1eb82feb, 0xeb000001, 0x0131b828,
+0x21eb0000, 0x000134b8, 0xb81aeb00, 0x00000138,
+0x3bb813eb, 0xeb000001, 0x0140b80c, 0x05eb0000,
+0x000145b8, 0x00c35d00, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40100000,
+0x00000000, 0x40140000, 0x00000000, 0x40180000,
+0x00000000, 0x401c0000, 0x00000000, 0x40200000,
+0x00000000, 0x40220000, 0x00000000, 0x40240000,
+0x00000000, 0x40260000, 0x00000000, 0x40280000,
+0x00000000, 0x402a0000, 0x00000000, 0x402c0000,
+0x00000000, 0x402e0000, 0x00000000, 0x40300000,
+0x00000000, 0x40310000, 0x00000000, 0x40320000,
+0x00000000, 0x40330000, 0x00000000, 0x40340000,
+0x00000000, 0x40350000, 0x00000000, 0x40360000,
+0x00000000, 0x40370000, 0x00000000, 0x40380000,
+0x00000000, 0x40390000, 0x00000000, 0x403a0000,
+0x00000000, 0x403b0000, 0x00000000, 0x403c0000,
+0x00000000, 0x403d0000, 0x00000000, 0x403e0000,
+0x00000000, 0x403f0000, 0x00000000, 0x40400000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40140000,
+0x00000000, 0xbff00000, 0x00000000, 0x00000000,
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+0002640,
+};
+asm(".type avx512f_sg_x86_64_D_16x8f8, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_64_D_16x8f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_64_D_32x4i4[] = {
+0xb85500eb, 0x00000001, 0x000009b9, 0xe5894800,
+0xe0e48348, 0x28ec8348, 0x4489ca89, 0xc229e484,
+0x04845489, 0x48c0ff48, 0x7509f883, 0x76f5c5eb,
+0x65f162c9, 0x48dbef08, 0xc8244c8d, 0x2875f262,
+0xf162c927, 0xd16f287d, 0xc193f8c5, 0xc5c0be0f,
+0x89d190f8, 0x48a42444, 0xa824448d, 0x48c28948,
+0xf262c689, 0x14902a7d, 0x1004401d, 0x7df16200,
+0x24947f28, 0xffffffa8, 0x0f013a83, 0x00036d85,
+0xc2834800, 0xca394804, 0xf162ee75, 0xa46f287d,
+0xffffe824, 0x7df162ff, 0xc5d16f28, 0x31d990f8,
+0x7df262d2, 0xa514902b, 0x00100440, 0x287df162,
+0xa824947f, 0x8dffffff, 0x3c39027a, 0x32850f90,
+0x48000003, 0x8348c2ff, 0xeb7508fa, 0x2865f162,
+0x6202f472, 0x6f287df1, 0x90f8c5d1, 0x0003bae1,
+0xf2620000, 0x14902c7d, 0x1004405d, 0x7df16200,
+0x24947f28, 0xffffffa8, 0x850f1039, 0x000002fc,
+0x4802c283, 0x8304c083, 0xec7513fa, 0x287df162,
+0x0824946f, 0x62000000, 0x6f287df1, 0x90f8c5d9,
+0x62c031e9, 0x902d7df2, 0x0440951c, 0xf1620010,
+0x9c7f287d, 0xffffa824, 0x047c8bff, 0x247c8908,
+0x01578da0, 0x0f061439, 0x0002b685, 0xc0834800,
+0xf8834804, 0x62e27520, 0xef0865f1, 0x0001b8db,
+0xf8c50000, 0xf162f190, 0x9cfa2865, 0xffffe824,
+0x7df162ff, 0x24b46f28, 0xffffffa8, 0x287df162,
+0xf262e96f, 0x2c902e7d, 0x1004609d, 0x7df26200,
+0xb8d87c28, 0x00000107, 0x284df162, 0xf362dbfa,
+0xc31f2855, 0x93f8c500, 0x0fc2fed0, 0x00028185,
+0x6df16200, 0x01f27228, 0x287df162, 0xc031d96f,
+0x297df262, 0x40551c90, 0x62001004, 0x7f287df1,
+0xffa8249c, 0x7c8bffff, 0x7c890804, 0x578da024,
+0x06143901, 0x0220850f, 0x83480000, 0x834804c0,
+0xe27520f8, 0x285df162, 0x082494db, 0x62000000,
+0xef0855f1, 0x0001b8ed, 0x09be0000, 0xc5000000,
+0x62d576ed, 0xdf286df1, 0x75f262c9, 0x62c92728,
+0x90297df2, 0x0440a51c, 0xf1620010, 0x9c7f287d,
+0xffffc824, 0x8bf289ff, 0x29fc817c, 0x74c285c2,
+0x84548b06, 0x8b04ebe4, 0x89048454, 0xffa02454,
+0xc0ff48c2, 0x850fd739, 0x000001b5, 0x09f88348,
+0xc031d375, 0x1489d231, 0x10056085, 0xc0ff4800,
+0x40f88348, 0xb848ee75, 0x00000001, 0x00000002,
+0x24448948, 0x03b848a8, 0x04000000, 0x48000000,
+0xb0244489, 0x0005b848, 0x00060000, 0x89480000,
+0x48b82444, 0x000007b8, 0x00000800, 0x44894800,
+0xf162c024, 0x0d6f287d, 0x00000284, 0x287df162,
+0xa824bc6f, 0xb8ffffff, 0x00000131, 0x2875f262,
+0xf162c927, 0xc9ef0875, 0x297df262, 0x600d3ca0,
+0x83001005, 0x0002763d, 0x850f0100, 0x00000142,
+0x000001b8, 0x853c8300, 0x00100560, 0x15850f00,
+0x48000001, 0x8348c0ff, 0xe97508f8, 0xa424448a,
+0x287df162, 0xa824b46f, 0x62ffffff, 0xef0875f1,
+0x92f8c5c9, 0x0138b8f8, 0xf2620000, 0x34a02f7d,
+0x1005600d, 0x243d8300, 0x08000002, 0x00f0850f,
+0x01ba0000, 0x8b000000, 0x05609504, 0xc0850010,
+0x00c9850f, 0xff480000, 0xfa8348c2, 0x8ae87508,
+0x62a4244c, 0x6f287df1, 0xffe824bc, 0x01baffff,
+0x62000000, 0x6f287df1, 0xffa824b4, 0xf8c5ffff,
+0xf262d192, 0x34a02a7d, 0x100560bd, 0x95143900,
+0x00100560, 0x008c850f, 0xff480000, 0xfa8348c2,
+0x8aea7509, 0x62a4244c, 0x6f287df1, 0x000824bc,
+0x01ba0000, 0x62000000, 0x6f287df1, 0xffa824a4,
+0xf8c5ffff, 0x09b9d992, 0x62000000, 0xa02b7df2,
+0x0560bd24, 0xce890010, 0x3439d629, 0x10056095,
+0x484a7500, 0x8348c2ff, 0xea7509fa, 0xe7b844eb,
+0xeb000000, 0x00efb83d, 0x36eb0000, 0x0000f7b8,
+0xb82feb00, 0x000000ff, 0x15b828eb, 0xeb000001,
+0x011eb821, 0x1aeb0000, 0x000134b8, 0xb813eb00,
+0x0000013b, 0x40b80ceb, 0xeb000001, 0x0145b805,
+0xc3c90000, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000002, 0x00000003, 0x00000004,
+0x00000005, 0x00000006, 0x00000007, 0x00000008,
+0x00000009, 0x0000000a, 0x0000000b, 0x0000000c,
+0x0000000d, 0x0000000e, 0x0000000f, 0x00000010,
+0x00000011, 0x00000012, 0x00000013, 0x00000014,
+0x00000015, 0x00000016, 0x00000017, 0x00000018,
+0x00000019, 0x0000001a, 0x0000001b, 0x0000001c,
+0x0000001d, 0x0000001e, 0x0000001f, 0x00000020,
+0x00000021, 0x00000022, 0x00000023, 0x00000024,
+0x00000025, 0x00000026, 0x00000027, 0x00000028,
+0x00000029, 0x0000002a, 0x0000002b, 0x0000002c,
+0x0000002d, 0x0000002e, 0x0000002f, 0x00000030,
+0x00000031, 0x00000032, 0x00000033, 0x00000034,
+0x00000035, 0x00000036, 0x00000037, 0x00000038,
+0x00000039, 0x0000003a, 0x0000003b, 0x0000003c,
+0x0000003d, 0x0000003e, 0x0000003f, 0x00000040,
+0xffffffff, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0002540,
+};
+asm(".type avx512f_sg_x86_64_D_32x4i4, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_64_D_32x4i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_64_D_32x4i8[] = {
+0xb84800eb, 0x00000001, 0x00000002, 0xe5894855,
+0xe0e48348, 0x24448948, 0x03b848c0, 0x04000000,
+0x48000000, 0xc8244489, 0x000001b8, 0xe0c148c0,
+0x44894802, 0x01b8d024, 0x48800000, 0x8948c001,
+0xc5d82444, 0x62c976f5, 0xef08e5f1, 0xe28948db,
+0x28f5f262, 0xf162c927, 0xd16f28fd, 0xc193f8c5,
+0xc5c0be0f, 0x89d190f8, 0x48bc2444, 0xe024448d,
+0x62c18948, 0x902afdf2, 0x04001d14, 0xf1620010,
+0x547f28fd, 0x8348ff24, 0x850f0138, 0x0000034a,
+0x08c08348, 0x75c23948, 0xfdf162ed, 0xc5d16f28,
+0xb8d990f8, 0x000000ef, 0x08fdf162, 0xfc245c6f,
+0x2bfdf262, 0x00dd1490, 0x62001004, 0x7e08fdf1,
+0xfdf162d2, 0x24547f28, 0xfa8348ff, 0x21850f02,
+0xc4000003, 0xd216f9e3, 0xfa834801, 0x11850f03,
+0x62000003, 0x39287df3, 0xf36201d4, 0xd23928fd,
+0xfdf16201, 0x48d67e08, 0x0f04fe83, 0x0002f385,
+0xf9e3c400, 0x4801e216, 0x0f05fa83, 0x0002e385,
+0x65f16200, 0x03f37208, 0x28fdf162, 0xf8c5d16f,
+0xf7b8e190, 0x62000000, 0x902cfdf2, 0x04005d14,
+0xf1620010, 0xd27e08fd, 0x28fdf162, 0xff24547f,
+0x03fa8348, 0x02aa850f, 0xe3c40000, 0x01d216f9,
+0x05fa8348, 0x029a850f, 0xf3620000, 0xd339287d,
+0xfdf36201, 0x01d23928, 0x08fdf162, 0x8348d77e,
+0x850f07ff, 0x0000027c, 0x16f9e3c4, 0x834801da,
+0x850f09fa, 0x0000026c, 0x08fdf162, 0xfd24546f,
+0x28fdf162, 0xf8c5d96f, 0xc031e990, 0x2dfdf262,
+0x00d51c90, 0x62001004, 0x7f28fdf1, 0x8bff245c,
+0x8dd08474, 0x74890156, 0x6348b824, 0x143948d2,
+0x1a850fc1, 0x48000002, 0x8348c0ff, 0xdf7504f8,
+0x08e5f162, 0x01b8dbef, 0xc5000000, 0x62f190f8,
+0xfa0865f1, 0x62fc245c, 0x6f28fdf1, 0x62ff246c,
+0x6f28fdf1, 0xfdf262e1, 0xdd24902e, 0x00100420,
+0x28fdf262, 0x07b8d87c, 0x62000001, 0xfb28d5f1,
+0xddf362db, 0x00c31f28, 0xd093f8c5, 0x0f0ffa80,
+0x0001cf85, 0x6df16200, 0x01f27208, 0xf262c031,
+0x0c9029fd, 0x10040095, 0xfdf16200, 0x244c7f28,
+0x84748bff, 0x01568dd0, 0xb8247489, 0x48d26348,
+0x0fc11439, 0x00018f85, 0xc0ff4800, 0x04f88348,
+0xc031df75, 0x8948d231, 0x0620c514, 0xff480010,
+0xf88348c0, 0x48ed7540, 0xe02444c7, 0x00000001,
+0x2444c748, 0x000002e8, 0x44c74800, 0x0003f024,
+0xc7480000, 0x04f82444, 0x62000000, 0x6f28fdf1,
+0x00035b0d, 0xfdf16200, 0x24746f28, 0x0131b8ff,
+0xf2620000, 0xc92728f5, 0x08f5f162, 0xf262c9ef,
+0x34a029fd, 0x1006200d, 0x3d834800, 0x0000034f,
+0x1d850f01, 0x48000001, 0x034a158b, 0x0b480000,
+0x00034b15, 0x0134b800, 0x0b480000, 0x00034715,
+0xfd850f00, 0x8a000000, 0x62bc2444, 0x6f28fdf1,
+0xc5ff247c, 0xb8f892f8, 0x00000138, 0x2ffdf262,
+0x200d3ca0, 0x48001006, 0x03013d83, 0x0f040000,
+0x0000cf85, 0x158b4800, 0x000002fc, 0xfd150b48,
+0xb8000002, 0x0000013b, 0xf9150b48, 0x0f000002,
+0x0000af85, 0x24448a00, 0xfdf162bc, 0x246c6f08,
+0xfdf162fc, 0x24746f28, 0x92f8c5ff, 0x0001b8d0,
+0xf2620000, 0x34a02afd, 0x100620ed, 0x04394800,
+0x100620c5, 0x48787500, 0x8348c0ff, 0xed7505f8,
+0xbc24448a, 0x08fdf162, 0xfd247c6f, 0x28fdf162,
+0xff246c6f, 0xd892f8c5, 0x000145b8, 0xfdf26200,
+0xfd2ca02b, 0x00100620, 0x783d8348, 0x04000002,
+0x83484275, 0x0002763d, 0x38750300, 0x743d8348,
+0x02000002, 0xc0312e75, 0x000145ba, 0x3d834800,
+0x0000026b, 0xc2450f01, 0xe7b81aeb, 0xeb000000,
+0x00ffb813, 0x0ceb0000, 0x000115b8, 0xb805eb00,
+0x00000140, 0x0000c3c9, 0x00000000, 0x00000000,
+0x00000001, 0x00000000, 0x00000002, 0x00000000,
+0x00000003, 0x00000000, 0x00000004, 0x00000000,
+0x00000005, 0x00000000, 0x00000006, 0x00000000,
+0x00000007, 0x00000000, 0x00000008, 0x00000000,
+0x00000009, 0x00000000, 0x0000000a, 0x00000000,
+0x0000000b, 0x00000000, 0x0000000c, 0x00000000,
+0x0000000d, 0x00000000, 0x0000000e, 0x00000000,
+0x0000000f, 0x00000000, 0x00000010, 0x00000000,
+0x00000011, 0x00000000, 0x00000012, 0x00000000,
+0x00000013, 0x00000000, 0x00000014, 0x00000000,
+0x00000015, 0x00000000, 0x00000016, 0x00000000,
+0x00000017, 0x00000000, 0x00000018, 0x00000000,
+0x00000019, 0x00000000, 0x0000001a, 0x00000000,
+0x0000001b, 0x00000000, 0x0000001c, 0x00000000,
+0x0000001d, 0x00000000, 0x0000001e, 0x00000000,
+0x0000001f, 0x00000000, 0x00000020, 0x00000000,
+0x00000021, 0x00000000, 0x00000022, 0x00000000,
+0x00000023, 0x00000000, 0x00000024, 0x00000000,
+0x00000025, 0x00000000, 0x00000026, 0x00000000,
+0x00000027, 0x00000000, 0x00000028, 0x00000000,
+0x00000029, 0x00000000, 0x0000002a, 0x00000000,
+0x0000002b, 0x00000000, 0x0000002c, 0x00000000,
+0x0000002d, 0x00000000, 0x0000002e, 0x00000000,
+0x0000002f, 0x00000000, 0x00000030, 0x00000000,
+0x00000031, 0x00000000, 0x00000032, 0x00000000,
+0x00000033, 0x00000000, 0x00000034, 0x00000000,
+0x00000035, 0x00000000, 0x00000036, 0x00000000,
+0x00000037, 0x00000000, 0x00000038, 0x00000000,
+0x00000039, 0x00000000, 0x0000003a, 0x00000000,
+0x0000003b, 0x00000000, 0x0000003c, 0x00000000,
+0x0000003d, 0x00000000, 0x0000003e, 0x00000000,
+0x0000003f, 0x00000000, 0x00000040, 0x00000000,
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0003040,
+};
+asm(".type avx512f_sg_x86_64_D_32x4i8, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_64_D_32x4i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_64_D_32x4f4[] = {
+0xb85500eb, 0x00000001, 0x000009b9, 0xe5894800,
+0xe0e48348, 0x28ec8348, 0x4489ca89, 0xc229e484,
+0x04845489, 0x48c0ff48, 0x7509f883, 0x76ddc5eb,
+0x76f5c5e4, 0x65f162c9, 0x62dbef08, 0x10087ef1,
+0x0005bb35, 0x5df26200, 0x62cc2728, 0x28287cf1,
+0x4c8d48d1, 0xf8c5c824, 0xbe0fc193, 0x90f8c5c0,
+0x244489d1, 0x448d48a4, 0x8948a824, 0xc68948c2,
+0x2a7df262, 0x001d1492, 0x62001005, 0x29287cf1,
+0xffa82494, 0xf162ffff, 0x322e087c, 0x04068a0f,
+0x850f0000, 0x00000400, 0x04c28348, 0x75ca3948,
+0x7df162e5, 0x249c6f28, 0xffffffe8, 0x287cf162,
+0xf8c5d128, 0xd231d990, 0x2b7df262, 0x009d1492,
+0x62001005, 0x29287cf1, 0xffa82494, 0x7a8dffff,
+0x6ef16202, 0x62d72a08, 0x2e087cf1, 0x8a0f9014,
+0x000003bb, 0x03b5850f, 0xff480000, 0xfa8348c2,
+0x62db7508, 0x722855f1, 0xf16202f3, 0xd128287c,
+0xe190f8c5, 0x000003ba, 0x7df26200, 0x6d14922c,
+0x00100500, 0x287cf162, 0xa8249429, 0x62ffffff,
+0x2a086ef1, 0x7cf162d2, 0x0f102e08, 0x0003758a,
+0x6f850f00, 0x83000003, 0x834802c2, 0xfa8304c0,
+0x62dc7513, 0x6f287df1, 0x00082494, 0xf1620000,
+0xe928287c, 0xe990f8c5, 0xf262c031, 0x2c922d7d,
+0x10050095, 0x7cf16200, 0x24ac2928, 0xffffffa8,
+0x08047c8b, 0x8901578d, 0x62a0247c, 0x2a0856f1,
+0x7cf162ea, 0x062c2e08, 0x031f8a0f, 0x850f0000,
+0x00000319, 0x04c08348, 0x20f88348, 0xf162d275,
+0xedef0855, 0x287cf162, 0xf8c5f928, 0xf162f190,
+0xacfa2855, 0xffffe824, 0x0107b8ff, 0xf2620000,
+0x3c922e7d, 0x100520ad, 0x7df26200, 0x312d1828,
+0x62000004, 0x582854f1, 0xffa824ac, 0xf362ffff,
+0xc51f2845, 0x93f8c500, 0x0fc2fed0, 0x0002f985,
+0x6df16200, 0x01f27228, 0xf262c031, 0x0c92297d,
+0x10050055, 0x7cf16200, 0x248c2928, 0xffffffa8,
+0x08047c8b, 0x8901578d, 0x62a0247c, 0x2a086ef1,
+0x7cf162d2, 0x06142e08, 0x02868a0f, 0x850f0000,
+0x00000280, 0x04c08348, 0x20f88348, 0xf162d275,
+0x94db2865, 0x00000824, 0x55f16200, 0xb8edef08,
+0x00000001, 0x000009be, 0x76edc500, 0x6df162d5,
+0x62d4df28, 0x27286df2, 0x7df262ca, 0x9d0c9229,
+0x00100500, 0x287cf162, 0xc8248c29, 0x89ffffff,
+0x7ef162f2, 0x81541008, 0x85c229ff, 0x8b0674c2,
+0xebe4847c, 0x847c8b04, 0x01578d04, 0x89c0ff48,
+0x62a0247c, 0x2a0876f1, 0x7cf162ca, 0x0fd12e08,
+0x0002068a, 0x00850f00, 0x48000002, 0x7509f883,
+0xc7c031be, 0x06408504, 0x00000010, 0xff480000,
+0xf88348c0, 0x48ec7540, 0x800000b8, 0x0000003f,
+0x44894840, 0xb848a824, 0x40400000, 0x40800000,
+0x24448948, 0x00b848b0, 0x0040a000, 0x4840c000,
+0xb8244489, 0x0000b848, 0x000040e0, 0x89484100,
+0x62c02444, 0x6f287df1, 0x0003030d, 0x7cf16200,
+0x24a42828, 0xffffffa8, 0x2875f262, 0xf162c927,
+0xc9ef0875, 0x297df262, 0x400d24a2, 0x62001006,
+0x2e087cf1, 0x0002f735, 0x738a0f00, 0xb8000001,
+0x00000001, 0xc957f0c5, 0x0164850f, 0xf1620000,
+0x0c2e087c, 0x10064085, 0x5a8a0f00, 0x0f000001,
+0x00015485, 0xc0ff4800, 0x08f88348, 0x448ae075,
+0xf162a424, 0xb428287c, 0xffffa824, 0x75f162ff,
+0xc5c9ef08, 0x62f892f8, 0xa22f7df2, 0x06400d34,
+0xf1620010, 0x0d10087e, 0x00000294, 0x087cf162,
+0x02520d2e, 0x8a0f0000, 0x00000114, 0x000001b8,
+0x57f0c500, 0x05850fc9, 0x62000001, 0x2e087cf1,
+0x0640850c, 0x8a0f0010, 0x000000fb, 0x00f5850f,
+0xff480000, 0xf88348c0, 0x8ae07508, 0x62a42444,
+0x6f287df1, 0xffe824a4, 0xf162ffff, 0xb428287c,
+0xffffa824, 0x92f8c5ff, 0x0001b8d0, 0xf2620000,
+0x34a22a7d, 0x100640a5, 0x76f16200, 0x62c82a08,
+0x2e087cf1, 0x0640850c, 0x8a0f0010, 0x000000ae,
+0x00a8850f, 0xff480000, 0xf88348c0, 0x8ada7509,
+0x62a42444, 0x6f287df1, 0x000824bc, 0x09ba0000,
+0x62000000, 0x28287cf1, 0xffa8249c, 0xf8c5ffff,
+0x01b8d892, 0x62000000, 0xa22b7df2, 0x0640bd1c,
+0xd1890010, 0xf162c129, 0xc92a0876, 0x087cf162,
+0x40850c2e, 0x7a001006, 0x485a755c, 0x8348c0ff,
+0xde7509f8, 0x52ebc031, 0x0000e7b8, 0xb84beb00,
+0x000000ef, 0xf7b844eb, 0xeb000000, 0x00ffb83d,
+0x36eb0000, 0x000115b8, 0xb82feb00, 0x0000011e,
+0x31b828eb, 0xeb000001, 0x0134b821, 0x1aeb0000,
+0x000138b8, 0xb813eb00, 0x0000013b, 0x40b80ceb,
+0xeb000001, 0x0145b805, 0xc3c90000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+0x40a00000, 0x40c00000, 0x40e00000, 0x41000000,
+0x41100000, 0x41200000, 0x41300000, 0x41400000,
+0x41500000, 0x41600000, 0x41700000, 0x41800000,
+0x41880000, 0x41900000, 0x41980000, 0x41a00000,
+0x41a80000, 0x41b00000, 0x41b80000, 0x41c00000,
+0x41c80000, 0x41d00000, 0x41d80000, 0x41e00000,
+0x41e80000, 0x41f00000, 0x41f80000, 0x42000000,
+0x42040000, 0x42080000, 0x420c0000, 0x42100000,
+0x42140000, 0x42180000, 0x421c0000, 0x42200000,
+0x42240000, 0x42280000, 0x422c0000, 0x42300000,
+0x42340000, 0x42380000, 0x423c0000, 0x42400000,
+0x42440000, 0x42480000, 0x424c0000, 0x42500000,
+0x42540000, 0x42580000, 0x425c0000, 0x42600000,
+0x42640000, 0x42680000, 0x426c0000, 0x42700000,
+0x42740000, 0x42780000, 0x427c0000, 0x42800000,
+0x3f800000, 0xbf800000, 0x41000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0xffffffff, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0003100,
+};
+asm(".type avx512f_sg_x86_64_D_32x4f4, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_64_D_32x4f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_64_D_32x4f8[] = {
+0xb84800eb, 0x00000001, 0x00000002, 0xe5894855,
+0xe0e48348, 0x24448948, 0x03b848c0, 0x04000000,
+0x48000000, 0xc8244489, 0x000001b8, 0xe0c148c0,
+0x44894802, 0x01b8d024, 0x48800000, 0x8948c001,
+0xc5d82444, 0x62c976f5, 0xef08e5f1, 0xe28948db,
+0x08fff162, 0x07262d10, 0xf2620000, 0xc92728f5,
+0xc976f5c5, 0x28fdf162, 0xf8c5d128, 0xbe0fc193,
+0x90f8c5c0, 0x244489d1, 0x448d48bc, 0x8948e024,
+0xfdf262c1, 0x1d14922a, 0x00100580, 0x28fdf162,
+0xff245429, 0x08fdf162, 0x8a0f282e, 0x00000479,
+0x0473850f, 0x83480000, 0x394808c0, 0x62e575c2,
+0x6f08fdf1, 0x62fc245c, 0x2828fdf1, 0x90f8c5d1,
+0xff7162d9, 0xbd051008, 0x62000006, 0x922bfdf2,
+0x0580dd14, 0xd1620010, 0xd02e08fd, 0x28fdf162,
+0xff245429, 0x04368a0f, 0x850f0000, 0x00000430,
+0x08fff162, 0x06963510, 0xf1620000, 0xe21508ed,
+0x08fdf162, 0x8a0fe62e, 0x00000414, 0x040e850f,
+0xf1620000, 0x251008ff, 0x0000067c, 0x287df362,
+0x6201d719, 0x1928fdf3, 0xf16201d2, 0xd42e08fd,
+0x03ea8a0f, 0x850f0000, 0x000003e4, 0x08ff7162,
+0x065a0d10, 0xf1620000, 0xff1508c5, 0x08fdd162,
+0x8a0ff92e, 0x000003c8, 0x03c2850f, 0xf1620000,
+0xf3720865, 0xfdf16203, 0xc5d12828, 0x62e190f8,
+0x922cfdf2, 0x05805d14, 0xf1620010, 0xd62e08fd,
+0x28fdf162, 0xff245429, 0x03998a0f, 0x850f0000,
+0x00000393, 0x08edf162, 0xd162da15, 0xd92e08fd,
+0x03818a0f, 0x850f0000, 0x0000037b, 0x287df362,
+0x6201d319, 0x1928fdf3, 0xf16201d2, 0x152e08fd,
+0x000005e4, 0x035d8a0f, 0x850f0000, 0x00000357,
+0x08e5f162, 0xf162db15, 0x1d2e08fd, 0x000005d0,
+0x03418a0f, 0x850f0000, 0x0000033b, 0x08fdf162,
+0xfd24546f, 0x28fdf162, 0xf8c5d928, 0xc031e990,
+0x2dfdf262, 0x80d51c92, 0x62001005, 0x2928fdf1,
+0x8bff245c, 0x8dd08474, 0x74890156, 0xf162b824,
+0xda2a0867, 0x08fdf162, 0x0fc11c2e, 0x0002fd8a,
+0xf7850f00, 0x48000002, 0x8348c0ff, 0xd37504f8,
+0x08e5f162, 0xf162dbef, 0xf92828fd, 0xf190f8c5,
+0x0865f162, 0xfc245cfa, 0x000107b8, 0xfdf26200,
+0xdd3c922e, 0x001005a0, 0x28fdf262, 0x05461d19,
+0xf1620000, 0x5c5828e5, 0xf362ff24, 0xc31f28c5,
+0x93f8c500, 0x0ffa80d0, 0x02d6850f, 0xf1620000,
+0xf272086d, 0x62c03101, 0x9229fdf2, 0x0580950c,
+0xf1620010, 0x4c2928fd, 0x748bff24, 0x568dd084,
+0x24748901, 0x77f162b8, 0x62ca2a08, 0x2e08fdf1,
+0x8a0fc10c, 0x0000026d, 0x0267850f, 0xff480000,
+0xf88348c0, 0x31d37504, 0x57f1c5c0, 0x04c748c9,
+0x1007e0c5, 0x00000000, 0xc0ff4800, 0x40f88348,
+0xf162eb75, 0x6c1108ff, 0x7162fc24, 0x441108ff,
+0xf162fd24, 0x741108ff, 0xf162fe24, 0x641108ff,
+0xf162ff24, 0x156f28fd, 0x000004a4, 0x28fdf162,
+0xff247428, 0x28edf262, 0xf162ca27, 0xd2ef08ed,
+0x29fdf262, 0xe01534a2, 0x62001007, 0x2e08fdf1,
+0x00049b2d, 0xf18a0f00, 0x0f000001, 0x0001eb85,
+0xfdf16200, 0x8d0d2e08, 0x0f000004, 0x0001e28a,
+0xdc850f00, 0x62000001, 0x2e08fdf1, 0x00047f0d,
+0xcc8a0f00, 0x0f000001, 0x0001c685, 0xfdf16200,
+0x710d2e08, 0x0f000004, 0x0001b68a, 0xb0850f00,
+0x8a000001, 0x62bc2444, 0x2828fdf1, 0xc5ff246c,
+0x62f892f8, 0xa22ffdf2, 0x07e0152c, 0xf1620010,
+0x252e08fd, 0x00000428, 0x018c8a0f, 0xf1620000,
+0x0d1008ff, 0x000003d0, 0x08fdf162, 0x040e0d2e,
+0x850f0000, 0x00000172, 0xd257e9c5, 0x08fdf162,
+0x0402152e, 0x8a0f0000, 0x00000165, 0x015f850f,
+0xf1620000, 0x152e08fd, 0x000003f4, 0x014f8a0f,
+0x850f0000, 0x00000149, 0x08fdf162, 0x03e6152e,
+0x8a0f0000, 0x00000139, 0x0133850f, 0x448a0000,
+0xf162bc24, 0x6c6f08fd, 0xf162fc24, 0x742828fd,
+0xf162ff24, 0x151008ff, 0x00000344, 0xd092f8c5,
+0x2afdf262, 0xe0ed34a2, 0x62001007, 0x2e08fdf1,
+0x00039315, 0xfd8a0f00, 0x0f000000, 0x0000f785,
+0xfff16200, 0x1d1d1008, 0x62000003, 0x2e08fdf1,
+0x00037b1d, 0xdd8a0f00, 0x0f000000, 0x0000d785,
+0xfff16200, 0x05251008, 0x62000003, 0x2e08fdf1,
+0x00036325, 0xbd8a0f00, 0x0f000000, 0x0000b785,
+0xfdf16200, 0x550d2e08, 0x0f000003, 0x0000a78a,
+0xa1850f00, 0x8a000000, 0x62bc2444, 0x6f08fdf1,
+0x62fd246c, 0x2828fdf1, 0xc5ff2474, 0x62d892f8,
+0xa22bfdf2, 0x07e0ed34, 0xf1620010, 0x0d2e08fd,
+0x00000304, 0x7775797a, 0x08fdf162, 0x02fe252e,
+0x6b7a0000, 0xf1626975, 0x1d2e08fd, 0x000002f8,
+0x5b755d7a, 0x08fdf162, 0x02f2152e, 0x4f7a0000,
+0x000000b8, 0xeb4d7400, 0x00e7b846, 0x44eb0000,
+0x0000efb8, 0xb83deb00, 0x000000f7, 0xffb836eb,
+0xeb000000, 0x0115b82f, 0x28eb0000, 0x000131b8,
+0xb821eb00, 0x00000134, 0x38b81aeb, 0xeb000001,
+0x013bb813, 0x0ceb0000, 0x000140b8, 0xb805eb00,
+0x00000145, 0x0000c3c9, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40100000,
+0x00000000, 0x40140000, 0x00000000, 0x40180000,
+0x00000000, 0x401c0000, 0x00000000, 0x40200000,
+0x00000000, 0x40220000, 0x00000000, 0x40240000,
+0x00000000, 0x40260000, 0x00000000, 0x40280000,
+0x00000000, 0x402a0000, 0x00000000, 0x402c0000,
+0x00000000, 0x402e0000, 0x00000000, 0x40300000,
+0x00000000, 0x40310000, 0x00000000, 0x40320000,
+0x00000000, 0x40330000, 0x00000000, 0x40340000,
+0x00000000, 0x40350000, 0x00000000, 0x40360000,
+0x00000000, 0x40370000, 0x00000000, 0x40380000,
+0x00000000, 0x40390000, 0x00000000, 0x403a0000,
+0x00000000, 0x403b0000, 0x00000000, 0x403c0000,
+0x00000000, 0x403d0000, 0x00000000, 0x403e0000,
+0x00000000, 0x403f0000, 0x00000000, 0x40400000,
+0x00000000, 0x40408000, 0x00000000, 0x40410000,
+0x00000000, 0x40418000, 0x00000000, 0x40420000,
+0x00000000, 0x40428000, 0x00000000, 0x40430000,
+0x00000000, 0x40438000, 0x00000000, 0x40440000,
+0x00000000, 0x40448000, 0x00000000, 0x40450000,
+0x00000000, 0x40458000, 0x00000000, 0x40460000,
+0x00000000, 0x40468000, 0x00000000, 0x40470000,
+0x00000000, 0x40478000, 0x00000000, 0x40480000,
+0x00000000, 0x40488000, 0x00000000, 0x40490000,
+0x00000000, 0x40498000, 0x00000000, 0x404a0000,
+0x00000000, 0x404a8000, 0x00000000, 0x404b0000,
+0x00000000, 0x404b8000, 0x00000000, 0x404c0000,
+0x00000000, 0x404c8000, 0x00000000, 0x404d0000,
+0x00000000, 0x404d8000, 0x00000000, 0x404e0000,
+0x00000000, 0x404e8000, 0x00000000, 0x404f0000,
+0x00000000, 0x404f8000, 0x00000000, 0x40500000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40100000,
+0x00000000, 0x40140000, 0x00000000, 0x401c0000,
+0x00000000, 0x40220000, 0x00000000, 0xbff00000,
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0003740,
+};
+asm(".type avx512f_sg_x86_64_D_32x4f8, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_64_D_32x4f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_64_D_32x8i4[] = {
+0x485500eb, 0x8348e589, 0xc748e0e4, 0x01c02444,
+0x48000000, 0xe02444c7, 0x00000004, 0x2444c748,
+0x000002c8, 0x44c74800, 0x0003e824, 0xc7480000,
+0x03d02444, 0x48000000, 0xf02444c7, 0x00000002,
+0x2444c748, 0x000004d8, 0x44c74800, 0x0001f824,
+0xf1c50000, 0xf162c976, 0xdbef0865, 0x24548d48,
+0x75f262c0, 0x62c92708, 0x6f087df1, 0x93f8c5d1,
+0xc0be0fc1, 0xd190f8c5, 0xac244489, 0x24448d48,
+0xc18948b0, 0x2a7df262, 0xe01d1491, 0x62001003,
+0x7f087df1, 0x83fb2454, 0x850f0138, 0x0000030b,
+0x04c08348, 0x75c23948, 0x7df162ee, 0xc5d16f08,
+0xb8d990f8, 0x000000ef, 0x287df162, 0xfe245c6f,
+0x2b7df262, 0xe09d1491, 0x62001003, 0x7e087df1,
+0x7df162d2, 0x24547f08, 0x02fa83fb, 0x02f1850f,
+0xe3c40000, 0x01d21679, 0x0f03fa83, 0x0002e285,
+0x79e3c400, 0x8302d216, 0x850f04fa, 0x000002d3,
+0x1679e3c4, 0xfa8303d2, 0xc4850f05, 0x62000002,
+0x7328e5f1, 0xf16202f3, 0xd16f087d, 0xe190f8c5,
+0x0000f7b8, 0x7df26200, 0x5d14912c, 0x001003e0,
+0x087df162, 0xf162d27e, 0x547f087d, 0xfa83fb24,
+0x8c850f03, 0xc4000002, 0xd21679e3, 0x05fa8301,
+0x027d850f, 0xe3c40000, 0x02d21679, 0x0f07fa83,
+0x00026e85, 0x79e3c400, 0x8303d216, 0x850f09fa,
+0x0000025f, 0x287df162, 0xff24546f, 0x087df162,
+0xf8c5d96f, 0xc031e990, 0x2d7df262, 0xe0951c91,
+0x62001003, 0x7f087df1, 0x48fb245c, 0xe0c47c8b,
+0x81346348, 0x01578d48, 0x247c8948, 0xd63948a0,
+0x01fc850f, 0xff480000, 0xf88348c0, 0x62dc7504,
+0xef085df1, 0xddf162e4, 0x2464fb28, 0x7df162fe,
+0x62d96f08, 0x6f087df1, 0xc5fb2474, 0xb8f190f8,
+0x00000107, 0x2e7df262, 0xf0a51c91, 0x62001003,
+0xfa084df1, 0x0002e725, 0x65f36200, 0x00c41f08,
+0xd093f8c5, 0x0f0ffa80, 0x0001c685, 0xedf16200,
+0x01f27328, 0x087df162, 0xc031e96f, 0x297df262,
+0xe0552c91, 0x62001003, 0x7f087df1, 0x48fb246c,
+0xe0c47c8b, 0x81346348, 0x01578d48, 0x247c8948,
+0xd63948a0, 0x016f850f, 0xff480000, 0xf88348c0,
+0x31dc7504, 0x89d231c0, 0x05008514, 0xff480010,
+0xf88348c0, 0x48ee7540, 0x000001b8, 0x00000200,
+0x44894800, 0xb848b024, 0x00000003, 0x00000004,
+0x24448948, 0x7df162b8, 0x610d6f08, 0x62000002,
+0x6f087df1, 0xb8fb247c, 0x00000131, 0x0875f262,
+0xf162c927, 0xc9ef0875, 0x297df262, 0x000d3ca1,
+0x83001005, 0x0002463d, 0x850f0100, 0x00000113,
+0x023e158b, 0x150b0000, 0x0000023c, 0x000134b8,
+0x35150b00, 0x0f000002, 0x0000f685, 0x24448a00,
+0x7df162ac, 0x24746f08, 0x92f8c5fb, 0x0138b8f8,
+0xf2620000, 0x34a12f7d, 0x1005000d, 0xfc3d8300,
+0x04000001, 0x00c9850f, 0x058b0000, 0x000001f4,
+0x01f2050b, 0x050b0000, 0x000001f0, 0x009e850f,
+0x4c8a0000, 0xf162ac24, 0x7c6f287d, 0x01bafe24,
+0x62000000, 0x6f087df1, 0xc5fb2474, 0x62d192f8,
+0xa12a7df2, 0x0500bd34, 0x14390010, 0x10050095,
+0x48747500, 0x8348c2ff, 0xee7505fa, 0xac244c8a,
+0x287df162, 0xff247c6f, 0x087df162, 0xfb246c6f,
+0xd992f8c5, 0x2b7df262, 0x00bd2ca1, 0x83001005,
+0x00017e3d, 0x46750400, 0x01793d83, 0x75030000,
+0x743d833d, 0x02000001, 0x3d833475, 0x0000016f,
+0x0145ba01, 0x450f0000, 0xb828ebc2, 0x000000e7,
+0xffb821eb, 0xeb000000, 0x0115b81a, 0x13eb0000,
+0x00013bb8, 0xb80ceb00, 0x00000140, 0x45b805eb,
+0xc9000001, 0x000000c3, 0x00000000, 0x00000000,
+0x00000001, 0x00000002, 0x00000003, 0x00000004,
+0x00000005, 0x00000006, 0x00000007, 0x00000008,
+0x00000009, 0x0000000a, 0x0000000b, 0x0000000c,
+0x0000000d, 0x0000000e, 0x0000000f, 0x00000010,
+0x00000011, 0x00000012, 0x00000013, 0x00000014,
+0x00000015, 0x00000016, 0x00000017, 0x00000018,
+0x00000019, 0x0000001a, 0x0000001b, 0x0000001c,
+0x0000001d, 0x0000001e, 0x0000001f, 0x00000020,
+0x00000021, 0x00000022, 0x00000023, 0x00000024,
+0x00000025, 0x00000026, 0x00000027, 0x00000028,
+0x00000029, 0x0000002a, 0x0000002b, 0x0000002c,
+0x0000002d, 0x0000002e, 0x0000002f, 0x00000030,
+0x00000031, 0x00000032, 0x00000033, 0x00000034,
+0x00000035, 0x00000036, 0x00000037, 0x00000038,
+0x00000039, 0x0000003a, 0x0000003b, 0x0000003c,
+0x0000003d, 0x0000003e, 0x0000003f, 0x00000040,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0xffffffff, 0x00000000, 0x00000000, 0x00000000,
+0002400,
+};
+asm(".type avx512f_sg_x86_64_D_32x8i4, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_64_D_32x8i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_64_D_32x8i8[] = {
+0x485500eb, 0x8348e589, 0x8348e0e4, 0xc74828ec,
+0x00042404, 0xc7480000, 0x01e82444, 0x48000000,
+0x082444c7, 0x00000004, 0x2444c748, 0x000002f0,
+0x44c74800, 0x00031024, 0xc7480000, 0x03f82444,
+0x48000000, 0x182444c7, 0x00000002, 0x2444c748,
+0x00000120, 0x76f5c500, 0xe5f162c9, 0x48dbef08,
+0xc8244c8d, 0x28f5f262, 0xf162c927, 0xd16f28fd,
+0xc193f8c5, 0xc5c0be0f, 0x89d190f8, 0x48a42444,
+0xa824448d, 0x62c68948, 0x912afdf2, 0x04c01d14,
+0xf1620010, 0x947f28fd, 0xffffa824, 0x388348ff,
+0xf4850f01, 0x48000003, 0x4808c083, 0xed75c839,
+0x28fdf162, 0xf8c5d16f, 0xefb8d990, 0x62000000,
+0x6f28fdf1, 0xffe824a4, 0xf262ffff, 0x14912bfd,
+0x1004c0e5, 0xfdf16200, 0x62d27e08, 0x7f28fdf1,
+0xffa82494, 0x8348ffff, 0x850f02fa, 0x000003cc,
+0x16f9e3c4, 0x834801d2, 0x850f03fa, 0x000003bc,
+0x287df362, 0x6201d339, 0x3928fdf3, 0xf16201d2,
+0xd77e08fd, 0x04ff8348, 0x039e850f, 0xe3c40000,
+0x01da16f9, 0x05fa8348, 0x038e850f, 0xf1620000,
+0xf47328e5, 0xfdf16203, 0xc5d16f28, 0xb8e190f8,
+0x000000f7, 0x2cfdf262, 0xc05d1491, 0x62001004,
+0x7e08fdf1, 0xfdf162d2, 0x24947f28, 0xffffffa8,
+0x03fa8348, 0x0352850f, 0xe3c40000, 0x01d216f9,
+0x05fa8348, 0x0342850f, 0xf3620000, 0xd339287d,
+0xfdf36201, 0x01d23928, 0x08fdf162, 0x8348d77e,
+0x850f07ff, 0x00000324, 0x16f9e3c4, 0x834801da,
+0x850f09fa, 0x00000314, 0x28fdf162, 0x0824946f,
+0x62000000, 0x6f28fdf1, 0x90f8c5d9, 0x62c031e9,
+0x912dfdf2, 0x04c0d51c, 0xf1620010, 0x9c7f28fd,
+0xffffa824, 0x7c8b48ff, 0x89480804, 0x4898247c,
+0x4801578d, 0x0f061439, 0x0002b585, 0xc0834800,
+0xf8834808, 0x62de7520, 0xef08e5f1, 0x0001b8db,
+0xf8c50000, 0xf162f190, 0x9cfb28e5, 0xffffe824,
+0xfdf162ff, 0x24b46f28, 0xffffffa8, 0x28fdf162,
+0xf262e96f, 0x2c912efd, 0x1004e0dd, 0xfdf26200,
+0xb8d87c28, 0x00000107, 0x28cdf162, 0xf362dbfb,
+0xc31f28d5, 0x93f8c500, 0x0ffa80d0, 0x026a850f,
+0xf1620000, 0xf27328ed, 0xfdf16201, 0x31d96f28,
+0xfdf262c0, 0x951c9129, 0x001004c0, 0x28fdf162,
+0xa8249c7f, 0x48ffffff, 0x08047c8b, 0x247c8948,
+0x578d4898, 0x14394801, 0x1a850f06, 0x48000002,
+0x4808c083, 0x7520f883, 0xddf162de, 0x2494db28,
+0x00000008, 0x08d5f162, 0x01b8edef, 0xbe000000,
+0x00000005, 0x296de2c4, 0xedf162d5, 0x62c9df28,
+0x2728f5f2, 0xfdf262c9, 0xe51c9129, 0x001004c0,
+0x28fdf162, 0xc8249c7f, 0x89ffffff, 0x7c8b48f2,
+0xc229f8c1, 0x0774c285, 0xc4548b48, 0x4809ebe0,
+0x48c4148b, 0x98245489, 0x48c2ff48, 0x3948c0ff,
+0xa9850fd7, 0x48000001, 0x7505f883, 0x31c031ce,
+0x148948d2, 0x1006e0c5, 0xc0ff4800, 0x40f88348,
+0xc748ed75, 0x01a82444, 0x48000000, 0xb02444c7,
+0x00000002, 0x2444c748, 0x000003b8, 0x44c74800,
+0x0004c024, 0xf1620000, 0x0d6f28fd, 0x00000370,
+0x28fdf162, 0xa824bc6f, 0xb8ffffff, 0x00000131,
+0x28f5f262, 0xf162c927, 0xc9ef08f5, 0x29fdf262,
+0xe00d3ca1, 0x48001006, 0x03613d83, 0x0f010000,
+0x00013785, 0x158b4800, 0x0000035c, 0x5d150b48,
+0xb8000003, 0x00000134, 0x59150b48, 0x0f000003,
+0x00011785, 0x24448a00, 0xfdf162a4, 0x24b46f28,
+0xffffffa8, 0xf892f8c5, 0x000138b8, 0xfdf26200,
+0x0d34a12f, 0x001006e0, 0x103d8348, 0x04000003,
+0x00e6850f, 0x8b480000, 0x00030b15, 0x150b4800,
+0x0000030c, 0x00013bb8, 0x150b4800, 0x00000308,
+0x00c6850f, 0x448a0000, 0xf162a424, 0xbc6f28fd,
+0xffffe824, 0xfdf162ff, 0x24b46f28, 0xffffffa8,
+0xd092f8c5, 0x000001b8, 0xfdf26200, 0xfd34a12a,
+0x001006e0, 0xc5043948, 0x001006e0, 0x0085850f,
+0xff480000, 0xf88348c0, 0x8ae97505, 0x62a42444,
+0x6f28fdf1, 0x000824bc, 0xf1620000, 0xa46f28fd,
+0xffffa824, 0x92f8c5ff, 0x0145b8d8, 0xf2620000,
+0x24a12bfd, 0x1006e0fd, 0x3d834800, 0x00000277,
+0x48497504, 0x02753d83, 0x75030000, 0x3d83483f,
+0x00000273, 0x31357502, 0x0145bac0, 0x83480000,
+0x00026a3d, 0x450f0100, 0xb821ebc2, 0x000000e7,
+0xffb81aeb, 0xeb000000, 0x0115b813, 0x0ceb0000,
+0x00011eb8, 0xb805eb00, 0x00000140, 0x0000c3c9,
+0x00000001, 0x00000000, 0x00000002, 0x00000000,
+0x00000003, 0x00000000, 0x00000004, 0x00000000,
+0x00000005, 0x00000000, 0x00000006, 0x00000000,
+0x00000007, 0x00000000, 0x00000008, 0x00000000,
+0x00000009, 0x00000000, 0x0000000a, 0x00000000,
+0x0000000b, 0x00000000, 0x0000000c, 0x00000000,
+0x0000000d, 0x00000000, 0x0000000e, 0x00000000,
+0x0000000f, 0x00000000, 0x00000010, 0x00000000,
+0x00000011, 0x00000000, 0x00000012, 0x00000000,
+0x00000013, 0x00000000, 0x00000014, 0x00000000,
+0x00000015, 0x00000000, 0x00000016, 0x00000000,
+0x00000017, 0x00000000, 0x00000018, 0x00000000,
+0x00000019, 0x00000000, 0x0000001a, 0x00000000,
+0x0000001b, 0x00000000, 0x0000001c, 0x00000000,
+0x0000001d, 0x00000000, 0x0000001e, 0x00000000,
+0x0000001f, 0x00000000, 0x00000020, 0x00000000,
+0x00000021, 0x00000000, 0x00000022, 0x00000000,
+0x00000023, 0x00000000, 0x00000024, 0x00000000,
+0x00000025, 0x00000000, 0x00000026, 0x00000000,
+0x00000027, 0x00000000, 0x00000028, 0x00000000,
+0x00000029, 0x00000000, 0x0000002a, 0x00000000,
+0x0000002b, 0x00000000, 0x0000002c, 0x00000000,
+0x0000002d, 0x00000000, 0x0000002e, 0x00000000,
+0x0000002f, 0x00000000, 0x00000030, 0x00000000,
+0x00000031, 0x00000000, 0x00000032, 0x00000000,
+0x00000033, 0x00000000, 0x00000034, 0x00000000,
+0x00000035, 0x00000000, 0x00000036, 0x00000000,
+0x00000037, 0x00000000, 0x00000038, 0x00000000,
+0x00000039, 0x00000000, 0x0000003a, 0x00000000,
+0x0000003b, 0x00000000, 0x0000003c, 0x00000000,
+0x0000003d, 0x00000000, 0x0000003e, 0x00000000,
+0x0000003f, 0x00000000, 0x00000040, 0x00000000,
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0003340,
+};
+asm(".type avx512f_sg_x86_64_D_32x8i8, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_64_D_32x8i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_64_D_32x8f4[] = {
+0x485500eb, 0x8348e589, 0xc748e0e4, 0x01c02444,
+0x48000000, 0xe02444c7, 0x00000004, 0x2444c748,
+0x000002c8, 0x44c74800, 0x0003e824, 0xc7480000,
+0x03d02444, 0x48000000, 0xf02444c7, 0x00000002,
+0x2444c748, 0x000004d8, 0x44c74800, 0x0001f824,
+0xf1c50000, 0xe9c5c976, 0xf162d276, 0xdbef0865,
+0x087ef162, 0x06362d10, 0xf2620000, 0xc9270875,
+0x087cf162, 0x8d48ca28, 0xc5c02454, 0x0fc193f8,
+0xf8c5c0be, 0x4489d190, 0x8d48ac24, 0x48b02444,
+0xf262c189, 0x0c932a7d, 0x1005a01d, 0x7cf16200,
+0x244c2908, 0x7cf162fb, 0x0f282e08, 0x00048c8a,
+0x86850f00, 0x48000004, 0x4804c083, 0xe575c239,
+0x287df162, 0xfe245c6f, 0x087cf162, 0xf8c5ca28,
+0xf262d990, 0x0c932b7d, 0x1005a09d, 0x7cf16200,
+0xbd0d2e08, 0x62000005, 0x29087cf1, 0x0ffb244c,
+0x00044f8a, 0x49850f00, 0x62000004, 0xc60874f1,
+0xf16255e1, 0x252e087c, 0x0000059c, 0x04328a0f,
+0x850f0000, 0x0000042c, 0x0874f162, 0xf162e115,
+0x252e087c, 0x00000584, 0x04168a0f, 0x850f0000,
+0x00000410, 0x0874f162, 0x62ffc9c6, 0x2e087cf1,
+0x00056b0d, 0xf98a0f00, 0x0f000003, 0x0003f385,
+0xe5f16200, 0x02f37328, 0x087cf162, 0xf8c5ca28,
+0xf262e190, 0x0c932c7d, 0x1005a05d, 0x7cf16200,
+0x310d2e08, 0x62000005, 0x29087cf1, 0x0ffb244c,
+0x0003c68a, 0xc0850f00, 0x62000003, 0xc60874f1,
+0xf16255d9, 0x1d2e087c, 0x00000514, 0x03a98a0f,
+0x850f0000, 0x000003a3, 0x0874f162, 0xf162d915,
+0x1d2e087c, 0x000004fc, 0x038d8a0f, 0x850f0000,
+0x00000387, 0x0874f162, 0x62ffc9c6, 0x2e087cf1,
+0x0004e30d, 0x708a0f00, 0x0f000003, 0x00036a85,
+0x7df16200, 0x244c6f28, 0x7cf162ff, 0xc5da2808,
+0x31e990f8, 0x7df262c0, 0x8d1c932d, 0x001005a0,
+0x087cf162, 0xfb245c29, 0xc4748b48, 0x568d48e0,
+0x74894801, 0xf162a024, 0xda2a08e6, 0x087cf162,
+0x0f811c2e, 0x0003298a, 0x23850f00, 0x48000003,
+0x8348c0ff, 0xd07504f8, 0x085df162, 0xf162e4ef,
+0xda28087c, 0xf190f8c5, 0x28ddf162, 0xfe2464fb,
+0x000107b8, 0x7df26200, 0xa51c932e, 0x001005b0,
+0x087df262, 0x04522518, 0xf1620000, 0x6458085c,
+0xf362fb24, 0xc41f0865, 0x93f8c500, 0x0ffa80d0,
+0x0302850f, 0xf1620000, 0xf17328f5, 0x7cf16201,
+0x31f22808, 0x7df262c0, 0x4d349329, 0x001005a0,
+0x087cf162, 0xfb247429, 0xc4748b48, 0x568d48e0,
+0x74894801, 0xf162a024, 0xca2a08f6, 0x087cf162,
+0x0f810c2e, 0x0002908a, 0x8a850f00, 0x48000002,
+0x8348c0ff, 0xd07504f8, 0xf0c5c031, 0x04c7c957,
+0x1006e085, 0x00000000, 0xc0ff4800, 0x40f88348,
+0xb848ec75, 0x3f800000, 0x40000000, 0x24448948,
+0x00b848b0, 0x00404000, 0x48408000, 0xb8244489,
+0x087df162, 0x03a6156f, 0xf1620000, 0x7c28087c,
+0xf262fb24, 0xca27086d, 0x086df162, 0xf262d2ef,
+0x3ca3297d, 0x1006e015, 0x7cf16200, 0x9d2d2e08,
+0x0f000003, 0x0002178a, 0x11850f00, 0x62000002,
+0x2e087cf1, 0x00038b0d, 0x088a0f00, 0x0f000002,
+0x00020285, 0x7cf16200, 0x790d2e08, 0x0f000003,
+0x0001f28a, 0xec850f00, 0x62000001, 0x2e087cf1,
+0x0003670d, 0xdc8a0f00, 0x0f000001, 0x0001d685,
+0x24448a00, 0x7cf162ac, 0x247c2808, 0x92f8c5fb,
+0x7df262f8, 0x153ca32f, 0x001006e0, 0x087ef162,
+0x032a0d10, 0xf1620000, 0x0d2e087c, 0x000002ec,
+0x01a88a0f, 0x850f0000, 0x000001a2, 0xc957f0c5,
+0x087cf162, 0x030a0d2e, 0x8a0f0000, 0x00000195,
+0x018f850f, 0xf1620000, 0x0d2e087c, 0x000002f8,
+0x017f8a0f, 0x850f0000, 0x00000179, 0x087cf162,
+0x02e60d2e, 0x8a0f0000, 0x00000169, 0x0163850f,
+0x448a0000, 0xf162ac24, 0x6c6f287d, 0xf162fe24,
+0x7c28087c, 0xf162fb24, 0x0d10087e, 0x00000270,
+0xd092f8c5, 0x2a7df262, 0xe0ad3ca3, 0x62001006,
+0x2e087cf1, 0x00029b0d, 0x2d8a0f00, 0x0f000001,
+0x00012785, 0x7ef16200, 0x89151008, 0x62000002,
+0x2e087cf1, 0x00023b15, 0x0d8a0f00, 0x0f000001,
+0x00010785, 0x7ef16200, 0x6d151008, 0x62000002,
+0x2e087cf1, 0x00021f15, 0xed8a0f00, 0x0f000000,
+0x0000e785, 0x7ef16200, 0x51151008, 0x62000002,
+0x2e087cf1, 0x00020315, 0xcd8a0f00, 0x0f000000,
+0x0000c785, 0x24448a00, 0x7df162ac, 0x246c6f28,
+0x7cf162ff, 0x24742808, 0x92f8c5fb, 0x7df262d8,
+0xad34a32b, 0x001006e0, 0x087ef162, 0x02021510,
+0xf1620000, 0x152e087c, 0x000001c0, 0x00918a0f,
+0x850f0000, 0x0000008b, 0x087ef162, 0x01e61510,
+0xf1620000, 0x152e087c, 0x0000019c, 0x7375757a,
+0x087ef162, 0x01d21510, 0xf1620000, 0x152e087c,
+0x00000180, 0x5b755d7a, 0x087cf162, 0x01be0d2e,
+0x4f7a0000, 0x000000b8, 0xeb4d7400, 0x00e7b846,
+0x44eb0000, 0x0000efb8, 0xb83deb00, 0x000000f7,
+0xffb836eb, 0xeb000000, 0x0115b82f, 0x28eb0000,
+0x000131b8, 0xb821eb00, 0x00000134, 0x38b81aeb,
+0xeb000001, 0x013bb813, 0x0ceb0000, 0x000140b8,
+0xb805eb00, 0x00000145, 0x0000c3c9, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+0x40a00000, 0x40c00000, 0x40e00000, 0x41000000,
+0x41100000, 0x41200000, 0x41300000, 0x41400000,
+0x41500000, 0x41600000, 0x41700000, 0x41800000,
+0x41880000, 0x41900000, 0x41980000, 0x41a00000,
+0x41a80000, 0x41b00000, 0x41b80000, 0x41c00000,
+0x41c80000, 0x41d00000, 0x41d80000, 0x41e00000,
+0x41e80000, 0x41f00000, 0x41f80000, 0x42000000,
+0x42040000, 0x42080000, 0x420c0000, 0x42100000,
+0x42140000, 0x42180000, 0x421c0000, 0x42200000,
+0x42240000, 0x42280000, 0x422c0000, 0x42300000,
+0x42340000, 0x42380000, 0x423c0000, 0x42400000,
+0x42440000, 0x42480000, 0x424c0000, 0x42500000,
+0x42540000, 0x42580000, 0x425c0000, 0x42600000,
+0x42640000, 0x42680000, 0x426c0000, 0x42700000,
+0x42740000, 0x42780000, 0x427c0000, 0x42800000,
+0x3f800000, 0x40000000, 0x40400000, 0x40800000,
+0x40a00000, 0x40e00000, 0x41100000, 0xbf800000,
+0xffffffff, 0x00000000, 0x00000000, 0x00000000,
+0003320,
+};
+asm(".type avx512f_sg_x86_64_D_32x8f4, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_64_D_32x8f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_64_D_32x8f8[] = {
+0x485500eb, 0x8348e589, 0x8348e0e4, 0xc74828ec,
+0x00042404, 0xc7480000, 0x01e82444, 0x48000000,
+0x082444c7, 0x00000004, 0x2444c748, 0x000002f0,
+0x44c74800, 0x00031024, 0xc7480000, 0x03f82444,
+0x48000000, 0x182444c7, 0x00000002, 0x2444c748,
+0x00000120, 0x76c5c500, 0x76f5c5ff, 0xe5f162c9,
+0x62dbef08, 0x2728c5f2, 0xfdf162cf, 0x48d12828,
+0xc8244c8d, 0xc193f8c5, 0xc5c0be0f, 0x89d190f8,
+0x48a42444, 0xa824448d, 0x62c68948, 0x932afdf2,
+0x06401d14, 0xf1620010, 0x942928fd, 0xffffa824,
+0xfff162ff, 0x95151008, 0x62000007, 0x2e08fdf1,
+0x308a0f10, 0x0f000005, 0x00052a85, 0xc0834800,
+0xc8394808, 0xf162e575, 0x9c6f28fd, 0xffffe824,
+0xfdf162ff, 0xc5d12828, 0x62d990f8, 0x932bfdf2,
+0x0640dd14, 0xf1620010, 0x152e08fd, 0x00000758,
+0x28fdf162, 0xa8249429, 0x0fffffff, 0x0004ed8a,
+0xe7850f00, 0x62000004, 0x1008fff1, 0x00073f35,
+0xedf16200, 0x62e21508, 0x2e08fdf1, 0xcb8a0fe6,
+0x0f000004, 0x0004c585, 0xfff16200, 0x252d1008,
+0x62000007, 0x19287df3, 0xf36201d4, 0xd21928fd,
+0xfdf16201, 0x0fd52e08, 0x0004a18a, 0x9b850f00,
+0x62000004, 0x1008ff71, 0x00070305, 0xddf16200,
+0x62e41508, 0x2e08fdd1, 0x7f8a0fe0, 0x0f000004,
+0x00047985, 0xddf16200, 0x03f37328, 0x28fdf162,
+0xf8c5d128, 0xf262e190, 0x14932cfd, 0x10064065,
+0xfdf16200, 0x62d62e08, 0x2928fdf1, 0xffa82494,
+0x8a0fffff, 0x0000044d, 0x0447850f, 0xf1620000,
+0xe21508ed, 0x08fdd162, 0x8a0fe02e, 0x00000435,
+0x042f850f, 0xf3620000, 0xd419287d, 0xfdf36201,
+0x01d21928, 0x08fdf162, 0x068a152e, 0x8a0f0000,
+0x00000411, 0x040b850f, 0xf1620000, 0xe41508dd,
+0x08fdf162, 0x0676252e, 0x8a0f0000, 0x000003f5,
+0x03ef850f, 0xf1620000, 0x946f28fd, 0x00000824,
+0xfdf16200, 0xc5e12828, 0x31e990f8, 0xfdf262c0,
+0xd524932d, 0x00100640, 0x28fdf162, 0xa824a429,
+0x48ffffff, 0x08047c8b, 0x01578d48, 0x247c8948,
+0xdff16298, 0x62e22a08, 0x2e08fdf1, 0x8a0f0624,
+0x000003a8, 0x03a2850f, 0x83480000, 0x834808c0,
+0xcf7520f8, 0x08ddf162, 0x7162e4ef, 0xc12828fd,
+0xf190f8c5, 0x28ddf162, 0xe824a4fb, 0xb8ffffff,
+0x00000107, 0x2efd7262, 0x60e50493, 0x62001006,
+0x1928fdf2, 0x0005df25, 0xddf16200, 0x24a45828,
+0xffffffa8, 0x28bdf362, 0xc500c41f, 0x80d093f8,
+0x850f0ffa, 0x00000381, 0x28edf162, 0x3101f273,
+0xfdf262c0, 0x950c9329, 0x00100640, 0x28fdf162,
+0xa8248c29, 0x48ffffff, 0x08047c8b, 0x01578d48,
+0x247c8948, 0xeff16298, 0x62d22a08, 0x2e08fdf1,
+0x8a0f0614, 0x0000030b, 0x0305850f, 0x83480000,
+0x834808c0, 0xcf7520f8, 0x28e5f162, 0x082494db,
+0x62000000, 0xef08ddf1, 0x0001b8e4, 0x05be0000,
+0xc4000000, 0xd4296de2, 0x28edf162, 0xf262d7df,
+0xca2728ed, 0x29fdf262, 0x40dd0c93, 0x62001006,
+0x2928fdf1, 0xffc8248c, 0xf289ffff, 0x08fff162,
+0xffc15410, 0xc285c229, 0x8b480774, 0xebe0c47c,
+0x3c8b4809, 0x7c8948c4, 0x8d489824, 0xff480157,
+0xf7f162c0, 0x62ca2a08, 0x2e08fdf1, 0x878a0fd1,
+0x0f000002, 0x00028185, 0xf8834800, 0x31bb7505,
+0x57e1c5c0, 0x04c748db, 0x1008a0c5, 0x00000000,
+0xc0ff4800, 0x40f88348, 0xf162eb75, 0x0d1008ff,
+0x0000048c, 0x08fff162, 0xf7247411, 0x08fff162,
+0x04821510, 0xf1620000, 0x6c1108ff, 0xf162f824,
+0x4c1108ff, 0xf162f524, 0x541108ff, 0xf162f624,
+0x256f28fd, 0x00000498, 0x28fdf162, 0xa824bc28,
+0x62ffffff, 0x2728ddf2, 0xddf162cc, 0x62e4ef08,
+0xa329fdf2, 0x08a0253c, 0xf1620010, 0x0d2e08fd,
+0x0000048c, 0x01f78a0f, 0x850f0000, 0x000001f1,
+0x08fdf162, 0x047e1d2e, 0x8a0f0000, 0x000001e8,
+0x01e2850f, 0xf1620000, 0x1d2e08fd, 0x00000470,
+0x01d28a0f, 0x850f0000, 0x000001cc, 0x08fdf162,
+0x04621d2e, 0x8a0f0000, 0x000001bc, 0x01b6850f,
+0x448a0000, 0xf162a424, 0xb42828fd, 0xffffa824,
+0x92f8c5ff, 0xfdf262f8, 0x2534a32f, 0x001008a0,
+0x08fdf162, 0x04162d2e, 0x8a0f0000, 0x0000018f,
+0x08fff162, 0x03be1d10, 0xf1620000, 0x1d2e08fd,
+0x000003fc, 0x0175850f, 0xd9c50000, 0xf162e457,
+0x252e08fd, 0x000003f0, 0x01688a0f, 0x850f0000,
+0x00000162, 0x08fdf162, 0x03e2252e, 0x8a0f0000,
+0x00000152, 0x014c850f, 0xf1620000, 0x252e08fd,
+0x000003d4, 0x013c8a0f, 0x850f0000, 0x00000136,
+0xa424448a, 0x28fdf162, 0xe824bc6f, 0x62ffffff,
+0x2828fdf1, 0xffa824ac, 0xf8c5ffff, 0xf262d092,
+0x2ca32afd, 0x1008a0fd, 0xfdf16200, 0x850d2e08,
+0x0f000003, 0x0001048a, 0xfe850f00, 0x62000000,
+0x2e08fdf1, 0x00037715, 0xee8a0f00, 0x0f000000,
+0x0000e885, 0xfff16200, 0x01251008, 0x62000003,
+0x2e08fdf1, 0x00035f25, 0xce8a0f00, 0x0f000000,
+0x0000c885, 0xfdf16200, 0x511d2e08, 0x0f000003,
+0x0000b88a, 0xb2850f00, 0x8a000000, 0x62a42444,
+0x6f28fdf1, 0x000824b4, 0xf1620000, 0xbc2828fd,
+0xffffa824, 0x92f8c5ff, 0xfdf262d8, 0xf53ca32b,
+0x001008a0, 0x08fdf162, 0x02fa1d2e, 0x8a0f0000,
+0x00000080, 0xf1627e75, 0x252e08fd, 0x000002f0,
+0x7075727a, 0x08fdf162, 0x02ea152e, 0x647a0000,
+0xf1626275, 0x0d2e08fd, 0x000002e4, 0x00b8567a,
+0x74000000, 0xb84deb54, 0x000000e7, 0xefb84beb,
+0xeb000000, 0x00f7b844, 0x3deb0000, 0x0000ffb8,
+0xb836eb00, 0x00000115, 0x1eb82feb, 0xeb000001,
+0x0131b828, 0x21eb0000, 0x000134b8, 0xb81aeb00,
+0x00000138, 0x3bb813eb, 0xeb000001, 0x0140b80c,
+0x05eb0000, 0x000145b8, 0x00c3c900, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40100000,
+0x00000000, 0x40140000, 0x00000000, 0x40180000,
+0x00000000, 0x401c0000, 0x00000000, 0x40200000,
+0x00000000, 0x40220000, 0x00000000, 0x40240000,
+0x00000000, 0x40260000, 0x00000000, 0x40280000,
+0x00000000, 0x402a0000, 0x00000000, 0x402c0000,
+0x00000000, 0x402e0000, 0x00000000, 0x40300000,
+0x00000000, 0x40310000, 0x00000000, 0x40320000,
+0x00000000, 0x40330000, 0x00000000, 0x40340000,
+0x00000000, 0x40350000, 0x00000000, 0x40360000,
+0x00000000, 0x40370000, 0x00000000, 0x40380000,
+0x00000000, 0x40390000, 0x00000000, 0x403a0000,
+0x00000000, 0x403b0000, 0x00000000, 0x403c0000,
+0x00000000, 0x403d0000, 0x00000000, 0x403e0000,
+0x00000000, 0x403f0000, 0x00000000, 0x40400000,
+0x00000000, 0x40408000, 0x00000000, 0x40410000,
+0x00000000, 0x40418000, 0x00000000, 0x40420000,
+0x00000000, 0x40428000, 0x00000000, 0x40430000,
+0x00000000, 0x40438000, 0x00000000, 0x40440000,
+0x00000000, 0x40448000, 0x00000000, 0x40450000,
+0x00000000, 0x40458000, 0x00000000, 0x40460000,
+0x00000000, 0x40468000, 0x00000000, 0x40470000,
+0x00000000, 0x40478000, 0x00000000, 0x40480000,
+0x00000000, 0x40488000, 0x00000000, 0x40490000,
+0x00000000, 0x40498000, 0x00000000, 0x404a0000,
+0x00000000, 0x404a8000, 0x00000000, 0x404b0000,
+0x00000000, 0x404b8000, 0x00000000, 0x404c0000,
+0x00000000, 0x404c8000, 0x00000000, 0x404d0000,
+0x00000000, 0x404d8000, 0x00000000, 0x404e0000,
+0x00000000, 0x404e8000, 0x00000000, 0x404f0000,
+0x00000000, 0x404f8000, 0x00000000, 0x40500000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0x40100000,
+0x00000000, 0x40140000, 0x00000000, 0x401c0000,
+0x00000000, 0x40220000, 0x00000000, 0xbff00000,
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0004240,
+};
+asm(".type avx512f_sg_x86_64_D_32x8f8, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_64_D_32x8f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_64_D_higher[] = {
+0xb85500eb, 0x00000001, 0x000011b9, 0xe5894800,
+0xc0e48348, 0xc8ec8148, 0x89000000, 0x844489ca,
+0x89c22944, 0x00848494, 0xff480000, 0xf88348c0,
+0x62e87511, 0x25483d53, 0x41c4ffc0, 0x48d2ef29,
+0x0824748d, 0x483dd262, 0x5162c827, 0xc86f487d,
+0xc193f8c5, 0x90f8c598, 0x244489d1, 0x448d48c4,
+0x8948c824, 0xc18948c2, 0x4a7d3262, 0x40150c90,
+0x62001004, 0x7f487d71, 0xffc8248c, 0x3a83ffff,
+0x35850f01, 0x48000003, 0x4804c283, 0xee75f239,
+0x487d7162, 0x48248c6f, 0x62000000, 0x6f487d51,
+0x90f8c5d0, 0x62d231d9, 0x904b7d32, 0x04408d14,
+0x71620010, 0x947f487d, 0xffffc824, 0x027a8dff,
+0x0f903c39, 0x0002fa85, 0xc2ff4800, 0x10fa8348,
+0xd162eb75, 0xf1724825, 0x7d516202, 0xc5d06f48,
+0xbae190f8, 0x00000003, 0x4c7d3262, 0x405d1490,
+0x62001004, 0x7f487d71, 0xffc82494, 0x1039ffff,
+0x02c4850f, 0xc2830000, 0xc0834802, 0x23fa8304,
+0x5162ec75, 0xd86f487d, 0xe990f8c5, 0x7162c031,
+0x946f487d, 0x00008824, 0x7d326200, 0x951c904d,
+0x00100440, 0x487d7162, 0xc8249c7f, 0x8bffffff,
+0x008804bc, 0x7c890000, 0x578dc024, 0x01143901,
+0x027b850f, 0x83480000, 0x834804c0, 0xdf7540f8,
+0xef1941c4, 0x0001b8e4, 0x51620000, 0xe86f487d,
+0xf190f8c5, 0x481d5162, 0x3262e1fa, 0x2c904e7d,
+0x100480a5, 0x7d726200, 0xb8e07c48, 0x00000107,
+0x48255162, 0xd362dcfa, 0xc31f4815, 0x93f8c500,
+0xc2ff66d0, 0x0256850f, 0xd1620000, 0xf272481d,
+0x7d516201, 0x31d86f48, 0x7d3262c0, 0x651c9049,
+0x00100440, 0x487d7162, 0xc8249c7f, 0x8bffffff,
+0x008804bc, 0x7c890000, 0x578dc024, 0x01143901,
+0x01f2850f, 0x83480000, 0x834804c0, 0xdf7540f8,
+0x48355162, 0x41c4d2db, 0xb8e4ef19, 0x00000001,
+0x000011bf, 0x2dd36200, 0x04cc1f48, 0x491d5262,
+0xd262d064, 0xca27482d, 0x497d3262, 0x408d1c90,
+0x62001004, 0x7f487d71, 0x0008249c, 0xfa890000,
+0x86448b44, 0x85c229fc, 0x8b0674c2, 0xeb448454,
+0x84948b07, 0x00000084, 0xc0245489, 0xff48c2ff,
+0xd03941c0, 0x0185850f, 0x83480000, 0xce7511f8,
+0xd231c031, 0x80851489, 0x48001006, 0x3d48c0ff,
+0x00000080, 0x01b8ec75, 0x89000000, 0x48fc8144,
+0x8348c0ff, 0xf37511f8, 0x487d7162, 0x03ae056f,
+0x71620000, 0xb46f487d, 0xffffc824, 0x0131b8ff,
+0xd2620000, 0xc827483d, 0xef3941c4, 0x7d3262c0,
+0x0534a049, 0x00100680, 0x03c13d83, 0x0f010000,
+0x00013b85, 0x0001b800, 0x3c830000, 0x10068085,
+0x850f0000, 0x0000010e, 0x48c0ff48, 0x7510f883,
+0x7d7162e9, 0x24bc6f48, 0xffffffc8, 0xef3941c4,
+0x90f8c5c0, 0xb8c4247c, 0x00000138, 0x4f7d3262,
+0x80053ca0, 0x83001006, 0x0003723d, 0x850f1000,
+0x000000ec, 0x000001ba, 0x95048b00, 0x00100680,
+0x850fc085, 0x000000c5, 0x48c2ff48, 0x7510fa83,
+0x7d7162e8, 0x24b46f48, 0x00000048, 0x5490f8c5,
+0x01bac424, 0x62000000, 0x6f487d71, 0xffc824bc,
+0x3262ffff, 0x3ca04a7d, 0x100680b5, 0x95143900,
+0x00100680, 0x008a850f, 0xff480000, 0xfa8348c2,
+0xc5ea7511, 0x245c90f8, 0x0001bac4, 0x11b90000,
+0x62000000, 0x6f487d71, 0x008824b4, 0x71620000,
+0xbc6f487d, 0xffffc824, 0x7d3262ff, 0xb53ca04b,
+0x00100680, 0xd629ce89, 0x80953439, 0x75001006,
+0xc2ff484a, 0x11fa8348, 0x44ebea75, 0x0000e7b8,
+0xb83deb00, 0x000000ef, 0xf7b836eb, 0xeb000000,
+0x00ffb82f, 0x28eb0000, 0x000115b8, 0xb821eb00,
+0x0000011e, 0x34b81aeb, 0xeb000001, 0x013bb813,
+0x0ceb0000, 0x000140b8, 0xb805eb00, 0x00000145,
+0x0000c3c9, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000002, 0x00000003, 0x00000004,
+0x00000005, 0x00000006, 0x00000007, 0x00000008,
+0x00000009, 0x0000000a, 0x0000000b, 0x0000000c,
+0x0000000d, 0x0000000e, 0x0000000f, 0x00000010,
+0x00000011, 0x00000012, 0x00000013, 0x00000014,
+0x00000015, 0x00000016, 0x00000017, 0x00000018,
+0x00000019, 0x0000001a, 0x0000001b, 0x0000001c,
+0x0000001d, 0x0000001e, 0x0000001f, 0x00000020,
+0x00000021, 0x00000022, 0x00000023, 0x00000024,
+0x00000025, 0x00000026, 0x00000027, 0x00000028,
+0x00000029, 0x0000002a, 0x0000002b, 0x0000002c,
+0x0000002d, 0x0000002e, 0x0000002f, 0x00000030,
+0x00000031, 0x00000032, 0x00000033, 0x00000034,
+0x00000035, 0x00000036, 0x00000037, 0x00000038,
+0x00000039, 0x0000003a, 0x0000003b, 0x0000003c,
+0x0000003d, 0x0000003e, 0x0000003f, 0x00000040,
+0x00000041, 0x00000042, 0x00000043, 0x00000044,
+0x00000045, 0x00000046, 0x00000047, 0x00000048,
+0x00000049, 0x0000004a, 0x0000004b, 0x0000004c,
+0x0000004d, 0x0000004e, 0x0000004f, 0x00000050,
+0x00000051, 0x00000052, 0x00000053, 0x00000054,
+0x00000055, 0x00000056, 0x00000057, 0x00000058,
+0x00000059, 0x0000005a, 0x0000005b, 0x0000005c,
+0x0000005d, 0x0000005e, 0x0000005f, 0x00000060,
+0x00000061, 0x00000062, 0x00000063, 0x00000064,
+0x00000065, 0x00000066, 0x00000067, 0x00000068,
+0x00000069, 0x0000006a, 0x0000006b, 0x0000006c,
+0x0000006d, 0x0000006e, 0x0000006f, 0x00000070,
+0x00000071, 0x00000072, 0x00000073, 0x00000074,
+0x00000075, 0x00000076, 0x00000077, 0x00000078,
+0x00000079, 0x0000007a, 0x0000007b, 0x0000007c,
+0x0000007d, 0x0000007e, 0x0000007f, 0x00000080,
+0xffffffff, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0003200,
+};
+asm(".type avx512f_sg_x86_64_D_higher, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_64_D_higher, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) avx512f_sg_x86_64_D_highest[] = {
+0xb85500eb, 0x00000001, 0x000011b9, 0xe5894800,
+0xc0e48348, 0xc8ec8148, 0x89000000, 0x844489ca,
+0x89c22944, 0x00848494, 0xff480000, 0xf88348c0,
+0x62e87511, 0x25407da3, 0xa162ffc0, 0xd2ef406d,
+0x24748d48, 0x7db26208, 0x62c82740, 0x6f487da1,
+0x93f8c5c8, 0xf8c598c1, 0x4489d190, 0x8d48c424,
+0x48c82444, 0x8948c289, 0x7de262c1, 0x150c9042,
+0x00100440, 0x487de162, 0xc8248c7f, 0x83ffffff,
+0x850f013a, 0x00000339, 0x04c28348, 0x75f23948,
+0x7de162ee, 0x248c6f48, 0x00000048, 0x487da162,
+0xf8c5d06f, 0xd231d990, 0x437de262, 0x408d1490,
+0x62001004, 0x7f487de1, 0xffc82494, 0x7a8dffff,
+0x903c3902, 0x02fe850f, 0xff480000, 0xfa8348c2,
+0x62eb7510, 0x724065b1, 0xa16202f1, 0xd06f487d,
+0xe190f8c5, 0x000003ba, 0x7de26200, 0x5d149044,
+0x00100440, 0x487de162, 0xc824947f, 0x39ffffff,
+0xc8850f10, 0x83000002, 0x834802c2, 0xfa8304c0,
+0x62ec7523, 0x6f487da1, 0x90f8c5d8, 0x62c031e9,
+0x6f487de1, 0x00882494, 0xe2620000, 0x1c90457d,
+0x10044095, 0x7de16200, 0x249c7f48, 0xffffffc8,
+0x8804bc8b, 0x89000000, 0x8dc0247c, 0x14390157,
+0x7f850f01, 0x48000002, 0x4804c083, 0x7540f883,
+0x5da162df, 0xb8e4ef40, 0x00000001, 0x487da162,
+0xf8c5e86f, 0xa162f190, 0xe1fa405d, 0x467de262,
+0x80a52c90, 0x62001004, 0x7c487de2, 0x0107b8e0,
+0xa1620000, 0xdcfa4065, 0x4055b362, 0xc500c31f,
+0x66d093f8, 0x850fc2ff, 0x00000259, 0x405db162,
+0x6201f272, 0x6f487da1, 0x62c031d8, 0x90417de2,
+0x0440651c, 0xe1620010, 0x9c7f487d, 0xffffc824,
+0x04bc8bff, 0x00000088, 0xc0247c89, 0x3901578d,
+0x850f0114, 0x000001f5, 0x04c08348, 0x40f88348,
+0xa162df75, 0xd2db4075, 0x405da162, 0x01b8e4ef,
+0xbf000000, 0x00000011, 0x406db362, 0x6204cc1f,
+0x64415da2, 0x6db262d0, 0x62ca2740, 0x90417de2,
+0x04408d1c, 0xe1620010, 0x9c7f487d, 0x00000824,
+0x44fa8900, 0xfc86448b, 0xc285c229, 0x548b0674,
+0x07eb4484, 0x8484948b, 0x89000000, 0xffc02454,
+0xc0ff48c2, 0x0fd03941, 0x00018785, 0xf8834800,
+0x31ce7511, 0x89d231c0, 0x06808514, 0xff480010,
+0x803d48c0, 0x75000000, 0x0001b8ec, 0x44890000,
+0xff48fc81, 0xf88348c0, 0x62f37511, 0x6f487de1,
+0x0003ab05, 0x7de16200, 0x24b46f48, 0xffffffc8,
+0x000131b8, 0x7db26200, 0x62c82740, 0xef407da1,
+0x7de262c0, 0x0534a041, 0x00100680, 0x03bd3d83,
+0x0f010000, 0x00013c85, 0x0001b800, 0x3c830000,
+0x10068085, 0x850f0000, 0x0000010f, 0x48c0ff48,
+0x7510f883, 0x7de162e9, 0x24bc6f48, 0xffffffc8,
+0x407da162, 0xf8c5c0ef, 0xc4247c90, 0x000138b8,
+0x7de26200, 0x053ca047, 0x00100680, 0x036d3d83,
+0x0f100000, 0x0000ec85, 0x0001ba00, 0x048b0000,
+0x10068095, 0x0fc08500, 0x0000c585, 0xc2ff4800,
+0x10fa8348, 0x6162e875, 0x846f487d, 0x00004824,
+0x90f8c500, 0xbac42454, 0x00000001, 0x487d6162,
+0xc8248c6f, 0x62ffffff, 0xa0427d22, 0x0680850c,
+0x14390010, 0x10068095, 0x8a850f00, 0x48000000,
+0x8348c2ff, 0xea7511fa, 0x5c90f8c5, 0x01bac424,
+0xb9000000, 0x00000011, 0x487d6162, 0x8824946f,
+0x62000000, 0x6f487d61, 0xffc8249c, 0x2262ffff,
+0x1ca0437d, 0x10068095, 0x29ce8900, 0x953439d6,
+0x00100680, 0xff484a75, 0xfa8348c2, 0xebea7511,
+0x00e7b844, 0x3deb0000, 0x0000efb8, 0xb836eb00,
+0x000000f7, 0xffb82feb, 0xeb000000, 0x0115b828,
+0x21eb0000, 0x00011eb8, 0xb81aeb00, 0x00000134,
+0x3bb813eb, 0xeb000001, 0x0140b80c, 0x05eb0000,
+0x000145b8, 0x00c3c900, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000002, 0x00000003, 0x00000004,
+0x00000005, 0x00000006, 0x00000007, 0x00000008,
+0x00000009, 0x0000000a, 0x0000000b, 0x0000000c,
+0x0000000d, 0x0000000e, 0x0000000f, 0x00000010,
+0x00000011, 0x00000012, 0x00000013, 0x00000014,
+0x00000015, 0x00000016, 0x00000017, 0x00000018,
+0x00000019, 0x0000001a, 0x0000001b, 0x0000001c,
+0x0000001d, 0x0000001e, 0x0000001f, 0x00000020,
+0x00000021, 0x00000022, 0x00000023, 0x00000024,
+0x00000025, 0x00000026, 0x00000027, 0x00000028,
+0x00000029, 0x0000002a, 0x0000002b, 0x0000002c,
+0x0000002d, 0x0000002e, 0x0000002f, 0x00000030,
+0x00000031, 0x00000032, 0x00000033, 0x00000034,
+0x00000035, 0x00000036, 0x00000037, 0x00000038,
+0x00000039, 0x0000003a, 0x0000003b, 0x0000003c,
+0x0000003d, 0x0000003e, 0x0000003f, 0x00000040,
+0x00000041, 0x00000042, 0x00000043, 0x00000044,
+0x00000045, 0x00000046, 0x00000047, 0x00000048,
+0x00000049, 0x0000004a, 0x0000004b, 0x0000004c,
+0x0000004d, 0x0000004e, 0x0000004f, 0x00000050,
+0x00000051, 0x00000052, 0x00000053, 0x00000054,
+0x00000055, 0x00000056, 0x00000057, 0x00000058,
+0x00000059, 0x0000005a, 0x0000005b, 0x0000005c,
+0x0000005d, 0x0000005e, 0x0000005f, 0x00000060,
+0x00000061, 0x00000062, 0x00000063, 0x00000064,
+0x00000065, 0x00000066, 0x00000067, 0x00000068,
+0x00000069, 0x0000006a, 0x0000006b, 0x0000006c,
+0x0000006d, 0x0000006e, 0x0000006f, 0x00000070,
+0x00000071, 0x00000072, 0x00000073, 0x00000074,
+0x00000075, 0x00000076, 0x00000077, 0x00000078,
+0x00000079, 0x0000007a, 0x0000007b, 0x0000007c,
+0x0000007d, 0x0000007e, 0x0000007f, 0x00000080,
+0xffffffff, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0003200,
+};
+asm(".type avx512f_sg_x86_64_D_highest, STT_NOTYPE;");
+asm(".type avx512f_sg_x86_64_D_highest, STT_FUNC;");
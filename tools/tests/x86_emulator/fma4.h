@@ -0,0 +1,472 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma4_x86_32_D_16f4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xe8d955c3,
+0xec83e589, 0xc855d938, 0x024805d9, 0x55d90010,
+0xd9c9d9d8, 0x05d9e855, 0x00100210, 0xd9cc55d9,
+0x10024405, 0xdc55d900, 0x55d9cad9, 0xd9cad9ec,
+0x5dd9d05d, 0xf055d9e0, 0x5dd9c9d9, 0xe455d9d4,
+0xc5f45dd9, 0xd84d28f8, 0xdb76e1c5, 0x0000a7b8,
+0x71e3c400, 0x10c85568, 0x15c2e8c5, 0x00100220,
+0x79e2c400, 0x830fd30e, 0x0000018d, 0x7c71e3c4,
+0xc510c855, 0x3015c2e8, 0x00001002, 0x0000abb8,
+0x79e2c400, 0x830fd30e, 0x0000016d, 0x6c71e3c4,
+0xc510c855, 0x4015c2e8, 0x00001002, 0x0000afb8,
+0x79e2c400, 0x830fd30e, 0x0000014d, 0x7871e3c4,
+0xc510c855, 0x5015c2e8, 0x00001002, 0x0000b3b8,
+0x79e2c400, 0x830fd30e, 0x0000012d, 0x5528f8c5,
+0x58e8c5c8, 0x28f8c5e9, 0xbbb8e875, 0xc4000000,
+0x6568e9e3, 0xd0c560d8, 0xc400e4c2, 0xe30e79e2,
+0x0103830f, 0xe2c40000, 0x50251879, 0xb8001002,
+0x000000c0, 0x7528f8c5, 0x57d0c5e8, 0xe9e3c4ec,
+0x60d8757c, 0xeec2d0c5, 0x79e2c400, 0x830feb0e,
+0x000000d5, 0xc95ce8c5, 0x7528f8c5, 0x00c5b8e8,
+0xe3c40000, 0xd86d6ce9, 0xc2f0c560, 0xe2c400ed,
+0x0feb0e79, 0x0000b083, 0x28f8c500, 0xf0c5e875,
+0xcab8cc57, 0xc4000000, 0x6d78e9e3, 0xf0c560d8,
+0xc400cdc2, 0xcb0e79e2, 0x008b830f, 0xe8c50000,
+0xc5d84d59, 0xc5e457c8, 0xc5eed0f3, 0xc5ccd0f3,
+0xd86528f8, 0x0000d4b8, 0xe9e3c400, 0x40e8755c,
+0xeec2d0c5, 0x79e2c400, 0x5d73eb0e, 0x5ee9e3c4,
+0xc540e865, 0x00e4c2f0, 0x0000d8b8, 0x79e2c400,
+0x4573e30e, 0x5d59e8c5, 0xd0e3c5d8, 0xf8c5e85d,
+0xb8e86d28, 0x000000de, 0x5c69e3c4, 0xc550d865,
+0x00dcc2e0, 0xe476d9c5, 0x0e79e2c4, 0xc41a73dc,
+0x555e69e3, 0xf0c550d8, 0xb800cac2, 0x000000e2,
+0x0e79e2c4, 0x310273cc, 0x00c3c9c0, 0x00000000,
+0x40000000, 0x00000000, 0x00000000, 0x00000000,
+0x41000000, 0x41100000, 0x41000000, 0x40a00000,
+0xc1000000, 0xc1100000, 0xc1000000, 0xc0a00000,
+0x00000000, 0x40400000, 0x40800000, 0x40400000,
+0x80000000, 0xc0400000, 0xc0800000, 0xc0400000,
+0001140,
+};
+asm(".type fma4_x86_32_D_16f4, STT_NOTYPE;");
+asm(".type fma4_x86_32_D_16f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma4_x86_32_D_16f8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xe8d955c3,
+0xec83e589, 0xc855dd38, 0x01f005d9, 0x55dd0010,
+0xddc9d9d8, 0xc9d9e855, 0xddd05ddd, 0x5ddde055,
+0x76e1c5f0, 0x28f9c5db, 0xa7b8d84d, 0xc4000000,
+0x556971e3, 0xe9c510c8, 0x020015c2, 0xc4000010,
+0xd30f79e2, 0x018c830f, 0xabb80000, 0xc4000000,
+0x557d71e3, 0xe9c510c8, 0x021015c2, 0xc4000010,
+0xd30f79e2, 0x016c830f, 0xafb80000, 0xc4000000,
+0x556d71e3, 0xe9c510c8, 0x022015c2, 0xc4000010,
+0xd30f79e2, 0x014c830f, 0xb3b80000, 0xc4000000,
+0x557971e3, 0xe9c510c8, 0x023015c2, 0xc4000010,
+0xd30f79e2, 0x012c830f, 0xf9c50000, 0xc5c85528,
+0xb8e958e9, 0x000000bb, 0x7528f9c5, 0xe9e3c4e8,
+0x60d86569, 0xe4c2d1c5, 0x79e2c400, 0x830fe30f,
+0x00000102, 0x2512fbc5, 0x00100230, 0x7528f9c5,
+0x57d1c5e8, 0xe9e3c4ec, 0x60d8757d, 0x0000c0b8,
+0xc2d1c500, 0xe2c400ee, 0x0feb0f79, 0x0000d583,
+0x5ce9c500, 0x00c5b8c9, 0xf9c50000, 0xc4e87528,
+0x6d6de9e3, 0xf1c560d8, 0xc400edc2, 0xeb0f79e2,
+0x00b0830f, 0xcab80000, 0xc5000000, 0xe87528f9,
+0xcc57f1c5, 0x79e9e3c4, 0xc560d86d, 0x00cdc2f1,
+0x0f79e2c4, 0x8b830fcb, 0xc5000000, 0xd84d59e9,
+0xe457c9c5, 0xeed0f1c5, 0xccd0f1c5, 0x0000d4b8,
+0x28f9c500, 0xe3c4d865, 0xe8755de9, 0xc2d1c540,
+0xe2c400ee, 0x73eb0f79, 0x00d8b85d, 0xe3c40000,
+0xe8655fe9, 0xc2f1c540, 0xe2c400e4, 0x73e30f79,
+0x59e9c545, 0xe1c5d85d, 0xb8e85dd0, 0x000000de,
+0x6d28f9c5, 0x69e3c4e8, 0x50d8655d, 0xdcc2e1c5,
+0x76d9c500, 0x79e2c4e4, 0x1a73dc0f, 0x0000e2b8,
+0x69e3c400, 0x50d8555f, 0xcac2f1c5, 0x79e2c400,
+0x0273cc0f, 0xc3c9c031, 0x00000000, 0x00000000,
+0x40000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x40100000, 0x00000000, 0x40080000,
+0x00000000, 0xc0100000, 0x00000000, 0xc0080000,
+0x00000000, 0x00000000, 0x00000000, 0x3ff00000,
+0x00000000, 0x80000000, 0x00000000, 0xbff00000,
+0001100,
+};
+asm(".type fma4_x86_32_D_16f8, STT_NOTYPE;");
+asm(".type fma4_x86_32_D_16f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma4_x86_32_D_32f4[] = {
+0x315500eb, 0x83e589c0, 0xc483e0e4, 0x0009b980,
+0x89400000, 0x244489ca, 0x83c2291c, 0x44c708f8,
+0x00005c84, 0x44db3f80, 0x54891c24, 0x5cd91c24,
+0x44db1c84, 0x5cd91c24, 0xd6753c84, 0x5428fcc5,
+0xfcc52024, 0x60247428, 0x4c28fcc5, 0xecc54024,
+0xd4c5ee58, 0xe2c4e959, 0x241d187d, 0xc4001002,
+0x646875e3, 0xb8102024, 0x000000a7, 0xe4c2d4c5,
+0x7de2c400, 0x830fe30e, 0x000001a6, 0x187de2c4,
+0x10022825, 0x75e3c400, 0x20247c7c, 0x57d4c510,
+0x00abb8ec, 0xd4c50000, 0xc400efc2, 0xeb0e7de2,
+0x017c830f, 0xecc50000, 0xecc5d65c, 0xafb8d159,
+0xc4000000, 0x6c6c75e3, 0xc5102024, 0x00edc2ec,
+0x0e7de2c4, 0x57830feb, 0xb8000001, 0x000000b3,
+0x7875e3c4, 0x1020246c, 0xd457ecc5, 0xd5c2ecc5,
+0x7de2c400, 0x830fd30e, 0x00000136, 0x5428fcc5,
+0xecc52024, 0xbbb8e958, 0xc5000000, 0x247428fc,
+0xede3c460, 0x40247468, 0xc2d4c560, 0xe2c400f6,
+0x0ff30e7d, 0x00010983, 0x00c0b800, 0xfcc50000,
+0x60247428, 0xec57d4c5, 0x7cede3c4, 0x60402474,
+0xeec2d4c5, 0x7de2c400, 0x830feb0e, 0x000000e2,
+0xc95cecc5, 0x0000c5b8, 0x28fcc500, 0xc4602474,
+0x6c6cede3, 0xc5604024, 0x00edc2f4, 0x0e7de2c4,
+0xbb830feb, 0xb8000000, 0x000000ca, 0x7428fcc5,
+0xf4c56024, 0xe3c4cc57, 0x246c78ed, 0xf4c56040,
+0xc400cdc2, 0xcb0e7de2, 0x0094830f, 0xecc50000,
+0x40244c59, 0xe457ccc5, 0xeed0f7c5, 0xccd0f7c5,
+0x0000d4b8, 0x28fcc500, 0xc4402464, 0x745cede3,
+0xc5406024, 0x00eec2d4, 0x0e7de2c4, 0xb86373eb,
+0x000000d8, 0x5eede3c4, 0x40602464, 0xeb28fcc5,
+0xe4c2f4c5, 0x7de2c400, 0x4673e30e, 0x5c59ecc5,
+0xe7c54024, 0x60245cd0, 0x0000deb8, 0x28fcc500,
+0xc4602464, 0x745c6de3, 0xc5404024, 0x00dec2e4,
+0x0e7de2c4, 0xb81b73dd, 0x000000e2, 0x5e6de3c4,
+0x40402454, 0xcac2f4c5, 0x7de2c400, 0x0273cd0e,
+0xc3c9c031, 0xffffffff, 0x80000000,
+0001054,
+};
+asm(".type fma4_x86_32_D_32f4, STT_NOTYPE;");
+asm(".type fma4_x86_32_D_32f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma4_x86_32_D_32f8[] = {
+0x315500eb, 0x83e589c0, 0xc483e0e4, 0x0005b980,
+0x89400000, 0x244489ca, 0xc7c2291c, 0x005cc444,
+0xdb3ff000, 0x891c2444, 0x311c2454, 0x04f883d2,
+0x58c45489, 0x18c45cdd, 0x1c2444db, 0x38c45cdd,
+0xfdc5d075, 0x20245428, 0x7428fdc5, 0xfdc56024,
+0x40244c28, 0xee58edc5, 0xe959d5c5, 0x197de2c4,
+0x1002301d, 0x75e3c400, 0x20246469, 0x00a7b810,
+0xd5c50000, 0xc400e4c2, 0xe30f7de2, 0x01a6830f,
+0xe2c40000, 0x3825197d, 0xc4001002, 0x7c7d75e3,
+0xc5102024, 0xb8ec57d5, 0x000000ab, 0xefc2d5c5,
+0x7de2c400, 0x830feb0f, 0x0000017c, 0xd65cedc5,
+0xd159edc5, 0x0000afb8, 0x75e3c400, 0x20246c6d,
+0xc2edc510, 0xe2c400ed, 0x0feb0f7d, 0x00015783,
+0x00b3b800, 0xe3c40000, 0x246c7975, 0xedc51020,
+0xedc5d457, 0xc400d5c2, 0xd30f7de2, 0x0136830f,
+0xfdc50000, 0x20245428, 0xe958edc5, 0x0000bbb8,
+0x28fdc500, 0xc4602474, 0x7469ede3, 0xc5604024,
+0x00f6c2d5, 0x0f7de2c4, 0x09830ff3, 0xb8000001,
+0x000000c0, 0x7428fdc5, 0xd5c56024, 0xe3c4ec57,
+0x24747ded, 0xd5c56040, 0xc400eec2, 0xeb0f7de2,
+0x00e2830f, 0xedc50000, 0xc5b8c95c, 0xc5000000,
+0x247428fd, 0xede3c460, 0x40246c6d, 0xc2f5c560,
+0xe2c400ed, 0x0feb0f7d, 0x0000bb83, 0x00cab800,
+0xfdc50000, 0x60247428, 0xcc57f5c5, 0x79ede3c4,
+0x6040246c, 0xcdc2f5c5, 0x7de2c400, 0x830fcb0f,
+0x00000094, 0x4c59edc5, 0xcdc54024, 0xf5c5e457,
+0xf5c5eed0, 0xd4b8ccd0, 0xc5000000, 0x246428fd,
+0xede3c440, 0x6024745d, 0xc2d5c540, 0xe2c400ee,
+0x73eb0f7d, 0x00d8b863, 0xe3c40000, 0x24645fed,
+0xfdc54060, 0xf5c5eb28, 0xc400e4c2, 0xe30f7de2,
+0xedc54673, 0x40245c59, 0x5cd0e5c5, 0xdeb86024,
+0xc5000000, 0x246428fd, 0x6de3c460, 0x4024745d,
+0xc2e5c540, 0xe2c400de, 0x73dd0f7d, 0x00e2b81b,
+0xe3c40000, 0x24545f6d, 0xf5c54040, 0xc400cac2,
+0xcd0f7de2, 0xc0310273, 0x0000c3c9, 0x00000000,
+0xffffffff, 0xffffffff, 0x00000000, 0x80000000,
+0001100,
+};
+asm(".type fma4_x86_32_D_32f8, STT_NOTYPE;");
+asm(".type fma4_x86_32_D_32f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma4_x86_32_D_f4[] = {
+0x895500eb, 0x70ec83e5, 0x0d10fac5, 0x00100170,
+0x4d11fac5, 0x11fac59c, 0xfac5a04d, 0xc5a44d11,
+0xa04d10fa, 0x6a71e3c4, 0xc5109c4d, 0x740d2ef8,
+0x0f001001, 0x0000f08a, 0xea850f00, 0xc5000000,
+0xa04d10fa, 0x7e71e3c4, 0xc5109c4d, 0x780d2ef8,
+0x0f001001, 0x0000d78a, 0xd1850f00, 0xc5000000,
+0xa04d10fa, 0xd257e8c5, 0x6e71e3c4, 0xc5109c4d,
+0x0fca2ef8, 0x0000be8a, 0xb8850f00, 0xc5000000,
+0xa04d10fa, 0x7a71e3c4, 0xc5109c4d, 0x0fca2ef8,
+0x0000a98a, 0xa3850f00, 0xc5000000, 0x9c4d10fa,
+0x6510fac5, 0x58f2c5a0, 0x10fac5d4, 0xfac59c75,
+0xc4a47d10, 0x5d6ac9e3, 0xf8c570a0, 0x8a0fd32e,
+0x00000081, 0xfac57f75, 0x01801d10, 0xfac50010,
+0xc59c6d10, 0xa47510fa, 0xd357e8c5, 0x7ed1e3c4,
+0xc560a06d, 0x7aea2ef8, 0xc5617563, 0xc5cc5cf2,
+0x9c7d10fa, 0x6510fac5, 0xc1e3c4a4, 0x40a0556e,
+0xca2ef8c5, 0x4b754d7a, 0x6d10fac5, 0x57f0c59c,
+0x10fac5cb, 0xe3c4a475, 0xa0557ad1, 0x2ef8c560,
+0x75377ad1, 0xebc03135, 0x00a7b836, 0x2feb0000,
+0x0000abb8, 0xb828eb00, 0x000000af, 0xb3b821eb,
+0xeb000000, 0x00bbb81a, 0x13eb0000, 0x0000c0b8,
+0xb80ceb00, 0x000000c5, 0xcab805eb, 0xc9000000,
+0x000000c3, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x40000000, 0xc0000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0000620,
+};
+asm(".type fma4_x86_32_D_f4, STT_NOTYPE;");
+asm(".type fma4_x86_32_D_f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma4_x86_32_D_f8[] = {
+0x895500eb, 0xd0ec81e5, 0xc5000000, 0xc00d10fb,
+0xc5001001, 0x388d11fb, 0xc5ffffff, 0x408d11fb,
+0xc5ffffff, 0x488d11fb, 0xc5ffffff, 0x408d10fb,
+0xc4ffffff, 0x8d6b71e3, 0xffffff38, 0x2ef9c510,
+0x1001c80d, 0x308a0f00, 0x0f000001, 0x00012a85,
+0x10fbc500, 0xffff408d, 0x71e3c4ff, 0xff388d7f,
+0xc510ffff, 0xd00d2ef9, 0x0f001001, 0x0001118a,
+0x0b850f00, 0xc5000001, 0xc5d257e9, 0x408d10fb,
+0xc4ffffff, 0x8d6f71e3, 0xffffff38, 0x2ef9c510,
+0xf28a0fca, 0x0f000000, 0x0000ec85, 0x10fbc500,
+0xffff408d, 0x71e3c4ff, 0xff388d7b, 0xc510ffff,
+0x0fca2ef9, 0x0000d78a, 0xd1850f00, 0xc5000000,
+0x388d10fb, 0xc5ffffff, 0x40a510fb, 0xc5ffffff,
+0xc5d458f3, 0x38b510fb, 0xc5ffffff, 0x48bd10fb,
+0xc4ffffff, 0x9d6bc9e3, 0xffffff40, 0x2ef9c570,
+0xa08a0fd3, 0x0f000000, 0x00009a85, 0x7efac500,
+0x1001e01d, 0x10fbc500, 0xffff38ad, 0x10fbc5ff,
+0xffff48b5, 0x57e9c5ff, 0xd1e3c4d3, 0xff40ad7f,
+0xc560ffff, 0x7aea2ef9, 0xc5737575, 0xc5cc5cf3,
+0x38bd10fb, 0xc5ffffff, 0x48a510fb, 0xc4ffffff,
+0x956fc1e3, 0xffffff40, 0x2ef9c540, 0x75567aca,
+0x10fbc554, 0xffff38ad, 0x10fbc5ff, 0xffff48b5,
+0x57f1c5ff, 0xd1e3c4cb, 0xff40957b, 0xc560ffff,
+0x7ad12ef9, 0x31357537, 0xb836ebc0, 0x000000a7,
+0xabb82feb, 0xeb000000, 0x00afb828, 0x21eb0000,
+0x0000b3b8, 0xb81aeb00, 0x000000bb, 0xc0b813eb,
+0xeb000000, 0x00c5b80c, 0x05eb0000, 0x0000cab8,
+0x00c3c900, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0xc0000000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x00000000,
+0000760,
+};
+asm(".type fma4_x86_32_D_f8, STT_NOTYPE;");
+asm(".type fma4_x86_32_D_f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma4_x86_64_D_16f4[] = {
+0xb84800eb, 0x3f800000, 0x40000000, 0xe5894855,
+0xd0458948, 0x0000b848, 0x00004040, 0x89484080,
+0xb848d845, 0x40800000, 0x40400000, 0xe0458948,
+0x000001b8, 0xe0c148fe, 0x4589481e, 0x002d48e8,
+0x48008000, 0x48f04589, 0xc5f84589, 0xe04d28f8,
+0x6871e3c4, 0xc510d05d, 0xb8d276e9, 0x000000a7,
+0x1dc2e0c5, 0x00000197, 0x79e2c400, 0x830fda0e,
+0x0000018a, 0x7c71e3c4, 0xb810d05d, 0x000000ab,
+0x1dc2e0c5, 0x00000187, 0x79e2c400, 0x830fda0e,
+0x0000016a, 0x6c71e3c4, 0xb810d05d, 0x000000af,
+0x1dc2e0c5, 0x00000177, 0x79e2c400, 0x830fda0e,
+0x0000014a, 0x7871e3c4, 0xb810d05d, 0x000000b3,
+0x1dc2e0c5, 0x00000167, 0x79e2c400, 0x830fda0e,
+0x0000012a, 0x5d28f8c5, 0x58e0c5d0, 0x28f8c5e1,
+0xe3c4f075, 0xe06d68e1, 0x00bbb860, 0xd8c50000,
+0xc400edc2, 0xea0e79e2, 0x0100830f, 0xf8c50000,
+0xc4f07528, 0x6d7ce1e3, 0xc0b860e0, 0xc4000000,
+0x351879e2, 0x00000118, 0xe657d8c5, 0xe5c2d8c5,
+0x79e2c400, 0x830fe20e, 0x000000d2, 0xc95ce0c5,
+0x6d28f8c5, 0xe1e3c4f0, 0x50e0656c, 0x0000c5b8,
+0xc2f0c500, 0xe2c400e4, 0x0fe20e79, 0x0000ad83,
+0x28f8c500, 0xe3c4f06d, 0xe06578e1, 0x57f0c550,
+0x00cab8ce, 0xf0c50000, 0xc400ccc2, 0xca0e79e2,
+0x0088830f, 0xe0c50000, 0xc5e04d59, 0xf06557c8,
+0xedd0f3c5, 0xccd0f3c5, 0x6528f8c5, 0xe1e3c4e0,
+0x40f0755c, 0x0000d4b8, 0xc2d0c500, 0xe2c400ee,
+0x73ea0e79, 0xe1e3c459, 0x40f0655e, 0x0000d8b8,
+0xc2f0c500, 0xe2c400e4, 0x73e20e79, 0x59e0c541,
+0xdbc5e065, 0xc5f065d0, 0xf06d28f8, 0x5c61e3c4,
+0xb850e075, 0x000000de, 0xe6c2d8c5, 0x79e2c400,
+0x1a73e20e, 0x5e61e3c4, 0xb850e05d, 0x000000e2,
+0xcbc2f0c5, 0x79e2c400, 0x0273ca0e, 0xc35dc031,
+0x41000000, 0x41100000, 0x41000000, 0x40a00000,
+0xc1000000, 0xc1100000, 0xc1000000, 0xc0a00000,
+0x00000000, 0x40400000, 0x40800000, 0x40400000,
+0x80000000, 0xc0400000, 0xc0800000, 0xc0400000,
+0001100,
+};
+asm(".type fma4_x86_64_D_16f4, STT_NOTYPE;");
+asm(".type fma4_x86_64_D_16f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma4_x86_64_D_16f8[] = {
+0x485500eb, 0xfbc5e589, 0x021a0d10, 0xfbc50000,
+0x01da1510, 0xfbc50000, 0xc5d04d11, 0xe05511fb,
+0x4d11fbc5, 0x11fbc5f0, 0xfbc5d855, 0xc5e84d11,
+0xf84d11fb, 0x4d28f9c5, 0x71e3c4e0, 0x10d05d69,
+0xd276e9c5, 0x0000a7b8, 0xc2e1c500, 0x0001ae1d,
+0xe2c40000, 0x0fda0f79, 0x00018983, 0x71e3c400,
+0x10d05d7d, 0x0000abb8, 0xc2e1c500, 0x00019e1d,
+0xe2c40000, 0x0fda0f79, 0x00016983, 0x71e3c400,
+0x10d05d6d, 0x0000afb8, 0xc2e1c500, 0x00018e1d,
+0xe2c40000, 0x0fda0f79, 0x00014983, 0x71e3c400,
+0x10d05d79, 0x0000b3b8, 0xc2e1c500, 0x00017e1d,
+0xe2c40000, 0x0fda0f79, 0x00012983, 0x28f9c500,
+0xe1c5d05d, 0xf9c5e158, 0xc4f07528, 0x6d69e1e3,
+0xbbb860e0, 0xc5000000, 0x00edc2d9, 0x0f79e2c4,
+0xff830fea, 0xc5000000, 0xf07528f9, 0x7de1e3c4,
+0xb860e06d, 0x000000c0, 0x3512fbc5, 0x00000130,
+0xe657d9c5, 0xe5c2d9c5, 0x79e2c400, 0x830fe20f,
+0x000000d2, 0xc95ce1c5, 0x6d28f9c5, 0xe1e3c4f0,
+0x50e0656d, 0x0000c5b8, 0xc2f1c500, 0xe2c400e4,
+0x0fe20f79, 0x0000ad83, 0x28f9c500, 0xe3c4f06d,
+0xe06579e1, 0x57f1c550, 0x00cab8ce, 0xf1c50000,
+0xc400ccc2, 0xca0f79e2, 0x0088830f, 0xe1c50000,
+0xc5e04d59, 0xf06557c9, 0xedd0f1c5, 0xccd0f1c5,
+0x6528f9c5, 0xe1e3c4e0, 0x40f0755d, 0x0000d4b8,
+0xc2d1c500, 0xe2c400ee, 0x73ea0f79, 0xe1e3c459,
+0x40f0655f, 0x0000d8b8, 0xc2f1c500, 0xe2c400e4,
+0x73e20f79, 0x59e1c541, 0xd9c5e065, 0xc5f065d0,
+0xf06d28f9, 0x5d61e3c4, 0xb850e075, 0x000000de,
+0xe6c2d9c5, 0x79e2c400, 0x1a73e20f, 0x5f61e3c4,
+0xb850e05d, 0x000000e2, 0xcbc2f1c5, 0x79e2c400,
+0x0273ca0f, 0xc35dc031, 0x00000000, 0x00000000,
+0x00000000, 0x40000000, 0x00000000, 0x00000000,
+0x00000000, 0x40100000, 0x00000000, 0x40080000,
+0x00000000, 0xc0100000, 0x00000000, 0xc0080000,
+0x00000000, 0x00000000, 0x00000000, 0x3ff00000,
+0x00000000, 0x80000000, 0x00000000, 0xbff00000,
+0001100,
+};
+asm(".type fma4_x86_64_D_16f8, STT_NOTYPE;");
+asm(".type fma4_x86_64_D_16f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma4_x86_64_D_32f4[] = {
+0xb85500eb, 0x00000001, 0x000009b9, 0xe5894800,
+0xe0e48348, 0x0d10fac5, 0x00000210, 0xd02aeac5,
+0xfac5ca89, 0xdc844c11, 0xfac5c229, 0x9c845411,
+0xd22aeac5, 0x5411fac5, 0xff48bc84, 0xf88348c0,
+0xc5d97509, 0x245c28fc, 0x28fcc5a0, 0xc5e02474,
+0x244c28fc, 0x58e4c5c0, 0x59dcc5e6, 0x75e3c4e1,
+0xa0246c68, 0x00a7b810, 0xe2c40000, 0xbd15187d,
+0xc5000001, 0x00edc2dc, 0x0e7de2c4, 0xa4830fea,
+0xc4000001, 0x7c7c75e3, 0xb810a024, 0x000000ab,
+0x187de2c4, 0x00019b2d, 0x57dcc500, 0xc2dcc5e5,
+0xe2c400e7, 0x0fe20e7d, 0x00017a83, 0x5ce4c500,
+0x59e4c5de, 0x75e3c4d9, 0xa024646c, 0x00afb810,
+0xe4c50000, 0xc400e4c2, 0xe20e7de2, 0x0155830f,
+0xe3c40000, 0x24647875, 0xe4c510a0, 0xb3b8dd57,
+0xc5000000, 0x00dcc2e4, 0x0e7de2c4, 0x34830fda,
+0xc5000001, 0x245c28fc, 0x58e4c5a0, 0x28fcc5e1,
+0xc4e02474, 0x7468e5e3, 0xb860c024, 0x000000bb,
+0xf6c2dcc5, 0x7de2c400, 0x830ff20e, 0x00000107,
+0x7428fcc5, 0xdcc5e024, 0xc0b8e557, 0xc4000000,
+0x747ce5e3, 0xc560c024, 0x00e6c2dc, 0x0e7de2c4,
+0xe0830fe2, 0xc5000000, 0xc5c95ce4, 0x247428fc,
+0xe5e3c4e0, 0xc024646c, 0x00c5b860, 0xf4c50000,
+0xc400e4c2, 0xe20e7de2, 0x00b9830f, 0xfcc50000,
+0xe0247428, 0xcd57f4c5, 0x0000cab8, 0xe5e3c400,
+0xc0246478, 0xc2f4c560, 0xe2c400cc, 0x0fca0e7d,
+0x00009283, 0x59e4c500, 0xc5c0244c, 0x246457d4,
+0xd0f7c5e0, 0xd0f7c5f6, 0x28fcc5cc, 0xc4c02464,
+0x6c5ce5e3, 0xb840e024, 0x000000d4, 0xedc2ccc5,
+0x7de2c400, 0x5f73ea0e, 0x5ee5e3c4, 0x40e02464,
+0x0000d8b8, 0xc2f4c500, 0xe2c400e4, 0x73e20e7d,
+0x59e4c546, 0xc5c02464, 0x2464d0df, 0x28fcc5e0,
+0xc4e0246c, 0x745c65e3, 0xb850c024, 0x000000de,
+0xe6c2dcc5, 0x7de2c400, 0x1b73e20e, 0x5e65e3c4,
+0x50c0245c, 0x0000e2b8, 0xc2f4c500, 0xe2c400cb,
+0x73ca0e7d, 0xc9c03102, 0x000000c3, 0x3f800000,
+0xffffffff, 0x80000000,
+0001070,
+};
+asm(".type fma4_x86_64_D_32f4, STT_NOTYPE;");
+asm(".type fma4_x86_64_D_32f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma4_x86_64_D_32f8[] = {
+0x485500eb, 0x8348e589, 0xfbc5e0e4, 0x024e0d10,
+0xfbc50000, 0x02b61510, 0xfbc50000, 0x02461d10,
+0xfbc50000, 0x029e2510, 0xfbc50000, 0xa0244c11,
+0x5411fbc5, 0xfbc5c024, 0xe0244c11, 0x5c11fbc5,
+0xfbc5a824, 0xc8246411, 0x4c11fbc5, 0xfbc5e824,
+0xb0246411, 0x5c11fbc5, 0xfbc5d024, 0xf0244c11,
+0x5411fbc5, 0xfbc5b824, 0xd8244c11, 0x4c11fbc5,
+0xfdc5f824, 0xc0244c28, 0x6975e3c4, 0x10a0245c,
+0x0000a7b8, 0x7de2c400, 0x01e21519, 0xe5c50000,
+0x01e91dc2, 0xc4000000, 0xda0f7de2, 0x01a0830f,
+0xe3c40000, 0x245c7d75, 0xabb810a0, 0xc5000000,
+0xe81dc2e5, 0x00000001, 0x0f7de2c4, 0x7f830fda,
+0xc4000001, 0x5c6d75e3, 0xb810a024, 0x000000af,
+0x1dc2e5c5, 0x000001e7, 0x7de2c400, 0x830fda0f,
+0x0000015e, 0x7975e3c4, 0x10a0245c, 0x0000b3b8,
+0xc2e5c500, 0x0001e61d, 0xe2c40000, 0x0fda0f7d,
+0x00013d83, 0x28fdc500, 0xc5a0245c, 0xc5e158e5,
+0x247428fd, 0xe5e3c4e0, 0xc0246c69, 0x00bbb860,
+0xddc50000, 0xc400edc2, 0xea0f7de2, 0x0110830f,
+0xfdc50000, 0xe0247428, 0x7de5e3c4, 0x60c0246c,
+0x0000c0b8, 0x7de2c400, 0x01923519, 0xddc50000,
+0xddc5e657, 0xc400e5c2, 0xe20f7de2, 0x00e0830f,
+0xe5c50000, 0xfdc5c95c, 0xe0246c28, 0x6de5e3c4,
+0x50c02464, 0x0000c5b8, 0xc2f5c500, 0xe2c400e4,
+0x0fe20f7d, 0x0000b983, 0x28fdc500, 0xc5e0246c,
+0xb8ce57f5, 0x000000ca, 0x79e5e3c4, 0x50c02464,
+0xccc2f5c5, 0x7de2c400, 0x830fca0f, 0x00000092,
+0x4c59e5c5, 0xcdc5c024, 0xe0246457, 0xedd0f5c5,
+0xccd0f5c5, 0x6428fdc5, 0xe3c4c024, 0x24745de5,
+0xd4b840e0, 0xc5000000, 0x00eec2d5, 0x0f7de2c4,
+0xc45f73ea, 0x645fe5e3, 0xb840e024, 0x000000d8,
+0xe4c2f5c5, 0x7de2c400, 0x4673e20f, 0x6459e5c5,
+0xddc5c024, 0xe02464d0, 0x6c28fdc5, 0xe3c4e024,
+0x24745d65, 0xdeb850c0, 0xc5000000, 0x00e6c2dd,
+0x0f7de2c4, 0xc41b73e2, 0x5c5f65e3, 0xb850c024,
+0x000000e2, 0xcbc2f5c5, 0x7de2c400, 0x0273ca0f,
+0xc3c9c031, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+0x00000000, 0x40200000, 0x00000000, 0x40220000,
+0x00000000, 0x40200000, 0x00000000, 0x40140000,
+0x00000000, 0xc0200000, 0x00000000, 0xc0220000,
+0x00000000, 0xc0200000, 0x00000000, 0xc0140000,
+0x00000000, 0x00000000, 0x00000000, 0x40080000,
+0x00000000, 0x40100000, 0x00000000, 0x40080000,
+0x00000000, 0x80000000, 0x00000000, 0xc0080000,
+0x00000000, 0xc0100000, 0x00000000, 0xc0080000,
+0001400,
+};
+asm(".type fma4_x86_64_D_32f8, STT_NOTYPE;");
+asm(".type fma4_x86_64_D_32f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma4_x86_64_D_f4[] = {
+0x485500eb, 0xfac5e589, 0x01520d10, 0xfac50000,
+0xc59c4d11, 0xa04d11fa, 0x4d11fac5, 0x10fac5a4,
+0xe3c4a04d, 0x9c4d6a71, 0x2ef8c510, 0x0001330d,
+0xf08a0f00, 0x0f000000, 0x0000ea85, 0x10fac500,
+0xe3c4a04d, 0x9c4d7e71, 0x2ef8c510, 0x0001170d,
+0xd78a0f00, 0x0f000000, 0x0000d185, 0x10fac500,
+0xe3c4a04d, 0x9c4d6e71, 0x57e8c510, 0x2ef8c5d2,
+0xbe8a0fca, 0x0f000000, 0x0000b885, 0x10fac500,
+0xe3c4a04d, 0x9c4d7a71, 0x2ef8c510, 0xa98a0fca,
+0x0f000000, 0x0000a385, 0x10fac500, 0xfac59c4d,
+0xc5a06510, 0xc5d458f2, 0x9c7510fa, 0x7d10fac5,
+0xc9e3c4a4, 0x70a05d6a, 0xd32ef8c5, 0x00818a0f,
+0x7f750000, 0x6d10fac5, 0x10fac59c, 0xfac5a475,
+0x009a1d10, 0xe3c40000, 0xa06d7ed1, 0x57e8c560,
+0x2ef8c5d3, 0x75637aea, 0x5cf2c561, 0x10fac5cc,
+0xfac59c7d, 0xc4a46510, 0x556ec1e3, 0xf8c540a0,
+0x4d7aca2e, 0xfac54b75, 0xc59c6d10, 0xa47510fa,
+0xcb57f0c5, 0x7ad1e3c4, 0xc560a055, 0x7ad12ef8,
+0x31357537, 0xb836ebc0, 0x000000a7, 0xabb82feb,
+0xeb000000, 0x00afb828, 0x21eb0000, 0x0000b3b8,
+0xb81aeb00, 0x000000bb, 0xc0b813eb, 0xeb000000,
+0x00c5b80c, 0x05eb0000, 0x0000cab8, 0x00c35d00,
+0x3f800000, 0x40000000, 0xc0000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0000600,
+};
+asm(".type fma4_x86_64_D_f4, STT_NOTYPE;");
+asm(".type fma4_x86_64_D_f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) fma4_x86_64_D_f8[] = {
+0x485500eb, 0x8348e589, 0xfbc558ec, 0x01ae0d10,
+0xfbc50000, 0xff388d11, 0xfbc5ffff, 0xff408d11,
+0xfbc5ffff, 0xff488d11, 0xfbc5ffff, 0xff408d10,
+0xe3c4ffff, 0x388d6b71, 0x10ffffff, 0x0d2ef9c5,
+0x00000184, 0x01308a0f, 0x850f0000, 0x0000012a,
+0x8d10fbc5, 0xffffff40, 0x7f71e3c4, 0xffff388d,
+0xf9c510ff, 0x01660d2e, 0x8a0f0000, 0x00000111,
+0x010b850f, 0xfbc50000, 0xff408d10, 0xe9c5ffff,
+0xe3c4d257, 0x388d6f71, 0x10ffffff, 0xca2ef9c5,
+0x00f28a0f, 0x850f0000, 0x000000ec, 0x8d10fbc5,
+0xffffff40, 0x7b71e3c4, 0xffff388d, 0xf9c510ff,
+0x8a0fca2e, 0x000000d7, 0x00d1850f, 0xfbc50000,
+0xff388d10, 0xfbc5ffff, 0xff40a510, 0xf3c5ffff,
+0xfbc5d458, 0xff38b510, 0xfbc5ffff, 0xff48bd10,
+0xe3c4ffff, 0x409d6bc9, 0x70ffffff, 0xd32ef9c5,
+0x00a08a0f, 0x850f0000, 0x0000009a, 0xad10fbc5,
+0xffffff38, 0xb510fbc5, 0xffffff48, 0x7fd1e3c4,
+0xffff40ad, 0xfac560ff, 0x00c21d7e, 0xe9c50000,
+0xf9c5d357, 0x757aea2e, 0xf3c57375, 0xfbc5cc5c,
+0xff38bd10, 0xfbc5ffff, 0xff48a510, 0xe3c4ffff,
+0x40956fc1, 0x40ffffff, 0xca2ef9c5, 0x5475567a,
+0xad10fbc5, 0xffffff38, 0xb510fbc5, 0xffffff48,
+0xcb57f1c5, 0x7bd1e3c4, 0xffff4095, 0xf9c560ff,
+0x377ad12e, 0xc0313575, 0xa7b836eb, 0xeb000000,
+0x00abb82f, 0x28eb0000, 0x0000afb8, 0xb821eb00,
+0x000000b3, 0xbbb81aeb, 0xeb000000, 0x00c0b813,
+0x0ceb0000, 0x0000c5b8, 0xb805eb00, 0x000000ca,
+0x0000c3c9, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x40000000,
+0x00000000, 0xc0000000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x00000000,
+0000760,
+};
+asm(".type fma4_x86_64_D_f8, STT_NOTYPE;");
+asm(".type fma4_x86_64_D_f8, STT_FUNC;");
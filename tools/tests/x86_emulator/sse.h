@@ -0,0 +1,258 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse_x86_32_D_16f4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xe8d955c3,
+0xec83e589, 0xc855d968, 0x021405d9, 0x55d90010,
+0xd9c9d9d8, 0x05d9e855, 0x00100218, 0xd9cc55d9,
+0x10021c05, 0xdc55d900, 0xe0d9e8d9, 0xd9ec55d9,
+0xd05dd9c9, 0x5dd9c9d9, 0xd9c9d9e0, 0xcad9f055,
+0xd9d45dd9, 0xe45dd9c9, 0x0ff45dd9, 0x0fc86d28,
+0x0f986d29, 0xb8984528, 0x00000539, 0x0fc8280f,
+0x0f00cdc2, 0xfa83d150, 0x90850f0f, 0x0f000001,
+0x0fc84d28, 0x290fc858, 0x280fa84d, 0x3fb8c84d,
+0x0f000005, 0xc20fc958, 0x0f00a84d, 0xfa83d150,
+0x68850f0f, 0x0f000001, 0x0fa84d28, 0x0fc84d5c,
+0x0fb84d29, 0x44b8c828, 0x0f000005, 0x00b84dc2,
+0x83d1500f, 0x850f0ffa, 0x00000143, 0xd855280f,
+0xc845590f, 0x0fd2590f, 0x0fc84d28, 0x0fd86528,
+0x280fe158, 0x055bb8d9, 0x5c0f0000, 0x5c0fd85d,
+0xdc590fc2, 0x00c3c20f, 0x83d0500f, 0x850f0ffa,
+0x0000010b, 0xe845280f, 0x0fc1590f, 0x0f984529,
+0xb8e84d5e, 0x00000564, 0x00c1c20f, 0x83d0500f,
+0x850f0ffa, 0x000000e7, 0x1d100ff3, 0x00100220,
+0x000567b8, 0x4d280f00, 0xd1280fe8, 0x00dbc60f,
+0xc845280f, 0x0fd3570f, 0x0f985559, 0xc20fd857,
+0x500f00d3, 0x0ffa83d2, 0x00b1850f, 0x280f0000,
+0xd0590fd0, 0x9855290f, 0x9855510f, 0x00059cb8,
+0xd0c20f00, 0xd2500f00, 0x0f0ffa83, 0x00008e85,
+0xd0280f00, 0x0fd1590f, 0x0fd84d59, 0x0fa84d29,
+0x5f0fca28, 0x5d0fa84d, 0x290fa855, 0x580fa855,
+0x3db8a84d, 0x0f000006, 0x0fe84d59, 0x0fd84558,
+0x0f00c1c2, 0xfa83d050, 0x0f54750f, 0xb8c84528,
+0x0000064e, 0x1bc0c60f, 0xd845c20f, 0xd0500f00,
+0x750ffa83, 0x45280f3a, 0x45140fd8, 0x4d280fc8,
+0x4d150fd8, 0xc15c0fc8, 0x0006a8ba, 0x100ff300,
+0x1002180d, 0x45590f00, 0xc9c60fe8, 0xc1c20f00,
+0xc0500f00, 0xb80ff883, 0x00000000, 0xc9c2450f,
+0x000000c3, 0x40800000, 0x40000000, 0x40400000,
+0x80000000,
+0001044,
+};
+asm(".type sse_x86_32_D_16f4, STT_NOTYPE;");
+asm(".type sse_x86_32_D_16f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse_x86_32_D_f4[] = {
+0x89551eeb, 0x458952e5, 0x80c031fc, 0xfffc287c,
+0x83400a75, 0xf37504f8, 0x02eb01b0, 0xc3c9c031,
+0x81e58955, 0x0000e8ec, 0x100ff300, 0x10049005,
+0x110ff300, 0xffff4085, 0x110ff3ff, 0xffff4485,
+0x110ff3ff, 0xffff4885, 0x40858bff, 0x89ffffff,
+0xffff3485, 0x100ff3ff, 0xffff4085, 0xb9c031ff,
+0x00000000, 0x34852e0f, 0x0fffffff, 0x450fc09b,
+0xe8d8f7c1, 0xffffff8a, 0x39b8c288, 0x84000005,
+0xfa840fd2, 0xf3000003, 0x3485100f, 0xf3ffffff,
+0x4085580f, 0xf3ffffff, 0x3885110f, 0xf3ffffff,
+0x4085100f, 0x31ffffff, 0x580ff3c0, 0x852e0fc0,
+0xffffff38, 0x0fc09b0f, 0xd8f7c145, 0xffff41e8,
+0xb8c288ff, 0x0000053f, 0x840fd284, 0x000003b1,
+0x85100ff3, 0xffffff38, 0x855c0ff3, 0xffffff40,
+0x85110ff3, 0xffffff18, 0xff18858b, 0x8589ffff,
+0xffffff74, 0xff388589, 0x8589ffff, 0xffffff3c,
+0x85100ff3, 0xffffff34, 0x2e0fc031, 0xffff3c85,
+0xc09b0fff, 0xf7c1450f, 0xfee4e8d8, 0xc288ffff,
+0x000544b8, 0x0fd28400, 0x00035484, 0x100ff300,
+0xffff3485, 0x590ff3ff, 0xffff4085, 0x110ff3ff,
+0xffff3485, 0x100ff3ff, 0xffff4485, 0x590ff3ff,
+0x110ff3c0, 0xffff3885, 0x100ff3ff, 0xffff4085,
+0x580ff3ff, 0xffff4485, 0x110ff3ff, 0xffff3c85,
+0x100ff3ff, 0xffff4085, 0xf3c031ff, 0x3495100f,
+0x0fffffff, 0x0ff3c828, 0xff448d5c, 0x0ff3ffff,
+0xff38955c, 0x0ff3ffff, 0xff3c8d59, 0x0ff3ffff,
+0xff3c8d11, 0x2e0fffff, 0xc09b0fd1, 0xf7c1450f,
+0xfe4ce8d8, 0xc288ffff, 0x00055bb8, 0x0fd28400,
+0x0002bc84, 0x590ff300, 0xffff4885, 0x110ff3ff,
+0xffff3485, 0x100ff3ff, 0xffff4085, 0xf3c031ff,
+0x48855e0f, 0x0fffffff, 0xff34852e, 0x0ff3ffff,
+0xff388511, 0x9b0fffff, 0xc1450fc0, 0xffe8d8f7,
+0x88fffffd, 0x0564b8c2, 0xd2840000, 0x026f840f,
+0x0ff30000, 0x04a01510, 0xc0310010, 0x85100ff3,
+0xffffff48, 0x8d100ff3, 0xffffff40, 0xf3c2570f,
+0x3485590f, 0x0fffffff, 0x2e0fca57, 0xc09b0fc1,
+0xf7c1450f, 0xfdb8e8d8, 0xc288ffff, 0x000567b8,
+0x0fd28400, 0x00022884, 0x2c0ff300, 0xffff4085,
+0x4c8589ff, 0xf3ffffff, 0x4c852a0f, 0xf3ffffff,
+0x3485110f, 0xf3ffffff, 0x3485100f, 0x31ffffff,
+0x852e0fc0, 0xffffff40, 0x0fc09b0f, 0xd8f7c145,
+0xfffd6de8, 0xb8c288ff, 0x0000056e, 0x840fd284,
+0x000001dd, 0x85530ff3, 0xffffff40, 0x85110ff3,
+0xffffff34, 0x85530ff3, 0xffffff34, 0xc02c0ff3,
+0xff4c8589, 0x0ff3ffff, 0xff4c8d2a, 0xc031ffff,
+0x85100ff3, 0xffffff40, 0x0fc82e0f, 0x450fc09b,
+0xe8d8f7c1, 0xfffffd1a, 0x75b8c288, 0x84000005,
+0x8a840fd2, 0xf3000001, 0xf3c0590f, 0x3485110f,
+0xf3ffffff, 0x3485520f, 0xf3ffffff, 0x3885110f,
+0xf3ffffff, 0x3885530f, 0xf3ffffff, 0x89c02c0f,
+0xffff4c85, 0x2a0ff3ff, 0xffff4c85, 0x0fc031ff,
+0xff40852e, 0x9b0fffff, 0xc1450fc0, 0xbfe8d8f7,
+0x88fffffc, 0x057cb8c2, 0xd2840000, 0x012f840f,
+0x0ff30000, 0xff38852c, 0x8589ffff, 0xffffff4c,
+0x85530ff3, 0xffffff40, 0xc02c0ff3, 0x8d2a0ff3,
+0xffffff4c, 0xff4c8589, 0x0ff3ffff, 0xff4c852a,
+0xc031ffff, 0x0fc82e0f, 0x450fc09b, 0xe8d8f7c1,
+0xfffffc6e, 0x7eb8c288, 0x84000005, 0xde840fd2,
+0xf3000000, 0x4085100f, 0xf3ffffff, 0xf3c0590f,
+0x3485110f, 0xf3ffffff, 0x408d100f, 0x31ffffff,
+0x510ff3c0, 0xffff3485, 0xc12e0fff, 0x0fc09b0f,
+0xd8f7c145, 0xfffc29e8, 0xb8c288ff, 0x0000059c,
+0x840fd284, 0x00000099, 0x85100ff3, 0xffffff48,
+0xc8590ff3, 0x85590ff3, 0xffffff44, 0x8d110ff3,
+0xffffff34, 0x85110ff3, 0xffffff38, 0x85100ff3,
+0xffffff34, 0x855f0ff3, 0xffffff38, 0x85110ff3,
+0xffffff3c, 0x85100ff3, 0xffffff34, 0x855d0ff3,
+0xffffff38, 0x85110ff3, 0xffffff38, 0x85100ff3,
+0xffffff38, 0x0ff3d231, 0xff408d10, 0xc889ffff,
+0x85580ff3, 0xffffff3c, 0x8d580ff3, 0xffffff44,
+0x85590ff3, 0xffffff48, 0x0fc12e0f, 0x440fc29b,
+0xe8d8f7c2, 0xfffffb8a, 0xc019013c, 0x00063d25,
+0x00c3c900, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0002260,
+};
+asm(".type sse_x86_32_D_f4, STT_NOTYPE;");
+asm(".type sse_x86_32_D_f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse_x86_64_D_16f4[] = {
+0xb84800eb, 0x3f800000, 0x40000000, 0xe5894855,
+0xd0458948, 0x0000b848, 0x00004040, 0x89484080,
+0xb848d845, 0x40800000, 0x40400000, 0xe0458948,
+0x000001b8, 0xe0c148fe, 0x4589481e, 0x00b848e8,
+0x003f8000, 0x48bf8000, 0x48f04589, 0x0ff84589,
+0x0fd06d28, 0x0fa06d29, 0xb8a04528, 0x00000539,
+0x0fc8280f, 0x0f00cdc2, 0xfa83d150, 0x95850f0f,
+0x0f000002, 0x0fd04d28, 0x290fc858, 0x280fb04d,
+0x3fb8d04d, 0x0f000005, 0xc20fc958, 0x0f00b04d,
+0xfa83d150, 0x6d850f0f, 0x0f000002, 0x0fb04d28,
+0x0fd04d5c, 0x0fc04d29, 0x44b8c828, 0x0f000005,
+0x00c04dc2, 0x83d1500f, 0x850f0ffa, 0x00000248,
+0xe04d280f, 0xd045590f, 0x0fd1280f, 0x280fd159,
+0x280fd04d, 0x580fe065, 0xd9280fe1, 0xe05d5c0f,
+0xb8c25c0f, 0x0000055b, 0x0fdc590f, 0x0f00c3c2,
+0xfa83d050, 0x0d850f0f, 0x0f000002, 0x0ff04528,
+0x290fc159, 0x5e0fa045, 0xc20ff04d, 0x64b800c1,
+0x0f000005, 0xfa83d050, 0xe9850f0f, 0x0f000001,
+0xf3f05528, 0xe10d100f, 0xb8000001, 0x00000567,
+0x0fc2280f, 0x0f00c9c6, 0x570fc157, 0x590fd04d,
+0xc20fa045, 0x500f00c1, 0x0ffa83d0, 0x01b6850f,
+0x0f660000, 0x0fd0455b, 0xc20fc05b, 0xb800d045,
+0x0000056e, 0x83d0500f, 0x850f0ffa, 0x00000198,
+0xd045530f, 0xa045290f, 0xa045530f, 0xd04d280f,
+0x000575b8, 0x5b0f6600, 0xc05b0fc0, 0x00c1c20f,
+0x83d0500f, 0x850f0ffa, 0x0000016c, 0x0fc1280f,
+0x290fc159, 0x520fa045, 0x290fa045, 0x280fb045,
+0x7cb8b045, 0x0f000005, 0x0f66d853, 0x5b0fdb5b,
+0xcbc20fdb, 0xd1500f00, 0x0f0ffa83, 0x00013785,
+0x5b0f6600, 0x45280fc8, 0xc95b0fd0, 0x00057eb8,
+0xd8530f00, 0xdb5b0f66, 0x0fdb5b0f, 0x0f00cbc2,
+0xfa83d150, 0x0d850f0f, 0x0f000001, 0x590fc828,
+0x4d290fc8, 0x4d510fa0, 0x059cb8a0, 0xc20f0000,
+0x500f00c8, 0x0ffa83d1, 0x00ea850f, 0x280f0000,
+0x280fe04d, 0xda590fd8, 0x0fca590f, 0x0fb04d29,
+0x5f0fcb28, 0x5d0fb04d, 0x290fb05d, 0x580fb05d,
+0x580fb04d, 0x3db8e045, 0x0f000006, 0xc20fca59,
+0x500f00c1, 0x0ffa83d0, 0x00aa850f, 0x280f0000,
+0x4eb8d045, 0x0f000006, 0x0f1bc0c6, 0x00e045c2,
+0x83d0500f, 0x850f0ffa, 0x0000008c, 0xe04d280f,
+0x0fc1280f, 0x0fd04514, 0x0fd04d15, 0x0ff3c15c,
+0x007a0d10, 0xa8b80000, 0x0f000006, 0x0f00c9c6,
+0x290fc259, 0xc20fc045, 0x500f00c1, 0x0ffa83d0,
+0x280f5675, 0x0ff3d04d, 0x48e44510, 0xbac07d8d,
+0x00000000, 0xb04d290f, 0x45110ff3, 0x100ff3b4,
+0x0ff3ec45, 0x0fbc4511, 0xc20fc057, 0x0f6601c2,
+0x0f66c8f7, 0x280fc976, 0x570fe075, 0xf70f66c1,
+0x45280ff0, 0x45c20fc0, 0x500f00b0, 0x0ff883c0,
+0x00072ab8, 0xc2440f00, 0x0000c35d, 0x80000000,
+0x40000000,
+0001424,
+};
+asm(".type sse_x86_64_D_16f4, STT_NOTYPE;");
+asm(".type sse_x86_64_D_16f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse_x86_64_D_f4[] = {
+0x485523eb, 0x7d89e589, 0x458d48fc, 0xea8948fc,
+0x75ff3880, 0xc0ff480c, 0x75d03948, 0xeb01b0f3,
+0x5dc03102, 0x894855c3, 0xec8148e5, 0x000000e0,
+0x05100ff3, 0x00000488, 0x85110ff3, 0xffffff40,
+0x85110ff3, 0xffffff44, 0x85110ff3, 0xffffff48,
+0xff40858b, 0x8589ffff, 0xffffff34, 0x0ff3ff31,
+0xff408510, 0x00b9ffff, 0x0f000000, 0xff34852e,
+0x0f40ffff, 0x450fc79b, 0xe8dff7f9, 0xffffff82,
+0x39b8c289, 0x84000005, 0x26840fd2, 0xf3000004,
+0x3485100f, 0xf3ffffff, 0x4085580f, 0xf3ffffff,
+0x3885110f, 0xf3ffffff, 0x4085100f, 0x31ffffff,
+0x580ff3ff, 0x852e0fc0, 0xffffff38, 0xc79b0f40,
+0xf7f9450f, 0xff38e8df, 0xc289ffff, 0x00053fb8,
+0x0fd28400, 0x0003dc84, 0x100ff300, 0xffff3885,
+0x5c0ff3ff, 0xffff4085, 0x110ff3ff, 0xffff2085,
+0x20858bff, 0x89ffffff, 0xffff7085, 0x388589ff,
+0x89ffffff, 0xffff3c85, 0xf3ff31ff, 0x3485100f,
+0x0fffffff, 0xff3c852e, 0x0f40ffff, 0x450fc79b,
+0xe8dff7f9, 0xfffffeda, 0x44b8c289, 0x84000005,
+0x7e840fd2, 0xf3000003, 0x3485100f, 0xf3ffffff,
+0x4085590f, 0xf3ffffff, 0x3485110f, 0xf3ffffff,
+0x4485100f, 0xf3ffffff, 0xf3c0590f, 0x3885110f,
+0xf3ffffff, 0x4085100f, 0xf3ffffff, 0x4485580f,
+0xf3ffffff, 0x3c85110f, 0xf3ffffff, 0x4085100f,
+0xf3ffffff, 0x3495100f, 0x31ffffff, 0x5c0ff3ff,
+0xffff3895, 0xc8280fff, 0x8d5c0ff3, 0xffffff44,
+0x8d590ff3, 0xffffff3c, 0xf3d12e0f, 0x3c8d110f,
+0x40ffffff, 0x0fc79b0f, 0xdff7f945, 0xfffe41e8,
+0xb8c289ff, 0x0000055b, 0x840fd284, 0x000002e5,
+0x85590ff3, 0xffffff48, 0x85110ff3, 0xffffff34,
+0x0ff3ff31, 0xff408510, 0x0ff3ffff, 0xff48855e,
+0x2e0fffff, 0xffff3485, 0x110ff3ff, 0xffff3885,
+0x9b0f40ff, 0xf9450fc7, 0xf3e8dff7, 0x89fffffd,
+0x0564b8c2, 0xd2840000, 0x0297840f, 0x0ff30000,
+0xff488510, 0x0ff3ffff, 0x02a21510, 0x0ff30000,
+0xff408d10, 0xff31ffff, 0x0fc2570f, 0x0ff3ca57,
+0xff348559, 0x2e0fffff, 0x9b0f40c1, 0xf9450fc7,
+0xabe8dff7, 0x89fffffd, 0x0567b8c2, 0xd2840000,
+0x024f840f, 0x0ff30000, 0xff40852c, 0x4589ffff,
+0x2a0ff3f8, 0x0ff3f845, 0xff348511, 0xff31ffff,
+0x85100ff3, 0xffffff34, 0x40852e0f, 0x40ffffff,
+0x0fc79b0f, 0xdff7f945, 0xfffd65e8, 0xb8c289ff,
+0x0000056e, 0x840fd284, 0x00000209, 0x85530ff3,
+0xffffff40, 0x85110ff3, 0xffffff34, 0x85530ff3,
+0xffffff34, 0xc02c0ff3, 0xf3f84589, 0xf84d2a0f,
+0x85100ff3, 0xffffff40, 0x2e0fff31, 0x9b0f40c8,
+0xf9450fc7, 0x17e8dff7, 0x89fffffd, 0x0575b8c2,
+0xd2840000, 0x01bb840f, 0x0ff30000, 0x0ff3c059,
+0xff348511, 0x0ff3ffff, 0xff348552, 0x0ff3ffff,
+0xff388511, 0x0ff3ffff, 0xff388553, 0x0ff3ffff,
+0x4589c02c, 0xf3ff31f8, 0xf8452a0f, 0x40852e0f,
+0x40ffffff, 0x0fc79b0f, 0xdff7f945, 0xfffcc1e8,
+0xb8c289ff, 0x0000057c, 0x840fd284, 0x00000165,
+0x852c0ff3, 0xffffff38, 0xf3f84589, 0x4085530f,
+0xf3ffffff, 0xf3c02c0f, 0xf84d2a0f, 0xf3f84589,
+0xf8452a0f, 0x2e0fff31, 0x9b0f40c8, 0xf9450fc7,
+0x7be8dff7, 0x89fffffc, 0x057eb8c2, 0xd2840000,
+0x011f840f, 0x48f30000, 0x40852c0f, 0x48ffffff,
+0xf3f84589, 0x452a0f48, 0x110ff3f8, 0xffff3485,
+0xf3ff31ff, 0x4085100f, 0x0fffffff, 0xff34852e,
+0x0f40ffff, 0x450fc79b, 0xe8dff7f9, 0xfffffc32,
+0x88b8c289, 0x84000005, 0xd6840fd2, 0xf3000000,
+0xf3c0590f, 0x3485110f, 0xf3ffffff, 0x408d100f,
+0x31ffffff, 0x510ff3ff, 0xffff3485, 0xc12e0fff,
+0xc79b0f40, 0xf7f9450f, 0xfbf4e8df, 0xc289ffff,
+0x00059cb8, 0x0fd28400, 0x00009884, 0x100ff300,
+0xffff4885, 0x590ff3ff, 0x590ff3c8, 0xffff4485,
+0x110ff3ff, 0xffff348d, 0x110ff3ff, 0xffff3885,
+0x100ff3ff, 0xffff3485, 0x5f0ff3ff, 0xffff3885,
+0x110ff3ff, 0xffff3c85, 0x100ff3ff, 0xffff3485,
+0x5d0ff3ff, 0xffff3885, 0x110ff3ff, 0xffff3885,
+0x100ff3ff, 0xffff3885, 0x580ff3ff, 0xffff3c85,
+0xf3ff31ff, 0x4885590f, 0xf3ffffff, 0x408d100f,
+0xf3ffffff, 0x448d580f, 0x0fffffff, 0x0f40c12e,
+0x450fc79b, 0xe8dff7f9, 0xfffffb56, 0xc019013c,
+0x00063d25, 0x00c3c900, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0002340,
+};
+asm(".type sse_x86_64_D_f4, STT_NOTYPE;");
+asm(".type sse_x86_64_D_f4, STT_FUNC;");
@@ -0,0 +1,1751 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_32_D_16i1[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x01b155c3,
+0xc031e589, 0x64ec8357, 0xc8054c88, 0xca2811b2,
+0xd8285488, 0xe283c289, 0x01fa8301, 0xc1fed219,
+0xfe02e280, 0x055488ca, 0xf88340e8, 0x0fd97510,
+0x0fc87528, 0x0f987529, 0xb8984d28, 0x00000539,
+0x66c1280f, 0x66c6740f, 0x81d0d70f, 0x00fffffa,
+0x19850f00, 0x0f000001, 0x66c84528, 0x0fc1fc0f,
+0x0fa84529, 0xb8c84528, 0x0000053f, 0xc0fc0f66,
+0x45740f66, 0xd70f66a8, 0xfffa81d0, 0x0f0000ff,
+0x0000eb85, 0x45280f00, 0xf80f66a8, 0x290fc845,
+0x0f66b845, 0x66b84d74, 0x81d1d70f, 0x00fffffa,
+0x0544b800, 0x850f0000, 0x000000c4, 0xd855280f,
+0x66da280f, 0xc85d600f, 0x985d290f, 0x66ca280f,
+0xc84d680f, 0xe845280f, 0xd9f80f66, 0x0006a8b8,
+0xeb280f00, 0x66e0280f, 0x66eb600f, 0x0fdb680f,
+0x0f66c828, 0x0f66e068, 0x0f66e3d5, 0x280fc860,
+0x1001901d, 0xd50f6600, 0xcb540fcd, 0x66dc540f,
+0x0fcb670f, 0x66b84d29, 0xa00d740f, 0x66001001,
+0x81d1d70f, 0x00fffffa, 0x0f557500, 0xb8c84d28,
+0x00000001, 0xa84d290f, 0xd805548a, 0xa8055488,
+0x8302c083, 0xf07511f8, 0x8ddb570f, 0x00bab87d,
+0x66000000, 0x66c3640f, 0x66c8f70f, 0x0fc9760f,
+0x0f66c155, 0x280fd0f7, 0x0f66b845, 0x66a84574,
+0x3dc0d70f, 0x0000ffff, 0x00072ab8, 0xc2440f00,
+0x5f64c483, 0x0000c35d, 0x00000000, 0x00000000,
+0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff,
+0x08080808, 0x08080808, 0x08080808, 0x08080808,
+0000660,
+};
+asm(".type sse2_x86_32_D_16i1, STT_NOTYPE;");
+asm(".type sse2_x86_32_D_16i1, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_32_D_16u1[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x01b255c3,
+0xc031e589, 0x64ec8357, 0xc8055488, 0xd12811b1,
+0x4c88c2fe, 0xc189d828, 0xfe01e183, 0x054c88c9,
+0xf88340e8, 0x0fe17510, 0x0fc87528, 0x0f987529,
+0xb8984d28, 0x00000539, 0x66c1280f, 0x66c6740f,
+0x81d0d70f, 0x00fffffa, 0x69850f00, 0x0f000001,
+0x66c84528, 0x0fc1fc0f, 0x0fa84529, 0xb8c84528,
+0x0000053f, 0xc0fc0f66, 0x45740f66, 0xd70f66a8,
+0xfffa81d0, 0x0f0000ff, 0x00013b85, 0x45280f00,
+0xf80f66a8, 0x290fc845, 0x280fb845, 0x0544b8d1,
+0x0f660000, 0x66b85574, 0x81d2d70f, 0x00fffffa,
+0x11850f00, 0x0f000001, 0x0fd84d56, 0x0f984d29,
+0x0fd84554, 0x0fb84d28, 0x0fd84d57, 0xb8984555,
+0x00000550, 0xdb760f66, 0xc1740f66, 0xd0d70f66,
+0xfffffa81, 0x850f0000, 0x000000dc, 0xc84d280f,
+0xd845280f, 0xc1da0f66, 0xd855280f, 0xd1de0f66,
+0x4dfc0f66, 0xfc0f66d8, 0x0634b8c2, 0x0f660000,
+0x0f66c174, 0xfa81d0d7, 0x0000ffff, 0x00a6850f,
+0x280f0000, 0x280fd855, 0x600f66e2, 0x290fc865,
+0x280f9865, 0x680f66c2, 0x280fc845, 0x0f66e84d,
+0xa8b8c3fc, 0x66000006, 0x0fc4f80f, 0x570fe128,
+0xe3570fc1, 0xc4f80f66, 0x05740f66, 0x001001d0,
+0xd0d70f66, 0xfffffa81, 0x5c750000, 0xc845280f,
+0xb8ed570f, 0x00000001, 0x66e0280f, 0x0fe5600f,
+0x66a84529, 0x0fe5600f, 0x8ab86529, 0x88d80554,
+0x83a80554, 0xf88302c0, 0x8df07511, 0x00bab87d,
+0x66000000, 0x0fc1f70f, 0x0f66cb57, 0x280fd1f7,
+0x0f66b845, 0x66a84574, 0x3dc0d70f, 0x0000ffff,
+0x00072ab8, 0xc2440f00, 0x5f64c483, 0x0000c35d,
+0x08080808, 0x08080808, 0x08080808, 0x08080808,
+0000740,
+};
+asm(".type sse2_x86_32_D_16u1, STT_NOTYPE;");
+asm(".type sse2_x86_32_D_16u1, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_32_D_16i2[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc93155c3,
+0x5657e589, 0x0010bb53, 0xec810000, 0x000000bc,
+0xbec1b70f, 0x00000008, 0x2901788d, 0x0fc889c6,
+0xe083ffbf, 0xf6bf0f01, 0x8d01f883, 0xd2190141,
+0x4a02e283, 0x0175c885, 0x7c89664b, 0xf883a645,
+0x74896608, 0x8966b645, 0x66c64554, 0xd6455c89,
+0xc1890474, 0x280fbaeb, 0x290fa87d, 0xffff78bd,
+0x85280fff, 0xffffff78, 0x000539b8, 0xc8280f00,
+0xcf750f66, 0xd1d70f66, 0xfffffa81, 0x850f0000,
+0x00000507, 0xa84d280f, 0xc8fd0f66, 0x884d290f,
+0xa84d280f, 0x00053fb8, 0x710f6600, 0x0f6601f1,
+0x66884d75, 0x81d1d70f, 0x00fffffa, 0xd8850f00,
+0x0f000004, 0x66884d28, 0xa84df90f, 0x984d290f,
+0xb8c8280f, 0x00000544, 0x4d750f66, 0xd70f6698,
+0xfffa81d1, 0x0f0000ff, 0x0004ae85, 0x55280f00,
+0xd50f66b8, 0x0f66a845, 0x280fd2d5, 0x280fa84d,
+0x0f66b865, 0x280fe1fd, 0xf90f66d9, 0xf90f66c2,
+0x5bb8b85d, 0x66000005, 0x66dcd50f, 0x66c3750f,
+0x81d0d70f, 0x00fffffa, 0x6c850f00, 0x0f000004,
+0x66b84528, 0x66c1d50f, 0xb005750f, 0x66001005,
+0x81d0d70f, 0x00fffffa, 0x05c8b800, 0x850f0000,
+0x00000447, 0x66d9280f, 0xc85de50f, 0xc855280f,
+0xb8c0570f, 0x000005cf, 0xc2650f66, 0xc3750f66,
+0xd0d70f66, 0xfffffa81, 0x850f0000, 0x0000041b,
+0x66c2280f, 0x0fc1d50f, 0x0f984529, 0x66985d28,
+0x03f3710f, 0x789d290f, 0x0fffffff, 0x66984528,
+0x02f0710f, 0x8845290f, 0xc0fd0f66, 0x0005edb8,
+0x750f6600, 0xd70f66c3, 0xfffa81d0, 0x0f0000ff,
+0x0003d685, 0x85280f00, 0xffffff78, 0xe0710f66,
+0xfd0f6602, 0x05f2b8c0, 0x0f660000, 0x66884575,
+0x81d0d70f, 0x00fffffa, 0xac850f00, 0x0f000003,
+0x85c7c128, 0xffffff74, 0x00000003, 0xc2d50f66,
+0x8bd8280f, 0xffff7485, 0x608589ff, 0xc1ffffff,
+0x85891ff8, 0xffffff64, 0xbd7e0ff3, 0xffffff60,
+0xdff10f66, 0xff7485c7, 0x0002ffff, 0x858b0000,
+0xffffff74, 0xff608589, 0xf8c1ffff, 0x6485891f,
+0xf3ffffff, 0x60b57e0f, 0x66ffffff, 0x0fc6f10f,
+0x66884529, 0xb8c0fd0f, 0x00000605, 0xc3750f66,
+0xd0d70f66, 0xfffffa81, 0x850f0000, 0x0000032b,
+0xff74858b, 0x8589ffff, 0xffffff60, 0x891ff8c1,
+0xffff6485, 0x7e0ff3ff, 0xffff60bd, 0xe10f66ff,
+0xc3280fdf, 0xc3fd0f66, 0x000609b8, 0x750f6600,
+0x0f668845, 0xfa81d0d7, 0x0000ffff, 0x02e9850f,
+0x280f0000, 0x570fd845, 0xe1280fdb, 0xe2d50f66,
+0xc3650f66, 0x0fc4540f, 0x8b984529, 0x89669845,
+0xffff5485, 0x4dbf0fff, 0x54858bd8, 0x8bffffff,
+0x8b669c5d, 0xe0d39e7d, 0xda4dbf0f, 0xff508589,
+0x8b66ffff, 0x0f669a45, 0xff50a56e, 0x8966ffff,
+0xffff6085, 0x60858bff, 0xd3ffffff, 0x4dbf0fe0,
+0x4c8589dc, 0x89ffffff, 0xc40f66d8, 0xffff4ca5,
+0xe0d301ff, 0xde4dbf0f, 0xff488589, 0xf889ffff,
+0xb56e0f66, 0xffffff48, 0xbf0fe0d3, 0x8589e04d,
+0xffffff44, 0x66a0458b, 0xff5c8589, 0xb58bffff,
+0xffffff5c, 0xbf0fe6d3, 0xb589e24d, 0xffffff40,
+0xa2758b66, 0xe2d3f289, 0xe44dbf0f, 0xff3c9589,
+0x558bffff, 0xd3d089a4, 0x4dbf0fe0, 0x388589e6,
+0x66ffffff, 0x66a6458b, 0xff588589, 0x858bffff,
+0xffffff58, 0xb5c40f66, 0xffffff44, 0x6e0f6601,
+0xffff4085, 0x6e0f66ff, 0xffff38ad, 0xc40f66ff,
+0xffff3c85, 0x0f6601ff, 0xe0d3e662, 0xe8c40f66,
+0x620f6601, 0x6c0f66c5, 0x45280fe0, 0xf90f66d8,
+0x1005c005, 0x45290f00, 0x4dbf0fd8, 0x54858bd8,
+0xd3ffffff, 0x4dbf0fe0, 0x548589da, 0x8bffffff,
+0xffff6085, 0x6e0f66ff, 0xffff5485, 0x0fe0d3ff,
+0x89dc4dbf, 0xffff6085, 0x5c858bff, 0x66ffffff,
+0x6085c40f, 0x01ffffff, 0xbf0fe3d3, 0x0f66de4d,
+0xe7d3fb6e, 0xe04dbf0f, 0xffc40f66, 0x620f6601,
+0x0fe0d3c7, 0x89e24dbf, 0xffff5c85, 0x58858bff,
+0x66ffffff, 0x5cad6e0f, 0xd3ffffff, 0x4dbf0fe6,
+0xc40f66e4, 0xe2d301ee, 0xe64dbf0f, 0xf26e0f66,
+0x0f66e0d3, 0x6601f0c4, 0x66ee620f, 0x66c56c0f,
+0xb8c0fd0f, 0x00000621, 0xc4750f66, 0xd0d70f66,
+0xfffffa81, 0x850f0000, 0x0000010f, 0xb845280f,
+0x66e2280f, 0x0fc2d50f, 0x66884529, 0x0fe1d50f,
+0x66884528, 0x66c4ee0f, 0x8865ea0f, 0x8865290f,
+0x45fd0f66, 0x063db888, 0x0f660000, 0x66b84dfd,
+0x66c2d50f, 0x66c1750f, 0x81d0d70f, 0x00fffffa,
+0xc4850f00, 0x0f000000, 0xf2b84d28, 0xa845700f,
+0x700ff31b, 0x0f661bc0, 0xb84ec070, 0x0000064e,
+0xc1750f66, 0xd0d70f66, 0xfffffa81, 0x850f0000,
+0x00000097, 0x66c1280f, 0xa845610f, 0x4d690f66,
+0xf90f66a8, 0x06a8b8c1, 0x0f660000, 0x290fc2d5,
+0x0f669845, 0x05d00575, 0x0f660010, 0xfa81d0d7,
+0x0000ffff, 0x8b666575, 0x0f66ba45, 0x7d8dc076,
+0x6d280f98, 0x650f66a8, 0x0000bad3, 0x570f0000,
+0x6d290fc2, 0x75280f88, 0x458966a8, 0x458b668a,
+0x458966be, 0x458b668e, 0x458966c2, 0x458b6692,
+0x458966c6, 0xf70f6696, 0x7d280ff2, 0xf70f66b8,
+0x45280ff8, 0x750f6698, 0x0f668845, 0xff3dc0d7,
+0xb80000ff, 0x0000072a, 0x81c2440f, 0x0000bcc4,
+0x5f5e5b00, 0x0000c35d, 0x00000000, 0x00000000,
+0x000e0008, 0x00140012, 0x00120014, 0x0008000e,
+0x00010001, 0x00010001, 0x00010001, 0x00010001,
+0x00040004, 0x00040004, 0x00040004, 0x00040004,
+0002740,
+};
+asm(".type sse2_x86_32_D_16i2, STT_NOTYPE;");
+asm(".type sse2_x86_32_D_16i2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_32_D_16u2[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x10b955c3,
+0x89000000, 0x57c031e5, 0xec815356, 0x000000bc,
+0xbbd0b70f, 0x00000008, 0xc789d329, 0x8901728d,
+0x01e283c2, 0xf8854a40, 0x0ff6b70f, 0xb70fdbb7,
+0x490175d2, 0x45748966, 0x08f883a6, 0x455c8966,
+0x548966b6, 0x8966c645, 0x75d6454c, 0x7d280fc3,
+0xbd290fa8, 0xffffff78, 0x788d280f, 0xb8ffffff,
+0x00000539, 0x66c1280f, 0x66c7750f, 0x81d0d70f,
+0x00fffffa, 0x76850f00, 0x0f000004, 0x66a84528,
+0x0fc1fd0f, 0x0f884529, 0xb8a84528, 0x0000053f,
+0xf0710f66, 0x750f6601, 0x0f668845, 0xfa81d0d7,
+0x0000ffff, 0x0447850f, 0x280f0000, 0x0f668845,
+0x0fa845f9, 0x0f984529, 0x44b8d128, 0x66000005,
+0x9855750f, 0xd2d70f66, 0xfffffa81, 0x850f0000,
+0x0000041d, 0xb84d560f, 0x788d290f, 0x0fffffff,
+0x0fb84554, 0x0f984d28, 0x0fb84d57, 0xff788555,
+0x50b8ffff, 0x66000005, 0x66db760f, 0x66c1750f,
+0x81d0d70f, 0x00fffffa, 0xe2850f00, 0x0f000003,
+0x0fa84528, 0x66b84d28, 0x66c8d50f, 0x100d750f,
+0x66001005, 0x81d1d70f, 0x00fffffa, 0x05c8b800,
+0x850f0000, 0x000003b9, 0x66e0280f, 0xc865e40f,
+0xc84d280f, 0x0005d1b8, 0xd0280f00, 0x66d1540f,
+0x66d1fd0f, 0x66d4750f, 0x81d2d70f, 0x00fffffa,
+0x8a850f00, 0x0f000003, 0x0f984529, 0x66986528,
+0x03f4710f, 0x78a5290f, 0x0fffffff, 0x66985528,
+0x02f2710f, 0x8855290f, 0xd2fd0f66, 0x0005edb8,
+0x750f6600, 0xd70f66d4, 0xfffa81d2, 0x0f0000ff,
+0x00034c85, 0x95280f00, 0xffffff78, 0xd2710f66,
+0xfd0f6602, 0x05f2b8d2, 0x0f660000, 0x66885575,
+0x81d2d70f, 0x00fffffa, 0x22850f00, 0xc7000003,
+0xffff7485, 0x000003ff, 0xd0280f00, 0xa56e0f66,
+0xffffff74, 0xd4f10f66, 0xff7485c7, 0x0002ffff,
+0x0f660000, 0xff74a56e, 0x0f66ffff, 0x290fc4f1,
+0x0f668845, 0x05b8c0fd, 0x66000006, 0x66c2750f,
+0x81d0d70f, 0x00fffffa, 0xd2850f00, 0x66000002,
+0x74a56e0f, 0x66ffffff, 0x0fd4d10f, 0x0f66c228,
+0x09b8c2fd, 0x66000006, 0x8845750f, 0xd0d70f66,
+0xfffffa81, 0x850f0000, 0x000002a5, 0x0fd2570f,
+0x0f66c228, 0x66d84575, 0x0fc2750f, 0x0fa84554,
+0x8b984529, 0x89669845, 0xffff5885, 0x4db70fff,
+0x58858bd8, 0x8bffffff, 0x8b669c5d, 0xe0d39e7d,
+0xda4db70f, 0xff548589, 0x8b66ffff, 0x0f669a45,
+0xff54a56e, 0x8966ffff, 0xffff6485, 0x64858bff,
+0xd3ffffff, 0x4db70fe0, 0x508589dc, 0x89ffffff,
+0xc40f66d8, 0xffff50a5, 0xe0d301ff, 0xde4db70f,
+0xff4c8589, 0xf889ffff, 0xb56e0f66, 0xffffff4c,
+0xb70fe0d3, 0x8589e04d, 0xffffff48, 0x66a0458b,
+0xff608589, 0xb58bffff, 0xffffff60, 0xb70fe6d3,
+0xb589e24d, 0xffffff44, 0xa2758b66, 0xe2d3f289,
+0xe44db70f, 0xff409589, 0x558bffff, 0xd3d089a4,
+0x4db70fe0, 0x3c8589e6, 0x66ffffff, 0x66a6458b,
+0xff5c8589, 0x858bffff, 0xffffff5c, 0xb5c40f66,
+0xffffff48, 0x6e0f6601, 0xffff4485, 0x6e0f66ff,
+0xffff3cad, 0xc40f66ff, 0xffff4085, 0x0f6601ff,
+0xe0d3e662, 0xe8c40f66, 0x620f6601, 0x6c0f66c5,
+0x45280fe0, 0xfd0f66d8, 0x45290fc3, 0x4db70fd8,
+0x58858bd8, 0xd3ffffff, 0x4db70fe0, 0x588589da,
+0x8bffffff, 0xffff6485, 0x6e0f66ff, 0xffff5885,
+0x0fe0d3ff, 0x89dc4db7, 0xffff6485, 0x60858bff,
+0x66ffffff, 0x6485c40f, 0x01ffffff, 0xb70fe3d3,
+0x0f66de4d, 0xe7d3fb6e, 0xe04db70f, 0xffc40f66,
+0x620f6601, 0x0fe0d3c7, 0x89e24db7, 0xffff6085,
+0x5c858bff, 0x66ffffff, 0x60ad6e0f, 0xd3ffffff,
+0x4db70fe6, 0xc40f66e4, 0xe2d301ee, 0xe64db70f,
+0xf26e0f66, 0x0f66e0d3, 0x6601f0c4, 0x66ee620f,
+0x66c56c0f, 0xb8c0fd0f, 0x00000621, 0xc4750f66,
+0xd0d70f66, 0xfffffa81, 0x850f0000, 0x000000d1,
+0xb845280f, 0x65700ff2, 0x0ff31ba8, 0x661be470,
+0x4ee4700f, 0x00064eb8, 0x750f6600, 0xd70f66e0,
+0xfffa81d4, 0x0f0000ff, 0x0000a485, 0xe0280f00,
+0x65610f66, 0x690f66a8, 0x0f66a845, 0x570fc3fd,
+0xf90f66d9, 0x06a8b8c4, 0x570f0000, 0xf90f66c1,
+0x750f66c3, 0x10052005, 0xd70f6600, 0xfffa81d0,
+0x750000ff, 0x458b666c, 0x987d8dba, 0x000000ba,
+0x45280f00, 0x45290fa8, 0xd8280f88, 0x8a458966,
+0xbe458b66, 0xda610f66, 0xda610f66, 0x985d290f,
+0x8e458966, 0xc2458b66, 0x92458966, 0xc6458b66,
+0x96458966, 0xc1f70f66, 0xb87d280f, 0xc0760f66,
+0x66c1570f, 0x0ff8f70f, 0x66984528, 0x8845750f,
+0xc0d70f66, 0x00ffff3d, 0x072ab800, 0x440f0000,
+0xbcc481c2, 0x5b000000, 0xc35d5f5e, 0x00000000,
+0x000e0008, 0x00140012, 0x00120014, 0x0008000e,
+0x00040004, 0x00040004, 0x00040004, 0x00040004,
+0002460,
+};
+asm(".type sse2_x86_32_D_16u2, STT_NOTYPE;");
+asm(".type sse2_x86_32_D_16u2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_32_D_16i4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xe58955c3,
+0x74ec8357, 0x01d845c7, 0xc7000000, 0x0004e845,
+0x45c70000, 0x000002dc, 0xec45c700, 0x00000003,
+0x03e045c7, 0xc7000000, 0x0002f045, 0x45c70000,
+0x000004e4, 0xf445c700, 0x00000001, 0xd875280f,
+0xa875290f, 0xa845280f, 0x000539b8, 0xc8280f00,
+0xce760f66, 0x83d1500f, 0x850f0ffa, 0x0000032c,
+0xd84d280f, 0xc8fe0f66, 0xb84d290f, 0xd84d280f,
+0x00053fb8, 0x720f6600, 0x0f6601f1, 0x0fb84d76,
+0xfa83d150, 0x01850f0f, 0x0f000003, 0x66b84d28,
+0xd84dfa0f, 0xc84d290f, 0xb8c8280f, 0x00000544,
+0x4d760f66, 0xd1500fc8, 0x0f0ffa83, 0x0002db85,
+0x4d280f00, 0x55280fa8, 0x730f66d8, 0x0f6620d1,
+0x66d845f4, 0x20d2730f, 0xe85d280f, 0xcaf40f66,
+0xc9700f66, 0x700f6608, 0x0f6608c0, 0x280fc162,
+0x0f66e84d, 0x66e85df4, 0x20d1730f, 0xc9f40f66,
+0xc9700f66, 0x700f6608, 0x0f6608db, 0x280fd962,
+0x280fd84d, 0x0f66e865, 0x280fe1fe, 0xd1280fec,
+0xd5730f66, 0xfa0f6620, 0x0f66e855, 0x5bb8c3fa,
+0x66000005, 0x66e2f40f, 0x20d2730f, 0xd5f40f66,
+0xe4700f66, 0x700f6608, 0x0f6608d2, 0x0f66e262,
+0x500fc476, 0x0ffa83d0, 0x023e850f, 0x280f0000,
+0x280fd855, 0x0f66e845, 0x6620d273, 0xe84df40f,
+0xd0730f66, 0xf40f6620, 0x700f66c2, 0x0f6608c0,
+0x6608c970, 0x66c8620f, 0xb00d760f, 0x0f001003,
+0xc8b8d150, 0x83000005, 0x850f0ffa, 0x000001fc,
+0x000001b8, 0xffc98300, 0xc96e0f66, 0xc06e0f66,
+0xc0700f66, 0x100ff3e1, 0x6e0f66c1, 0x700f66f8,
+0x0f66e1c0, 0xf3c6c070, 0x66c7100f, 0xc6c0700f,
+0xc0700f66, 0x100ff327, 0x700f66c1, 0x280f27c0,
+0xf40f66c8, 0x280fd84d, 0x730f66d8, 0x0f6620d3,
+0x0f66d3f4, 0x6608c970, 0x08d2700f, 0xca620f66,
+0xc84d290f, 0xc865280f, 0xf4720f66, 0x65290f03,
+0x55280fa8, 0x720f66c8, 0x290f02f2, 0x0f66b855,
+0xedb8d2fe, 0x66000005, 0x0fd4760f, 0xfa83d250,
+0x65850f0f, 0x0f000001, 0x66a85528, 0x02e2720f,
+0xd2fe0f66, 0x0005f2b8, 0x760f6600, 0x500fb855,
+0x0ffa83d2, 0x0142850f, 0x45c70000, 0x000003a4,
+0xd1280f00, 0x89a4458b, 0xf8c19045, 0x9445891f,
+0x757e0ff3, 0xf20f6690, 0xa445c7d6, 0x00000002,
+0x89a4458b, 0xf8c19045, 0x9445891f, 0x7d7e0ff3,
+0xf20f6690, 0x4d290fcf, 0xfe0f66b8, 0x0605b8c9,
+0x0f660000, 0x500fca76, 0x0ffa83d1, 0x00ea850f,
+0x458b0000, 0x904589a4, 0x891ff8c1, 0x0ff39445,
+0x66906d7e, 0x0fd5e20f, 0x0f66ca28, 0x09b8cafe,
+0x66000006, 0xb84d760f, 0x83d1500f, 0x850f0ffa,
+0x000000b8, 0xe855280f, 0x4d700f66, 0x4eb81bd8,
+0x66000006, 0x0fca760f, 0xfa83d150, 0x99850f0f,
+0x0f000000, 0x0f66ca28, 0x66d84d62, 0xd8556a0f,
+0xcafa0f66, 0x0006a8b8, 0xd1280f00, 0xd1730f66,
+0xf40f6620, 0xf40f66d0, 0x700f66cb, 0x0f6608d2,
+0x6608c970, 0x0fd1620f, 0x66c85529, 0xc015760f,
+0x0f001003, 0xfa83d250, 0x8b51750f, 0x570fec45,
+0xc87d8dc9, 0xd875280f, 0x000000ba, 0x660f6600,
+0x760f66c1, 0x75290fc9, 0x7d280fb8, 0xbc4589d8,
+0x89f4458b, 0x0f66c445, 0x280ff8f7, 0x570fe86d,
+0xf70f66c1, 0x45280fe8, 0x760f66c8, 0x500fb845,
+0x0ff883c0, 0x00072ab8, 0xc2440f00, 0x5f74c483,
+0x0000c35d, 0x00000000, 0x00000000, 0x00000000,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0x00000002, 0x00000002, 0x00000002, 0x00000002,
+0001720,
+};
+asm(".type sse2_x86_32_D_16i4, STT_NOTYPE;");
+asm(".type sse2_x86_32_D_16i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_32_D_16u4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0x5357e589, 0x000005bb, 0x70ec8300, 0xdf89c189,
+0x8940ca89, 0x83c48544, 0xc72901e2, 0xd4857c89,
+0x04f8834a, 0xe4855489, 0x280fe275, 0x290fc86d,
+0x280f986d, 0x39b8984d, 0x0f000005, 0x0f66c128,
+0x500fc576, 0x0ffa83d0, 0x0279850f, 0x280f0000,
+0x0f66c845, 0x290fc1fe, 0x280fa845, 0x3fb8c845,
+0x66000005, 0x01f0720f, 0x45760f66, 0xd0500fa8,
+0x0f0ffa83, 0x00024e85, 0x45280f00, 0xfa0f66a8,
+0x290fc845, 0x280fb845, 0x0544b8d1, 0x0f660000,
+0x0fb85576, 0xfa83d250, 0x28850f0f, 0x0f000002,
+0x0fd84d56, 0x0f984d29, 0x0fd84554, 0x0fb85528,
+0x0fd85557, 0xb8984555, 0x00000550, 0xc9760f66,
+0xc2760f66, 0x83d0500f, 0x850f0ffa, 0x000001f7,
+0xc845280f, 0xc85d280f, 0x0fd0280f, 0x66d86528,
+0x20d3730f, 0x55f40f66, 0x730f66d8, 0x0f6620d4,
+0x0f66dcf4, 0x6608db70, 0x08d2700f, 0xd3620f66,
+0x15760f66, 0x001002e0, 0xb8d2500f, 0x000005c8,
+0x0f0ffa83, 0x0001ae85, 0x55280f00, 0xd0570fe8,
+0x9855290f, 0xd07e0f66, 0x55f40f66, 0xd865f7d8,
+0x8bb84589, 0x5589e045, 0xa065f7bc, 0xb8c04589,
+0x000005e1, 0x66c45589, 0xb855760f, 0x83d2500f,
+0x850f0ffa, 0x0000016f, 0xb845290f, 0xb85d280f,
+0xf3720f66, 0x5d290f03, 0x55280f98, 0x720f66b8,
+0x290f02f2, 0x0f66a855, 0xedb8d2fe, 0x66000005,
+0x0fd3760f, 0xfa83d250, 0x38850f0f, 0x0f000001,
+0x66985528, 0x02d2720f, 0xd2fe0f66, 0x0005f2b8,
+0x760f6600, 0x500fa855, 0x0ffa83d2, 0x0115850f,
+0x45c70000, 0x00000394, 0xd0280f00, 0x5d6e0f66,
+0xf20f6694, 0x9445c7d3, 0x00000002, 0x5d6e0f66,
+0xf20f6694, 0x45290fc3, 0xfe0f66a8, 0x0605b8c0,
+0x0f660000, 0x500fc276, 0x0ffa83d0, 0x00d5850f,
+0x0f660000, 0x66945d6e, 0x0fd3d20f, 0x0f66c228,
+0x09b8c2fe, 0x66000006, 0xa845760f, 0x83d0500f,
+0x850f0ffa, 0x000000af, 0xd845280f, 0x55700f66,
+0x4eb81bc8, 0x66000006, 0x0fd0760f, 0xfa83d250,
+0x90850f0f, 0x0f000000, 0x0f66d828, 0x66c85d62,
+0xc8456a0f, 0xe855280f, 0xc1fe0f66, 0x0006a8b8,
+0xfa0f6600, 0xc2570fc3, 0x66ca570f, 0x66c1fa0f,
+0xf005760f, 0x0f001002, 0xfa83d050, 0x8b58750f,
+0x570fdc45, 0xb87d8ddb, 0xc845280f, 0x000000ba,
+0x45290f00, 0xc8280fa8, 0x8bac4589, 0x0f66e445,
+0x0f66cb62, 0x290fcb62, 0x4589b84d, 0xf70f66b4,
+0x75280fc2, 0x760f66d8, 0xc2570fc0, 0xf0f70f66,
+0xb845280f, 0x45760f66, 0xc0500fa8, 0xb80ff883,
+0x0000072a, 0x83c2440f, 0x5f5b70c4, 0x0000c35d,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0x00000002, 0x00000002, 0x00000002, 0x00000002,
+0001400,
+};
+asm(".type sse2_x86_32_D_16u4, STT_NOTYPE;");
+asm(".type sse2_x86_32_D_16u4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_32_D_16i8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xd23155c3,
+0xc931e589, 0x53ff3157, 0xec83db31, 0xd845c770,
+0x00000001, 0xc7dc5589, 0x0002e845, 0x4d890000,
+0xe045c7ec, 0x00000002, 0xc7e45d89, 0x0001f045,
+0x7d890000, 0x7d280ff4, 0x7d290fd8, 0x7e0ff3a8,
+0x0ff3a84d, 0x0fd8457e, 0x0ff3c157, 0x66e0557e,
+0x66c27e0f, 0x20d0730f, 0xc07e0f66, 0x0ff3c209,
+0x0fb0457e, 0xd231c094, 0x0fc0b60f, 0xd8f7d057,
+0x83904589, 0xdaf700d2, 0x66945589, 0x66d27e0f,
+0x20d2730f, 0xd07e0f66, 0x0ff3c209, 0x0f90557e,
+0xd231c094, 0xf7c0b60f, 0x904589d8, 0xb800d283,
+0x00000539, 0x5589daf7, 0x55160f94, 0x500f6690,
+0x03fa83d2, 0x0716850f, 0x280f0000, 0x280fa85d,
+0x0f66d855, 0x290fd3d4, 0x280fb855, 0x0f66d855,
+0x6601f273, 0x9055d60f, 0x0f90458b, 0x8b885517,
+0x45339455, 0xbc5533b8, 0x940fd009, 0x0fd231c0,
+0xd8f7c0b6, 0x83904589, 0x458b00d2, 0xc0453388,
+0x5589daf7, 0x8c558b94, 0xf3c45533, 0x90557e0f,
+0x940fd009, 0x0fd231c0, 0xd8f7c0b6, 0x83904589,
+0x3fb800d2, 0xf7000005, 0x945589da, 0x9055160f,
+0xd2500f66, 0x0f03fa83, 0x00069385, 0x55280f00,
+0xfb0f66b8, 0x290fd855, 0x0ff3c855, 0x0fc8557e,
+0x0f66ca57, 0x0f66ca7e, 0x6620d173, 0x09c87e0f,
+0x7e0ff3c2, 0x940fd04d, 0x0fd231c0, 0x570fc0b6,
+0x89d8f7c1, 0xd2839045, 0x89daf700, 0x0f669455,
+0x0f66c27e, 0x6620d073, 0x09c07e0f, 0x7e0ff3c2,
+0x940f9045, 0x0fd231c0, 0xd8f7c0b6, 0x83904589,
+0x44b800d2, 0xf7000005, 0x945589da, 0x9045160f,
+0xd0500f66, 0x0f03fa83, 0x00061385, 0xc3280f00,
+0xd865280f, 0xd0730f66, 0xcb280f20, 0x4df40f66,
+0xf40f66d8, 0x0f66d845, 0x6620d473, 0x0fdcf40f,
+0x280fd128, 0x0f66e84d, 0x0f66c3d4, 0x0f20f073,
+0x0f66d928, 0x280fd0d4, 0x730f66c1, 0x0f6620d0,
+0x0f66c1f4, 0x0f66d9f4, 0x0f66c0d4, 0x6620f073,
+0x0fd8d40f, 0x0fd86528, 0x0f66fc28, 0x280ff9d4,
+0xfb0f66f4, 0xfb0f66d3, 0x280fe875, 0x730f66ef,
+0x280f20d5, 0xf40f66ce, 0x730f66ee, 0x280f20d1,
+0xf40f66c6, 0xd40f66cf, 0xf40f66cd, 0x730f66c7,
+0x0f6620f1, 0x0f66c1d4, 0x8b9045d6, 0x170f9045,
+0x558b8845, 0xd60f6694, 0x45339055, 0x94553390,
+0x940fd009, 0x0fd231c0, 0xd8f7c0b6, 0x83904589,
+0x458b00d2, 0x89daf788, 0x558b9455, 0x55170f8c,
+0x88453388, 0x457e0ff3, 0x8c553390, 0x940fd009,
+0x0fd231c0, 0xd8f7c0b6, 0x83904589, 0x5bb800d2,
+0xf7000005, 0x945589da, 0x9045160f, 0xd0500f66,
+0x0f03fa83, 0x00050785, 0x45280f00, 0xec280fe8,
+0x0fd0280f, 0x0f66cc28, 0x6620d573, 0x20d2730f,
+0xc8f40f66, 0xd4f40f66, 0xc5f40f66, 0xc2d40f66,
+0xf0730f66, 0xd40f6620, 0xd60f66c1, 0x290f9045,
+0x458ba845, 0x94558b90, 0x0902f083, 0xc0940fd0,
+0xb60fd231, 0x89d8f7c0, 0xd2839045, 0xb0458b00,
+0x5589daf7, 0xb4558b94, 0x457e0ff3, 0x02f08390,
+0x940fd009, 0x0fd231c0, 0xd8f7c0b6, 0x83904589,
+0xc8b800d2, 0xf7000005, 0x945589da, 0x9045160f,
+0xd0500f66, 0x0f03fa83, 0x00047385, 0x9045c700,
+0x00000001, 0x4589c031, 0x7e0ff394, 0x160f9055,
+0x1007f015, 0xda280f00, 0xd3730f66, 0xc5280f20,
+0x66cc280f, 0x66c2f40f, 0x66e3f40f, 0x66caf40f,
+0x66c4d40f, 0x20f0730f, 0xc1d40f66, 0xc845290f,
+0xc845280f, 0xf0730f66, 0xd60f6603, 0x290f9045,
+0x458ba845, 0x94558b90, 0xc845280f, 0xf0730f66,
+0x45290f02, 0xd40f66b8, 0xf40f66c0, 0xd60f66ea,
+0x4d8b9045, 0x45170f90, 0x945d8b88, 0xc031c131,
+0xd909d331, 0x31c0940f, 0x89d8f7d2, 0xd2839045,
+0x88458b00, 0xf7b04533, 0x945589da, 0x338c558b,
+0x0ff3b455, 0x0990457e, 0xc0940fd0, 0xb60fd231,
+0x89d8f7c0, 0xd2839045, 0x05edb800, 0xdaf70000,
+0x0f945589, 0x66904516, 0x83d0500f, 0x850f03fa,
+0x0000039c, 0xa845280f, 0xa875280f, 0xd0730f66,
+0x700f6602, 0x0f6688c0, 0x6602e672, 0xddf6700f,
+0xc6620f66, 0xc0d40f66, 0x45d60f66, 0x90458b90,
+0x8845170f, 0x3394558b, 0x5533b845, 0x0fd009bc,
+0xd231c094, 0xf7c0b60f, 0x904589d8, 0x8b00d283,
+0x45338845, 0x89daf7c0, 0x558b9455, 0xc455338c,
+0x457e0ff3, 0x0fd00990, 0xd231c094, 0xf7c0b60f,
+0x904589d8, 0xb800d283, 0x000005f2, 0x5589daf7,
+0x45160f94, 0x500f6690, 0x03fa83d0, 0x030e850f,
+0x45c70000, 0x000003a4, 0xd40f6600, 0x730f66ec,
+0x0f6620f5, 0x280fcdd4, 0xa4458bc1, 0xc1904589,
+0x45891ff8, 0x7e0ff394, 0x0f66907d, 0x45c7c7f3,
+0x000002a4, 0xa4458b00, 0xc1904589, 0x45891ff8,
+0x7e0ff394, 0x0f66907d, 0x290fcff3, 0x0f66b84d,
+0x0f66c9d4, 0x8b904dd6, 0x170f9045, 0x558b884d,
+0xd60f6694, 0x45339045, 0x94553390, 0x940fd009,
+0x0fd231c0, 0xd8f7c0b6, 0x83904589, 0x458b00d2,
+0x89daf788, 0x558b9455, 0x45170f8c, 0x88453388,
+0x4d7e0ff3, 0x8c553390, 0x940fd009, 0x0fd231c0,
+0xd8f7c0b6, 0x83904589, 0x05b800d2, 0xf7000006,
+0x945589da, 0x904d160f, 0xd1500f66, 0x0f03fa83,
+0x00024b85, 0xc8280f00, 0x66a4558b, 0x1fe1720f,
+0xc9700f66, 0x905589f5, 0xf8c1d089, 0x9445891f,
+0x000040b8, 0xf3d02900, 0x907d7e0f, 0xc7d30f66,
+0xe06e0f66, 0xccf30f66, 0x66c1560f, 0x66c0d40f,
+0x9045d60f, 0x0f90458b, 0x8b884517, 0x45339455,
+0xbc5533b8, 0x940fd009, 0x0fd231c0, 0xd8f7c0b6,
+0x83904589, 0x458b00d2, 0xc0453388, 0x5589daf7,
+0x8c558b94, 0xf3c45533, 0x90457e0f, 0x940fd009,
+0x0fd231c0, 0xd8f7c0b6, 0x83904589, 0x09b800d2,
+0xf7000006, 0x945589da, 0x9045160f, 0xd0500f66,
+0x0f03fa83, 0x0001a785, 0x700f6600, 0x664ed845,
+0x9045d60f, 0x8b90458b, 0x170f9455, 0x45338845,
+0xec5533e8, 0x940fd009, 0x0fd231c0, 0xd8f7c0b6,
+0x83904589, 0x458b00d2, 0xf0453388, 0x5589daf7,
+0x8c558b94, 0xf3f45533, 0x90457e0f, 0x940fd009,
+0x0fd231c0, 0xd8f7c0b6, 0x83904589, 0x4eb800d2,
+0xf7000006, 0x945589da, 0x9045160f, 0xd0500f66,
+0x0f03fa83, 0x00013785, 0x65280f00, 0x6c0f66e8,
+0x280fd865, 0x0f66e845, 0x66d8456d, 0x0fe0fb0f,
+0x0f66cc28, 0x0f66dcf4, 0x0f20d173, 0x0f66c428,
+0x0f66caf4, 0x0f66cbd4, 0x0f66c2f4, 0x6620f173,
+0x66c1d40f, 0x9045d60f, 0x8845170f, 0xc845290f,
+0x8b90458b, 0xf0839455, 0x0fd00901, 0xd231c094,
+0xf7c0b60f, 0x904589d8, 0x8b00d283, 0xdaf78845,
+0x8b945589, 0x0ff38c55, 0x8390457e, 0xd00901f0,
+0x31c0940f, 0xc0b60fd2, 0x4589d8f7, 0x00d28390,
+0x0006a8b8, 0x89daf700, 0x160f9455, 0x0f669045,
+0xfa83d050, 0x95850f03, 0x0f000000, 0x07f00528,
+0x7d8d0010, 0x7e0ff3c8, 0x280ff04d, 0x458bd875,
+0xdc558bd8, 0xf0f70f66, 0x0005280f, 0x0f001008,
+0x66e87d28, 0x8bf8f70f, 0x0ff3c84d, 0x8bd0457e,
+0x570fcc5d, 0x31c131c1, 0x09d331c0, 0xc0940fd9,
+0xd8f7d231, 0x83904589, 0xdaf700d2, 0x66945589,
+0x66c27e0f, 0x20d0730f, 0xc07e0f66, 0x0ff3c209,
+0x0f90457e, 0xd231c094, 0xf7c0b60f, 0x904589d8,
+0xf700d283, 0x945589da, 0x000000ba, 0x45160f00,
+0x500f6690, 0x03f883c0, 0x00072ab8, 0xc2440f00,
+0x5b70c483, 0x00c35d5f, 0x00000000, 0x00000000,
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0xffffffff, 0xffffffff,
+0004020,
+};
+asm(".type sse2_x86_32_D_16i8, STT_NOTYPE;");
+asm(".type sse2_x86_32_D_16i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_32_D_16u8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0xd231e589, 0x53c93157, 0xec83db31, 0xd845c770,
+0x00000001, 0xc7dc4589, 0x0002e845, 0x55890000,
+0xe045c7ec, 0x00000002, 0xc7e44d89, 0x0001f045,
+0x5d890000, 0x6d280ff4, 0x6d290fd8, 0x7e0ff3a8,
+0x0ff3a84d, 0x0fd8457e, 0x0ff3c157, 0x66b04d7e,
+0x66c27e0f, 0x20d0730f, 0xc07e0f66, 0x0ff3c209,
+0x0fe0457e, 0xd231c094, 0x0fc0b60f, 0xd8f7c157,
+0x83904589, 0xdaf700d2, 0x66945589, 0x66c27e0f,
+0x20d0730f, 0xc07e0f66, 0x0ff3c209, 0x0f90457e,
+0xd231c094, 0xf7c0b60f, 0x904589d8, 0xb800d283,
+0x00000539, 0x5589daf7, 0x45160f94, 0x500f6690,
+0x03fa83d0, 0x0604850f, 0x280f0000, 0x280fa855,
+0x0f66d845, 0x290fc2d4, 0x280fb845, 0x0f66d845,
+0x6601f073, 0x9045d60f, 0x0f90458b, 0x8b884517,
+0x45339455, 0xbc5533b8, 0x940fd009, 0x0fd231c0,
+0xd8f7c0b6, 0x83904589, 0x458b00d2, 0xc0453388,
+0x5589daf7, 0x8c558b94, 0xf3c45533, 0x90457e0f,
+0x940fd009, 0x0fd231c0, 0xd8f7c0b6, 0x83904589,
+0x3fb800d2, 0xf7000005, 0x945589da, 0x9045160f,
+0xd0500f66, 0x0f03fa83, 0x00058185, 0x45280f00,
+0xfb0f66b8, 0x290fd845, 0x0ff3c845, 0xf3c85d7e,
+0xa84d7e0f, 0xf3cb570f, 0xd05d7e0f, 0xca7e0f66,
+0xd1730f66, 0x7e0f6620, 0xf3c209c8, 0xb04d7e0f,
+0x31c0940f, 0xc0b60fd2, 0xf7cb570f, 0x904589d8,
+0xf700d283, 0x945589da, 0xca7e0f66, 0xd1730f66,
+0x7e0f6620, 0xf3c209c8, 0x904d7e0f, 0x31c0940f,
+0xc0b60fd2, 0x4589d8f7, 0x00d28390, 0x000544b8,
+0x89daf700, 0x160f9455, 0x0f66904d, 0xfa83d150,
+0xf7850f03, 0x0f000004, 0x0fe85556, 0x0fa85529,
+0x0fe84554, 0x0fc84d28, 0x66e84d57, 0x904dd60f,
+0xc84d290f, 0x8b90458b, 0x550f9455, 0x0f66a845,
+0x0f66c976, 0x8b9045d6, 0x170f904d, 0x5d8b8845,
+0x31c13194, 0x09d331c0, 0xc0940fd9, 0xd8f7d231,
+0x83904589, 0x458b00d2, 0xd0453388, 0x5589daf7,
+0x8c558b94, 0xf3d45533, 0x90457e0f, 0x940fd009,
+0x0fd231c0, 0xd8f7c0b6, 0x83904589, 0x50b800d2,
+0xf7000005, 0x945589da, 0x9045160f, 0xd0500f66,
+0x0f03fa83, 0x00046585, 0x45280f00, 0xd0280fd8,
+0xe865280f, 0xd2730f66, 0xd8280f20, 0x55f40f66,
+0xf40f66e8, 0x0f66e85d, 0x6620d473, 0x66e0f40f,
+0x66d4d40f, 0x20f2730f, 0xd3d40f66, 0x55d60f66,
+0x55290f90, 0x90458ba8, 0x8394558b, 0xd00902f0,
+0x31c0940f, 0xc0b60fd2, 0x4589d8f7, 0x00d28390,
+0xf7b0458b, 0x945589da, 0xf3b4558b, 0x90557e0f,
+0x0902f083, 0xc0940fd0, 0xb60fd231, 0x89d8f7c0,
+0xd2839045, 0x05c8b800, 0xdaf70000, 0x0f945589,
+0x66905516, 0x83d2500f, 0x850f03fa, 0x000003ce,
+0xc845290f, 0xc855280f, 0xf2730f66, 0xd60f6603,
+0x290f9055, 0x458ba855, 0x94558b90, 0xc855280f,
+0xf2730f66, 0x55290f02, 0xd40f66b8, 0xd60f66d2,
+0x4d8b9055, 0x55170f90, 0x945d8b88, 0xc031c131,
+0xd909d331, 0x31c0940f, 0x89d8f7d2, 0xd2839045,
+0x88458b00, 0xf7b04533, 0x945589da, 0x338c558b,
+0x0ff3b455, 0x0990557e, 0xc0940fd0, 0xb60fd231,
+0x89d8f7c0, 0xd2839045, 0x05edb800, 0xdaf70000,
+0x0f945589, 0x66905516, 0x83d2500f, 0x850f03fa,
+0x0000033a, 0xa855280f, 0xd2730f66, 0xd40f6602,
+0xd60f66d2, 0x458b9055, 0x55170f90, 0x94558b88,
+0x33b84533, 0xd009bc55, 0x31c0940f, 0xc0b60fd2,
+0x4589d8f7, 0x00d28390, 0x3388458b, 0xdaf7c045,
+0x8b945589, 0x55338c55, 0x7e0ff3c4, 0xd0099055,
+0x31c0940f, 0xc0b60fd2, 0x4589d8f7, 0x00d28390,
+0x0005f2b8, 0x89daf700, 0x160f9455, 0x0f669055,
+0xfa83d250, 0xc3850f03, 0xc7000002, 0x0003a445,
+0x280f0000, 0x6e0f66d0, 0x0f66a45d, 0x45c7d3f3,
+0x000002a4, 0x6e0f6600, 0x0f66a45d, 0x290fc3f3,
+0x0f66b845, 0x0f66c0d4, 0x8b9045d6, 0x170f9045,
+0x558b8845, 0xd60f6694, 0x45339055, 0x94553390,
+0x940fd009, 0x0fd231c0, 0xd8f7c0b6, 0x83904589,
+0x458b00d2, 0x89daf788, 0x558b9455, 0x55170f8c,
+0x88453388, 0x457e0ff3, 0x8c553390, 0x940fd009,
+0x0fd231c0, 0xd8f7c0b6, 0x83904589, 0x05b800d2,
+0xf7000006, 0x945589da, 0x9045160f, 0xd0500f66,
+0x0f03fa83, 0x00022585, 0x6e0f6600, 0x0f66a445,
+0x0f66d0d3, 0x0f66d2d4, 0x8b9055d6, 0x170f9045,
+0x558b8855, 0xb8453394, 0x09bc5533, 0xc0940fd0,
+0xb60fd231, 0x89d8f7c0, 0xd2839045, 0x88458b00,
+0xf7c04533, 0x945589da, 0x338c558b, 0x0ff3c455,
+0x0990457e, 0xc0940fd0, 0xb60fd231, 0x89d8f7c0,
+0xd2839045, 0x0609b800, 0xdaf70000, 0x0f945589,
+0x66904516, 0x83d0500f, 0x850f03fa, 0x000001ae,
+0x45700f66, 0x0f664ed8, 0x8b9045d6, 0x558b9045,
+0x45170f94, 0xe8453388, 0x09ec5533, 0xc0940fd0,
+0xb60fd231, 0x89d8f7c0, 0xd2839045, 0x88458b00,
+0xf7f04533, 0x945589da, 0x338c558b, 0x0ff3f455,
+0x0990457e, 0xc0940fd0, 0xb60fd231, 0x89d8f7c0,
+0xd2839045, 0x064eb800, 0xdaf70000, 0x0f945589,
+0x66904516, 0x83d0500f, 0x850f03fa, 0x0000013e,
+0xff9045c7, 0xc7ffffff, 0xffff9445, 0x0ff3ffff,
+0xf390557e, 0x0fd27e0f, 0x66e85d28, 0xd85d6c0f,
+0xe845280f, 0x456d0f66, 0xd40f66d8, 0xca570fc1,
+0xc3fb0f66, 0x66c2570f, 0x66c1fb0f, 0x9045d60f,
+0x0f90458b, 0x8b884517, 0xf0839455, 0x0fd00901,
+0xd231c094, 0xf7c0b60f, 0x904589d8, 0x8b00d283,
+0xdaf78845, 0x8b945589, 0x0ff38c55, 0x8390457e,
+0xd00901f0, 0x31c0940f, 0xc0b60fd2, 0x4589d8f7,
+0x00d28390, 0x0006a8b8, 0x89daf700, 0x160f9455,
+0x0f669045, 0xfa83d050, 0x9f850f03, 0x0f000000,
+0x8dd84528, 0x0ff3c87d, 0x0ff3c87e, 0x290fc97e,
+0x0f66c84d, 0xf39045d6, 0xf04d7e0f, 0x8b90458b,
+0x0f669455, 0x280fc2f7, 0x0f66e875, 0x570fc076,
+0xf70f66c2, 0xc84d8bf0, 0x457e0ff3, 0xcc5d8bd0,
+0x31c1570f, 0x31c031c1, 0x0fd909d3, 0xd231c094,
+0x4589d8f7, 0x00d28390, 0x5589daf7, 0x7e0f6694,
+0x730f66c2, 0x0f6620d0, 0xc209c07e, 0x457e0ff3,
+0xc0940f90, 0xb60fd231, 0x89d8f7c0, 0xd2839045,
+0x89daf700, 0x00ba9455, 0x0f000000, 0x66904516,
+0x83c0500f, 0x2ab803f8, 0x0f000007, 0xc483c244,
+0x5d5f5b70, 0x000000c3,
+0003325,
+};
+asm(".type sse2_x86_32_D_16u8, STT_NOTYPE;");
+asm(".type sse2_x86_32_D_16u8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_32_D_16f4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xe8d955c3,
+0x8357e589, 0x55d964ec, 0x1405d9c8, 0xd9001003,
+0xc9d9d855, 0xd9e855d9, 0x10031805, 0xcc55d900,
+0x031c05d9, 0x55d90010, 0xd9e8d9dc, 0xec55d9e0,
+0x5dd9c9d9, 0xd9c9d9d0, 0xc9d9e05d, 0xd9f055d9,
+0xd45dd9ca, 0x5dd9c9d9, 0xf45dd9e4, 0xc86d280f,
+0x986d290f, 0x9845280f, 0x000539b8, 0xc8280f00,
+0x00cdc20f, 0x83d1500f, 0x850f0ffa, 0x0000028e,
+0xc84d280f, 0x0fc8580f, 0x0fa84d29, 0xb8c84d28,
+0x0000053f, 0x0fc9580f, 0x00a84dc2, 0x83d1500f,
+0x850f0ffa, 0x00000266, 0xa84d280f, 0xc84d5c0f,
+0xb84d290f, 0xb8c8280f, 0x00000544, 0xb84dc20f,
+0xd1500f00, 0x0f0ffa83, 0x00024185, 0x55280f00,
+0x45590fd8, 0xd2590fc8, 0xc84d280f, 0xd865280f,
+0x0fe1580f, 0x5bb8d928, 0x0f000005, 0x0fd85d5c,
+0x590fc25c, 0xc3c20fdc, 0xd0500f00, 0x0f0ffa83,
+0x00020985, 0x45280f00, 0xc1590fe8, 0x9845290f,
+0xe84d5e0f, 0x000564b8, 0xc1c20f00, 0xd0500f00,
+0x0f0ffa83, 0x0001e585, 0x100ff300, 0x10032015,
+0x0567b800, 0x280f0000, 0x280fe84d, 0xd2c60fc1,
+0xc2570f00, 0x9845590f, 0xc855570f, 0x00c2c20f,
+0x83d0500f, 0x850f0ffa, 0x000001b2, 0x455b0f66,
+0xc05b0fc8, 0xc845c20f, 0x056eb800, 0x500f0000,
+0x0ffa83d0, 0x0194850f, 0x530f0000, 0x290fc845,
+0x530f9845, 0x75b89845, 0x0f000005, 0x66c85528,
+0x0fc05b0f, 0xc20fc05b, 0x500f00c2, 0x0ffa83d0,
+0x0168850f, 0x280f0000, 0xc2590fc2, 0x9845290f,
+0x9845520f, 0xa845290f, 0xa845280f, 0x00057cb8,
+0xd8530f00, 0xdb5b0f66, 0x0fdb5b0f, 0x0f00d3c2,
+0xfa83d250, 0x33850f0f, 0x66000001, 0x0fd05b0f,
+0xb8c84528, 0x0000057e, 0x0fd25b0f, 0x0f66d853,
+0x5b0fdb5b, 0xd3c20fdb, 0xd2500f00, 0x0f0ffa83,
+0x00010985, 0xd0280f00, 0x0fd0590f, 0x0f985529,
+0xb8985551, 0x0000059c, 0x00d0c20f, 0x83d2500f,
+0x850f0ffa, 0x000000e6, 0xd855280f, 0x0fd8280f,
+0x590fd159, 0x55290fd9, 0xd3280fa8, 0xa8555f0f,
+0xa85d5d0f, 0xa85d290f, 0xa855580f, 0x00063db8,
+0x45580f00, 0xd1590fd8, 0x00c2c20f, 0x83d0500f,
+0x850f0ffa, 0x000000a6, 0xc845280f, 0x00064eb8,
+0xc0c60f00, 0x45c20f1b, 0x500f00d8, 0x0ffa83d0,
+0x0088850f, 0x280f0000, 0x140fd845, 0x280fc845,
+0x150fd855, 0x5c0fc855, 0x06a8b8c2, 0x0ff30000,
+0x03181510, 0x590f0010, 0xd2c60fc1, 0x45290f00,
+0xc2c20fb8, 0xd0500f00, 0x750ffa83, 0x75280f51,
+0xc0570fc8, 0xbab87d8d, 0x00000000, 0xa875290f,
+0x0fdc45d9, 0x0f01c1c2, 0xd9c87d28, 0x0f66ac5d,
+0x45d9c976, 0xb45dd9e4, 0xf8f70f66, 0xd86d280f,
+0x66c1570f, 0x0fe8f70f, 0x0fb84528, 0x00a845c2,
+0x83c0500f, 0x2ab80ff8, 0x0f000007, 0xc483c244,
+0xc35d5f64, 0x40800000, 0x40000000, 0x40400000,
+0x80000000,
+0001444,
+};
+asm(".type sse2_x86_32_D_16f4, STT_NOTYPE;");
+asm(".type sse2_x86_32_D_16f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_32_D_16f8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0xe589e8d9, 0x64ec8357, 0xd9c855dd, 0x10035805,
+0xd855dd00, 0x4589c9d9, 0xe855ddf0, 0x45c7c9d9,
+0xf00000f4, 0xd05dddbf, 0x0fe05ddd, 0x0fc86d28,
+0x0f986d29, 0xb8984528, 0x00000539, 0x66c8280f,
+0x00cdc20f, 0xd1500f66, 0x0f03fa83, 0x0002ec85,
+0x4d280f00, 0x580f66c8, 0x4d290fc8, 0x4d280fa8,
+0x053fb8c8, 0x0f660000, 0x0f66c958, 0x00a84dc2,
+0xd1500f66, 0x0f03fa83, 0x0002c085, 0x4d280f00,
+0x5c0f66a8, 0x290fc84d, 0x280fb84d, 0x0544b8c8,
+0x0f660000, 0x00b84dc2, 0xd1500f66, 0x0f03fa83,
+0x00029885, 0x55280f00, 0x590f66d8, 0x0f66c845,
+0x280fd259, 0x280fc84d, 0x0f66d865, 0x280fe158,
+0x5c0f66d9, 0x055bb8c2, 0x0f660000, 0x66d85d5c,
+0x66dc590f, 0x00c3c20f, 0xd0500f66, 0x0f03fa83,
+0x00025885, 0x45280f00, 0x590f66e8, 0x45290fc1,
+0x5e0f6698, 0x0f66e84d, 0x6600c1c2, 0x83d0500f,
+0x64b803fa, 0x0f000005, 0x00023085, 0x4d280f00,
+0x100ff2e8, 0x10036015, 0x140f6600, 0x0567b8d2,
+0x280f0000, 0xc2570fc1, 0xc855570f, 0x45590f66,
+0xc20f6698, 0x0f6600c2, 0xfa83d050, 0xfa850f03,
+0xf2000001, 0xc845e60f, 0xc0e60ff3, 0x45c20f66,
+0x0f6600c8, 0xfa83d050, 0x056eb803, 0x850f0000,
+0x000001d9, 0x455a0f66, 0xc0530fc8, 0x0fc05a0f,
+0x66984529, 0x98455a0f, 0xb8c0530f, 0x00000575,
+0xc855280f, 0xf2c05a0f, 0xf3c0e60f, 0x66c0e60f,
+0x00c2c20f, 0xd0500f66, 0x0f03fa83, 0x00019c85,
+0xc2280f00, 0xc2590f66, 0x9845290f, 0x455a0f66,
+0xc0520f98, 0x0fc05a0f, 0x0fa84529, 0xb8a85d28,
+0x0000057c, 0xc35a0f66, 0x0fc0530f, 0x0ff2c05a,
+0x0ff3c0e6, 0x0f66c0e6, 0x6600d0c2, 0x83d2500f,
+0x850f03fa, 0x00000155, 0xc855280f, 0xdbe60ff2,
+0xdbe60ff3, 0x00057eb8, 0x5a0f6600, 0xc0530fc2,
+0xf2c05a0f, 0xf3c0e60f, 0x66c0e60f, 0x00d8c20f,
+0xd3500f66, 0x0f03fa83, 0x00012085, 0xc2280f00,
+0xc2590f66, 0x9845290f, 0x45510f66, 0xc20f6698,
+0x0f6600c2, 0xfa83d050, 0x059cb803, 0x850f0000,
+0x000000f9, 0xd845280f, 0x66da280f, 0x66c1590f,
+0x0fd9590f, 0x0fa84529, 0x0f66c328, 0x66a8455f,
+0xa85d5d0f, 0xa85d290f, 0x45580f66, 0x580f66a8,
+0x0f66d855, 0x0f66c159, 0x6600c2c2, 0x83d0500f,
+0x3db803fa, 0x0f000006, 0x0000b085, 0x45280f00,
+0x064eb8c8, 0x0f660000, 0x6601c0c6, 0xd845c20f,
+0x500f6600, 0x03fa83d0, 0x008f850f, 0x280f0000,
+0x0f66d845, 0x0fc84516, 0x66c85528, 0xe055120f,
+0xc25c0f66, 0x15100ff2, 0x00100368, 0xc1590f66,
+0xd2140f66, 0xb845290f, 0xc2c20f66, 0x500f6600,
+0x03fa83d0, 0x0006a8b8, 0x0f527500, 0x0fc87528,
+0x7d8dc057, 0x100ff2b8, 0x00bae07d, 0x0f000000,
+0x66a87529, 0x01c1c20f, 0xc9760f66, 0xc86d280f,
+0x7d110ff2, 0xf70f66b0, 0x75280fe8, 0xc1570fd8,
+0xf0f70f66, 0xb845280f, 0x45c20f66, 0x0f6600a8,
+0xf883c050, 0x072ab803, 0x440f0000, 0x64c483c2,
+0x00c35d5f, 0x00000000, 0x40000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x3ff00000,
+0001560,
+};
+asm(".type sse2_x86_32_D_16f8, STT_NOTYPE;");
+asm(".type sse2_x86_32_D_16f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_32_D_f4[] = {
+0x31551aeb, 0x80e589c0, 0xff08287c, 0x83400a75,
+0xf37504f8, 0x02eb01b0, 0xc35dc031, 0x81e58955,
+0x0000f8ec, 0x100ff300, 0x1004f005, 0x110ff300,
+0xffff4085, 0x110ff3ff, 0xffff4485, 0x110ff3ff,
+0xffff4885, 0x40858bff, 0x89ffffff, 0xffff3485,
+0x100ff3ff, 0xffff4085, 0xbac031ff, 0x00000000,
+0x34852e0f, 0x0fffffff, 0x450fc09b, 0x89d8f7c2,
+0x8be82404, 0x83ffffff, 0xc18810c4, 0x000539b8,
+0x0fc98400, 0x00046084, 0x100ff300, 0xffff3485,
+0x580ff3ff, 0xffff4085, 0x110ff3ff, 0xffff3885,
+0x100ff3ff, 0xffff4085, 0x10ec83ff, 0x0ff3c031,
+0x2e0fc058, 0xffff3885, 0xc09b0fff, 0xf7c2450f,
+0x240489d8, 0xffff39e8, 0x10c483ff, 0x3fb8c188,
+0x84000005, 0x0e840fc9, 0xf3000004, 0x3885100f,
+0xf3ffffff, 0x40855c0f, 0xf3ffffff, 0x1885110f,
+0x8bffffff, 0xffff1885, 0x748589ff, 0x89ffffff,
+0xffff3885, 0x3c8589ff, 0xf3ffffff, 0x3485100f,
+0x83ffffff, 0xc03110ec, 0x3c852e0f, 0x0fffffff,
+0x450fc09b, 0x89d8f7c2, 0xd3e82404, 0x83fffffe,
+0xc18810c4, 0x000544b8, 0x0fc98400, 0x0003a884,
+0x100ff300, 0xffff3485, 0x590ff3ff, 0xffff4085,
+0x110ff3ff, 0xffff3485, 0x100ff3ff, 0xffff4485,
+0x590ff3ff, 0x110ff3c0, 0xffff3885, 0x100ff3ff,
+0xffff4085, 0x580ff3ff, 0xffff4485, 0x110ff3ff,
+0xffff3c85, 0x100ff3ff, 0xffff4085, 0x10ec83ff,
+0x95100ff3, 0xffffff34, 0x280fc031, 0x5c0ff3c8,
+0xffff448d, 0x5c0ff3ff, 0xffff3895, 0x590ff3ff,
+0xffff3c8d, 0x110ff3ff, 0xffff3c8d, 0xd12e0fff,
+0x0fc09b0f, 0xd8f7c245, 0xe8240489, 0xfffffe32,
+0x8810c483, 0x055bb8c1, 0xc9840000, 0x0307840f,
+0x0ff30000, 0xff488559, 0x0ff3ffff, 0xff348511,
+0x0ff3ffff, 0xff408510, 0xec83ffff, 0xf3c03110,
+0x48855e0f, 0x0fffffff, 0xff34852e, 0x0ff3ffff,
+0xff388511, 0x9b0fffff, 0xc2450fc0, 0x0489d8f7,
+0xfddce824, 0xc483ffff, 0xb8c18810, 0x00000564,
+0x840fc984, 0x000002b1, 0x15100ff3, 0x00100500,
+0xf310ec83, 0x4885100f, 0x31ffffff, 0x100ff3c0,
+0xffff408d, 0xc2570fff, 0x85590ff3, 0xffffff34,
+0x0fca570f, 0x9b0fc12e, 0xc2450fc0, 0x0489d8f7,
+0xfd8ce824, 0xc483ffff, 0xb8c18810, 0x00000567,
+0x840fc984, 0x00000261, 0x852c0ff3, 0xffffff40,
+0xff4c8589, 0x0ff3ffff, 0xff4c852a, 0x0ff3ffff,
+0xff348511, 0x0ff3ffff, 0xff348510, 0xec83ffff,
+0x0fc03110, 0xff40852e, 0x9b0fffff, 0xc2450fc0,
+0x0489d8f7, 0xfd38e824, 0xc483ffff, 0xb8c18810,
+0x0000056e, 0x840fc984, 0x0000020d, 0x85530ff3,
+0xffffff40, 0x85110ff3, 0xffffff34, 0x85530ff3,
+0xffffff34, 0xc02c0ff3, 0xff4c8589, 0x0ff3ffff,
+0xff4c8d2a, 0xec83ffff, 0xf3c03110, 0x4085100f,
+0x0fffffff, 0x9b0fc82e, 0xc2450fc0, 0x0489d8f7,
+0xfcdce824, 0xc483ffff, 0xb8c18810, 0x00000575,
+0x840fc984, 0x000001b1, 0xc0590ff3, 0x85110ff3,
+0xffffff34, 0x85520ff3, 0xffffff34, 0x85110ff3,
+0xffffff38, 0x85530ff3, 0xffffff38, 0xc02c0ff3,
+0xff4c8589, 0x0ff3ffff, 0xff4c852a, 0xec83ffff,
+0x0fc03110, 0xff40852e, 0x9b0fffff, 0xc2450fc0,
+0x0489d8f7, 0xfc78e824, 0xc483ffff, 0xb8c18810,
+0x0000057c, 0x840fc984, 0x0000014d, 0x852c0ff3,
+0xffffff38, 0xff4c8589, 0x0ff3ffff, 0xff408553,
+0x0ff3ffff, 0x0ff3c02c, 0xff4c8d2a, 0x8589ffff,
+0xffffff4c, 0x852a0ff3, 0xffffff4c, 0x3110ec83,
+0xc82e0fc0, 0x0fc09b0f, 0xd8f7c245, 0xe8240489,
+0xfffffc1e, 0x8810c483, 0x057eb8c2, 0xd2840000,
+0x00f3840f, 0x0ff30000, 0xff408510, 0x0ff3ffff,
+0x0ff3c059, 0xff348511, 0x0ff3ffff, 0xff408d10,
+0xec83ffff, 0xbac03110, 0x00000000, 0x85510ff3,
+0xffffff34, 0x0fc12e0f, 0x450fc09b, 0x89d8f7c2,
+0xcbe82404, 0x83fffffb, 0xc18810c4, 0x00059cb8,
+0x0fc98400, 0x0000a084, 0x100ff300, 0xffff4885,
+0x590ff3ff, 0x590ff3c8, 0xffff4485, 0x110ff3ff,
+0xffff348d, 0x110ff3ff, 0xffff3885, 0x100ff3ff,
+0xffff3485, 0x5f0ff3ff, 0xffff3885, 0x110ff3ff,
+0xffff3c85, 0x100ff3ff, 0xffff3485, 0x5d0ff3ff,
+0xffff3885, 0x110ff3ff, 0xffff3885, 0x100ff3ff,
+0xffff3885, 0x10ec83ff, 0x8d100ff3, 0xffffff40,
+0x0ff3c031, 0xff3c8558, 0x0ff3ffff, 0xff448d58,
+0x0ff3ffff, 0xff488559, 0x2e0fffff, 0xc09b0fc1,
+0xf7c2450f, 0x240489d8, 0xfffb25e8, 0x10c483ff,
+0xc019013c, 0x00063d25, 0x00c3c900, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0002420,
+};
+asm(".type sse2_x86_32_D_f4, STT_NOTYPE;");
+asm(".type sse2_x86_32_D_f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_32_D_f8[] = {
+0x895500eb, 0xb8ec81e5, 0xf2000001, 0x3005100f,
+0xf2001006, 0x9085110f, 0xf2fffffe, 0x9885110f,
+0xf2fffffe, 0xa085110f, 0x8bfffffe, 0xfffe9085,
+0x788589ff, 0x8bfffffe, 0xfffe9485, 0x7c8589ff,
+0xf2fffffe, 0x909d100f, 0x66fffffe, 0x789d2e0f,
+0x7afffffe, 0x0001b80c, 0x00ba0000, 0x74000000,
+0x31c03104, 0x89d8f7d2, 0xfffe5085, 0x00d283ff,
+0x000539b8, 0x89daf700, 0xfffe5495, 0x856f0fff,
+0xfffffe50, 0x81d0d70f, 0x0000fffa, 0x90850f00,
+0xf2000005, 0x7885100f, 0xf2fffffe, 0x9085580f,
+0xf2fffffe, 0x8085110f, 0x31fffffe, 0x100ff2d2,
+0xfffe9085, 0x0001b8ff, 0x0ff20000, 0x0f66c058,
+0xfe80852e, 0x027affff, 0xc0310474, 0xd8f7d231,
+0xfe508589, 0xd283ffff, 0x053fb800, 0xdaf70000,
+0xfe549589, 0x6f0fffff, 0xfffe508d, 0xd1d70fff,
+0x00fffa81, 0x850f0000, 0x00000527, 0x85100ff2,
+0xfffffe80, 0x855c0ff2, 0xfffffe90, 0x85110ff2,
+0xfffffe58, 0xfe58958b, 0x858bffff, 0xfffffe5c,
+0xfef09589, 0x8589ffff, 0xfffffef4, 0xfe809589,
+0x8589ffff, 0xfffffe84, 0xfe889589, 0x8589ffff,
+0xfffffe8c, 0x0ff2d231, 0xfe78a510, 0x01b8ffff,
+0x66000000, 0x88a52e0f, 0x7afffffe, 0x31047402,
+0xf7d231c0, 0x508589d8, 0x83fffffe, 0x44b800d2,
+0xf7000005, 0x549589da, 0x0ffffffe, 0xfe50956f,
+0xd70fffff, 0xfffa81d2, 0x0f000000, 0x00049285,
+0x100ff200, 0xfffe7885, 0x590ff2ff, 0xfffe9085,
+0x110ff2ff, 0xfffe7885, 0x100ff2ff, 0xfffe9885,
+0x590ff2ff, 0x110ff2c0, 0xfffe8085, 0x100ff2ff,
+0xfffe9085, 0x580ff2ff, 0xfffe9885, 0x110ff2ff,
+0xfffe8885, 0x100ff2ff, 0xfffe9085, 0xc8280fff,
+0x0ff2d231, 0xfe988d5c, 0x0ff2ffff, 0xfe789510,
+0x0ff2ffff, 0xfe888d59, 0x0ff2ffff, 0xfe80955c,
+0x01b8ffff, 0xf2000000, 0x888d110f, 0x66fffffe,
+0x7ad12e0f, 0x31047402, 0xf7d231c0, 0x508589d8,
+0x83fffffe, 0x5bb800d2, 0xf7000005, 0x549589da,
+0x0ffffffe, 0xfe509d6f, 0xd70fffff, 0xfffa81d3,
+0x0f000000, 0x0003da85, 0x590ff200, 0xfffea085,
+0x110ff2ff, 0xfffe7885, 0xf2d231ff, 0x9085100f,
+0xb8fffffe, 0x00000001, 0x855e0ff2, 0xfffffea0,
+0x85110ff2, 0xfffffe80, 0x852e0f66, 0xfffffe78,
+0x0474027a, 0xd231c031, 0x8589d8f7, 0xfffffe50,
+0xb800d283, 0x00000564, 0x9589daf7, 0xfffffe54,
+0x50a56f0f, 0x0ffffffe, 0xfa81d4d7, 0x000000ff,
+0x036d850f, 0x0ff30000, 0x06400d7e, 0x0ff20010,
+0xfea08510, 0x0ff2ffff, 0xfe90ad10, 0x570fffff,
+0x0fd231c1, 0x0ff2cd57, 0xfe788559, 0x01b8ffff,
+0x66000000, 0x7ac12e0f, 0x31047402, 0xf7d231c0,
+0x508589d8, 0x83fffffe, 0x67b800d2, 0xf7000005,
+0x549589da, 0x0ffffffe, 0xfe50ad6f, 0xd70fffff,
+0xfffa81d5, 0x0f000000, 0x00030685, 0x2c0ff200,
+0xfffe9085, 0x748589ff, 0xf2fffffe, 0x74852a0f,
+0xf2fffffe, 0x7885110f, 0x31fffffe, 0x100ff2d2,
+0xfffe78b5, 0x0001b8ff, 0x0f660000, 0xfe90b52e,
+0x027affff, 0xc0310474, 0xd8f7d231, 0xfe508589,
+0xd283ffff, 0x056eb800, 0xdaf70000, 0xfe549589,
+0x6f0fffff, 0xfffe50b5, 0xd6d70fff, 0x00fffa81,
+0x850f0000, 0x0000029b, 0x855a0ff2, 0xfffffe90,
+0xc0530ff3, 0xc05a0ff3, 0x85130f66, 0xfffffe78,
+0x855a0ff2, 0xfffffe78, 0xc0530ff3, 0xc05a0ff3,
+0xc02c0ff2, 0xfe748589, 0x0ff2ffff, 0xfe748d2a,
+0xd231ffff, 0x85100ff2, 0xfffffe90, 0x000001b8,
+0x2e0f6600, 0x74027ac8, 0x31c03104, 0x89d8f7d2,
+0xfffe5085, 0x00d283ff, 0x000575b8, 0x89daf700,
+0xfffe5495, 0xbd6f0fff, 0xfffffe50, 0x81d7d70f,
+0x0000fffa, 0x18850f00, 0xf2000002, 0xf2c0590f,
+0x7885110f, 0xf2fffffe, 0x78855a0f, 0xf3fffffe,
+0xf3c0520f, 0x66c05a0f, 0x8085130f, 0xf2fffffe,
+0x80855a0f, 0xf3fffffe, 0xf3c0530f, 0xf2c05a0f,
+0x89c02c0f, 0xfffe7485, 0x2a0ff2ff, 0xfffe7485,
+0xb8d231ff, 0x00000001, 0x852e0f66, 0xfffffe90,
+0x0474027a, 0xd231c031, 0x8589d8f7, 0xfffffe50,
+0xb800d283, 0x0000057c, 0x9589daf7, 0xfffffe54,
+0x50856f0f, 0x0ffffffe, 0xfa81d0d7, 0x000000ff,
+0x018d850f, 0x0ff20000, 0xfe80852c, 0x8589ffff,
+0xfffffe74, 0x855a0ff2, 0xfffffe90, 0xc0530ff3,
+0xc05a0ff3, 0xd02c0ff2, 0xfe74858b, 0x9589ffff,
+0xfffffe74, 0xfe74853b, 0x940fffff, 0x0fd231c0,
+0xd8f7c0b6, 0xfe508589, 0xd283ffff, 0x057eb800,
+0xdaf70000, 0xfe549589, 0x6f0fffff, 0xfffe508d,
+0xd1d70fff, 0x00fffa81, 0x850f0000, 0x00000123,
+0x85100ff2, 0xfffffe90, 0xc0590ff2, 0x85110ff2,
+0xfffffe78, 0x0ff2d231, 0xfe908d10, 0x01b8ffff,
+0xf2000000, 0x7885510f, 0x66fffffe, 0x7ac12e0f,
+0x31047402, 0xf7d231c0, 0x508589d8, 0x83fffffe,
+0x9cb800d2, 0xf7000005, 0x549589da, 0x0ffffffe,
+0xfe50956f, 0xd70fffff, 0xfffa81d2, 0x0f000000,
+0x0000be85, 0x100ff200, 0xfffea085, 0x590ff2ff,
+0x590ff2c8, 0xfffe9885, 0x110ff2ff, 0xfffe788d,
+0x110ff2ff, 0xfffe8085, 0x100ff2ff, 0xfffe7885,
+0x5f0ff2ff, 0xfffe8085, 0x110ff2ff, 0xfffe8885,
+0x100ff2ff, 0xfffe7885, 0x5d0ff2ff, 0xfffe8085,
+0x110ff2ff, 0xfffe8085, 0xf2d231ff, 0x8085100f,
+0xf2fffffe, 0x908d100f, 0xf2fffffe, 0x8885580f,
+0xf2fffffe, 0x988d580f, 0xf2fffffe, 0xa085590f,
+0xb8fffffe, 0x00000001, 0xc12e0f66, 0x0474027a,
+0xd231c031, 0x8589d8f7, 0xfffffe50, 0xf700d283,
+0x549589da, 0xbafffffe, 0x00000000, 0x509d6f0f,
+0x0ffffffe, 0xff3dc3d7, 0xb8000000, 0x0000063d,
+0xc9c2440f, 0x000000c3, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x00000000,
+0003120,
+};
+asm(".type sse2_x86_32_D_f8, STT_NOTYPE;");
+asm(".type sse2_x86_32_D_f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_64_D_16i1[] = {
+0x315500eb, 0x4810b1c0, 0x508de589, 0x05548801,
+0x29ca89d0, 0x285488c2, 0x83c289e0, 0xfa8301e2,
+0x83d21901, 0xcaff02e2, 0xf0055488, 0x48c0ff48,
+0x7510f883, 0x75280fd5, 0x75290fd0, 0x4d280fa0,
+0x0539b8a0, 0x280f0000, 0x740f66c1, 0xd70f66c6,
+0xfffa81d0, 0x0f0000ff, 0x00011c85, 0x45280f00,
+0xfc0f66d0, 0x45290fc1, 0x45280fb0, 0x053fb8d0,
+0x0f660000, 0x0f66c0fc, 0x66b04574, 0x81d0d70f,
+0x00fffffa, 0xee850f00, 0x0f000000, 0x66b04528,
+0xd045f80f, 0xc045290f, 0x4d740f66, 0x0544b8c0,
+0x0f660000, 0xfa81d1d7, 0x0000ffff, 0x00c7850f,
+0x280f0000, 0x280fe05d, 0x600f66d3, 0x290fd055,
+0x280fa055, 0x680f66cb, 0x280fd04d, 0x0f66f045,
+0xa8b8d1f8, 0x0f000006, 0x280fea28, 0xe0280fc8,
+0xea600f66, 0xc8600f66, 0xd2680f66, 0xe0680f66,
+0xe2d50f66, 0xcdd50f66, 0x8115280f, 0x0f000000,
+0x540fca54, 0x670f66d4, 0x4d290fca, 0x740f66c0,
+0x00007b0d, 0xd70f6600, 0xfffa81d1, 0x750000ff,
+0x4d280f58, 0x0001b8d0, 0x290f0000, 0x548ab04d,
+0x5488e005, 0x8348b005, 0x834802c0, 0xee7511f8,
+0x48d2570f, 0xbac07d8d, 0x00000000, 0xc2640f66,
+0xc8f70f66, 0xc9760f66, 0x66c1550f, 0x0fd8f70f,
+0x66c04528, 0xb045740f, 0xc0d70f66, 0x00ffff3d,
+0x072ab800, 0x440f0000, 0x00c35dc2, 0x00000000,
+0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff,
+0x08080808, 0x08080808, 0x08080808, 0x08080808,
+0000640,
+};
+asm(".type sse2_x86_64_D_16i1, STT_NOTYPE;");
+asm(".type sse2_x86_64_D_16i1, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_64_D_16u1[] = {
+0x315500eb, 0x4810b1c0, 0x508de589, 0x05548801,
+0x29ca89d0, 0x285488c2, 0x83c289e0, 0xcaff01e2,
+0xf0055488, 0x48c0ff48, 0x7510f883, 0x75280fdd,
+0x75290fd0, 0x4d280fa0, 0x0539b8a0, 0x280f0000,
+0x740f66c1, 0xd70f66c6, 0xfffa81d0, 0x0f0000ff,
+0x00016c85, 0x45280f00, 0xfc0f66d0, 0x45290fc1,
+0x45280fb0, 0x053fb8d0, 0x0f660000, 0x0f66c0fc,
+0x66b04574, 0x81d0d70f, 0x00fffffa, 0x3e850f00,
+0x0f000001, 0x66b04528, 0xd045f80f, 0xc045290f,
+0xb8d1280f, 0x00000544, 0x55740f66, 0xd70f66c0,
+0xfffa81d2, 0x0f0000ff, 0x00011485, 0x4d560f00,
+0x4d290fe0, 0x45540fa0, 0x4d280fe0, 0x4d570fc0,
+0x45550fe0, 0x760f66a0, 0x0550b8d2, 0x0f660000,
+0x0f66c174, 0xfa81d0d7, 0x0000ffff, 0x00df850f,
+0x280f0000, 0x280fd04d, 0x0f66e045, 0x280fc1da,
+0x0f66e05d, 0x0f66d9de, 0x66e04dfc, 0xb8c3fc0f,
+0x00000634, 0xc1740f66, 0xd0d70f66, 0xfffffa81,
+0x850f0000, 0x000000a9, 0xe05d280f, 0x66e3280f,
+0xd065600f, 0xa065290f, 0x66c3280f, 0xd045680f,
+0xf04d280f, 0xc2fc0f66, 0x0006a8b8, 0xf80f6600,
+0xe1280fc4, 0x0fc1570f, 0x0f66e257, 0x0f66c4f8,
+0x007a0574, 0x0f660000, 0xfa81d0d7, 0x0000ffff,
+0x280f5f75, 0x570fd045, 0x0001b8ed, 0x280f0000,
+0x45290fe0, 0x600f66b0, 0x600f66e5, 0x65290fe5,
+0x05548ac0, 0x055488e0, 0xc08348b0, 0xf8834802,
+0x48ee7511, 0xbac07d8d, 0x00000000, 0xc1f70f66,
+0x66ca570f, 0x0fd9f70f, 0x66c04528, 0xb045740f,
+0xc0d70f66, 0x00ffff3d, 0x072ab800, 0x440f0000,
+0x00c35dc2, 0x00000000, 0x00000000, 0x00000000,
+0x08080808, 0x08080808, 0x08080808, 0x08080808,
+0000740,
+};
+asm(".type sse2_x86_64_D_16u1, STT_NOTYPE;");
+asm(".type sse2_x86_64_D_16u1, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_64_D_16i2[] = {
+0xb85500eb, 0x00000001, 0x000010b9, 0x09b94100,
+0x48000000, 0x5641e589, 0x54415541, 0xec834853,
+0xff708d08, 0x66cf8944, 0x9e454489, 0xc729f289,
+0x6601e283, 0xae457c89, 0x1901fa83, 0x02e283d2,
+0xc685caff, 0xc6940f40, 0x45548966, 0xb60f40be,
+0x66f129f6, 0xce454c89, 0x48c0ff48, 0x7509f883,
+0x6d280fc0, 0xad290fa0, 0xffffff70, 0x7085280f,
+0xb8ffffff, 0x00000539, 0x66c8280f, 0x66cd750f,
+0x81d1d70f, 0x00fffffa, 0x44850f00, 0x0f000004,
+0x66a04d28, 0x0fc8fd0f, 0x0f804d29, 0xb8a04d28,
+0x0000053f, 0xf1710f66, 0x750f6601, 0x0f66804d,
+0xfa81d1d7, 0x0000ffff, 0x0415850f, 0x280f0000,
+0x0f66804d, 0x0fa04df9, 0x0f904d29, 0x44b8c828,
+0x66000005, 0x904d750f, 0xd1d70f66, 0xfffffa81,
+0x850f0000, 0x000003eb, 0xb04d280f, 0x45d50f66,
+0xd50f66a0, 0x55280fc9, 0x65280fa0, 0xfd0f66b0,
+0xda280fe2, 0x5df90f66, 0xf90f66b0, 0x055bb8c1,
+0x0f660000, 0x0f66dcd5, 0x0f66c375, 0xfa81d0d7,
+0x0000ffff, 0x03a9850f, 0x280f0000, 0x0f66b045,
+0x0f66c2d5, 0x03a60575, 0xc8b80000, 0x66000005,
+0x81d0d70f, 0x00fffffa, 0x84850f00, 0x0f000003,
+0x0f66ca28, 0x0fc04de5, 0x0fc05d28, 0xcfb8c057,
+0x66000005, 0x66c3650f, 0x66c1750f, 0x81d0d70f,
+0x00fffffa, 0x58850f00, 0x0f000003, 0x0f66c328,
+0x290fc2d5, 0x280f9045, 0x0f66904d, 0x0f03f171,
+0xff708d29, 0x280fffff, 0x0f669045, 0x0f02f071,
+0x66804529, 0xb8c0fd0f, 0x000005ed, 0xc1750f66,
+0xd0d70f66, 0xfffffa81, 0x850f0000, 0x00000313,
+0x7085280f, 0x66ffffff, 0x02e0710f, 0xc0fd0f66,
+0x0005f2b8, 0x750f6600, 0x0f668045, 0xfa81d0d7,
+0x0000ffff, 0x02e9850f, 0x85c70000, 0xffffff6c,
+0x00000003, 0x66c2280f, 0x48c3d50f, 0xff6c8563,
+0x280fffff, 0x0f4866c8, 0x0f66f86e, 0x85c7cff1,
+0xffffff6c, 0x00000002, 0x6c856348, 0x66ffffff,
+0xe86e0f48, 0xc5f10f66, 0x8045290f, 0xc0fd0f66,
+0x000605b8, 0x750f6600, 0xd70f66c1, 0xfffa81d0,
+0x0f0000ff, 0x00028a85, 0x85634800, 0xffffff6c,
+0x6e0f4866, 0xe10f66f8, 0xc1280fcf, 0xc1fd0f66,
+0x000609b8, 0x750f6600, 0x0f668045, 0xfa81d0d7,
+0x0000ffff, 0x0259850f, 0x280f0000, 0x45280fca,
+0xed570fd0, 0xcbd50f66, 0xc5650f66, 0x0fc1540f,
+0x8b904529, 0x4d8b9045, 0x66c689d0, 0x926d8b44,
+0x66947d8b, 0x96658b44, 0x8b66e6d3, 0x558bd24d,
+0xfa894198, 0x5d8b4466, 0x4d8b449a, 0x6e0f669c,
+0xe5d341e6, 0x41d44d8b, 0x4466d089, 0x449e758b,
+0x4166db89, 0x01e5c40f, 0x66e2d341, 0x66d64d8b,
+0xf26e0f41, 0x8be4d341, 0x4166d84d, 0x01f4c40f,
+0x66e0d341, 0x66da4d8b, 0x66e6620f, 0xc06e0f41,
+0x4d8be3d3, 0xc40f66dc, 0xd34101c3, 0x4d8b66e1,
+0x0f4166de, 0xd341c96e, 0x0f4166e6, 0x6601cec4,
+0x66c1620f, 0x0fe06c0f, 0x66d04528, 0xbd05f90f,
+0x0f000001, 0x8bd04529, 0x4466d04d, 0x6692458b,
+0x964d8b44, 0xd39c758b, 0x4d8b66e0, 0x5d8b66d2,
+0x6e0f669e, 0x0621b8c0, 0xd3410000, 0xd44d8be0,
+0xc40f4166, 0xe7d301c0, 0xd64d8b66, 0xff6e0f66,
+0x8be1d341, 0x4166d84d, 0x01f9c40f, 0x8b66e2d3,
+0x0f66da4d, 0x0f66c762, 0xd341ca6e, 0xdc4d8be3,
+0xc40f4166, 0xe6d301cb, 0xde4d8b66, 0xf66e0f66,
+0x0f66e3d3, 0x6601f3c4, 0x66ce620f, 0x66c16c0f,
+0x66c0fd0f, 0x66c4750f, 0x81d0d70f, 0x00fffffa,
+0x0c850f00, 0x0f000001, 0x0fb04528, 0x0f66cb28,
+0x0f66cad5, 0x290fc3d5, 0x280f8045, 0x0f668045,
+0x0f66c1ee, 0x0f804dea, 0x66804d29, 0x8045fd0f,
+0x55fd0f66, 0x063db8b0, 0x0f660000, 0x0f66c3d5,
+0x0f66c275, 0xfa81d0d7, 0x0000ffff, 0x00c1850f,
+0x0ff20000, 0x1ba04570, 0xb04d280f, 0x00064eb8,
+0x700ff300, 0x0f661bc0, 0x664ec070, 0x66c1750f,
+0x81d0d70f, 0x00fffffa, 0x94850f00, 0x0f000000,
+0x0f66c128, 0x66a04561, 0xa04d690f, 0xc1f90f66,
+0x0006a8b8, 0xd50f6600, 0x45290fc3, 0x750f6690,
+0x00009b05, 0xd70f6600, 0xfffa81d0, 0x750000ff,
+0x45280f62, 0x458b66a0, 0x650f66b2, 0x7d8d48dd,
+0x0000ba90, 0x290f0000, 0x89668045, 0x8b668245,
+0x8966b645, 0x8b668645, 0x8966ba45, 0x8b668a45,
+0x8966be45, 0x0f668e45, 0x0f66c3f7, 0x280fc076,
+0x570fb06d, 0xf70f66c3, 0x45280fe8, 0x750f6690,
+0x0f668045, 0xff3dc0d7, 0xb80000ff, 0x0000072a,
+0x5ac2440f, 0x415c415b, 0x5d5e415d, 0x000000c3,
+0x000e0008, 0x00140012, 0x00120014, 0x0008000e,
+0x00010001, 0x00010001, 0x00010001, 0x00010001,
+0x00040004, 0x00040004, 0x00040004, 0x00040004,
+0002420,
+};
+asm(".type sse2_x86_64_D_16i2, STT_NOTYPE;");
+asm(".type sse2_x86_64_D_16i2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_64_D_16u2[] = {
+0xb85500eb, 0x00000001, 0x000010ba, 0x09b94100,
+0x48000000, 0x5641e589, 0x54415541, 0xec834853,
+0xff708d08, 0x66cf8944, 0x9e454489, 0xc729f189,
+0x6601e183, 0xae457c89, 0xc685c9ff, 0xc6940f40,
+0x454c8966, 0xb60f40be, 0x66f229f6, 0xce455489,
+0x48c0ff48, 0x7509f883, 0x7d280fc8, 0xbd290fa0,
+0xffffff70, 0x708d280f, 0xb8ffffff, 0x00000539,
+0x66c1280f, 0x66c7750f, 0x81d0d70f, 0x00fffffa,
+0xea850f00, 0x0f000003, 0x66a04528, 0x0fc1fd0f,
+0x0f804529, 0xb8a04528, 0x0000053f, 0xf0710f66,
+0x750f6601, 0x0f668045, 0xfa81d0d7, 0x0000ffff,
+0x03bb850f, 0x280f0000, 0x0f668045, 0x0fa045f9,
+0x0f904529, 0x44b8d128, 0x66000005, 0x9055750f,
+0xd2d70f66, 0xfffffa81, 0x850f0000, 0x00000391,
+0xb04d560f, 0x708d290f, 0x0fffffff, 0x0fb04554,
+0x0f904d28, 0x0fb04d57, 0xff708555, 0x0f66ffff,
+0x50b8d276, 0x66000005, 0x66c1750f, 0x81d0d70f,
+0x00fffffa, 0x56850f00, 0x0f000003, 0x0fa04528,
+0x66b04d28, 0x66c8d50f, 0x510d750f, 0xb8000003,
+0x000005c8, 0xd1d70f66, 0xfffffa81, 0x850f0000,
+0x0000032d, 0x66e0280f, 0xc065e40f, 0xc04d280f,
+0xb8d8280f, 0x000005d1, 0x66d9540f, 0x66d9fd0f,
+0x66dc750f, 0x81d3d70f, 0x00fffffa, 0xfe850f00,
+0x0f000002, 0x0f904529, 0x66906528, 0x03f4710f,
+0x70a5290f, 0x0fffffff, 0x66905d28, 0x02f3710f,
+0x805d290f, 0xdbfd0f66, 0x0005edb8, 0x750f6600,
+0xd70f66dc, 0xfffa81d3, 0x0f0000ff, 0x0002c085,
+0x9d280f00, 0xffffff70, 0xd3710f66, 0xfd0f6602,
+0x05f2b8db, 0x0f660000, 0x66805d75, 0x81d3d70f,
+0x00fffffa, 0x96850f00, 0xc7000002, 0xffff6c85,
+0x000003ff, 0x6e0f6600, 0xffff6ca5, 0xd8280fff,
+0xdcf10f66, 0xff6c85c7, 0x0002ffff, 0x0f660000,
+0xff6ca56e, 0x0f66ffff, 0x290fc4f1, 0x0f668045,
+0x05b8c0fd, 0x66000006, 0x66c3750f, 0x81d0d70f,
+0x00fffffa, 0x46850f00, 0x66000002, 0x6ca56e0f,
+0x66ffffff, 0x0fdcd10f, 0x0f66c328, 0x09b8c3fd,
+0x66000006, 0x8045750f, 0xd0d70f66, 0xfffffa81,
+0x850f0000, 0x00000219, 0x0fdb570f, 0x0f66c328,
+0x66d04575, 0x0fc3750f, 0x0fa04554, 0x8b904529,
+0x4d8b9045, 0x66c689d0, 0x926d8b44, 0x66947d8b,
+0x96658b44, 0x8b66e6d3, 0x558bd24d, 0xfa894198,
+0x5d8b4466, 0x4d8b449a, 0x6e0f669c, 0xe5d341ee,
+0x41d44d8b, 0x4466d089, 0x449e758b, 0x4166db89,
+0x01edc40f, 0x66e2d341, 0x66d64d8b, 0xf26e0f41,
+0x8be4d341, 0x4166d84d, 0x01f4c40f, 0x66e0d341,
+0x66da4d8b, 0x66ee620f, 0xc06e0f41, 0x4d8be3d3,
+0xc40f66dc, 0xd34101c3, 0x4d8b66e1, 0x0f4166de,
+0xd341e16e, 0x0f4166e6, 0x6601e6c4, 0x66c4620f,
+0x0fe86c0f, 0x66d04528, 0x0fc2fd0f, 0x8bd04529,
+0x4466d04d, 0x6692458b, 0x964d8b44, 0xd39c758b,
+0x4d8b66e0, 0x5d8b66d2, 0x6e0f669e, 0x0621b8c0,
+0xd3410000, 0xd44d8be0, 0xc40f4166, 0xe7d301c0,
+0xd64d8b66, 0xff6e0f66, 0x8be1d341, 0x4166d84d,
+0x01f9c40f, 0x8b66e2d3, 0x0f66da4d, 0x0f66c762,
+0xd341e26e, 0xdc4d8be3, 0xc40f4166, 0xe6d301e3,
+0xde4d8b66, 0xf66e0f66, 0x0f66e3d3, 0x6601f3c4,
+0x66e6620f, 0x66c46c0f, 0x66c0fd0f, 0x66c5750f,
+0x81d0d70f, 0x00fffffa, 0xd2850f00, 0xf2000000,
+0xa065700f, 0x45280f1b, 0x064eb8b0, 0x0ff30000,
+0x661be470, 0x4ee4700f, 0xe0750f66, 0xd4d70f66,
+0xfffffa81, 0x850f0000, 0x000000a5, 0x66e0280f,
+0xa065610f, 0x45690f66, 0xfd0f66a0, 0xd1570fc2,
+0x0006a8b8, 0xf90f6600, 0xc1570fc4, 0xc2f90f66,
+0x05750f66, 0x00000098, 0xd0d70f66, 0xfffffa81,
+0x6d750000, 0xa045280f, 0xb2458b66, 0x907d8d48,
+0x000000ba, 0x45290f00, 0xd0280f80, 0x82458966,
+0xb6458b66, 0xd3610f66, 0xd3610f66, 0x86458966,
+0xba458b66, 0x9055290f, 0x8a458966, 0xbe458b66,
+0x8e458966, 0xc1f70f66, 0xc0760f66, 0xb07d280f,
+0x66c1570f, 0x0ff8f70f, 0x66904528, 0x8045750f,
+0xc0d70f66, 0x00ffff3d, 0x072ab800, 0x440f0000,
+0x415b5ac2, 0x415d415c, 0x00c35d5e, 0x00000000,
+0x000e0008, 0x00140012, 0x00120014, 0x0008000e,
+0x00040004, 0x00040004, 0x00040004, 0x00040004,
+0002240,
+};
+asm(".type sse2_x86_64_D_16u2, STT_NOTYPE;");
+asm(".type sse2_x86_64_D_16u2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_64_D_16i4[] = {
+0xb84800eb, 0x00000001, 0x00000002, 0xe5894855,
+0xe0458948, 0x0003b848, 0x00040000, 0x89480000,
+0x01b8e845, 0x48c00000, 0x4802e0c1, 0xb8f04589,
+0x80000001, 0x48c00148, 0x0ff84589, 0x0fe07528,
+0x0fb07529, 0xb8b04528, 0x00000539, 0x66c8280f,
+0x0fce760f, 0xfa83d150, 0xdb850f0f, 0x0f000002,
+0x66e04d28, 0x0fc8fe0f, 0x0fc04d29, 0xb8e04d28,
+0x0000053f, 0xf1720f66, 0x760f6601, 0x500fc04d,
+0x0ffa83d1, 0x02b0850f, 0x280f0000, 0x0f66c04d,
+0x0fe04dfa, 0x0fd04d29, 0x44b8c828, 0x66000005,
+0xd04d760f, 0x83d1500f, 0x850f0ffa, 0x0000028a,
+0x45f40f66, 0x700f66e0, 0x280f08c0, 0x280fb04d,
+0x280fe055, 0x45280fd8, 0x730f66f0, 0x0f6620d2,
+0x0f20d173, 0x0f66e028, 0x0f66caf4, 0x0f66e0f4,
+0x6620d073, 0x66c0f40f, 0x08c9700f, 0xe4700f66,
+0x620f6608, 0x700f66d9, 0x0f6608c0, 0x280fe062,
+0x280fe045, 0x0f66f04d, 0x280fc8fe, 0xd0280fe9,
+0x55fa0f66, 0xfa0f66f0, 0x055bb8dc, 0x0f660000,
+0x6620d573, 0x66caf40f, 0x20d2730f, 0xd5f40f66,
+0xc9700f66, 0x700f6608, 0x0f6608d2, 0x0f66ca62,
+0x500fcb76, 0x0ffa83d1, 0x01ec850f, 0x280f0000,
+0x280fe04d, 0x0f66f055, 0x66f045f4, 0x08c0700f,
+0xd1730f66, 0x730f6620, 0x0f6620d2, 0x0f66d1f4,
+0x6608d270, 0x66c2620f, 0xc105760f, 0xb8000001,
+0x000005c8, 0x83d0500f, 0x850f0ffa, 0x000001aa,
+0xc915280f, 0x0f000001, 0x280fda28, 0xf40f66c2,
+0x0f66e045, 0x6608c070, 0x20d3730f, 0xcbf40f66,
+0xc9700f66, 0x620f6608, 0x45290fc1, 0x65280fd0,
+0x720f66d0, 0x290f03f4, 0x280fb065, 0x0f66d04d,
+0x0f02f172, 0x66c04d29, 0xb8c9fe0f, 0x000005ed,
+0xcc760f66, 0x83d1500f, 0x850f0ffa, 0x0000014a,
+0xb04d280f, 0xe1720f66, 0xfe0f6602, 0x05f2b8c9,
+0x0f660000, 0x0fc04d76, 0xfa83d150, 0x27850f0f,
+0xc7000001, 0x0003ac45, 0x63480000, 0x280fac45,
+0x0f4866c8, 0x0f66f86e, 0x45c7cff2, 0x000002ac,
+0x45634800, 0x0f4866ac, 0x0f66f06e, 0x290fc6f2,
+0x0f66c045, 0x05b8c0fe, 0x66000006, 0x0fc1760f,
+0xfa83d050, 0xdf850f0f, 0x48000000, 0x0fac4563,
+0x4866c128, 0x66f86e0f, 0x66c7e20f, 0xb8c0fe0f,
+0x00000609, 0x45760f66, 0xd0500fc0, 0x0f0ffa83,
+0x0000b585, 0x4d280f00, 0x700f66f0, 0xb81be045,
+0x0000064e, 0xc1760f66, 0x83d0500f, 0x850f0ffa,
+0x00000096, 0x66c1280f, 0xe045620f, 0x4d6a0f66,
+0xfa0f66e0, 0x06a8b8c1, 0x280f0000, 0x730f66c8,
+0x0f6620d0, 0x0f66caf4, 0x0f66c3f4, 0x6608c970,
+0x08c0700f, 0xc8620f66, 0xd04d290f, 0x0d760f66,
+0x0000006c, 0x83d1500f, 0x4e750ffa, 0xe045280f,
+0x0ff4458b, 0x8d48c957, 0x0f66d07d, 0x00bad166,
+0x0f000000, 0x89c04529, 0x458bc445, 0xcc4589fc,
+0xc2f70f66, 0xc0760f66, 0xf06d280f, 0x66c2570f,
+0x0fe8f70f, 0x66d04528, 0xc045760f, 0x83c0500f,
+0x2ab80ff8, 0x0f000007, 0xc35dc244, 0x00000000,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0x00000002, 0x00000002, 0x00000002, 0x00000002,
+0x00000001, 0xffffffff, 0x00000001, 0xffffffff,
+0001560,
+};
+asm(".type sse2_x86_64_D_16i4, STT_NOTYPE;");
+asm(".type sse2_x86_64_D_16i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_64_D_16u4[] = {
+0x315500eb, 0x0004bfc0, 0x89480000, 0x89c289e5,
+0x01488dfe, 0x2901e283, 0x854c89c6, 0x89caffd0,
+0x89e08574, 0x48f08554, 0x8348c0ff, 0xdd7504f8,
+0xd06d280f, 0xa06d290f, 0xa04d280f, 0x000539b8,
+0xc1280f00, 0xc5760f66, 0x83d0500f, 0x850f0ffa,
+0x0000027e, 0xd045280f, 0xc1fe0f66, 0xb045290f,
+0xd045280f, 0x00053fb8, 0x720f6600, 0x0f6601f0,
+0x0fb04576, 0xfa83d050, 0x53850f0f, 0x0f000002,
+0x66b04528, 0xd045fa0f, 0xc045290f, 0xb8d1280f,
+0x00000544, 0x55760f66, 0xd2500fc0, 0x0f0ffa83,
+0x00022d85, 0x4d560f00, 0x4d290fe0, 0x45540fa0,
+0x4d280fe0, 0x4d570fc0, 0x45550fe0, 0x760f66a0,
+0x0550b8d2, 0x0f660000, 0x500fc176, 0x0ffa83d0,
+0x01fc850f, 0x280f0000, 0x280fd05d, 0x280fe065,
+0x0f66d045, 0x6620d473, 0x20d3730f, 0xdcf40f66,
+0x66c8280f, 0xe04df40f, 0xc9700f66, 0x700f6608,
+0x0f6608db, 0x0f66cb62, 0x01d20d76, 0xc8b80000,
+0x0f000005, 0xfa83d150, 0xb3850f0f, 0x0f000001,
+0x0ff04d28, 0x0f66c857, 0x290fc87e, 0x0f66a04d,
+0x8be04df4, 0x0f48e055, 0x558bc2af, 0x458948e8,
+0xa8458bc0, 0xc2af0f48, 0xc8458948, 0x0005e1b8,
+0x760f6600, 0x500fc04d, 0x0ffa83d1, 0x0170850f,
+0x290f0000, 0x280fc045, 0x0f66c05d, 0x0f03f372,
+0x0fa05d29, 0x66c04d28, 0x02f1720f, 0xb04d290f,
+0xc9fe0f66, 0x0005edb8, 0x760f6600, 0xd1500fcb,
+0x0f0ffa83, 0x00013985, 0x4d280f00, 0x720f66a0,
+0x0f6602d1, 0xf2b8c9fe, 0x66000005, 0xb04d760f,
+0x83d1500f, 0x850f0ffa, 0x00000116, 0x039c45c7,
+0x66000000, 0x9c5d6e0f, 0x66c8280f, 0xc7cbf20f,
+0x00029c45, 0x0f660000, 0x669c5d6e, 0x0fc3f20f,
+0x66b04529, 0xb8c0fe0f, 0x00000605, 0xc1760f66,
+0x83d0500f, 0x850f0ffa, 0x000000d6, 0x5d6e0f66,
+0xd20f669c, 0xc1280fcb, 0xc1fe0f66, 0x000609b8,
+0x760f6600, 0x500fb045, 0x0ffa83d0, 0x00b0850f,
+0x280f0000, 0x0f66e045, 0x1bd04d70, 0x00064eb8,
+0x760f6600, 0xd1500fc8, 0x0f0ffa83, 0x00009185,
+0xd8280f00, 0x5d620f66, 0x6a0f66d0, 0x280fd045,
+0x0f66f04d, 0xa8b8c2fe, 0x66000006, 0x0fc3fa0f,
+0x570fc157, 0xfa0f66d1, 0x760f66c2, 0x00007f05,
+0xd0500f00, 0x750ffa83, 0x45280f59, 0xe4458bd0,
+0x48db570f, 0xbac07d8d, 0x00000000, 0xb045290f,
+0x89d0280f, 0x458bb445, 0x620f66ec, 0x620f66d3,
+0xbc4589d3, 0xc055290f, 0xc1f70f66, 0xc0760f66,
+0xe075280f, 0x66c1570f, 0x0ff0f70f, 0x66c04528,
+0xb045760f, 0x83c0500f, 0x2ab80ff8, 0x0f000007,
+0xc35dc244, 0x00000000, 0x00000000, 0x00000000,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0x00000002, 0x00000002, 0x00000002, 0x00000002,
+0001400,
+};
+asm(".type sse2_x86_64_D_16u4, STT_NOTYPE;");
+asm(".type sse2_x86_64_D_16u4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_64_D_16i8[] = {
+0x485500eb, 0xc748e589, 0x0001e045, 0xc7480000,
+0x0002f045, 0xc7480000, 0x0002e845, 0xc7480000,
+0x0001f845, 0x280f0000, 0x290fe07d, 0xc031b07d,
+0xb0758b48, 0xe0753b48, 0x48c0940f, 0x48b84d8b,
+0x4866d8f7, 0x31c06e0f, 0x4d3b48c0, 0xc0940fe8,
+0x66d8f748, 0xf86e0f48, 0x000539b8, 0x6c0f6600,
+0x500f66c7, 0x03fa83d0, 0x055f850f, 0x280f0000,
+0x280fb055, 0x0f66e045, 0x290fc2d4, 0x280fc045,
+0x0f66e045, 0x6601f073, 0xc07e0f48, 0xc0453948,
+0x0fe8120f, 0xb60fc094, 0xd8f748c0, 0x66c28948,
+0xe87e0f48, 0xc8453948, 0x66c0940f, 0xc26e0f48,
+0x48c0b60f, 0x4866d8f7, 0xb8f86e0f, 0x0000053f,
+0xc76c0f66, 0xd0500f66, 0x0f03fa83, 0x0004fc85,
+0x45280f00, 0xfb0f66c0, 0x290fe045, 0xc031d045,
+0xd0753b48, 0x48c0940f, 0x4866d8f7, 0x31c06e0f,
+0x4d3b48c0, 0xc0940fd8, 0x66d8f748, 0xe86e0f48,
+0x000544b8, 0x6c0f6600, 0x500f66c5, 0x03fa83d0,
+0x04b7850f, 0x280f0000, 0x280fe065, 0xc2280fca,
+0xd1730f66, 0xf40f6620, 0xf40f66cc, 0xdc280fc4,
+0xd3730f66, 0xf40f6620, 0xd40f66d3, 0x55280fca,
+0x730f66f0, 0x0f6620f1, 0x280fc1d4, 0xda280fca,
+0xd1730f66, 0xf40f6620, 0xf40f66da, 0xd40f66ca,
+0x730f66c9, 0x0f6620f1, 0x280fd9d4, 0x280fe06d,
+0xd40f66fd, 0xf5280ffa, 0x75fb0f66, 0xe7280ff0,
+0xd4730f66, 0xfb0f6620, 0xce280fc3, 0xe6f40f66,
+0x66d6280f, 0x20d1730f, 0xd7f40f66, 0x7e0f4866,
+0xf40f66c0, 0xf0120fcf, 0xccd40f66, 0xf1730f66,
+0xd40f6620, 0x0f4866ca, 0x120fca7e, 0xc23948f9,
+0x7e0f4866, 0xc0940ffa, 0x48c0b60f, 0x8948d8f7,
+0x0f4866c1, 0x3948f07e, 0x0f4866c2, 0x940fc16e,
+0xc0b60fc0, 0x66d8f748, 0xf86e0f48, 0x00055bb8,
+0x6c0f6600, 0x500f66c7, 0x03fa83d0, 0x03cb850f,
+0x280f0000, 0x280ff045, 0xcd280fe5, 0xd4730f66,
+0xd0280f20, 0xc8f40f66, 0xd2730f66, 0xf40f6620,
+0xf40f66c4, 0xd40f66d5, 0x730f66c2, 0x0f6620f0,
+0x4866c1d4, 0x0fc07e0f, 0x48b04529, 0x0f02f883,
+0xb60fc094, 0xd8f748c0, 0x6e0f4866, 0x48c031c0,
+0x02b87d83, 0x48c0940f, 0x4866d8f7, 0xb8f06e0f,
+0x000005c8, 0xc66c0f66, 0xd0500f66, 0x0f03fa83,
+0x00035885, 0x15280f00, 0x00000374, 0x0fc4280f,
+0x0f66cd28, 0x0f66c2f4, 0x280fcaf4, 0x730f66da,
+0x0f6620d3, 0x0f66ebf4, 0x0f66c5d4, 0x6620f073,
+0x0fc1d40f, 0x0fd04529, 0x66d04528, 0x03f0730f,
+0x7e0f4866, 0x45290fc2, 0x45280fb0, 0x730f66d0,
+0x290f02f0, 0x0f66c045, 0x0f66c0d4, 0x4866e2f4,
+0x0fc07e0f, 0x3948f812, 0xc0940fc2, 0x48c0b60f,
+0x8948d8f7, 0x0f4866c2, 0x3948f87e, 0x940fb845,
+0x0f4866c0, 0xb60fc26e, 0xd8f748c0, 0x6e0f4866,
+0x05edb8f0, 0x0f660000, 0x0f66c66c, 0xfa83d050,
+0xb6850f03, 0x0f000002, 0x0fb07528, 0x0f66c628,
+0x6602e672, 0x02d0730f, 0xf6700f66, 0x700f66dd,
+0x0f6688c0, 0x0f66c662, 0x4866c0d4, 0x48c07e0f,
+0x0fc04539, 0x940ff812, 0xc0b60fc0, 0x48d8f748,
+0x4866c289, 0x48f87e0f, 0x0fc84539, 0x4866c094,
+0x0fc26e0f, 0xf748c0b6, 0x0f4866d8, 0xf2b8f06e,
+0x66000005, 0x66c66c0f, 0x83d0500f, 0x850f03fa,
+0x00000249, 0xe5d40f66, 0x03ac45c7, 0x0f000000,
+0x0f66c428, 0x6620f073, 0x48c8d40f, 0x0fac4563,
+0x4866c128, 0x66e86e0f, 0xc7c5f30f, 0x0002ac45,
+0x63480000, 0x4866ac45, 0x66e86e0f, 0x0fcdf30f,
+0x66c04d29, 0x66c9d40f, 0xc07e0f48, 0x7e0f4866,
+0xe9120fca, 0x0fc23948, 0xb60fc094, 0xd8f748c0,
+0x66c28948, 0xe87e0f48, 0x66e8120f, 0xe97e0f48,
+0x6e0f4866, 0xc83948ca, 0x0fc0940f, 0xf748c0b6,
+0x0f4866d8, 0x05b8f86e, 0x66000006, 0x66cf6c0f,
+0x83d1500f, 0x850f03fa, 0x000001b1, 0xac556348,
+0xb8c8280f, 0x00000040, 0xe1720f66, 0xd029481f,
+0x6e0f4866, 0x700f66f2, 0x4866f5c9, 0x66e86e0f,
+0x66c6d30f, 0x0fcdf30f, 0x0f66c156, 0x4866c0d4,
+0x48c07e0f, 0x0fc04539, 0x940ff812, 0xc0b60fc0,
+0x48d8f748, 0x4866c289, 0x48f87e0f, 0x0fc84539,
+0x4866c094, 0x0fc26e0f, 0xf748c0b6, 0x0f4866d8,
+0x09b8f06e, 0x66000006, 0x66c66c0f, 0x83d0500f,
+0x850f03fa, 0x00000135, 0x4d700f66, 0x48664ee0,
+0x48c87e0f, 0x0ff04539, 0x940fe912, 0xc0b60fc0,
+0x66d8f748, 0xc06e0f48, 0x7e0f4866, 0x453948e8,
+0xc0940ff8, 0x48c0b60f, 0x4866d8f7, 0xb8f86e0f,
+0x0000064e, 0xc76c0f66, 0xd0500f66, 0x0f03fa83,
+0x0000e885, 0x45280f00, 0xe0280ff0, 0x656c0f66,
+0x6d0f66e0, 0x0f66e045, 0x280fe0fb, 0xf40f66cc,
+0xc4280fdc, 0xd1730f66, 0xf40f6620, 0xf40f66c2,
+0xd40f66ca, 0x730f66cb, 0x0f6620f1, 0x4866c1d4,
+0x0fc07e0f, 0x290fd812, 0xff48d045, 0xc0940fc8,
+0x48c0b60f, 0x8948d8f7, 0x0f4866c2, 0xff48d87e,
+0x0f4866c8, 0x940fc26e, 0xc0b60fc0, 0x66d8f748,
+0xd86e0f48, 0x0006a8b8, 0x6c0f6600, 0x500f66c3,
+0x03fa83d0, 0x280f6775, 0x280fe045, 0x00005f0d,
+0x7d8d4800, 0x0000bad0, 0x0f660000, 0x4866c1f7,
+0x0fc07e0f, 0x0ff05d28, 0x00520528, 0x0f660000,
+0x3948d8f7, 0x940fd045, 0xc0b60fc0, 0x66d8f748,
+0xc06e0f48, 0xf8458b48, 0xd8453948, 0x0fc0940f,
+0xf748c0b6, 0x0f4866d8, 0x0f66f06e, 0x0f66c66c,
+0xf883c050, 0x072ab803, 0x440f0000, 0x00c35dc2,
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0xffffffff, 0xffffffff,
+0x00000001, 0x00000000, 0xffffffff, 0xffffffff,
+0003000,
+};
+asm(".type sse2_x86_64_D_16i8, STT_NOTYPE;");
+asm(".type sse2_x86_64_D_16i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_64_D_16u8[] = {
+0x485500eb, 0xc748e589, 0x0001e045, 0xc7480000,
+0x0002f045, 0xc7480000, 0x0002e845, 0xc7480000,
+0x0001f845, 0x280f0000, 0x290fe075, 0x8b48b075,
+0x3948b045, 0x940fe045, 0xc0b60fc0, 0x66d8f748,
+0xc06e0f48, 0xb8458b48, 0xe8453948, 0x0fc0940f,
+0xf748c0b6, 0x0f4866d8, 0x39b8f86e, 0x66000005,
+0x66c76c0f, 0x83d0500f, 0x850f03fa, 0x0000045b,
+0xb055280f, 0xe045280f, 0xc2d40f66, 0xc045290f,
+0xe045280f, 0xf0730f66, 0x0f486601, 0x3948c07e,
+0x120fc045, 0xc0940ff0, 0x48c0b60f, 0x8948d8f7,
+0x0f4866c2, 0x3948f07e, 0x940fc845, 0x0f4866c0,
+0xb60fc26e, 0xd8f748c0, 0x6e0f4866, 0x053fb8f8,
+0x0f660000, 0x0f66c76c, 0xfa83d050, 0xf8850f03,
+0x0f000003, 0x66c04528, 0xe045fb0f, 0xd045290f,
+0xd0458b48, 0xb0453948, 0x0fc0940f, 0xf748c0b6,
+0x0f4866d8, 0x8b48c86e, 0x3948d845, 0x940fb845,
+0xc0b60fc0, 0x66d8f748, 0xe86e0f48, 0x000544b8,
+0x6c0f6600, 0x500f66cd, 0x03fa83d1, 0x03a9850f,
+0x560f0000, 0x290ff055, 0x540fb055, 0x280ff045,
+0x570fd04d, 0x4866f04d, 0x0fca7e0f, 0x0fd04d29,
+0x66b04555, 0x66d2760f, 0xc07e0f48, 0x48f0120f,
+0x940fc239, 0xc0b60fc0, 0x48d8f748, 0x4866c289,
+0x48f07e0f, 0x0fd84539, 0x4866c094, 0x0fc26e0f,
+0xf748c0b6, 0x0f4866d8, 0x50b8f86e, 0x66000005,
+0x66c76c0f, 0x83d0500f, 0x850f03fa, 0x0000033b,
+0xe045280f, 0xf06d280f, 0x0fc8280f, 0x280fe528,
+0x730f66d8, 0x0f6620d1, 0x6620d473, 0x66cdf40f,
+0x66e0f40f, 0x66ddf40f, 0x66ccd40f, 0x20f1730f,
+0xcbd40f66, 0x7e0f4866, 0x4d290fc8, 0xf88348b0,
+0xc0940f02, 0x48c0b60f, 0x4866d8f7, 0x31c86e0f,
+0x7d8348c0, 0x940f02b8, 0xd8f748c0, 0x6e0f4866,
+0x05c8b8e8, 0x0f660000, 0x0f66cd6c, 0xfa83d150,
+0xc4850f03, 0x0f000002, 0x0fd04529, 0x66d04d28,
+0x03f1730f, 0x7e0f4866, 0x4d290fca, 0x4d280fb0,
+0x730f66d0, 0x290f02f1, 0x0f66c04d, 0x4866c9d4,
+0x0fc87e0f, 0x3948f112, 0xc0940fc2, 0x48c0b60f,
+0x8948d8f7, 0x0f4866c2, 0x3948f07e, 0x940fb845,
+0x0f4866c0, 0xb60fca6e, 0xd8f748c0, 0x6e0f4866,
+0x05edb8f8, 0x0f660000, 0x0f66cf6c, 0xfa83d150,
+0x54850f03, 0x0f000002, 0x66b04d28, 0x02d1730f,
+0xc9d40f66, 0x7e0f4866, 0x453948c8, 0xe1120fc0,
+0x0fc0940f, 0xf748c0b6, 0xc28948d8, 0x7e0f4866,
+0x453948e0, 0xc0940fc8, 0x6e0f4866, 0xc0b60fca,
+0x66d8f748, 0xe86e0f48, 0x0005f2b8, 0x6c0f6600,
+0x500f66cd, 0x03fa83d1, 0x01fd850f, 0x45c70000,
+0x000003ac, 0x6e0f6600, 0x280fac5d, 0xf30f66c8,
+0xac45c7cb, 0x00000002, 0x5d6e0f66, 0xf30f66ac,
+0x45290fc3, 0xd40f66c0, 0x0f4866c0, 0x120fc87e,
+0x0f4866f9, 0x120fc27e, 0x0f4866f0, 0x3948f97e,
+0xc0940fc2, 0x48c0b60f, 0x8948d8f7, 0x0f4866c2,
+0x3948f07e, 0x0f4866c8, 0x940fc26e, 0xc0b60fc0,
+0x66d8f748, 0xe06e0f48, 0x000605b8, 0x6c0f6600,
+0x500f66c4, 0x03fa83d0, 0x017d850f, 0x0f660000,
+0x66ac456e, 0x66c8d30f, 0x66c9d40f, 0xc87e0f48,
+0xc0453948, 0x0fe9120f, 0xb60fc094, 0xd8f748c0,
+0x6e0f4866, 0x0f4866c0, 0x3948e87e, 0x940fc845,
+0xc0b60fc0, 0x66d8f748, 0xf06e0f48, 0x000609b8,
+0x6c0f6600, 0x500f66c6, 0x03fa83d0, 0x0129850f,
+0x0f660000, 0x4ee04d70, 0x7e0f4866, 0x453948c8,
+0xf9120ff0, 0x0fc0940f, 0xf748c0b6, 0x0f4866d8,
+0x4866c06e, 0x48f87e0f, 0x0ff84539, 0xb60fc094,
+0xd8f748c0, 0x6e0f4866, 0x064eb8e0, 0x0f660000,
+0x0f66c46c, 0xfa83d050, 0xdc850f03, 0x48000000,
+0x66ffc883, 0xc86e0f48, 0xf045280f, 0x66d8280f,
+0xe05d6c0f, 0x456d0f66, 0xd40f66e0, 0xd1570fc2,
+0xc3fb0f66, 0x66c1570f, 0x66c2fb0f, 0xc07e0f48,
+0x48e8120f, 0x940fc8ff, 0xc0b60fc0, 0x48d8f748,
+0x4866c289, 0x48e87e0f, 0x4866c8ff, 0x0fc26e0f,
+0xb60fc094, 0xd8f748c0, 0x6e0f4866, 0x06a8b8f0,
+0x0f660000, 0x0f66c66c, 0xfa83d050, 0x0f6c7503,
+0x48e04528, 0xbad07d8d, 0x00000000, 0xd07e0ff3,
+0x7e0f4866, 0x7e0ff3c0, 0x55290fd2, 0xf70f66d0,
+0x760f66c1, 0x7d280fc0, 0xc1570ff0, 0xf8f70f66,
+0xd0453948, 0x0fc0940f, 0xf748c0b6, 0x0f4866d8,
+0x8b48c06e, 0x3948f845, 0x940fd845, 0xc0b60fc0,
+0x66d8f748, 0xe06e0f48, 0xc46c0f66, 0xc0500f66,
+0xb803f883, 0x0000072a, 0x5dc2440f, 0x000000c3,
+0002315,
+};
+asm(".type sse2_x86_64_D_16u8, STT_NOTYPE;");
+asm(".type sse2_x86_64_D_16u8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_64_D_16f4[] = {
+0xb84800eb, 0x3f800000, 0x40000000, 0xe5894855,
+0xd0458948, 0x0000b848, 0x00004040, 0x89484080,
+0xb848d845, 0x40800000, 0x40400000, 0xe0458948,
+0x000001b8, 0xe0c148fe, 0x4589481e, 0x00b848e8,
+0x003f8000, 0x48bf8000, 0x48f04589, 0x0ff84589,
+0x0fd06d28, 0x0fa06d29, 0xb8a04528, 0x00000539,
+0x0fc8280f, 0x0f00cdc2, 0xfa83d150, 0x95850f0f,
+0x0f000002, 0x0fd04d28, 0x290fc858, 0x280fb04d,
+0x3fb8d04d, 0x0f000005, 0xc20fc958, 0x0f00b04d,
+0xfa83d150, 0x6d850f0f, 0x0f000002, 0x0fb04d28,
+0x0fd04d5c, 0x0fc04d29, 0x44b8c828, 0x0f000005,
+0x00c04dc2, 0x83d1500f, 0x850f0ffa, 0x00000248,
+0xe04d280f, 0xd045590f, 0x0fd1280f, 0x280fd159,
+0x280fd04d, 0x580fe065, 0xd9280fe1, 0xe05d5c0f,
+0xb8c25c0f, 0x0000055b, 0x0fdc590f, 0x0f00c3c2,
+0xfa83d050, 0x0d850f0f, 0x0f000002, 0x0ff04528,
+0x290fc159, 0x5e0fa045, 0xc20ff04d, 0x64b800c1,
+0x0f000005, 0xfa83d050, 0xe9850f0f, 0x0f000001,
+0xf3f05528, 0xe10d100f, 0xb8000001, 0x00000567,
+0x0fc2280f, 0x0f00c9c6, 0x570fc157, 0x590fd04d,
+0xc20fa045, 0x500f00c1, 0x0ffa83d0, 0x01b6850f,
+0x0f660000, 0x0fd0455b, 0xc20fc05b, 0xb800d045,
+0x0000056e, 0x83d0500f, 0x850f0ffa, 0x00000198,
+0xd045530f, 0xa045290f, 0xa045530f, 0xd04d280f,
+0x000575b8, 0x5b0f6600, 0xc05b0fc0, 0x00c1c20f,
+0x83d0500f, 0x850f0ffa, 0x0000016c, 0x0fc1280f,
+0x290fc159, 0x520fa045, 0x290fa045, 0x280fb045,
+0x7cb8b045, 0x0f000005, 0x0f66d853, 0x5b0fdb5b,
+0xcbc20fdb, 0xd1500f00, 0x0f0ffa83, 0x00013785,
+0x5b0f6600, 0x45280fc8, 0xc95b0fd0, 0x00057eb8,
+0xd8530f00, 0xdb5b0f66, 0x0fdb5b0f, 0x0f00cbc2,
+0xfa83d150, 0x0d850f0f, 0x0f000001, 0x590fc828,
+0x4d290fc8, 0x4d510fa0, 0x059cb8a0, 0xc20f0000,
+0x500f00c8, 0x0ffa83d1, 0x00ea850f, 0x280f0000,
+0x280fe04d, 0xda590fd8, 0x0fca590f, 0x0fb04d29,
+0x5f0fcb28, 0x5d0fb04d, 0x290fb05d, 0x580fb05d,
+0x580fb04d, 0x3db8e045, 0x0f000006, 0xc20fca59,
+0x500f00c1, 0x0ffa83d0, 0x00aa850f, 0x280f0000,
+0x4eb8d045, 0x0f000006, 0x0f1bc0c6, 0x00e045c2,
+0x83d0500f, 0x850f0ffa, 0x0000008c, 0xe04d280f,
+0x0fc1280f, 0x0fd04514, 0x0fd04d15, 0x0ff3c15c,
+0x007a0d10, 0xa8b80000, 0x0f000006, 0x0f00c9c6,
+0x290fc259, 0xc20fc045, 0x500f00c1, 0x0ffa83d0,
+0x280f5675, 0x0ff3d04d, 0x48e44510, 0xbac07d8d,
+0x00000000, 0xb04d290f, 0x45110ff3, 0x100ff3b4,
+0x0ff3ec45, 0x0fbc4511, 0xc20fc057, 0x0f6601c2,
+0x0f66c8f7, 0x280fc976, 0x570fe075, 0xf70f66c1,
+0x45280ff0, 0x45c20fc0, 0x500f00b0, 0x0ff883c0,
+0x00072ab8, 0xc2440f00, 0x0000c35d, 0x80000000,
+0x40000000,
+0001424,
+};
+asm(".type sse2_x86_64_D_16f4, STT_NOTYPE;");
+asm(".type sse2_x86_64_D_16f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_64_D_16f8[] = {
+0x485500eb, 0x0ff2e589, 0x034a0510, 0x0ff20000,
+0x034a0d10, 0x8b480000, 0x00034b05, 0x110ff200,
+0x8948d045, 0x0ff2f845, 0xf2e04d11, 0xf045110f,
+0x4d110ff2, 0x110ff2d8, 0x280fe845, 0x290fd06d,
+0x280fa06d, 0x39b8a045, 0x0f000005, 0x0f66c828,
+0x6600cdc2, 0x83d1500f, 0x850f03fa, 0x000002ef,
+0xd04d280f, 0xc8580f66, 0xb04d290f, 0xd04d280f,
+0x00053fb8, 0x580f6600, 0xc20f66c9, 0x6600b04d,
+0x83d1500f, 0x850f03fa, 0x000002c3, 0xb04d280f,
+0x4d5c0f66, 0x4d290fd0, 0xc8280fc0, 0x000544b8,
+0xc20f6600, 0x6600c04d, 0x83d1500f, 0x850f03fa,
+0x0000029b, 0xe04d280f, 0x45590f66, 0xd1280fd0,
+0xd1590f66, 0xd04d280f, 0xe065280f, 0xe1580f66,
+0x66d9280f, 0xe05d5c0f, 0xc25c0f66, 0x00055bb8,
+0x590f6600, 0xc20f66dc, 0x0f6600c3, 0xfa83d050,
+0x58850f03, 0x0f000002, 0x66f04528, 0x0fc1590f,
+0x66a04529, 0xf04d5e0f, 0xc1c20f66, 0x0564b800,
+0x0f660000, 0xfa83d050, 0x30850f03, 0xf2000002,
+0x4915100f, 0x0f000002, 0xb8f04d28, 0x00000567,
+0xd2140f66, 0x0fc1280f, 0x570fc257, 0x0f66d055,
+0x66a04559, 0x00c2c20f, 0xd0500f66, 0x0f03fa83,
+0x0001fa85, 0xe60ff200, 0x0ff3d045, 0x0f66c0e6,
+0x00d045c2, 0x00056eb8, 0x500f6600, 0x03fa83d0,
+0x01d9850f, 0x0f660000, 0x0fd0455a, 0x5a0fc053,
+0x45290fc0, 0x5a0f66a0, 0x530fa045, 0x5d280fc0,
+0x0575b8d0, 0x5a0f0000, 0xe60ff2c0, 0xe60ff3c0,
+0xc20f66c0, 0x0f6600c3, 0xfa83d050, 0x9c850f03,
+0x0f000001, 0x0f66c328, 0x290fc359, 0x0f66a045,
+0x0fa0455a, 0x5a0fc052, 0x45290fc0, 0x55280fb0,
+0x057cb8b0, 0x0f660000, 0x530fc25a, 0xc05a0fc0,
+0xc0e60ff2, 0xc0e60ff3, 0xd8c20f66, 0x500f6600,
+0x03fa83d3, 0x0155850f, 0x280f0000, 0x0ff2d065,
+0x0ff3d2e6, 0x7eb8d2e6, 0x66000005, 0x0fc45a0f,
+0x5a0fc053, 0xe60ff2c0, 0xe60ff3c0, 0xc20f66c0,
+0x0f6600d0, 0xfa83d250, 0x20850f03, 0x0f000001,
+0x0f66c428, 0x290fc459, 0x0f66a045, 0x66a05551,
+0x00d4c20f, 0x00059cb8, 0x500f6600, 0x03fa83d2,
+0x00f9850f, 0x280f0000, 0x280fe045, 0x590f66dc,
+0x590f66d9, 0x45290fc1, 0xd3280fb0, 0x555f0f66,
+0x5d0f66b0, 0x290fb05d, 0x0f66b05d, 0x66b05558,
+0xe065580f, 0x00063db8, 0x590f6600, 0xc4280fd1,
+0xc2c20f66, 0x500f6600, 0x03fa83d0, 0x00ad850f,
+0x280f0000, 0x4eb8d045, 0x66000006, 0x01c0c60f,
+0x45c20f66, 0x0f6600e0, 0xfa83d050, 0x8c850f03,
+0x0f000000, 0x66e04528, 0xd045160f, 0xd055280f,
+0x55120f66, 0x5c0f66e8, 0x100ff2c2, 0x00007715,
+0x06a8b800, 0x0f660000, 0x0f66d214, 0x290fc159,
+0x0f66c045, 0x6600c2c2, 0x83d0500f, 0x4f7503fa,
+0x45100ff2, 0x55280fe8, 0x7d8d48d0, 0x0000bac0,
+0x290f0000, 0x0ff2b055, 0x0fb84511, 0x0f66c057,
+0x6601c1c2, 0x66c9760f, 0x0fd0f70f, 0x0fe07528,
+0x0f66c157, 0x280ff0f7, 0x0f66c045, 0x00b045c2,
+0xc0500f66, 0xb803f883, 0x0000072a, 0x5dc2440f,
+0x000000c3, 0x00000000, 0x00000000, 0x3ff00000,
+0x00000000, 0x40000000, 0x00000000, 0xbff00000,
+0x00000000, 0x80000000,
+0001570,
+};
+asm(".type sse2_x86_64_D_16f8, STT_NOTYPE;");
+asm(".type sse2_x86_64_D_16f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_64_D_f4[] = {
+0x485523eb, 0x7d89e589, 0x458d48fc, 0xea8948fc,
+0x75ff3880, 0xc0ff480c, 0x75d03948, 0xeb01b0f3,
+0x5dc03102, 0x894855c3, 0xec8148e5, 0x000000e0,
+0x05100ff3, 0x00000488, 0x85110ff3, 0xffffff40,
+0x85110ff3, 0xffffff44, 0x85110ff3, 0xffffff48,
+0xff40858b, 0x8589ffff, 0xffffff34, 0x0ff3ff31,
+0xff408510, 0x00b9ffff, 0x0f000000, 0xff34852e,
+0x0f40ffff, 0x450fc79b, 0xe8dff7f9, 0xffffff82,
+0x39b8c289, 0x84000005, 0x26840fd2, 0xf3000004,
+0x3485100f, 0xf3ffffff, 0x4085580f, 0xf3ffffff,
+0x3885110f, 0xf3ffffff, 0x4085100f, 0x31ffffff,
+0x580ff3ff, 0x852e0fc0, 0xffffff38, 0xc79b0f40,
+0xf7f9450f, 0xff38e8df, 0xc289ffff, 0x00053fb8,
+0x0fd28400, 0x0003dc84, 0x100ff300, 0xffff3885,
+0x5c0ff3ff, 0xffff4085, 0x110ff3ff, 0xffff2085,
+0x20858bff, 0x89ffffff, 0xffff7085, 0x388589ff,
+0x89ffffff, 0xffff3c85, 0xf3ff31ff, 0x3485100f,
+0x0fffffff, 0xff3c852e, 0x0f40ffff, 0x450fc79b,
+0xe8dff7f9, 0xfffffeda, 0x44b8c289, 0x84000005,
+0x7e840fd2, 0xf3000003, 0x3485100f, 0xf3ffffff,
+0x4085590f, 0xf3ffffff, 0x3485110f, 0xf3ffffff,
+0x4485100f, 0xf3ffffff, 0xf3c0590f, 0x3885110f,
+0xf3ffffff, 0x4085100f, 0xf3ffffff, 0x4485580f,
+0xf3ffffff, 0x3c85110f, 0xf3ffffff, 0x4085100f,
+0xf3ffffff, 0x3495100f, 0x31ffffff, 0x5c0ff3ff,
+0xffff3895, 0xc8280fff, 0x8d5c0ff3, 0xffffff44,
+0x8d590ff3, 0xffffff3c, 0xf3d12e0f, 0x3c8d110f,
+0x40ffffff, 0x0fc79b0f, 0xdff7f945, 0xfffe41e8,
+0xb8c289ff, 0x0000055b, 0x840fd284, 0x000002e5,
+0x85590ff3, 0xffffff48, 0x85110ff3, 0xffffff34,
+0x0ff3ff31, 0xff408510, 0x0ff3ffff, 0xff48855e,
+0x2e0fffff, 0xffff3485, 0x110ff3ff, 0xffff3885,
+0x9b0f40ff, 0xf9450fc7, 0xf3e8dff7, 0x89fffffd,
+0x0564b8c2, 0xd2840000, 0x0297840f, 0x0ff30000,
+0xff488510, 0x0ff3ffff, 0x02a21510, 0x0ff30000,
+0xff408d10, 0xff31ffff, 0x0fc2570f, 0x0ff3ca57,
+0xff348559, 0x2e0fffff, 0x9b0f40c1, 0xf9450fc7,
+0xabe8dff7, 0x89fffffd, 0x0567b8c2, 0xd2840000,
+0x024f840f, 0x0ff30000, 0xff40852c, 0x4589ffff,
+0x2a0ff3f8, 0x0ff3f845, 0xff348511, 0xff31ffff,
+0x85100ff3, 0xffffff34, 0x40852e0f, 0x40ffffff,
+0x0fc79b0f, 0xdff7f945, 0xfffd65e8, 0xb8c289ff,
+0x0000056e, 0x840fd284, 0x00000209, 0x85530ff3,
+0xffffff40, 0x85110ff3, 0xffffff34, 0x85530ff3,
+0xffffff34, 0xc02c0ff3, 0xf3f84589, 0xf84d2a0f,
+0x85100ff3, 0xffffff40, 0x2e0fff31, 0x9b0f40c8,
+0xf9450fc7, 0x17e8dff7, 0x89fffffd, 0x0575b8c2,
+0xd2840000, 0x01bb840f, 0x0ff30000, 0x0ff3c059,
+0xff348511, 0x0ff3ffff, 0xff348552, 0x0ff3ffff,
+0xff388511, 0x0ff3ffff, 0xff388553, 0x0ff3ffff,
+0x4589c02c, 0xf3ff31f8, 0xf8452a0f, 0x40852e0f,
+0x40ffffff, 0x0fc79b0f, 0xdff7f945, 0xfffcc1e8,
+0xb8c289ff, 0x0000057c, 0x840fd284, 0x00000165,
+0x852c0ff3, 0xffffff38, 0xf3f84589, 0x4085530f,
+0xf3ffffff, 0xf3c02c0f, 0xf84d2a0f, 0xf3f84589,
+0xf8452a0f, 0x2e0fff31, 0x9b0f40c8, 0xf9450fc7,
+0x7be8dff7, 0x89fffffc, 0x057eb8c2, 0xd2840000,
+0x011f840f, 0x48f30000, 0x40852c0f, 0x48ffffff,
+0xf3f84589, 0x452a0f48, 0x110ff3f8, 0xffff3485,
+0xf3ff31ff, 0x4085100f, 0x0fffffff, 0xff34852e,
+0x0f40ffff, 0x450fc79b, 0xe8dff7f9, 0xfffffc32,
+0x88b8c289, 0x84000005, 0xd6840fd2, 0xf3000000,
+0xf3c0590f, 0x3485110f, 0xf3ffffff, 0x408d100f,
+0x31ffffff, 0x510ff3ff, 0xffff3485, 0xc12e0fff,
+0xc79b0f40, 0xf7f9450f, 0xfbf4e8df, 0xc289ffff,
+0x00059cb8, 0x0fd28400, 0x00009884, 0x100ff300,
+0xffff4885, 0x590ff3ff, 0x590ff3c8, 0xffff4485,
+0x110ff3ff, 0xffff348d, 0x110ff3ff, 0xffff3885,
+0x100ff3ff, 0xffff3485, 0x5f0ff3ff, 0xffff3885,
+0x110ff3ff, 0xffff3c85, 0x100ff3ff, 0xffff3485,
+0x5d0ff3ff, 0xffff3885, 0x110ff3ff, 0xffff3885,
+0x100ff3ff, 0xffff3885, 0x580ff3ff, 0xffff3c85,
+0xf3ff31ff, 0x4885590f, 0xf3ffffff, 0x408d100f,
+0xf3ffffff, 0x448d580f, 0x0fffffff, 0x0f40c12e,
+0x450fc79b, 0xe8dff7f9, 0xfffffb56, 0xc019013c,
+0x00063d25, 0x00c3c900, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0002340,
+};
+asm(".type sse2_x86_64_D_f4, STT_NOTYPE;");
+asm(".type sse2_x86_64_D_f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse2_x86_64_D_f8[] = {
+0x485500eb, 0x8148e589, 0x000128ec, 0x100ff200,
+0x00056b05, 0x110ff200, 0xfffe8885, 0x110ff2ff,
+0xfffe9085, 0x110ff2ff, 0xfffe9885, 0x858b48ff,
+0xfffffe88, 0x70858948, 0x31fffffe, 0x100ff2c0,
+0xfffe8885, 0x0000baff, 0x0f660000, 0xfe70852e,
+0x9b0fffff, 0x450f48c0, 0xd8f748c2, 0x6e0f4866,
+0x0539b8d8, 0x0f660000, 0xb60fcbd7, 0xfff981c9,
+0x0f000000, 0x0004f685, 0x100ff200, 0xfffe7085,
+0x580ff2ff, 0xfffe8885, 0x110ff2ff, 0xfffe7885,
+0x100ff2ff, 0xfffe8885, 0xf2c031ff, 0x66c0580f,
+0x78852e0f, 0x0ffffffe, 0x0f48c09b, 0xf748c245,
+0x0f4866d8, 0x3fb8e06e, 0x66000005, 0x0fccd70f,
+0xf981c9b6, 0x000000ff, 0x04a1850f, 0x0ff20000,
+0xfe788510, 0x0ff2ffff, 0xfe88855c, 0x0ff2ffff,
+0xfe608511, 0x8b48ffff, 0xfffe6085, 0x858948ff,
+0xfffffef0, 0x78858948, 0x48fffffe, 0xfe808589,
+0xc031ffff, 0x85100ff2, 0xfffffe70, 0x852e0f66,
+0xfffffe80, 0x48c09b0f, 0x48c2450f, 0x4866d8f7,
+0xb8e86e0f, 0x00000544, 0xcdd70f66, 0x81c9b60f,
+0x0000fff9, 0x34850f00, 0xf2000004, 0x7085100f,
+0xf2fffffe, 0x8885590f, 0xf2fffffe, 0x7085110f,
+0xf2fffffe, 0x9085100f, 0xf2fffffe, 0xf2c0590f,
+0x7885110f, 0xf2fffffe, 0x8885100f, 0xf2fffffe,
+0x9085580f, 0xf2fffffe, 0x8085110f, 0xf2fffffe,
+0x8885100f, 0xf2fffffe, 0x7095100f, 0x31fffffe,
+0x5c0ff2c0, 0xfffe7895, 0xc8280fff, 0x8d5c0ff2,
+0xfffffe90, 0x8d590ff2, 0xfffffe80, 0xd12e0f66,
+0x8d110ff2, 0xfffffe80, 0x48c09b0f, 0x48c2450f,
+0x4866d8f7, 0xb8f06e0f, 0x0000055b, 0xced70f66,
+0x81c9b60f, 0x0000fff9, 0x90850f00, 0xf2000003,
+0x9885590f, 0xf2fffffe, 0x7085110f, 0x31fffffe,
+0x100ff2c0, 0xfffe8885, 0x5e0ff2ff, 0xfffe9885,
+0x2e0f66ff, 0xfffe7085, 0x110ff2ff, 0xfffe7885,
+0xc09b0fff, 0xc2450f48, 0x66d8f748, 0xf86e0f48,
+0x000564b8, 0xd70f6600, 0xc9b60fcf, 0x00fff981,
+0x850f0000, 0x00000337, 0x157e0ff3, 0x00000350,
+0x85100ff2, 0xfffffe98, 0x0ff2c031, 0xfe888d10,
+0x570fffff, 0x590ff2c2, 0xfffe7085, 0xca570fff,
+0xc12e0f66, 0x48c09b0f, 0x48c2450f, 0x4866d8f7,
+0xb8d86e0f, 0x00000567, 0xcbd70f66, 0x81c9b60f,
+0x0000fff9, 0xe4850f00, 0xf2000002, 0x88852c0f,
+0x89fffffe, 0xfffea085, 0x2a0ff2ff, 0xfffea085,
+0x110ff2ff, 0xfffe7085, 0xf2c031ff, 0x7085100f,
+0x66fffffe, 0x88852e0f, 0x0ffffffe, 0x0f48c09b,
+0xf748c245, 0x0f4866d8, 0x6eb8e06e, 0x66000005,
+0x0fccd70f, 0xf981c9b6, 0x000000ff, 0x028d850f,
+0x0ff20000, 0xfe88855a, 0x0ff3ffff, 0x0ff3c053,
+0x0f66c05a, 0xfe708513, 0x0ff2ffff, 0xfe70855a,
+0x0ff3ffff, 0x0ff3c053, 0x0ff2c05a, 0x8589c02c,
+0xfffffea0, 0x8d2a0ff2, 0xfffffea0, 0x85100ff2,
+0xfffffe88, 0x0f66c031, 0x9b0fc82e, 0x450f48c0,
+0xd8f748c2, 0x6e0f4866, 0x0575b8e8, 0x0f660000,
+0xb60fcdd7, 0xfff981c9, 0x0f000000, 0x00021e85,
+0x590ff200, 0x110ff2c0, 0xfffe7085, 0x5a0ff2ff,
+0xfffe7085, 0x520ff3ff, 0x5a0ff3c0, 0x130f66c0,
+0xfffe7885, 0x5a0ff2ff, 0xfffe7885, 0x530ff3ff,
+0x5a0ff3c0, 0x2c0ff2c0, 0xa08589c0, 0x31fffffe,
+0x2a0ff2c0, 0xfffea085, 0x2e0f66ff, 0xfffe8885,
+0xc09b0fff, 0xc2450f48, 0x66d8f748, 0xf06e0f48,
+0x00057cb8, 0xd70f6600, 0xd2b60fd6, 0x00fffa81,
+0x850f0000, 0x000001a7, 0x852c0ff2, 0xfffffe78,
+0xfea08589, 0x0ff2ffff, 0xfe88855a, 0x0ff3ffff,
+0x0ff3c053, 0x0ff2c05a, 0x858bd02c, 0xfffffea0,
+0xfea09589, 0x853bffff, 0xfffffea0, 0x0fc0940f,
+0xf748c0b6, 0x0f4866d8, 0x7eb8f86e, 0x66000005,
+0x0fd7d70f, 0xfa81d2b6, 0x000000ff, 0x014d850f,
+0x48f20000, 0x88852c0f, 0x48fffffe, 0xfea08589,
+0x48f2ffff, 0xa0852a0f, 0xf2fffffe, 0x7085110f,
+0x31fffffe, 0x100ff2c0, 0xfffe8885, 0x0000baff,
+0x0f660000, 0xfe70852e, 0x9b0fffff, 0x450f48c0,
+0xd8f748c2, 0x6e0f4866, 0x0588b8d8, 0x0f660000,
+0xb60fcbd7, 0xfff981c9, 0x0f000000, 0x0000ee85,
+0x590ff200, 0x110ff2c0, 0xfffe7085, 0x100ff2ff,
+0xfffe888d, 0xf2c031ff, 0x7085510f, 0x66fffffe,
+0x0fc12e0f, 0x0f48c09b, 0xf748c245, 0x0f4866d8,
+0x9cb8e06e, 0x66000005, 0x0fccd70f, 0xf981c9b6,
+0x000000ff, 0x00a5850f, 0x0ff20000, 0xfe988510,
+0x0ff2ffff, 0x0ff2c859, 0xfe908559, 0x0ff2ffff,
+0xfe708d11, 0x0ff2ffff, 0xfe788511, 0x0ff2ffff,
+0xfe708510, 0x0ff2ffff, 0xfe78855f, 0x0ff2ffff,
+0xfe808511, 0x0ff2ffff, 0xfe708510, 0x0ff2ffff,
+0xfe78855d, 0x0ff2ffff, 0xfe788511, 0x0ff2ffff,
+0xfe788510, 0x0ff2ffff, 0xfe808558, 0xc031ffff,
+0x85590ff2, 0xfffffe98, 0x8d100ff2, 0xfffffe88,
+0x8d580ff2, 0xfffffe90, 0xc12e0f66, 0x48c09b0f,
+0x48c2450f, 0x4866d8f7, 0x66e86e0f, 0x0fc5d70f,
+0xff3dc0b6, 0xb8000000, 0x0000063d, 0xc9c2440f,
+0x000000c3, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x00000000,
+0002640,
+};
+asm(".type sse2_x86_64_D_f8, STT_NOTYPE;");
+asm(".type sse2_x86_64_D_f8, STT_FUNC;");
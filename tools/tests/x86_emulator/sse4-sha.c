@@ -0,0 +1 @@
+simd-sha.c
\ No newline at end of file
@@ -0,0 +1,2219 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_32_D_16i1[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x01b255c3,
+0x08b9e589, 0x56000000, 0xb353f631, 0x10ec8111,
+0x88000001, 0x88b83554, 0x88d028d8, 0x89c83544,
+0x01e083f0, 0x1901f883, 0xfe0224c0, 0x354488c8,
+0x01468dd8, 0xfe83c621, 0x00d98301, 0x4c88c2fe,
+0xf883e705, 0x89047410, 0x0fc8ebc6, 0x0fb87d28,
+0x0f887d29, 0xb8884d28, 0x00000539, 0x66c1280f,
+0x66c7740f, 0x0517380f, 0x00100780, 0x06a6830f,
+0x280f0000, 0x0f66b845, 0x290fc1fc, 0x280f9845,
+0x3fb8b845, 0x66000005, 0x66c0fc0f, 0x9845740f,
+0x17380f66, 0x10078005, 0x79830f00, 0x0f000006,
+0x66984528, 0xb845f80f, 0xa845290f, 0x000544b8,
+0x740f6600, 0x0f66a84d, 0x800d1738, 0x0f001007,
+0x00065383, 0x7d280f00, 0x45280fb8, 0xbd290fd8,
+0xffffff78, 0x66f8280f, 0x0ff8600f, 0xff789528,
+0x0f66ffff, 0x290fc068, 0xffff58bd, 0x600f66ff,
+0x0d280fd2, 0x00100740, 0x4885290f, 0x0fffffff,
+0xff788528, 0x0f66ffff, 0xff5895d5, 0x0f66ffff,
+0x0f66c068, 0xff4885d5, 0x540fffff, 0xc1540fd1,
+0x0ffa280f, 0x0f66d257, 0x280ff867, 0x290fe845,
+0xffff68bd, 0x640f66ff, 0xc7540fc2, 0xa845290f,
+0x88a8458a, 0xffff3885, 0xe84d8aff, 0x8aaa5d8a,
+0xe0d2ac55, 0x88e94d8a, 0xffff2885, 0xa9458aff,
+0x4d8ae0d2, 0x278588ea, 0x8affffff, 0xe3d2ab45,
+0x66eb4d8a, 0x0fc36e0f, 0xe0d2f828, 0x88ec4d8a,
+0xffff2685, 0xad458aff, 0x4d8ae2d2, 0x6e0f66ed,
+0x8ae0d2e2, 0x8588ee4d, 0xffffff20, 0xd2ae458a,
+0xef4d8ae0, 0xff1c8588, 0x458affff, 0x8ae0d2af,
+0x8588f04d, 0xffffff18, 0xd2b0458a, 0xf14d8ae0,
+0xff148588, 0x458affff, 0x8ae0d2b1, 0x8588f24d,
+0xffffff10, 0xd2b2458a, 0xf34d8ae0, 0xff0c8588,
+0x458affff, 0x88e0d2b3, 0xffff0885, 0xf44d8aff,
+0x203a0f66, 0xffff26bd, 0x458a01ff, 0x3a0f66b4,
+0xff20a520, 0x8b01ffff, 0xffff28b5, 0xbd290fff,
+0xffffff28, 0x4d8ae0d2, 0x048588f5, 0x8affffff,
+0x0f66b545, 0x0f66d66e, 0x2795203a, 0x01ffffff,
+0x95610f66, 0xffffff28, 0x4d8ae0d2, 0x008588f6,
+0x8affffff, 0xe0d2b645, 0x88f74d8a, 0xfffee885,
+0xb7458aff, 0xc188e0d2, 0xff1c858b, 0x0f66ffff,
+0x858bf86e, 0xffffff14, 0x203a0f66, 0xffff18bd,
+0x0f6601ff, 0x0f66e761, 0x0f66d462, 0x858bc06e,
+0xffffff0c, 0x203a0f66, 0xffff1085, 0x0f6601ff,
+0x858bf06e, 0xffffff04, 0x203a0f66, 0xffff08b5,
+0x0f6601ff, 0x280fc661, 0x6e0f66f2, 0xe8858bd8,
+0x66fffffe, 0x9d203a0f, 0xffffff00, 0x6e0f6601,
+0x3a0f66e8, 0x6601e920, 0x66dd610f, 0x66c3620f,
+0x0ff06c0f, 0xfee8b529, 0x280fffff, 0x0f66e845,
+0x075005f8, 0x290f0010, 0x4d8ae845, 0x38858ae8,
+0x8affffff, 0x558aaa5d, 0x8ae0d2ac, 0x8588e94d,
+0xffffff38, 0xd2a9458a, 0xea4d8ae0, 0xff288588,
+0x458affff, 0x8ae3d2ab, 0xe0d2eb4d, 0x88ec4d8a,
+0xffff2785, 0xad458aff, 0x4d8ae2d2, 0x6e0f66ed,
+0x8ae0d2e2, 0x8588ee4d, 0xffffff26, 0xd2ae458a,
+0xef4d8ae0, 0xff208588, 0x458affff, 0x8ae0d2af,
+0x8588f04d, 0xffffff1c, 0xd2b0458a, 0xf14d8ae0,
+0xff188588, 0x458affff, 0x8ae0d2b1, 0x8588f24d,
+0xffffff14, 0xd2b2458a, 0xf34d8ae0, 0xff108588,
+0x458affff, 0x3a0f66b3, 0xff26a520, 0x8b01ffff,
+0xffff38b5, 0x8ae0d2ff, 0x8588f44d, 0xffffff0c,
+0x66b4458a, 0x0fc66e0f, 0x0f66d028, 0x280fc36e,
+0x3a0f66f8, 0xff289520, 0x6601ffff, 0xbd203a0f,
+0xffffff27, 0xbd290f01, 0xffffff38, 0x4d8ae0d2,
+0x088588f5, 0x8affffff, 0x0f66b545, 0xff389561,
+0xe0d2ffff, 0x88f64d8a, 0xffff0485, 0xb6458aff,
+0x4d8ae0d2, 0x008588f7, 0x8affffff, 0xe0d2b745,
+0x858bc188, 0xffffff20, 0xf86e0f66, 0xff18858b,
+0x0f66ffff, 0x1cbd203a, 0x01ffffff, 0xe7610f66,
+0xd4620f66, 0xc06e0f66, 0xff10858b, 0x0f66ffff,
+0x1485203a, 0x01ffffff, 0xf06e0f66, 0xff08858b,
+0x0f66ffff, 0x0cb5203a, 0x01ffffff, 0xc6610f66,
+0xd86e0f66, 0xff00858b, 0x0f66ffff, 0x049d203a,
+0x01ffffff, 0xe86e0f66, 0x203a0f66, 0x0f6601e9,
+0x0f66dd61, 0x0f66c362, 0x0f66d06c, 0x0f66d2fc,
+0xfee89574, 0x21b8ffff, 0x66000006, 0x1517380f,
+0x00100780, 0x027e830f, 0x280f0000, 0x280fc855,
+0xda280fc2, 0xc2600f66, 0xda680f66, 0x85d50f66,
+0xffffff58, 0x9dd50f66, 0xffffff48, 0x68b5280f,
+0x0fffffff, 0x290fc154, 0x540f8875, 0x670f66d9,
+0x45290fc3, 0x45280f98, 0x380f6698, 0x280fc63c,
+0x0f66985d, 0x0fde3838, 0x66985d29, 0x9845fc0f,
+0x00063db8, 0xd8280f00, 0xd8600f66, 0xc0680f66,
+0x9dd50f66, 0xffffff58, 0x85d50f66, 0xffffff48,
+0x0fd9540f, 0x0f66c154, 0x280fd867, 0xffff7885,
+0xfc0f66ff, 0x740f66c2, 0x380f66d8, 0x07801d17,
+0x830f0010, 0x000001e0, 0x000644b8, 0x380f6600,
+0x6688451c, 0x7885740f, 0x66ffffff, 0x0517380f,
+0x00100780, 0x01be830f, 0x280f0000, 0x1007501d,
+0x0649b800, 0x280f0000, 0x0f66d845, 0x66d80838,
+0x66d8740f, 0x1d17380f, 0x00100780, 0x0196830f,
+0x280f0000, 0x064eb8e2, 0x0f660000, 0x075025f8,
+0x280f0010, 0x0f66b85d, 0x66dc0038, 0x66da740f,
+0x1d17380f, 0x00100780, 0x016a830f, 0x280f0000,
+0x600f66e2, 0x280fb865, 0x680f66da, 0x0f66b85d,
+0xa8b8e3f8, 0x0f000006, 0x280fdc28, 0x600f66f0,
+0x680f66dc, 0xe8280fe4, 0xf0600f66, 0xe8680f66,
+0xded50f66, 0xecd50f66, 0x0fd9540f, 0x0f66e954,
+0x0f66dd67, 0x07601d74, 0x0f660010, 0x801d1738,
+0x0f001007, 0x00010f83, 0x5d280f00, 0xe3280fb8,
+0x66eb280f, 0x66e3600f, 0x66e6d50f, 0x0feb680f,
+0x540ff028, 0x680f66e1, 0xd50f66f0, 0xcd540fee,
+0xe1670f66, 0x8865290f, 0x66c9570f, 0x66c8640f,
+0x0fe1600f, 0x66887528, 0xee20380f, 0xf6760f66,
+0xe5740f66, 0x0006b3b8, 0x380f6600, 0x830fe617,
+0x000000b4, 0xc9600f66, 0xe9600f66, 0x887d280f,
+0x21380f66, 0x06bbb8e7, 0x0f660000, 0x0f66ec74,
+0x0fee1738, 0x00008f83, 0x600f6600, 0x600f66c9,
+0x6d280fe1, 0x380f6688, 0x290fcd22, 0xc4b8a84d,
+0x66000006, 0x66e1740f, 0xe617380f, 0x290f6a73,
+0x01b8985d, 0x8a000000, 0x88c80554, 0x83980554,
+0xf88302c0, 0x0ff07511, 0x2ab8c957, 0x66000007,
+0x66c1640f, 0xd310380f, 0xc0760f66, 0x55740f66,
+0x380f6698, 0x3073d017, 0x31cb280f, 0x3a0f66c0,
+0x0f01cb0f, 0x07701d54, 0x0f660010, 0x07501dfc,
+0x0f660010, 0x0f66d974, 0x0fd81738, 0xf883c092,
+0x25c01901, 0x0000074a, 0x0110c481, 0x5e5b0000,
+0x0000c35d, 0x00000000, 0x00000000, 0x00000000,
+0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff,
+0x01010101, 0x01010101, 0x01010101, 0x01010101,
+0x08080808, 0x08080808, 0x08080808, 0x08080808,
+0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f,
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+0003620,
+};
+asm(".type sse4_x86_32_D_16i1, STT_NOTYPE;");
+asm(".type sse4_x86_32_D_16i1, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_32_D_16u1[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x01b055c3,
+0x08bae589, 0x56000000, 0xb353f631, 0xd0ec8111,
+0x88000000, 0x88b83544, 0x88c128d9, 0x89c8354c,
+0x01e183f1, 0x4c88c9fe, 0xf189d835, 0x83f12146,
+0xda8301f9, 0x88c0fe00, 0x83e73554, 0xd37510fe,
+0xb875280f, 0x8875290f, 0x884d280f, 0xd2760f66,
+0x000539b8, 0xc1280f00, 0xc6740f66, 0x17380f66,
+0x88830fc2, 0x0f000005, 0x66b84528, 0x0fc1fc0f,
+0x0f984529, 0xb8b84528, 0x0000053f, 0xc0fc0f66,
+0x45740f66, 0x380f6698, 0x830fc217, 0x0000055f,
+0x9845280f, 0x45f80f66, 0x45290fb8, 0xd9280fa8,
+0x000544b8, 0x740f6600, 0x0f66a85d, 0x0fda1738,
+0x00053a83, 0x4d560f00, 0x4d290fc8, 0x45540f88,
+0x4d280fc8, 0x4d570fa8, 0x45550fc8, 0x0550b888,
+0x0f660000, 0x0f66c174, 0x0fc21738, 0x00050e83,
+0xc9570f00, 0x66c1280f, 0xe845740f, 0xc1740f66,
+0xb845540f, 0xa845290f, 0x88a8458a, 0xffff7885,
+0xe84d8aff, 0xd2b25d8a, 0xe94d8ae0, 0xff688588,
+0x458affff, 0x8ae0d2a9, 0x8588ea4d, 0xffffff64,
+0xd2aa458a, 0xeb4d8ae0, 0xff608588, 0x458affff,
+0x8ae0d2ab, 0x8588ec4d, 0xffffff5c, 0xd2ac458a,
+0xed4d8ae0, 0xff588588, 0x458affff, 0x8ae0d2ad,
+0x8588ee4d, 0xffffff54, 0xd2ae458a, 0xef4d8ae0,
+0xff508588, 0x458affff, 0x8ae0d2af, 0x8588f04d,
+0xffffff4c, 0xd2b0458a, 0xf14d8ae0, 0xff488588,
+0x458affff, 0x8ae0d2b1, 0x8588f24d, 0xffffff44,
+0x4d8ae3d2, 0xb3458af3, 0xdb6e0f66, 0x8aeb280f,
+0xb58bb455, 0xffffff68, 0x4d8ae0d2, 0x438588f4,
+0x8affffff, 0x0f66b545, 0xb58bce6e, 0xffffff60,
+0x203a0f66, 0xffff43ad, 0x290f01ff, 0xffff68ad,
+0x3a0f66ff, 0xff648d20, 0xd201ffff, 0xf54d8ae2,
+0xda6e0f66, 0xfe6e0f66, 0xff58b58b, 0x0f66ffff,
+0x5cbd203a, 0x01ffffff, 0xcf610f66, 0x4d8ae0d2,
+0x3c8588f6, 0x8affffff, 0x0f66b645, 0xb58be66e,
+0xffffff50, 0x203a0f66, 0xffff54a5, 0x0f6601ff,
+0x3c9d203a, 0x01ffffff, 0x4d8ae0d2, 0x288588f7,
+0x8affffff, 0x0f66b745, 0xb58bf66e, 0xffffff48,
+0x203a0f66, 0xffff4cb5, 0x0f6601ff, 0x0f66e661,
+0x280fcc62, 0x88e0d2f9, 0x28858bc1, 0x66ffffff,
+0x66c66e0f, 0x85203a0f, 0xffffff44, 0x610f6601,
+0xffff6885, 0x6e0f66ff, 0x3a0f66e8, 0x6601e920,
+0x66dd610f, 0x66c3620f, 0x0ff86c0f, 0xff28bd29,
+0x280fffff, 0x10064005, 0xfc0f6600, 0x290fe845,
+0x4d8ae845, 0x78858ae8, 0xd2ffffff, 0xe94d8ae0,
+0xff788588, 0x458affff, 0x8ae0d2a9, 0x8588ea4d,
+0xffffff68, 0xd2aa458a, 0xeb4d8ae0, 0xff648588,
+0x458affff, 0x8ae0d2ab, 0x8588ec4d, 0xffffff60,
+0xd2ac458a, 0xed4d8ae0, 0xff5c8588, 0x458affff,
+0x8ae0d2ad, 0x8588ee4d, 0xffffff58, 0xd2ae458a,
+0xef4d8ae0, 0xff548588, 0x458affff, 0x8ae0d2af,
+0x8588f04d, 0xffffff50, 0xd2b0458a, 0xf14d8ae0,
+0xff4c8588, 0x458affff, 0x8ae0d2b1, 0x8588f24d,
+0xffffff48, 0xd2b2458a, 0x448588e0, 0x8bffffff,
+0xffff78b5, 0xf34d8aff, 0x8ab3458a, 0x0f66b45d,
+0xb58bc66e, 0xffffff64, 0x203a0f66, 0xffff6885,
+0x558a01ff, 0x8ae0d2b5, 0x8588f44d, 0xffffff43,
+0x66b6458a, 0x8bf66e0f, 0xffff5cb5, 0x3a0f66ff,
+0xff60b520, 0x6601ffff, 0xd2c6610f, 0xf54d8ae3,
+0xee6e0f66, 0xff54b58b, 0x0f66ffff, 0x58ad203a,
+0x01ffffff, 0x4d8ae2d2, 0x6e0f66f6, 0xf9280fce,
+0xff4cb58b, 0x0f66ffff, 0x50bd203a, 0x01ffffff,
+0xef610f66, 0xc5620f66, 0x4d8ae0d2, 0x3c8588f7,
+0x8affffff, 0x0f66b745, 0xb58bce6e, 0xffffff44,
+0x203a0f66, 0xffff488d, 0xe0d201ff, 0x858bc188,
+0xffffff3c, 0xde6e0f66, 0x66e3280f, 0xa5203a0f,
+0xffffff43, 0xa5290f01, 0xffffff78, 0xe36e0f66,
+0x203a0f66, 0x0f6601e2, 0x0f66d86e, 0xff788d61,
+0x0f66ffff, 0x01d9203a, 0xe3610f66, 0xcc620f66,
+0xc16c0f66, 0xc0fc0f66, 0x000621b8, 0x740f6600,
+0xffff2885, 0x380f66ff, 0x830fc217, 0x0000019f,
+0xb84d280f, 0xc845280f, 0xc1da0f66, 0xc85d280f,
+0xd9de0f66, 0x4dfc0f66, 0xfc0f66c8, 0x0634b8c3,
+0x0f660000, 0x0f66c174, 0x0fc21738, 0x00016e83,
+0x1d280f00, 0x00100610, 0x000649b8, 0x4d280f00,
+0xc3280fd8, 0x08380f66, 0x740f66c1, 0x380f66c1,
+0x830fc217, 0x00000147, 0x402d280f, 0xb8001006,
+0x0000064e, 0xc865280f, 0xb845280f, 0xecfc0f66,
+0x00380f66, 0x740f66c5, 0x380f66c4, 0x830fc217,
+0x0000011b, 0x66ec280f, 0xb86d600f, 0x66c4280f,
+0xb845680f, 0x05fc0f66, 0x00100640, 0x0006a8b8,
+0xf80f6600, 0xc1570fc5, 0x400d570f, 0x66001006,
+0x66c1f80f, 0x2005740f, 0x66001006, 0xc217380f,
+0x00d9830f, 0x0f660000, 0xb8553038, 0x30380f66,
+0x4d290fca, 0x75280fa8, 0x380f66b8, 0x0f66c630,
+0x0f66c274, 0xd3b8d276, 0x66000006, 0xc217380f,
+0x00a9830f, 0x280f0000, 0x0f66b87d, 0xb8c73138,
+0x000006da, 0xc1740f66, 0x17380f66, 0x8c830fc2,
+0x0f000000, 0x66b87528, 0xc632380f, 0x8845290f,
+0xb8e8280f, 0x000006e1, 0x30380f66, 0x740f66c9,
+0x380f66e9, 0x6773ea17, 0xb84d280f, 0x000001b8,
+0x4d290f00, 0x05548a98, 0x055488c8, 0x02c08398,
+0x7511f883, 0xc0570ff0, 0x00072ab8, 0x640f6600,
+0x0f66d845, 0x66e11038, 0x9865740f, 0x17380f66,
+0x0f2c73e2, 0xc031c128, 0x0f3a0f66, 0x540f01c1,
+0x1006300d, 0xfc0f6600, 0x740f66cb, 0x380f66c8,
+0x920fca17, 0x01f883c0, 0x4a25c019, 0x81000007,
+0x0000d0c4, 0x5d5e5b00, 0x000000c3, 0x00000000,
+0x01010101, 0x01010101, 0x01010101, 0x01010101,
+0x08080808, 0x08080808, 0x08080808, 0x08080808,
+0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f,
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+0003120,
+};
+asm(".type sse4_x86_32_D_16u1, STT_NOTYPE;");
+asm(".type sse4_x86_32_D_16u1, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_32_D_16i2[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc93155c3,
+0x5657e589, 0x0010bb53, 0xec810000, 0x000000dc,
+0xbec1b70f, 0x00000008, 0x2901788d, 0x0fc889c6,
+0xe083ffbf, 0xf6bf0f01, 0x8d01f883, 0xd2190141,
+0x4a02e283, 0x0175c885, 0x7c89664b, 0xf883a645,
+0x74896608, 0x8966b645, 0x66c64554, 0xd6455c89,
+0xc1890474, 0x280fbaeb, 0x290fa87d, 0xffff78bd,
+0x85280fff, 0xffffff78, 0xc9760f66, 0x000539b8,
+0xd0280f00, 0xd7750f66, 0x17380f66, 0x32830fd1,
+0x0f000006, 0x66a85528, 0x0fd0fd0f, 0x0f885529,
+0xb8a85528, 0x0000053f, 0xf2710f66, 0x750f6601,
+0x0f668855, 0x0fd11738, 0x00060883, 0x55280f00,
+0xf90f6688, 0x290fa855, 0x280f9855, 0x0544b8d0,
+0x0f660000, 0x66985575, 0xd117380f, 0x05e3830f,
+0x280f0000, 0x0f66b85d, 0x66a845d5, 0x0fdbd50f,
+0x0fa85528, 0x66b86d28, 0x0feafd0f, 0x0f66e228,
+0x0f66c3f9, 0xb8b865f9, 0x0000055b, 0xe5d50f66,
+0xc4750f66, 0x17380f66, 0xa6830fc1, 0x0f000005,
+0x66b84528, 0xb8c2d50f, 0x000005c8, 0x05750f66,
+0x001006d0, 0x17380f66, 0x86830fc1, 0x0f000005,
+0x0f66da28, 0x0fc85de5, 0x0fc86528, 0xcfb8c057,
+0x66000005, 0x66c4650f, 0x66c3750f, 0xc117380f,
+0x055f830f, 0x280f0000, 0xd50f66c4, 0x45290fc2,
+0x5d280f98, 0x710f6698, 0x290f03f3, 0xffff789d,
+0x45280fff, 0x710f6698, 0x290f02f0, 0x0f668845,
+0xedb8c0fd, 0x66000005, 0x66c3750f, 0xc117380f,
+0x051f830f, 0x280f0000, 0xffff7885, 0x710f66ff,
+0x0f6602e0, 0xf2b8c0fd, 0x66000005, 0x8845750f,
+0x17380f66, 0xfa830fc1, 0x0f000004, 0x85c7c228,
+0xffffff74, 0x00000003, 0xc4d50f66, 0x8bd8280f,
+0xffff7485, 0x588589ff, 0xc1ffffff, 0x85891ff8,
+0xffffff5c, 0xbd7e0ff3, 0xffffff58, 0xdff10f66,
+0xff7485c7, 0x0002ffff, 0x858b0000, 0xffffff74,
+0xff588589, 0xf8c1ffff, 0x5c85891f, 0xf3ffffff,
+0x58b57e0f, 0x66ffffff, 0x0fc6f10f, 0x66884529,
+0xb8c0fd0f, 0x00000605, 0xc3750f66, 0x17380f66,
+0x7e830fc1, 0x8b000004, 0xffff7485, 0x588589ff,
+0xc1ffffff, 0x85891ff8, 0xffffff5c, 0xbd7e0ff3,
+0xffffff58, 0xdfe10f66, 0x66c3280f, 0xb8c3fd0f,
+0x00000609, 0x45750f66, 0x380f6688, 0x830fc117,
+0x00000441, 0xd845280f, 0x0fff570f, 0x0f66da28,
+0x0f66dcd5, 0x540fc765, 0x45290fc3, 0x98458b98,
+0x4c858966, 0x0fffffff, 0x8bd84dbf, 0xffff4c85,
+0x7d8b66ff, 0xa0758b9e, 0xbf0fe0d3, 0x8589da4d,
+0xffffff38, 0x9a458b66, 0x0f66fa89, 0xff389d6e,
+0x8966ffff, 0xffff5885, 0x58858bff, 0xd3ffffff,
+0x4dbf0fe0, 0x488589dc, 0x8bffffff, 0x0f669c45,
+0xff489dc4, 0x6601ffff, 0xff548589, 0x9d8bffff,
+0xffffff54, 0xbf0fe3d3, 0x9d89de4d, 0xffffff34,
+0x0f66f389, 0xff34b56e, 0xe2d3ffff, 0xe04dbf0f,
+0xff309589, 0xe3d3ffff, 0xe24dbf0f, 0xff2c9d89,
+0x8b66ffff, 0xda89a25d, 0xbf0fe2d3, 0x9589e44d,
+0xffffff28, 0x89a4558b, 0x0fe0d3d0, 0x89e64dbf,
+0xffff2485, 0x458b66ff, 0x858966a6, 0xffffff50,
+0xff50858b, 0x0f66ffff, 0xff30b5c4, 0x6601ffff,
+0x0fde620f, 0x0f66f328, 0xff2c856e, 0x0f66ffff,
+0xff24ad6e, 0x0f66ffff, 0xff2885c4, 0xd301ffff,
+0xc40f66e0, 0x0f6601e8, 0x0f66c562, 0x290ff06c,
+0xffff38b5, 0x35280fff, 0x001006e0, 0xd845280f,
+0xc6f90f66, 0xd845290f, 0xd84dbf0f, 0xff4c858b,
+0xe0d3ffff, 0xda4dbf0f, 0xff4c8589, 0x858bffff,
+0xffffff58, 0x856e0f66, 0xffffff4c, 0xbf0fe0d3,
+0x8589dc4d, 0xffffff58, 0xff54858b, 0x0f66ffff,
+0xff5885c4, 0xd301ffff, 0x4dbf0fe0, 0x548589de,
+0x8bffffff, 0xffff5085, 0x6e0f66ff, 0xffff549d,
+0xeb280fff, 0xbf0fe7d3, 0x0f66e04d, 0x0f01efc4,
+0xff58ad29, 0x0f66ffff, 0xff588562, 0xe6d3ffff,
+0xe24dbf0f, 0xde6e0f66, 0xbf0fe3d3, 0x0f66e44d,
+0xd301dbc4, 0x4dbf0fe2, 0x6e0f66e6, 0x66e0d3ea,
+0x01e8c40f, 0xdd620f66, 0xc36c0f66, 0xc0fd0f66,
+0x000621b8, 0x750f6600, 0xffff3885, 0x380f66ff,
+0x830fc117, 0x0000024d, 0xb845280f, 0x66dc280f,
+0x0fc4d50f, 0x66884529, 0x0fdad50f, 0x66884528,
+0x66c3ee0f, 0x885dea0f, 0x885d290f, 0x45fd0f66,
+0x063db888, 0x280f0000, 0x0f66b85d, 0x0f66c4d5,
+0x0f66dafd, 0x0f66c375, 0x0fc11738, 0x00020483,
+0xd50f6600, 0xa5290fe2, 0xffffff78, 0x000644b8,
+0x380f6600, 0xff78851d, 0x0f66ffff, 0x0f66d075,
+0x0fd11738, 0x0001dc83, 0x45280f00, 0x0649b8c8,
+0x280f0000, 0x380f66d6, 0x0f66d009, 0x0f66d075,
+0x0fd11738, 0x0001bc83, 0x5d280f00, 0x700ff2b8,
+0xb81ba855, 0x0000064e, 0xd2700ff3, 0x700f661b,
+0x0f664ed2, 0x0f66d375, 0x0fd11738, 0x00019483,
+0xd3280f00, 0x55610f66, 0x690f66a8, 0x0f66a85d,
+0xa8b8d3f9, 0x66000006, 0x66d0d50f, 0xf015750f,
+0x66001006, 0xd117380f, 0x0167830f, 0x280f0000,
+0x280fa855, 0xd50f66e7, 0x650f66d0, 0xda280fe0,
+0x7895290f, 0x66ffffff, 0x0fdc610f, 0xff78ad28,
+0x0f66ffff, 0xb8d52338, 0x000006b3, 0xda750f66,
+0x17380f66, 0x2a830fd9, 0x0f000001, 0x0f66da28,
+0x0f66e461, 0x280fdc61, 0xffff78ad, 0x380f66ff,
+0xbbb8d524, 0x66000006, 0x66d3750f, 0xd117380f,
+0x00ff830f, 0x8b660000, 0x0f66ba45, 0x280fc765,
+0x290fa86d, 0x280f886d, 0x8966b87d, 0x8b668a45,
+0x0f66be45, 0xa87d1038, 0x66c7280f, 0x668e4589,
+0x66c2458b, 0x66924589, 0x66c6458b, 0xb8964589,
+0x0000072a, 0x885d280f, 0xc3750f66, 0x17380f66,
+0xae830fc1, 0x0f000000, 0xb8a85528, 0x0000073a,
+0x66c2280f, 0x450e3a0f, 0x0f66aab8, 0x0f66d875,
+0x0fd91738, 0x00008c83, 0x1d280f00, 0x00100700,
+0x00074ab8, 0xc2280f00, 0x66da540f, 0xc20f3a0f,
+0xfd0f6602, 0x750f66de, 0x380f66c3, 0x6573c117,
+0x7895290f, 0x0fffffff, 0x03b8d257, 0x0f000000,
+0x6648c228, 0x8501380f, 0xffffff78, 0x7885290f,
+0x75ffffff, 0xc50f66ea, 0xfa8307d0, 0x075eb824,
+0x31750000, 0xa845280f, 0x0f66c031, 0xb8450538,
+0x01380f66, 0x380f66c2, 0x0f66c201, 0x66c20138,
+0x66c2750f, 0xc117380f, 0x83c0920f, 0xc01901f8,
+0x00076725, 0xdcc48100, 0x5b000000, 0xc35d5f5e,
+0x000e0008, 0x00140012, 0x00120014, 0x0008000e,
+0x00010001, 0x00010001, 0x00010001, 0x00010001,
+0x00040004, 0x00040004, 0x00040004, 0x00040004,
+0x00070007, 0x00070007, 0x00070007, 0x00070007,
+0003420,
+};
+asm(".type sse4_x86_32_D_16i2, STT_NOTYPE;");
+asm(".type sse4_x86_32_D_16i2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_32_D_16u2[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x10b955c3,
+0x89000000, 0x57c031e5, 0xec815356, 0x000000bc,
+0xbbd0b70f, 0x00000008, 0xc789d329, 0x8901728d,
+0x01e283c2, 0xf8854a40, 0x0ff6b70f, 0xb70fdbb7,
+0x490175d2, 0x45748966, 0x08f883a6, 0x455c8966,
+0x548966b6, 0x8966c645, 0x75d6454c, 0x7d280fc3,
+0xbd290fa8, 0xffffff78, 0x7895280f, 0x66ffffff,
+0xb8c9760f, 0x00000539, 0x66c2280f, 0x66c7750f,
+0xc117380f, 0x0572830f, 0x280f0000, 0x0f66a845,
+0x290fc2fd, 0x280f8845, 0x3fb8a845, 0x66000005,
+0x01f0710f, 0x45750f66, 0x380f6688, 0x830fc117,
+0x00000548, 0x8845280f, 0x45f90f66, 0x45290fa8,
+0xda280f98, 0x000544b8, 0x750f6600, 0x0f66985d,
+0x0fd91738, 0x00052383, 0x55560f00, 0x95290fb8,
+0xffffff78, 0xb845540f, 0x9855280f, 0xb855570f,
+0x7885550f, 0xb8ffffff, 0x00000550, 0xe4760f66,
+0xc2750f66, 0x17380f66, 0xed830fc1, 0x0f000004,
+0x0fa84528, 0x66b85528, 0xb8d0d50f, 0x000005c8,
+0x15750f66, 0x00100610, 0x17380f66, 0xc9830fd1,
+0x0f000004, 0x0f66d828, 0x0fc85de4, 0xb8c85528,
+0x000005d1, 0x66d0540f, 0xc855fd0f, 0xd3750f66,
+0x17380f66, 0xa1830fd1, 0x0f000004, 0x0f984529,
+0x66985d28, 0x03f3710f, 0x789d290f, 0x0fffffff,
+0x66985528, 0x02f2710f, 0x8855290f, 0xd2fd0f66,
+0x0005edb8, 0x750f6600, 0x380f66d3, 0x830fd117,
+0x00000468, 0x7895280f, 0x66ffffff, 0x02d2710f,
+0xd2fd0f66, 0x0005f2b8, 0x750f6600, 0x0f668855,
+0x0fd11738, 0x00044383, 0x7485c700, 0x03ffffff,
+0x0f000000, 0x0f66d028, 0xff749d6e, 0x0f66ffff,
+0x85c7d3f1, 0xffffff74, 0x00000002, 0x66d8280f,
+0x74ad6e0f, 0x66ffffff, 0x0fddf10f, 0x66885d29,
+0xb8dbfd0f, 0x00000605, 0xda750f66, 0x17380f66,
+0xf5830fd9, 0x66000003, 0x749d6e0f, 0x66ffffff,
+0x66d3d10f, 0xb8d2fd0f, 0x00000609, 0x55750f66,
+0x380f6688, 0x830fd117, 0x000003d0, 0x0fdb570f,
+0x0f66d328, 0x66d85575, 0x0fd3750f, 0x290fd054,
+0x458b9855, 0x85896698, 0xffffff58, 0xd84db70f,
+0xff58858b, 0x5d8bffff, 0x7d8b669c, 0x0fe0d39e,
+0x89da4db7, 0xffff5485, 0x458b66ff, 0x6e0f669a,
+0xffff549d, 0x858966ff, 0xffffff64, 0xff64858b,
+0xe0d3ffff, 0xdc4db70f, 0xff508589, 0xd889ffff,
+0x9dc40f66, 0xffffff50, 0x0fe0d301, 0x89de4db7,
+0xffff4c85, 0x66f889ff, 0x4cb56e0f, 0xd3ffffff,
+0x4db70fe0, 0x488589e0, 0x8bffffff, 0x8966a045,
+0xffff6085, 0x60b58bff, 0xd3ffffff, 0x4db70fe6,
+0x44b589e2, 0x66ffffff, 0x89a2758b, 0x0fe2d3f2,
+0x89e44db7, 0xffff4095, 0xa4558bff, 0xe0d3d089,
+0xe64db70f, 0xff3c8589, 0x8b66ffff, 0x8966a645,
+0xffff5c85, 0x5c858bff, 0x66ffffff, 0x48b5c40f,
+0x01ffffff, 0x956e0f66, 0xffffff44, 0xad6e0f66,
+0xffffff3c, 0x95c40f66, 0xffffff40, 0x620f6601,
+0x66e0d3de, 0x01e8c40f, 0xd5620f66, 0xda6c0f66,
+0xd855280f, 0xd4fd0f66, 0xd855290f, 0xd84db70f,
+0xff58858b, 0xe0d3ffff, 0xda4db70f, 0xff588589,
+0x858bffff, 0xffffff64, 0x956e0f66, 0xffffff58,
+0xb70fe0d3, 0x8589dc4d, 0xffffff64, 0xff60858b,
+0x0f66ffff, 0xff6495c4, 0xd301ffff, 0x4db70fe3,
+0x6e0f66de, 0x0fe7d3fb, 0x66e04db7, 0x01ffc40f,
+0xd7620f66, 0xb70fe0d3, 0x8589e24d, 0xffffff60,
+0xff5c858b, 0x0f66ffff, 0xff60ad6e, 0xe6d3ffff,
+0xe44db70f, 0xeec40f66, 0x0fe2d301, 0x66e64db7,
+0xd3f26e0f, 0xc40f66e0, 0x0f6601f0, 0x0f66ee62,
+0x0f66d56c, 0x21b8d2fd, 0x66000006, 0x66d3750f,
+0xd117380f, 0x0202830f, 0x280f0000, 0x0f66b855,
+0x0fd03a38, 0x66b85d28, 0xd83e380f, 0x45fd0f66,
+0xfd0f66b8, 0x0634b8d3, 0x0f660000, 0x0f66c275,
+0x0fc11738, 0x0001d383, 0x15280f00, 0x00100620,
+0x000649b8, 0x5d280f00, 0xc2280fc8, 0x09380f66,
+0x750f66c3, 0x380f66c3, 0x830fc117, 0x000001ac,
+0xb845280f, 0x6d700ff2, 0x4eb81ba8, 0xf3000006,
+0x1bed700f, 0xed700f66, 0x750f664e, 0x380f66e8,
+0x830fe917, 0x00000184, 0x66e8280f, 0xa86d610f,
+0x45690f66, 0xfd0f66a8, 0x06a8b8c4, 0x0f660000,
+0x570fc5f9, 0xdc570fc3, 0xc3f90f66, 0x05750f66,
+0x00100630, 0x17380f66, 0x4d830fc1, 0x66000001,
+0x5d33380f, 0x380f66a8, 0x290fc333, 0x280f9845,
+0x0f66a875, 0xb8c63338, 0x000006d3, 0xc3750f66,
+0x17380f66, 0x21830fc1, 0x0f000001, 0x66a86528,
+0xc434380f, 0x0006dab8, 0x750f6600, 0x0f669845,
+0x0fc11738, 0x00010383, 0x458b6600, 0xc0570fba,
+0xa87d280f, 0x45640f66, 0x7d290fc8, 0x7d280f88,
+0x458966b8, 0x458b668a, 0x380f66be, 0x0fa87d10,
+0x8966c728, 0x8b668e45, 0x8966c245, 0x8b669245,
+0x8966c645, 0x2ab89645, 0x0f000007, 0x66886528,
+0x66c4750f, 0xc117380f, 0x00ae830f, 0x280f0000,
+0x3ab8a85d, 0x0f000007, 0x0f66c328, 0xb8450e3a,
+0x750f66aa, 0x380f66e0, 0x830fe117, 0x0000008c,
+0x4005280f, 0xb8001006, 0x0000074a, 0x66c3540f,
+0x0fd0fd0f, 0x0f66c328, 0x02c30f3a, 0xc2750f66,
+0x17380f66, 0x0f6573c1, 0xff789d29, 0x570fffff,
+0x0003b8d2, 0x280f0000, 0x0f6648c2, 0x78850138,
+0x0fffffff, 0xff788529, 0xea75ffff, 0xd0c50f66,
+0x24fa8307, 0x00075eb8, 0x0f317500, 0x31a84528,
+0x380f66c0, 0x66b84505, 0xc201380f, 0x01380f66,
+0x380f66c2, 0x0f66c201, 0x0f66c275, 0x0fc11738,
+0xf883c092, 0x25c01901, 0x00000767, 0x00bcc481,
+0x5e5b0000, 0x00c35d5f, 0x00000000, 0x00000000,
+0x000e0008, 0x00140012, 0x00120014, 0x0008000e,
+0x00010001, 0x00010001, 0x00010001, 0x00010001,
+0x00040004, 0x00040004, 0x00040004, 0x00040004,
+0x00070007, 0x00070007, 0x00070007, 0x00070007,
+0003120,
+};
+asm(".type sse4_x86_32_D_16u2, STT_NOTYPE;");
+asm(".type sse4_x86_32_D_16u2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_32_D_16i4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x20b955c3,
+0x89000000, 0x57c031e5, 0x000005bf, 0x81535600,
+0x00009cec, 0x89c38900, 0x40da89fe, 0x2901e283,
+0x01fa83c6, 0xe283d219, 0xd8854a02, 0x89490175,
+0x83a48544, 0x748904f8, 0x5489b485, 0x4c89c485,
+0xd175d485, 0xa87d280f, 0x78bd290f, 0x0fffffff,
+0xff788528, 0x0f66ffff, 0x39b8c976, 0x0f000005,
+0x0f66d028, 0x0f66d776, 0x0fd11738, 0x0004d083,
+0x55280f00, 0xfe0f66a8, 0x55290fd0, 0x55280f88,
+0x053fb8a8, 0x0f660000, 0x6601f272, 0x8855760f,
+0x17380f66, 0xa6830fd1, 0x0f000004, 0x66885528,
+0xa855fa0f, 0x9855290f, 0xb8d0280f, 0x00000544,
+0x55760f66, 0x380f6698, 0x830fd117, 0x00000481,
+0xb85d280f, 0x40380f66, 0x0f66a845, 0x0fdb4038,
+0x0fa85528, 0x66b86d28, 0x0feafe0f, 0x0f66e228,
+0x0f66c3fa, 0xb8b865fa, 0x0000055b, 0x40380f66,
+0x760f66e5, 0x380f66c4, 0x830fc117, 0x00000441,
+0xb845280f, 0x40380f66, 0x05c8b8c2, 0x0f660000,
+0x05600576, 0x0f660010, 0x0fc11738, 0x00042083,
+0x45280f00, 0xc2570fc8, 0x7885290f, 0x66ffffff,
+0x66c07e0f, 0x4528380f, 0xb86df7b8, 0x8b984589,
+0x5589c045, 0x806df79c, 0xb8a04589, 0x000005e1,
+0x66a45589, 0x9845760f, 0x17380f66, 0xde830fc1,
+0x0f000003, 0x66c84528, 0xc240380f, 0x9845290f,
+0x9865280f, 0xf4720f66, 0xa5290f03, 0xffffff78,
+0x985d280f, 0xf3720f66, 0x5d290f02, 0xfe0f6688,
+0x05edb8db, 0x0f660000, 0x0f66dc76, 0x0fd91738,
+0x00039c83, 0x9d280f00, 0xffffff78, 0xe3720f66,
+0xfe0f6602, 0x05f2b8db, 0x0f660000, 0x66885d76,
+0xd917380f, 0x0377830f, 0x85c70000, 0xffffff74,
+0x00000003, 0x8bd8280f, 0xffff7485, 0x608589ff,
+0xc1ffffff, 0x85891ff8, 0xffffff64, 0xbd7e0ff3,
+0xffffff60, 0xdff20f66, 0xff7485c7, 0x0002ffff,
+0x858b0000, 0xffffff74, 0xff608589, 0xf8c1ffff,
+0x6485891f, 0xf3ffffff, 0x60bd7e0f, 0x66ffffff,
+0x0fc7f20f, 0x66884529, 0xb8c0fe0f, 0x00000605,
+0xc3760f66, 0x17380f66, 0x02830fc1, 0x8b000003,
+0xffff7485, 0x608589ff, 0xc1ffffff, 0x85891ff8,
+0xffffff64, 0xbd7e0ff3, 0xffffff60, 0xdfe20f66,
+0x66c3280f, 0xb8c3fe0f, 0x00000609, 0x45760f66,
+0x380f6688, 0x830fc117, 0x000002c5, 0xc85d280f,
+0x0fe4570f, 0x66d84528, 0xda40380f, 0xc4660f66,
+0x0fc3540f, 0x66984529, 0x8bc07e0f, 0xc789d84d,
+0x8b9c5d8b, 0x558ba075, 0x8be7d3a4, 0x0f66dc4d,
+0xd789ef6e, 0x4d8be3d3, 0x3a0f66e0, 0xd301eb22,
+0xe44d8be6, 0xc66e0f66, 0x0f66e7d3, 0x01c7223a,
+0xe86c0f66, 0x701d280f, 0x0f001005, 0x66d84528,
+0x0fc3fa0f, 0x8bd84529, 0x5d8bd84d, 0x8be0d3a0,
+0x0f66dc4d, 0x458bc06e, 0x8be0d39c, 0x0f66e04d,
+0x01c0223a, 0x000621b8, 0x8be3d300, 0x0f66e44d,
+0xe2d3f36e, 0x223a0f66, 0x0f6601f2, 0x0f66c66c,
+0x0f66c0fe, 0x0f66c576, 0x0fc11738, 0x00021083,
+0x6d280f00, 0x45280fc8, 0xf5280fb8, 0x40380f66,
+0x45290fc5, 0x380f6688, 0x280ff240, 0x0f668845,
+0x66c63d38, 0x7539380f, 0x75290f88, 0xfe0f6688,
+0x3db88845, 0x0f000006, 0x66b87528, 0xc540380f,
+0xf2fe0f66, 0xc6760f66, 0x17380f66, 0xbe830fc1,
+0x66000001, 0xea40380f, 0x78ad290f, 0xb8ffffff,
+0x00000644, 0x1e380f66, 0xffff7885, 0x760f66ff,
+0x380f66d0, 0x830fd117, 0x00000195, 0xc845280f,
+0x000649b8, 0xd3280f00, 0x0a380f66, 0x760f66d0,
+0x380f66d0, 0x830fd117, 0x00000175, 0xb86d280f,
+0x55700f66, 0x4eb81ba8, 0x66000006, 0x66d5760f,
+0xd117380f, 0x0157830f, 0x280f0000, 0x620f66d5,
+0x0f66a855, 0x66a86d6a, 0xb8d5fa0f, 0x000006a8,
+0x40380f66, 0x760f66d0, 0x10058015, 0x380f6600,
+0x830fd117, 0x00000129, 0xa855280f, 0x66f4280f,
+0xd040380f, 0xf0660f66, 0x0fea280f, 0xff789529,
+0x0f66ffff, 0x280fee62, 0xffff78bd, 0x380f66ff,
+0xb3b8d725, 0x66000006, 0x66d5760f, 0xd117380f,
+0x00eb830f, 0x458b0000, 0x660f66bc, 0x7d280fc4,
+0x7d290fa8, 0x7d280f88, 0x8c4589b8, 0x66c4458b,
+0x7d10380f, 0xc7280fa8, 0xb8944589, 0x0000072a,
+0x8855280f, 0xc2760f66, 0x17380f66, 0xae830fc1,
+0x0f000000, 0xb8a84528, 0x0000073a, 0x66e0280f,
+0x650e3a0f, 0x0f66ccb8, 0x0f66d476, 0x0fd11738,
+0x00008c83, 0x15280f00, 0x00100590, 0x00074ab8,
+0xd0540f00, 0xdafe0f66, 0x66d0280f, 0xd00f3a0f,
+0x760f6604, 0x380f66d3, 0x6573d117, 0x7885290f,
+0x0fffffff, 0x280fd257, 0x380f66c2, 0xff788502,
+0x290fffff, 0xffff7885, 0xc2280fff, 0x00075eb8,
+0x380f6600, 0xff788502, 0x0f66ffff, 0x03c2163a,
+0x750afa83, 0x45280f2c, 0x66c031a8, 0x4506380f,
+0x380f66b8, 0x0f66c202, 0x66c20238, 0x66c2760f,
+0xc117380f, 0x83c0920f, 0xc01901f8, 0x00076725,
+0x9cc48100, 0x5b000000, 0xc35d5f5e, 0x00000000,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x00000002, 0x00000002, 0x00000002, 0x00000002,
+0x00000003, 0x00000003, 0x00000003, 0x00000003,
+0002640,
+};
+asm(".type sse4_x86_32_D_16i4, STT_NOTYPE;");
+asm(".type sse4_x86_32_D_16i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_32_D_16u4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x20ba55c3,
+0x89000000, 0x57c031e5, 0x000005bf, 0x81535600,
+0x00008cec, 0x89c38900, 0x40d989fe, 0x2901e183,
+0xd88549c6, 0x894a0175, 0x83a48544, 0x748904f8,
+0x4c89b485, 0x5489c485, 0xd975d485, 0xa87d280f,
+0x78bd290f, 0x0fffffff, 0xff789528, 0x0f66ffff,
+0x39b8c976, 0x0f000005, 0x0f66c228, 0x0f66c776,
+0x0fc11738, 0x00041f83, 0x45280f00, 0xfe0f66a8,
+0x45290fc2, 0x45280f88, 0x053fb8a8, 0x0f660000,
+0x6601f072, 0x8845760f, 0x17380f66, 0xf5830fc1,
+0x0f000003, 0x66884528, 0xa845fa0f, 0x9845290f,
+0xb8da280f, 0x00000544, 0x5d760f66, 0x380f6698,
+0x830fd917, 0x000003d0, 0xb855560f, 0x7895290f,
+0x0fffffff, 0x0fb84554, 0x0f985528, 0x0fb85557,
+0xff788555, 0x50b8ffff, 0x66000005, 0x66ed760f,
+0x66c2760f, 0xc117380f, 0x039a830f, 0x280f0000,
+0x280fa85d, 0x0f66b845, 0xb8c34038, 0x000005c8,
+0x05760f66, 0x001004b0, 0x17380f66, 0x75830fc1,
+0x0f000003, 0x0fc84528, 0x290fc357, 0xffff7885,
+0x7e0f66ff, 0xf40f66c0, 0x65f7b845, 0x984589b8,
+0x89c0458b, 0x65f79c55, 0xa0458980, 0x0005e1b8,
+0xa4558900, 0x45760f66, 0x380f6698, 0x830fc117,
+0x00000334, 0x985d290f, 0x9855280f, 0xf2720f66,
+0x95290f03, 0xffffff78, 0x9845280f, 0xf0720f66,
+0x45290f02, 0xfe0f6688, 0x05edb8c0, 0x0f660000,
+0x0f66c276, 0x0fc11738, 0x0002fb83, 0x85280f00,
+0xffffff78, 0xd0720f66, 0xfe0f6602, 0x05f2b8c0,
+0x0f660000, 0x66884576, 0xc117380f, 0x02d6830f,
+0x85c70000, 0xffffff74, 0x00000003, 0x66c3280f,
+0x74956e0f, 0x66ffffff, 0xc7c2f20f, 0xffff7485,
+0x000002ff, 0xd3280f00, 0xa56e0f66, 0xffffff74,
+0xd4f20f66, 0x8855290f, 0xd2fe0f66, 0x000605b8,
+0x760f6600, 0x380f66d0, 0x830fd117, 0x00000288,
+0x956e0f66, 0xffffff74, 0xc2d20f66, 0xc0fe0f66,
+0x000609b8, 0x760f6600, 0x0f668845, 0x0fc11738,
+0x00026383, 0xd2570f00, 0x66c2280f, 0xd845760f,
+0xc2760f66, 0x0fc3540f, 0x66984529, 0x8bc07e0f,
+0xc789d84d, 0x8b9c5d8b, 0x558ba075, 0x8be7d3a4,
+0x0f66dc4d, 0xd789e76e, 0x4d8be3d3, 0x3a0f66e0,
+0xd301e322, 0xe44d8be6, 0xc66e0f66, 0x0f66e7d3,
+0x01c7223a, 0xe06c0f66, 0xd845280f, 0xc5fe0f66,
+0xd845290f, 0x8bd84d8b, 0xe0d3a05d, 0x66dc4d8b,
+0x8bc06e0f, 0xe0d39c45, 0x66e04d8b, 0xc0223a0f,
+0x0621b801, 0xe3d30000, 0x66e44d8b, 0xd3f36e0f,
+0x3a0f66e2, 0x6601f222, 0x66c66c0f, 0x66c0fe0f,
+0x66c4760f, 0xc117380f, 0x01ba830f, 0x280f0000,
+0x0f66b845, 0x0fc33b38, 0x66b86528, 0xe33f380f,
+0x5dfe0f66, 0xfe0f66b8, 0x0634b8c4, 0x0f660000,
+0x0f66c376, 0x0fc11738, 0x00018b83, 0x1d280f00,
+0x001004c0, 0x000649b8, 0x65280f00, 0xc3280fc8,
+0x0a380f66, 0x760f66c4, 0x380f66c4, 0x830fc117,
+0x00000164, 0xb845280f, 0x75700f66, 0x4eb81ba8,
+0x66000006, 0x66f0760f, 0xf117380f, 0x0146830f,
+0x280f0000, 0x620f66f0, 0x0f66a875, 0x66a8456a,
+0xb8c5fe0f, 0x000006a8, 0xc6fa0f66, 0x0fc4570f,
+0x0f66e557, 0x0f66c4fa, 0x04d00576, 0x0f660010,
+0x0fc11738, 0x00010f83, 0x380f6600, 0x0fa86535,
+0x66a87d28, 0xc735380f, 0x0006d3b8, 0x760f6600,
+0x380f66c4, 0x830fc117, 0x000000ec, 0x0fbc458b,
+0x280fc057, 0x0f66a87d, 0x0fc84564, 0x0f887d29,
+0x89b87d28, 0x458b8c45, 0x380f66c4, 0x0fa87d10,
+0x4589c728, 0x072ab894, 0x280f0000, 0x0f668865,
+0x0f66c476, 0x0fc11738, 0x0000ab83, 0x45280f00,
+0x073ab8a8, 0x280f0000, 0x3a0f66e8, 0xccb86d0e,
+0xe5760f66, 0x17380f66, 0x89830fe1, 0x0f000000,
+0x04e02528, 0x4ab80010, 0x0f000007, 0x0f66e054,
+0x280fe3fe, 0x3a0f66d8, 0x6604d80f, 0x66dc760f,
+0xd917380f, 0x290f6273, 0xffff7885, 0xc2280fff,
+0x02380f66, 0xffff7885, 0x85290fff, 0xffffff78,
+0x02380f66, 0xffff7895, 0x075eb8ff, 0x0f660000,
+0x03d2163a, 0x750afa83, 0x45280f2f, 0xd2570fa8,
+0x0f66c031, 0xb8450638, 0x02380f66, 0x380f66c2,
+0x0f66c202, 0x0f66c276, 0x0fc11738, 0xf883c092,
+0x25c01901, 0x00000767, 0x008cc481, 0x5e5b0000,
+0x00c35d5f, 0x00000000, 0x00000000, 0x00000000,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x00000002, 0x00000002, 0x00000002, 0x00000002,
+0x00000003, 0x00000003, 0x00000003, 0x00000003,
+0002360,
+};
+asm(".type sse4_x86_32_D_16u4, STT_NOTYPE;");
+asm(".type sse4_x86_32_D_16u4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_32_D_16i8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0x3157e589, 0x815356ff, 0x00009cec, 0xcc458900,
+0x4589c031, 0x89c031dc, 0xc031c445, 0x31d44589,
+0xb845c7c0, 0x00000001, 0xc7bc7d89, 0x0002c845,
+0x45c70000, 0x00003fd8, 0xc045c700, 0x00000002,
+0x01d045c7, 0xc7000000, 0x003ee045, 0x45890000,
+0x7d280fe4, 0x7d290fb8, 0x55280f88, 0x760f6688,
+0x0539b8c9, 0x280f0000, 0x380f66c2, 0x0f66c729,
+0x0fc11738, 0x0004ec83, 0x45280f00, 0xd40f66b8,
+0x45290fc2, 0x45280f98, 0x053fb8b8, 0x0f660000,
+0x6601f073, 0x4529380f, 0x380f6698, 0x830fc117,
+0x000004c1, 0x9845280f, 0x45fb0f66, 0x45290fb8,
+0xc2280fa8, 0x000544b8, 0x380f6600, 0x66a84529,
+0xc117380f, 0x049b830f, 0x280f0000, 0x65280fc2,
+0x730f66b8, 0x280f20d0, 0xf40f66da, 0x0f66b845,
+0x66b85df4, 0x20d4730f, 0xd4f40f66, 0xc2d40f66,
+0xc855280f, 0xf0730f66, 0xd40f6620, 0xc2280fd8,
+0xd0730f66, 0xe2280f20, 0xc2f40f66, 0xc0d40f66,
+0xe2f40f66, 0xf0730f66, 0xd40f6620, 0xa5290fe0,
+0xffffff68, 0xb855280f, 0xc845280f, 0xc2d40f66,
+0xb8f2280f, 0x0000055b, 0x75fb0f66, 0xe8280fc8,
+0xd5730f66, 0xfe280f20, 0xeef40f66, 0x66e6280f,
+0x20d7730f, 0x9dfb0f66, 0xffffff68, 0xe0f40f66,
+0xc7f40f66, 0xc5d40f66, 0xf0730f66, 0xd40f6620,
+0x380f66e0, 0x0f66dc29, 0x0fd91738, 0x0003e483,
+0x45280f00, 0xda280fc8, 0x0fe8280f, 0x0f66e228,
+0x6620d373, 0x20d5730f, 0xe0f40f66, 0xeaf40f66,
+0xc3f40f66, 0xc5d40f66, 0xf0730f66, 0xd40f6620,
+0x05c8b8c4, 0x0f660000, 0x80052938, 0x66001005,
+0xc117380f, 0x039b830f, 0x85c70000, 0xffffff68,
+0x00000001, 0xb589f631, 0xffffff6c, 0x857e0ff3,
+0xffffff68, 0xa005160f, 0x0f001005, 0x0f66f028,
+0x0f20d673, 0x280feb28, 0xf40f66e2, 0xf40f66e8,
+0xf40f66d6, 0xd40f66e0, 0x730f66ea, 0x0f6620f5,
+0x290fecd4, 0x280fa86d, 0x0f66a875, 0x0f03f673,
+0x0f887529, 0x66a86d28, 0x02f5730f, 0x986d290f,
+0xedd40f66, 0xd8f40f66, 0x29380f66, 0x05edb8ee,
+0x0f660000, 0x0fe91738, 0x00031883, 0x6d280f00,
+0x75280f88, 0x730f6688, 0x0f6602d5, 0x6602e672,
+0xee0e3a0f, 0xd40f66cc, 0x05f2b8ed, 0x0f660000,
+0x986d2938, 0x17380f66, 0xe6830fe9, 0x0f000002,
+0x45c7f328, 0x00000384, 0xd40f6600, 0x730f66f2,
+0x0f6620f6, 0x280ff4d4, 0x84458bee, 0xff688589,
+0xf8c1ffff, 0x6c85891f, 0xf3ffffff, 0x68bd7e0f,
+0x66ffffff, 0xc7eff30f, 0x00028445, 0x458b0000,
+0x68858984, 0xc1ffffff, 0x85891ff8, 0xffffff6c,
+0xbd7e0ff3, 0xffffff68, 0xf7f30f66, 0x9875290f,
+0xf6d40f66, 0x000605b8, 0x380f6600, 0x0f66f529,
+0x0ff11738, 0x00026c83, 0x84558b00, 0x0fff570f,
+0x0f66f728, 0x0ff53738, 0xff58b529, 0xd089ffff,
+0xff689589, 0xf8c1ffff, 0x6c85891f, 0xb8ffffff,
+0x00000040, 0xb57e0ff3, 0xffffff68, 0xeed30f66,
+0x290fd029, 0xffff68ad, 0x6e0f66ff, 0xad280ff0,
+0xffffff58, 0xeef30f66, 0x0ff5280f, 0xff68ad28,
+0x560fffff, 0xd40f66ee, 0x0609b8ed, 0x0f660000,
+0x986d2938, 0x17380f66, 0xf6830fe9, 0x66000001,
+0x66d3d40f, 0x20f2730f, 0xe2d40f66, 0xd855280f,
+0x37380f66, 0xe2540fd7, 0xa865290f, 0xa5d60f66,
+0xffffff68, 0x31d84d8a, 0x7e0f66db, 0x3a0f66e0,
+0x0f01e216, 0xe0d3c2a5, 0x8a20c1f6, 0x450fe04d,
+0xc3450fd0, 0xff588589, 0x458bffff, 0x89ff31b0,
+0xffff5c95, 0xb4558bff, 0xa57e0ff3, 0xffffff58,
+0xe3d3c389, 0xa50fd689, 0x20c1f6c6, 0x0ff3450f,
+0x9d89df45, 0xffffff58, 0xff5cb589, 0x160fffff,
+0xffff58a5, 0x15280fff, 0x00100590, 0xd85d280f,
+0xdafb0f66, 0xd85d290f, 0x31d84d8a, 0x68b58bdb,
+0x8bffffff, 0xffff6cbd, 0xf7a50fff, 0xc1f6e6d3,
+0xe04d8a20, 0x0ffe450f, 0xdb31f345, 0xde6e0f66,
+0x223a0f66, 0xa50f01df, 0xf6e0d3c2, 0x450f20c1,
+0xc3450fd0, 0xff688589, 0x21b8ffff, 0x89000006,
+0xffff6c95, 0x9d160fff, 0xffffff68, 0xdbd40f66,
+0x29380f66, 0x380f66dc, 0x830fd917, 0x000000f5,
+0xc85d280f, 0x65700f66, 0x4eb84eb8, 0x66000006,
+0xe329380f, 0x17380f66, 0xd6830fe1, 0x0f000000,
+0x0f66f328, 0x66b8756c, 0xb85d6d0f, 0xf3fb0f66,
+0x0006a8b8, 0xde280f00, 0x66e8280f, 0x20d3730f,
+0xd5730f66, 0xf40f6620, 0xe6280fd8, 0xeef40f66,
+0xddd40f66, 0xe0f40f66, 0xf3730f66, 0xd40f6620,
+0x380f66dc, 0x0f66da29, 0x0fd91738, 0x00008483,
+0x7d280f00, 0x7e0ff3b8, 0x2ab8d05d, 0x0f000007,
+0x66987d29, 0xa05dd60f, 0x0fdb570f, 0x66c87d28,
+0xc337380f, 0x985d280f, 0x10380f66, 0x280fb87d,
+0x380f66c7, 0x0f66c329, 0x73c11738, 0x45280f48,
+0x073ab8b8, 0x280f0000, 0x3a0f66e0, 0xf0c8650e,
+0x29380f66, 0x380f66dc, 0x2973d917, 0x31d8280f,
+0x3a0f66c0, 0x0f08d80f, 0x0f66c254, 0x0f66c2d4,
+0x66c32938, 0xc117380f, 0x83c0920f, 0xc01901f8,
+0x00074a25, 0x9cc48100, 0x5b000000, 0xc35d5f5e,
+0x00000002, 0x00000000, 0x00000002, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0xffffffff, 0xffffffff,
+0002650,
+};
+asm(".type sse4_x86_32_D_16i8, STT_NOTYPE;");
+asm(".type sse4_x86_32_D_16i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_32_D_16u8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0x3157e589, 0xf63156ff, 0x8cec8153, 0x89000000,
+0xc031dc45, 0x31c44589, 0xd44589c0, 0x45c7c031,
+0x000001b8, 0xbc758900, 0x02c845c7, 0x89000000,
+0x45c7cc7d, 0x00003fd8, 0xc045c700, 0x00000002,
+0x01d045c7, 0xc7000000, 0x003ee045, 0x45890000,
+0x75280fe4, 0x75290fb8, 0x55280f88, 0x760f6688,
+0x0539b8c9, 0x280f0000, 0x380f66c2, 0x0f66c629,
+0x0fc11738, 0x00037883, 0x45280f00, 0xd40f66b8,
+0x45290fc2, 0x45280f98, 0x053fb8b8, 0x0f660000,
+0x6601f073, 0x4529380f, 0x380f6698, 0x830fc117,
+0x0000034d, 0x9845280f, 0x45fb0f66, 0x45290fb8,
+0xda280fa8, 0x000544b8, 0x380f6600, 0x66a85d29,
+0xd917380f, 0x0327830f, 0x560f0000, 0x290fc855,
+0x540f8855, 0x280fc845, 0x570fa855, 0x570fc855,
+0x0550b8c1, 0x540f0000, 0x0f668845, 0x66c22938,
+0xc117380f, 0x02f7830f, 0x280f0000, 0x280fb845,
+0x65280fd0, 0x730f66c8, 0x280f20d2, 0xf40f66d8,
+0x0f66c855, 0x66c85df4, 0x20d4730f, 0xe0f40f66,
+0xd4d40f66, 0xf2730f66, 0xd40f6620, 0x05c8b8d3,
+0x0f660000, 0x10152938, 0x66001004, 0xd117380f,
+0x02ab830f, 0x290f0000, 0x280fa845, 0x0f66a85d,
+0x0f03f373, 0x0f885d29, 0x66a85528, 0x02f2730f,
+0x9855290f, 0xd2d40f66, 0x0005edb8, 0x380f6600,
+0x0f66d329, 0x0fd11738, 0x00027483, 0x55280f00,
+0x730f6688, 0x0f6602d2, 0xf2b8d2d4, 0x66000005,
+0x5529380f, 0x380f6698, 0x830fd117, 0x00000251,
+0x038445c7, 0x0f000000, 0x0f66d028, 0x66845d6e,
+0xc7d3f30f, 0x00028445, 0x0f660000, 0x66845d6e,
+0x0fc3f30f, 0x66984529, 0xb8c0d40f, 0x00000605,
+0x29380f66, 0x380f66c2, 0x830fc117, 0x00000211,
+0x5d6e0f66, 0xd30f6684, 0xc2280fd3, 0xc2d40f66,
+0x000609b8, 0x380f6600, 0x66984529, 0xc117380f,
+0x01eb830f, 0x570f0000, 0xc2280fd2, 0x29380f66,
+0x0f66d845, 0x0fc22938, 0x0fb84554, 0x66a84529,
+0x7085d60f, 0x8affffff, 0xdb31d84d, 0xc07e0f66,
+0x163a0f66, 0xa50f01c2, 0xf6e0d3c2, 0x4d8a20c1,
+0xd0450fe0, 0x89c3450f, 0xffff6885, 0xb0458bff,
+0x9589ff31, 0xffffff6c, 0xf3b4558b, 0x68957e0f,
+0x89ffffff, 0x89e3d3c3, 0xc6a50fd6, 0x0f20c1f6,
+0x450ff345, 0x689d89df, 0x89ffffff, 0xffff6cb5,
+0x95160fff, 0xffffff68, 0xd845280f, 0xc1d40f66,
+0xd845290f, 0x31d84d8a, 0x70b58bdb, 0x8bffffff,
+0xffff74bd, 0xf7a50fff, 0xc1f6e6d3, 0xe04d8a20,
+0x0ffe450f, 0xdb31f345, 0xc66e0f66, 0x223a0f66,
+0xa50f01c7, 0xf6e0d3c2, 0x450f20c1, 0xc3450fd0,
+0xff708589, 0x21b8ffff, 0x89000006, 0xffff7495,
+0x85160fff, 0xffffff70, 0xc0d40f66, 0x29380f66,
+0x380f66c2, 0x830fc117, 0x000000f5, 0xc855280f,
+0x45700f66, 0x4eb84eb8, 0x66000006, 0xc229380f,
+0x17380f66, 0xd6830fc1, 0xc7000000, 0xffff7085,
+0xffffffff, 0x7485c7ff, 0xffffffff, 0xf3ffffff,
+0x70857e0f, 0xf3ffffff, 0x0fc07e0f, 0x0f66da28,
+0x66b85d6c, 0xb8556d0f, 0xd1d40f66, 0x0006a8b8,
+0xfb0f6600, 0xd8280fd3, 0x0fd0570f, 0x0f66d957,
+0x280fd3fb, 0x1004201d, 0x380f6600, 0x0f66d329,
+0x73d11738, 0x7d280f7c, 0x7e0ff3b8, 0x2ab8d055,
+0x0f000007, 0x66987d29, 0xa055d60f, 0xc86d280f,
+0x9855280f, 0x10380f66, 0x280fb86d, 0x380f66c5,
+0x0f66c229, 0x73c11738, 0x45280f48, 0x073ab8b8,
+0x280f0000, 0x3a0f66e0, 0xf0c8650e, 0x29380f66,
+0x380f66d4, 0x2973d117, 0x31d0280f, 0x3a0f66c0,
+0x0f08d00f, 0x0f66c354, 0x0f66c3d4, 0x66c22938,
+0xc117380f, 0x83c0920f, 0xc01901f8, 0x00074a25,
+0x8cc48100, 0x5b000000, 0xc35d5f5e, 0x00000000,
+0x00000002, 0x00000000, 0x00000002, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0002060,
+};
+asm(".type sse4_x86_32_D_16u8, STT_NOTYPE;");
+asm(".type sse4_x86_32_D_16u8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_32_D_16f4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xe8d955c3,
+0xec83e589, 0xc855d978, 0x045005d9, 0x55d90010,
+0xd9c9d9d8, 0x05d9e855, 0x00100454, 0xd9cc55d9,
+0x10045805, 0xdc55d900, 0xe0d9e8d9, 0xd9ec55d9,
+0xd05dd9c9, 0x5dd9c9d9, 0xd9c9d9e0, 0xcad9f055,
+0xd9d45dd9, 0xe45dd9c9, 0x0ff45dd9, 0x0fc87d28,
+0x0f987d29, 0x66984528, 0xb8c9760f, 0x00000539,
+0x0fd0280f, 0x6600d7c2, 0xd117380f, 0x03c6830f,
+0x280f0000, 0x580fc855, 0x55290fd0, 0x55280fa8,
+0x053fb8c8, 0x580f0000, 0x55c20fd2, 0x0f6600a8,
+0x0fd11738, 0x00039f83, 0x55280f00, 0x555c0fa8,
+0x55290fc8, 0xd0280fb8, 0x000544b8, 0x55c20f00,
+0x0f6600b8, 0x0fd11738, 0x00037b83, 0x5d280f00,
+0x45590fd8, 0xdb590fc8, 0xc855280f, 0xd86d280f,
+0x0fea580f, 0x5bb8e228, 0x0f000005, 0x0fd8655c,
+0x590fc35c, 0xc4c20fe5, 0x380f6600, 0x830fc117,
+0x00000344, 0xe845280f, 0x0fc2590f, 0x0f984529,
+0xb8e8555e, 0x00000564, 0x00c2c20f, 0x17380f66,
+0x21830fc1, 0xf3000003, 0x6015100f, 0xb8001004,
+0x00000567, 0xe85d280f, 0x0fc3280f, 0x0f00d2c6,
+0x590fc257, 0x570f9845, 0xc20fc855, 0x0f6600c2,
+0x0fc11738, 0x0002ef83, 0x5b0f6600, 0x5b0fc845,
+0x45c20fc0, 0x6eb800c8, 0x66000005, 0xc117380f,
+0x02d2830f, 0x530f0000, 0x290fc845, 0x530f9845,
+0x75b89845, 0x0f000005, 0x66c85528, 0x0fc05b0f,
+0xc20fc05b, 0x0f6600c2, 0x0fc11738, 0x0002a783,
+0xc2280f00, 0x0fc2590f, 0x0f984529, 0x0f984552,
+0x0fa84529, 0xb8a84528, 0x0000057c, 0x66e0530f,
+0x0fe45b0f, 0xc20fe45b, 0x0f6600d4, 0x0fd11738,
+0x00027383, 0x5b0f6600, 0x45280fd0, 0x057eb8c8,
+0x5b0f0000, 0xe0530fd2, 0xe45b0f66, 0x0fe45b0f,
+0x6600d4c2, 0xd117380f, 0x024a830f, 0x280f0000,
+0xd0590fd0, 0x9855290f, 0x9855510f, 0x00059cb8,
+0xd0c20f00, 0x380f6600, 0x830fd117, 0x00000228,
+0x25100ff3, 0x00100470, 0x00e4c60f, 0x0fd4280f,
+0x290fd05e, 0x0f669855, 0x9855083a, 0x15c20f0b,
+0x00100470, 0x05a4b800, 0x0f660000, 0x0fd11738,
+0x0001f383, 0x55280f00, 0xeb280fd8, 0x0fd3590f,
+0x290fe859, 0x280fa855, 0x555f0fd5, 0x6d5d0fa8,
+0x6d290fa8, 0x55580fa8, 0x063db8a8, 0x580f0000,
+0x590fd845, 0xc2c20fd3, 0x380f6600, 0x830fc117,
+0x000001b4, 0xc845280f, 0x00064eb8, 0xc0c60f00,
+0x45c20f1b, 0x0f6600d8, 0x0fc11738, 0x00019783,
+0x55280f00, 0xc2280fd8, 0xc845140f, 0x0fea280f,
+0x0fc86d15, 0xa8b8c55c, 0xf3000006, 0x542d100f,
+0x0f001004, 0xc60fc359, 0xc20f00ed, 0x0f6600c5,
+0x0fc11738, 0x00015f83, 0x120ff300, 0x0ff3c845,
+0x045c2d10, 0x17b80010, 0xf3000007, 0x6435100f,
+0x0f001004, 0x0fc8455c, 0x0f00edc6, 0x0f00f6c6,
+0x590feb58, 0xc5c20fee, 0x380f6600, 0x830fc117,
+0x00000124, 0x45160ff3, 0xe3580fc8, 0x00071eb8,
+0x6d280f00, 0xe6590fc8, 0x0fc55c0f, 0x6600c4c2,
+0xc117380f, 0x00fe830f, 0x45d90000, 0xc0570fdc,
+0x00072ab8, 0x6d290f00, 0xc3c20fa8, 0xac5dd901,
+0xd9e445d9, 0x0f66b45d, 0x0fd51438, 0x0fa84528,
+0x6600d0c2, 0xd117380f, 0x00ca830f, 0x280f0000,
+0x3ab8c855, 0x66000007, 0x550c3a0f, 0xc20f0ad8,
+0x0f6600c2, 0x0fc11738, 0x0000ab83, 0x45280f00,
+0xd00ff2c8, 0x280fd845, 0x43b8c855, 0xf2000007,
+0xd855d00f, 0x00c2c20f, 0x17380f66, 0x85830fc1,
+0x0f000000, 0xb8c85528, 0x00000752, 0x66c2280f,
+0x45403a0f, 0xc20ff1d8, 0x10048005, 0x0f660000,
+0x73c11738, 0x55290f63, 0xd2570f98, 0xf2c2280f,
+0x98457c0f, 0x9845290f, 0xd9c2280f, 0x10046805,
+0x7c0ff200, 0x0f669845, 0x9445173a, 0x9445d903,
+0xd8dde9df, 0x2b752d7a, 0xc845280f, 0x0ff2c031,
+0xf2d8457d, 0xf2c27c0f, 0x0fc27c0f, 0x6600c2c2,
+0xc117380f, 0x83c0920f, 0xc01901f8, 0x00076725,
+0xb805eb00, 0x0000075e, 0x0000c3c9, 0x00000000,
+0x40800000, 0x40000000, 0x40400000, 0xbf800000,
+0x80000000, 0x3f000000, 0x41200000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x41a00000, 0x00000000, 0x00000000, 0x00000000,
+0002220,
+};
+asm(".type sse4_x86_32_D_16f4, STT_NOTYPE;");
+asm(".type sse4_x86_32_D_16f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_32_D_16f8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0xe589e8d9, 0xdd78ec83, 0x05d9c855, 0x00100440,
+0xd9d855dd, 0xf04589c9, 0xd9e855dd, 0xf445c7c9,
+0xbff00000, 0xddd05ddd, 0x280fe05d, 0x290fc87d,
+0x280f987d, 0x0f669845, 0x39b8c976, 0x0f000005,
+0x0f66d028, 0x6600d7c2, 0xd117380f, 0x03d0830f,
+0x280f0000, 0x0f66c855, 0x290fd058, 0x280fa855,
+0x3fb8c855, 0x66000005, 0x66d2580f, 0xa855c20f,
+0x380f6600, 0x830fd117, 0x000003a6, 0xa855280f,
+0x555c0f66, 0x55290fc8, 0xd0280fb8, 0x000544b8,
+0xc20f6600, 0x6600b855, 0xd117380f, 0x0380830f,
+0x280f0000, 0x0f66d85d, 0x66c84559, 0x0fdb590f,
+0x0fc85528, 0x66d86d28, 0x0fea580f, 0x0f66e228,
+0x5bb8c35c, 0x66000005, 0xd8655c0f, 0xe5590f66,
+0xc4c20f66, 0x380f6600, 0x830fc117, 0x00000342,
+0xe845280f, 0xc2590f66, 0x9845290f, 0x000564b8,
+0x5e0f6600, 0x0f66e855, 0x6600c2c2, 0xc117380f,
+0x031c830f, 0x280f0000, 0x0ff2e855, 0x04481d12,
+0x67b80010, 0x0f000005, 0x570fc228, 0x5d570fc3,
+0x590f66c8, 0x0f669845, 0x6600c3c2, 0xc117380f,
+0x02ec830f, 0x0ff20000, 0xf3c845e6, 0xb8c0e60f,
+0x0000056e, 0x45c20f66, 0x0f6600c8, 0x0fc11738,
+0x0002cd83, 0x5a0f6600, 0x530fc845, 0xc05a0fc0,
+0x9845290f, 0x455a0f66, 0xc0530f98, 0x000575b8,
+0x5d280f00, 0xc05a0fc8, 0xc0e60ff2, 0xc0e60ff3,
+0xc3c20f66, 0x380f6600, 0x830fc117, 0x00000292,
+0x66c3280f, 0x0fc3590f, 0x66984529, 0x98455a0f,
+0x0fc0520f, 0x290fc05a, 0x280fa845, 0x7cb8a865,
+0x66000005, 0x0fc45a0f, 0x5a0fc053, 0xe60ff2c0,
+0xe60ff3c0, 0xc20f66c0, 0x0f6600d8, 0x0fd91738,
+0x00024d83, 0x5d280f00, 0xe60ff2c8, 0x057eb8e4,
+0x0ff30000, 0x0f66e4e6, 0x530fc35a, 0xc05a0fc0,
+0xc0e60ff2, 0xc0e60ff3, 0xe0c20f66, 0x380f6600,
+0x830fe117, 0x0000021a, 0x66c3280f, 0x0fc3590f,
+0xb8984529, 0x0000059c, 0x45510f66, 0xc20f6698,
+0x0f6600c3, 0x0fc11738, 0x0001f583, 0x120ff200,
+0x10046025, 0xc4280f00, 0xc35e0f66, 0x9845290f,
+0x0005a4b8, 0x3a0f6600, 0x0b984509, 0x05c20f66,
+0x00100460, 0x380f6600, 0x830fc117, 0x000001c2,
+0xd845280f, 0x66ea280f, 0x66c2590f, 0x0feb590f,
+0x0fa84529, 0x0f66c528, 0x66a8455f, 0xa86d5d0f,
+0xa86d290f, 0x00063db8, 0x580f6600, 0x0f66a845,
+0x66d85d58, 0x66c2590f, 0x00c3c20f, 0x17380f66,
+0x7b830fc1, 0x0f000001, 0xb8c84528, 0x0000064e,
+0x0f3a0f66, 0x0f6608c0, 0x00d845c2, 0x17380f66,
+0x5b830fc1, 0x0f000001, 0x0fd85d28, 0x0f66c328,
+0x0fc84516, 0x66c86d28, 0xe06d120f, 0x0006a8b8,
+0x5c0f6600, 0x590f66c5, 0xc20f66c2, 0x0f6600c4,
+0x0fc11738, 0x00012983, 0x120ff200, 0x280fc845,
+0x0ff2c865, 0x04583512, 0x17b80010, 0x0f000007,
+0x0ff2e828, 0x04500512, 0x0f660010, 0x0f66c258,
+0x0f66ec5c, 0x0f66c659, 0x6600c5c2, 0xc117380f,
+0x00ec830f, 0x290f0000, 0x570fa865, 0x100ff2c0,
+0x0ff2e075, 0xb8b07511, 0x0000072a, 0xc2c20f66,
+0x380f6601, 0x280fdc15, 0x0f66a845, 0x6600d8c2,
+0xd917380f, 0x00b8830f, 0x280f0000, 0x3ab8c855,
+0x66000007, 0x550d3a0f, 0x0f6602d8, 0x6600c2c2,
+0xc117380f, 0x0098830f, 0x280f0000, 0x0f66c845,
+0x0fd845d0, 0xb8c85528, 0x00000743, 0x55d00f66,
+0xc20f66d8, 0x0f6600c2, 0x73c11738, 0x55280f75,
+0x0752b8c8, 0x280f0000, 0x3a0f66c2, 0x31d84541,
+0x05c20f66, 0x00100470, 0x380f6600, 0x5273c117,
+0x9855290f, 0x0fd2570f, 0x0f66c228, 0x6698457c,
+0x9045170f, 0x044405d9, 0x45dd0010, 0xdde9df90,
+0x752a7ad8, 0x45280f28, 0x66c031c8, 0xd8457d0f,
+0xc27c0f66, 0xc2c20f66, 0x380f6600, 0x920fc117,
+0x01f883c0, 0x6725c019, 0xeb000007, 0x075eb805,
+0xc3c90000, 0x00000000, 0x00000000, 0x00000000,
+0x40000000, 0x40400000, 0x00000000, 0x80000000,
+0x00000000, 0xbff00000, 0x00000000, 0x3fe00000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x40100000, 0x00000000, 0x00000000,
+0002200,
+};
+asm(".type sse4_x86_32_D_16f8, STT_NOTYPE;");
+asm(".type sse4_x86_32_D_16f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_32_D_f4[] = {
+0x31551aeb, 0x80e589c0, 0xff08287c, 0x83400a75,
+0xf37504f8, 0x02eb01b0, 0xc35dc031, 0x81e58955,
+0x0000f8ec, 0x100ff300, 0x10055005, 0x110ff300,
+0xffff3885, 0x110ff3ff, 0xffff3c85, 0x110ff3ff,
+0xffff4085, 0x38858bff, 0x89ffffff, 0xffff2c85,
+0x100ff3ff, 0xffff388d, 0xbac031ff, 0x00000000,
+0x2c8d2e0f, 0x0fffffff, 0x450fc09b, 0x89d8f7c2,
+0x8be82404, 0x83ffffff, 0xc18810c4, 0x000539b8,
+0x0fc98400, 0x0004bf84, 0x100ff300, 0xffff2c8d,
+0x580ff3ff, 0xffff388d, 0x110ff3ff, 0xffff308d,
+0x100ff3ff, 0xffff388d, 0x10ec83ff, 0x0ff3c031,
+0x2e0fc958, 0xffff308d, 0xc09b0fff, 0xf7c2450f,
+0x240489d8, 0xffff39e8, 0x10c483ff, 0x3fb8c188,
+0x84000005, 0x6d840fc9, 0xf3000004, 0x308d100f,
+0xf3ffffff, 0x388d5c0f, 0xf3ffffff, 0x188d110f,
+0x8bffffff, 0xffff1885, 0x6c8589ff, 0x89ffffff,
+0xffff3085, 0x348589ff, 0xf3ffffff, 0x2c8d100f,
+0x83ffffff, 0xc03110ec, 0x348d2e0f, 0x0fffffff,
+0x450fc09b, 0x89d8f7c2, 0xd3e82404, 0x83fffffe,
+0xc18810c4, 0x000544b8, 0x0fc98400, 0x00040784,
+0x100ff300, 0xffff2c8d, 0x590ff3ff, 0xffff388d,
+0x110ff3ff, 0xffff2c8d, 0x100ff3ff, 0xffff3c8d,
+0x590ff3ff, 0x110ff3c9, 0xffff308d, 0x100ff3ff,
+0xffff388d, 0x580ff3ff, 0xffff3c8d, 0x110ff3ff,
+0xffff348d, 0x100ff3ff, 0xffff388d, 0x10ec83ff,
+0x9d100ff3, 0xffffff2c, 0x280fc031, 0x5c0ff3d1,
+0xffff3c95, 0x5c0ff3ff, 0xffff309d, 0x590ff3ff,
+0xffff3495, 0x110ff3ff, 0xffff3495, 0xda2e0fff,
+0x0fc09b0f, 0xd8f7c245, 0xe8240489, 0xfffffe32,
+0x8810c483, 0x055bb8c1, 0xc9840000, 0x0366840f,
+0x0ff30000, 0xff408d59, 0x0ff3ffff, 0xff2c8d11,
+0x0ff3ffff, 0xff388d10, 0xec83ffff, 0xf3c03110,
+0x408d5e0f, 0x0fffffff, 0xff2c8d2e, 0x0ff3ffff,
+0xff308d11, 0x9b0fffff, 0xc2450fc0, 0x0489d8f7,
+0xfddce824, 0xc483ffff, 0xb8c18810, 0x00000564,
+0x840fc984, 0x00000310, 0x1d100ff3, 0x00100560,
+0xf310ec83, 0x408d100f, 0x31ffffff, 0x100ff3c0,
+0xffff3895, 0xcb570fff, 0x8d590ff3, 0xffffff2c,
+0x0fd3570f, 0x9b0fca2e, 0xc2450fc0, 0x0489d8f7,
+0xfd8ce824, 0xc483ffff, 0xb8c18810, 0x00000567,
+0x840fc984, 0x000002c0, 0x852c0ff3, 0xffffff38,
+0xff448589, 0x0ff3ffff, 0xff448d2a, 0x0ff3ffff,
+0xff2c8d11, 0x0ff3ffff, 0xff2c8d10, 0xec83ffff,
+0x0fc03110, 0xff388d2e, 0x9b0fffff, 0xc2450fc0,
+0x0489d8f7, 0xfd38e824, 0xc483ffff, 0xb8c18810,
+0x0000056e, 0x840fc984, 0x0000026c, 0x8d530ff3,
+0xffffff38, 0x8d110ff3, 0xffffff2c, 0x8d530ff3,
+0xffffff2c, 0xc12c0ff3, 0xff448589, 0x0ff3ffff,
+0xff44952a, 0xec83ffff, 0xf3c03110, 0x388d100f,
+0x0fffffff, 0x9b0fd12e, 0xc2450fc0, 0x0489d8f7,
+0xfcdce824, 0xc483ffff, 0xb8c18810, 0x00000575,
+0x840fc984, 0x00000210, 0xc9590ff3, 0x8d110ff3,
+0xffffff2c, 0x8d520ff3, 0xffffff2c, 0x8d110ff3,
+0xffffff30, 0x8d530ff3, 0xffffff30, 0xc12c0ff3,
+0xff448589, 0x0ff3ffff, 0xff448d2a, 0xec83ffff,
+0x0fc03110, 0xff388d2e, 0x9b0fffff, 0xc2450fc0,
+0x0489d8f7, 0xfc78e824, 0xc483ffff, 0xb8c18810,
+0x0000057c, 0x840fc984, 0x000001ac, 0x852c0ff3,
+0xffffff30, 0xff448589, 0x0ff3ffff, 0xff388d53,
+0x0ff3ffff, 0x0ff3c12c, 0xff44952a, 0x8589ffff,
+0xffffff44, 0x8d2a0ff3, 0xffffff44, 0x3110ec83,
+0xd12e0fc0, 0x0fc09b0f, 0xd8f7c245, 0xe8240489,
+0xfffffc1e, 0x8810c483, 0x057eb8c2, 0xd2840000,
+0x0152840f, 0x0ff30000, 0xff388d10, 0x0ff3ffff,
+0x0ff3c959, 0xff2c8d11, 0x0ff3ffff, 0xff389510,
+0xec83ffff, 0xbac03110, 0x00000000, 0x8d510ff3,
+0xffffff2c, 0x0fca2e0f, 0x450fc09b, 0x89d8f7c2,
+0xcbe82404, 0x83fffffb, 0xc18810c4, 0x00059cb8,
+0x0fc98400, 0x0000ff84, 0xc8280f00, 0x85110ff3,
+0xffffff30, 0xca5e0ff3, 0x8d110ff3, 0xffffff2c,
+0xec83c031, 0x3a0f6610, 0xff2c850a, 0x0f0bffff,
+0xff30852e, 0x0ff3ffff, 0xff348511, 0x9b0fffff,
+0xc2450fc0, 0x0489d8f7, 0xfb74e824, 0xc483ffff,
+0xb8c18810, 0x000005a4, 0x840fc984, 0x000000a8,
+0x85100ff3, 0xffffff40, 0x8d100ff3, 0xffffff38,
+0xc8590ff3, 0x85590ff3, 0xffffff3c, 0x8d110ff3,
+0xffffff2c, 0x85110ff3, 0xffffff30, 0x85100ff3,
+0xffffff2c, 0x855f0ff3, 0xffffff30, 0x85110ff3,
+0xffffff34, 0x85100ff3, 0xffffff2c, 0x855d0ff3,
+0xffffff30, 0x85110ff3, 0xffffff30, 0x85100ff3,
+0xffffff30, 0xf310ec83, 0x388d100f, 0x31ffffff,
+0x580ff3c0, 0xffff3485, 0x580ff3ff, 0xffff3c8d,
+0x590ff3ff, 0xffff4085, 0xc12e0fff, 0x0fc09b0f,
+0xd8f7c245, 0xe8240489, 0xfffffac6, 0x3c10c483,
+0x25c01901, 0x0000063d, 0x0000c3c9, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0002560,
+};
+asm(".type sse4_x86_32_D_f4, STT_NOTYPE;");
+asm(".type sse4_x86_32_D_f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_32_D_f8[] = {
+0x895500eb, 0xc8ec81e5, 0xf2000001, 0xa005100f,
+0xf2001006, 0x8085110f, 0xf2fffffe, 0x8885110f,
+0xf2fffffe, 0x9085110f, 0x8bfffffe, 0xfffe8085,
+0x688589ff, 0x8bfffffe, 0xfffe8485, 0x6c8589ff,
+0xf2fffffe, 0x80a5100f, 0x66fffffe, 0x68a52e0f,
+0x7afffffe, 0x0001b80c, 0x00ba0000, 0x74000000,
+0x31c03104, 0x89d8f7d2, 0xfffe4085, 0x00d283ff,
+0x000539b8, 0x89daf700, 0xfffe4495, 0x856f0fff,
+0xfffffe40, 0x81d0d70f, 0x0000fffa, 0x06850f00,
+0xf2000006, 0x688d100f, 0xf2fffffe, 0x808d580f,
+0xf2fffffe, 0x708d110f, 0x31fffffe, 0x100ff2d2,
+0xfffe808d, 0x0001b8ff, 0x0ff20000, 0x0f66c958,
+0xfe708d2e, 0x027affff, 0xc0310474, 0xd8f7d231,
+0xfe408589, 0xd283ffff, 0x053fb800, 0xdaf70000,
+0xfe449589, 0x6f0fffff, 0xfffe408d, 0xd1d70fff,
+0x00fffa81, 0x850f0000, 0x0000059d, 0x8d100ff2,
+0xfffffe70, 0x8d5c0ff2, 0xfffffe80, 0x8d110ff2,
+0xfffffe48, 0xfe48958b, 0x858bffff, 0xfffffe4c,
+0xfee09589, 0x8589ffff, 0xfffffee4, 0xfe709589,
+0x8589ffff, 0xfffffe74, 0xfe789589, 0x8589ffff,
+0xfffffe7c, 0x0ff2d231, 0xfe68ad10, 0x01b8ffff,
+0x66000000, 0x78ad2e0f, 0x7afffffe, 0x31047402,
+0xf7d231c0, 0x408589d8, 0x83fffffe, 0x44b800d2,
+0xf7000005, 0x449589da, 0x0ffffffe, 0xfe40956f,
+0xd70fffff, 0xfffa81d2, 0x0f000000, 0x00050885,
+0x100ff200, 0xfffe688d, 0x590ff2ff, 0xfffe808d,
+0x110ff2ff, 0xfffe688d, 0x100ff2ff, 0xfffe888d,
+0x590ff2ff, 0x110ff2c9, 0xfffe708d, 0x100ff2ff,
+0xfffe808d, 0x580ff2ff, 0xfffe888d, 0x110ff2ff,
+0xfffe788d, 0x100ff2ff, 0xfffe808d, 0xd1280fff,
+0x0ff2d231, 0xfe88955c, 0x0ff2ffff, 0xfe689d10,
+0x0ff2ffff, 0xfe789559, 0x0ff2ffff, 0xfe709d5c,
+0x01b8ffff, 0xf2000000, 0x7895110f, 0x66fffffe,
+0x7ada2e0f, 0x31047402, 0xf7d231c0, 0x408589d8,
+0x83fffffe, 0x5bb800d2, 0xf7000005, 0x449589da,
+0x0ffffffe, 0xfe409d6f, 0xd70fffff, 0xfffa81d3,
+0x0f000000, 0x00045085, 0x590ff200, 0xfffe908d,
+0x110ff2ff, 0xfffe688d, 0xf2d231ff, 0x808d100f,
+0xb8fffffe, 0x00000001, 0x8d5e0ff2, 0xfffffe90,
+0x8d110ff2, 0xfffffe70, 0x8d2e0f66, 0xfffffe68,
+0x0474027a, 0xd231c031, 0x8589d8f7, 0xfffffe40,
+0xb800d283, 0x00000564, 0x9589daf7, 0xfffffe44,
+0x40a56f0f, 0x0ffffffe, 0xfa81d4d7, 0x000000ff,
+0x03e3850f, 0x0ff30000, 0x06b0157e, 0x0ff20010,
+0xfe908d10, 0x0ff2ffff, 0xfe80b510, 0x570fffff,
+0x0fd231ca, 0x0ff2d657, 0xfe688d59, 0x01b8ffff,
+0x66000000, 0x7aca2e0f, 0x31047402, 0xf7d231c0,
+0x408589d8, 0x83fffffe, 0x67b800d2, 0xf7000005,
+0x449589da, 0x0ffffffe, 0xfe40ad6f, 0xd70fffff,
+0xfffa81d5, 0x0f000000, 0x00037c85, 0x2c0ff200,
+0xfffe8085, 0x648589ff, 0xf2fffffe, 0x648d2a0f,
+0xf2fffffe, 0x688d110f, 0x31fffffe, 0x100ff2d2,
+0xfffe68bd, 0x0001b8ff, 0x0f660000, 0xfe80bd2e,
+0x027affff, 0xc0310474, 0xd8f7d231, 0xfe408589,
+0xd283ffff, 0x056eb800, 0xdaf70000, 0xfe449589,
+0x6f0fffff, 0xfffe40b5, 0xd6d70fff, 0x00fffa81,
+0x850f0000, 0x00000311, 0x8d5a0ff2, 0xfffffe80,
+0xc9530ff3, 0xc95a0ff3, 0x8d130f66, 0xfffffe68,
+0x8d5a0ff2, 0xfffffe68, 0xc9530ff3, 0xc95a0ff3,
+0xc12c0ff2, 0xfe648589, 0x0ff2ffff, 0xfe64952a,
+0xd231ffff, 0x8d100ff2, 0xfffffe80, 0x000001b8,
+0x2e0f6600, 0x74027ad1, 0x31c03104, 0x89d8f7d2,
+0xfffe4085, 0x00d283ff, 0x000575b8, 0x89daf700,
+0xfffe4495, 0xbd6f0fff, 0xfffffe40, 0x81d7d70f,
+0x0000fffa, 0x8e850f00, 0xf2000002, 0xf2c9590f,
+0x688d110f, 0xf2fffffe, 0x688d5a0f, 0xf3fffffe,
+0xf3c9520f, 0x66c95a0f, 0x708d130f, 0xf2fffffe,
+0x708d5a0f, 0xf3fffffe, 0xf3c9530f, 0xf2c95a0f,
+0x89c12c0f, 0xfffe6485, 0x2a0ff2ff, 0xfffe648d,
+0xb8d231ff, 0x00000001, 0x8d2e0f66, 0xfffffe80,
+0x0474027a, 0xd231c031, 0x8589d8f7, 0xfffffe40,
+0xb800d283, 0x0000057c, 0x9589daf7, 0xfffffe44,
+0x40856f0f, 0x0ffffffe, 0xfa81d0d7, 0x000000ff,
+0x0203850f, 0x0ff20000, 0xfe70852c, 0x8589ffff,
+0xfffffe64, 0x8d5a0ff2, 0xfffffe80, 0xc9530ff3,
+0xc95a0ff3, 0xd12c0ff2, 0xfe64858b, 0x9589ffff,
+0xfffffe64, 0xfe64853b, 0x940fffff, 0x0fd231c0,
+0xd8f7c0b6, 0xfe408589, 0xd283ffff, 0x057eb800,
+0xdaf70000, 0xfe449589, 0x6f0fffff, 0xfffe408d,
+0xd1d70fff, 0x00fffa81, 0x850f0000, 0x00000199,
+0x8d100ff2, 0xfffffe80, 0xc9590ff2, 0x8d110ff2,
+0xfffffe68, 0x0ff2d231, 0xfe809510, 0x01b8ffff,
+0xf2000000, 0x688d510f, 0x66fffffe, 0x7aca2e0f,
+0x31047402, 0xf7d231c0, 0x408589d8, 0x83fffffe,
+0x9cb800d2, 0xf7000005, 0x449589da, 0x0ffffffe,
+0xfe40956f, 0xd70fffff, 0xfffa81d2, 0x0f000000,
+0x00013485, 0xc8280f00, 0x85110ff2, 0xfffffe70,
+0xca5e0ff2, 0x8d110ff2, 0xfffffe68, 0x01b8d231,
+0x66000000, 0x850b3a0f, 0xfffffe68, 0x110ff20b,
+0xfffe7885, 0x2e0f66ff, 0xfffe7085, 0x74027aff,
+0x31c03104, 0x89d8f7d2, 0xfffe4085, 0x00d283ff,
+0x0005a4b8, 0x89daf700, 0xfffe4495, 0x9d6f0fff,
+0xfffffe40, 0x81d3d70f, 0x0000fffa, 0xc6850f00,
+0xf2000000, 0x9085100f, 0xf2fffffe, 0x808d100f,
+0xf2fffffe, 0xf2c8590f, 0x8885590f, 0xf2fffffe,
+0x688d110f, 0xf2fffffe, 0x7085110f, 0xf2fffffe,
+0x6885100f, 0xf2fffffe, 0x70855f0f, 0xf2fffffe,
+0x7885110f, 0xf2fffffe, 0x6885100f, 0xf2fffffe,
+0x70855d0f, 0xf2fffffe, 0x7085110f, 0x31fffffe,
+0x100ff2d2, 0xfffe7085, 0x100ff2ff, 0xfffe808d,
+0x580ff2ff, 0xfffe7885, 0x580ff2ff, 0xfffe888d,
+0x590ff2ff, 0xfffe9085, 0x0001b8ff, 0x0f660000,
+0x027ac12e, 0xc0310474, 0xd8f7d231, 0xfe408589,
+0xd283ffff, 0x89daf700, 0xfffe4495, 0x0000baff,
+0x6f0f0000, 0xfffe40a5, 0xc4d70fff, 0x0000ff3d,
+0x063db800, 0x440f0000, 0x00c3c9c2, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x00000000,
+0003300,
+};
+asm(".type sse4_x86_32_D_f8, STT_NOTYPE;");
+asm(".type sse4_x86_32_D_f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_64_D_16i1[] = {
+0xb85500eb, 0x00000001, 0x000008be, 0x11b74000,
+0x41e58948, 0x41564157, 0x53544155, 0x10ec8348,
+0x488dfa89, 0x054488ff, 0x88c2298f, 0x899f0554,
+0x01e283ca, 0x1901fa83, 0x83c121d2, 0xcaff02e2,
+0x8301f983, 0x548800de, 0x8840af05, 0x48bf0574,
+0x8348c0ff, 0xc87511f8, 0x9075280f, 0x60b5290f,
+0x0fffffff, 0xff608d28, 0x0f66ffff, 0x39b8d276,
+0x0f000005, 0x0f66c128, 0x0f66c674, 0x0fc21738,
+0x0005a583, 0x45280f00, 0xfc0f6690, 0x85290fc1,
+0xffffff70, 0x9045280f, 0x00053fb8, 0xfc0f6600,
+0x740f66c0, 0xffff7085, 0x380f66ff, 0x830fc217,
+0x00000576, 0x7085280f, 0x66ffffff, 0x9045f80f,
+0x8045290f, 0x4d740f66, 0x0544b880, 0x0f660000,
+0x0fca1738, 0x00055183, 0x65280f00, 0x7d280f90,
+0xdb570fb0, 0x552d280f, 0x44000005, 0x0fc7280f,
+0x280fcc28, 0x0f4466c4, 0x0f66c760, 0x0f66cc60,
+0x0f66ff68, 0x4166c468, 0x66c8d50f, 0x0fc7d50f,
+0x540fcd54, 0x670f66c5, 0x45280fc8, 0x640f66c0,
+0xc1540fc3, 0x8045290f, 0x8a80458a, 0xc389c04d,
+0x817d8a44, 0x82558a44, 0x83758a44, 0x4d8ae3d3,
+0x7d8a40c1, 0x6d8a4484, 0x758a4085, 0x5c9d8886,
+0x41ffffff, 0x4d8ae7d3, 0x875d8ac2, 0x4488558a,
+0x4189658a, 0x4d8ae2d3, 0x4d8a44c3, 0x5d8a448a,
+0x0f45668d, 0xd341ea6e, 0xc44d8ae6, 0x3a0f4566,
+0xd301ee20, 0xc54d8ae7, 0x6e0f4466, 0xe5d341cf,
+0x66c64d8a, 0x203a0f45, 0xe6d301cd, 0x40c74d8a,
+0xff58b588, 0x8a40ffff, 0xe3d38c75, 0x88c84d8a,
+0xffff549d, 0x8b5d8aff, 0x4d8ae2d3, 0x509588c9,
+0x41ffffff, 0x4d8ae4d3, 0xe1d341ca, 0x66cb4d8a,
+0xd96e0f45, 0x4d8ae3d3, 0x0f4466cc, 0x01db203a,
+0x4d8ae6d3, 0x6e0f66cd, 0xe3d341f6, 0x44ce4d8a,
+0x668e458a, 0x5c9d6e0f, 0x8affffff, 0x44668f55,
+0x58a56e0f, 0x66ffffff, 0x50856e0f, 0x66ffffff,
+0x203a0f44, 0xffff54a5, 0xd34101ff, 0xcf4d8ae0,
+0x3a0f4166, 0x6601df20, 0x203a0f41, 0x456601c4,
+0x66d06e0f, 0xdd610f41, 0x610f4566, 0x66e2d3cc,
+0xc3610f41, 0x620f4166, 0x0f4166d9, 0x01f3203a,
+0x3a0f4466, 0x6601d220, 0xf2610f41, 0xc6620f66,
+0xd86c0f66, 0xe535280f, 0x0f000003, 0x66c04528,
+0x0fc6f80f, 0x8ac04529, 0x8a44c04d, 0x8a448255,
+0x8a40837d, 0xe0d38475, 0x44c14d8a, 0x4485758a,
+0x44864d8a, 0x88876d8a, 0xffff5c85, 0x81458aff,
+0x89658a44, 0x8a458a44, 0xd38b5d8a, 0xc24d8ae0,
+0x448c558a, 0x408d5d8a, 0x888e7d8a, 0xffff5885,
+0xe2d341ff, 0x8ac34d8a, 0x45668845, 0x41fa6e0f,
+0x4d8ae7d3, 0x0f4566c4, 0x01ff203a, 0x4d8ae6d3,
+0x0f4466c5, 0xd341de6e, 0xc64d8ae6, 0x3a0f4566,
+0x4101de20, 0x4d8ae1d3, 0x0f4566c7, 0xd341f16e,
+0xc84d8ae5, 0x3a0f4566, 0xd301f520, 0xc94d8ae0,
+0x610f4566, 0x548588de, 0x41ffffff, 0x4d8ae4d3,
+0xe0d341ca, 0x66cb4d8a, 0xe86e0f45, 0x4d8ae3d3,
+0x0f4466cc, 0x01eb203a, 0x4d8ae2d3, 0x0f4466cd,
+0xd341d26e, 0xce4d8ae3, 0x3a0f4566, 0xd301d320,
+0xcf4d8ae7, 0x668f458a, 0x5c856e0f, 0x66ffffff,
+0x8d6e0f44, 0xffffff54, 0x6e0f4466, 0x3a0f66e7,
+0xff588520, 0xd301ffff, 0x0f4566e0, 0x01cc203a,
+0x3a0f4466, 0x6601e020, 0xc7610f41, 0x610f4566,
+0x0621b8cd, 0x45660000, 0x66d4610f, 0xc3620f41,
+0x620f4566, 0x0f4166ca, 0x0f66c16c, 0x0f66c0fc,
+0x0f66c374, 0x0fc21738, 0x00026d83, 0x5d280f00,
+0x8d290fa0, 0xffffff60, 0x44c3280f, 0x66cb280f,
+0x66c3600f, 0xcb680f44, 0xd50f4166, 0x0f4466c0,
+0x540fcfd5, 0x540f44c5, 0x0f4166cd, 0x290fc167,
+0xffff7085, 0x85280fff, 0xffffff70, 0x3c380f66,
+0x380f66c1, 0xff708d38, 0x290fffff, 0xffff708d,
+0xfc0f66ff, 0xffff7085, 0x063db8ff, 0x280f0000,
+0x600f66c8, 0x680f66c8, 0x0f4166c0, 0x0f66c8d5,
+0x540fc7d5, 0xc5540fcd, 0xc8670f66, 0x66c4280f,
+0x66c3fc0f, 0x66c1740f, 0xc217380f, 0x01d8830f,
+0x0f660000, 0x60851c38, 0x66ffffff, 0xb8e0740f,
+0x00000644, 0x17380f66, 0xbb830fe2, 0x0f000001,
+0x0fb04528, 0x49b8ce28, 0x66000006, 0xc808380f,
+0xc8740f66, 0x17380f66, 0x9b830fca, 0x0f000001,
+0x0f904d28, 0x4eb8e328, 0x66000006, 0x66e6f80f,
+0xcc00380f, 0xcb740f66, 0x17380f66, 0x77830fca,
+0x0f000001, 0x0f66cb28, 0x0f904d60, 0x0f66e328,
+0x66906568, 0x44ccf80f, 0x0fc0280f, 0xa8b8f828,
+0x0f000006, 0x4466e128, 0x66c0600f, 0x66f8680f,
+0x66e1600f, 0x66c9680f, 0xe0d50f41, 0xcfd50f66,
+0x0fe5540f, 0x0f66cd54, 0x0f66e167, 0x015e2574,
+0x0f660000, 0x0fe21738, 0x00011d83, 0x4d280f00,
+0xe1280f90, 0xc9280f44, 0xe1600f66, 0x680f4466,
+0x0f4166c9, 0x4166e0d5, 0x0ff9d50f, 0x540fe554,
+0x670f66ef, 0xed570fe5, 0xe8640f66, 0x60a5290f,
+0x66ffffff, 0x0fe5600f, 0xff60bd28, 0x0f66ffff,
+0x66ff2038, 0xb8e7740f, 0x000006b3, 0x17380f66,
+0xc3830fe2, 0x66000000, 0x0fed600f, 0x0f66e528,
+0x280ffd60, 0xffff60ad, 0x380f66ff, 0x0f66ed21,
+0xbbb8fd74, 0x66000006, 0xfa17380f, 0x0098830f,
+0x0f660000, 0x0f66e460, 0x280fec60, 0xffff60bd,
+0x380f66ff, 0x280fe722, 0x65290ffc, 0x740f6680,
+0x06c4b8fd, 0x0f660000, 0x73fa1738, 0x8d290f6d,
+0xffffff70, 0x000001b8, 0x05548a00, 0x059488a0,
+0xffffff70, 0x02c08348, 0x11f88348, 0x570feb75,
+0x072ab8e4, 0x0f660000, 0x0f66c464, 0x66d91038,
+0x709d740f, 0x66ffffff, 0xda17380f, 0x280f2c73,
+0x66c031c1, 0xc10f3a0f, 0x0d540f01, 0x00000060,
+0xcefc0f66, 0xc8740f66, 0x17380f66, 0xc0920fca,
+0x1901f883, 0x074a25c0, 0x595a0000, 0x415c415b,
+0x415e415d, 0x00c35d5f, 0x00000000, 0x00000000,
+0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff,
+0x01010101, 0x01010101, 0x01010101, 0x01010101,
+0x08080808, 0x08080808, 0x08080808, 0x08080808,
+0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f,
+0003200,
+};
+asm(".type sse4_x86_64_D_16i1, STT_NOTYPE;");
+asm(".type sse4_x86_64_D_16i1, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_64_D_16u1[] = {
+0xb85500eb, 0x00000001, 0x000008b9, 0x11b74000,
+0x41e58948, 0x41564157, 0x53544155, 0x10ec8348,
+0x508dfe89, 0x054488ff, 0x40c6298f, 0x9f057488,
+0xc221d689, 0xff01e683, 0x01fa83ce, 0x4000d983,
+0xaf057488, 0xbf054c88, 0x48c0ff48, 0x7511f883,
+0x7d280fcf, 0xbd290f90, 0xffffff60, 0x6095280f,
+0x66ffffff, 0xb8c9760f, 0x00000539, 0x66c2280f,
+0x66c7740f, 0xc117380f, 0x04be830f, 0x280f0000,
+0x0f669045, 0x290fc2fc, 0xffff7085, 0x45280fff,
+0x053fb890, 0x0f660000, 0x0f66c0fc, 0xff708574,
+0x0f66ffff, 0x0fc11738, 0x00048f83, 0x85280f00,
+0xffffff70, 0x45f80f66, 0x45290f90, 0xda280f80,
+0x000544b8, 0x740f6600, 0x0f66805d, 0x0fd91738,
+0x00046783, 0x55560f00, 0x95290fa0, 0xffffff60,
+0xa045540f, 0x8055280f, 0xa055570f, 0x6085550f,
+0x66ffffff, 0xb8db760f, 0x00000550, 0xc2740f66,
+0x17380f66, 0x31830fc1, 0x0f000004, 0x280fd257,
+0x740f66c2, 0x0f66c045, 0x540fc274, 0x290f9045,
+0x458a8045, 0xc04d8a80, 0x8a44c389, 0x8a44817d,
+0x8a448255, 0xe3d38375, 0x40c14d8a, 0x44847d8a,
+0x8a856d8a, 0x9d888855, 0xffffff5c, 0x8ae7d341,
+0x5d8ac24d, 0x658a4486, 0x4d8a4489, 0xe2d3418a,
+0x40c34d8a, 0x448c758a, 0x668d5d8a, 0xca6e0f45,
+0x8ae6d341, 0x4566c44d, 0xce203a0f, 0x8ae7d301,
+0x0f66c54d, 0xd341ef6e, 0xc64d8ae5, 0x3a0f4166,
+0xd301ed20, 0xc74d8ae3, 0xff589d88, 0x5d8affff,
+0x8ae3d387, 0x9d88c84d, 0xffffff54, 0xd38b5d8a,
+0xc94d8ae2, 0xff509588, 0xd341ffff, 0xca4d8ae4,
+0x8ae1d341, 0x4166cb4d, 0xd3f96e0f, 0xcc4d8ae3,
+0x203a0f66, 0xe6d301fb, 0x66cd4d8a, 0x41e66e0f,
+0x4d8ae3d3, 0x458a44ce, 0x6e0f668e, 0xffff5c95,
+0x8f558aff, 0x6e0f4466, 0xffff5885, 0x6e0f66ff,
+0xffff5085, 0x0f4466ff, 0x5485203a, 0x01ffffff,
+0x8ae0d341, 0x4166cf4d, 0xd7203a0f, 0x0f416601,
+0x01c4203a, 0x6e0f4166, 0x0f4166f0, 0x01e3203a,
+0x610f4166, 0x66e2d3d1, 0xe8610f41, 0xc7610f66,
+0x203a0f66, 0x0f6601f2, 0x0f66d562, 0x0f66e661,
+0x0f66c462, 0x280fd06c, 0x0f66c045, 0x290fc3fc,
+0x4d8ac045, 0x558a44c0, 0x7d8a4482, 0x758a4083,
+0x8ae0d384, 0x8a44c14d, 0x8a448575, 0x8a44864d,
+0x8588876d, 0xffffff5c, 0x4481458a, 0x4489658a,
+0x8a8a458a, 0xe0d38b5d, 0x8ac24d8a, 0x8a448c55,
+0x8a408d5d, 0x85888e7d, 0xffffff58, 0x8ae2d341,
+0x458ac34d, 0x0f456688, 0xd341d26e, 0xc44d8ae7,
+0x3a0f4566, 0xd301d720, 0xc54d8ae6, 0x6e0f4466,
+0xe6d341c6, 0x66c64d8a, 0x203a0f45, 0xd34101c6,
+0xc74d8ae1, 0x6e0f4566, 0xe5d341c9, 0x66c84d8a,
+0x203a0f45, 0xe0d301cd, 0x66c94d8a, 0xc1610f45,
+0xff548588, 0xd341ffff, 0xca4d8ae4, 0x8ae0d341,
+0x4166cb4d, 0xd3f86e0f, 0xcc4d8ae3, 0x203a0f66,
+0xe2d301fb, 0x66cd4d8a, 0x41ea6e0f, 0x4d8ae3d3,
+0x0f4166ce, 0x01eb203a, 0x4d8ae7d3, 0x8f458acf,
+0x856e0f66, 0xffffff5c, 0xa56e0f66, 0xffffff54,
+0xf76e0f66, 0x203a0f66, 0xffff5885, 0xe0d301ff,
+0x3a0f4166, 0x6601e420, 0xf0203a0f, 0x0f416601,
+0x0f66c261, 0x21b8e761, 0x66000006, 0x66ee610f,
+0xc0620f41, 0xe5620f66, 0xc46c0f66, 0xc0fc0f66,
+0xc2740f66, 0x17380f66, 0x9d830fc1, 0x0f000001,
+0x0f905528, 0x66a04528, 0x0fc2da0f, 0x66a06528,
+0x66e2de0f, 0xa055fc0f, 0xc4fc0f66, 0x000634b8,
+0x740f6600, 0x380f66c2, 0x830fc117, 0x0000016c,
+0x792d280f, 0x0f000001, 0xb8b05528, 0x00000649,
+0x66c5280f, 0xc208380f, 0xc2740f66, 0x17380f66,
+0x45830fc1, 0x0f000001, 0x0fa06528, 0xb8904528,
+0x0000064e, 0x66f4280f, 0x66f3fc0f, 0xc600380f,
+0xc4740f66, 0x17380f66, 0x1d830fc1, 0x0f000001,
+0x0f66f428, 0x0f907560, 0x0f66c428, 0x66904568,
+0xb8c3fc0f, 0x000006a8, 0xc6f80f66, 0x0fc2570f,
+0x0f66d357, 0x0f66c2f8, 0x01120574, 0x0f660000,
+0x0fc11738, 0x0000e383, 0x380f6600, 0x66905d30,
+0xd330380f, 0x8055290f, 0x907d280f, 0x30380f66,
+0x740f66c7, 0x06d3b8c3, 0x0f660000, 0x0fc11738,
+0x0000b783, 0x7d280f00, 0x380f6690, 0x0f66c731,
+0xdab8c274, 0x66000006, 0xc117380f, 0x009a830f,
+0x280f0000, 0x0f66907d, 0x0fc73238, 0x290fd828,
+0xffff6085, 0x380f66ff, 0xe1b8d230, 0x66000006,
+0x66da740f, 0xd917380f, 0x280f7273, 0x01b89055,
+0x0f000000, 0xff709529, 0x548affff, 0x9488a005,
+0xffff7005, 0xc08348ff, 0xf8834802, 0x0feb7511,
+0x2ab8c057, 0x66000007, 0xb045640f, 0x10380f66,
+0x740f66e2, 0xffff70a5, 0x380f66ff, 0x2c73e117,
+0x31c2280f, 0x3a0f66c0, 0x0f01c20f, 0x004e1554,
+0x0f660000, 0x0f66d5fc, 0x0f66d074, 0x0fd11738,
+0xf883c092, 0x25c01901, 0x0000074a, 0x415b595a,
+0x415d415c, 0x5d5f415e, 0x000000c3, 0x00000000,
+0x01010101, 0x01010101, 0x01010101, 0x01010101,
+0x08080808, 0x08080808, 0x08080808, 0x08080808,
+0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f,
+0002600,
+};
+asm(".type sse4_x86_64_D_16u1, STT_NOTYPE;");
+asm(".type sse4_x86_64_D_16u1, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_64_D_16i2[] = {
+0xb85500eb, 0x00000001, 0x000010b9, 0x09b94100,
+0x48000000, 0x5641e589, 0x54415541, 0xec834853,
+0xff708d08, 0x66cf8944, 0x9e454489, 0xc729f289,
+0x6601e283, 0xae457c89, 0x1901fa83, 0x02e283d2,
+0xc685caff, 0xc6940f40, 0x45548966, 0xb60f40be,
+0x66f129f6, 0xce454c89, 0x48c0ff48, 0x7509f883,
+0x7d280fc0, 0xbd290fa0, 0xffffff70, 0x7085280f,
+0x66ffffff, 0xb8c9760f, 0x00000539, 0x66d0280f,
+0x66d7750f, 0xd117380f, 0x055c830f, 0x280f0000,
+0x0f66a055, 0x290fd0fd, 0x280f8055, 0x3fb8a055,
+0x66000005, 0x01f2710f, 0x55750f66, 0x380f6680,
+0x830fd117, 0x00000532, 0x8055280f, 0x55f90f66,
+0x55290fa0, 0xd0280f90, 0x000544b8, 0x750f6600,
+0x0f669055, 0x0fd11738, 0x00050d83, 0x55280f00,
+0xd50f66b0, 0x280fa045, 0xd50f66da, 0x55280fda,
+0x6d280fa0, 0xfd0f66b0, 0xe2280fea, 0x65f90f66,
+0xf90f66b0, 0x055bb8c3, 0x0f660000, 0x0f66e5d5,
+0x0f66c475, 0x0fc11738, 0x0004cd83, 0x45280f00,
+0xd50f66b0, 0x750f66c2, 0x0004d305, 0x05c8b800,
+0x0f660000, 0x0fc11738, 0x0004ad83, 0xda280f00,
+0x5de50f66, 0x65280fc0, 0xc0570fc0, 0x0005cfb8,
+0x650f6600, 0x750f66c4, 0x380f66c3, 0x830fc117,
+0x00000486, 0x66c4280f, 0x0fc2d50f, 0x0f904529,
+0x66905d28, 0x03f3710f, 0x709d290f, 0x0fffffff,
+0x66904528, 0x02f0710f, 0x8045290f, 0xc0fd0f66,
+0x0005edb8, 0x750f6600, 0x380f66c3, 0x830fc117,
+0x00000446, 0x7085280f, 0x66ffffff, 0x02e0710f,
+0xc0fd0f66, 0x0005f2b8, 0x750f6600, 0x0f668045,
+0x0fc11738, 0x00042183, 0x6c85c700, 0x03ffffff,
+0x0f000000, 0x0f66c228, 0x6348c4d5, 0xffff6c85,
+0xd8280fff, 0x6e0f4866, 0xf10f66f0, 0x6c85c7de,
+0x02ffffff, 0x48000000, 0xff6c8563, 0x4866ffff,
+0x66f86e0f, 0x0fc7f10f, 0x66804529, 0xb8c0fd0f,
+0x00000605, 0xc3750f66, 0x17380f66, 0xc7830fc1,
+0x48000003, 0xff6c8563, 0x4866ffff, 0x66f06e0f,
+0x0fdee10f, 0x0f66c328, 0x09b8c3fd, 0x66000006,
+0x8045750f, 0x17380f66, 0x9b830fc1, 0x0f000003,
+0x280fda28, 0x570fd045, 0xd50f66ff, 0x650f66dc,
+0xc3540fc7, 0x9045290f, 0x8b90458b, 0xc689d04d,
+0x6d8b4466, 0x947d8b92, 0x658b4466, 0x66e6d396,
+0x8bd24d8b, 0x89419855, 0x8b4466fa, 0x8b449a5d,
+0x0f669c4d, 0xd341ee6e, 0xd44d8be5, 0x66d08941,
+0x9e758b44, 0x66db8944, 0xedc40f41, 0xe2d34101,
+0xd64d8b66, 0x6e0f4166, 0xe4d341f2, 0x66d84d8b,
+0xf4c40f41, 0xe0d34101, 0xda4d8b66, 0xee620f66,
+0x6e0f4166, 0x8be3d3c0, 0x0f66dc4d, 0x4101c3c4,
+0x8b66e1d3, 0x4166de4d, 0x41d96e0f, 0x4166e6d3,
+0x01dec40f, 0xc3620f66, 0xe86c0f66, 0x0d35280f,
+0x0f000003, 0x66d04528, 0x0fc6f90f, 0x8bd04529,
+0x4466d04d, 0x6692458b, 0x964d8b44, 0xd39c758b,
+0x4d8b66e0, 0x5d8b66d2, 0x6e0f669e, 0x0621b8c0,
+0xd3410000, 0xd44d8be0, 0xc40f4166, 0xe7d301c0,
+0xd64d8b66, 0x6e0f4466, 0xe1d341cf, 0x66d84d8b,
+0xc9c40f45, 0x66e2d301, 0x66da4d8b, 0xc1620f41,
+0xda6e0f66, 0x8be3d341, 0x4166dc4d, 0x01dbc40f,
+0x8b66e6d3, 0x4466de4d, 0xd3c66e0f, 0x0f4466e3,
+0x6601c3c4, 0xd8620f41, 0xc36c0f66, 0xc0fd0f66,
+0xc5750f66, 0x17380f66, 0x4b830fc1, 0x0f000002,
+0x0fb04528, 0x0f66dc28, 0x0f66dad5, 0x290fc4d5,
+0x280f8045, 0x0f668045, 0x0f66c3ee, 0x0f805dea,
+0x66805d29, 0x8045fd0f, 0xb05d280f, 0x00063db8,
+0xd50f6600, 0xfd0f66c4, 0x750f66da, 0x380f66c3,
+0x830fc117, 0x00000202, 0xe2d50f66, 0x70a5290f,
+0x66ffffff, 0x851d380f, 0xffffff70, 0xd0750f66,
+0x000644b8, 0x380f6600, 0x830fd117, 0x000001da,
+0xc045280f, 0xb8d6280f, 0x00000649, 0x09380f66,
+0x750f66d0, 0x380f66d0, 0x830fd117, 0x000001ba,
+0x55700ff2, 0x280f1ba0, 0x4eb8b05d, 0xf3000006,
+0x1bd2700f, 0xd2700f66, 0x750f664e, 0x380f66d3,
+0x830fd117, 0x00000192, 0x66d3280f, 0xa055610f,
+0x5d690f66, 0xf90f66a0, 0x06a8b8d3, 0x0f660000,
+0x0f66d0d5, 0x01a61575, 0x0f660000, 0x0fd11738,
+0x00016583, 0x55280f00, 0xe7280fa0, 0xe0650f66,
+0xd0d50f66, 0x0fda280f, 0xff709529, 0x0f66ffff,
+0x280fdc61, 0xffff70ad, 0x380f66ff, 0x0f66d523,
+0xb3b8da75, 0x66000006, 0xd917380f, 0x0128830f,
+0x0f660000, 0x0f66e461, 0x280fd461, 0xffff70ad,
+0x380f66ff, 0x0f66dd24, 0xbbb8d375, 0x66000006,
+0xd117380f, 0x0100830f, 0x280f0000, 0x8b66a055,
+0x0f66b245, 0x280fc765, 0x290fb07d, 0x89668055,
+0x8b668245, 0x0f66b645, 0x0ffa1038, 0x8966c728,
+0x8b668645, 0x8966ba45, 0x8b668a45, 0x8966be45,
+0x280f8e45, 0x2ab88055, 0x66000007, 0x66c2750f,
+0xc117380f, 0x00b0830f, 0x280f0000, 0x3ab8a045,
+0x0f000007, 0x0f66d828, 0xb05d0e3a, 0x750f66aa,
+0x380f66d3, 0x830fd117, 0x0000008e, 0xcd1d280f,
+0x0f000000, 0x4ab8d028, 0x66000007, 0xd00f3a0f,
+0xd8540f02, 0xdefd0f66, 0xd3750f66, 0x17380f66,
+0x0f6773d1, 0xff708529, 0x03b8ffff, 0x0f000000,
+0x280fd257, 0x380f66c2, 0xff708501, 0x290fffff,
+0xffff7085, 0x75c8ffff, 0xc50f66e9, 0x5eb807d0,
+0x66000007, 0x7524fa83, 0x45280f31, 0x380f66a0,
+0x31b04505, 0x380f66c0, 0x0f66c201, 0x66c20138,
+0xc201380f, 0xc2750f66, 0x17380f66, 0xc0920fc1,
+0x1901f883, 0x076725c0, 0x5b5a0000, 0x5d415c41,
+0xc35d5e41, 0x00000000, 0x00000000, 0x00000000,
+0x000e0008, 0x00140012, 0x00120014, 0x0008000e,
+0x00010001, 0x00010001, 0x00010001, 0x00010001,
+0x00040004, 0x00040004, 0x00040004, 0x00040004,
+0x00070007, 0x00070007, 0x00070007, 0x00070007,
+0003100,
+};
+asm(".type sse4_x86_64_D_16i2, STT_NOTYPE;");
+asm(".type sse4_x86_64_D_16i2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_64_D_16u2[] = {
+0xb85500eb, 0x00000001, 0x000010ba, 0x09b94100,
+0x48000000, 0x5641e589, 0x54415541, 0xec834853,
+0xff708d08, 0x66cf8944, 0x9e454489, 0xc729f189,
+0x6601e183, 0xae457c89, 0xc685c9ff, 0xc6940f40,
+0x454c8966, 0xb60f40be, 0x66f229f6, 0xce455489,
+0x48c0ff48, 0x7509f883, 0x7d280fc8, 0xbd290fa0,
+0xffffff70, 0x7095280f, 0x66ffffff, 0xb8c9760f,
+0x00000539, 0x66c2280f, 0x66c7750f, 0xc117380f,
+0x04e8830f, 0x280f0000, 0x0f66a045, 0x290fc2fd,
+0x280f8045, 0x3fb8a045, 0x66000005, 0x01f0710f,
+0x45750f66, 0x380f6680, 0x830fc117, 0x000004be,
+0x8045280f, 0x45f90f66, 0x45290fa0, 0xda280f90,
+0x000544b8, 0x750f6600, 0x0f66905d, 0x0fd91738,
+0x00049983, 0x55560f00, 0x95290fb0, 0xffffff70,
+0xb045540f, 0x9055280f, 0xb055570f, 0x7085550f,
+0x66ffffff, 0xb8e4760f, 0x00000550, 0xc2750f66,
+0x17380f66, 0x63830fc1, 0x0f000004, 0x0fa05528,
+0x66b04528, 0x66c2d50f, 0x6105750f, 0xb8000004,
+0x000005c8, 0x17380f66, 0x3f830fc1, 0x0f000004,
+0x0f66ea28, 0x0fc06de4, 0x0fc05d28, 0xd1b8c228,
+0x0f000005, 0x0f66c354, 0x0f66c3fd, 0x0f66c575,
+0x0fc11738, 0x00041583, 0x55290f00, 0x5d280f90,
+0x710f6690, 0x290f03f3, 0xffff709d, 0x45280fff,
+0x710f6690, 0x290f02f0, 0x0f668045, 0xedb8c0fd,
+0x66000005, 0x66c3750f, 0xc117380f, 0x03dc830f,
+0x280f0000, 0xffff7085, 0x710f66ff, 0x0f6602d0,
+0xf2b8c0fd, 0x66000005, 0x8045750f, 0x17380f66,
+0xb7830fc1, 0xc7000003, 0xffff6c85, 0x000003ff,
+0x6e0f6600, 0xffff6c9d, 0xc2280fff, 0xc3f10f66,
+0xff6c85c7, 0x0002ffff, 0x0f660000, 0xff6cad6e,
+0x280fffff, 0xf10f66da, 0x5d290fdd, 0xfd0f6680,
+0x0605b8db, 0x0f660000, 0x0f66d875, 0x0fd91738,
+0x00036983, 0x6e0f6600, 0xffff6c9d, 0xd10f66ff,
+0xfd0f66c3, 0x0609b8c0, 0x0f660000, 0x66804575,
+0xc117380f, 0x0344830f, 0x570f0000, 0xc3280fdb,
+0x45750f66, 0x750f66d0, 0xc2540fc3, 0x9045290f,
+0x8b90458b, 0xc689d04d, 0x6d8b4466, 0x947d8b92,
+0x658b4466, 0x66e6d396, 0x8bd24d8b, 0x89419855,
+0x8b4466fa, 0x8b449a5d, 0x0f669c4d, 0xd341ee6e,
+0xd44d8be5, 0x66d08941, 0x9e758b44, 0x66db8944,
+0xedc40f41, 0xe2d34101, 0xd64d8b66, 0x6e0f4166,
+0xe4d341f2, 0x66d84d8b, 0xf4c40f41, 0xe0d34101,
+0xda4d8b66, 0xee620f66, 0x6e0f4166, 0x8be3d3c0,
+0x0f66dc4d, 0x4101c3c4, 0x8b66e1d3, 0x4166de4d,
+0x41d96e0f, 0x4166e6d3, 0x01dec40f, 0xc3620f66,
+0xe86c0f66, 0xd045280f, 0xc4fd0f66, 0xd045290f,
+0x66d04d8b, 0x92458b44, 0x4d8b4466, 0x9c758b96,
+0x8b66e0d3, 0x8b66d24d, 0x0f669e5d, 0x21b8c06e,
+0x41000006, 0x4d8be0d3, 0x0f4166d4, 0xd301c0c4,
+0x4d8b66e7, 0x6e0f66d6, 0xe1d341ff, 0x66d84d8b,
+0xf9c40f41, 0x66e2d301, 0x66da4d8b, 0x66c7620f,
+0x41da6e0f, 0x4d8be3d3, 0x0f4166dc, 0xd301dbc4,
+0x4d8b66e6, 0x6e0f66de, 0x66e3d3f6, 0x01f3c40f,
+0xde620f66, 0xc36c0f66, 0xc0fd0f66, 0xc5750f66,
+0x17380f66, 0x03830fc1, 0x0f000002, 0x66b04528,
+0xc23a380f, 0xb05d280f, 0x3e380f66, 0xfd0f66da,
+0x0f66b055, 0x34b8c3fd, 0x66000006, 0x66c2750f,
+0xc117380f, 0x01d4830f, 0x280f0000, 0x0001ef2d,
+0x5d280f00, 0x0649b8c0, 0x280f0000, 0x380f66c5,
+0x0f66c309, 0x0f66c375, 0x0fc11738, 0x0001ad83,
+0x700ff200, 0x0f1ba055, 0xb8b04528, 0x0000064e,
+0xd2700ff3, 0x700f661b, 0x0f664ed2, 0x0f66d075,
+0x0fd11738, 0x00018583, 0xd0280f00, 0x55610f66,
+0x690f66a0, 0x0f66a045, 0xa8b8c4fd, 0x66000006,
+0x0fc2f90f, 0x570fc357, 0xf90f66dc, 0x750f66c3,
+0x00018b05, 0x380f6600, 0x830fc117, 0x0000014e,
+0x33380f66, 0x0f66a055, 0x0fc23338, 0x0f904529,
+0x66a07d28, 0xc733380f, 0xc2750f66, 0x0006d3b8,
+0x380f6600, 0x830fc117, 0x00000122, 0xa065280f,
+0x34380f66, 0x750f66c4, 0xdab89045, 0x66000006,
+0xc117380f, 0x0104830f, 0x280f0000, 0x8b66a055,
+0x570fb245, 0x640f66c0, 0x280fc045, 0x290fb065,
+0x89668055, 0x8b668245, 0x0f66b645, 0x66e21038,
+0x66864589, 0x0fba458b, 0x8966c428, 0x8b668a45,
+0x8966be45, 0x280f8e45, 0x2ab88055, 0x66000007,
+0x66c2750f, 0xc117380f, 0x00b0830f, 0x280f0000,
+0x3ab8a045, 0x0f000007, 0x0f66d828, 0xb05d0e3a,
+0x750f66aa, 0x380f66d3, 0x830fd117, 0x0000008e,
+0xc91d280f, 0x0f000000, 0x4ab8d028, 0x66000007,
+0xd00f3a0f, 0xd8540f02, 0xddfd0f66, 0xd3750f66,
+0x17380f66, 0x0f6773d1, 0xff708529, 0x03b8ffff,
+0x0f000000, 0x280fd257, 0x380f66c2, 0xff708501,
+0x290fffff, 0xffff7085, 0x75c8ffff, 0xc50f66e9,
+0x5eb807d0, 0x66000007, 0x7524fa83, 0x45280f31,
+0x380f66a0, 0x31b04505, 0x380f66c0, 0x0f66c201,
+0x66c20138, 0xc201380f, 0xc2750f66, 0x17380f66,
+0xc0920fc1, 0x1901f883, 0x076725c0, 0x5b5a0000,
+0x5d415c41, 0xc35d5e41, 0x00000000, 0x00000000,
+0x000e0008, 0x00140012, 0x00120014, 0x0008000e,
+0x00010001, 0x00010001, 0x00010001, 0x00010001,
+0x00040004, 0x00040004, 0x00040004, 0x00040004,
+0x00070007, 0x00070007, 0x00070007, 0x00070007,
+0002700,
+};
+asm(".type sse4_x86_64_D_16u2, STT_NOTYPE;");
+asm(".type sse4_x86_64_D_16u2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_64_D_16i4[] = {
+0xb85500eb, 0x00000001, 0x000020b9, 0x05b94100,
+0x48000000, 0x8348e589, 0x788d08ec, 0xc88945ff,
+0xbc854489, 0x2941fa89, 0x01e283c0, 0x85448944,
+0x01fa83cc, 0xe283d219, 0x85caff02, 0x940f40f8,
+0x855489c7, 0xb60f40dc, 0x89f929ff, 0x48ec854c,
+0x8348c0ff, 0xc27505f8, 0xc07d280f, 0x907d290f,
+0x9045280f, 0xc9760f66, 0x000539b8, 0xd0280f00,
+0xd7760f66, 0x17380f66, 0x7f830fd1, 0x0f000004,
+0x66c05528, 0x0fd0fe0f, 0x0fa05529, 0xb8c05528,
+0x0000053f, 0xf2720f66, 0x760f6601, 0x0f66a055,
+0x0fd11738, 0x00045583, 0x55280f00, 0xfa0f66a0,
+0x290fc055, 0x280fb055, 0x0544b8d0, 0x0f660000,
+0x66b05576, 0xd117380f, 0x0430830f, 0x280f0000,
+0x0f66d055, 0xc0454038, 0x66da280f, 0xda40380f,
+0xc055280f, 0xd06d280f, 0xeafe0f66, 0x66e2280f,
+0xd065fa0f, 0xc3fa0f66, 0x00055bb8, 0x380f6600,
+0x0f66e540, 0x0f66c476, 0x0fc11738, 0x0003ed83,
+0x45280f00, 0x380f66d0, 0x0f66c240, 0x03de0576,
+0xc8b80000, 0x66000005, 0xc117380f, 0x03cc830f,
+0x280f0000, 0x570fe045, 0x7e0f66c2, 0x45290fc0,
+0x380f6690, 0x48d04528, 0x48d05563, 0xaf0f4898,
+0x556348c2, 0x458948d8, 0x456348b0, 0xaf0f4898,
+0x458948c2, 0x05e1b8b8, 0x0f660000, 0x66b04576,
+0xc117380f, 0x0384830f, 0x280f0000, 0x0f66e045,
+0x0fc24038, 0x0fb04529, 0x66b06528, 0x03f4720f,
+0x9065290f, 0xb05d280f, 0xf3720f66, 0x5d290f02,
+0xfe0f66a0, 0x05edb8db, 0x0f660000, 0x0f66dc76,
+0x0fd91738, 0x00034583, 0x5d280f00, 0x720f6690,
+0x0f6602e3, 0xf2b8dbfe, 0x66000005, 0xa05d760f,
+0x17380f66, 0x23830fd9, 0xc7000003, 0x00038c45,
+0x63480000, 0x280f8c45, 0x0f4866d8, 0x0f66f86e,
+0x45c7dff2, 0x0000028c, 0x45634800, 0x0f48668c,
+0x0f66f86e, 0x290fc7f2, 0x0f66a045, 0x05b8c0fe,
+0x66000006, 0x66c3760f, 0xc117380f, 0x02dc830f,
+0x63480000, 0x48668c45, 0x66f86e0f, 0x0fdfe20f,
+0x0f66c328, 0x09b8c3fe, 0x66000006, 0xa045760f,
+0x17380f66, 0xb3830fc1, 0x0f000002, 0x0fe05d28,
+0x0ff04528, 0x0f66e457, 0x66da4038, 0x0fc4660f,
+0x0f66c354, 0x290fc07e, 0x4d8bb045, 0x8bc689f0,
+0x7d8bb855, 0x8be6d3bc, 0x8941f44d, 0x6e0f66d0,
+0xb4758bee, 0x41fa8941, 0xd341f189, 0xf84d8be1,
+0x3a0f4166, 0x4101e922, 0x4d8be0d3, 0x0f4166fc,
+0xd341c06e, 0x0f4166e2, 0x01c2223a, 0xe86c0f66,
+0x591d280f, 0x0f000002, 0x66f04528, 0x0fc3fa0f,
+0x8bf04529, 0xe0d3f04d, 0x66f44d8b, 0xb8c06e0f,
+0x00000621, 0x4d8be6d3, 0x3a0f66f8, 0xd301c622,
+0xfc4d8be2, 0xf26e0f66, 0x0f66e7d3, 0x01f7223a,
+0xc66c0f66, 0xc0fe0f66, 0xc5760f66, 0x17380f66,
+0xf7830fc1, 0x0f000001, 0x0fe06d28, 0x66d04528,
+0xc540380f, 0x66f5280f, 0xf240380f, 0xa045290f,
+0xa045280f, 0x3d380f66, 0x380f66c6, 0x0fa07539,
+0x66a07529, 0xa045fe0f, 0xd075280f, 0x00063db8,
+0x380f6600, 0x0f66c540, 0x0f66f2fe, 0x0f66c676,
+0x0fc11738, 0x0001a583, 0x380f6600, 0x290fea40,
+0x0f66906d, 0x90451e38, 0xd0760f66, 0x000644b8,
+0x380f6600, 0x830fd117, 0x00000182, 0xe045280f,
+0xb8d3280f, 0x00000649, 0x0a380f66, 0x760f66d0,
+0x380f66d0, 0x830fd117, 0x00000162, 0xd06d280f,
+0x55700f66, 0x4eb81bc0, 0x66000006, 0x66d5760f,
+0xd117380f, 0x0144830f, 0x280f0000, 0x620f66d5,
+0x0f66c055, 0x66c06d6a, 0xb8d5fa0f, 0x000006a8,
+0x40380f66, 0x760f66d0, 0x00014315, 0x380f6600,
+0x830fd117, 0x00000116, 0xc055280f, 0x66f4280f,
+0x66f0660f, 0xd040380f, 0x0fea280f, 0x66905529,
+0x0fee620f, 0x66907d28, 0xd725380f, 0xd5760f66,
+0x0006b3b8, 0x380f6600, 0x830fd117, 0x000000de,
+0xc055280f, 0x66d4458b, 0x0fc4660f, 0x0fd07d28,
+0x89a05529, 0x458ba445, 0x380f66dc, 0x280ffa10,
+0xac4589c7, 0xa055280f, 0x00072ab8, 0x760f6600,
+0x380f66c2, 0x830fc117, 0x000000a2, 0xc045280f,
+0x00073ab8, 0xe0280f00, 0x0e3a0f66, 0x66ccd065,
+0x66d4760f, 0xd117380f, 0x0080830f, 0x280f0000,
+0x0000ab15, 0x074ab800, 0x540f0000, 0xfe0f66d0,
+0xd0280fda, 0x0f3a0f66, 0x0f6604d0, 0x0f66d376,
+0x73d11738, 0x45290f59, 0xd2570f90, 0x66c2280f,
+0x4502380f, 0x45290f90, 0xc2280f90, 0x02380f66,
+0x5eb89045, 0x66000007, 0xc2163a0f, 0x0afa8303,
+0x280f2c75, 0x0f66c045, 0xd0450638, 0x0f66c031,
+0x66c20238, 0xc202380f, 0xc2760f66, 0x17380f66,
+0xc0920fc1, 0x1901f883, 0x076725c0, 0xc3c90000,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x00000002, 0x00000002, 0x00000002, 0x00000002,
+0x00000003, 0x00000003, 0x00000003, 0x00000003,
+0002500,
+};
+asm(".type sse4_x86_64_D_16i4, STT_NOTYPE;");
+asm(".type sse4_x86_64_D_16i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_64_D_16u4[] = {
+0x315500eb, 0x0020bac0, 0xb9410000, 0x00000004,
+0x48e58948, 0x8908ec83, 0x01708dc1, 0x45cf8944,
+0xe183c031, 0x89c72901, 0xffc08574, 0x89c685c9,
+0x41d0857c, 0x89c0940f, 0x44e0854c, 0x5489c229,
+0xff48f085, 0xf88348c0, 0x0fcc7504, 0x0fc07d28,
+0x0f907d29, 0x66905528, 0xb8c9760f, 0x00000539,
+0x66c2280f, 0x66c7760f, 0xc117380f, 0x03fb830f,
+0x280f0000, 0x0f66c045, 0x290fc2fe, 0x280fa045,
+0x3fb8c045, 0x66000005, 0x01f0720f, 0x45760f66,
+0x380f66a0, 0x830fc117, 0x000003d1, 0xa045280f,
+0x45fa0f66, 0x45290fc0, 0xda280fb0, 0x000544b8,
+0x760f6600, 0x0f66b05d, 0x0fd91738, 0x0003ac83,
+0x55560f00, 0x55290fd0, 0x45540f90, 0x55280fd0,
+0x55570fb0, 0x45550fd0, 0x760f6690, 0x0550b8e4,
+0x0f660000, 0x0f66c276, 0x0fc11738, 0x00037c83,
+0x5d280f00, 0x45280fc0, 0x380f66d0, 0x0f66c340,
+0x036a0576, 0xc8b80000, 0x66000005, 0xc117380f,
+0x0357830f, 0x280f0000, 0x570fe045, 0x7e0f66c3,
+0x45290fc0, 0xf40f6690, 0x558bd045, 0xaf0f48d0,
+0xd8558bc2, 0xb0458948, 0x4898458b, 0x48c2af0f,
+0xb8b84589, 0x000005e1, 0x45760f66, 0x380f66b0,
+0x830fc117, 0x00000315, 0xb05d290f, 0xb055280f,
+0xf2720f66, 0x55290f03, 0x45280f90, 0x720f66b0,
+0x290f02f0, 0x0f66a045, 0xedb8c0fe, 0x66000005,
+0x66c2760f, 0xc117380f, 0x02df830f, 0x280f0000,
+0x0f669045, 0x6602d072, 0xb8c0fe0f, 0x000005f2,
+0x45760f66, 0x380f66a0, 0x830fc117, 0x000002bd,
+0x038c45c7, 0x66000000, 0x8c556e0f, 0x66c3280f,
+0xc7c2f20f, 0x00028c45, 0x0f660000, 0x0f8c6d6e,
+0x0f66d328, 0x290fd5f2, 0x0f66a055, 0x05b8d2fe,
+0x66000006, 0x66d0760f, 0xd117380f, 0x027b830f,
+0x0f660000, 0x668c556e, 0x66c2d20f, 0xb8c0fe0f,
+0x00000609, 0x45760f66, 0x380f66a0, 0x830fc117,
+0x00000259, 0x0fd2570f, 0x0f66c228, 0x66f04576,
+0x0fc2760f, 0x0f66c354, 0x290fc07e, 0x4d8bb045,
+0x8bc689f0, 0x7d8bb855, 0x8be6d3bc, 0x8941f44d,
+0x6e0f66d0, 0xb4758bee, 0x41fa8941, 0xd341f189,
+0xf84d8be1, 0x3a0f4166, 0x4101e922, 0x4d8be0d3,
+0x0f4166fc, 0xd341c06e, 0x0f4166e2, 0x01c2223a,
+0xe86c0f66, 0xf045280f, 0xc4fe0f66, 0xf045290f,
+0xd3f04d8b, 0xf44d8be0, 0xc06e0f66, 0x000621b8,
+0x8be6d300, 0x0f66f84d, 0x01c6223a, 0x4d8be2d3,
+0x6e0f66fc, 0x66e7d3f2, 0xf7223a0f, 0x6c0f6601,
+0xfe0f66c6, 0x760f66c0, 0x380f66c5, 0x830fc117,
+0x000001a9, 0xd045280f, 0x3b380f66, 0x6d280fc3,
+0x380f66d0, 0x0f66eb3f, 0x66d05dfe, 0xb8c5fe0f,
+0x00000634, 0xc3760f66, 0x17380f66, 0x7a830fc1,
+0x0f000001, 0x01862d28, 0x280f0000, 0x49b8e05d,
+0x0f000006, 0x0f66c528, 0x66c30a38, 0x66c3760f,
+0xc117380f, 0x0153830f, 0x280f0000, 0x0f66d045,
+0x1bc07570, 0x00064eb8, 0x760f6600, 0x380f66f0,
+0x830ff117, 0x00000135, 0x66f0280f, 0xc075620f,
+0x456a0f66, 0xfe0f66c0, 0x06a8b8c4, 0x0f660000,
+0x570fc6fa, 0xdc570fc3, 0xc3fa0f66, 0x05760f66,
+0x0000012c, 0x17380f66, 0xfe830fc1, 0x66000000,
+0x5d35380f, 0x7d280fc0, 0x380f66c0, 0x0f66c735,
+0xd3b8c376, 0x66000006, 0xc117380f, 0x00db830f,
+0x280f0000, 0x458bc05d, 0xc0570fd4, 0x45640f66,
+0x7d280fe0, 0x5d290fd0, 0xa44589a0, 0x66dc458b,
+0xfb10380f, 0x0fac4589, 0x0fa05d28, 0x2ab8c728,
+0x66000007, 0x66c3760f, 0xc117380f, 0x009b830f,
+0x280f0000, 0x3ab8c045, 0x0f000007, 0x0f66e028,
+0xd0650e3a, 0x760f66cc, 0x380f66dc, 0x7d73d917,
+0xa925280f, 0x0f000000, 0x4ab8d828, 0x66000007,
+0xd80f3a0f, 0xe0540f04, 0xe5fe0f66, 0xdc760f66,
+0x17380f66, 0x0f5673d9, 0x0f904529, 0x0f66c228,
+0x90450238, 0x9045290f, 0x02380f66, 0x5eb89055,
+0x66000007, 0xd2163a0f, 0x0afa8303, 0x280f2f75,
+0x0f66c045, 0xd0450638, 0x31d2570f, 0x380f66c0,
+0x0f66c202, 0x66c20238, 0x66c2760f, 0xc117380f,
+0x83c0920f, 0xc01901f8, 0x00076725, 0x00c3c900,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x00000002, 0x00000002, 0x00000002, 0x00000002,
+0x00000003, 0x00000003, 0x00000003, 0x00000003,
+0002260,
+};
+asm(".type sse4_x86_64_D_16u4, STT_NOTYPE;");
+asm(".type sse4_x86_64_D_16u4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_64_D_16i8[] = {
+0x485500eb, 0xc748e589, 0x0001d045, 0xc7480000,
+0x0002e045, 0xc7480000, 0x003ff045, 0xc7480000,
+0x0002d845, 0xc7480000, 0x0001e845, 0xc7480000,
+0x003ef845, 0x280f0000, 0x290fd04d, 0x280fa04d,
+0x39b8a05d, 0x0f000005, 0x0f66c328, 0x66c12938,
+0x66c9760f, 0xc117380f, 0x0401830f, 0x280f0000,
+0x0f66d045, 0x290fc3d4, 0x280fb045, 0x3fb8d045,
+0x66000005, 0x01f0730f, 0x29380f66, 0x0f66b045,
+0x0fc11738, 0x0003d683, 0x45280f00, 0xfb0f66b0,
+0x290fd045, 0x280fc045, 0x0544b8c3, 0x0f660000,
+0xc0452938, 0x17380f66, 0xb0830fc1, 0x0f000003,
+0x0fd06d28, 0x280fd328, 0x730f66c3, 0x0f6620d2,
+0x0f66d5f4, 0x280fc5f4, 0x730f66e5, 0x0f6620d4,
+0x0f66dcf4, 0x280fd3d4, 0x730f66d8, 0x0f6620f2,
+0x280fdad4, 0x280fe055, 0xea280fc2, 0xd0730f66,
+0xf40f6620, 0xf40f66ea, 0xd40f66c2, 0x730f66c0,
+0x0f6620f0, 0x280fe8d4, 0x0f44d055, 0x66e04528,
+0xc2d40f44, 0x41fa280f, 0x66f0280f, 0xb8ddfb0f,
+0x0000055b, 0x7dfb0f66, 0x730f66e0, 0x280f20d6,
+0xf40f66c7, 0xe7280ff7, 0xd0730f66, 0x0f416620,
+0x4166e0f4, 0x66c0f40f, 0x66c6d40f, 0x20f0730f,
+0xe0d40f66, 0x66c3280f, 0xc429380f, 0x17380f66,
+0xf8830fc1, 0x0f000002, 0x0fe04528, 0x280ffa28,
+0x730f66da, 0x280f20d7, 0xf40f66e0, 0x730f66d8,
+0x0f6620d4, 0x0f66c7f4, 0x0f66e2f4, 0x0f66c4d4,
+0x6620f073, 0x66c3d40f, 0x0529380f, 0x000002d0,
+0x0005c8b8, 0x380f6600, 0x830fc117, 0x000002af,
+0xd905280f, 0x0f000002, 0x280fdf28, 0xf40f66f2,
+0xf40f66d8, 0xe8280ff0, 0xd5730f66, 0xf40f6620,
+0xd40f66d5, 0x730f66da, 0x0f6620f3, 0x290fded4,
+0x280fc05d, 0x0f66c065, 0x0f03f473, 0x0fa06529,
+0x66c05d28, 0x02f3730f, 0xb05d290f, 0xdbd40f66,
+0xf8f40f66, 0x0005edb8, 0x380f6600, 0x0f66dc29,
+0x0fd91738, 0x00024683, 0x65280f00, 0xdc280fa0,
+0xe4720f66, 0x730f6602, 0x0f6602d3, 0xccdc0e3a,
+0xdbd40f66, 0x0005f2b8, 0x380f6600, 0x66b05d29,
+0xd917380f, 0x0215830f, 0x280f0000, 0x9c45c7df,
+0x00000003, 0xdad40f66, 0xf3730f66, 0xd40f6620,
+0x456348de, 0xe3280f9c, 0x6e0f4c66, 0x0f4166c8,
+0x45c7e1f3, 0x0000029c, 0x45634800, 0x0f4c669c,
+0x4166d06e, 0x0fdaf30f, 0x66b05d29, 0xb8dbd40f,
+0x00000605, 0x29380f66, 0x380f66dc, 0x830fd917,
+0x000001bb, 0xc0570f45, 0x9c556348, 0x000040b8,
+0x280f4100, 0x380f66d8, 0x2948dc37, 0x0f4c66d0,
+0x4c66da6e, 0x66e06e0f, 0xe3d30f41, 0xf30f4166,
+0xe3560fdc, 0xe4d40f66, 0x000609b8, 0x380f6600,
+0x66b06529, 0xe117380f, 0x0171830f, 0x0f660000,
+0x0f66d7d4, 0x6620f273, 0x0ff2d40f, 0x66f05528,
+0x37380f41, 0xf2540fd0, 0x7e0f4866, 0x75290ff0,
+0x4d8b48c0, 0x558b48f0, 0xc68948c8, 0x48e6d348,
+0x48f84d8b, 0x4866d789, 0x48e66e0f, 0x4866e7d3,
+0xe7223a0f, 0x1d280f01, 0x00000144, 0xf055280f,
+0xd3fb0f66, 0xf055290f, 0xf04d8b48, 0x48e0d348,
+0x66f84d8b, 0xd06e0f48, 0x000621b8, 0xe2d34800,
+0x3a0f4866, 0x6601d222, 0x66d2d40f, 0xd429380f,
+0x17380f66, 0xe4830fd1, 0x0f000000, 0x66e05528,
+0xd065700f, 0x064eb84e, 0x0f660000, 0x66e22938,
+0xe117380f, 0x00c5830f, 0x280f0000, 0x6c0f66f2,
+0x0f66d075, 0x66d0556d, 0xb8f2fb0f, 0x000006a8,
+0x66d6280f, 0x0feef40f, 0x0f66e628, 0x6620d273,
+0x66e0f40f, 0x66d0f40f, 0x66d5d40f, 0x20f2730f,
+0xd4d40f66, 0x29380f66, 0x380f66d3, 0x7f73d117,
+0x380f4166, 0x280fc037, 0x8b48d055, 0x280fe845,
+0x290fe07d, 0x0f66b055, 0x48fa1038, 0x0fb84589,
+0xb8b05528, 0x0000072a, 0x66c7280f, 0xc229380f,
+0x17380f66, 0x0f4873c1, 0xb8d04528, 0x0000073a,
+0x66e0280f, 0x650e3a0f, 0x0f66f0e0, 0x66d42938,
+0xd117380f, 0x280f2973, 0x66c031d0, 0xd00f3a0f,
+0xc3540f08, 0xc3d40f66, 0x29380f66, 0x380f66c2,
+0x920fc117, 0x01f883c0, 0x4a25c019, 0x5d000007,
+0x000000c3, 0x00000000, 0x00000000, 0x00000000,
+0x00000002, 0x00000000, 0x00000002, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0x00000001, 0x00000000, 0xffffffff, 0xffffffff,
+0002240,
+};
+asm(".type sse4_x86_64_D_16i8, STT_NOTYPE;");
+asm(".type sse4_x86_64_D_16i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_64_D_16u8[] = {
+0x485500eb, 0xc748e589, 0x0001d045, 0xc7480000,
+0x0002e045, 0xc7480000, 0x003ff045, 0xc7480000,
+0x0002d845, 0xc7480000, 0x0001e845, 0xc7480000,
+0x003ef845, 0x280f0000, 0x290fd07d, 0x280fa07d,
+0x0f66a055, 0x39b8c976, 0x0f000005, 0x0f66c228,
+0x66c72938, 0xc117380f, 0x02e8830f, 0x280f0000,
+0x0f66d045, 0x290fc2d4, 0x280fb045, 0x3fb8d045,
+0x66000005, 0x01f0730f, 0x29380f66, 0x0f66b045,
+0x0fc11738, 0x0002bd83, 0x45280f00, 0xfb0f66b0,
+0x290fd045, 0x280fc045, 0x0544b8da, 0x0f660000,
+0xc05d2938, 0x17380f66, 0x97830fd9, 0x0f000002,
+0x0fe05556, 0x0fa05529, 0x0fe04554, 0x0fc05528,
+0x0fe05557, 0x540fc157, 0x50b8a045, 0x66000005,
+0xc229380f, 0x17380f66, 0x67830fc1, 0x0f000002,
+0x0fd04528, 0x0fe06d28, 0x280fd028, 0xd8280fe5,
+0xd2730f66, 0x730f6620, 0x0f6620d4, 0x0f66d5f4,
+0x0f66e0f4, 0x0f66ddf4, 0x0f66d4d4, 0x6620f273,
+0x66d3d40f, 0x1529380f, 0x00000234, 0x0005c8b8,
+0x380f6600, 0x830fd117, 0x0000021a, 0xc045290f,
+0xc05d280f, 0xf3730f66, 0x5d290f03, 0x55280fa0,
+0x730f66c0, 0x290f02f2, 0x0f66b055, 0xedb8d2d4,
+0x66000005, 0xd329380f, 0x17380f66, 0xe3830fd1,
+0x0f000001, 0x66a05528, 0x02d2730f, 0xd2d40f66,
+0x0005f2b8, 0x380f6600, 0x66b05529, 0xd117380f,
+0x01c0830f, 0x45c70000, 0x0000039c, 0x6e0f6600,
+0x280f9c5d, 0xf30f66d0, 0x9c45c7d3, 0x00000002,
+0x5d6e0f66, 0xf30f669c, 0x45290fc3, 0xd40f66b0,
+0x0605b8c0, 0x0f660000, 0x66c22938, 0xc117380f,
+0x0180830f, 0x0f660000, 0x669c5d6e, 0x0fd3d30f,
+0x0f66c228, 0x09b8c2d4, 0x66000006, 0x4529380f,
+0x380f66b0, 0x830fc117, 0x0000015a, 0x0fd2570f,
+0x0f66c228, 0xf0452938, 0x29380f66, 0x45540fc2,
+0x0f4866d0, 0x290fc07e, 0x8b48c045, 0x8b48f04d,
+0x8948c855, 0xe6d348c6, 0xf84d8b48, 0x66d78948,
+0xd66e0f48, 0x66e7d348, 0x223a0f48, 0x280f01d7,
+0x0f66f045, 0x290fc1d4, 0x8b48f045, 0xd348f04d,
+0x4d8b48e0, 0x0f4866f8, 0x21b8c06e, 0x48000006,
+0x4866e2d3, 0xc2223a0f, 0xd40f6601, 0x380f66c0,
+0x0f66c229, 0x0fc11738, 0x0000d983, 0x55280f00,
+0x700f66e0, 0xb84ed045, 0x0000064e, 0x29380f66,
+0x380f66c2, 0x830fc117, 0x000000ba, 0xdd05280f,
+0x0f000000, 0x0f66da28, 0x66d05d6c, 0xd0556d0f,
+0xd1d40f66, 0x0006a8b8, 0xfb0f6600, 0xd8280fd3,
+0x0fd9570f, 0x0f66d057, 0x280fd3fb, 0x00009f1d,
+0x380f6600, 0x0f66d329, 0x73d11738, 0x55280f79,
+0x458b48d0, 0x75280fe8, 0x55290fe0, 0x380f66b0,
+0x8948f210, 0x280fb845, 0x2ab8b055, 0x0f000007,
+0x0f66c628, 0x66c22938, 0xc117380f, 0x280f4873,
+0x3ab8d045, 0x0f000007, 0x0f66e028, 0xe0650e3a,
+0x380f66f0, 0x0f66d429, 0x73d11738, 0xd0280f29,
+0x0f66c031, 0x08d00f3a, 0x66c3540f, 0x66c3d40f,
+0xc229380f, 0x17380f66, 0xc0920fc1, 0x1901f883,
+0x074a25c0, 0xc35d0000, 0x00000000, 0x00000000,
+0x00000002, 0x00000000, 0x00000002, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+0001600,
+};
+asm(".type sse4_x86_64_D_16u8, STT_NOTYPE;");
+asm(".type sse4_x86_64_D_16u8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_64_D_16f4[] = {
+0xb84800eb, 0x3f800000, 0x40000000, 0xe5894855,
+0xd0458948, 0x0000b848, 0x00004040, 0x89484080,
+0xb848d845, 0x40800000, 0x40400000, 0xe0458948,
+0x000001b8, 0xe0c148fe, 0x4589481e, 0x00b848e8,
+0x003f8000, 0x48bf8000, 0x48f04589, 0x0ff84589,
+0x0fd07d28, 0x0fa07d29, 0x66a04528, 0xb8c9760f,
+0x00000539, 0x0fd0280f, 0x6600d7c2, 0xd117380f,
+0x03c4830f, 0x280f0000, 0x580fd055, 0x55290fd0,
+0x55280fb0, 0x053fb8d0, 0x580f0000, 0x55c20fd2,
+0x0f6600b0, 0x0fd11738, 0x00039d83, 0x55280f00,
+0x555c0fb0, 0x55290fd0, 0xd0280fc0, 0x000544b8,
+0x55c20f00, 0x0f6600c0, 0x0fd11738, 0x00037983,
+0x55280f00, 0x45590fe0, 0xda280fd0, 0x0fda590f,
+0x0fd05528, 0x0fe06d28, 0x280fea58, 0x655c0fe2,
+0xc35c0fe0, 0x00055bb8, 0xe5590f00, 0x00c4c20f,
+0x17380f66, 0x3f830fc1, 0x0f000003, 0x0ff04528,
+0x290fc259, 0x5e0fa045, 0xc20ff055, 0x64b800c2,
+0x66000005, 0xc117380f, 0x031c830f, 0x280f0000,
+0x0ff3f05d, 0x03161510, 0x67b80000, 0x0f000005,
+0xc60fc328, 0x570f00d2, 0x55570fc2, 0x45590fd0,
+0xc2c20fa0, 0x380f6600, 0x830fc117, 0x000002ea,
+0x455b0f66, 0xc05b0fd0, 0xd045c20f, 0x056eb800,
+0x0f660000, 0x0fc11738, 0x0002cd83, 0x45530f00,
+0x45290fd0, 0x45530fa0, 0x55280fa0, 0x0575b8d0,
+0x0f660000, 0x5b0fc05b, 0xc2c20fc0, 0x380f6600,
+0x830fc117, 0x000002a2, 0x0fc2280f, 0x290fc259,
+0x520fa045, 0x290fa045, 0x280fb045, 0x7cb8b045,
+0x0f000005, 0x0f66e053, 0x5b0fe45b, 0xd4c20fe4,
+0x380f6600, 0x830fd117, 0x0000026e, 0xd05b0f66,
+0xd045280f, 0xb8d25b0f, 0x0000057e, 0x66e0530f,
+0x0fe45b0f, 0xc20fe45b, 0x0f6600d4, 0x0fd11738,
+0x00024583, 0xd0280f00, 0x0fd0590f, 0x0fa05529,
+0xb8a05551, 0x0000059c, 0x00d0c20f, 0x17380f66,
+0x23830fd1, 0xf3000002, 0x4125100f, 0x0f000002,
+0x0f00e4c6, 0x5e0fd428, 0x55290fd0, 0x3a0f66a0,
+0x0ba05508, 0x2415c20f, 0x00000002, 0x0005a4b8,
+0x380f6600, 0x830fd117, 0x000001ee, 0xe055280f,
+0x0feb280f, 0x590fe859, 0x55290fd3, 0xd5280fb0,
+0xb0555f0f, 0xb06d5d0f, 0xb06d290f, 0xb055580f,
+0xe045580f, 0x00063db8, 0xd3590f00, 0x00c2c20f,
+0x17380f66, 0xaf830fc1, 0x0f000001, 0xb8d04528,
+0x0000064e, 0x1bc0c60f, 0xe045c20f, 0x380f6600,
+0x830fc117, 0x00000192, 0xe055280f, 0x0fc2280f,
+0x0fd04514, 0x150fea28, 0x5c0fd06d, 0x100ff3c5,
+0x00017f2d, 0x06a8b800, 0xc60f0000, 0x590f00ed,
+0xc5c20fc3, 0x380f6600, 0x830fc117, 0x0000015a,
+0x45120ff3, 0x100ff3d0, 0x00015b2d, 0x455c0f00,
+0x0717b8d0, 0x0ff30000, 0x014e3510, 0xc60f0000,
+0x580f00ed, 0xf6c60feb, 0xee590f00, 0x00c5c20f,
+0x17380f66, 0x1f830fc1, 0xf3000001, 0xd045160f,
+0x0fe3580f, 0xb8d06d28, 0x0000071e, 0x0fc55c0f,
+0xc20fe659, 0x0f6600c4, 0x0fc11738, 0x0000f983,
+0x100ff300, 0x290fe445, 0x2ab8b06d, 0xf3000007,
+0xb445110f, 0x45100ff3, 0x110ff3ec, 0x570fbc45,
+0xc3c20fc0, 0x380f6601, 0x280fd514, 0xc20fb045,
+0x0f6600d0, 0x0fd11738, 0x0000bd83, 0x55280f00,
+0x073ab8d0, 0x0f660000, 0xe0550c3a, 0xc2c20f0a,
+0x380f6600, 0x830fc117, 0x0000009e, 0xd045280f,
+0x45d00ff2, 0x55280fe0, 0xd00ff2d0, 0x43b8e055,
+0x0f000007, 0x6600c2c2, 0xc117380f, 0x280f7c73,
+0x52b8d055, 0x0f000007, 0x0f66c228, 0xe045403a,
+0x05c20ff1, 0x00000097, 0x380f6600, 0x5a73c117,
+0xa055290f, 0x0fd2570f, 0x0ff2c228, 0x0fa0457c,
+0x0fa04529, 0x0ff2c228, 0x0fa0457c, 0x0fffc0c6,
+0x004a052e, 0x2d7a0000, 0x280f2b75, 0x0ff2d045,
+0x31e0457d, 0x7c0ff2c0, 0x7c0ff2c2, 0xc2c20fc2,
+0x380f6600, 0x920fc117, 0x01f883c0, 0x6725c019,
+0xeb000007, 0x075eb805, 0xc35d0000, 0x00000000,
+0x80000000, 0x40000000, 0xbf800000, 0x3f000000,
+0x41200000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x41a00000, 0x00000000, 0x00000000, 0x00000000,
+0002200,
+};
+asm(".type sse4_x86_64_D_16f4, STT_NOTYPE;");
+asm(".type sse4_x86_64_D_16f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_64_D_16f8[] = {
+0x485500eb, 0x0ff2e589, 0x04520510, 0x0ff20000,
+0x041a0d10, 0x8b480000, 0x00041b05, 0x110ff200,
+0x8948d045, 0x0ff2f845, 0xf2e04d11, 0xf045110f,
+0x4d110ff2, 0x110ff2d8, 0x280fe845, 0x290fd07d,
+0x280fa07d, 0x0f66a045, 0x39b8c976, 0x0f000005,
+0x0f66d028, 0x6600d7c2, 0xd117380f, 0x03ca830f,
+0x280f0000, 0x0f66d055, 0x290fd058, 0x280fb055,
+0x3fb8d055, 0x66000005, 0x66d2580f, 0xb055c20f,
+0x380f6600, 0x830fd117, 0x000003a0, 0xb055280f,
+0x555c0f66, 0x55290fd0, 0xd0280fc0, 0x000544b8,
+0xc20f6600, 0x6600c055, 0xd117380f, 0x037a830f,
+0x280f0000, 0x0f66e055, 0x0fd04559, 0x0f66da28,
+0x280fda59, 0x280fd055, 0x0f66e06d, 0x280fea58,
+0x5c0f66e2, 0x0f66e065, 0x5bb8c35c, 0x66000005,
+0x66e5590f, 0x00c4c20f, 0x17380f66, 0x39830fc1,
+0x0f000003, 0x66f04528, 0x0fc2590f, 0x66a04529,
+0xf0555e0f, 0xc2c20f66, 0x0564b800, 0x0f660000,
+0x0fc11738, 0x00031383, 0x55280f00, 0x120ff2f0,
+0x00031b1d, 0x0567b800, 0x280f0000, 0xc3570fc2,
+0xd05d570f, 0x45590f66, 0xc20f66a0, 0x0f6600c3,
+0x0fc11738, 0x0002e383, 0xe60ff200, 0x0ff3d045,
+0x0f66c0e6, 0x00d045c2, 0x00056eb8, 0x380f6600,
+0x830fc117, 0x000002c4, 0x455a0f66, 0xc0530fd0,
+0x0fc05a0f, 0x66a04529, 0xa0455a0f, 0x0fc0530f,
+0xb8d06528, 0x00000575, 0xf2c05a0f, 0xf3c0e60f,
+0x66c0e60f, 0x00c4c20f, 0x17380f66, 0x89830fc1,
+0x0f000002, 0x0f66c428, 0x290fc459, 0x0f66a045,
+0x0fa0455a, 0x5a0fc052, 0x45290fc0, 0x5d280fb0,
+0x057cb8b0, 0x0f660000, 0x530fc35a, 0xc05a0fc0,
+0xc0e60ff2, 0xc0e60ff3, 0xe0c20f66, 0x380f6600,
+0x830fe117, 0x00000244, 0xdbe60ff2, 0xe3e60ff3,
+0xd05d280f, 0x00057eb8, 0x5a0f6600, 0xc0530fc3,
+0xf2c05a0f, 0xf3c0e60f, 0x66c0e60f, 0x00c4c20f,
+0x17380f66, 0x11830fc1, 0x0f000002, 0x0f66c328,
+0x290fc359, 0x0f66a045, 0x66a04551, 0x00c3c20f,
+0x00059cb8, 0x380f6600, 0x830fc117, 0x000001ec,
+0x2d120ff2, 0x00000218, 0x66c5280f, 0x0fc35e0f,
+0x66a04529, 0x45093a0f, 0xa4b80ba0, 0x66000005,
+0xf805c20f, 0x00000001, 0x17380f66, 0xb9830fc1,
+0x0f000001, 0x0fe04528, 0x0f66e228, 0x0f66e359,
+0x290fc259, 0x280fb045, 0x5f0f66c4, 0x0f66b045,
+0x0fb0655d, 0x66b06529, 0xb045580f, 0x5d580f66,
+0x063db8e0, 0x0f660000, 0x0f66c259, 0x6600c3c2,
+0xc117380f, 0x0172830f, 0x280f0000, 0x4eb8d045,
+0x66000006, 0xc00f3a0f, 0xc20f6608, 0x6600e045,
+0xc117380f, 0x0152830f, 0x280f0000, 0x280fe05d,
+0x160f66c3, 0x280fd045, 0x0f66d065, 0x66e86512,
+0xb8c45c0f, 0x000006a8, 0xc2590f66, 0xc5c20f66,
+0x380f6600, 0x830fc117, 0x00000120, 0x45120ff2,
+0x120ff2d0, 0x00011f25, 0x580f6600, 0x6d280fe2,
+0x120ff2d0, 0x00011f35, 0x0717b800, 0x0f660000,
+0x0f66c55c, 0x0f66e659, 0x6600c4c2, 0xc117380f,
+0x00e6830f, 0x0ff20000, 0x0fe84510, 0xb8b06d29,
+0x0000072a, 0x45110ff2, 0xc0570fb8, 0xc2c20f66,
+0x380f6601, 0x280fdd15, 0x0f66b045, 0x6600d8c2,
+0xd917380f, 0x00b2830f, 0x280f0000, 0x3ab8d055,
+0x66000007, 0x550d3a0f, 0x0f6602e0, 0x6600c2c2,
+0xc117380f, 0x0092830f, 0x280f0000, 0x0f66d045,
+0x0fe045d0, 0x66d05528, 0xe055d00f, 0x000743b8,
+0xc20f6600, 0x0f6600c2, 0x73c11738, 0x55280f6f,
+0x0752b8d0, 0x280f0000, 0x3a0f66c2, 0x31e04541,
+0x05c20f66, 0x00000097, 0x380f6600, 0x4c73c117,
+0xa055290f, 0x0fd2570f, 0x0f66c228, 0x66a0457c,
+0x66c0150f, 0x55052e0f, 0x7a000000, 0x0f28752a,
+0x66d04528, 0xe0457d0f, 0x0f66c031, 0x0f66c27c,
+0x6600c2c2, 0xc117380f, 0x83c0920f, 0xc01901f8,
+0x00076725, 0xb805eb00, 0x0000075e, 0x0000c35d,
+0x00000000, 0x40000000, 0x00000000, 0xbff00000,
+0x00000000, 0x80000000, 0x00000000, 0x3fe00000,
+0x00000000, 0x40080000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x40100000, 0x00000000, 0x00000000,
+0002200,
+};
+asm(".type sse4_x86_64_D_16f8, STT_NOTYPE;");
+asm(".type sse4_x86_64_D_16f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_64_D_f4[] = {
+0x485523eb, 0x7d89e589, 0x458d48fc, 0xea8948fc,
+0x75ff3880, 0xc0ff480c, 0x75d03948, 0xeb01b0f3,
+0x5dc03102, 0x894855c3, 0xec8148e5, 0x000000f0,
+0x05100ff3, 0x000004d8, 0x85110ff3, 0xffffff38,
+0x85110ff3, 0xffffff3c, 0x85110ff3, 0xffffff40,
+0xff38858b, 0x8589ffff, 0xffffff2c, 0x0ff3ff31,
+0xff388d10, 0x00b9ffff, 0x0f000000, 0xff2c8d2e,
+0x0f40ffff, 0x450fc79b, 0xe8dff7f9, 0xffffff82,
+0x39b8c289, 0x84000005, 0x7d840fd2, 0xf3000004,
+0x2c8d100f, 0xf3ffffff, 0x388d580f, 0xf3ffffff,
+0x308d110f, 0xf3ffffff, 0x388d100f, 0x31ffffff,
+0x580ff3ff, 0x8d2e0fc9, 0xffffff30, 0xc79b0f40,
+0xf7f9450f, 0xff38e8df, 0xc289ffff, 0x00053fb8,
+0x0fd28400, 0x00043384, 0x100ff300, 0xffff308d,
+0x5c0ff3ff, 0xffff388d, 0x110ff3ff, 0xffff108d,
+0x10858bff, 0x89ffffff, 0xffff6885, 0x308589ff,
+0x89ffffff, 0xffff3485, 0xf3ff31ff, 0x2c8d100f,
+0x0fffffff, 0xff348d2e, 0x0f40ffff, 0x450fc79b,
+0xe8dff7f9, 0xfffffeda, 0x44b8c289, 0x84000005,
+0xd5840fd2, 0xf3000003, 0x2c8d100f, 0xf3ffffff,
+0x388d590f, 0xf3ffffff, 0x2c8d110f, 0xf3ffffff,
+0x3c8d100f, 0xf3ffffff, 0xf3c9590f, 0x308d110f,
+0xf3ffffff, 0x388d100f, 0xf3ffffff, 0x3c8d580f,
+0xf3ffffff, 0x348d110f, 0xf3ffffff, 0x388d100f,
+0xf3ffffff, 0x2c9d100f, 0x31ffffff, 0x5c0ff3ff,
+0xffff309d, 0xd1280fff, 0x955c0ff3, 0xffffff3c,
+0x95590ff3, 0xffffff34, 0xf3da2e0f, 0x3495110f,
+0x40ffffff, 0x0fc79b0f, 0xdff7f945, 0xfffe41e8,
+0xb8c289ff, 0x0000055b, 0x840fd284, 0x0000033c,
+0x8d590ff3, 0xffffff40, 0x8d110ff3, 0xffffff2c,
+0x0ff3ff31, 0xff388d10, 0x0ff3ffff, 0xff408d5e,
+0x2e0fffff, 0xffff2c8d, 0x110ff3ff, 0xffff308d,
+0x9b0f40ff, 0xf9450fc7, 0xf3e8dff7, 0x89fffffd,
+0x0564b8c2, 0xd2840000, 0x02ee840f, 0x0ff30000,
+0xff408d10, 0x0ff3ffff, 0x02f21d10, 0x0ff30000,
+0xff389510, 0xff31ffff, 0x0fcb570f, 0x0ff3d357,
+0xff2c8d59, 0x2e0fffff, 0x9b0f40ca, 0xf9450fc7,
+0xabe8dff7, 0x89fffffd, 0x0567b8c2, 0xd2840000,
+0x02a6840f, 0x0ff30000, 0xff38852c, 0x4589ffff,
+0x2a0ff3f8, 0x0ff3f84d, 0xff2c8d11, 0xff31ffff,
+0x8d100ff3, 0xffffff2c, 0x388d2e0f, 0x40ffffff,
+0x0fc79b0f, 0xdff7f945, 0xfffd65e8, 0xb8c289ff,
+0x0000056e, 0x840fd284, 0x00000260, 0x8d530ff3,
+0xffffff38, 0x8d110ff3, 0xffffff2c, 0x8d530ff3,
+0xffffff2c, 0xc12c0ff3, 0xf3f84589, 0xf8552a0f,
+0x8d100ff3, 0xffffff38, 0x2e0fff31, 0x9b0f40d1,
+0xf9450fc7, 0x17e8dff7, 0x89fffffd, 0x0575b8c2,
+0xd2840000, 0x0212840f, 0x0ff30000, 0x0ff3c959,
+0xff2c8d11, 0x0ff3ffff, 0xff2c8d52, 0x0ff3ffff,
+0xff308d11, 0x0ff3ffff, 0xff308d53, 0x0ff3ffff,
+0x4589c12c, 0xf3ff31f8, 0xf84d2a0f, 0x388d2e0f,
+0x40ffffff, 0x0fc79b0f, 0xdff7f945, 0xfffcc1e8,
+0xb8c289ff, 0x0000057c, 0x840fd284, 0x000001bc,
+0x852c0ff3, 0xffffff30, 0xf3f84589, 0x388d530f,
+0xf3ffffff, 0xf3c12c0f, 0xf8552a0f, 0xf3f84589,
+0xf84d2a0f, 0x2e0fff31, 0x9b0f40d1, 0xf9450fc7,
+0x7be8dff7, 0x89fffffc, 0x057eb8c2, 0xd2840000,
+0x0176840f, 0x48f30000, 0x38852c0f, 0x48ffffff,
+0xf3f84589, 0x4d2a0f48, 0x110ff3f8, 0xffff2c8d,
+0xf3ff31ff, 0x388d100f, 0x0fffffff, 0xff2c8d2e,
+0x0f40ffff, 0x450fc79b, 0xe8dff7f9, 0xfffffc32,
+0x88b8c289, 0x84000005, 0x2d840fd2, 0xf3000001,
+0xf3c9590f, 0x2c8d110f, 0xf3ffffff, 0x3895100f,
+0x31ffffff, 0x510ff3ff, 0xffff2c8d, 0xca2e0fff,
+0xc79b0f40, 0xf7f9450f, 0xfbf4e8df, 0xc289ffff,
+0x00059cb8, 0x0fd28400, 0x0000ef84, 0xc8280f00,
+0x85110ff3, 0xffffff30, 0xca5e0ff3, 0x8d110ff3,
+0xffffff2c, 0x0f66ff31, 0x2c850a3a, 0x0bffffff,
+0x30852e0f, 0xf3ffffff, 0x3485110f, 0x40ffffff,
+0x0fc79b0f, 0xdff7f945, 0xfffba5e8, 0xb8c289ff,
+0x000005a4, 0x840fd284, 0x000000a0, 0x85100ff3,
+0xffffff40, 0x8d100ff3, 0xffffff38, 0xc8590ff3,
+0x85590ff3, 0xffffff3c, 0x8d110ff3, 0xffffff2c,
+0x85110ff3, 0xffffff30, 0x85100ff3, 0xffffff2c,
+0x855f0ff3, 0xffffff30, 0x85110ff3, 0xffffff34,
+0x85100ff3, 0xffffff2c, 0x855d0ff3, 0xffffff30,
+0x85110ff3, 0xffffff30, 0x85100ff3, 0xffffff30,
+0x85580ff3, 0xffffff34, 0x0ff3ff31, 0xff408559,
+0x0ff3ffff, 0xff388d10, 0x0ff3ffff, 0xff3c8d58,
+0x2e0fffff, 0x9b0f40c1, 0xf9450fc7, 0xffe8dff7,
+0x3cfffffa, 0x25c01901, 0x0000063d, 0x0000c3c9,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0002460,
+};
+asm(".type sse4_x86_64_D_f4, STT_NOTYPE;");
+asm(".type sse4_x86_64_D_f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) sse4_x86_64_D_f8[] = {
+0x485500eb, 0x8148e589, 0x000138ec, 0x100ff200,
+0x0005cb05, 0x110ff200, 0xfffe7885, 0x110ff2ff,
+0xfffe8085, 0x110ff2ff, 0xfffe8885, 0x858b48ff,
+0xfffffe78, 0x60858948, 0x31fffffe, 0x100ff2c0,
+0xfffe788d, 0x0000baff, 0x0f660000, 0xfe608d2e,
+0x9b0fffff, 0x450f48c0, 0xd8f748c2, 0x6e0f4866,
+0x0539b8e0, 0x0f660000, 0xb60fccd7, 0xfff981c9,
+0x0f000000, 0x00055885, 0x100ff200, 0xfffe608d,
+0x580ff2ff, 0xfffe788d, 0x110ff2ff, 0xfffe688d,
+0x100ff2ff, 0xfffe788d, 0xf2c031ff, 0x66c9580f,
+0x688d2e0f, 0x0ffffffe, 0x0f48c09b, 0xf748c245,
+0x0f4866d8, 0x3fb8e86e, 0x66000005, 0x0fcdd70f,
+0xf981c9b6, 0x000000ff, 0x0503850f, 0x0ff20000,
+0xfe688d10, 0x0ff2ffff, 0xfe788d5c, 0x0ff2ffff,
+0xfe508d11, 0x8b48ffff, 0xfffe5085, 0x858948ff,
+0xfffffee0, 0x68858948, 0x48fffffe, 0xfe708589,
+0xc031ffff, 0x8d100ff2, 0xfffffe60, 0x8d2e0f66,
+0xfffffe70, 0x48c09b0f, 0x48c2450f, 0x4866d8f7,
+0xb8f06e0f, 0x00000544, 0xced70f66, 0x81c9b60f,
+0x0000fff9, 0x96850f00, 0xf2000004, 0x608d100f,
+0xf2fffffe, 0x788d590f, 0xf2fffffe, 0x608d110f,
+0xf2fffffe, 0x808d100f, 0xf2fffffe, 0xf2c9590f,
+0x688d110f, 0xf2fffffe, 0x788d100f, 0xf2fffffe,
+0x808d580f, 0xf2fffffe, 0x708d110f, 0xf2fffffe,
+0x788d100f, 0xf2fffffe, 0x609d100f, 0x31fffffe,
+0x5c0ff2c0, 0xfffe689d, 0xd1280fff, 0x955c0ff2,
+0xfffffe80, 0x95590ff2, 0xfffffe70, 0xda2e0f66,
+0x95110ff2, 0xfffffe70, 0x48c09b0f, 0x48c2450f,
+0x4866d8f7, 0xb8f86e0f, 0x0000055b, 0xcfd70f66,
+0x81c9b60f, 0x0000fff9, 0xf2850f00, 0xf2000003,
+0x888d590f, 0xf2fffffe, 0x608d110f, 0x31fffffe,
+0x100ff2c0, 0xfffe788d, 0x5e0ff2ff, 0xfffe888d,
+0x2e0f66ff, 0xfffe608d, 0x110ff2ff, 0xfffe688d,
+0xc09b0fff, 0xc2450f48, 0x66d8f748, 0xe06e0f48,
+0x000564b8, 0xd70f6600, 0xc9b60fcc, 0x00fff981,
+0x850f0000, 0x00000399, 0x1d7e0ff3, 0x000003b0,
+0x8d100ff2, 0xfffffe88, 0x0ff2c031, 0xfe789510,
+0x570fffff, 0x590ff2cb, 0xfffe608d, 0xd3570fff,
+0xca2e0f66, 0x48c09b0f, 0x48c2450f, 0x4866d8f7,
+0xb8e86e0f, 0x00000567, 0xcdd70f66, 0x81c9b60f,
+0x0000fff9, 0x46850f00, 0xf2000003, 0x78852c0f,
+0x89fffffe, 0xfffe9085, 0x2a0ff2ff, 0xfffe908d,
+0x110ff2ff, 0xfffe608d, 0xf2c031ff, 0x608d100f,
+0x66fffffe, 0x788d2e0f, 0x0ffffffe, 0x0f48c09b,
+0xf748c245, 0x0f4866d8, 0x6eb8f06e, 0x66000005,
+0x0fced70f, 0xf981c9b6, 0x000000ff, 0x02ef850f,
+0x0ff20000, 0xfe788d5a, 0x0ff3ffff, 0x0ff3c953,
+0x0f66c95a, 0xfe608d13, 0x0ff2ffff, 0xfe608d5a,
+0x0ff3ffff, 0x0ff3c953, 0x0ff2c95a, 0x8589c12c,
+0xfffffe90, 0x952a0ff2, 0xfffffe90, 0x8d100ff2,
+0xfffffe78, 0x0f66c031, 0x9b0fd12e, 0x450f48c0,
+0xd8f748c2, 0x6e0f4866, 0x0575b8f8, 0x0f660000,
+0xb60fcfd7, 0xfff981c9, 0x0f000000, 0x00028085,
+0x590ff200, 0x110ff2c9, 0xfffe608d, 0x5a0ff2ff,
+0xfffe608d, 0x520ff3ff, 0x5a0ff3c9, 0x130f66c9,
+0xfffe688d, 0x5a0ff2ff, 0xfffe688d, 0x530ff3ff,
+0x5a0ff3c9, 0x2c0ff2c9, 0x908589c1, 0x31fffffe,
+0x2a0ff2c0, 0xfffe908d, 0x2e0f66ff, 0xfffe788d,
+0xc09b0fff, 0xc2450f48, 0x66d8f748, 0xe06e0f48,
+0x00057cb8, 0xd70f6600, 0xd2b60fd4, 0x00fffa81,
+0x850f0000, 0x00000209, 0x852c0ff2, 0xfffffe68,
+0xfe908589, 0x0ff2ffff, 0xfe788d5a, 0x0ff3ffff,
+0x0ff3c953, 0x0ff2c95a, 0x858bd12c, 0xfffffe90,
+0xfe909589, 0x853bffff, 0xfffffe90, 0x0fc0940f,
+0xf748c0b6, 0x0f4866d8, 0x7eb8e86e, 0x66000005,
+0x0fd5d70f, 0xfa81d2b6, 0x000000ff, 0x01af850f,
+0x48f20000, 0x78852c0f, 0x48fffffe, 0xfe908589,
+0x48f2ffff, 0x908d2a0f, 0xf2fffffe, 0x608d110f,
+0x31fffffe, 0x100ff2c0, 0xfffe788d, 0x0000baff,
+0x0f660000, 0xfe608d2e, 0x9b0fffff, 0x450f48c0,
+0xd8f748c2, 0x6e0f4866, 0x0588b8f0, 0x0f660000,
+0xb60fced7, 0xfff981c9, 0x0f000000, 0x00015085,
+0x590ff200, 0x110ff2c9, 0xfffe608d, 0x100ff2ff,
+0xfffe7895, 0xf2c031ff, 0x608d510f, 0x66fffffe,
+0x0fca2e0f, 0x0f48c09b, 0xf748c245, 0x0f4866d8,
+0x9cb8f86e, 0x66000005, 0x0fcfd70f, 0xf981c9b6,
+0x000000ff, 0x0107850f, 0x280f0000, 0x110ff2c8,
+0xfffe6885, 0x5e0ff2ff, 0x110ff2ca, 0xfffe608d,
+0x66c031ff, 0x850b3a0f, 0xfffffe60, 0x2e0f660b,
+0xfffe6885, 0x110ff2ff, 0xfffe7085, 0xc09b0fff,
+0xc2450f48, 0x66d8f748, 0xe06e0f48, 0x0005a4b8,
+0xd70f6600, 0xc9b60fcc, 0x00fff981, 0x850f0000,
+0x000000ad, 0x85100ff2, 0xfffffe88, 0x8d100ff2,
+0xfffffe78, 0xc8590ff2, 0x85590ff2, 0xfffffe80,
+0x8d110ff2, 0xfffffe60, 0x85110ff2, 0xfffffe68,
+0x85100ff2, 0xfffffe60, 0x855f0ff2, 0xfffffe68,
+0x85110ff2, 0xfffffe70, 0x85100ff2, 0xfffffe60,
+0x855d0ff2, 0xfffffe68, 0x85110ff2, 0xfffffe68,
+0x85100ff2, 0xfffffe68, 0x85580ff2, 0xfffffe70,
+0x0ff2c031, 0xfe888559, 0x0ff2ffff, 0xfe788d10,
+0x0ff2ffff, 0xfe808d58, 0x0f66ffff, 0x9b0fc12e,
+0x450f48c0, 0xd8f748c2, 0x6e0f4866, 0xd70f66e8,
+0xc0b60fc5, 0x0000ff3d, 0x063db800, 0x440f0000,
+0x00c3c9c2, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x80000000, 0x00000000, 0x00000000,
+0003000,
+};
+asm(".type sse4_x86_64_D_f8, STT_NOTYPE;");
+asm(".type sse4_x86_64_D_f8, STT_FUNC;");
@@ -0,0 +1,40 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) ssse3_aes_x86_32_D_16[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x570f55c3,
+0x83e589c9, 0x290f38ec, 0xc031d84d, 0xc8054488,
+0x10f88340, 0x280ff675, 0x1000d01d, 0x15280f00,
+0x001000e0, 0xdb380f66, 0x280fc865, 0x280fc84d,
+0x380f66e9, 0x66d86ddd, 0x6dde380f, 0x740f66d8,
+0xd70f66e5, 0xfffa81d4, 0x750000ff, 0x380f6659,
+0x66d84ddf, 0x4ddc380f, 0x4d290fd8, 0x380f66e8,
+0x66e84ddb, 0xc84d740f, 0xd1d70f66, 0xfffffa81,
+0x39750000, 0xdf3a0f66, 0x0f00c84d, 0x0f66e128,
+0x66e30038, 0x66cc740f, 0x81d1d70f, 0x00fffffa,
+0x0f217500, 0x48c84d28, 0xcafc0f66, 0xc84d290f,
+0xc0318275, 0x4ab813eb, 0xeb000000, 0x0053b80c,
+0x05eb0000, 0x00005eb8, 0x00c3c900, 0x00000000,
+0x06050407, 0x00030201, 0x0e0d0c0f, 0x080b0a09,
+0x10101010, 0x10101010, 0x10101010, 0x10101010,
+0000360,
+};
+asm(".type ssse3_aes_x86_32_D_16, STT_NOTYPE;");
+asm(".type ssse3_aes_x86_32_D_16, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) ssse3_aes_x86_64_D_16[] = {
+0x0f5500eb, 0xc031c957, 0x0fe58948, 0x88e04d29,
+0x48d00544, 0x8348c0ff, 0xf37510f8, 0xad2d280f,
+0x0f000000, 0x00b62528, 0x0f660000, 0xd055db38,
+0xd04d280f, 0x66d9280f, 0x5ddd380f, 0x380f66e0,
+0x66e05dde, 0x66d3740f, 0x81d2d70f, 0x00fffffa,
+0x665a7500, 0x4ddf380f, 0x380f66e0, 0x0fe04ddc,
+0x66f04d29, 0x4ddb380f, 0x740f66f0, 0x0f66d04d,
+0xfa81d1d7, 0x0000ffff, 0x0f663a75, 0xd04ddf3a,
+0xd1280f00, 0x00380f66, 0x740f66d5, 0xd70f66ca,
+0xfffa81d1, 0x750000ff, 0x4d280f22, 0xfc0f66d0,
+0x4d290fcc, 0x75c8ffd0, 0xebc03181, 0x004ab813,
+0x0ceb0000, 0x000053b8, 0xb805eb00, 0x0000005e,
+0x0000c35d, 0x00000000, 0x00000000, 0x00000000,
+0x06050407, 0x00030201, 0x0e0d0c0f, 0x080b0a09,
+0x10101010, 0x10101010, 0x10101010, 0x10101010,
+0000360,
+};
+asm(".type ssse3_aes_x86_64_D_16, STT_NOTYPE;");
+asm(".type ssse3_aes_x86_64_D_16, STT_FUNC;");
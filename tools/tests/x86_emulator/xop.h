@@ -0,0 +1,8903 @@
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_16i1[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x01b255c3,
+0x08b9e589, 0x53000000, 0xec81c031, 0x00000094,
+0xb8055488, 0xd32811b3, 0xc8285c88, 0xe383c389,
+0x01fb8301, 0xe380db19, 0x88cbfe02, 0x8dd8055c,
+0xd8210158, 0x8301f883, 0xc2fe00d9, 0xe71d4c88,
+0x7410fb83, 0xebd88904, 0x6ff9c5c7, 0xf9c5b865,
+0xc588657f, 0xc5db76e1, 0x88556ff9, 0x000539b8,
+0x74e9c500, 0x79e2c4cc, 0x830fcb17, 0x00000397,
+0x4dfce9c5, 0x7ff9c5b8, 0xf9c5984d, 0xc5b8656f,
+0xb8ccfcd9, 0x0000053f, 0x4d74f1c5, 0x79e2c498,
+0x830fcb17, 0x0000036f, 0x7d6ff9c5, 0xf8c1c598,
+0xf9c5b84d, 0xb8a84d7f, 0x00000544, 0x5574e9c5,
+0x79e2c4a8, 0x830fd317, 0x0000034b, 0x4d6ff9c5,
+0x6ff9c5d8, 0xf1c5b865, 0xd9c5f960, 0xf9c5d460,
+0xff78bd7f, 0xf1c5ffff, 0xe9c5f968, 0xff7895d5,
+0xf9c5ffff, 0xff68bd7f, 0xd9c5ffff, 0xf1c5cc68,
+0xff688dd5, 0xd1c5ffff, 0xf9c5edef, 0x8fe8756f,
+0x15a3e8e8, 0x00100420, 0x64c9c510, 0xdbf1c5cd,
+0x7ff9c5ca, 0xe98fa84d, 0xe87598f0, 0x7d6ff9c5,
+0xf8c1c5e8, 0x1004303d, 0x7ff9c500, 0xe98fe87d,
+0xe84d98f0, 0x000621b8, 0xfcf1c500, 0x74c1c5f9,
+0x79e2c4fe, 0x830ffb17, 0x000002bb, 0x6df8d1c5,
+0x0626b8e8, 0xe98f0000, 0xc5c99850, 0xa84d74f1,
+0x1779e2c4, 0x9c830fcb, 0xc5000002, 0xc86d6ff9,
+0xcd60d1c5, 0xf568d1c5, 0x8dd5f1c5, 0xffffff78,
+0x557ff9c5, 0xd5c9c588, 0xffff68b5, 0xf0e88fff,
+0x04200da3, 0xc5600010, 0x984d7ff9, 0x3c69e2c4,
+0xe2c4984d, 0x98553869, 0x557ff9c5, 0xfcf1c598,
+0x3db8984d, 0xc5000006, 0xc5d160f1, 0xc5c968f1,
+0x7895d5e9, 0xc5ffffff, 0x688dd5f1, 0x8fffffff,
+0x15a3e8e8, 0x00100420, 0xfcd9c510, 0x74e9c5cd,
+0x79e2c4d1, 0x830fd317, 0x0000021b, 0x000644b8,
+0x79e2c400, 0xc5884d1c, 0xc4e174d9, 0xe31779e2,
+0x0201830f, 0xf9c50000, 0x0430256f, 0xf9c50010,
+0xb8d84d6f, 0x00000649, 0x0859e2c4, 0x74f1c5d1,
+0x79e2c4d2, 0x830fd317, 0x000001db, 0xd4f8d1c5,
+0x00064eb8, 0x6ff9c500, 0xe2c4b865, 0xc5d20059,
+0xc4d274d1, 0xd31779e2, 0x01b9830f, 0xd1c50000,
+0x043015f8, 0xf9c50010, 0xb8b8656f, 0x00000653,
+0xa358e88f, 0xf9c520d4, 0xd1c5e36f, 0xe2c4d274,
+0x0fd31779, 0x00018e83, 0x60d1c500, 0xd1c5b85d,
+0xc5b85568, 0xc5eaf8e1, 0xc5f960f1, 0xc5f168f1,
+0xc5d560d1, 0xc5ed68d1, 0xc5d2d5c1, 0xb8edd5c9,
+0x000006a8, 0xa3e8e88f, 0x10042015, 0xe9c55000,
+0x04401574, 0xe2c40010, 0x0fd41779, 0x00014683,
+0x6ff9c500, 0xe9c5b855, 0xe9c5da60, 0xe1c5ea68,
+0xd1c5dfd5, 0xc9c5eed5, 0xe88ff6ef, 0x201da3e0,
+0x50001004, 0xcc70e88f, 0xf9c500f6, 0xc5885d7f,
+0xc5de60e1, 0x887d6ff9, 0x2079e2c4, 0x06b3b8ff,
+0xe1c50000, 0xe2c4df74, 0x0fdc1779, 0x0000f683,
+0x60c9c500, 0x60c1c5f6, 0x6ff9c5fe, 0xe2c4886d,
+0xb8dd2179, 0x000006bb, 0xfb74c1c5, 0x1779e2c4,
+0xd0830ffc, 0xc5000000, 0xc5f660c9, 0xc5de60e1,
+0x88756ff9, 0x2279e2c4, 0x7ff9c5ee, 0xc4b8a86d,
+0xc5000006, 0xc4db74d1, 0xdc1779e2, 0x00a5830f,
+0x01b80000, 0xc5000000, 0x98557ff9, 0xc805548a,
+0x98055488, 0x8302c083, 0xf07511f8, 0xdbefe1c5,
+0x00072ab8, 0x64f1c500, 0x76e1c5cb, 0x68e88fdb,
+0x10c84da2, 0x4d74f1c5, 0x79e2c498, 0x6773cb17,
+0x0f69e3c4, 0xe9c501ca, 0x045015db, 0x4ab80010,
+0xc5000007, 0x3015fce9, 0xc5001004, 0xc4ca74f1,
+0xcb1779e2, 0x04b84173, 0x8f000000, 0x55e178e9,
+0x78e98fc8, 0xc5b84de1, 0xc5ca63f1, 0x48d2efe9,
+0xc178e98f, 0x63f1c5c9, 0x31f475ca, 0xefe9c5c0,
+0x74f1c5d2, 0x79e2c4ca, 0x920fcb17, 0x01f883c0,
+0x6725c019, 0x81000007, 0x000094c4, 0xc35d5b00,
+0x06040200, 0x0e0c0a08, 0x16141210, 0x1e1c1a18,
+0x01010101, 0x01010101, 0x01010101, 0x01010101,
+0x08080808, 0x08080808, 0x08080808, 0x08080808,
+0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f,
+0002140,
+};
+asm(".type xop_x86_32_D_16i1, STT_NOTYPE;");
+asm(".type xop_x86_32_D_16i1, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_16u1[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x01b255c3,
+0x08b9e589, 0x53000000, 0xec83c031, 0x05548874,
+0x2811b3b8, 0x285c88d3, 0x83c389c8, 0xcbfe01e3,
+0xd8055c88, 0x2140c389, 0x01fb83c3, 0xfe00d983,
+0x054c88c2, 0x10f883e7, 0xf9c5d375, 0xc5b87d6f,
+0x887d7ff9, 0xd276e9c5, 0x5d6ff9c5, 0x0539b888,
+0xe1c50000, 0xe2c4cf74, 0x0fca1779, 0x0002ba83,
+0xfce1c500, 0xf9c5b84d, 0xc5984d7f, 0xb87d6ff9,
+0xcffcc1c5, 0x00053fb8, 0x74f1c500, 0xe2c4984d,
+0x0fca1779, 0x00029283, 0x6ff9c500, 0xc9c59875,
+0xc5b84df8, 0xa84d7ff9, 0x000544b8, 0x74e1c500,
+0xe2c4a865, 0x0fe21779, 0x00026e83, 0xebe1c500,
+0xf9c5c85d, 0xc5885d7f, 0xc84ddbf1, 0x7d6ff9c5,
+0xefc1c5a8, 0x50b8c85d, 0xc5000005, 0x884ddff1,
+0xed76d1c5, 0xcb74f1c5, 0x1779e2c4, 0x38830fca,
+0xc5000002, 0xc5e4efd9, 0xe8756ff9, 0xcc48e88f,
+0xf1c505cc, 0x8fb84ddb, 0x7d98f0e9, 0xfcd1c5e8,
+0xf9c5e85d, 0x8fe85d7f, 0x5d98f0e9, 0x0621b8e8,
+0xe1c50000, 0xc9c5f3fc, 0xe2c4f774, 0x0ff21779,
+0x0001f683, 0xf8d9c500, 0x26b8e865, 0x8f000006,
+0xdb9458e9, 0xcb74f1c5, 0x1779e2c4, 0xd8830fca,
+0xc5000001, 0xb85d6ff9, 0x4ddae1c5, 0xdee1c5c8,
+0xe1c5c865, 0xc5c85dfc, 0xb8ccfcf1, 0x00000634,
+0xcb74f1c5, 0x1779e2c4, 0xac830fca, 0xc5000001,
+0x401d6ff9, 0xc5001003, 0xd8656ff9, 0x000649b8,
+0x61e2c400, 0xf1c5cc08, 0xe2c4cc74, 0x0fca1779,
+0x00018683, 0x6ff9c500, 0xf1c5c84d, 0xf9c5edfc,
+0xb8b87d6f, 0x0000064e, 0x0041e2c4, 0x74d1c5ed,
+0x79e2c4e9, 0x830fea17, 0x0000015f, 0xebf8f1c5,
+0x756ff9c5, 0x0653b8b8, 0xe88f0000, 0x50eea348,
+0xe974d1c5, 0x1779e2c4, 0x3c830fea, 0xc5000001,
+0xb87560f1, 0x4d68f1c5, 0x76d1c5b8, 0xfcd1c5ed,
+0x06a8b8c9, 0xf1c50000, 0xf1c5cef8, 0xd9c5ccef,
+0xf1c5e5ef, 0xf1c5ccf8, 0x03500d74, 0xe2c40010,
+0x0fca1779, 0x00010283, 0x79e2c400, 0xc4b86d30,
+0xe53079e2, 0x657ff9c5, 0x6ff9c5a8, 0xe2c4b87d,
+0xb8cf3079, 0x000006d3, 0xcd74f1c5, 0x1779e2c4,
+0xd4830fca, 0xc5000000, 0xb8756ff9, 0x3179e2c4,
+0x06dab8ce, 0xf1c50000, 0xe2c4cc74, 0x0fca1779,
+0x0000b683, 0x6ff9c500, 0xe2c4b87d, 0xc5cf3279,
+0x884d7ff9, 0x0006e1b8, 0x79e2c400, 0xf1c5e430,
+0xe2c4cc74, 0x0fca1779, 0x00008e83, 0x0001b800,
+0xf9c50000, 0xc5b84d6f, 0x984d7ff9, 0xc805548a,
+0x98055488, 0x8302c083, 0xf07511f8, 0x756ff9c5,
+0x072ab8d8, 0xe88f0000, 0xc865a270, 0x74d9c560,
+0xe2c49865, 0x73e21779, 0x71e3c452, 0xc501e10f,
+0x602ddbf1, 0xc5001003, 0xc5ebfcd1, 0xb8dd74d9,
+0x0000074a, 0x1779e2c4, 0xba3073da, 0x00000004,
+0x4d7ff9c5, 0xefe9c588, 0xe98f4ad2, 0x884dd178,
+0xc967e9c5, 0x4d7ff9c5, 0xc4ee7588, 0xc81479e3,
+0xb8883c0f, 0x0000075e, 0x83c2440f, 0x5d5b74c4,
+0x000000c3, 0x00000000, 0x00000000, 0x00000000,
+0x01010101, 0x01010101, 0x01010101, 0x01010101,
+0x08080808, 0x08080808, 0x08080808, 0x08080808,
+0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f,
+0001560,
+};
+asm(".type xop_x86_32_D_16u1, STT_NOTYPE;");
+asm(".type xop_x86_32_D_16u1, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_16i2[] = {
+0x83e58955, 0x5be8f0e4, 0xc9000001, 0x01b855c3,
+0x89000000, 0x0009b9e5, 0xec830000, 0x44896648,
+0xca89c645, 0x4544c766, 0x290001e6, 0x548966c2,
+0x8340d645, 0xe57509f8, 0x5d6ff9c5, 0x6ff9c5e8,
+0xe9c5c855, 0xf9c5f3fd, 0xc5d84d6f, 0xb85d7ff9,
+0xf1d5c9c5, 0xdb76e1c5, 0x9570e88f, 0xb810c865,
+0x000000a7, 0xe675d9c5, 0x1779e2c4, 0xf1830fe3,
+0xc5000000, 0xc5e4efd9, 0xc5e9f9d9, 0xc5f6f9d9,
+0xc87dd5d1, 0x0000abb8, 0xf9c1c500, 0x75c1c5f9,
+0x79e2c4fe, 0x830ffb17, 0x000000c8, 0x55f9e9c5,
+0xd5e9c5b8, 0xd5f1c5d1, 0xafb8c875, 0xc5000000,
+0xc5f1f9c9, 0xc4f275c9, 0xf31779e2, 0x00a2830f,
+0xd9c50000, 0xe88fd2f9, 0xc86d9550, 0x00b3b810,
+0xd1c50000, 0xe2c4ea75, 0x0feb1779, 0x00008383,
+0x6ff9c500, 0xd1c5c86d, 0xd1c5f9fd, 0xb8e855d5,
+0x000000bb, 0x55fde9c5, 0x75e9c5d8, 0x79e2c4d7,
+0x6073d317, 0xd5f9d9c5, 0xe7f9d9c5, 0x75d5e9c5,
+0x00c0b8e8, 0xc9c50000, 0xc5d875f9, 0xc4f475c9,
+0xf31779e2, 0xd1c53e73, 0xc5e865d5, 0xb8f1f9d1,
+0x000000c5, 0x65f9d9c5, 0x75d9c5d8, 0x79e2c4e6,
+0x2073e317, 0x55d5e9c5, 0xf9f1c5e8, 0x00cab8cd,
+0xe9c50000, 0xc5d855fd, 0xc4d175e9, 0xd31779e2,
+0xc0310273, 0x3155c3c9, 0x57e589c9, 0x10bb5356,
+0x81000000, 0x00009cec, 0xc1b70f00, 0x000008be,
+0x01788d00, 0xc889c629, 0x83ffbf0f, 0xbf0f01e0,
+0x01f883f6, 0x1901418d, 0x02e283d2, 0x75c8854a,
+0x89664b01, 0x83a6457c, 0x896608f8, 0x66b64574,
+0xc6455489, 0x455c8966, 0x890474d6, 0xc5baebc1,
+0xa8756ff9, 0xb57ff9c5, 0xffffff78, 0xc976f1c5,
+0x956ff9c5, 0xffffff78, 0x000539b8, 0x75e9c500,
+0x79e2c4de, 0x830fd917, 0x000004fb, 0x5dfde9c5,
+0x7ff9c5a8, 0xf9c5885d, 0xc5a8756f, 0x01f671e1,
+0x00053fb8, 0x75e1c500, 0xe2c4885d, 0x0fd91779,
+0x0004d283, 0x6ff9c500, 0xc9c58875, 0xc5a85df9,
+0x985d7ff9, 0x000544b8, 0x75e9c500, 0xe2c4985d,
+0x0fd91779, 0x0004ae83, 0x6ff9c500, 0xe9c5b875,
+0xc5a855d5, 0xc5e6d5c9, 0xa85d6ff9, 0xf6fde1c5,
+0x6df9e1c5, 0xf9e9c5b8, 0x055bb8d4, 0xd1c50000,
+0xe9c5eed5, 0xe2c4d575, 0x0fd11779, 0x00047683,
+0xd5e1c500, 0xc8b8b855, 0xc5000005, 0x001575e9,
+0xc4001007, 0xd11779e2, 0x0459830f, 0xe1c50000,
+0xc5c865e5, 0xc5d2efe9, 0xc86d6ff9, 0x0005cfb8,
+0x50e88f00, 0xc500d2cd, 0xc4d475e9, 0xd11779e2,
+0x0431830f, 0xd1c50000, 0xf9c5d3d5, 0xc598557f,
+0x98756ff9, 0xf671d9c5, 0x7ff9c503, 0xffff78a5,
+0x6ff9c5ff, 0xe9c59875, 0xc502f671, 0x88557ff9,
+0xd2fde9c5, 0x0005edb8, 0x75e9c500, 0x79e2c4d4,
+0x830fd117, 0x000003ef, 0xbd6ff9c5, 0xffffff78,
+0xe771e9c5, 0xfde9c502, 0x05f2b8d2, 0xe9c50000,
+0xc4885575, 0xd11779e2, 0x03c9830f, 0x85c70000,
+0xffffff74, 0x00000003, 0xe5d5e1c5, 0xff74858b,
+0x8589ffff, 0xffffff58, 0x891ff8c1, 0xffff5c85,
+0x7efac5ff, 0xffff58b5, 0xf1d9c5ff, 0x7485c7d6,
+0x02ffffff, 0x8b000000, 0xffff7485, 0x588589ff,
+0xc1ffffff, 0x85891ff8, 0xffffff5c, 0xbd7efac5,
+0xffffff58, 0xe7f1d9c5, 0x657ff9c5, 0xfdd9c588,
+0x0605b8e4, 0xd9c50000, 0xe2c4e275, 0x0fe11779,
+0x00035283, 0x74858b00, 0x89ffffff, 0xffff5885,
+0x1ff8c1ff, 0xff5c8589, 0xfac5ffff, 0xff58b57e,
+0xe9c5ffff, 0xe9c5d6e1, 0x09b8d2fd, 0xc5000006,
+0x885575e9, 0x1779e2c4, 0x18830fd1, 0xc5000003,
+0xc5f5d5e1, 0xc5e4efd9, 0xd87d6ff9, 0xd465c1c5,
+0xd6dbe9c5, 0x557ff9c5, 0xe8e98f98, 0xc5d87599,
+0x58b57ff9, 0xc5ffffff, 0x10356ff9, 0xc5001007,
+0xd87d6ff9, 0xfef9c1c5, 0x7d7ff9c5, 0xe8e98fd8,
+0xb8d85599, 0x00000621, 0xfafde9c5, 0xbd75c1c5,
+0xffffff58, 0x1779e2c4, 0xb8830ff9, 0xc5000002,
+0xd87df9d9, 0x000626b8, 0x40e98f00, 0xe9c5d299,
+0xc4985575, 0xd11779e2, 0x0299830f, 0xd1c50000,
+0xc5b855d5, 0xc5fbd5d1, 0x88557ff9, 0x55eec1c5,
+0xeac1c588, 0xf9c5887d, 0xc5887d7f, 0x8855fde9,
+0x00063db8, 0xfde1c500, 0xe9c5b87d, 0xe9c5d5d5,
+0xe2c4d775, 0x0fd11779, 0x00025a83, 0xd5d1c500,
+0x7ff9c5eb, 0xffff78ad, 0x0644b8ff, 0xe2c40000,
+0x78951d79, 0xc5ffffff, 0xc4da75e1, 0xd91779e2,
+0x0231830f, 0x49b80000, 0xc5000006, 0xc8556ff9,
+0x0949e2c4, 0x75e9c5da, 0x79e2c4db, 0x830fd917,
+0x00000213, 0x00064eb8, 0x70fbc500, 0xc51ba85d,
+0xb86d6ff9, 0xdb70fac5, 0x70f9c51b, 0xd1c54edb,
+0xe2c4db75, 0x0fd91779, 0x0001ea83, 0x71e1c500,
+0x53b801f5, 0xc5000006, 0xc5fef9e1, 0x201df9e1,
+0x8f001007, 0xffc178e8, 0xebe1c508, 0x6ff9c5df,
+0xe88fa87d, 0x30dfa340, 0xdd75e1c5, 0x1779e2c4,
+0xb0830fd9, 0xc5000001, 0xa85d61d1, 0x6d69d1c5,
+0xf9e1c5a8, 0x06a8b8dd, 0xe1c50000, 0xe1c5dad5,
+0x07301d75, 0xe2c40010, 0x0fd91779, 0x00018683,
+0xd5e9c500, 0xe88fa86d, 0x00e4cd68, 0xad7ff9c5,
+0xffffff78, 0xec61d1c5, 0xbd6ff9c5, 0xffffff78,
+0x2379e2c4, 0x06b3b8df, 0xd1c50000, 0xe2c4eb75,
+0x0fe91779, 0x00014e83, 0x61d9c500, 0x61e1c5e4,
+0x6ff9c5dc, 0xffff78ad, 0x79e2c4ff, 0xbbb8e524,
+0xc5000006, 0xc4e375d9, 0xe11779e2, 0x0125830f,
+0x8b660000, 0xf9c5ba45, 0xc5a86d6f, 0x886d7ff9,
+0xc9eff1c5, 0x7d6ff9c5, 0x65e9c5a8, 0x40e88fd1,
+0x20b84da2, 0xd276e9c5, 0x4d7ff9c5, 0x45896698,
+0x458b668a, 0x458966be, 0x458b668e, 0x458966c2,
+0x458b6692, 0x458966c6, 0x072ab896, 0xf9c50000,
+0xc5885d6f, 0xc4c975e1, 0xca1779e2, 0x00c5830f,
+0x3ab80000, 0xc5000007, 0xa84d6ff9, 0x0e71e3c4,
+0xc5aab865, 0xc4dc75e1, 0xda1779e2, 0x00a5830f,
+0xe3c40000, 0x02d90f71, 0x25dbf1c5, 0x00100740,
+0xe6fdd9c5, 0xdc75e1c5, 0x00074ab8, 0x7ff9c500,
+0xe2c48865, 0x73da1779, 0x0003b87e, 0xf9c50000,
+0xff788d7f, 0xe1c5ffff, 0x8f48dbef, 0x8dc678e9,
+0xffffff78, 0xc96be1c5, 0x8d7ff9c5, 0xffffff78,
+0xf9c5e875, 0x8307d1c5, 0x5eb824fa, 0x75000007,
+0x0767b846, 0xe98f0000, 0xb865e278, 0xe278e98f,
+0xf1c5a84d, 0xe98fcc6b, 0xc5c9c678, 0x8fcb6bf1,
+0xc9c678e9, 0xcb6bf1c5, 0xc678e98f, 0x6bf1c5c9,
+0xefe1c5cb, 0x75f1c5db, 0x79e2c4cb, 0x0773ca17,
+0xfff928e8, 0x81d8f7ff, 0x00009cc4, 0x5f5e5b00,
+0x0000c35d, 0x00000000, 0x00000000, 0x00000000,
+0x000e0008, 0x00140012, 0x00120014, 0x0008000e,
+0x00010001, 0x00010001, 0x00010001, 0x00010001,
+0x00020002, 0x00020002, 0x00020002, 0x00020002,
+0x00040004, 0x00040004, 0x00040004, 0x00040004,
+0x00070007, 0x00070007, 0x00070007, 0x00070007,
+0003520,
+};
+asm(".type xop_x86_32_D_16i2, STT_NOTYPE;");
+asm(".type xop_x86_32_D_16i2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_16u2[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x10b955c3,
+0x89000000, 0x57c031e5, 0xec815356, 0x0000009c,
+0xbbd0b70f, 0x00000008, 0xc789d329, 0x8901728d,
+0x01e283c2, 0xf8854a40, 0x0ff6b70f, 0xb70fdbb7,
+0x490175d2, 0x45748966, 0x08f883a6, 0x455c8966,
+0x548966b6, 0x8966c645, 0x75d6454c, 0x6ff9c5c3,
+0xf9c5a875, 0xff78b57f, 0xf1c5ffff, 0xf9c5c976,
+0xff789d6f, 0x39b8ffff, 0xc5000005, 0xc4d675e1,
+0xd11779e2, 0x040c830f, 0xe1c50000, 0xc5a855fd,
+0x88557ff9, 0x756ff9c5, 0x71e9c5a8, 0x3fb801f6,
+0xc5000005, 0x885575e9, 0x1779e2c4, 0xe3830fd1,
+0xc5000003, 0x88756ff9, 0x55f9c9c5, 0x7ff9c5a8,
+0x44b89855, 0xc5000005, 0x986575e1, 0x1779e2c4,
+0xbf830fe1, 0xc5000003, 0xb85debe1, 0x9d7ff9c5,
+0xffffff78, 0x55dbe9c5, 0x6ff9c5b8, 0xc1c5987d,
+0xb8b85def, 0x00000550, 0x95dfe9c5, 0xffffff78,
+0xd375e9c5, 0x1779e2c4, 0x87830fd1, 0xc5000003,
+0xa8556ff9, 0x5dd5e9c5, 0x05c8b8b8, 0xe1c50000,
+0x04b01d75, 0xe2c40010, 0x0fd91779, 0x00036583,
+0xe4e9c500, 0xe9c5c865, 0xc5c85ddb, 0xc85dfde1,
+0x0005d1b8, 0x75e1c500, 0x79e2c4dc, 0x830fd917,
+0x00000342, 0x557ff9c5, 0x6ff9c598, 0xd9c59875,
+0xc503f671, 0x78a57ff9, 0xc5ffffff, 0x987d6ff9,
+0xf771e1c5, 0x7ff9c502, 0xe1c5885d, 0xedb8dbfd,
+0xc5000005, 0xc4dc75e1, 0xd91779e2, 0x0304830f,
+0xf9c50000, 0xff78b56f, 0xe1c5ffff, 0xc502d671,
+0xb8dbfde1, 0x000005f2, 0x5d75e1c5, 0x79e2c488,
+0x830fd917, 0x000002de, 0xff7485c7, 0x0003ffff,
+0xf9c50000, 0xff749d6e, 0xe9c5ffff, 0x85c7dbf1,
+0xffffff74, 0x00000002, 0xa56ef9c5, 0xffffff74,
+0xe4f1e9c5, 0x657ff9c5, 0xfdd9c588, 0x0605b8e4,
+0xd9c50000, 0xe2c4e375, 0x0fe11779, 0x00029583,
+0x6ef9c500, 0xffff74a5, 0xd1e1c5ff, 0xfde1c5dc,
+0x0609b8db, 0xe1c50000, 0xc4885d75, 0xd91779e2,
+0x0270830f, 0xd1c50000, 0xf9c5edef, 0x8fd87d6f,
+0xddcd40e8, 0xdbe1c505, 0xe0e98fda, 0xc5d87599,
+0x58b57ff9, 0xc5ffffff, 0xc5f676c9, 0xd865fdc9,
+0x657ff9c5, 0xe0e98fd8, 0xb8d86599, 0x00000621,
+0xfcfdd9c5, 0xbd75c1c5, 0xffffff58, 0x1779e2c4,
+0x1f830ff9, 0xc5000002, 0xd86df9d1, 0x000626b8,
+0x50e98f00, 0xe1c5e495, 0xe2c4dc75, 0x0fd91779,
+0x00020183, 0x69e2c400, 0xc4b85d3a, 0x653e69e2,
+0xfde9c5b8, 0xe1c5b855, 0x34b8dcfd, 0xc5000006,
+0xc4d275e1, 0xd11779e2, 0x01d8830f, 0xf9c50000,
+0x04c01d6f, 0xf9c50010, 0xb8c8656f, 0x00000649,
+0x0961e2c4, 0x75e9c5d4, 0x79e2c4d4, 0x830fd117,
+0x000001b2, 0x00064eb8, 0x70fbc500, 0xc51ba86d,
+0xb8556ff9, 0xed70fac5, 0x70f9c51b, 0xe9c54eed,
+0xe2c4ed75, 0x0fe91779, 0x00018983, 0x71d1c500,
+0x53b801f2, 0xc5000006, 0xc5fbf9d1, 0xd02dfdd1,
+0x8f001004, 0xffc178e8, 0xebd1c508, 0x6ff9c5ef,
+0xe88fa87d, 0x50efa340, 0xea75d1c5, 0x1779e2c4,
+0x4f830fe9, 0xc5000001, 0xa86d61e9, 0x5569e9c5,
+0xfdc9c5a8, 0x06a8b8d2, 0xe9c50000, 0xe9c5d5f9,
+0xd9c5d4ef, 0xe9c5e6ef, 0xe9c5d4f9, 0x04e01575,
+0xe2c40010, 0x0fd11779, 0x00011983, 0x79e2c400,
+0xc4a86533, 0xd43379e2, 0x557ff9c5, 0x6ff9c598,
+0xe2c4a875, 0xb8d63379, 0x000006d3, 0xd475e9c5,
+0x1779e2c4, 0xeb830fd1, 0xc5000000, 0xa87d6ff9,
+0x3479e2c4, 0x06dab8d7, 0xe9c50000, 0xc4985575,
+0xd11779e2, 0x00cc830f, 0x8b660000, 0xf9c5ba45,
+0xc5a8756f, 0x88757ff9, 0x7d6ff9c5, 0x6ff9c5a8,
+0xe88fc875, 0xb855a240, 0x45896660, 0x458b668a,
+0x458966be, 0x458b668e, 0x458966c2, 0x458b6692,
+0x458966c6, 0x072ab896, 0xf9c50000, 0xc588656f,
+0xc4d275d9, 0xd11779e2, 0xd1c57c73, 0xf9c5ed76,
+0xb8a84d6f, 0x0000073a, 0x0e71e3c4, 0xc5aab855,
+0xc4e275d9, 0xe51779e2, 0xe3c45c73, 0x02d10f71,
+0x25dbf1c5, 0x001004f0, 0xdbfdd9c5, 0xd375e9c5,
+0x00074ab8, 0x79e2c400, 0x3a73d517, 0x000003ba,
+0x7ff9c500, 0xffff788d, 0xefe9c5ff, 0xe98f4ad2,
+0x788dd678, 0xc4ffffff, 0xc92b69e2, 0x8d7ff9c5,
+0xffffff78, 0xf9c5e775, 0x8307c1c5, 0x5eb824f8,
+0x0f000007, 0xc481c244, 0x0000009c, 0x5d5f5e5b,
+0x000000c3, 0x00000000, 0x00000000, 0x00000000,
+0x000e0008, 0x00140012, 0x00120014, 0x0008000e,
+0x00010001, 0x00010001, 0x00010001, 0x00010001,
+0xfffefffe, 0xfffefffe, 0xfffefffe, 0xfffefffe,
+0x00040004, 0x00040004, 0x00040004, 0x00040004,
+0x00070007, 0x00070007, 0x00070007, 0x00070007,
+0002400,
+};
+asm(".type xop_x86_32_D_16u2, STT_NOTYPE;");
+asm(".type xop_x86_32_D_16u2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_16i4[] = {
+0x83e58955, 0x78e8f0e4, 0xc9000001, 0xe58955c3,
+0xc738ec83, 0x0001c845, 0x45c70000, 0x000004d8,
+0xe845c700, 0x00000001, 0x02cc45c7, 0xc7000000,
+0x0003dc45, 0x45c70000, 0x000001ec, 0xd045c700,
+0x00000003, 0x02e045c7, 0xc7000000, 0x0001f045,
+0x45c70000, 0x000004d4, 0xe445c700, 0x00000001,
+0x01f445c7, 0xc5000000, 0xc5db76e1, 0xd84d6ff9,
+0x0000a7b8, 0x70e88f00, 0x10c8559e, 0x1576e9c5,
+0x001006b0, 0x1779e2c4, 0xf2830fd3, 0xc5000000,
+0xc5e4efd9, 0xb8d1fad9, 0x000000ab, 0x4069e2c4,
+0xd1c5c86d, 0xd1c5e9fa, 0x06c02d76, 0xe2c40010,
+0x0feb1779, 0x0000c883, 0x71e2c400, 0xb8c86d40,
+0x000000af, 0xe9fad1c5, 0x2d76d1c5, 0x001006d0,
+0x1779e2c4, 0xa6830feb, 0xb8000000, 0x000000b3,
+0x9e68e88f, 0xc510c855, 0xe01576e9, 0xc4001006,
+0xd31779e2, 0x0087830f, 0xf9c50000, 0xc5c86d6f,
+0xc4f9fed1, 0x554051e2, 0x00bbb8e8, 0xe9c50000,
+0xc5d855fe, 0xc4d776e9, 0xd31779e2, 0xd9c56373,
+0xd9c5d5fa, 0xe2c4e7fa, 0xe8754069, 0x0000c0b8,
+0xfac9c500, 0xc9c5d875, 0xe2c4f476, 0x73f31779,
+0x51e2c440, 0xc5e86540, 0xb8f1fad1, 0x000000c5,
+0x65fad9c5, 0x76d9c5d8, 0x79e2c4e6, 0x2173e317,
+0x4069e2c4, 0xf1c5e855, 0xcab8cdfa, 0xc5000000,
+0xd855fee9, 0xd176e9c5, 0x1779e2c4, 0x310273d3,
+0x55c3c9c0, 0x000020b9, 0x31e58900, 0x05bf57c0,
+0x56000000, 0x9cec8153, 0x89000000, 0x89fe89c3,
+0xe28340da, 0x83c62901, 0xd21901fa, 0x4a02e283,
+0x0175d885, 0x85448949, 0x04f883a4, 0xb4857489,
+0xc4855489, 0xd4854c89, 0xf9c5d175, 0xc5a87d6f,
+0x78bd7ff9, 0xc5ffffff, 0xc5c976f1, 0x78956ff9,
+0xb8ffffff, 0x00000539, 0xdf76e9c5, 0x1779e2c4,
+0xa8830fd9, 0xc5000004, 0xa85dfee9, 0x5d7ff9c5,
+0x6ff9c588, 0xe1c5a87d, 0xb801f772, 0x0000053f,
+0x5d76e1c5, 0x79e2c488, 0x830fd917, 0x0000047f,
+0x756ff9c5, 0xfac9c588, 0xf9c5a85d, 0xb8985d7f,
+0x00000544, 0x5d76e9c5, 0x79e2c498, 0x830fd917,
+0x0000045b, 0x7d6ff9c5, 0x69e2c4b8, 0xc4a85d40,
+0xe74041e2, 0x556ff9c5, 0xfee9c5a8, 0xfae9c5f7,
+0xe1c5b86d, 0x5bb8dcfa, 0xc4000005, 0xee4051e2,
+0xdd76e1c5, 0x1779e2c4, 0x20830fd9, 0xc4000004,
+0x5d4069e2, 0x05c8b8b8, 0xe1c50000, 0x06f01d76,
+0xe2c40010, 0x0fd91779, 0x00040283, 0xefe9c500,
+0xf9c5c85d, 0xf9c5d87e, 0xff789d7f, 0xe2c4ffff,
+0xb85d2861, 0x89b86df7, 0x458b9845, 0x9c5589c0,
+0x89806df7, 0xe1b8a045, 0x89000005, 0xe1c5a455,
+0xc4985d76, 0xd91779e2, 0x03c1830f, 0xe2c40000,
+0xc8654069, 0x657ff9c5, 0x6ff9c598, 0xd1c59875,
+0xc503f672, 0x78ad7ff9, 0xc5ffffff, 0x987d6ff9,
+0xf772e1c5, 0x7ff9c502, 0xe1c5885d, 0xedb8dbfe,
+0xc5000005, 0xc4dd76e1, 0xd91779e2, 0x037d830f,
+0xf9c50000, 0xff78b56f, 0xe1c5ffff, 0xc502e672,
+0xb8dbfee1, 0x000005f2, 0x5d76e1c5, 0x79e2c488,
+0x830fd917, 0x00000357, 0xff7485c7, 0x0003ffff,
+0x858b0000, 0xffffff74, 0xff608589, 0xf8c1ffff,
+0x6485891f, 0xc5ffffff, 0x60bd7efa, 0xc5ffffff,
+0xc7dff2d9, 0xffff7485, 0x000002ff, 0x74858b00,
+0x89ffffff, 0xffff6085, 0x1ff8c1ff, 0xff648589,
+0xfac5ffff, 0xff60b57e, 0xd9c5ffff, 0xf9c5e6f2,
+0xc588657f, 0xb8e4fed9, 0x00000605, 0xe376d9c5,
+0x1779e2c4, 0xe4830fe1, 0x8b000002, 0xffff7485,
+0x608589ff, 0xc1ffffff, 0x85891ff8, 0xffffff64,
+0xbd7efac5, 0xffffff60, 0xdfe2e1c5, 0xdbfee1c5,
+0x000609b8, 0x76e1c500, 0xe2c4885d, 0x0fd91779,
+0x0002aa83, 0x69e2c400, 0xc5c86d40, 0xc5e4efd9,
+0xd8756ff9, 0xdc66c9c5, 0xdddbe1c5, 0x5d7ff9c5,
+0xe0e98f98, 0xb8d8759a, 0x00000001, 0xf86ef9c5,
+0xef70f9c5, 0x6ff9c500, 0xc1c5d87d, 0xf9c5fdfa,
+0x8fd87d7f, 0x5d9ae0e9, 0x0621b8d8, 0xe1c50000,
+0xc1c5fbfe, 0xe2c4f676, 0x0ff11779, 0x00024e83,
+0xfad9c500, 0x26b8d875, 0x8f000006, 0xdb9a48e9,
+0x5d76e1c5, 0x79e2c498, 0x830fd917, 0x0000022f,
+0x756ff9c5, 0x49e2c4c8, 0xc4b85d40, 0xfa4049e2,
+0x5d7ff9c5, 0x41e2c488, 0xc4885d3d, 0x7d3941e2,
+0x7ff9c588, 0xe1c5887d, 0xb8885dfe, 0x0000063d,
+0x7dfee9c5, 0x61e2c4b8, 0xe1c5de40, 0xe2c4df76,
+0x0fd91779, 0x0001e683, 0x49e2c400, 0xf9c5f240,
+0xff78b57f, 0x44b8ffff, 0xc4000006, 0x9d1e79e2,
+0xffffff78, 0xd376e9c5, 0x1779e2c4, 0xbc830fd1,
+0xb8000001, 0x00000649, 0x556ff9c5, 0x51e2c4c8,
+0xe9c5ea0a, 0xe2c4ed76, 0x0fe91779, 0x00019e83,
+0x064eb800, 0xf9c50000, 0x1ba85d70, 0x6d6ff9c5,
+0x76d1c5b8, 0x79e2c4db, 0x830fd917, 0x0000017f,
+0x5d62d1c5, 0x6ad1c5a8, 0xe1c5a86d, 0x02b8ddfa,
+0xc4000000, 0xda4061e2, 0xf06ef9c5, 0x0006a8b8,
+0x70f9c500, 0xe1c500ee, 0xe2c4dd76, 0x0fd91779,
+0x00014a83, 0x69e2c400, 0x8fa85d40, 0xecce68e8,
+0x7ff9c500, 0xffff789d, 0x62e1c5ff, 0x6ff9c5ed,
+0xffff78b5, 0x79e2c4ff, 0xb3b8de25, 0xc5000006,
+0xc4dd76e1, 0xd91779e2, 0x0111830f, 0x458b0000,
+0x6ff9c5bc, 0xf9c5a87d, 0xc5887d7f, 0xc5d466e9,
+0xa8656ff9, 0xa258e88f, 0xc520b855, 0x98557ff9,
+0x8b8c4589, 0x4589c445, 0x072ab894, 0xf9c50000,
+0xc5885d6f, 0xc4d276e1, 0xd11779e2, 0x00cd830f,
+0x3ab80000, 0xc5000007, 0xa8556ff9, 0x0e69e3c4,
+0xc5ccb865, 0xc4dc76e1, 0xd91779e2, 0x00ad830f,
+0x03b80000, 0xc4000000, 0xda0f69e3, 0x6ef9c504,
+0x0001b8e0, 0xf9c50000, 0xc500cc70, 0xc5e06ef9,
+0xc5c9dbe9, 0x00e470f9, 0xccfef1c5, 0x00074ab8,
+0x7ff9c500, 0xe1c5884d, 0xe1c5c976, 0xe2c4db76,
+0x73cb1779, 0x7ff9c56a, 0xffff7895, 0xefe9c5ff,
+0x69e2c4d2, 0xff788d02, 0xf9c5ffff, 0xff788d7f,
+0xe2c4ffff, 0x788d0269, 0xb8ffffff, 0x0000075e,
+0x1679e3c4, 0xfa8303ca, 0x7ff9c50a, 0xffff788d,
+0xc52c75ff, 0xa8656ff9, 0x0659e2c4, 0x67b8b84d,
+0xc4000007, 0xca0271e2, 0x0271e2c4, 0x76f1c5ca,
+0x79e2c4ca, 0x0773cb17, 0xfff970e8, 0x81d8f7ff,
+0x00009cc4, 0x5f5e5b00, 0x0000c35d, 0x00000000,
+0x00000008, 0x00000009, 0x00000008, 0x00000005,
+0xfffffff8, 0xfffffff7, 0xfffffff8, 0xfffffffb,
+0x00000000, 0x00000003, 0x00000004, 0x00000003,
+0x00000000, 0xfffffffd, 0xfffffffc, 0xfffffffd,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0003400,
+};
+asm(".type xop_x86_32_D_16i4, STT_NOTYPE;");
+asm(".type xop_x86_32_D_16i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_16u4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0x20ba55c3,
+0x89000000, 0x57c031e5, 0x000005bf, 0x81535600,
+0x00009cec, 0x89c38900, 0x40d989fe, 0x2901e183,
+0xd88549c6, 0x894a0175, 0x83a48544, 0x748904f8,
+0x4c89b485, 0x5489c485, 0xd975d485, 0x756ff9c5,
+0x7ff9c5a8, 0xffff78b5, 0x76f1c5ff, 0x6ff9c5c9,
+0xffff789d, 0x0539b8ff, 0xe1c50000, 0xe2c4d676,
+0x0fd11779, 0x0003f083, 0xfee1c500, 0xf9c5a855,
+0xc588557f, 0xa87d6ff9, 0xf772e9c5, 0x053fb801,
+0xe9c50000, 0xc4885576, 0xd11779e2, 0x03c7830f,
+0xf9c50000, 0xc588756f, 0xa855fac9, 0x557ff9c5,
+0x0544b898, 0xe1c50000, 0xc4986576, 0xe11779e2,
+0x03a3830f, 0xe1c50000, 0xc5b85deb, 0x789d7ff9,
+0xc5ffffff, 0xb855dbe9, 0x7d6ff9c5, 0xefc1c598,
+0x50b8b85d, 0xc5000005, 0x7895dfe9, 0xc5ffffff,
+0xc4d376e9, 0xd11779e2, 0x036b830f, 0xf9c50000,
+0xc4a85d6f, 0x554061e2, 0x05c8b8b8, 0xe9c50000,
+0x04801576, 0xe2c40010, 0x0fd11779, 0x00034883,
+0xefe1c500, 0xf9c5c855, 0xf9c5d07e, 0xff78957f,
+0xe9c5ffff, 0xf7b855f4, 0x4589b865, 0xc0458b98,
+0xf79c5589, 0x45898065, 0x05e1b8a0, 0x55890000,
+0x76e9c5a4, 0xe2c49855, 0x0fd11779, 0x00030883,
+0x7ff9c500, 0xf9c5985d, 0xc598756f, 0x03f672d9,
+0xa57ff9c5, 0xffffff78, 0x7d6ff9c5, 0x72e9c598,
+0xf9c502f7, 0xc588557f, 0xb8d2fee9, 0x000005ed,
+0xd476e9c5, 0x1779e2c4, 0xca830fd1, 0xc5000002,
+0x78b56ff9, 0xc5ffffff, 0x02d672e9, 0xd2fee9c5,
+0x0005f2b8, 0x76e9c500, 0xe2c48855, 0x0fd11779,
+0x0002a483, 0x7485c700, 0x03ffffff, 0xc5000000,
+0x74956ef9, 0xc5ffffff, 0xc7d2f2e1, 0xffff7485,
+0x000002ff, 0x6ef9c500, 0xffff74a5, 0xf2e1c5ff,
+0x7ff9c5e4, 0xd9c58865, 0x05b8e4fe, 0xc5000006,
+0xc4e276d9, 0xe11779e2, 0x025b830f, 0xf9c50000,
+0xff74a56e, 0xe9c5ffff, 0xe9c5d4d2, 0x09b8d2fe,
+0xc5000006, 0x885576e9, 0x1779e2c4, 0x36830fd1,
+0xc5000002, 0xc5edefd1, 0xd87d6ff9, 0xce40e88f,
+0xe9c505d5, 0xe98fd3db, 0xd8759ae8, 0xb57ff9c5,
+0xffffff58, 0xf676c9c5, 0x65fec9c5, 0x7ff9c5d8,
+0xe98fd865, 0xd8659ae8, 0x000621b8, 0xfed9c500,
+0x76c1c5fc, 0xffff58bd, 0x79e2c4ff, 0x830ff917,
+0x000001e5, 0x6dfad1c5, 0x0626b8d8, 0xe98f0000,
+0xc5e49650, 0xc4d476e9, 0xd11779e2, 0x01c7830f,
+0xe2c40000, 0xb8553b61, 0x3f61e2c4, 0xe1c5b865,
+0xc5b85dfe, 0xb8d4fee9, 0x00000634, 0xd376e9c5,
+0x1779e2c4, 0x9e830fd1, 0xb8000001, 0x00000001,
+0x656ff9c5, 0x6ef9c5c8, 0x0649b8f8, 0xf9c50000,
+0xc400df70, 0xd40a61e2, 0xd476e9c5, 0x1779e2c4,
+0x72830fd1, 0xb8000001, 0x0000064e, 0x6d70f9c5,
+0xf9c51ba8, 0xc5b8556f, 0xc4ed76e9, 0xe91779e2,
+0x0153830f, 0xe9c50000, 0xc5a86d62, 0xa8556ae9,
+0xd2fec9c5, 0x000002b8, 0xfae9c500, 0xefe9c5d5,
+0xefd9c5d4, 0xfae9c5e6, 0x6ef9c5d4, 0x06a8b8f0,
+0xf9c50000, 0xc500e670, 0xc4d476e9, 0xd11779e2,
+0x0113830f, 0xe2c40000, 0xa8653579, 0x7d6ff9c5,
+0x79e2c4a8, 0xd3b8d735, 0xc5000006, 0xc4d476e9,
+0xd11779e2, 0x00ef830f, 0x458b0000, 0x6ff9c5bc,
+0xf9c5a875, 0xc588757f, 0xc86d6ff9, 0x7d6ff9c5,
+0x40e88fa8, 0x50b855a2, 0x8b8c4589, 0x4589c445,
+0x072ab894, 0xf9c50000, 0xc5886d6f, 0xc4d276d1,
+0xd11779e2, 0x00af830f, 0x3ab80000, 0xc5000007,
+0xa8656ff9, 0x0e59e3c4, 0xc5ccb855, 0xc4ea76d1,
+0xe91779e2, 0x008f830f, 0x03b80000, 0xc4000000,
+0xec0f59e3, 0x6ef9c504, 0x70f9c5f0, 0xd9c500d6,
+0xe9c5d2db, 0x4ab8d3fe, 0xc5000007, 0xc4d276d1,
+0xd11779e2, 0xf9c56373, 0xff78a57f, 0xe1c5ffff,
+0xe2c4dbef, 0x78950261, 0xc5ffffff, 0x78957ff9,
+0xc4ffffff, 0x950261e2, 0xffffff78, 0x00075eb8,
+0x79e3c400, 0x8303d216, 0x2d750afa, 0x7d6ff9c5,
+0x41e2c4a8, 0x31b85506, 0x69e2c4c0, 0xe2c4d302,
+0xc5d30269, 0xc4d376e9, 0xd11779e2, 0x83c0920f,
+0xc01901f8, 0x00076725, 0x9cc48100, 0x5b000000,
+0xc35d5f5e, 0x00000000, 0x00000000, 0x00000000,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0002220,
+};
+asm(".type xop_x86_32_D_16u4, STT_NOTYPE;");
+asm(".type xop_x86_32_D_16u4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_16i8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0xec81e589, 0x00000088, 0x31ec4589, 0x89d231c0,
+0xc031d445, 0x4589c931, 0xc7c031e4, 0x0001c845,
+0x55890000, 0xd845c7cc, 0x00000002, 0xc7dc4d89,
+0x003fe845, 0x45c70000, 0x000002d0, 0xe045c700,
+0x00000001, 0x3ef045c7, 0x89000000, 0xf9c5f445,
+0xc5c86d6f, 0x986d7ff9, 0xd276e9c5, 0x4d6ff9c5,
+0x0539b898, 0xe2c40000, 0xc4dd2971, 0xda1779e2,
+0x038b830f, 0xf1c50000, 0xc5c85dd4, 0xa85d7ff9,
+0x756ff9c5, 0x73e1c5c8, 0x3fb801f6, 0xc4000005,
+0x5d2961e2, 0x79e2c4a8, 0x830fda17, 0x00000361,
+0x6d6ff9c5, 0xfbd1c5a8, 0xf9c5c85d, 0xb8b85d7f,
+0x00000544, 0x2971e2c4, 0xe2c4b85d, 0x0fda1779,
+0x00033c83, 0x70f9c500, 0xe2c4b1d9, 0xc85d4061,
+0x4df4f1c5, 0x78e98fc8, 0xe1c5dbcb, 0xc520f373,
+0xc5cbd4f1, 0xd85d6ff9, 0xe370f9c5, 0x59e2c4b1,
+0xe1c5e340, 0xe98fdbf4, 0xc5e4cb78, 0x20f473d9,
+0xdcd4e1c5, 0x6d6ff9c5, 0xd4d1c5c8, 0xd1c5d87d,
+0xc5d875fb, 0xb8cbfbf1, 0x0000055b, 0xe670f9c5,
+0x59e2c4b1, 0xc9c5e740, 0xe98ff7f4, 0xc5e4cb78,
+0x20f473d9, 0xf4d4c9c5, 0x2971e2c4, 0x79e2c4ce,
+0x830fca17, 0x000002b9, 0xcd70f9c5, 0x71e2c4b1,
+0x8fd85d40, 0xdbcb78e9, 0xf373d9c5, 0xf4d1c520,
+0xe1c5d85d, 0xc8b8dcd4, 0xc4000005, 0x1d2961e2,
+0x00100420, 0x1779e2c4, 0x82830fda, 0xc7000002,
+0x00018045, 0xc0310000, 0xc5844589, 0x805d7efa,
+0x1d16e0c5, 0x00100450, 0x4071e2c4, 0xf4d1c5cb,
+0x78e98ff3, 0xf1c5c9cb, 0xc520f173, 0xc5c9d4c9,
+0xb84d7ff9, 0x7d6ff9c5, 0x73c1c5b8, 0xf9c503f7,
+0xc5987d7f, 0xb8656ff9, 0xf473d9c5, 0x7ff9c502,
+0xd9c5a865, 0xedb8e4d4, 0xc4000005, 0xe72959e2,
+0x1779e2c4, 0x16830fe2, 0xc5000002, 0x30256ff9,
+0x8f001004, 0x659b58e9, 0xd4d9c598, 0x05f2b8e4,
+0xe2c40000, 0xa8652959, 0x1779e2c4, 0xee830fe2,
+0xc7000001, 0x00039445, 0x458b0000, 0x80458994,
+0x84558999, 0x7d7efac5, 0xf3f1c580, 0x9445c7e7,
+0x00000002, 0x8994458b, 0xf8c18045, 0x8445891f,
+0x7d7efac5, 0xf3f1c580, 0x7ff9c5cf, 0xf1c5a84d,
+0x05b8c9d4, 0xc4000006, 0xcc2971e2, 0x1779e2c4,
+0x9a830fca, 0x8b000001, 0xf1c59445, 0x4589c9ef,
+0x55899980, 0x12fbc584, 0xf1c5807d, 0xe98ffffb,
+0xc5e49b40, 0xb8e4d4d9, 0x00000609, 0x2959e2c4,
+0xe2c4a865, 0x0fe21779, 0x00016483, 0x70f9c500,
+0xe2c4b1e3, 0xc5e54059, 0xe86d6ff9, 0xcb78e98f,
+0x73d9c5e4, 0xe2c420f4, 0xc5c93751, 0xc5f4d4c9,
+0xc5cedbf1, 0xb84d7ff9, 0x9bf0e98f, 0xf9c5e86d,
+0x0440256f, 0xf9c50010, 0xc5e8756f, 0xc5f4fbc9,
+0xe8757ff9, 0x9bf0e98f, 0x21b8e84d, 0xc5000006,
+0xa84d7ff9, 0xc9d4f1c5, 0x2971e2c4, 0x79e2c4cd,
+0x830fca17, 0x000000f9, 0xf6efc9c5, 0x4dfbc9c5,
+0x0626b8e8, 0xe98f0000, 0xa84d9b70, 0x2971e2c4,
+0xe2c4b84d, 0x0fca1779, 0x0000d483, 0x064eb800,
+0xf9c50000, 0x4ec84d70, 0x6d6ff9c5, 0x51e2c4d8,
+0xe2c4c929, 0x0fca1779, 0x0000b483, 0x6cd1c500,
+0xd1c5c84d, 0xc5c87d6d, 0xb8cffbf1, 0x000006a8,
+0xf970f9c5, 0x41e2c4b1, 0xf1c5fb40, 0xe98fcbf4,
+0xc5ffcb78, 0x20f773c1, 0xcfd4f1c5, 0x2971e2c4,
+0x79e2c4cc, 0x7973ca17, 0x7d6ff9c5, 0x7efac5c8,
+0xf9c5e04d, 0xc4a87d7f, 0xde3761e2, 0x4dd6f9c5,
+0x072ab8b0, 0xe88f0000, 0x30cda240, 0x5d6ff9c5,
+0x61e2c4a8, 0xe2c4c929, 0x73ca1779, 0x073ab844,
+0xf9c50000, 0xc4c84d6f, 0x6d0e71e3, 0xe2c4f0d8,
+0xc4dd2961, 0xda1779e2, 0xe3c42773, 0x08d90f71,
+0xf1c5c031, 0xf1c5ccdb, 0xe2c4ccd4, 0xc4cb2971,
+0xca1779e2, 0x83c0920f, 0xc01901f8, 0x00074a25,
+0x00c3c900, 0x00000000, 0x00000000, 0x00000000,
+0x00000002, 0x00000000, 0x00000002, 0x00000000,
+0xfffffffe, 0xffffffff, 0xfffffffe, 0xffffffff,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0xffffffff, 0xffffffff,
+0002130,
+};
+asm(".type xop_x86_32_D_16i8, STT_NOTYPE;");
+asm(".type xop_x86_32_D_16i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_16u8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0xec81e589, 0x00000088, 0x31cc4589, 0x89d231c0,
+0xc031d445, 0x4589c931, 0xc7c031e4, 0x0001c845,
+0x45c70000, 0x000002d8, 0xdc558900, 0x3fe845c7,
+0x89000000, 0x45c7ec4d, 0x000002d0, 0xe045c700,
+0x00000001, 0x3ef045c7, 0x89000000, 0xf9c5f445,
+0xc5c8756f, 0x98757ff9, 0xc976f1c5, 0x5d6ff9c5,
+0x0539b898, 0xe2c40000, 0xc4d62961, 0xd11779e2,
+0x02d7830f, 0xe1c50000, 0xc5c855d4, 0xa8557ff9,
+0x7d6ff9c5, 0x73e9c5c8, 0x3fb801f7, 0xc4000005,
+0x552969e2, 0x79e2c4a8, 0x830fd117, 0x000002ad,
+0x756ff9c5, 0xfbc9c5a8, 0xf9c5c855, 0xb8b8557f,
+0x00000544, 0x2961e2c4, 0xe2c4b865, 0x0fe11779,
+0x00028883, 0xebe1c500, 0xf9c5d85d, 0xc5985d7f,
+0xd855dbe9, 0x7d6ff9c5, 0xefc1c5b8, 0x50b8d85d,
+0xc5000005, 0xc5d1efe9, 0x9855dbe9, 0x2969e2c4,
+0x79e2c4d3, 0x830fd117, 0x00000251, 0x556ff9c5,
+0x70f9c5c8, 0xe2c4b1da, 0xd85d4061, 0xcb78e98f,
+0x73d9c5db, 0xe9c520f3, 0xc5d85df4, 0xb8dcd4e1,
+0x000005c8, 0x2961e2c4, 0x1003601d, 0x79e2c400,
+0x830fd917, 0x00000215, 0x557ff9c5, 0x6ff9c5b8,
+0xd9c5b875, 0xc503f673, 0x98657ff9, 0x7d6ff9c5,
+0x73e1c5b8, 0xf9c502f7, 0xc5a85d7f, 0xb8dbd4e1,
+0x000005ed, 0x2961e2c4, 0x79e2c4dc, 0x830fd917,
+0x000001d9, 0x756ff9c5, 0x73e1c598, 0xe1c502d6,
+0xf2b8dbd4, 0xc4000005, 0x5d2961e2, 0x79e2c4a8,
+0x830fd917, 0x000001b5, 0x039445c7, 0xc5000000,
+0x945d6ef9, 0xdbf3e9c5, 0x029445c7, 0xc5000000,
+0x94656ef9, 0xd4f3e9c5, 0x557ff9c5, 0xd4e9c5a8,
+0x0605b8d2, 0xe2c40000, 0xc4d32969, 0xd11779e2,
+0x0177830f, 0xf9c50000, 0xc594556e, 0xc5d2d3e1,
+0xb8d2d4e9, 0x00000609, 0x2969e2c4, 0xe2c4a855,
+0x0fd11779, 0x00015483, 0x6ff9c500, 0xe9c5e87d,
+0xe88fd2ef, 0x05d2cf40, 0x55dbe9c5, 0x7ff9c5c8,
+0xe98fb855, 0xe85d9be8, 0x65d4f1c5, 0x7ff9c5e8,
+0xe98fe865, 0xe8559be8, 0x000621b8, 0x7ff9c500,
+0xe9c5a855, 0xe2c4d2d4, 0xc4d32969, 0xd11779e2,
+0x0107830f, 0xe9c50000, 0xe9c5d2ef, 0xb8e855fb,
+0x00000626, 0x9768e98f, 0xe2c4a855, 0xb8552969,
+0x1779e2c4, 0xe2830fd1, 0xb8000000, 0x0000064e,
+0x5570f9c5, 0xf9c54ec8, 0xc4d8656f, 0xd22959e2,
+0x1779e2c4, 0xc2830fd1, 0xc7000000, 0xffff8045,
+0x45c7ffff, 0xffffff84, 0x7efac5ff, 0xfac5805d,
+0xd9c5db7e, 0xc5c86d6c, 0xc8556dd9, 0xd2d4f1c5,
+0x0006a8b8, 0xfbe9c500, 0xefe1c5d5, 0xefe9c5e9,
+0xfbe9c5d3, 0x6ff9c5d5, 0x1003702d, 0x69e2c400,
+0xe2c4d529, 0x73d11779, 0x6ff9c574, 0xfac5c875,
+0xc5e0557e, 0xa8757ff9, 0x00072ab8, 0xd6f9c500,
+0xe88fb055, 0x30d4a248, 0x5d6ff9c5, 0x61e2c4a8,
+0xe2c4d229, 0x73d11779, 0x073ab844, 0xf9c50000,
+0xc4c8556f, 0x650e69e3, 0xe2c4f0d8, 0xc4dc2961,
+0xd91779e2, 0xe3c42773, 0x08da0f69, 0xe9c5c031,
+0xe9c5d5db, 0xe2c4d5d4, 0xc4d32969, 0xd11779e2,
+0x83c0920f, 0xc01901f8, 0x00074a25, 0x00c3c900,
+0x00000002, 0x00000000, 0x00000002, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0001600,
+};
+asm(".type xop_x86_32_D_16u8, STT_NOTYPE;");
+asm(".type xop_x86_32_D_16u8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_16f4[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xe8d955c3,
+0xec81e589, 0x00000088, 0xd9c855d9, 0x10056005,
+0x10fac500, 0x1005641d, 0xd855d900, 0x55d9c9d9,
+0x11fac5e8, 0x05d9cc5d, 0x00100568, 0x5d11fac5,
+0xdc55d9e0, 0xe0d9e8d9, 0xd9ec55d9, 0xd05dd9c9,
+0x55d9c9d9, 0xd9cad9f0, 0xc9d9d45d, 0xd9e45dd9,
+0xf8c5f45d, 0xc5c87d28, 0x987d29f8, 0x6528f8c5,
+0x76f1c598, 0x0539b8c9, 0xd8c50000, 0xc400d7c2,
+0xd10e79e2, 0x04c5830f, 0xd8c50000, 0xc5c85558,
+0xa85529f8, 0x7d28f8c5, 0x053fb8c8, 0xc0c50000,
+0xe8c5d758, 0x00a855c2, 0x0e79e2c4, 0x9c830fd1,
+0xc5000004, 0xa87d28f8, 0x555cc0c5, 0x29f8c5c8,
+0xd8c5b855, 0x00b855c2, 0x000544b8, 0x79e2c400,
+0x830fd10e, 0x00000477, 0x7d28f8c5, 0x59d8c5d8,
+0xc0c5c865, 0xf8c5ef59, 0xc5c85528, 0xc5ff58e8,
+0xd8755ce8, 0x00055bb8, 0x5cd8c500, 0x59c8c5e5,
+0xc2d8c5f7, 0xe2c400e6, 0x0fe10e79, 0x00043e83,
+0x59e8c500, 0xf8c5e865, 0xc5986529, 0xe8555ee8,
+0x000564b8, 0xc2d8c500, 0xe2c400e2, 0x0fe10e79,
+0x00041a83, 0x79e2c400, 0x05702d18, 0x67b80010,
+0xc5000005, 0xe86528f8, 0xd557d8c5, 0x5559e8c5,
+0x57d0c598, 0xe8c5c86d, 0xc400d5c2, 0xd10e79e2,
+0x03e9830f, 0xf9c50000, 0xc5c8555b, 0xc5d25bf8,
+0xc855c2e8, 0x056eb800, 0xe2c40000, 0x0fd10e79,
+0x0003ca83, 0x53f8c500, 0xf8c5c855, 0xc5985529,
+0x985553f8, 0x000575b8, 0x28f8c500, 0xf9c5c86d,
+0xf8c5d25b, 0xe8c5d25b, 0xc400d5c2, 0xd10e79e2,
+0x0399830f, 0xd0c50000, 0xf8c5d559, 0xc5985529,
+0x985552f8, 0x5529f8c5, 0x28f8c5a8, 0x7cb8a855,
+0xc5000005, 0xc5f253f8, 0xc5f65bf9, 0xc5f65bf8,
+0x00eec2d0, 0x0e79e2c4, 0x60830fe9, 0xc5000003,
+0xc86d28f8, 0xd25bf9c5, 0x00057eb8, 0x5bf8c500,
+0x53f8c5d2, 0x5bf9c5f5, 0x5bf8c5f6, 0xc2e8c5f6,
+0xe2c400d6, 0x0fd10e79, 0x00033283, 0x59d0c500,
+0x29f8c5d5, 0xf8c59855, 0xb8985551, 0x0000059c,
+0xd5c2e8c5, 0x79e2c400, 0x830fd10e, 0x0000030f,
+0x1879e2c4, 0x10059015, 0x5ee8c500, 0x29f8c5ed,
+0xe3c4986d, 0x986d0879, 0xc2d0c50b, 0x1005902d,
+0xa4b80000, 0xc4000005, 0xe90e79e2, 0x02dd830f,
+0xe98f0000, 0xc8758078, 0xed57d0c5, 0x0005abb8,
+0xc2c8c500, 0xe2c400f5, 0x0ff10e79, 0x0002be83,
+0x58e8c500, 0xe8c5c875, 0xf8c5d65e, 0x8f985529,
+0x558078e9, 0xc2e8c598, 0xb8009855, 0x000005b1,
+0x0e79e2c4, 0x94830fd1, 0xc4000002, 0x151879e2,
+0x00100574, 0x5559e8c5, 0x29f8c5c8, 0xe3c49855,
+0x98550879, 0x78e98f0b, 0xc5987580, 0xb8d658e8,
+0x000005bb, 0x55c2e8c5, 0xe2c40098, 0x0fd10e79,
+0x00025a83, 0x59d8c500, 0xd8c5d855, 0xc5c87559,
+0xa85529f8, 0x555fc8c5, 0x5dc8c5a8, 0xf8c5a875,
+0xc5a87529, 0xa85558e8, 0x00063db8, 0x28f8c500,
+0xe8c5c87d, 0xc0c5d459, 0xc5d87558, 0x00d6c2e8,
+0x0e79e2c4, 0x14830fd1, 0xc4000002, 0x550479e3,
+0x4eb81bc8, 0xc5000006, 0xd855c2e8, 0x79e2c400,
+0x830fd10e, 0x000001f7, 0x7528f8c5, 0x0003b8d8,
+0xf9c50000, 0xf9c5f86e, 0xb800ff70, 0x00000653,
+0xd65bf9c5, 0xd7fee9c5, 0x4851e3c4, 0xc520c86d,
+0x00edc2c8, 0x0e79e2c4, 0xc0830fe9, 0xc5000001,
+0xc87d28f8, 0x00065db8, 0x58c0c500, 0x79e2c4d6,
+0x05782d18, 0xe8c50010, 0xc400d5c2, 0xd10e79e2,
+0x0199830f, 0xc8c50000, 0xc5c85514, 0xc87515c8,
+0xd65ce8c5, 0x0006a6b8, 0xc6e0c500, 0xe8c500db,
+0xe8c5d459, 0xc400d3c2, 0xd10e79e2, 0x016d830f,
+0xfac50000, 0xc4c85512, 0x1d1879e2, 0x0010056c,
+0x000717b8, 0x58e0c500, 0x79e2c4dc, 0x057c3518,
+0xe0c50010, 0xe8c5de59, 0xc5c8555c, 0x00d3c2e8,
+0x0e79e2c4, 0x34830fd1, 0xc5000001, 0xc85d16fa,
+0x1879e2c4, 0x1005902d, 0x071eb800, 0xd8c50000,
+0xf8c5ed58, 0xc5c85528, 0xc5ee59d0, 0xc5da5ce0,
+0x00ddc2e0, 0x0e79e2c4, 0x00830fd9, 0xd9000001,
+0xe0c5dc45, 0x2ab8db57, 0xc5000007, 0xa85529f8,
+0xe4c2e0c5, 0xac5dd901, 0x8fe445d9, 0x55a268e8,
+0x5dd940d8, 0x28f8c5b4, 0xd8c5a865, 0xc400d2c2,
+0xd10e79e2, 0x00c5830f, 0xf8c50000, 0xb8c87d28,
+0x0000073a, 0x0c41e3c4, 0xc50ad855, 0x00e2c2d8,
+0x0e79e2c4, 0xa4830fe1, 0xc5000000, 0xc87d28f8,
+0x55d0c3c5, 0x28f8c5d8, 0x43b8c87d, 0xc5000007,
+0xd865d0c3, 0xd4c2e8c5, 0x79e2c400, 0x7f73d10e,
+0x6528f8c5, 0x0752b8c8, 0xe3c40000, 0xd8554059,
+0xc2e8c5f1, 0x1005a015, 0xe2c40000, 0x73d10e79,
+0x29f8c55e, 0xe3c59865, 0xc598557c, 0x985529f8,
+0x557ce3c5, 0x8005d998, 0xc4001005, 0x551779e3,
+0x45d90384, 0xdde9df84, 0x752f7ad8, 0x28f8c52d,
+0xc031c87d, 0x557dc3c5, 0x7cebc5d8, 0x7cebc5d3,
+0xc2e8c5d3, 0xe2c400d3, 0x0fd10e79, 0xf883c092,
+0x25c01901, 0x00000767, 0x5eb805eb, 0xc9000007,
+0x000000c3, 0x00000000, 0x00000000, 0x00000000,
+0x40800000, 0x40000000, 0x40400000, 0xbf800000,
+0x80000000, 0x3e800000, 0x40a00000, 0x3f000000,
+0x41200000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x41a00000, 0x00000000, 0x00000000, 0x00000000,
+0002660,
+};
+asm(".type xop_x86_32_D_16f4, STT_NOTYPE;");
+asm(".type xop_x86_32_D_16f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_16f8[] = {
+0x83e58955, 0x02e8f0e4, 0xc9000000, 0xc03155c3,
+0xe589e8d9, 0x0088ec81, 0x55dd0000, 0x0005d9b8,
+0xdd001005, 0xc9d9c855, 0xdde04589, 0xc9d9d855,
+0x00e445c7, 0xddbff000, 0x5dddc05d, 0x28f9c5d0,
+0xf9c5b87d, 0xc5887d29, 0xc5c976f1, 0x885528f9,
+0x000539b8, 0xc2e9c500, 0xe2c400df, 0x0fd90f79,
+0x00049783, 0x58e9c500, 0xf9c5b85d, 0xb8985d29,
+0x0000053f, 0x7d28f9c5, 0x58c1c5b8, 0xc2e1c5df,
+0xc400985d, 0xd90f79e2, 0x046e830f, 0xf9c50000,
+0xc5987d28, 0xb85d5cc1, 0x5d29f9c5, 0x0544b8a8,
+0xe9c50000, 0x00a85dc2, 0x0f79e2c4, 0x49830fd9,
+0xc5000004, 0xc87d28f9, 0x5559e9c5, 0x59c1c5b8,
+0x28f9c5e7, 0xe1c5b85d, 0x5bb8f758, 0xc5000005,
+0xc86d5ce1, 0xd45ce9c5, 0xee59d1c5, 0xd5c2e9c5,
+0x79e2c400, 0x830fd10f, 0x00000410, 0x5559e1c5,
+0x29f9c5d8, 0x64b88855, 0xc5000005, 0xd85d5ee1,
+0xd3c2e9c5, 0x79e2c400, 0x830fd10f, 0x000003ec,
+0x2512fbc5, 0x00100508, 0x5d28f9c5, 0x0567b8d8,
+0xe1c50000, 0xd9c5d457, 0xc5b86557, 0x885559e9,
+0xd4c2e9c5, 0x79e2c400, 0x830fd10f, 0x000003bc,
+0x55e6fbc5, 0xe6fac5b8, 0x056eb8d2, 0xe9c50000,
+0x00b855c2, 0x0f79e2c4, 0x9d830fd1, 0xc5000003,
+0xb8555af9, 0xd253f8c5, 0xd25af8c5, 0x5529f9c5,
+0x5af9c588, 0xf8c58855, 0xf9c5d253, 0xb8b86d28,
+0x00000575, 0xd25af8c5, 0xd2e6fbc5, 0xd2e6fac5,
+0xd5c2e9c5, 0x79e2c400, 0x830fd10f, 0x0000035c,
+0xd559d1c5, 0x5529f9c5, 0x5af9c588, 0xf8c58855,
+0xf8c5d252, 0xf9c5d25a, 0xc5985529, 0x986528f9,
+0xd45af9c5, 0x00057cb8, 0x53f8c500, 0x5af8c5d2,
+0xe6fbc5d2, 0xe6fac5d2, 0xc2d1c5d2, 0xe2c400ea,
+0x0fe90f79, 0x00031383, 0x28f9c500, 0xf9c5b86d,
+0xfbc5d55a, 0x7eb8e4e6, 0xc5000005, 0xc5e4e6fa,
+0xc5d253f8, 0xc5d25af8, 0xc5d2e6fb, 0xc5d2e6fa,
+0x00e2c2d9, 0x0f79e2c4, 0xdd830fe1, 0xc5000002,
+0xc5d559d1, 0x885529f9, 0x00059cb8, 0x51f9c500,
+0xe9c58855, 0xc400d5c2, 0xd10f79e2, 0x02ba830f,
+0xfbc50000, 0x05302512, 0xd9c50010, 0xf9c5ed5e,
+0xb8886d29, 0x000005a4, 0x0979e3c4, 0xc50b8855,
+0x3015c2e9, 0x00001005, 0x0f79e2c4, 0x89830fd1,
+0x8f000002, 0x558178e9, 0x57c9c5b8, 0x05abb8f6,
+0xe9c50000, 0xc400d6c2, 0xd10f79e2, 0x026a830f,
+0xd9c50000, 0xc5b85558, 0xc5d25ed9, 0x885529f9,
+0x8178e98f, 0xb1b88855, 0xc5000005, 0x8855c2e9,
+0x79e2c400, 0x830fd10f, 0x00000240, 0x1512fbc5,
+0x00100510, 0x5559e9c5, 0x29f9c5b8, 0xe3c48855,
+0x88550979, 0x78e98f0b, 0xb8886d81, 0x000005bb,
+0xd558e9c5, 0x55c2e9c5, 0xe2c40088, 0x0fd10f79,
+0x00020783, 0x59e1c500, 0xe1c5c855, 0xc5b86d59,
+0x985529f9, 0x555fd1c5, 0x5dd1c598, 0xf9c5986d,
+0xb8986d29, 0x0000063d, 0x5558e9c5, 0x28f9c598,
+0xe9c5b87d, 0xc1c5d359, 0xc5c86d58, 0x00d5c2e9,
+0x0f79e2c4, 0xc1830fd1, 0xb8000001, 0x0000064e,
+0x0579e3c4, 0xc501b855, 0xc855c2e9, 0x79e2c400,
+0x830fd10f, 0x000001a4, 0x000001b8, 0x28f9c500,
+0xfbc5c855, 0xf9c5eae6, 0xf9c5f86e, 0xc500ff70,
+0xc4effed1, 0xed2579e2, 0xf573d1c5, 0x28f9c501,
+0xf9c5b87d, 0xb8e86d7f, 0x00000653, 0x49c9e3c4,
+0xc570e875, 0x00f6c2e9, 0x0f79e2c4, 0x59830ff1,
+0xc5000001, 0xb85516e9, 0x7528f9c5, 0x12c9c5b8,
+0xa8b8d06d, 0xc5000006, 0xc5d55ce9, 0xc5d359e9,
+0x00d4c2e9, 0x0f79e2c4, 0x2d830fd1, 0xf2000001,
+0xb865120f, 0x3512fbc5, 0x00100520, 0x5528f9c5,
+0x0717b8b8, 0xd9c50000, 0xfbc5ea5c, 0x05182512,
+0xe1c50010, 0xd9c5e458, 0xd1c5e659, 0xc400e4c2,
+0xe10f79e2, 0x00f2830f, 0xf9c50000, 0xc5985529,
+0xd07510fb, 0xe457d9c5, 0x7511fbc5, 0xc2d9c5a0,
+0xf9c501db, 0x8f984d28, 0x55a268e8, 0x2ab830c8,
+0xc5000007, 0x00d2c2f1, 0xdb76e1c5, 0x0f79e2c4,
+0xb5830fd3, 0xb8000000, 0x0000073a, 0x7528f9c5,
+0x49e3c4b8, 0x02c8550d, 0xcac2f1c5, 0x79e2c400,
+0x830fcb0f, 0x00000094, 0x7d28f9c5, 0xd0c1c5b8,
+0x43b8c84d, 0xc5000007, 0xb87528f9, 0x55d0c9c5,
+0xc2f1c5c8, 0xe2c400ca, 0x73cb0f79, 0x0752b86f,
+0xf9c50000, 0xc4b85528, 0x4d4169e3, 0xf1c531c8,
+0x05400dc2, 0xc4000010, 0xcb0f79e2, 0xf9c54e73,
+0xc5885529, 0x884d7cd9, 0x4d17f9c5, 0x0405d980,
+0xdd001005, 0xe9df8045, 0x2b7ad8dd, 0xc0312975,
+0x7d28f9c5, 0x7dc1c5b8, 0xf1c5c84d, 0xf1c5cc7c,
+0xc400ccc2, 0xcb0f79e2, 0x83c0920f, 0xc01901f8,
+0x00076725, 0xb805eb00, 0x0000075e, 0x0000c3c9,
+0x40000000, 0x40400000, 0x00000000, 0x80000000,
+0x00000000, 0x3fd00000, 0x00000000, 0xbff00000,
+0x00000000, 0x3fe00000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x40100000, 0x00000000, 0x00000000,
+0002520,
+};
+asm(".type xop_x86_32_D_16f8, STT_NOTYPE;");
+asm(".type xop_x86_32_D_16f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_32i1[] = {
+0x315524eb, 0x83e589c0, 0xec83e0e4, 0x7ffdc520,
+0x3c802404, 0x0a75ff04, 0x20f88340, 0x01b0f475,
+0xc03102eb, 0x4c8dc3c9, 0xe4830424, 0xfc71ffe0,
+0x895501b2, 0xf63156e5, 0x5121b353, 0x000008b9,
+0x0cec8100, 0x88000002, 0xff683594, 0xd888ffff,
+0x4488d028, 0xf0898835, 0x8301e083, 0xc01901f8,
+0xc8fe0224, 0xa8354488, 0x2101468d, 0x01fe83c6,
+0xfe00d983, 0x054c88c2, 0x20f883c7, 0xc6890474,
+0xfdc5c5eb, 0xff68bd6f, 0xfdc5ffff, 0xff08bd7f,
+0x858affff, 0xffffff08, 0xff68853a, 0x8588ffff,
+0xfffffee8, 0xf6c0940f, 0x488588d8, 0x8afffffe,
+0xffff0985, 0x698538ff, 0x0fffffff, 0xd8f6c094,
+0xfe388588, 0x858affff, 0xffffff0a, 0xff6a853a,
+0x8588ffff, 0xfffffed8, 0xf6c0940f, 0x588588d8,
+0x8afffffe, 0xffff0b85, 0x6b853aff, 0x88ffffff,
+0xfffec885, 0xc0940fff, 0x8588d8f6, 0xfffffe5d,
+0xff0c858a, 0x853affff, 0xffffff6c, 0xfec48588,
+0x940fffff, 0x88d8f6c0, 0xfffe3485, 0x0d858aff,
+0x3affffff, 0xffff6d85, 0xc08588ff, 0x0ffffffe,
+0xd8f6c094, 0xfe5c8588, 0x858affff, 0xffffff0e,
+0xff6e853a, 0x8588ffff, 0xfffffebc, 0xf6c0940f,
+0x308588d8, 0x8afffffe, 0xffff0f85, 0x6f853aff,
+0x88ffffff, 0xfffeb885, 0xc0940fff, 0x8588d8f6,
+0xfffffe2f, 0xff10858a, 0x8588ffff, 0xfffffeb4,
+0xff189d8a, 0x853affff, 0xffffff70, 0xfe949d88,
+0x940fffff, 0x88d8f6c0, 0xfffe2885, 0x11858aff,
+0x3affffff, 0xffff7185, 0xb08588ff, 0x0ffffffe,
+0xd8f6c094, 0xfe2e8588, 0x858affff, 0xffffff12,
+0xff72853a, 0x8588ffff, 0xfffffeac, 0xf6c0940f,
+0x248588d8, 0x8afffffe, 0xffff1385, 0x73853aff,
+0x88ffffff, 0xfffea885, 0xc1940fff, 0xff14858a,
+0xd9f6ffff, 0xff74853a, 0x8588ffff, 0xfffffea4,
+0xf6c0940f, 0x208588d8, 0x8afffffe, 0xffff1585,
+0x75853aff, 0x88ffffff, 0xfffea085, 0xc2940fff,
+0xff16858a, 0xdaf6ffff, 0xff76853a, 0x8588ffff,
+0xfffffe9c, 0xf6c0940f, 0x1c8588d8, 0x8afffffe,
+0xffff1785, 0x77853aff, 0x88ffffff, 0xfffe9885,
+0xc0940fff, 0x9d3ad8f6, 0xffffff78, 0xf6c3940f,
+0x189d88db, 0x8afffffe, 0xffff199d, 0x909d88ff,
+0x3afffffe, 0xffff799d, 0xc3940fff, 0x9d88dbf6,
+0xfffffe2d, 0xff1a9d8a, 0x9d3affff, 0xffffff7a,
+0xfe8c9d88, 0x940fffff, 0x88dbf6c3, 0xfffe149d,
+0x1b9d8aff, 0x3affffff, 0xffff7b9d, 0x889d88ff,
+0x0ffffffe, 0xdbf6c394, 0xfe2c9d88, 0x9d8affff,
+0xffffff1c, 0xff7c9d3a, 0x9d88ffff, 0xfffffe84,
+0xf6c3940f, 0x109d88db, 0x8afffffe, 0xffff1d9d,
+0x7d9d3aff, 0x88ffffff, 0xfffe809d, 0xc3940fff,
+0x9d88dbf6, 0xfffffe0f, 0xff1e9d8a, 0x9d3affff,
+0xffffff7e, 0xfe7c9d88, 0x940fffff, 0x88dbf6c3,
+0xfffe089d, 0x1f9d8aff, 0x3affffff, 0xffff7f9d,
+0x789d88ff, 0x0ffffffe, 0xdbf6c394, 0xfe0e9d88,
+0x9d8affff, 0xffffff20, 0x88805d3a, 0xfffe749d,
+0xc3940fff, 0x9d88dbf6, 0xfffffe04, 0xff219d8a,
+0x9d88ffff, 0xfffffe70, 0x8b815d3a, 0xfffe48b5,
+0xc3940fff, 0x9d88dbf6, 0xfffffe0d, 0xff229d8a,
+0xf9c5ffff, 0x5d3afe6e, 0x41e3c482, 0xfe38bd20,
+0x8b01ffff, 0xfffe58b5, 0x6c9d88ff, 0x0ffffffe,
+0xdbf6c394, 0xfe009d88, 0x9d8affff, 0xffffff23,
+0xce6ef9c5, 0xc4835d3a, 0x8d2071e3, 0xfffffe5d,
+0x61c1c501, 0x34b58bc9, 0x88fffffe, 0xfffe689d,
+0xc3940fff, 0x9d88dbf6, 0xfffffe0c, 0xff249d8a,
+0xf9c5ffff, 0x5d3af66e, 0x49e3c484, 0xfe5cb520,
+0x8b01ffff, 0xfffe30b5, 0x649d88ff, 0x0ffffffe,
+0xdbf6c394, 0xfdfc9d88, 0x9d8affff, 0xffffff25,
+0xe66ef9c5, 0x88855d3a, 0xfffe609d, 0xc3940fff,
+0x9d88dbf6, 0xfffffdfb, 0xff269d8a, 0x5d3affff,
+0x5f9d8886, 0x0ffffffe, 0xdbf6c394, 0xfdf49d88,
+0x9d8affff, 0xffffff27, 0x88875d3a, 0xfffe5e9d,
+0x59e3c4ff, 0xfe2fa520, 0x8b01ffff, 0xfffe28b5,
+0x61c9c5ff, 0x62f1c5e4, 0xc3940fcc, 0xf9c5dbf6,
+0xb58bd66e, 0xfffffe24, 0x2069e3c4, 0xfffe2e95,
+0xf9c501ff, 0xe3c4de6e, 0x01e92061, 0xfe208d8b,
+0xf9c5ffff, 0xfe48ad7f, 0xe9c5ffff, 0xfe489561,
+0xf9c5ffff, 0xe3c4d96e, 0x01da2061, 0xfe1c958b,
+0xf9c5ffff, 0xe3c4ea6e, 0x01e82051, 0xfe18858b,
+0xe1c5ffff, 0xe9c5dd61, 0xf1c5d362, 0x39baca6c,
+0xc5000005, 0x8be86ef9, 0xfffe1485, 0x51e3c4ff,
+0xfe2dad20, 0xc501ffff, 0x8bd06ef9, 0xfffe1085,
+0x69e3c4ff, 0xfe2c9520, 0xc501ffff, 0xc5ea61d1,
+0x8bd86ef9, 0xfffe0885, 0x61e3c4ff, 0xfe0f9d20,
+0xc501ffff, 0x8be06ef9, 0xfffe0485, 0x59e3c4ff,
+0xfe0ebd20, 0xc501ffff, 0x48bd7ff9, 0xc5fffffe,
+0x489d61e1, 0xc5fffffe, 0xc5eb62d1, 0x8bf06ef9,
+0xfffe0085, 0x49e3c4ff, 0xfe0db520, 0xc501ffff,
+0x8be06ef9, 0xfffdfc85, 0x59e3c4ff, 0xfe0cbd20,
+0xc501ffff, 0x38bd7ff9, 0xc5fffffe, 0x38b561c9,
+0xc5fffffe, 0x8bf86ef9, 0xfffdf485, 0x41e3c4ff,
+0xfdfbbd20, 0xc501ffff, 0xc4e06ef9, 0xe32059e3,
+0x61c1c501, 0x62c9c5fc, 0x6cd1c5f7, 0x75e3c4ee,
+0xe801c518, 0xfffffa6a, 0x840fc084, 0x00001f8f,
+0xbd6ff9c5, 0xffffff08, 0x8dfcc1c5, 0xffffff68,
+0xbd6ff9c5, 0xffffff18, 0x95fcc1c5, 0xffffff78,
+0x1875e3c4, 0xfdc501ca, 0xff288d7f, 0xf9c5ffff,
+0xff68bd6f, 0xc1c5ffff, 0xf9c5d7fc, 0xff78bd6f,
+0xe3c4ffff, 0x00d01479, 0xff288538, 0xc1c5ffff,
+0xe3c4cffc, 0x00cb1479, 0xf6c0940f, 0x488588d8,
+0xc4fffffe, 0xd01479e3, 0x29853801, 0x0fffffff,
+0xd8f6c094, 0xfe388588, 0xe3c4ffff, 0x02d01479,
+0xff2a8538, 0x940fffff, 0x88d8f6c0, 0xfffe5885,
+0x79e3c4ff, 0x3803d014, 0xffff2b85, 0xc0940fff,
+0x8588d8f6, 0xfffffe5d, 0x1479e3c4, 0x853804d0,
+0xffffff2c, 0xf6c0940f, 0x348588d8, 0xc4fffffe,
+0xd01479e3, 0x2d853805, 0x0fffffff, 0xd8f6c094,
+0xfe5c8588, 0xe3c4ffff, 0x06d01479, 0xff2e8538,
+0x940fffff, 0x88d8f6c0, 0xfffe3085, 0x79e3c4ff,
+0x3807d014, 0xffff2f85, 0xc0940fff, 0x8588d8f6,
+0xfffffe2f, 0x1479e3c4, 0x853808d0, 0xffffff30,
+0xf6c0940f, 0x288588d8, 0xc4fffffe, 0xd01479e3,
+0x31853809, 0x0fffffff, 0xd8f6c094, 0xfe2e8588,
+0xe3c4ffff, 0x0ad01479, 0xff328538, 0x940fffff,
+0x88d8f6c0, 0xfffe2485, 0x79e3c4ff, 0x380bd014,
+0xffff3385, 0x79e3c4ff, 0x0f0cd014, 0xd9f6c194,
+0xff348538, 0x940fffff, 0x88d8f6c0, 0xfffe2085,
+0x79e3c4ff, 0x380dd014, 0xffff3585, 0x79e3c4ff,
+0x0f0ed014, 0xdaf6c294, 0xff368538, 0x940fffff,
+0x88d8f6c0, 0xfffe1c85, 0x79e3c4ff, 0x380fd014,
+0xffff3785, 0xc0940fff, 0x9d38d8f6, 0xffffff38,
+0xf6c3940f, 0x189d88db, 0xc4fffffe, 0xcb1479e3,
+0x48b58b01, 0x38fffffe, 0xffff399d, 0xc3940fff,
+0xfe6ef9c5, 0xfe58b58b, 0xdbf6ffff, 0x2041e3c4,
+0xfffe38bd, 0x9d8801ff, 0xfffffe2d, 0x1479e3c4,
+0x9d3802cb, 0xffffff3a, 0xf6c3940f, 0x149d88db,
+0xc4fffffe, 0xcb1479e3, 0x3b9d3803, 0x0fffffff,
+0xdbf6c394, 0xfe2c9d88, 0xe3c4ffff, 0x04cb1479,
+0xff3c9d38, 0x940fffff, 0x88dbf6c3, 0xfffe109d,
+0x79e3c4ff, 0x3805cb14, 0xffff3d9d, 0xc3940fff,
+0x9d88dbf6, 0xfffffe0f, 0x1479e3c4, 0x9d3806cb,
+0xffffff3e, 0xf6c3940f, 0x089d88db, 0xc4fffffe,
+0xcb1479e3, 0x3f9d3807, 0x0fffffff, 0xdbf6c394,
+0xfe0e9d88, 0xe3c4ffff, 0x08cb1479, 0xff409d38,
+0x940fffff, 0x88dbf6c3, 0xfffe049d, 0x79e3c4ff,
+0x3809cb14, 0xffff419d, 0xc3940fff, 0x9d88dbf6,
+0xfffffe0d, 0x1479e3c4, 0x9d380acb, 0xffffff42,
+0xf6c3940f, 0x009d88db, 0xc4fffffe, 0xcb1479e3,
+0x439d380b, 0x0fffffff, 0xdbf6c394, 0xfe0c9d88,
+0xe3c4ffff, 0x0ccb1479, 0xff449d38, 0x940fffff,
+0x88dbf6c3, 0xfffdfc9d, 0x79e3c4ff, 0x380dcb14,
+0xffff459d, 0xc3940fff, 0x9d88dbf6, 0xfffffdfb,
+0x1479e3c4, 0x9d380ecb, 0xffffff46, 0xf6c3940f,
+0xf49d88db, 0xc4fffffd, 0xcb1479e3, 0x6ef9c50f,
+0x479d38ce, 0xc4ffffff, 0x8d2071e3, 0xfffffe5d,
+0x61c1c501, 0x34b58bc9, 0x0ffffffe, 0xdbf6c394,
+0xf66ef9c5, 0xfe30b58b, 0xe3c4ffff, 0x5cb52049,
+0x01fffffe, 0xe66ef9c5, 0xfe28b58b, 0xe3c4ffff,
+0x2fa52059, 0x01fffffe, 0xe461c9c5, 0xcc62f1c5,
+0xd66ef9c5, 0xfe24b58b, 0xe3c4ffff, 0x2e952069,
+0x01fffffe, 0xde6ef9c5, 0x2061e3c4, 0x8d8b01e9,
+0xfffffe20, 0xad7ff9c5, 0xfffffe48, 0x9561e9c5,
+0xfffffe48, 0xd96ef9c5, 0x2061e3c4, 0x958b01da,
+0xfffffe1c, 0xea6ef9c5, 0x2051e3c4, 0x858b01e8,
+0xfffffe18, 0xdd61e1c5, 0xd362e9c5, 0xca6cf1c5,
+0x00053fba, 0x6ef9c500, 0x14858be8, 0xc4fffffe,
+0xad2051e3, 0xfffffe2d, 0x6ef9c501, 0x10858bd0,
+0xc4fffffe, 0x952069e3, 0xfffffe2c, 0x61d1c501,
+0x6ef9c5ea, 0x08858bd8, 0xc4fffffe, 0x9d2061e3,
+0xfffffe0f, 0x6ef9c501, 0x04858be0, 0xc4fffffe,
+0xbd2059e3, 0xfffffe0e, 0x7ff9c501, 0xfffe48bd,
+0x61e1c5ff, 0xfffe489d, 0x62d1c5ff, 0x6ef9c5eb,
+0x00858bf0, 0xc4fffffe, 0xb52049e3, 0xfffffe0d,
+0x6ef9c501, 0xfc858be0, 0xc4fffffd, 0xbd2059e3,
+0xfffffe0c, 0x7ff9c501, 0xfffe38bd, 0x61c9c5ff,
+0xfffe38b5, 0x6ef9c5ff, 0xf4858bf8, 0xc4fffffd,
+0xbd2041e3, 0xfffffdfb, 0x6ef9c501, 0x59e3c4e0,
+0xc501e320, 0xc5fc61c1, 0xc5f762c9, 0xc4ee6cd1,
+0xc51875e3, 0xf5b8e801, 0xc084ffff, 0x1add840f,
+0xf9c50000, 0xff28bd6f, 0xf9c5ffff, 0xff38b56f,
+0xc1c5ffff, 0xff688df8, 0xc9c5ffff, 0xff7895f8,
+0xe3c4ffff, 0x01ca1875, 0x8d7ffdc5, 0xffffff48,
+0xfee8858a, 0x853affff, 0xffffff48, 0xf6c0940f,
+0xe88588d8, 0x8afffffe, 0xffff4985, 0x098538ff,
+0x0fffffff, 0xd8f6c094, 0xfe488588, 0x858affff,
+0xfffffed8, 0xff4a853a, 0x940fffff, 0x88d8f6c0,
+0xfffed885, 0xc8858aff, 0x3afffffe, 0xffff4b85,
+0xc0940fff, 0x8588d8f6, 0xfffffec8, 0xfec4858a,
+0x853affff, 0xffffff4c, 0xf6c0940f, 0xc48588d8,
+0x8afffffe, 0xfffec085, 0x4d853aff, 0x0fffffff,
+0xd8f6c094, 0xfec08588, 0x858affff, 0xfffffebc,
+0xff4e853a, 0x940fffff, 0x88d8f6c0, 0xfffebc85,
+0xb8858aff, 0x3afffffe, 0xffff4f85, 0xc0940fff,
+0x8588d8f6, 0xfffffeb8, 0xfeb4858a, 0x853affff,
+0xffffff50, 0xf6c0940f, 0xb48588d8, 0x8afffffe,
+0xfffeb085, 0x51853aff, 0x0fffffff, 0xd8f6c094,
+0xfeb08588, 0x858affff, 0xfffffeac, 0xff52853a,
+0x940fffff, 0x88d8f6c0, 0xfffeac85, 0xa8858aff,
+0x3afffffe, 0xffff5385, 0xa4858aff, 0x8afffffe,
+0xfffe949d, 0xc1940fff, 0x853ad9f6, 0xffffff54,
+0xf6c0940f, 0xa88588d8, 0x8afffffe, 0xfffea085,
+0x55853aff, 0x8affffff, 0xfffe9c85, 0xc2940fff,
+0x853adaf6, 0xffffff56, 0xf6c0940f, 0xa48588d8,
+0x8afffffe, 0xfffe9885, 0x57853aff, 0x0fffffff,
+0xd8f6c094, 0xff589d3a, 0x940fffff, 0x88dbf6c3,
+0xfffea09d, 0x909d8aff, 0x3afffffe, 0xffff599d,
+0xc3940fff, 0x9d88dbf6, 0xfffffe9c, 0xfe8c9d8a,
+0x9d3affff, 0xffffff5a, 0xf6c3940f, 0x989d88db,
+0x8afffffe, 0xfffe889d, 0x5b9d3aff, 0x0fffffff,
+0xdbf6c394, 0xfe949d88, 0x9d8affff, 0xfffffe84,
+0xff5c9d3a, 0x940fffff, 0x88dbf6c3, 0xfffe909d,
+0x809d8aff, 0x3afffffe, 0xffff5d9d, 0xc3940fff,
+0x9d88dbf6, 0xfffffe8c, 0xfe7c9d8a, 0x9d3affff,
+0xffffff5e, 0xf6c3940f, 0x889d88db, 0x8afffffe,
+0xfffe789d, 0x5f9d3aff, 0x8bffffff, 0xfffee8b5,
+0xc3940fff, 0x9d88dbf6, 0xfffffe84, 0xfe749d8a,
+0xf9c5ffff, 0x9d3afe6e, 0xffffff60, 0x2041e3c4,
+0xfffe48bd, 0xb58b01ff, 0xfffffed8, 0xf6c3940f,
+0x809d88db, 0x8afffffe, 0xfffe709d, 0x6ef9c5ff,
+0x619d3ace, 0xc4ffffff, 0x8d2071e3, 0xfffffec8,
+0x61c1c501, 0xc4b58bc9, 0x0ffffffe, 0xdbf6c394,
+0xfe7c9d88, 0x9d8affff, 0xfffffe6c, 0xf66ef9c5,
+0xff629d3a, 0xe3c4ffff, 0xc0b52049, 0x01fffffe,
+0xf6c3940f, 0x789d88db, 0x8afffffe, 0xfffe689d,
+0x639d3aff, 0x0fffffff, 0xdbf6c394, 0xfe749d88,
+0x9d8affff, 0xfffffe64, 0xff649d3a, 0x940fffff,
+0x88dbf6c3, 0xfffe709d, 0x609d8aff, 0x3afffffe,
+0xffff659d, 0xc3940fff, 0x9d88dbf6, 0xfffffe6c,
+0xfe5f9d8a, 0x9d3affff, 0xffffff66, 0xf6c3940f,
+0x689d88db, 0x8afffffe, 0xfffe5e9d, 0x679d3aff,
+0x8bffffff, 0xfffebcb5, 0xc3940fff, 0xf9c5dbf6,
+0xb58be66e, 0xfffffeb4, 0x2059e3c4, 0xfffeb8a5,
+0xc9c501ff, 0xf1c5e461, 0xf9c5cc62, 0xb58bd66e,
+0xfffffeac, 0x2069e3c4, 0xfffeb095, 0xf9c501ff,
+0xe3c4de6e, 0x01e92061, 0xfea88d8b, 0xf9c5ffff,
+0xfee8ad7f, 0xe9c5ffff, 0xfee89561, 0xf9c5ffff,
+0xe3c4d96e, 0x01da2061, 0xfea4958b, 0xf9c5ffff,
+0xe3c4ea6e, 0x01e82051, 0xfea0858b, 0xe1c5ffff,
+0xe9c5dd61, 0xf1c5d362, 0x44baca6c, 0xc5000005,
+0x8be86ef9, 0xfffe9885, 0x51e3c4ff, 0xfe9cad20,
+0xc501ffff, 0x8bd06ef9, 0xfffe9085, 0x69e3c4ff,
+0xfe949520, 0xc501ffff, 0xc5ea61d1, 0x8bd86ef9,
+0xfffe8885, 0x61e3c4ff, 0xfe8c9d20, 0xc501ffff,
+0x8be06ef9, 0xfffe8085, 0x59e3c4ff, 0xfe84bd20,
+0xc501ffff, 0xe8bd7ff9, 0xc5fffffe, 0xe89d61e1,
+0xc5fffffe, 0xc5eb62d1, 0x8bf06ef9, 0xfffe7885,
+0x49e3c4ff, 0xfe7cb520, 0xc501ffff, 0x8be06ef9,
+0xfffe7085, 0x59e3c4ff, 0xfe74bd20, 0xc501ffff,
+0xd8bd7ff9, 0xc5fffffe, 0xd8b561c9, 0xc5fffffe,
+0x8bf86ef9, 0xfffe6885, 0x41e3c4ff, 0xfe6cbd20,
+0xc501ffff, 0xc4e06ef9, 0xe32059e3, 0x61c1c501,
+0x62c9c5fc, 0x6cd1c5f7, 0x75e3c4ee, 0xe801c518,
+0xfffff11e, 0x840fc084, 0x00001643, 0x00c87d80,
+0x9d6ff9c5, 0xffffff68, 0x4d6ff9c5, 0x60e1c5a8,
+0x60f1c5e3, 0x68e1c5d1, 0x68f1c5db, 0x6ff9c5c9,
+0x85c6b86d, 0xfffffee8, 0xd5f1c500, 0xd5e9c5cb,
+0x6ff9c5d4, 0xffff789d, 0x6ff9c5ff, 0x10254025,
+0x60e1c500, 0x68e88ff3, 0xc540d1a3, 0xc5db68e1,
+0xc5cd60d1, 0xc5ed68d1, 0xc5ced5f1, 0x8febd5d1,
+0xcda370e8, 0xc40a7e40, 0x951479e3, 0xfffffee8,
+0xc97d8000, 0xd885c600, 0x00fffffe, 0xe3c40a7e,
+0xd8951479, 0x01fffffe, 0x00ca7d80, 0xfec885c6,
+0x7e00ffff, 0x79e3c40a, 0xfec89514, 0x8002ffff,
+0xc600cb7d, 0xfffec485, 0x0a7e00ff, 0x1479e3c4,
+0xfffec495, 0x7d8003ff, 0x85c600cc, 0xfffffec0,
+0xc40a7e00, 0x951479e3, 0xfffffec0, 0xcd7d8004,
+0xbc85c600, 0x00fffffe, 0xe3c40a7e, 0xbc951479,
+0x05fffffe, 0x00ce7d80, 0xfeb885c6, 0x7e00ffff,
+0x79e3c40a, 0xfeb89514, 0x8006ffff, 0xc600cf7d,
+0xfffeb485, 0x0a7e00ff, 0x1479e3c4, 0xfffeb495,
+0x7d8007ff, 0x85c600d0, 0xfffffeb0, 0xc40a7e00,
+0x951479e3, 0xfffffeb0, 0xd17d8008, 0xac85c600,
+0x00fffffe, 0xe3c40a7e, 0xac951479, 0x09fffffe,
+0x00d27d80, 0xfea885c6, 0x7e00ffff, 0x79e3c40a,
+0xfea89514, 0x800affff, 0xc600d37d, 0xfffea485,
+0x0a7e00ff, 0x1479e3c4, 0xfffea495, 0x7d800bff,
+0x85c600d4, 0xfffffea0, 0xc40a7e00, 0x951479e3,
+0xfffffea0, 0xd57d800c, 0x9c85c600, 0x00fffffe,
+0xe3c40a7e, 0x9c951479, 0x0dfffffe, 0x7d80db31,
+0x067e00d6, 0x1479e3c4, 0x7d800ed3, 0x85c600d7,
+0xfffffe98, 0xc40a7e00, 0x951479e3, 0xfffffe98,
+0x80c9310f, 0x7e00d87d, 0x79e3c406, 0x8000c914,
+0xc600d97d, 0xfffe9485, 0x0a7e00ff, 0x1479e3c4,
+0xfffe948d, 0x7d8001ff, 0x85c600da, 0xfffffe90,
+0xc40a7e00, 0x8d1479e3, 0xfffffe90, 0xdb7d8002,
+0x8c85c600, 0x00fffffe, 0xe3c40a7e, 0x8c8d1479,
+0x03fffffe, 0x00dc7d80, 0xfe8885c6, 0x7e00ffff,
+0x79e3c40a, 0xfe888d14, 0x8004ffff, 0xc600dd7d,
+0xfffe8485, 0x0a7e00ff, 0x1479e3c4, 0xfffe848d,
+0x7d8005ff, 0x85c600de, 0xfffffe80, 0xc40a7e00,
+0x8d1479e3, 0xfffffe80, 0xdf7d8006, 0x7c85c600,
+0x00fffffe, 0xe3c40a7e, 0x7c8d1479, 0x07fffffe,
+0x00e07d80, 0xfe7885c6, 0x7e00ffff, 0x79e3c40a,
+0xfe788d14, 0x8008ffff, 0xc600e17d, 0xfffe7485,
+0x0a7e00ff, 0x1479e3c4, 0xfffe748d, 0x7d8009ff,
+0x85c600e2, 0xfffffe70, 0xc40a7e00, 0x8d1479e3,
+0xfffffe70, 0xe37d800a, 0x6c85c600, 0x00fffffe,
+0xe3c40a7e, 0x6c8d1479, 0x0bfffffe, 0x00e47d80,
+0xfe6885c6, 0x7e00ffff, 0x79e3c40a, 0xfe688d14,
+0x800cffff, 0xc600e57d, 0xfffe6485, 0x0a7e00ff,
+0x1479e3c4, 0xfffe648d, 0xd2310dff, 0x00e67d80,
+0xe3c4067e, 0x0eca1479, 0x7d80c031, 0x067e00e7,
+0x1479e3c4, 0xb58b0fc8, 0xfffffee8, 0xfe6ef9c5,
+0xfec8b58b, 0xe3c4ffff, 0xd8bd2041, 0x01fffffe,
+0xce6ef9c5, 0xfec0b58b, 0xe3c4ffff, 0xc48d2071,
+0x01fffffe, 0xc961c1c5, 0xf66ef9c5, 0xfeb8b58b,
+0xe3c4ffff, 0xbcb52049, 0x01fffffe, 0xe66ef9c5,
+0xfeb0b58b, 0xe3c4ffff, 0xb4a52059, 0x01fffffe,
+0xe461c9c5, 0xcc62f1c5, 0xd66ef9c5, 0xfea8b58b,
+0xe3c4ffff, 0xac952069, 0x01fffffe, 0xde6ef9c5,
+0xfea0b58b, 0xe3c4ffff, 0xa4ad2061, 0x01fffffe,
+0xad7ff9c5, 0xfffffee8, 0xeb6ef9c5, 0x2051e3c4,
+0xfffe98ad, 0xe9c501ff, 0xfee89561, 0xf9c5ffff,
+0xe3c4de6e, 0x9c9d2061, 0x01fffffe, 0xdd61e1c5,
+0xe96ef9c5, 0xfe908d8b, 0xe9c5ffff, 0xf1c5d362,
+0xe3c4ca6c, 0x94ad2051, 0x01fffffe, 0xe16ef9c5,
+0xfe888d8b, 0xe3c4ffff, 0x8ca52059, 0x01fffffe,
+0xec61d1c5, 0xd96ef9c5, 0xfe808d8b, 0xe3c4ffff,
+0x849d2061, 0x01fffffe, 0xd16ef9c5, 0xfe788d8b,
+0xe3c4ffff, 0x7cb52069, 0x01fffffe, 0xb57ff9c5,
+0xfffffee8, 0xf16ef9c5, 0xfe708d8b, 0xe3c4ffff,
+0x74b52049, 0x01fffffe, 0xd16ef9c5, 0xfe688d8b,
+0xe3c4ffff, 0x6cbd2069, 0x01fffffe, 0xd26ef9c5,
+0xbd7ff9c5, 0xfffffed8, 0x2069e3c4, 0xf9c501d0,
+0xe3c4f96e, 0x64bd2041, 0x01fffffe, 0x9d61e1c5,
+0xfffffee8, 0xfa61c1c5, 0xb561c9c5, 0xfffffed8,
+0xeb62d1c5, 0xf762c9c5, 0xee6cd1c5, 0x1875e3c4,
+0xf9c501cd, 0xfdc5d16f, 0xff488d7f, 0xe98fffff,
+0xc85d98f0, 0x756ff9c5, 0x48e98fd8, 0xff588d98,
+0xe3c4ffff, 0x01f11865, 0xb57ffdc5, 0xfffffee8,
+0xbd6ffdc5, 0xfffffee8, 0xfee8958a, 0xfdc5ffff,
+0xff08bd7f, 0xf9c5ffff, 0x25501d6f, 0xf9c50010,
+0xc5c8756f, 0xd87d6ff9, 0xcbf8c9c5, 0xdbf8c1c5,
+0x1875e3c4, 0xfdc501cb, 0x8fc84d7f, 0x5598e8e9,
+0x6ff9c5c8, 0xe98fd875, 0x588d9848, 0xc4ffffff,
+0xd9186de3, 0xfce9c501, 0x7ffdc5d2, 0xffff289d,
+0x79e3c4ff, 0x3800d014, 0xfcf1c5c2, 0xc0940fc9,
+0x8588d8f6, 0xfffffee8, 0x1479e3c4, 0x853801d0,
+0xffffff09, 0xf6c0940f, 0xd88588d8, 0xc4fffffe,
+0xd01479e3, 0x0a853802, 0x0fffffff, 0xd8f6c094,
+0xfec88588, 0xe3c4ffff, 0x03d01479, 0xff0b8538,
+0x940fffff, 0x88d8f6c0, 0xfffec485, 0x79e3c4ff,
+0x3804d014, 0xffff0c85, 0xc0940fff, 0x8588d8f6,
+0xfffffec0, 0x1479e3c4, 0x853805d0, 0xffffff0d,
+0xf6c0940f, 0xbc8588d8, 0xc4fffffe, 0xd01479e3,
+0x0e853806, 0x0fffffff, 0xd8f6c094, 0xfeb88588,
+0xe3c4ffff, 0x07d01479, 0xff0f8538, 0x940fffff,
+0x88d8f6c0, 0xfffeb485, 0x79e3c4ff, 0x3808d014,
+0xffff1085, 0xc0940fff, 0x8588d8f6, 0xfffffeb0,
+0x1479e3c4, 0x853809d0, 0xffffff11, 0xf6c0940f,
+0xac8588d8, 0xc4fffffe, 0xd01479e3, 0x1285380a,
+0x0fffffff, 0xd8f6c094, 0xfea88588, 0xe3c4ffff,
+0x0bd01479, 0xff138538, 0xe3c4ffff, 0x0cd01479,
+0xf6c3940f, 0x148538db, 0x0fffffff, 0xd8f6c094,
+0xfea48588, 0xe3c4ffff, 0x0dd01479, 0xff158538,
+0xe3c4ffff, 0x0ed01479, 0xf6c1940f, 0x168538d9,
+0x0fffffff, 0xd8f6c094, 0xfea08588, 0xe3c4ffff,
+0x0fd01479, 0xff178538, 0xe3c4ffff, 0x00c81479,
+0xf6c2940f, 0x188538da, 0x0fffffff, 0xd8f6c094,
+0xfe9c8588, 0xe3c4ffff, 0x01c81479, 0xff198538,
+0x940fffff, 0x88d8f6c0, 0xfffe9885, 0x79e3c4ff,
+0x3802c814, 0xffff1a85, 0xc0940fff, 0x8588d8f6,
+0xfffffe94, 0x1479e3c4, 0x853803c8, 0xffffff1b,
+0xf6c0940f, 0x908588d8, 0xc4fffffe, 0xc81479e3,
+0x1c853804, 0x0fffffff, 0xd8f6c094, 0xfe8c8588,
+0xe3c4ffff, 0x05c81479, 0xff1d8538, 0x940fffff,
+0x88d8f6c0, 0xfffe8885, 0x79e3c4ff, 0x3806c814,
+0xffff1e85, 0xc0940fff, 0x8588d8f6, 0xfffffe84,
+0x1479e3c4, 0x853807c8, 0xffffff1f, 0xf6c0940f,
+0x808588d8, 0xc4fffffe, 0xc81479e3, 0x20853808,
+0x0fffffff, 0xd8f6c094, 0xfe7c8588, 0xe3c4ffff,
+0x09c81479, 0xff218538, 0x940fffff, 0x88d8f6c0,
+0xfffe7885, 0x79e3c4ff, 0x380ac814, 0xffff2285,
+0xc0940fff, 0x8588d8f6, 0xfffffe74, 0x1479e3c4,
+0x85380bc8, 0xffffff23, 0xf6c0940f, 0x708588d8,
+0xc4fffffe, 0xc81479e3, 0x2485380c, 0x0fffffff,
+0xd8f6c094, 0xfe6c8588, 0xe3c4ffff, 0x0dc81479,
+0xff258538, 0x940fffff, 0x88d8f6c0, 0xfffe6885,
+0x79e3c4ff, 0x380ec814, 0xffff2685, 0xc0940fff,
+0x8588d8f6, 0xfffffe64, 0xfee8b58b, 0xe3c4ffff,
+0x0fc81479, 0xff278538, 0xf9c5ffff, 0xb58bfe6e,
+0xfffffec8, 0x2041e3c4, 0xfffed8bd, 0x940f01ff,
+0xc5d8f6c0, 0x8bce6ef9, 0xfffec0b5, 0x71e3c4ff,
+0xfec48d20, 0xc501ffff, 0xc5c961c1, 0x8bf66ef9,
+0xfffeb8b5, 0x49e3c4ff, 0xfebcb520, 0xc501ffff,
+0x8be66ef9, 0xfffeb0b5, 0x59e3c4ff, 0xfeb4a520,
+0xc501ffff, 0xc5e461c9, 0xc5cc62f1, 0x8bd66ef9,
+0xfffea8b5, 0x69e3c4ff, 0xfeac9520, 0xc501ffff,
+0xc4de6ef9, 0xeb2061e3, 0xa49d8b01, 0xc5fffffe,
+0xe8ad7ff9, 0xc5fffffe, 0xe89561e9, 0xc5fffffe,
+0xc4db6ef9, 0xd92061e3, 0xa08d8b01, 0xc5fffffe,
+0xc4e96ef9, 0xea2051e3, 0x9c958b01, 0xc5fffffe,
+0xc5dd61e1, 0xc5d362e9, 0xc5ca6cf1, 0x8bea6ef9,
+0xfffe9495, 0x51e3c4ff, 0xfe98ad20, 0xc501ffff,
+0x8bd26ef9, 0xfffe8c95, 0x69e3c4ff, 0xfe909520,
+0xc501ffff, 0xc5ea61d1, 0x8bda6ef9, 0xfffe8495,
+0x61e3c4ff, 0xfe889d20, 0xc501ffff, 0x8be26ef9,
+0xfffe7c95, 0x59e3c4ff, 0xfe80bd20, 0xc501ffff,
+0xe8bd7ff9, 0xc5fffffe, 0x8bf26ef9, 0xfffe7495,
+0x49e3c4ff, 0xfe78b520, 0xc501ffff, 0x8be26ef9,
+0xfffe6c95, 0x59e3c4ff, 0xfe70a520, 0xc501ffff,
+0xd8a57ff9, 0xc5fffffe, 0xc4fa6ef9, 0xbd2041e3,
+0xfffffe68, 0x64958b01, 0xc5fffffe, 0xe89d61e1,
+0xc5fffffe, 0xd8b561c9, 0xc5fffffe, 0xc5eb62d1,
+0xc4e26ef9, 0xe02059e3, 0x61c1c501, 0x62c9c5fc,
+0x6cd1c5f7, 0x75e3c4ee, 0xe801c518, 0xffffe782,
+0x000621ba, 0x0fc08400, 0x000ca284, 0xeff1c500,
+0xf8f1c5c9, 0xf1c5c855, 0x8fd84df8, 0x959868e9,
+0xffffff28, 0x9870e98f, 0xffff388d, 0x79e3c4ff,
+0x3800d014, 0xffff4885, 0x6de3c4ff, 0xc501d918,
+0x089d7ffd, 0x0fffffff, 0xd8f6c094, 0xfee88588,
+0xe3c4ffff, 0x01d01479, 0xff498538, 0x940fffff,
+0x88d8f6c0, 0xfffed885, 0x79e3c4ff, 0x3802d014,
+0xffff4a85, 0xc0940fff, 0x8588d8f6, 0xfffffec8,
+0x1479e3c4, 0x853803d0, 0xffffff4b, 0xf6c0940f,
+0xc48588d8, 0xc4fffffe, 0xd01479e3, 0x4c853804,
+0x0fffffff, 0xd8f6c094, 0xfec08588, 0xe3c4ffff,
+0x05d01479, 0xff4d8538, 0x940fffff, 0x88d8f6c0,
+0xfffebc85, 0x79e3c4ff, 0x3806d014, 0xffff4e85,
+0xc0940fff, 0x8588d8f6, 0xfffffeb8, 0x1479e3c4,
+0x853807d0, 0xffffff4f, 0xf6c0940f, 0xb48588d8,
+0xc4fffffe, 0xd01479e3, 0x50853808, 0x0fffffff,
+0xd8f6c094, 0xfeb08588, 0xe3c4ffff, 0x09d01479,
+0xff518538, 0x940fffff, 0x88d8f6c0, 0xfffeac85,
+0x79e3c4ff, 0x380ad014, 0xffff5285, 0xc0940fff,
+0x8588d8f6, 0xfffffea8, 0x1479e3c4, 0x85380bd0,
+0xffffff53, 0x1479e3c4, 0x940f0cd0, 0x38dbf6c3,
+0xffff5485, 0xc0940fff, 0x8588d8f6, 0xfffffea4,
+0x1479e3c4, 0x85380dd0, 0xffffff55, 0x1479e3c4,
+0x940f0ed0, 0x38d9f6c1, 0xffff5685, 0xc0940fff,
+0x8588d8f6, 0xfffffea0, 0x1479e3c4, 0x85380fd0,
+0xffffff57, 0x1479e3c4, 0x940f00c8, 0x38daf6c2,
+0xffff5885, 0xc0940fff, 0x8588d8f6, 0xfffffe9c,
+0x1479e3c4, 0x853801c8, 0xffffff59, 0xf6c0940f,
+0x988588d8, 0xc4fffffe, 0xc81479e3, 0x5a853802,
+0x0fffffff, 0xd8f6c094, 0xfe948588, 0xe3c4ffff,
+0x03c81479, 0xff5b8538, 0x940fffff, 0x88d8f6c0,
+0xfffe9085, 0x79e3c4ff, 0x3804c814, 0xffff5c85,
+0xc0940fff, 0x8588d8f6, 0xfffffe8c, 0x1479e3c4,
+0x853805c8, 0xffffff5d, 0xf6c0940f, 0x888588d8,
+0xc4fffffe, 0xc81479e3, 0x5e853806, 0x0fffffff,
+0xd8f6c094, 0xfe848588, 0xe3c4ffff, 0x07c81479,
+0xff5f8538, 0x940fffff, 0x88d8f6c0, 0xfffe8085,
+0x79e3c4ff, 0x3808c814, 0xffff6085, 0xc0940fff,
+0x8588d8f6, 0xfffffe7c, 0x1479e3c4, 0x853809c8,
+0xffffff61, 0xf6c0940f, 0x788588d8, 0xc4fffffe,
+0xc81479e3, 0x6285380a, 0x0fffffff, 0xd8f6c094,
+0xfe748588, 0xe3c4ffff, 0x0bc81479, 0xff638538,
+0x940fffff, 0x88d8f6c0, 0xfffe7085, 0x79e3c4ff,
+0x380cc814, 0xffff6485, 0xc0940fff, 0x8588d8f6,
+0xfffffe6c, 0x1479e3c4, 0x85380dc8, 0xffffff65,
+0xf6c0940f, 0x688588d8, 0xc4fffffe, 0xc81479e3,
+0x6685380e, 0x8bffffff, 0xfffee8b5, 0xc0940fff,
+0xf9c5d8f6, 0x8588fe6e, 0xfffffe64, 0xfec8b58b,
+0xe3c4ffff, 0x0fc81479, 0x2041e3c4, 0xfffed8bd,
+0x853801ff, 0xffffff67, 0xce6ef9c5, 0xfec0b58b,
+0xe3c4ffff, 0xc48d2071, 0x01fffffe, 0xc961c1c5,
+0xf6c0940f, 0x6ef9c5d8, 0xb8b58bf6, 0xc4fffffe,
+0xb52049e3, 0xfffffebc, 0x6ef9c501, 0xb0b58be6,
+0xc4fffffe, 0xa52059e3, 0xfffffeb4, 0x61c9c501,
+0x62f1c5e4, 0x6ef9c5cc, 0xa8b58bd6, 0xc4fffffe,
+0x952069e3, 0xfffffeac, 0x6ef9c501, 0x61e3c4de,
+0x8b01eb20, 0xfffea49d, 0x7ff9c5ff, 0xfffee8ad,
+0x61e9c5ff, 0xfffee895, 0x6ef9c5ff, 0x61e3c4db,
+0x8b01d920, 0xfffea08d, 0x6ef9c5ff, 0x51e3c4e9,
+0x8b01ea20, 0xfffe9c95, 0x61e1c5ff, 0x62e9c5dd,
+0x6cf1c5d3, 0x6ef9c5ca, 0x94958bea, 0xc4fffffe,
+0xad2051e3, 0xfffffe98, 0x6ef9c501, 0x8c958bd2,
+0xc4fffffe, 0x952069e3, 0xfffffe90, 0x61d1c501,
+0x6ef9c5ea, 0x84958bda, 0xc4fffffe, 0x9d2061e3,
+0xfffffe88, 0x6ef9c501, 0x7c958be2, 0xc4fffffe,
+0xb52059e3, 0xfffffe80, 0x7ff9c501, 0xfffee8b5,
+0x6ef9c5ff, 0x74958bf2, 0xc4fffffe, 0xb52049e3,
+0xfffffe78, 0x6ef9c501, 0x59e3c4e2, 0xfe70bd20,
+0xc501ffff, 0xd8bd7ff9, 0x8bfffffe, 0xfffe6c95,
+0x61e1c5ff, 0xfffee89d, 0x61c9c5ff, 0xfffed8b5,
+0x62d1c5ff, 0x6ef9c5eb, 0x64958bfa, 0xc4fffffe,
+0xbd2041e3, 0xfffffe68, 0x6ef9c501, 0x59e3c4e2,
+0xc501e020, 0xc5fc61c1, 0xc5f762c9, 0xc4ee6cd1,
+0xc51875e3, 0xe2e8e801, 0x26baffff, 0x84000006,
+0x08840fc0, 0xb8000008, 0x00000001, 0xa56ffdc5,
+0xffffff68, 0xa57ffdc5, 0xfffffee8, 0xa57ffdc5,
+0xffffff28, 0x8805548a, 0x28059488, 0x83ffffff,
+0xf88302c0, 0x80ed7521, 0x0f00a87d, 0xd8f6c09f,
+0x00a97d80, 0xfed88588, 0x9f0fffff, 0x80d9f6c1,
+0x0f00aa7d, 0xd8f6c09f, 0x00ab7d80, 0xfec88588,
+0x9f0fffff, 0x80d8f6c0, 0x8800ac7d, 0xfffec485,
+0xc09f0fff, 0x7d80d8f6, 0x858800ad, 0xfffffec0,
+0xf6c09f0f, 0xae7d80d8, 0xbc858800, 0x0ffffffe,
+0xd8f6c09f, 0x00af7d80, 0xfeb88588, 0x9f0fffff,
+0x80d8f6c0, 0x8800b07d, 0xfffeb485, 0xc09f0fff,
+0x7d80d8f6, 0x858800b1, 0xfffffeb0, 0xf6c09f0f,
+0xb27d80d8, 0xac858800, 0x0ffffffe, 0xd8f6c09f,
+0x00b37d80, 0xfea88588, 0x9f0fffff, 0x80daf6c2,
+0x0f00b47d, 0xd8f6c09f, 0x00b57d80, 0xfea48588,
+0x9f0fffff, 0x80d8f6c0, 0x0f00b67d, 0xdbf6c39f,
+0x00b77d80, 0xfea09d88, 0x9f0fffff, 0x80dbf6c3,
+0x8800b87d, 0xfffe9c9d, 0xc39f0fff, 0x7d80dbf6,
+0x9d8800b9, 0xfffffe98, 0xf6c39f0f, 0x949d88db,
+0x8bfffffe, 0xfffed8b5, 0xba7d80ff, 0xc39f0f00,
+0xce6ef9c5, 0x2071e3c4, 0xdbf601c9, 0xfec88d8b,
+0x7d80ffff, 0x9d8800bb, 0xfffffe90, 0xc5c39f0f,
+0x8bf96ef9, 0xfffec08d, 0xc4dbf6ff, 0xbd2041e3,
+0xfffffec4, 0x61f1c501, 0xbc7d80cf, 0x8c9d8800,
+0xc5fffffe, 0xc4f16ef9, 0xb52049e3, 0xfffffebc,
+0xc39f0f01, 0x7d80dbf6, 0x9d8800bd, 0xfffffe88,
+0xf6c39f0f, 0xbe7d80db, 0x849d8800, 0x0ffffffe,
+0xdbf6c39f, 0x00bf7d80, 0xfe809d88, 0x9f0fffff,
+0x80dbf6c3, 0x8800c07d, 0xfffe7c9d, 0xc39f0fff,
+0x7d80dbf6, 0x9d8800c1, 0xfffffe78, 0xf6c39f0f,
+0xc27d80db, 0x749d8800, 0x0ffffffe, 0xdbf6c39f,
+0x00c37d80, 0xfe709d88, 0x9f0fffff, 0x80dbf6c3,
+0x8800c47d, 0xfffe6c9d, 0xc39f0fff, 0x7d80dbf6,
+0x9d8800c5, 0xfffffe68, 0xf6c39f0f, 0xc67d80db,
+0x649d8800, 0x0ffffffe, 0xdbf6c39f, 0xfe609d88,
+0x7d80ffff, 0x8d8b00c7, 0xfffffeb8, 0xf6c39f0f,
+0x6ef9c5db, 0xb08d8be1, 0xc4fffffe, 0xa52059e3,
+0xfffffeb4, 0x61c9c501, 0x62f1c5e4, 0x6ef9c5cc,
+0xa88d8bd1, 0xc4fffffe, 0x952069e3, 0xfffffeac,
+0x6ef9c501, 0x61e3c4d9, 0x8b01ea20, 0xfffea495,
+0x7ff9c5ff, 0xfffed8ad, 0x61e9c5ff, 0xfffed895,
+0x6ef9c5ff, 0x61e3c4da, 0x8b01d820, 0xfffea085,
+0x6ef9c5ff, 0x98858be8, 0xc4fffffe, 0xad2051e3,
+0xfffffe9c, 0x61e1c501, 0x62e9c5dd, 0x6cf1c5d3,
+0x6ef9c5ca, 0x90858be8, 0xc4fffffe, 0xad2051e3,
+0xfffffe94, 0x6ef9c501, 0x88858bf8, 0xc4fffffe,
+0xbd2041e3, 0xfffffe8c, 0x61d1c501, 0x6ffdc5ef,
+0xfffee8bd, 0x6ef9c5ff, 0x80858bd8, 0xc4fffffe,
+0x9d2061e3, 0xfffffe84, 0x6ef9c501, 0x78858bd0,
+0xc4fffffe, 0xa52069e3, 0xfffffe7c, 0x7ff9c501,
+0xfffed8a5, 0x61e1c5ff, 0xfffed89d, 0x62d1c5ff,
+0x6ef9c5eb, 0x70858bf0, 0xc4fffffe, 0xb52049e3,
+0xfffffe74, 0x6ef9c501, 0x68858bd0, 0xc4fffffe,
+0xa52069e3, 0xfffffe6c, 0x7ff9c501, 0xfffec8a5,
+0x61c9c5ff, 0xfffec8b5, 0x6ef9c5ff, 0x60858bd0,
+0xc4fffffe, 0x952069e3, 0xfffffe64, 0x6ef9c501,
+0x59e3c4e0, 0xc501e320, 0xc5d461e9, 0xc5f262c9,
+0xc4ee6cd1, 0xcd1875e3, 0x44e88f01, 0x10884da2,
+0x1479e3c4, 0x853800c8, 0xffffff28, 0xf6c0940f,
+0xe88588d8, 0xc4fffffe, 0xc81479e3, 0x29853801,
+0x0fffffff, 0xd8f6c094, 0xfed88588, 0xe3c4ffff,
+0x02c81479, 0xff2a8538, 0x940fffff, 0x88d8f6c0,
+0xfffec885, 0x79e3c4ff, 0x3803c814, 0xffff2b85,
+0xc0940fff, 0x8588d8f6, 0xfffffec4, 0x1479e3c4,
+0x853804c8, 0xffffff2c, 0xf6c0940f, 0xc08588d8,
+0xc4fffffe, 0xc81479e3, 0x2d853805, 0x0fffffff,
+0xd8f6c094, 0xfebc8588, 0xe3c4ffff, 0x06c81479,
+0xff2e8538, 0x940fffff, 0x88d8f6c0, 0xfffeb885,
+0x79e3c4ff, 0x3807c814, 0xffff2f85, 0xc0940fff,
+0x8588d8f6, 0xfffffeb4, 0x1479e3c4, 0x853808c8,
+0xffffff30, 0xf6c0940f, 0xb08588d8, 0xc4fffffe,
+0xc81479e3, 0x31853809, 0x0fffffff, 0xd8f6c094,
+0xfeac8588, 0xe3c4ffff, 0x0ac81479, 0xff328538,
+0x940fffff, 0x88d8f6c0, 0xfffea885, 0x79e3c4ff,
+0x380bc814, 0xffff3385, 0x79e3c4ff, 0x0f0cc814,
+0xdbf6c394, 0xff348538, 0x940fffff, 0x88d8f6c0,
+0xfffea485, 0x79e3c4ff, 0x380dc814, 0xffff3585,
+0x79e3c4ff, 0x0f0ec814, 0xd9f6c194, 0xff368538,
+0x940fffff, 0x88d8f6c0, 0xfffea085, 0x79e3c4ff,
+0xc40fc814, 0xc9197de3, 0x37853801, 0xc4ffffff,
+0xc81479e3, 0xc2940f00, 0x8538daf6, 0xffffff38,
+0xf6c0940f, 0x9c8588d8, 0xc4fffffe, 0xc81479e3,
+0x39853801, 0x0fffffff, 0xd8f6c094, 0xfe988588,
+0xe3c4ffff, 0x02c81479, 0xff3a8538, 0x940fffff,
+0x88d8f6c0, 0xfffe9485, 0x79e3c4ff, 0x8b03c814,
+0xfffee8b5, 0x3b8538ff, 0x0fffffff, 0xf9c5c094,
+0xb58bfe6e, 0xfffffec8, 0xe3c4d8f6, 0xd8bd2041,
+0x01fffffe, 0xfe908588, 0xe3c4ffff, 0x04c81479,
+0xff3c8538, 0x940fffff, 0x88d8f6c0, 0xfffe8c85,
+0x79e3c4ff, 0x3805c814, 0xffff3d85, 0xc0940fff,
+0x8588d8f6, 0xfffffe88, 0x1479e3c4, 0x853806c8,
+0xffffff3e, 0xf6c0940f, 0x848588d8, 0xc4fffffe,
+0xc81479e3, 0x3f853807, 0x0fffffff, 0xd8f6c094,
+0xfe808588, 0xe3c4ffff, 0x08c81479, 0xff408538,
+0x940fffff, 0x88d8f6c0, 0xfffe7c85, 0x79e3c4ff,
+0x3809c814, 0xffff4185, 0xc0940fff, 0x8588d8f6,
+0xfffffe78, 0x1479e3c4, 0x85380ac8, 0xffffff42,
+0xf6c0940f, 0x748588d8, 0xc4fffffe, 0xc81479e3,
+0x4385380b, 0x0fffffff, 0xd8f6c094, 0xfe708588,
+0xe3c4ffff, 0x0cc81479, 0xff448538, 0x940fffff,
+0x88d8f6c0, 0xfffe6c85, 0x79e3c4ff, 0x380dc814,
+0xffff4585, 0xc0940fff, 0x8588d8f6, 0xfffffe68,
+0x1479e3c4, 0x85380ec8, 0xffffff46, 0xf6c0940f,
+0x648588d8, 0xc4fffffe, 0xc81479e3, 0x6ef9c50f,
+0xc0b58bce, 0xc4fffffe, 0x8d2071e3, 0xfffffec4,
+0x61c1c501, 0x478538c9, 0xc5ffffff, 0x8bf66ef9,
+0xfffeb8b5, 0x49e3c4ff, 0xfebcb520, 0x0f01ffff,
+0xd8f6c094, 0xe66ef9c5, 0x2059e3c4, 0xfffeb4a5,
+0xb58b01ff, 0xfffffeb0, 0xe461c9c5, 0xcc62f1c5,
+0xd66ef9c5, 0xfea8b58b, 0xe3c4ffff, 0xac952069,
+0x01fffffe, 0xde6ef9c5, 0x2061e3c4, 0x9d8b01db,
+0xfffffea4, 0x9d7ff9c5, 0xfffffee8, 0x9561e9c5,
+0xfffffee8, 0xdb6ef9c5, 0x2061e3c4, 0x8d8b01d9,
+0xfffffea0, 0xe96ef9c5, 0x2051e3c4, 0x958b01ea,
+0xfffffe9c, 0xdd61e1c5, 0xd362e9c5, 0xca6cf1c5,
+0xea6ef9c5, 0xfe94958b, 0xe3c4ffff, 0x98ad2051,
+0x01fffffe, 0xd26ef9c5, 0xfe8c958b, 0xe3c4ffff,
+0x90952069, 0x01fffffe, 0xea61d1c5, 0xda6ef9c5,
+0xfe84958b, 0xe3c4ffff, 0x889d2061, 0x01fffffe,
+0xe26ef9c5, 0xfe7c958b, 0xe3c4ffff, 0x80b52059,
+0x01fffffe, 0xb57ff9c5, 0xfffffee8, 0x9d61e1c5,
+0xfffffee8, 0xeb62d1c5, 0xf26ef9c5, 0xfe74958b,
+0xe3c4ffff, 0x78b52049, 0x01fffffe, 0xe26ef9c5,
+0xfe6c958b, 0xe3c4ffff, 0x70bd2059, 0x01fffffe,
+0xbd7ff9c5, 0xfffffed8, 0xb561c9c5, 0xfffffed8,
+0xfa6ef9c5, 0xfe64958b, 0xe3c4ffff, 0x68bd2041,
+0x01fffffe, 0xe26ef9c5, 0x2059e3c4, 0xc1c501e0,
+0xc9c5fc61, 0xd1c5f762, 0xe3c4ee6c, 0x01c51875,
+0xffdadde8, 0x19013cff, 0x2ae281d2, 0x81000007,
+0x00020cc4, 0x59d08900, 0x8d5d5e5b, 0x00c3fc61,
+0x06040200, 0x0e0c0a08, 0x16141210, 0x1e1c1a18,
+0x01010101, 0x01010101, 0x01010101, 0x01010101,
+0022540,
+};
+asm(".type xop_x86_32_D_32i1, STT_NOTYPE;");
+asm(".type xop_x86_32_D_32i1, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_32u1[] = {
+0x315524eb, 0x83e589c0, 0xec83e0e4, 0x7ffdc520,
+0x3c802404, 0x0a75ff04, 0x20f88340, 0x01b0f475,
+0xc03102eb, 0x4c8dc3c9, 0xe4830424, 0xfc71ffe0,
+0x08ba01b0, 0x55000000, 0x3156e589, 0x21b353f6,
+0xecec8151, 0x88000001, 0xff683584, 0xd988ffff,
+0x4c88c128, 0xf1898835, 0xfe01e183, 0x354c88c9,
+0x46f189a8, 0xf983f121, 0x00da8301, 0x5488c0fe,
+0xfe83c735, 0xc5d07520, 0x68bd6ffd, 0xc5ffffff,
+0x08bd7ffd, 0x8affffff, 0xffff0885, 0x68853aff,
+0x88ffffff, 0xfffee885, 0xc0940fff, 0x8588d8f6,
+0xfffffe68, 0xff09858a, 0x853affff, 0xffffff69,
+0xfed88588, 0x940fffff, 0x88d8f6c0, 0xfffe5885,
+0x0a858aff, 0x3affffff, 0xffff6a85, 0xd48588ff,
+0x0ffffffe, 0xd8f6c094, 0xfe548588, 0x858affff,
+0xffffff0b, 0xff6b853a, 0x8588ffff, 0xfffffed3,
+0xf6c0940f, 0x898588d8, 0x8afffffe, 0xffff0c85,
+0x6c853aff, 0x88ffffff, 0xfffecc85, 0xc0940fff,
+0x8588d8f6, 0xfffffe50, 0xff0d858a, 0x853affff,
+0xffffff6d, 0xfed28588, 0x940fffff, 0x88d8f6c0,
+0xfffe8885, 0x0e858aff, 0x3affffff, 0xffff6e85,
+0xc88588ff, 0x0ffffffe, 0xd8f6c094, 0xfe4c8588,
+0x858affff, 0xffffff0f, 0xff6f853a, 0x8588ffff,
+0xfffffed1, 0xf6c0940f, 0x4b8588d8, 0x8afffffe,
+0xffff1085, 0x70853aff, 0x8affffff, 0xffff189d,
+0xc48588ff, 0x0ffffffe, 0xd8f6c094, 0xfe448588,
+0x858affff, 0xffffff11, 0xff71853a, 0x9d88ffff,
+0xfffffeab, 0xfec08588, 0x940fffff, 0x88d8f6c0,
+0xfffe4a85, 0x12858aff, 0x3affffff, 0xffff7285,
+0xbc8588ff, 0x0ffffffe, 0xd8f6c094, 0xfe408588,
+0x858affff, 0xffffff13, 0xff73853a, 0x8588ffff,
+0xfffffeb8, 0x8ac1940f, 0xffff1485, 0x3ad9f6ff,
+0xffff7485, 0xb48588ff, 0x0ffffffe, 0xd8f6c094,
+0xfe3c8588, 0x858affff, 0xffffff15, 0xff75853a,
+0x8588ffff, 0xfffffeb0, 0x8ac2940f, 0xffff1685,
+0x3adaf6ff, 0xffff7685, 0xd08588ff, 0x0ffffffe,
+0xd8f6c094, 0xfe388588, 0x858affff, 0xffffff17,
+0xff77853a, 0x8588ffff, 0xfffffeac, 0xf6c0940f,
+0x789d3ad8, 0x0fffffff, 0xdbf6c394, 0xfe349d88,
+0x9d8affff, 0xffffff19, 0xff799d3a, 0x9d88ffff,
+0xfffffea4, 0xf6c3940f, 0x499d88db, 0x8afffffe,
+0xffff1a9d, 0x7a9d3aff, 0x88ffffff, 0xfffeaa9d,
+0xc3940fff, 0x9d88dbf6, 0xfffffe30, 0xff1b9d8a,
+0x9d3affff, 0xffffff7b, 0xfea09d88, 0x940fffff,
+0x88dbf6c3, 0xfffe489d, 0x1c9d8aff, 0x3affffff,
+0xffff7c9d, 0xa99d88ff, 0x0ffffffe, 0xdbf6c394,
+0xfe2c9d88, 0x9d8affff, 0xffffff1d, 0xff7d9d3a,
+0x9d88ffff, 0xfffffe9c, 0xf6c3940f, 0x2b9d88db,
+0x8afffffe, 0xffff1e9d, 0x7e9d3aff, 0x88ffffff,
+0xfffea89d, 0xc3940fff, 0x9d88dbf6, 0xfffffe24,
+0xff1f9d8a, 0x9d3affff, 0xffffff7f, 0xfe989d88,
+0x940fffff, 0x88dbf6c3, 0xfffe2a9d, 0x209d8aff,
+0x3affffff, 0x9d88805d, 0xfffffe97, 0xf6c3940f,
+0x209d88db, 0x8afffffe, 0xffff219d, 0x815d3aff,
+0xfe68b58b, 0x9d88ffff, 0xfffffe90, 0xf6c3940f,
+0x299d88db, 0x8afffffe, 0xffff229d, 0x6ef9c5ff,
+0x825d3afe, 0x2041e3c4, 0xfffe58bd, 0xb58b01ff,
+0xfffffe54, 0xfe969d88, 0x940fffff, 0x88dbf6c3,
+0xfffe1c9d, 0x239d8aff, 0xc5ffffff, 0x3ace6ef9,
+0xe3c4835d, 0x898d2071, 0x01fffffe, 0xc961c1c5,
+0xfe50b58b, 0x9d88ffff, 0xfffffe8c, 0xf6c3940f,
+0x289d88db, 0x8afffffe, 0xffff249d, 0x6ef9c5ff,
+0x845d3af6, 0xfe959d88, 0x940fffff, 0x88dbf6c3,
+0xfffe189d, 0x259d8aff, 0x3affffff, 0x9d88855d,
+0xfffffe94, 0xf6c3940f, 0x179d88db, 0x8afffffe,
+0xffff269d, 0x865d3aff, 0xfe8b9d88, 0x940fffff,
+0x88dbf6c3, 0xfffe109d, 0x279d8aff, 0x3affffff,
+0x9d88875d, 0xfffffe8a, 0x2049e3c4, 0xfffe88b5,
+0xb58b01ff, 0xfffffe4c, 0xf6c3940f, 0x6ef9c5db,
+0x44b58be6, 0xc4fffffe, 0xa52059e3, 0xfffffe4b,
+0x61c9c501, 0x62f1c5e4, 0x6ef9c5cc, 0x40b58bd6,
+0xc4fffffe, 0x952069e3, 0xfffffe4a, 0x6ef9c501,
+0x61e3c4de, 0x8b01e920, 0xfffe3c8d, 0x7ff9c5ff,
+0xfffe68ad, 0x61e9c5ff, 0xfffe6895, 0x6ef9c5ff,
+0x61e3c4d9, 0x8b01da20, 0xfffe3895, 0x6ef9c5ff,
+0x51e3c4ea, 0x8b01e820, 0xfffe3485, 0x61e1c5ff,
+0x62e9c5dd, 0x6cf1c5d3, 0x0539baca, 0xf9c50000,
+0x858be86e, 0xfffffe30, 0x2051e3c4, 0xfffe49ad,
+0xf9c501ff, 0x858bd06e, 0xfffffe2c, 0x2069e3c4,
+0xfffe4895, 0xd1c501ff, 0xf9c5ea61, 0x858bd86e,
+0xfffffe24, 0x2061e3c4, 0xfffe2b9d, 0xf9c501ff,
+0x858be06e, 0xfffffe20, 0x2059e3c4, 0xfffe2abd,
+0xf9c501ff, 0xfe68bd7f, 0xe1c5ffff, 0xfe689d61,
+0xd1c5ffff, 0xf9c5eb62, 0x858bf06e, 0xfffffe1c,
+0x2049e3c4, 0xfffe29b5, 0xf9c501ff, 0x858be06e,
+0xfffffe18, 0x2059e3c4, 0xfffe28bd, 0xf9c501ff,
+0xfe58bd7f, 0xc9c5ffff, 0xfe58b561, 0xf9c5ffff,
+0x858bf86e, 0xfffffe10, 0x2041e3c4, 0xfffe17bd,
+0xf9c501ff, 0xe3c4e06e, 0x01e32059, 0xfc61c1c5,
+0xf762c9c5, 0xee6cd1c5, 0x1875e3c4, 0x6fe801c5,
+0x84fffffa, 0x57840fc0, 0xc500001f, 0x08bd6ff9,
+0xc5ffffff, 0x688dfcc1, 0xc5ffffff, 0x18bd6ff9,
+0xc5ffffff, 0x7895fcc1, 0xc4ffffff, 0xca1875e3,
+0x7ffdc501, 0xffff288d, 0x6ff9c5ff, 0xffff68bd,
+0xfcc1c5ff, 0x6ff9c5d7, 0xffff78bd, 0x79e3c4ff,
+0x3800d014, 0xffff2885, 0xfcc1c5ff, 0x79e3c4cf,
+0x0f00cb14, 0xd8f6c094, 0xfe688588, 0xe3c4ffff,
+0x01d01479, 0xff298538, 0x940fffff, 0x88d8f6c0,
+0xfffe5885, 0x79e3c4ff, 0x3802d014, 0xffff2a85,
+0xc0940fff, 0x8588d8f6, 0xfffffe54, 0x1479e3c4,
+0x853803d0, 0xffffff2b, 0xf6c0940f, 0x898588d8,
+0xc4fffffe, 0xd01479e3, 0x2c853804, 0x0fffffff,
+0xd8f6c094, 0xfe508588, 0xe3c4ffff, 0x05d01479,
+0xff2d8538, 0x940fffff, 0x88d8f6c0, 0xfffe8885,
+0x79e3c4ff, 0x3806d014, 0xffff2e85, 0xc0940fff,
+0x8588d8f6, 0xfffffe4c, 0x1479e3c4, 0x853807d0,
+0xffffff2f, 0xf6c0940f, 0x4b8588d8, 0xc4fffffe,
+0xd01479e3, 0x30853808, 0x0fffffff, 0xd8f6c094,
+0xfe448588, 0xe3c4ffff, 0x09d01479, 0xff318538,
+0x940fffff, 0x88d8f6c0, 0xfffe4a85, 0x79e3c4ff,
+0x380ad014, 0xffff3285, 0xc0940fff, 0x8588d8f6,
+0xfffffe40, 0x1479e3c4, 0x85380bd0, 0xffffff33,
+0x1479e3c4, 0x940f0cd0, 0x38d9f6c1, 0xffff3485,
+0xc0940fff, 0x8588d8f6, 0xfffffe3c, 0x1479e3c4,
+0x85380dd0, 0xffffff35, 0x1479e3c4, 0x940f0ed0,
+0x38daf6c2, 0xffff3685, 0xc0940fff, 0x8588d8f6,
+0xfffffe38, 0x1479e3c4, 0x85380fd0, 0xffffff37,
+0xf6c0940f, 0x389d38d8, 0x0fffffff, 0xdbf6c394,
+0xfe349d88, 0xe3c4ffff, 0x01cb1479, 0xfe68b58b,
+0x9d38ffff, 0xffffff39, 0xc5c3940f, 0x8bfe6ef9,
+0xfffe54b5, 0xc4dbf6ff, 0xbd2041e3, 0xfffffe58,
+0x499d8801, 0xc4fffffe, 0xcb1479e3, 0x3a9d3802,
+0x0fffffff, 0xdbf6c394, 0xfe309d88, 0xe3c4ffff,
+0x03cb1479, 0xff3b9d38, 0x940fffff, 0x88dbf6c3,
+0xfffe489d, 0x79e3c4ff, 0x3804cb14, 0xffff3c9d,
+0xc3940fff, 0x9d88dbf6, 0xfffffe2c, 0x1479e3c4,
+0x9d3805cb, 0xffffff3d, 0xf6c3940f, 0x2b9d88db,
+0xc4fffffe, 0xcb1479e3, 0x3e9d3806, 0x0fffffff,
+0xdbf6c394, 0xfe249d88, 0xe3c4ffff, 0x07cb1479,
+0xff3f9d38, 0x940fffff, 0x88dbf6c3, 0xfffe2a9d,
+0x79e3c4ff, 0x3808cb14, 0xffff409d, 0xc3940fff,
+0x9d88dbf6, 0xfffffe20, 0x1479e3c4, 0x9d3809cb,
+0xffffff41, 0xf6c3940f, 0x299d88db, 0xc4fffffe,
+0xcb1479e3, 0x429d380a, 0x0fffffff, 0xdbf6c394,
+0xfe1c9d88, 0xe3c4ffff, 0x0bcb1479, 0xff439d38,
+0x940fffff, 0x88dbf6c3, 0xfffe289d, 0x79e3c4ff,
+0x380ccb14, 0xffff449d, 0xc3940fff, 0x9d88dbf6,
+0xfffffe18, 0x1479e3c4, 0x9d380dcb, 0xffffff45,
+0xf6c3940f, 0x179d88db, 0xc4fffffe, 0xcb1479e3,
+0x469d380e, 0x0fffffff, 0xdbf6c394, 0xfe109d88,
+0xe3c4ffff, 0x0fcb1479, 0xce6ef9c5, 0xff479d38,
+0xe3c4ffff, 0x898d2071, 0x01fffffe, 0xc961c1c5,
+0xfe50b58b, 0x940fffff, 0xc5dbf6c3, 0x8bf66ef9,
+0xfffe4cb5, 0x49e3c4ff, 0xfe88b520, 0xc501ffff,
+0x8be66ef9, 0xfffe44b5, 0x59e3c4ff, 0xfe4ba520,
+0xc501ffff, 0xc5e461c9, 0xc5cc62f1, 0x8bd66ef9,
+0xfffe40b5, 0x69e3c4ff, 0xfe4a9520, 0xc501ffff,
+0xc4de6ef9, 0xe92061e3, 0x3c8d8b01, 0xc5fffffe,
+0x68ad7ff9, 0xc5fffffe, 0x689561e9, 0xc5fffffe,
+0xc4d96ef9, 0xda2061e3, 0x38958b01, 0xc5fffffe,
+0xc4ea6ef9, 0xe82051e3, 0x34858b01, 0xc5fffffe,
+0xc5dd61e1, 0xc5d362e9, 0xbaca6cf1, 0x0000053f,
+0xe86ef9c5, 0xfe30858b, 0xe3c4ffff, 0x49ad2051,
+0x01fffffe, 0xd06ef9c5, 0xfe2c858b, 0xe3c4ffff,
+0x48952069, 0x01fffffe, 0xea61d1c5, 0xd86ef9c5,
+0xfe24858b, 0xe3c4ffff, 0x2b9d2061, 0x01fffffe,
+0xe06ef9c5, 0xfe20858b, 0xe3c4ffff, 0x2abd2059,
+0x01fffffe, 0xbd7ff9c5, 0xfffffe68, 0x9d61e1c5,
+0xfffffe68, 0xeb62d1c5, 0xf06ef9c5, 0xfe1c858b,
+0xe3c4ffff, 0x29b52049, 0x01fffffe, 0xe06ef9c5,
+0xfe18858b, 0xe3c4ffff, 0x28bd2059, 0x01fffffe,
+0xbd7ff9c5, 0xfffffe58, 0xb561c9c5, 0xfffffe58,
+0xf86ef9c5, 0xfe10858b, 0xe3c4ffff, 0x17bd2041,
+0x01fffffe, 0xe06ef9c5, 0x2059e3c4, 0xc1c501e3,
+0xc9c5fc61, 0xd1c5f762, 0xe3c4ee6c, 0x01c51875,
+0xfff5bde8, 0x0fc084ff, 0x001aa584, 0x6ff9c500,
+0xffff28b5, 0x6ff9c5ff, 0xffff38bd, 0xf8c9c5ff,
+0xffff6895, 0xf8c1c5ff, 0xffff788d, 0x6de3c4ff,
+0xc501f118, 0x68b57ffd, 0xc5fffffe, 0x68bd6ffd,
+0xc5fffffe, 0x48bd7ffd, 0x8affffff, 0xfffee885,
+0x48853aff, 0x0fffffff, 0xd8f6c094, 0xfee88588,
+0x858affff, 0xfffffed8, 0xff49853a, 0x940fffff,
+0x88d8f6c0, 0xfffed885, 0xd4858aff, 0x3afffffe,
+0xffff4a85, 0xc0940fff, 0x8588d8f6, 0xfffffed4,
+0xfed3858a, 0x853affff, 0xffffff4b, 0xf6c0940f,
+0xd38588d8, 0x8afffffe, 0xfffecc85, 0x4c853aff,
+0x0fffffff, 0xd8f6c094, 0xfecc8588, 0x858affff,
+0xfffffed2, 0xff4d853a, 0x940fffff, 0x88d8f6c0,
+0xfffed285, 0xc8858aff, 0x3afffffe, 0xffff4e85,
+0xc0940fff, 0x8588d8f6, 0xfffffec8, 0xfed1858a,
+0x853affff, 0xffffff4f, 0xf6c0940f, 0xd18588d8,
+0x8afffffe, 0xfffec485, 0x50853aff, 0x0fffffff,
+0xd8f6c094, 0xfec48588, 0x858affff, 0xfffffec0,
+0xff51853a, 0x858affff, 0xfffffebc, 0xf6c1940f,
+0x52853ad9, 0x0fffffff, 0xd8f6c094, 0xfec08588,
+0x858affff, 0xfffffeb8, 0xff53853a, 0x858affff,
+0xfffffeb4, 0xfed09d8a, 0x940fffff, 0x3adaf6c2,
+0xffff5485, 0xc0940fff, 0x8588d8f6, 0xfffffebc,
+0xfeb0858a, 0x853affff, 0xffffff55, 0xf6c0940f,
+0x569d3ad8, 0x0fffffff, 0xdbf6c394, 0xfeb89d88,
+0x9d8affff, 0xfffffeac, 0xff579d3a, 0x940fffff,
+0x88dbf6c3, 0xfffeb49d, 0xab9d8aff, 0x3afffffe,
+0xffff589d, 0xc3940fff, 0x9d88dbf6, 0xfffffeb0,
+0xfea49d8a, 0x9d3affff, 0xffffff59, 0xf6c3940f,
+0xd09d88db, 0x8afffffe, 0xfffeaa9d, 0x5a9d3aff,
+0x0fffffff, 0xdbf6c394, 0xfeac9d88, 0x9d8affff,
+0xfffffea0, 0xff5b9d3a, 0x940fffff, 0x88dbf6c3,
+0xfffeab9d, 0xa99d8aff, 0x3afffffe, 0xffff5c9d,
+0xc3940fff, 0x9d88dbf6, 0xfffffea4, 0xfe9c9d8a,
+0x9d3affff, 0xffffff5d, 0xf6c3940f, 0xaa9d88db,
+0x8afffffe, 0xfffea89d, 0x5e9d3aff, 0x8bffffff,
+0xfffee8b5, 0xc3940fff, 0x9d88dbf6, 0xfffffea0,
+0xfe989d8a, 0xf9c5ffff, 0x9d3ace6e, 0xffffff5f,
+0x2071e3c4, 0xfffed88d, 0xb58b01ff, 0xfffffed4,
+0xf6c3940f, 0xa99d88db, 0x8afffffe, 0xfffe979d,
+0x6ef9c5ff, 0x609d3afe, 0xc4ffffff, 0xbd2041e3,
+0xfffffed3, 0x61f1c501, 0xc3940fcf, 0x9d88dbf6,
+0xfffffe9c, 0xfe909d8a, 0x9d3affff, 0xffffff61,
+0xf6c3940f, 0xa89d88db, 0x8afffffe, 0xfffe969d,
+0x629d3aff, 0x0fffffff, 0xdbf6c394, 0xfe989d88,
+0x9d8affff, 0xfffffe8c, 0xff639d3a, 0x940fffff,
+0x88dbf6c3, 0xfffe979d, 0x959d8aff, 0x3afffffe,
+0xffff649d, 0xc3940fff, 0x9d88dbf6, 0xfffffe90,
+0xfe949d8a, 0x9d3affff, 0xffffff65, 0xf6c3940f,
+0x969d88db, 0x8afffffe, 0xfffe8b9d, 0x669d3aff,
+0x0fffffff, 0xdbf6c394, 0xfe8c9d88, 0x9d8affff,
+0xfffffe8a, 0xff679d3a, 0xb58bffff, 0xfffffecc,
+0xf6c3940f, 0x6ef9c5db, 0xc8b58bf6, 0xc4fffffe,
+0xb52049e3, 0xfffffed2, 0x6ef9c501, 0xc4b58be6,
+0xc4fffffe, 0xa52059e3, 0xfffffed1, 0x61c9c501,
+0x62f1c5e4, 0x6ef9c5cc, 0x69e3c4d6, 0x8b01d120,
+0xfffec08d, 0x6ef9c5ff, 0x61e3c4d9, 0x8b01ea20,
+0xfffebc95, 0x7ff9c5ff, 0xfffee8ad, 0x61e9c5ff,
+0xfffee895, 0x6ef9c5ff, 0x61e3c4da, 0x8b01d820,
+0xfffeb885, 0x0544baff, 0xf9c50000, 0x858be86e,
+0xfffffeb0, 0x2051e3c4, 0xfffeb4ad, 0xe1c501ff,
+0xe9c5dd61, 0xf1c5d362, 0xf9c5ca6c, 0x858be86e,
+0xfffffeac, 0x2051e3c4, 0xfffed0ad, 0xf9c501ff,
+0x858be06e, 0xfffffea4, 0x2059e3c4, 0xfffeaba5,
+0xd1c501ff, 0xf9c5ec61, 0x858bd86e, 0xfffffea0,
+0x2061e3c4, 0xfffeaa9d, 0xf9c501ff, 0x858bd06e,
+0xfffffe9c, 0x2069e3c4, 0xfffea9b5, 0xf9c501ff,
+0xfee8b57f, 0xe1c5ffff, 0xfee89d61, 0xd1c5ffff,
+0xf9c5eb62, 0x858bf06e, 0xfffffe98, 0x2049e3c4,
+0xfffea8b5, 0xf9c501ff, 0x858bd06e, 0xfffffe90,
+0x2069e3c4, 0xfffe97bd, 0xf9c501ff, 0xfed8bd7f,
+0xc9c5ffff, 0xfed8b561, 0xf9c5ffff, 0x858bf86e,
+0xfffffe8c, 0x2041e3c4, 0xfffe96bd, 0xf9c501ff,
+0xe3c4d06e, 0x01d32069, 0xfa61c1c5, 0xf762c9c5,
+0xee6cd1c5, 0x1875e3c4, 0x13e801c5, 0x84fffff1,
+0xfb840fc0, 0xc5000015, 0x08b56ffd, 0xc5ffffff,
+0x884d56cc, 0x8d7ffdc5, 0xffffff08, 0xbd6ffdc5,
+0xfffffe68, 0x4d54c4c5, 0x6ffdc588, 0xffff48b5,
+0x57ccc5ff, 0xfdc58865, 0xff48a57f, 0x958affff,
+0xffffff48, 0x8d55f4c5, 0xffffff08, 0x1479e3c4,
+0xc23800c8, 0xf6c0940f, 0xe88588d8, 0xc4fffffe,
+0xc81479e3, 0x49853801, 0x0fffffff, 0xd8f6c094,
+0xfed88588, 0xe3c4ffff, 0x02c81479, 0xff4a8538,
+0x940fffff, 0x88d8f6c0, 0xfffed485, 0x79e3c4ff,
+0x3803c814, 0xffff4b85, 0xc0940fff, 0x8588d8f6,
+0xfffffed3, 0x1479e3c4, 0x853804c8, 0xffffff4c,
+0xf6c0940f, 0xcc8588d8, 0xc4fffffe, 0xc81479e3,
+0x4d853805, 0x0fffffff, 0xd8f6c094, 0xfed28588,
+0xe3c4ffff, 0x06c81479, 0xff4e8538, 0x940fffff,
+0x88d8f6c0, 0xfffec885, 0x79e3c4ff, 0x3807c814,
+0xffff4f85, 0xc0940fff, 0x8588d8f6, 0xfffffed1,
+0x1479e3c4, 0x853808c8, 0xffffff50, 0xf6c0940f,
+0xc48588d8, 0xc4fffffe, 0xc81479e3, 0x51853809,
+0x0fffffff, 0xd8f6c094, 0xfec08588, 0xe3c4ffff,
+0x0ac81479, 0xff528538, 0x940fffff, 0x88d8f6c0,
+0xfffebc85, 0x79e3c4ff, 0x380bc814, 0xffff5385,
+0x79e3c4ff, 0x0f0cc814, 0xdbf6c394, 0xff548538,
+0x940fffff, 0x88d8f6c0, 0xfffeb885, 0x79e3c4ff,
+0x380dc814, 0xffff5585, 0x79e3c4ff, 0x0f0ec814,
+0xd9f6c194, 0xff568538, 0x940fffff, 0x88d8f6c0,
+0xfffeb485, 0x79e3c4ff, 0xc40fc814, 0xc9197de3,
+0x57853801, 0xc4ffffff, 0xc81479e3, 0xc2940f00,
+0x8538daf6, 0xffffff58, 0xf6c0940f, 0xb08588d8,
+0xc4fffffe, 0xc81479e3, 0x59853801, 0x0fffffff,
+0xd8f6c094, 0xfed08588, 0xe3c4ffff, 0x02c81479,
+0xfee8b58b, 0x8538ffff, 0xffffff5a, 0xc5c0940f,
+0x8bfe6ef9, 0xfffed4b5, 0xc4d8f6ff, 0xbd2041e3,
+0xfffffed8, 0xac858801, 0xc4fffffe, 0xc81479e3,
+0x5b853803, 0x0fffffff, 0xd8f6c094, 0xfeab8588,
+0xe3c4ffff, 0x04c81479, 0xff5c8538, 0x940fffff,
+0x88d8f6c0, 0xfffea485, 0x79e3c4ff, 0x3805c814,
+0xffff5d85, 0xc0940fff, 0x8588d8f6, 0xfffffeaa,
+0x1479e3c4, 0x853806c8, 0xffffff5e, 0xf6c0940f,
+0xa08588d8, 0xc4fffffe, 0xc81479e3, 0x5f853807,
+0x0fffffff, 0xd8f6c094, 0xfea98588, 0xe3c4ffff,
+0x08c81479, 0xff608538, 0x940fffff, 0x88d8f6c0,
+0xfffe9c85, 0x79e3c4ff, 0x3809c814, 0xffff6185,
+0xc0940fff, 0x8588d8f6, 0xfffffea8, 0x1479e3c4,
+0x85380ac8, 0xffffff62, 0xf6c0940f, 0x988588d8,
+0xc4fffffe, 0xc81479e3, 0x6385380b, 0x0fffffff,
+0xd8f6c094, 0xfe978588, 0xe3c4ffff, 0x0cc81479,
+0xff648538, 0x940fffff, 0x88d8f6c0, 0xfffe9085,
+0x79e3c4ff, 0x380dc814, 0xffff6585, 0xc0940fff,
+0x8588d8f6, 0xfffffe96, 0x1479e3c4, 0x85380ec8,
+0xffffff66, 0xf6c0940f, 0x8c8588d8, 0xc4fffffe,
+0xc81479e3, 0x6ef9c50f, 0xccb58bce, 0xc4fffffe,
+0x8d2071e3, 0xfffffed3, 0x61c1c501, 0x678538c9,
+0xc5ffffff, 0xc4f66ef9, 0xb52049e3, 0xfffffed2,
+0xc8b58b01, 0x0ffffffe, 0xd8f6c094, 0xe66ef9c5,
+0xfec4b58b, 0xe3c4ffff, 0xd1a52059, 0x01fffffe,
+0xe461c9c5, 0xcc62f1c5, 0xd66ef9c5, 0xfebcb58b,
+0xe3c4ffff, 0xc0952069, 0x01fffffe, 0xde6ef9c5,
+0x2061e3c4, 0x9d8b01eb, 0xfffffeb8, 0xad7ff9c5,
+0xfffffee8, 0x9561e9c5, 0xfffffee8, 0xdb6ef9c5,
+0x2061e3c4, 0x8d8b01d9, 0xfffffeb4, 0xe96ef9c5,
+0x2051e3c4, 0x958b01ea, 0xfffffeb0, 0xdd61e1c5,
+0xd362e9c5, 0xca6cf1c5, 0xea6ef9c5, 0xfeac958b,
+0xe3c4ffff, 0xd0ad2051, 0x01fffffe, 0xd26ef9c5,
+0xfea4958b, 0xe3c4ffff, 0xab952069, 0x01fffffe,
+0xea61d1c5, 0xda6ef9c5, 0xfea0958b, 0xe3c4ffff,
+0xaa9d2061, 0x01fffffe, 0xe26ef9c5, 0xfe9c958b,
+0xe3c4ffff, 0xa9bd2059, 0x01fffffe, 0xbd7ff9c5,
+0xfffffee8, 0x9d61e1c5, 0xfffffee8, 0xeb62d1c5,
+0xf26ef9c5, 0xfe98958b, 0xe3c4ffff, 0xa8b52049,
+0x01fffffe, 0xe26ef9c5, 0xfe90958b, 0xe3c4ffff,
+0x97a52059, 0x01fffffe, 0xa57ff9c5, 0xfffffed8,
+0xb561c9c5, 0xfffffed8, 0xfa6ef9c5, 0xfe8c958b,
+0xe3c4ffff, 0x96bd2041, 0x01fffffe, 0xe26ef9c5,
+0x2059e3c4, 0xc1c501e0, 0xc9c5fc61, 0xd1c5f762,
+0xe3c4ee6c, 0x01c51875, 0xffec65e8, 0x0550baff,
+0xc0840000, 0x1148840f, 0x458a0000, 0x18d8f6c8,
+0xe88588c0, 0x8afffffe, 0xd8f6c945, 0x8588c018,
+0xfffffed8, 0xf6ca458a, 0xcb458ad8, 0xf9c5db18,
+0xd8f6cb6e, 0x8588c018, 0xfffffed4, 0xf6cc458a,
+0xcd458ad8, 0xf9c5c918, 0xd8f6f16e, 0x8588c018,
+0xfffffed3, 0xf6ce458a, 0x88c018d8, 0xfffecc85,
+0xcf458aff, 0xc018d8f6, 0xfed28588, 0x458affff,
+0x18d8f6d0, 0xc88588c0, 0x8afffffe, 0xd8f6d145,
+0x8588c018, 0xfffffed1, 0xf6d2458a, 0x88c018d8,
+0xfffec485, 0xd3458aff, 0xc018d8f6, 0xfec08588,
+0x458affff, 0x8ad8f6d4, 0xd218d545, 0xc018d8f6,
+0xfebc8588, 0x458affff, 0x18d8f6d6, 0xb88588c0,
+0x8afffffe, 0xd8f6d745, 0x8588c018, 0xfffffeb4,
+0xf6d8458a, 0x88c018d8, 0xfffeb085, 0xd9458aff,
+0xc018d8f6, 0xfed08588, 0x458affff, 0x49e3c4da,
+0xfed3b520, 0x8b01ffff, 0xfffecc8d, 0x71e3c4ff,
+0xfed48d20, 0x8b01ffff, 0xfffee8b5, 0x18d8f6ff,
+0x6ef9c5c0, 0xac8588e1, 0x8afffffe, 0xf9c5db45,
+0xe3c4fe6e, 0xd8bd2041, 0x01fffffe, 0xc961c1c5,
+0xc018d8f6, 0xfeab8588, 0x458affff, 0x18d8f6dc,
+0xa48588c0, 0x8afffffe, 0xd8f6dd45, 0x8588c018,
+0xfffffeaa, 0xf6de458a, 0x88c018d8, 0xfffea085,
+0xdf458aff, 0xc018d8f6, 0xfea98588, 0x458affff,
+0x18d8f6e0, 0x9c8588c0, 0x8afffffe, 0xd8f6e145,
+0x8588c018, 0xfffffea8, 0xf6e2458a, 0x88c018d8,
+0xfffe9885, 0xe3458aff, 0xc018d8f6, 0xfe978588,
+0x458affff, 0x18d8f6e4, 0x908588c0, 0x8afffffe,
+0xd8f6e545, 0x8588c018, 0xfffffe96, 0xf6e6458a,
+0x88c018d8, 0xfffe8c85, 0xe7458aff, 0x2059e3c4,
+0xfffed2a5, 0x8d8b01ff, 0xfffffec8, 0xe461c9c5,
+0xcc62f1c5, 0xf9c5d8f6, 0x8d8bd16e, 0xfffffec4,
+0x2069e3c4, 0xfffed195, 0xc01801ff, 0xd96ef9c5,
+0x2061e3c4, 0xfffec09d, 0xf9c501ff, 0xfee89d7f,
+0xf9c5ffff, 0x958bda6e, 0xfffffeb8, 0x2061e3c4,
+0xfffebc9d, 0xe9c501ff, 0xfee89561, 0xf9c5ffff,
+0x958bea6e, 0xfffffeb0, 0x2051e3c4, 0xfffeb4ad,
+0xe1c501ff, 0xe9c5dd61, 0xf1c5d362, 0xf9c5ca6c,
+0x958bea6e, 0xfffffeac, 0x2051e3c4, 0xfffed0ad,
+0xf9c501ff, 0x958bfa6e, 0xfffffea4, 0x2041e3c4,
+0xfffeabbd, 0xd1c501ff, 0xf9c5ef61, 0x958bda6e,
+0xfffffea0, 0x2061e3c4, 0xfffeaa9d, 0xf9c501ff,
+0x958bd26e, 0xfffffe9c, 0x2069e3c4, 0xfffea9b5,
+0xf9c501ff, 0xfee8b57f, 0xe1c5ffff, 0xfee89d61,
+0xd1c5ffff, 0xf9c5eb62, 0x958bf26e, 0xfffffe98,
+0x2049e3c4, 0xfffea8b5, 0xf9c501ff, 0x958bd26e,
+0xfffffe90, 0x2069e3c4, 0xfffe97a5, 0xf9c501ff,
+0xfed8a57f, 0xc9c5ffff, 0xfed8b561, 0xf9c5ffff,
+0x958bd26e, 0xfffffe8c, 0x2069e3c4, 0xfffe9695,
+0xf9c501ff, 0xe3c4e26e, 0x01e02059, 0xd461e9c5,
+0xf262c9c5, 0xee6cd1c5, 0x1875e3c4, 0xf4c501cd,
+0xff688d54, 0xf9c5ffff, 0xfdc5d16f, 0xff488d7f,
+0xe98fffff, 0xc85d98f0, 0x7d6ff9c5, 0x40e98fd8,
+0xff588d98, 0xe3c4ffff, 0x01f11865, 0xb57ffdc5,
+0xfffffee8, 0xbd6ffdc5, 0xfffffee8, 0xfee8958a,
+0xfdc5ffff, 0xff08bd7f, 0xf1c5ffff, 0xf1c5c976,
+0xc5c85dfc, 0xd84dfcf1, 0x1865e3c4, 0xfdc501c9,
+0x8fc84d7f, 0x5598e8e9, 0x6ff9c5c8, 0xe98fd865,
+0x588d9858, 0xc4ffffff, 0xd9186de3, 0xfce9c501,
+0x7ffdc5d2, 0xffff289d, 0x79e3c4ff, 0x3800d014,
+0xfcf1c5c2, 0xc0940fc9, 0x8588d8f6, 0xfffffee8,
+0x1479e3c4, 0x853801d0, 0xffffff09, 0xf6c0940f,
+0xd88588d8, 0xc4fffffe, 0xd01479e3, 0x0a853802,
+0x0fffffff, 0xd8f6c094, 0xfed48588, 0xe3c4ffff,
+0x03d01479, 0xff0b8538, 0x940fffff, 0x88d8f6c0,
+0xfffed385, 0x79e3c4ff, 0x3804d014, 0xffff0c85,
+0xc0940fff, 0x8588d8f6, 0xfffffecc, 0x1479e3c4,
+0x853805d0, 0xffffff0d, 0xf6c0940f, 0xd28588d8,
+0xc4fffffe, 0xd01479e3, 0x0e853806, 0x0fffffff,
+0xd8f6c094, 0xfec88588, 0xe3c4ffff, 0x07d01479,
+0xff0f8538, 0x940fffff, 0x88d8f6c0, 0xfffed185,
+0x79e3c4ff, 0x3808d014, 0xffff1085, 0xc0940fff,
+0x8588d8f6, 0xfffffec4, 0x1479e3c4, 0x853809d0,
+0xffffff11, 0xf6c0940f, 0xc08588d8, 0xc4fffffe,
+0xd01479e3, 0x1285380a, 0x0fffffff, 0xd8f6c094,
+0xfebc8588, 0xe3c4ffff, 0x0bd01479, 0xff138538,
+0xe3c4ffff, 0x0cd01479, 0xf6c3940f, 0x148538db,
+0x0fffffff, 0xd8f6c094, 0xfeb88588, 0xe3c4ffff,
+0x0dd01479, 0xff158538, 0xe3c4ffff, 0x0ed01479,
+0xf6c1940f, 0x168538d9, 0x0fffffff, 0xd8f6c094,
+0xfeb48588, 0xe3c4ffff, 0x0fd01479, 0xff178538,
+0xe3c4ffff, 0x00c81479, 0xf6c2940f, 0x188538da,
+0x0fffffff, 0xd8f6c094, 0xfeb08588, 0xe3c4ffff,
+0x01c81479, 0xff198538, 0x940fffff, 0x88d8f6c0,
+0xfffed085, 0x79e3c4ff, 0x3802c814, 0xffff1a85,
+0xc0940fff, 0x8588d8f6, 0xfffffeac, 0x1479e3c4,
+0x853803c8, 0xffffff1b, 0xf6c0940f, 0xab8588d8,
+0xc4fffffe, 0xc81479e3, 0x1c853804, 0x0fffffff,
+0xd8f6c094, 0xfea48588, 0xe3c4ffff, 0x05c81479,
+0xff1d8538, 0x940fffff, 0x88d8f6c0, 0xfffeaa85,
+0x79e3c4ff, 0x3806c814, 0xffff1e85, 0xc0940fff,
+0x8588d8f6, 0xfffffea0, 0x1479e3c4, 0x853807c8,
+0xffffff1f, 0xf6c0940f, 0xa98588d8, 0xc4fffffe,
+0xc81479e3, 0x20853808, 0x0fffffff, 0xd8f6c094,
+0xfe9c8588, 0xe3c4ffff, 0x09c81479, 0xff218538,
+0x940fffff, 0x88d8f6c0, 0xfffea885, 0x79e3c4ff,
+0x380ac814, 0xffff2285, 0xc0940fff, 0x8588d8f6,
+0xfffffe98, 0x1479e3c4, 0x85380bc8, 0xffffff23,
+0xf6c0940f, 0x978588d8, 0xc4fffffe, 0xc81479e3,
+0x2485380c, 0x0fffffff, 0xd8f6c094, 0xfe908588,
+0xe3c4ffff, 0x0dc81479, 0xff258538, 0x940fffff,
+0x88d8f6c0, 0xfffe9685, 0x79e3c4ff, 0x380ec814,
+0xffff2685, 0xc0940fff, 0x8588d8f6, 0xfffffe8c,
+0xfee8b58b, 0xe3c4ffff, 0x0fc81479, 0xff278538,
+0xf9c5ffff, 0xb58bfe6e, 0xfffffed4, 0x2041e3c4,
+0xfffed8bd, 0x940f01ff, 0xc5d8f6c0, 0x8bce6ef9,
+0xfffeccb5, 0x71e3c4ff, 0xfed38d20, 0xc501ffff,
+0xc5c961c1, 0x8bf66ef9, 0xfffec8b5, 0x49e3c4ff,
+0xfed2b520, 0xc501ffff, 0x8be66ef9, 0xfffec4b5,
+0x59e3c4ff, 0xfed1a520, 0xc501ffff, 0xc5e461c9,
+0xc5cc62f1, 0x8bd66ef9, 0xfffebcb5, 0x69e3c4ff,
+0xfec09520, 0xc501ffff, 0xc4de6ef9, 0xeb2061e3,
+0xb89d8b01, 0xc5fffffe, 0xe8ad7ff9, 0xc5fffffe,
+0xe89561e9, 0xc5fffffe, 0xc4db6ef9, 0xd92061e3,
+0xb48d8b01, 0xc5fffffe, 0xc4e96ef9, 0xea2051e3,
+0xb0958b01, 0xc5fffffe, 0xc5dd61e1, 0xc5d362e9,
+0xc5ca6cf1, 0x8bea6ef9, 0xfffeac95, 0x51e3c4ff,
+0xfed0ad20, 0xc501ffff, 0x8bd26ef9, 0xfffea495,
+0x69e3c4ff, 0xfeab9520, 0xc501ffff, 0xc5ea61d1,
+0x8bda6ef9, 0xfffea095, 0x61e3c4ff, 0xfeaa9d20,
+0xc501ffff, 0x8be26ef9, 0xfffe9c95, 0x59e3c4ff,
+0xfea9b520, 0xc501ffff, 0xe8b57ff9, 0xc5fffffe,
+0x8bf26ef9, 0xfffe9895, 0x49e3c4ff, 0xfea8b520,
+0xc501ffff, 0x8be26ef9, 0xfffe9095, 0x59e3c4ff,
+0xfe97bd20, 0xc501ffff, 0xd8bd7ff9, 0xc5fffffe,
+0xc4fa6ef9, 0xbd2041e3, 0xfffffe96, 0x8c958b01,
+0xc5fffffe, 0xe89d61e1, 0xc5fffffe, 0xd8b561c9,
+0xc5fffffe, 0xc5eb62d1, 0xc4e26ef9, 0xe02059e3,
+0x61c1c501, 0x62c9c5fc, 0x6cd1c5f7, 0x75e3c4ee,
+0xe801c518, 0xffffe45a, 0x000621ba, 0x0fc08400,
+0x00093d84, 0xeff1c500, 0xf8f1c5c9, 0xf1c5c855,
+0x8fd84df8, 0x959468e9, 0xffffff28, 0x9470e98f,
+0xffff388d, 0x79e3c4ff, 0x3800d014, 0xffff4885,
+0x6de3c4ff, 0xc501d918, 0x089d7ffd, 0x0fffffff,
+0xd8f6c094, 0xfee88588, 0xe3c4ffff, 0x01d01479,
+0xff498538, 0x940fffff, 0x88d8f6c0, 0xfffed885,
+0x79e3c4ff, 0x3802d014, 0xffff4a85, 0xc0940fff,
+0x8588d8f6, 0xfffffed4, 0x1479e3c4, 0x853803d0,
+0xffffff4b, 0xf6c0940f, 0xd38588d8, 0xc4fffffe,
+0xd01479e3, 0x4c853804, 0x0fffffff, 0xd8f6c094,
+0xfecc8588, 0xe3c4ffff, 0x05d01479, 0xff4d8538,
+0x940fffff, 0x88d8f6c0, 0xfffed285, 0x79e3c4ff,
+0x3806d014, 0xffff4e85, 0xc0940fff, 0x8588d8f6,
+0xfffffec8, 0x1479e3c4, 0x853807d0, 0xffffff4f,
+0xf6c0940f, 0xd18588d8, 0xc4fffffe, 0xd01479e3,
+0x50853808, 0x0fffffff, 0xd8f6c094, 0xfec48588,
+0xe3c4ffff, 0x09d01479, 0xff518538, 0x940fffff,
+0x88d8f6c0, 0xfffec085, 0x79e3c4ff, 0x380ad014,
+0xffff5285, 0xc0940fff, 0x8588d8f6, 0xfffffebc,
+0x1479e3c4, 0x85380bd0, 0xffffff53, 0x1479e3c4,
+0x940f0cd0, 0x38dbf6c3, 0xffff5485, 0xc0940fff,
+0x8588d8f6, 0xfffffeb8, 0x1479e3c4, 0x85380dd0,
+0xffffff55, 0x1479e3c4, 0x940f0ed0, 0x38d9f6c1,
+0xffff5685, 0xc0940fff, 0x8588d8f6, 0xfffffeb4,
+0x1479e3c4, 0x85380fd0, 0xffffff57, 0x1479e3c4,
+0x940f00c8, 0x38daf6c2, 0xffff5885, 0xc0940fff,
+0x8588d8f6, 0xfffffeb0, 0x1479e3c4, 0x853801c8,
+0xffffff59, 0xf6c0940f, 0xd08588d8, 0xc4fffffe,
+0xc81479e3, 0x5a853802, 0x0fffffff, 0xd8f6c094,
+0xfeac8588, 0xe3c4ffff, 0x03c81479, 0xff5b8538,
+0x940fffff, 0x88d8f6c0, 0xfffeab85, 0x79e3c4ff,
+0x3804c814, 0xffff5c85, 0xc0940fff, 0x8588d8f6,
+0xfffffea4, 0x1479e3c4, 0x853805c8, 0xffffff5d,
+0xf6c0940f, 0xaa8588d8, 0xc4fffffe, 0xc81479e3,
+0x5e853806, 0x0fffffff, 0xd8f6c094, 0xfea08588,
+0xe3c4ffff, 0x07c81479, 0xff5f8538, 0x940fffff,
+0x88d8f6c0, 0xfffea985, 0x79e3c4ff, 0x3808c814,
+0xffff6085, 0xc0940fff, 0x8588d8f6, 0xfffffe9c,
+0x1479e3c4, 0x853809c8, 0xffffff61, 0xf6c0940f,
+0xa88588d8, 0xc4fffffe, 0xc81479e3, 0x6285380a,
+0x0fffffff, 0xd8f6c094, 0xfe988588, 0xe3c4ffff,
+0x0bc81479, 0xff638538, 0x940fffff, 0x88d8f6c0,
+0xfffe9785, 0x79e3c4ff, 0x380cc814, 0xffff6485,
+0xc0940fff, 0x8588d8f6, 0xfffffe90, 0x1479e3c4,
+0x85380dc8, 0xffffff65, 0xf6c0940f, 0x968588d8,
+0xc4fffffe, 0xc81479e3, 0x6685380e, 0x8bffffff,
+0xfffee8b5, 0xc0940fff, 0xf9c5d8f6, 0x8588fe6e,
+0xfffffe8c, 0xfed4b58b, 0xe3c4ffff, 0x0fc81479,
+0x2041e3c4, 0xfffed8bd, 0x853801ff, 0xffffff67,
+0xce6ef9c5, 0xfeccb58b, 0xe3c4ffff, 0xd38d2071,
+0x01fffffe, 0xc961c1c5, 0xf6c0940f, 0x6ef9c5d8,
+0xc8b58bf6, 0xc4fffffe, 0xb52049e3, 0xfffffed2,
+0x6ef9c501, 0xc4b58be6, 0xc4fffffe, 0xa52059e3,
+0xfffffed1, 0x61c9c501, 0x62f1c5e4, 0x6ef9c5cc,
+0xbcb58bd6, 0xc4fffffe, 0x952069e3, 0xfffffec0,
+0x6ef9c501, 0x61e3c4de, 0x8b01db20, 0xfffeb89d,
+0x7ff9c5ff, 0xfffee89d, 0x61e9c5ff, 0xfffee895,
+0x6ef9c5ff, 0x61e3c4db, 0x8b01d920, 0xfffeb48d,
+0x6ef9c5ff, 0x51e3c4e9, 0x8b01ea20, 0xfffeb095,
+0x61e1c5ff, 0x62e9c5dd, 0x6cf1c5d3, 0x6ef9c5ca,
+0xac958bea, 0xc4fffffe, 0xad2051e3, 0xfffffed0,
+0x6ef9c501, 0xa4958bd2, 0xc4fffffe, 0x952069e3,
+0xfffffeab, 0x61d1c501, 0x6ef9c5ea, 0xa0958bda,
+0xc4fffffe, 0x9d2061e3, 0xfffffeaa, 0x6ef9c501,
+0x9c958be2, 0xc4fffffe, 0xa52059e3, 0xfffffea9,
+0x7ff9c501, 0xfffee8a5, 0x6ef9c5ff, 0x98958bf2,
+0xc4fffffe, 0xb52049e3, 0xfffffea8, 0x6ef9c501,
+0x59e3c4e2, 0xfe97bd20, 0xc501ffff, 0xd8bd7ff9,
+0x8bfffffe, 0xfffe9095, 0x61e1c5ff, 0xfffee89d,
+0x61c9c5ff, 0xfffed8b5, 0x62d1c5ff, 0x6ef9c5eb,
+0x8c958bfa, 0xc4fffffe, 0xbd2041e3, 0xfffffe96,
+0x6ef9c501, 0x59e3c4e2, 0xc501e020, 0xc5fc61c1,
+0xc5f762c9, 0xc4ee6cd1, 0xc51875e3, 0xdfc0e801,
+0x26baffff, 0x84000006, 0xa3840fc0, 0xb8000004,
+0x00000001, 0x8d6ffdc5, 0xffffff68, 0x8d7ffdc5,
+0xffffff28, 0x8805548a, 0x28059488, 0x83ffffff,
+0xf88302c0, 0xc5ed7521, 0xa8756ffd, 0xa274e88f,
+0xc460884d, 0xc81479e3, 0x28853800, 0x0fffffff,
+0xd8f6c094, 0xfee88588, 0xe3c4ffff, 0x01c81479,
+0xff298538, 0x940fffff, 0x88d8f6c0, 0xfffed885,
+0x79e3c4ff, 0x3802c814, 0xffff2a85, 0xc0940fff,
+0x8588d8f6, 0xfffffed4, 0x1479e3c4, 0x853803c8,
+0xffffff2b, 0xf6c0940f, 0xd38588d8, 0xc4fffffe,
+0xc81479e3, 0x2c853804, 0x0fffffff, 0xd8f6c094,
+0xfecc8588, 0xe3c4ffff, 0x05c81479, 0xff2d8538,
+0x940fffff, 0x88d8f6c0, 0xfffed285, 0x79e3c4ff,
+0x3806c814, 0xffff2e85, 0xc0940fff, 0x8588d8f6,
+0xfffffec8, 0x1479e3c4, 0x853807c8, 0xffffff2f,
+0xf6c0940f, 0xd18588d8, 0xc4fffffe, 0xc81479e3,
+0x30853808, 0x0fffffff, 0xd8f6c094, 0xfec48588,
+0xe3c4ffff, 0x09c81479, 0xff318538, 0x940fffff,
+0x88d8f6c0, 0xfffec085, 0x79e3c4ff, 0x380ac814,
+0xffff3285, 0xc0940fff, 0x8588d8f6, 0xfffffebc,
+0x1479e3c4, 0x85380bc8, 0xffffff33, 0x1479e3c4,
+0x940f0cc8, 0x38dbf6c3, 0xffff3485, 0xc0940fff,
+0x8588d8f6, 0xfffffeb8, 0x1479e3c4, 0x85380dc8,
+0xffffff35, 0x1479e3c4, 0x940f0ec8, 0x38d9f6c1,
+0xffff3685, 0xc0940fff, 0x8588d8f6, 0xfffffeb4,
+0x1479e3c4, 0xe3c40fc8, 0x01c9197d, 0xff378538,
+0xe3c4ffff, 0x00c81479, 0xf6c2940f, 0x388538da,
+0x0fffffff, 0xd8f6c094, 0xfeb08588, 0xe3c4ffff,
+0x01c81479, 0xfee8b58b, 0x8538ffff, 0xffffff39,
+0xc5c0940f, 0x8bfe6ef9, 0xfffed4b5, 0xc4d8f6ff,
+0xbd2041e3, 0xfffffed8, 0xd0858801, 0xc4fffffe,
+0xc81479e3, 0x3a853802, 0x0fffffff, 0xd8f6c094,
+0xfeac8588, 0xe3c4ffff, 0x03c81479, 0xff3b8538,
+0x940fffff, 0x88d8f6c0, 0xfffeab85, 0x79e3c4ff,
+0x3804c814, 0xffff3c85, 0xc0940fff, 0x8588d8f6,
+0xfffffea4, 0x1479e3c4, 0x853805c8, 0xffffff3d,
+0xf6c0940f, 0xaa8588d8, 0xc4fffffe, 0xc81479e3,
+0x3e853806, 0x0fffffff, 0xd8f6c094, 0xfea08588,
+0xe3c4ffff, 0x07c81479, 0xff3f8538, 0x940fffff,
+0x88d8f6c0, 0xfffea985, 0x79e3c4ff, 0x3808c814,
+0xffff4085, 0xc0940fff, 0x8588d8f6, 0xfffffe9c,
+0x1479e3c4, 0x853809c8, 0xffffff41, 0xf6c0940f,
+0xa88588d8, 0xc4fffffe, 0xc81479e3, 0x4285380a,
+0x0fffffff, 0xd8f6c094, 0xfe988588, 0xe3c4ffff,
+0x0bc81479, 0xff438538, 0x940fffff, 0x88d8f6c0,
+0xfffe9785, 0x79e3c4ff, 0x380cc814, 0xffff4485,
+0xc0940fff, 0x8588d8f6, 0xfffffe90, 0x1479e3c4,
+0x85380dc8, 0xffffff45, 0xf6c0940f, 0x968588d8,
+0xc4fffffe, 0xc81479e3, 0x4685380e, 0x0fffffff,
+0xd8f6c094, 0xfe8c8588, 0xe3c4ffff, 0x0fc81479,
+0xce6ef9c5, 0xff478538, 0xe3c4ffff, 0xd38d2071,
+0x01fffffe, 0xc961c1c5, 0xfeccb58b, 0x940fffff,
+0xc5d8f6c0, 0x8bf66ef9, 0xfffec8b5, 0x49e3c4ff,
+0xfed2b520, 0xc501ffff, 0x8be66ef9, 0xfffec4b5,
+0x59e3c4ff, 0xfed1a520, 0xc501ffff, 0xc5e461c9,
+0xc5cc62f1, 0x8bd66ef9, 0xfffebcb5, 0x69e3c4ff,
+0xfec09520, 0xc501ffff, 0xc4de6ef9, 0xeb2061e3,
+0xb89d8b01, 0xc5fffffe, 0xe8ad7ff9, 0xc5fffffe,
+0xe89561e9, 0xc5fffffe, 0xc4db6ef9, 0xd92061e3,
+0xb48d8b01, 0xc5fffffe, 0xc4e96ef9, 0xea2051e3,
+0xb0958b01, 0xc5fffffe, 0xc5dd61e1, 0xc5d362e9,
+0xc5ca6cf1, 0x8bea6ef9, 0xfffeac95, 0x51e3c4ff,
+0xfed0ad20, 0xc501ffff, 0x8bd26ef9, 0xfffea495,
+0x69e3c4ff, 0xfeab9520, 0xc501ffff, 0xc5ea61d1,
+0x8bda6ef9, 0xfffea095, 0x61e3c4ff, 0xfeaa9d20,
+0xc501ffff, 0x8be26ef9, 0xfffe9c95, 0x59e3c4ff,
+0xfea9a520, 0xc501ffff, 0xe8a57ff9, 0xc5fffffe,
+0xe89d61e1, 0xc5fffffe, 0xc5eb62d1, 0x8bf26ef9,
+0xfffe9895, 0x49e3c4ff, 0xfea8b520, 0xc501ffff,
+0x8be26ef9, 0xfffe9095, 0x59e3c4ff, 0xfe97bd20,
+0xc501ffff, 0xd8bd7ff9, 0xc5fffffe, 0xd8b561c9,
+0xc5fffffe, 0x8bfa6ef9, 0xfffe8c95, 0x41e3c4ff,
+0xfe96bd20, 0xc501ffff, 0xc4e26ef9, 0xe02059e3,
+0x61c1c501, 0x62c9c5fc, 0x6cd1c5f7, 0x75e3c4ee,
+0xe801c518, 0xffffdb1a, 0xd219013c, 0x072ae281,
+0xc4810000, 0x000001ec, 0x5b59d089, 0x618d5d5e,
+0x0000c3fc,
+0022402,
+};
+asm(".type xop_x86_32_D_32u1, STT_NOTYPE;");
+asm(".type xop_x86_32_D_32u1, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_32i2[] = {
+0x315524eb, 0x83e589c0, 0xec83e0e4, 0x7ffdc520,
+0x3c802404, 0x0a75ff04, 0x20f88340, 0x01b0f475,
+0xc03102eb, 0x4c8dc3c9, 0xe4830424, 0xfc71ffe0,
+0x8955d231, 0x535657e5, 0xb951db31, 0x00000010,
+0x0188ec81, 0x85c70000, 0xffffff04, 0x00000010,
+0xbec2b70f, 0x00000010, 0x2901788d, 0xc6bf0fc6,
+0x89ffbf0f, 0xfffef485, 0x01728dff, 0xb589d089,
+0xfffffec8, 0x8301e083, 0xc01901f8, 0x4802e083,
+0x0375d685, 0x8b01b349, 0xfffec8b5, 0xbc8966ff,
+0xffff6675, 0x8bf789ff, 0xfffef4b5, 0x448966ff,
+0xff83a67d, 0x4c896610, 0x8966c67d, 0x74867d74,
+0xc8958b08, 0xebfffffe, 0x74db8497, 0x048d8906,
+0xc5ffffff, 0x68bd6ffd, 0xc5ffffff, 0x08bd7ffd,
+0x0fffffff, 0xff08bdbf, 0xbf0fffff, 0xffff6885,
+0xf4bd89ff, 0x39fffffe, 0xbdbf0ff8, 0xffffff0e,
+0x0fc0940f, 0xd8f7c0b6, 0xfe948589, 0xbf0fffff,
+0xffff0a85, 0xe8bd89ff, 0x89fffffe, 0xfffef085,
+0x85bf0fff, 0xffffff6a, 0xfef08539, 0x940fffff,
+0xc0b60fc0, 0x8589d8f7, 0xfffffe90, 0x0c85bf0f,
+0x89ffffff, 0xfffeec85, 0x85bf0fff, 0xffffff6c,
+0xfeec8539, 0x940fffff, 0xc0b60fc0, 0x8589d8f7,
+0xfffffe8c, 0x6e85bf0f, 0x39ffffff, 0xc0940ff8,
+0xf7c0b60f, 0x888589d8, 0x0ffffffe, 0xff1085bf,
+0x8589ffff, 0xfffffec4, 0x7085bf0f, 0x39ffffff,
+0xfffec485, 0xc0940fff, 0xf7c0b60f, 0x848589d8,
+0x0ffffffe, 0xff1285bf, 0x8589ffff, 0xfffffec0,
+0x7285bf0f, 0x39ffffff, 0xfffec085, 0xc0940fff,
+0xf7c0b60f, 0x808589d8, 0x0ffffffe, 0xff1485bf,
+0x8589ffff, 0xfffffebc, 0x7485bf0f, 0x39ffffff,
+0xfffebc85, 0xc0940fff, 0xf7c0b60f, 0x7c8589d8,
+0x0ffffffe, 0xff1685bf, 0xbf0fffff, 0xffff229d,
+0x55bf0fff, 0xb8858982, 0x0ffffffe, 0xff7685bf,
+0x9d89ffff, 0xfffffea0, 0xfeb88539, 0x940fffff,
+0xc0b60fc0, 0x8589d8f7, 0xfffffe78, 0x1885bf0f,
+0x89ffffff, 0xfffeb485, 0x85bf0fff, 0xffffff78,
+0xfeb48539, 0x940fffff, 0xc0b60fc0, 0x8589d8f7,
+0xfffffe74, 0x1a85bf0f, 0x89ffffff, 0xfffeb085,
+0x85bf0fff, 0xffffff7a, 0xfeb08539, 0x940fffff,
+0x0fc931c0, 0xd8f7c0b6, 0xfe708589, 0xbf0fffff,
+0xffff1c85, 0xac8589ff, 0x0ffffffe, 0xff7c85bf,
+0x8539ffff, 0xfffffeac, 0x1e85bf0f, 0x0fffffff,
+0xd9f7c194, 0xfea88589, 0xbf0fffff, 0xffff7e85,
+0x6ef9c5ff, 0xa88539e9, 0x0ffffffe, 0xb60fc094,
+0x85bf0ff8, 0xffffff20, 0xd1c5dff7, 0x8901efc4,
+0xfffea485, 0x45bf0fff, 0xa4853980, 0x0ffffffe,
+0xb60fc094, 0x39d8f7c0, 0x9dbf0fd3, 0xffffff24,
+0x0fc2940f, 0xdef7f2b6, 0xfe9c9d89, 0xbf0fffff,
+0xf9c58455, 0xfe94956e, 0xf9c5ffff, 0xfe8ca56e,
+0xe9c5ffff, 0xfe9095c4, 0xc501ffff, 0x88a5c4d9,
+0x01fffffe, 0x8d6ef9c5, 0xfffffe84, 0xd462e9c5,
+0x8dc4f1c5, 0xfffffe80, 0x6ef9c501, 0xfffe7c9d,
+0xc4e1c5ff, 0xfffe789d, 0xf1c501ff, 0xd339cb62,
+0x269dbf0f, 0xc5ffffff, 0x0fd16ce9, 0xf9c5c294,
+0xf9c5c86e, 0xfe749d6e, 0xb60fffff, 0xc4e1c5d2,
+0xfffe709d, 0xf1c501ff, 0xf701cec4, 0x62e1c5da,
+0x989d89dd, 0x0ffffffe, 0xc5865dbf, 0xbae26ef9,
+0x00000539, 0xfe989d39, 0x940fffff, 0xdbb60fc3,
+0xd9c5dbf7, 0xc501e3c4, 0xc5cc62f1, 0xc4c96ce1,
+0xc1186de3, 0xfc58e801, 0xc084ffff, 0x20d8840f,
+0xf9c50000, 0xff08a56f, 0xf9c5ffff, 0xff189d6f,
+0xd9c5ffff, 0xff688dfd, 0xe1c5ffff, 0xff7895fd,
+0xe3c4ffff, 0x01ca1875, 0x8d7ffdc5, 0xffffff28,
+0x2895bf0f, 0xc5ffffff, 0x68bd6ff9, 0xc5ffffff,
+0x01f771e9, 0xc2c5f9c5, 0xf9c59800, 0xff78bd6f,
+0xf1c5ffff, 0x0f01f771, 0xff428dbf, 0xbf0fffff,
+0xffff46bd, 0x0fc239ff, 0xff2a95bf, 0x940fffff,
+0xc0b60fc0, 0x8589d8f7, 0xfffffe94, 0xc2c5f9c5,
+0xc2399801, 0x2c95bf0f, 0x0fffffff, 0xb60fc094,
+0x89d8f7c0, 0xfffe9085, 0xc5f9c5ff, 0x399802c2,
+0x95bf0fc2, 0xffffff2e, 0x0fc0940f, 0xd8f7c0b6,
+0xfe8c8589, 0xf9c5ffff, 0x9803c2c5, 0xbf0fc239,
+0xffff3095, 0x6ef9c5ff, 0xfffe8cad, 0xc0940fff,
+0xf7c0b60f, 0x888589d8, 0xc5fffffe, 0x04c2c5f9,
+0x0fc23998, 0xff3295bf, 0x940fffff, 0xc0b60fc0,
+0x8589d8f7, 0xfffffe84, 0xc2c5f9c5, 0xc2399805,
+0x3495bf0f, 0x0fffffff, 0xb60fc094, 0x89d8f7c0,
+0xfffe8085, 0xc5f9c5ff, 0x399806c2, 0x95bf0fc2,
+0xffffff36, 0x0fc0940f, 0xd8f7c0b6, 0xfe7c8589,
+0xf9c5ffff, 0x9807c2c5, 0xbf0fc239, 0xffff3895,
+0x6ef9c5ff, 0xfffe9495, 0xc0940fff, 0x95c4e9c5,
+0xfffffe90, 0xc0b60f01, 0x8589d8f7, 0xfffffe78,
+0xc1c5f9c5, 0xc2399800, 0x3a95bf0f, 0x0fffffff,
+0xb60fc094, 0x89d8f7c0, 0xfffe7485, 0xc5f9c5ff,
+0x399801c1, 0x95bf0fc2, 0xffffff3c, 0x0fc0940f,
+0xd8f7c0b6, 0xfe708589, 0xf9c5ffff, 0x9802c1c5,
+0xbf0fc239, 0xffff3e95, 0xc0940fff, 0xf7c0b60f,
+0x6c8589d8, 0xc5fffffe, 0x03c1c5f9, 0x0fc23998,
+0xff4095bf, 0x940fffff, 0xf0b60fc0, 0xc1c5f9c5,
+0xdef79804, 0xf9c5c239, 0x0f05d1c5, 0x940fd2bf,
+0x0fdb31c0, 0xd8f7c0b6, 0xbf0fd139, 0xffff448d,
+0xc3940fff, 0xd1c5f9c5, 0xd2bf0f06, 0xd1c5dbf7,
+0xfe88adc4, 0xc501ffff, 0x6cbd6ef9, 0xc5fffffe,
+0xc5d562e9, 0x01fec4c1, 0xe86ef9c5, 0xf9c5d139,
+0x0f07c9c5, 0x940fc9bf, 0x6ef9c5c2, 0xfffe848d,
+0xc4d1c5ff, 0xb60f01eb, 0xc4f1c5d2, 0xfffe80b5,
+0xf9c501ff, 0xfe7c8d6e, 0xdaf7ffff, 0xf1c5cf39,
+0xfe788dc4, 0x0f01ffff, 0xc9c5c194, 0xf9c5c962,
+0xb60ff26e, 0x6ce9c5c9, 0x6ef9c5d1, 0xfffe748d,
+0xc5d9f7ff, 0x708dc4f1, 0x01fffffe, 0xcf62f1c5,
+0xf1c4c9c5, 0x62d1c501, 0x6cf1c5ee, 0x6de3c4cd,
+0xe801c118, 0xfffff9ba, 0x00053fba, 0x0fc08400,
+0x001e3584, 0x6ff9c500, 0xffff28bd, 0xf9c1c5ff,
+0xffff688d, 0x6ff9c5ff, 0xffff38bd, 0xf9c1c5ff,
+0xffff7895, 0x75e3c4ff, 0xc501ca18, 0x488d7ffd,
+0x0fffffff, 0xff4885bf, 0x8539ffff, 0xfffffef4,
+0x0fc0940f, 0xd8f7c0b6, 0xfef48589, 0xbf0fffff,
+0xffff4a85, 0xf08539ff, 0x0ffffffe, 0xb60fc094,
+0x89d8f7c0, 0xfffef085, 0x85bf0fff, 0xffffff4c,
+0xfeec8539, 0x940fffff, 0xc0b60fc0, 0x8589d8f7,
+0xfffffeec, 0x4e85bf0f, 0x39ffffff, 0xfffee885,
+0xc0940fff, 0xf7c0b60f, 0xe88589d8, 0x0ffffffe,
+0xff5085bf, 0x8539ffff, 0xfffffec4, 0x0fc0940f,
+0xd8f7c0b6, 0xfec48589, 0xbf0fffff, 0xffff5285,
+0xc08539ff, 0x0ffffffe, 0xb60fc094, 0x89d8f7c0,
+0xfffec085, 0x85bf0fff, 0xffffff54, 0xfebc8539,
+0x940fffff, 0xc0b60fc0, 0x8589d8f7, 0xfffffebc,
+0x5685bf0f, 0x39ffffff, 0xfffeb885, 0xc0940fff,
+0xf7c0b60f, 0xb88589d8, 0x0ffffffe, 0xff5885bf,
+0x8539ffff, 0xfffffeb4, 0x0fc0940f, 0xd8f7c0b6,
+0xfeb48589, 0xbf0fffff, 0xffff5a85, 0xb08539ff,
+0x0ffffffe, 0xc931c094, 0xf7c0b60f, 0xb08589d8,
+0x0ffffffe, 0xff5c85bf, 0x8539ffff, 0xfffffeac,
+0x5e85bf0f, 0xc5ffffff, 0xc4956ef9, 0xc5fffffe,
+0xf48d6ef9, 0x0ffffffe, 0xff6295bf, 0xe9c5ffff,
+0xfec0b5c4, 0xc501ffff, 0xf08dc4f1, 0x01fffffe,
+0x0fc1940f, 0xff669dbf, 0xf9c5ffff, 0xfeecad6e,
+0xd9f7ffff, 0xadc4d1c5, 0xfffffee8, 0x6ef9c501,
+0xfffebc95, 0xa88539ff, 0xc5fffffe, 0xc5cd62f1,
+0xb895c4e9, 0x01fffffe, 0xf96ef9c5, 0xd262c9c5,
+0xca6cf1c5, 0x956ef9c5, 0xfffffeb4, 0x95c4e9c5,
+0xfffffeb0, 0xc0940f01, 0x0ff8b60f, 0xff6085bf,
+0xdff7ffff, 0xffc4c1c5, 0x62e9c501, 0xa48539d7,
+0x0ffffffe, 0xb60fc094, 0x39d8f7c0, 0xfffea095,
+0x6ef9c5ff, 0xc2940fe8, 0x0ff2b60f, 0xff6495bf,
+0xdef7ffff, 0xeec4d1c5, 0x9c953901, 0x0ffffffe,
+0xb60fc294, 0x39daf7d2, 0xfffe989d, 0x6ef9c5ff,
+0x0544baf2, 0x940f0000, 0xdbb60fc3, 0xc9c5dbf7,
+0xc501f3c4, 0xc5ee62d1, 0xc4d56ce9, 0xc21875e3,
+0xf75ce801, 0xc084ffff, 0x1bdc840f, 0xd9c50000,
+0xff688dd5, 0xf9c5ffff, 0xc5887d6f, 0x789dd5e1,
+0xc4ffffff, 0xcb1875e3, 0x6ff9c501, 0x7ffdc5f1,
+0xffff088d, 0xd5c1c5ff, 0x6ff9c5cf, 0xc1c5987d,
+0xe3c4d7d5, 0x01ca1875, 0xe96ff9c5, 0x8d7ffdc5,
+0xffffff28, 0x956ff9c5, 0xffffff68, 0x5dfde9c5,
+0x6ff9c588, 0xffff788d, 0xfdf1c5ff, 0x65e3c4e7,
+0xc501dc18, 0x489d7ffd, 0xc5ffffff, 0x8865f9e9,
+0xf5f9c9c5, 0xd6c5f9c5, 0xd5d9c500, 0xc5f9c5e3,
+0xf1c500c4, 0x39985df9, 0xc0940fc2, 0xd6c5f9c5,
+0xd5e1c501, 0xffff589d, 0xc0b60fff, 0x8589d8f7,
+0xfffffef4, 0xc4c5f9c5, 0x0fc23901, 0xf9c5c094,
+0xc402d6c5, 0xfb185de3, 0xc0b60f01, 0xbd7ffdc5,
+0xffffff48, 0xbd6ff9c5, 0xffffff18, 0xadf9c1c5,
+0xffffff38, 0x8589d8f7, 0xfffffef0, 0xc4c5f9c5,
+0x0fc23902, 0xf9c5c094, 0x0f03d6c5, 0xf9c5c0b6,
+0xc505cdc5, 0x07fdc5f9, 0x8589d8f7, 0xfffffeec,
+0xc4c5f9c5, 0x0fc23903, 0xf9c5c094, 0x0f04d6c5,
+0xd8f7c0b6, 0xfee88589, 0xf9c5ffff, 0x3904c4c5,
+0xc0940fc2, 0xd6c5f9c5, 0xc0b60f05, 0x8589d8f7,
+0xfffffec4, 0xc4c5f9c5, 0x0fc23905, 0xf9c5c094,
+0x0f06d6c5, 0xd8f7c0b6, 0xfec08589, 0xf9c5ffff,
+0x3906c4c5, 0xc0940fc2, 0xd6c5f9c5, 0xc0b60f07,
+0x8589d8f7, 0xfffffebc, 0xc4c5f9c5, 0x0fc23907,
+0xf9c5c094, 0xc500d5c5, 0xf4a56ef9, 0x0ffffffe,
+0xd9c5c0b6, 0xfef0a5c4, 0xf701ffff, 0xb88589d8,
+0xc5fffffe, 0x00c3c5f9, 0x940fc239, 0xc5f9c5c0,
+0xb60f01d5, 0x89d8f7c0, 0xfffeb485, 0xc5f9c5ff,
+0xc23901c3, 0xc5c0940f, 0x02d5c5f9, 0xf7c0b60f,
+0xb08589d8, 0xc5fffffe, 0x02c3c5f9, 0x940fc239,
+0xc5f9c5c0, 0xb60f03d5, 0x89d8f7c0, 0xfffeac85,
+0xc5f9c5ff, 0xc23903c3, 0xc5c0940f, 0x04d5c5f9,
+0xbd6ef9c5, 0xfffffeac, 0xc5f0b60f, 0x04c3c5f9,
+0xc239def7, 0xd3c5f9c5, 0xc0940f05, 0xc1c5db31,
+0x0f01fec4, 0xd8f7c0b6, 0xf9c5d139, 0x0f06d3c5,
+0xf9c5c394, 0xc506cdc5, 0xecad6ef9, 0xf7fffffe,
+0xc5d139db, 0x07cbc5f9, 0xc5c2940f, 0xe8adc4d1,
+0x01fffffe, 0x9d6ef9c5, 0xfffffec4, 0xc5d2b60f,
+0xc0b5c4e1, 0x01fffffe, 0xe562d9c5, 0xcf39daf7,
+0xe86ef9c5, 0xc5c1940f, 0xbc9d6ef9, 0xc5fffffe,
+0x01ebc4d1, 0xc5c9b60f, 0xb89dc4e1, 0x01fffffe,
+0xdb62c9c5, 0xd9c5d9f7, 0xf9c5e36c, 0xf9c5f26e,
+0xfeb49d6e, 0xc9c5ffff, 0xc501f1c4, 0xb09dc4e1,
+0x01fffffe, 0xee62d1c5, 0xdf62e1c5, 0xdd6ce1c5,
+0x185de3c4, 0x97e801c3, 0xbafffff4, 0x0000055b,
+0x840fc084, 0x00001912, 0x5dd5e9c5, 0xd5f1c588,
+0xe3c49865, 0x01dc1865, 0x9d7ffdc5, 0xffffff08,
+0x2885c766, 0x10ffffff, 0x28858d00, 0x66ffffff,
+0xff4685c7, 0x0010ffff, 0xfec8ad83, 0x8302ffff,
+0x958b02c0, 0xfffffec8, 0xfe500366, 0xfec8bd8b,
+0xbf0fffff, 0x108966d2, 0x3d948966, 0xffffff36,
+0x7502ff83, 0x08858bd3, 0x66ffffff, 0xff288539,
+0x940fffff, 0xc0b60fc0, 0x8589d8f7, 0xfffffec8,
+0x0a858b66, 0x66ffffff, 0xff2a8539, 0x940fffff,
+0xc0b60fc0, 0x8589d8f7, 0xfffffef4, 0xff0c858b,
+0x3966ffff, 0xffff2c85, 0xc0940fff, 0xf7c0b60f,
+0xf08589d8, 0x66fffffe, 0xff0e858b, 0x3966ffff,
+0xffff2e85, 0xc0940fff, 0xf7c0b60f, 0xec8589d8,
+0x8bfffffe, 0xffff1085, 0x853966ff, 0xffffff30,
+0x0fc0940f, 0xd8f7c0b6, 0xfee88589, 0x8b66ffff,
+0xffff1285, 0x853966ff, 0xffffff32, 0x0fc0940f,
+0xd8f7c0b6, 0xfec48589, 0x858bffff, 0xffffff14,
+0x34853966, 0x0fffffff, 0xb60fc094, 0x89d8f7c0,
+0xfffec085, 0x858b66ff, 0xffffff16, 0x36853966,
+0x0fffffff, 0xb60fc094, 0x89d8f7c0, 0xfffebc85,
+0x85bf0fff, 0xffffff18, 0x940fd039, 0xc0b60fc0,
+0x8589d8f7, 0xfffffeb8, 0x1a858b66, 0x66ffffff,
+0xff3a8539, 0x940fffff, 0x0fc931c0, 0xd8f7c0b6,
+0xfeb48589, 0x858bffff, 0xffffff1c, 0x3c853966,
+0x66ffffff, 0xff1e858b, 0x940fffff, 0x66d9f7c1,
+0xff3e8539, 0xf9c5ffff, 0xf9c5f96e, 0xfee89d6e,
+0x8b66ffff, 0xffff229d, 0xc4e1c5ff, 0xfffec4b5,
+0xf9c501ff, 0xfec8a56e, 0xf9c5ffff, 0xfef0ad6e,
+0xd9c5ffff, 0xfef4a5c4, 0xc501ffff, 0xecadc4d1,
+0x01fffffe, 0xc5c0940f, 0xc5e562d9, 0xc09d6ef9,
+0x0ffffffe, 0x858bf8b6, 0xffffff20, 0x9dc4e1c5,
+0xfffffebc, 0xc5dff701, 0xc5db62c9, 0x66e36cd9,
+0xff408539, 0xf9c5ffff, 0xfeb89d6e, 0xc1c5ffff,
+0xc501ffc4, 0xb49dc4e1, 0x01fffffe, 0xdf62e1c5,
+0x0fc0940f, 0xd8f7c0b6, 0x429d3966, 0xc5ffffff,
+0x8be86ef9, 0xffff249d, 0xc2940fff, 0x31f2b60f,
+0x66def7d2, 0xff449d39, 0xd1c5ffff, 0x6601eec4,
+0xff269d8b, 0x940fffff, 0x66daf7c2, 0xff469d39,
+0xf9c5ffff, 0xc8baf26e, 0x0f000005, 0xb60fc394,
+0xc5dbf7db, 0x01f3c4c9, 0xee62d1c5, 0xdd6ce1c5,
+0x185de3c4, 0x07e801c3, 0x84fffff2, 0x87840fc0,
+0xc5000016, 0xa855d5e9, 0x4dd5f1c5, 0x6de3c4b8,
+0xc501f918, 0x48bd7ffd, 0xc5ffffff, 0x48b56ff9,
+0xc5ffffff, 0x03f671d9, 0xb56ff9c5, 0xffffff58,
+0xf671e1c5, 0x5de3c403, 0xc501f318, 0xc8b57ffd,
+0xc5fffffe, 0xc8b56ffd, 0x0ffffffe, 0xfec895bf,
+0xfdc5ffff, 0xff08b57f, 0xf9c5ffff, 0xff48b56f,
+0xe1c5ffff, 0xc502f671, 0x58b56ff9, 0xc5ffffff,
+0x02f671d9, 0x1865e3c4, 0xfdc501dc, 0xff289d7f,
+0xf9c5ffff, 0xff28b56f, 0xc9c5ffff, 0xf9c5e6fd,
+0xff38b56f, 0xf9c5ffff, 0x9800c4c5, 0xdefdc9c5,
+0xbf0fc239, 0xffff0a95, 0xc0940fff, 0x228dbf0f,
+0x0fffffff, 0xbf0fc0b6, 0xffff26bd, 0x89d8f7ff,
+0xfffec885, 0xc5f9c5ff, 0x399801c4, 0x95bf0fc2,
+0xffffff0c, 0xad6ef9c5, 0xfffffec8, 0x0fc0940f,
+0xd8f7c0b6, 0xfef48589, 0xf9c5ffff, 0x9802c4c5,
+0xbf0fc239, 0xffff0e95, 0xc4d1c5ff, 0xfffef4ad,
+0x940f01ff, 0xc0b60fc0, 0x8589d8f7, 0xfffffef0,
+0xc4c5f9c5, 0xc2399803, 0x1095bf0f, 0x0fffffff,
+0xb60fc094, 0x89d8f7c0, 0xfffeec85, 0xc5f9c5ff,
+0x399804c4, 0x95bf0fc2, 0xffffff12, 0x0fc0940f,
+0xd8f7c0b6, 0xfee88589, 0xf9c5ffff, 0x9805c4c5,
+0xbf0fc239, 0xffff1495, 0xc0940fff, 0xf7c0b60f,
+0xc48589d8, 0xc5fffffe, 0x06c4c5f9, 0x0fc23998,
+0xff1695bf, 0x940fffff, 0xc0b60fc0, 0x8589d8f7,
+0xfffffec0, 0xc4c5f9c5, 0xc2399807, 0x1895bf0f,
+0x0fffffff, 0xb60fc094, 0x89d8f7c0, 0xfffebc85,
+0xc5f9c5ff, 0x399800c3, 0x95bf0fc2, 0xffffff1a,
+0x0fc0940f, 0xd8f7c0b6, 0xfeb88589, 0xf9c5ffff,
+0x9801c3c5, 0xbf0fc239, 0xffff1c95, 0xc0940fff,
+0xf7c0b60f, 0xb48589d8, 0xc5fffffe, 0x02c3c5f9,
+0x0fc23998, 0xff1e95bf, 0x940fffff, 0xc0b60fc0,
+0x8589d8f7, 0xfffffeb0, 0xc3c5f9c5, 0xc2399803,
+0x2095bf0f, 0x0fffffff, 0xb60fc094, 0xc5f9c5f0,
+0xf79804c3, 0xc5c239de, 0x05d3c5f9, 0x0fd2bf0f,
+0xdb31c094, 0xf7c0b60f, 0x0fd139d8, 0xff248dbf,
+0x940fffff, 0xc5f9c5c3, 0xbf0f06d3, 0x39dbf7d2,
+0xc5f9c5d1, 0xbf0f07d3, 0xc1940fd2, 0x9d6ef9c5,
+0xfffffef0, 0x9dc4e1c5, 0xfffffeec, 0xc9b60f01,
+0xa56ef9c5, 0xfffffee8, 0xeb62d1c5, 0xd739d9f7,
+0xa5c4d9c5, 0xfffffec4, 0xc2940f01, 0xb56ef9c5,
+0xfffffec0, 0xb5c4c9c5, 0xfffffebc, 0xd2b60f01,
+0xde62d9c5, 0xa56ef9c5, 0xfffffeb8, 0xd1c5daf7,
+0xd9c5eb6c, 0xfeb4a5c4, 0xc501ffff, 0xb09d6ef9,
+0xc5fffffe, 0x01f6c4e1, 0xd86ef9c5, 0xb57ff9c5,
+0xfffffec8, 0xdbc4e1c5, 0x6ef9c501, 0x62d9c5f1,
+0xfffec8a5, 0xc4c9c5ff, 0xe1c501f2, 0xd9c5de62,
+0xe3c4e36c, 0x01c41855, 0xffef15e8, 0x05edbaff,
+0xc0840000, 0x1390840f, 0xf9c50000, 0xff08b56f,
+0xe1c5ffff, 0xc502e671, 0x18b56ff9, 0xc5ffffff,
+0x02e671d9, 0x1865e3c4, 0xfdc501dc, 0xff489d7f,
+0xbf0fffff, 0xffff2895, 0x6ff9c5ff, 0xffff48b5,
+0xfdc9c5ff, 0xc5f9c5e6, 0xc59800c4, 0x58b56ff9,
+0xc5ffffff, 0x0fdefdc9, 0xff428dbf, 0xbf0fffff,
+0xffff46bd, 0x0fc239ff, 0xff2a95bf, 0x940fffff,
+0xc0b60fc0, 0x8589d8f7, 0xfffffec8, 0xc4c5f9c5,
+0xc2399801, 0x2c95bf0f, 0xc5ffffff, 0xc8ad6ef9,
+0x0ffffffe, 0xb60fc094, 0x89d8f7c0, 0xfffef485,
+0xc5f9c5ff, 0x399802c4, 0x95bf0fc2, 0xffffff2e,
+0xadc4d1c5, 0xfffffef4, 0xc0940f01, 0xf7c0b60f,
+0xf08589d8, 0xc5fffffe, 0x03c4c5f9, 0x0fc23998,
+0xff3095bf, 0x940fffff, 0xc0b60fc0, 0x8589d8f7,
+0xfffffeec, 0xc4c5f9c5, 0xc2399804, 0x3295bf0f,
+0x0fffffff, 0xb60fc094, 0x89d8f7c0, 0xfffee885,
+0xc5f9c5ff, 0x399805c4, 0x95bf0fc2, 0xffffff34,
+0x0fc0940f, 0xd8f7c0b6, 0xfec48589, 0xf9c5ffff,
+0x9806c4c5, 0xbf0fc239, 0xffff3695, 0xc0940fff,
+0xf7c0b60f, 0xc08589d8, 0xc5fffffe, 0x07c4c5f9,
+0x0fc23998, 0xff3895bf, 0x940fffff, 0xc0b60fc0,
+0x8589d8f7, 0xfffffebc, 0xc3c5f9c5, 0xc2399800,
+0x3a95bf0f, 0x0fffffff, 0xb60fc094, 0x89d8f7c0,
+0xfffeb885, 0xc5f9c5ff, 0x399801c3, 0x95bf0fc2,
+0xffffff3c, 0x0fc0940f, 0xd8f7c0b6, 0xfeb48589,
+0xf9c5ffff, 0x9802c3c5, 0xbf0fc239, 0xffff3e95,
+0xc0940fff, 0xf7c0b60f, 0xb08589d8, 0xc5fffffe,
+0x03c3c5f9, 0x0fc23998, 0xff4095bf, 0x940fffff,
+0xf0b60fc0, 0xc3c5f9c5, 0xdef79804, 0xf9c5c239,
+0x0f05d3c5, 0x940fd2bf, 0x0fdb31c0, 0xd8f7c0b6,
+0xbf0fd139, 0xffff448d, 0xc3940fff, 0xd3c5f9c5,
+0xd2bf0f06, 0xd139dbf7, 0xd3c5f9c5, 0xd2bf0f07,
+0xc5c1940f, 0xf09d6ef9, 0xc5fffffe, 0xec9dc4e1,
+0x01fffffe, 0xc5c9b60f, 0xc5eb62d1, 0xe8a56ef9,
+0xf7fffffe, 0xc5d739d9, 0xc4a5c4d9, 0x01fffffe,
+0xc5c2940f, 0xc0b56ef9, 0xc5fffffe, 0xbcb5c4c9,
+0x01fffffe, 0xc5d2b60f, 0xc5de62d9, 0xb8a56ef9,
+0xf7fffffe, 0x6cd1c5da, 0xc4d9c5eb, 0xfffeb4a5,
+0xf9c501ff, 0xfeb09d6e, 0xe1c5ffff, 0xc501f6c4,
+0xc5d86ef9, 0xc8b57ff9, 0xc5fffffe, 0x01dbc4e1,
+0xf16ef9c5, 0xa562d9c5, 0xfffffec8, 0xf2c4c9c5,
+0x62e1c501, 0x6cd9c5de, 0x55e3c4e3, 0xe801c418,
+0xffffec6e, 0x0005f2ba, 0x0fc08400, 0x0010e984,
+0x0485c700, 0x03ffffff, 0xc5000000, 0xc5df6ff9,
+0x48bd7ffd, 0x8bffffff, 0xffff04b5, 0xc5f789ff,
+0xc1e66ef9, 0xe3c41fff, 0x01e72259, 0xecf1c1c5,
+0xbd6ff9c5, 0xffffff58, 0xe4f1c1c5, 0x1855e3c4,
+0xfdc501fc, 0xfec8bd7f, 0xfdc5ffff, 0xfec8bd6f,
+0xbf0fffff, 0xfffec895, 0x7ffdc5ff, 0xffff08bd,
+0x0485c7ff, 0x02ffffff, 0x8b000000, 0xffff04b5,
+0x6ff9c5ff, 0xffff58bd, 0xc5f789ff, 0xc1e66ef9,
+0xe3c41fff, 0x01e72259, 0xdcf1e1c5, 0xe4f1c1c5,
+0x1865e3c4, 0xfdc501dc, 0xff289d7f, 0xf9c5ffff,
+0xff28bd6f, 0xc1c5ffff, 0xf9c5e7fd, 0xff38bd6f,
+0xf9c5ffff, 0x9800c4c5, 0xdffdc1c5, 0xbf0fc239,
+0xffff0a95, 0xc0940fff, 0x228dbf0f, 0x0fffffff,
+0xbf0fc0b6, 0xffff26bd, 0x89d8f7ff, 0xfffec885,
+0xc5f9c5ff, 0x399801c4, 0x95bf0fc2, 0xffffff0c,
+0x0fc0940f, 0xd8f7c0b6, 0xfef48589, 0xf9c5ffff,
+0x9802c4c5, 0xbf0fc239, 0xffff0e95, 0xc0940fff,
+0xf7c0b60f, 0xf08589d8, 0xc5fffffe, 0x03c4c5f9,
+0x0fc23998, 0xff1095bf, 0xf9c5ffff, 0xfef0ad6e,
+0x940fffff, 0xc0b60fc0, 0x8589d8f7, 0xfffffeec,
+0xc4c5f9c5, 0xc2399804, 0x1295bf0f, 0xc5ffffff,
+0xecadc4d1, 0x01fffffe, 0x0fc0940f, 0xd8f7c0b6,
+0xfee88589, 0xf9c5ffff, 0x9805c4c5, 0xbf0fc239,
+0xffff1495, 0xc0940fff, 0xf7c0b60f, 0xc48589d8,
+0xc5fffffe, 0x06c4c5f9, 0x0fc23998, 0xff1695bf,
+0x940fffff, 0xc0b60fc0, 0x8589d8f7, 0xfffffec0,
+0xc4c5f9c5, 0xc2399807, 0x1895bf0f, 0xc5ffffff,
+0xc8a56ef9, 0x0ffffffe, 0xd9c5c094, 0xfef4a5c4,
+0xc501ffff, 0x0fe562d9, 0xd8f7c0b6, 0xfebc8589,
+0xf9c5ffff, 0x9800c3c5, 0xbf0fc239, 0xffff1a95,
+0xc0940fff, 0xf7c0b60f, 0xb88589d8, 0xc5fffffe,
+0x01c3c5f9, 0x0fc23998, 0xff1c95bf, 0x940fffff,
+0xc0b60fc0, 0x8589d8f7, 0xfffffeb4, 0xc3c5f9c5,
+0xc2399802, 0x1e95bf0f, 0x0fffffff, 0xb60fc094,
+0x89d8f7c0, 0xfffeb085, 0xc5f9c5ff, 0x399803c3,
+0x95bf0fc2, 0xffffff20, 0x0fc0940f, 0xf9c5f0b6,
+0x9804c3c5, 0xc239def7, 0xd3c5f9c5, 0xd2bf0f05,
+0x31c0940f, 0xc0b60fdb, 0xd139d8f7, 0x248dbf0f,
+0x0fffffff, 0xf9c5c394, 0x0f06d3c5, 0xdbf7d2bf,
+0xe86ef9c5, 0xebc4d1c5, 0xc5d13901, 0x07cbc5f9,
+0x0fc9bf0f, 0xf9c5c294, 0xfee89d6e, 0xf9c5ffff,
+0xfeb0bd6e, 0xb60fffff, 0xc4e1c5d2, 0xfffec4b5,
+0xc1c501ff, 0xf701fec4, 0xc5cf39da, 0xc09d6ef9,
+0x0ffffffe, 0xe1c5c194, 0xfebc9dc4, 0xc501ffff,
+0x0fdb62c9, 0xd9c5c9b6, 0xf9c5e36c, 0xd9f7f26e,
+0x9d6ef9c5, 0xfffffeb8, 0x9dc4e1c5, 0xfffffeb4,
+0xc4c9c501, 0xe1c501f1, 0xd1c5df62, 0xe1c5ee62,
+0xe3c4dd6c, 0x01c3185d, 0xffe965e8, 0x0605baff,
+0xc0840000, 0x0de0840f, 0xb58b0000, 0xffffff04,
+0xbd6ff9c5, 0xffffff08, 0xf9c5f789, 0xffc1e66e,
+0x59e3c41f, 0xc501e722, 0xc5dce1c1, 0x18bd6ff9,
+0xc5ffffff, 0xc4e4e1c1, 0xdc1865e3, 0x7ffdc501,
+0xffff489d, 0x95bf0fff, 0xffffff28, 0xbd6ff9c5,
+0xffffff48, 0xe7fdc1c5, 0xc4c5f9c5, 0xf9c59800,
+0xff58bd6f, 0xc1c5ffff, 0xbf0fdffd, 0xffff428d,
+0xbdbf0fff, 0xffffff46, 0xbf0fc239, 0xffff2a95,
+0xc0940fff, 0xf7c0b60f, 0xc88589d8, 0xc5fffffe,
+0x01c4c5f9, 0x0fc23998, 0xff2c95bf, 0x940fffff,
+0xc0b60fc0, 0x8589d8f7, 0xfffffef4, 0xc4c5f9c5,
+0xc2399802, 0x2e95bf0f, 0x0fffffff, 0xb60fc094,
+0x89d8f7c0, 0xfffef085, 0xc5f9c5ff, 0x399803c4,
+0x95bf0fc2, 0xffffff30, 0xad6ef9c5, 0xfffffef0,
+0x0fc0940f, 0xd8f7c0b6, 0xfeec8589, 0xf9c5ffff,
+0x9804c4c5, 0xbf0fc239, 0xffff3295, 0xc0940fff,
+0xf7c0b60f, 0xe88589d8, 0xc5fffffe, 0x05c4c5f9,
+0x0fc23998, 0xff3495bf, 0x940fffff, 0xc0b60fc0,
+0x8589d8f7, 0xfffffec4, 0xc4c5f9c5, 0xc2399806,
+0x3695bf0f, 0x0fffffff, 0xb60fc094, 0x89d8f7c0,
+0xfffec085, 0xc5f9c5ff, 0x399807c4, 0x95bf0fc2,
+0xffffff38, 0xa56ef9c5, 0xfffffec8, 0xc5c0940f,
+0xf4a5c4d9, 0x01fffffe, 0xf7c0b60f, 0xbc8589d8,
+0xc5fffffe, 0x00c3c5f9, 0x0fc23998, 0xff3a95bf,
+0x940fffff, 0xc0b60fc0, 0x8589d8f7, 0xfffffeb8,
+0xc3c5f9c5, 0xc2399801, 0x3c95bf0f, 0x0fffffff,
+0xb60fc094, 0x89d8f7c0, 0xfffeb485, 0xc5f9c5ff,
+0x399802c3, 0x95bf0fc2, 0xffffff3e, 0x0fc0940f,
+0xd8f7c0b6, 0xfeb08589, 0xf9c5ffff, 0x9803c3c5,
+0xbf0fc239, 0xffff4095, 0xc0940fff, 0xc5f0b60f,
+0x04c3c5f9, 0x39def798, 0xc5f9c5c2, 0xbf0f05d3,
+0xc0940fd2, 0xb60fdb31, 0x39d8f7c0, 0x8dbf0fd1,
+0xffffff44, 0xc5c3940f, 0x06d3c5f9, 0xf7d2bf0f,
+0xc4d1c5db, 0xfffeecad, 0xf9c501ff, 0xfeb0bd6e,
+0xd9c5ffff, 0xc1c5e562, 0xc501fec4, 0x39e86ef9,
+0xc5f9c5d1, 0xbf0f07cb, 0xc2940fc9, 0x9d6ef9c5,
+0xfffffee8, 0xebc4d1c5, 0xd2b60f01, 0xb5c4e1c5,
+0xfffffec4, 0x6ef9c501, 0xfffec09d, 0x39daf7ff,
+0xc4e1c5cf, 0xfffebc9d, 0x940f01ff, 0x62c9c5c1,
+0x6ef9c5db, 0xc9b60ff2, 0xe36cd9c5, 0x9d6ef9c5,
+0xfffffeb8, 0xe1c5d9f7, 0xfeb49dc4, 0xc501ffff,
+0xc5df62e1, 0x01f1c4c9, 0xee62d1c5, 0xdd6ce1c5,
+0x185de3c4, 0xb7e801c3, 0xbaffffe6, 0x00000609,
+0x840fc084, 0x00000b32, 0xf9c5c031, 0xc500d2c5,
+0x03f9c5f9, 0xc87d8366, 0xc5f9c500, 0xf9c505f1,
+0xc506c9c5, 0x07d9c5f9, 0x66d04e0f, 0x00ca7d83,
+0xfec89589, 0xf9c5ffff, 0x0f01d2c5, 0x8366d04e,
+0x8900cc7d, 0xfffef495, 0xc5f9c5ff, 0x4e0f02d2,
+0x7d8366d0, 0x958900ce, 0xfffffef0, 0xd2c5f9c5,
+0x6ef9c503, 0xfffef0a5, 0xd04e0fff, 0xd07d8366,
+0xec958900, 0xc5fffffe, 0x04d2c5f9, 0xa5c4d9c5,
+0xfffffeec, 0xd04e0f01, 0xd27d8366, 0xe8958900,
+0xc5fffffe, 0x05d2c5f9, 0x66d04e0f, 0x00d47d83,
+0xfec49589, 0xf9c5ffff, 0x0f06d2c5, 0x8366d04e,
+0x8900d67d, 0xfffec095, 0xc5f9c5ff, 0xf9c507d2,
+0xfee8956e, 0x4e0fffff, 0x7d8366d0, 0x958900d8,
+0xfffffebc, 0xd1c5f9c5, 0xd04e0f00, 0xda7d8366,
+0xb8958900, 0xc5fffffe, 0x01d1c5f9, 0x66d04e0f,
+0x00dc7d83, 0xfeb49589, 0xf9c5ffff, 0x0f02d1c5,
+0x8366d04e, 0x8900de7d, 0xfffeb095, 0xc5f9c5ff,
+0xf9c504d1, 0xfec88d6e, 0xf1c5ffff, 0xfef48dc4,
+0xc501ffff, 0x0fcc62f1, 0x8366f84e, 0x0f00e07d,
+0x8366d04e, 0x0f00e27d, 0x8366f04e, 0x0f00e47d,
+0x8366c84e, 0xc500e67d, 0xc5e16ef9, 0xc495c4e9,
+0x01fffffe, 0x9d6ef9c5, 0xfffffec0, 0xad6ef9c5,
+0xfffffeb0, 0x9dc4e1c5, 0xfffffebc, 0xc4d1c501,
+0xe9c501ef, 0xf9c5d362, 0xfeb89d6e, 0x4e0fffff,
+0x6cf1c5d8, 0xc4e1c5ca, 0xfffeb49d, 0xf9c501ff,
+0xd9c5d26e, 0xc501e3c4, 0x01d6c4e9, 0xdd62e1c5,
+0xd462e9c5, 0xd26ce1c5, 0x1875e3c4, 0xf9c501ca,
+0xfdc5d16f, 0xff488d7f, 0xe98fffff, 0xc85d99f0,
+0x7d6ff9c5, 0x40e98fd8, 0xff588d99, 0xe3c4ffff,
+0x01f91865, 0xbd7ffdc5, 0xfffffec8, 0xbd6ffdc5,
+0xfffffec8, 0xc895bf0f, 0xc5fffffe, 0x08bd7ffd,
+0xc5ffffff, 0xa01d6ff9, 0xc5001024, 0xc87d6ff9,
+0xcbf9c1c5, 0x7d6ff9c5, 0xf9c1c5d8, 0x75e3c4db,
+0xc501cb18, 0xc84d7ffd, 0x99e8e98f, 0xf9c5c855,
+0x8fd87d6f, 0x8d9940e9, 0xffffff58, 0x228dbf0f,
+0xc4ffffff, 0xd9186de3, 0xfde9c501, 0xfdf1c5d2,
+0xc5f9c5c9, 0xc59800c2, 0x289d7ffd, 0x39ffffff,
+0x95bf0fc2, 0xffffff0a, 0x0fc0940f, 0xd8f7c0b6,
+0xfec88589, 0xf9c5ffff, 0x9801c2c5, 0xbf0fc239,
+0xffff0c95, 0xc0940fff, 0xf7c0b60f, 0xf48589d8,
+0xc5fffffe, 0x02c2c5f9, 0x0fc23998, 0xff0e95bf,
+0x940fffff, 0xc0b60fc0, 0x8589d8f7, 0xfffffef0,
+0xc2c5f9c5, 0xc2399803, 0x1095bf0f, 0x0fffffff,
+0xb60fc094, 0x89d8f7c0, 0xfffeec85, 0xc5f9c5ff,
+0x399804c2, 0x95bf0fc2, 0xffffff12, 0x0fc0940f,
+0xd8f7c0b6, 0xfee88589, 0xf9c5ffff, 0x9805c2c5,
+0xbf0fc239, 0xffff1495, 0xc0940fff, 0xf7c0b60f,
+0xc48589d8, 0xc5fffffe, 0x06c2c5f9, 0x0fc23998,
+0xff1695bf, 0x940fffff, 0xc0b60fc0, 0x8589d8f7,
+0xfffffec0, 0xc2c5f9c5, 0xc2399807, 0x1895bf0f,
+0x0fffffff, 0xb60fc094, 0x89d8f7c0, 0xfffebc85,
+0xc5f9c5ff, 0x399800c1, 0x95bf0fc2, 0xffffff1a,
+0x0fc0940f, 0xd8f7c0b6, 0xfeb88589, 0xf9c5ffff,
+0x9801c1c5, 0xbf0fc239, 0xffff1c95, 0xc0940fff,
+0xf7c0b60f, 0xb48589d8, 0xc5fffffe, 0x02c1c5f9,
+0x0fc23998, 0xff1e95bf, 0x940fffff, 0xc0b60fc0,
+0x8589d8f7, 0xfffffeb0, 0xc1c5f9c5, 0xc2399803,
+0x2095bf0f, 0x0fffffff, 0xb60fc094, 0xc5f9c5f0,
+0xf79804c1, 0xc5c239de, 0x05d1c5f9, 0x0fd2bf0f,
+0xdb31c094, 0xf7c0b60f, 0x0fd139d8, 0xff248dbf,
+0x940fffff, 0xbdbf0fc3, 0xffffff26, 0xd1c5f9c5,
+0xd2bf0f06, 0xf9c5dbf7, 0xfec8956e, 0xf9c5ffff,
+0xfef0a56e, 0xe9c5ffff, 0xfef495c4, 0xc501ffff,
+0xeca5c4d9, 0x01fffffe, 0xf9c5d139, 0x0f07c9c5,
+0x940fc9bf, 0x62e9c5c2, 0x6ef9c5d4, 0xfffee88d,
+0xd2b60fff, 0x8dc4f1c5, 0xfffffec4, 0x6ef9c501,
+0xfffec09d, 0x39daf7ff, 0xc4e1c5cf, 0xfffebc9d,
+0x940f01ff, 0x62f1c5c1, 0x6ef9c5cb, 0xc9b60fe2,
+0xd16ce9c5, 0x9d6ef9c5, 0xfffffeb8, 0xf9c5d9f7,
+0xe1c5c86e, 0xfeb49dc4, 0xc501ffff, 0xb0ad6ef9,
+0xc5fffffe, 0x01cbc4f1, 0xeec4d1c5, 0xc4d9c501,
+0xe1c501e1, 0xf1c5dd62, 0xe1c5cc62, 0xe3c4c96c,
+0x01c1186d, 0xffe229e8, 0x0621baff, 0xc0840000,
+0x06a4840f, 0xf1c50000, 0xf1c5c9ef, 0x0fc855f9,
+0xff4895bf, 0xe98fffff, 0x28959968, 0xc5ffffff,
+0xd84df9f1, 0x628dbf0f, 0xc5ffffff, 0x00c2c5f9,
+0x9970e98f, 0xffff388d, 0xc23998ff, 0x4a95bf0f,
+0x0fffffff, 0xb60fc094, 0x6de3c4c0, 0xc501d918,
+0x089d7ffd, 0xf7ffffff, 0xc88589d8, 0xc5fffffe,
+0x01c2c5f9, 0x0fc23998, 0xff4c95bf, 0x940fffff,
+0xc0b60fc0, 0x8589d8f7, 0xfffffef4, 0xc2c5f9c5,
+0xc2399802, 0x4e95bf0f, 0x0fffffff, 0xb60fc094,
+0x89d8f7c0, 0xfffef085, 0xc5f9c5ff, 0x399803c2,
+0x95bf0fc2, 0xffffff50, 0x0fc0940f, 0xd8f7c0b6,
+0xfeec8589, 0xf9c5ffff, 0x9804c2c5, 0xbf0fc239,
+0xffff5295, 0xc0940fff, 0xf7c0b60f, 0xe88589d8,
+0xc5fffffe, 0x05c2c5f9, 0x0fc23998, 0xff5495bf,
+0x940fffff, 0xc0b60fc0, 0x8589d8f7, 0xfffffec4,
+0xc2c5f9c5, 0xc2399806, 0x5695bf0f, 0x0fffffff,
+0xb60fc094, 0x89d8f7c0, 0xfffec085, 0xc5f9c5ff,
+0x399807c2, 0x95bf0fc2, 0xffffff58, 0x0fc0940f,
+0xd8f7c0b6, 0xfebc8589, 0xf9c5ffff, 0x9800c1c5,
+0xbf0fc239, 0xffff5a95, 0xc0940fff, 0xf7c0b60f,
+0xb88589d8, 0xc5fffffe, 0x01c1c5f9, 0x0fc23998,
+0xff5c95bf, 0x940fffff, 0xc0b60fc0, 0x8589d8f7,
+0xfffffeb4, 0xc1c5f9c5, 0xc2399802, 0x5e95bf0f,
+0x0fffffff, 0xb60fc094, 0x89d8f7c0, 0xfffeb085,
+0xc5f9c5ff, 0x399803c1, 0x95bf0fc2, 0xffffff60,
+0x0fc0940f, 0xf9c5f0b6, 0x9804c1c5, 0xc239def7,
+0xd1c5f9c5, 0xd2bf0f05, 0x31c0940f, 0xc0b60fdb,
+0xd139d8f7, 0x648dbf0f, 0x0fffffff, 0xf9c5c394,
+0x0f06d1c5, 0xff66bdbf, 0xbf0fffff, 0xc5dbf7d2,
+0xc8956ef9, 0xc5fffffe, 0xf0a56ef9, 0xc5fffffe,
+0xf495c4e9, 0x01fffffe, 0xa5c4d9c5, 0xfffffeec,
+0xc5d13901, 0x07c9c5f9, 0x0fc9bf0f, 0xe9c5c294,
+0xf9c5d462, 0xfee88d6e, 0xb60fffff, 0xc4f1c5d2,
+0xfffec48d, 0xf9c501ff, 0xfec09d6e, 0xdaf7ffff,
+0xe1c5cf39, 0xfebc9dc4, 0x0f01ffff, 0xf1c5c194,
+0xf9c5cb62, 0xb60fe26e, 0x6ce9c5c9, 0x6ef9c5d1,
+0xfffeb89d, 0xc5d9f7ff, 0xc5c86ef9, 0xb49dc4e1,
+0x01fffffe, 0xad6ef9c5, 0xfffffeb0, 0xcbc4f1c5,
+0xc4d1c501, 0xd9c501ee, 0xc501e1c4, 0xc5dd62e1,
+0xc5cc62f1, 0xc4c96ce1, 0xc1186de3, 0xdfa0e801,
+0x26baffff, 0x84000006, 0x1b840fc0, 0xb8000004,
+0x00000001, 0x8d6ffdc5, 0xffffff68, 0x8d7ffdc5,
+0xffffff28, 0x45548b66, 0x94896688, 0xffff2845,
+0x02c083ff, 0x7511f883, 0x66c031eb, 0x00a87d83,
+0xf7c09f0f, 0xc88589d8, 0x31fffffe, 0x7d8366c0,
+0xf9c500aa, 0xfec89d6e, 0x9f0fffff, 0x89d8f7c0,
+0xfffef485, 0x66c031ff, 0x00ac7d83, 0x9dc4e1c5,
+0xfffffef4, 0xc09f0f01, 0x8589d8f7, 0xfffffef0,
+0x8366c031, 0xc500ae7d, 0xf0ad6ef9, 0x0ffffffe,
+0xd8f7c09f, 0xfeec8589, 0xc031ffff, 0xb07d8366,
+0xc4d1c500, 0xfffeecad, 0xe1c501ff, 0x9f0fdd62,
+0x89d8f7c0, 0xfffee885, 0x66c031ff, 0x00b27d83,
+0x956ef9c5, 0xfffffee8, 0xf7c09f0f, 0xc48589d8,
+0x31fffffe, 0x7d8366c0, 0xe9c500b4, 0xfec495c4,
+0x0f01ffff, 0xd8f7c09f, 0xfec08589, 0xc031ffff,
+0xb67d8366, 0xc09f0f00, 0x8589d8f7, 0xfffffebc,
+0x8366c031, 0x0f00b87d, 0xd8f7c09f, 0xfeb88589,
+0xc031ffff, 0xba7d8366, 0xc09f0f00, 0xd8f7c931,
+0xbc7d8366, 0xb4858900, 0x0ffffffe, 0xd9f7c19f,
+0xbe7d8366, 0x6ef9c500, 0xc09f0ff1, 0x31f8b60f,
+0x66dff7c0, 0x00c07d83, 0xf7c4c9c5, 0xc09f0f01,
+0x8366d8f7, 0xc500c27d, 0x0fe86ef9, 0xb60fc29f,
+0xf7d231f2, 0x7d8366de, 0xd1c500c4, 0x0f01eec4,
+0xdb31c29f, 0x8366daf7, 0xc500c67d, 0xc0a56ef9,
+0xc5fffffe, 0xbca5c4d9, 0x01fffffe, 0xd462e9c5,
+0xe26ef9c5, 0x2895bf0f, 0xc5ffffff, 0xc5da6ce1,
+0xb8956ef9, 0xc5fffffe, 0xb495c4e9, 0x01fffffe,
+0xc5c39f0f, 0x0fd662e9, 0xff428dbf, 0xdbf7ffff,
+0x46bdbf0f, 0xc5ffffff, 0x01e3c4d9, 0xec62d1c5,
+0xd56ce9c5, 0x1865e3c4, 0xe88f01da, 0x884da274,
+0xc5f9c530, 0x399800c1, 0x95bf0fc2, 0xffffff2a,
+0x0fc0940f, 0xd8f7c0b6, 0xfec88589, 0xf9c5ffff,
+0x9801c1c5, 0xbf0fc239, 0xffff2c95, 0xc0940fff,
+0xf7c0b60f, 0xf48589d8, 0xc5fffffe, 0x02c1c5f9,
+0x0fc23998, 0xff2e95bf, 0x940fffff, 0xc0b60fc0,
+0x8589d8f7, 0xfffffef0, 0xc1c5f9c5, 0xc2399803,
+0x3095bf0f, 0x0fffffff, 0xb60fc094, 0x89d8f7c0,
+0xfffeec85, 0xc5f9c5ff, 0x399804c1, 0x95bf0fc2,
+0xffffff32, 0x0fc0940f, 0xd8f7c0b6, 0xfee88589,
+0xf9c5ffff, 0x9805c1c5, 0xbf0fc239, 0xffff3495,
+0xc0940fff, 0xf7c0b60f, 0xc48589d8, 0xc5fffffe,
+0x06c1c5f9, 0x0fc23998, 0xff3695bf, 0x940fffff,
+0xc0b60fc0, 0x8589d8f7, 0xfffffec0, 0xc1c5f9c5,
+0xc2399807, 0x3895bf0f, 0xc4ffffff, 0xc9197de3,
+0xc0940f01, 0xf7c0b60f, 0xbc8589d8, 0xc5fffffe,
+0x00c1c5f9, 0x0fc23998, 0xff3a95bf, 0x940fffff,
+0xc0b60fc0, 0x8589d8f7, 0xfffffeb8, 0xc1c5f9c5,
+0xc2399801, 0x3c95bf0f, 0x0fffffff, 0xb60fc094,
+0x89d8f7c0, 0xfffeb485, 0xc5f9c5ff, 0x399802c1,
+0x95bf0fc2, 0xffffff3e, 0x0fc0940f, 0xd8f7c0b6,
+0xfeb08589, 0xf9c5ffff, 0x9803c1c5, 0xbf0fc239,
+0xffff4095, 0xc0940fff, 0xc5f0b60f, 0x04c1c5f9,
+0x39def798, 0xc5f9c5c2, 0xbf0f05d1, 0xc0940fd2,
+0xb60fdb31, 0x39d8f7c0, 0x8dbf0fd1, 0xffffff44,
+0xc5c3940f, 0x06d1c5f9, 0xf7d2bf0f, 0x6ef9c5db,
+0xfffec895, 0x6ef9c5ff, 0xfffef0a5, 0xc4e9c5ff,
+0xfffef495, 0xd9c501ff, 0xfeeca5c4, 0xc501ffff,
+0xc09d6ef9, 0x39fffffe, 0xc5f9c5d1, 0xbf0f07c9,
+0xc2940fc9, 0x9dc4e1c5, 0xfffffebc, 0x62e9c501,
+0xd2b60fd4, 0x8d6ef9c5, 0xfffffee8, 0xad6ef9c5,
+0xfffffeb0, 0xcf39daf7, 0x8dc4f1c5, 0xfffffec4,
+0xc1940f01, 0xcb62f1c5, 0xe26ef9c5, 0xc5c9b60f,
+0xc5d16ce9, 0xb89d6ef9, 0xf7fffffe, 0x6ef9c5d9,
+0xc4e1c5c8, 0xfffeb49d, 0xd1c501ff, 0xc501eec4,
+0x01cbc4f1, 0xe1c4d9c5, 0x62e1c501, 0x62f1c5dd,
+0x6ce1c5cc, 0x6de3c4c9, 0xe801c118, 0xffffdb82,
+0xd219013c, 0x072ae281, 0xc4810000, 0x00000188,
+0x5b59d089, 0x8d5d5f5e, 0x00c3fc61, 0x00000000,
+0x00010001, 0x00010001, 0x00010001, 0x00010001,
+0022260,
+};
+asm(".type xop_x86_32_D_32i2, STT_NOTYPE;");
+asm(".type xop_x86_32_D_32i2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_32u2[] = {
+0x315524eb, 0x83e589c0, 0xec83e0e4, 0x7ffdc520,
+0x3c802404, 0x0a75ff04, 0x20f88340, 0x01b0f475,
+0xc03102eb, 0x4c8dc3c9, 0xe4830424, 0xfc71ffe0,
+0x10bac031, 0x55000000, 0x5657e589, 0x51db3153,
+0x0188ec81, 0x85c70000, 0xffffff04, 0x00000010,
+0xfec88589, 0xb70fffff, 0xfffec885, 0x0010b9ff,
+0xbd8b0000, 0xfffffec8, 0x2901708d, 0xc8858bc1,
+0xfffffffe, 0xfffec885, 0xf6b70fff, 0x83c9b70f,
+0x854801e0, 0xfffec8bd, 0xc0b70fff, 0xb34a0375,
+0xc8bd8b01, 0x66fffffe, 0x667db489, 0x83ffffff,
+0x896610ff, 0x66867d4c, 0xa67d4489, 0x7d548966,
+0x84a375c6, 0x890674db, 0xffff0495, 0x6ffdc5ff,
+0xffff68bd, 0x7ffdc5ff, 0xffff08bd, 0xbdb70fff,
+0xffffff08, 0x6885b70f, 0x89ffffff, 0xfffef4bd,
+0x0ff839ff, 0xb60fc094, 0x89d8f7c0, 0xfffe9485,
+0x85b70fff, 0xffffff0a, 0xfef08589, 0xb70fffff,
+0xffff6a85, 0xf08539ff, 0x0ffffffe, 0xb60fc094,
+0x89d8f7c0, 0xfffe9085, 0x85b70fff, 0xffffff0c,
+0xfeec8589, 0xb70fffff, 0xffff6c85, 0xec8539ff,
+0x0ffffffe, 0xb60fc094, 0x89d8f7c0, 0xfffe8c85,
+0x85b70fff, 0xffffff0e, 0xfee88589, 0xb70fffff,
+0xffff6e85, 0xe88539ff, 0x0ffffffe, 0xb60fc094,
+0x89d8f7c0, 0xfffe8885, 0x85b70fff, 0xffffff10,
+0xfec48589, 0xb70fffff, 0xffff7085, 0xc48539ff,
+0x0ffffffe, 0xb60fc094, 0x89d8f7c0, 0xfffe8485,
+0x85b70fff, 0xffffff12, 0xfec08589, 0xb70fffff,
+0xffff7285, 0xc08539ff, 0x0ffffffe, 0xb60fc094,
+0x89d8f7c0, 0xfffe8085, 0x85b70fff, 0xffffff14,
+0xfebc8589, 0xb70fffff, 0xffff7485, 0xbc8539ff,
+0x0ffffffe, 0xff22b5b7, 0xb70fffff, 0x940f8255,
+0xc0b60fc0, 0xfea0b589, 0xd8f7ffff, 0xfe7c8589,
+0xb70fffff, 0xffff1685, 0xb88589ff, 0x0ffffffe,
+0xff7685b7, 0x8539ffff, 0xfffffeb8, 0x0fc0940f,
+0xd8f7c0b6, 0xfe788589, 0xb70fffff, 0xffff1885,
+0xb48589ff, 0x0ffffffe, 0xff7885b7, 0x8539ffff,
+0xfffffeb4, 0x0fc0940f, 0xd8f7c0b6, 0xfe748589,
+0xb70fffff, 0xffff1a85, 0xb08589ff, 0x0ffffffe,
+0xff7a85b7, 0x8539ffff, 0xfffffeb0, 0x31c0940f,
+0xc0b60fc9, 0x8589d8f7, 0xfffffe70, 0x1c85b70f,
+0x89ffffff, 0xfffeac85, 0x85b70fff, 0xffffff7c,
+0xfeac8539, 0xb70fffff, 0xffff1e85, 0xc1940fff,
+0x8589d9f7, 0xfffffea8, 0x7e85b70f, 0xc5ffffff,
+0x39e96ef9, 0xfffea885, 0xc0940fff, 0x0ff8b60f,
+0xff2085b7, 0xdff7ffff, 0xefc4d1c5, 0xa4858901,
+0x0ffffffe, 0x398045b7, 0xfffea485, 0x9db70fff,
+0xffffff24, 0x956ef9c5, 0xfffffe94, 0xa56ef9c5,
+0xfffffe8c, 0x95c4e9c5, 0xfffffe90, 0xc4d9c501,
+0xfffe88a5, 0xf9c501ff, 0xfe848d6e, 0x940fffff,
+0x62e9c5c0, 0xc4f1c5d4, 0xfffe808d, 0xb60f01ff,
+0x6ef9c5c0, 0xfffe7c9d, 0xc4e1c5ff, 0xfffe789d,
+0x9d8901ff, 0xfffffe9c, 0xd639d8f7, 0xc5c2940f,
+0xc5cb62f1, 0x749d6ef9, 0x0ffffffe, 0xb70ff2b6,
+0xe9c58455, 0xdef7d16c, 0xc86ef9c5, 0x9dc4e1c5,
+0xfffffe70, 0xc4f1c501, 0xe1c501ce, 0xd339dd62,
+0x269db70f, 0x0fffffff, 0xb60fc294, 0x89daf7d2,
+0xfffe989d, 0x5db70fff, 0x6ef9c586, 0x0539bae2,
+0x9d390000, 0xfffffe98, 0x0fc3940f, 0xdbf7dbb6,
+0xe3c4d9c5, 0x62f1c501, 0x6ce1c5cc, 0x6de3c4c9,
+0xe801c118, 0xfffffc5a, 0x840fc084, 0x00001c50,
+0xbd6ff9c5, 0xffffff08, 0x8dfdc1c5, 0xffffff68,
+0xbd6ff9c5, 0xffffff18, 0x95fdc1c5, 0xffffff78,
+0x1875e3c4, 0xfdc501ca, 0xff288d7f, 0xf9c5ffff,
+0xff68bd6f, 0xe9c5ffff, 0xc501f771, 0x78bd6ff9,
+0xc5ffffff, 0x00c2c5f9, 0x28853b66, 0xc5ffffff,
+0x01f771f1, 0xd1c5f9c5, 0xc5f9c505, 0x940f07d9,
+0xc0b60fc0, 0x8589d8f7, 0xfffffe94, 0xc2c5f9c5,
+0x853b6601, 0xffffff2a, 0x0fc0940f, 0xd8f7c0b6,
+0xfe908589, 0xf9c5ffff, 0x6602c2c5, 0xff2c853b,
+0x940fffff, 0xc0b60fc0, 0x8589d8f7, 0xfffffe8c,
+0xc2c5f9c5, 0x853b6603, 0xffffff2e, 0xa56ef9c5,
+0xfffffe8c, 0x0fc0940f, 0xd8f7c0b6, 0xfe888589,
+0xf9c5ffff, 0x6604c2c5, 0xff30853b, 0xd9c5ffff,
+0xfe88a5c4, 0x0f01ffff, 0xb60fc094, 0x89d8f7c0,
+0xfffe8485, 0xc5f9c5ff, 0x3b6605c2, 0xffff3285,
+0xc0940fff, 0xf7c0b60f, 0x808589d8, 0xc5fffffe,
+0x06c2c5f9, 0x34853b66, 0x0fffffff, 0xb60fc094,
+0x89d8f7c0, 0xfffe7c85, 0xc5f9c5ff, 0xf9c507c2,
+0xfe94956e, 0x3b66ffff, 0xffff3685, 0xc4e9c5ff,
+0xfffe9095, 0xe9c501ff, 0x940fd462, 0xc0b60fc0,
+0x8589d8f7, 0xfffffe78, 0xc1c5f9c5, 0x853b6600,
+0xffffff38, 0x0fc0940f, 0xd8f7c0b6, 0xfe748589,
+0xf9c5ffff, 0x6601c1c5, 0xff3a853b, 0x940fffff,
+0x0fc931c0, 0xd8f7c0b6, 0xfe708589, 0xf9c5ffff,
+0x6602c1c5, 0xff3c853b, 0xf9c5ffff, 0x0f03c1c5,
+0xd9f7c194, 0x3e853b66, 0xc5ffffff, 0x0fe96ef9,
+0xb60fc094, 0xc5f9c5f8, 0xdff704c1, 0x40853b66,
+0xc5ffffff, 0x01efc4d1, 0x0fc0940f, 0xd8f7c0b6,
+0x42953b66, 0x0fffffff, 0xb60fc294, 0xc5f9c5f2,
+0xdef706d1, 0x44953b66, 0x0fffffff, 0xb60fc294,
+0x66daf7d2, 0xff469d3b, 0xf9c5ffff, 0xf9c5e26e,
+0xfe848d6e, 0xf9c5ffff, 0xfe7c9d6e, 0xf1c5ffff,
+0xfe808dc4, 0xc501ffff, 0x789dc4e1, 0x01fffffe,
+0xcb62f1c5, 0x9d6ef9c5, 0xfffffe74, 0xd16ce9c5,
+0xc5c3940f, 0xc5c86ef9, 0x709dc4e1, 0x01fffffe,
+0xc5dbb60f, 0x01cec4f1, 0xdd62e1c5, 0x3fbadbf7,
+0xc5000005, 0x01e3c4d9, 0xcc62f1c5, 0xc96ce1c5,
+0x186de3c4, 0xf7e801c1, 0x84fffff9, 0xed840fc0,
+0xc5000019, 0x28bd6ff9, 0xc5ffffff, 0x688df9c1,
+0xc5ffffff, 0x38bd6ff9, 0xc5ffffff, 0x7895f9c1,
+0xc4ffffff, 0xca1875e3, 0x7ffdc501, 0xffff488d,
+0x85b70fff, 0xffffff48, 0xfef48539, 0x940fffff,
+0xc0b60fc0, 0x8589d8f7, 0xfffffef4, 0x4a85b70f,
+0x39ffffff, 0xfffef085, 0xc0940fff, 0xf7c0b60f,
+0xf08589d8, 0x0ffffffe, 0xff4c85b7, 0x8539ffff,
+0xfffffeec, 0x0fc0940f, 0xd8f7c0b6, 0xfeec8589,
+0xb70fffff, 0xffff4e85, 0xe88539ff, 0x0ffffffe,
+0xb60fc094, 0x89d8f7c0, 0xfffee885, 0x85b70fff,
+0xffffff50, 0xfec48539, 0x940fffff, 0xc0b60fc0,
+0x8589d8f7, 0xfffffec4, 0x5285b70f, 0x39ffffff,
+0xfffec085, 0xc0940fff, 0xf7c0b60f, 0xc08589d8,
+0x0ffffffe, 0xff5485b7, 0x8539ffff, 0xfffffebc,
+0x0fc0940f, 0xd8f7c0b6, 0xfebc8589, 0xb70fffff,
+0xffff5685, 0xb88539ff, 0x0ffffffe, 0xb60fc094,
+0x89d8f7c0, 0xfffeb885, 0x85b70fff, 0xffffff58,
+0xfeb48539, 0x940fffff, 0xc0b60fc0, 0x8589d8f7,
+0xfffffeb4, 0x5a85b70f, 0x39ffffff, 0xfffeb085,
+0xc0940fff, 0xb60fc931, 0x89d8f7c0, 0xfffeb085,
+0x85b70fff, 0xffffff5c, 0xfeac8539, 0xb70fffff,
+0xffff5e85, 0x6ef9c5ff, 0xfffef49d, 0x6ef9c5ff,
+0xfffeecad, 0x95b70fff, 0xffffff62, 0xadc4d1c5,
+0xfffffee8, 0xc4e1c501, 0xfffef09d, 0x940f01ff,
+0x9db70fc1, 0xffffff66, 0xdd62e1c5, 0xf9c5d9f7,
+0xfec4956e, 0xf9c5ffff, 0xfebca56e, 0x8539ffff,
+0xfffffea8, 0xa5c4d9c5, 0xfffffeb8, 0xc4e9c501,
+0xfffec095, 0xf9c501ff, 0xe9c5f16e, 0xe1c5d462,
+0xf9c5da6c, 0xfeb4956e, 0xe9c5ffff, 0xfeb095c4,
+0x0f01ffff, 0xb60fc094, 0x85b70ff8, 0xffffff60,
+0xc9c5dff7, 0xc501f7c4, 0x39d662e9, 0xfffea485,
+0xc0940fff, 0xf7c0b60f, 0xa09539d8, 0xc5fffffe,
+0x0fe06ef9, 0xb60fc294, 0x95b70ff2, 0xffffff64,
+0xd9c5def7, 0x3901e6c4, 0xfffe9c95, 0xc2940fff,
+0xf7d2b60f, 0x989d39da, 0xc5fffffe, 0xbaea6ef9,
+0x00000544, 0x0fc3940f, 0xdbf7dbb6, 0xebc4d1c5,
+0x62d9c501, 0x6ce9c5e5, 0x65e3c4d4, 0xe801c218,
+0xfffff79e, 0x840fc084, 0x00001794, 0xbd6ffdc5,
+0xffffff08, 0x5556c4c5, 0x7ffdc588, 0xffff0895,
+0x54f4c5ff, 0xfdc5884d, 0xff288d7f, 0xfdc5ffff,
+0xff48bd6f, 0xc4c5ffff, 0xc5887d57, 0x48bd7ffd,
+0x8bffffff, 0xffff4885, 0x55f4c5ff, 0xffff088d,
+0xc5f9c5ff, 0x396600d1, 0xc0940fc2, 0xf7c0b60f,
+0xf48589d8, 0xc5fffffe, 0x01c1c5f9, 0x4a853b66,
+0xc5ffffff, 0xf4956ef9, 0x0ffffffe, 0xb60fc094,
+0x89d8f7c0, 0xfffef085, 0xc5f9c5ff, 0x3b6602c1,
+0xffff4c85, 0xc4e9c5ff, 0xfffef095, 0x940f01ff,
+0xc0b60fc0, 0x8589d8f7, 0xfffffeec, 0xc1c5f9c5,
+0x853b6603, 0xffffff4e, 0xa56ef9c5, 0xfffffeec,
+0x0fc0940f, 0xd8f7c0b6, 0xfee88589, 0xf9c5ffff,
+0x6604c1c5, 0xff50853b, 0xd9c5ffff, 0xfee8a5c4,
+0xc501ffff, 0x0fd462e9, 0xb60fc094, 0x89d8f7c0,
+0xfffec485, 0xc5f9c5ff, 0x3b6605c1, 0xffff5285,
+0xc0940fff, 0xf7c0b60f, 0xc08589d8, 0xc5fffffe,
+0x06c1c5f9, 0x54853b66, 0x0fffffff, 0xb60fc094,
+0x89d8f7c0, 0xfffebc85, 0xc5f9c5ff, 0xe3c407c1,
+0x01c9197d, 0x56853b66, 0xc5ffffff, 0x05d1c5f9,
+0xd9c5f9c5, 0xc0940f07, 0xf7c0b60f, 0xb88589d8,
+0xc5fffffe, 0x00c1c5f9, 0x58853b66, 0x0fffffff,
+0xb60fc094, 0x89d8f7c0, 0xfffeb485, 0xc5f9c5ff,
+0x3b6601c1, 0xffff5a85, 0xc0940fff, 0xb60fc931,
+0x89d8f7c0, 0xfffeb085, 0xc5f9c5ff, 0x3b6602c1,
+0xffff5c85, 0xc5f9c5ff, 0x940f03c1, 0x66d9f7c1,
+0xff5e853b, 0xf9c5ffff, 0x940fe96e, 0xf8b60fc0,
+0xc1c5f9c5, 0x66dff704, 0xff60853b, 0xd1c5ffff,
+0x0f01efc4, 0xb60fc094, 0x66d8f7c0, 0xff62953b,
+0x940fffff, 0xf2b60fc2, 0xd1c5f9c5, 0x6ef9c506,
+0xfffec48d, 0xc5def7ff, 0xc08dc4f1, 0x01fffffe,
+0x64953b66, 0x0fffffff, 0xb60fc294, 0x66daf7d2,
+0xff669d3b, 0xf9c5ffff, 0xf9c5e26e, 0xfebc9d6e,
+0xe1c5ffff, 0xfeb89dc4, 0xc501ffff, 0xc5cb62f1,
+0xb49d6ef9, 0xc5fffffe, 0xc5d16ce9, 0xb09dc4e1,
+0x01fffffe, 0xc86ef9c5, 0xc5c3940f, 0x01cec4f1,
+0xdd62e1c5, 0xbadbb60f, 0x00000550, 0xd9c5dbf7,
+0xc501e3c4, 0xc5cc62f1, 0xc4c96ce1, 0xc1186de3,
+0xf53ce801, 0xc084ffff, 0x1532840f, 0xf9c50000,
+0xff68bd6f, 0xc1c5ffff, 0xc5884dd5, 0x78bd6ff9,
+0xc5ffffff, 0x9855d5c1, 0x1875e3c4, 0xfdc501ca,
+0xff088d7f, 0xc766ffff, 0xffff2885, 0x8d0010ff,
+0xffff2885, 0x85c766ff, 0xffffff46, 0xad830010,
+0xfffffec8, 0x02c08302, 0xfec8958b, 0x0366ffff,
+0x8d8bfe50, 0xfffffec8, 0x66d2b70f, 0x89661089,
+0xff360d94, 0xf983ffff, 0x8bd37502, 0xffff0885,
+0x853966ff, 0xffffff28, 0x0fc0940f, 0xd8f7c0b6,
+0xfec88589, 0x8b66ffff, 0xffff0a85, 0x853966ff,
+0xffffff2a, 0x0fc0940f, 0xd8f7c0b6, 0xfef48589,
+0x858bffff, 0xffffff0c, 0x2c853966, 0x0fffffff,
+0xb60fc094, 0x89d8f7c0, 0xfffef085, 0x858b66ff,
+0xffffff0e, 0x2e853966, 0x0fffffff, 0xb60fc094,
+0x89d8f7c0, 0xfffeec85, 0x10858bff, 0x66ffffff,
+0xff308539, 0x940fffff, 0xc0b60fc0, 0x8589d8f7,
+0xfffffee8, 0x12858b66, 0x66ffffff, 0xff328539,
+0x940fffff, 0xc0b60fc0, 0x8589d8f7, 0xfffffec4,
+0xff14858b, 0x3966ffff, 0xffff3485, 0xc0940fff,
+0xf7c0b60f, 0xc08589d8, 0x66fffffe, 0xff16858b,
+0x3966ffff, 0xffff3685, 0xc0940fff, 0xf7c0b60f,
+0xbc8589d8, 0x0ffffffe, 0xff1885b7, 0xd039ffff,
+0x0fc0940f, 0xd8f7c0b6, 0xfeb88589, 0x8b66ffff,
+0xffff1a85, 0x853966ff, 0xffffff3a, 0x31c0940f,
+0xc0b60fc9, 0x8589d8f7, 0xfffffeb4, 0xff1c858b,
+0x3966ffff, 0xffff3c85, 0x858b66ff, 0xffffff1e,
+0xf7c1940f, 0x853966d9, 0xffffff3e, 0xe96ef9c5,
+0x956ef9c5, 0xfffffec8, 0x22b58b66, 0xc5ffffff,
+0xf495c4e9, 0x01fffffe, 0xa56ef9c5, 0xfffffef0,
+0xff249d8b, 0xd9c5ffff, 0xfeeca5c4, 0xc501ffff,
+0xe88d6ef9, 0x0ffffffe, 0xe9c5c094, 0xf1c5d462,
+0xfec48dc4, 0x0f01ffff, 0x858bf8b6, 0xffffff20,
+0x9d6ef9c5, 0xfffffec0, 0xe1c5dff7, 0xfebc9dc4,
+0xc501ffff, 0x66cb62f1, 0xff408539, 0xe9c5ffff,
+0xf9c5d16c, 0xfeb89d6e, 0xd1c5ffff, 0xc501efc4,
+0xb49dc4e1, 0x01fffffe, 0xdd62e1c5, 0x0fc0940f,
+0xd8f7c0b6, 0x42b53966, 0xc5ffffff, 0x0fc86ef9,
+0xb60fc294, 0xf7d231f2, 0x9d3966de, 0xffffff44,
+0xcec4f1c5, 0x9d8b6601, 0xffffff26, 0xf7c2940f,
+0x9d3966da, 0xffffff46, 0xe26ef9c5, 0x0005c8ba,
+0xc3940f00, 0xf7dbb60f, 0xc4d9c5db, 0xf1c501e3,
+0xe1c5cc62, 0xe3c4c96c, 0x01c1186d, 0xfff2a1e8,
+0x0fc084ff, 0x00129784, 0x6ffdc500, 0xffff688d,
+0x7ffdc5ff, 0xffff488d, 0x6ff9c5ff, 0xffff48bd,
+0x71e1c5ff, 0xf9c503f7, 0xff58bd6f, 0xe9c5ffff,
+0xc403f771, 0xfa1865e3, 0x7ffdc501, 0xfffec8bd,
+0x6ffdc5ff, 0xfffec8bd, 0xc8858bff, 0xc5fffffe,
+0x08bd7ffd, 0xc5ffffff, 0x48b56ff9, 0xc5ffffff,
+0x58bd6ff9, 0xc5ffffff, 0x02f671e9, 0xf771e1c5,
+0x6de3c402, 0xc501d318, 0x28957ffd, 0xc5ffffff,
+0x28b56ff9, 0xc5ffffff, 0xc5defdc9, 0x38bd6ff9,
+0xc5ffffff, 0x00d3c5f9, 0xc5c23966, 0x0fd7fdc1,
+0xf9c5c094, 0xc505d2c5, 0x07dac5f9, 0xf7c0b60f,
+0xc88589d8, 0xc5fffffe, 0x01c3c5f9, 0x0a853b66,
+0x0fffffff, 0xb60fc094, 0x89d8f7c0, 0xfffef485,
+0xc5f9c5ff, 0x3b6602c3, 0xffff0c85, 0xc0940fff,
+0xf7c0b60f, 0xf08589d8, 0xc5fffffe, 0x03c3c5f9,
+0x0e853b66, 0xc5ffffff, 0xf0ad6ef9, 0x0ffffffe,
+0xb60fc094, 0x89d8f7c0, 0xfffeec85, 0xc5f9c5ff,
+0x3b6604c3, 0xffff1085, 0xc4d1c5ff, 0xfffeecad,
+0x940f01ff, 0xc0b60fc0, 0x8589d8f7, 0xfffffee8,
+0xc3c5f9c5, 0x853b6605, 0xffffff12, 0x0fc0940f,
+0xd8f7c0b6, 0xfec48589, 0xf9c5ffff, 0x6606c3c5,
+0xff14853b, 0x940fffff, 0xc0b60fc0, 0x8589d8f7,
+0xfffffec0, 0xc3c5f9c5, 0x6ef9c507, 0xfffec89d,
+0x853b66ff, 0xffffff16, 0x9dc4e1c5, 0xfffffef4,
+0x62e1c501, 0xc0940fdd, 0xf7c0b60f, 0xbc8589d8,
+0xc5fffffe, 0x00c2c5f9, 0x18853b66, 0x0fffffff,
+0xb60fc094, 0x89d8f7c0, 0xfffeb885, 0xc5f9c5ff,
+0x3b6601c2, 0xffff1a85, 0xc0940fff, 0xb60fc931,
+0x89d8f7c0, 0xfffeb485, 0xc5f9c5ff, 0x3b6602c2,
+0xffff1c85, 0xc5f9c5ff, 0x940f03c2, 0x66d9f7c1,
+0xff1e853b, 0xf9c5ffff, 0x940ff16e, 0xf8b60fc0,
+0xc2c5f9c5, 0x66dff704, 0xff20853b, 0xc9c5ffff,
+0x0f01f7c4, 0xb60fc094, 0x66d8f7c0, 0xff22953b,
+0xf9c5ffff, 0x940fe86e, 0xf2b60fc2, 0xd2c5f9c5,
+0x6ef9c506, 0xfffee895, 0x66def7ff, 0xff24953b,
+0xd1c5ffff, 0x0f01eec4, 0xb60fc294, 0x66daf7d2,
+0xff269d3b, 0xe9c5ffff, 0xfec495c4, 0xc501ffff,
+0xc0a56ef9, 0xc5fffffe, 0xbca5c4d9, 0x01fffffe,
+0xd462e9c5, 0xe26ef9c5, 0xda6ce1c5, 0x956ef9c5,
+0xfffffeb8, 0x95c4e9c5, 0xfffffeb4, 0xc3940f01,
+0xd662e9c5, 0x0005edba, 0xdbb60f00, 0xd9c5dbf7,
+0xc501e3c4, 0xc5ec62d1, 0xc4d56ce9, 0xc21865e3,
+0xeffce801, 0xc084ffff, 0x0ff2840f, 0xf9c50000,
+0xff08b56f, 0xf9c5ffff, 0xff18bd6f, 0xe9c5ffff,
+0xc502d671, 0x02d771e1, 0x186de3c4, 0xfdc501d3,
+0xff48957f, 0xf9c5ffff, 0xff48b56f, 0xc9c5ffff,
+0xf9c5defd, 0xff58bd6f, 0xf9c5ffff, 0x6600c3c5,
+0xff28853b, 0xc1c5ffff, 0xf9c5d7fd, 0xc505d2c5,
+0x07dac5f9, 0x0fc0940f, 0xd8f7c0b6, 0xfec88589,
+0xf9c5ffff, 0x6601c3c5, 0xff2a853b, 0x940fffff,
+0xc0b60fc0, 0x8589d8f7, 0xfffffef4, 0xc3c5f9c5,
+0x853b6602, 0xffffff2c, 0x0fc0940f, 0xd8f7c0b6,
+0xfef08589, 0xf9c5ffff, 0x6603c3c5, 0xff2e853b,
+0xf9c5ffff, 0xfef0ad6e, 0x940fffff, 0xc0b60fc0,
+0x8589d8f7, 0xfffffeec, 0xc3c5f9c5, 0x853b6604,
+0xffffff30, 0xadc4d1c5, 0xfffffeec, 0xc0940f01,
+0xf7c0b60f, 0xe88589d8, 0xc5fffffe, 0x05c3c5f9,
+0x32853b66, 0x0fffffff, 0xb60fc094, 0x89d8f7c0,
+0xfffec485, 0xc5f9c5ff, 0x3b6606c3, 0xffff3485,
+0xc0940fff, 0xf7c0b60f, 0xc08589d8, 0xc5fffffe,
+0x07c3c5f9, 0x9d6ef9c5, 0xfffffec8, 0x36853b66,
+0xc5ffffff, 0xf49dc4e1, 0x01fffffe, 0xdd62e1c5,
+0x0fc0940f, 0xd8f7c0b6, 0xfebc8589, 0xf9c5ffff,
+0x6600c2c5, 0xff38853b, 0x940fffff, 0xc0b60fc0,
+0x8589d8f7, 0xfffffeb8, 0xc2c5f9c5, 0x853b6601,
+0xffffff3a, 0x31c0940f, 0xc0b60fc9, 0x8589d8f7,
+0xfffffeb4, 0xc2c5f9c5, 0x853b6602, 0xffffff3c,
+0xc2c5f9c5, 0xc1940f03, 0x3b66d9f7, 0xffff3e85,
+0x6ef9c5ff, 0xc0940ff1, 0xc5f8b60f, 0x04c2c5f9,
+0x3b66dff7, 0xffff4085, 0xc4c9c5ff, 0x940f01f7,
+0xc0b60fc0, 0x3b66d8f7, 0xffff4295, 0x6ef9c5ff,
+0xc2940fe8, 0xc5f2b60f, 0x06d2c5f9, 0x3b66def7,
+0xffff4495, 0xc4d1c5ff, 0x940f01ee, 0xd2b60fc2,
+0x3b66daf7, 0xffff469d, 0x6ef9c5ff, 0xfffee895,
+0x6ef9c5ff, 0xfffec0a5, 0xc4e9c5ff, 0xfffec495,
+0xd9c501ff, 0xfebca5c4, 0xc501ffff, 0xc5d462e9,
+0xc5e26ef9, 0xc5da6ce1, 0xb8956ef9, 0x0ffffffe,
+0xe9c5c394, 0xfeb495c4, 0xc501ffff, 0x0fd662e9,
+0xf2badbb6, 0xf7000005, 0xc4d9c5db, 0xd1c501e3,
+0xe9c5ec62, 0xe3c4d56c, 0x01c21865, 0xffeda1e8,
+0x0fc084ff, 0x000d9784, 0x0485c700, 0x03ffffff,
+0xc5000000, 0x488d7ffd, 0xc5ffffff, 0x049d6ef9,
+0xc5ffffff, 0x58b56ff9, 0xc5ffffff, 0xc5e3f1f1,
+0xc4dbf1c9, 0xfb185de3, 0x7ffdc501, 0xfffec8bd,
+0x6ffdc5ff, 0xfffec8b5, 0xc8858bff, 0xc5fffffe,
+0x08b57ffd, 0xc7ffffff, 0xffff0485, 0x000002ff,
+0x6ef9c500, 0xffff049d, 0x6ff9c5ff, 0xffff58bd,
+0xf1f1c5ff, 0xf1c1c5d3, 0x6de3c4db, 0xc501d318,
+0x28957ffd, 0xc5ffffff, 0x28b56ff9, 0xc5ffffff,
+0xc5defdc9, 0x38bd6ff9, 0xc5ffffff, 0x00d3c5f9,
+0xc5c23966, 0x0fd7fdc1, 0xf9c5c094, 0xc505d2c5,
+0x07dac5f9, 0xf7c0b60f, 0xc88589d8, 0xc5fffffe,
+0x01c3c5f9, 0x0a853b66, 0x0fffffff, 0xb60fc094,
+0x89d8f7c0, 0xfffef485, 0xc5f9c5ff, 0x3b6602c3,
+0xffff0c85, 0xc0940fff, 0xf7c0b60f, 0xf08589d8,
+0xc5fffffe, 0x03c3c5f9, 0x0e853b66, 0xc5ffffff,
+0xf0ad6ef9, 0x0ffffffe, 0xb60fc094, 0x89d8f7c0,
+0xfffeec85, 0xc5f9c5ff, 0x3b6604c3, 0xffff1085,
+0xc4d1c5ff, 0xfffeecad, 0x940f01ff, 0xc0b60fc0,
+0x8589d8f7, 0xfffffee8, 0xc3c5f9c5, 0x853b6605,
+0xffffff12, 0x0fc0940f, 0xd8f7c0b6, 0xfec48589,
+0xf9c5ffff, 0x6606c3c5, 0xff14853b, 0x940fffff,
+0xc0b60fc0, 0x8589d8f7, 0xfffffec0, 0xc3c5f9c5,
+0x6ef9c507, 0xfffec89d, 0x853b66ff, 0xffffff16,
+0x9dc4e1c5, 0xfffffef4, 0x62e1c501, 0xc0940fdd,
+0xf7c0b60f, 0xbc8589d8, 0xc5fffffe, 0x00c2c5f9,
+0x18853b66, 0x0fffffff, 0xb60fc094, 0x89d8f7c0,
+0xfffeb885, 0xc5f9c5ff, 0x3b6601c2, 0xffff1a85,
+0xc0940fff, 0xb60fc931, 0x89d8f7c0, 0xfffeb485,
+0xc5f9c5ff, 0x3b6602c2, 0xffff1c85, 0xc5f9c5ff,
+0x940f03c2, 0x66d9f7c1, 0xff1e853b, 0xf9c5ffff,
+0x940ff16e, 0xf8b60fc0, 0xc2c5f9c5, 0x66dff704,
+0xff20853b, 0xc9c5ffff, 0x0f01f7c4, 0xb60fc094,
+0x66d8f7c0, 0xff22953b, 0xf9c5ffff, 0x940fe86e,
+0xf2b60fc2, 0xd2c5f9c5, 0x6ef9c506, 0xfffee895,
+0x66def7ff, 0xff24953b, 0xd1c5ffff, 0x0f01eec4,
+0xb60fc294, 0x66daf7d2, 0xff269d3b, 0xe9c5ffff,
+0xfec495c4, 0xc501ffff, 0xc0a56ef9, 0xc5fffffe,
+0xbca5c4d9, 0x01fffffe, 0xd462e9c5, 0xe26ef9c5,
+0xda6ce1c5, 0x956ef9c5, 0xfffffeb8, 0x95c4e9c5,
+0xfffffeb4, 0xc3940f01, 0xd662e9c5, 0x000605ba,
+0xdbb60f00, 0xd9c5dbf7, 0xc501e3c4, 0xc5ec62d1,
+0xc4d56ce9, 0xc21865e3, 0xeaf4e801, 0xc084ffff,
+0x0aea840f, 0xf9c50000, 0xff049d6e, 0xf9c5ffff,
+0xff08b56f, 0xf9c5ffff, 0xff18bd6f, 0xc9c5ffff,
+0xc1c5d3d1, 0xe3c4dbd1, 0x01d3186d, 0x957ffdc5,
+0xffffff48, 0xb56ff9c5, 0xffffff48, 0xdefdc9c5,
+0xbd6ff9c5, 0xffffff58, 0xc3c5f9c5, 0x853b6600,
+0xffffff28, 0xd7fdc1c5, 0xd2c5f9c5, 0xc5f9c505,
+0x940f07da, 0xc0b60fc0, 0x8589d8f7, 0xfffffec8,
+0xc3c5f9c5, 0x853b6601, 0xffffff2a, 0x0fc0940f,
+0xd8f7c0b6, 0xfef48589, 0xf9c5ffff, 0x6602c3c5,
+0xff2c853b, 0x940fffff, 0xc0b60fc0, 0x8589d8f7,
+0xfffffef0, 0xc3c5f9c5, 0x853b6603, 0xffffff2e,
+0xad6ef9c5, 0xfffffef0, 0x0fc0940f, 0xd8f7c0b6,
+0xfeec8589, 0xf9c5ffff, 0x6604c3c5, 0xff30853b,
+0xd1c5ffff, 0xfeecadc4, 0x0f01ffff, 0xb60fc094,
+0x89d8f7c0, 0xfffee885, 0xc5f9c5ff, 0x3b6605c3,
+0xffff3285, 0xc0940fff, 0xf7c0b60f, 0xc48589d8,
+0xc5fffffe, 0x06c3c5f9, 0x34853b66, 0x0fffffff,
+0xb60fc094, 0x89d8f7c0, 0xfffec085, 0xc5f9c5ff,
+0xf9c507c3, 0xfec89d6e, 0x3b66ffff, 0xffff3685,
+0xc4e1c5ff, 0xfffef49d, 0xe1c501ff, 0x940fdd62,
+0xc0b60fc0, 0x8589d8f7, 0xfffffebc, 0xc2c5f9c5,
+0x853b6600, 0xffffff38, 0x0fc0940f, 0xd8f7c0b6,
+0xfeb88589, 0xf9c5ffff, 0x6601c2c5, 0xff3a853b,
+0x940fffff, 0x0fc931c0, 0xd8f7c0b6, 0xfeb48589,
+0xf9c5ffff, 0x6602c2c5, 0xff3c853b, 0xf9c5ffff,
+0x0f03c2c5, 0xd9f7c194, 0x3e853b66, 0xc5ffffff,
+0x0ff16ef9, 0xb60fc094, 0xc5f9c5f8, 0xdff704c2,
+0x40853b66, 0xc5ffffff, 0x01f7c4c9, 0x0fc0940f,
+0xd8f7c0b6, 0x42953b66, 0xc5ffffff, 0x0fe86ef9,
+0xb60fc294, 0xc5f9c5f2, 0xdef706d2, 0x44953b66,
+0xc5ffffff, 0x01eec4d1, 0x0fc2940f, 0xdaf7d2b6,
+0x469d3b66, 0xc5ffffff, 0xe8956ef9, 0xc5fffffe,
+0xc0a56ef9, 0xc5fffffe, 0xc495c4e9, 0x01fffffe,
+0xa5c4d9c5, 0xfffffebc, 0x62e9c501, 0x6ef9c5d4,
+0x6ce1c5e2, 0x6ef9c5da, 0xfffeb895, 0xc3940fff,
+0x95c4e9c5, 0xfffffeb4, 0x62e9c501, 0xdbb60fd6,
+0x000609ba, 0xc5dbf700, 0x01e3c4d9, 0xec62d1c5,
+0xd56ce9c5, 0x1865e3c4, 0x93e801c2, 0x84ffffe8,
+0x89840fc0, 0x8b000008, 0x8b66c845, 0x4d8bca7d,
+0x758b66cc, 0xd8f766ce, 0xe65d8b66, 0xf766c019,
+0x66ff19df, 0xf9c5d9f7, 0xc919d86e, 0x8bdef766,
+0x8d89d075, 0xfffffec8, 0xe1c5c919, 0x8901dfc4,
+0xfffef48d, 0x6ef9c5ff, 0xfffec8ad, 0xc4d1c5ff,
+0xfffef4ad, 0xe1c501ff, 0xf766dd62, 0x758b66de,
+0x89c919d2, 0xfffef08d, 0x6ef9c5ff, 0xfffef095,
+0xdef766ff, 0x19d4758b, 0xec8d89c9, 0xc5fffffe,
+0xec95c4e9, 0x01fffffe, 0x66def766, 0x19d6758b,
+0xe88d89c9, 0xc5fffffe, 0xe8a56ef9, 0x66fffffe,
+0x758bdef7, 0x89c919d8, 0xfffec48d, 0xc4d9c5ff,
+0xfffec4a5, 0xe9c501ff, 0xe1c5d462, 0xf766d26c,
+0x758b66de, 0x89c919da, 0xfffec08d, 0xdef766ff,
+0x19dc758b, 0xbc8d89c9, 0x66fffffe, 0x8b66def7,
+0xc919de75, 0xfeb88d89, 0xf766ffff, 0xe0758bde,
+0x8d89c919, 0xfffffeb4, 0xe24d8b66, 0x19def766,
+0xd9f766d2, 0xc5e44d8b, 0x19ea6ef9, 0x6ef9c5f6,
+0xfffec09d, 0x6ef9c5ff, 0xfffeb8b5, 0xc4e1c5ff,
+0xfffebc9d, 0xc9c501ff, 0xfeb4b5c4, 0xc501ffff,
+0x01eec4d1, 0xde62e1c5, 0x19d9f766, 0xdbf766c9,
+0xf9c5db19, 0xd9c5e16e, 0xc501e3c4, 0xc5ec62d1,
+0xc4dd6ce1, 0xd3186de3, 0x54ecc501, 0x6ff9c5d1,
+0x7ffdc5da, 0xffff4895, 0xe8e98fff, 0xc5c86599,
+0xd8756ff9, 0x9948e98f, 0xffff5895, 0x5de3c4ff,
+0xc501fa18, 0xc8bd7ffd, 0xc5fffffe, 0xc8b56ffd,
+0x8bfffffe, 0xfffec885, 0x7ffdc5ff, 0xffff08b5,
+0x76e9c5ff, 0xfde9c5d2, 0xe9c5c865, 0xc4d855fd,
+0xd2185de3, 0x7ffdc501, 0xe98fc855, 0xc85d99e0,
+0x7d6ff9c5, 0x40e98fd8, 0xff589599, 0xe3c4ffff,
+0x01e21865, 0xdbfde1c5, 0xd2fde9c5, 0xd3c5f9c5,
+0xc2396600, 0xd2c5f9c5, 0xc0940f05, 0xdac5f9c5,
+0x7ffdc507, 0xffff28a5, 0xc0b60fff, 0x8589d8f7,
+0xfffffec8, 0xc3c5f9c5, 0x853b6601, 0xffffff0a,
+0x0fc0940f, 0xd8f7c0b6, 0xfef48589, 0xf9c5ffff,
+0x6602c3c5, 0xff0c853b, 0x940fffff, 0xc0b60fc0,
+0x8589d8f7, 0xfffffef0, 0xc3c5f9c5, 0x853b6603,
+0xffffff0e, 0x0fc0940f, 0xd8f7c0b6, 0xfeec8589,
+0xf9c5ffff, 0x6604c3c5, 0xff10853b, 0x940fffff,
+0xc0b60fc0, 0x8589d8f7, 0xfffffee8, 0xc3c5f9c5,
+0x853b6605, 0xffffff12, 0x0fc0940f, 0xd8f7c0b6,
+0xfec48589, 0xf9c5ffff, 0x6606c3c5, 0xff14853b,
+0x940fffff, 0xc0b60fc0, 0x8589d8f7, 0xfffffec0,
+0xc3c5f9c5, 0x853b6607, 0xffffff16, 0x0fc0940f,
+0xd8f7c0b6, 0xfebc8589, 0xf9c5ffff, 0x6600c2c5,
+0xff18853b, 0x940fffff, 0xc0b60fc0, 0x8589d8f7,
+0xfffffeb8, 0xc2c5f9c5, 0x853b6601, 0xffffff1a,
+0x31c0940f, 0xc0b60fc9, 0x8589d8f7, 0xfffffeb4,
+0xc2c5f9c5, 0x853b6602, 0xffffff1c, 0xc2c5f9c5,
+0xc1940f03, 0x3b66d9f7, 0xffff1e85, 0x6ef9c5ff,
+0xc0940ff1, 0xc5f8b60f, 0x04c2c5f9, 0x3b66dff7,
+0xffff2085, 0xc4c9c5ff, 0x940f01f7, 0xc0b60fc0,
+0x3b66d8f7, 0xffff2295, 0xc2940fff, 0xc5f2b60f,
+0x06d2c5f9, 0x3b66def7, 0xffff2495, 0xc2940fff,
+0xf7d2b60f, 0x9d3b66da, 0xffffff26, 0x9d6ef9c5,
+0xfffffec8, 0xad6ef9c5, 0xfffffef0, 0x9dc4e1c5,
+0xfffffef4, 0xc4d1c501, 0xfffeecad, 0xf9c501ff,
+0xfee8956e, 0xe1c5ffff, 0xe9c5dd62, 0xfec495c4,
+0xc501ffff, 0x0fe86ef9, 0xf9c5c394, 0xfec0a56e,
+0xd1c5ffff, 0x0f01eec4, 0xd9c5dbb6, 0xfebca5c4,
+0xc501ffff, 0xf7d462e9, 0x6ce1c5db, 0x6ef9c5da,
+0x6ef9c5e2, 0xfffeb895, 0xc4d9c5ff, 0xe9c501e3,
+0xfeb495c4, 0xc501ffff, 0xc5ec62d1, 0xc5d662e9,
+0xc4d56ce9, 0xc21865e3, 0xe4a4e801, 0x21baffff,
+0x84000006, 0x95840fc0, 0xc5000004, 0xc5d2efe9,
+0xc85df9e9, 0x55f9e9c5, 0x60e98fd8, 0xff289d95,
+0xe98fffff, 0x38959568, 0xc5ffffff, 0x00c3c5f9,
+0x48853b66, 0xc5ffffff, 0x05d2c5f9, 0x1865e3c4,
+0xf9c501e2, 0xc507dac5, 0x08a57ffd, 0x0fffffff,
+0xb60fc094, 0x89d8f7c0, 0xfffec885, 0xc5f9c5ff,
+0x3b6601c3, 0xffff4a85, 0xc0940fff, 0xf7c0b60f,
+0xf48589d8, 0xc5fffffe, 0x02c3c5f9, 0x4c853b66,
+0x0fffffff, 0xb60fc094, 0x89d8f7c0, 0xfffef085,
+0xc5f9c5ff, 0x3b6603c3, 0xffff4e85, 0xc0940fff,
+0xf7c0b60f, 0xec8589d8, 0xc5fffffe, 0x04c3c5f9,
+0x50853b66, 0x0fffffff, 0xb60fc094, 0x89d8f7c0,
+0xfffee885, 0xc5f9c5ff, 0x3b6605c3, 0xffff5285,
+0xc0940fff, 0xf7c0b60f, 0xc48589d8, 0xc5fffffe,
+0x06c3c5f9, 0x54853b66, 0x0fffffff, 0xb60fc094,
+0x89d8f7c0, 0xfffec085, 0xc5f9c5ff, 0x3b6607c3,
+0xffff5685, 0xc0940fff, 0xf7c0b60f, 0xbc8589d8,
+0xc5fffffe, 0x00c2c5f9, 0x58853b66, 0x0fffffff,
+0xb60fc094, 0x89d8f7c0, 0xfffeb885, 0xc5f9c5ff,
+0x3b6601c2, 0xffff5a85, 0xc0940fff, 0xb60fc931,
+0x89d8f7c0, 0xfffeb485, 0xc5f9c5ff, 0x3b6602c2,
+0xffff5c85, 0xc5f9c5ff, 0x940f03c2, 0x66d9f7c1,
+0xff5e853b, 0xf9c5ffff, 0x940ff16e, 0xf8b60fc0,
+0xc2c5f9c5, 0x66dff704, 0xff60853b, 0xc9c5ffff,
+0x0f01f7c4, 0xb60fc094, 0x66d8f7c0, 0xff62953b,
+0x940fffff, 0xf2b60fc2, 0xd2c5f9c5, 0x66def706,
+0xff64953b, 0x940fffff, 0xd2b60fc2, 0x3b66daf7,
+0xffff669d, 0x6ef9c5ff, 0xfffec89d, 0x6ef9c5ff,
+0xfffef0ad, 0xc4e1c5ff, 0xfffef49d, 0xd1c501ff,
+0xfeecadc4, 0xc501ffff, 0xe8956ef9, 0xc5fffffe,
+0xc5dd62e1, 0xc495c4e9, 0x01fffffe, 0xe86ef9c5,
+0xc5c3940f, 0xc0a56ef9, 0xc5fffffe, 0x01eec4d1,
+0xc5dbb60f, 0xbca5c4d9, 0x01fffffe, 0xd462e9c5,
+0xe1c5dbf7, 0xf9c5da6c, 0xf9c5e26e, 0xfeb8956e,
+0xd9c5ffff, 0xc501e3c4, 0xb495c4e9, 0x01fffffe,
+0xec62d1c5, 0xd662e9c5, 0xd56ce9c5, 0x1865e3c4,
+0x5be801c2, 0xbaffffe2, 0x00000626, 0x840fc084,
+0x0000024c, 0x000001b8, 0x7ffdc500, 0xffff288d,
+0x548b66ff, 0x89668845, 0xff284594, 0xc083ffff,
+0x11f88302, 0xfdc5eb75, 0x8fa8756f, 0x4da274e8,
+0xf9c56088, 0x6600c1c5, 0xff28853b, 0x940fffff,
+0xc0b60fc0, 0x8589d8f7, 0xfffffec8, 0xc1c5f9c5,
+0x853b6601, 0xffffff2a, 0x956ef9c5, 0xfffffec8,
+0x0fc0940f, 0xd8f7c0b6, 0xfef48589, 0xf9c5ffff,
+0x6602c1c5, 0xff2c853b, 0xe9c5ffff, 0xfef495c4,
+0x0f01ffff, 0xb60fc094, 0x89d8f7c0, 0xfffef085,
+0xc5f9c5ff, 0x3b6603c1, 0xffff2e85, 0x6ef9c5ff,
+0xfffef0a5, 0xc0940fff, 0xf7c0b60f, 0xec8589d8,
+0xc5fffffe, 0x04c1c5f9, 0x30853b66, 0xc5ffffff,
+0xeca5c4d9, 0x01fffffe, 0xd462e9c5, 0x0fc0940f,
+0xd8f7c0b6, 0xfee88589, 0xf9c5ffff, 0x6605c1c5,
+0xff32853b, 0x940fffff, 0xc0b60fc0, 0x8589d8f7,
+0xfffffec4, 0xc1c5f9c5, 0x853b6606, 0xffffff34,
+0x0fc0940f, 0xd8f7c0b6, 0xfec08589, 0xf9c5ffff,
+0xc407c1c5, 0xc9197de3, 0x853b6601, 0xffffff36,
+0xd1c5f9c5, 0xc5f9c505, 0x940f07d9, 0xc0b60fc0,
+0x8589d8f7, 0xfffffebc, 0xc1c5f9c5, 0x853b6600,
+0xffffff38, 0x0fc0940f, 0xd8f7c0b6, 0xfeb88589,
+0xf9c5ffff, 0x6601c1c5, 0xff3a853b, 0x940fffff,
+0x0fc931c0, 0xd8f7c0b6, 0xfeb48589, 0xf9c5ffff,
+0x6602c1c5, 0xff3c853b, 0xf9c5ffff, 0x0f03c1c5,
+0xd9f7c194, 0x3e853b66, 0xc5ffffff, 0x0fe96ef9,
+0xb60fc094, 0xc5f9c5f8, 0xdff704c1, 0x40853b66,
+0xc5ffffff, 0x01efc4d1, 0x0fc0940f, 0xd8f7c0b6,
+0x42953b66, 0x0fffffff, 0xb60fc294, 0xc5f9c5f2,
+0xdef706d1, 0x44953b66, 0x0fffffff, 0xb60fc294,
+0x66daf7d2, 0xff469d3b, 0xf9c5ffff, 0xf9c5e26e,
+0xfee88d6e, 0xf9c5ffff, 0xfec09d6e, 0xf1c5ffff,
+0xfec48dc4, 0xc501ffff, 0xbc9dc4e1, 0x01fffffe,
+0xcb62f1c5, 0x9d6ef9c5, 0xfffffeb8, 0xd16ce9c5,
+0xc5c3940f, 0xc5c86ef9, 0xb49dc4e1, 0x01fffffe,
+0xc5dbb60f, 0x01cec4f1, 0xdd62e1c5, 0xd9c5dbf7,
+0xc501e3c4, 0xc5cc62f1, 0xc4c96ce1, 0xc1186de3,
+0xe00ce801, 0x013cffff, 0xe281d219, 0x0000072a,
+0x0188c481, 0xd0890000, 0x5f5e5b59, 0xfc618d5d,
+0x000000c3,
+0020021,
+};
+asm(".type xop_x86_32_D_32u2, STT_NOTYPE;");
+asm(".type xop_x86_32_D_32u2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_32i4[] = {
+0xb95500eb, 0x00000020, 0xc031e589, 0x0009bf57,
+0x53560000, 0x81e0e483, 0x000120ec, 0x89c38900,
+0x40da89fe, 0x2901e283, 0x01fa83c6, 0xe283d219,
+0xd8854a02, 0x89490175, 0x009c8484, 0xf8830000,
+0x84b48908, 0x000000bc, 0xdc849489, 0x89000000,
+0x00fc848c, 0xc5750000, 0xb46ffdc5, 0x0000a024,
+0x7ffdc500, 0x8b402474, 0x39402444, 0x00a02484,
+0x748b0000, 0x940f4824, 0x0fc931c0, 0xd8f7c0b6,
+0xc86ef9c5, 0x4424448b, 0xa4248439, 0x0f000000,
+0xc031c194, 0xb43bd9f7, 0x0000a824, 0x71e3c400,
+0x0f01c922, 0xdb31c094, 0xf9c5d8f7, 0x448bd86e,
+0x843b4c24, 0x0000ac24, 0x24448900, 0xc3940f2c,
+0x5024448b, 0x843bdbf7, 0x0000b024, 0x61e3c400,
+0xc501db22, 0x89cb6cf1, 0x0f282444, 0xb60fc094,
+0xc5d8f7c0, 0x8bd06ef9, 0x3b542444, 0x00b42484,
+0x44890000, 0x940f2424, 0x24448bc2, 0xfab60f58,
+0xdff7d231, 0xb824843b, 0xc4000000, 0xd72269e3,
+0x24448901, 0x24448b20, 0xc2940f5c, 0x843bdaf7,
+0x0000bc24, 0x6ef9c500, 0x244489fa, 0xc0940f1c,
+0xf7c0b60f, 0x41e3c4d8, 0xc501e022, 0xc4d46ce9,
+0xca1875e3, 0x50fcc501, 0xfffa81d1, 0xb8000000,
+0x00000539, 0x0eba850f, 0xf9c50000, 0x40244c6f,
+0x646ff9c5, 0xf1c55024, 0xa02494fe, 0xc5000000,
+0x249cfed9, 0x000000b0, 0x186de3c4, 0xfdc501d3,
+0x6024547f, 0xb46ff9c5, 0x0000a024, 0x72e1c500,
+0xf9c501f6, 0xb024bc6f, 0xc5000000, 0x39d87ef9,
+0xc4602444, 0xda1679e3, 0x79e3c401, 0xc503d916,
+0x01f772d1, 0xeb7ef9c5, 0x1679e3c4, 0x940f01ef,
+0xc0b60fc0, 0x5439d8f7, 0xf9c56424, 0x940fd06e,
+0xd2b60fc2, 0x5489daf7, 0xe3c41824, 0x02da1679,
+0x68245439, 0x2269e3c4, 0x01182454, 0x0fc2940f,
+0xdaf7d2b6, 0x6c244c39, 0xf26ef9c5, 0x0fc1940f,
+0xd9f7c9b6, 0x70245c39, 0x2249e3c4, 0xe9c501f1,
+0x940fd66c, 0xd8b60fc0, 0x7c39dbf7, 0xf9c57424,
+0xe3c4db6e, 0x02eb1679, 0x0fc2940f, 0xdff7fab6,
+0x78245c39, 0x2261e3c4, 0x940f01df, 0x0fc031c2,
+0xdbf7dab6, 0xe3c4da89, 0x03eb1679, 0x7c245c39,
+0xfa6ef9c5, 0xf7c0940f, 0x41e3c4d8, 0xc501e822,
+0xc4dd6ce1, 0xd3186de3, 0x50fcc501, 0xfffa81d2,
+0xb8000000, 0x0000053f, 0x0d96850f, 0xf9c50000,
+0x6024746f, 0x94fac9c5, 0x0000a024, 0x6ff9c500,
+0xc5702474, 0x249cfac9, 0x000000b0, 0x186de3c4,
+0xfdc501d3, 0x8024947f, 0x8b000000, 0x00802484,
+0x44390000, 0x940f4024, 0x0fd231c0, 0xd8f7c0b6,
+0xd06ef9c5, 0x8424848b, 0x39000000, 0x8b442444,
+0x0f2c2444, 0xc931c294, 0xb43bdaf7, 0x00008824,
+0x69e3c400, 0x0f01d222, 0xd9f7c194, 0x8c24843b,
+0xc5000000, 0x8bf96ef9, 0x0f282444, 0xb60fc394,
+0xf7db31f3, 0x24843bde, 0x00000090, 0x2424448b,
+0xf7c3940f, 0x24843bdb, 0x00000094, 0x0fc0940f,
+0x448bf8b6, 0xdff72024, 0x9824843b, 0x0f000000,
+0xb60fc094, 0xc5d8f7c0, 0x8bf06ef9, 0x3b1c2444,
+0x009c2484, 0x940f0000, 0xc0b60fc0, 0xe3c4d8f7,
+0x01e82249, 0xf36ef9c5, 0x2249e3c4, 0xe1c501df,
+0xe3c4dd6c, 0x01ee2241, 0xd56ce9c5, 0x186de3c4,
+0xfcc501d3, 0xfa81d250, 0x000000ff, 0x000544b8,
+0x8d850f00, 0xc400000c, 0xa44059e2, 0x0000b024,
+0x6ff9c500, 0x00c024b4, 0xf9c50000, 0xd024bc6f,
+0xc4000000, 0x8c4071e2, 0x0000a024, 0x41e2c400,
+0xe3c4d740, 0x01cc1875, 0xd96ff9c5, 0x4c7ffdc5,
+0xe2c44024, 0xc4ce4049, 0xca1875e3, 0x6ff9c501,
+0x7ffdc5e1, 0xc560244c, 0x24946ff9, 0x000000a0,
+0x8c6ff9c5, 0x0000b024, 0xfee9c500, 0xfef1c5ee,
+0x55e3c4f7, 0xc501ee18, 0x24ac7ffd, 0x00000080,
+0xbcfae9c5, 0x0000c024, 0xfae1c500, 0x7ef9c5dc,
+0xfaf1c5d8, 0x00d024b4, 0xe2c40000, 0x24b44049,
+0x00000090, 0x4041e2c4, 0x6ff9c5fd, 0xc550246c,
+0xc5fa7ef9, 0x246cfad1, 0x0fc23970, 0xe3c4c094,
+0x01fa1679, 0xb60fc931, 0x79e3c4c0, 0xc401f616,
+0xf71679e3, 0x89d8f702, 0xc42c2444, 0xd81679e3,
+0x0fc23901, 0xe3c4c194, 0x02fa1679, 0x1679e3c4,
+0xd9f702d8, 0xe3c4c239, 0x03fa1679, 0x31c0940f,
+0x6ef9c5db, 0x0f2c247c, 0xd8f7c0b6, 0xe06ef9c5,
+0x1679e3c4, 0xc23903d8, 0xc5c3940f, 0xc5f27ef9,
+0xf7e87ef9, 0xc4c239db, 0xea1679e3, 0xc0940f01,
+0x2259e3c4, 0xb60f01e3, 0x39d8f7c0, 0xc2940fd6,
+0xc4f2b60f, 0xea1679e3, 0x39def702, 0x79e3c4d7,
+0x0f03ef16, 0xb60fc294, 0xc5daf7d2, 0xc4da6ef9,
+0xf21679e3, 0x0ffa3903, 0xf9c5c294, 0xe3c4f06e,
+0x01ee2249, 0xb8fab60f, 0x0000055b, 0xe3c4dff7,
+0x01df2261, 0xeb6cd1c5, 0x2241e3c4, 0xe1c501d9,
+0xe3c4dc6c, 0x01dd1865, 0xd350fcc5, 0x00fffa81,
+0x850f0000, 0x00000aec, 0x4069e2c4, 0x00c0249c,
+0xe2c40000, 0x24a44071, 0x000000d0, 0x1865e3c4,
+0xf9c501dc, 0xfdc5d87e, 0x40245c7f, 0x0f08f883,
+0xc931c094, 0xf7c0b60f, 0x247c83d8, 0xf9c50e44,
+0x940fd86e, 0xf7c031c1, 0x247c83d9, 0xe3c41248,
+0x01d92261, 0x31c0940f, 0x83d8f7db, 0x144c247c,
+0xe86ef9c5, 0x31c3940f, 0x83dbf7c0, 0x1450247c,
+0x2251e3c4, 0xe1c501eb, 0x940fdd6c, 0x83d8f7c0,
+0x1254247c, 0xf86ef9c5, 0x0005c8b8, 0xc2940f00,
+0x31f2b60f, 0x83def7d2, 0x0e58247c, 0x2241e3c4,
+0x940f01e6, 0x83daf7c2, 0x085c247c, 0xf26ef9c5,
+0x2444940f, 0x7cb60f2c, 0xdff72c24, 0x2249e3c4,
+0xd9c501f7, 0xe3c4e66c, 0x01dc1865, 0xd350fcc5,
+0x00fffa81, 0x850f0000, 0x00000a18, 0x4069e2c4,
+0x00e02494, 0xe2c40000, 0x248c4071, 0x000000f0,
+0x186de3c4, 0xfdc501f1, 0x8024b47f, 0xc5000000,
+0x24bc6ff9, 0x00000080, 0xf772e1c5, 0x6ff9c503,
+0x009024bc, 0xd9c50000, 0xc403f772, 0xdc1865e3,
+0x7ef9c501, 0x7ffdc5d8, 0xc540245c, 0x24bc6ff9,
+0x00000080, 0xf772e1c5, 0x6ff9c502, 0x009024bc,
+0xd9c50000, 0xc402f772, 0xdc1865e3, 0x7ffdc501,
+0xc560245c, 0x247c6ff9, 0xfec1c560, 0x6ff9c5e7,
+0xc570247c, 0x39e27ef9, 0xfec1c5d0, 0xc0940fef,
+0xe3c4c931, 0x01ea1679, 0xc4c0b60f, 0xef1679e3,
+0xc5d8f703, 0xc4f86ef9, 0xe01679e3, 0x24443901,
+0x79e3c444, 0x0f02e016, 0xd9f7c194, 0x48244439,
+0x2241e3c4, 0x940f01f9, 0x0fdb31c0, 0xd8f7c0b6,
+0xd86ef9c5, 0x1679e3c4, 0x443903e0, 0xf9c54c24,
+0x940fe87e, 0x39dbf7c3, 0xc4502444, 0xdb2261e3,
+0x6cc1c501, 0xc0940ffb, 0xf7c0b60f, 0x245439d8,
+0xc2940f54, 0xc4f2b60f, 0xea1679e3, 0x6ef9c502,
+0xb8def7e8, 0x000005ed, 0x58245439, 0x2251e3c4,
+0x940f01ee, 0xd2b60fc2, 0x7c39daf7, 0xf9c55c24,
+0x940fe26e, 0xfab60fc2, 0xe3c4dff7, 0x01e72259,
+0xe46cd1c5, 0x1845e3c4, 0xfcc501fc, 0xfa81d750,
+0x000000ff, 0x08ba850f, 0xf9c50000, 0x40247c6f,
+0xe772e1c5, 0x6ff9c502, 0xc550247c, 0x02e772d9,
+0x1865e3c4, 0xfdc501dc, 0x80249c7f, 0xc5000000,
+0x24bc6ff9, 0x00000080, 0xe7fec1c5, 0xbc6ff9c5,
+0x00009024, 0x7ef9c500, 0x244439e0, 0xfec1c560,
+0x79e3c4ef, 0xc401ea16, 0xef1679e3, 0xc0940f03,
+0xb60fc931, 0xc5d8f7c0, 0xc4f86ef9, 0xe01679e3,
+0x24443901, 0x79e3c464, 0x0f02e016, 0xd9f7c194,
+0x68244439, 0x2241e3c4, 0x940f01f9, 0x0fdb31c0,
+0xd8f7c0b6, 0xd86ef9c5, 0x1679e3c4, 0x443903e0,
+0xf9c56c24, 0x940fe87e, 0x39dbf7c3, 0xc4702444,
+0xdb2261e3, 0x6cc1c501, 0xc0940ffb, 0xf7c0b60f,
+0x245439d8, 0xc2940f74, 0xc4f2b60f, 0xea1679e3,
+0x6ef9c502, 0xb8def7e8, 0x000005f2, 0x78245439,
+0x2251e3c4, 0x940f01ee, 0xd2b60fc2, 0x7c39daf7,
+0xf9c57c24, 0x940fe26e, 0xfab60fc2, 0xe3c4dff7,
+0x01e72259, 0xe46cd1c5, 0x1845e3c4, 0xfcc501fc,
+0xfa81d750, 0x000000ff, 0x07a6850f, 0x44c70000,
+0x00033c24, 0xf9c50000, 0xfdc5de6f, 0x8024b47f,
+0x8b000000, 0x893c2474, 0x6ef9c5f7, 0x1fffc1e6,
+0x2259e3c4, 0xc9c501e7, 0xf9c5ecf2, 0x9024b46f,
+0xc5000000, 0xc4e4f2c9, 0xe41855e3, 0x7ef9c501,
+0x7ffdc5e2, 0xc7402464, 0x023c2444, 0x8b000000,
+0x893c2474, 0x6ef9c5f7, 0x1fffc1e6, 0x2259e3c4,
+0xe1c501e7, 0xc9c5dcf2, 0xe3c4e4f2, 0x01dc1865,
+0x5c7ffdc5, 0xf9c56024, 0x6024746f, 0xdefec9c5,
+0x746ff9c5, 0xf9c57024, 0xc239d87e, 0x1679e3c4,
+0x940f01d8, 0x0fdb31c2, 0xc9c5d2b6, 0xdaf7eefe,
+0x44244439, 0x1679e3c4, 0x940f02d8, 0x39dbf7c3,
+0x0f482444, 0xb60fc094, 0xc5d8f7c0, 0xc4e06ef9,
+0xd81679e3, 0x24443903, 0xc0940f4c, 0xc5f0b60f,
+0xf7e87ef9, 0x244439de, 0x59e3c450, 0x0f01e622,
+0xb60fc094, 0xc5d8f7c0, 0xc4d86ef9, 0xe81679e3,
+0x24443901, 0x79e3c454, 0x0f02e816, 0xb60fc194,
+0xf7c931f9, 0x244439df, 0x79e3c458, 0xc403e816,
+0xdf2261e3, 0xc1940f01, 0x4439d9f7, 0xf9c55c24,
+0x940ff16e, 0xc0b60fc0, 0xe3c4d8f7, 0x01e82249,
+0xf26ef9c5, 0xed6ce1c5, 0x2249e3c4, 0xe1c501db,
+0xe3c4dc6c, 0x01dd1865, 0xd350fcc5, 0x00fffa81,
+0x05b80000, 0x0f000006, 0x00064785, 0x24748b00,
+0x6ff9c53c, 0x89402474, 0x6ef9c5f7, 0x1fffc1e6,
+0x2259e3c4, 0xc9c501e7, 0xf9c5dce2, 0x5024746f,
+0xe4e2c9c5, 0x1865e3c4, 0xfdc501dc, 0x80249c7f,
+0xc5000000, 0x24b46ff9, 0x00000080, 0xdefec9c5,
+0xf9c5d231, 0x4439d87e, 0xe3c46024, 0x01d81679,
+0xb46ff9c5, 0x00009024, 0xfec9c500, 0xc2940fee,
+0xdaf7db31, 0x64244439, 0x1679e3c4, 0xf9c502d8,
+0x940ffa6e, 0x39dbf7c3, 0x0f682444, 0xb60fc094,
+0xc5d8f7c0, 0xc4e06ef9, 0xd81679e3, 0x24443903,
+0xc0940f6c, 0xc5f0b60f, 0xf7e87ef9, 0x244439de,
+0x59e3c470, 0x0f01e622, 0xb60fc094, 0xc5d8f7c0,
+0xc4d86ef9, 0xe81679e3, 0x24443901, 0x79e3c474,
+0x0f02e816, 0xb60fc194, 0xf7c931f9, 0x244439df,
+0x79e3c478, 0xc403e816, 0xdf2261e3, 0xc1940f01,
+0x4439d9f7, 0xf9c57c24, 0x940ff16e, 0xc0b60fc0,
+0xe3c4d8f7, 0x01e82249, 0xed6ce1c5, 0x2241e3c4,
+0xe1c501db, 0xe3c4dc6c, 0x01dd1865, 0xd350fcc5,
+0x00fffa81, 0x09b80000, 0x0f000006, 0x00052385,
+0xc5db3100, 0xc4d17ef9, 0xd21679e3, 0x24bc8301,
+0x00000100, 0x79e3c400, 0xc402d016, 0x541679e3,
+0xc5032c24, 0xc4ce7ef9, 0xcf1679e3, 0xcb4e0f01,
+0x0424bc83, 0x00000001, 0x83d34e0f, 0x010824bc,
+0x0f000000, 0x4489c34e, 0x448b2824, 0xbc832c24,
+0x00010c24, 0x4e0f0000, 0x24bc83c3, 0x00000110,
+0x24448900, 0x79e3c42c, 0x0f02c816, 0xbc83f34e,
+0x00011424, 0xf9c50000, 0x4e0ffe6e, 0x24bc83fb,
+0x00000118, 0xc34e0f00, 0x1c24bc83, 0x00000001,
+0x24244489, 0x1679e3c4, 0xe3c403c8, 0x01cf2241,
+0x746ef9c5, 0xf9c52424, 0x4f0ff96e, 0x49e3c4d8,
+0xc501d322, 0x24746ef9, 0x6cf1c528, 0x49e3c4ca,
+0x2c245c22, 0x41e3c401, 0xc501d222, 0xc4d36ce9,
+0xd1186de3, 0x6ff9c501, 0x7ffdc5ca, 0x00802494,
+0xe98f0000, 0x24949ae8, 0x00000100, 0xb46ff9c5,
+0x00011024, 0x48e98f00, 0x90249c9a, 0xc4000000,
+0xd3186de3, 0x7ef9c501, 0x7ffdc5d2, 0xb8402454,
+0x00000001, 0xb46ff9c5, 0x00010024, 0x6ef9c500,
+0x70f9c5f8, 0xf9c500df, 0x1024bc6f, 0xc5000001,
+0xc5d3fac9, 0xc4dbfac1, 0xd3186de3, 0x7ffdc501,
+0x01002494, 0xe98f0000, 0x248c9af0, 0x00000100,
+0xb46ff9c5, 0x00011024, 0x48e98f00, 0x9024949a,
+0xc4000000, 0xda1875e3, 0xfef1c501, 0x7ffdc5c9,
+0xc560245c, 0x39c87ef9, 0xfee9c5c2, 0xc0940fd2,
+0xb60fc931, 0x79e3c4f8, 0xf701c816, 0x244439df,
+0x79e3c444, 0xc502c816, 0x0fff6ef9, 0xd9f7c194,
+0x48244439, 0x31c0940f, 0xc0b60fdb, 0xf9c5d8f7,
+0xe3c4d86e, 0x03c81679, 0x4c244439, 0xd07ef9c5,
+0xf7c3940f, 0x244439db, 0x61e3c450, 0x0f01db22,
+0xb60fc094, 0xc5d8f7c0, 0xc4c86ef9, 0xd01679e3,
+0x24443901, 0xc0940f54, 0xb60fd231, 0x79e3c4f0,
+0xf702d016, 0x244439de, 0x79e3c458, 0xc403d016,
+0xce2271e3, 0xc2940f01, 0x4439daf7, 0xf9c55c24,
+0x940fe26e, 0xc2b60fc2, 0xe3c4d8f7, 0x01d02259,
+0xca6cf1c5, 0x2241e3c4, 0xe9c501d1, 0xe3c4d36c,
+0x01c9186d, 0xd150fcc5, 0x00fffa81, 0x21b80000,
+0x0f000006, 0x0002db85, 0xefe9c500, 0xfae9c5d2,
+0x0100248c, 0xe9c50000, 0x102494fa, 0x8f000001,
+0x4c9a70e9, 0xe98f6024, 0x245c9a68, 0x7ef9c570,
+0x248439c8, 0x00000080, 0x1679e3c4, 0xe3c401da,
+0x03df1679, 0x31c0940f, 0xc0b60fc9, 0xf9c5d8f7,
+0xe3c4d06e, 0x01c81679, 0x84248439, 0xc4000000,
+0xc81679e3, 0xc1940f02, 0x8439d9f7, 0x00008824,
+0x69e3c400, 0x0f01d122, 0xdb31c094, 0xf7c0b60f,
+0x6ef9c5d8, 0x79e3c4e0, 0x3903c816, 0x008c2484,
+0xf9c50000, 0x940fd87e, 0x39dbf7c3, 0x00902484,
+0xe3c40000, 0x01e32259, 0xd46ce9c5, 0x0fc0940f,
+0xd8f7c0b6, 0x94249439, 0xc5000000, 0xb8f06ef9,
+0x00000626, 0x0fc2940f, 0xe3c4f2b6, 0x02da1679,
+0x9439def7, 0x00009824, 0x49e3c400, 0x0f01ce22,
+0xb60fc294, 0x39daf7d2, 0x009c24bc, 0xf9c50000,
+0x940fea6e, 0x0f2c2444, 0x2c247cb6, 0xe3c4dff7,
+0x01df2251, 0xcb6cf1c5, 0x186de3c4, 0xfcc501c9,
+0xfa81d150, 0x000000ff, 0x01c6850f, 0xc0310000,
+0xbc6ffdc5, 0x0000a024, 0x7ffdc500, 0x8360247c,
+0x00e024bc, 0xc5000000, 0x248c6ff9, 0x000000a0,
+0xce7ef9c5, 0x31c09f0f, 0x83d8f7c9, 0x00e424bc,
+0xc5000000, 0x0fd06ef9, 0xc031c19f, 0xbc83d9f7,
+0x0000e824, 0xe3c40000, 0x01d12269, 0x31c09f0f,
+0x83d8f7db, 0x00ec24bc, 0xc5000000, 0x0fd86ef9,
+0xc031c39f, 0xbc83dbf7, 0x0000f024, 0xe3c40000,
+0x01db2261, 0xd36ce9c5, 0xf7c09f0f, 0x24bc83d8,
+0x000000f4, 0x6ef9c500, 0xc29f0ff8, 0x31fab60f,
+0x83dff7d2, 0x00f824bc, 0xc4000000, 0xcf2241e3,
+0x6ffdc501, 0x00a024bc, 0x9f0f0000, 0xf7c031c2,
+0x24bc83da, 0x000000fc, 0x6ef9c500, 0xc09f0fea,
+0xe3c4d8f7, 0x01e02251, 0xcc6cf1c5, 0x186de3c4,
+0xe88f01c9, 0x248ca244, 0x000000c0, 0x7ef9c510,
+0x0fc639c8, 0xc931c094, 0xf7c0b60f, 0x6ef9c5d8,
+0x79e3c4d0, 0x3901c816, 0x00c42484, 0xe3c40000,
+0x02c81679, 0xf7c1940f, 0x244439d9, 0x69e3c468,
+0x0f01d122, 0xdb31c094, 0xf7c0b60f, 0x6ef9c5d8,
+0x79e3c4d8, 0x3903c816, 0x00cc2484, 0xe3c40000,
+0x01c9197d, 0xc87ef9c5, 0xf7c3940f, 0x244439db,
+0x61e3c470, 0xc501db22, 0x0fd36ce9, 0xb60fc094,
+0x89d8f7c0, 0x79e3c4c7, 0x3901c816, 0x00d42484,
+0xf9c50000, 0x940fef6e, 0x0fd231c0, 0xe3c4f0b6,
+0x02c81679, 0x4439def7, 0xe3c47824, 0x03c81679,
+0x2251e3c4, 0x940f01ce, 0x39daf7c2, 0x00dc2484,
+0xf9c50000, 0x940fe26e, 0xc2b60fc2, 0x000000ba,
+0xc4d8f700, 0xe02259e3, 0x6cf1c501, 0x6de3c4cc,
+0xc501c918, 0x3dc150fc, 0x000000ff, 0x00072ab8,
+0xc2440f00, 0x5bf4658d, 0xc35d5f5e,
+0010034,
+};
+asm(".type xop_x86_32_D_32i4, STT_NOTYPE;");
+asm(".type xop_x86_32_D_32i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_32u4[] = {
+0xba5500eb, 0x00000020, 0xc031e589, 0x0009bf57,
+0x53560000, 0x81e0e483, 0x000120ec, 0x89c38900,
+0x40d989fe, 0x2901e183, 0xd88549c6, 0x894a0175,
+0x009c8484, 0xf8830000, 0x84b48908, 0x000000bc,
+0xdc848c89, 0x89000000, 0x00fc8494, 0xcd750000,
+0xb46ffdc5, 0x0000a024, 0x7ffdc500, 0x8b402474,
+0x39402444, 0x00a02484, 0x748b0000, 0x940f4824,
+0x0fc931c0, 0xd8f7c0b6, 0xc86ef9c5, 0x4424448b,
+0xa4248439, 0x0f000000, 0xc031c194, 0xb43bd9f7,
+0x0000a824, 0x71e3c400, 0x0f01c922, 0xdb31c094,
+0xf9c5d8f7, 0x448bd86e, 0x843b4c24, 0x0000ac24,
+0x24448900, 0xc3940f2c, 0x5024448b, 0x843bdbf7,
+0x0000b024, 0x61e3c400, 0xc501db22, 0x89cb6cf1,
+0x0f282444, 0xb60fc094, 0xc5d8f7c0, 0x8bd06ef9,
+0x3b542444, 0x00b42484, 0x44890000, 0x940f2424,
+0x24448bc2, 0xfab60f58, 0xdff7d231, 0xb824843b,
+0xc4000000, 0xd72269e3, 0x24448901, 0x24448b20,
+0xc2940f5c, 0x843bdaf7, 0x0000bc24, 0x6ef9c500,
+0x244489fa, 0xc0940f1c, 0xf7c0b60f, 0x41e3c4d8,
+0xc501e022, 0xc4d46ce9, 0xca1875e3, 0x50fcc501,
+0xfffa81d1, 0xb8000000, 0x00000539, 0x0d1c850f,
+0xf9c50000, 0x4024746f, 0x7c6ff9c5, 0xc9c55024,
+0xa0248cfe, 0xc5000000, 0x2494fec1, 0x000000b0,
+0x1875e3c4, 0xfdc501ca, 0x60244c7f, 0xb46ff9c5,
+0x0000a024, 0x72e9c500, 0xf9c501f6, 0xb024bc6f,
+0xc5000000, 0x39d07ef9, 0xc4602444, 0xd21679e3,
+0x79e3c401, 0xc503d116, 0x01f772e1, 0xdb7ef9c5,
+0x1679e3c4, 0x940f01df, 0xc0b60fc0, 0x5439d8f7,
+0xf9c56424, 0x940fc86e, 0xd2b60fc2, 0x5489daf7,
+0xe3c41824, 0x02d21679, 0x68245439, 0x2271e3c4,
+0x0118244c, 0x0fc2940f, 0xdaf7d2b6, 0x6c244c39,
+0xe26ef9c5, 0x0fc1940f, 0xd9f7c9b6, 0x70245c39,
+0x2259e3c4, 0xf1c501e1, 0x940fcc6c, 0xd8b60fc0,
+0x7c39dbf7, 0xf9c57424, 0xe3c4d36e, 0x02db1679,
+0x0fc2940f, 0xdff7fab6, 0x78245c39, 0x2269e3c4,
+0x940f01d7, 0x0fc031c2, 0xdbf7dab6, 0xe3c4da89,
+0x03db1679, 0x7c245c39, 0xf26ef9c5, 0xf7c0940f,
+0x49e3c4d8, 0xc501d822, 0xc4d36ce9, 0xca1875e3,
+0x50fcc501, 0xfffa81d1, 0xb8000000, 0x0000053f,
+0x0bf8850f, 0xf9c50000, 0x60247c6f, 0x746ff9c5,
+0xc1c57024, 0xa0248cfa, 0xc5000000, 0x2494fac9,
+0x000000b0, 0x1875e3c4, 0xfdc501ca, 0x80248c7f,
+0x8b000000, 0x00802484, 0x44390000, 0x940f4024,
+0x0fd231c0, 0xd8f7c0b6, 0xd06ef9c5, 0x8424848b,
+0x39000000, 0x8b442444, 0x0f2c2444, 0xc931c294,
+0xb43bdaf7, 0x00008824, 0x69e3c400, 0x0f01d222,
+0xd9f7c194, 0x8c24843b, 0xc5000000, 0x8bf16ef9,
+0x0f282444, 0xb60fc394, 0xf7db31f3, 0x24843bde,
+0x00000090, 0x2424448b, 0xf7c3940f, 0x24843bdb,
+0x00000094, 0xdb6ef9c5, 0x31c0940f, 0xf8b60fdb,
+0x2024448b, 0x843bdff7, 0x00009824, 0x61e3c400,
+0x8b01df22, 0x0f1c2444, 0xdbf7c394, 0x9c24843b,
+0xc5000000, 0x0ffb6ef9, 0xb60fc094, 0xc4d8f7c0,
+0xe02241e3, 0x6ce1c501, 0x49e3c4dc, 0xc501e622,
+0xc4d46ce9, 0xd3186de3, 0x50fcc501, 0xfffa81d2,
+0xb8000000, 0x00000544, 0x0af0850f, 0xfdc50000,
+0x40247c6f, 0x9456c4c5, 0x0000c024, 0x7ffdc500,
+0xc5402454, 0x248c54f4, 0x000000c0, 0xb46ffdc5,
+0x00008024, 0x57ccc500, 0x00c02494, 0xf9c50000,
+0xfdc5d07e, 0x8024947f, 0xc5000000, 0x244c55f4,
+0x7ef9c540, 0x0fd039ca, 0xc931c094, 0xf7c0b60f,
+0x6ef9c5d8, 0x79e3c4d0, 0x3901c816, 0x00842484,
+0xe3c40000, 0x02c81679, 0xf7c1940f, 0x248439d9,
+0x00000088, 0x2269e3c4, 0x940f01d1, 0x0fdb31c0,
+0xd8f7c0b6, 0xd86ef9c5, 0x1679e3c4, 0x843903c8,
+0x00008c24, 0x7de3c400, 0xc501c919, 0x0fc87ef9,
+0xdbf7c394, 0x90248439, 0xc4000000, 0xdb2261e3,
+0x6ce9c501, 0xc0940fd3, 0xf7c0b60f, 0xc4c789d8,
+0xc81679e3, 0x24843901, 0x00000094, 0xff6ef9c5,
+0x31c0940f, 0xf0b60fd2, 0x1679e3c4, 0xdef702c8,
+0x98248439, 0xc4000000, 0xc81679e3, 0x41e3c403,
+0x0f01ce22, 0xdaf7c294, 0x9c248439, 0xc5000000,
+0x0fe26ef9, 0xb60fc294, 0xc4d8f7c2, 0xe02259e3,
+0x6cf1c501, 0x6de3c4cc, 0xc501c918, 0x81d150fc,
+0x0000fffa, 0x0550b800, 0x850f0000, 0x000009be,
+0xb46ff9c5, 0x0000a024, 0x6ff9c500, 0x00b024bc,
+0xe2c40000, 0x248c4049, 0x000000c0, 0x4041e2c4,
+0x00d02494, 0xe3c40000, 0x01ca1875, 0xc87ef9c5,
+0x4c7ffdc5, 0xf8834024, 0xc0940f08, 0xb60fc931,
+0x83d8f7c0, 0x0e44247c, 0xd06ef9c5, 0x31c1940f,
+0x83d9f7c0, 0x1248247c, 0x2269e3c4, 0x940f01d1,
+0xf7db31c0, 0x247c83d8, 0xf9c5144c, 0x940fd86e,
+0xf7c031c3, 0x247c83db, 0xe3c41450, 0x01db2261,
+0xd36ce9c5, 0xf7c0940f, 0x247c83d8, 0xf9c51254,
+0xc8b8f86e, 0x0f000005, 0xb60fc294, 0xf7d231f2,
+0x247c83de, 0xe3c40e58, 0x01ce2241, 0xf7c2940f,
+0x247c83da, 0xf9c5085c, 0x940ff26e, 0x0f2c2444,
+0x2c247cb6, 0xe3c4dff7, 0x01e72249, 0xcc6cf1c5,
+0x186de3c4, 0xfcc501c9, 0xfa81d150, 0x000000ff,
+0x08d8850f, 0xfdc50000, 0xa0249c6f, 0xc5000000,
+0x249c7ffd, 0x00000080, 0xb46ff9c5, 0x00008024,
+0x6ff9c500, 0x009024bc, 0xf1c50000, 0xc503f672,
+0x03f772e9, 0x1875e3c4, 0xf9c501ca, 0xfdc5c87e,
+0x40244c7f, 0xb46ff9c5, 0x00008024, 0x6ff9c500,
+0x009024bc, 0xf1c50000, 0xc502f672, 0x02f772e9,
+0x1875e3c4, 0xfdc501ca, 0x60244c7f, 0x746ff9c5,
+0xc9c56024, 0xf9c5cefe, 0x70247c6f, 0xca7ef9c5,
+0xc1c5d039, 0x940feffe, 0xc4c931c0, 0xea1679e3,
+0xc0b60f01, 0x1679e3c4, 0xd8f703ef, 0xd06ef9c5,
+0x1679e3c4, 0x443901c8, 0xe3c44424, 0x02c81679,
+0xf7c1940f, 0x244439d9, 0x69e3c448, 0x0f01d122,
+0xdb31c094, 0xf7c0b60f, 0x6ef9c5d8, 0x79e3c4e0,
+0x3903c816, 0xc54c2444, 0x0fe87ef9, 0xdbf7c394,
+0x50244439, 0x2259e3c4, 0xe9c501e3, 0x940fd46c,
+0xc0b60fc0, 0x5439d8f7, 0xf9c55424, 0xedb8f86e,
+0x0f000005, 0xb60fc294, 0x79e3c4f2, 0xf702ea16,
+0x245439de, 0x41e3c458, 0x0f01ce22, 0xb60fc294,
+0x39daf7d2, 0xc55c247c, 0x0ff26ef9, 0x2c244494,
+0x247cb60f, 0xc4dff72c, 0xef2249e3, 0x6cf1c501,
+0x6de3c4cd, 0xc501c918, 0x81d150fc, 0x0000fffa,
+0x87850f00, 0xc5000007, 0x24746ff9, 0x6ff9c540,
+0xc550247c, 0x02d672f1, 0xd772e9c5, 0x75e3c402,
+0xc501ca18, 0x248c7ffd, 0x00000080, 0xb46ff9c5,
+0x00008024, 0xfec9c500, 0x6ff9c5ce, 0x009024bc,
+0xf9c50000, 0x4439c87e, 0xc1c56024, 0xe3c4effe,
+0x01ea1679, 0x1679e3c4, 0x940f03ef, 0x0fc931c0,
+0xd8f7c0b6, 0xd06ef9c5, 0x1679e3c4, 0x443901c8,
+0xe3c46424, 0x02c81679, 0xf7c1940f, 0x244439d9,
+0x69e3c468, 0x0f01d122, 0xdb31c094, 0xf7c0b60f,
+0x6ef9c5d8, 0x79e3c4e0, 0x3903c816, 0xc56c2444,
+0x0fe87ef9, 0xdbf7c394, 0x70244439, 0x2259e3c4,
+0xe9c501e3, 0x940fd46c, 0xc0b60fc0, 0x5439d8f7,
+0xf9c57424, 0xf2b8f86e, 0x0f000005, 0xb60fc294,
+0x79e3c4f2, 0xf702ea16, 0x245439de, 0x41e3c478,
+0x0f01ce22, 0xb60fc294, 0x39daf7d2, 0xc57c247c,
+0x0ff26ef9, 0x2c244494, 0x247cb60f, 0xc4dff72c,
+0xef2249e3, 0x6cf1c501, 0x6de3c4cd, 0xc501c918,
+0x81d150fc, 0x0000fffa, 0x6f850f00, 0xc7000006,
+0x033c2444, 0xc5000000, 0x249c7ffd, 0x00000080,
+0x646ef9c5, 0xf9c53c24, 0x9024b46f, 0xc5000000,
+0xc5d4f2e1, 0xc4e4f2c9, 0xd4186de3, 0x7ef9c501,
+0x7ffdc5d0, 0xc7402454, 0x023c2444, 0xc5000000,
+0x24546ef9, 0xf2e1c53c, 0xf2c9c5ca, 0x75e3c4d2,
+0xc501ca18, 0x244c7ffd, 0x6ff9c560, 0xc5602474,
+0xc5cefec9, 0x247c6ff9, 0x7ef9c570, 0xc5d039ca,
+0x0feffec1, 0xc931c094, 0x1679e3c4, 0xb60f01ea,
+0x79e3c4c0, 0xf703ef16, 0x6ef9c5d8, 0x79e3c4d0,
+0x3901c816, 0xc4442444, 0xc81679e3, 0xc1940f02,
+0x4439d9f7, 0xe3c44824, 0x01d12269, 0x31c0940f,
+0xc0b60fdb, 0xf9c5d8f7, 0xe3c4e06e, 0x03c81679,
+0x4c244439, 0xe87ef9c5, 0xf7c3940f, 0x244439db,
+0x59e3c450, 0xc501e322, 0x0fd46ce9, 0xb60fc094,
+0x39d8f7c0, 0xc5542454, 0xb8f86ef9, 0x00000605,
+0x0fc2940f, 0xe3c4f2b6, 0x02ea1679, 0x5439def7,
+0xe3c45824, 0x01ce2241, 0x0fc2940f, 0xdaf7d2b6,
+0x5c247c39, 0xf26ef9c5, 0x2444940f, 0x7cb60f2c,
+0xdff72c24, 0x2249e3c4, 0xf1c501ef, 0xe3c4cd6c,
+0x01c9186d, 0xd150fcc5, 0x00fffa81, 0x850f0000,
+0x0000052a, 0x546ef9c5, 0xf9c53c24, 0x4024746f,
+0x7c6ff9c5, 0xc9c55024, 0xc1c5cad2, 0xe3c4d2d2,
+0x01ca1875, 0x8c7ffdc5, 0x00008024, 0x6ff9c500,
+0x008024ac, 0xd1c50000, 0xf9c5cdfe, 0x9024b46f,
+0xc5000000, 0x39c87ef9, 0xc5602444, 0xc4eefec9,
+0xea1679e3, 0x79e3c401, 0x0f03ef16, 0xc931c094,
+0xf7c0b60f, 0x6ef9c5d8, 0x79e3c4d0, 0x3901c816,
+0xc4642444, 0xc81679e3, 0xc1940f02, 0x4439d9f7,
+0xe3c46824, 0x01d12269, 0x31c0940f, 0xc0b60fdb,
+0xf9c5d8f7, 0xe3c4e06e, 0x03c81679, 0x6c244439,
+0xe87ef9c5, 0xf7c3940f, 0x244439db, 0x59e3c470,
+0xc501e322, 0x0fd46ce9, 0xb60fc094, 0x39d8f7c0,
+0xc5742454, 0xb8f06ef9, 0x00000609, 0x0fc2940f,
+0xe3c4f2b6, 0x02ea1679, 0x5439def7, 0xe3c47824,
+0x01ce2249, 0x0fc2940f, 0xdaf7d2b6, 0x7c247c39,
+0xfa6ef9c5, 0x2444940f, 0x7cb60f2c, 0xdff72c24,
+0x2241e3c4, 0xf1c501ef, 0xe3c4cd6c, 0x01c9186d,
+0xd150fcc5, 0x00fffa81, 0x850f0000, 0x0000040e,
+0x0024848b, 0x8b000001, 0x010824b4, 0xbc8b0000,
+0x00011824, 0x19d8f700, 0x6ef9c5c0, 0x24848bd0,
+0x00000104, 0xc019d8f7, 0xf619def7, 0x2269e3c4,
+0xf9c501d0, 0xb48be66e, 0x00010c24, 0x8bdef700,
+0x011024b4, 0xd2190000, 0x2259e3c4, 0xe9c501e2,
+0xdef7d46c, 0xf9c5f619, 0xb48bce6e, 0x00011424,
+0x19def700, 0x8bdff7c9, 0x011c24bc, 0xf6190000,
+0x2271e3c4, 0xf9c501c9, 0xdff7ee6e, 0xe3c4db19,
+0x01eb2251, 0xcd6cf1c5, 0x186de3c4, 0xecc501d1,
+0xf9c5d354, 0xfdc5ca6f, 0x8024947f, 0x8f000000,
+0x949ae8e9, 0x00010024, 0x6ff9c500, 0x011024ac,
+0xe98f0000, 0x24a49a50, 0x00000090, 0x186de3c4,
+0xf9c501d4, 0xfdc5d07e, 0x4024547f, 0xd276e9c5,
+0xa4fee9c5, 0x00010024, 0xfee9c500, 0x01102494,
+0xe3c40000, 0x01d2185d, 0x947ffdc5, 0x00010024,
+0xf0e98f00, 0x00248c9a, 0xc5000001, 0x24bc6ff9,
+0x00000110, 0x9a40e98f, 0x00902494, 0xe3c40000,
+0x01e21875, 0xc9fef1c5, 0xd2fee9c5, 0xca7ef9c5,
+0xfdc5d039, 0x6024647f, 0x31c0940f, 0xf0b60fd2,
+0x1679e3c4, 0xdef701c8, 0x44244439, 0x1679e3c4,
+0xf9c502c8, 0x940ff66e, 0x39daf7c2, 0x0f482444,
+0xc931c094, 0xc4f8b60f, 0xc81679e3, 0x39dff703,
+0xc54c2444, 0xc5d07ef9, 0x0fef6ef9, 0xd9f7c194,
+0x50244439, 0x31c0940f, 0xc0b60fdb, 0xf9c5d8f7,
+0xe3c4c86e, 0x01d01679, 0x54244439, 0x1679e3c4,
+0x940f02d0, 0x39dbf7c3, 0xc4582444, 0xcb2271e3,
+0xc0940f01, 0xf7c0b60f, 0x6ef9c5d8, 0x79e3c4e0,
+0x3903d016, 0x0f5c2444, 0xb60fc094, 0xc4d8f7c0,
+0xd02259e3, 0x51e3c401, 0xc501e122, 0xc4ca6cf1,
+0xd22249e3, 0x6ce9c501, 0x6de3c4d4, 0xc501c918,
+0x81d150fc, 0x0000fffa, 0x0621b800, 0x850f0000,
+0x0000021a, 0xd2efe9c5, 0x8cfae9c5, 0x00010024,
+0xfae9c500, 0x01102494, 0xe98f0000, 0x244c9670,
+0x68e98f60, 0x70246c96, 0xc87ef9c5, 0x80248439,
+0xc4000000, 0xea1679e3, 0x79e3c401, 0x0f03ef16,
+0xc931c094, 0xf7c0b60f, 0x6ef9c5d8, 0x79e3c4d0,
+0x3901c816, 0x00842484, 0xe3c40000, 0x02c81679,
+0xf7c1940f, 0x248439d9, 0x00000088, 0x2269e3c4,
+0x940f01d1, 0x0fdb31c0, 0xd8f7c0b6, 0xe06ef9c5,
+0x1679e3c4, 0x843903c8, 0x00008c24, 0x7ef9c500,
+0xc3940fe8, 0x8439dbf7, 0x00009024, 0x59e3c400,
+0xc501e322, 0x0fd46ce9, 0xb60fc094, 0x39d8f7c0,
+0x00942494, 0xf9c50000, 0x26b8f06e, 0x0f000006,
+0xb60fc294, 0x79e3c4f2, 0xf702ea16, 0x249439de,
+0x00000098, 0x2249e3c4, 0x940f01ce, 0xd2b60fc2,
+0xbc39daf7, 0x00009c24, 0x6ef9c500, 0x44940ffa,
+0xb60f2c24, 0xf72c247c, 0x41e3c4df, 0xc501ef22,
+0xc4cd6cf1, 0xc9186de3, 0x50fcc501, 0xfffa81d1,
+0x0f000000, 0x00010585, 0x7ef9c500, 0x6ffdc5d8,
+0x00e024ac, 0xe88f0000, 0x248ca264, 0x000000c0,
+0x7ef9c550, 0xc5d039ca, 0x245c7ffd, 0xc0940f60,
+0xb60fc931, 0xc5d8f7c0, 0xc4d06ef9, 0xc81679e3,
+0x24843901, 0x000000c4, 0x1679e3c4, 0x940f02c8,
+0x39d9f7c1, 0xc4682444, 0xd12269e3, 0xc0940f01,
+0xb60fdb31, 0xc5d8f7c0, 0xc4d86ef9, 0xc81679e3,
+0x24843903, 0x000000cc, 0x197de3c4, 0xf9c501c9,
+0x940fc87e, 0x39dbf7c3, 0xc4702444, 0xdb2261e3,
+0x6ce9c501, 0xc0940fd3, 0xf7c0b60f, 0xc4c789d8,
+0xc81679e3, 0x24843901, 0x000000d4, 0xff6ef9c5,
+0x31c0940f, 0xf0b60fd2, 0x1679e3c4, 0xdef702c8,
+0x78244439, 0x1679e3c4, 0xe3c403c8, 0x01ce2241,
+0xf7c2940f, 0x248439da, 0x000000dc, 0xe26ef9c5,
+0x0fc2940f, 0x00bac2b6, 0xf7000000, 0x59e3c4d8,
+0xc501e022, 0xc4cc6cf1, 0xc9186de3, 0x50fcc501,
+0x00ff3dc1, 0x2ab80000, 0x0f000007, 0x658dc244,
+0x5f5e5bf4, 0x0000c35d,
+0007166,
+};
+asm(".type xop_x86_32_D_32u4, STT_NOTYPE;");
+asm(".type xop_x86_32_D_32u4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_32i8[] = {
+0xb85500eb, 0x00000001, 0xd231e589, 0xbb535657,
+0x00000040, 0x81e0e483, 0x000140ec, 0xff788d00,
+0x000005be, 0x247c8900, 0x29ff3130, 0x247489c6,
+0x83d71940, 0x7c89ffce, 0x01a84424, 0xf789c189,
+0x01be0774, 0x31000000, 0x244c85ff, 0x4b017530,
+0xb8cc8489, 0xc5000000, 0x247c7efa, 0xd6f9c540,
+0x00d8ccbc, 0xb4890000, 0x0000f8cc, 0x83f63100,
+0x948901c0, 0x0000bccc, 0x00d28300, 0xfcccbc89,
+0x89000000, 0x0118cc9c, 0xb4890000, 0x00011ccc,
+0x83c18900, 0xd10905f1, 0xfdc58375, 0xc024bc6f,
+0xc5000000, 0x247c7ffd, 0xc5c03160, 0x24547efa,
+0x7efac560, 0x00c0248c, 0xf1c50000, 0xf1c5caef,
+0xe2c4c96c, 0x0fc91779, 0xd231c094, 0x5c7efac5,
+0xd8f76824, 0x8c7efac5, 0x0000c824, 0xeff1c500,
+0x244489cb, 0x00d28328, 0xdaf7c031, 0xc96cf1c5,
+0x1779e2c4, 0x7efac5c9, 0xc570244c, 0x244c7ff9,
+0x7efac530, 0x00d0248c, 0xf1c50000, 0x30244cef,
+0xc96cf1c5, 0x2c245489, 0x31c0940f, 0x7ff9c5db,
+0x89402454, 0x83d9f7c1, 0xc03100d3, 0xe2c4dbf7,
+0x0fc91779, 0xd231c094, 0xfac5d8f7, 0x78244c7e,
+0x20244489, 0x3100d283, 0xc5daf7c0, 0xc5f96ff9,
+0x248c7efa, 0x000000d8, 0xc9efc1c5, 0xc96cf1c5,
+0x1779e2c4, 0x245489c9, 0xc0940f24, 0xd8f7d231,
+0x747efac5, 0x44892024, 0xd2832024, 0x0539b800,
+0xdaf70000, 0x24245489, 0x5c16c8c5, 0xfac52024,
+0x2824747e, 0x28244c89, 0x2c245c89, 0x4c16c8c5,
+0xe3c42824, 0x01cb1875, 0xd150fdc5, 0x0f0ffa83,
+0x00126185, 0x6ff9c500, 0xc560244c, 0x24646ff9,
+0xd4f1c570, 0x00c0249c, 0xd9c50000, 0xd024acd4,
+0xc4000000, 0xdd1865e3, 0x7ffdc501, 0x0080249c,
+0xf9c50000, 0xc024b46f, 0xc5000000, 0x01f673c9,
+0x947efac5, 0x00008024, 0x7ef9c500, 0x6ef9c5f0,
+0xc4c031d8, 0xf21679e3, 0x61e3c401, 0xc501da22,
+0xc5daefe1, 0xc4db6ce1, 0xdb1779e2, 0x31c0940f,
+0xc5d8f7d2, 0x247417f8, 0x24448928, 0x00d28320,
+0xf9c5c031, 0x28245c6e, 0xe3c4daf7, 0x245c2261,
+0xfac5012c, 0x8824b47e, 0xc5000000, 0xc5deefe1,
+0xc4db6ce1, 0xdb1779e2, 0xac6ff9c5, 0x0000d024,
+0x24548900, 0xc0940f24, 0xf573d1c5, 0x7efac501,
+0x009024b4, 0xc1890000, 0xf9c5db31, 0xd9f7e87e,
+0xd86ef9c5, 0x1679e3c4, 0xd38301ea, 0xc4c03100,
+0xda2261e3, 0xc5dbf701, 0xc5deefe1, 0xc4db6ce1,
+0xdb1779e2, 0x31c0940f, 0xc5d8f7d2, 0x246c17f8,
+0x7efac528, 0x009824ac, 0x44890000, 0xd2831824,
+0xf7c03100, 0x6ef9c5da, 0xc428245c, 0x5c2261e3,
+0xc5012c24, 0xc5ddefe1, 0xc4db6ce1, 0xdb1779e2,
+0x1c245489, 0x31c0940f, 0xc5d8f7d2, 0x24747efa,
+0x24448918, 0x00d28328, 0x00053fb8, 0x89daf700,
+0xc52c2454, 0x246c16c8, 0x244c8928, 0x7efac528,
+0x89202474, 0xc52c245c, 0x245c16c8, 0x65e3c428,
+0xc501dd18, 0x83d350fd, 0x850f0ffa, 0x000010e6,
+0xb46ff9c5, 0x00008024, 0xfbc9c500, 0x00c0249c,
+0xf9c50000, 0x9024b46f, 0xc5000000, 0x24acfbc9,
+0x000000d0, 0x1865e3c4, 0xfdc501dd, 0xa0249c7f,
+0x31000000, 0x7efac5c0, 0x00a0249c, 0xe1c50000,
+0x402454ef, 0xd26ce9c5, 0x1779e2c4, 0xc0940fd2,
+0xd8f7d231, 0x9c7efac5, 0x0000a824, 0x24448900,
+0x00d28340, 0xdaf7c031, 0x547efac5, 0xe9c56824,
+0xe9c5d3ef, 0xe2c4d26c, 0xc5d21779, 0x24947efa,
+0x000000b0, 0x54efe9c5, 0xe9c53024, 0x5489d26c,
+0x940f4424, 0x89db31c0, 0x83d9f7c1, 0xc03100d3,
+0xe2c4dbf7, 0x0fd21779, 0xd231c094, 0xfac5d8f7,
+0xb824947e, 0x89000000, 0x83302444, 0xc03100d2,
+0xc1c5daf7, 0xe9c5d2ef, 0xe2c4d26c, 0x89d21779,
+0x0f342454, 0xd231c094, 0xfac5d8f7, 0x30247c7e,
+0x30244489, 0xb800d283, 0x00000544, 0x5489daf7,
+0xc0c53424, 0x30245c16, 0x7c7efac5, 0x4c894024,
+0x5c894024, 0xc0c54424, 0x40245416, 0x186de3c4,
+0xfdc501d3, 0xfa83d250, 0xc7850f0f, 0xc500000f,
+0xb1d170f9, 0x4069e2c4, 0x00c02494, 0xf1c50000,
+0xc0248cf4, 0x8f000000, 0xd2cb78e9, 0xf273e9c5,
+0xd4f1c520, 0x70f9c5ca, 0xe2c4b1d4, 0x24944069,
+0x000000d0, 0xa4f4d9c5, 0x0000d024, 0x78e98f00,
+0xe9c5d2cb, 0xc520f273, 0xc5e2d4d9, 0x24946ff9,
+0x000000f0, 0x1875e3c4, 0xf9c501cc, 0xfdc5e96f,
+0x60244c7f, 0x8c6ff9c5, 0x0000e024, 0x70f9c500,
+0xe2c4b1d9, 0x8fd94061, 0xdbcb78e9, 0xc9f4f1c5,
+0xf373e1c5, 0xd4f1c520, 0x70f9c5cb, 0xe2c4b1da,
+0x8fda4061, 0xdbcb78e9, 0xd2f4e9c5, 0xf373e1c5,
+0xd4e9c520, 0x75e3c4d3, 0xc501ca18, 0xc5f96ff9,
+0x248c7ffd, 0x00000080, 0x946ff9c5, 0x0000c024,
+0x6ff9c500, 0x00d0248c, 0xe9c50000, 0xe0249cd4,
+0xc5000000, 0x24a4d4f1, 0x000000f0, 0x1865e3c4,
+0xf9c501dc, 0xfdc5f36f, 0xa0249c7f, 0xc5000000,
+0x249cfbe9, 0x000000e0, 0xeffbd1c5, 0x7c6ff9c5,
+0xf9c57024, 0xe3c4e97e, 0x01eb1679, 0xe370f9c5,
+0x59e2c4b1, 0xe1c5e640, 0xe98fdef4, 0xc5e4cb78,
+0x24b4fbf1, 0x000000f0, 0xf473d9c5, 0xd4e1c520,
+0x7ef9c5dc, 0x79e3c4d8, 0x3101da16, 0xc5da31c8,
+0x245c17f8, 0x70f9c530, 0xe2c4b1e6, 0x24a44059,
+0x000000b0, 0xc9c5d009, 0xb024b4f4, 0x0f000000,
+0xb60fc094, 0xf7d231c0, 0x78e98fd8, 0xd9c5e4cb,
+0x8920f473, 0x83402444, 0x448b00d2, 0xdaf73024,
+0xf4d4c9c5, 0x44245489, 0x3424548b, 0x6c17f8c5,
+0x44333024, 0xf8c53024, 0x28247417, 0x34245433,
+0xa4fbc1c5, 0x00009024, 0xc4d00900, 0xf21679e3,
+0xc0940f01, 0xf9c5ff31, 0xb60fe17e, 0x79e3c4c0,
+0x8901e316, 0x7ef9c5c6, 0x83def7f0, 0xc83100d7,
+0xdff7da31, 0x940fd009, 0x0fd231c0, 0xd8f7c0b6,
+0x30244489, 0x8b00d283, 0xf7282444, 0x245489da,
+0x24548b34, 0x17f8c52c, 0x33282464, 0xc5282444,
+0x247c7efa, 0x24543330, 0x0fd0092c, 0xd231c094,
+0xf7c0b60f, 0x244489d8, 0x00d28330, 0x00055bb8,
+0x89daf700, 0xc5342454, 0x246416c0, 0x7efac530,
+0x8940247c, 0x89402474, 0xc544247c, 0x245c16c0,
+0x65e3c440, 0xc501dc18, 0x83d350fd, 0x850f0ffa,
+0x00000d72, 0xe270f9c5, 0x59e2c4b1, 0xe0249c40,
+0xc5000000, 0x24acf4e9, 0x000000e0, 0xcb78e98f,
+0x73e1c5db, 0xd1c520f3, 0xf9c5ebd4, 0xc4b1d970,
+0xb44061e2, 0x0000f024, 0x78e98f00, 0xc1c5f6cb,
+0xc520f673, 0x24b4f4f1, 0x000000f0, 0xf7d4c9c5,
+0x1855e3c4, 0xf9c501ee, 0xe3c4e87e, 0x01ea1679,
+0x6c7ffdc5, 0xf0836024, 0x6ff9c504, 0x10144035,
+0x7efac500, 0x0968246c, 0xefd1c5d0, 0x6cd1c5ee,
+0xc0940fed, 0xb60fd231, 0x89d8f7c0, 0x83402444,
+0xc03100d2, 0xe2c4daf7, 0x0fed1779, 0xfac5c094,
+0x70246c7e, 0xeeefd1c5, 0xed6cd1c5, 0x44245489,
+0xdb31c189, 0xf9c5d9f7, 0x1450356f, 0xd3830010,
+0xf7c03100, 0x79e2c4db, 0x940fed17, 0xf7d231c0,
+0x7efac5d8, 0x8978246c, 0x83302444, 0xc03100d2,
+0xd1c5daf7, 0xd1c5eeef, 0xe2c4ed6c, 0x89ed1779,
+0x0f342454, 0xd231c094, 0xfac5d8f7, 0x30247c7e,
+0x30244489, 0xb800d283, 0x000005c8, 0x5489daf7,
+0xc0c53424, 0x30247416, 0x7c7efac5, 0x4c894024,
+0x5c894024, 0xc0c54424, 0x40246c16, 0x1855e3c4,
+0xfdc501ee, 0xfa83d550, 0x37850f0f, 0xc400000c,
+0xa44059e2, 0x00010024, 0x61e2c400, 0x10249c40,
+0xc5000001, 0x2494f4e9, 0x00000100, 0x8cf4f1c5,
+0x00011024, 0x78e98f00, 0xd9c5e4cb, 0x8f20f473,
+0xdbcb78e9, 0xf373e1c5, 0xd4e9c520, 0xd4f1c5d4,
+0x6de3c4cb, 0xc501e118, 0x24a47ffd, 0x000000a0,
+0xbc6ff9c5, 0x0000a024, 0x73e1c500, 0xf9c503f7,
+0xb024bc6f, 0xc5000000, 0x03f773d1, 0x1865e3c4,
+0xf9c501dd, 0xe3c4d87e, 0x01da1679, 0x5c7ffdc5,
+0xf9c56024, 0xa024bc6f, 0xc5000000, 0x02f773e1,
+0xbc6ff9c5, 0x0000b024, 0x73d1c500, 0xe3c402f7,
+0x01dd1865, 0x9c7ffdc5, 0x00008024, 0x6ff9c500,
+0x008024bc, 0xc1c50000, 0xfac5dfd4, 0x6824747e,
+0xd97ef9c5, 0x1679e3c4, 0xc13101db, 0xc031d331,
+0x5c17f8c5, 0xd9094024, 0x5c6ef9c5, 0xe3c44024,
+0x245c2261, 0x940f0144, 0xc5d231c0, 0xf7deefe1,
+0x6ce1c5d8, 0x6ff9c5db, 0x009024bc, 0x44890000,
+0xd2833024, 0xf7c03100, 0x79e2c4da, 0x940fdb17,
+0xc5c189c0, 0xc5efd4c1, 0x24747efa, 0x7ef9c570,
+0x6ef9c5e8, 0x245489d8, 0xf7db3134, 0x79e3c4d9,
+0x8301ea16, 0xc03100d3, 0x2261e3c4, 0xdbf701da,
+0xdeefe1c5, 0xdb6ce1c5, 0x1779e2c4, 0xc0940fdb,
+0xd8f7d231, 0x6c17f8c5, 0xfac54024, 0x78246c7e,
+0x28244489, 0x3100d283, 0xc5daf7c0, 0x245c6ef9,
+0x61e3c440, 0x44245c22, 0xefe1c501, 0x6ce1c5dd,
+0x79e2c4db, 0x5489db17, 0x940f2c24, 0xf7d231c0,
+0x7efac5d8, 0x8928247c, 0x83402444, 0xedb800d2,
+0xf7000005, 0x245489da, 0x16c0c544, 0x8940246c,
+0xc540244c, 0x247c7efa, 0x245c8930, 0x16c0c544,
+0xc440245c, 0xdd1865e3, 0x50fdc501, 0x0ffa83d3,
+0x0a60850f, 0xf9c50000, 0x14202d6f, 0xe98f0010,
+0x245c9b50, 0x50e98f60, 0x70246c9b, 0x1865e3c4,
+0xfdc501dd, 0xa0249c7f, 0xc5000000, 0x24bc6ff9,
+0x000000a0, 0xf7d4c1c5, 0xbc6ff9c5, 0x0000b024,
+0x7ef9c500, 0x6ef9c5f0, 0xc5c031d8, 0xc4efd4c1,
+0xf21679e3, 0x7efac501, 0x008024bc, 0xe3c40000,
+0x01da2261, 0xdfefe1c5, 0xdb6ce1c5, 0x1779e2c4,
+0xc0940fdb, 0xd8f7d231, 0x7417f8c5, 0xfac54024,
+0x8824b47e, 0x89000000, 0x83302444, 0xc03100d2,
+0x5c6ef9c5, 0xdaf74024, 0x2261e3c4, 0x0144245c,
+0xdeefe1c5, 0xdb6ce1c5, 0x1779e2c4, 0x245489db,
+0xc0940f34, 0xc189db31, 0xe87ef9c5, 0xd86ef9c5,
+0xe3c4d9f7, 0x01ea1679, 0xb47efac5, 0x00009024,
+0x00d38300, 0xe3c4c031, 0x01da2261, 0xe1c5dbf7,
+0xe1c5deef, 0xe2c4db6c, 0x0fdb1779, 0xd231c094,
+0xf8c5d8f7, 0x40246c17, 0xac7efac5, 0x00009824,
+0x24448900, 0x00d28328, 0xdaf7c031, 0x5c6ef9c5,
+0xe3c44024, 0x245c2261, 0xe1c50144, 0xe1c5ddef,
+0xe2c4db6c, 0x89db1779, 0x0f2c2454, 0xd231c094,
+0xfac5d8f7, 0x28247c7e, 0x40244489, 0xb800d283,
+0x000005f2, 0x5489daf7, 0xc0c54424, 0x40246c16,
+0x40244c89, 0x7c7efac5, 0x5c893024, 0xc0c54424,
+0x40245c16, 0x1865e3c4, 0xfdc501dd, 0xfa83d350,
+0xef850f0f, 0xc7000008, 0x035c2444, 0xc5000000,
+0xc5dc6ff9, 0x24a47ffd, 0x000000a0, 0x5c245c8b,
+0xbc6ff9c5, 0x0000b024, 0xc5de8900, 0xc1e36ef9,
+0xe3c41ffe, 0x01e62259, 0xecf3e1c5, 0xe4f3c1c5,
+0x1855e3c4, 0xf9c501e4, 0xe3c4e07e, 0x01e21679,
+0x647ffdc5, 0x44c76024, 0x00025c24, 0x5c8b0000,
+0xde895c24, 0xe36ef9c5, 0xc41ffec1, 0xe62259e3,
+0xf3e1c501, 0xf3c1c5dc, 0x65e3c4e4, 0xc501dc18,
+0x249c7ffd, 0x00000080, 0xbc6ff9c5, 0x00008024,
+0xd4c1c500, 0x7efac5df, 0xc568246c, 0xc4d97ef9,
+0xdb1679e3, 0x31c13101, 0xc5c031d3, 0x245c17f8,
+0xc5d90940, 0x245c6ef9, 0x61e3c440, 0x44245c22,
+0xc0940f01, 0xe1c5d231, 0xd8f7ddef, 0xdb6ce1c5,
+0xbc6ff9c5, 0x00009024, 0x24448900, 0x00d28330,
+0xdaf7c031, 0x1779e2c4, 0xc0940fdb, 0xc1c5c189,
+0xfac5e7d4, 0x70246c7e, 0xe07ef9c5, 0xd86ef9c5,
+0x34245489, 0xd9f7db31, 0x1679e3c4, 0xd38301e2,
+0xc4c03100, 0xda2261e3, 0xc5dbf701, 0xc5ddefe1,
+0xc4db6ce1, 0xdb1779e2, 0x31c0940f, 0xc5d8f7d2,
+0x246417f8, 0x7efac540, 0x89782464, 0x83282444,
+0xc03100d2, 0xf9c5daf7, 0x40245c6e, 0x2261e3c4,
+0x0144245c, 0xdcefe1c5, 0xdb6ce1c5, 0x1779e2c4,
+0x245489db, 0xc0940f2c, 0xd8f7d231, 0x7c7efac5,
+0xfac52824, 0x3024747e, 0x40244489, 0xb800d283,
+0x00000605, 0x5489daf7, 0xc0c54424, 0x40246416,
+0x40244c89, 0x44245c89, 0x5c16c8c5, 0xe3c44024,
+0x01dc1865, 0xd350fdc5, 0x0f0ffa83, 0x00074585,
+0x24448b00, 0xefd9c55c, 0x244489e4, 0x1ff8c140,
+0x44244489, 0x5c12fbc5, 0xd9c54024, 0xe98fdbfb,
+0x24649b60, 0x60e98f60, 0x70245c9b, 0x185de3c4,
+0xfdc501db, 0xa0249c7f, 0xc5000000, 0x24b46ff9,
+0x000000a0, 0xeed4c9c5, 0xb47efac5, 0x00008024,
+0x7ef9c500, 0x6ef9c5e8, 0xc4c031d8, 0xea1679e3,
+0x61e3c401, 0xc501da22, 0xc5deefe1, 0xc4db6ce1,
+0xdb1779e2, 0x31c0940f, 0xc5d8f7d2, 0x246c17f8,
+0x24448940, 0x00d28330, 0xf9c5c031, 0x40245c6e,
+0xe3c4daf7, 0x245c2261, 0xfac50144, 0x8824ac7e,
+0xc5000000, 0xc5ddefe1, 0xc4db6ce1, 0xdb1779e2,
+0xbc6ff9c5, 0x0000b024, 0x24548900, 0xc0940f34,
+0xe7d4c1c5, 0xac7efac5, 0x00009024, 0x31c18900,
+0x7ef9c5db, 0xc5d9f7e0, 0xc4d86ef9, 0xe21679e3,
+0x00d38301, 0xe3c4c031, 0x01da2261, 0xe1c5dbf7,
+0xe1c5ddef, 0xe2c4db6c, 0x0fdb1779, 0xd231c094,
+0xf8c5d8f7, 0x40246417, 0xa47efac5, 0x00009824,
+0x24448900, 0x00d28328, 0xdaf7c031, 0x5c6ef9c5,
+0xe3c44024, 0x245c2261, 0xe1c50144, 0xe1c5dcef,
+0xe2c4db6c, 0x89db1779, 0x0f2c2454, 0xd231c094,
+0xfac5d8f7, 0x2824747e, 0x7c7efac5, 0x44893024,
+0xd2834024, 0x0609b800, 0xdaf70000, 0x44245489,
+0x6416c8c5, 0x4c894024, 0x5c894024, 0xc0c54424,
+0x40245c16, 0x1865e3c4, 0xfdc501dc, 0xfa83d350,
+0xbf850f0f, 0x31000005, 0xefe1c5c0, 0x24843bdb,
+0x00000120, 0x2424841b, 0x7d000001, 0x6ff9c504,
+0xc5c031da, 0x3be4efd9, 0x01282484, 0x841b0000,
+0x00012c24, 0xc5057d00, 0x08da73d9, 0xe9c5c031,
+0x843bd2ef, 0x00013024, 0x24841b00, 0x00000134,
+0xf9c5047d, 0xc031d16f, 0xedefd1c5, 0x3824843b,
+0x1b000001, 0x013c2484, 0x057d0000, 0xd973d1c5,
+0x6ce9c508, 0x6ce1c5cd, 0x6de3c4d4, 0xc501d118,
+0xc5ca6ff9, 0x24947ffd, 0x000000a0, 0x9be8e98f,
+0x01202494, 0xf9c50000, 0x3024b46f, 0x8f000001,
+0x9c9b48e9, 0x0000b024, 0x6de3c400, 0xc501d318,
+0xc4d07ef9, 0xd21679e3, 0x7ffdc501, 0xc5602454,
+0x301d6ff9, 0xc5001014, 0x24bc6ff9, 0x00000120,
+0xb46ff9c5, 0x00013024, 0xfbc1c500, 0xfbc9c5d3,
+0x6de3c4db, 0xc501d318, 0x24947ffd, 0x00000120,
+0x9bf0e98f, 0x0120248c, 0xf9c50000, 0x3024bc6f,
+0x8f000001, 0x949b40e9, 0x0000b024, 0x75e3c400,
+0xc501da18, 0xc5c9d4f1, 0x249c7ffd, 0x00000080,
+0xc97ef9c5, 0x1679e3c4, 0xc13101cb, 0xc031d331,
+0x4c17f8c5, 0xd9094024, 0x4c6ef9c5, 0xfac54024,
+0x68245c7e, 0x31c0940f, 0x71e3c4d2, 0x44244c22,
+0xc5d8f701, 0xc5cbeff1, 0x89c96cf1, 0x83302444,
+0xc03100d2, 0xe2c4daf7, 0x0fc91779, 0xc189c094,
+0xd2d4e9c5, 0x5c7efac5, 0xf9c57024, 0xf9c5d07e,
+0x5489c86e, 0xdb313424, 0xe3c4d9f7, 0x01d21679,
+0x3100d383, 0x71e3c4c0, 0xf701ca22, 0xeff1c5db,
+0x6cf1c5cb, 0x79e2c4c9, 0x940fc917, 0xf7d231c0,
+0x17f8c5d8, 0xc5402454, 0x24547efa, 0x24448978,
+0x00d28328, 0xdaf7c031, 0x4c6ef9c5, 0xe3c44024,
+0x244c2271, 0xf1c50144, 0xf1c5caef, 0xe2c4c96c,
+0x89c91779, 0x0f2c2454, 0xd231c094, 0xfac5d8f7,
+0x2824747e, 0x7c7efac5, 0x44893024, 0xd2834024,
+0x0621b800, 0xdaf70000, 0x44245489, 0x5416c8c5,
+0x4c894024, 0x5c894024, 0xc0c54424, 0x40244c16,
+0x1875e3c4, 0xfdc501ca, 0xfa83d150, 0x93850f0f,
+0xc5000003, 0xc5c9eff1, 0x2494fbf1, 0x00000120,
+0xa47efac5, 0x0000a024, 0xfbf1c500, 0x0130248c,
+0xe98f0000, 0x249c9b68, 0x00000080, 0x9b70e98f,
+0x00902494, 0xf9c50000, 0xf9c5d87e, 0xc031c86e,
+0x1679e3c4, 0xe3c401da, 0x01ca2271, 0xcceff1c5,
+0xc96cf1c5, 0x1779e2c4, 0xc0940fc9, 0xd8f7d231,
+0x5c17f8c5, 0x44894024, 0xd2833024, 0xc5c03100,
+0x244c6ef9, 0xc4daf740, 0x4c2271e3, 0xc5014424,
+0x249c7efa, 0x000000a8, 0xcbeff1c5, 0xc96cf1c5,
+0x1779e2c4, 0x245489c9, 0xc0940f34, 0xdb31c189,
+0xd07ef9c5, 0xf9c5d9f7, 0xe3c4c86e, 0x01d21679,
+0x3100d383, 0x71e3c4c0, 0xf701ca22, 0x7efac5db,
+0x00b0249c, 0xf1c50000, 0xf1c5cbef, 0xe2c4c96c,
+0x0fc91779, 0xd231c094, 0xf8c5d8f7, 0x40245417,
+0x28244489, 0x3100d283, 0xc5daf7c0, 0x244c6ef9,
+0x7efac540, 0x00b82494, 0xe3c40000, 0x244c2271,
+0xf1c50144, 0xf1c5caef, 0xe2c4c96c, 0x89c91779,
+0x0f2c2454, 0xd231c094, 0xfac5d8f7, 0x2824747e,
+0x40244489, 0xc500d283, 0x247c7efa, 0xb8daf730,
+0x00000626, 0x44245489, 0x5416c8c5, 0x4c894024,
+0x5c894024, 0xc0c54424, 0x40244c16, 0x1875e3c4,
+0xfdc501ca, 0xfa83d150, 0x37850f0f, 0x8b000002,
+0x01042484, 0xfdc50000, 0xc024b46f, 0xc5000000,
+0x24b47ffd, 0x00000080, 0xc024b48b, 0x8b000000,
+0x00c424bc, 0xf8c10000, 0x24843b1f, 0x00000100,
+0x9c1bc389, 0x00010424, 0xc1d23100, 0xd8891feb,
+0x0c249c8b, 0xf7000001, 0x244489d8, 0x00d28340,
+0x5489daf7, 0xfbc14424, 0x249c3b1f, 0x00000108,
+0xfac5da89, 0x4024747e, 0x0c24941b, 0x31000001,
+0xc1d089db, 0xc1891fe8, 0x1424848b, 0xf7000001,
+0x244c89d9, 0x00d38330, 0x5c89dbf7, 0xf8c13424,
+0x24843b1f, 0x00000110, 0xc8c5c389, 0x30244c16,
+0x14249c1b, 0x31000001, 0x1febc1d2, 0x9c8bd889,
+0x00011c24, 0x89d8f700, 0x83282444, 0xdaf700d2,
+0x2c245489, 0x3b1ffbc1, 0x0118249c, 0xda890000,
+0x7c7efac5, 0x941b2824, 0x00011c24, 0x89db3100,
+0x1fe8c1d0, 0xd9f7c189, 0x28244c89, 0xf700d383,
+0x245c89db, 0x16c0c52c, 0xc5282454, 0x24bc6ffd,
+0x000000c0, 0x1875e3c4, 0xe88f01ca, 0x248ca244,
+0x000000e0, 0x7ef9c510, 0x79e3c4c8, 0x3101ca16,
+0x09fa31f0, 0xc0940fd0, 0xb60fd231, 0x89d8f7c0,
+0x83302444, 0xc03100d2, 0x5489daf7, 0xf8c53424,
+0x40244c17, 0x546ef9c5, 0xfac54024, 0xe8249c7e,
+0xc4000000, 0x542269e3, 0xc5014424, 0xc5d3efe9,
+0xc4d26ce9, 0xd21779e2, 0x89c0940f, 0xc4db31c1,
+0xc9197de3, 0xc5d9f701, 0xc5c87ef9, 0x83d06ef9,
+0xc03100d3, 0x1679e3c4, 0xdbf701ca, 0x2269e3c4,
+0xfac501d2, 0x90249c7e, 0xc5000000, 0xc5d3efe9,
+0xc4d26ce9, 0xd21779e2, 0x31c0940f, 0x17f8c5d2,
+0xf740244c, 0x6ef9c5d8, 0xc540244c, 0x24947efa,
+0x000000f8, 0x28244489, 0x3100d283, 0xc4daf7c0,
+0x4c2271e3, 0xc5014424, 0xc5caeff1, 0xc4c96cf1,
+0xc91779e2, 0x2c245489, 0x31c0940f, 0x7efac5d2,
+0xf7282464, 0x7efac5d8, 0x89302474, 0x83402444,
+0xdaf700d2, 0x44245489, 0x000000ba, 0x16d8c500,
+0x89402454, 0x8940244c, 0xc544245c, 0x244c16c8,
+0x75e3c440, 0xc501ca18, 0x83c150fd, 0x2ab80ff8,
+0x0f000007, 0x658dc244, 0x5f5e5bf4, 0x0000c35d,
+0xfffffffe, 0xffffffff, 0xfffffffe, 0xffffffff,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0x00000006, 0x00000000, 0x00000000, 0x00000000,
+0x00000004, 0x00000000, 0x00000000, 0x00000000,
+0012140,
+};
+asm(".type xop_x86_32_D_32i8, STT_NOTYPE;");
+asm(".type xop_x86_32_D_32i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_32u8[] = {
+0xba5500eb, 0x00000040, 0x3157e589, 0x01be56ff,
+0x53000000, 0x81e0e483, 0x000120ec, 0xff5e8d00,
+0x000005b9, 0x245c8900, 0x29db3128, 0x244c89f1,
+0x244c8b20, 0x89fb1928, 0x8924245c, 0x01e183f0,
+0xc1cb8949, 0x74851ffb, 0x01752824, 0xc4b4894a,
+0x00000098, 0x7c7efac5, 0xf9c52024, 0xb8c4bcd6,
+0x89000000, 0x00d8c48c, 0xc9310000, 0x8901c683,
+0x009cc4bc, 0xd7830000, 0xc49c8900, 0x000000dc,
+0xf8c49489, 0x89000000, 0x00fcc48c, 0xf0890000,
+0x0905f083, 0xc58675f8, 0x24bc6ffd, 0x000000a0,
+0x7c7ffdc5, 0xc0314024, 0x647efac5, 0xfac54024,
+0xa0248c7e, 0xc5000000, 0xc5c9efd9, 0xc4c96cf1,
+0xc91779e2, 0x31c0940f, 0x7efac5d2, 0xf7482454,
+0x7efac5d8, 0x00a8248c, 0xf1c50000, 0x4489caef,
+0xd2832824, 0xf7c03100, 0x6cf1c5da, 0x79e2c4c9,
+0xfac5c917, 0x50245c7e, 0x8c7efac5, 0x0000b024,
+0xefe1c500, 0x6cf1c5c9, 0x245489c9, 0xc0940f2c,
+0xdb31c189, 0x547efac5, 0xd9f75824, 0x747efac5,
+0x4c892824, 0xd3832824, 0xf7c03100, 0x79e2c4db,
+0x940fc917, 0x7efac5c0, 0x00b8248c, 0xe9c50000,
+0xf1c5c9ef, 0x5c89c96c, 0xd2312c24, 0x4489d8f7,
+0xd2832024, 0xf7c03100, 0x79e2c4da, 0x940fc917,
+0x245489c0, 0xf7d23124, 0x00d283d8, 0x7c7efac5,
+0xc8c52024, 0x28244c16, 0x20244489, 0x39b8daf7,
+0x89000005, 0xc5242454, 0x246c16c0, 0x75e3c420,
+0xc501cd18, 0x83d150fd, 0x850f0ffa, 0x00001013,
+0x7c6ff9c5, 0xf9c54024, 0x5024746f, 0x8cd4c1c5,
+0x0000a024, 0xd4c9c500, 0x00b024ac, 0xe3c40000,
+0x01cd1875, 0x4c7ffdc5, 0xf9c56024, 0xa024bc6f,
+0xc5000000, 0x01f773c9, 0xbc6ff9c5, 0x0000b024,
+0x7ef9c500, 0x6ef9c5f0, 0xc5c031c8, 0x01f773d1,
+0x1679e3c4, 0xfac501f2, 0x60247c7e, 0x2271e3c4,
+0xf1c501ca, 0xf1c5cfef, 0xe2c4c96c, 0x0fc91779,
+0xd231c094, 0xf8c5d8f7, 0x28247417, 0x747efac5,
+0x44896824, 0xd2832024, 0xc5c03100, 0x244c6ef9,
+0xc4daf728, 0x4c2271e3, 0xc5012c24, 0xc5ceeff1,
+0xc4c96cf1, 0xc91779e2, 0x24245489, 0x31c0940f,
+0xc5c189db, 0xc5e87ef9, 0xf7c86ef9, 0x79e3c4d9,
+0xc501ea16, 0x24747efa, 0x00d38370, 0xe3c4c031,
+0x01ca2271, 0xf1c5dbf7, 0xf1c5ceef, 0xe2c4c96c,
+0x0fc91779, 0xd231c094, 0xf8c5d8f7, 0x28246c17,
+0x6c7efac5, 0x44897824, 0xd2831824, 0xf7c03100,
+0x6ef9c5da, 0xc428244c, 0x4c2271e3, 0xc5012c24,
+0xc5cdeff1, 0xc4c96cf1, 0xc91779e2, 0x1c245489,
+0x31c0940f, 0xc5d8f7d2, 0x24747efa, 0x24448918,
+0x00d28328, 0x00053fb8, 0x89daf700, 0xc52c2454,
+0x246c16c8, 0x244c8928, 0x7efac528, 0x89202474,
+0xc52c245c, 0x244c16c8, 0x75e3c428, 0xc501cd18,
+0x83d150fd, 0x850f0ffa, 0x00000ea7, 0x7c6ff9c5,
+0xf9c56024, 0x7024746f, 0x8cfbc1c5, 0x0000a024,
+0xfbc9c500, 0x00b024ac, 0xe3c40000, 0x01cd1875,
+0x8c7ffdc5, 0x00008024, 0xc5c03100, 0x24ac7efa,
+0x00000080, 0xe5efd9c5, 0xe46cd9c5, 0x1779e2c4,
+0xc0940fe4, 0xd8f7d231, 0x647efac5, 0x44894824,
+0xd2832824, 0xf7c03100, 0x7efac5da, 0x008824ac,
+0xd9c50000, 0xd9c5e5ef, 0xe2c4e46c, 0xc5e41779,
+0x24a47efa, 0x00000090, 0xdcefe1c5, 0xdb6ce1c5,
+0x2c245489, 0x31c0940f, 0x7efac5db, 0x89282474,
+0x89d9f7c1, 0x8328244c, 0xc03100d3, 0xe2c4dbf7,
+0x0fdb1779, 0xfac5c094, 0x98249c7e, 0xc5000000,
+0xc5d3efe9, 0x89d26ce9, 0x312c245c, 0x89d8f7d2,
+0x83202444, 0xc03100d2, 0xe2c4daf7, 0x0fd21779,
+0x5489c094, 0xd2312424, 0xd283d8f7, 0x7efac500,
+0xc520247c, 0x245416c8, 0x24448928, 0xb8daf720,
+0x00000544, 0x24245489, 0x5c16c0c5, 0xe3c42024,
+0x01d3186d, 0xd250fdc5, 0x0f0ffa83, 0x000d9285,
+0x6ffdc500, 0xc540247c, 0x249456c4, 0x000000c0,
+0x547ffdc5, 0xf4c54024, 0xc0248c54, 0xc5000000,
+0x24b46ffd, 0x00000080, 0x9457ccc5, 0x0000c024,
+0x7ef9c500, 0x79e3c4d0, 0xc501d216, 0x24947ffd,
+0x00000080, 0x4c55f4c5, 0xf9c54024, 0xe3c4c97e,
+0x01cb1679, 0xd331c131, 0x4c17f8c5, 0xc0312824,
+0xf9c5d909, 0x2824546e, 0x31c0940f, 0x69e3c4d2,
+0x2c245422, 0xc5d8f701, 0x249c7efa, 0x00000088,
+0xd3efe9c5, 0x20244489, 0x3100d283, 0xc5daf7c0,
+0xc4d26ce9, 0xd21779e2, 0x197de3c4, 0x548901c9,
+0x940f2424, 0x31c189c0, 0x7ef9c5db, 0xc5d9f7c8,
+0xc4d06ef9, 0xca1679e3, 0x00d38301, 0xe3c4c031,
+0x01d22269, 0xfac5dbf7, 0x90249c7e, 0xc5000000,
+0xc5d3efe9, 0xc4d26ce9, 0xd21779e2, 0x31c0940f,
+0xc5d8f7d2, 0x244c17f8, 0x24448928, 0x00d28318,
+0xdaf7c031, 0x4c6ef9c5, 0xfac52824, 0x9824947e,
+0xc4000000, 0x4c2271e3, 0xc5012c24, 0xc5caeff1,
+0xc4c96cf1, 0xc91779e2, 0x1c245489, 0x31c0940f,
+0xc5d8f7d2, 0x247c7efa, 0x24448918, 0x00d28328,
+0x747efac5, 0xdaf72024, 0x000550b8, 0x24548900,
+0x16c0c52c, 0x89282454, 0x8928244c, 0xc52c245c,
+0x244c16c8, 0x75e3c428, 0xc501ca18, 0x83d150fd,
+0x850f0ffa, 0x00000c2b, 0x8c70f9c5, 0x0000a024,
+0xe2c4b100, 0x248c4071, 0x000000c0, 0xbc6ff9c5,
+0x0000a024, 0x6ff9c500, 0x00b024ac, 0xd1c50000,
+0xd0249cf4, 0x8f000000, 0xc9cb78e9, 0xf173e9c5,
+0xf4c1c520, 0x00c0248c, 0xf1c50000, 0xf9c5cad4,
+0xb0249470, 0xb1000000, 0x4069e2c4, 0x00d02494,
+0xe98f0000, 0xc5d2cb78, 0x20f273e9, 0xd2d4e1c5,
+0x1875e3c4, 0xf9c501ca, 0xe3c4c87e, 0x01ca1679,
+0x4c7ffdc5, 0xf0834024, 0x6ff9c504, 0x1011c015,
+0x7efac500, 0x0948244c, 0xeff1c5d0, 0x6cf1c5ca,
+0xc0940fc9, 0xb60fd231, 0x89d8f7c0, 0x83282444,
+0xc03100d2, 0xe2c4daf7, 0x0fc91779, 0xfac5c094,
+0x50244c7e, 0xcaeff1c5, 0xc96cf1c5, 0x2c245489,
+0xdb31c189, 0xf9c5d9f7, 0x11d0156f, 0xfac50010,
+0x28247c7e, 0x28244c89, 0x3100d383, 0xc4dbf7c0,
+0xc91779e2, 0xc5c0940f, 0x244c7efa, 0xeff1c558,
+0x6cf1c5ca, 0x245c89c9, 0xf7d2312c, 0x244489d8,
+0x00d28320, 0xdaf7c031, 0x1779e2c4, 0xc0940fc9,
+0x24245489, 0xd8f7d231, 0xc500d283, 0x24747efa,
+0x16c0c520, 0x8928244c, 0xf7202444, 0x05c8b8da,
+0x54890000, 0xc8c52424, 0x20245416, 0x1875e3c4,
+0xfdc501ca, 0xfa83d150, 0xd4850f0f, 0xc500000a,
+0x248c6ffd, 0x000000a0, 0x8c7ffdc5, 0x00008024,
+0x6ff9c500, 0x008024ac, 0xf9c50000, 0x9024b46f,
+0xc5000000, 0x03f573e9, 0xf673e1c5, 0x6de3c403,
+0xc501d318, 0xc4d07ef9, 0xd21679e3, 0x7ffdc501,
+0xc5402454, 0x24bc6ff9, 0x00000080, 0xac6ff9c5,
+0x00009024, 0x73e9c500, 0xe1c502f7, 0xc402f573,
+0xd3186de3, 0x7ffdc501, 0xc5602454, 0x24746ff9,
+0xd4c9c560, 0x7efac5d6, 0xc5482464, 0xc4d17ef9,
+0xd31679e3, 0x31c13101, 0xc5c031d3, 0x245417f8,
+0xc5d90928, 0x24546ef9, 0x69e3c428, 0x2c245422,
+0xc0940f01, 0xe9c5d231, 0xd8f7d4ef, 0xd26ce9c5,
+0x7c6ff9c5, 0x44897024, 0xd2832024, 0xf7c03100,
+0x79e2c4da, 0x940fd217, 0xc5c189c0, 0xc5dfd4c1,
+0x24647efa, 0x7ef9c550, 0x6ef9c5d8, 0x245489d0,
+0xf7db3124, 0x79e3c4d9, 0x8301da16, 0xc03100d3,
+0x2269e3c4, 0xdbf701d2, 0xd4efe9c5, 0xd26ce9c5,
+0x1779e2c4, 0xc0940fd2, 0xd8f7d231, 0x5c17f8c5,
+0xfac52824, 0x58245c7e, 0x18244489, 0x3100d283,
+0xc5daf7c0, 0x24546ef9, 0x69e3c428, 0x2c245422,
+0xefe9c501, 0x6ce9c5d3, 0x79e2c4d2, 0x5489d217,
+0x940f1c24, 0xf7d231c0, 0x7efac5d8, 0xc518246c,
+0x24747efa, 0x24448920, 0x00d28328, 0x0005edb8,
+0x89daf700, 0xc52c2454, 0x245c16d0, 0x244c8928,
+0x245c8928, 0x16c8c52c, 0xc4282454, 0xd3186de3,
+0x50fdc501, 0x0ffa83d2, 0x0945850f, 0xf9c50000,
+0x40247c6f, 0x6c6ff9c5, 0xe9c55024, 0xc502d773,
+0x02d573e1, 0x186de3c4, 0xfdc501d3, 0x8024947f,
+0xc5000000, 0x24b46ff9, 0x00000080, 0xe6d4c9c5,
+0x6c7efac5, 0xf9c56024, 0xf9c5e07e, 0xc031d06e,
+0x1679e3c4, 0xe3c401e2, 0x01d22269, 0xd5efe9c5,
+0xd26ce9c5, 0x1779e2c4, 0xc0940fd2, 0xd8f7d231,
+0x6417f8c5, 0x44892824, 0xd2832024, 0xc5c03100,
+0x24546ef9, 0xc4daf728, 0x542269e3, 0xc5012c24,
+0x24647efa, 0xefe9c568, 0x6ce9c5d4, 0x79e2c4d2,
+0xf9c5d217, 0x9024bc6f, 0x89000000, 0x0f242454,
+0xc1c5c094, 0xfac5dfd4, 0x7024647e, 0xdb31c189,
+0xd87ef9c5, 0xf9c5d9f7, 0xe3c4d06e, 0x01da1679,
+0x3100d383, 0x69e3c4c0, 0xf701d222, 0xefe9c5db,
+0x6ce9c5d4, 0x79e2c4d2, 0x940fd217, 0xf7d231c0,
+0x17f8c5d8, 0xc528245c, 0x245c7efa, 0x24448978,
+0x00d28318, 0xdaf7c031, 0x546ef9c5, 0xe3c42824,
+0x24542269, 0xe9c5012c, 0xe9c5d3ef, 0xe2c4d26c,
+0x89d21779, 0x0f1c2454, 0xd231c094, 0xfac5d8f7,
+0x18246c7e, 0x747efac5, 0x44892024, 0xd2832824,
+0x05f2b800, 0xdaf70000, 0x2c245489, 0x5c16d0c5,
+0x4c892824, 0x5c892824, 0xc8c52c24, 0x28245416,
+0x186de3c4, 0xfdc501d3, 0xfa83d250, 0xe0850f0f,
+0xc7000007, 0x033c2444, 0xc5000000, 0x248c7ffd,
+0x00000080, 0x646ef9c5, 0xf9c53c24, 0x9024bc6f,
+0xc5000000, 0xc5dcf3f1, 0xc4e4f3c1, 0xdc1865e3,
+0x7ef9c501, 0x79e3c4d8, 0xc501da16, 0x245c7ffd,
+0x2444c740, 0x0000023c, 0x6ef9c500, 0xc53c245c,
+0xc5d3f3f1, 0xc4dbf3c1, 0xd3186de3, 0x7ffdc501,
+0xc5602454, 0x24746ff9, 0xd4c9c560, 0x7efac5d6,
+0xc5482464, 0xc4d17ef9, 0xd31679e3, 0x31c13101,
+0xc5c031d3, 0x245417f8, 0xc5d90928, 0x24546ef9,
+0x69e3c428, 0x2c245422, 0xc0940f01, 0xe9c5d231,
+0xd8f7d4ef, 0xd26ce9c5, 0x7c6ff9c5, 0x44897024,
+0xd2832024, 0xf7c03100, 0x79e2c4da, 0x940fd217,
+0xc5c189c0, 0xc5dfd4c1, 0x24647efa, 0x7ef9c550,
+0x6ef9c5d8, 0x245489d0, 0xf7db3124, 0x79e3c4d9,
+0x8301da16, 0xc03100d3, 0x2269e3c4, 0xdbf701d2,
+0xd4efe9c5, 0xd26ce9c5, 0x1779e2c4, 0xc0940fd2,
+0xd8f7d231, 0x5c17f8c5, 0xfac52824, 0x58245c7e,
+0x18244489, 0x3100d283, 0xc5daf7c0, 0x24546ef9,
+0x69e3c428, 0x2c245422, 0xefe9c501, 0x6ce9c5d3,
+0x79e2c4d2, 0x5489d217, 0x940f1c24, 0xf7d231c0,
+0x7efac5d8, 0xc518246c, 0x24747efa, 0x24448920,
+0x00d28328, 0x000605b8, 0x89daf700, 0xc52c2454,
+0x245c16d0, 0x244c8928, 0x245c8928, 0x16c8c52c,
+0xc4282454, 0xd3186de3, 0x50fdc501, 0x0ffa83d2,
+0x065d850f, 0xf9c50000, 0x3c245c6e, 0x7c6ff9c5,
+0xf9c54024, 0x50246c6f, 0xd3d3c1c5, 0xdbd3d1c5,
+0x186de3c4, 0xfdc501d3, 0x8024947f, 0xc5000000,
+0x24b46ff9, 0x00000080, 0xe6d4c9c5, 0x6c7efac5,
+0xf9c56024, 0xf9c5e07e, 0xc031d06e, 0x1679e3c4,
+0xe3c401e2, 0x01d22269, 0xd5efe9c5, 0xd26ce9c5,
+0x1779e2c4, 0xc0940fd2, 0xd8f7d231, 0x6417f8c5,
+0x44892824, 0xd2832024, 0xc5c03100, 0x24546ef9,
+0xc4daf728, 0x542269e3, 0xc5012c24, 0x24647efa,
+0xefe9c568, 0x6ce9c5d4, 0x79e2c4d2, 0xf9c5d217,
+0x9024bc6f, 0x89000000, 0x0f242454, 0xc1c5c094,
+0xfac5dfd4, 0x7024647e, 0xdb31c189, 0xd87ef9c5,
+0xf9c5d9f7, 0xe3c4d06e, 0x01da1679, 0x3100d383,
+0x69e3c4c0, 0xf701d222, 0xefe9c5db, 0x6ce9c5d4,
+0x79e2c4d2, 0x940fd217, 0xf7d231c0, 0x17f8c5d8,
+0xc528245c, 0x245c7efa, 0x24448978, 0x00d28318,
+0xdaf7c031, 0x546ef9c5, 0xe3c42824, 0x24542269,
+0xe9c5012c, 0xe9c5d3ef, 0xe2c4d26c, 0x89d21779,
+0x0f1c2454, 0xd231c094, 0xfac5d8f7, 0x18246c7e,
+0x747efac5, 0x44892024, 0xd2832824, 0x0609b800,
+0xdaf70000, 0x2c245489, 0x5c16d0c5, 0x4c892824,
+0x5c892824, 0xc8c52c24, 0x28245416, 0x186de3c4,
+0xfdc501d3, 0xfa83d250, 0xf4850f0f, 0x8b000004,
+0x01002484, 0x840b0000, 0x00010424, 0xc0950f00,
+0xb60fd231, 0x89d8f7c0, 0x83282444, 0x848b00d2,
+0x00010824, 0x0bdaf700, 0x010c2484, 0x54890000,
+0xfac52c24, 0x28246c7e, 0x31c0950f, 0xc0b60fdb,
+0x848bc189, 0x00011024, 0x89d9f700, 0x8328244c,
+0xdbf700d3, 0x1424840b, 0x89000001, 0xc52c245c,
+0x245c16d0, 0xc0950f28, 0xb60fd231, 0x89d8f7c0,
+0x83202444, 0x848b00d2, 0x00011824, 0x0bdaf700,
+0x011c2484, 0x54890000, 0xfac52424, 0x20247c7e,
+0x31c0950f, 0xc0b60fd2, 0x4489d8f7, 0xd2832024,
+0x89daf700, 0xc5242454, 0x245416c0, 0x65e3c420,
+0xc501da18, 0xc5d954e4, 0xc5d36ff9, 0x249c7ffd,
+0x00000080, 0x9be0e98f, 0x0100249c, 0xf9c50000,
+0x1024b46f, 0x8f000001, 0xa49b48e9, 0x00009024,
+0x65e3c400, 0xc501dc18, 0xc4d87ef9, 0xda1679e3,
+0x7ffdc501, 0xc540245c, 0xc5db76e1, 0x24a4d4e1,
+0x00000100, 0x9cd4e1c5, 0x00011024, 0x5de3c400,
+0xc501db18, 0x249c7ffd, 0x00000100, 0x9be8e98f,
+0x01002494, 0xf9c50000, 0x1024bc6f, 0x8f000001,
+0x9c9b40e9, 0x00009024, 0x6de3c400, 0xc501e318,
+0xc5d2d4e9, 0x24647ffd, 0x7ef9c560, 0x79e3c4d1,
+0x3101d316, 0x31d331c1, 0x17f8c5c0, 0x09282454,
+0x6ef9c5d9, 0xc5282454, 0x24647efa, 0xc0940f48,
+0xe3c4d231, 0x24542269, 0xd8f7012c, 0xd4efe9c5,
+0xd26ce9c5, 0x20244489, 0x3100d283, 0xc4daf7c0,
+0xd21779e2, 0x89c0940f, 0xd4e1c5c1, 0x7efac5db,
+0xc5502464, 0xc5d87ef9, 0x89d06ef9, 0x31242454,
+0xc4d9f7db, 0xda1679e3, 0x00d38301, 0xe3c4c031,
+0x01d22269, 0xe9c5dbf7, 0xe9c5d4ef, 0xe2c4d26c,
+0x0fd21779, 0xd231c094, 0xf8c5d8f7, 0x28245c17,
+0x5c7efac5, 0x44895824, 0xd2831824, 0xf7c03100,
+0x6ef9c5da, 0xc4282454, 0x542269e3, 0xc5012c24,
+0xc5d3efe9, 0xc4d26ce9, 0xd21779e2, 0x1c245489,
+0x31c0940f, 0xc5d8f7d2, 0x246c7efa, 0x7efac518,
+0x89202474, 0x83282444, 0x21b800d2, 0xf7000006,
+0x245489da, 0x16d0c52c, 0x8928245c, 0x8928244c,
+0xc52c245c, 0x245416c8, 0x6de3c428, 0xc501d318,
+0x83d250fd, 0x850f0ffa, 0x00000297, 0xd2efe9c5,
+0x9cfbe9c5, 0x00010024, 0x7efac500, 0x008024ac,
+0xe9c50000, 0x102494fb, 0x8f000001, 0x649760e9,
+0xe98f6024, 0x245c9768, 0x7ef9c570, 0x6ef9c5e0,
+0xc4c031d0, 0xe21679e3, 0x69e3c401, 0xc501d222,
+0xc5d5efe9, 0xc4d26ce9, 0xd21779e2, 0x31c0940f,
+0xc5d8f7d2, 0x246417f8, 0x24448928, 0x00d28320,
+0xf9c5c031, 0x2824546e, 0xe3c4daf7, 0x24542269,
+0xfac5012c, 0x8824a47e, 0xc5000000, 0xc5d4efe9,
+0xc4d26ce9, 0xd21779e2, 0x24245489, 0x89c0940f,
+0xc5db31c1, 0xf7d87ef9, 0x6ef9c5d9, 0x79e3c4d0,
+0x8301da16, 0xc03100d3, 0x2269e3c4, 0xdbf701d2,
+0xa47efac5, 0x00009024, 0xefe9c500, 0x6ce9c5d4,
+0x79e2c4d2, 0x940fd217, 0xf7d231c0, 0x17f8c5d8,
+0x8928245c, 0x83182444, 0xc03100d2, 0xf9c5daf7,
+0x2824546e, 0x9c7efac5, 0x00009824, 0x69e3c400,
+0x2c245422, 0xefe9c501, 0x6ce9c5d3, 0x79e2c4d2,
+0x5489d217, 0x940f1c24, 0xf7d231c0, 0x7efac5d8,
+0x8918247c, 0x83282444, 0xfac500d2, 0x20246c7e,
+0x26b8daf7, 0x89000006, 0xc52c2454, 0x245c16c0,
+0x244c8928, 0x245c8928, 0x16d0c52c, 0xc4282454,
+0xd3186de3, 0x50fdc501, 0x0ffa83d2, 0x0141850f,
+0xf9c50000, 0xe3c4c87e, 0x01ca1679, 0x4c7ffdc5,
+0xfdc56024, 0xe024b46f, 0x8f000000, 0x8ca274e8,
+0x0000c024, 0xf9c56000, 0xe3c4c97e, 0x01cb1679,
+0xd331c131, 0xd909c031, 0x4c17f8c5, 0x940f2824,
+0xc5d231c0, 0x24546ef9, 0xc4d8f728, 0x542269e3,
+0xc5012c24, 0x249c7efa, 0x000000c8, 0x20244489,
+0x3100d283, 0xc5daf7c0, 0xc5d3efe9, 0xc4d26ce9,
+0xd21779e2, 0x197de3c4, 0x548901c9, 0x940f2424,
+0xc4db31c0, 0xca1679e3, 0xc5c18901, 0xc5c87ef9,
+0xf7d06ef9, 0x69e3c4d9, 0xc501d222, 0x245c7efa,
+0x00d38370, 0xe9c5c031, 0xdbf7d3ef, 0xd26ce9c5,
+0x1779e2c4, 0xc0940fd2, 0xf8c5d231, 0x28244c17,
+0xf9c5d8f7, 0x28244c6e, 0x947efac5, 0x0000d824,
+0x24448900, 0x00d28318, 0xdaf7c031, 0x2271e3c4,
+0x012c244c, 0xcaeff1c5, 0xc96cf1c5, 0x1779e2c4,
+0x245489c9, 0xc0940f1c, 0xfac5d231, 0x18247c7e,
+0xfac5d8f7, 0x20246c7e, 0x28244489, 0xf700d283,
+0x245489da, 0x0000ba2c, 0xc0c50000, 0x28245416,
+0x28244c89, 0x2c245c89, 0x4c16d0c5, 0xe3c42824,
+0x01ca1875, 0xc150fdc5, 0xb80ff883, 0x0000072a,
+0x8dc2440f, 0x5e5bf465, 0x00c35d5f, 0x00000000,
+0x00000006, 0x00000000, 0x00000000, 0x00000000,
+0x00000004, 0x00000000, 0x00000000, 0x00000000,
+0010740,
+};
+asm(".type xop_x86_32_D_32u8, STT_NOTYPE;");
+asm(".type xop_x86_32_D_32u8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_32f4[] = {
+0x315500eb, 0x53e589c0, 0x000009bb, 0xe0e48300,
+0x00e0ec81, 0xc2890000, 0x24448940, 0xdbd9890c,
+0x290c2444, 0x01c2f6c1, 0x0c244c89, 0x7c845cd9,
+0x0c2444db, 0x9c849cd9, 0xd9000000, 0xd9e0d9e8,
+0xddc9dbe8, 0x08f883d9, 0xbc849cd9, 0x75000000,
+0x28fcc5c5, 0x008024bc, 0xfcc50000, 0x20247c29,
+0x4c28fcc5, 0xf4c52024, 0xc500d7c2, 0x81d250fc,
+0x0000fffa, 0x0539b800, 0x850f0000, 0x0000071e,
+0x9458f4c5, 0x00008024, 0x29fcc500, 0xc5402454,
+0x24bc28fc, 0x00000080, 0xd758c4c5, 0x54c2ecc5,
+0xc5004024, 0x81d250fc, 0x0000fffa, 0x053fb800,
+0x850f0000, 0x000006e6, 0x7c28fcc5, 0xc4c54024,
+0x8024945c, 0xc5000000, 0x245429fc, 0xc2f4c560,
+0x00602454, 0xd250fcc5, 0x00fffa81, 0x44b80000,
+0x0f000005, 0x0006b585, 0x28fcc500, 0x00a024b4,
+0xf4c50000, 0x80248c59, 0xc5000000, 0xc5de59cc,
+0x249428fc, 0x00000080, 0xee58ecc5, 0xa45cecc5,
+0x0000a024, 0x5cf4c500, 0x59dcc5cb, 0xc2f4c5e5,
+0xfcc500cc, 0xfa81d150, 0x000000ff, 0x00055bb8,
+0x67850f00, 0xc5000006, 0x248c59ec, 0x000000c0,
+0x4c29fcc5, 0xecc52024, 0xc024945e, 0xc5000000,
+0x00cac2f4, 0xd150fcc5, 0x00fffa81, 0x64b80000,
+0x0f000005, 0x00063585, 0x7de2c400, 0x07c41518,
+0xfcc50010, 0xc024ac28, 0xc5000000, 0xc5ca57d4,
+0x249457ec, 0x00000080, 0x4c59f4c5, 0xf4c52024,
+0xc500cac2, 0x81d150fc, 0x0000fffa, 0x0567b800,
+0x850f0000, 0x000005f6, 0x8c5bfdc5, 0x00008024,
+0x5bfcc500, 0xc2f4c5c9, 0x0080248c, 0xc5000000,
+0x81d150fc, 0x0000fffa, 0x056eb800, 0x850f0000,
+0x000005ca, 0x8c53fcc5, 0x00008024, 0x29fcc500,
+0xc520244c, 0x244c53fc, 0x28fcc520, 0x00802494,
+0xfdc50000, 0xfcc5c95b, 0xf4c5c95b, 0xc500cac2,
+0x81d150fc, 0x0000fffa, 0x0575b800, 0x850f0000,
+0x0000058a, 0xca59ecc5, 0x4c29fcc5, 0xfcc52024,
+0x20244c52, 0x4c29fcc5, 0xfcc54024, 0x40244c28,
+0xd953fcc5, 0xdb5bfdc5, 0xdb5bfcc5, 0xd3c2ecc5,
+0x50fcc500, 0xfffa81d2, 0xb8000000, 0x0000057c,
+0x0548850f, 0xfdc50000, 0xfcc5c95b, 0x80249c28,
+0xc5000000, 0xc5c95bfc, 0xc5d353fc, 0xc5d25bfd,
+0xc5d25bfc, 0x00cac2f4, 0xd150fcc5, 0x00fffa81,
+0x7eb80000, 0x0f000005, 0x00051185, 0x59e4c500,
+0x29fcc5cb, 0xc520244c, 0x244c51fc, 0xc2f4c520,
+0xfcc500cb, 0xfa81d150, 0x000000ff, 0x00059cb8,
+0xe7850f00, 0xc4000004, 0x15187de2, 0x001007e0,
+0xdb5eecc5, 0x5c29fcc5, 0xe3c42024, 0x244c087d,
+0xf4c50b20, 0x07e00dc2, 0xc5000010, 0x81d150fc,
+0x0000fffa, 0x05a4b800, 0x850f0000, 0x000004ae,
+0x807ce98f, 0x0080248c, 0xe0c50000, 0xf4c5db57,
+0xc500cbc2, 0x81d150fc, 0x0000fffa, 0x05abb800,
+0x850f0000, 0x00000486, 0x8c58ecc5, 0x00008024,
+0x5eecc500, 0x29fcc5c9, 0x8f20244c, 0x4c807ce9,
+0xf4c52024, 0x20244cc2, 0x50fcc500, 0xfffa81d1,
+0xb8000000, 0x000005b1, 0x0450850f, 0xe2c40000,
+0xc80d187d, 0xc5001007, 0x248c59f4, 0x00000080,
+0x4c29fcc5, 0xe3c42024, 0x244c087d, 0xe98f0b20,
+0x245c807c, 0x58f4c520, 0xc2f4c5cb, 0x0020244c,
+0xd150fcc5, 0x00fffa81, 0xbbb80000, 0x0f000005,
+0x00040985, 0x59d4c500, 0x00a0248c, 0xd4c50000,
+0x80249c59, 0xc5000000, 0x244c29fc, 0x5fe4c540,
+0xc540244c, 0x245c5de4, 0x29fcc540, 0xc540245c,
+0x244c58f4, 0x28fcc540, 0x008024bc, 0xf4c50000,
+0xc4c5cd59, 0xa0249c58, 0xc5000000, 0x00cbc2f4,
+0xd150fcc5, 0x00fffa81, 0x3db80000, 0x0f000006,
+0x0003a985, 0x7de3c400, 0x80248c04, 0x1b000000,
+0xa428fcc5, 0x0000a024, 0x75e3c400, 0xc501c906,
+0x00c9c2dc, 0xd150fcc5, 0x00fffa81, 0x4eb80000,
+0x0f000006, 0x00037585, 0x0001b800, 0xfdc50000,
+0xf9c5dc5b, 0xf9c5f06e, 0xc500f670, 0xc4cefae1,
+0xdb197de3, 0xfae1c501, 0x0653b8de, 0xe3c40000,
+0x01cb1875, 0x9c28fcc5, 0x00008024, 0x65e2c400,
+0xe3c4c90c, 0x01c90675, 0xc9c2dcc5, 0x50fcc500,
+0xfffa81d1, 0x0f000000, 0x00032185, 0x58e4c500,
+0x7de2c4dc, 0x07cc0d18, 0xe4c50010, 0xc500d9c2,
+0x81d350fc, 0x0000fffa, 0x065db800, 0x850f0000,
+0x000002fa, 0x8c12fec5, 0x00008024, 0x7de2c400,
+0x07c01d18, 0xf4c50010, 0x80248c5c, 0xc5000000,
+0xc4dd58e4, 0x35187de2, 0x001007d0, 0xde59e4c5,
+0xcbc2f4c5, 0x50fcc500, 0xfffa81d1, 0xb8000000,
+0x00000717, 0x02b4850f, 0xfec50000, 0x80249c16,
+0xc5000000, 0x248c28fc, 0x00000080, 0xd258d4c5,
+0xd95ce4c5, 0xd659ecc5, 0xdac2e4c5, 0x50fcc500,
+0xfffa81d3, 0xb8000000, 0x0000071e, 0x027c850f,
+0x84d90000, 0x0000a424, 0x29fcc500, 0xc540244c,
+0xc5d257e8, 0x01d5c2ec, 0xa274e88f, 0x2ab820cc,
+0xd9000007, 0xd944245c, 0x00ac2484, 0x5cd90000,
+0x84d94c24, 0x0000b424, 0x245cd900, 0x2484d954,
+0x000000bc, 0x5c245cd9, 0x5c28fcc5, 0xe4c54024,
+0xc500c9c2, 0x81d150fc, 0x0000fffa, 0x1b850f00,
+0x83000002, 0xe2c4ffc8, 0x248c2c6d, 0x00000080,
+0x4c29fcc5, 0x44896024, 0xf1c50c24, 0x33b8c9ef,
+0xc4000007, 0x6c187de2, 0xe88f0c24, 0x20cda274,
+0x2e75e2c4, 0xc5602464, 0x247c28fc, 0xc2c4c560,
+0xfcc500cb, 0xfa81d150, 0x000000ff, 0x01cc850f,
+0xfcc50000, 0x8024ac28, 0xc4000000, 0x8c0c55e3,
+0x0000a024, 0xe4c5aa00, 0xc500d9c2, 0x81d350fc,
+0x0000fffa, 0x073ab800, 0x850f0000, 0x0000019e,
+0xb428fcc5, 0x00008024, 0xd0cfc500, 0x00a0248c,
+0xfcc50000, 0x8024bc28, 0xc5000000, 0x2494d0c7,
+0x000000a0, 0xcac2f4c5, 0x50fcc500, 0xfffa81d1,
+0xb8000000, 0x00000743, 0x0160850f, 0xfcc50000,
+0x80249c28, 0xc4000000, 0x944065e3, 0x0000a024,
+0xfac5f100, 0x0c245411, 0x197de3c4, 0x52b801d2,
+0xd9000007, 0xc50c2444, 0x245411fa, 0x2444d90c,
+0xd9c1de0c, 0xc50c245c, 0x244c10fa, 0xc2f4c50c,
+0x1008000d, 0xfcc50000, 0xfa81d150, 0x000000ff,
+0x0108850f, 0x03ba0000, 0xc5000000, 0x245c29fc,
+0x57f0c520, 0x7cf7c5c9, 0xc5202454, 0xc4e212d8,
+0xd3197de3, 0xc6d8c501, 0xe3c4e4e3, 0x245c1779,
+0xe8c5030c, 0xc44ad316, 0xd4186de3, 0x29fcc501,
+0x75202454, 0xd405d9d0, 0xd9001007, 0xdf0c2444,
+0x0fd8dde9, 0x0000b08a, 0xaa850f00, 0xc5000000,
+0x24ac28fc, 0x00000080, 0x9c7dd7c5, 0x0000a024,
+0x28f8c500, 0x12d8c5d3, 0x7de3c4e2, 0xc501db19,
+0xe4e3c6d8, 0xd316e8c5, 0x186de3c4, 0xefc501d4,
+0xf8c5d97c, 0xd8c5d328, 0xe3c4e212, 0x01db197d,
+0xe3c6d8c5, 0x16e8c5e4, 0x6de3c4d3, 0xc501d418,
+0xc5d97cef, 0xc5d328f8, 0xc4e212d8, 0xdb197de3,
+0xc6d8c501, 0xe8c5e4e3, 0xe3c4d316, 0x01d4186d,
+0xd17cefc5, 0xda28f8c5, 0xe312d8c5, 0x197de3c4,
+0xd8c501d2, 0xc5e4e2c6, 0xc4da16e0, 0xdc1865e3,
+0xc2e4c501, 0xfcc500d9, 0xff3dc350, 0xb8000000,
+0x00000767, 0xebc2440f, 0x075eb805, 0x5d8b0000,
+0x00c3c9fc, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0xbf800000, 0x80000000, 0x3e800000, 0x41100000,
+0x3f000000, 0x42100000, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x42f00000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0004040,
+};
+asm(".type xop_x86_32_D_32f4, STT_NOTYPE;");
+asm(".type xop_x86_32_D_32f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_32f8[] = {
+0xd95500eb, 0x83e589e8, 0xec81e0e4, 0x000000e0,
+0x802494dd, 0xd9000000, 0x1006c005, 0x2494dd00,
+0x000000a0, 0x94ddc9d9, 0x0000c024, 0xc405d900,
+0xdd001006, 0x00882494, 0x05d90000, 0x001006c8,
+0xa82494dd, 0xd9000000, 0xdde0d9e8, 0x00c82494,
+0xc9d90000, 0x90249cdd, 0xd9000000, 0x249cddc9,
+0x000000b0, 0x94ddc9d9, 0x0000d024, 0xddcad900,
+0x0098249c, 0xc9d90000, 0xb8249cdd, 0xdd000000,
+0x00d8249c, 0xfdc50000, 0x8024bc28, 0xc5000000,
+0x247c29fd, 0x28fdc520, 0xc520244c, 0x00d7c2f5,
+0xd250fdc5, 0xb80ffa83, 0x00000539, 0x05f4850f,
+0xf5c50000, 0x80249458, 0xc5000000, 0x245429fd,
+0x28fdc540, 0x008024bc, 0xc5c50000, 0xedc5d758,
+0x402454c2, 0x50fdc500, 0x0ffa83d2, 0x00053fb8,
+0xbf850f00, 0xc5000005, 0x247428fd, 0x5ccdc540,
+0x00802494, 0xfdc50000, 0x60245429, 0x54c2f5c5,
+0xc5006024, 0x83d250fd, 0x44b80ffa, 0x0f000005,
+0x00059185, 0x28fdc500, 0x00a024bc, 0xf5c50000,
+0x80248c59, 0xc5000000, 0xc5df59c5, 0x249428fd,
+0x00000080, 0xef58edc5, 0xa45cedc5, 0x0000a024,
+0x5cf5c500, 0x59ddc5cb, 0xc2f5c5e5, 0xfdc500cc,
+0xfa83d150, 0x055bb80f, 0x850f0000, 0x00000546,
+0x8c59edc5, 0x0000c024, 0x29fdc500, 0xc520244c,
+0x24945eed, 0x000000c0, 0xcac2f5c5, 0x50fdc500,
+0x0ffa83d1, 0x000564b8, 0x17850f00, 0xc4000005,
+0x1d197de2, 0x001006d8, 0x9428fdc5, 0x0000c024,
+0x57edc500, 0x57e5c5cb, 0x0080249c, 0xf5c50000,
+0x20244c59, 0xcbc2f5c5, 0x50fdc500, 0x0ffa83d1,
+0x000567b8, 0xdb850f00, 0xc5000004, 0x248ce6ff,
+0x00000080, 0xc9e6fec5, 0x8cc2f5c5, 0x00008024,
+0xfdc50000, 0xfa83d150, 0x056eb80f, 0x850f0000,
+0x000004b2, 0x8c5afdc5, 0x00008024, 0x75e3c400,
+0xc501c918, 0xc5c953fc, 0xc5c95afc, 0x244c29fd,
+0x5afdc520, 0xc520244c, 0x24a428fd, 0x00000080,
+0x4c29f8c5, 0xe3c41024, 0x01c91875, 0xc953fcc5,
+0xc95afcc5, 0xc9e6ffc5, 0xc9e6fec5, 0xccc2f5c5,
+0x50fdc500, 0x0ffa83d1, 0x000575b8, 0x53850f00,
+0xc5000004, 0xc5cc59dd, 0x244c29fd, 0x5afdc520,
+0xc420244c, 0xc91875e3, 0x52fcc501, 0x5afcc5c9,
+0x29fdc5c9, 0xc540244c, 0x245c28fd, 0x5afdc540,
+0x057cb8cb, 0xf8c50000, 0x10244c29, 0x1875e3c4,
+0xfcc501c9, 0xfcc5c953, 0xffc5c95a, 0xfec5c9e6,
+0xddc5c9e6, 0xc500e1c2, 0x83d450fd, 0x850f0ffa,
+0x000003f2, 0xa428fdc5, 0x00008024, 0x5afdc500,
+0xe6ffc5cc, 0xe6fec5db, 0x057eb8db, 0xf8c50000,
+0x10244c29, 0x1875e3c4, 0xfcc501c9, 0xfcc5c953,
+0xffc5c95a, 0xfec5c9e6, 0xe5c5c9e6, 0xc500d9c2,
+0x83d350fd, 0x850f0ffa, 0x000003aa, 0xcc59ddc5,
+0x4c29fdc5, 0xfdc52024, 0x20244c51, 0xccc2f5c5,
+0x50fdc500, 0x0ffa83d1, 0x00059cb8, 0x83850f00,
+0xc4000003, 0x0d197de2, 0x00100700, 0xe45ef5c5,
+0x6429fdc5, 0xe3c42024, 0x245c097d, 0xe5c50b20,
+0x07001dc2, 0xc5000010, 0x83d350fd, 0xa4b80ffa,
+0x0f000005, 0x00034d85, 0x7ce98f00, 0x8024a481,
+0xc5000000, 0xc5db57e1, 0x00e3c2dd, 0xd450fdc5,
+0xb80ffa83, 0x000005ab, 0x0328850f, 0xf5c50000,
+0x8024a458, 0xc5000000, 0xc5cc5ef5, 0x244c29fd,
+0x7ce98f20, 0x20244c81, 0x4cc2f5c5, 0xc5002024,
+0x83d150fd, 0xb1b80ffa, 0x0f000005, 0x0002f585,
+0x7de2c400, 0x06e00d19, 0xf5c50010, 0x80248c59,
+0xc5000000, 0x244c29fd, 0x7de3c420, 0x20244c09,
+0x7ce98f0b, 0x20246481, 0xcc58f5c5, 0x4cc2f5c5,
+0xc5002024, 0x83d150fd, 0xbbb80ffa, 0x0f000005,
+0x0002b185, 0x59edc500, 0x00a0248c, 0xedc50000,
+0x8024a459, 0xc5000000, 0x244c29fd, 0x5fddc540,
+0xc540244c, 0x24645ddd, 0x29fdc540, 0xc5402464,
+0x244c58f5, 0x28fdc540, 0x008024b4, 0xf5c50000,
+0xcdc5ca59, 0xa024a458, 0xc5000000, 0x00ccc2f5,
+0xd150fdc5, 0xb80ffa83, 0x0000063d, 0x0254850f,
+0xfdc50000, 0x80248c28, 0xc4000000, 0xe1057de3,
+0x5de3c405, 0xc501ec06, 0x24a428fd, 0x000000a0,
+0xedc2ddc5, 0x50fdc500, 0x0ffa83d5, 0x00064eb8,
+0x1f850f00, 0xd9000002, 0x1006cc05, 0x58f5c500,
+0x065db8cc, 0x5cdd0000, 0xe2c41024, 0x246c197d,
+0xc2f5c510, 0xfdc500cd, 0xfa83d150, 0xf3850f0f,
+0xc5000001, 0x24ac12ff, 0x00000080, 0x197de2c4,
+0x1006e835, 0x28fdc500, 0x0080248c, 0xedc50000,
+0xd5c5f658, 0xe2c4e95c, 0xf03d197d, 0xc5001006,
+0xc5f759cd, 0x00eec2d5, 0xd550fdc5, 0xb80ffa83,
+0x00000717, 0x01ac850f, 0xfdc50000, 0x40244c29,
+0xdac2e5c5, 0x10fbc501, 0x00a824bc, 0xfbc50000,
+0xb824b410, 0xc5000000, 0x247c11fb, 0x11fbc548,
+0x8f582474, 0xcca274e8, 0x28fdc530, 0xc5402454,
+0x00c9c2ed, 0xd150fdc5, 0xb80ffa83, 0x0000072a,
+0x0160850f, 0xe2c40000, 0x248c2d65, 0x00000080,
+0x4c29fdc5, 0xf1c56024, 0xe88fc9ef, 0x201da274,
+0x30001007, 0x2f65e2c4, 0xc5602464, 0x247c28fd,
+0xc2c5c560, 0xfdc500ca, 0xfa83d150, 0x0733b80f,
+0x850f0000, 0x0000011e, 0xb428fdc5, 0x00008024,
+0x4de3c400, 0xa0248c0d, 0x0a000000, 0xd1c2edc5,
+0x50fdc500, 0x0ffa83d2, 0x00073ab8, 0xf3850f00,
+0xc5000000, 0x24bc28fd, 0x00000080, 0x8cd0c5c5,
+0x0000a024, 0x28fdc500, 0x00802494, 0xedc50000,
+0xa0249cd0, 0xc5000000, 0x00cbc2f5, 0xd150fdc5,
+0xb80ffa83, 0x00000743, 0x00b8850f, 0xfdc50000,
+0x20245429, 0xc957f1c5, 0x547cf5c5, 0xe3c42024,
+0x01da186d, 0x066de3c4, 0xe5c531d2, 0xc50cd2c6,
+0x245429fd, 0x7cf5c520, 0xc4202454, 0xd2197de3,
+0x17f9c501, 0xd9082454, 0x1006d005, 0x2444dd00,
+0xdde9df08, 0x756a7ad8, 0x0000ba68, 0xfdc50000,
+0x8024ac28, 0xc5000000, 0x24947dd5, 0x000000a0,
+0x186de3c4, 0xe3c401da, 0x31d2066d, 0xdac6e5c5,
+0x7ce5c50c, 0x65e3c4d9, 0xc401d318, 0xdb0665e3,
+0xc6edc531, 0xedc50cd3, 0xe3c4d17c, 0x01da186d,
+0x066de3c4, 0xe5c531d2, 0xc50cd2c6, 0x00c9c2ed,
+0xc150fdc5, 0xb80ff883, 0x00000767, 0xebc2440f,
+0x075eb805, 0xc3c90000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x40800000, 0x40000000, 0x40400000, 0x40a00000,
+0x41200000, 0x00000000, 0x00000000, 0x80000000,
+0x00000000, 0x3fd00000, 0x00000000, 0xbff00000,
+0x00000000, 0x3fe00000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+0003500,
+};
+asm(".type xop_x86_32_D_32f8, STT_NOTYPE;");
+asm(".type xop_x86_32_D_32f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_f4[] = {
+0x31551aeb, 0x80e589c0, 0xff08287c, 0x83400a75,
+0xf37504f8, 0x02eb01b0, 0xc35dc031, 0x04244c8d,
+0xffe0e483, 0x8955fc71, 0xec8151e5, 0x00000144,
+0x0d10fac5, 0x00100680, 0x8d11fac5, 0xffffff08,
+0x8d11fac5, 0xffffff0c, 0x8d11fac5, 0xffffff10,
+0xff08858b, 0x8589ffff, 0xfffffefc, 0x9510fac5,
+0xffffff08, 0x00bac031, 0xc5000000, 0xfc952ef8,
+0x0ffffffe, 0x450fc09b, 0x89d8f7c2, 0x7fe82404,
+0x83ffffff, 0xc18810c4, 0x000539b8, 0x0fc98400,
+0x0005dd84, 0x10fac500, 0xfffefc95, 0x58eac5ff,
+0xffff0895, 0x11fac5ff, 0xffff0095, 0x10fac5ff,
+0xffff0895, 0x10ec83ff, 0xeac5c031, 0xf8c5d258,
+0xff00952e, 0x9b0fffff, 0xc2450fc0, 0x0489d8f7,
+0xff2ce824, 0xc483ffff, 0xb8c18810, 0x0000053f,
+0x840fc984, 0x0000058a, 0x9510fac5, 0xffffff00,
+0x955ceac5, 0xffffff08, 0x9511fac5, 0xfffffec8,
+0xfec8858b, 0x8589ffff, 0xffffff3c, 0xff008589,
+0x8589ffff, 0xffffff04, 0x9510fac5, 0xfffffefc,
+0x3110ec83, 0x2ef8c5c0, 0xffff0495, 0xc09b0fff,
+0xf7c2450f, 0x240489d8, 0xfffec5e8, 0x10c483ff,
+0x44b8c188, 0x84000005, 0x23840fc9, 0xc5000005,
+0xfc9510fa, 0xc5fffffe, 0x089559ea, 0xc5ffffff,
+0xfc9511fa, 0xc5fffffe, 0x0c9510fa, 0xc5ffffff,
+0xc5d259ea, 0x009511fa, 0xc5ffffff, 0x089510fa,
+0xc5ffffff, 0x0c9558ea, 0xc5ffffff, 0x049511fa,
+0xc5ffffff, 0x089510fa, 0x83ffffff, 0xfac510ec,
+0xfefca510, 0xc031ffff, 0x9d5ceac5, 0xffffff0c,
+0xa55cdac5, 0xffffff00, 0x9d59e2c5, 0xffffff04,
+0x9d11fac5, 0xffffff04, 0xe32ef8c5, 0x0fc09b0f,
+0xd8f7c245, 0xe8240489, 0xfffffe26, 0x8810c483,
+0x055bb8c1, 0xc9840000, 0x0484840f, 0xeac50000,
+0xff109559, 0xfac5ffff, 0xfefc9511, 0xfac5ffff,
+0xff089510, 0xec83ffff, 0xc5c03110, 0x10955eea,
+0xc5ffffff, 0xfc952ef8, 0xc5fffffe, 0x009511fa,
+0x0fffffff, 0x450fc09b, 0x89d8f7c2, 0xcfe82404,
+0x83fffffd, 0xc18810c4, 0x000564b8, 0x0fc98400,
+0x00042d84, 0x10fac500, 0x10069025, 0x10ec8300,
+0x9510fac5, 0xffffff10, 0xfac5c031, 0xff089d10,
+0xe8c5ffff, 0xeac5d457, 0xfefc9559, 0xe0c5ffff,
+0xf8c5dc57, 0x9b0fd32e, 0xc2450fc0, 0x0489d8f7,
+0xfd7ce824, 0xc483ffff, 0xb8c18810, 0x00000567,
+0x840fc984, 0x000003da, 0x852cfac5, 0xffffff08,
+0xff148589, 0xeac5ffff, 0xff14952a, 0xfac5ffff,
+0xfefc9511, 0xfac5ffff, 0xfefc9510, 0xec83ffff,
+0xc5c03110, 0x08952ef8, 0x0fffffff, 0x450fc09b,
+0x89d8f7c2, 0x27e82404, 0x83fffffd, 0xc18810c4,
+0x00056eb8, 0x0fc98400, 0x00038584, 0x530ff300,
+0xffff0895, 0x11fac5ff, 0xfffefc95, 0x530ff3ff,
+0xfffefc95, 0x2cfac5ff, 0x148589c2, 0xc5ffffff,
+0x149d2ae2, 0x83ffffff, 0xc03110ec, 0x9510fac5,
+0xffffff08, 0xda2ef8c5, 0x0fc09b0f, 0xd8f7c245,
+0xe8240489, 0xfffffcca, 0x8810c483, 0x0575b8c1,
+0xc9840000, 0x0328840f, 0xeac50000, 0xfac5d259,
+0xfefc9511, 0x0ff3ffff, 0xfefc9552, 0xfac5ffff,
+0xff009511, 0x0ff3ffff, 0xff009553, 0xfac5ffff,
+0x8589c22c, 0xffffff14, 0x952aeac5, 0xffffff14,
+0x3110ec83, 0x2ef8c5c0, 0xffff0895, 0xc09b0fff,
+0xf7c2450f, 0x240489d8, 0xfffc65e8, 0x10c483ff,
+0x7cb8c188, 0x84000005, 0xc3840fc9, 0xc5000002,
+0x00852cfa, 0x89ffffff, 0xffff1485, 0x530ff3ff,
+0xffff0895, 0x2cfac5ff, 0x2ae2c5c2, 0xffff149d,
+0x148589ff, 0xc5ffffff, 0x14952aea, 0x83ffffff,
+0xc03110ec, 0xda2ef8c5, 0x0fc09b0f, 0xd8f7c245,
+0xe8240489, 0xfffffc0a, 0x8810c483, 0x057eb8c2,
+0xd2840000, 0x0268840f, 0xfac50000, 0xff089510,
+0xeac5ffff, 0xfac5d259, 0xfefc9511, 0xfac5ffff,
+0xff089510, 0xec83ffff, 0xbac03110, 0x00000000,
+0x9d510ff3, 0xfffffefc, 0xda2ef8c5, 0x0fc09b0f,
+0xd8f7c245, 0xe8240489, 0xfffffbb6, 0x8810c483,
+0x059cb8c1, 0xc9840000, 0x0214840f, 0xf2c50000,
+0xfac5d25e, 0xff008d11, 0xfac5ffff, 0xfefc9511,
+0xc031ffff, 0x6610ec83, 0x950a3a0f, 0xfffffefc,
+0x2ef8c50b, 0xffff0095, 0x11fac5ff, 0xffff0495,
+0xc09b0fff, 0xf7c2450f, 0x240489d8, 0xfffb61e8,
+0x10c483ff, 0xa4b8c188, 0x84000005, 0xbf840fc9,
+0x8f000001, 0x958278e9, 0xffffff08, 0x9511fac5,
+0xfffffefc, 0xd257e8c5, 0x3110ec83, 0x2ef8c5c0,
+0xfffefc95, 0xc09b0fff, 0xf7c2450f, 0x240489d8,
+0xfffb1de8, 0x10c483ff, 0xabb8c188, 0x84000005,
+0x7b840fc9, 0xc5000001, 0x089558f2, 0xc5ffffff,
+0xc5ca5ef2, 0xfc8d11fa, 0x8ffffffe, 0x8d8278e9,
+0xfffffefc, 0x8d11fac5, 0xffffff00, 0x8d10fac5,
+0xfffffefc, 0x3110ec83, 0x2ef8c5c0, 0xffff008d,
+0xc09b0fff, 0xf7c2450f, 0x240489d8, 0xfffac1e8,
+0x10c483ff, 0xb1b8c188, 0x84000005, 0x1f840fc9,
+0xc5000001, 0x840d10fa, 0xc5001006, 0x088d59f2,
+0xc5ffffff, 0xfc8d11fa, 0x66fffffe, 0x8d0a3a0f,
+0xfffffefc, 0x11fac50b, 0xffff008d, 0x78e98fff,
+0xfefc8d82, 0xfac5ffff, 0xff048d11, 0xfac5ffff,
+0xff008d10, 0xec83ffff, 0xc5c03110, 0x048d58f2,
+0xc5ffffff, 0xfc8d2ef8, 0x0ffffffe, 0x450fc09b,
+0x89d8f7c2, 0x47e82404, 0x83fffffa, 0xc18810c4,
+0x0005bbb8, 0x0fc98400, 0x0000a584, 0x10fac500,
+0xffff108d, 0x59f2c5ff, 0xffff0895, 0x59f2c5ff,
+0xffff0c8d, 0x11fac5ff, 0xfffefc95, 0x11fac5ff,
+0xffff008d, 0x10fac5ff, 0xfffefc8d, 0x5ff2c5ff,
+0xffff008d, 0x11fac5ff, 0xffff048d, 0x10fac5ff,
+0xfffefc8d, 0x5df2c5ff, 0xffff008d, 0x11fac5ff,
+0xffff008d, 0x10fac5ff, 0xffff008d, 0x10ec83ff,
+0x9510fac5, 0xffffff08, 0xf2c5c031, 0xff048d58,
+0xeac5ffff, 0xff0c9558, 0xf2c5ffff, 0xff108d59,
+0xf8c5ffff, 0x9b0fca2e, 0xc2450fc0, 0x0489d8f7,
+0xf99ce824, 0xc483ffff, 0x19013c10, 0x063d25c0,
+0x4d8b0000, 0x618dc9fc, 0x0000c3fc, 0x00000000,
+0x3f800000, 0x3e800000, 0x00000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0003240,
+};
+asm(".type xop_x86_32_D_f4, STT_NOTYPE;");
+asm(".type xop_x86_32_D_f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_32_D_f8[] = {
+0x895500eb, 0xe0e483e5, 0x0220ec81, 0xfbc50000,
+0x06b00d10, 0xfbc50010, 0x68244c11, 0x4c11fbc5,
+0xfbc57024, 0x78244c11, 0x6824448b, 0x50244489,
+0x6c24448b, 0x54244489, 0x6c10fbc5, 0xf9c56824,
+0x50246c2e, 0x01b80c7a, 0xba000000, 0x00000000,
+0xc0310474, 0xd8f7d231, 0x18244489, 0xb800d283,
+0x00000539, 0x5489daf7, 0x6f0f1c24, 0x0f182444,
+0xfa81d0d7, 0x000000ff, 0x062c850f, 0xfbc50000,
+0x50247410, 0x5458cbc5, 0xfbc56824, 0x58245411,
+0xfbc5d231, 0x68245410, 0x000001b8, 0x58ebc500,
+0x2ef9c5d2, 0x7a582454, 0x31047402, 0xf7d231c0,
+0x244489d8, 0x00d28318, 0x00053fb8, 0x89daf700,
+0x0f1c2454, 0x18244c6f, 0x81d1d70f, 0x0000fffa,
+0xd3850f00, 0xc5000005, 0x247c10fb, 0x5cc3c558,
+0xc5682454, 0x245411fb, 0x24548b20, 0x24448b20,
+0x24948924, 0x000000c8, 0xcc248489, 0x89000000,
+0x89582454, 0x895c2444, 0x89602454, 0x31642444,
+0x10fbc5d2, 0xb8502464, 0x00000001, 0x642ef9c5,
+0x027a6024, 0xc0310474, 0xd8f7d231, 0x18244489,
+0xb800d283, 0x00000544, 0x5489daf7, 0x6f0f1c24,
+0x0f182454, 0xfa81d2d7, 0x000000ff, 0x0558850f,
+0xfbc50000, 0x50246c10, 0x5459d3c5, 0xfbc56824,
+0x50245411, 0x5410fbc5, 0xebc57024, 0xfbc5d259,
+0x58245411, 0x7410fbc5, 0xcbc56824, 0x70245458,
+0x5411fbc5, 0xd2316024, 0x5410fbc5, 0xfbc56824,
+0x50247c10, 0x5c5cebc5, 0xc3c57024, 0x5824645c,
+0x5c59e3c5, 0x01b86024, 0xc5000000, 0x245c11fb,
+0x2ef9c560, 0x74027ae3, 0x31c03104, 0x89d8f7d2,
+0x83182444, 0x5bb800d2, 0xf7000005, 0x245489da,
+0x5c6f0f1c, 0xd70f1824, 0xfffa81d3, 0x0f000000,
+0x0004c585, 0x59ebc500, 0xc5782454, 0x245411fb,
+0xc5d23150, 0x246410fb, 0x0001b868, 0xdbc50000,
+0x7824545e, 0x5411fbc5, 0xf9c55824, 0x5024542e,
+0x0474027a, 0xd231c031, 0x4489d8f7, 0xd2831824,
+0x0564b800, 0xdaf70000, 0x1c245489, 0x24646f0f,
+0xd4d70f18, 0x00fffa81, 0x850f0000, 0x0000046a,
+0x1d7efac5, 0x001006c0, 0xfbc5d231, 0x78246c10,
+0x7410fbc5, 0xd1c56824, 0x01b8d357, 0xc5000000,
+0x245459eb, 0x57c9c550, 0x2ef9c5db, 0x74027ad3,
+0x31c03104, 0x89d8f7d2, 0x83182444, 0x67b800d2,
+0xf7000005, 0x245489da, 0x6c6f0f1c, 0xd70f1824,
+0xfffa81d5, 0x0f000000, 0x00040d85, 0x2cfbc500,
+0x89682444, 0xc54c2444, 0x24542aeb, 0x11fbc54c,
+0x31502454, 0x10fbc5d2, 0xb850247c, 0x00000001,
+0x7c2ef9c5, 0x027a6824, 0xc0310474, 0xd8f7d231,
+0x18244489, 0xb800d283, 0x0000056e, 0x5489daf7,
+0x6f0f1c24, 0x0f182474, 0xfa81d6d7, 0x000000ff,
+0x03b4850f, 0x0ff20000, 0x6824545a, 0xd2530ff3,
+0xd25a0ff3, 0x5413f9c5, 0x0ff25024, 0x5024545a,
+0xd2530ff3, 0xd25a0ff3, 0xc22cfbc5, 0x4c244489,
+0x5c2ae3c5, 0xd2314c24, 0x5410fbc5, 0x01b86824,
+0xc5000000, 0x7ada2ef9, 0x31047402, 0xf7d231c0,
+0x244489d8, 0x00d28318, 0x000575b8, 0x89daf700,
+0x0f1c2454, 0x18247c6f, 0x81d7d70f, 0x0000fffa,
+0x43850f00, 0xc5000003, 0xc5d259eb, 0x245411fb,
+0x5a0ff250, 0xf3502454, 0xf3d2520f, 0xc5d25a0f,
+0x245413f9, 0x5a0ff258, 0xf3582454, 0xf3d2530f,
+0xc5d25a0f, 0x89c22cfb, 0xc54c2444, 0x24542aeb,
+0xb8d2314c, 0x00000001, 0x542ef9c5, 0x027a6824,
+0xc0310474, 0xd8f7d231, 0x18244489, 0xb800d283,
+0x0000057c, 0x5489daf7, 0x6f0f1c24, 0x0f182444,
+0xfa81d0d7, 0x000000ff, 0x02cc850f, 0xfbc50000,
+0x5824442c, 0x4c244489, 0x545a0ff2, 0x0ff36824,
+0x0ff3d253, 0xfbc5d25a, 0x448bd22c, 0x54894c24,
+0x443b4c24, 0x940f4c24, 0x0fd231c0, 0xd8f7c0b6,
+0x18244489, 0xb800d283, 0x0000057e, 0x5489daf7,
+0x6f0f1c24, 0x0f18244c, 0xfa81d1d7, 0x000000ff,
+0x0274850f, 0xfbc50000, 0x68245410, 0xd259ebc5,
+0x5411fbc5, 0xd2315024, 0x5410fbc5, 0x01b86824,
+0xf2000000, 0x245c510f, 0x2ef9c550, 0x74027ada,
+0x31c03104, 0x89d8f7d2, 0x83182444, 0x9cb800d2,
+0xf7000005, 0x245489da, 0x546f0f1c, 0xd70f1824,
+0xfffa81d2, 0x0f000000, 0x00021d85, 0x5ef3c500,
+0x11fbc5d2, 0xc558244c, 0x245411fb, 0xb8d23150,
+0x00000001, 0x0b3a0f66, 0x0b502454, 0x5411fbc5,
+0xf9c56024, 0x5824542e, 0x0474027a, 0xd231c031,
+0x4489d8f7, 0xd2831824, 0x05a4b800, 0xdaf70000,
+0x1c245489, 0x245c6f0f, 0xd3d70f18, 0x00fffa81,
+0x850f0000, 0x000001c2, 0x8378e98f, 0xc5682454,
+0x245413f9, 0xc5d23150, 0xb8d257e9, 0x00000001,
+0x542ef9c5, 0x027a5024, 0xc0310474, 0xd8f7d231,
+0x18244489, 0xb800d283, 0x000005ab, 0x5489daf7,
+0x6f0f1c24, 0x0f182464, 0xfa81d4d7, 0x000000ff,
+0x0174850f, 0xf3c50000, 0x68245458, 0xca5ef3c5,
+0x4c11fbc5, 0xe98f5024, 0x244c8378, 0x13f9c550,
+0x3158244c, 0x10fbc5d2, 0xb8502464, 0x00000001,
+0x642ef9c5, 0x027a5824, 0xc0310474, 0xd8f7d231,
+0x18244489, 0xb800d283, 0x000005b1, 0x5489daf7,
+0x6f0f1c24, 0x0f18246c, 0xfa81d5d7, 0x000000ff,
+0x0114850f, 0xfbc50000, 0x06b82d10, 0xd3c50010,
+0x68244c59, 0x4c11fbc5, 0x0f665024, 0x244c0b3a,
+0xf9c50b50, 0x58244c13, 0x8378e98f, 0xc550244c,
+0x244c13f9, 0xc5d23160, 0x247410fb, 0x0001b858,
+0xcbc50000, 0x60244c58, 0x4c2ef9c5, 0x027a5024,
+0xc0310474, 0xd8f7d231, 0x18244489, 0xb800d283,
+0x000005bb, 0x5489daf7, 0x6f0f1c24, 0x0f182474,
+0xfa81d6d7, 0x000000ff, 0x009c850f, 0xfbc50000,
+0x78244c10, 0x5459f3c5, 0xf3c56824, 0x70244c59,
+0x5411fbc5, 0xfbc55024, 0x58244c11, 0x7c10fbc5,
+0xc3c55024, 0x58244c5f, 0x4c11fbc5, 0xfbc56024,
+0x50246410, 0x4c5ddbc5, 0xfbc55824, 0x58244c11,
+0xfbc5d231, 0x58246c10, 0x7410fbc5, 0xd3c56824,
+0x60244c58, 0x5458cbc5, 0xf3c57024, 0x78244c59,
+0x000001b8, 0x2ef9c500, 0x74027aca, 0x31c03104,
+0x89d8f7d2, 0x83182444, 0xdaf700d2, 0x1c245489,
+0x000000ba, 0x7c6f0f00, 0xd70f1824, 0x00ff3dc7,
+0x3db80000, 0x0f000006, 0xc3c9c244, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x3fd00000,
+0x00000000, 0x80000000, 0x00000000, 0x00000000,
+0003320,
+};
+asm(".type xop_x86_32_D_f8, STT_NOTYPE;");
+asm(".type xop_x86_32_D_f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_16i1[] = {
+0xb85500eb, 0x00000001, 0x000008be, 0x11b74000,
+0x89e58948, 0xff488dfa, 0xbf054488, 0x5488c229,
+0xca89cf05, 0x8301e283, 0xd21901fa, 0xe283c121,
+0x83caff02, 0xde8301f9, 0x05548800, 0x748840df,
+0xff48ef05, 0xf88348c0, 0xc5c87511, 0xc06d6ff9,
+0x6d7ff9c5, 0x6ff9c590, 0xe9c5905d, 0x39b8d276,
+0xc5000005, 0xc4cd74e1, 0xca1779e2, 0x0359830f,
+0xe1c50000, 0xc5c04dfc, 0xa04d7ff9, 0x4d6ff9c5,
+0x053fb8c0, 0xf1c50000, 0xf1c5c9fc, 0xc4a04d74,
+0xca1779e2, 0x0331830f, 0xf9c50000, 0xc5a06d6f,
+0xc04df8d1, 0x4d7ff9c5, 0x74e1c5b0, 0x44b8b05d,
+0xc4000005, 0xda1779e2, 0x030d830f, 0xf9c50000,
+0xc5c0756f, 0xe07d6ff9, 0xdbefe1c5, 0x256ff9c5,
+0x000002fc, 0x6d6ff9c5, 0x6041c5f0, 0x6049c5c7,
+0x68c1c5ce, 0x68c9c5ff, 0x3941c4ce, 0xc1c5c9d5,
+0x688fc9d5, 0x40c9a330, 0xcb64d1c5, 0xdb71c1c4,
+0x7ff9c5c9, 0x698fb04d, 0xf05d98f0, 0x2d6ff9c5,
+0x000002cc, 0x656f79c5, 0xf819c5f0, 0x7f79c5d5,
+0xe98ff055, 0xf04d98f0, 0x000621b8, 0xfc71c500,
+0x2941c4d1, 0x62c4d374, 0x0fd21779, 0x00028a83,
+0xf8e1c500, 0x26b8f05d, 0x8f000006, 0xc99860e9,
+0x4d74f1c5, 0x79e2c4b0, 0x830fca17, 0x0000026b,
+0x5d6ff9c5, 0x7f79c5d0, 0xe1c5904d, 0x61c5cb60,
+0xc1c4d368, 0xc5c8d571, 0x8fd7d529, 0xcaa370c8,
+0x7ff9c540, 0xe2c4a04d, 0xa04d3c31, 0x383162c4,
+0x79c5a04d, 0xc5a04d7f, 0xa04dfcf1, 0x00063db8,
+0x6071c500, 0x68f1c5c9, 0xd5f1c5c9, 0x3141c4cf,
+0xc9c5c0d5, 0xe88ffbfc, 0x40c9a338, 0xcf74f1c5,
+0x1779e2c4, 0x00830fca, 0xc4000002, 0x4d1c79e2,
+0x74c9c590, 0x0644b8f1, 0xe2c40000, 0x0ff21779,
+0x0001e683, 0x6ff9c500, 0x49b8e04d, 0xc4000006,
+0xf10851e2, 0xf674f1c5, 0x1779e2c4, 0xc8830ff2,
+0xc5000001, 0xc07d6ff9, 0xf5f8e1c5, 0x00064eb8,
+0x41e2c400, 0xe1c5f600, 0xe2c4f674, 0x0ff21779,
+0x0001a683, 0x6ff9c500, 0xe1c5c075, 0x53b8fdf8,
+0x8f000006, 0xf6a348e8, 0x74e1c570, 0x79e2c4f6,
+0x830ff217, 0x00000183, 0x7560e1c5, 0x68e1c5c0,
+0xc9c5c05d, 0x71c5dbf8, 0x71c5c960, 0xa8b8c168,
+0xc5000006, 0xc5f360e1, 0xc5db68e1, 0xc5f6d5b1,
+0x8fdbd5b9, 0xdba348e8, 0x74e1c540, 0x00016f1d,
+0x79e2c400, 0x830fda17, 0x0000013f, 0x5d6ff9c5,
+0x60e1c5c0, 0x68e1c5f3, 0x49c1c4fb, 0xc1c4f1d5,
+0x8ff8d541, 0xf7a348e8, 0xefd9c540, 0x7ff9c5e4,
+0xe88f9075, 0x00e4cc70, 0xf460c9c5, 0x7d6ff9c5,
+0x79e2c490, 0xc9c5ff20, 0xb3b8f774, 0xc4000006,
+0xf21779e2, 0x00f1830f, 0xd9c50000, 0xc1c5e460,
+0xf9c5fc60, 0xc490756f, 0xf62179e2, 0xfe74c1c5,
+0x0006bbb8, 0x79e2c400, 0x830ffa17, 0x000000cb,
+0xe460d9c5, 0xf460c9c5, 0x656ff9c5, 0x79e2c490,
+0xf9c5e422, 0xc5b0657f, 0xb8e674d9, 0x000006c4,
+0x1779e2c4, 0xa0830fe2, 0xc5000000, 0xa05d7ff9,
+0x000001b8, 0x05548a00, 0x055488d0, 0xc08348a0,
+0xf8834802, 0xc5ee7511, 0xb8e4efd9, 0x0000072a,
+0xcc64f1c5, 0xa260e88f, 0xc510d04d, 0xa04d74f1,
+0x1779e2c4, 0xc46473ca, 0xcb0f61e3, 0xdbe1c501,
+0x00008b1d, 0x074ab800, 0xe1c50000, 0xf1c5ddfc,
+0xe2c4cb74, 0x73ca1779, 0x0004b842, 0xe98f0000,
+0xd05de178, 0xe178e98f, 0xf1c5c04d, 0xe1c5cb63,
+0xe98fdbef, 0xc5c9c178, 0xffcb63f1, 0xc5f375c8,
+0x31dbefe1, 0x74f1c5c0, 0x79e2c4cb, 0x920fca17,
+0x01f883c0, 0x6725c019, 0x5d000007, 0x000000c3,
+0x06040200, 0x0e0c0a08, 0x16141210, 0x1e1c1a18,
+0x01010101, 0x01010101, 0x01010101, 0x01010101,
+0x08080808, 0x08080808, 0x08080808, 0x08080808,
+0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f,
+0002020,
+};
+asm(".type xop_x86_64_D_16i1, STT_NOTYPE;");
+asm(".type xop_x86_64_D_16i1, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_16u1[] = {
+0xb85500eb, 0x00000001, 0x000008b9, 0x11b74000,
+0x89e58948, 0xff508dfe, 0xbf054488, 0x8840c629,
+0x89cf0574, 0x83c221d6, 0xceff01e6, 0x8301fa83,
+0x884000d9, 0x88df0574, 0x48ef054c, 0x8348c0ff,
+0xcf7511f8, 0x7d6ff9c5, 0x7ff9c5c0, 0xf9c5907d,
+0xc5905d6f, 0xb8d276e9, 0x00000539, 0xcf74e1c5,
+0x1779e2c4, 0xb9830fca, 0xc5000002, 0xc04dfce1,
+0x4d7ff9c5, 0x6ff9c5a0, 0x3fb8c04d, 0xc5000005,
+0xc5c9fcf1, 0xa04d74f1, 0x1779e2c4, 0x91830fca,
+0xc5000002, 0xa06d6ff9, 0x4df8d1c5, 0x7ff9c5c0,
+0xe1c5b04d, 0xb8b06574, 0x00000544, 0x1779e2c4,
+0x6d830fe2, 0xc5000002, 0xd05debe1, 0x5d7ff9c5,
+0xdbf1c590, 0xf9c5d04d, 0xc5b07d6f, 0xd05defc1,
+0x4ddff1c5, 0x76d1c590, 0x0550b8ed, 0xf1c50000,
+0xe2c4cb74, 0x0fca1779, 0x00023783, 0x6ff9c500,
+0xd9c5f075, 0xe88fe4ef, 0x05cccc48, 0x4ddbf1c5,
+0xf0e98fc0, 0xc5f07d98, 0xf05dfcd1, 0x5d7ff9c5,
+0xf0e98ff0, 0xb8f05d98, 0x00000621, 0xf3fce1c5,
+0xf774c9c5, 0x1779e2c4, 0xf5830ff2, 0xc5000001,
+0xf065f8d9, 0x000626b8, 0x58e98f00, 0xf1c5db94,
+0xe2c4cb74, 0x0fca1779, 0x0001d783, 0x6ff9c500,
+0xe1c5c05d, 0xc5d04dda, 0xd065dee1, 0x5dfce1c5,
+0xfcf1c5d0, 0x0634b8cc, 0xf1c50000, 0xe2c4cb74,
+0x0fca1779, 0x0001ab83, 0x6ff9c500, 0x0001af35,
+0x6ff9c500, 0x49b8e05d, 0xc4000006, 0xcb0849e2,
+0xcb74f1c5, 0x1779e2c4, 0x85830fca, 0xc5000001,
+0xd04d6ff9, 0x7d6ff9c5, 0x064eb8c0, 0xf1c50000,
+0xe2c4e5fc, 0xc5e40041, 0xc4e174d9, 0xe21779e2,
+0x015e830f, 0xf9c50000, 0xc5c0656f, 0xb8fef8f1,
+0x00000653, 0xa358e88f, 0xd9c570e4, 0xe2c4e174,
+0x0fe21779, 0x00013b83, 0x60f1c500, 0xf1c5c065,
+0xc5c04d68, 0xb8c9fcd1, 0x000006a8, 0xccf8f1c5,
+0xcbeff1c5, 0xddefe1c5, 0xcbf8f1c5, 0x0d74f1c5,
+0x0000012c, 0x1779e2c4, 0x05830fca, 0xc4000001,
+0x653079e2, 0x79e2c4c0, 0xf9c5dc30, 0xc5b05d7f,
+0xc06d6ff9, 0x3079e2c4, 0x74f1c5cd, 0x06d3b8cc,
+0xe2c40000, 0x0fca1779, 0x0000d783, 0x6ff9c500,
+0xe2c4c06d, 0xc5cd3179, 0xb8cb74f1, 0x000006da,
+0x1779e2c4, 0xb9830fca, 0xc5000000, 0xc07d6ff9,
+0x3279e2c4, 0x7ff9c5cf, 0xe2c4904d, 0xb8db3079,
+0x000006e1, 0xcb74f1c5, 0x1779e2c4, 0x91830fca,
+0xc5000000, 0xc04d6ff9, 0x000001b8, 0x7ff9c500,
+0x548aa04d, 0x5488d005, 0x8348a005, 0x834802c0,
+0xee7511f8, 0x6d6ff9c5, 0x70e88fe0, 0x50d05da2,
+0x5d74e1c5, 0x072ab8a0, 0xe2c40000, 0x73da1779,
+0xdbf1c553, 0x00007725, 0x71e3c400, 0xb801d90f,
+0x0000074a, 0xe6fcd9c5, 0xdc74e1c5, 0x1779e2c4,
+0xc53173da, 0x904d7ff9, 0xd2efe9c5, 0x000004ba,
+0x78e98f00, 0xc5904dd1, 0xc5c967e9, 0x904d7ff9,
+0xed75caff, 0x1479e3c4, 0x883c0fc8, 0x00075eb8,
+0xc2440f00, 0x0000c35d, 0x00000000, 0x00000000,
+0x01010101, 0x01010101, 0x01010101, 0x01010101,
+0x08080808, 0x08080808, 0x08080808, 0x08080808,
+0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f, 0x0f0f0f0f,
+0001540,
+};
+asm(".type xop_x86_64_D_16u1, STT_NOTYPE;");
+asm(".type xop_x86_64_D_16u1, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_16i2[] = {
+0x000156e9, 0x01b85500, 0xb9000000, 0x00000009,
+0x89e58948, 0x448966ca, 0xc229ce45, 0x4544c766,
+0x660001ee, 0xde455489, 0x48c0ff48, 0x7509f883,
+0x6ff9c5e2, 0x79c5d055, 0xc5f0456f, 0xe04d6ff9,
+0xfd69c1c4, 0xd5c9c5f0, 0x70e88ff1, 0x10d06595,
+0xdb76e1c5, 0x0000a7b8, 0x75d9c500, 0x79e2c4e6,
+0x830fe317, 0x000000f1, 0xe4efd9c5, 0x0000abb8,
+0xf9d9c500, 0xf9d9c5e9, 0xd5d1c5f6, 0xc1c5d07d,
+0xc1c5f9f9, 0xe2c4f675, 0x0ff31779, 0x0000c883,
+0x69c1c400, 0xe9c5d0f9, 0xf1c5d1d5, 0xc5d075d5,
+0xb8f1f9c9, 0x000000af, 0xf275c9c5, 0x1779e2c4,
+0xa2830ff3, 0x8f000000, 0x6d9550e8, 0xd9c510d0,
+0xb3b8d2f9, 0xc5000000, 0xc4ea75d1, 0xeb1779e2,
+0x0083830f, 0xf9c50000, 0xc5d06d6f, 0xc5f9fdd1,
+0xf055d5d1, 0x55fde9c5, 0x00bbb8e0, 0xe9c50000,
+0xe2c4d775, 0x73d31779, 0xf9d9c560, 0xd5e9c5d5,
+0xc9c5f075, 0xb8e075f9, 0x000000c0, 0xe7f9d9c5,
+0xe475c9c5, 0x1779e2c4, 0xc53e73e3, 0xf065d5d1,
+0x65f9d9c5, 0xf9d1c5e0, 0x00c5b8f1, 0xd9c50000,
+0xe2c4e675, 0x73e31779, 0xd5e9c520, 0xe9c5f055,
+0xc5e055fd, 0xb8cdf9f1, 0x000000ca, 0xd175e9c5,
+0x1779e2c4, 0x310273d3, 0x55c35dc0, 0x000001b8,
+0x0010b900, 0xb9410000, 0x00000009, 0x48e58948,
+0x8d80c483, 0x8944ff70, 0x448966cf, 0xf289be45,
+0xe283c729, 0x7c896601, 0xfa83ce45, 0x83d21901,
+0xcaff02e2, 0x0f40c685, 0x8966c694, 0x40de4554,
+0x29f6b60f, 0x4c8966f1, 0xff48ee45, 0xf88348c0,
+0xc5c07509, 0xc0756ff9, 0x757ff9c5, 0x6ff9c590,
+0xf1c59055, 0x39b8c976, 0xc5000005, 0xc4de75e9,
+0xd91779e2, 0x048b830f, 0xe9c50000, 0xc5c05dfd,
+0xa05d7ff9, 0x756ff9c5, 0x053fb8c0, 0xe1c50000,
+0xc501f671, 0xa05d75e1, 0x1779e2c4, 0x62830fd9,
+0xc5000004, 0xa0756ff9, 0x5df9c9c5, 0x7ff9c5c0,
+0xe9c5b05d, 0xb8b05d75, 0x00000544, 0x1779e2c4,
+0x3e830fd9, 0xc5000004, 0xd05d6ff9, 0x55d5e9c5,
+0xd5e1c5c0, 0x6ff9c5e3, 0xe1c5c05d, 0xc5d075fd,
+0xd06df9e1, 0xd4f9e9c5, 0x00055bb8, 0xd5d1c500,
+0x75e9c5ee, 0x79e2c4d5, 0x830fd117, 0x00000405,
+0x55d5e1c5, 0x75e9c5d0, 0x00040315, 0x05c8b800,
+0xe2c40000, 0x0fd11779, 0x0003e883, 0xe5e1c500,
+0xf9c5e065, 0xc5e06d6f, 0xb8d2efe9, 0x000005cf,
+0xcd50e88f, 0xe9c500d2, 0xe2c4d475, 0x0fd11779,
+0x0003c083, 0xd5d1c500, 0x7ff9c5d3, 0xf9c5b055,
+0xc5b0756f, 0x03f671d9, 0x657ff9c5, 0x6ff9c590,
+0xe9c5b075, 0xc502f671, 0xa0557ff9, 0xd2fde9c5,
+0x0005edb8, 0x75e9c500, 0x79e2c4d4, 0x830fd117,
+0x00000381, 0x756ff9c5, 0x71e9c590, 0xe9c502e6,
+0xf2b8d2fd, 0xc5000005, 0xa05575e9, 0x1779e2c4,
+0x5e830fd1, 0xc5000003, 0xc7e5d5e1, 0x00038c45,
+0x63480000, 0xe1c48c45, 0xc5d06ef9, 0xc7d2f1d9,
+0x00028c45, 0x63480000, 0xe1c48c45, 0xc5f06ef9,
+0xc5e6f1d9, 0xa0657ff9, 0xe4fdd9c5, 0x000605b8,
+0x75d9c500, 0x79e2c4e2, 0x830fe117, 0x00000315,
+0x8c456348, 0x6ef9e1c4, 0xe1e9c5f8, 0xfde9c5d7,
+0x0609b8d2, 0xe9c50000, 0xc4a05575, 0xd11779e2,
+0x02ef830f, 0xe1c50000, 0xf9c5f5d5, 0xc5f07d6f,
+0xc5e4efd9, 0xc5d465c1, 0xc5d6dbe9, 0xb0557ff9,
+0x99e8698f, 0xf9c5f045, 0x02e2356f, 0xf9c50000,
+0xc5f07d6f, 0xc5fef9c1, 0xf07d7ff9, 0x99e8e98f,
+0x21b8f055, 0xc5000006, 0xc4fafde9, 0xf87541c1,
+0x1779e2c4, 0x9a830ff9, 0xc5000002, 0xf07df9d9,
+0x000626b8, 0x40e98f00, 0xe9c5d299, 0xc4b05575,
+0xd11779e2, 0x027b830f, 0xd1c50000, 0xc5d055d5,
+0xc5fbd5d1, 0xa0557ff9, 0x55eec1c5, 0xeac1c5a0,
+0xf9c5a07d, 0xc5a07d7f, 0xa055fde9, 0x7dfde1c5,
+0x063db8d0, 0xe9c50000, 0xe9c5d5d5, 0xe2c4d775,
+0x0fd11779, 0x00023c83, 0xd5d1c500, 0x7ff9c5eb,
+0xe2c4906d, 0x90551d79, 0xda75e1c5, 0x000644b8,
+0x79e2c400, 0x830fd917, 0x00000219, 0x5d6ff9c5,
+0x0649b8e0, 0xe2c40000, 0xc5d30949, 0xc4d275e1,
+0xd11779e2, 0x01fb830f, 0xfbc50000, 0x1bc05570,
+0x6d6ff9c5, 0x064eb8d0, 0xfac50000, 0xc51bd270,
+0x4ed270f9, 0xd275d1c5, 0x1779e2c4, 0xd2830fd1,
+0xc5000001, 0x01f571c1, 0x556ff9c5, 0x0653b8c0,
+0x41c50000, 0xc1c5c6f9, 0x01e23df9, 0x488f0000,
+0x08c0c178, 0xeb41c1c4, 0x68e88ff8, 0xc570d2a3,
+0xc4d575e9, 0xd11779e2, 0x0197830f, 0xd1c50000,
+0xc5c05561, 0xc06d69d1, 0xd5f9e9c5, 0x0006a8b8,
+0xd5e9c500, 0x75e9c5d3, 0x0001b315, 0x79e2c400,
+0x830fd117, 0x0000016d, 0x6dd5e1c5, 0x60e88fc0,
+0xc500d4cd, 0x906d7ff9, 0xea61d1c5, 0x7d6ff9c5,
+0x79e2c490, 0xd1c5e723, 0xb3b8ec75, 0xc4000006,
+0xe91779e2, 0x013b830f, 0xe9c50000, 0xd9c5d261,
+0xf9c5e261, 0xc4906d6f, 0xd52479e2, 0xd475e9c5,
+0x0006bbb8, 0x79e2c400, 0x830fd117, 0x00000115,
+0x556ff9c5, 0x458b66c0, 0xefd9c5d2, 0x65e1c5e4,
+0x7ff9c5dc, 0xe88fa055, 0xd055a268, 0x45896630,
+0x458b66a2, 0x7ff9c5d6, 0x8966b055, 0x8b66a645,
+0x8966da45, 0x8b66aa45, 0x8966de45, 0xf9c5ae45,
+0xb8a05d6f, 0x0000072a, 0xd275e1c5, 0x1779e2c4,
+0xbe830fd1, 0xc5000000, 0xc0556ff9, 0x00073ab8,
+0x69e3c400, 0xaad0650e, 0xdc75e1c5, 0x1779e2c4,
+0x9e830fd9, 0xc5000000, 0xe125dbe9, 0xc4000000,
+0xda0f69e3, 0x074ab802, 0xd9c50000, 0xe1c5e6fd,
+0xf9c5dc75, 0xc4a0657f, 0xd91779e2, 0xf9c57773,
+0xc590557f, 0xb8dbefe1, 0x00000003, 0xc678e98f,
+0xe1c59055, 0xf9c5d26b, 0xff90557f, 0xc5ed75c8,
+0x07d2c5f9, 0x00075eb8, 0xfa836600, 0x8f467524,
+0x65e278e9, 0x78e98fd0, 0xc5c055e2, 0xb8d46be9,
+0x00000767, 0xc678e98f, 0x6be9c5d2, 0x78e98fd3,
+0xe9c5d2c6, 0xe98fd36b, 0xc5d2c678, 0xc5d36be9,
+0xc5dbefe1, 0xc4d375e9, 0xd11779e2, 0xa2e80773,
+0xf7fffff9, 0x00c3c9d8, 0x00000000, 0x00000000,
+0x000e0008, 0x00140012, 0x00120014, 0x0008000e,
+0x00010001, 0x00010001, 0x00010001, 0x00010001,
+0x00020002, 0x00020002, 0x00020002, 0x00020002,
+0x00040004, 0x00040004, 0x00040004, 0x00040004,
+0x00070007, 0x00070007, 0x00070007, 0x00070007,
+0003300,
+};
+asm(".type xop_x86_64_D_16i2, STT_NOTYPE;");
+asm(".type xop_x86_64_D_16i2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_16u2[] = {
+0xb85500eb, 0x00000001, 0x000010ba, 0x09b94100,
+0x48000000, 0x8348e589, 0x708d08ec, 0xcf8944ff,
+0x45448966, 0x29f189be, 0x01e183c7, 0x457c8966,
+0x85c9ffce, 0x940f40c6, 0x4c8966c6, 0x0f40de45,
+0xf229f6b6, 0x45548966, 0xc0ff48ee, 0x09f88348,
+0xf9c5c875, 0xc5c07d6f, 0x907d7ff9, 0x5d6ff9c5,
+0x76f1c590, 0x0539b8c9, 0xe1c50000, 0xe2c4d775,
+0x0fd11779, 0x0003da83, 0xfde1c500, 0xf9c5c055,
+0xc5a0557f, 0xc0656ff9, 0x00053fb8, 0x71e9c500,
+0xe9c501f4, 0xc4a05575, 0xd11779e2, 0x03b1830f,
+0xf9c50000, 0xc5a07d6f, 0xc055f9c1, 0x557ff9c5,
+0x75e1c5b0, 0x44b8b065, 0xc4000005, 0xe11779e2,
+0x038d830f, 0xe1c50000, 0xc5d05deb, 0x905d7ff9,
+0x55dbe9c5, 0x6ff9c5d0, 0xd9c5b065, 0xc5d05def,
+0x9055dfe9, 0xe476d9c5, 0x000550b8, 0x75e9c500,
+0x79e2c4d3, 0x830fd117, 0x00000357, 0x556ff9c5,
+0xd5e9c5c0, 0xe1c5d05d, 0x03521d75, 0xc8b80000,
+0xc4000005, 0xd91779e2, 0x0335830f, 0xe9c50000,
+0xc5e075e4, 0xe06d6ff9, 0x0005d1b8, 0xdbe9c500,
+0xfde1c5dd, 0x75e1c5dd, 0x79e2c4de, 0x830fd917,
+0x0000030f, 0x557ff9c5, 0x6ff9c5b0, 0xd1c5b075,
+0xc503f671, 0x906d7ff9, 0x7d6ff9c5, 0x71e1c5b0,
+0xf9c502f7, 0xc5a05d7f, 0xb8dbfde1, 0x000005ed,
+0xdd75e1c5, 0x1779e2c4, 0xd4830fd9, 0xc5000002,
+0x90756ff9, 0xd671e1c5, 0xfde1c502, 0x05f2b8db,
+0xe1c50000, 0xc4a05d75, 0xd91779e2, 0x02b1830f,
+0x45c70000, 0x0000038c, 0x6ef9c500, 0xe9c58c5d,
+0x45c7dbf1, 0x0000028c, 0x6ef9c500, 0xe9c58c6d,
+0xf9c5edf1, 0xc5a06d7f, 0xb8edfdd1, 0x00000605,
+0xeb75d1c5, 0x1779e2c4, 0x74830fe9, 0xc5000002,
+0x8c6d6ef9, 0xddd1e1c5, 0xdbfde1c5, 0x000609b8,
+0x75e1c500, 0xe2c4a05d, 0x0fd91779, 0x00025283,
+0x6ff9c500, 0xc9c5f07d, 0xe88ff6ef, 0x05decd40,
+0xdadbe1c5, 0x99e0698f, 0xd9c5f045, 0xc5f06dfd,
+0xf06d7ff9, 0x99e0e98f, 0x21b8f06d, 0xc5000006,
+0xc4fdfdd1, 0xf87541c1, 0x1779e2c4, 0x10830ff9,
+0xc5000002, 0xf075f9c9, 0x000626b8, 0x48e98f00,
+0xe1c5ed95, 0xe2c4dd75, 0x0fd91779, 0x0001f283,
+0x69e2c400, 0xc4d05d3a, 0x6d3e69e2, 0xfde9c5d0,
+0xe1c5d055, 0x34b8ddfd, 0xc5000006, 0xc4d275e1,
+0xd11779e2, 0x01c9830f, 0xf9c50000, 0x01de2d6f,
+0xf9c50000, 0xb8e0756f, 0x00000649, 0x0951e2c4,
+0x75e9c5d6, 0x79e2c4d6, 0x830fd117, 0x000001a3,
+0x5d70fbc5, 0xf9c51bc0, 0xb8d0556f, 0x0000064e,
+0xdb70fac5, 0x70f9c51b, 0xe9c54edb, 0xe2c4db75,
+0x0fd91779, 0x00017a83, 0x71c1c500, 0xf9c501f2,
+0xb8c05d6f, 0x00000653, 0xc5f941c5, 0x3dfdc1c5,
+0x0000018c, 0xc178488f, 0xc1c408c0, 0x8ff8eb41,
+0xdba360e8, 0x75e1c570, 0x79e2c4da, 0x830fd917,
+0x0000013f, 0x5d61e9c5, 0x69e9c5c0, 0xd9c5c055,
+0xa8b8d2fd, 0xc5000006, 0xc5d3f9e9, 0xc5d6efe9,
+0xc5f4efc9, 0xc5d6f9e9, 0x511575e9, 0xc4000001,
+0xd11779e2, 0x0109830f, 0xe2c40000, 0xc05d3379,
+0x3379e2c4, 0x7ff9c5d3, 0xf9c5b055, 0xc4c0656f,
+0xd43379e2, 0xd375e9c5, 0x0006d3b8, 0x79e2c400,
+0x830fd117, 0x000000db, 0x656ff9c5, 0x79e2c4c0,
+0xe9c5d434, 0xb8b05575, 0x000006da, 0x1779e2c4,
+0xbc830fd1, 0xc5000000, 0xc0556ff9, 0xd2458b66,
+0x756ff9c5, 0x7ff9c5e0, 0xe88fa055, 0xd055a268,
+0x45896660, 0x458b66a2, 0x458966d6, 0x458b66a6,
+0x458966da, 0x458b66aa, 0x458966de, 0x6ff9c5ae,
+0x2ab8a05d, 0xc5000007, 0xc4d275e1, 0xd11779e2,
+0xf9c57173, 0xb8c0556f, 0x0000073a, 0x0e69e3c4,
+0xc5aad065, 0xc4dc75e1, 0xd91779e2, 0xe9c55573,
+0x009a25db, 0xe3c40000, 0x02da0f69, 0x00074ab8,
+0xfdd9c500, 0x75e1c5e5, 0x79e2c4dc, 0x3373d917,
+0x557ff9c5, 0x0003ba90, 0xe9c50000, 0xe98fd2ef,
+0x904dd678, 0x2b69e2c4, 0x7ff9c5c9, 0xcaff904d,
+0xf9c5ec75, 0x6607c1c5, 0xb824f883, 0x0000075e,
+0xc9c2440f, 0x000000c3, 0x00000000, 0x00000000,
+0x000e0008, 0x00140012, 0x00120014, 0x0008000e,
+0x00010001, 0x00010001, 0x00010001, 0x00010001,
+0xfffefffe, 0xfffefffe, 0xfffefffe, 0xfffefffe,
+0x00040004, 0x00040004, 0x00040004, 0x00040004,
+0x00070007, 0x00070007, 0x00070007, 0x00070007,
+0002260,
+};
+asm(".type xop_x86_64_D_16u2, STT_NOTYPE;");
+asm(".type xop_x86_64_D_16u2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_16i4[] = {
+0x000160e9, 0x01b84800, 0x02000000, 0x55000000,
+0x48e58948, 0x48d04589, 0x000003b8, 0x00000400,
+0x45894800, 0x0001b8d8, 0xc148c000, 0x894802e0,
+0x01b8e045, 0x48800000, 0x8948c001, 0xff48e845,
+0x458948c8, 0x458948f0, 0x6ff9c5f8, 0xe88fe04d,
+0xd0559e70, 0x76e1c510, 0x00a7b8db, 0xe9c50000,
+0x05aa1576, 0xe2c40000, 0x0fd31779, 0x0000f283,
+0xefc9c500, 0x00abb8f6, 0xc9c50000, 0xe2c4d1fa,
+0xd0654069, 0xe1fad9c5, 0x2576d9c5, 0x00000590,
+0x1779e2c4, 0xc8830fe3, 0xc4000000, 0x654071e2,
+0xfad9c5d0, 0x00afb8e1, 0xd9c50000, 0x057e2576,
+0xe2c40000, 0x0fe31779, 0x0000a683, 0x68e88f00,
+0x10d0559e, 0x0000b3b8, 0x76e9c500, 0x00056f15,
+0x79e2c400, 0x830fd317, 0x00000087, 0x656ff9c5,
+0xfed9c5d0, 0x59e2c4f9, 0xc5f05540, 0xe055fee9,
+0x0000bbb8, 0x76e9c500, 0x79e2c4d7, 0x6373d317,
+0xd4fac9c5, 0x4069e2c4, 0xd1c5f06d, 0xb8e06dfa,
+0x000000c0, 0xf7fac9c5, 0xee76d1c5, 0x1779e2c4,
+0xc44073eb, 0x6d4059e2, 0xfad1c5f0, 0xd9c5e06d,
+0xc5b8f1fa, 0xc5000000, 0xc4ee76d1, 0xeb1779e2,
+0xe2c42173, 0xf0554069, 0x55fee9c5, 0xfaf1c5e0,
+0x00cab8cc, 0xe9c50000, 0xe2c4d176, 0x73d31779,
+0x5dc03102, 0x01b855c3, 0xb9000000, 0x00000020,
+0x0005b941, 0x89480000, 0xc48348e5, 0xff788d80,
+0x89c88945, 0x89bc8544, 0xc02941fa, 0x4401e283,
+0xcc854489, 0x1901fa83, 0x02e283d2, 0xf885caff,
+0xc7940f40, 0xdc855489, 0xffb60f40, 0x4c89f929,
+0xff48ec85, 0xf88348c0, 0xc5c27505, 0xc07d6ff9,
+0x7d7ff9c5, 0x6ff9c590, 0xf1c59055, 0x39b8c976,
+0xc5000005, 0xc4df76e9, 0xd91779e2, 0x041f830f,
+0xe9c50000, 0xc5c05dfe, 0xa05d7ff9, 0x7d6ff9c5,
+0x053fb8c0, 0xe1c50000, 0xc501f772, 0xa05d76e1,
+0x1779e2c4, 0xf6830fd9, 0xc5000003, 0xa0756ff9,
+0x5dfac9c5, 0x7ff9c5c0, 0xe9c5b05d, 0xb8b05d76,
+0x00000544, 0x1779e2c4, 0xd2830fd9, 0xc5000003,
+0xd05d6ff9, 0x4069e2c4, 0xe2c4c055, 0xc5e34061,
+0xc05d6ff9, 0x75fee1c5, 0xfae1c5d0, 0xe9c5d06d,
+0x5bb8d4fa, 0xc4000005, 0xee4051e2, 0xd576e9c5,
+0x1779e2c4, 0x96830fd1, 0xc4000003, 0x554061e2,
+0x76e9c5d0, 0x0003d715, 0x05c8b800, 0xe2c40000,
+0x0fd11779, 0x00037883, 0xefe1c500, 0xf9c5e055,
+0xf9c5d07e, 0xc490557f, 0x552869e2, 0x556348d0,
+0x489848d0, 0x48c2af0f, 0x48d85563, 0x48b04589,
+0x48984563, 0x48c2af0f, 0xb8b84589, 0x000005e1,
+0x5576e9c5, 0x79e2c4b0, 0x830fd117, 0x00000331,
+0x4061e2c4, 0xf9c5e065, 0xc5b0657f, 0xb07d6ff9,
+0xf772d1c5, 0x7ff9c503, 0xf9c5906d, 0xc5b0756f,
+0x02f672e9, 0x557ff9c5, 0xfee9c5a0, 0x05edb8d2,
+0xe9c50000, 0xe2c4d576, 0x0fd11779, 0x0002f083,
+0x6ff9c500, 0xe9c5907d, 0xc502e772, 0xb8d2fee9,
+0x000005f2, 0x5576e9c5, 0x79e2c4a0, 0x830fd117,
+0x000002cd, 0x038c45c7, 0x48000000, 0xc48c4563,
+0xd06ef9e1, 0xd2f2d9c5, 0x028c45c7, 0x48000000,
+0xc48c4563, 0xf06ef9e1, 0xe6f2d9c5, 0x657ff9c5,
+0xfed9c5a0, 0x0605b8e4, 0xd9c50000, 0xe2c4e276,
+0x0fe11779, 0x00028883, 0x45634800, 0xf9e1c48c,
+0xe9c5f86e, 0xe9c5d7e2, 0x09b8d2fe, 0xc5000006,
+0xa05576e9, 0x1779e2c4, 0x62830fd1, 0xc5000002,
+0xf0756ff9, 0xe4efd9c5, 0x4061e2c4, 0xc9c5e06d,
+0xe9c5d466, 0xf9c5d5db, 0x8fb0557f, 0x759ae8e9,
+0x6ff9c5f0, 0x0002972d, 0x6ff9c500, 0xc1c5f07d,
+0xf9c5fdfa, 0x8ff07d7f, 0x559ae8e9, 0x0621b8f0,
+0xe9c50000, 0xc1c5fafe, 0xe2c4f676, 0x0ff11779,
+0x00020c83, 0xfad9c500, 0x26b8f075, 0x8f000006,
+0xd29a48e9, 0x5576e9c5, 0x79e2c4b0, 0x830fd117,
+0x000001ed, 0x756ff9c5, 0x49e2c4e0, 0xc5d05540,
+0xa0557ff9, 0x4049e2c4, 0x41e2c4fb, 0xc4a0553d,
+0x7d3941e2, 0x7ff9c5a0, 0xe9c5a07d, 0xc5a055fe,
+0xd07dfee1, 0x00063db8, 0x69e2c400, 0xe9c5d640,
+0xe2c4d776, 0x0fd11779, 0x0001a483, 0x49e2c400,
+0xf9c5f340, 0xc490757f, 0x551e79e2, 0x76e1c590,
+0x0644b8da, 0xe2c40000, 0x0fd91779, 0x00018083,
+0x6ff9c500, 0x49b8e055, 0xc4000006, 0xea0a51e2,
+0xed76e9c5, 0x1779e2c4, 0x62830fe9, 0xc5000001,
+0xd06d6ff9, 0x5d70f9c5, 0x4eb81bc0, 0xc5000006,
+0xc4db76d1, 0xd91779e2, 0x0143830f, 0xd1c50000,
+0xc5c05d62, 0xc06d6ad1, 0xddfae1c5, 0x0006a8b8,
+0x61e2c400, 0xe1c5da40, 0x01921d76, 0xe2c40000,
+0x0fd91779, 0x00011883, 0x69e2c400, 0x8fc05d40,
+0xecce68e8, 0x7ff9c500, 0xe1c5905d, 0xf9c5ed62,
+0xc490756f, 0xde2579e2, 0xdd76e1c5, 0x0006b3b8,
+0x79e2c400, 0x830fd917, 0x000000e5, 0x5d6ff9c5,
+0xd4458bc0, 0xd466e9c5, 0xa260e88f, 0xc520d055,
+0xb0557ff9, 0x5d7ff9c5, 0xa44589a0, 0x89dc458b,
+0xf9c5ac45, 0xb8a05d6f, 0x0000072a, 0xd276e1c5,
+0x1779e2c4, 0xa6830fd1, 0xc5000000, 0xc0556ff9,
+0x00073ab8, 0x69e3c400, 0xccd0650e, 0xdc76e1c5,
+0x1779e2c4, 0x86830fd9, 0xc5000000, 0xfd25dbe9,
+0xc4000000, 0xda0f69e3, 0x074ab804, 0xd9c50000,
+0x00ca25fe, 0xe1c50000, 0xf9c5dc76, 0xc4a0657f,
+0xd91779e2, 0xf9c55b73, 0xc590557f, 0xc4dbefe1,
+0x550261e2, 0x7ff9c590, 0xe2c49055, 0x90550261,
+0x00075eb8, 0x79e3c400, 0xc503d216, 0x90557ff9,
+0x750afa83, 0x6ff9c52c, 0xe2c4c07d, 0xd0550641,
+0x000767b8, 0x69e2c400, 0xe2c4d302, 0xc5d30269,
+0xc4d376e9, 0xd11779e2, 0x06e80773, 0xf7fffffa,
+0x00c3c9d8, 0x00000000, 0x00000000, 0x00000000,
+0x00000008, 0x00000009, 0x00000008, 0x00000005,
+0xfffffff8, 0xfffffff7, 0xfffffff8, 0xfffffffb,
+0x00000000, 0x00000003, 0x00000004, 0x00000003,
+0x00000000, 0xfffffffd, 0xfffffffc, 0xfffffffd,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x00000002, 0x00000002, 0x00000002, 0x00000002,
+0x00000003, 0x00000003, 0x00000003, 0x00000003,
+0003220,
+};
+asm(".type xop_x86_64_D_16i4, STT_NOTYPE;");
+asm(".type xop_x86_64_D_16i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_16u4[] = {
+0x315500eb, 0x0020bac0, 0xb9410000, 0x00000004,
+0x48e58948, 0x8908ec83, 0x01708dc1, 0x45cf8944,
+0xe183c031, 0x89c72901, 0xffc08574, 0x89c685c9,
+0x41d0857c, 0x89c0940f, 0x44e0854c, 0x5489c229,
+0xff48f085, 0xf88348c0, 0xc5cc7504, 0xc07d6ff9,
+0x7d7ff9c5, 0x6ff9c590, 0xf1c5905d, 0x39b8c976,
+0xc5000005, 0xc4d776e1, 0xd11779e2, 0x039b830f,
+0xe1c50000, 0xc5c055fe, 0xa0557ff9, 0x7d6ff9c5,
+0x053fb8c0, 0xe9c50000, 0xc501f772, 0xa05576e9,
+0x1779e2c4, 0x72830fd1, 0xc5000003, 0xa07d6ff9,
+0x55fac1c5, 0x7ff9c5c0, 0xe1c5b055, 0xb8b06576,
+0x00000544, 0x1779e2c4, 0x4e830fe1, 0xc5000003,
+0xd05debe1, 0x5d7ff9c5, 0xdbe9c590, 0xf9c5d055,
+0xc5b07d6f, 0xd065efc1, 0x55dfe9c5, 0x76e1c590,
+0x0550b8db, 0xe9c50000, 0xe2c4d476, 0x0fd11779,
+0x00031883, 0x6ff9c500, 0xe2c4c065, 0xd0554059,
+0x1576e9c5, 0x00000308, 0x0005c8b8, 0x79e2c400,
+0x830fd117, 0x000002f5, 0x55efd9c5, 0x7ef9c5e0,
+0x7ff9c5d0, 0xe9c59055, 0x8bd055f4, 0x0f48d055,
+0x558bc2af, 0x458948d8, 0x98458bb0, 0xc2af0f48,
+0xb8458948, 0x0005e1b8, 0x76e9c500, 0xe2c4b055,
+0x0fd11779, 0x0002b483, 0x7ff9c500, 0xf9c5b065,
+0xc5b0756f, 0x03f672d1, 0x6d7ff9c5, 0x6ff9c590,
+0xe9c5b07d, 0xc502f772, 0xa0557ff9, 0xd2fee9c5,
+0x0005edb8, 0x76e9c500, 0x79e2c4d5, 0x830fd117,
+0x00000279, 0x756ff9c5, 0x72e9c590, 0xe9c502d6,
+0xf2b8d2fe, 0xc5000005, 0xa05576e9, 0x1779e2c4,
+0x56830fd1, 0xc7000002, 0x00038c45, 0xf9c50000,
+0xc58c556e, 0xc7d2f2d9, 0x00028c45, 0xf9c50000,
+0xc58c6d6e, 0xc5edf2d9, 0xa06d7ff9, 0xedfed1c5,
+0x000605b8, 0x76d1c500, 0x79e2c4ea, 0x830fe917,
+0x00000219, 0x6d6ef9c5, 0xd2e9c58c, 0xfee9c5d5,
+0x0609b8d2, 0xe9c50000, 0xc4a05576, 0xd11779e2,
+0x01f7830f, 0xf9c50000, 0xc5f07d6f, 0x8ff6efc9,
+0xd6ce40e8, 0xdbe9c505, 0xe8e98fd4, 0xc5f07d9a,
+0xf06dfee1, 0x6d7ff9c5, 0xe8e98ff0, 0xb8f06d9a,
+0x00000621, 0xc5fe51c5, 0xff76b9c5, 0x1779e2c4,
+0xb6830ff9, 0xc5000001, 0xf075fac9, 0x000626b8,
+0x48e98f00, 0xe9c5ed96, 0xe2c4d576, 0x0fd11779,
+0x00019883, 0x59e2c400, 0xc4d0553b, 0x6d3f59e2,
+0xfed9c5d0, 0xe9c5d065, 0x34b8d5fe, 0xc5000006,
+0xc4d476e9, 0xd11779e2, 0x016f830f, 0xf9c50000,
+0x017a2d6f, 0xf9c50000, 0xb8e0656f, 0x00000649,
+0x0a51e2c4, 0x76e9c5d4, 0x79e2c4d4, 0x830fd117,
+0x00000149, 0x556ff9c5, 0x70f9c5d0, 0xb81bc075,
+0x0000064e, 0xf676e9c5, 0x1779e2c4, 0x2a830ff1,
+0xc5000001, 0xc07562e9, 0x556ae9c5, 0xfee1c5c0,
+0x06a8b8d2, 0xe9c50000, 0xe9c5d6fa, 0xd9c5d4ef,
+0xe9c5e3ef, 0xe9c5d4fa, 0x01221576, 0xe2c40000,
+0x0fd11779, 0x0000f483, 0x79e2c400, 0xc5c05d35,
+0xc0756ff9, 0x3579e2c4, 0x76e9c5d6, 0x06d3b8d3,
+0xe2c40000, 0x0fd11779, 0x0000d083, 0x6ff9c500,
+0x458bc055, 0x6ff9c5d4, 0xf9c5e07d, 0x8fa0557f,
+0x55a268e8, 0x458970d0, 0xdc458ba4, 0xc5ac4589,
+0xa05d6ff9, 0x00072ab8, 0x76e1c500, 0x79e2c4d2,
+0x830fd117, 0x00000095, 0x556ff9c5, 0x073ab8c0,
+0xe3c40000, 0xd0650e69, 0x76e1c5cc, 0x79e2c4dc,
+0x7973d917, 0x25dbe9c5, 0x000000a4, 0x0f69e3c4,
+0x4ab804da, 0xc5000007, 0xc5e5fed9, 0xc4dc76e1,
+0xd91779e2, 0xf9c55773, 0xc590557f, 0xc4dbefe1,
+0x550261e2, 0x7ff9c590, 0xe2c49055, 0x90550261,
+0x00075eb8, 0x79e3c400, 0x8303d216, 0x2d750afa,
+0x756ff9c5, 0x49e2c4c0, 0x31d05506, 0x69e2c4c0,
+0xe2c4d302, 0xc5d30269, 0xc4d376e9, 0xd11779e2,
+0x83c0920f, 0xc01901f8, 0x00076725, 0x00c3c900,
+0x00000004, 0x00000006, 0x00000006, 0x00000004,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x00000002, 0x00000002, 0x00000002, 0x00000002,
+0x00000003, 0x00000003, 0x00000003, 0x00000003,
+0002120,
+};
+asm(".type xop_x86_64_D_16u4, STT_NOTYPE;");
+asm(".type xop_x86_64_D_16u4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_16i8[] = {
+0x485500eb, 0xc748e589, 0x0001d045, 0xc7480000,
+0x0002e045, 0xc7480000, 0x003ff045, 0xc7480000,
+0x0002d845, 0xc7480000, 0x0001e845, 0xc7480000,
+0x003ef845, 0xf9c50000, 0xc5d07d6f, 0xa07d7ff9,
+0x556ff9c5, 0x76e1c5a0, 0x0539b8db, 0xe2c40000,
+0xc4cf2969, 0xcb1779e2, 0x037c830f, 0xe9c50000,
+0xc5d04dd4, 0xb04d7ff9, 0x7d6ff9c5, 0x053fb8d0,
+0xf1c50000, 0xc401f773, 0x4d2971e2, 0x79e2c4b0,
+0x830fcb17, 0x00000352, 0x6d6ff9c5, 0xfbd1c5b0,
+0xf9c5d04d, 0xc4c04d7f, 0x4d2969e2, 0x0544b8c0,
+0xe2c40000, 0x0fcb1779, 0x00032d83, 0x6ff9c500,
+0xf9c5d065, 0xc4b1ca70, 0xcc4071e2, 0xd4f4e9c5,
+0xcb78e98f, 0x73f1c5c9, 0xe9c520f1, 0xf9c5e1d4,
+0xc5e04d6f, 0xb1d170f9, 0x4069e2c4, 0xf4f1c5d1,
+0x78e98fc9, 0xe9c5d2cb, 0xc520f273, 0xc5cad4f1,
+0xd06d6ff9, 0x7dd4d1c5, 0xfbd1c5e0, 0xd9c5e075,
+0x5bb8e1fb, 0xc5000005, 0xb1d670f9, 0xf7f4c9c5,
+0x4069e2c4, 0x78e98fd7, 0xe9c5d2cb, 0xc520f273,
+0xc4f2d4c9, 0xe62959e2, 0x1779e2c4, 0xa7830fe3,
+0xc5000002, 0xe04d6ff9, 0xd570f9c5, 0x69e2c4b1,
+0xd1c5e140, 0xe98fc9f4, 0xc5e4cb78, 0x20f473d9,
+0xccd4f1c5, 0x2971e2c4, 0x0002830d, 0x05c8b800,
+0xe2c40000, 0x0fcb1779, 0x00026d83, 0x6ff9c500,
+0x00029b25, 0x69e2c400, 0xd1c5d440, 0xe98ff4f4,
+0xc5d2cb78, 0x20f273e9, 0xd2d4c9c5, 0x557ff9c5,
+0x6ff9c5c0, 0xc1c5c07d, 0xc503f773, 0xa07d7ff9,
+0x4d6ff9c5, 0x73f1c5c0, 0xf9c502f1, 0xc5b04d7f,
+0xb8c9d4f1, 0x000005ed, 0x2971e2c4, 0x79e2c4cf,
+0x830fcb17, 0x00000212, 0x0d6ff9c5, 0x00000220,
+0x9b70e98f, 0xf1c5a04d, 0xf2b8c9d4, 0xc4000005,
+0x4d2971e2, 0x79e2c4b0, 0x830fcb17, 0x000001ea,
+0x039c45c7, 0x48000000, 0xc49c4563, 0xc86ef9e1,
+0xc9f3e9c5, 0x029c45c7, 0x48000000, 0xc49c4563,
+0xf86ef9e1, 0xd7f3e9c5, 0x557ff9c5, 0xd4e9c5b0,
+0x0605b8d2, 0xe2c40000, 0xc4d12969, 0xd31779e2,
+0x01a4830f, 0x63480000, 0xc1c59c45, 0xe1c4ffef,
+0xc5d06ef9, 0xc5d26ce9, 0x8fd2fbc1, 0xc99b68e9,
+0xc9d4f1c5, 0x000609b8, 0x71e2c400, 0xc4b04d29,
+0xcb1779e2, 0x0170830f, 0xf9c50000, 0xc4b1cc70,
+0xcd4071e2, 0x6d6ff9c5, 0x78e98ff0, 0xf1c5c9cb,
+0xc520f173, 0xc4f1d4c9, 0xcf3751e2, 0xcedbf1c5,
+0x4d7ff9c5, 0xf0e98fc0, 0xb8f0559b, 0x00000001,
+0x756ff9c5, 0xf9e1c4f0, 0xd1c5e86e, 0xc9c5ed6c,
+0xf9c5edfb, 0x8ff06d7f, 0x4d9bf0e9, 0x0621b8f0,
+0xf9c50000, 0xc5b04d7f, 0xc4c9d4f1, 0xca2971e2,
+0x1779e2c4, 0xff830fcb, 0xc5000000, 0xf04dfbc1,
+0x9b70e98f, 0xf9c5b04d, 0x26b8ef6f, 0xc4000006,
+0x4d2971e2, 0x79e2c4c0, 0x830fcb17, 0x000000da,
+0x756ff9c5, 0x70f9c5e0, 0xb84ed04d, 0x0000064e,
+0x2949e2c4, 0x79e2c4c9, 0x830fcb17, 0x000000ba,
+0x4d6cc9c5, 0x6dc9c5d0, 0xf1c5d055, 0xf9c5cafb,
+0x00ca3d6f, 0xa8b80000, 0xc5000006, 0xb1d170f9,
+0xccf4f1c5, 0x4069e2c4, 0x78e98fd4, 0xe9c5d2cb,
+0xc520f273, 0xc4cad4f1, 0xcf2971e2, 0x1779e2c4,
+0xc57773cb, 0xd04d6ff9, 0xe8458b48, 0x3759e2c4,
+0x7ff9c5e5, 0x8948b04d, 0xf9c5b845, 0x8fb0556f,
+0xcea270e8, 0x072ab840, 0xe2c40000, 0xc4c92969,
+0xcb1779e2, 0xf9c54473, 0xb8d04d6f, 0x0000073a,
+0x0e71e3c4, 0xc4f0e065, 0xd42969e2, 0x1779e2c4,
+0xc42773d3, 0xd10f71e3, 0xdbf1c508, 0xc5c031cf,
+0xc4cfd4f1, 0xca2971e2, 0x1779e2c4, 0xc0920fcb,
+0x1901f883, 0x074a25c0, 0xc35d0000, 0x00000000,
+0x00000002, 0x00000000, 0x00000002, 0x00000000,
+0xfffffffe, 0xffffffff, 0xfffffffe, 0xffffffff,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0x00000001, 0x00000000, 0xffffffff, 0xffffffff,
+0002040,
+};
+asm(".type xop_x86_64_D_16i8, STT_NOTYPE;");
+asm(".type xop_x86_64_D_16i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_16u8[] = {
+0x485500eb, 0xc748e589, 0x0001d045, 0xc7480000,
+0x0002e045, 0xc7480000, 0x003ff045, 0xc7480000,
+0x0002d845, 0xc7480000, 0x0001e845, 0xc7480000,
+0x003ef845, 0xf9c50000, 0xc5d0756f, 0xa0757ff9,
+0x5d6ff9c5, 0x76f1c5a0, 0x0539b8c9, 0xe2c40000,
+0xc4d62961, 0xd11779e2, 0x02c9830f, 0xe1c50000,
+0xc5d055d4, 0xb0557ff9, 0x7d6ff9c5, 0x053fb8d0,
+0xe9c50000, 0xc401f773, 0x552969e2, 0x79e2c4b0,
+0x830fd117, 0x0000029f, 0x756ff9c5, 0xfbc9c5b0,
+0xf9c5d055, 0xc4c0557f, 0x652961e2, 0x0544b8c0,
+0xe2c40000, 0x0fe11779, 0x00027a83, 0xebe1c500,
+0xf9c5e05d, 0xc5a05d7f, 0xe055dbe9, 0x7d6ff9c5,
+0xefc1c5c0, 0xe9c5e05d, 0xe9c5d1ef, 0xb8a055db,
+0x00000550, 0x2969e2c4, 0x79e2c4d3, 0x830fd117,
+0x00000243, 0x556ff9c5, 0x6ff9c5d0, 0xf9c5e05d,
+0xc4b1e270, 0xe34059e2, 0xdbf4e9c5, 0xcb78e98f,
+0x73d9c5e4, 0xe1c520f4, 0xe2c4dcd4, 0x1d1d2961,
+0xb8000002, 0x000005c8, 0x1779e2c4, 0x04830fd9,
+0xc5000002, 0xc0557ff9, 0x756ff9c5, 0x73d9c5c0,
+0xf9c503f6, 0xc5a0657f, 0xc07d6ff9, 0xf773e1c5,
+0x7ff9c502, 0xe1c5b05d, 0xedb8dbd4, 0xc4000005,
+0xdc2961e2, 0x1779e2c4, 0xc8830fd9, 0xc5000001,
+0xa06d6ff9, 0xd573e1c5, 0xd4e1c502, 0x05f2b8db,
+0xe2c40000, 0xb05d2961, 0x1779e2c4, 0xa4830fd9,
+0xc7000001, 0x00039c45, 0xf9c50000, 0xc59c5d6e,
+0xc7dbf3e9, 0x00029c45, 0xf9c50000, 0xc59c656e,
+0xc5d4f3e9, 0xb0557ff9, 0xd2d4e9c5, 0x000605b8,
+0x69e2c400, 0xe2c4d329, 0x0fd11779, 0x00016683,
+0x6ef9c500, 0xe1c59c55, 0xe9c5d2d3, 0x09b8d2d4,
+0xc4000006, 0x552969e2, 0x79e2c4b0, 0x830fd117,
+0x00000143, 0x756ff9c5, 0xefe9c5f0, 0x48e88fd2,
+0xc505d2cf, 0xd055dbe9, 0x557ff9c5, 0xe8e98fc0,
+0xc5f05d9b, 0xf065d4f1, 0x657ff9c5, 0xe8e98ff0,
+0xb8f0559b, 0x00000621, 0x557ff9c5, 0xd4e9c5b0,
+0x69e2c4d2, 0xe2c4d329, 0x0fd11779, 0x0000f683,
+0xefe9c500, 0xfbe9c5d2, 0x26b8f055, 0x8f000006,
+0x559768e9, 0x69e2c4b0, 0xc4c05529, 0xd11779e2,
+0x00d1830f, 0xf9c50000, 0xc5e05d6f, 0xd05570f9,
+0x064eb84e, 0xe2c40000, 0xc4d22961, 0xd11779e2,
+0x00b1830f, 0xf9c50000, 0x00d22d6f, 0xe1c50000,
+0xc5d0656c, 0xd0556de1, 0xd2d4f1c5, 0x0006a8b8,
+0xfbe9c500, 0xefd1c5d4, 0xefe9c5e1, 0xfbe9c5d5,
+0x6ff9c5d4, 0x00009725, 0x69e2c400, 0xe2c4d429,
+0x73d11779, 0x6ff9c572, 0x8b48d055, 0xf9c5e845,
+0x8fb0557f, 0xd3a268e8, 0x45894850, 0x6ff9c5b8,
+0x2ab8b05d, 0xc4000007, 0xd22961e2, 0x1779e2c4,
+0xc54473d1, 0xd0556ff9, 0x00073ab8, 0x69e3c400,
+0xf0e06d0e, 0x2961e2c4, 0x79e2c4dd, 0x2773d917,
+0x0f69e3c4, 0xe9c508da, 0xc031d4db, 0xd4d4e9c5,
+0x2969e2c4, 0x79e2c4d3, 0x920fd117, 0x01f883c0,
+0x4a25c019, 0x5d000007, 0x000000c3, 0x00000000,
+0x00000002, 0x00000000, 0x00000002, 0x00000000,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+0001540,
+};
+asm(".type xop_x86_64_D_16u8, STT_NOTYPE;");
+asm(".type xop_x86_64_D_16u8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_16f4[] = {
+0xb84800eb, 0x3f800000, 0x40000000, 0xe5894855,
+0xd0458948, 0x0000b848, 0x00004040, 0x89484080,
+0xb848d845, 0x40800000, 0x40400000, 0xe0458948,
+0x000001b8, 0xe0c148fe, 0x4589481e, 0x00b848e8,
+0x003f8000, 0x48bf8000, 0x48f04589, 0xc5f84589,
+0xd07d28f8, 0x7d29f8c5, 0x28f8c5a0, 0xf1c5a055,
+0x39b8c976, 0xc5000005, 0x00dfc2e8, 0x0e79e2c4,
+0xae830fd9, 0xc5000004, 0xd05d58e8, 0x5d29f8c5,
+0x28f8c5b0, 0x3fb8d05d, 0xc5000005, 0xc5db58e0,
+0xb05dc2e0, 0x79e2c400, 0x830fd90e, 0x00000485,
+0x7d28f8c5, 0x5cc0c5b0, 0xf8c5d05d, 0xc5c05d29,
+0xc05dc2e8, 0x0544b800, 0xe2c40000, 0x0fd90e79,
+0x00046083, 0x28f8c500, 0xe8c5e05d, 0xc5d05559,
+0xc5e359e0, 0xd05d28f8, 0x7558e0c5, 0x5ce0c5e0,
+0xe8c5e06d, 0x5bb8d45c, 0xc5000005, 0xc5ee59d0,
+0x00d5c2e8, 0x0e79e2c4, 0x26830fd1, 0xc5000004,
+0xf05559e0, 0x5529f8c5, 0x5ee0c5a0, 0xe8c5f05d,
+0xb800d3c2, 0x00000564, 0x0e79e2c4, 0x02830fd1,
+0xc4000004, 0x1d1879e2, 0x00000404, 0x6d28f8c5,
+0x0567b8f0, 0xd0c50000, 0xe0c5d357, 0xc5d05d57,
+0xa05559e8, 0xd3c2e8c5, 0x79e2c400, 0x830fd10e,
+0x000003d1, 0x555bf9c5, 0x5bf8c5d0, 0xc2e8c5d2,
+0xb800d055, 0x0000056e, 0x0e79e2c4, 0xb2830fd1,
+0xc5000003, 0xd05553f8, 0x5529f8c5, 0x53f8c5a0,
+0xf8c5a055, 0xb8d05d28, 0x00000575, 0xd25bf9c5,
+0xd25bf8c5, 0xd3c2e8c5, 0x79e2c400, 0x830fd10e,
+0x00000381, 0xd359e0c5, 0x5529f8c5, 0x52f8c5a0,
+0xf8c5a055, 0xc5b05529, 0xb05528f8, 0x00057cb8,
+0x53f8c500, 0x5bf9c5e2, 0x5bf8c5e4, 0xc2e0c5e4,
+0xe2c400dc, 0x0fd90e79, 0x00034883, 0x28f8c500,
+0xf9c5d05d, 0xf8c5d25b, 0x7eb8d25b, 0xc5000005,
+0xc5e353f8, 0xc5e45bf9, 0xc5e45bf8, 0x00d4c2e8,
+0x0e79e2c4, 0x1a830fd1, 0xc5000003, 0xc5d359e0,
+0xa05529f8, 0x5551f8c5, 0x059cb8a0, 0xe8c50000,
+0xc400d3c2, 0xd10e79e2, 0x02f7830f, 0xe2c40000,
+0x19151879, 0xc5000003, 0xc5db5ee8, 0xa05d29f8,
+0x0879e3c4, 0xb80ba05d, 0x000005a4, 0x1dc2e0c5,
+0x000002fb, 0x79e2c400, 0x830fd90e, 0x000002c5,
+0x8078e98f, 0xc8c5d05d, 0xabb8f657, 0xc5000005,
+0x00dec2e0, 0x0e79e2c4, 0xa6830fd9, 0xc5000002,
+0xd05d58e8, 0xdb5ee8c5, 0x5d29f8c5, 0x78e98fa0,
+0xc5a05d80, 0xa05dc2e0, 0x05b1b800, 0xe2c40000,
+0x0fd90e79, 0x00027c83, 0x79e2c400, 0x02821d18,
+0xe0c50000, 0xc5d05d59, 0xa05d29f8, 0x0879e3c4,
+0x8f0ba05d, 0x658078e9, 0x58e0c5a0, 0x05bbb8dc,
+0xe0c50000, 0x00a05dc2, 0x0e79e2c4, 0x42830fd9,
+0xc5000002, 0xe05d59d0, 0x6559d0c5, 0x29f8c5d0,
+0xd8c5b05d, 0xc5b05d5f, 0xb0655dd8, 0x6529f8c5,
+0x58e0c5b0, 0xf8c5b05d, 0xb8d07d28, 0x0000063d,
+0x6558c0c5, 0x59e0c5e0, 0xc2e0c5dd, 0xe2c400dc,
+0x0fd90e79, 0x0001fc83, 0x79e3c400, 0x1bd05d04,
+0x00064eb8, 0xc2e0c500, 0xc400e05d, 0xd90e79e2,
+0x01df830f, 0xf8c50000, 0xb8e06528, 0x00000653,
+0xdc5bf9c5, 0x1dfee1c5, 0x00000204, 0x4849e3c4,
+0xc530d075, 0x00f6c2d8, 0x0e79e2c4, 0xb2830ff1,
+0xc5000001, 0xd07d28f8, 0x00065db8, 0x58c0c500,
+0xc2e0c5dc, 0x0001f61d, 0xe2c40000, 0x0fd90e79,
+0x00019083, 0x14d8c500, 0xd8c5d05d, 0xc5d06515,
+0xb8dc5ce0, 0x000006a6, 0xdd59e0c5, 0x1dc2e0c5,
+0x000001db, 0x79e2c400, 0x830fd90e, 0x00000165,
+0x5d12fac5, 0x79e2c4d0, 0x016a2518, 0xe0c50000,
+0xb8d05d5c, 0x00000717, 0x1879e2c4, 0x00015b35,
+0x58d8c500, 0x59d8c5e5, 0xc2e0c5e6, 0xe2c400dc,
+0x0fd90e79, 0x00012c83, 0x16fac500, 0xd0c5d05d,
+0xf8c5d258, 0xb8d06528, 0x0000071e, 0xdc5ce0c5,
+0xd659e8c5, 0xd2c2e0c5, 0x79e2c400, 0x830fd10e,
+0x00000101, 0x5510fac5, 0x29f8c5e4, 0xe0c5b065,
+0x2ab8db57, 0xc5000007, 0x01edc2e0, 0xa258e88f,
+0xc550e065, 0xb45511fa, 0x5510fac5, 0x11fac5ec,
+0xf8c5bc55, 0xc5b05528, 0x00e4c2e8, 0x0e79e2c4,
+0xbe830fe1, 0xc5000000, 0xd07d28f8, 0x00073ab8,
+0x41e3c400, 0x0ae0650c, 0xd4c2e8c5, 0x79e2c400,
+0x830fd10e, 0x0000009d, 0x7d28f8c5, 0xd0c3c5d0,
+0xf8c5e055, 0xc5d06d28, 0xe065d0d3, 0x000743b8,
+0xc2e8c500, 0xe2c400d4, 0x73d10e79, 0x28f8c578,
+0xe3c4d065, 0xe0554059, 0x0752b8f1, 0xe8c50000,
+0x00a915c2, 0xc4000000, 0xd10e79e2, 0xf8c55773,
+0xc5a06529, 0xa0557ce3, 0x5529f8c5, 0x7ce3c5a0,
+0xe8c5a055, 0xc5ffd2c6, 0x51152ef8, 0x7a000000,
+0xc52d752f, 0xd07528f8, 0x557dcbc5, 0xc5c031e0,
+0xc5d37ceb, 0xc5d37ceb, 0x00d3c2e8, 0x0e79e2c4,
+0xc0920fd1, 0x1901f883, 0x076725c0, 0x05eb0000,
+0x00075eb8, 0x00c35d00, 0x00000000, 0x00000000,
+0x80000000, 0x3e800000, 0xbf800000, 0x3f000000,
+0x41200000, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x00000003, 0x00000003, 0x00000003, 0x00000003,
+0x41a00000, 0x00000000, 0x00000000, 0x00000000,
+0x40a00000, 0x40a00000, 0x40a00000, 0x40a00000,
+0x40000000, 0x40000000, 0x40000000, 0x40000000,
+0002640,
+};
+asm(".type xop_x86_64_D_16f4, STT_NOTYPE;");
+asm(".type xop_x86_64_D_16f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_16f8[] = {
+0x485500eb, 0xfbc5e589, 0x05120d10, 0xfbc50000,
+0x04da1510, 0x8b480000, 0x0004db05, 0x11fbc500,
+0x8948c04d, 0xfbc5e845, 0xc5d05511, 0xe04d11fb,
+0x5511fbc5, 0x11fbc5c8, 0xf9c5d84d, 0xc5c07d28,
+0x907d29f9, 0x5528f9c5, 0x76f1c590, 0x0539b8c9,
+0xe9c50000, 0xc400dfc2, 0xd90f79e2, 0x0484830f,
+0xe9c50000, 0xc5c05d58, 0xa05d29f9, 0x5d28f9c5,
+0x053fb8c0, 0xe1c50000, 0xe1c5db58, 0x00a05dc2,
+0x0f79e2c4, 0x5b830fd9, 0xc5000004, 0xa07d28f9,
+0x5d5cc1c5, 0x29f9c5c0, 0xe9c5b05d, 0x00b05dc2,
+0x000544b8, 0x79e2c400, 0x830fd90f, 0x00000436,
+0x5d28f9c5, 0x59e9c5d0, 0xe1c5c055, 0xf9c5e359,
+0xc5c05d28, 0xd07558e1, 0x6d5ce1c5, 0x5ce9c5d0,
+0x055bb8d4, 0xd1c50000, 0xe9c5ee59, 0xc400d5c2,
+0xd10f79e2, 0x03fc830f, 0xe1c50000, 0xc5e05559,
+0x905529f9, 0x5d5ee1c5, 0xc2e9c5e0, 0x64b800d3,
+0xc4000005, 0xd10f79e2, 0x03d8830f, 0xf9c50000,
+0xc5e05d28, 0xe52512fb, 0xb8000003, 0x00000567,
+0xd457e1c5, 0x6557d9c5, 0x59e9c5c0, 0xe9c59055,
+0xc400d4c2, 0xd10f79e2, 0x03a8830f, 0xfbc50000,
+0xc5c055e6, 0xc5d2e6fa, 0xc055c2e9, 0x056eb800,
+0xe2c40000, 0x0fd10f79, 0x00038983, 0x5af9c500,
+0xf8c5c055, 0xf8c5d253, 0xf9c5d25a, 0xc5905529,
+0x90555af9, 0xd253f8c5, 0x6d28f9c5, 0x0575b8c0,
+0xf8c50000, 0xfbc5d25a, 0xfac5d2e6, 0xe9c5d2e6,
+0xc400d5c2, 0xd10f79e2, 0x0348830f, 0xd1c50000,
+0xf9c5d559, 0xc5905529, 0x90555af9, 0xd252f8c5,
+0xd25af8c5, 0x5529f9c5, 0x28f9c5a0, 0x7cb8a065,
+0xc5000005, 0xc5d45af9, 0xc5d253f8, 0xc5d25af8,
+0xc5d2e6fb, 0xc5d2e6fa, 0x00eac2d1, 0x0f79e2c4,
+0xff830fe9, 0xc5000002, 0xc07528f9, 0xe4e6fbc5,
+0xe4e6fac5, 0x00057eb8, 0x5af9c500, 0x53f8c5d6,
+0x5af8c5d2, 0xe6fbc5d2, 0xe6fac5d2, 0xc2d9c5d2,
+0xe2c400e2, 0x0fe10f79, 0x0002c983, 0x59c9c500,
+0x29f9c5d6, 0xf9c59055, 0xc5905551, 0x00d6c2e9,
+0x00059cb8, 0x79e2c400, 0x830fd10f, 0x000002a6,
+0x2d12fbc5, 0x000002d8, 0xf65ed1c5, 0x7529f9c5,
+0x79e3c490, 0x0b905509, 0x0005a4b8, 0xc2e9c500,
+0x0002ba15, 0xe2c40000, 0x0fd10f79, 0x00027583,
+0x78e98f00, 0xc5c05581, 0xb8f657c9, 0x000005ab,
+0xd6c2e9c5, 0x79e2c400, 0x830fd10f, 0x00000256,
+0x5558d1c5, 0x5ed1c5c0, 0x29f9c5d2, 0xe98f9055,
+0x90558178, 0x55c2e9c5, 0xb1b80090, 0xc4000005,
+0xd10f79e2, 0x022c830f, 0xfbc50000, 0x02461512,
+0xe9c50000, 0xc5c05559, 0x905529f9, 0x0979e3c4,
+0x8f0b9055, 0x658178e9, 0x58e9c590, 0x05bbb8d4,
+0xe9c50000, 0x009055c2, 0x0f79e2c4, 0xf3830fd1,
+0xc5000001, 0xd05559e1, 0x6559e1c5, 0x29f9c5c0,
+0xd9c5a055, 0xc5a0555f, 0xa0655dd9, 0x6529f9c5,
+0x58e9c5a0, 0xf9c5a055, 0xb8c07d28, 0x0000063d,
+0x6558c1c5, 0x59e9c5d0, 0xc2e9c5d3, 0xe2c400d4,
+0x0fd10f79, 0x0001ad83, 0x79e3c400, 0x01c05505,
+0x00064eb8, 0xc2e9c500, 0xc400d055, 0xd10f79e2,
+0x0190830f, 0xf9c50000, 0xc5d05528, 0xc07d28f9,
+0x000653b8, 0xe6fbc500, 0xfed9c5e2, 0x0001bf25,
+0x79e2c400, 0xd9c5e425, 0xc501f473, 0xf0657ff9,
+0x49c9e3c4, 0xc570f075, 0x00f6c2e9, 0x0f79e2c4,
+0x4f830ff1, 0xc5000001, 0xc05516e9, 0x7d28f9c5,
+0x12c1c5c0, 0xe9c5d865, 0xa8b8d45c, 0xc5000006,
+0xc5d359e9, 0x00d5c2e9, 0x0f79e2c4, 0x23830fd1,
+0xf2000001, 0xc065120f, 0x2d12fbc5, 0x00000128,
+0xed58e1c5, 0x5528f9c5, 0x12fbc5c0, 0x00012f35,
+0x0717b800, 0xd9c50000, 0xd1c5e25c, 0xd9c5ee59,
+0xc400e5c2, 0xe10f79e2, 0x00e8830f, 0xfbc50000,
+0xc5d86510, 0xa05529f9, 0x00072ab8, 0x11fbc500,
+0xd9c5a865, 0xd9c5e457, 0x8f01dbc2, 0x55a268e8,
+0xf9c530d0, 0xc5a05d28, 0x00d2c2e1, 0x0f79e2c4,
+0xaf830fd1, 0xc5000000, 0xc07d28f9, 0x00073ab8,
+0x41e3c400, 0x02d0550d, 0xdac2e1c5, 0x79e2c400,
+0x830fd90f, 0x0000008e, 0x7d28f9c5, 0xd0c1c5c0,
+0xf9c5d055, 0xc5c07d28, 0xd05dd0c1, 0x000743b8,
+0xc2e9c500, 0xe2c400d3, 0x73d10f79, 0x28f9c569,
+0xe3c4c05d, 0xd0554161, 0x0752b831, 0xe9c50000,
+0x00a915c2, 0xc4000000, 0xd10f79e2, 0xf9c54873,
+0xc5905d29, 0x90557cd9, 0xd215e9c5, 0x152ef9c5,
+0x00000064, 0x29752b7a, 0x7d28f9c5, 0x7dc1c5c0,
+0xc031d055, 0xd47ce9c5, 0xd4c2e9c5, 0x79e2c400,
+0x920fd10f, 0x01f883c0, 0x6725c019, 0xeb000007,
+0x075eb805, 0xc35d0000, 0x00000000, 0x00000000,
+0x00000000, 0x40000000, 0x00000000, 0xbff00000,
+0x00000000, 0x80000000, 0x00000000, 0x3fd00000,
+0x00000000, 0x3fe00000, 0x00000000, 0x40080000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0x00000000, 0x40100000, 0x00000000, 0x00000000,
+0002520,
+};
+asm(".type xop_x86_64_D_16f8, STT_NOTYPE;");
+asm(".type xop_x86_64_D_16f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_32i1[] = {
+0x48552beb, 0x8348e589, 0xfdc5e0e4, 0xe024447f,
+0x24448d48, 0xe28948e0, 0x75ff3880, 0xc0ff480c,
+0x75d03948, 0xeb01b0f3, 0xc9c03102, 0x548d4cc3,
+0x83480824, 0x01b8e0e4, 0x40000000, 0xff4121b7,
+0x08bef872, 0x55000000, 0x41e58948, 0x41564157,
+0x41544155, 0x81485352, 0x0001a0ec, 0x8dfa8900,
+0x8488ff48, 0xffff4f05, 0x88c229ff, 0xff6f0594,
+0xca89ffff, 0x8301e283, 0xd21901fa, 0xe283c121,
+0x83caff02, 0xde8301f9, 0x05548800, 0x7488408f,
+0xff48af05, 0xf88348c0, 0xc5c27521, 0x50bd6ffd,
+0xc5ffffff, 0xf0bd7ffd, 0x8afffffe, 0xfffef085,
+0x50853aff, 0x88ffffff, 0xfffed085, 0xc0940fff,
+0x8588d8f7, 0xfffffe74, 0xfef1858a, 0x853affff,
+0xffffff51, 0xfecc8588, 0x940fffff, 0x88d8f7c0,
+0xfffe7a85, 0xf2858aff, 0x3afffffe, 0xffff5285,
+0xc88588ff, 0x0ffffffe, 0xd8f7c094, 0xfe708588,
+0x858affff, 0xfffffef3, 0xff53853a, 0x8588ffff,
+0xfffffec4, 0xf7c0940f, 0x798588d8, 0x8afffffe,
+0xfffef485, 0x54853aff, 0x88ffffff, 0xfffec085,
+0xc0940fff, 0x8588d8f7, 0xfffffe6c, 0xfef5858a,
+0x853affff, 0xffffff55, 0xfebc8588, 0x940fffff,
+0x88d8f7c0, 0xfffe7885, 0xf6858aff, 0x3afffffe,
+0xffff5685, 0xb88588ff, 0x0ffffffe, 0xd8f7c094,
+0xfe688588, 0x858affff, 0xfffffef7, 0xff57853a,
+0x8588ffff, 0xfffffeb4, 0xf7c0940f, 0x678588d8,
+0x8afffffe, 0xfffef885, 0x58853aff, 0x88ffffff,
+0xfffeb085, 0xc0940fff, 0x8588d8f7, 0xfffffe60,
+0xfef9858a, 0x853affff, 0xffffff59, 0xfeac8588,
+0x940fffff, 0x88d8f7c0, 0xfffe6685, 0xfa858aff,
+0x3afffffe, 0xffff5a85, 0xa88588ff, 0x0ffffffe,
+0xd8f7c094, 0xfe5c8588, 0x858affff, 0xfffffefb,
+0xff5b853a, 0x8588ffff, 0xfffffea4, 0xf7c0940f,
+0x658588d8, 0x8afffffe, 0xfffefc85, 0x5c853aff,
+0x88ffffff, 0xfffea085, 0xc0940fff, 0x8588d8f7,
+0xfffffe58, 0xfefd858a, 0x853affff, 0xffffff5d,
+0xfe9c8588, 0x940fffff, 0x88d8f7c0, 0xfffe6485,
+0xfe858aff, 0x3afffffe, 0xffff5e85, 0x988588ff,
+0x0ffffffe, 0xd8f7c094, 0xfe548588, 0x858affff,
+0xfffffeff, 0xff5f853a, 0x8588ffff, 0xfffffe94,
+0xf7c0940f, 0x538588d8, 0x8afffffe, 0xffff0085,
+0x60853aff, 0x40ffffff, 0xff09b58a, 0x8588ffff,
+0xfffffe90, 0xf7c0940f, 0xb58840d8, 0xfffffe81,
+0xfe4c8588, 0x858affff, 0xffffff01, 0xff61853a,
+0x8588ffff, 0xfffffe8c, 0xf7c0940f, 0x528588d8,
+0x8afffffe, 0xffff0285, 0x62853aff, 0x88ffffff,
+0xfffe8885, 0x940f41ff, 0x03858ac1, 0x41ffffff,
+0x853ad9f7, 0xffffff63, 0xfe878588, 0x0f41ffff,
+0x858ac794, 0xffffff04, 0x6e7941c4, 0xdff741c9,
+0xff64853a, 0x8588ffff, 0xfffffe86, 0x8ac1940f,
+0xffff0585, 0x3143c4ff, 0xf701cf20, 0x65853ad9,
+0x88ffffff, 0xfffe8585, 0x940f41ff, 0x06858ac6,
+0x41ffffff, 0x853adef7, 0xffffff66, 0xfe848588,
+0x0f41ffff, 0x858ac094, 0xffffff07, 0x3ad8f741,
+0xffff6785, 0x838588ff, 0x41fffffe, 0x8ac5940f,
+0xffff0885, 0xddf741ff, 0xff68853a, 0x8588ffff,
+0xfffffe82, 0xf7c0940f, 0xb53a40d8, 0xffffff69,
+0x0ab58a40, 0xc5ffffff, 0x74956ef9, 0x41fffffe,
+0x44c4940f, 0xff0f958a, 0xe3c4ffff, 0x7a952069,
+0x01fffffe, 0x856e79c5, 0xfffffe70, 0x40dcf741,
+0xff6ab53a, 0x8840ffff, 0xfffe80b5, 0x6ef9c5ff,
+0xfffe6ca5, 0xb58a40ff, 0xffffff0b, 0xc7940f40,
+0x203963c4, 0xfffe7985, 0x884401ff, 0xfffe7b95,
+0x40dff7ff, 0xff6bb53a, 0xe3c4ffff, 0x78a52059,
+0x01fffffe, 0x7fb58840, 0x0ffffffe, 0x8a40c394,
+0xffff0cb5, 0x6ef9c5ff, 0xfffe68bd, 0x40dbf7ff,
+0xff6cb53a, 0xe3c4ffff, 0x67bd2041, 0x01fffffe,
+0x7eb58840, 0x0ffffffe, 0x8a40c294, 0xffff0db5,
+0x6ef9c5ff, 0xfffe608d, 0xc5daf7ff, 0x40e761d9,
+0xff6db53a, 0x8840ffff, 0xfffe7db5, 0x940f41ff,
+0xb58a40c3, 0xffffff0e, 0xb56ef9c5, 0xfffffe5c,
+0xc4dbf741, 0xd06169c1, 0x6eb53a40, 0x40ffffff,
+0xfe7cb588, 0x0f40ffff, 0xe9c5c694, 0xe3c4d462,
+0x65b52049, 0x01fffffe, 0xe26ef9c5, 0x6e7941c4,
+0x6ef9c5c0, 0xc4def7ff, 0x8d2071e3, 0xfffffe66,
+0x953a4401, 0xffffff6f, 0x9d6ef9c5, 0xfffffe58,
+0xc2940f41, 0x203943c4, 0xe3c401c5, 0x649d2061,
+0x01fffffe, 0xad6ef9c5, 0xfffffe54, 0xce61f1c5,
+0xc5daf741, 0xc4f66ef9, 0xfb2041e3, 0x51e3c401,
+0xfe53ad20, 0xc401ffff, 0xe32059c3, 0x49c3c401,
+0xc501f220, 0xc5dd61e1, 0xc5e96ef9, 0xc5e661d9,
+0xc5cb62f1, 0x4c9d6ef9, 0xc4fffffe, 0xee2051c3,
+0x6ce9c501, 0x6ef9c5d1, 0x51c1c4c8, 0xe3c4e861,
+0x529d2061, 0x01fffffe, 0x2071c3c4, 0xf1c501cc,
+0xc1c4cf61, 0xc5d96161, 0xc5cc62f1, 0xc5dd62e1,
+0xc4c96ce1, 0xc1186de3, 0xfab4e801, 0xc289ffff,
+0x000539b8, 0x0fd28400, 0x001b6e84, 0x6ff9c500,
+0xfffef0bd, 0x6ff9c5ff, 0xffff00b5, 0xfcc1c5ff,
+0xffff508d, 0xfcc9c5ff, 0xffff6095, 0x75e3c4ff,
+0xc501ca18, 0x108d7ffd, 0xc5ffffff, 0x50956ff9,
+0xc5ffffff, 0x608d6ff9, 0xc5ffffff, 0xc5d2fce9,
+0xc4c9fcf1, 0xd01479e3, 0x10853800, 0xc4ffffff,
+0xca1479e3, 0xc0940f09, 0x1479e3c4, 0xc3c40dce,
+0x0fca1479, 0x8588d8f7, 0xfffffe74, 0x1479e3c4,
+0x853801d0, 0xffffff11, 0xf7c0940f, 0x7a8588d8,
+0xc4fffffe, 0xd01479e3, 0x12853802, 0x0fffffff,
+0xd8f7c094, 0xfe708588, 0xe3c4ffff, 0x03d01479,
+0xff138538, 0x940fffff, 0x88d8f7c0, 0xfffe7985,
+0x79e3c4ff, 0x3804d014, 0xffff1485, 0xc0940fff,
+0x8588d8f7, 0xfffffe6c, 0x1479e3c4, 0x853805d0,
+0xffffff15, 0xf7c0940f, 0x788588d8, 0xc4fffffe,
+0xd01479e3, 0x16853806, 0x0fffffff, 0xd8f7c094,
+0xfe688588, 0xe3c4ffff, 0x07d01479, 0xff178538,
+0x940fffff, 0x88d8f7c0, 0xfffe6785, 0x79e3c4ff,
+0x3808d014, 0xffff1885, 0xc0940fff, 0x8588d8f7,
+0xfffffe60, 0x1479e3c4, 0x853809d0, 0xffffff19,
+0xf7c0940f, 0x668588d8, 0xc4fffffe, 0xd01479e3,
+0x1a85380a, 0x0fffffff, 0xd8f7c094, 0xfe5c8588,
+0xe3c4ffff, 0x0bd01479, 0xff1b8538, 0x940fffff,
+0x88d8f7c0, 0xfffe6585, 0x79e3c4ff, 0x380cd014,
+0xffff1c85, 0xc0940fff, 0x8588d8f7, 0xfffffe58,
+0x1479e3c4, 0x85380dd0, 0xffffff1d, 0xf7c0940f,
+0x648588d8, 0xc4fffffe, 0xd01479e3, 0x1e85380e,
+0x0fffffff, 0xd8f7c094, 0xfe548588, 0xe3c4ffff,
+0x0fd01479, 0xff1f8538, 0xf9c5ffff, 0xfe74956e,
+0x940fffff, 0x6e79c5c0, 0xfffe7085, 0x69e3c4ff,
+0xfe7a9520, 0xf701ffff, 0x6ef9c5d8, 0xfffe6ca5,
+0x3963c4ff, 0xfe798520, 0x8801ffff, 0xfffe5385,
+0x79e3c4ff, 0x3800c814, 0xffff2085, 0x6ef9c5ff,
+0xfffe68bd, 0xc0940fff, 0x6169c1c4, 0x41e3c4d0,
+0xfe67bd20, 0xf701ffff, 0x6ef9c5d8, 0xfffe5cb5,
+0x59e3c4ff, 0xfe78a520, 0xc401ffff, 0xb52049e3,
+0xfffffe65, 0x4c858801, 0xc4fffffe, 0xc81479e3,
+0x21853801, 0xc5ffffff, 0x0fe761d9, 0xe9c5c094,
+0xd8f7d462, 0xfe528588, 0xe3c4ffff, 0x02c81479,
+0xff228538, 0xe3c4ffff, 0x03c81479, 0xc1940f41,
+0x38d9f741, 0xffff2385, 0x79e3c4ff, 0x4104c814,
+0xc4c7940f, 0xc96e7941, 0x38dff741, 0xffff2485,
+0x79e3c4ff, 0x0f05c814, 0x43c4c194, 0x01cf2031,
+0x8538d9f7, 0xffffff25, 0x1479e3c4, 0x0f4106c8,
+0xf741c694, 0x268538de, 0xc4ffffff, 0xc81479e3,
+0x940f4107, 0xd8f741c0, 0xff278538, 0xe3c4ffff,
+0x08c81479, 0xc5940f41, 0x6e7941c4, 0xddf741c0,
+0xff288538, 0x940fffff, 0x3943c4c0, 0xf701c520,
+0x299538d8, 0xc4ffffff, 0xca1479e3, 0x940f410a,
+0xdcf741c4, 0xff2a9538, 0xe3c4ffff, 0x0bca1479,
+0xc7940f40, 0x9538dff7, 0xffffff2b, 0x1479e3c4,
+0x940f0cca, 0x6ef9c5c3, 0x38dbf7ff, 0xffff2c95,
+0xc2940fff, 0x2041e3c4, 0xdaf701fb, 0x2db53840,
+0xc4ffffff, 0xce1479e3, 0x940f410e, 0x6ef9c5c3,
+0xfffe608d, 0x6ef9c5ff, 0x71e3c4e2, 0xfe668d20,
+0x4101ffff, 0x3840dbf7, 0xffff2eb5, 0x940f40ff,
+0x59c3c4c6, 0xf701e320, 0x953844de, 0xffffff2f,
+0xce61f1c5, 0x9d6ef9c5, 0xfffffe58, 0xc2940f41,
+0xf66ef9c5, 0x2061e3c4, 0xfffe649d, 0xf9c501ff,
+0xfe54ad6e, 0xf741ffff, 0x51e3c4da, 0xfe53ad20,
+0xc401ffff, 0xf22049c3, 0x61d9c501, 0x61e1c5e6,
+0x6ef9c5dd, 0x62f1c5e9, 0x6ef9c5cb, 0xfffe4c9d,
+0x51c3c4ff, 0xc501ee20, 0xc5d16ce9, 0xc4c86ef9,
+0xe86151c1, 0x2061e3c4, 0xfffe529d, 0xc3c401ff,
+0x01cc2071, 0xcf61f1c5, 0x6161c1c4, 0x62f1c5d9,
+0x62e1c5cc, 0x6ce1c5dd, 0x6de3c4c9, 0xe801c118,
+0xfffff68e, 0x3fb8c289, 0x84000005, 0x48840fd2,
+0xc5000017, 0x10bd6ff9, 0xc5ffffff, 0x20b56ff9,
+0xc5ffffff, 0x508df8c1, 0xc5ffffff, 0x6095f8c9,
+0xc4ffffff, 0xca1875e3, 0x7ffdc501, 0xffff308d,
+0xd0858aff, 0x3afffffe, 0xffff3085, 0xc0940fff,
+0x8588d8f7, 0xfffffed0, 0xfecc858a, 0x853affff,
+0xffffff31, 0xf7c0940f, 0xcc8588d8, 0x8afffffe,
+0xfffec885, 0x32853aff, 0x0fffffff, 0xd8f7c094,
+0xfec88588, 0x858affff, 0xfffffec4, 0xff33853a,
+0x940fffff, 0x88d8f7c0, 0xfffec485, 0xc0858aff,
+0x3afffffe, 0xffff3485, 0xc0940fff, 0x8588d8f7,
+0xfffffec0, 0xfebc858a, 0x853affff, 0xffffff35,
+0xf7c0940f, 0xbc8588d8, 0x8afffffe, 0xfffeb885,
+0x36853aff, 0x0fffffff, 0xd8f7c094, 0xfeb88588,
+0x858affff, 0xfffffeb4, 0xff37853a, 0x940fffff,
+0x88d8f7c0, 0xfffeb485, 0xb0858aff, 0x3afffffe,
+0xffff3885, 0xc0940fff, 0x8588d8f7, 0xfffffeb0,
+0xfeac858a, 0x853affff, 0xffffff39, 0xf7c0940f,
+0xac8588d8, 0x8afffffe, 0xfffea885, 0x3a853aff,
+0x0fffffff, 0xd8f7c094, 0xfea88588, 0x858affff,
+0xfffffea4, 0xff3b853a, 0x940fffff, 0x88d8f7c0,
+0xfffea485, 0xa0858aff, 0x3afffffe, 0xffff3c85,
+0xc0940fff, 0x8588d8f7, 0xfffffea0, 0xfe9c858a,
+0x853affff, 0xffffff3d, 0xf7c0940f, 0x9c8588d8,
+0x8afffffe, 0xfffe9885, 0x3e853aff, 0x0fffffff,
+0xd8f7c094, 0xfe988588, 0x858affff, 0xfffffe94,
+0xff3f853a, 0x858affff, 0xfffffe90, 0xc7940f41,
+0x3adff741, 0xffff4085, 0xc0940fff, 0x8588d8f7,
+0xfffffe94, 0xfe8c858a, 0x853affff, 0xffffff41,
+0xf7c0940f, 0x908588d8, 0x8afffffe, 0xfffe8885,
+0x42853aff, 0x0fffffff, 0xd8f7c094, 0xfe8c8588,
+0x858affff, 0xfffffe87, 0xff43853a, 0x858affff,
+0xfffffe86, 0xc6940f41, 0x3adef741, 0xffff4485,
+0x85858aff, 0x0ffffffe, 0xd9f7c194, 0xff45853a,
+0x858affff, 0xfffffe84, 0xc5940f41, 0x3addf741,
+0xffff4685, 0x83858aff, 0x41fffffe, 0x41c0940f,
+0x853ad8f7, 0xffffff47, 0xfe82858a, 0xf9c5ffff,
+0xfed0956e, 0x0f41ffff, 0x8a40c494, 0xfffe81bd,
+0xb58a40ff, 0xfffffe7f, 0x856e79c5, 0xfffffec8,
+0x3adcf741, 0xffff4885, 0x3963c4ff, 0xfec48520,
+0x0f01ffff, 0xf9c5c094, 0xfec0a56e, 0xe3c4ffff,
+0xcc952069, 0x01fffffe, 0x7b8d8a44, 0xf7fffffe,
+0xbd3a40d8, 0xffffff49, 0x80bd8a40, 0xc5fffffe,
+0xb8bd6ef9, 0x0ffffffe, 0xf9c5c394, 0xfeb08d6e,
+0xe3c4ffff, 0xb4bd2041, 0x01fffffe, 0x3a40dbf7,
+0xffff4abd, 0x59e3c4ff, 0xfebca520, 0x4001ffff,
+0xc5c7940f, 0xa8b56ef9, 0xc4fffffe, 0xd06169c1,
+0xd9c5dff7, 0x41c4e761, 0x40c06e79, 0xff4bb53a,
+0x0f41ffff, 0xe9c5c394, 0x8a40d462, 0xfffe7eb5,
+0x49e3c4ff, 0xfea4b520, 0x4101ffff, 0x3a40dbf7,
+0xffff4cb5, 0x6ef9c5ff, 0xb58a40ff, 0xfffffe7d,
+0xc5c2940f, 0xa09d6ef9, 0xc4fffffe, 0x8d2071e3,
+0xfffffeac, 0x40daf701, 0xff4db53a, 0xe3c4ffff,
+0x9c9d2061, 0x01fffffe, 0xc2940f41, 0x7cb58a40,
+0xc5fffffe, 0xc5ce61f1, 0x41e26ef9, 0xf9c5daf7,
+0xfe98ad6e, 0x3a40ffff, 0xffff4eb5, 0x940f40ff,
+0x51c3c4c6, 0xc401ef20, 0xc4203943, 0x61e1c501,
+0xc5def7dd, 0x44e96ef9, 0xff4f8d3a, 0xf1c5ffff,
+0x0f41cb62, 0xf9c5c194, 0xf9c5f66e, 0xfe949d6e,
+0xe9c5ffff, 0xf741d16c, 0x6ef9c5d9, 0x6e79c5c8,
+0xfffe8c8d, 0x61e3c4ff, 0xfe909d20, 0xc401ffff,
+0xce203143, 0x51c3c401, 0xc401ed20, 0xcb2071e3,
+0x41c3c401, 0xc401fb20, 0xe22059c3, 0x49c3c401,
+0xc401f120, 0xd96161c1, 0x6151c1c4, 0x61f1c5e8,
+0x61d9c5cf, 0x62e1c5e6, 0x62f1c5dd, 0x6ce1c5cc,
+0x6de3c4c9, 0xe801c118, 0xfffff276, 0x44b8c289,
+0x84000005, 0x30840fd2, 0xc5000013, 0x509d6ff9,
+0xc5ffffff, 0x904d6ff9, 0xf9c5c031, 0x133e2d6f,
+0x7d800000, 0xe1c500b0, 0xf1c5e360, 0xe1c5d160,
+0xf1c5db68, 0xe9c5c968, 0xf9c5d4d5, 0xff60a56f,
+0xf1c5ffff, 0xf9c5cbd5, 0xc5a05d6f, 0xc5f460d9,
+0x8fe468d9, 0xd1a368e8, 0x79e3c450, 0xc400d214,
+0xd11479e3, 0x79c3c402, 0x0f01d714, 0x7d80d04e,
+0xe1c500b1, 0xcb89cb60, 0x1479e3c4, 0xe1c503d1,
+0x0f44db68, 0xe1c5f84e, 0x7d80dcd5, 0x4e0f00b2,
+0xd5f1c5d8, 0xb37d80ce, 0xd09d8800, 0x89fffffe,
+0x79e3c4cb, 0x0f04d114, 0x7d80d84e, 0x9d8800b4,
+0xfffffecc, 0xe3c4cb89, 0x05d11479, 0xa370e88f,
+0x4e0f50cb, 0x80ce89d8, 0xc400b57d, 0xd11479e3,
+0x79c3c406, 0x0f05ce14, 0x9d88f04e, 0xfffffec8,
+0x00b67d80, 0xe3c4cb89, 0x07d11479, 0x80d84e0f,
+0x4000b77d, 0xfec4b588, 0xc3c4ffff, 0x06c91479,
+0x1479c3c4, 0xce8907cd, 0xc4f04e0f, 0xd11479e3,
+0xb87d8008, 0xc09d8800, 0xc4fffffe, 0xcc1479c3,
+0x79c3c409, 0x890ac814, 0x79e3c4cb, 0x0f09d114,
+0x7d80d84e, 0x884000b9, 0xfffebcb5, 0x79c3c4ff,
+0xc40dcb14, 0xca1479c3, 0xc4ce890f, 0xd11479e3,
+0xf04e0f0a, 0x00ba7d80, 0xfeb89d88, 0xcf89ffff,
+0x1479e3c4, 0x4e0f0bd1, 0x80cb89f8, 0x4000bb7d,
+0xfeb4b588, 0xe3c4ffff, 0x0cd11479, 0x80d84e0f,
+0x8900bc7d, 0x79e3c4ce, 0x400dd114, 0xfeb0bd88,
+0x4e0fffff, 0x80cf89f0, 0x8800bd7d, 0xfffeac9d,
+0x79e3c4ff, 0x0f0ed114, 0x7d80f84e, 0xcb8900be,
+0x1479e3c4, 0x88400fd1, 0xfffea8b5, 0xd84e0fff,
+0xa4bd8840, 0x89fffffe, 0x79e3c4ce, 0x8900c914,
+0x79e3c4cf, 0x8801c914, 0xfffea09d, 0xbf7d80ff,
+0xc4cb8900, 0xc91479e3, 0xf04e0f02, 0x00c07d80,
+0x856e79c5, 0xfffffed0, 0x80f84e0f, 0x0f00c17d,
+0x8840d84e, 0xfffe9cb5, 0xc27d80ff, 0xc4ce8900,
+0xc91479e3, 0xf04e0f03, 0x98bd8840, 0x80fffffe,
+0x8900c37d, 0x79e3c4cf, 0x8804c914, 0xfffe949d,
+0xf84e0fff, 0x7d80cb89, 0x884000c4, 0xfffe90b5,
+0x79e3c4ff, 0x0f08c914, 0x7d80d84e, 0x0f4400c5,
+0x7d80f04e, 0x884000c6, 0xfffe8cbd, 0x4e0f44ff,
+0xc77d80c8, 0x889d8800, 0xc4fffffe, 0xcb1479e3,
+0x79e3c40b, 0x440cce14, 0x80e84e0f, 0xc400c87d,
+0xcf1479e3, 0xc84e0f0e, 0x00c97d80, 0x203963c4,
+0xfffecc85, 0xf9c501ff, 0xfec8a56e, 0xf9c5ffff,
+0x0f44ca6e, 0x7d80e04e, 0xf9c500ca, 0xfec0bd6e,
+0x0f44ffff, 0x7d80c04e, 0xe3c400cb, 0xbcbd2041,
+0x01fffffe, 0x80d84e0f, 0x0f00cc7d, 0x7d80f04e,
+0x0f4400cd, 0x7d80d84e, 0x4e0f00ce, 0x6ef9c5f8,
+0xfffeb895, 0xcf7d80ff, 0x59e3c400, 0xfec4a520,
+0xc401ffff, 0xcf2071c3, 0x4e0f4401, 0x69e3c4d0,
+0xfeb49520, 0xc501ffff, 0xb0b56ef9, 0xc4fffffe,
+0xb52049e3, 0xfffffeac, 0x6ef9c501, 0xfffea89d,
+0x6ef9c5ff, 0xfffea0ad, 0x61d9c5ff, 0x71c1c4e7,
+0x79c5c861, 0xfe908d6e, 0xe9c5ffff, 0xf1c5d661,
+0x41c4cc62, 0xc4c16e79, 0xf86e79c1, 0xe66ef9c5,
+0xf76ef9c5, 0x2051e3c4, 0xfffe9cad, 0x43c401ff,
+0x01c52039, 0x2061e3c4, 0xfffea49d, 0x63c401ff,
+0x8c8d2031, 0x01fffffe, 0x2041e3c4, 0xc3c401fb,
+0x01e32059, 0xdd61e1c5, 0xad6ef9c5, 0xfffffe88,
+0x2049c3c4, 0xe9c501f2, 0xf9c5d362, 0xfe989d6e,
+0xc3c4ffff, 0x01ee2051, 0xca6cf1c5, 0xd16ef9c5,
+0x6151c1c4, 0x61e3c4e8, 0xfe949d20, 0xc401ffff,
+0xd42069c3, 0x61d9c501, 0x61e9c5e6, 0x61c1c4d7,
+0xe9c5d961, 0xe1c5d462, 0xe1c5dd62, 0xe3c4d26c,
+0x01d21875, 0xca6ff9c5, 0x957ffdc5, 0xffffff30,
+0x98e8e98f, 0xf9c5b065, 0xff40956f, 0xe98fffff,
+0xc05d98e8, 0x185de3c4, 0xfdc501fb, 0xfed0bd7f,
+0xfdc5ffff, 0xfed0b56f, 0x958affff, 0xfffffed0,
+0xb57ffdc5, 0xfffffef0, 0x256ff9c5, 0x00000f40,
+0x7d6ff9c5, 0x6ff9c5b0, 0xc1c5c075, 0xc9c5dcf8,
+0xe3c4e4f8, 0x01dc1865, 0x5d7ffdc5, 0xf0e98fb0,
+0x8fb04d98, 0x5598e8e9, 0x75e3c4c0, 0xc501da18,
+0xc5c9fcf1, 0xc4d2fce9, 0xc81479e3, 0x7ffdc500,
+0xffff109d, 0x79e3c4ff, 0xc409d114, 0xd71479e3,
+0xc4c2380d, 0xca1479e3, 0x79c3c401, 0x0f0fd214,
+0xd8f7c094, 0xfef19538, 0xe3c4ffff, 0x02ca1479,
+0xc7940f41, 0x38dff741, 0xfffef295, 0xc2940fff,
+0x9588daf7, 0xfffffed0, 0x1479e3c4, 0x953803ca,
+0xfffffef3, 0xf7c2940f, 0xcc9588da, 0xc4fffffe,
+0xca1479e3, 0xf4953804, 0x0ffffffe, 0xdaf7c294,
+0xfec89588, 0xe3c4ffff, 0x05ca1479, 0xfef59538,
+0x940fffff, 0x88daf7c2, 0xfffec495, 0x79e3c4ff,
+0x3806ca14, 0xfffef695, 0xc2940fff, 0x9588daf7,
+0xfffffec0, 0x1479e3c4, 0x953807ca, 0xfffffef7,
+0xf7c2940f, 0xbc9588da, 0xc4fffffe, 0xca1479e3,
+0xf8953808, 0x0ffffffe, 0xdaf7c294, 0xfeb89588,
+0xe3c4ffff, 0x09ca1479, 0xfef99538, 0x940fffff,
+0x88daf7c2, 0xfffeb495, 0x79e3c4ff, 0x380aca14,
+0xfffefa95, 0xc2940fff, 0x9588daf7, 0xfffffeb0,
+0x1479e3c4, 0x95380bca, 0xfffffefb, 0xf7c2940f,
+0xac9588da, 0xc4fffffe, 0xca1479e3, 0xfc95380c,
+0x0ffffffe, 0xdaf7c294, 0xfea89588, 0xe3c4ffff,
+0x0dca1479, 0xfefd9538, 0x940fffff, 0x88daf7c2,
+0xfffea495, 0x79e3c4ff, 0x380eca14, 0xfffefe95,
+0x6e79c5ff, 0xfffed085, 0xc2940fff, 0x203963c4,
+0xfffecc85, 0xf9c501ff, 0xfec8a56e, 0xdaf7ffff,
+0x2059e3c4, 0xfffec4a5, 0xf9c501ff, 0xfec0bd6e,
+0xe3c4ffff, 0xbcbd2041, 0x01fffffe, 0xfea09588,
+0xe3c4ffff, 0x0fca1479, 0x8d6ef9c5, 0xfffffeb8,
+0x2071e3c4, 0xfffeb48d, 0x953801ff, 0xfffffeff,
+0xc5c2940f, 0xf7e761d9, 0x9c9588da, 0xc4fffffe,
+0xd21479e3, 0x00953800, 0x0fffffff, 0xdaf7c294,
+0xfe989588, 0xe3c4ffff, 0x01d21479, 0xff019538,
+0x940fffff, 0x88daf7c2, 0xfffe9495, 0x79e3c4ff,
+0x3802d214, 0xffff0295, 0xc2940fff, 0x9588daf7,
+0xfffffe90, 0x1479e3c4, 0x953803d2, 0xffffff03,
+0xf7c2940f, 0x8c9588da, 0xc4fffffe, 0xd21479e3,
+0x04953804, 0xc4ffffff, 0xd21479e3, 0x940f4005,
+0x38def7c6, 0xffff0595, 0x79e3c4ff, 0x4106d214,
+0x41c6940f, 0x9538def7, 0xffffff06, 0x1479e3c4,
+0x0f4107d2, 0xf741c194, 0x079538d9, 0xc4ffffff,
+0xd21479e3, 0x940f4108, 0xddf741c5, 0xff089538,
+0x940fffff, 0x38daf7c2, 0xffff098d, 0x79e3c4ff,
+0x410ad114, 0x41c4940f, 0x8d38dcf7, 0xffffff0a,
+0x1479e3c4, 0x0f410bd1, 0xf741c094, 0x0b8d38d8,
+0xc4ffffff, 0xd11479e3, 0xc3940f0c, 0x6e79c1c4,
+0x38dbf7f8, 0xffff0c8d, 0xc1940fff, 0x2041e3c4,
+0xd9f701fb, 0x0dbd3840, 0xc4ffffff, 0xd71479e3,
+0x940f410e, 0x6ef9c5c3, 0xdbf741d0, 0x0ebd3840,
+0xc4ffffff, 0xd72069c3, 0x940f4001, 0x69c1c4c7,
+0x41c4d061, 0xf7c16e79, 0x953844df, 0xffffff0f,
+0xb56ef9c5, 0xfffffeb0, 0x9d6ef9c5, 0xfffffea8,
+0xad6ef9c5, 0xfffffea0, 0xc2940f41, 0xd462e9c5,
+0xc5daf741, 0xc4e16ef9, 0xb52049e3, 0xfffffeac,
+0x6e79c501, 0xfffe908d, 0x51e3c4ff, 0xfe9cad20,
+0xc401ffff, 0x9d2061e3, 0xfffffea4, 0x3943c401,
+0xc401c520, 0x8d203163, 0xfffffe8c, 0x61f1c501,
+0x6ef9c5ce, 0x59c3c4f7, 0xc501e320, 0xc5dd61e1,
+0xc4ee6ef9, 0xf22049c3, 0x62f1c501, 0x6ef9c5cb,
+0xfffe989d, 0x51c3c4ff, 0xc501ee20, 0xc5d16ce9,
+0xc4ca6ef9, 0xe86151c1, 0x2061e3c4, 0xfffe949d,
+0xc3c401ff, 0x01cc2071, 0xe661d9c5, 0xcf61f1c5,
+0x6161c1c4, 0x62f1c5d9, 0x62e1c5cc, 0x6ce1c5dd,
+0x6de3c4c9, 0xe801c118, 0xffffea36, 0x21b8c289,
+0x84000006, 0xf0840fd2, 0xc500000a, 0xc5c9eff1,
+0xb055f8f1, 0x4df8f1c5, 0x68e98fc0, 0xff109598,
+0xe98fffff, 0x208d9870, 0xc4ffffff, 0xd01479e3,
+0x30853800, 0xc4ffffff, 0xd21479e3, 0xc0940f01,
+0x186de3c4, 0xe3c401d9, 0x09c91479, 0x9538d8f7,
+0xffffff31, 0x1479e3c4, 0xfdc502d2, 0xfef09d7f,
+0x0f41ffff, 0xe3c4c794, 0x0dcf1479, 0x1479c3c4,
+0xf7410fca, 0x329538df, 0x0fffffff, 0xdaf7c294,
+0xfed09588, 0xe3c4ffff, 0x03d21479, 0xff339538,
+0x940fffff, 0x88daf7c2, 0xfffecc95, 0x79e3c4ff,
+0x3804d214, 0xffff3495, 0xc2940fff, 0x9588daf7,
+0xfffffec8, 0x1479e3c4, 0x953805d2, 0xffffff35,
+0xf7c2940f, 0xc49588da, 0xc4fffffe, 0xd21479e3,
+0x36953806, 0x0fffffff, 0xdaf7c294, 0xfec09588,
+0xe3c4ffff, 0x07d21479, 0xff379538, 0x940fffff,
+0x88daf7c2, 0xfffebc95, 0x79e3c4ff, 0x3808d214,
+0xffff3895, 0xc2940fff, 0x9588daf7, 0xfffffeb8,
+0x1479e3c4, 0x953809d2, 0xffffff39, 0xf7c2940f,
+0xb49588da, 0xc4fffffe, 0xd21479e3, 0x3a95380a,
+0x0fffffff, 0xdaf7c294, 0xfeb09588, 0xe3c4ffff,
+0x0bd21479, 0xff3b9538, 0x940fffff, 0x88daf7c2,
+0xfffeac95, 0x79e3c4ff, 0x380cd214, 0xffff3c95,
+0xc2940fff, 0x9588daf7, 0xfffffea8, 0x1479e3c4,
+0x95380dd2, 0xffffff3d, 0xf7c2940f, 0xa49588da,
+0xc4fffffe, 0xd21479e3, 0x3e95380e, 0xc5ffffff,
+0xd0856e79, 0x0ffffffe, 0x63c4c294, 0xcc852039,
+0x01fffffe, 0xa56ef9c5, 0xfffffec8, 0xe3c4daf7,
+0xc4a52059, 0x01fffffe, 0xbd6ef9c5, 0xfffffec0,
+0x2041e3c4, 0xfffebcbd, 0x958801ff, 0xfffffea0,
+0x1479e3c4, 0xf9c50fd2, 0x9538d06e, 0xffffff3f,
+0x2069c3c4, 0x940f01d7, 0x61d9c5c2, 0x69c1c4e7,
+0xdaf7d061, 0xd462e9c5, 0xfe9c9588, 0xe3c4ffff,
+0x00ca1479, 0xff409538, 0x940fffff, 0x88daf7c2,
+0xfffe9895, 0x79e3c4ff, 0x3801ca14, 0xffff4195,
+0xc2940fff, 0x9588daf7, 0xfffffe94, 0x1479e3c4,
+0x953802ca, 0xffffff42, 0xf7c2940f, 0x909588da,
+0xc4fffffe, 0xca1479e3, 0x43953803, 0x0fffffff,
+0xdaf7c294, 0xfe8c9588, 0xe3c4ffff, 0x04ca1479,
+0xff449538, 0xe3c4ffff, 0x05ca1479, 0xc6940f40,
+0x9538def7, 0xffffff45, 0x1479e3c4, 0x0f4106ca,
+0xf741c694, 0x469538de, 0xc4ffffff, 0xca1479e3,
+0x940f4107, 0xd9f741c1, 0xff479538, 0xe3c4ffff,
+0x08ca1479, 0xc5940f41, 0x6e7941c4, 0xddf741c1,
+0xff489538, 0x940fffff, 0x3943c4c2, 0xf701c520,
+0x498d38da, 0xc4ffffff, 0xc91479e3, 0x940f410a,
+0xdcf741c4, 0xff4a8d38, 0xe3c4ffff, 0x0bc91479,
+0xc0940f41, 0x38d8f741, 0xffff4b8d, 0x79e3c4ff,
+0x0f0cc914, 0xc1c4c394, 0xf7f86e79, 0x4c8d38db,
+0x0fffffff, 0xe3c4c194, 0x01fb2041, 0x3840d9f7,
+0xffff4dbd, 0x79e3c4ff, 0x410ecf14, 0xc5c3940f,
+0xb88d6ef9, 0xc5fffffe, 0xc4e16ef9, 0x8d2071e3,
+0xfffffeb4, 0xdbf74101, 0x4ebd3840, 0x40ffffff,
+0xc4c7940f, 0xe32059c3, 0x44dff701, 0xff4f9538,
+0xf9c5ffff, 0xfeb0b56e, 0xf9c5ffff, 0xfea89d6e,
+0xf9c5ffff, 0xfea0ad6e, 0x0f41ffff, 0xe3c4c294,
+0xacb52049, 0x01fffffe, 0xc5daf741, 0x908d6e79,
+0xc4fffffe, 0xad2051e3, 0xfffffe9c, 0x61e3c401,
+0xfea49d20, 0xc401ffff, 0x8d203163, 0xfffffe8c,
+0x61f1c501, 0x6ef9c5ce, 0x61e1c5f7, 0x6ef9c5dd,
+0x49c3c4ee, 0xc501f220, 0xc5cb62f1, 0x989d6ef9,
+0xc4fffffe, 0xee2051c3, 0x6ce9c501, 0x6ef9c5d1,
+0x51c1c4ca, 0xe3c4e861, 0x949d2061, 0x01fffffe,
+0x2071c3c4, 0xd9c501cc, 0xf1c5e661, 0xc1c4cf61,
+0xc5d96161, 0xc5cc62f1, 0xc5dd62e1, 0xc4c96ce1,
+0xc1186de3, 0xe628e801, 0xc289ffff, 0x000626b8,
+0x0fd28400, 0x0006e284, 0x6ffdc500, 0xffff508d,
+0x0001b8ff, 0xfdc50000, 0xff108d7f, 0x948affff,
+0xffff7005, 0x059488ff, 0xffffff10, 0x02c08348,
+0x21f88348, 0x7d80e875, 0x9f0f0090, 0x80d8f7c0,
+0x4100917d, 0xc5c79f0f, 0x41d86ef9, 0x7d80dff7,
+0x0f410092, 0xc3c4c19f, 0x01df2061, 0x80d9f741,
+0x0f00937d, 0x41c4c29f, 0xf7c96e79, 0x947d80da,
+0xd0958800, 0x0ffffffe, 0xdaf7c29f, 0x00957d80,
+0xfecc9588, 0x9f0fffff, 0x80daf7c2, 0x8800967d,
+0xfffec895, 0xc29f0fff, 0x7d80daf7, 0x95880097,
+0xfffffec4, 0xf7c29f0f, 0x987d80da, 0xc0958800,
+0x0ffffffe, 0xdaf7c29f, 0x00997d80, 0xfebc9588,
+0x9f0fffff, 0x80daf7c2, 0x88009a7d, 0xfffeb895,
+0xc29f0fff, 0x7d80daf7, 0x9588009b, 0xfffffeb4,
+0xf7c29f0f, 0x9c7d80da, 0xb0958800, 0x0ffffffe,
+0xdaf7c29f, 0x009d7d80, 0xfeac9588, 0x9f0fffff,
+0x80daf7c2, 0x88009e7d, 0xfffea895, 0xc29f0fff,
+0x7d80daf7, 0x9588009f, 0xfffffea4, 0xf7c29f0f,
+0xa07d80da, 0xa0958800, 0x0ffffffe, 0xdaf7c29f,
+0x00a17d80, 0xfe9c9588, 0x9f0fffff, 0x88daf7c2,
+0xfffe9895, 0xa27d80ff, 0x6ef9c500, 0xfffeccad,
+0x6e79c5ff, 0xfffec485, 0xc29f0fff, 0x956ef9c5,
+0xfffffebc, 0x203163c4, 0xfffed08d, 0xdaf701ff,
+0x00a37d80, 0x203963c4, 0xfffec085, 0x958801ff,
+0xfffffe94, 0xc4c29f0f, 0xad2051e3, 0xfffffec8,
+0x6ef9c501, 0xfffeb4bd, 0x80daf7ff, 0xc400a47d,
+0xd96161c1, 0xfe909588, 0x9f0fffff, 0x51c1c4c2,
+0xe3c4e861, 0xb0bd2041, 0x01fffffe, 0x7d80daf7,
+0xe1c500a5, 0x0f41dd62, 0x9588c69f, 0xfffffe8c,
+0x2069e3c4, 0xfffeb895, 0xf9c501ff, 0xfeaca56e,
+0xf741ffff, 0xa67d80de, 0x59e3c400, 0xfea8a520,
+0x4101ffff, 0xc5c09f0f, 0xa4b56ef9, 0xc5fffffe,
+0xc4d761e9, 0xb52049e3, 0xfffffea0, 0xd8f74101,
+0x00a77d80, 0xc59f0f41, 0x6e7941c4, 0xddf741c8,
+0x00a87d80, 0xe661d9c5, 0xc5c29f0f, 0xc5d462e9,
+0x9ca56ef9, 0xf7fffffe, 0xa97d80da, 0x6ce1c500,
+0x9f0f41da, 0x6ef9c5c4, 0x3143c4d2, 0xc401cd20,
+0xa52059e3, 0xfffffe98, 0xdcf74101, 0x00aa7d80,
+0xc79f0f40, 0x2069c3c4, 0xdff701d4, 0x00ab7d80,
+0xc5c39f0f, 0xf7c76e79, 0xac7d80db, 0xc19f0f00,
+0x203963c4, 0xd9f701c3, 0x00ad7d80, 0x6169c1c4,
+0x9f0f41d0, 0x6ef9c5c3, 0xdbf741e9, 0x00ae7d80,
+0xc69f0f40, 0x2051c3c4, 0xdef701eb, 0x00af7d80,
+0x956e79c5, 0xfffffe94, 0xc29f0f41, 0xfe6ef9c5,
+0x202963c4, 0xfffe9095, 0xf74101ff, 0x6ef9c5da,
+0xfffe8cb5, 0x41c3c4ff, 0xc401fa20, 0xf62049c3,
+0x59c1c401, 0xc1c4e261, 0xc5f16149, 0xc5ef61d1,
+0xc5e662d9, 0xc5d562e9, 0xc4d26cd9, 0xda1865e3,
+0x74e88f01, 0xff708da2, 0xc430ffff, 0xc81479e3,
+0x10853800, 0x0fffffff, 0xe3c4c094, 0x01ca1479,
+0x9538d8f7, 0xffffff11, 0x1479e3c4, 0x0f4102ca,
+0xf9c5c794, 0xf741d06e, 0x129538df, 0x0fffffff,
+0xc3c4c294, 0x01d72069, 0x9588daf7, 0xfffffed0,
+0x1479e3c4, 0x953803ca, 0xffffff13, 0xf7c2940f,
+0xcc9588da, 0xc4fffffe, 0xca1479e3, 0x14953804,
+0x0fffffff, 0xdaf7c294, 0xfec89588, 0xe3c4ffff,
+0x05ca1479, 0xff159538, 0x940fffff, 0x88daf7c2,
+0xfffec495, 0x79e3c4ff, 0x3806ca14, 0xffff1695,
+0xc2940fff, 0x9588daf7, 0xfffffec0, 0x1479e3c4,
+0x953807ca, 0xffffff17, 0xf7c2940f, 0xbc9588da,
+0xc4fffffe, 0xca1479e3, 0x18953808, 0x0fffffff,
+0xdaf7c294, 0xfeb89588, 0xe3c4ffff, 0x09ca1479,
+0xff199538, 0x940fffff, 0x88daf7c2, 0xfffeb495,
+0x79e3c4ff, 0x380aca14, 0xffff1a95, 0xc2940fff,
+0x9588daf7, 0xfffffeb0, 0x1479e3c4, 0x95380bca,
+0xffffff1b, 0xf7c2940f, 0xac9588da, 0xc4fffffe,
+0xca1479e3, 0x1c95380c, 0x0fffffff, 0xdaf7c294,
+0xfea89588, 0xe3c4ffff, 0x0dca1479, 0xff1d9538,
+0x940fffff, 0x88daf7c2, 0xfffea495, 0x79e3c4ff,
+0x380eca14, 0xffff1e95, 0xc2940fff, 0x9588daf7,
+0xfffffea0, 0x1479e3c4, 0x95380fca, 0xffffff1f,
+0x197de3c4, 0x940f01c9, 0x79e3c4c2, 0xc409c914,
+0xcf1479e3, 0xc4daf70d, 0xca1479c3, 0x6e79c50f,
+0xfffed085, 0x9c9588ff, 0xc4fffffe, 0xca1479e3,
+0x20953800, 0xc5ffffff, 0xc8a56ef9, 0x0ffffffe,
+0xf9c5c294, 0xfec0bd6e, 0x63c4ffff, 0xcc852039,
+0x01fffffe, 0xf9c5daf7, 0xfeb0b56e, 0xe3c4ffff,
+0xbcbd2041, 0x01fffffe, 0xfe989588, 0xe3c4ffff,
+0x01ca1479, 0xff219538, 0xc1c4ffff, 0xc4d06169,
+0xb52049e3, 0xfffffeac, 0xc2940f01, 0x2059e3c4,
+0xfffec4a5, 0xdaf701ff, 0xfe949588, 0xe3c4ffff,
+0x02ca1479, 0xe761d9c5, 0xff229538, 0x940fffff,
+0x62e9c5c2, 0x88daf7d4, 0xfffe9095, 0x79e3c4ff,
+0x3803ca14, 0xffff2395, 0xc2940fff, 0x9588daf7,
+0xfffffe8c, 0x1479e3c4, 0x953804ca, 0xffffff24,
+0x1479e3c4, 0x0f4005ca, 0xdef7c694, 0xff259538,
+0xe3c4ffff, 0x06ca1479, 0xc6940f41, 0x38def741,
+0xffff2695, 0x79e3c4ff, 0x4107ca14, 0x41c1940f,
+0x9538d9f7, 0xffffff27, 0x1479e3c4, 0x0f4108ca,
+0x41c4c594, 0x41c16e79, 0x9538ddf7, 0xffffff28,
+0xc4c2940f, 0xc5203943, 0x38daf701, 0xffff298d,
+0x79e3c4ff, 0x410ac914, 0x41c4940f, 0x8d38dcf7,
+0xffffff2a, 0x1479e3c4, 0x0f410bc9, 0xf741c094,
+0x2b8d38d8, 0xc4ffffff, 0xc91479e3, 0xc3940f0c,
+0x6e79c1c4, 0x38dbf7f8, 0xffff2c8d, 0xc1940fff,
+0x2041e3c4, 0xd9f701fb, 0x2dbd3840, 0xc4ffffff,
+0xcf1479e3, 0x940f410e, 0x6ef9c5c3, 0xfffeb88d,
+0x6ef9c5ff, 0x71e3c4e1, 0xfeb48d20, 0x4101ffff,
+0x3840dbf7, 0xffff2ebd, 0x940f40ff, 0x59c3c4c7,
+0xf701e320, 0x953844df, 0xffffff2f, 0xce61f1c5,
+0x9d6ef9c5, 0xfffffea8, 0xc2940f41, 0x2061e3c4,
+0xfffea49d, 0xf9c501ff, 0xfea0ad6e, 0xf741ffff,
+0x6e79c5da, 0xfffe908d, 0x51e3c4ff, 0xfe9cad20,
+0xc501ffff, 0xc4f76ef9, 0x8d203163, 0xfffffe8c,
+0x49c3c401, 0xc501f220, 0xc5dd61e1, 0xc5ee6ef9,
+0xc5e661d9, 0xc5cb62f1, 0x989d6ef9, 0xc4fffffe,
+0xee2051c3, 0x6ce9c501, 0x6ef9c5d1, 0x51c1c4ca,
+0xe3c4e861, 0x949d2061, 0x01fffffe, 0x2071c3c4,
+0xf1c501cc, 0xc1c4cf61, 0xc5d96161, 0xc5cc62f1,
+0xc5dd62e1, 0xc4c96ce1, 0xc1186de3, 0xdf40e801,
+0x013cffff, 0x2a25c019, 0x48000007, 0x01a0c481,
+0x415b0000, 0x415c415a, 0x415e415d, 0x8d495d5f,
+0x00c3f862, 0x00000000, 0x00000000, 0x00000000,
+0x06040200, 0x0e0c0a08, 0x16141210, 0x1e1c1a18,
+0x01010101, 0x01010101, 0x01010101, 0x01010101,
+0020420,
+};
+asm(".type xop_x86_64_D_32i1, STT_NOTYPE;");
+asm(".type xop_x86_64_D_32i1, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_32u1[] = {
+0x48552beb, 0x8348e589, 0xfdc5e0e4, 0xe024447f,
+0x24448d48, 0xe28948e0, 0x75ff3880, 0xc0ff480c,
+0x75d03948, 0xeb01b0f3, 0xc9c03102, 0x548d4cc3,
+0x83480824, 0x01b8e0e4, 0x40000000, 0xff4121b7,
+0x08b9f872, 0x55000000, 0x41e58948, 0x41564157,
+0x41544155, 0x81485352, 0x000180ec, 0x8dfe8900,
+0x8488ff50, 0xffff4f05, 0x40c629ff, 0x6f05b488,
+0x89ffffff, 0x83c221d6, 0xceff01e6, 0x8301fa83,
+0x884000d9, 0x888f0574, 0x48af054c, 0x8348c0ff,
+0xc97521f8, 0xbd6ffdc5, 0xffffff50, 0xbd7ffdc5,
+0xfffffef0, 0xfef0858a, 0x853affff, 0xffffff50,
+0xfed08588, 0x940fffff, 0x88d8f7c0, 0xfffe8c85,
+0xf1858aff, 0x3afffffe, 0xffff5185, 0xcf8588ff,
+0x0ffffffe, 0xd8f7c094, 0xfe928588, 0x858affff,
+0xfffffef2, 0xff52853a, 0x8588ffff, 0xfffffec8,
+0xf7c0940f, 0x888588d8, 0x8afffffe, 0xfffef385,
+0x53853aff, 0x88ffffff, 0xfffece85, 0xc0940fff,
+0x8588d8f7, 0xfffffe91, 0xfef4858a, 0x853affff,
+0xffffff54, 0xfec48588, 0x940fffff, 0x88d8f7c0,
+0xfffe8485, 0xf5858aff, 0x3afffffe, 0xffff5585,
+0xcd8588ff, 0x0ffffffe, 0xd8f7c094, 0xfe908588,
+0x858affff, 0xfffffef6, 0xff56853a, 0x8588ffff,
+0xfffffec0, 0xf7c0940f, 0x808588d8, 0x8afffffe,
+0xfffef785, 0x57853aff, 0x88ffffff, 0xfffecc85,
+0xc0940fff, 0x8588d8f7, 0xfffffe7f, 0xfef8858a,
+0x853affff, 0xffffff58, 0xfebc8588, 0x940fffff,
+0x88d8f7c0, 0xfffe7885, 0xf9858aff, 0x3afffffe,
+0xffff5985, 0xbb8588ff, 0x0ffffffe, 0xd8f7c094,
+0xfe7e8588, 0x858affff, 0xfffffefa, 0xff5a853a,
+0x8588ffff, 0xfffffeb4, 0xf7c0940f, 0x748588d8,
+0x8afffffe, 0xfffefb85, 0x5b853aff, 0x88ffffff,
+0xfffeba85, 0xc0940fff, 0x8588d8f7, 0xfffffe7d,
+0xfefc858a, 0x853affff, 0xffffff5c, 0xfeb08588,
+0x940fffff, 0x88d8f7c0, 0xfffe7085, 0xfd858aff,
+0x3afffffe, 0xffff5d85, 0xb98588ff, 0x0ffffffe,
+0xd8f7c094, 0xfe7c8588, 0x858affff, 0xfffffefe,
+0xff5e853a, 0x8588ffff, 0xfffffeac, 0xf7c0940f,
+0x6c8588d8, 0x8afffffe, 0xfffeff85, 0x5f853aff,
+0x88ffffff, 0xfffea885, 0xc0940fff, 0x8588d8f7,
+0xfffffe6b, 0xff00858a, 0x853affff, 0xffffff60,
+0xff099d8a, 0x8588ffff, 0xfffffea4, 0xf7c0940f,
+0x999d88d8, 0x88fffffe, 0xfffe6485, 0x01858aff,
+0x3affffff, 0xffff6185, 0xa08588ff, 0x0ffffffe,
+0xd8f7c094, 0xfe6a8588, 0x858affff, 0xffffff02,
+0xff62853a, 0x8588ffff, 0xfffffeb8, 0xc1940f41,
+0xff03858a, 0xf741ffff, 0x63853ad9, 0x88ffffff,
+0xfffe9f85, 0x940f41ff, 0x04858ac7, 0xc4ffffff,
+0xc96e7941, 0x3adff741, 0xffff6485, 0x9e8588ff,
+0x0ffffffe, 0x858ac194, 0xffffff05, 0x203143c4,
+0xd9f701cf, 0xff65853a, 0x8588ffff, 0xfffffe9d,
+0xc6940f41, 0xff06858a, 0xf741ffff, 0x66853ade,
+0x88ffffff, 0xfffe9c85, 0x940f41ff, 0x07858ac0,
+0x41ffffff, 0x853ad8f7, 0xffffff67, 0xfe9b8588,
+0x0f41ffff, 0x858ac594, 0xffffff08, 0x3addf741,
+0xffff6885, 0x9a8588ff, 0x0ffffffe, 0xd8f7c094,
+0xff699d3a, 0x9d8affff, 0xffffff0a, 0x956ef9c5,
+0xfffffe8c, 0xc4940f41, 0x0cb58a40, 0x44ffffff,
+0xff0f958a, 0x79c5ffff, 0xfe88856e, 0xf741ffff,
+0x6a9d3adc, 0x88ffffff, 0xfffe989d, 0x6ef9c5ff,
+0xfffe84a5, 0x0b9d8aff, 0x40ffffff, 0x40c7940f,
+0xfe96b588, 0xf9c5ffff, 0xfe80bd6e, 0xdff7ffff,
+0xff6b9d3a, 0x63c4ffff, 0x91852039, 0x01fffffe,
+0x93958844, 0x88fffffe, 0xfffe979d, 0xc3940fff,
+0x2041e3c4, 0xfffe7fbd, 0xf9c501ff, 0xfe788d6e,
+0xdbf7ffff, 0x6cb53a40, 0x40ffffff, 0xff0db58a,
+0xf9c5ffff, 0xfe74b56e, 0x940fffff, 0x49e3c4c2,
+0xfe7db520, 0xc401ffff, 0x952069e3, 0xfffffe92,
+0x40daf701, 0xff6db53a, 0x8840ffff, 0xfffe95b5,
+0x6ef9c5ff, 0xfffe709d, 0xb58a40ff, 0xffffff0e,
+0xc3940f41, 0x2059e3c4, 0xfffe90a5, 0xc1c401ff,
+0x41d06169, 0x3a40dbf7, 0xffff6eb5, 0x7941c4ff,
+0x8840c06e, 0xfffe94b5, 0x940f40ff, 0x61d9c5c6,
+0x71e3c4e7, 0xfe7e8d20, 0xc501ffff, 0xc5d462e9,
+0xc5ff6ef9, 0xf7e26ef9, 0x61f1c5de, 0x6ef9c5ce,
+0x953a44f6, 0xffffff6f, 0xc2940f41, 0x203943c4,
+0xe3c401c5, 0x7c9d2061, 0x01fffffe, 0xc5daf741,
+0x6cad6ef9, 0xc4fffffe, 0xad2051e3, 0xfffffe6b,
+0x41e3c401, 0xc401fb20, 0xe32059c3, 0x49c3c401,
+0xc501f220, 0xc5dd61e1, 0xc5e96ef9, 0xc5e661d9,
+0xc5cb62f1, 0x649d6ef9, 0xc4fffffe, 0xee2051c3,
+0x6ce9c501, 0x6ef9c5d1, 0x51c1c4c8, 0xe3c4e861,
+0x6a9d2061, 0x01fffffe, 0x2071c3c4, 0xf1c501cc,
+0xc1c4cf61, 0xc5d96161, 0xc5cc62f1, 0xc5dd62e1,
+0xc4c96ce1, 0xc1186de3, 0xfac4e801, 0xc289ffff,
+0x000539b8, 0x0fd28400, 0x001b9c84, 0x6ff9c500,
+0xfffef0b5, 0x6ff9c5ff, 0xffff00bd, 0xfcc9c5ff,
+0xffff508d, 0xfcc1c5ff, 0xffff6095, 0x75e3c4ff,
+0xc501ca18, 0x108d7ffd, 0xc5ffffff, 0x50956ff9,
+0xc5ffffff, 0x608d6ff9, 0xc5ffffff, 0xc5d2fce9,
+0xc4c9fcf1, 0xd01479e3, 0x10853800, 0xc4ffffff,
+0xca1479e3, 0xc0940f09, 0x1479e3c4, 0xc3c40dce,
+0x0fca1479, 0x8588d8f7, 0xfffffe8c, 0x1479e3c4,
+0x853801d0, 0xffffff11, 0xf7c0940f, 0x928588d8,
+0xc4fffffe, 0xd01479e3, 0x12853802, 0x0fffffff,
+0xd8f7c094, 0xfe888588, 0xe3c4ffff, 0x03d01479,
+0xff138538, 0x940fffff, 0x88d8f7c0, 0xfffe9185,
+0x79e3c4ff, 0x3804d014, 0xffff1485, 0xc0940fff,
+0x8588d8f7, 0xfffffe84, 0x1479e3c4, 0x853805d0,
+0xffffff15, 0xf7c0940f, 0x908588d8, 0xc4fffffe,
+0xd01479e3, 0x16853806, 0x0fffffff, 0xd8f7c094,
+0xfe808588, 0xe3c4ffff, 0x07d01479, 0xff178538,
+0x940fffff, 0x88d8f7c0, 0xfffe7f85, 0x79e3c4ff,
+0x3808d014, 0xffff1885, 0xc0940fff, 0x8588d8f7,
+0xfffffe78, 0x1479e3c4, 0x853809d0, 0xffffff19,
+0xf7c0940f, 0x7e8588d8, 0xc4fffffe, 0xd01479e3,
+0x1a85380a, 0x0fffffff, 0xd8f7c094, 0xfe748588,
+0xe3c4ffff, 0x0bd01479, 0xff1b8538, 0x940fffff,
+0x88d8f7c0, 0xfffe7d85, 0x79e3c4ff, 0x380cd014,
+0xffff1c85, 0xc0940fff, 0x8588d8f7, 0xfffffe70,
+0x1479e3c4, 0x85380dd0, 0xffffff1d, 0xf7c0940f,
+0x7c8588d8, 0xc4fffffe, 0xd01479e3, 0x1e85380e,
+0x0fffffff, 0xd8f7c094, 0xfe6c8588, 0xe3c4ffff,
+0x0fd01479, 0xff1f8538, 0xf9c5ffff, 0xfe8c956e,
+0x940fffff, 0x6e79c5c0, 0xfffe8885, 0x69e3c4ff,
+0xfe929520, 0xf701ffff, 0x6ef9c5d8, 0xfffe84a5,
+0x3963c4ff, 0xfe918520, 0x8801ffff, 0xfffe6b85,
+0x79e3c4ff, 0x3800c814, 0xffff2085, 0x6ef9c5ff,
+0xfffe80bd, 0xc0940fff, 0x6169c1c4, 0x41e3c4d0,
+0xfe7fbd20, 0xf701ffff, 0x6ef9c5d8, 0xfffe74b5,
+0x59e3c4ff, 0xfe90a520, 0xc401ffff, 0xb52049e3,
+0xfffffe7d, 0x64858801, 0xc4fffffe, 0xc81479e3,
+0x21853801, 0xc5ffffff, 0x0fe761d9, 0xe9c5c094,
+0xd8f7d462, 0xfe6a8588, 0xe3c4ffff, 0x02c81479,
+0xff228538, 0xe3c4ffff, 0x03c81479, 0xc1940f41,
+0x38d9f741, 0xffff2385, 0x79e3c4ff, 0x4104c814,
+0xc4c7940f, 0xc96e7941, 0x38dff741, 0xffff2485,
+0x79e3c4ff, 0x0f05c814, 0x43c4c194, 0x01cf2031,
+0x8538d9f7, 0xffffff25, 0x1479e3c4, 0x0f4106c8,
+0xf741c694, 0x268538de, 0xc4ffffff, 0xc81479e3,
+0x940f4107, 0xd8f741c0, 0xff278538, 0xe3c4ffff,
+0x08c81479, 0xc5940f41, 0x6e7941c4, 0xddf741c0,
+0xff288538, 0x940fffff, 0x3943c4c0, 0xf701c520,
+0x299538d8, 0xc4ffffff, 0xca1479e3, 0x940f410a,
+0xdcf741c4, 0xff2a9538, 0xe3c4ffff, 0x0bca1479,
+0xc7940f40, 0x9538dff7, 0xffffff2b, 0x1479e3c4,
+0x940f0cca, 0x6ef9c5c3, 0x38dbf7ff, 0xffff2c95,
+0xc2940fff, 0x2041e3c4, 0xdaf701fb, 0x2db53840,
+0xc4ffffff, 0xce1479e3, 0x940f410e, 0x6ef9c5c3,
+0xfffe788d, 0x6ef9c5ff, 0x71e3c4e2, 0xfe7e8d20,
+0x4101ffff, 0x3840dbf7, 0xffff2eb5, 0x940f40ff,
+0x59c3c4c6, 0xf701e320, 0x953844de, 0xffffff2f,
+0xce61f1c5, 0x9d6ef9c5, 0xfffffe70, 0xc2940f41,
+0xf66ef9c5, 0x2061e3c4, 0xfffe7c9d, 0xf9c501ff,
+0xfe6cad6e, 0xf741ffff, 0x51e3c4da, 0xfe6bad20,
+0xc401ffff, 0xf22049c3, 0x61d9c501, 0x61e1c5e6,
+0x6ef9c5dd, 0x62f1c5e9, 0x6ef9c5cb, 0xfffe649d,
+0x51c3c4ff, 0xc501ee20, 0xc5d16ce9, 0xc4c86ef9,
+0xe86151c1, 0x2061e3c4, 0xfffe6a9d, 0xc3c401ff,
+0x01cc2071, 0xcf61f1c5, 0x6161c1c4, 0x62f1c5d9,
+0x62e1c5cc, 0x6ce1c5dd, 0x6de3c4c9, 0xe801c118,
+0xfffff69e, 0x3fb8c289, 0x84000005, 0x76840fd2,
+0xc5000017, 0x10b56ff9, 0xc5ffffff, 0x20bd6ff9,
+0xc5ffffff, 0x508df8c9, 0xc5ffffff, 0x6095f8c1,
+0xc4ffffff, 0xca1875e3, 0x7ffdc501, 0xffff308d,
+0xd0858aff, 0x3afffffe, 0xffff3085, 0xc0940fff,
+0x8588d8f7, 0xfffffed0, 0xfecf858a, 0x853affff,
+0xffffff31, 0xf7c0940f, 0xcf8588d8, 0x8afffffe,
+0xfffec885, 0x32853aff, 0x0fffffff, 0xd8f7c094,
+0xfec88588, 0x858affff, 0xfffffece, 0xff33853a,
+0x940fffff, 0x88d8f7c0, 0xfffece85, 0xc4858aff,
+0x3afffffe, 0xffff3485, 0xc0940fff, 0x8588d8f7,
+0xfffffec4, 0xfecd858a, 0x853affff, 0xffffff35,
+0xf7c0940f, 0xcd8588d8, 0x8afffffe, 0xfffec085,
+0x36853aff, 0x0fffffff, 0xd8f7c094, 0xfec08588,
+0x858affff, 0xfffffecc, 0xff37853a, 0x940fffff,
+0x88d8f7c0, 0xfffecc85, 0xbc858aff, 0x3afffffe,
+0xffff3885, 0xc0940fff, 0x8588d8f7, 0xfffffebc,
+0xfebb858a, 0x853affff, 0xffffff39, 0xf7c0940f,
+0xbb8588d8, 0x8afffffe, 0xfffeb485, 0x3a853aff,
+0x0fffffff, 0xd8f7c094, 0xfeb48588, 0x858affff,
+0xfffffeba, 0xff3b853a, 0x940fffff, 0x88d8f7c0,
+0xfffeba85, 0xb0858aff, 0x3afffffe, 0xffff3c85,
+0xc0940fff, 0x8588d8f7, 0xfffffeb0, 0xfeb9858a,
+0x853affff, 0xffffff3d, 0xf7c0940f, 0xb98588d8,
+0x8afffffe, 0xfffeac85, 0x3e853aff, 0x0fffffff,
+0xd8f7c094, 0xfeac8588, 0x858affff, 0xfffffea8,
+0xff3f853a, 0x858affff, 0xfffffea4, 0xc7940f41,
+0x3adff741, 0xffff4085, 0xc0940fff, 0x8588d8f7,
+0xfffffea8, 0xfea0858a, 0x853affff, 0xffffff41,
+0xf7c0940f, 0xa48588d8, 0x8afffffe, 0xfffeb885,
+0x42853aff, 0x0fffffff, 0xd8f7c094, 0xfea08588,
+0x858affff, 0xfffffe9f, 0xff43853a, 0x858affff,
+0xfffffe9e, 0xc6940f41, 0x3adef741, 0xffff4485,
+0x9d858aff, 0x0ffffffe, 0xd9f7c194, 0xff45853a,
+0x858affff, 0xfffffe9c, 0xc5940f41, 0x3addf741,
+0xffff4685, 0x9b858aff, 0x41fffffe, 0x41c0940f,
+0x853ad8f7, 0xffffff47, 0xfe9a858a, 0xf9c5ffff,
+0xfed0a56e, 0x0f41ffff, 0x9d8ac494, 0xfffffe99,
+0x98bd8a40, 0xc5fffffe, 0xc88d6e79, 0x41fffffe,
+0x853adcf7, 0xffffff48, 0x97b58a40, 0xc5fffffe,
+0xc4ad6ef9, 0x0ffffffe, 0x79c5c094, 0xfec0856e,
+0x63c4ffff, 0xce8d2031, 0x01fffffe, 0x938d8a44,
+0xf7fffffe, 0x499d3ad8, 0xc4ffffff, 0x85203963,
+0xfffffecc, 0xc3940f01, 0x956ef9c5, 0xfffffebc,
+0x2059e3c4, 0xfffecfa5, 0xdbf701ff, 0x4abd3a40,
+0xc4ffffff, 0xad2051e3, 0xfffffecd, 0x940f4001,
+0x6ef9c5c7, 0xfffeb4bd, 0x59c1c4ff, 0xdff7e161,
+0x6151c1c4, 0x7941c4e8, 0x3a40c86e, 0xffff4bb5,
+0x940f41ff, 0x62d9c5c3, 0xb58a40e5, 0xfffffe96,
+0x2041e3c4, 0xfffebabd, 0xf74101ff, 0xb53a40db,
+0xffffff4c, 0xc76e79c5, 0x95b58a40, 0x0ffffffe,
+0xf9c5c294, 0xfeb09d6e, 0xe3c4ffff, 0xbb952069,
+0x01fffffe, 0x3a40daf7, 0xffff4db5, 0x61e3c4ff,
+0xfeb99d20, 0x4101ffff, 0x40c2940f, 0xfe94b58a,
+0xe9c5ffff, 0xf9c5d761, 0xf741ea6e, 0x6ef9c5da,
+0xfffeacb5, 0xb53a40ff, 0xffffff4e, 0xc6940f40,
+0x2049c3c4, 0x43c401f7, 0x01cc2031, 0xde61e1c5,
+0xf9c5def7, 0x3a44f16e, 0xffff4f8d, 0x62e9c5ff,
+0x940f41d3, 0x6ef9c5c1, 0x6ef9c5fe, 0xfffea89d,
+0x6cd9c5ff, 0xd9f741e2, 0xd06ef9c5, 0x956e79c5,
+0xfffffea0, 0x2061e3c4, 0xfffea49d, 0x43c401ff,
+0x01d62029, 0x2049c3c4, 0xe3c401f5, 0x01d32069,
+0x203943c4, 0xc3c401c3, 0x01ea2051, 0x2041c3c4,
+0xc1c401f9, 0xc4da6161, 0xf16149c1, 0x6169c1c4,
+0x61d1c5d0, 0x62e1c5ef, 0x62e9c5de, 0x6ce1c5d5,
+0x5de3c4d2, 0xe801c218, 0xfffff286, 0x44b8c289,
+0x84000005, 0x5e840fd2, 0xc5000013, 0xf0b56ffd,
+0xc5fffffe, 0x709556cc, 0xc5ffffff, 0xf0957ffd,
+0xc5fffffe, 0x708d54f4, 0xc5ffffff, 0x30b56ffd,
+0xc5ffffff, 0x70bd57cc, 0xc5ffffff, 0x30bd7ffd,
+0x8affffff, 0xffff3095, 0x55f4c5ff, 0xfffef08d,
+0x79e3c4ff, 0x3800c814, 0x79e3c4c2, 0x0f01ca14,
+0xd8f7c094, 0xff319538, 0xe3c4ffff, 0x02ca1479,
+0xc7940f41, 0xd06ef9c5, 0x38dff741, 0xffff3295,
+0xc2940fff, 0x2069c3c4, 0xdaf701d7, 0xfed09588,
+0xe3c4ffff, 0x03ca1479, 0xff339538, 0x940fffff,
+0x88daf7c2, 0xfffecf95, 0x79e3c4ff, 0x3804ca14,
+0xffff3495, 0xc2940fff, 0x9588daf7, 0xfffffec8,
+0x1479e3c4, 0x953805ca, 0xffffff35, 0xf7c2940f,
+0xce9588da, 0xc4fffffe, 0xca1479e3, 0x36953806,
+0x0fffffff, 0xdaf7c294, 0xfec49588, 0xe3c4ffff,
+0x07ca1479, 0xff379538, 0x940fffff, 0x88daf7c2,
+0xfffecd95, 0x79e3c4ff, 0x3808ca14, 0xffff3895,
+0xc2940fff, 0x9588daf7, 0xfffffec0, 0x1479e3c4,
+0x953809ca, 0xffffff39, 0xf7c2940f, 0xcc9588da,
+0xc4fffffe, 0xca1479e3, 0x3a95380a, 0x0fffffff,
+0xdaf7c294, 0xfebc9588, 0xe3c4ffff, 0x0bca1479,
+0xff3b9538, 0x940fffff, 0x88daf7c2, 0xfffebb95,
+0x79e3c4ff, 0x380cca14, 0xffff3c95, 0xc2940fff,
+0x9588daf7, 0xfffffeb4, 0x1479e3c4, 0x95380dca,
+0xffffff3d, 0xf7c2940f, 0xba9588da, 0xc4fffffe,
+0xca1479e3, 0x3e95380e, 0x0fffffff, 0xdaf7c294,
+0xfeb09588, 0xe3c4ffff, 0x0fca1479, 0xff3f9538,
+0xe3c4ffff, 0x01c9197d, 0xc4c2940f, 0xc91479e3,
+0x79e3c409, 0xf70dcf14, 0x79c3c4da, 0x880fca14,
+0xfffeb995, 0x79e3c4ff, 0x3800ca14, 0xffff4095,
+0xc2940fff, 0x9588daf7, 0xfffffeac, 0x1479e3c4,
+0x953801ca, 0xffffff41, 0x856e79c5, 0xfffffed0,
+0xc5c2940f, 0xc8a56ef9, 0xc4fffffe, 0x85203963,
+0xfffffecf, 0xc5daf701, 0xc4bd6ef9, 0xc4fffffe,
+0xa52059e3, 0xfffffece, 0xa8958801, 0xc4fffffe,
+0xca1479e3, 0x42953802, 0xc5ffffff, 0xbcb56ef9,
+0x0ffffffe, 0xf9c5c294, 0xfeb49d6e, 0xc1c4ffff,
+0xf7d06169, 0x41e3c4da, 0xfecdbd20, 0xc401ffff,
+0xb52049e3, 0xfffffebb, 0xa4958801, 0xc4fffffe,
+0xca1479e3, 0x43953803, 0xc5ffffff, 0xb0ad6ef9,
+0x0ffffffe, 0xd9c5c294, 0xe3c4e761, 0xb9ad2051,
+0x01fffffe, 0x2061e3c4, 0xfffeba9d, 0xdaf701ff,
+0xd462e9c5, 0xfea09588, 0xe3c4ffff, 0x04ca1479,
+0xff449538, 0xe3c4ffff, 0x05ca1479, 0xc6940f40,
+0xdd61e1c5, 0x9538def7, 0xffffff45, 0x1479e3c4,
+0x0f4106ca, 0xf9c5c694, 0xf741ee6e, 0x469538de,
+0xc4ffffff, 0xca1479e3, 0x940f4107, 0x51c3c4c1,
+0x4101ee20, 0x9538d9f7, 0xffffff47, 0x1479e3c4,
+0x0f4108ca, 0x41c4c594, 0x41c16e79, 0x9538ddf7,
+0xffffff48, 0xc4c2940f, 0xc5203943, 0x38daf701,
+0xffff498d, 0x79e3c4ff, 0x410ac914, 0xc4c4940f,
+0xe86151c1, 0x38dcf741, 0xffff4a8d, 0x79e3c4ff,
+0x410bc914, 0x41c0940f, 0x8d38d8f7, 0xffffff4b,
+0x1479e3c4, 0x940f0cc9, 0x79c1c4c3, 0xdbf7f86e,
+0xff4c8d38, 0x940fffff, 0x41e3c4c1, 0xf701fb20,
+0xbd3840d9, 0xffffff4d, 0x1479e3c4, 0x0f410ecf,
+0xf9c5c394, 0xfec08d6e, 0xf9c5ffff, 0xe3c4e16e,
+0xcc8d2071, 0x01fffffe, 0x40dbf741, 0xff4ebd38,
+0x0f40ffff, 0xc3c4c794, 0x01e32059, 0xf1c5dff7,
+0x3844ce61, 0xffff4f95, 0x62f1c5ff, 0x940f41cb,
+0x6ef9c5c2, 0x6ef9c5f7, 0xfffeac9d, 0x6ce9c5ff,
+0x61e3c4d1, 0xfea89d20, 0x4101ffff, 0xf9c5daf7,
+0x79c5ca6e, 0xfea48d6e, 0x63c4ffff, 0xa08d2031,
+0x01fffffe, 0x2071c3c4, 0xc3c401cc, 0x01f22049,
+0x6161c1c4, 0x61f1c5d9, 0x61d9c5cf, 0x62e1c5e6,
+0x62f1c5dd, 0x6ce1c5cc, 0x6de3c4c9, 0xe801c118,
+0xffffee5e, 0x50b8c289, 0x84000005, 0x36840fd2,
+0x8a00000f, 0x5d8ab045, 0x7d8a40b1, 0xbd4d8ab4,
+0xc018d8f6, 0x5d8adbf6, 0xff1845b2, 0xd06ef9c5,
+0x5d8adbf6, 0x69c3c4b3, 0x4501d720, 0xdbf6c918,
+0xc4b55d8a, 0xc16e7941, 0x40f61845, 0x8a40dff6,
+0x1840b67d, 0xc4dbf6f6, 0xc6203943, 0xed184501,
+0xe66ef9c5, 0x6169c1c4, 0xdff640d0, 0xb77d8a40,
+0xc3c4db18, 0x01e52059, 0xfed09d88, 0xf640ffff,
+0x7d8a40df, 0x40db18b8, 0x8a40dff6, 0x9d88b97d,
+0xfffffecf, 0xf640db18, 0x7d8a40df, 0xc89d88ba,
+0x18fffffe, 0xdff640db, 0xbb7d8a40, 0xfece9d88,
+0xdb18ffff, 0x40dff640, 0x88bc7d8a, 0xfffec49d,
+0x40db18ff, 0x9d88dff6, 0xfffffecd, 0xd9f6db18,
+0xfec09d88, 0x5d8affff, 0xff1840be, 0xccbd8840,
+0x40fffffe, 0xf6bf7d8a, 0x40c918db, 0x8d88dff6,
+0xfffffebc, 0x18c04d8a, 0xbb9d88db, 0x8afffffe,
+0xd9f6c15d, 0xf6ff1840, 0xbd8840db, 0xfffffeb4,
+0xc27d8a40, 0x8d88c918, 0xfffffeba, 0x18dff640,
+0xb09d88db, 0x8afffffe, 0xf9c5c34d, 0xfed0bd6e,
+0xf9c5ffff, 0xfec88d6e, 0x5d8affff, 0x6ef9c5c4,
+0xfffec4b5, 0x558a44ff, 0x6ef9c5cf, 0xfffec09d,
+0xc4d9f6ff, 0xbd2041e3, 0xfffffecf, 0x49e3c401,
+0xfecdb520, 0x4001ffff, 0xdbf6ff18, 0x2071e3c4,
+0xfffece8d, 0x884001ff, 0xfffeb9bd, 0x7d8a40ff,
+0xc5c918c5, 0xbcad6ef9, 0x88fffffe, 0xfffeac8d,
+0xc64d8aff, 0xe761d9c5, 0xce61f1c5, 0xc5dff640,
+0xc5d462e9, 0xb08d6e79, 0xc4fffffe, 0x9d2061e3,
+0xfffffecc, 0xf6db1801, 0xa89d88d9, 0x8afffffe,
+0x1840c75d, 0xbd8840ff, 0xfffffea4, 0xc87d8a40,
+0x2051e3c4, 0xfffebbad, 0xdbf601ff, 0xc4c95d8a,
+0x8d203163, 0xfffffeb9, 0x40c91801, 0x8a40dff6,
+0x8d88cb7d, 0xfffffea0, 0x18ca4d8a, 0x45dbf6d2,
+0xe1c5e418, 0xd9f6dd61, 0xc5cc4d8a, 0xc5cb62f1,
+0xb49d6ef9, 0x45fffffe, 0xf640c018, 0x7d8a40df,
+0x61e3c4cd, 0xfeba9d20, 0x1801ffff, 0x6ce9c5db,
+0x79c1c4d1, 0xd9f6f86e, 0xca6ef9c5, 0x2041e3c4,
+0xc1c401fb, 0x18d96161, 0xdff640c9, 0xce7d8a40,
+0xe16ef9c5, 0xad6ef9c5, 0xfffffeac, 0xc5db1845,
+0xa4856e79, 0xc4fffffe, 0xad2051e3, 0xfffffea8,
+0xdff64001, 0x2071c3c4, 0x63c401cc, 0xa0852039,
+0x01fffffe, 0xc4ff1840, 0xe32059c3, 0x61f1c501,
+0xdaf641cf, 0xc5d21845, 0xc4f76ef9, 0xe86151c1,
+0x2049c3c4, 0xe1c501f2, 0xd9c5dd62, 0xf1c5e661,
+0xe1c5cc62, 0xe3c4c96c, 0x01d1186d, 0x9554ecc5,
+0xffffff50, 0xca6ff9c5, 0x957ffdc5, 0xffffff30,
+0x98e8e98f, 0xf9c5b065, 0xff40956f, 0xe98fffff,
+0xc05d98e8, 0x185de3c4, 0xfdc501fb, 0xfed0bd7f,
+0xfdc5ffff, 0xfed0b56f, 0x958affff, 0xfffffed0,
+0xb57ffdc5, 0xfffffef0, 0xdb76e1c5, 0x65fce1c5,
+0xfce1c5b0, 0xe3c4c05d, 0x01db185d, 0x5d7ffdc5,
+0xf0e98fb0, 0x8fb04d98, 0x5598e8e9, 0x75e3c4c0,
+0xc501da18, 0xc5c9fcf1, 0xc4d2fce9, 0xc81479e3,
+0x7ffdc500, 0xffff109d, 0x79e3c4ff, 0xc409d114,
+0xd71479e3, 0xc4c2380d, 0xca1479e3, 0x79c3c401,
+0x0f0fd214, 0xd8f7c094, 0xfef19538, 0xe3c4ffff,
+0x02ca1479, 0xc7940f41, 0x38dff741, 0xfffef295,
+0xc2940fff, 0x9588daf7, 0xfffffed0, 0x1479e3c4,
+0x953803ca, 0xfffffef3, 0xf7c2940f, 0xcf9588da,
+0xc4fffffe, 0xca1479e3, 0xf4953804, 0x0ffffffe,
+0xdaf7c294, 0xfec89588, 0xe3c4ffff, 0x05ca1479,
+0xfef59538, 0x940fffff, 0x88daf7c2, 0xfffece95,
+0x79e3c4ff, 0x3806ca14, 0xfffef695, 0xc2940fff,
+0x9588daf7, 0xfffffec4, 0x1479e3c4, 0x953807ca,
+0xfffffef7, 0xf7c2940f, 0xcd9588da, 0xc4fffffe,
+0xca1479e3, 0xf8953808, 0x0ffffffe, 0xdaf7c294,
+0xfec09588, 0xe3c4ffff, 0x09ca1479, 0xfef99538,
+0x940fffff, 0x88daf7c2, 0xfffecc95, 0x79e3c4ff,
+0x380aca14, 0xfffefa95, 0xc2940fff, 0x9588daf7,
+0xfffffebc, 0x1479e3c4, 0x95380bca, 0xfffffefb,
+0xf7c2940f, 0xbb9588da, 0xc4fffffe, 0xca1479e3,
+0xfc95380c, 0x0ffffffe, 0xdaf7c294, 0xfeb49588,
+0xe3c4ffff, 0x0dca1479, 0xfefd9538, 0x940fffff,
+0x88daf7c2, 0xfffeba95, 0x79e3c4ff, 0x380eca14,
+0xfffefe95, 0x6e79c5ff, 0xfffed085, 0xc2940fff,
+0x203963c4, 0xfffecf85, 0xf9c501ff, 0xfec8a56e,
+0xdaf7ffff, 0x2059e3c4, 0xfffecea5, 0xf9c501ff,
+0xfec4bd6e, 0xe3c4ffff, 0xcdbd2041, 0x01fffffe,
+0xfeb09588, 0xe3c4ffff, 0x0fca1479, 0x8d6ef9c5,
+0xfffffec0, 0x2071e3c4, 0xfffecc8d, 0x953801ff,
+0xfffffeff, 0xc5c2940f, 0xf7e761d9, 0xb99588da,
+0xc4fffffe, 0xd21479e3, 0x00953800, 0x0fffffff,
+0xdaf7c294, 0xfeac9588, 0xe3c4ffff, 0x01d21479,
+0xff019538, 0x940fffff, 0x88daf7c2, 0xfffea895,
+0x79e3c4ff, 0x3802d214, 0xffff0295, 0xc2940fff,
+0x9588daf7, 0xfffffea4, 0x1479e3c4, 0x953803d2,
+0xffffff03, 0xf7c2940f, 0xa09588da, 0xc4fffffe,
+0xd21479e3, 0x04953804, 0xc4ffffff, 0xd21479e3,
+0x940f4005, 0x38def7c6, 0xffff0595, 0x79e3c4ff,
+0x4106d214, 0x41c6940f, 0x9538def7, 0xffffff06,
+0x1479e3c4, 0x0f4107d2, 0xf741c194, 0x079538d9,
+0xc4ffffff, 0xd21479e3, 0x940f4108, 0xddf741c5,
+0xff089538, 0x940fffff, 0x38daf7c2, 0xffff098d,
+0x79e3c4ff, 0x410ad114, 0x41c4940f, 0x8d38dcf7,
+0xffffff0a, 0x1479e3c4, 0x0f410bd1, 0xf741c094,
+0x0b8d38d8, 0xc4ffffff, 0xd11479e3, 0xc3940f0c,
+0x6e79c1c4, 0x38dbf7f8, 0xffff0c8d, 0xc1940fff,
+0x2041e3c4, 0xd9f701fb, 0x0dbd3840, 0xc4ffffff,
+0xd71479e3, 0x940f410e, 0x6ef9c5c3, 0xdbf741d0,
+0x0ebd3840, 0xc4ffffff, 0xd72069c3, 0x940f4001,
+0x69c1c4c7, 0x41c4d061, 0xf7c16e79, 0x953844df,
+0xffffff0f, 0xb56ef9c5, 0xfffffebc, 0x9d6ef9c5,
+0xfffffeb4, 0xad6ef9c5, 0xfffffeb0, 0xc2940f41,
+0xd462e9c5, 0xc5daf741, 0xc4e16ef9, 0xb52049e3,
+0xfffffebb, 0x6e79c501, 0xfffea48d, 0x51e3c4ff,
+0xfeb9ad20, 0xc401ffff, 0x9d2061e3, 0xfffffeba,
+0x3943c401, 0xc401c520, 0x8d203163, 0xfffffea0,
+0x61f1c501, 0x6ef9c5ce, 0x59c3c4f7, 0xc501e320,
+0xc5dd61e1, 0xc4ee6ef9, 0xf22049c3, 0x62f1c501,
+0x6ef9c5cb, 0xfffeac9d, 0x51c3c4ff, 0xc501ee20,
+0xc5d16ce9, 0xc4ca6ef9, 0xe86151c1, 0x2061e3c4,
+0xfffea89d, 0xc3c401ff, 0x01cc2071, 0xe661d9c5,
+0xcf61f1c5, 0x6161c1c4, 0x62f1c5d9, 0x62e1c5cc,
+0x6ce1c5dd, 0x6de3c4c9, 0xe801c118, 0xffffe752,
+0x21b8c289, 0x84000006, 0x2a840fd2, 0xc5000008,
+0xc5c9eff1, 0xb055f8f1, 0x4df8f1c5, 0x68e98fc0,
+0xff109594, 0xe98fffff, 0x208d9470, 0xc4ffffff,
+0xd01479e3, 0x30853800, 0xc4ffffff, 0xd21479e3,
+0xc0940f01, 0x186de3c4, 0xe3c401d9, 0x09c91479,
+0x9538d8f7, 0xffffff31, 0x1479e3c4, 0xfdc502d2,
+0xfef09d7f, 0x0f41ffff, 0xe3c4c794, 0x0dcf1479,
+0x1479c3c4, 0xf7410fca, 0x329538df, 0x0fffffff,
+0xdaf7c294, 0xfed09588, 0xe3c4ffff, 0x03d21479,
+0xff339538, 0x940fffff, 0x88daf7c2, 0xfffecf95,
+0x79e3c4ff, 0x3804d214, 0xffff3495, 0xc2940fff,
+0x9588daf7, 0xfffffec8, 0x1479e3c4, 0x953805d2,
+0xffffff35, 0xf7c2940f, 0xce9588da, 0xc4fffffe,
+0xd21479e3, 0x36953806, 0x0fffffff, 0xdaf7c294,
+0xfec49588, 0xe3c4ffff, 0x07d21479, 0xff379538,
+0x940fffff, 0x88daf7c2, 0xfffecd95, 0x79e3c4ff,
+0x3808d214, 0xffff3895, 0xc2940fff, 0x9588daf7,
+0xfffffec0, 0x1479e3c4, 0x953809d2, 0xffffff39,
+0xf7c2940f, 0xcc9588da, 0xc4fffffe, 0xd21479e3,
+0x3a95380a, 0x0fffffff, 0xdaf7c294, 0xfebc9588,
+0xe3c4ffff, 0x0bd21479, 0xff3b9538, 0x940fffff,
+0x88daf7c2, 0xfffebb95, 0x79e3c4ff, 0x380cd214,
+0xffff3c95, 0xc2940fff, 0x9588daf7, 0xfffffeb4,
+0x1479e3c4, 0x95380dd2, 0xffffff3d, 0xf7c2940f,
+0xba9588da, 0xc4fffffe, 0xd21479e3, 0x3e95380e,
+0xc5ffffff, 0xd0856e79, 0x0ffffffe, 0x63c4c294,
+0xcf852039, 0x01fffffe, 0xa56ef9c5, 0xfffffec8,
+0xe3c4daf7, 0xcea52059, 0x01fffffe, 0xbd6ef9c5,
+0xfffffec4, 0x2041e3c4, 0xfffecdbd, 0x958801ff,
+0xfffffeb0, 0x1479e3c4, 0xf9c50fd2, 0x9538d06e,
+0xffffff3f, 0x2069c3c4, 0x940f01d7, 0x61d9c5c2,
+0x69c1c4e7, 0xdaf7d061, 0xd462e9c5, 0xfeb99588,
+0xe3c4ffff, 0x00ca1479, 0xff409538, 0x940fffff,
+0x88daf7c2, 0xfffeac95, 0x79e3c4ff, 0x3801ca14,
+0xffff4195, 0xc2940fff, 0x9588daf7, 0xfffffea8,
+0x1479e3c4, 0x953802ca, 0xffffff42, 0xf7c2940f,
+0xa49588da, 0xc4fffffe, 0xca1479e3, 0x43953803,
+0x0fffffff, 0xdaf7c294, 0xfea09588, 0xe3c4ffff,
+0x04ca1479, 0xff449538, 0xe3c4ffff, 0x05ca1479,
+0xc6940f40, 0x9538def7, 0xffffff45, 0x1479e3c4,
+0x0f4106ca, 0xf741c694, 0x469538de, 0xc4ffffff,
+0xca1479e3, 0x940f4107, 0xd9f741c1, 0xff479538,
+0xe3c4ffff, 0x08ca1479, 0xc5940f41, 0x6e7941c4,
+0xddf741c1, 0xff489538, 0x940fffff, 0x3943c4c2,
+0xf701c520, 0x498d38da, 0xc4ffffff, 0xc91479e3,
+0x940f410a, 0xdcf741c4, 0xff4a8d38, 0xe3c4ffff,
+0x0bc91479, 0xc0940f41, 0x38d8f741, 0xffff4b8d,
+0x79e3c4ff, 0x0f0cc914, 0xc1c4c394, 0xf7f86e79,
+0x4c8d38db, 0x0fffffff, 0xe3c4c194, 0x01fb2041,
+0x3840d9f7, 0xffff4dbd, 0x79e3c4ff, 0x410ecf14,
+0xc5c3940f, 0xc08d6ef9, 0xc5fffffe, 0xc4e16ef9,
+0x8d2071e3, 0xfffffecc, 0xdbf74101, 0x4ebd3840,
+0x40ffffff, 0xc4c7940f, 0xe32059c3, 0x44dff701,
+0xff4f9538, 0xf9c5ffff, 0xfebcb56e, 0xf9c5ffff,
+0xfeb49d6e, 0xf9c5ffff, 0xfeb0ad6e, 0x0f41ffff,
+0xe3c4c294, 0xbbb52049, 0x01fffffe, 0xc5daf741,
+0xa48d6e79, 0xc4fffffe, 0xad2051e3, 0xfffffeb9,
+0x61e3c401, 0xfeba9d20, 0xc401ffff, 0x8d203163,
+0xfffffea0, 0x61f1c501, 0x6ef9c5ce, 0x61e1c5f7,
+0x6ef9c5dd, 0x49c3c4ee, 0xc501f220, 0xc5cb62f1,
+0xac9d6ef9, 0xc4fffffe, 0xee2051c3, 0x6ce9c501,
+0x6ef9c5d1, 0x51c1c4ca, 0xe3c4e861, 0xa89d2061,
+0x01fffffe, 0x2071c3c4, 0xd9c501cc, 0xf1c5e661,
+0xc1c4cf61, 0xc5d96161, 0xc5cc62f1, 0xc5dd62e1,
+0xc4c96ce1, 0xc1186de3, 0xe344e801, 0xc289ffff,
+0x000626b8, 0x0fd28400, 0x00041c84, 0x6ffdc500,
+0xffff508d, 0x0001b8ff, 0xfdc50000, 0xff108d7f,
+0x948affff, 0xffff7005, 0x059488ff, 0xffffff10,
+0x02c08348, 0x21f88348, 0xfdc5e875, 0x8f907d6f,
+0x8da274e8, 0xffffff70, 0x79e3c470, 0x3800c814,
+0xffff1085, 0xc0940fff, 0x1479e3c4, 0xd8f701ca,
+0xff119538, 0xe3c4ffff, 0x02ca1479, 0xc7940f41,
+0xd06ef9c5, 0x38dff741, 0xffff1295, 0xc2940fff,
+0x2069c3c4, 0xdaf701d7, 0xfed09588, 0xe3c4ffff,
+0x03ca1479, 0xff139538, 0x940fffff, 0x88daf7c2,
+0xfffecf95, 0x79e3c4ff, 0x3804ca14, 0xffff1495,
+0xc2940fff, 0x9588daf7, 0xfffffec8, 0x1479e3c4,
+0x953805ca, 0xffffff15, 0xf7c2940f, 0xce9588da,
+0xc4fffffe, 0xca1479e3, 0x16953806, 0x0fffffff,
+0xdaf7c294, 0xfec49588, 0xe3c4ffff, 0x07ca1479,
+0xff179538, 0x940fffff, 0x88daf7c2, 0xfffecd95,
+0x79e3c4ff, 0x3808ca14, 0xffff1895, 0xc2940fff,
+0x9588daf7, 0xfffffec0, 0x1479e3c4, 0x953809ca,
+0xffffff19, 0xf7c2940f, 0xcc9588da, 0xc4fffffe,
+0xca1479e3, 0x1a95380a, 0x0fffffff, 0xdaf7c294,
+0xfebc9588, 0xe3c4ffff, 0x0bca1479, 0xff1b9538,
+0x940fffff, 0x88daf7c2, 0xfffebb95, 0x79e3c4ff,
+0x380cca14, 0xffff1c95, 0xc2940fff, 0x9588daf7,
+0xfffffeb4, 0x1479e3c4, 0x95380dca, 0xffffff1d,
+0xf7c2940f, 0xba9588da, 0xc4fffffe, 0xca1479e3,
+0x1e95380e, 0x0fffffff, 0xdaf7c294, 0xfeb09588,
+0xe3c4ffff, 0x0fca1479, 0xff1f9538, 0xe3c4ffff,
+0x01c9197d, 0xc4c2940f, 0xc91479e3, 0x79e3c409,
+0xf70dcf14, 0x79c3c4da, 0x880fca14, 0xfffeb995,
+0x79e3c4ff, 0x3800ca14, 0xffff2095, 0x6e79c5ff,
+0xfffed085, 0xc2940fff, 0xa56ef9c5, 0xfffffec8,
+0x203963c4, 0xfffecf85, 0xdaf701ff, 0xbd6ef9c5,
+0xfffffec4, 0x2059e3c4, 0xfffecea5, 0x958801ff,
+0xfffffeac, 0x1479e3c4, 0xc1c401ca, 0x38d06169,
+0xffff2195, 0xc2940fff, 0xb56ef9c5, 0xfffffebc,
+0x2041e3c4, 0xfffecdbd, 0xdaf701ff, 0x9d6ef9c5,
+0xfffffeb4, 0x2049e3c4, 0xfffebbb5, 0x958801ff,
+0xfffffea8, 0x1479e3c4, 0x953802ca, 0xffffff22,
+0xe761d9c5, 0xc5c2940f, 0xc4d462e9, 0x9d2061e3,
+0xfffffeba, 0x88daf701, 0xfffea495, 0x79e3c4ff,
+0x3803ca14, 0xffff2395, 0xc2940fff, 0x9588daf7,
+0xfffffea0, 0x1479e3c4, 0x953804ca, 0xffffff24,
+0x1479e3c4, 0x0f4005ca, 0xdef7c694, 0xff259538,
+0xe3c4ffff, 0x06ca1479, 0xc6940f41, 0x38def741,
+0xffff2695, 0x79e3c4ff, 0x4107ca14, 0x41c1940f,
+0x9538d9f7, 0xffffff27, 0x1479e3c4, 0x0f4108ca,
+0x41c4c594, 0x41c16e79, 0x9538ddf7, 0xffffff28,
+0xc4c2940f, 0xc5203943, 0x38daf701, 0xffff298d,
+0x79e3c4ff, 0x410ac914, 0x41c4940f, 0x8d38dcf7,
+0xffffff2a, 0x1479e3c4, 0x0f410bc9, 0xf741c094,
+0x2b8d38d8, 0xc4ffffff, 0xc91479e3, 0xc3940f0c,
+0x6e79c1c4, 0x38dbf7f8, 0xffff2c8d, 0xc1940fff,
+0x2041e3c4, 0xd9f701fb, 0x2dbd3840, 0xc4ffffff,
+0xcf1479e3, 0x940f410e, 0x6ef9c5c3, 0xfffec08d,
+0x6ef9c5ff, 0x71e3c4e1, 0xfecc8d20, 0x4101ffff,
+0x3840dbf7, 0xffff2ebd, 0x940f40ff, 0x59c3c4c7,
+0xf701e320, 0x953844df, 0xffffff2f, 0xce61f1c5,
+0xad6ef9c5, 0xfffffeb0, 0xc2940f41, 0x2051e3c4,
+0xfffeb9ad, 0xf74101ff, 0x6e79c5da, 0xfffea48d,
+0x6ef9c5ff, 0x61e1c5f7, 0x6ef9c5dd, 0x49c3c4ee,
+0xc501f220, 0xc5cb62f1, 0xac9d6ef9, 0xc4fffffe,
+0xee2051c3, 0x6ce9c501, 0x6ef9c5d1, 0x51c1c4ca,
+0xe3c4e861, 0xa89d2061, 0x01fffffe, 0x2071c3c4,
+0xd9c501cc, 0x63c4e661, 0xa08d2031, 0x01fffffe,
+0xcf61f1c5, 0xcc62f1c5, 0x6161c1c4, 0x62e1c5d9,
+0x6ce1c5dd, 0x6de3c4c9, 0xe801c118, 0xffffdf22,
+0xc019013c, 0x00072a25, 0xc4814800, 0x00000180,
+0x415a415b, 0x415d415c, 0x5d5f415e, 0xf8628d49,
+0x000000c3,
+0020401,
+};
+asm(".type xop_x86_64_D_32u1, STT_NOTYPE;");
+asm(".type xop_x86_64_D_32u1, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_32i2[] = {
+0x48552beb, 0x8348e589, 0xfdc5e0e4, 0xe024447f,
+0x24448d48, 0xe28948e0, 0x75ff3880, 0xc0ff480c,
+0x75d03948, 0xeb01b0f3, 0xc9c03102, 0x548d4cc3,
+0x83480824, 0x01b8e0e4, 0x31000000, 0x72ff41f6,
+0x0010b9f8, 0x48550000, 0x5741e589, 0x55415641,
+0x52415441, 0x0011ba41, 0x48530000, 0x0140ec81,
+0x85c70000, 0xfffffeec, 0x00000010, 0x45ff788d,
+0x8941d089, 0x41fa89c1, 0xe283c029, 0x01fa8301,
+0xe283d219, 0x85caff02, 0xff0575c7, 0x01b640c9,
+0x8c894466, 0xffff4e45, 0x894466ff, 0xff6e4584,
+0x8966ffff, 0x668e4554, 0xae454c89, 0x48c0ff48,
+0x7511f883, 0xf68440b7, 0x8d890674, 0xfffffeec,
+0xbd6ffdc5, 0xffffff50, 0xbd7ffdc5, 0xfffffef0,
+0xfef0858b, 0x3966ffff, 0xffff5085, 0xc0940fff,
+0xf29d8b66, 0x45fffffe, 0xb60fff31, 0x66d8f7c0,
+0xff529d3b, 0x8966ffff, 0xfffeb09d, 0x940f41ff,
+0xf49d8bc7, 0x45fffffe, 0xf9c5c931, 0xf741d06e,
+0x9d3b66df, 0xffffff54, 0xc1940f41, 0xde9d8966,
+0x45fffffe, 0x8b66f631, 0xfffef69d, 0xd9f741ff,
+0x569d3b66, 0xc4ffffff, 0xd7c469c1, 0x940f4101,
+0x9d8966c6, 0xfffffed8, 0x6e79c1c4, 0xf89d8be1,
+0x41fffffe, 0x3b66def7, 0xffff589d, 0xc1940fff,
+0xdc9d8966, 0x66fffffe, 0xfefa9d8b, 0x3145ffff,
+0xc9b60fed, 0xc459c1c4, 0xd9f701e6, 0x5a9d3b66,
+0x66ffffff, 0xfed69d89, 0xe9c5ffff, 0x9d8bd462,
+0xfffffefc, 0xc5940f41, 0xc5c03145, 0x41c96ef9,
+0x3b66ddf7, 0xffff5c9d, 0x940f41ff, 0x9d8966c0,
+0xfffffed4, 0x8b66d231, 0xfffefe9d, 0xd8f741ff,
+0x5e9d3b66, 0xc4ffffff, 0xcdc471c1, 0xc2940f01,
+0xd29d8966, 0x8bfffffe, 0xffff009d, 0x79c1c4ff,
+0xdaf7d86e, 0x9c958966, 0x31fffffe, 0x9d3b66d2,
+0xffffff60, 0xd09d8966, 0x66fffffe, 0xff029d8b,
+0x940fffff, 0xe43145c2, 0x3b66daf7, 0xffff629d,
+0x9d8966ff, 0xfffffeae, 0xff049d8b, 0x0f41ffff,
+0x8966c494, 0xfffe9895, 0xdcf741ff, 0xac9d8966,
+0x66fffffe, 0xff649d3b, 0x0f40ffff, 0x8b66c794,
+0xffff069d, 0x08958bff, 0x40ffffff, 0x66ffb60f,
+0xff0ab58b, 0x4466ffff, 0xff0e958b, 0xdff7ffff,
+0x669d3b66, 0x66ffffff, 0xfeaa9d89, 0x940fffff,
+0x6ef9c5c3, 0x958966ef, 0xfffffea8, 0x9dc4e1c5,
+0xfffffe9c, 0xdbb60f01, 0xa6b58966, 0xf7fffffe,
+0x953b66db, 0xffffff68, 0x95894466, 0xfffffea2,
+0xcb62f1c5, 0xc5c2940f, 0xc5d16ce9, 0x01ebc4d1,
+0x0fdb3145, 0xf9c5d2b6, 0xfe988d6e, 0xdaf7ffff,
+0x6ab53b66, 0x8bffffff, 0xffff0cb5, 0x71c1c4ff,
+0x4101ccc4, 0xc5c3940f, 0xc5da6ef9, 0x41cd62f1,
+0x3b66dbf7, 0xffff6cb5, 0xb58966ff, 0xfffffea4,
+0xc6940f40, 0xc461c1c4, 0x0f4001db, 0xdef7f6b6,
+0x953b4466, 0xffffff6e, 0xc2940f41, 0xe66ef9c5,
+0xd2b60f45, 0xc4daf741, 0xe2c459c1, 0x62e1c501,
+0x6cf1c5dc, 0x6de3c4cb, 0xe801c118, 0xfffffcd2,
+0x39b8c289, 0x84000005, 0x70840fd2, 0xc500001c,
+0xf09d6ff9, 0xc5fffffe, 0x00a56ff9, 0xc5ffffff,
+0x508dfde1, 0xc5ffffff, 0x6095fdd9, 0xc4ffffff,
+0xca1875e3, 0x7ffdc501, 0xffff108d, 0x6ff9c5ff,
+0xffff50bd, 0x71e9c5ff, 0xf9c501f7, 0xff60bd6f,
+0xf9c5ffff, 0x6600c2c5, 0xff108539, 0x940fffff,
+0x71f1c5c0, 0xb60f01f7, 0xc5f9c5c0, 0xf9c501d1,
+0xf705f1c5, 0xc579c5d8, 0x896607d1, 0xfffe9c85,
+0xc5f9c5ff, 0x396601c2, 0xffff1285, 0xc0940fff,
+0x0fc93145, 0xd8f7c0b6, 0x98858966, 0xc5fffffe,
+0x02c2c5f9, 0x14853966, 0xc5ffffff, 0x03c2c5f9,
+0xc1940f41, 0x41ff3145, 0x3966d9f7, 0xffff1685,
+0xc5f9c5ff, 0x0f4104c2, 0xc931c794, 0x6e79c1c4,
+0xdff741f1, 0x18853966, 0xc5ffffff, 0x05c2c5f9,
+0x45c1940f, 0xc1c4f631, 0x01f7c449, 0x3966d9f7,
+0xffff1a85, 0xc5f9c5ff, 0x0f4106c2, 0x3145c694,
+0xdef741c0, 0x1c853966, 0xc5ffffff, 0x07c2c5f9,
+0xc0940f41, 0xc5ed3145, 0x9c956ef9, 0xc5fffffe,
+0x9895c4e9, 0x01fffffe, 0x66d8f741, 0xff1e8539,
+0x0f41ffff, 0xf9c5c594, 0xc400c1c5, 0xe86e79c1,
+0x66ddf741, 0xff208539, 0xe9c5ffff, 0x940fd662,
+0xe43145c0, 0xc451c1c4, 0xb60f01ed, 0x66d8f7c0,
+0xff229539, 0xf9c5ffff, 0x4102d1c5, 0x31c4940f,
+0xdcf741ff, 0x24953966, 0xc5ffffff, 0x03d1c5f9,
+0xc7940f40, 0xdff7db31, 0x26953966, 0xc5ffffff,
+0x04d1c5f9, 0xc5c3940f, 0xf7ff6ef9, 0x953966db,
+0xffffff28, 0x45c2940f, 0xc1c5db31, 0x0f01fbc4,
+0xdaf7d2b6, 0x2ab53966, 0xc5ffffff, 0x06f1c5f9,
+0xc3940f41, 0xc96ef9c5, 0x66dbf741, 0xff2cb539,
+0xc1c4ffff, 0x01cec471, 0xc6940f40, 0xcd62f1c5,
+0xea6ef9c5, 0xf6b60f40, 0xd16ce9c5, 0xc86ef9c5,
+0x4466def7, 0xff2e9539, 0xc1c4ffff, 0x01ccc471,
+0xc2940f41, 0xf66ef9c5, 0xc451c1c4, 0x0f4501eb,
+0xf1c5d2b6, 0xf741cf62, 0x49c1c4da, 0xc501f2c4,
+0xc5ee62d1, 0xc4cd6cf1, 0xc1186de3, 0xfaa0e801,
+0xc289ffff, 0x00053fb8, 0x0fd28400, 0x001a3e84,
+0x6ff9c500, 0xffff10bd, 0xf9c1c5ff, 0xffff508d,
+0x6ff9c5ff, 0xffff20bd, 0xf9c1c5ff, 0xffff6095,
+0x75e3c4ff, 0xc501ca18, 0x308d7ffd, 0x8bffffff,
+0xffff3085, 0x853966ff, 0xfffffef0, 0x66c0940f,
+0xfeaebd8b, 0x8b66ffff, 0xfffeaa9d, 0xc0b60fff,
+0xfea8958b, 0x8b66ffff, 0xfffea6b5, 0x66d8f7ff,
+0xfe9c8589, 0x858bffff, 0xfffffeb0, 0x32853b66,
+0x0fffffff, 0x3145c094, 0xc0b60fc9, 0x8966d8f7,
+0xfffeb085, 0x858b66ff, 0xfffffede, 0x34853b66,
+0x8bffffff, 0xfffed885, 0x940f41ff, 0xff3145c1,
+0x66d9f741, 0xff36853b, 0x858bffff, 0xfffffedc,
+0xc7940f41, 0xc1c4c931, 0x41f16e79, 0x3b66dff7,
+0xffff3885, 0x858b66ff, 0xfffffed6, 0x45c1940f,
+0xc1c4f631, 0x01f7c449, 0x3b66d9f7, 0xffff3a85,
+0xd4858bff, 0x41fffffe, 0x45c6940f, 0xf9c5c031,
+0xf741c96e, 0x853b66de, 0xffffff3c, 0xd2858b66,
+0x41fffffe, 0x45c0940f, 0xc1c4ed31, 0x01cec471,
+0x66d8f741, 0xff3e853b, 0x858bffff, 0xfffffed0,
+0xc5940f41, 0x6e79c1c4, 0xddf741e8, 0x40853b66,
+0x0fffffff, 0x3145c094, 0x51c1c4e4, 0x0f01edc4,
+0xf1c5c0b6, 0xd8f7cd62, 0x42bd3b66, 0x8bffffff,
+0xfffeacbd, 0x940f41ff, 0xdcf741c4, 0x44bd3b66,
+0x40ffffff, 0x40c7940f, 0xf7ffb60f, 0x9d3b66df,
+0xffffff46, 0xc5c3940f, 0x0fff6ef9, 0xdbf7dbb6,
+0x48953b66, 0x0fffffff, 0x3145c294, 0xc4c1c5db,
+0xb60f01fb, 0x66daf7d2, 0xff4ab53b, 0xb58bffff,
+0xfffffea4, 0xc3940f41, 0xea6ef9c5, 0x66dbf741,
+0xff4cb53b, 0x4466ffff, 0xfea2958b, 0xf9c5ffff,
+0xfe9c956e, 0x0f40ffff, 0xc1c4c694, 0x01ebc451,
+0x95c4e9c5, 0xfffffeb0, 0xb60f4001, 0x66def7f6,
+0x4e953b44, 0xc5ffffff, 0x41d662e9, 0xc5c2940f,
+0xc5d16ce9, 0x45f66ef9, 0xc5d2b60f, 0x41c86ef9,
+0xc1c4daf7, 0x01ccc471, 0xc449c1c4, 0xf1c501f2,
+0xd1c5cf62, 0xf1c5ee62, 0xe3c4cd6c, 0x01c1186d,
+0xfff86de8, 0xb8c289ff, 0x00000544, 0x840fd284,
+0x0000180b, 0x556ff9c5, 0x6ff9c580, 0xffff708d,
+0xd5e1c5ff, 0xffff509d, 0xd5d9c5ff, 0xffff60a5,
+0x65e3c4ff, 0xc501dc18, 0xc5d2d5e9, 0xc5c9d5f1,
+0xc5f36ff9, 0xf09d7ffd, 0xc4fffffe, 0xca1875e3,
+0x6ff9c501, 0x7ffdc5e9, 0xffff108d, 0x6ff9c5ff,
+0xffff5095, 0x6ff9c5ff, 0xffff608d, 0xfde9c5ff,
+0xffff709d, 0xfdf1c5ff, 0xe3c48065, 0x01dc1865,
+0x9d7ffdc5, 0xffffff30, 0xa5f9e9c5, 0xffffff70,
+0xf5f9c9c5, 0xc6c5f9c5, 0xd5d9c500, 0xf9f1c5e3,
+0xe1c5805d, 0xff409dd5, 0x79c5ffff, 0xc501cbc5,
+0x06f3c579, 0xfbc579c5, 0xc5f9c507, 0xf9c500d4,
+0xc501ccc5, 0x05f4c5f9, 0xc5c23966, 0x01c6c5f9,
+0x185de3c4, 0x940f01fb, 0xed3145c2, 0xbd7ffdc5,
+0xffffff30, 0xbd6ff9c5, 0xffffff00, 0xc5d2b60f,
+0x20adf9c1, 0xf7ffffff, 0xc13966da, 0xccc5f9c5,
+0x940f4102, 0xc5f9c5c5, 0x314502c6, 0xddf741c0,
+0xc5c13966, 0x03ccc5f9, 0xc0940f41, 0xc6c5f9c5,
+0xe4314503, 0x66d8f741, 0xf9c5c139, 0xc504ccc5,
+0x04c6c5f9, 0xc4940f41, 0x66dcf741, 0xf9c5c139,
+0x0f05c6c5, 0xdb31c194, 0xf7c9b60f, 0xc63966d9,
+0xf4c5f9c5, 0xc3940f06, 0xc6c5f9c5, 0xf7ff3106,
+0xc63966db, 0xf4c5f9c5, 0x940f4007, 0xc5f9c5c7,
+0xf9c507c6, 0x3145e26e, 0xc4dff7db, 0xf06e79c1,
+0xc459c1c4, 0x396601e5, 0x940f41c6, 0xc5f9c5c3,
+0xf9c500f3, 0x4100c5c5, 0x3966dbf7, 0xc5f9c5c6,
+0x940f01f5, 0xd23145c0, 0xc449c1c4, 0xb60f01f4,
+0x62d9c5c0, 0x66d8f7e6, 0xc5f13941, 0x02cbc579,
+0xf5c5f9c5, 0x940f4102, 0xdaf741c2, 0xf1394166,
+0xcbc579c5, 0x940f4003, 0xb60f40c6, 0x66def7f6,
+0xfeb0b589, 0xf9c5ffff, 0x6603f5c5, 0xc5f13941,
+0x04cbc579, 0xc6940f40, 0xf6b60f40, 0xbd6ef9c5,
+0xfffffeb0, 0x8966def7, 0xfffedeb5, 0xc5f9c5ff,
+0xc1c504f5, 0xfedebdc4, 0x6601ffff, 0xc5f13941,
+0x05cbc579, 0xd96ef9c5, 0xc6940f40, 0xdbc4e1c5,
+0xb60f4001, 0x66def7f6, 0xfed8b589, 0xf9c5ffff,
+0x6605f5c5, 0xc5f13941, 0x06f5c5f9, 0xc1940f41,
+0xc9b60f45, 0x66d9f741, 0xc5f63941, 0x07f5c579,
+0xc6940f40, 0xef6ef9c5, 0xf6b60f40, 0xc451c1c4,
+0xdef701eb, 0xf7394566, 0xdd62e1c5, 0xc6940f41,
+0xe36cd9c5, 0xf66ef9c5, 0xf6b60f45, 0xd86ef9c5,
+0xad6ef9c5, 0xfffffed8, 0xc4def741, 0xdac461c1,
+0x51c1c401, 0xc401e9c4, 0xf6c449c1, 0x62e1c501,
+0x62d1c5df, 0x6ce1c5ee, 0x5de3c4dd, 0xe801c318,
+0xfffff5ae, 0x5bb8c289, 0x84000005, 0x4c840fd2,
+0xc5000015, 0x709dd5e9, 0xc5ffffff, 0x8065d5f1,
+0x1865e3c4, 0xfdc501dc, 0xfef09d7f, 0xc766ffff,
+0xffff1085, 0x310010ff, 0x000ebfc0, 0x8d480000,
+0xffff2c8d, 0x85c766ff, 0xffffff2e, 0xfe890010,
+0x29ca8948, 0xb40366c6, 0xffff1005, 0xc22948ff,
+0x05b48966, 0xffffff12, 0x02c08348, 0x48328966,
+0x750ef883, 0x10858bd9, 0x31ffffff, 0x853966d2,
+0xfffffef0, 0x66c2940f, 0xff12858b, 0x3145ffff,
+0xbd8b66ff, 0xffffff22, 0x3966daf7, 0xfffef285,
+0x14858bff, 0x41ffffff, 0x45c7940f, 0xf9c5c931,
+0x4466e26e, 0xff2e958b, 0xf741ffff, 0x853966df,
+0xfffffef4, 0x16858b66, 0x41ffffff, 0x45c1940f,
+0xc1c4f631, 0x01e7c459, 0x66d9f741, 0xfef68539,
+0x858bffff, 0xffffff18, 0xc6940f41, 0xc1c4c931,
+0x41f16e79, 0x3966def7, 0xfffef885, 0x858b66ff,
+0xffffff1a, 0x45c1940f, 0xc1c4ed31, 0x01f6c449,
+0x3966d9f7, 0xfffefa85, 0x1c858bff, 0xc5ffffff,
+0x41e662d9, 0x45c5940f, 0xf9c5c031, 0xf741d96e,
+0x853966dd, 0xfffffefc, 0x1e858b66, 0x41ffffff,
+0x45c0940f, 0xc1c4e431, 0x01ddc461, 0x66d8f741,
+0xfefe8539, 0x0f41ffff, 0xc031c494, 0x6e79c1c4,
+0xdcf741e8, 0x00b53966, 0x66ffffff, 0xff26b58b,
+0x940fffff, 0xc4db31c0, 0xecc451c1, 0x66d8f701,
+0xff02bd39, 0xbd8bffff, 0xffffff24, 0xdd62e1c5,
+0xc5c3940f, 0xc5e36cd9, 0xf7d86ef9, 0xbd3966db,
+0xffffff04, 0xc7940f40, 0xc5db3145, 0x01dbc4e1,
+0xffb60f40, 0x3966dff7, 0xffff06b5, 0x28b58bff,
+0x41ffffff, 0xc5c3940f, 0x41ff6ef9, 0x3966dbf7,
+0xffff08b5, 0x940f40ff, 0x41c1c4c6, 0x4001fbc4,
+0xc5f6b60f, 0xf7df62e1, 0xb58966de, 0xfffffeb0,
+0x2ab58b66, 0x66ffffff, 0xff0ab539, 0x0f40ffff,
+0x0f40c694, 0xdef7f6b6, 0xdeb58966, 0x8bfffffe,
+0xffff2cb5, 0xb53966ff, 0xffffff0c, 0xc6940f40,
+0xf6b60f40, 0x4466def7, 0xff0e9539, 0xf9c5ffff,
+0xfeb0ad6e, 0x0f41ffff, 0xf9c5c294, 0xd1c5f66e,
+0xfedeadc4, 0x4501ffff, 0x41d2b60f, 0xc1c4daf7,
+0x01f2c449, 0xee62d1c5, 0xdd6ce1c5, 0x185de3c4,
+0x4be801c3, 0x89fffff3, 0x05c8b8c2, 0xd2840000,
+0x12e9840f, 0xe9c50000, 0xc59055d5, 0xa04dd5f1,
+0x186de3c4, 0xfdc501e9, 0xff30ad7f, 0xf9c5ffff,
+0xff30bd6f, 0xd9c5ffff, 0xc503f771, 0x40bd6ff9,
+0xc5ffffff, 0x03f771e1, 0x185de3c4, 0xfdc501fb,
+0xfeb0bd7f, 0xfdc5ffff, 0xfeb0bd6f, 0x958bffff,
+0xfffffeb0, 0xbd7ffdc5, 0xfffffef0, 0xbd6ff9c5,
+0xffffff30, 0xf771e1c5, 0x6ff9c502, 0xffff40bd,
+0x71d9c5ff, 0xe3c402f7, 0x01dc1865, 0x9d7ffdc5,
+0xffffff10, 0xa56ff9c5, 0xffffff10, 0x9d6ff9c5,
+0xffffff20, 0xe4fdd9c5, 0xdbfde1c5, 0xc4c5f9c5,
+0xc5f9c500, 0x79c501f3, 0x6607d3c5, 0xf9c5c239,
+0x0f01c4c5, 0x3145c294, 0xd2b60fff, 0x3966daf7,
+0xfffef285, 0xc5f9c5ff, 0x0f4102c4, 0x3145c794,
+0xdff741c9, 0xf4853966, 0xc5fffffe, 0x03c4c5f9,
+0xc1940f41, 0x41f63145, 0x3966d9f7, 0xfffef685,
+0xc5f9c5ff, 0x0f4104c4, 0xc931c694, 0x6e79c1c4,
+0xdef741f9, 0xf8853966, 0xc5fffffe, 0x05c4c5f9,
+0x45c1940f, 0xc1c4ed31, 0x01fec441, 0x3966d9f7,
+0xfffefa85, 0xc5f9c5ff, 0x0f4106c4, 0x3145c594,
+0xddf741c0, 0xfc853966, 0xc5fffffe, 0x07c4c5f9,
+0xc0940f41, 0xc5e43145, 0x41e26ef9, 0x3966d8f7,
+0xfffefe85, 0xc5f9c5ff, 0x0f4100c3, 0xc1c4c494,
+0xc4f06e79, 0xe7c459c1, 0xdcf74101, 0x00853966,
+0xc5ffffff, 0x0fe762d9, 0xdb31c094, 0xc449c1c4,
+0xb60f01f4, 0x66d8f7c0, 0xff02b539, 0xf9c5ffff,
+0x0f02f3c5, 0xff31c394, 0x3966dbf7, 0xffff04b5,
+0xc5f9c5ff, 0x0f4003f3, 0x3145c794, 0x66dff7db,
+0xff06b539, 0xf9c5ffff, 0x4104f3c5, 0xc5c3940f,
+0x41c76e79, 0x3966dbf7, 0xffff08b5, 0x940f40ff,
+0x3941c4c6, 0x4001c3c4, 0xf7f6b60f, 0xb58966de,
+0xfffffeb0, 0xf3c5f9c5, 0xb5396605, 0xffffff0a,
+0xc6940f40, 0xf6b60f40, 0x8966def7, 0xfffedeb5,
+0xc5f9c5ff, 0xf9c506f3, 0x3966d96e, 0xffff0cb5,
+0x940f40ff, 0x61c1c4c6, 0x4001ddc4, 0xc5f6b60f,
+0xc5de62e1, 0xb0b56ef9, 0xc5fffffe, 0xdeb5c4c9,
+0x01fffffe, 0xd9c5def7, 0x4466e36c, 0xff0e9539,
+0x0f41ffff, 0xf9c5c294, 0xf9c5d86e, 0x0f45fe6e,
+0xe1c5d2b6, 0x4101dbc4, 0xc1c4daf7, 0xc4d86261,
+0xfac441c1, 0x62c9c501, 0x6ce1c5f7, 0x5de3c4de,
+0xe801c318, 0xfffff0ca, 0xedb8c289, 0x84000005,
+0x68840fd2, 0xc5000010, 0xf0bd6ff9, 0xc5fffffe,
+0x02e771e1, 0xbd6ff9c5, 0xffffff00, 0xe771d9c5,
+0x65e3c402, 0xc501dc18, 0x309d7ffd, 0xc5ffffff,
+0x30a56ff9, 0x31ffffff, 0x6ff9c5d2, 0xffff409d,
+0xfdd9c5ff, 0xfde1c5e4, 0xc5f9c5db, 0xf9c500c4,
+0xc501f3c5, 0x07d3c579, 0x10853966, 0x0fffffff,
+0xf9c5c294, 0x4501c4c5, 0xdaf7ff31, 0x12853966,
+0xc5ffffff, 0x02c4c5f9, 0xc7940f41, 0x41c93145,
+0x3966dff7, 0xffff1485, 0xc5f9c5ff, 0x0f4103c4,
+0x3145c194, 0xd9f741f6, 0x16853966, 0xc5ffffff,
+0x04c4c5f9, 0xc6940f41, 0xc1c4c931, 0x41f96e79,
+0x3966def7, 0xffff1885, 0xc5f9c5ff, 0x940f05c4,
+0xed3145c1, 0xc441c1c4, 0xd9f701fe, 0x1a853966,
+0xc5ffffff, 0x06c4c5f9, 0xc5940f41, 0x41c03145,
+0x3966ddf7, 0xffff1c85, 0xc5f9c5ff, 0x0f4107c4,
+0x3145c094, 0x6ef9c5e4, 0xd8f741e2, 0x1e853966,
+0xc5ffffff, 0x00c3c5f9, 0xc4940f41, 0x6e79c1c4,
+0x59c1c4f0, 0x4101e7c4, 0x3966dcf7, 0xffff2085,
+0x62d9c5ff, 0xc0940fe7, 0xc1c4db31, 0x01f4c449,
+0xf7c0b60f, 0xb53966d8, 0xffffff22, 0xf3c5f9c5,
+0xc3940f02, 0xdbf7ff31, 0x24b53966, 0xc5ffffff,
+0x03f3c5f9, 0xc7940f40, 0xf7db3145, 0xb53966df,
+0xffffff26, 0xf3c5f9c5, 0x940f4104, 0x6e79c5c3,
+0xdbf741c7, 0x28b53966, 0x40ffffff, 0xc4c6940f,
+0xc3c43941, 0xb60f4001, 0x66def7f6, 0xfeb0b589,
+0xf9c5ffff, 0x6605f3c5, 0xff2ab539, 0x0f40ffff,
+0x0f40c694, 0xdef7f6b6, 0xdeb58966, 0xc5fffffe,
+0x06f3c5f9, 0xd96ef9c5, 0x2cb53966, 0x40ffffff,
+0xc4c6940f, 0xddc461c1, 0xb60f4001, 0x62e1c5f6,
+0x6ef9c5de, 0xfffeb0b5, 0xc4c9c5ff, 0xfffedeb5,
+0xdef701ff, 0xe36cd9c5, 0x95394466, 0xffffff2e,
+0xc2940f41, 0xd86ef9c5, 0xfe6ef9c5, 0xd2b60f45,
+0xdbc4e1c5, 0xdaf74101, 0x6261c1c4, 0x41c1c4d8,
+0xc501fac4, 0xc5f762c9, 0xc4de6ce1, 0xc3185de3,
+0xee9ce801, 0xc289ffff, 0x0005f2b8, 0x0fd28400,
+0x000e3a84, 0xec85c700, 0x03fffffe, 0xc5000000,
+0xc5dd6ff9, 0x30ad7ffd, 0x48ffffff, 0xfeec8563,
+0xf9c5ffff, 0xff40a56f, 0xe1c4ffff, 0xc5e86ef9,
+0xc5f5f1e1, 0xc4edf1d9, 0xfd184de3, 0x7ffdc501,
+0xfffeb0bd, 0x6ffdc5ff, 0xfffeb0bd, 0xb0958bff,
+0xc5fffffe, 0xf0bd7ffd, 0xc7fffffe, 0xfffeec85,
+0x000002ff, 0x85634800, 0xfffffeec, 0x6ef9e1c4,
+0xf1e1c5e8, 0xf1d9c5dd, 0x65e3c4e5, 0xc501dc18,
+0x109d7ffd, 0xc5ffffff, 0x10a56ff9, 0xc5ffffff,
+0x209d6ff9, 0xc5ffffff, 0xc5e4fdd9, 0xc5dbfde1,
+0x00c4c5f9, 0xf3c5f9c5, 0xc579c501, 0x396607d3,
+0xc5f9c5c2, 0x940f01c4, 0xff3145c2, 0xf7d2b60f,
+0x853966da, 0xfffffef2, 0xc4c5f9c5, 0x940f4102,
+0xc93145c7, 0x66dff741, 0xfef48539, 0xf9c5ffff,
+0x4103c4c5, 0x45c1940f, 0xf741f631, 0x853966d9,
+0xfffffef6, 0xc4c5f9c5, 0x940f4104, 0xc4c931c6,
+0xf16e79c1, 0x66def741, 0xfef88539, 0xf9c5ffff,
+0x0f05c4c5, 0x3145c194, 0x49c1c4ed, 0xf701f6c4,
+0x853966d9, 0xfffffefa, 0xc4c5f9c5, 0x940f4106,
+0xc03145c5, 0x66ddf741, 0xfefc8539, 0xf9c5ffff,
+0x4107c4c5, 0x45c0940f, 0xf9c5e431, 0xf741e26e,
+0x853966d8, 0xfffffefe, 0xc3c5f9c5, 0x940f4100,
+0x79c1c4c4, 0xc1c4e86e, 0x01e7c459, 0x66dcf741,
+0xff008539, 0xd9c5ffff, 0x940fe662, 0xc4db31c0,
+0xecc451c1, 0xc0b60f01, 0x3966d8f7, 0xffff02b5,
+0xc5f9c5ff, 0x940f02f3, 0xf7ff31c3, 0xb53966db,
+0xffffff04, 0xf3c5f9c5, 0x940f4003, 0xdb3145c7,
+0x3966dff7, 0xffff06b5, 0xc5f9c5ff, 0x0f4104f3,
+0xf9c5c394, 0xf741ff6e, 0xb53966db, 0xffffff08,
+0xc6940f40, 0xc441c1c4, 0x0f4001fb, 0xdef7f6b6,
+0xb0b58966, 0xc5fffffe, 0x05f3c5f9, 0x0ab53966,
+0x40ffffff, 0x40c6940f, 0xf7f6b60f, 0xb58966de,
+0xfffffede, 0xf3c5f9c5, 0x6ef9c506, 0xb53966d9,
+0xffffff0c, 0xc6940f40, 0xc461c1c4, 0x0f4001dd,
+0xe1c5f6b6, 0xf9c5dd62, 0xfeb0ad6e, 0xd1c5ffff,
+0xfedeadc4, 0xf701ffff, 0x6cd9c5de, 0x394466e3,
+0xffff0e95, 0x940f41ff, 0x6ef9c5c2, 0x6ef9c5d8,
+0xb60f45f6, 0xc4e1c5d2, 0xf74101db, 0x62e1c5da,
+0x49c1c4df, 0xc501f2c4, 0xc5ee62d1, 0xc4dd6ce1,
+0xc3185de3, 0xec18e801, 0xc289ffff, 0x000605b8,
+0x0fd28400, 0x000bb684, 0x85634800, 0xfffffeec,
+0xbd6ff9c5, 0xfffffef0, 0x6ef9e1c4, 0xe1c1c5e0,
+0x6ff9c5dc, 0xffff00bd, 0xe1c1c5ff, 0x65e3c4e4,
+0xc501dc18, 0x309d7ffd, 0xc5ffffff, 0x30a56ff9,
+0x31ffffff, 0x6ff9c5d2, 0xffff409d, 0xfdd9c5ff,
+0xfde1c5e4, 0xc5f9c5db, 0xf9c500c4, 0xc501f3c5,
+0x07d3c579, 0x10853966, 0x0fffffff, 0xf9c5c294,
+0x4501c4c5, 0xdaf7ff31, 0x12853966, 0xc5ffffff,
+0x02c4c5f9, 0xc7940f41, 0x41c93145, 0x3966dff7,
+0xffff1485, 0xc5f9c5ff, 0x0f4103c4, 0x3145c194,
+0xd9f741f6, 0x16853966, 0xc5ffffff, 0x04c4c5f9,
+0xc6940f41, 0xc1c4c931, 0x41f16e79, 0x3966def7,
+0xffff1885, 0xc5f9c5ff, 0x940f05c4, 0xed3145c1,
+0xc449c1c4, 0xd9f701f6, 0x1a853966, 0xc5ffffff,
+0x06c4c5f9, 0xc5940f41, 0x41c03145, 0x3966ddf7,
+0xffff1c85, 0xc5f9c5ff, 0x0f4107c4, 0x3145c094,
+0x6ef9c5e4, 0xd8f741e2, 0x1e853966, 0xc5ffffff,
+0x00c3c5f9, 0xc4940f41, 0x6e79c1c4, 0x59c1c4e8,
+0x4101e7c4, 0x3966dcf7, 0xffff2085, 0x62d9c5ff,
+0xc0940fe6, 0xc1c4db31, 0x01ecc451, 0xf7c0b60f,
+0xb53966d8, 0xffffff22, 0xf3c5f9c5, 0xc3940f02,
+0xdbf7ff31, 0x24b53966, 0xc5ffffff, 0x03f3c5f9,
+0xc7940f40, 0xf7db3145, 0xb53966df, 0xffffff26,
+0xf3c5f9c5, 0x940f4104, 0x6ef9c5c3, 0xdbf741ff,
+0x28b53966, 0x40ffffff, 0xc4c6940f, 0xfbc441c1,
+0xb60f4001, 0x66def7f6, 0xfeb0b589, 0xf9c5ffff,
+0x6605f3c5, 0xff2ab539, 0x0f40ffff, 0x0f40c694,
+0xdef7f6b6, 0xdeb58966, 0xc5fffffe, 0x06f3c5f9,
+0xd96ef9c5, 0x2cb53966, 0x40ffffff, 0xc4c6940f,
+0xddc461c1, 0xb60f4001, 0x62e1c5f6, 0x6ef9c5dd,
+0xfffeb0ad, 0xc4d1c5ff, 0xfffedead, 0xdef701ff,
+0xe36cd9c5, 0x95394466, 0xffffff2e, 0xc2940f41,
+0xd86ef9c5, 0xf66ef9c5, 0xd2b60f45, 0xdbc4e1c5,
+0xdaf74101, 0xdf62e1c5, 0xc449c1c4, 0xd1c501f2,
+0xe1c5ee62, 0xe3c4dd6c, 0x01c3185d, 0xffe9e1e8,
+0xb8c289ff, 0x00000609, 0x840fd284, 0x0000097f,
+0xf9c5c031, 0x6600d2c5, 0x00b07d83, 0xc5d04e0f,
+0x01fac579, 0xb27d8366, 0xc579c500, 0x79c502ca,
+0x4403f2c5, 0xc5f84e0f, 0x04f2c5f9, 0xeac579c5,
+0x7d836605, 0x0f4400b4, 0x8366c84e, 0xc500b67d,
+0x06c2c579, 0xe2c579c5, 0xc5f9c507, 0x0f4400c9,
+0xf9c5f04e, 0xc501d9c5, 0x02f9c5f9, 0xb87d8366,
+0xc579c500, 0xf9c505d9, 0xc1c4d26e, 0x0fe16e79,
+0x79c5f04e, 0x6607d1c5, 0x00ba7d83, 0xe84e0f44,
+0xbc7d8366, 0x59c1c400, 0x4401e6c4, 0xc4c04e0f,
+0xd7c469c1, 0x7d836601, 0x0f4400be, 0xe9c5e04e,
+0x8366d462, 0x0f00c07d, 0xc1c4c84e, 0x66d86e79,
+0x00c27d83, 0xc4d84e0f, 0xdcc461c1, 0x7d836601,
+0x4e0f00c4, 0x7d8366f8, 0x896600c6, 0xfffeb0bd,
+0xc5f9c5ff, 0x4e0f03f9, 0x7d8366f8, 0x896600c8,
+0xfffedebd, 0xc5f9c5ff, 0xf9c504f9, 0xfeb0ad6e,
+0xd1c5ffff, 0xfedeadc4, 0x0f01ffff, 0x8366f84e,
+0x4400ca7d, 0x66d84e0f, 0x00cc7d83, 0xd8bd8966,
+0xc5fffffe, 0x06f9c5f9, 0xce6ef9c5, 0xc4f84e0f,
+0xcdc471c1, 0x7d836601, 0xf1c500ce, 0x0f44cb62,
+0xe9c5d04e, 0xf9c5d16c, 0xfed89d6e, 0xf9c5ffff,
+0xf9c5c96e, 0xc1c4e76e, 0x01dbc461, 0xcbc4f1c5,
+0x59c1c401, 0xc501e2c4, 0xc5cd62f1, 0xc5dc62e1,
+0xc4cb6cf1, 0xd1186de3, 0x6ff9c501, 0x7ffdc5ca,
+0xffff3095, 0xe8e98fff, 0xc5b06599, 0x40956ff9,
+0x8fffffff, 0x5d99e8e9, 0x5de3c4c0, 0xc501fb18,
+0xb0bd7ffd, 0xc5fffffe, 0xb0bd6ffd, 0x8bfffffe,
+0xfffeb095, 0x7ffdc5ff, 0xfffef0bd, 0x6ff9c5ff,
+0x0007eb25, 0x6ff9c500, 0xf9c5b07d, 0xc5c0756f,
+0xc5dcf9c1, 0xc4e4f9c9, 0xdc1865e3, 0x7ffdc501,
+0xe98fb05d, 0xb04d99f0, 0x99e8e98f, 0xe3c4c055,
+0x01da1875, 0xc9fdf1c5, 0xd2fde9c5, 0xc1c5f9c5,
+0xc5f9c500, 0x79c501f2, 0xc507d2c5, 0x109d7ffd,
+0x66ffffff, 0xf9c5c239, 0x0f01c1c5, 0x3145c294,
+0xd2b60fff, 0x3966daf7, 0xfffef285, 0xc5f9c5ff,
+0x0f4102c1, 0x3145c794, 0xdff741c9, 0xf4853966,
+0xc5fffffe, 0x03c1c5f9, 0xc1940f41, 0x41f63145,
+0x3966d9f7, 0xfffef685, 0xc5f9c5ff, 0x0f4104c1,
+0xc931c694, 0x6e79c1c4, 0xdef741e1, 0xf8853966,
+0xc5fffffe, 0x05c1c5f9, 0x45c1940f, 0xc1c4ed31,
+0x01e6c459, 0x3966d9f7, 0xfffefa85, 0xc5f9c5ff,
+0x0f4106c1, 0x3145c594, 0xddf741c0, 0xfc853966,
+0xc5fffffe, 0x07c1c5f9, 0xc0940f41, 0xc5e43145,
+0x41c96ef9, 0x3966d8f7, 0xfffefe85, 0xc5f9c5ff,
+0x0f4100c2, 0xc1c4c494, 0xc4d86e79, 0xcdc471c1,
+0xdcf74101, 0x00853966, 0x0fffffff, 0xdb31c094,
+0xc461c1c4, 0xb60f01dc, 0x62f1c5c0, 0x66d8f7cb,
+0xff02b539, 0xf9c5ffff, 0x0f02f2c5, 0xff31c394,
+0x3966dbf7, 0xffff04b5, 0xc5f9c5ff, 0x0f4003f2,
+0x3145c794, 0x66dff7db, 0xff06b539, 0xf9c5ffff,
+0x4104f2c5, 0xc5c3940f, 0x41ef6ef9, 0x3966dbf7,
+0xffff08b5, 0x940f40ff, 0x51c1c4c6, 0x4001ebc4,
+0xf7f6b60f, 0xb58966de, 0xfffffeb0, 0xf2c5f9c5,
+0xb5396605, 0xffffff0a, 0xc6940f40, 0xf6b60f40,
+0xf9c5def7, 0xfeb09d6e, 0x8966ffff, 0xfffedeb5,
+0xc5f9c5ff, 0xf9c506f2, 0x3966d26e, 0xffff0cb5,
+0x940f40ff, 0x69c1c4c6, 0xc501d7c4, 0xde9dc4e1,
+0x01fffffe, 0xf6b60f40, 0xd462e9c5, 0x4466def7,
+0xff0e9539, 0xe9c5ffff, 0x0f41d16c, 0xf9c5c294,
+0xf9c5c86e, 0x0f45e66e, 0xf1c5d2b6, 0x4101cbc4,
+0xf1c5daf7, 0xc1c4cd62, 0x01e2c459, 0xdc62e1c5,
+0xcb6cf1c5, 0x186de3c4, 0x03e801c1, 0x89ffffe6,
+0x0621b8c2, 0xd2840000, 0x05a1840f, 0xf1c50000,
+0xf1c5c9ef, 0xc5b055f9, 0xc04df9f1, 0xe98fd231,
+0x10959968, 0x8fffffff, 0x8d9970e9, 0xffffff20,
+0xc2c5f9c5, 0xc5f9c500, 0xe3c401f1, 0x01d9186d,
+0x30853966, 0x0fffffff, 0xf9c5c294, 0x4501c2c5,
+0xfdc5ff31, 0xfef09d7f, 0xdaf7ffff, 0x32853966,
+0xc5ffffff, 0x02c2c5f9, 0xc7940f41, 0xc5c93145,
+0x07d1c579, 0x66dff741, 0xff348539, 0xf9c5ffff,
+0x4103c2c5, 0x45c1940f, 0xf741f631, 0x853966d9,
+0xffffff36, 0xc2c5f9c5, 0x940f4104, 0xc4c931c6,
+0xe16e79c1, 0x66def741, 0xff388539, 0xf9c5ffff,
+0x0f05c2c5, 0x3145c194, 0x59c1c4ed, 0xf701e6c4,
+0x853966d9, 0xffffff3a, 0xc2c5f9c5, 0x940f4106,
+0xc03145c5, 0x66ddf741, 0xff3c8539, 0xf9c5ffff,
+0x4107c2c5, 0x45c0940f, 0xf9c5e431, 0xf741d26e,
+0x853966d8, 0xffffff3e, 0xc1c5f9c5, 0x940f4100,
+0x79c1c4c4, 0xc1c4d86e, 0x01d7c469, 0x66dcf741,
+0xff408539, 0xe9c5ffff, 0x940fd462, 0xc4db31c0,
+0xdcc461c1, 0xc0b60f01, 0x3966d8f7, 0xffff42b5,
+0xc5f9c5ff, 0x940f02f1, 0xf7ff31c3, 0xb53966db,
+0xffffff44, 0xf1c5f9c5, 0x940f4003, 0xdb3145c7,
+0x3966dff7, 0xffff46b5, 0xc5f9c5ff, 0x0f4104f1,
+0xf9c5c394, 0xf741ef6e, 0xb53966db, 0xffffff48,
+0xc6940f40, 0xc451c1c4, 0x0f4001eb, 0xdef7f6b6,
+0xb0b58966, 0xc5fffffe, 0x05f1c5f9, 0x4ab53966,
+0x40ffffff, 0x40c6940f, 0xf7f6b60f, 0xb58966de,
+0xfffffede, 0xf1c5f9c5, 0x6ef9c506, 0xb53966c9,
+0xffffff4c, 0xc6940f40, 0xc471c1c4, 0x0f4001cd,
+0xf1c5f6b6, 0xf9c5cb62, 0xfeb09d6e, 0xe1c5ffff,
+0xfede9dc4, 0xf701ffff, 0x6ce9c5de, 0x394466d1,
+0xffff4e95, 0x940f41ff, 0x6ef9c5c2, 0x6ef9c5c8,
+0xb60f45e6, 0xc4f1c5d2, 0xf74101cb, 0x62f1c5da,
+0x59c1c4cd, 0xc501e2c4, 0xc5dc62e1, 0xc4cb6cf1,
+0xc1186de3, 0xe3e8e801, 0xc289ffff, 0x000626b8,
+0x0fd28400, 0x00038684, 0x6ffdc500, 0xffff508d,
+0x0002b8ff, 0xfdc50000, 0xff108d7f, 0x8b66ffff,
+0xff700594, 0x8966ffff, 0xff100594, 0x8348ffff,
+0x834804c0, 0xe67522f8, 0x8366c031, 0x0f00907d,
+0x3145c09f, 0x66d8f7ff, 0x00927d83, 0xc79f0f41,
+0xc5c93145, 0x41d06ef9, 0x8366dff7, 0x4100947d,
+0x45c19f0f, 0xc1c4f631, 0x01d7c469, 0x66d9f741,
+0x00967d83, 0xc69f0f41, 0xc1c4c931, 0x41e96e79,
+0x8366def7, 0x0f00987d, 0x3145c19f, 0x51c1c4ed,
+0xf701eec4, 0x7d8366d9, 0xe9c5009a, 0x0f41d562,
+0x3145c59f, 0x6ef9c5c0, 0xddf741d9, 0x9c7d8366,
+0x9f0f4100, 0xe43145c0, 0xc461c1c4, 0xf74101dd,
+0x7d8366d8, 0x0f41009e, 0xd231c49f, 0x6e79c1c4,
+0xdcf741e0, 0xa07d8366, 0xc29f0f00, 0xc1c4db31,
+0x01e4c459, 0x8366daf7, 0xc500a27d, 0x0fdc62e1,
+0xff31c39f, 0xd36ce9c5, 0x8366dbf7, 0xc500a47d,
+0x40da6ef9, 0x45c79f0f, 0xe1c5db31, 0xf701dbc4,
+0x7d8366df, 0x0f4100a6, 0xf631c39f, 0xf76ef9c5,
+0x66dbf741, 0x00a87d83, 0xc69f0f40, 0xc449c1c4,
+0xdef701f3, 0xde62e1c5, 0xb0b58966, 0x31fffffe,
+0x7d8366f6, 0x0f4000aa, 0xdef7c69f, 0xdeb58966,
+0x31fffffe, 0x7d8366f6, 0xf9c500ac, 0xfeb0a56e,
+0xd9c5ffff, 0xfedea5c4, 0x4001ffff, 0x45c69f0f,
+0xdef7d231, 0xae7d8366, 0x9f0f4100, 0x6ef9c5c2,
+0x41d231ee, 0xc1c4daf7, 0x01eac451, 0xe562d9c5,
+0xdc6ce1c5, 0x186de3c4, 0xe88f01d3, 0x708da274,
+0x20ffffff, 0xc1c5f9c5, 0x85396600, 0xffffff10,
+0xc5c2940f, 0x01c1c5f9, 0xf7ff3145, 0x853966da,
+0xffffff12, 0xc1c5f9c5, 0x940f4102, 0xc93145c7,
+0xd26ef9c5, 0x66dff741, 0xff148539, 0xf9c5ffff,
+0x4103c1c5, 0x45c1940f, 0xc1c4f631, 0x01d7c469,
+0x66d9f741, 0xff168539, 0xf9c5ffff, 0x4104c1c5,
+0x31c6940f, 0x79c1c4c9, 0xf741e16e, 0x853966de,
+0xffffff18, 0xc1c5f9c5, 0xc1940f05, 0xc4ed3145,
+0xe6c459c1, 0x66d9f701, 0xff1a8539, 0xf9c5ffff,
+0x4106c1c5, 0x45c5940f, 0xe9c5c031, 0xf741d462,
+0x853966dd, 0xffffff1c, 0xc1c5f9c5, 0x940f4107,
+0xe43145c0, 0x197de3c4, 0xf74101c9, 0x853966d8,
+0xffffff1e, 0xc1c5f9c5, 0x940f4100, 0xc5f9c5c4,
+0x79c501f1, 0x4107d1c5, 0x3966dcf7, 0xffff2085,
+0x79c1c4ff, 0x940fd86e, 0xc4db31c0, 0xdcc461c1,
+0xc0b60f01, 0x3966d8f7, 0xffff22b5, 0xc5f9c5ff,
+0x940f02f1, 0xf7ff31c3, 0xb53966db, 0xffffff24,
+0xf1c5f9c5, 0x940f4003, 0xdb3145c7, 0x3966dff7,
+0xffff26b5, 0xc5f9c5ff, 0x0f4104f1, 0xf9c5c394,
+0xf741ef6e, 0xb53966db, 0xffffff28, 0xc6940f40,
+0xc451c1c4, 0x0f4001eb, 0xdef7f6b6, 0xb0b58966,
+0xc5fffffe, 0x05f1c5f9, 0x2ab53966, 0x40ffffff,
+0x40c6940f, 0xf7f6b60f, 0xb58966de, 0xfffffede,
+0xf1c5f9c5, 0x6ef9c506, 0xb53966c9, 0xffffff2c,
+0xc6940f40, 0xc471c1c4, 0x0f4001cd, 0xf1c5f6b6,
+0xf9c5cb62, 0xfeb09d6e, 0xe1c5ffff, 0xfede9dc4,
+0xf701ffff, 0x6ce9c5de, 0x394466d1, 0xffff2e95,
+0x940f41ff, 0x6ef9c5c2, 0x6ef9c5c8, 0xb60f45e6,
+0xc4f1c5d2, 0xf74101cb, 0x62f1c5da, 0x59c1c4cd,
+0xc501e2c4, 0xc5dc62e1, 0xc4cb6cf1, 0xc1186de3,
+0xe05ce801, 0x013cffff, 0x2a25c019, 0x48000007,
+0x0140c481, 0x415b0000, 0x415c415a, 0x415e415d,
+0x8d495d5f, 0x00c3f862, 0x00000000, 0x00000000,
+0x00010001, 0x00010001, 0x00010001, 0x00010001,
+0017740,
+};
+asm(".type xop_x86_64_D_32i2, STT_NOTYPE;");
+asm(".type xop_x86_64_D_32i2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_32u2[] = {
+0x48552beb, 0x8348e589, 0xfdc5e0e4, 0xe024447f,
+0x24448d48, 0xe28948e0, 0x75ff3880, 0xc0ff480c,
+0x75d03948, 0xeb01b0f3, 0xc9c03102, 0x548d4cc3,
+0x83480824, 0x01b8e0e4, 0x31000000, 0x72ff41f6,
+0x0010baf8, 0x48550000, 0x5741e589, 0x55415641,
+0x52415441, 0x0011ba41, 0x48530000, 0x0140ec81,
+0x85c70000, 0xfffffeec, 0x00000010, 0x45ff788d,
+0x8941d089, 0x41f989c1, 0xe183c029, 0x85c9ff01,
+0xff0575c7, 0x01b640ca, 0x8c894466, 0xffff4e45,
+0x894466ff, 0xff6e4584, 0x8966ffff, 0x668e454c,
+0xae455489, 0x48c0ff48, 0x7511f883, 0xf68440bf,
+0x95890674, 0xfffffeec, 0xbd6ffdc5, 0xffffff50,
+0xbd7ffdc5, 0xfffffef0, 0xfef0858b, 0x3966ffff,
+0xffff5085, 0xc0940fff, 0xf29d8b66, 0x45fffffe,
+0xbd8bff31, 0xfffffef8, 0xf7c0b60f, 0x9d3b66d8,
+0xffffff52, 0xb09d8966, 0x41fffffe, 0x8bc7940f,
+0xfffef49d, 0xc93145ff, 0xd06ef9c5, 0x66dff741,
+0xff549d3b, 0x8966ffff, 0xfffedcbd, 0x940f41ff,
+0x9d8966c1, 0xfffffede, 0x66f63145, 0xfef69d8b,
+0xf741ffff, 0x9d3966d9, 0xffffff56, 0xc469c1c4,
+0x0f4101d7, 0xc931c694, 0x6e79c1c4, 0xdef741e1,
+0x58bd3b66, 0x66ffffff, 0xfefabd8b, 0x940fffff,
+0xed3145c1, 0xc459c1c4, 0xd9f701e6, 0x5abd3b66,
+0x66ffffff, 0xfedabd89, 0xe9c5ffff, 0xbd8bd462,
+0xfffffefc, 0xc5940f41, 0xc5c03145, 0x41c96ef9,
+0x3b66ddf7, 0xffff5cbd, 0x940f41ff, 0xbd8966c0,
+0xfffffed8, 0x8b66d231, 0xfffefebd, 0xd8f741ff,
+0x5ebd3b66, 0xc4ffffff, 0xcdc471c1, 0xc2940f01,
+0xd6bd8966, 0x8bfffffe, 0xffff00bd, 0x79c1c4ff,
+0xdaf7d86e, 0xa0958966, 0x31fffffe, 0xbd3b66d2,
+0xffffff60, 0xd4bd8966, 0x66fffffe, 0xff02bd8b,
+0x940fffff, 0xe43145c2, 0x3b66daf7, 0xffff62bd,
+0xbd8966ff, 0xfffffed2, 0xff04bd8b, 0x0f41ffff,
+0x8966c494, 0xfffe9c95, 0xdcf741ff, 0x8966fb89,
+0xfffed0bd, 0x66ff31ff, 0xff649d3b, 0x0f40ffff,
+0x8b66c794, 0xffff069d, 0x08958bff, 0xf7ffffff,
+0x9d3b66df, 0xffffff66, 0x0ab58b66, 0x66ffffff,
+0xfeae9d89, 0x940fffff, 0x8b4466c3, 0xffff0e95,
+0x6ef9c5ff, 0xdbb60fef, 0xac958966, 0xc5fffffe,
+0xa09dc4e1, 0x01fffffe, 0x3b66dbf7, 0xffff6895,
+0xb58966ff, 0xfffffeaa, 0x45c2940f, 0xf1c5db31,
+0x4466cb62, 0xfea69589, 0xb60fffff, 0x6ce9c5d2,
+0x6ef9c5d1, 0xfffe9c8d, 0x66daf7ff, 0xff6ab53b,
+0xb58bffff, 0xffffff0c, 0xc471c1c4, 0x0f4101cc,
+0xf9c5c394, 0xd1c5da6e, 0x4101ebc4, 0x3b66dbf7,
+0xffff6cb5, 0xb58966ff, 0xfffffea8, 0xcd62f1c5,
+0xc6940f40, 0xc461c1c4, 0x0f4001db, 0xdef7f6b6,
+0x953b4466, 0xffffff6e, 0xc2940f41, 0xe66ef9c5,
+0xd2b60f45, 0xc4daf741, 0xe2c459c1, 0x62e1c501,
+0x6cf1c5dc, 0x6de3c4cb, 0xe801c118, 0xfffffce2,
+0x39b8c289, 0x84000005, 0x38840fd2, 0xc500001a,
+0xf0bd6ff9, 0xc5fffffe, 0x508dfdc1, 0xc5ffffff,
+0x00bd6ff9, 0xc5ffffff, 0x6095fdc1, 0xc4ffffff,
+0xca1875e3, 0x7ffdc501, 0xffff108d, 0x6ff9c5ff,
+0xffff50bd, 0x71e9c5ff, 0xf9c501f7, 0xff60bd6f,
+0xf9c5ffff, 0x6600c2c5, 0xff108539, 0x940fffff,
+0x71f1c5c0, 0xb60f01f7, 0xc5f9c5c0, 0xf9c501d1,
+0xf705f1c5, 0xc579c5d8, 0x896607d1, 0xfffea085,
+0xc5f9c5ff, 0x396601c2, 0xffff1285, 0xc0940fff,
+0x0fc93145, 0xd8f7c0b6, 0x9c858966, 0xc5fffffe,
+0x02c2c5f9, 0x14853966, 0xc5ffffff, 0x03c2c5f9,
+0xc1940f41, 0x41ff3145, 0x3966d9f7, 0xffff1685,
+0xc5f9c5ff, 0x0f4104c2, 0xc931c794, 0x6e79c1c4,
+0xdff741e1, 0x18853966, 0xc5ffffff, 0x05c2c5f9,
+0x45c1940f, 0xc1c4f631, 0x01e7c459, 0x3966d9f7,
+0xffff1a85, 0xc5f9c5ff, 0x0f4106c2, 0x3145c694,
+0xdef741c0, 0x1c853966, 0xc5ffffff, 0x07c2c5f9,
+0xc0940f41, 0xc5ed3145, 0xa0956ef9, 0xc5fffffe,
+0x9c95c4e9, 0x01fffffe, 0x66d8f741, 0xff1e8539,
+0x0f41ffff, 0xf9c5c594, 0xc400c1c5, 0xd86e79c1,
+0x66ddf741, 0xff208539, 0xe9c5ffff, 0x940fd462,
+0xe43145c0, 0xc461c1c4, 0xb60f01dd, 0x66d8f7c0,
+0xff229539, 0xf9c5ffff, 0x4102d1c5, 0x31c4940f,
+0xdcf741ff, 0x24953966, 0xc5ffffff, 0x03d1c5f9,
+0xc7940f40, 0xdff7db31, 0x26953966, 0xc5ffffff,
+0x04d1c5f9, 0xc5c3940f, 0xf7ef6ef9, 0x953966db,
+0xffffff28, 0x45c2940f, 0xd1c5db31, 0x0f01ebc4,
+0xdaf7d2b6, 0x2ab53966, 0xc5ffffff, 0x06f1c5f9,
+0xc3940f41, 0xc96ef9c5, 0x66dbf741, 0xff2cb539,
+0xc1c4ffff, 0x01cec471, 0xc6940f40, 0xcb62f1c5,
+0xda6ef9c5, 0xf6b60f40, 0xd16ce9c5, 0xc86ef9c5,
+0x4466def7, 0xff2e9539, 0xc1c4ffff, 0x01ccc471,
+0xc2940f41, 0xe66ef9c5, 0xc461c1c4, 0x0f4501db,
+0xf1c5d2b6, 0xf741cd62, 0x59c1c4da, 0xc501e2c4,
+0xc5dc62e1, 0xc4cb6cf1, 0xc1186de3, 0xfab0e801,
+0xc289ffff, 0x00053fb8, 0x0fd28400, 0x00180684,
+0x6ff9c500, 0xffff10bd, 0xf9c1c5ff, 0xffff508d,
+0x6ff9c5ff, 0xffff20bd, 0xf9c1c5ff, 0xffff6095,
+0x75e3c4ff, 0xc501ca18, 0x308d7ffd, 0x8bffffff,
+0xffff3085, 0x853966ff, 0xfffffef0, 0x66c0940f,
+0xfed2bd8b, 0x8b66ffff, 0xfffeae9d, 0xc0b60fff,
+0xfeac958b, 0x8b66ffff, 0xfffeaab5, 0x66d8f7ff,
+0xfea08589, 0x858bffff, 0xfffffeb0, 0x32853b66,
+0x0fffffff, 0x3145c094, 0xc0b60fc9, 0x8966d8f7,
+0xfffeb085, 0x858b66ff, 0xfffffede, 0x34853b66,
+0x66ffffff, 0xff36858b, 0x0f41ffff, 0x3145c194,
+0xd9f741ff, 0xf6853966, 0x8bfffffe, 0xfffedc85,
+0x940f41ff, 0xc4c931c7, 0xe96e79c1, 0x66dff741,
+0xff38853b, 0x8b66ffff, 0xfffeda85, 0xc1940fff,
+0xc4f63145, 0xefc451c1, 0x66d9f701, 0xff3a853b,
+0x858bffff, 0xfffffed8, 0xc6940f41, 0xc5c03145,
+0x41d16ef9, 0x3b66def7, 0xffff3c85, 0x858b66ff,
+0xfffffed6, 0xc0940f41, 0xc4ed3145, 0xd6c469c1,
+0xd8f74101, 0x3e853b66, 0x8bffffff, 0xfffed485,
+0x940f41ff, 0x79c1c4c5, 0xf741e06e, 0x853b66dd,
+0xffffff40, 0x45c0940f, 0xc1c4e431, 0x01e5c459,
+0xc5c0b60f, 0xf7d462e9, 0xbd3b66d8, 0xffffff42,
+0xfed0bd8b, 0x0f41ffff, 0xf741c494, 0xbd3b66dc,
+0xffffff44, 0xc7940f40, 0xffb60f40, 0x3b66dff7,
+0xffff469d, 0xc3940fff, 0xf76ef9c5, 0xf7dbb60f,
+0x953b66db, 0xffffff48, 0x45c2940f, 0xc9c5db31,
+0x0f01f3c4, 0xdaf7d2b6, 0x4ab53b66, 0x8bffffff,
+0xfffea8b5, 0x940f41ff, 0x6ef9c5c3, 0xdbf741e2,
+0x4cb53b66, 0x66ffffff, 0xa6958b44, 0xc5fffffe,
+0xa09d6ef9, 0x40fffffe, 0xc4c6940f, 0xe3c459c1,
+0xc4e1c501, 0xfffeb09d, 0x0f4001ff, 0xdef7f6b6,
+0x953b4466, 0xffffff4e, 0xdd62e1c5, 0xc2940f41,
+0xda6ce1c5, 0xee6ef9c5, 0xd2b60f45, 0xd06ef9c5,
+0xc4daf741, 0xd4c469c1, 0x51c1c401, 0xc501eac4,
+0xc5d662e9, 0xc5e562d9, 0xc4d46ce9, 0xc21865e3,
+0xf87ce801, 0xc289ffff, 0x000544b8, 0x0fd28400,
+0x0015d284, 0x6ffdc500, 0xfffef0bd, 0x56c4c5ff,
+0xffff7095, 0x7ffdc5ff, 0xfffef095, 0x54f4c5ff,
+0xffff708d, 0x7ffdc5ff, 0xffff108d, 0x6ffdc5ff,
+0xffff30bd, 0x57c4c5ff, 0xffff70bd, 0x7ffdc5ff,
+0xffff30bd, 0x30958bff, 0xc5ffffff, 0xf08d55f4,
+0xc5fffffe, 0x00c1c5f9, 0xc5c23966, 0x01c1c5f9,
+0x45c2940f, 0xb60fff31, 0x66daf7d2, 0xff328539,
+0xf9c5ffff, 0x4102c1c5, 0x45c7940f, 0xf9c5c931,
+0xf741d26e, 0x853966df, 0xffffff34, 0xc1c5f9c5,
+0x940f4103, 0xf63145c1, 0xc469c1c4, 0xf74101d7,
+0x853966d9, 0xffffff36, 0xc1c5f9c5, 0x940f4104,
+0xc4c931c6, 0xe16e79c1, 0x66def741, 0xff388539,
+0xf9c5ffff, 0x0f05c1c5, 0x3145c194, 0x59c1c4ed,
+0xf701e6c4, 0x853966d9, 0xffffff3a, 0xc1c5f9c5,
+0x940f4106, 0xc03145c5, 0xd462e9c5, 0x66ddf741,
+0xff3c8539, 0xf9c5ffff, 0x4107c1c5, 0x45c0940f,
+0xe3c4e431, 0x01c9197d, 0x66d8f741, 0xff3e8539,
+0xf9c5ffff, 0x4100c1c5, 0xc5c4940f, 0x01f1c5f9,
+0xd1c579c5, 0xdcf74107, 0x40853966, 0xc4ffffff,
+0xd86e79c1, 0x31c0940f, 0x61c1c4db, 0x0f01dcc4,
+0xd8f7c0b6, 0x42b53966, 0xc5ffffff, 0x02f1c5f9,
+0x31c3940f, 0x66dbf7ff, 0xff44b539, 0xf9c5ffff,
+0x4003f1c5, 0x45c7940f, 0xdff7db31, 0x46b53966,
+0xc5ffffff, 0x04f1c5f9, 0xc3940f41, 0xef6ef9c5,
+0x66dbf741, 0xff48b539, 0x0f40ffff, 0xc1c4c694,
+0x01ebc451, 0xf6b60f40, 0x8966def7, 0xfffeb0b5,
+0xc5f9c5ff, 0x396605f1, 0xffff4ab5, 0x940f40ff,
+0xb60f40c6, 0x66def7f6, 0xfedeb589, 0xf9c5ffff,
+0xc506f1c5, 0x66c96ef9, 0xff4cb539, 0x0f40ffff,
+0xc1c4c694, 0x01cdc471, 0xf6b60f40, 0xcb62f1c5,
+0x9d6ef9c5, 0xfffffeb0, 0x9dc4e1c5, 0xfffffede,
+0xc5def701, 0x66d16ce9, 0x4e953944, 0x41ffffff,
+0xc5c2940f, 0xc5c86ef9, 0x45e66ef9, 0xc5d2b60f,
+0x01cbc4f1, 0xc5daf741, 0xc4cd62f1, 0xe2c459c1,
+0x62e1c501, 0x6cf1c5dc, 0x6de3c4cb, 0xe801c118,
+0xfffff63e, 0x50b8c289, 0x84000005, 0x94840fd2,
+0xc5000013, 0x50bd6ff9, 0xc5ffffff, 0x708dd5c1,
+0xc5ffffff, 0x60bd6ff9, 0xc5ffffff, 0x8055d5c1,
+0x1875e3c4, 0xfdc501ca, 0xfef08d7f, 0xc766ffff,
+0xffff1085, 0x310010ff, 0x000ebfc0, 0x8d480000,
+0xffff2c8d, 0x85c766ff, 0xffffff2e, 0xfe890010,
+0x29ca8948, 0xb40366c6, 0xffff1005, 0xc22948ff,
+0x05b48966, 0xffffff12, 0x02c08348, 0x48328966,
+0x750ef883, 0x10858bd9, 0x31ffffff, 0x853966d2,
+0xfffffef0, 0x66c2940f, 0xff12858b, 0x3145ffff,
+0xbd8b66ff, 0xffffff22, 0x3966daf7, 0xfffef285,
+0x14858bff, 0x41ffffff, 0x45c7940f, 0xf9c5c931,
+0x4466d26e, 0xff2e958b, 0xf741ffff, 0x853966df,
+0xfffffef4, 0x16858b66, 0x41ffffff, 0x45c1940f,
+0xc1c4f631, 0x01d7c469, 0x66d9f741, 0xfef68539,
+0x858bffff, 0xffffff18, 0xc6940f41, 0xc1c4c931,
+0x41e16e79, 0x3966def7, 0xfffef885, 0x858b66ff,
+0xffffff1a, 0x45c1940f, 0xc1c4ed31, 0x01e6c459,
+0x3966d9f7, 0xfffefa85, 0x1c858bff, 0xc5ffffff,
+0x41d462e9, 0x45c5940f, 0xf9c5c031, 0xf741c96e,
+0x853966dd, 0xfffffefc, 0x1e858b66, 0x41ffffff,
+0x45c0940f, 0xc1c4e431, 0x01cdc471, 0x66d8f741,
+0xfefe8539, 0x0f41ffff, 0xc031c494, 0x6e79c1c4,
+0xdcf741d8, 0x00b53966, 0x66ffffff, 0xff26b58b,
+0x940fffff, 0xc4db31c0, 0xdcc461c1, 0x66d8f701,
+0xff02bd39, 0xbd8bffff, 0xffffff24, 0xcb62f1c5,
+0xc5c3940f, 0xc5d16ce9, 0xf7c86ef9, 0xbd3966db,
+0xffffff04, 0xc7940f40, 0xc5db3145, 0x01cbc4f1,
+0xffb60f40, 0x3966dff7, 0xffff06b5, 0x28b58bff,
+0x41ffffff, 0xc5c3940f, 0x41ef6ef9, 0x3966dbf7,
+0xffff08b5, 0x940f40ff, 0x51c1c4c6, 0x4001ebc4,
+0xc5f6b60f, 0xf7cd62f1, 0xb58966de, 0xfffffeb0,
+0x2ab58b66, 0x66ffffff, 0xff0ab539, 0x0f40ffff,
+0x0f40c694, 0xdef7f6b6, 0xdeb58966, 0x8bfffffe,
+0xffff2cb5, 0xb53966ff, 0xffffff0c, 0xc6940f40,
+0xf6b60f40, 0x4466def7, 0xff0e9539, 0xf9c5ffff,
+0xfeb09d6e, 0x0f41ffff, 0xf9c5c294, 0xe1c5e66e,
+0xfede9dc4, 0x4501ffff, 0x41d2b60f, 0xc1c4daf7,
+0x01e2c459, 0xdc62e1c5, 0xcb6cf1c5, 0x186de3c4,
+0xcbe801c1, 0x89fffff3, 0x05c8b8c2, 0xd2840000,
+0x1121840f, 0xfdc50000, 0xff509d6f, 0xfdc5ffff,
+0xff309d7f, 0xf9c5ffff, 0xff30bd6f, 0xe9c5ffff,
+0xc503f771, 0x40bd6ff9, 0xc5ffffff, 0x03f771f1,
+0x186de3c4, 0xfdc501f9, 0xfeb0bd7f, 0xfdc5ffff,
+0xfeb0bd6f, 0x958bffff, 0xfffffeb0, 0xbd7ffdc5,
+0xfffffef0, 0xb56ff9c5, 0xffffff30, 0xbd6ff9c5,
+0xffffff40, 0xf671f1c5, 0x71e9c502, 0xe3c402f7,
+0x01ca1875, 0x8d7ffdc5, 0xffffff10, 0x956ff9c5,
+0xffffff10, 0x8d6ff9c5, 0xffffff20, 0xd2fde9c5,
+0xc9fdf1c5, 0xc2c5f9c5, 0xc5f9c500, 0x79c501f1,
+0x6607d1c5, 0xf9c5c239, 0x0f01c2c5, 0x3145c294,
+0xd2b60fff, 0x3966daf7, 0xfffef285, 0xc5f9c5ff,
+0x0f4102c2, 0x3145c794, 0xdff741c9, 0xf4853966,
+0xc5fffffe, 0x03c2c5f9, 0xc1940f41, 0x41f63145,
+0x3966d9f7, 0xfffef685, 0xc5f9c5ff, 0x0f4104c2,
+0xc931c694, 0x6e79c1c4, 0xdef741e9, 0xf8853966,
+0xc5fffffe, 0x05c2c5f9, 0x45c1940f, 0xc1c4ed31,
+0x01eec451, 0x3966d9f7, 0xfffefa85, 0xc5f9c5ff,
+0x0f4106c2, 0x3145c594, 0xddf741c0, 0xfc853966,
+0xc5fffffe, 0x07c2c5f9, 0xc0940f41, 0xc5e43145,
+0x41d26ef9, 0x3966d8f7, 0xfffefe85, 0xc5f9c5ff,
+0x0f4100c1, 0xc1c4c494, 0xc4e06e79, 0xd7c469c1,
+0xdcf74101, 0x00853966, 0xc5ffffff, 0x0fd562e9,
+0xdb31c094, 0xc459c1c4, 0xb60f01e4, 0x66d8f7c0,
+0xff02b539, 0xf9c5ffff, 0x0f02f1c5, 0xff31c394,
+0x3966dbf7, 0xffff04b5, 0xc5f9c5ff, 0x0f4003f1,
+0x3145c794, 0x66dff7db, 0xff06b539, 0xf9c5ffff,
+0x4104f1c5, 0xc5c3940f, 0x41f76ef9, 0x3966dbf7,
+0xffff08b5, 0x940f40ff, 0x49c1c4c6, 0x4001f3c4,
+0xf7f6b60f, 0xb58966de, 0xfffffeb0, 0xf1c5f9c5,
+0xb5396605, 0xffffff0a, 0xc6940f40, 0xf6b60f40,
+0x8966def7, 0xfffedeb5, 0xc5f9c5ff, 0xf9c506f1,
+0x3966c96e, 0xffff0cb5, 0x940f40ff, 0x71c1c4c6,
+0x4001cdc4, 0xc5f6b60f, 0xc5cc62f1, 0xb0a56ef9,
+0xc5fffffe, 0xdea5c4d9, 0x01fffffe, 0xe9c5def7,
+0x4466d16c, 0xff0e9539, 0x0f41ffff, 0xf9c5c294,
+0xf9c5c86e, 0x0f45ee6e, 0xf1c5d2b6, 0x4101cbc4,
+0xf1c5daf7, 0xc1c4ce62, 0x01eac451, 0xe562d9c5,
+0xcc6cf1c5, 0x186de3c4, 0x53e801c1, 0x89fffff1,
+0x05edb8c2, 0xd2840000, 0x0ea9840f, 0xf9c50000,
+0xfef0b56f, 0xf9c5ffff, 0xff00bd6f, 0xf1c5ffff,
+0xc502d671, 0x02d771e9, 0x1875e3c4, 0xfdc501ca,
+0xff308d7f, 0xf9c5ffff, 0xff30956f, 0xd231ffff,
+0x8d6ff9c5, 0xffffff40, 0xd2fde9c5, 0xc9fdf1c5,
+0xc2c5f9c5, 0xc5f9c500, 0x79c501f1, 0x6607d1c5,
+0xff108539, 0x940fffff, 0xc5f9c5c2, 0x314501c2,
+0x66daf7ff, 0xff128539, 0xf9c5ffff, 0x4102c2c5,
+0x45c7940f, 0xf741c931, 0x853966df, 0xffffff14,
+0xc2c5f9c5, 0x940f4103, 0xf63145c1, 0x66d9f741,
+0xff168539, 0xf9c5ffff, 0x4104c2c5, 0x31c6940f,
+0x79c1c4c9, 0xf741e96e, 0x853966de, 0xffffff18,
+0xc2c5f9c5, 0xc1940f05, 0xc4ed3145, 0xeec451c1,
+0x66d9f701, 0xff1a8539, 0xf9c5ffff, 0x4106c2c5,
+0x45c5940f, 0xf741c031, 0x853966dd, 0xffffff1c,
+0xc2c5f9c5, 0x940f4107, 0xe43145c0, 0xd26ef9c5,
+0x66d8f741, 0xff1e8539, 0xf9c5ffff, 0x4100c1c5,
+0xc4c4940f, 0xe06e79c1, 0xc469c1c4, 0xf74101d7,
+0x853966dc, 0xffffff20, 0xd562e9c5, 0x31c0940f,
+0x59c1c4db, 0x0f01e4c4, 0xd8f7c0b6, 0x22b53966,
+0xc5ffffff, 0x02f1c5f9, 0x31c3940f, 0x66dbf7ff,
+0xff24b539, 0xf9c5ffff, 0x4003f1c5, 0x45c7940f,
+0xdff7db31, 0x26b53966, 0xc5ffffff, 0x04f1c5f9,
+0xc3940f41, 0xf76ef9c5, 0x66dbf741, 0xff28b539,
+0x0f40ffff, 0xc1c4c694, 0x01f3c449, 0xf6b60f40,
+0x8966def7, 0xfffeb0b5, 0xc5f9c5ff, 0x396605f1,
+0xffff2ab5, 0x940f40ff, 0xb60f40c6, 0x66def7f6,
+0xfedeb589, 0xf9c5ffff, 0xc506f1c5, 0x66c96ef9,
+0xff2cb539, 0x0f40ffff, 0xc1c4c694, 0x01cdc471,
+0xf6b60f40, 0xcc62f1c5, 0xa56ef9c5, 0xfffffeb0,
+0xa5c4d9c5, 0xfffffede, 0xc5def701, 0x66d16ce9,
+0x2e953944, 0x41ffffff, 0xc5c2940f, 0xc5c86ef9,
+0x45ee6ef9, 0xc5d2b60f, 0x01cbc4f1, 0xc5daf741,
+0xc4ce62f1, 0xeac451c1, 0x62d9c501, 0x6cf1c5e5,
+0x6de3c4cc, 0xe801c118, 0xffffef26, 0xf2b8c289,
+0x84000005, 0x7c840fd2, 0xc700000c, 0xfffeec85,
+0x000003ff, 0x7ffdc500, 0xffff309d, 0x6ef9c5ff,
+0xfffeeca5, 0x6ff9c5ff, 0xffff4095, 0xf1e1c5ff,
+0xf1e9c5ec, 0x55e3c4e4, 0xc501f418, 0xb0b57ffd,
+0xc5fffffe, 0xb0bd6ffd, 0x8bfffffe, 0xfffeb095,
+0x7ffdc5ff, 0xfffef0bd, 0xec85c7ff, 0x02fffffe,
+0xc5000000, 0xeca56ef9, 0xc5fffffe, 0xc5ccf1e1,
+0xc4d4f1e9, 0xca1875e3, 0x7ffdc501, 0xffff108d,
+0x6ff9c5ff, 0xffff1095, 0x6ff9c5ff, 0xffff208d,
+0xfde9c5ff, 0xfdf1c5d2, 0xc5f9c5c9, 0xf9c500c2,
+0xc501f1c5, 0x07d1c579, 0xc5c23966, 0x01c2c5f9,
+0x45c2940f, 0xb60fff31, 0x66daf7d2, 0xfef28539,
+0xf9c5ffff, 0x4102c2c5, 0x45c7940f, 0xf741c931,
+0x853966df, 0xfffffef4, 0xc2c5f9c5, 0x940f4103,
+0xf63145c1, 0x66d9f741, 0xfef68539, 0xf9c5ffff,
+0x4104c2c5, 0x31c6940f, 0x79c1c4c9, 0xf741e96e,
+0x853966de, 0xfffffef8, 0xc2c5f9c5, 0xc1940f05,
+0xc4ed3145, 0xeec451c1, 0x66d9f701, 0xfefa8539,
+0xf9c5ffff, 0x4106c2c5, 0x45c5940f, 0xf741c031,
+0x853966dd, 0xfffffefc, 0xc2c5f9c5, 0x940f4107,
+0xe43145c0, 0xd26ef9c5, 0x66d8f741, 0xfefe8539,
+0xf9c5ffff, 0x4100c1c5, 0xc4c4940f, 0xe06e79c1,
+0xc469c1c4, 0xf74101d7, 0x853966dc, 0xffffff00,
+0xd562e9c5, 0x31c0940f, 0x59c1c4db, 0x0f01e4c4,
+0xd8f7c0b6, 0x02b53966, 0xc5ffffff, 0x02f1c5f9,
+0x31c3940f, 0x66dbf7ff, 0xff04b539, 0xf9c5ffff,
+0x4003f1c5, 0x45c7940f, 0xdff7db31, 0x06b53966,
+0xc5ffffff, 0x04f1c5f9, 0xc3940f41, 0xf76ef9c5,
+0x66dbf741, 0xff08b539, 0x0f40ffff, 0xc1c4c694,
+0x01f3c449, 0xf6b60f40, 0x8966def7, 0xfffeb0b5,
+0xc5f9c5ff, 0x396605f1, 0xffff0ab5, 0x940f40ff,
+0xb60f40c6, 0x66def7f6, 0xfedeb589, 0xf9c5ffff,
+0xc506f1c5, 0x66c96ef9, 0xff0cb539, 0x0f40ffff,
+0xc1c4c694, 0x01cdc471, 0xf6b60f40, 0xcc62f1c5,
+0xa56ef9c5, 0xfffffeb0, 0xa5c4d9c5, 0xfffffede,
+0xc5def701, 0x66d16ce9, 0x0e953944, 0x41ffffff,
+0xc5c2940f, 0xc5c86ef9, 0x45ee6ef9, 0xc5d2b60f,
+0x01cbc4f1, 0xc5daf741, 0xc4ce62f1, 0xeac451c1,
+0x62d9c501, 0x6cf1c5e5, 0x6de3c4cc, 0xe801c118,
+0xffffecae, 0x05b8c289, 0x84000006, 0x04840fd2,
+0xc500000a, 0xec956ef9, 0xc5fffffe, 0xf0b56ff9,
+0xc5fffffe, 0x00bd6ff9, 0xc5ffffff, 0xc5cad1c9,
+0xc4d2d1c1, 0xca1875e3, 0x7ffdc501, 0xffff308d,
+0x6ff9c5ff, 0xffff3095, 0xc5d231ff, 0x408d6ff9,
+0xc5ffffff, 0xc5d2fde9, 0xc5c9fdf1, 0x00c2c5f9,
+0xf1c5f9c5, 0xc579c501, 0x396607d1, 0xffff1085,
+0xc2940fff, 0xc2c5f9c5, 0xff314501, 0x3966daf7,
+0xffff1285, 0xc5f9c5ff, 0x0f4102c2, 0x3145c794,
+0xdff741c9, 0x14853966, 0xc5ffffff, 0x03c2c5f9,
+0xc1940f41, 0x41f63145, 0x3966d9f7, 0xffff1685,
+0xc5f9c5ff, 0x0f4104c2, 0xc931c694, 0x6e79c1c4,
+0xdef741e9, 0x18853966, 0xc5ffffff, 0x05c2c5f9,
+0x45c1940f, 0xc1c4ed31, 0x01eec451, 0x3966d9f7,
+0xffff1a85, 0xc5f9c5ff, 0x0f4106c2, 0x3145c594,
+0xddf741c0, 0x1c853966, 0xc5ffffff, 0x07c2c5f9,
+0xc0940f41, 0xc5e43145, 0x41d26ef9, 0x3966d8f7,
+0xffff1e85, 0xc5f9c5ff, 0x0f4100c1, 0xc1c4c494,
+0xc4e06e79, 0xd7c469c1, 0xdcf74101, 0x20853966,
+0xc5ffffff, 0x0fd562e9, 0xdb31c094, 0xc459c1c4,
+0xb60f01e4, 0x66d8f7c0, 0xff22b539, 0xf9c5ffff,
+0x0f02f1c5, 0xff31c394, 0x3966dbf7, 0xffff24b5,
+0xc5f9c5ff, 0x0f4003f1, 0x3145c794, 0x66dff7db,
+0xff26b539, 0xf9c5ffff, 0x4104f1c5, 0xc5c3940f,
+0x41f76ef9, 0x3966dbf7, 0xffff28b5, 0x940f40ff,
+0x49c1c4c6, 0x4001f3c4, 0xf7f6b60f, 0xb58966de,
+0xfffffeb0, 0xf1c5f9c5, 0xb5396605, 0xffffff2a,
+0xc6940f40, 0xf6b60f40, 0x8966def7, 0xfffedeb5,
+0xc5f9c5ff, 0xf9c506f1, 0x3966c96e, 0xffff2cb5,
+0x940f40ff, 0x71c1c4c6, 0x4001cdc4, 0xc5f6b60f,
+0xc5cc62f1, 0xb0a56ef9, 0xc5fffffe, 0xdea5c4d9,
+0x01fffffe, 0xe9c5def7, 0x4466d16c, 0xff2e9539,
+0x0f41ffff, 0xf9c5c294, 0xf9c5c86e, 0x0f45ee6e,
+0xf1c5d2b6, 0x4101cbc4, 0xf1c5daf7, 0xc1c4ce62,
+0x01eac451, 0xe562d9c5, 0xcc6cf1c5, 0x186de3c4,
+0x7be801c1, 0x89ffffea, 0x0609b8c2, 0xd2840000,
+0x07d1840f, 0x458b0000, 0x4d8b66b0, 0x5d8b66b2,
+0xbc7d8bba, 0x66d8f766, 0x66c6758b, 0xce558b44,
+0x66c01966, 0x4d8bd9f7, 0x194566b4, 0x6ef9c5ff,
+0xd9f766d0, 0xb64d8b66, 0xc469c1c4, 0x456601d7,
+0xf766c919, 0xb84d8bd9, 0x6e79c1c4, 0x194566e9,
+0xd9f766f6, 0xc451c1c4, 0x196601ee, 0xdbf766c9,
+0xbe5d8b66, 0xd562e9c5, 0xed194566, 0x8bdff766,
+0xf9c5c07d, 0x4566c96e, 0xf766c019, 0x5d8b66db,
+0x71c1c4c2, 0x6601cdc4, 0x66e41945, 0x7d8bdff7,
+0x79c1c4c4, 0x1966e06e, 0xdbf766d2, 0xc459c1c4,
+0x196601e4, 0xdff766db, 0xcc62f1c5, 0x66ff1966,
+0x758bdef7, 0x6ce9c5c8, 0x194566d1, 0x6ef9c5db,
+0x6ef9c5ca, 0xdef766f7, 0xcbc4f1c5, 0x49c1c401,
+0x6601f3c4, 0xf1c5f619, 0x8966ce62, 0xfffeb0b5,
+0x758b66ff, 0xdef766ca, 0xc5f61966, 0xb0a56ef9,
+0x66fffffe, 0xfedeb589, 0x758bffff, 0xc4d9c5cc,
+0xfffedea5, 0xf76601ff, 0xf61966de, 0xdaf74166,
+0xd2194566, 0xee6ef9c5, 0xc451c1c4, 0xd9c501ea,
+0xf1c5e562, 0xe3c4cc6c, 0x01d1186d, 0xd354ecc5,
+0xca6ff9c5, 0x957ffdc5, 0xffffff30, 0x99e8e98f,
+0xf9c5b06d, 0xff40956f, 0xe98fffff, 0xc06599e8,
+0x1855e3c4, 0xfdc501f4, 0xfeb0b57f, 0xfdc5ffff,
+0xfeb0bd6f, 0x958bffff, 0xfffffeb0, 0xbd7ffdc5,
+0xfffffef0, 0xe476d9c5, 0x6dfdd9c5, 0xfdd9c5b0,
+0xe3c4c065, 0x01e41855, 0x657ffdc5, 0xf0e98fb0,
+0x8fb04d99, 0x5599e8e9, 0x75e3c4c0, 0xc501e218,
+0xc5c9fdf1, 0xc5d2fde9, 0x00c1c5f9, 0xf2c5f9c5,
+0xc579c501, 0xfdc507d2, 0xff10a57f, 0x3966ffff,
+0xc5f9c5c2, 0x940f01c1, 0xff3145c2, 0xf7d2b60f,
+0x853966da, 0xfffffef2, 0xc1c5f9c5, 0x940f4102,
+0xc93145c7, 0x66dff741, 0xfef48539, 0xf9c5ffff,
+0x4103c1c5, 0x45c1940f, 0xf741f631, 0x853966d9,
+0xfffffef6, 0xc1c5f9c5, 0x940f4104, 0xc4c931c6,
+0xe96e79c1, 0x66def741, 0xfef88539, 0xf9c5ffff,
+0x0f05c1c5, 0x3145c194, 0x51c1c4ed, 0xf701eec4,
+0x853966d9, 0xfffffefa, 0xc1c5f9c5, 0x940f4106,
+0xc03145c5, 0x66ddf741, 0xfefc8539, 0xf9c5ffff,
+0x4107c1c5, 0x45c0940f, 0xf9c5e431, 0xf741c96e,
+0x853966d8, 0xfffffefe, 0xc2c5f9c5, 0x940f4100,
+0x79c1c4c4, 0xc1c4e06e, 0x01cdc471, 0x66dcf741,
+0xff008539, 0x940fffff, 0xc4db31c0, 0xe4c459c1,
+0xc0b60f01, 0xcc62f1c5, 0x3966d8f7, 0xffff02b5,
+0xc5f9c5ff, 0x940f02f2, 0xf7ff31c3, 0xb53966db,
+0xffffff04, 0xf2c5f9c5, 0x940f4003, 0xdb3145c7,
+0x3966dff7, 0xffff06b5, 0xc5f9c5ff, 0x0f4104f2,
+0xf9c5c394, 0xf741f76e, 0xb53966db, 0xffffff08,
+0xc6940f40, 0xc449c1c4, 0x0f4001f3, 0xdef7f6b6,
+0xb0b58966, 0xc5fffffe, 0x05f2c5f9, 0x0ab53966,
+0x40ffffff, 0x40c6940f, 0xf7f6b60f, 0x6ef9c5de,
+0xfffeb0a5, 0xb58966ff, 0xfffffede, 0xf2c5f9c5,
+0x6ef9c506, 0xb53966d2, 0xffffff0c, 0xc6940f40,
+0xc469c1c4, 0xd9c501d7, 0xfedea5c4, 0x4001ffff,
+0xc5f6b60f, 0xf7d562e9, 0x394466de, 0xffff0e95,
+0x6ce9c5ff, 0x940f41d1, 0x6ef9c5c2, 0x6ef9c5c8,
+0xb60f45ee, 0xc4f1c5d2, 0xf74101cb, 0x62f1c5da,
+0x51c1c4ce, 0xc501eac4, 0xc5e562d9, 0xc4cc6cf1,
+0xc1186de3, 0xe6e8e801, 0xc289ffff, 0x000621b8,
+0x0fd28400, 0x00043e84, 0xeff1c500, 0xf9f1c5c9,
+0xf1c5b055, 0x31c04df9, 0x68e98fd2, 0xff109595,
+0xe98fffff, 0x208d9570, 0xc5ffffff, 0x00c2c5f9,
+0xf1c5f9c5, 0x6de3c401, 0x6601e118, 0xff308539,
+0x940fffff, 0xc5f9c5c2, 0x314501c2, 0x7ffdc5ff,
+0xfffef0a5, 0x66daf7ff, 0xff328539, 0xf9c5ffff,
+0x4102c2c5, 0x45c7940f, 0x79c5c931, 0x4107d1c5,
+0x3966dff7, 0xffff3485, 0xc5f9c5ff, 0x0f4103c2,
+0x3145c194, 0xd9f741f6, 0x36853966, 0xc5ffffff,
+0x04c2c5f9, 0xc6940f41, 0xc1c4c931, 0x41e96e79,
+0x3966def7, 0xffff3885, 0xc5f9c5ff, 0x940f05c2,
+0xed3145c1, 0xc451c1c4, 0xd9f701ee, 0x3a853966,
+0xc5ffffff, 0x06c2c5f9, 0xc5940f41, 0x41c03145,
+0x3966ddf7, 0xffff3c85, 0xc5f9c5ff, 0x0f4107c2,
+0x3145c094, 0x6ef9c5e4, 0xd8f741d2, 0x3e853966,
+0xc5ffffff, 0x00c1c5f9, 0xc4940f41, 0x6e79c1c4,
+0x69c1c4e0, 0x4101d7c4, 0x3966dcf7, 0xffff4085,
+0x62e9c5ff, 0xc0940fd5, 0xc1c4db31, 0x01e4c459,
+0xf7c0b60f, 0xb53966d8, 0xffffff42, 0xf1c5f9c5,
+0xc3940f02, 0xdbf7ff31, 0x44b53966, 0xc5ffffff,
+0x03f1c5f9, 0xc7940f40, 0xf7db3145, 0xb53966df,
+0xffffff46, 0xf1c5f9c5, 0x940f4104, 0x6ef9c5c3,
+0xdbf741f7, 0x48b53966, 0x40ffffff, 0xc4c6940f,
+0xf3c449c1, 0xb60f4001, 0x66def7f6, 0xfeb0b589,
+0xf9c5ffff, 0x6605f1c5, 0xff4ab539, 0x0f40ffff,
+0x0f40c694, 0xdef7f6b6, 0xdeb58966, 0xc5fffffe,
+0x06f1c5f9, 0xc96ef9c5, 0x4cb53966, 0x40ffffff,
+0xc4c6940f, 0xcdc471c1, 0xb60f4001, 0x62f1c5f6,
+0x6ef9c5cc, 0xfffeb0a5, 0xc4d9c5ff, 0xfffedea5,
+0xdef701ff, 0xd16ce9c5, 0x95394466, 0xffffff4e,
+0xc2940f41, 0xc86ef9c5, 0xee6ef9c5, 0xd2b60f45,
+0xcbc4f1c5, 0xdaf74101, 0xce62f1c5, 0xc451c1c4,
+0xd9c501ea, 0xf1c5e562, 0xe3c4cc6c, 0x01c1186d,
+0xffe4cde8, 0xb8c289ff, 0x00000626, 0x840fd284,
+0x00000223, 0x9d7ffdc5, 0xffffff10, 0x000002b8,
+0x948b6600, 0xffff7005, 0x948966ff, 0xffff1005,
+0xc08348ff, 0xf8834804, 0x31e67522, 0x6ffdc5d2,
+0xe88f9075, 0x708da264, 0x60ffffff, 0xc1c5f9c5,
+0x85396600, 0xffffff10, 0xc1c5f9c5, 0xc2940f01,
+0xf7ff3145, 0x853966da, 0xffffff12, 0xc1c5f9c5,
+0x940f4102, 0xc93145c7, 0xd26ef9c5, 0x66dff741,
+0xff148539, 0xf9c5ffff, 0x4103c1c5, 0x45c1940f,
+0xc1c4f631, 0x01d7c469, 0x66d9f741, 0xff168539,
+0xf9c5ffff, 0x4104c1c5, 0x31c6940f, 0x79c1c4c9,
+0xf741e16e, 0x853966de, 0xffffff18, 0xc1c5f9c5,
+0xc1940f05, 0xc4ed3145, 0xe6c459c1, 0x66d9f701,
+0xff1a8539, 0xf9c5ffff, 0x4106c1c5, 0x45c5940f,
+0xe9c5c031, 0xf741d462, 0x853966dd, 0xffffff1c,
+0xc1c5f9c5, 0x940f4107, 0xe43145c0, 0x197de3c4,
+0xf74101c9, 0x853966d8, 0xffffff1e, 0xc1c5f9c5,
+0x940f4100, 0xc5f9c5c4, 0x79c501f1, 0x4107d1c5,
+0x3966dcf7, 0xffff2085, 0x79c1c4ff, 0x940fd86e,
+0xc4db31c0, 0xdcc461c1, 0xc0b60f01, 0x3966d8f7,
+0xffff22b5, 0xc5f9c5ff, 0x940f02f1, 0xf7ff31c3,
+0xb53966db, 0xffffff24, 0xf1c5f9c5, 0x940f4003,
+0xdb3145c7, 0x3966dff7, 0xffff26b5, 0xc5f9c5ff,
+0x0f4104f1, 0xf9c5c394, 0xf741ef6e, 0xb53966db,
+0xffffff28, 0xc6940f40, 0xc451c1c4, 0x0f4001eb,
+0xdef7f6b6, 0xb0b58966, 0xc5fffffe, 0x05f1c5f9,
+0x2ab53966, 0x40ffffff, 0x40c6940f, 0xf7f6b60f,
+0xb58966de, 0xfffffede, 0xf1c5f9c5, 0x6ef9c506,
+0xb53966c9, 0xffffff2c, 0xc6940f40, 0xc471c1c4,
+0x0f4001cd, 0xf1c5f6b6, 0xf9c5cb62, 0xfeb09d6e,
+0xe1c5ffff, 0xfede9dc4, 0xf701ffff, 0x6ce9c5de,
+0x394466d1, 0xffff2e95, 0x940f41ff, 0x6ef9c5c2,
+0x6ef9c5c8, 0xb60f45e6, 0xc4f1c5d2, 0xf74101cb,
+0x62f1c5da, 0x59c1c4cd, 0xc501e2c4, 0xc5dc62e1,
+0xc4cb6cf1, 0xc1186de3, 0xe2a4e801, 0x013cffff,
+0x2a25c019, 0x48000007, 0x0140c481, 0x415b0000,
+0x415c415a, 0x415e415d, 0x8d495d5f, 0x00c3f862,
+0016577,
+};
+asm(".type xop_x86_64_D_32u2, STT_NOTYPE;");
+asm(".type xop_x86_64_D_32u2, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_32i4[] = {
+0xb85500eb, 0x00000001, 0x000020b9, 0x09b94100,
+0x48000000, 0x5441e589, 0xe4834853, 0xec8148e0,
+0x00000088, 0x45ff788d, 0x4489c889, 0xfa890484,
+0x83c02941, 0x894401e2, 0x83248444, 0xd21901fa,
+0xff02e283, 0x40c785ca, 0x89c7940f, 0x40448454,
+0x29ffb60f, 0x844c89f9, 0xc0ff4864, 0x09f88348,
+0xfdc5c275, 0x08247c6f, 0x7c7ffdc5, 0x448ba824,
+0x4439a824, 0x940f0824, 0x245c8bc0, 0xd23145ac,
+0xb8247c8b, 0x44c0b60f, 0xb0244c8b, 0x24448b44,
+0x39d8f7b4, 0x8b0c245c, 0x41bc2474, 0x31c2940f,
+0x244c8bd2, 0x6ef9c5c0, 0xdaf741f8, 0x244c3b44,
+0x0539b810, 0x940f0000, 0xdb3145c2, 0x3b44daf7,
+0x41142444, 0xc5c3940f, 0x31da6ef9, 0xdbf741d2,
+0x18247c3b, 0x31c2940f, 0x61c3c4db, 0xf701db22,
+0x24743bda, 0xc3940f1c, 0xd26ef9c5, 0xdbf7d231,
+0x20244c3b, 0x45c2940f, 0xe3c4e431, 0x01d32269,
+0xf9c5daf7, 0x548bca6e, 0x543bc424, 0x0f412424,
+0xf741c494, 0x71c3c4dc, 0xc501cc22, 0xc4d16ce9,
+0xca2241c3, 0x6cf1c501, 0x75e3c4cb, 0xc501ca18,
+0x41d1507c, 0x00fffa81, 0x850f0000, 0x00000dcd,
+0x5c6ff9c5, 0xf9c5a824, 0xb824646f, 0x4cfee1c5,
+0xd9c50824, 0x182454fe, 0x1875e3c4, 0xfdc501ca,
+0xc8244c7f, 0x7c6ff9c5, 0xe9c50824, 0xc501f772,
+0x247c6ff9, 0x7ef9c518, 0x244439d0, 0x79c3c4c8,
+0x0f01d216, 0xf1c5c094, 0x4501f772, 0xb60fdb31,
+0x44d8f7c0, 0xcc245439, 0x1679c3c4, 0x0f4102d2,
+0xf9c5c394, 0x3fb8f86e, 0x41000005, 0x3944dbf7,
+0x41d02454, 0x31c2940f, 0xb60f45db, 0xdaf741d2,
+0x6e79c1c4, 0x79c3c4ea, 0x4403d216, 0xd4245439,
+0xc4c3940f, 0xca7e79c1, 0x3944dbf7, 0x41d82454,
+0x45c2940f, 0xe3c4e431, 0x01eb2251, 0xd2b60f45,
+0xc4daf741, 0xd26e79c1, 0x1679c3c4, 0x394401ca,
+0x41dc2454, 0xc4c4940f, 0xca1679c3, 0xdcf74102,
+0x24543944, 0x940f41e0, 0x69c3c4c2, 0x4501d422,
+0x41d2b60f, 0xc1c4daf7, 0xc4f26e79, 0xca1679c3,
+0x54394403, 0x0f41e424, 0xc3c4c294, 0x01cb2241,
+0xd2b60f45, 0xcd6cf1c5, 0xc4daf741, 0xf22249c3,
+0x6ce9c501, 0x75e3c4d6, 0xc501ca18, 0x41d1507c,
+0x00fffa81, 0x850f0000, 0x00000ca1, 0x7c6ff9c5,
+0xc1c5c824, 0x08244cfa, 0x7c6ff9c5, 0xc1c5d824,
+0x182454fa, 0x1875e3c4, 0xfdc501ca, 0xe8244c7f,
+0xe824448b, 0xa8244439, 0x8bc0940f, 0x45ec245c,
+0xb60fd231, 0x39d8f7c0, 0x41ac245c, 0x41c2940f,
+0x3b44daf7, 0x41f0244c, 0x45c1940f, 0x41c9b60f,
+0x3b44d9f7, 0x41f42444, 0x45c0940f, 0x41c0b60f,
+0x7c3bd8f7, 0x0f40f824, 0x0f40c794, 0xdff7ffb6,
+0xfc24743b, 0xc6940f40, 0xf6b60f40, 0x0c3bdef7,
+0xc1940f24, 0xf7c9b60f, 0x24543bd9, 0xc2940f04,
+0xf96ef9c5, 0xf7d2b60f, 0x41e3c4da, 0xc501ca22,
+0xc4ff6ef9, 0xd62241e3, 0x79c1c401, 0xc3c4f96e,
+0x01e82241, 0xf86ef9c5, 0xd16ce9c5, 0x000544b8,
+0x41c3c400, 0xc501ca22, 0xc4cd6cf1, 0xca1875e3,
+0x50fcc501, 0xfffa81d1, 0x0f000000, 0x000bbc85,
+0x61e2c400, 0x08244c40, 0x4059e2c4, 0xc4182464,
+0xcc1875e3, 0x6ff9c501, 0xc5382454, 0xc5e96ff9,
+0x244c7ffd, 0x6ff9c5a8, 0xc428244c, 0xd24069e2,
+0x4071e2c4, 0x75e3c4c9, 0xc501ca18, 0xc5f96ff9,
+0x244c7ffd, 0x6ff9c5c8, 0xc508244c, 0x24546ff9,
+0xfef1c518, 0xc528245c, 0x2464fee9, 0x65e3c438,
+0xc501dc18, 0x245c7ffd, 0xfaf1c5e8, 0xc5282474,
+0xc5effad1, 0x247c6ff9, 0x7ef9c5b8, 0xfae9c5e8,
+0xc4382464, 0x644059e2, 0xe2c4f824, 0xc5f34049,
+0x245cfac1, 0x7ef9c5d8, 0x79e3c4f2, 0x3901f116,
+0x79e3c4c2, 0x0f01ea16, 0x3145c094, 0xc0b60fc0,
+0xd139d8f7, 0x1679e3c4, 0xe3c402f1, 0x02ea1679,
+0xc0940f41, 0x39d8f741, 0x79e3c4d1, 0x0f03f116,
+0x3145c294, 0xd2b60fd2, 0xe3c4d789, 0x03ea1679,
+0xd139dff7, 0xe17ef9c5, 0xda7ef9c5, 0xc2940f41,
+0xff6ef9c5, 0x39daf741, 0x79e3c4d1, 0x0f01e116,
+0x3145c294, 0x41c3c4db, 0x0f01ea22, 0xd689d2b6,
+0x1679e3c4, 0xdef701da, 0xe3c4d139, 0x02e11679,
+0x1679e3c4, 0x0f4102da, 0xf741c394, 0xc4d139db,
+0xe11679e3, 0xc2940f03, 0xf7d2b60f, 0xd18941da,
+0x1679e3c4, 0xd13903da, 0x6e79c1c4, 0xc2940ff1,
+0xf7d2b60f, 0x49e3c4da, 0xc501da22, 0xc4f66ef9,
+0xe32249c3, 0x6ef9c501, 0x055bb8f0, 0xd9c50000,
+0xc3c4e36c, 0x01d82249, 0xdd6ce1c5, 0x1865e3c4,
+0xfcc501dc, 0xfa81d350, 0x000000ff, 0x0a2b850f,
+0xe2c40000, 0x245c4071, 0x69e2c428, 0x38246440,
+0x1865e3c4, 0xf9c501dc, 0xfdc5d87e, 0xa8245c7f,
+0x0f08f883, 0xf631c094, 0xf7c0b60f, 0x247c83d8,
+0x0f400eac, 0xd231c694, 0x7c83def7, 0x0f12b024,
+0xff31c294, 0x7c83daf7, 0x4014b424, 0xc5c7940f,
+0x31ea6ef9, 0x83dff7d2, 0x14b8247c, 0x45c2940f,
+0xe3c4c031, 0x01ef2251, 0x7c83daf7, 0x4112bc24,
+0x31c0940f, 0x6ef9c5c9, 0xd8f741f2, 0xc0247c83,
+0xc1940f0e, 0xc4c93145, 0xe02249c3, 0x83d9f701,
+0x08c4247c, 0xc1940f41, 0xf96ef9c5, 0xc4d9f741,
+0xd92241c3, 0x6ef9c501, 0x05c8b8f8, 0xd9c50000,
+0xe3c4e36c, 0x01de2241, 0xdd6ce1c5, 0x1865e3c4,
+0xfcc501dc, 0xfa81d350, 0x000000ff, 0x095b850f,
+0xe2c40000, 0x244c4071, 0x69e2c448, 0x58245440,
+0x1875e3c4, 0xfdc501ea, 0xe8246c7f, 0x746ff9c5,
+0xf9c5e824, 0xf8247c6f, 0xf672e1c5, 0x72d9c503,
+0xe3c403f7, 0x01dc1865, 0xd87ef9c5, 0x5c7ffdc5,
+0xf9c5a824, 0xe824746f, 0x7c6ff9c5, 0xe1c5f824,
+0xc502f672, 0x02f772d9, 0x1865e3c4, 0xfdc501dc,
+0xc8245c7f, 0x646ff9c5, 0xf9c5c824, 0xd8245c6f,
+0xe4fed9c5, 0xdbfee1c5, 0xe27ef9c5, 0xe3c4d039,
+0x01e21679, 0x31c0940f, 0xc0b60ff6, 0x5439d8f7,
+0xe3c4ac24, 0x02e21679, 0xc6940f40, 0x5439def7,
+0x940fb024, 0x0fff31c2, 0xdaf7d2b6, 0xf26ef9c5,
+0x1679e3c4, 0x543903e2, 0x0f40b424, 0xf9c5c794,
+0xdff7da7e, 0xb8245439, 0x45c2940f, 0xe3c4c031,
+0x01f72249, 0xf7d2b60f, 0x6ef9c5da, 0x79e3c4e2,
+0x3901da16, 0x41bc2454, 0xc4c0940f, 0xda1679e3,
+0xd8f74102, 0xc0245439, 0xc4c2940f, 0xe02259c3,
+0xd2b60f01, 0xe3c4d189, 0x03da1679, 0x5439d9f7,
+0x940fc424, 0x6ef9c5c2, 0xd2b60ff9, 0xe3c4daf7,
+0x01da2241, 0xf86ef9c5, 0x0005edb8, 0x6cd9c500,
+0x41e3c4e3, 0xc501de22, 0xc4de6ce1, 0xdc1865e3,
+0x50fcc501, 0xfffa81d3, 0x0f000000, 0x00080c85,
+0x6ff9c500, 0xc5a82474, 0x02e672e1, 0x746ff9c5,
+0xd9c5b824, 0xc402e672, 0xdc1865e3, 0x7ffdc501,
+0xc5e8245c, 0x24646ff9, 0x6ff9c5e8, 0xc5f8245c,
+0xc5e4fed9, 0xc5dbfee1, 0x39e07ef9, 0xc4c82444,
+0xe21679e3, 0xc0940f01, 0xb60ff631, 0x39d8f7c0,
+0xc4cc2454, 0xe21679e3, 0x940f4002, 0x39def7c6,
+0x0fd02454, 0xff31c294, 0xf7d2b60f, 0x6ef9c5da,
+0x79e3c4f2, 0x3903e216, 0x40d42454, 0xc5c7940f,
+0xf7da7ef9, 0x245439df, 0xc2940fd8, 0xc4c03145,
+0xf72249e3, 0xd2b60f01, 0xf9c5daf7, 0xe3c4e26e,
+0x01da1679, 0xdc245439, 0xc0940f41, 0x1679e3c4,
+0xf74102da, 0x245439d8, 0xc2940fe0, 0x2259c3c4,
+0xb60f01e0, 0xc4d189d2, 0xda1679e3, 0x39d9f703,
+0x0fe42454, 0xf9c5c294, 0xb60ff96e, 0xc4daf7d2,
+0xda2241e3, 0x6ef9c501, 0x05f2b8f8, 0xd9c50000,
+0xe3c4e36c, 0x01de2241, 0xde6ce1c5, 0x1865e3c4,
+0xfcc501dc, 0xfa81d350, 0x000000ff, 0x06fb850f,
+0x44c70000, 0x0003a424, 0xf9c50000, 0xfdc5dd6f,
+0xe8246c7f, 0x24446348, 0x6ff9c5a4, 0xc4f82464,
+0xf06ef9e1, 0xeef2d1c5, 0xf6f2d9c5, 0x1855e3c4,
+0xf9c501ee, 0xfdc5e87e, 0xa8246c7f, 0xa42444c7,
+0x00000002, 0x245c6348, 0xf9e1c4a4, 0xe1c5eb6e,
+0xd9c5ddf2, 0xe3c4e5f2, 0x01dc1865, 0x5c7ffdc5,
+0xf9c5c824, 0xc824646f, 0x5c6ff9c5, 0xd9c5d824,
+0xe1c5e4fe, 0xf9c5dbfe, 0xd039e27e, 0x1679e3c4,
+0x940f01e2, 0x0ff631c0, 0xd8f7c0b6, 0xac245439,
+0x1679e3c4, 0x0f4002e2, 0xdef7c694, 0xb0245439,
+0x31c2940f, 0xd2b60fff, 0xf9c5daf7, 0xe3c4ea6e,
+0x03e21679, 0xb4245439, 0xc7940f40, 0xda7ef9c5,
+0x5439dff7, 0x940fb824, 0xc03145c2, 0x2251e3c4,
+0xb60f01ef, 0xc5daf7d2, 0xc4e26ef9, 0xda1679e3,
+0x24543901, 0x940f41bc, 0x79e3c4c0, 0x4102da16,
+0x5439d8f7, 0x940fc024, 0x59c3c4c2, 0x0f01e022,
+0xd189d2b6, 0x1679e3c4, 0xd9f703da, 0xc4245439,
+0xc5c2940f, 0x0ff16ef9, 0xdaf7d2b6, 0x2249e3c4,
+0xf9c501da, 0x05b8f06e, 0xc5000006, 0xc4e36cd9,
+0xde2249e3, 0x6ce1c501, 0x65e3c4dd, 0xc501dc18,
+0x81d350fc, 0x0000fffa, 0xae850f00, 0x48000005,
+0xa4244463, 0x6c6ff9c5, 0xe1c4a824, 0xc5e06ef9,
+0xc5dce2d1, 0x246c6ff9, 0xe2d1c5b8, 0x65e3c4e4,
+0xc501dc18, 0x245c7ffd, 0x6ff9c5e8, 0xc5e82464,
+0x245c6ff9, 0xfed9c5f8, 0xfee1c5e4, 0x7ef9c5db,
+0x244439e0, 0x79e3c4c8, 0x0f01e216, 0xf631c094,
+0xf7c0b60f, 0x245439d8, 0x79e3c4cc, 0x4002e216,
+0xc5c6940f, 0xb8f86ef9, 0x00000609, 0x5439def7,
+0x940fd024, 0x0fff31c2, 0xdaf7d2b6, 0xea6ef9c5,
+0x1679e3c4, 0x543903e2, 0x0f40d424, 0xf9c5c794,
+0xdff7da7e, 0xd8245439, 0x45c2940f, 0xe3c4c031,
+0x01ef2251, 0xf7d2b60f, 0x6ef9c5da, 0x79e3c4e2,
+0x3901da16, 0x41dc2454, 0xc4c0940f, 0xda1679e3,
+0xd8f74102, 0xe0245439, 0xc4c2940f, 0xe02259c3,
+0xd2b60f01, 0xe3c4d189, 0x03da1679, 0x5439d9f7,
+0x940fe424, 0x6ef9c5c2, 0xd2b60ff1, 0xe3c4daf7,
+0x01da2249, 0xe36cd9c5, 0x2241e3c4, 0xe1c501de,
+0xe3c4dd6c, 0x01dc1865, 0xd350fcc5, 0x00fffa81,
+0x850f0000, 0x00000495, 0xc87ef9c5, 0x1679c3c4,
+0xf9c501ca, 0xf631d77e, 0x68247c83, 0x79c3c400,
+0xc402c816, 0xca1679e3, 0xc64e0f03, 0x6c247c83,
+0x79c3c400, 0xc401d316, 0xd11679c3, 0x79e3c402,
+0x4403d116, 0x83d64e0f, 0x0070247c, 0xf86ef9c5,
+0xc64e0f44, 0x74247c83, 0xd64e0f00, 0x78247c83,
+0xfe4e0f00, 0x6e79c1c4, 0x247c83f0, 0x0f44007c,
+0xbc83de4e, 0x00008024, 0x0f440000, 0xbc83ce4e,
+0x00008424, 0x4e0f0000, 0x49e3c4ce, 0xc401da22,
+0xe96e79c1, 0x2251e3c4, 0xf9c501d1, 0xc3c4ef6e,
+0x01cb2251, 0xca6cf1c5, 0x2241c3c4, 0xe9c501d2,
+0xe3c4d36c, 0x01d1186d, 0xca6ff9c5, 0x547ffdc5,
+0xe98fe824, 0x245c9ae8, 0x6ff9c568, 0x8ff82454,
+0x649ae8e9, 0xe3c47824, 0x01dc1865, 0xd87ef9c5,
+0x5c7ffdc5, 0xf9c5a824, 0x03c2256f, 0xf9c50000,
+0x68246c6f, 0x746ff9c5, 0xd1c57824, 0xc9c5dcfa,
+0xe3c4e4fa, 0x01dc1865, 0x5c7ffdc5, 0xe98f6824,
+0x244c9af0, 0xe8e98f68, 0x7824549a, 0x1875e3c4,
+0xf1c501da, 0xe9c5c9fe, 0xf9c5d2fe, 0xfdc5ca7e,
+0xc8245c7f, 0x940fd039, 0x0ff631c0, 0xd8f7c0b6,
+0xe3c4c289, 0x01c81679, 0xac244439, 0xc6940f40,
+0x1679e3c4, 0xf9c502c8, 0xdef7ea6e, 0xb0244439,
+0x31c0940f, 0xc0b60fff, 0xf9c5d8f7, 0xe3c4d86e,
+0x03c81679, 0xb4244439, 0xc7940f40, 0xd07ef9c5,
+0x4439dff7, 0x940fb824, 0xc03145c0, 0x2261e3c4,
+0xb60f01df, 0x89d8f7c0, 0x79e3c4c1, 0x3901d016,
+0x41bc2444, 0xc4c0940f, 0xd01679e3, 0x6ef9c502,
+0xd8f741f9, 0xc0244439, 0x0fc0940f, 0xd8f7c0b6,
+0xc86ef9c5, 0x1679e3c4, 0x443903d0, 0x940fc424,
+0x41c3c4c0, 0x0f01d022, 0xd8f7c0b6, 0x2271e3c4,
+0x21b801c8, 0xc5000006, 0xc4d16ce9, 0xce2251e3,
+0x6cf1c501, 0x75e3c4cb, 0xc501ca18, 0x81d150fc,
+0x0000fffa, 0x92850f00, 0xc5000002, 0xc5c9eff1,
+0x2454faf1, 0xfaf1c568, 0x8f78244c, 0x549a68e9,
+0xe98fc824, 0x244c9a70, 0x7ef9c5d8, 0x244439d0,
+0x79e3c4e8, 0x0f01d216, 0xf631c094, 0xf7c0b60f,
+0x245439d8, 0x79e3c4ec, 0x4002d216, 0xc5c6940f,
+0xb8f86ef9, 0x00000626, 0x5439def7, 0x940ff024,
+0x0fff31c2, 0xdaf7d2b6, 0xda6ef9c5, 0x1679e3c4,
+0x543903d2, 0x0f40f424, 0xf9c5c794, 0xdff7ca7e,
+0xf8245439, 0x45c2940f, 0xe3c4c031, 0x01df2261,
+0xf7d2b60f, 0x6ef9c5da, 0x79e3c4d2, 0x3901ca16,
+0x41fc2454, 0xc4c0940f, 0xca1679e3, 0xd8f74102,
+0x0f241439, 0xc3c4c294, 0x01d02269, 0x89d2b60f,
+0x79e3c4d1, 0xf703ca16, 0x245439d9, 0xc2940f04,
+0xf16ef9c5, 0xf7d2b60f, 0x49e3c4da, 0xc501ca22,
+0xc4d16ce9, 0xce2241e3, 0x6cf1c501, 0x75e3c4cb,
+0xc501ca18, 0x81d150fc, 0x0000fffa, 0x9a850f00,
+0x31000001, 0x247c83c0, 0xfdc50048, 0x08244c6f,
+0x31c09f0f, 0x83d8f7ff, 0x004c247c, 0x4c7ffdc5,
+0xf9c5c824, 0x0f40ce7e, 0xd231c79f, 0xf86ef9c5,
+0x7c83dff7, 0x0f005024, 0x3145c29f, 0x83daf7c0,
+0x0054247c, 0xc09f0f41, 0xe26ef9c5, 0xf741d231,
+0x247c83d8, 0x9f0f0058, 0xc93145c2, 0x2259c3c4,
+0xdaf701e0, 0x5c247c83, 0x9f0f4100, 0xc5c931c1,
+0x41f26ef9, 0x7c83d9f7, 0x0f006024, 0x3145c19f,
+0x49c3c4d2, 0xf701d922, 0x247c83d9, 0x0f410064,
+0xf9c5c29f, 0xf741e96e, 0x51c3c4da, 0xc501d222,
+0xc4da6ce1, 0xd72241e3, 0x6ce9c501, 0x6de3c4d4,
+0x8f01d318, 0x4ca274e8, 0xc5202824, 0x39c87ef9,
+0xc0940fc6, 0xb60ff631, 0x89d8f7c0, 0x79e3c4c2,
+0x3901c816, 0x402c2444, 0xc4c6940f, 0xc81679e3,
+0x6ef9c502, 0x0000baf2, 0xdef70000, 0xd0244439,
+0x31c0940f, 0xc0b60fff, 0xf9c5d8f7, 0xe3c4d86e,
+0x03c81679, 0x34244439, 0x197de3c4, 0x0f4001c9,
+0xf9c5c794, 0xdff7c87e, 0xd8244439, 0x45c0940f,
+0xe3c4c031, 0x01df2261, 0xf7c0b60f, 0x6ef9c5d8,
+0x79e3c4d0, 0x3901c816, 0x413c2444, 0xc4c0940f,
+0xc81679e3, 0xd8f74102, 0xe0244439, 0xc4c0940f,
+0xd02269c3, 0xc0b60f01, 0xc189d8f7, 0x1679e3c4,
+0x443903c8, 0x940f4424, 0x6ef9c5c0, 0xc0b60fe9,
+0xe3c4d8f7, 0x01c82251, 0xd16ce9c5, 0x2249e3c4,
+0xf1c501ce, 0xe3c4cb6c, 0x01ca1875, 0xc150fcc5,
+0x0000ff3d, 0x072ab800, 0x440f0000, 0x658d48c2,
+0x5c415bf0, 0x0000c35d, 0x00000000, 0x00000000,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0007460,
+};
+asm(".type xop_x86_64_D_32i4, STT_NOTYPE;");
+asm(".type xop_x86_64_D_32i4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_32u4[] = {
+0x315500eb, 0x0020bac0, 0xb9410000, 0x00000008,
+0x41e58948, 0x41564157, 0x53544155, 0xe0e48348,
+0x88ec8148, 0x89000000, 0x01708dc1, 0x45cf8944,
+0xe183c031, 0x89c72901, 0xff088474, 0x89c685c9,
+0x4128847c, 0x89c0940f, 0x4448844c, 0x5489c229,
+0xff486884, 0xf88348c0, 0xc5cc7508, 0x24746ffd,
+0x7ffdc508, 0x8ba82474, 0x39a82444, 0x0f082444,
+0x3145c094, 0x247c8bdb, 0x24748bb8, 0xc0b60fbc,
+0x24548b44, 0x4c8b44ac, 0xd8f7b024, 0x24543b44,
+0x448b440c, 0x0f41b424, 0xd231c394, 0xc0244c8b,
+0xf86ef9c5, 0x44dbf741, 0x10244c3b, 0x000539b8,
+0xc2940f00, 0xdaf7db31, 0x24443b44, 0xc3940f14,
+0xda6ef9c5, 0xdbf7d231, 0x18247c3b, 0x45c2940f,
+0xe3c4e431, 0x01db2261, 0x743bdaf7, 0x0f411c24,
+0xf9c5c494, 0xd231d26e, 0x3bdcf741, 0x0f20244c,
+0x3145c294, 0x69c3c4ed, 0xf701d422, 0x6ef9c5da,
+0x24548bca, 0x24543bc4, 0x940f4124, 0xddf741c5,
+0x2271c3c4, 0xe9c501cd, 0xc3c4d16c, 0x01cb2241,
+0xcb6cf1c5, 0x1875e3c4, 0x7cc501ca, 0x8141d950,
+0x0000fffb, 0x5b850f00, 0xc500000c, 0x24746ff9,
+0x6ff9c5a8, 0xc5b8247c, 0x244cfec9, 0xfec1c508,
+0xc4182454, 0xca1875e3, 0x7ffdc501, 0xc5c8244c,
+0x24746ff9, 0x6ff9c508, 0xc518247c, 0x01f672f1,
+0xf772e9c5, 0x7ef9c501, 0x244439c8, 0x79c3c4c8,
+0x0f01cb16, 0x3145c094, 0x79e3c4e4, 0x0f01d316,
+0xd8f7c0b6, 0x245c3944, 0x79c3c4cc, 0x4102cb16,
+0xc5c4940f, 0xb8f86ef9, 0x0000053f, 0x44dcf741,
+0xd0245c39, 0xc3940f41, 0x45ed3145, 0x41dbb60f,
+0xc1c4dbf7, 0xc4db6e79, 0xcb1679c3, 0x5c394403,
+0x0f41d424, 0xc1c4c594, 0x41d37e79, 0x3944ddf7,
+0x41d8245c, 0x45c3940f, 0xc3c4f631, 0x01dd2261,
+0xdbb60f45, 0x39dbf741, 0xc4dc245c, 0xd31679e3,
+0x940f4102, 0x79c1c4c6, 0xf741f36e, 0x245c39de,
+0xc3940fe0, 0x0fff3145, 0xdbf7dbb6, 0xcb6ef9c5,
+0x1679e3c4, 0x5c3903d3, 0x0f41e424, 0xc3c4c794,
+0x01d62249, 0xc4dff741, 0xcf2271c3, 0x6ce9c501,
+0x41c3c4d1, 0xc501cc22, 0xc4cb6cf1, 0xca1875e3,
+0x507cc501, 0xfb8141d9, 0x000000ff, 0x0b34850f,
+0xf9c50000, 0xc824746f, 0x7c6ff9c5, 0xc9c5d824,
+0x08244cfa, 0x54fac1c5, 0xe3c41824, 0x01ca1875,
+0x4c7ffdc5, 0x448be824, 0x4439e824, 0x940fa824,
+0xc0b60fc0, 0x3b44d8f7, 0x41ec2454, 0x45c2940f,
+0x41d2b60f, 0x3b44daf7, 0x41f0244c, 0x45c1940f,
+0x41c9b60f, 0x3b44d9f7, 0x41f42444, 0x45c0940f,
+0x41c0b60f, 0x7c3bd8f7, 0x0f40f824, 0x0f40c794,
+0xdff7ffb6, 0xfc24743b, 0xc6940f40, 0xff6ef9c5,
+0xf6b60f40, 0x0c3bdef7, 0xc1940f24, 0x2241e3c4,
+0xf9c501de, 0x44b8f86e, 0x0f000005, 0xd9f7c9b6,
+0x0424543b, 0xc5c2940f, 0x0ff16ef9, 0xdaf7d2b6,
+0x2249e3c4, 0xc1c401d2, 0xc5f16e79, 0xc4da6ce1,
+0xe02249c3, 0x41c3c401, 0xc501d222, 0xc4d46ce9,
+0xd3186de3, 0x50fcc501, 0xfffa81d2, 0x0f000000,
+0x000a5185, 0x6ffdc500, 0xc5a82474, 0x245456cc,
+0x7ffdc528, 0xc5a82454, 0x244c54f4, 0x6ffdc528,
+0xc5e8247c, 0x245457c4, 0x7ef9c528, 0x7ffdc5d0,
+0xc5e82454, 0x244c55f4, 0x7ef9c5a8, 0x0fd039ca,
+0xf631c094, 0xf7c0b60f, 0xc4c289d8, 0xc81679e3,
+0x24443901, 0x940f40ec, 0x79e3c4c6, 0xc502c816,
+0xf7fa6ef9, 0x244439de, 0xc0940ff0, 0xb60fff31,
+0xc5d8f7c0, 0xc4d86ef9, 0xc81679e3, 0x24443903,
+0x7de3c4f4, 0x4001c919, 0xc5c7940f, 0xf7c87ef9,
+0x244439df, 0xc0940ff8, 0xc4c03145, 0xdf2261e3,
+0xc0b60f01, 0xf9c5d8f7, 0xe3c4d06e, 0x01c81679,
+0xfc244439, 0xc0940f41, 0x1679e3c4, 0xf74102c8,
+0x240439d8, 0xc4c0940f, 0xd02269c3, 0xc0b60f01,
+0xc189d8f7, 0x1679e3c4, 0x443903c8, 0x940f0424,
+0x6ef9c5c0, 0xc0b60ff1, 0xe3c4d8f7, 0x01c82249,
+0x000550b8, 0x6ce9c500, 0x41e3c4d1, 0xc501ce22,
+0xc4cb6cf1, 0xca1875e3, 0x50fcc501, 0xfffa81d1,
+0x0f000000, 0x00093d85, 0x6ff9c500, 0xc508246c,
+0x24746ff9, 0x51e2c418, 0x28244c40, 0x4049e2c4,
+0xc4382454, 0xca1875e3, 0x7ef9c501, 0x7ffdc5c8,
+0x83a8244c, 0x940f08f8, 0x0ff631c0, 0xd8f7c0b6,
+0xac247c83, 0x940f400e, 0xc5d231c6, 0xb8f06ef9,
+0x000005c8, 0x7c83def7, 0x0f12b024, 0xff31c294,
+0x7c83daf7, 0x4014b424, 0xc5c7940f, 0x31da6ef9,
+0x83dff7d2, 0x14b8247c, 0x45c2940f, 0xe3c4c031,
+0x01df2261, 0x7c83daf7, 0x4112bc24, 0x31c0940f,
+0x6ef9c5c9, 0xd8f741ea, 0xc0247c83, 0xc1940f0e,
+0xc4c93145, 0xd02251c3, 0x83d9f701, 0x08c4247c,
+0xc1940f41, 0xf96ef9c5, 0xc4d9f741, 0xc92241c3,
+0x6ce9c501, 0x49e3c4d1, 0xc501ce22, 0xc4cb6cf1,
+0xca1875e3, 0x50fcc501, 0xfffa81d1, 0x0f000000,
+0x00086185, 0x6ffdc500, 0xc5082454, 0x24547ffd,
+0x6ff9c5e8, 0xc5e8247c, 0x246c6ff9, 0x72f1c5f8,
+0xe1c503f7, 0xc403f572, 0xcb1875e3, 0x7ef9c501,
+0x7ffdc5c8, 0xc5a8244c, 0x24746ff9, 0x6ff9c5e8,
+0xc5f8247c, 0x02f672f1, 0xf772e1c5, 0x75e3c402,
+0xc501cb18, 0x244c7ffd, 0x6ff9c5c8, 0xc5c8245c,
+0x244c6ff9, 0xfee1c5d8, 0xfef1c5db, 0x7ef9c5c9,
+0xc4d039da, 0xda1679e3, 0xc0940f01, 0xb60ff631,
+0x39d8f7c0, 0xc4ac2454, 0xda1679e3, 0x940f4002,
+0x6ef9c5c6, 0x05edb8f0, 0xdef70000, 0xb0245439,
+0x31c2940f, 0xd2b60fff, 0xf9c5daf7, 0xe3c4e26e,
+0x03da1679, 0xb4245439, 0xc7940f40, 0xca7ef9c5,
+0x5439dff7, 0x940fb824, 0xc03145c2, 0x2259e3c4,
+0xb60f01e7, 0xc5daf7d2, 0xc4da6ef9, 0xca1679e3,
+0x24543901, 0x940f41bc, 0x79e3c4c0, 0x4102ca16,
+0x5439d8f7, 0x940fc024, 0x61c3c4c2, 0x0f01d822,
+0xd189d2b6, 0x1679e3c4, 0xd9f703ca, 0xc4245439,
+0xc5c2940f, 0x0fe96ef9, 0xdaf7d2b6, 0x2251e3c4,
+0xe1c501ca, 0xe3c4d96c, 0x01ce2249, 0xcc6cf1c5,
+0x1875e3c4, 0xfcc501cb, 0xfa81d150, 0x000000ff,
+0x0720850f, 0xf9c50000, 0xa8247c6f, 0x6c6ff9c5,
+0xf1c5b824, 0xc502d772, 0x02d572e1, 0x1875e3c4,
+0xfdc501cb, 0xe8244c7f, 0x5c6ff9c5, 0xf9c5e824,
+0xf8244c6f, 0xdbfee1c5, 0xc9fef1c5, 0xd87ef9c5,
+0xc8244439, 0x1679e3c4, 0x940f01da, 0x0ff631c0,
+0xd8f7c0b6, 0xcc245439, 0x1679e3c4, 0x0f4002da,
+0xf9c5c694, 0xf2b8f86e, 0xf7000005, 0x245439de,
+0xc2940fd0, 0xb60fff31, 0xc5daf7d2, 0xc4e26ef9,
+0xda1679e3, 0x24543903, 0x940f40d4, 0x7ef9c5c7,
+0x39dff7ca, 0x0fd82454, 0x3145c294, 0x59e3c4c0,
+0x0f01e722, 0xdaf7d2b6, 0xda6ef9c5, 0x1679e3c4,
+0x543901ca, 0x0f41dc24, 0xe3c4c094, 0x02ca1679,
+0x39d8f741, 0x0fe02454, 0xc3c4c294, 0x01d82261,
+0x89d2b60f, 0x79e3c4d1, 0xf703ca16, 0x245439d9,
+0xc2940fe4, 0xf16ef9c5, 0xf7d2b60f, 0x49e3c4da,
+0xc501ca22, 0xc4d96ce1, 0xce2241e3, 0x6cf1c501,
+0x75e3c4cc, 0xc501cb18, 0x81d150fc, 0x0000fffa,
+0x0f850f00, 0xc7000006, 0x03a42444, 0xc5000000,
+0x24547ffd, 0x6ef9c5e8, 0xc5a4246c, 0x245c6ff9,
+0xf2e9c5f8, 0xf2e1c5e5, 0x5de3c4ed, 0xc501e518,
+0xc5e07ef9, 0x24647ffd, 0x2444c7a8, 0x000002a4,
+0x6ef9c500, 0xc5a42464, 0xc5ccf2e9, 0xc4dcf2e1,
+0xcb1875e3, 0x7ffdc501, 0xc5c8244c, 0x245c6ff9,
+0x6ff9c5c8, 0xc5d8244c, 0xc5dbfee1, 0xc5c9fef1,
+0x39da7ef9, 0x79e3c4d0, 0x0f01da16, 0xf631c094,
+0xf7c0b60f, 0x245439d8, 0x79e3c4ac, 0x4002da16,
+0xc5c6940f, 0xb8f06ef9, 0x00000605, 0x5439def7,
+0x940fb024, 0x0fff31c2, 0xdaf7d2b6, 0xe26ef9c5,
+0x1679e3c4, 0x543903da, 0x0f40b424, 0xf9c5c794,
+0xdff7ca7e, 0xb8245439, 0x45c2940f, 0xe3c4c031,
+0x01e72259, 0xf7d2b60f, 0x6ef9c5da, 0x79e3c4da,
+0x3901ca16, 0x41bc2454, 0xc4c0940f, 0xca1679e3,
+0xd8f74102, 0xc0245439, 0xc4c2940f, 0xd82261c3,
+0xd2b60f01, 0xe3c4d189, 0x03ca1679, 0x5439d9f7,
+0x940fc424, 0x6ef9c5c2, 0xd2b60fe9, 0xe3c4daf7,
+0x01ca2251, 0xd96ce1c5, 0x2249e3c4, 0xf1c501ce,
+0xe3c4cc6c, 0x01cb1875, 0xd150fcc5, 0x00fffa81,
+0x850f0000, 0x000004ce, 0x5c6ef9c5, 0xf9c5a424,
+0xa8247c6f, 0x6c6ff9c5, 0xc1c5b824, 0xd1c5cbd2,
+0xe3c4dbd2, 0x01cb1875, 0x4c7ffdc5, 0xf9c5e824,
+0xe8245c6f, 0x4c6ff9c5, 0xe1c5f824, 0xf1c5dbfe,
+0xf9c5c9fe, 0x4439d87e, 0xe3c4c824, 0x01da1679,
+0x31c0940f, 0xc0b60ff6, 0x5439d8f7, 0xe3c4cc24,
+0x02da1679, 0xc6940f40, 0xf86ef9c5, 0x000609b8,
+0x39def700, 0x0fd02454, 0xff31c294, 0xf7d2b60f,
+0x6ef9c5da, 0x79e3c4e2, 0x3903da16, 0x40d42454,
+0xc5c7940f, 0xf7ca7ef9, 0x245439df, 0xc2940fd8,
+0xc4c03145, 0xe72259e3, 0xd2b60f01, 0xf9c5daf7,
+0xe3c4da6e, 0x01ca1679, 0xdc245439, 0xc0940f41,
+0x1679e3c4, 0xf74102ca, 0x245439d8, 0xc2940fe0,
+0x2261c3c4, 0xb60f01d8, 0xc4d189d2, 0xca1679e3,
+0x39d9f703, 0x0fe42454, 0xf9c5c294, 0xb60ff16e,
+0xc4daf7d2, 0xca2249e3, 0x6ce1c501, 0x41e3c4d9,
+0xc501ce22, 0xc4cc6cf1, 0xcb1875e3, 0x50fcc501,
+0xfffa81d1, 0x0f000000, 0x0003b985, 0x24448b00,
+0x245c8b68, 0x19d8f770, 0x6ef9c5c0, 0x24448bd8,
+0x19d8f76c, 0x19dbf7c0, 0x61e3c4db, 0xc501d822,
+0x8be36ef9, 0xf774245c, 0x245c8bdb, 0xf7d21978,
+0x59e3c4db, 0x1901e222, 0x6ce1c5db, 0x6ef9c5dc,
+0x245c8bcb, 0x8bdbf77c, 0x0080249c, 0xc9190000,
+0xe3c4dbf7, 0x01c92271, 0xf9c5db19, 0x9c8beb6e,
+0x00008424, 0x19dbf700, 0x51e3c4f6, 0xc501ee22,
+0xc4cd6cf1, 0xd91865e3, 0x54e4c501, 0x6ff9c5da,
+0x7ffdc5cb, 0x8fe8245c, 0x649ae0e9, 0xf9c56824,
+0xf8245c6f, 0x9ae0e98f, 0xc478246c, 0xe5185de3,
+0x7ef9c501, 0x7ffdc5e0, 0xc5a82464, 0xc5e476d9,
+0x246cfed9, 0xfed9c568, 0xc4782464, 0xe41855e3,
+0x7ffdc501, 0x8f682464, 0x4c9af0e9, 0xe98f6824,
+0x245c9ae0, 0x75e3c478, 0xc501e318, 0xc5c9fef1,
+0xc5dbfee1, 0xc5ca7ef9, 0x24647ffd, 0x0fd039c8,
+0xf631c094, 0xf7c0b60f, 0xc4c289d8, 0xc81679e3,
+0x24443901, 0x940f40ac, 0x79e3c4c6, 0xc502c816,
+0xf7f26ef9, 0x244439de, 0xc0940fb0, 0xb60fff31,
+0xc5d8f7c0, 0xc4e06ef9, 0xc81679e3, 0x24443903,
+0x940f40b4, 0x7ef9c5c7, 0x39dff7d8, 0x0fb82444,
+0x3145c094, 0x59e3c4c0, 0x0f01e722, 0xd8f7c0b6,
+0xe3c4c189, 0x01d81679, 0xbc244439, 0xc0940f41,
+0x1679e3c4, 0xf9c502d8, 0xf741e96e, 0x244439d8,
+0xc0940fc0, 0xf7c0b60f, 0x6ef9c5d8, 0x79e3c4c8,
+0x3903d816, 0x0fc42444, 0xc3c4c094, 0x01d82251,
+0xf7c0b60f, 0x71e3c4d8, 0xb801c822, 0x00000621,
+0xd96ce1c5, 0x2249e3c4, 0xf1c501ce, 0xe3c4cc6c,
+0x01cb1875, 0xd150fcc5, 0x00fffa81, 0x850f0000,
+0x000001f2, 0xc9eff1c5, 0x5cfaf1c5, 0xf1c56824,
+0x78244cfa, 0x9660e98f, 0x8fc8245c, 0x4c9670e9,
+0xf9c5d824, 0x4439d87e, 0xe3c4e824, 0x01da1679,
+0x31c0940f, 0xc0b60ff6, 0x5439d8f7, 0xe3c4ec24,
+0x02da1679, 0xc6940f40, 0xe86ef9c5, 0x000626b8,
+0x39def700, 0x0ff02454, 0xff31c294, 0xf7d2b60f,
+0x6ef9c5da, 0x79e3c4e2, 0x3903da16, 0x40f42454,
+0xc5c7940f, 0xf7ca7ef9, 0x245439df, 0xc2940ff8,
+0xc4c03145, 0xe72259e3, 0xd2b60f01, 0xf9c5daf7,
+0xe3c4da6e, 0x01ca1679, 0xfc245439, 0xc0940f41,
+0x1679e3c4, 0xf74102ca, 0x241439d8, 0xc4c2940f,
+0xd82261c3, 0xd2b60f01, 0xe3c4d189, 0x03ca1679,
+0x5439d9f7, 0x940f0424, 0x6ef9c5c2, 0xd2b60ff9,
+0xe3c4daf7, 0x01ca2241, 0xd96ce1c5, 0x2251e3c4,
+0xf1c501ce, 0xe3c4cc6c, 0x01cb1875, 0xd150fcc5,
+0x00fffa81, 0x850f0000, 0x000000fa, 0x547ffdc5,
+0xf9c5c824, 0xfdc5d07e, 0x4824746f, 0xa26ce88f,
+0x60282454, 0xd27ef9c5, 0x940fd039, 0x0ff631c0,
+0xd8f7c0b6, 0xc86ef9c5, 0x1679e3c4, 0x443901d0,
+0x0f402c24, 0xe3c4c694, 0x02d01679, 0x4439def7,
+0x940fd024, 0xc4ff31c0, 0xce2271e3, 0xc0b60f01,
+0xc189d8f7, 0x1679e3c4, 0x443903d0, 0xe3c43424,
+0x01d2197d, 0xc7940f40, 0xe96ef9c5, 0xd07ef9c5,
+0x4439dff7, 0x940fd824, 0xc03145c0, 0xf7c0b60f,
+0xc4c289d8, 0xd01679e3, 0x24443901, 0x940f413c,
+0x79e3c4c0, 0xc502d016, 0xbafa6ef9, 0x00000000,
+0x39d8f741, 0x0fe02444, 0xb60fc094, 0xc5d8f7c0,
+0xc4d86ef9, 0xd01679e3, 0x24443903, 0xc0940f44,
+0x2241c3c4, 0xb60f01d0, 0xc4d8f7c0, 0xd82261e3,
+0x6ce9c501, 0x51e3c4d3, 0xc501df22, 0xc4cb6cf1,
+0xca1875e3, 0x50fcc501, 0x00ff3dc1, 0x2ab80000,
+0x0f000007, 0x8d48c244, 0x415bd865, 0x415d415c,
+0x5d5f415e, 0x000000c3,
+0006645,
+};
+asm(".type xop_x86_64_D_32u4, STT_NOTYPE;");
+asm(".type xop_x86_64_D_32u4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_32i8[] = {
+0xb85500eb, 0x00000001, 0x000040b9, 0x05b84100,
+0x48000000, 0x8348e589, 0x8148e0e4, 0x000088ec,
+0xff708d00, 0x48c7894c, 0x89c40489, 0xc72948f2,
+0x4801e283, 0x20c47c89, 0x4801fa83, 0xe283d219,
+0xcaff4802, 0x0f40c685, 0x8948c694, 0x4040c454,
+0x29f6b60f, 0x48cf89f1, 0x60c47c89, 0x48c0ff48,
+0x7505f883, 0x6ffdc5bc, 0xc508247c, 0x247c7ffd,
+0x48c031a8, 0xa8247c8b, 0x247c3b48, 0xc0940f08,
+0x24748b48, 0xc03145b0, 0x244c8b48, 0xd8f748c0,
+0x24743948, 0x748b4810, 0x0f41b824, 0xd231c094,
+0x48d8f749, 0x1824743b, 0x45c2940f, 0xf748c931,
+0x4c3b48da, 0x0f412024, 0xe1c4c194, 0x49fa6ef9,
+0xc3c4d9f7, 0x01d122c1, 0x6ef9e1c4, 0x0539b8f8,
+0xc3c40000, 0x01c822c1, 0x1875e3c4, 0xfdc501ca,
+0xfa83d150, 0x15850f0f, 0xc500000a, 0x244c6ff9,
+0x6ff9c5a8, 0xc5b8245c, 0x2454d4f1, 0xd4e1c508,
+0xc4182464, 0xd4186de3, 0x7ffdc501, 0xc5c82454,
+0x247c6ff9, 0x73d9c508, 0xf9c501f7, 0x18247c6f,
+0x7ef9e1c4, 0x443948e0, 0xe3c4c824, 0x01e216f9,
+0xc5c0940f, 0x01f773e9, 0x0fc03145, 0xf748c0b6,
+0x543948d8, 0xe1c4d024, 0x41d27ef9, 0xc4c0940f,
+0xf86ef9e1, 0x00053fb8, 0xd8f74900, 0x24543948,
+0xc2940fd8, 0x48d2b60f, 0xe1c4daf7, 0xc4e26ef9,
+0xd216f9e3, 0x54394801, 0x940fe024, 0xc1c3c4c2,
+0x0f01d022, 0xf748d2b6, 0xd9e3c4da, 0xc401e222,
+0xd4186de3, 0x50fdc501, 0x0ffa83d2, 0x095e850f,
+0xf9c50000, 0xc8247c6f, 0x54fbc1c5, 0xf9c50824,
+0xd8247c6f, 0x64fbc1c5, 0xe3c41824, 0x01d4186d,
+0x547ffdc5, 0xc031e824, 0x247c3b48, 0x7c8b48e8,
+0x940ff024, 0xd8f748c0, 0x247c3948, 0x940f40b0,
+0x40d231c7, 0x48ffb60f, 0x3b48dff7, 0x0ff82474,
+0xf748c294, 0x0c3b48da, 0xc1940f24, 0x6ef9e1c4,
+0xc9b60ffa, 0xc4d9f748, 0xe122c1e3, 0xf9e1c401,
+0x44b8f86e, 0xc4000005, 0xd722c1e3, 0x6de3c401,
+0xc501d418, 0x83d250fd, 0x850f0ffa, 0x000008d0,
+0x646ff9c5, 0xf9c50824, 0xc4b1d170, 0xd44069e2,
+0xccf4f1c5, 0x646ff9c5, 0xe98f1824, 0xc5d2cb78,
+0x20f273e9, 0xcad4f1c5, 0xd370f9c5, 0x69e2c4b1,
+0xe1c5d440, 0xe98fdcf4, 0xc5d2cb78, 0x20f273e9,
+0xdad4e1c5, 0x546ff9c5, 0xe3c43824, 0x01cb1875,
+0xe96ff9c5, 0x4c7ffdc5, 0xf9c5a824, 0x28244c6f,
+0xd970f9c5, 0x61e2c4b1, 0xf1c5d940, 0xe98fc9f4,
+0xc5dbcb78, 0x20f373e1, 0xcbd4f1c5, 0xda70f9c5,
+0x61e2c4b1, 0xe9c5da40, 0xe98fd2f4, 0xc5dbcb78,
+0x20f373e1, 0xd3d4e9c5, 0x1875e3c4, 0xf9c501ca,
+0xfdc5f96f, 0xc8244c7f, 0x4c6ff9c5, 0xf9c50824,
+0x1824546f, 0x5cd4f1c5, 0xe9c52824, 0x382464d4,
+0x1865e3c4, 0xf9c501dc, 0xfdc5f36f, 0xe8245c7f,
+0x64fbf1c5, 0x79c52824, 0xf824446f, 0xeffbd1c5,
+0x7ef9e1c4, 0x6ff9c5e8, 0xc5b8247c, 0xb1dc70f9,
+0xe6f4d9c5, 0x4061e2c4, 0x78e98fde, 0xe1c5dbcb,
+0xc520f373, 0xc5e3d4d9, 0x245cfbe9, 0xf9e1c438,
+0xe3c4e27e, 0x01e116f9, 0xf370f9c5, 0x61c1c4b1,
+0x3948d8f4, 0x49c2c4c2, 0x940ff040, 0x0ff631c0,
+0xf748c0b6, 0xc28948d8, 0x16f9e3c4, 0x394801e8,
+0x78e98fc1, 0xc9c5f6cb, 0x4020f673, 0xc5c6940f,
+0xc5ded4e1, 0x2474fbc1, 0xdef748d8, 0x7ef9e1c4,
+0xf9e1c4d9, 0xe1c4fa6e, 0x48f07ef9, 0xe3c4c139,
+0x01f116f9, 0x0fc0940f, 0xf748c0b6, 0xf9e1c4d8,
+0xe3c4e06e, 0x01d816f9, 0x22c1e3c4, 0x394801de,
+0xc0940fc8, 0x48c0b60f, 0xe3c4d8f7, 0x01e022d9,
+0x00055bb8, 0x65e3c400, 0xc501dc18, 0x83d350fd,
+0x850f0ffa, 0x00000718, 0x6c6ff9c5, 0xf9c52824,
+0xc5b1e170, 0x24746ff9, 0x59e2c438, 0xf1c5dd40,
+0xe98fedf4, 0xc5dbcb78, 0x20f373e1, 0xebd4d1c5,
+0xda70f9c5, 0x61e2c4b1, 0xe9c5fe40, 0xe98ff6f4,
+0xc5ffcb78, 0x20f773c1, 0xf7d4c9c5, 0x1855e3c4,
+0xe1c401ee, 0xc5e87ef9, 0x246c7ffd, 0xf88348a8,
+0xc0940f04, 0xb60fc931, 0xd8f748c0, 0x247c8348,
+0x940f06b0, 0xc4d231c1, 0xf86ef9e1, 0x0005c8b8,
+0xd9f74800, 0x247c8348, 0x940f06b8, 0xc4f631c2,
+0xe922c1e3, 0xdaf74801, 0x247c8348, 0x0f4004c0,
+0xe1c4c694, 0x48f26ef9, 0xe3c4def7, 0x01f622c9,
+0x1855e3c4, 0xfdc501ee, 0xfa83d550, 0x5d850f0f,
+0xc5000006, 0x246c6ff9, 0x59e2c448, 0xf1c5e540,
+0xe98fcdf4, 0xc5e4cb78, 0x20f473d9, 0xccd4f1c5,
+0x646ff9c5, 0xe2c45824, 0xc5dc4061, 0x8fd4f4e9,
+0xdbcb78e9, 0xf373e1c5, 0xd4e9c520, 0x75e3c4d3,
+0xc501ea18, 0x246c7ffd, 0x6ff9c5e8, 0xc5e82474,
+0x247c6ff9, 0x73e1c5f8, 0xd9c503f6, 0xc403f773,
+0xdc1865e3, 0xf9e1c401, 0xfdc5d87e, 0xa8245c7f,
+0x746ff9c5, 0xf9c5e824, 0xf8247c6f, 0xf673e1c5,
+0x73d9c502, 0xe3c402f7, 0x01dc1865, 0x5c7ffdc5,
+0xf9c5c824, 0xc824646f, 0x5c6ff9c5, 0xd9c5d824,
+0xe1c5e4d4, 0xe1c4dbd4, 0x48e27ef9, 0xe3c4d039,
+0x01e216f9, 0x31c0940f, 0xc0b60fc9, 0x48d8f748,
+0xb0245439, 0x7ef9e1c4, 0xc1940fda, 0x6ef9e1c4,
+0x05edb8f0, 0xf7480000, 0x543948d9, 0x940fb824,
+0xd2b60fc2, 0xc4daf748, 0xe26ef9e1, 0x16f9e3c4,
+0x394801da, 0x0fc02454, 0xe3c4c294, 0x01d922c9,
+0x48d2b60f, 0xe3c4daf7, 0x01e222d9, 0x1865e3c4,
+0xfdc501dc, 0xfa83d350, 0x41850f0f, 0xc5000005,
+0x49256ff9, 0x8f000005, 0x5c9b58e9, 0xe98fa824,
+0x24649b58, 0x65e3c4b8, 0xc501dc18, 0x245c7ffd,
+0x6ff9c5e8, 0xc5e82464, 0x245c6ff9, 0xd4d9c5f8,
+0xd4e1c5e4, 0xf9e1c4db, 0x3948e07e, 0xc4c82444,
+0xe216f9e3, 0xc0940f01, 0xb60fc931, 0xd8f748c0,
+0x24543948, 0xf9e1c4d0, 0x940fda7e, 0xf9e1c4c1,
+0xf2b8f86e, 0x48000005, 0x3948d9f7, 0x0fd82454,
+0xb60fc294, 0xdaf748d2, 0x6ef9e1c4, 0xf9e3c4e2,
+0x4801da16, 0xe0245439, 0xc4c2940f, 0xd922c1e3,
+0xd2b60f01, 0xc4daf748, 0xe222d9e3, 0x65e3c401,
+0xc501dc18, 0x83d350fd, 0x850f0ffa, 0x00000490,
+0xa42444c7, 0x00000003, 0xdd6ff9c5, 0x6c7ffdc5,
+0x6348e824, 0xc5a42444, 0x24646ff9, 0xf9e1c4f8,
+0xd1c5f06e, 0xd9c5eef3, 0xe3c4f6f3, 0x01ee1855,
+0x7ef9e1c4, 0x7ffdc5e8, 0xc7a8246c, 0x02a42444,
+0x48000000, 0xa4247c63, 0x6ef9e1c4, 0xf3e1c5ef,
+0xf3d9c5dd, 0x65e3c4e5, 0xc501dc18, 0x245c7ffd,
+0x6ff9c5c8, 0xc5c82464, 0x245c6ff9, 0xd4d9c5d8,
+0xd4e1c5e4, 0xf9e1c4db, 0x3948e27e, 0xf9e3c4d0,
+0x0f01e216, 0xc931c094, 0x48c0b60f, 0x3948d8f7,
+0xc4b02454, 0xda7ef9e1, 0xc4c1940f, 0xe86ef9e1,
+0x000605b8, 0xd9f74800, 0x24543948, 0xc2940fb8,
+0x48d2b60f, 0xe1c4daf7, 0xc4e26ef9, 0xda16f9e3,
+0x54394801, 0x940fc024, 0xd1e3c4c2, 0x0f01d922,
+0xf748d2b6, 0xd9e3c4da, 0xc401e222, 0xdc1865e3,
+0x50fdc501, 0x0ffa83d3, 0x03a2850f, 0x63480000,
+0xc5a42444, 0xc4e4efd9, 0xd86ef9e1, 0xdb6ce1c5,
+0xdbfbd9c5, 0x9b60e98f, 0x8fa82464, 0x5c9b60e9,
+0xe3c4b824, 0x01db185d, 0x5c7ffdc5, 0xf9c5e824,
+0xe824646f, 0x5c6ff9c5, 0xd9c5f824, 0xe1c5e4d4,
+0xe1c4dbd4, 0x48e07ef9, 0xc8244439, 0x16f9e3c4,
+0x940f01e2, 0x0fc931c0, 0xf748c0b6, 0x543948d8,
+0xe1c4d024, 0x0fda7ef9, 0xe1c4c194, 0xb8e86ef9,
+0x00000609, 0x48d9f748, 0xd8245439, 0x0fc2940f,
+0xf748d2b6, 0xf9e1c4da, 0xe3c4e26e, 0x01da16f9,
+0x24543948, 0xc2940fe0, 0x22d1e3c4, 0xb60f01d9,
+0xdaf748d2, 0x22d9e3c4, 0xe3c401e2, 0x01dc1865,
+0xd350fdc5, 0x0f0ffa83, 0x0002e385, 0xc4ff3100,
+0xc87ef9e1, 0x247c8348, 0x0f480068, 0xe3c4c74e,
+0x01ca16f9, 0x247c8348, 0xe1c40070, 0xc4d67ef9,
+0xd116f9e3, 0x4e0f4801, 0x7c8348d7, 0x48007824,
+0x48f74e0f, 0x8024bc83, 0x00000000, 0xcf4e0f48,
+0x6ef9e1c4, 0xd1e3c4ee, 0xc401c922, 0xe86ef9e1,
+0x22d1e3c4, 0xe3c401d2, 0x01d1186d, 0xca6ff9c5,
+0x547ffdc5, 0xe98fe824, 0x245c9be8, 0x6ff9c568,
+0x8ff82454, 0x649be8e9, 0xe3c47824, 0x01dc1865,
+0x7ef9e1c4, 0x7ffdc5d8, 0xc5a8245c, 0x6d256ff9,
+0xc5000002, 0x24746ff9, 0x6ff9c568, 0xc578247c,
+0xc5dcfbc9, 0xc4e4fbc1, 0xdc1865e3, 0x7ffdc501,
+0x8f68245c, 0x4c9bf0e9, 0xe98f6824, 0x24549be8,
+0x75e3c478, 0xc501da18, 0xc5c9d4f1, 0xc4d2d4e9,
+0xca7ef9e1, 0x5c7ffdc5, 0x3948c824, 0xc0940fd0,
+0xb60ff631, 0xd8f748c0, 0xc4c28948, 0xc816f9e3,
+0x44394801, 0x0f40b024, 0xe1c4c694, 0xc4d07ef9,
+0xf26ef9e1, 0x48def748, 0xb8244439, 0xc4c0940f,
+0xce22c9e3, 0xc0b60f01, 0x48d8f748, 0xe3c4c189,
+0x01d016f9, 0x24443948, 0xc0940fc0, 0x6ef9e1c4,
+0xc0b60fe9, 0xc4d8f748, 0xd022d1e3, 0x0621b801,
+0xe3c40000, 0x01ca1875, 0xd150fdc5, 0x0f0ffa83,
+0x00018b85, 0xeff1c500, 0xfbf1c5c9, 0xc5682454,
+0x244cfbf1, 0x68e98f78, 0xc824549b, 0x9b70e98f,
+0xc4d8244c, 0xd07ef9e1, 0x24443948, 0xf9e3c4e8,
+0x0f01d216, 0xc931c094, 0x48c0b60f, 0x3948d8f7,
+0xc4f02454, 0xca7ef9e1, 0xc4c1940f, 0xf86ef9e1,
+0x000626b8, 0xd9f74800, 0x24543948, 0xc2940ff8,
+0x48d2b60f, 0xe1c4daf7, 0xc4d26ef9, 0xca16f9e3,
+0x14394801, 0xc2940f24, 0x22c1e3c4, 0xb60f01c9,
+0xdaf748d2, 0x22e9e3c4, 0xe3c401d2, 0x01ca1875,
+0xd150fdc5, 0x0f0ffa83, 0x0000f385, 0x48c03100,
+0x48247c83, 0x6ffdc500, 0x0f08244c, 0xf631c09f,
+0x48d8f748, 0x50247c83, 0xf9e1c400, 0xfdc5c97e,
+0xc8244c7f, 0xc69f0f40, 0xe1c4d231, 0x48f06ef9,
+0x8348def7, 0x0058247c, 0x31c29f0f, 0xc9e3c4ff,
+0x4801d622, 0x8348daf7, 0x0060247c, 0xc79f0f40,
+0x6ef9e1c4, 0xdff748ea, 0x22d1e3c4, 0xe3c401df,
+0x01d3186d, 0xa274e88f, 0x2028244c, 0x7ef9e1c4,
+0xc13948c8, 0x31c0940f, 0xc0b60fc9, 0x48d8f748,
+0xe3c4c289, 0x01c816f9, 0x24443948, 0x7de3c430,
+0x0f01c919, 0xe1c4c194, 0xbafa6ef9, 0x00000000,
+0x7ef9e1c4, 0xd9f748c8, 0x24443948, 0xc0940fd8,
+0x48c0b60f, 0xe1c4d8f7, 0xc4d06ef9, 0xc816f9e3,
+0x44394801, 0x940f4024, 0xc1e3c4c0, 0x0f01c922,
+0xf748c0b6, 0xe9e3c4d8, 0xc401d022, 0xca1875e3,
+0x50fdc501, 0x0ff883c1, 0x00072ab8, 0xc2440f00,
+0x0000c3c9, 0x00000000, 0x00000000, 0x00000000,
+0xfffffffe, 0xffffffff, 0xfffffffe, 0xffffffff,
+0x00000001, 0x00000000, 0x00000001, 0x00000000,
+0005460,
+};
+asm(".type xop_x86_64_D_32i8, STT_NOTYPE;");
+asm(".type xop_x86_64_D_32i8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_32u8[] = {
+0xb85500eb, 0x00000001, 0x000040b9, 0x05b84100,
+0x48000000, 0x8348e589, 0x8148e0e4, 0x000088ec,
+0xff708d00, 0x48c7894c, 0x89c40489, 0xc72948f2,
+0x4801e283, 0x20c47c89, 0xc685caff, 0xc6940f40,
+0x40d26348, 0x48f6b60f, 0x40c45489, 0xcf89f129,
+0xc47c8948, 0xc0ff4860, 0x05f88348, 0xfdc5c375,
+0x0824746f, 0x747ffdc5, 0xc031a824, 0x247c8b48,
+0x7c3b48a8, 0x940f0824, 0x748b48c0, 0x3145b024,
+0x4c8b48c0, 0xf748c024, 0x743948d8, 0x8b481024,
+0x41b82474, 0x31c0940f, 0xf9e1c4d2, 0x39b8f06e,
+0x49000005, 0x3b48d8f7, 0x0f182474, 0x3145c294,
+0xc9c3c4c9, 0x4801c822, 0x3b48daf7, 0x4120244c,
+0xc4c1940f, 0xfa6ef9e1, 0xc4d9f749, 0xd122c1c3,
+0x75e3c401, 0xc501ca18, 0x83d150fd, 0x850f0ffa,
+0x0000085d, 0x7c6ff9c5, 0xf9c5a824, 0xb824746f,
+0x4cd4c1c5, 0xc9c50824, 0x182454d4, 0x1875e3c4,
+0xfdc501ca, 0xc8244c7f, 0x7c6ff9c5, 0xf9c50824,
+0x1824746f, 0xf773e9c5, 0x73f1c501, 0xe1c401f6,
+0x48d07ef9, 0xc8244439, 0x16f9e3c4, 0x940f01d2,
+0xc03145c0, 0x48c0b60f, 0x3948d8f7, 0xc4d02454,
+0xca7ef9e1, 0xc0940f41, 0x6ef9e1c4, 0x053fb8f8,
+0xf7490000, 0x543948d8, 0x940fd824, 0xd2b60fc2,
+0xc4daf748, 0xd26ef9e1, 0x16f9e3c4, 0x394801ca,
+0x0fe02454, 0xc3c4c294, 0x01c822c1, 0x48d2b60f,
+0xe3c4daf7, 0x01d222e9, 0x1875e3c4, 0xfdc501ca,
+0xfa83d150, 0xa6850f0f, 0xc5000007, 0x24746ff9,
+0x6ff9c5c8, 0xc5d8247c, 0x244cfbc9, 0xfbc1c508,
+0xc4182454, 0xca1875e3, 0x7ffdc501, 0x31e8244c,
+0x7c3b48c0, 0x8b48e824, 0x0ff0247c, 0xf748c094,
+0x7c3948d8, 0x0f40b024, 0xd231c794, 0x6ef9e1c4,
+0x0544b8f8, 0x0f400000, 0xf748ffb6, 0x743b48df,
+0x940ff824, 0xc1e3c4c2, 0x4801d722, 0x3b48daf7,
+0x940f240c, 0xf9e1c4c1, 0xb60ff26e, 0xd9f748c9,
+0x22c9e3c4, 0xe3c401d9, 0x01d3186d, 0xd250fdc5,
+0x0f0ffa83, 0x00071885, 0x6ffdc500, 0xc5a82474,
+0x245456cc, 0x7ffdc528, 0xc5a82454, 0x244c54f4,
+0x6ffdc528, 0xc5e8247c, 0x245457c4, 0xf9e1c428,
+0xfdc5d07e, 0xe824547f, 0x4c55f4c5, 0xe1c4a824,
+0x48ca7ef9, 0x940fd039, 0x0fc931c0, 0xf748c0b6,
+0xc28948d8, 0x16f9e3c4, 0x394801c8, 0xc4f02444,
+0xc9197de3, 0xc1940f01, 0x6ef9e1c4, 0xf9e1c4ea,
+0xf748c87e, 0x443948d9, 0x940ff824, 0xc0b60fc0,
+0xc4d8f748, 0xd06ef9e1, 0x16f9e3c4, 0x394801c8,
+0x940f2404, 0xd1e3c4c0, 0x0f01c922, 0xf748c0b6,
+0xe9e3c4d8, 0xb801d022, 0x00000550, 0x1875e3c4,
+0xfdc501ca, 0xfa83d150, 0x62850f0f, 0xc5000006,
+0x244c6ff9, 0x6ff9c508, 0xc528245c, 0x24646ff9,
+0x70f9c538, 0xf1c5b1d1, 0xe2c4cbf4, 0xc5d34069,
+0x245c6ff9, 0x78e98f18, 0xe9c5d2cb, 0xc520f273,
+0xc5cad4f1, 0xb1d370f9, 0x4069e2c4, 0xf4e1c5d4,
+0x78e98fdc, 0xe9c5d2cb, 0xc520f273, 0xc4dad4e1,
+0xcb1875e3, 0xf9e1c401, 0xfdc5c87e, 0xa8244c7f,
+0x04f88348, 0x31c0940f, 0xc0b60fc9, 0x48d8f748,
+0xb0247c83, 0xc1940f06, 0xe1c4d231, 0xb8f86ef9,
+0x000005c8, 0x48d9f748, 0xb8247c83, 0xc2940f06,
+0xe3c4f631, 0x01c922c1, 0x48daf748, 0xc0247c83,
+0x940f4004, 0xf9e1c4c6, 0xf748f26e, 0xc9e3c4de,
+0xc401d622, 0xca1875e3, 0x50fdc501, 0x0ffa83d1,
+0x059b850f, 0xfdc50000, 0x0824546f, 0x547ffdc5,
+0xf9c5e824, 0xe8246c6f, 0x746ff9c5, 0xf1c5f824,
+0xc503f573, 0x03f673e1, 0x1875e3c4, 0xe1c401cb,
+0xc5c87ef9, 0x244c7ffd, 0x6ff9c5a8, 0xc5e8247c,
+0x246c6ff9, 0x73f1c5f8, 0xe1c502f7, 0xc402f573,
+0xcb1875e3, 0x7ffdc501, 0xc5c8244c, 0x245c6ff9,
+0x6ff9c5c8, 0xc5d8244c, 0xc5dbd4e1, 0xc4c9d4f1,
+0xda7ef9e1, 0xc4d03948, 0xda16f9e3, 0xc0940f01,
+0xb60fc931, 0xd8f748c0, 0x24543948, 0xf9e1c4b0,
+0x940fca7e, 0xf9e1c4c1, 0xedb8f06e, 0x48000005,
+0x3948d9f7, 0x0fb82454, 0xb60fc294, 0xdaf748d2,
+0x6ef9e1c4, 0xf9e3c4da, 0x4801ca16, 0xc0245439,
+0xc4c2940f, 0xc922c9e3, 0xd2b60f01, 0xc4daf748,
+0xda22e1e3, 0x75e3c401, 0xc501cb18, 0x83d150fd,
+0x850f0ffa, 0x000004b9, 0x7c6ff9c5, 0xf9c5a824,
+0xb8246c6f, 0xd773f1c5, 0x73e1c502, 0xe3c402d5,
+0x01cb1875, 0x4c7ffdc5, 0xf9c5e824, 0xe8245c6f,
+0x4c6ff9c5, 0xe1c5f824, 0xf1c5dbd4, 0xe1c4c9d4,
+0x48d87ef9, 0xc8244439, 0x16f9e3c4, 0x940f01da,
+0x0fc931c0, 0xf748c0b6, 0x543948d8, 0xe1c4d024,
+0x0fca7ef9, 0xe1c4c194, 0xb8f06ef9, 0x000005f2,
+0x48d9f748, 0xd8245439, 0x0fc2940f, 0xf748d2b6,
+0xf9e1c4da, 0xe3c4da6e, 0x01ca16f9, 0x24543948,
+0xc2940fe0, 0x22c9e3c4, 0xb60f01c9, 0xdaf748d2,
+0x22e1e3c4, 0xe3c401da, 0x01cb1875, 0xd150fdc5,
+0x0f0ffa83, 0x00040885, 0x2444c700, 0x000003a4,
+0x7ffdc500, 0xc5e82454, 0x246c6ef9, 0x6ff9c5a4,
+0xc5f8245c, 0xc5e5f3e9, 0xc4edf3e1, 0xe5185de3,
+0xf9e1c401, 0xfdc5e07e, 0xa824647f, 0xa42444c7,
+0x00000002, 0x646ef9c5, 0xe9c5a424, 0xe1c5ccf3,
+0xe3c4dcf3, 0x01cb1875, 0x4c7ffdc5, 0xf9c5c824,
+0xc8245c6f, 0x4c6ff9c5, 0xe1c5d824, 0xf1c5dbd4,
+0xe1c4c9d4, 0x48da7ef9, 0xe3c4d039, 0x01da16f9,
+0x31c0940f, 0xc0b60fc9, 0x48d8f748, 0xb0245439,
+0x7ef9e1c4, 0xc1940fca, 0x6ef9e1c4, 0x0605b8f8,
+0xf7480000, 0x543948d9, 0x940fb824, 0xd2b60fc2,
+0xc4daf748, 0xda6ef9e1, 0x16f9e3c4, 0x394801ca,
+0x0fc02454, 0xe3c4c294, 0x01c922c1, 0x48d2b60f,
+0xe3c4daf7, 0x01da22e1, 0x1875e3c4, 0xfdc501cb,
+0xfa83d150, 0x26850f0f, 0xc5000003, 0x245c6ef9,
+0x6ff9c5a4, 0xc5a8246c, 0x24746ff9, 0xd3d1c5b8,
+0xd3c9c5cb, 0x75e3c4db, 0xc501cb18, 0x244c7ffd,
+0x6ff9c5e8, 0xc5e8245c, 0x244c6ff9, 0xd4e1c5f8,
+0xd4f1c5db, 0xf9e1c4c9, 0x3948d87e, 0xc4c82444,
+0xda16f9e3, 0xc0940f01, 0xb60fc931, 0xd8f748c0,
+0x24543948, 0xf9e1c4d0, 0x940fca7e, 0xf9e1c4c1,
+0x09b8f86e, 0x48000006, 0x3948d9f7, 0x0fd82454,
+0xb60fc294, 0xdaf748d2, 0x6ef9e1c4, 0xf9e3c4da,
+0x4801ca16, 0xe0245439, 0xc4c2940f, 0xc922c1e3,
+0xd2b60f01, 0xc4daf748, 0xda22e1e3, 0x75e3c401,
+0xc501cb18, 0x83d150fd, 0x850f0ffa, 0x00000271,
+0x24448b48, 0x7c8b4868, 0xf7487824, 0xc01948d8,
+0x6ef9e1c4, 0x448b48d8, 0xf7487024, 0xc01948d8,
+0x48dff748, 0x8024bc8b, 0x48000000, 0xe3c4f619,
+0x01d822e1, 0xc4dff748, 0xce6ef9e1, 0xc4d21948,
+0xca22f1e3, 0x65e3c401, 0xc501d918, 0xc5da54e4,
+0xc5cb6ff9, 0x245c7ffd, 0xe0e98fe8, 0x6824649b,
+0x5c6ff9c5, 0xe98ff824, 0x246c9be0, 0x5de3c478,
+0xc401e518, 0xe07ef9e1, 0x647ffdc5, 0xd9c5a824,
+0xd9c5e476, 0x68246cd4, 0x64d4d9c5, 0xe3c47824,
+0x01e41855, 0x647ffdc5, 0xe98f6824, 0x244c9bf0,
+0xe0e98f68, 0x78245c9b, 0x1875e3c4, 0xf1c501e3,
+0xe1c5c9d4, 0xe1c4dbd4, 0xc5ca7ef9, 0x24647ffd,
+0xd03948c8, 0x31c0940f, 0xc0b60ff6, 0x48d8f748,
+0xe3c4c289, 0x01c816f9, 0x24443948, 0x940f40b0,
+0xf9e1c4c6, 0xe1c4d87e, 0x48f26ef9, 0x3948def7,
+0x0fb82444, 0xe3c4c094, 0x01ce22c9, 0x48c0b60f,
+0x8948d8f7, 0xf9e3c4c1, 0x4801d816, 0xc0244439,
+0xc4c0940f, 0xe96ef9e1, 0x48c0b60f, 0xe3c4d8f7,
+0x01d822d1, 0x000621b8, 0x75e3c400, 0xc501cb18,
+0x83d150fd, 0x850f0ffa, 0x00000135, 0xc9eff1c5,
+0x5cfbf1c5, 0xf1c56824, 0x78244cfb, 0x9760e98f,
+0x8fc8245c, 0x4c9770e9, 0xe1c4d824, 0x48d87ef9,
+0xe8244439, 0x16f9e3c4, 0x940f01da, 0x0fc931c0,
+0xf748c0b6, 0x543948d8, 0xe1c4f024, 0x0fca7ef9,
+0xe1c4c194, 0xb8f86ef9, 0x00000626, 0x48d9f748,
+0xf8245439, 0x0fc2940f, 0xf748d2b6, 0xf9e1c4da,
+0xe3c4da6e, 0x01ca16f9, 0x24143948, 0xc4c2940f,
+0xc922c1e3, 0xd2b60f01, 0xc4daf748, 0xda22e1e3,
+0x75e3c401, 0xc501cb18, 0x83d150fd, 0x850f0ffa,
+0x0000009d, 0x7ef9e1c4, 0x7ffdc5d0, 0xc5c82454,
+0x24646ffd, 0x6ce88f48, 0x282454a2, 0xf9e1c440,
+0x3948d27e, 0xc0940fd0, 0xb60fc931, 0xd8f748c0,
+0x6ef9e1c4, 0xf9e3c4c8, 0x4801d016, 0x30244439,
+0x197de3c4, 0x940f01d2, 0xf9e1c4c1, 0xf748d07e,
+0x443948d9, 0x940fd824, 0xf1e3c4c0, 0x0f01c922,
+0xf748c0b6, 0xc28948d8, 0x16f9e3c4, 0x394801d0,
+0x0f402444, 0xe1c4c094, 0xbaea6ef9, 0x00000000,
+0x48c0b60f, 0xe3c4d8f7, 0x01d022d1, 0x1875e3c4,
+0xfdc501ca, 0xf883c150, 0x072ab80f, 0x440f0000,
+0x00c3c9c2,
+0004503,
+};
+asm(".type xop_x86_64_D_32u8, STT_NOTYPE;");
+asm(".type xop_x86_64_D_32u8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_32f4[] = {
+0x315500eb, 0x0008bac0, 0x89480000, 0xe48348e5,
+0xec8348e0, 0x01488d68, 0xc92af2c5, 0xc129d189,
+0x4c11fac5, 0xf2c50884, 0xfac5c92a, 0x28844c11,
+0x0d10fac5, 0x000006e8, 0x087501a8, 0x0d10fac5,
+0x000006fc, 0x4c11fac5, 0xff484884, 0xf88348c0,
+0xc5c27508, 0x247c28fc, 0x29fcc508, 0xc5a8247c,
+0x244c28fc, 0x0539b8a8, 0xf4c50000, 0xc500d7c2,
+0x81d250fc, 0x0000fffa, 0x87850f00, 0xc5000006,
+0x245458f4, 0x29fcc508, 0xc5c82454, 0x247c28fc,
+0x053fb808, 0xc4c50000, 0xecc5d758, 0xc82454c2,
+0x50fcc500, 0xfffa81d2, 0x0f000000, 0x00065585,
+0x28fcc500, 0xc5c8247c, 0x24545cc4, 0x29fcc508,
+0xc5e82454, 0x2454c2f4, 0x44b800e8, 0xc5000005,
+0x81d250fc, 0x0000fffa, 0x27850f00, 0xc5000006,
+0x247428fc, 0x59f4c528, 0xc508244c, 0xc5de59cc,
+0x245428fc, 0x58ecc508, 0x5cecc5ee, 0xc5282464,
+0xb8cb5cf4, 0x0000055b, 0xe559dcc5, 0xccc2f4c5,
+0x50fcc500, 0xfffa81d1, 0x0f000000, 0x0005e585,
+0x59ecc500, 0xc548244c, 0x244c29fc, 0x5eecc5a8,
+0xc5482454, 0x00cac2f4, 0x000564b8, 0x50fcc500,
+0xfffa81d1, 0x0f000000, 0x0005b985, 0x7de2c400,
+0x05ce1518, 0xfcc50000, 0x48245c28, 0x000567b8,
+0x57e4c500, 0x57ecc5ca, 0xc5082454, 0x244c59f4,
+0xc2f4c5a8, 0xfcc500ca, 0xfa81d150, 0x000000ff,
+0x0580850f, 0xfdc50000, 0x08244c5b, 0xc95bfcc5,
+0x4cc2f4c5, 0xb8000824, 0x0000056e, 0xd150fcc5,
+0x00fffa81, 0x850f0000, 0x0000055a, 0x4c53fcc5,
+0xfcc50824, 0xa8244c29, 0x4c53fcc5, 0xfcc5a824,
+0x08245428, 0x000575b8, 0x5bfdc500, 0x5bfcc5c9,
+0xc2f4c5c9, 0xfcc500ca, 0xfa81d150, 0x000000ff,
+0x0520850f, 0xecc50000, 0xfcc5ca59, 0xa8244c29,
+0x4c52fcc5, 0xfcc5a824, 0xc8244c29, 0x4c28fcc5,
+0x7cb8c824, 0xc5000005, 0xc5e153fc, 0xc5e45bfd,
+0xc5e45bfc, 0x00d4c2ec, 0xd250fcc5, 0x00fffa81,
+0x850f0000, 0x000004de, 0x6428fcc5, 0xfdc50824,
+0xfcc5c95b, 0x7eb8c95b, 0xc5000005, 0xc5d453fc,
+0xc5d25bfd, 0xc5d25bfc, 0x00cac2f4, 0xd150fcc5,
+0x00fffa81, 0x850f0000, 0x000004aa, 0xcc59dcc5,
+0x4c29fcc5, 0xfcc5a824, 0xa8244c51, 0x00059cb8,
+0xc2f4c500, 0xfcc500cc, 0xfa81d150, 0x000000ff,
+0x0480850f, 0xe2c40000, 0xb115187d, 0xc5000004,
+0xc5e45eec, 0x246429fc, 0x7de3c4a8, 0xa8244c08,
+0x05a4b80b, 0xf4c50000, 0x04910dc2, 0xc5000000,
+0x81d150fc, 0x0000fffa, 0x47850f00, 0x8f000004,
+0x4c807ce9, 0xd8c50824, 0xabb8e457, 0xc5000005,
+0x00ccc2f4, 0xd150fcc5, 0x00fffa81, 0x850f0000,
+0x00000422, 0x4c58ecc5, 0xecc50824, 0xfcc5c95e,
+0xa8244c29, 0x807ce98f, 0xc5a8244c, 0x244cc2f4,
+0xb1b800a8, 0xc5000005, 0x81d150fc, 0x0000fffa,
+0xef850f00, 0xc4000003, 0x0d187de2, 0x00000408,
+0x4c59f4c5, 0xfcc50824, 0xa8244c29, 0x087de3c4,
+0x0ba8244c, 0x807ce98f, 0xc5a82464, 0xb8cc58f4,
+0x000005bb, 0x4cc2f4c5, 0xc500a824, 0x81d150fc,
+0x0000fffa, 0xab850f00, 0xc5000003, 0x244c59e4,
+0x59e4c528, 0xc5082464, 0x244c29fc, 0x5fdcc5c8,
+0xc5c8244c, 0x24645ddc, 0x29fcc5c8, 0xc5c82464,
+0x244c58f4, 0x28fcc5c8, 0xb808247c, 0x0000063d,
+0x6458c4c5, 0xf4c52824, 0xf4c5cb59, 0xc500ccc2,
+0x81d150fc, 0x0000fffa, 0x57850f00, 0xc4000003,
+0x4c047de3, 0xc51b0824, 0x246c28fc, 0x064eb828,
+0xe3c40000, 0x01c90675, 0xc9c2d4c5, 0x50fcc500,
+0xfffa81d1, 0x0f000000, 0x00032985, 0x6ff9c500,
+0x00039b35, 0x5bfdc500, 0x0653b8e5, 0xd9c50000,
+0xe3c4cefa, 0x01e4197d, 0xe6fad9c5, 0x1875e3c4,
+0xfcc501cc, 0x08246428, 0x0c5de2c4, 0x75e3c4c9,
+0xc501c906, 0x00c9c2d4, 0xd150fcc5, 0x00fffa81,
+0x850f0000, 0x000002de, 0xe558dcc5, 0x00065db8,
+0x7de2c400, 0x02f20d18, 0xdcc50000, 0xc500e1c2,
+0x81d450fc, 0x0000fffa, 0xb7850f00, 0xc5000002,
+0x244c12fe, 0x7de2c408, 0x02c22518, 0xf4c50000,
+0x08244c5c, 0x000717b8, 0x7de2c400, 0x02be3518,
+0xdcc50000, 0xdcc5e358, 0xf4c5e659, 0xc500ccc2,
+0x81d150fc, 0x0000fffa, 0x77850f00, 0xc5000002,
+0x246416fe, 0x58e4c508, 0x28fcc5d2, 0xb808244c,
+0x0000071e, 0xe15cdcc5, 0xd659ecc5, 0xd2c2dcc5,
+0x50fcc500, 0xfffa81d2, 0x0f000000, 0x00024585,
+0x10fac500, 0xc52c2454, 0x244c29fc, 0x072ab8c8,
+0xfac50000, 0xcc245411, 0x5410fac5, 0xfac53424,
+0xd4245411, 0x5410fac5, 0xfac53c24, 0xdc245411,
+0x5410fac5, 0xfac54424, 0xe4245411, 0xd257e8c5,
+0xd3c2ecc5, 0x28fcc501, 0x8fc8245c, 0xcda274e8,
+0xc2e4c520, 0xfcc500c9, 0xfa81d150, 0x000000ff,
+0x01e0850f, 0xc8830000, 0x6de2c4ff, 0x08244c2c,
+0x4c29fcc5, 0xf1c5e824, 0x4489c9ef, 0xe2c49424,
+0x2464187d, 0x0733b894, 0xe88f0000, 0x20cca274,
+0x2e75e2c4, 0xc5e8246c, 0x247428fc, 0xc2ccc5e8,
+0xfcc500cb, 0xfa81d150, 0x000000ff, 0x0194850f,
+0xfcc50000, 0x08247c28, 0x00073ab8, 0x45e3c400,
+0x28244c0c, 0xc2e4c5aa, 0xfcc500d9, 0xfa81d350,
+0x000000ff, 0x016c850f, 0xfcc50000, 0x08246c28,
+0x4cd0d7c5, 0xfcc52824, 0x08247428, 0x54d0cfc5,
+0x43b82824, 0xc5000007, 0x00cac2f4, 0xd150fcc5,
+0x00fffa81, 0x850f0000, 0x0000013a, 0x5c28fcc5,
+0xe3c40824, 0x24544065, 0x52b8f128, 0xc5000007,
+0xc4ca28f8, 0xd2197de3, 0x58f2c501, 0x71e3c4ca,
+0xc50ec921, 0x640dc2f4, 0x00000001, 0xd150fcc5,
+0x00fffa81, 0x850f0000, 0x000000fa, 0x5c29fcc5,
+0x03baa824, 0xc5000000, 0xc5c957f0, 0x24547cf7,
+0x7de3c4a8, 0xc501d319, 0xc5e212d8, 0xc5d316e8,
+0xe4e3c6d8, 0xebc6e0c5, 0x6de3c4ff, 0xc501d418,
+0x245429fc, 0x75caffa8, 0x2ef8c5d2, 0x0000e32d,
+0xaa8a0f00, 0x0f000000, 0x0000a485, 0x28fcc500,
+0xc508247c, 0x245c7dc7, 0x28f8c528, 0x7de3c4d3,
+0xc501db19, 0xc5e212d8, 0xc5d316e8, 0xe4e3c6d8,
+0x186de3c4, 0xefc501d4, 0xf8c5d97c, 0xe3c4d328,
+0x01db197d, 0xe212d8c5, 0xd316e8c5, 0xe3c6d8c5,
+0x6de3c4e4, 0xc501d418, 0xc5d97cef, 0xc4d328f8,
+0xdb197de3, 0x12d8c501, 0x16e8c5e2, 0xc6d8c5d3,
+0xe3c4e4e3, 0x01d4186d, 0xd17cefc5, 0xda28f8c5,
+0x197de3c4, 0xd8c501d2, 0xe0c5e312, 0xd8c5da16,
+0xc4e4e2c6, 0xdc1865e3, 0xc2e4c501, 0xfcc500d9,
+0xff3dc350, 0xb8000000, 0x00000767, 0xebc2440f,
+0x075eb805, 0xc3c90000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0xbf800000, 0x80000000, 0x3e800000, 0x41100000,
+0x3f000000, 0x42100000, 0x00000000, 0x00000000,
+0x3f800000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x42f00000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000001, 0x00000001, 0x00000001, 0x00000001,
+0003620,
+};
+asm(".type xop_x86_64_D_32f4, STT_NOTYPE;");
+asm(".type xop_x86_64_D_32f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_32f8[] = {
+0x485500eb, 0x8348e589, 0x8348e0e4, 0xfbc568ec,
+0x068a0d10, 0xfbc50000, 0x06221d10, 0xfbc50000,
+0x06222510, 0xfbc50000, 0x06222d10, 0xfbc50000,
+0x06221510, 0xfbc50000, 0x08244c11, 0x5c11fbc5,
+0xfbc52824, 0x48244c11, 0x6411fbc5, 0xfbc51024,
+0x30246c11, 0x5411fbc5, 0xfbc55024, 0x18246c11,
+0x6411fbc5, 0xfbc53824, 0x58244c11, 0x5c11fbc5,
+0xfbc52024, 0x40244c11, 0x5411fbc5, 0xfdc56024,
+0x08247c28, 0x7c29fdc5, 0xfdc5a824, 0xa8244c28,
+0x000539b8, 0xc2f5c500, 0xfdc500d7, 0xfa83d250,
+0x7e850f0f, 0xc5000005, 0x245458f5, 0x29fdc508,
+0xc5c82454, 0x247c28fd, 0x053fb808, 0xc5c50000,
+0xedc5d758, 0xc82454c2, 0x50fdc500, 0x0ffa83d2,
+0x054f850f, 0xfdc50000, 0xc8247428, 0x545ccdc5,
+0xfdc50824, 0xe8245429, 0x54c2f5c5, 0xb800e824,
+0x00000544, 0xd250fdc5, 0x0f0ffa83, 0x00052485,
+0x28fdc500, 0xc528247c, 0x244c59f5, 0x59c5c508,
+0x28fdc5df, 0xc5082454, 0xc5ef58ed, 0x24645ced,
+0x5cf5c528, 0x055bb8cb, 0xddc50000, 0xf5c5e559,
+0xc500ccc2, 0x83d150fd, 0x850f0ffa, 0x000004e5,
+0x4c59edc5, 0xfdc54824, 0xa8244c29, 0x545eedc5,
+0xf5c54824, 0xb800cac2, 0x00000564, 0xd150fdc5,
+0x0f0ffa83, 0x0004bc85, 0x7de2c400, 0x04ee1d19,
+0xfdc50000, 0x48245428, 0x000567b8, 0x57edc500,
+0x57e5c5cb, 0xc508245c, 0x244c59f5, 0xc2f5c5a8,
+0xfdc500cb, 0xfa83d150, 0x86850f0f, 0xc5000004,
+0x244ce6ff, 0xe6fec508, 0xc2f5c5c9, 0x0008244c,
+0x00056eb8, 0x50fdc500, 0x0ffa83d1, 0x0463850f,
+0xfdc50000, 0x08244c5a, 0x1875e3c4, 0xfcc501c9,
+0xfcc5c953, 0xfdc5c95a, 0xa8244c29, 0x4c5afdc5,
+0xf8c5a824, 0x98244c29, 0x1875e3c4, 0xfdc501c9,
+0x08246428, 0xc953fcc5, 0x000575b8, 0x5afcc500,
+0xe6ffc5c9, 0xe6fec5c9, 0xc2f5c5c9, 0xfdc500cc,
+0xfa83d150, 0x0a850f0f, 0xc5000004, 0xc5cc59dd,
+0x244c29fd, 0x5afdc5a8, 0xc4a8244c, 0xc91875e3,
+0x52fcc501, 0x5afcc5c9, 0x29fdc5c9, 0xc5c8244c,
+0x245c28fd, 0x057cb8c8, 0xfdc50000, 0xf8c5cb5a,
+0x98244c29, 0x1875e3c4, 0xfcc501c9, 0xfcc5c953,
+0xffc5c95a, 0xfec5c9e6, 0xddc5c9e6, 0xc500e1c2,
+0x83d450fd, 0x850f0ffa, 0x000003a9, 0x6428fdc5,
+0xffc50824, 0xfec5dbe6, 0x7eb8dbe6, 0xc5000005,
+0xc5cc5afd, 0x244c29f8, 0x75e3c498, 0xc501c918,
+0xc5c953fc, 0xc5c95afc, 0xc5c9e6ff, 0xc5c9e6fe,
+0x00d9c2e5, 0xd350fdc5, 0x0f0ffa83, 0x00036485,
+0x59ddc500, 0x29fdc5cc, 0xc5a8244c, 0x244c51fd,
+0x059cb8a8, 0xf5c50000, 0xc500ccc2, 0x83d150fd,
+0x850f0ffa, 0x0000033d, 0x197de2c4, 0x0003af0d,
+0x5ef5c500, 0x29fdc5e4, 0xc4a82464, 0x5c097de3,
+0xb80ba824, 0x000005a4, 0x1dc2e5c5, 0x0000038f,
+0x50fdc500, 0x0ffa83d3, 0x0307850f, 0xe98f0000,
+0x2464817c, 0x57e1c508, 0x05abb8db, 0xddc50000,
+0xc500e3c2, 0x83d450fd, 0x850f0ffa, 0x000002e5,
+0x6458f5c5, 0xf5c50824, 0xfdc5cc5e, 0xa8244c29,
+0x817ce98f, 0xc5a8244c, 0x244cc2f5, 0xb1b800a8,
+0xc5000005, 0x83d150fd, 0x850f0ffa, 0x000002b5,
+0x197de2c4, 0x0002ef0d, 0x59f5c500, 0xc508244c,
+0x244c29fd, 0x7de3c4a8, 0xa8244c09, 0x7ce98f0b,
+0xa8246481, 0xcc58f5c5, 0x0005bbb8, 0xc2f5c500,
+0x00a8244c, 0xd150fdc5, 0x0f0ffa83, 0x00027485,
+0x59edc500, 0xc528244c, 0x246459ed, 0x29fdc508,
+0xc5c8244c, 0x244c5fdd, 0x5dddc5c8, 0xc5c82464,
+0x246429fd, 0x58f5c5c8, 0xc5c8244c, 0x247428fd,
+0x063db808, 0xcdc50000, 0x28246458, 0xca59f5c5,
+0xccc2f5c5, 0x50fdc500, 0x0ffa83d1, 0x0223850f,
+0xfdc50000, 0x08244c28, 0x6c28fdc5, 0x4eb82824,
+0xc4000006, 0xe1057de3, 0x5de3c405, 0xc501e406,
+0x00e4c2d5, 0xd450fdc5, 0x0f0ffa83, 0x0001f485,
+0x58f5c500, 0x065db8cd, 0xe2c40000, 0x2d25197d,
+0xc5000002, 0x00ccc2f5, 0xd150fdc5, 0x0f0ffa83,
+0x0001d085, 0x12ffc500, 0xc4082464, 0x35197de2,
+0x000001f4, 0x4c28fdc5, 0x17b80824, 0xc4000007,
+0x3d197de2, 0x00000200, 0xf658edc5, 0xe15cddc5,
+0xf759cdc5, 0xe6c2ddc5, 0x50fdc500, 0x0ffa83d4,
+0x018f850f, 0xfbc50000, 0x30246410, 0x4c29fdc5,
+0xe5c5c824, 0xb801d2c2, 0x0000072a, 0x6411fbc5,
+0xfbc5d024, 0x40246410, 0xa274e88f, 0xfbc520cd,
+0xe0246411, 0x5c28fdc5, 0xe5c5c824, 0xc500c9c2,
+0x83d150fd, 0x850f0ffa, 0x00000149, 0xffc88348,
+0x2d6de2c4, 0xc508244c, 0x244c29fd, 0xeff1c5e8,
+0x448948c9, 0xe2c49024, 0x2464197d, 0x0733b890,
+0xe88f0000, 0x20cca274, 0x2f75e2c4, 0xc5e8246c,
+0x247c28fd, 0xc2c5c5e8, 0xfdc500cb, 0xfa83d150,
+0xfe850f0f, 0xc5000000, 0x246c28fd, 0x073ab808,
+0xe3c40000, 0x244c0d55, 0xe5c50a28, 0xc500d9c2,
+0x83d350fd, 0x850f0ffa, 0x000000d9, 0x7428fdc5,
+0xcdc50824, 0x28244cd0, 0x5428fdc5, 0xedc50824,
+0x28245cd0, 0x000743b8, 0xc2f5c500, 0xfdc500cb,
+0xfa83d150, 0xaa850f0f, 0xc5000000, 0x245429fd,
+0x57f1c5a8, 0x7cf5c5c9, 0xc4a82454, 0xda186de3,
+0x6de3c401, 0xc531d206, 0x0cd2c6e5, 0x5429fdc5,
+0xf5c5a824, 0xa824547c, 0x197de3c4, 0xe9c501d2,
+0xf9c5d215, 0x00c6152e, 0x647a0000, 0xfdc56275,
+0x08247c28, 0x547dc5c5, 0x00ba2824, 0xc4000000,
+0xda186de3, 0x6de3c401, 0xc531d206, 0x0cdac6e5,
+0xd97ce5c5, 0x1865e3c4, 0xe3c401d3, 0x31db0665,
+0xd3c6edc5, 0x7cedc50c, 0x6de3c4d1, 0xc401da18,
+0xd2066de3, 0xc6e5c531, 0xedc50cd2, 0xc500c9c2,
+0x83c150fd, 0x67b80ff8, 0x0f000007, 0x05ebc244,
+0x00075eb8, 0x00c3c900, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x40100000, 0x00000000, 0x40000000,
+0x00000000, 0x40080000, 0x00000000, 0xbff00000,
+0x00000000, 0x80000000, 0x00000000, 0x3fd00000,
+0x00000000, 0x40140000, 0x00000000, 0x3fe00000,
+0x00000000, 0x40240000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x00000000,
+0x00000000, 0x00000000, 0x00000000, 0x00000000,
+0003300,
+};
+asm(".type xop_x86_64_D_32f8, STT_NOTYPE;");
+asm(".type xop_x86_64_D_32f8, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_f4[] = {
+0x485523eb, 0x7d89e589, 0x458d48fc, 0xea8948fc,
+0x75ff3880, 0xc0ff480c, 0x75d03948, 0xeb01b0f3,
+0x5dc03102, 0x894855c3, 0xe48348e5, 0xec8148e0,
+0x00000120, 0x0d10fac5, 0x00000544, 0x4c11fac5,
+0xfac53824, 0x3c244c11, 0x4c11fac5, 0x448b4024,
+0x44893824, 0xff312c24, 0x5410fac5, 0xf8c53824,
+0x2c24542e, 0x000000b9, 0x9b0f4000, 0xf9450fc7,
+0x8be8dff7, 0x89ffffff, 0x0539b8c2, 0xd2840000,
+0x04ea840f, 0xfac50000, 0x2c245410, 0x5458eac5,
+0xfac53824, 0x30245411, 0x5410fac5, 0xff313824,
+0xd258eac5, 0x542ef8c5, 0x0f403024, 0x450fc79b,
+0xe8dff7f9, 0xffffff4a, 0x3fb8c289, 0x84000005,
+0xa9840fd2, 0xc5000004, 0x245410fa, 0x5ceac530,
+0xc5382454, 0x241411fa, 0x8924048b, 0x89682444,
+0x89302444, 0x31342444, 0x10fac5ff, 0xc52c2454,
+0x24542ef8, 0x9b0f4034, 0xf9450fc7, 0xffe8dff7,
+0x89fffffe, 0x0544b8c2, 0xd2840000, 0x045e840f,
+0xfac50000, 0x2c245410, 0x5459eac5, 0xfac53824,
+0x2c245411, 0x5410fac5, 0xeac53c24, 0xfac5d259,
+0x30245411, 0x5410fac5, 0xeac53824, 0x3c245458,
+0x5411fac5, 0xfac53424, 0x38245410, 0x5c5ceac5,
+0xff313c24, 0x5c59e2c5, 0xfac53424, 0x2c246410,
+0x645cdac5, 0xf8c53024, 0xfac5e32e, 0x34245c11,
+0xc79b0f40, 0xf7f9450f, 0xfe84e8df, 0xc289ffff,
+0x00055bb8, 0x0fd28400, 0x0003e384, 0x59eac500,
+0xc5402454, 0x245411fa, 0xc5ff312c, 0x245410fa,
+0x5eeac538, 0xc5402454, 0x24542ef8, 0x11fac52c,
+0x40302454, 0x0fc79b0f, 0xdff7f945, 0xfffe41e8,
+0xb8c289ff, 0x00000564, 0x840fd284, 0x000003a0,
+0x5410fac5, 0xfac54024, 0x03b22510, 0xfac50000,
+0x38245c10, 0xe8c5ff31, 0xe0c5d457, 0xeac5dc57,
+0x2c245459, 0xd32ef8c5, 0xc79b0f40, 0xf7f9450f,
+0xfdfce8df, 0xc289ffff, 0x000567b8, 0x0fd28400,
+0x00035b84, 0x2cfac500, 0x89382444, 0x01182484,
+0xeac50000, 0x1824942a, 0xc5000001, 0x245411fa,
+0xc5ff312c, 0x245410fa, 0x2ef8c52c, 0x40382454,
+0x0fc79b0f, 0xdff7f945, 0xfffdb5e8, 0xb8c289ff,
+0x0000056e, 0x840fd284, 0x00000314, 0x54530ff3,
+0xfac53824, 0x2c245411, 0x54530ff3, 0xfac52c24,
+0x8489c22c, 0x00011824, 0x2ae2c500, 0x0118249c,
+0xfac50000, 0x38245410, 0xf8c5ff31, 0x0f40da2e,
+0x450fc79b, 0xe8dff7f9, 0xfffffd66, 0x75b8c289,
+0x84000005, 0xc5840fd2, 0xc5000002, 0xc5d259ea,
+0x245411fa, 0x520ff32c, 0xc52c2454, 0x245411fa,
+0x530ff330, 0xc5302454, 0x89c22cfa, 0x01182484,
+0xeac50000, 0x1824942a, 0x31000001, 0x2ef8c5ff,
+0x40382454, 0x0fc79b0f, 0xdff7f945, 0xfffd11e8,
+0xb8c289ff, 0x0000057c, 0x840fd284, 0x00000270,
+0x442cfac5, 0x84893024, 0x00011824, 0x530ff300,
+0xc5382454, 0xc5c22cfa, 0x249c2ae2, 0x00000118,
+0x18248489, 0xc5000001, 0x24942aea, 0x00000118,
+0xf8c5ff31, 0x0f40da2e, 0x450fc79b, 0xe8dff7f9,
+0xfffffcbe, 0x7eb8c289, 0x84000005, 0x1d840fd2,
+0xc4000002, 0x442cfae1, 0x89483824, 0x01182484,
+0xe1c40000, 0x24942aea, 0x00000118, 0x5411fac5,
+0xff312c24, 0x5410fac5, 0xf8c53824, 0x2c24542e,
+0xc79b0f40, 0xf7f9450f, 0xfc74e8df, 0xc289ffff,
+0x000588b8, 0x0fd28400, 0x0001d384, 0x59eac500,
+0x11fac5d2, 0xc52c2454, 0x245410fa, 0xf3ff3138,
+0x245c510f, 0x2ef8c52c, 0x9b0f40da, 0xf9450fc7,
+0x3be8dff7, 0x89fffffc, 0x059cb8c2, 0xd2840000,
+0x019a840f, 0xf2c50000, 0xfac5d25e, 0x30244c11,
+0x5411fac5, 0xff312c24, 0x0a3a0f66, 0x0b2c2454,
+0x542ef8c5, 0xfac53024, 0x34245411, 0xc79b0f40,
+0xf7f9450f, 0xfbf8e8df, 0xc289ffff, 0x0005a4b8,
+0x0fd28400, 0x00015784, 0x78e98f00, 0x38245482,
+0x5411fac5, 0xff312c24, 0xd257e8c5, 0x542ef8c5,
+0x0f402c24, 0x450fc79b, 0xe8dff7f9, 0xfffffbc2,
+0xabb8c289, 0x84000005, 0x21840fd2, 0xc5000001,
+0x245458f2, 0x5ef2c538, 0x11fac5ca, 0x8f2c244c,
+0x4c8278e9, 0xfac52c24, 0x30244c11, 0xfac5ff31,
+0x2c244c10, 0x4c2ef8c5, 0x0f403024, 0x450fc79b,
+0xe8dff7f9, 0xfffffb7a, 0xb1b8c289, 0x84000005,
+0xd9840fd2, 0xc5000000, 0xe50d10fa, 0xc5000000,
+0x244c59f2, 0x11fac538, 0x662c244c, 0x4c0a3a0f,
+0xc50b2c24, 0x244c11fa, 0x78e98f30, 0x2c244c82,
+0x4c11fac5, 0xff313424, 0x4c10fac5, 0xf2c53024,
+0x34244c58, 0x4c2ef8c5, 0x0f402c24, 0x450fc79b,
+0xe8dff7f9, 0xfffffb1a, 0xbbb8c289, 0x84000005,
+0xc57d74d2, 0x244c10fa, 0x59f2c540, 0xc5382454,
+0x244c59f2, 0x11fac53c, 0xc52c2454, 0x244c11fa,
+0x10fac530, 0xc52c244c, 0x244c5ff2, 0x11fac530,
+0xc534244c, 0x244c10fa, 0x5df2c52c, 0xc530244c,
+0x244c11fa, 0x10fac530, 0xc530244c, 0x244c58f2,
+0xc5ff3134, 0x244c59f2, 0x10fac540, 0xc5382454,
+0x245458ea, 0x2ef8c53c, 0x9b0f40ca, 0xf9450fc7,
+0x9be8dff7, 0x3cfffffa, 0x25c01901, 0x0000063d,
+0x0000c3c9, 0x00000000, 0x00000000, 0x00000000,
+0x3f800000, 0x3e800000, 0x00000000, 0x00000000,
+0x80000000, 0x00000000, 0x00000000, 0x00000000,
+0002640,
+};
+asm(".type xop_x86_64_D_f4, STT_NOTYPE;");
+asm(".type xop_x86_64_D_f4, STT_FUNC;");
+static const unsigned int __attribute__((section(".test, \"ax\", @progbits #"))) xop_x86_64_D_f8[] = {
+0x485500eb, 0x8348e589, 0x8148e0e4, 0x000188ec,
+0x10fbc500, 0x0005f70d, 0x11fbc500, 0xc5c0244c,
+0x244c11fb, 0x11fbc5c8, 0x48d0244c, 0xc024448b,
+0x24448948, 0xc5c031a8, 0x245410fb, 0x2ef9c5c0,
+0xbaa82454, 0x00000000, 0x48c09b0f, 0x48c2450f,
+0xe1c4d8f7, 0xb8e86ef9, 0x00000539, 0xcdd7f9c5,
+0x81c9b60f, 0x0000fff9, 0x94850f00, 0xc5000005,
+0x245410fb, 0x58ebc5a8, 0xc5c02454, 0x245411fb,
+0x10fbc5b0, 0x31c02454, 0x58ebc5c0, 0x2ef9c5d2,
+0x0fb02454, 0x0f48c09b, 0xf748c245, 0xf9e1c4d8,
+0x3fb8f06e, 0xc5000005, 0x0fced7f9, 0xf981c9b6,
+0x000000ff, 0x0549850f, 0xfbc50000, 0xb0245410,
+0x545cebc5, 0xfbc5c024, 0x88245411, 0x24448b48,
+0x44894888, 0x89482824, 0x48b02444, 0xb8244489,
+0xfbc5c031, 0xa8245410, 0x542ef9c5, 0x9b0fb824,
+0x450f48c0, 0xd8f748c2, 0x6ef9e1c4, 0x0544b8f8,
+0xf9c50000, 0xb60fcfd7, 0xfff981c9, 0x0f000000,
+0x0004ee85, 0x10fbc500, 0xc5a82454, 0x245459eb,
+0x11fbc5c0, 0xc5a82454, 0x245410fb, 0x59ebc5c8,
+0x11fbc5d2, 0xc5b02454, 0x245410fb, 0x58ebc5c0,
+0xc5c82454, 0x245411fb, 0x10fbc5b8, 0xc5c02454,
+0x245c5ceb, 0xc5c031c8, 0x245c59e3, 0x10fbc5b8,
+0xc5a82464, 0x24645cdb, 0x2ef9c5b0, 0x11fbc5e3,
+0x0fb8245c, 0x0f48c09b, 0xf748c245, 0xf9e1c4d8,
+0x5bb8e86e, 0xc5000005, 0x0fcdd7f9, 0xf981c9b6,
+0x000000ff, 0x0469850f, 0xebc50000, 0xd0245459,
+0x5411fbc5, 0xc031a824, 0x5410fbc5, 0xebc5c024,
+0xd024545e, 0x542ef9c5, 0xfbc5a824, 0xb0245411,
+0x48c09b0f, 0x48c2450f, 0xe1c4d8f7, 0xb8f06ef9,
+0x00000564, 0xced7f9c5, 0x81c9b60f, 0x0000fff9,
+0x1c850f00, 0xc5000004, 0x31257efa, 0xc5000004,
+0x245410fb, 0xc5c031d0, 0x245c10fb, 0x57e9c5c0,
+0x59ebc5d4, 0xc5a82454, 0xc5dc57e1, 0x0fd32ef9,
+0x0f48c09b, 0xf748c245, 0xf9e1c4d8, 0x67b8f86e,
+0xc5000005, 0x0fcfd7f9, 0xf981c9b6, 0x000000ff,
+0x03cd850f, 0xfbc50000, 0xc024442c, 0xd8244489,
+0x542aebc5, 0xfbc5d824, 0xa8245411, 0xfbc5c031,
+0xa8245410, 0x542ef9c5, 0x9b0fc024, 0x450f48c0,
+0xd8f748c2, 0x6ef9e1c4, 0x056eb8e8, 0xf9c50000,
+0xb60fcdd7, 0xfff981c9, 0x0f000000, 0x00038285,
+0x5a0ff200, 0xf3c02454, 0xf3d2530f, 0xc5d25a0f,
+0x245413f9, 0x5a0ff2a8, 0xf3a82454, 0xf3d2530f,
+0xc5d25a0f, 0x89c22cfb, 0xc5d82444, 0x245c2ae3,
+0x10fbc5d8, 0x31c02454, 0x2ef9c5c0, 0xc09b0fda,
+0xc2450f48, 0xc4d8f748, 0xf06ef9e1, 0x000575b8,
+0xd7f9c500, 0xc9b60fce, 0x00fff981, 0x850f0000,
+0x0000031f, 0xd259ebc5, 0x5411fbc5, 0x0ff2a824,
+0xa824545a, 0xd2520ff3, 0xd25a0ff3, 0x5413f9c5,
+0x0ff2b024, 0xb024545a, 0xd2530ff3, 0xd25a0ff3,
+0xc22cfbc5, 0xd8244489, 0xebc5c031, 0xd824542a,
+0x542ef9c5, 0x9b0fc024, 0x450f48c0, 0xd8f748c2,
+0x6ef9e1c4, 0x057cb8f8, 0xf9c50000, 0xb60fd7d7,
+0xfffa81d2, 0x0f000000, 0x0002b685, 0x2cfbc500,
+0x89b02444, 0xf2d82444, 0x24545a0f, 0x530ff3c0,
+0x5a0ff3d2, 0x2cfbc5d2, 0x24448bd2, 0x245489d8,
+0x24443bd8, 0xc0940fd8, 0x48c0b60f, 0xe1c4d8f7,
+0xb8e86ef9, 0x0000057e, 0xd5d7f9c5, 0x81d2b60f,
+0x0000fffa, 0x68850f00, 0xc4000002, 0x442cfbe1,
+0x8948c024, 0xc4d82444, 0x542aebe1, 0xfbc5d824,
+0xa8245411, 0xfbc5c031, 0xc0245410, 0x542ef9c5,
+0x00baa824, 0x0f000000, 0x0f48c09b, 0xf748c245,
+0xf9e1c4d8, 0x88b8f06e, 0xc5000005, 0x0fced7f9,
+0xf981c9b6, 0x000000ff, 0x0215850f, 0xebc50000,
+0xfbc5d259, 0xa8245411, 0x5410fbc5, 0xc031c024,
+0x5c510ff2, 0xf9c5a824, 0x9b0fda2e, 0x450f48c0,
+0xd8f748c2, 0x6ef9e1c4, 0x059cb8f8, 0xf9c50000,
+0xb60fcfd7, 0xfff981c9, 0x0f000000, 0x0001d285,
+0x5ef3c500, 0x11fbc5d2, 0xc5b0244c, 0x245411fb,
+0x66c031a8, 0x540b3a0f, 0xc50ba824, 0x24542ef9,
+0x11fbc5b0, 0x0fb82454, 0x0f48c09b, 0xf748c245,
+0xf9e1c4d8, 0xa4b8e06e, 0xc5000005, 0x0fccd7f9,
+0xf981c9b6, 0x000000ff, 0x0185850f, 0xe98f0000,
+0x24548378, 0x13f9c5c0, 0x31a82454, 0x57e9c5c0,
+0x2ef9c5d2, 0x0fa82454, 0x0f48c09b, 0xf748c245,
+0xf9e1c4d8, 0xabb8e86e, 0xc5000005, 0x0fcdd7f9,
+0xf981c9b6, 0x000000ff, 0x0145850f, 0xf3c50000,
+0xc0245458, 0xca5ef3c5, 0x4c11fbc5, 0xe98fa824,
+0x244c8378, 0x13f9c5a8, 0x31b0244c, 0x10fbc5c0,
+0xc5a8244c, 0x244c2ef9, 0xc09b0fb0, 0xc2450f48,
+0xc4d8f748, 0xf06ef9e1, 0x0005b1b8, 0xd7f9c500,
+0xc9b60fce, 0x00fff981, 0x850f0000, 0x000000f3,
+0x0d10fbc5, 0x00000100, 0x4c59f3c5, 0xfbc5c024,
+0xa8244c11, 0x0b3a0f66, 0x0ba8244c, 0x4c13f9c5,
+0xe98fb024, 0x244c8378, 0x13f9c5a8, 0x31b8244c,
+0x10fbc5c0, 0xc5b0244c, 0x244c58f3, 0x2ef9c5b8,
+0x0fa8244c, 0x0f48c09b, 0xf748c245, 0xf9e1c4d8,
+0xbbb8f86e, 0xc5000005, 0x0fcfd7f9, 0xf981c9b6,
+0x000000ff, 0x0089850f, 0xfbc50000, 0xd0244c10,
+0x5459f3c5, 0xf3c5c024, 0xc8244c59, 0x5411fbc5,
+0xfbc5a824, 0xb0244c11, 0x4c10fbc5, 0xf3c5a824,
+0xb0244c5f, 0x4c11fbc5, 0xfbc5b824, 0xa8244c10,
+0x4c5df3c5, 0xfbc5b024, 0xb0244c11, 0x4c10fbc5,
+0xf3c5b024, 0xb8244c58, 0xf3c5c031, 0xd0244c59,
+0x5410fbc5, 0xebc5c024, 0xc8245458, 0xca2ef9c5,
+0x48c09b0f, 0x48c2450f, 0xe1c4d8f7, 0xc5e06ef9,
+0x0fc4d7f9, 0xff3dc0b6, 0xb8000000, 0x0000063d,
+0xc9c2440f, 0x000000c3, 0x00000000, 0x00000000,
+0x00000000, 0x3ff00000, 0x00000000, 0x3fd00000,
+0x00000000, 0x80000000, 0x00000000, 0x00000000,
+0003060,
+};
+asm(".type xop_x86_64_D_f8, STT_NOTYPE;");
+asm(".type xop_x86_64_D_f8, STT_FUNC;");
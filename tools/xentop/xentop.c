@@ -139,6 +139,7 @@ static void do_domain(xenstat_domain *);
 static void do_vcpu(xenstat_domain *);
 static void do_network(xenstat_domain *);
 static void do_vbd(xenstat_domain *);
+static void do_exits(xenstat_domain *);
 static void top(void);
 
 /* Field types */
@@ -212,6 +213,7 @@ unsigned int iterations = 0;
 int show_vcpus = 0;
 int show_networks = 0;
 int show_vbds = 0;
+int show_exits = 0;
 int repeat_header = 0;
 int show_full_name = 0;
 int dom0_first = 0;
@@ -241,6 +243,7 @@ static void usage(const char *program)
            "-x, --vbds           output vbd block device data\n"
            "-r, --repeat-header  repeat table header before each domain\n"
            "-v, --vcpus          output vcpu data\n"
+           "-e, --exits          output VM exit and hypercall rates\n"
            "-b, --batch          output in batch mode, no user input accepted\n"
            "-p, --pcpus          show physical CPU stats\n"
            "-i, --iterations     number of iterations before exiting\n"
@@ -404,6 +407,9 @@ static int handle_key(int ch)
 		case 'v': case 'V':
 			show_vcpus ^= 1;
 			break;
+		case 'e': case 'E':
+			show_exits ^= 1;
+			break;
 		case KEY_DOWN:
 			first_domain_index++;
 			break;
@@ -1071,6 +1077,11 @@ void do_bottom_line(void)
 		attr_addstr(show_vcpus ? COLOR_PAIR(1) : 0, "CPUs");
 		addstr("  ");
 
+		/* exits */
+		addch(A_REVERSE | 'E');
+		attr_addstr(show_exits ? COLOR_PAIR(1) : 0, "xits");
+		addstr("  ");
+
 		/* repeat */
 		addch(A_REVERSE | 'R');
 		attr_addstr(repeat_header ? COLOR_PAIR(1) : 0, "epeat header");
@@ -1204,6 +1215,90 @@ void do_vbd(xenstat_domain *domain)
 	}
 }
 
+/*
+ * Find the total rate and the most frequent of the events counted by get()
+ * since the previous sample.
+ */
+static double event_rate(xenstat_domain *domain, xenstat_domain *old_domain,
+			 unsigned int num,
+			 unsigned long long (*get)(xenstat_domain *,
+						   unsigned int),
+			 unsigned int *top, double *top_pct)
+{
+	unsigned long long delta, total = 0, top_delta = 0;
+	double s_elapsed;
+	unsigned int i;
+
+	*top = 0;
+	*top_pct = 0.0;
+
+	for (i = 0; i < num; i++) {
+		delta = get(domain, i) - get(old_domain, i);
+		total += delta;
+		if (delta > top_delta) {
+			top_delta = delta;
+			*top = i;
+		}
+	}
+
+	if (total == 0)
+		return 0.0;
+
+	*top_pct = 100.0 * top_delta / total;
+	s_elapsed = (curtime.tv_sec - oldtime.tv_sec)
+		    + (curtime.tv_usec - oldtime.tv_usec) / 1000000.0;
+
+	return s_elapsed > 0 ? total / s_elapsed : 0.0;
+}
+
+/* Output VM exit and hypercall rates */
+void do_exits(xenstat_domain *domain)
+{
+	xenstat_domain *old_domain = NULL;
+	unsigned int top;
+	double rate, pct;
+	const char *name;
+	char unknown[16];
+
+	if (prev_node != NULL)
+		old_domain = xenstat_node_domain(prev_node,
+						 xenstat_domain_id(domain));
+	if (old_domain == NULL) {
+		print("Exits: -\n");
+		return;
+	}
+
+	if (xenstat_domain_num_exits(domain)) {
+		rate = event_rate(domain, old_domain,
+				  xenstat_domain_num_exits(domain),
+				  xenstat_domain_exits, &top, &pct);
+		name = xenstat_domain_exit_name(domain, top);
+		if (name == NULL) {
+			snprintf(unknown, sizeof(unknown), "#%u", top);
+			name = unknown;
+		}
+		if (rate > 0)
+			print("Exits: %10.0f/s top: %s (%3.0f%%)   ",
+			      rate, name, pct);
+		else
+			print("Exits: %10.0f/s   ", rate);
+	}
+
+	rate = event_rate(domain, old_domain,
+			  xenstat_domain_num_hypercalls(domain),
+			  xenstat_domain_hypercalls, &top, &pct);
+	name = xenstat_hypercall_name(top);
+	if (name == NULL) {
+		snprintf(unknown, sizeof(unknown), "#%u", top);
+		name = unknown;
+	}
+	if (rate > 0)
+		print("Hypercalls: %10.0f/s top: %s (%3.0f%%)\n",
+		      rate, name, pct);
+	else
+		print("Hypercalls: %10.0f/s\n", rate);
+}
+
 static void top(void)
 {
 	xenstat_domain **domains;
@@ -1270,6 +1365,8 @@ static void top(void)
 		do_domain(domains[i]);
 		if (show_vcpus)
 			do_vcpu(domains[i]);
+		if (show_exits)
+			do_exits(domains[i]);
 		if (show_networks)
 			do_network(domains[i]);
 		if (show_vbds)
@@ -1309,6 +1406,7 @@ int main(int argc, char **argv)
 		{ "vbds",          no_argument,       NULL, 'x' },
 		{ "repeat-header", no_argument,       NULL, 'r' },
 		{ "vcpus",         no_argument,       NULL, 'v' },
+		{ "exits",         no_argument,       NULL, 'e' },
 		{ "delay",         required_argument, NULL, 'd' },
 		{ "batch",         no_argument,	      NULL, 'b' },
 		{ "pcpus",         no_argument,       NULL, 'p' },
@@ -1317,7 +1415,7 @@ int main(int argc, char **argv)
 		{ "dom0-first",    no_argument,       NULL, 'z' },
 		{ 0, 0, 0, 0 },
 	};
-	const char *sopts = "hVnxrvd:bpi:fz";
+	const char *sopts = "hVnxrved:bpi:fz";
 
 	if (atexit(cleanup) != 0)
 		fail("Failed to install cleanup handler.\n");
@@ -1346,6 +1444,9 @@ int main(int argc, char **argv)
 		case 'v':
 			show_vcpus = 1;
 			break;
+		case 'e':
+			show_exits = 1;
+			break;
 		case 'd':
 			delay = atoi(optarg);
 			break;
@@ -1,6 +1,8 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <strings.h>
+#include <stdint.h>
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <sys/mman.h>
@@ -27,6 +29,40 @@ mread_handle_t mread_init(int fd)
     fstat(fd, &s);
     h->file_size = s.st_size;
 
+    /*
+     * Map the whole file if the address space allows it.  This avoids
+     * thrashing the window cache below when records from many pcpus are
+     * interleaved, and makes mread64() safe to call from several threads.
+     */
+    if ( h->file_size > 0 && (uintmax_t)h->file_size <= SIZE_MAX )
+    {
+        void *p = mmap(NULL, h->file_size, PROT_READ, MAP_SHARED, fd, 0);
+
+        if ( p != MAP_FAILED )
+            h->whole = p;
+    }
+
+    return h;
+}
+
+mread_handle_t mread_init_mem(const void *buf, off_t size)
+{
+    mread_handle_t h;
+
+    h=malloc(sizeof(struct mread_ctrl));
+
+    if (!h)
+    {
+        perror("malloc");
+        exit(1);
+    }
+
+    bzero(h, sizeof(struct mread_ctrl));
+
+    h->fd = -1;
+    h->file_size = size;
+    h->whole = buf;
+
     return h;
 }
 
@@ -66,6 +102,12 @@ ssize_t mread64(mread_handle_t h, void *rec, ssize_t len, off_t offset)
         len = h->file_size - offset;
     }
 
+    if ( h->whole )
+    {
+        memcpy(rec, h->whole + offset, len);
+        return len;
+    }
+
     /* Try to find the offset in our range */
     dprintf(warn, " Trying last, %d\n", last);
     if ( h->map[h->last].buffer
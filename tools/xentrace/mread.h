@@ -6,6 +6,8 @@
 typedef struct mread_ctrl {
     int fd;
     off_t file_size;
+    /* The whole file, if it could be mapped; the windows below are unused. */
+    const char *whole;
     struct mread_buffer {
         char * buffer;
         off_t start_offset;
@@ -15,4 +17,6 @@ typedef struct mread_ctrl {
 } *mread_handle_t;
 
 mread_handle_t mread_init(int fd);
+/* Read from @buf rather than a file. */
+mread_handle_t mread_init_mem(const void *buf, off_t size);
 ssize_t mread64(mread_handle_t h, void *dst, ssize_t len, off_t offset);
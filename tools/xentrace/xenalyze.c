@@ -30,10 +30,12 @@
 #include <sys/stat.h>
 #include <fcntl.h>
 #include <unistd.h>
+#include <pthread.h>
 #include <xen/trace.h>
 #include "analyze.h"
 #include "mread.h"
 #include "pv.h"
+#include "xtc.h"
 #include <errno.h>
 #include <strings.h>
 #include <string.h>
@@ -181,6 +183,7 @@ struct {
         summary:1,
         report_pcpu:1,
         tsc_loop_fatal:1,
+        serial_read:1,
         summary_info;
     long long cpu_qhz, cpu_hz;
     int scatterplot_interrupt_vector;
@@ -192,6 +195,12 @@ struct {
     int default_guest_paging_levels;
     int sample_size, sample_max;
     enum error_level tolerance; /* Tolerate up to this level of error */
+    /* Subset of a compressed trace to read */
+    struct {
+        bool pcpus_set, window_set;
+        bool *pcpus; /* MAX_CPUS entries */
+        double start, end; /* seconds; end < 0 means no end */
+    } select;
     struct {
         tsc_t cycles;
         /* Used if interval is specified in seconds to delay calculating
@@ -1824,6 +1833,7 @@ struct pcpu_info {
     tsc_t first_tsc, last_tsc, order_tsc;
     off_t file_offset;
     off_t next_cpu_change_offset;
+    struct pcpu_reader *reader;
     struct record_info ri;
     int last_cpu_change_pid;
     int power_state;
@@ -9744,6 +9754,260 @@ void __fill_in_record_info(struct pcpu_info *p)
     ri->cpu = p->pid;
 }
 
+/*
+ * Per-pcpu reader threads.
+ *
+ * The records a pcpu reads depend only on the file: starting from where it
+ * was activated, each record is followed by the next one, except that a
+ * cpu_change record for another pcpu is followed by the end of its window.
+ * So while the main thread processes records in tsc order, one thread per
+ * pcpu walks that chain ahead of it, faulting in the file and decoding the
+ * records into a ring.  read_record() then takes records from the ring.
+ *
+ * This needs the whole file mapped by mread, as the window cache is not
+ * thread-safe.  If the main thread asks for an offset the reader did not
+ * produce (e.g. a pcpu re-activated elsewhere), the reader is restarted.
+ */
+#define READER_RING 1024
+#define READER_CACHELINE 64
+
+struct reader_entry {
+    off_t offset;
+    ssize_t size; /* 0: end of this pcpu's records */
+    struct trace_record rec;
+};
+
+struct pcpu_reader {
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    int pid;
+    off_t start;
+    bool stop;
+
+    /*
+     * Free-running ring indices.  Each side keeps its own copy of the other
+     * side's index, and only re-reads the shared one when the ring looks
+     * full or empty, so the two threads don't share a cacheline per record.
+     */
+    struct {
+        unsigned int prod, cons_seen;
+        bool waiting;
+    } producer __attribute__((aligned(READER_CACHELINE)));
+    struct {
+        unsigned int cons, prod_seen;
+        bool waiting;
+    } consumer __attribute__((aligned(READER_CACHELINE)));
+
+    struct reader_entry ring[READER_RING];
+};
+
+/*
+ * Sleep until the ring has room (producer) or a record (consumer).  The
+ * waiting flag is set before re-checking the indices, and the other side
+ * updates its index before checking the flag, so a wakeup can't be missed.
+ */
+static bool reader_wait(struct pcpu_reader *r, bool producer)
+{
+    bool *waiting = producer ? &r->producer.waiting : &r->consumer.waiting;
+    bool ok;
+
+    pthread_mutex_lock(&r->lock);
+    __atomic_store_n(waiting, true, __ATOMIC_SEQ_CST);
+    for ( ; ; )
+    {
+        unsigned int used =
+            __atomic_load_n(&r->producer.prod, __ATOMIC_SEQ_CST) -
+            __atomic_load_n(&r->consumer.cons, __ATOMIC_SEQ_CST);
+
+        /* A full ring is only refilled once half of it has been consumed. */
+        ok = producer ? used <= READER_RING / 2 : used > 0;
+        if ( ok || __atomic_load_n(&r->stop, __ATOMIC_SEQ_CST) )
+            break;
+        pthread_cond_wait(&r->cond, &r->lock);
+    }
+    __atomic_store_n(waiting, false, __ATOMIC_SEQ_CST);
+    pthread_mutex_unlock(&r->lock);
+
+    return ok;
+}
+
+static void reader_kick(struct pcpu_reader *r)
+{
+    pthread_mutex_lock(&r->lock);
+    pthread_cond_signal(&r->cond);
+    pthread_mutex_unlock(&r->lock);
+}
+
+static void *reader_thread(void *arg)
+{
+    struct pcpu_reader *r = arg;
+    off_t offset = r->start;
+    unsigned int prod = r->producer.prod;
+
+    for ( ; ; )
+    {
+        struct reader_entry *e;
+        ssize_t size = 0;
+
+        if ( prod - r->producer.cons_seen == READER_RING )
+        {
+            r->producer.cons_seen =
+                __atomic_load_n(&r->consumer.cons, __ATOMIC_ACQUIRE);
+            if ( prod - r->producer.cons_seen == READER_RING )
+            {
+                if ( !reader_wait(r, true) )
+                    break;
+                r->producer.cons_seen =
+                    __atomic_load_n(&r->consumer.cons, __ATOMIC_ACQUIRE);
+            }
+        }
+
+        e = &r->ring[prod % READER_RING];
+        e->offset = offset;
+
+        if ( offset < G.file_size &&
+             mread64(G.mh, &e->rec, sizeof(e->rec), offset) >=
+             sizeof(uint32_t) )
+        {
+            size = get_rec_size(&e->rec);
+            if ( offset + size > G.file_size )
+                size = 0;
+        }
+        e->size = size;
+
+        __atomic_store_n(&r->producer.prod, ++prod, __ATOMIC_SEQ_CST);
+        if ( __atomic_load_n(&r->consumer.waiting, __ATOMIC_SEQ_CST) )
+            reader_kick(r);
+
+        if ( !size )
+            break;
+
+        offset += size;
+        if ( e->rec.event == TRC_TRACE_CPU_CHANGE && !e->rec.cycle_flag )
+        {
+            struct cpu_change_data *cd = (typeof(cd))e->rec.u.notsc.data;
+
+            if ( cd->cpu != r->pid )
+                offset += cd->window_size;
+        }
+    }
+
+    return NULL;
+}
+
+static void reader_start(struct pcpu_info *p)
+{
+    struct pcpu_reader *r = calloc(1, sizeof(*r));
+
+    if ( !r )
+        return;
+
+    pthread_mutex_init(&r->lock, NULL);
+    pthread_cond_init(&r->cond, NULL);
+    r->pid = p->pid;
+    r->start = p->file_offset;
+
+    if ( pthread_create(&r->thread, NULL, reader_thread, r) )
+    {
+        fprintf(warn, "%s: pthread_create failed for pcpu %d, reading serially\n",
+                __func__, p->pid);
+        free(r);
+        opt.serial_read = 1;
+        return;
+    }
+
+    p->reader = r;
+}
+
+static void reader_stop(struct pcpu_info *p)
+{
+    struct pcpu_reader *r = p->reader;
+
+    __atomic_store_n(&r->stop, true, __ATOMIC_SEQ_CST);
+    reader_kick(r);
+    pthread_join(r->thread, NULL);
+
+    pthread_cond_destroy(&r->cond);
+    pthread_mutex_destroy(&r->lock);
+    free(r);
+    p->reader = NULL;
+}
+
+static void reader_consume(struct pcpu_reader *r)
+{
+    unsigned int cons = r->consumer.cons + 1;
+
+    __atomic_store_n(&r->consumer.cons, cons, __ATOMIC_SEQ_CST);
+    if ( __atomic_load_n(&r->producer.waiting, __ATOMIC_SEQ_CST) &&
+         __atomic_load_n(&r->producer.prod, __ATOMIC_ACQUIRE) - cons <=
+         READER_RING / 2 )
+        reader_kick(r);
+}
+
+/* Returns the size of the record at p->file_offset, or -1 to read it directly. */
+static ssize_t reader_get(struct pcpu_info *p, struct trace_record *rec)
+{
+    if ( p->reader && p->reader->start > p->file_offset )
+        reader_stop(p);
+
+    if ( !p->reader )
+    {
+        reader_start(p);
+        if ( !p->reader )
+            return -1;
+    }
+
+    for ( ; ; )
+    {
+        struct pcpu_reader *r = p->reader;
+        unsigned int cons = r->consumer.cons;
+        const struct reader_entry *e;
+        ssize_t size;
+
+        if ( r->consumer.prod_seen == cons )
+        {
+            r->consumer.prod_seen =
+                __atomic_load_n(&r->producer.prod, __ATOMIC_ACQUIRE);
+            if ( r->consumer.prod_seen == cons )
+            {
+                reader_wait(r, false);
+                r->consumer.prod_seen =
+                    __atomic_load_n(&r->producer.prod, __ATOMIC_ACQUIRE);
+            }
+        }
+
+        e = &r->ring[cons % READER_RING];
+
+        if ( e->offset < p->file_offset && e->size )
+        {
+            /* Records handed over directly on activation. */
+            reader_consume(r);
+            continue;
+        }
+
+        if ( e->offset != p->file_offset )
+        {
+            /* Not on this reader's chain: start again from here. */
+            reader_stop(p);
+            reader_start(p);
+            if ( !p->reader )
+                return -1;
+            continue;
+        }
+
+        if ( !e->size )
+            /* Let __read_record() report why. */
+            return -1;
+
+        size = e->size;
+        *rec = e->rec;
+        reader_consume(r);
+
+        return size;
+    }
+}
+
 ssize_t read_record(struct pcpu_info * p) {
     off_t * offset;
     struct record_info *ri;
@@ -9751,7 +10015,11 @@ ssize_t read_record(struct pcpu_info * p) {
     offset = &p->file_offset;
     ri = &p->ri;
 
-    ri->size = __read_record(&ri->rec, *offset);
+    ri->size = -1;
+    if ( !opt.serial_read )
+        ri->size = reader_get(p, &ri->rec);
+    if ( ri->size < 0 )
+        ri->size = __read_record(&ri->rec, *offset);
     if(ri->size)
     {
         __fill_in_record_info(p);
@@ -10140,6 +10408,9 @@ enum {
     OPT_PROGRESS,
     OPT_TOLERANCE,
     OPT_TSC_LOOP_FATAL,
+    OPT_SERIAL_READ,
+    OPT_PCPUS,
+    OPT_TIME_WINDOW,
     /* Specific letters */
     OPT_DUMP_ALL='a',
     OPT_INTERVAL_LENGTH='i',
@@ -10620,6 +10891,66 @@ error_t cmd_parser(int key, char *arg, struct argp_state *state)
         opt.tsc_loop_fatal = 1;
         break;
 
+    case OPT_SERIAL_READ:
+        opt.serial_read = 1;
+        break;
+
+    case OPT_PCPUS:
+    {
+        char *p = arg, *q;
+
+        opt.select.pcpus_set = 1;
+        if ( !opt.select.pcpus &&
+             !(opt.select.pcpus = calloc(MAX_CPUS, sizeof(bool))) )
+        {
+            perror("calloc");
+            exit(1);
+        }
+        do {
+            unsigned long a, b;
+
+            a = b = strtoul(p, &q, 0);
+            if ( q != p && *q == '-' )
+            {
+                p = q + 1;
+                b = strtoul(p, &q, 0);
+            }
+            if ( q == p || (*q && *q != ',') || a > b || b >= MAX_CPUS )
+            {
+                fprintf(stderr, "Invalid pcpu list %s\n", arg);
+                argp_usage(state);
+            }
+            while ( a <= b )
+                opt.select.pcpus[a++] = 1;
+            p = q + 1;
+        } while ( *q );
+        break;
+    }
+
+    case OPT_TIME_WINDOW:
+    {
+        char *q;
+
+        opt.select.window_set = 1;
+        opt.select.start = strtod(arg, &q);
+        opt.select.end = -1;
+        if ( q != arg && *q == ':' )
+        {
+            char *e = q + 1;
+
+            opt.select.end = strtod(e, &q);
+            if ( q == e )
+                q = arg;
+        }
+        if ( q == arg || *q || opt.select.start < 0 ||
+             (opt.select.end >= 0 && opt.select.end < opt.select.start) )
+        {
+            fprintf(stderr, "Invalid time window %s\n", arg);
+            argp_usage(state);
+        }
+        break;
+    }
+
     case ARGP_KEY_ARG:
     {
         /* FIXME - strcpy */
@@ -10904,6 +11235,20 @@ const struct argp_option cmd_opts[] =  {
       .key = OPT_TSC_LOOP_FATAL,
       .doc = "Stop processing and exit if tsc skew tracking detects a dependency loop.", },
 
+    { .name = "pcpus",
+      .key = OPT_PCPUS,
+      .arg = "LIST",
+      .doc = "Only read these pcpus (e.g. 0,4-7) from a compressed trace.", },
+
+    { .name = "time-window",
+      .key = OPT_TIME_WINDOW,
+      .arg = "START[:END]",
+      .doc = "Only read chunks of a compressed trace overlapping this window, in seconds from the start of the trace.  Uses --cpu-hz.", },
+
+    { .name = "serial-read",
+      .key = OPT_SERIAL_READ,
+      .doc = "Read all pcpus' records on the main thread, rather than in one reader thread per pcpu.", },
+
     { .name = "tolerance",
       .key = OPT_TOLERANCE,
       .arg = "errlevel",
@@ -10920,6 +11265,318 @@ const struct argp parser_def = {
     .doc = "",
 };
 
+/*
+ * Compressed traces (xentrace -z).  The chunks selected by --pcpus and
+ * --time-window are decompressed, in order of their first tsc, into a
+ * buffer which is then read like a plain trace.  Only the
+ * selected chunks are read from the file.
+ */
+struct xtc_load {
+    int fd;
+    uint32_t codec;
+    struct xtc_index_entry *index;
+    unsigned int nr;
+    char *buf;
+    size_t *dst;
+    unsigned int next;
+};
+
+static int xtc_read_index(struct xtc_load *l, off_t file_size)
+{
+    struct xtc_trailer t;
+    off_t off;
+    unsigned int alloc = 0;
+
+    if ( file_size >= sizeof(struct xtc_file_header) + sizeof(t) &&
+         pread(l->fd, &t, sizeof(t), file_size - sizeof(t)) == sizeof(t) &&
+         t.magic == XTC_TRAILER_MAGIC &&
+         t.index_offset + (off_t)t.nr_entries * sizeof(*l->index) + sizeof(t)
+         == file_size )
+    {
+        size_t size = (size_t)t.nr_entries * sizeof(*l->index);
+
+        l->nr = t.nr_entries;
+        l->index = malloc(size ?: 1);
+        if ( !l->index ||
+             pread(l->fd, l->index, size, t.index_offset) != size )
+            return -1;
+        return 0;
+    }
+
+    /* No index; xentrace didn't exit cleanly.  Walk the chunk headers. */
+    fprintf(warn, "%s: no chunk index, scanning chunk headers\n", __func__);
+
+    for ( off = sizeof(struct xtc_file_header); ; )
+    {
+        struct xtc_chunk_header h;
+        struct xtc_index_entry *e;
+
+        if ( pread(l->fd, &h, sizeof(h), off) != sizeof(h) ||
+             h.magic != XTC_CHUNK_MAGIC ||
+             off + sizeof(h) + h.comp_size > file_size )
+            break;
+
+        if ( l->nr == alloc )
+        {
+            alloc = alloc ? alloc * 2 : 1024;
+            l->index = realloc(l->index, alloc * sizeof(*l->index));
+            if ( !l->index )
+                return -1;
+        }
+
+        e = &l->index[l->nr++];
+        e->offset = off;
+        e->first_tsc = h.first_tsc;
+        e->last_tsc = h.last_tsc;
+        e->cpu = h.cpu;
+        e->raw_size = h.raw_size;
+
+        off += sizeof(h) + h.comp_size;
+    }
+
+    return 0;
+}
+
+static int xtc_entry_cmp(const void *a, const void *b)
+{
+    const struct xtc_index_entry *x = a, *y = b;
+
+    if ( x->first_tsc != y->first_tsc )
+        return x->first_tsc < y->first_tsc ? -1 : 1;
+    if ( x->cpu != y->cpu )
+        return x->cpu < y->cpu ? -1 : 1;
+    return x->offset < y->offset ? -1 : x->offset > y->offset;
+}
+
+static void *xtc_decompress_thread(void *arg)
+{
+    struct xtc_load *l = arg;
+    unsigned int i;
+
+    while ( (i = __atomic_fetch_add(&l->next, 1, __ATOMIC_RELAXED)) < l->nr )
+    {
+        const struct xtc_index_entry *e = &l->index[i];
+        struct xtc_chunk_header h;
+        void *comp;
+
+        if ( pread(l->fd, &h, sizeof(h), e->offset) != sizeof(h) ||
+             h.magic != XTC_CHUNK_MAGIC || h.raw_size != e->raw_size ||
+             !(comp = malloc(h.comp_size ?: 1)) )
+            goto fail;
+
+        if ( pread(l->fd, comp, h.comp_size, e->offset + sizeof(h)) !=
+             h.comp_size ||
+             xtc_decompress(l->codec, l->buf + l->dst[i], h.raw_size,
+                            comp, h.comp_size) )
+        {
+            free(comp);
+            goto fail;
+        }
+
+        free(comp);
+    }
+
+    return NULL;
+
+ fail:
+    fprintf(stderr, "%s: bad chunk at offset %llx\n", __func__,
+            (unsigned long long)l->index[i].offset);
+    error(ERR_SYSTEM, NULL);
+    return NULL;
+}
+
+/*
+ * A chunk holds many consecutive windows of one pcpu.  xenalyze only starts
+ * reading a pcpu once it finds that pcpu's first window, so concatenating
+ * whole chunks would leave most pcpus inactive for a chunk's worth of time.
+ * Instead, lay the windows out in tsc order, as xentrace would have written
+ * them.
+ */
+struct xtc_window {
+    uint64_t tsc;
+    size_t offset, size;
+    unsigned int seq;
+};
+
+static int xtc_window_cmp(const void *a, const void *b)
+{
+    const struct xtc_window *x = a, *y = b;
+
+    if ( x->tsc != y->tsc )
+        return x->tsc < y->tsc ? -1 : 1;
+    return x->seq < y->seq ? -1 : x->seq > y->seq;
+}
+
+static char *xtc_interleave(const char *raw, size_t total)
+{
+    const size_t hdr = sizeof(uint32_t) + sizeof(struct cpu_change_data);
+    struct xtc_window *w = NULL;
+    uint64_t last_tsc[MAX_CPUS] = { 0 };
+    unsigned int nr = 0, alloc = 0, i;
+    size_t off = 0;
+    char *out;
+
+    while ( off + hdr <= total )
+    {
+        struct trace_record rec;
+        const struct cpu_change_data *cd = (typeof(cd))rec.u.notsc.data;
+        uint64_t first, last;
+        size_t size;
+
+        memcpy(&rec, raw + off, hdr);
+        if ( rec.event != TRC_TRACE_CPU_CHANGE || rec.cycle_flag ||
+             cd->cpu >= MAX_CPUS )
+            break;
+        size = hdr + cd->window_size;
+        if ( off + size > total )
+            size = total - off;
+
+        if ( nr == alloc )
+        {
+            alloc = alloc ? alloc * 2 : 4096;
+            w = realloc(w, alloc * sizeof(*w));
+            if ( !w )
+                return NULL;
+        }
+
+        /* Keep each pcpu's windows in order, even without a tsc. */
+        xtc_scan_tsc(raw + off + hdr, size - hdr, &first, &last);
+        if ( first < last_tsc[cd->cpu] )
+            first = last_tsc[cd->cpu];
+        last_tsc[cd->cpu] = last > first ? last : first;
+
+        w[nr].tsc = first;
+        w[nr].offset = off;
+        w[nr].size = size;
+        w[nr].seq = nr;
+        nr++;
+
+        off += size;
+    }
+
+    if ( off != total )
+        fprintf(warn, "%s: chunks don't hold whole windows, keeping chunk order\n",
+                __func__);
+
+    out = off == total ? malloc(total ?: 1) : NULL;
+    if ( !out )
+    {
+        free(w);
+        return NULL;
+    }
+
+    qsort(w, nr, sizeof(*w), xtc_window_cmp);
+    for ( i = 0, off = 0; i < nr; off += w[i].size, i++ )
+        memcpy(out + off, raw + w[i].offset, w[i].size);
+
+    free(w);
+
+    return out;
+}
+
+static void xtc_open(int fd, off_t file_size)
+{
+    struct xtc_load l = { .fd = fd };
+    struct xtc_file_header hdr;
+    uint64_t base_tsc = 0, start_tsc = 0, end_tsc = UINT64_MAX;
+    unsigned int i, n, nr_threads;
+    size_t total = 0;
+    pthread_t threads[8];
+
+    if ( pread(fd, &hdr, sizeof(hdr), 0) != sizeof(hdr) ||
+         hdr.version != 1 )
+    {
+        fprintf(stderr, "%s: unsupported compressed trace\n", __func__);
+        error(ERR_SYSTEM, NULL);
+    }
+    l.codec = hdr.codec;
+
+    if ( xtc_read_index(&l, file_size) )
+    {
+        perror("reading chunk index");
+        error(ERR_SYSTEM, NULL);
+    }
+
+    for ( i = 0; i < l.nr; i++ )
+        if ( l.index[i].first_tsc &&
+             (!base_tsc || l.index[i].first_tsc < base_tsc) )
+            base_tsc = l.index[i].first_tsc;
+
+    if ( opt.select.window_set )
+    {
+        start_tsc = base_tsc + opt.select.start * opt.cpu_hz;
+        if ( opt.select.end >= 0 )
+            end_tsc = base_tsc + opt.select.end * opt.cpu_hz;
+    }
+
+    /* Keep only the selected chunks. */
+    for ( i = n = 0; i < l.nr; i++ )
+    {
+        const struct xtc_index_entry *e = &l.index[i];
+
+        if ( e->cpu >= MAX_CPUS ||
+             (opt.select.pcpus_set && !opt.select.pcpus[e->cpu]) )
+            continue;
+        if ( opt.select.window_set &&
+             (!e->first_tsc || e->last_tsc < start_tsc ||
+              e->first_tsc > end_tsc) )
+            continue;
+        l.index[n++] = *e;
+    }
+
+    fprintf(warn, "%s: %s trace, reading %u of %u chunks\n", __func__,
+            xtc_codec_name(l.codec), n, l.nr);
+    l.nr = n;
+
+    qsort(l.index, l.nr, sizeof(*l.index), xtc_entry_cmp);
+
+    l.dst = malloc((l.nr ?: 1) * sizeof(*l.dst));
+    if ( !l.dst )
+    {
+        perror("malloc");
+        error(ERR_SYSTEM, NULL);
+    }
+    for ( i = 0; i < l.nr; i++ )
+    {
+        l.dst[i] = total;
+        total += l.index[i].raw_size;
+    }
+
+    l.buf = malloc(total ?: 1);
+    if ( !l.buf )
+    {
+        perror("malloc");
+        error(ERR_SYSTEM, NULL);
+    }
+
+    nr_threads = sysconf(_SC_NPROCESSORS_ONLN);
+    if ( nr_threads > sizeof(threads) / sizeof(threads[0]) )
+        nr_threads = sizeof(threads) / sizeof(threads[0]);
+    for ( n = 0; n < nr_threads; n++ )
+        if ( pthread_create(&threads[n], NULL, xtc_decompress_thread, &l) )
+            break;
+    if ( !n )
+        xtc_decompress_thread(&l);
+    for ( i = 0; i < n; i++ )
+        pthread_join(threads[i], NULL);
+
+    free(l.dst);
+    free(l.index);
+
+    {
+        char *out = xtc_interleave(l.buf, total);
+
+        if ( out )
+        {
+            free(l.buf);
+            l.buf = out;
+        }
+    }
+
+    G.mh = mread_init_mem(l.buf, total);
+    G.file_size = total;
+}
+
 int main(int argc, char *argv[]) {
     /* Start with warn at stderr. */
     warn = stderr;
@@ -10938,8 +11595,23 @@ int main(int argc, char *argv[]) {
         G.file_size = s.st_size;
     }
 
-    if ( (G.mh = mread_init(G.fd)) == NULL )
+    {
+        char magic[sizeof(XTC_MAGIC) - 1];
+
+        if ( pread(G.fd, magic, sizeof(magic), 0) == sizeof(magic) &&
+             !memcmp(magic, XTC_MAGIC, sizeof(magic)) )
+            xtc_open(G.fd, G.file_size);
+        else if ( opt.select.pcpus_set || opt.select.window_set )
+        {
+            fprintf(stderr, "--pcpus and --time-window need a compressed trace (xentrace -z)\n");
+            exit(1);
+        }
+    }
+
+    if ( !G.mh && (G.mh = mread_init(G.fd)) == NULL )
         perror("mread");
+    else if ( !G.mh->whole || sysconf(_SC_NPROCESSORS_ONLN) < 2 )
+        opt.serial_read = 1;
 
     if (G.symbol_file != NULL)
         parse_symbol_file(G.symbol_file);
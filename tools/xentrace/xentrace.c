@@ -25,6 +25,8 @@
 #include <assert.h>
 #include <ctype.h>
 #include <poll.h>
+#include <pthread.h>
+#include <stdbool.h>
 #include <sys/statvfs.h>
 
 #include <xen/xen.h>
@@ -34,6 +36,9 @@
 #include <xenevtchn.h>
 #include <xenctrl.h>
 
+#include "xtagg.h"
+#include "xtc.h"
+
 #define PERROR(_m, _a...)                                       \
 do {                                                            \
     int __saved_errno = errno;                                  \
@@ -49,6 +54,10 @@ do {                                                            \
 #define POLL_SLEEP_MILLIS 100
 
 #define DEFAULT_TBUF_SIZE 32
+
+/* compressed output: target raw size of a chunk, and threads compressing */
+#define XTC_CHUNK_SIZE (1UL << 20)
+#define DEFAULT_COMPRESS_THREADS 2
 /***** The code **************************************************************/
 
 typedef struct settings_st {
@@ -60,9 +69,12 @@ typedef struct settings_st {
     unsigned long disk_rsvd;
     unsigned long timeout;
     unsigned long memory_buffer;
+    unsigned long compress_threads;
+    char *aggregate;          /* socket to serve aggregates on, if any */
     uint8_t discard:1,
         disable_tracing:1,
-        start_disabled:1;
+        start_disabled:1,
+        compress:1;
 } settings_t;
 
 struct t_struct {
@@ -79,6 +91,7 @@ static xc_interface *xc_handle;
 static xenevtchn_handle *xce_handle = NULL;
 static int virq_port = -1;
 static int outfd = 1;
+static int agg_fd = -1;
 
 static void close_handler(int signal)
 {
@@ -332,6 +345,283 @@ fail:
     return;
 }
 
+/*
+ * Compressed output.  Windows are staged per cpu until a chunk's worth has
+ * been collected, and the chunk is then queued to a pool of threads which
+ * compress and write it.  This keeps compression off the thread draining the
+ * trace buffers.  The queue is bounded; if the compressors fall behind, the
+ * drain blocks as it would on a slow disk.
+ */
+struct xtc_chunk {
+    struct xtc_chunk *next;
+    unsigned int cpu;
+    size_t size, alloc;
+    unsigned char *data;
+};
+
+static struct {
+    uint32_t codec;
+    unsigned int nr_cpus;
+    struct xtc_chunk **staging;
+
+    pthread_t *threads;
+    pthread_mutex_t lock;
+    pthread_cond_t work, space;
+    struct xtc_chunk *head, **tail;
+    unsigned int pending;
+    bool done;
+
+    /* Protected by write_lock. */
+    pthread_mutex_t write_lock;
+    off_t offset;
+    struct xtc_index_entry *index;
+    unsigned int nr_index, index_alloc;
+} xtc = {
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .work = PTHREAD_COND_INITIALIZER,
+    .space = PTHREAD_COND_INITIALIZER,
+    .write_lock = PTHREAD_MUTEX_INITIALIZER,
+};
+
+static void xtc_write(const void *buf, size_t size)
+{
+    const char *p = buf;
+
+    while ( size )
+    {
+        ssize_t written = write(outfd, p, size);
+
+        if ( written <= 0 )
+        {
+            PERROR("Failed to write compressed trace data");
+            exit(EXIT_FAILURE);
+        }
+
+        p += written;
+        size -= written;
+        xtc.offset += written;
+    }
+}
+
+static void xtc_write_chunk(struct xtc_chunk *c)
+{
+    struct xtc_chunk_header *hdr;
+    struct xtc_index_entry *e;
+    size_t bound = xtc_compress_bound(xtc.codec, c->size);
+    unsigned char *buf = malloc(sizeof(*hdr) + bound);
+
+    if ( !buf )
+    {
+        fprintf(stderr, "%s: Couldn't malloc %zu bytes!\n",
+                __func__, sizeof(*hdr) + bound);
+        exit(EXIT_FAILURE);
+    }
+
+    hdr = (struct xtc_chunk_header *)buf;
+    hdr->magic = XTC_CHUNK_MAGIC;
+    hdr->cpu = c->cpu;
+    hdr->raw_size = c->size;
+    xtc_scan_tsc(c->data, c->size, &hdr->first_tsc, &hdr->last_tsc);
+    hdr->comp_size = xtc_compress(xtc.codec, buf + sizeof(*hdr), bound,
+                                  c->data, c->size);
+    if ( !hdr->comp_size )
+    {
+        fprintf(stderr, "%s: %s compression of %zu bytes failed\n",
+                __func__, xtc_codec_name(xtc.codec), c->size);
+        exit(EXIT_FAILURE);
+    }
+
+    pthread_mutex_lock(&xtc.write_lock);
+
+    if ( xtc.nr_index == xtc.index_alloc )
+    {
+        xtc.index_alloc = xtc.index_alloc ? xtc.index_alloc * 2 : 1024;
+        xtc.index = realloc(xtc.index, xtc.index_alloc * sizeof(*xtc.index));
+        if ( !xtc.index )
+        {
+            fprintf(stderr, "%s: Couldn't grow chunk index!\n", __func__);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    e = &xtc.index[xtc.nr_index++];
+    e->offset = xtc.offset;
+    e->first_tsc = hdr->first_tsc;
+    e->last_tsc = hdr->last_tsc;
+    e->cpu = hdr->cpu;
+    e->raw_size = hdr->raw_size;
+
+    xtc_write(buf, sizeof(*hdr) + hdr->comp_size);
+
+    pthread_mutex_unlock(&xtc.write_lock);
+
+    free(buf);
+}
+
+static void *xtc_thread(void *arg)
+{
+    for ( ; ; )
+    {
+        struct xtc_chunk *c;
+
+        pthread_mutex_lock(&xtc.lock);
+        while ( !xtc.head && !xtc.done )
+            pthread_cond_wait(&xtc.work, &xtc.lock);
+        c = xtc.head;
+        if ( c )
+        {
+            xtc.head = c->next;
+            if ( !xtc.head )
+                xtc.tail = &xtc.head;
+            xtc.pending--;
+            pthread_cond_signal(&xtc.space);
+        }
+        pthread_mutex_unlock(&xtc.lock);
+
+        if ( !c )
+            return NULL;
+
+        xtc_write_chunk(c);
+        free(c->data);
+        free(c);
+    }
+}
+
+static void xtc_submit(unsigned int cpu)
+{
+    struct xtc_chunk *c = xtc.staging[cpu];
+
+    if ( !c || !c->size )
+        return;
+
+    xtc.staging[cpu] = NULL;
+
+    pthread_mutex_lock(&xtc.lock);
+    /* Allow a couple of chunks in flight per compressor. */
+    while ( xtc.pending >= 2 * opts.compress_threads )
+        pthread_cond_wait(&xtc.space, &xtc.lock);
+    c->next = NULL;
+    *xtc.tail = c;
+    xtc.tail = &c->next;
+    xtc.pending++;
+    pthread_cond_signal(&xtc.work);
+    pthread_mutex_unlock(&xtc.lock);
+}
+
+static void xtc_append(unsigned int cpu, const void *data, size_t size)
+{
+    struct xtc_chunk *c = xtc.staging[cpu];
+
+    if ( !c )
+    {
+        c = calloc(1, sizeof(*c));
+        if ( !c )
+            goto fail;
+        c->cpu = cpu;
+        xtc.staging[cpu] = c;
+    }
+
+    if ( c->size + size > c->alloc )
+    {
+        size_t alloc = c->alloc ? c->alloc : XTC_CHUNK_SIZE;
+
+        while ( alloc < c->size + size )
+            alloc *= 2;
+        c->data = realloc(c->data, alloc);
+        if ( !c->data )
+            goto fail;
+        c->alloc = alloc;
+    }
+
+    memcpy(c->data + c->size, data, size);
+    c->size += size;
+    return;
+
+ fail:
+    fprintf(stderr, "%s: Couldn't allocate staging buffer for cpu %u!\n",
+            __func__, cpu);
+    exit(EXIT_FAILURE);
+}
+
+static void xtc_write_window(unsigned int cpu, unsigned char *start, int size,
+                             int total_size)
+{
+    if ( total_size != 0 )
+    {
+        struct cpu_change_record rec;
+        struct xtc_chunk *c = xtc.staging[cpu];
+
+        /* Start a new chunk rather than grow this one past the target. */
+        if ( c && c->size + sizeof(rec) + total_size > XTC_CHUNK_SIZE )
+            xtc_submit(cpu);
+
+        rec.header = CPU_CHANGE_HEADER;
+        rec.data.cpu = cpu;
+        rec.data.window_size = total_size;
+        xtc_append(cpu, &rec, sizeof(rec));
+    }
+
+    xtc_append(cpu, start, size);
+}
+
+static void xtc_init(unsigned int nr_cpus)
+{
+    struct xtc_file_header hdr = {
+        .magic = XTC_MAGIC,
+        .version = 1,
+    };
+    unsigned int i;
+
+    xtc.codec = hdr.codec = xtc_default_codec();
+    xtc.nr_cpus = nr_cpus;
+    xtc.tail = &xtc.head;
+    xtc.staging = calloc(nr_cpus, sizeof(*xtc.staging));
+    xtc.threads = calloc(opts.compress_threads, sizeof(*xtc.threads));
+    if ( !xtc.staging || !xtc.threads )
+    {
+        fprintf(stderr, "%s: Couldn't allocate compression state!\n",
+                __func__);
+        exit(EXIT_FAILURE);
+    }
+
+    xtc.offset = lseek(outfd, 0, SEEK_CUR);
+    if ( xtc.offset < 0 )
+        xtc.offset = 0;
+    xtc_write(&hdr, sizeof(hdr));
+
+    for ( i = 0; i < opts.compress_threads; i++ )
+        if ( pthread_create(&xtc.threads[i], NULL, xtc_thread, NULL) )
+        {
+            PERROR("Failed to create compression thread");
+            exit(EXIT_FAILURE);
+        }
+}
+
+static void xtc_finish(void)
+{
+    struct xtc_trailer trailer = { .magic = XTC_TRAILER_MAGIC };
+    unsigned int i;
+
+    for ( i = 0; i < xtc.nr_cpus; i++ )
+        xtc_submit(i);
+
+    pthread_mutex_lock(&xtc.lock);
+    xtc.done = true;
+    pthread_cond_broadcast(&xtc.work);
+    pthread_mutex_unlock(&xtc.lock);
+
+    for ( i = 0; i < opts.compress_threads; i++ )
+        pthread_join(xtc.threads[i], NULL);
+
+    trailer.nr_entries = xtc.nr_index;
+    trailer.index_offset = xtc.offset;
+    xtc_write(xtc.index, xtc.nr_index * sizeof(*xtc.index));
+    xtc_write(&trailer, sizeof(trailer));
+
+    fprintf(stderr, "Wrote %u %s compressed chunks.\n",
+            xtc.nr_index, xtc_codec_name(xtc.codec));
+}
+
 /**
  * write_buffer - write a section of the trace buffer
  * @cpu      - source buffer CPU ID
@@ -348,7 +638,13 @@ static void write_buffer(unsigned int cpu, unsigned char *start, int size,
 {
     struct statvfs stat;
     size_t written = 0;
-    
+
+    if ( opts.aggregate )
+    {
+        xtagg_window(cpu, start, size);
+        return;
+    }
+
     if ( opts.memory_buffer == 0 && opts.disk_rsvd != 0 )
     {
         unsigned long long freespace;
@@ -376,6 +672,12 @@ static void write_buffer(unsigned int cpu, unsigned char *start, int size,
         }
     }
 
+    if ( opts.compress )
+    {
+        xtc_write_window(cpu, start, size, total_size);
+        return;
+    }
+
     /* Write a CPU_BUF record on each buffer "window" written.  Wrapped
      * windows may involve two writes, so only write the record on the
      * first write. */
@@ -603,6 +905,22 @@ static unsigned int get_num_cpus(void)
     return physinfo.max_cpu_id + 1;
 }
 
+/**
+ * get_tsc_khz - get the frequency of the timestamps in the records
+ */
+static uint64_t get_tsc_khz(void)
+{
+    xc_physinfo_t physinfo;
+
+    if ( xc_physinfo(xc_handle, &physinfo) != 0 )
+    {
+        PERROR("Failure to get the cpu frequency from Xen");
+        exit(EXIT_FAILURE);
+    }
+
+    return physinfo.cpu_khz;
+}
+
 /**
  * event_init - setup to receive the VIRQ_TBUF event
  */
@@ -631,11 +949,13 @@ static void event_init(void)
 static void wait_for_event_or_timeout(unsigned long milliseconds)
 {
     int rc;
-    struct pollfd fd = { .fd = xenevtchn_fd(xce_handle),
-                         .events = POLLIN | POLLERR };
+    struct pollfd fd[2] = {
+        { .fd = xenevtchn_fd(xce_handle), .events = POLLIN | POLLERR },
+        { .fd = agg_fd, .events = POLLIN },
+    };
     int port;
 
-    rc = poll(&fd, 1, milliseconds);
+    rc = poll(fd, agg_fd >= 0 ? 2 : 1, milliseconds);
     if (rc == -1) {
         if (errno == EINTR)
             return;
@@ -643,7 +963,10 @@ static void wait_for_event_or_timeout(unsigned long milliseconds)
         exit(EXIT_FAILURE);
     }
 
-    if (rc == 1) {
+    if (agg_fd >= 0 && fd[1].revents)
+        xtagg_serve();
+
+    if (fd[0].revents) {
         port = xenevtchn_pending(xce_handle);
         if (port == -1) {
             PERROR("failed to read port from evtchn");
@@ -699,6 +1022,19 @@ static void monitor_tbufs(void)
     
     tbufs = map_tbufs(tbufs_mfn, num, tinfo_size);
 
+    if ( opts.compress )
+        xtc_init(num);
+
+    if ( opts.aggregate )
+    {
+        agg_fd = xtagg_init(opts.aggregate, num, get_tsc_khz());
+        if ( agg_fd < 0 )
+        {
+            PERROR("Failed to listen on %s", opts.aggregate);
+            exit(EXIT_FAILURE);
+        }
+    }
+
     size = tbufs->t_info->tbuf_size * XC_PAGE_SIZE;
 
     data_size = size - sizeof(struct t_buf);
@@ -784,12 +1120,21 @@ static void monitor_tbufs(void)
                 break;
         }
 
+        if ( opts.aggregate )
+            xtagg_tick();
+
         wait_for_event_or_timeout(opts.poll_sleep);
     }
 
     if ( opts.memory_buffer )
         membuf_dump();
 
+    if ( opts.compress )
+        xtc_finish();
+
+    if ( opts.aggregate )
+        xtagg_finish();
+
     /* cleanup */
     free(meta);
     free(data);
@@ -842,6 +1187,14 @@ static void usage(int status)
 "  -r  --reserve-disk-space=n Before writing trace records to disk, check to see\n" \
 "                          that after the write there will be at least n space\n" \
 "                          left on the disk.\n" \
+"  -z  --compress          Write a compressed trace, with an index of chunks\n" \
+"                          by cpu and tsc.\n" \
+"  -Z  --compress-threads=n Use n threads to compress (default " \
+                           xstr(DEFAULT_COMPRESS_THREADS) ").\n" \
+"  -A  --aggregate=socket  Don't write the records out, but keep running\n" \
+"                          totals of runstate times, VM exits, hypercalls\n" \
+"                          and lost records, reported to each client\n" \
+"                          connecting to the UNIX socket.\n" \
 "\n" \
 "This tool is used to capture trace buffer data from Xen. The\n" \
 "data is output in a binary format, in the following order:\n" \
@@ -1090,12 +1443,15 @@ static void parse_args(int argc, char **argv)
         { "discard-buffers", no_argument,      0, 'D' },
         { "dont-disable-tracing", no_argument, 0, 'x' },
         { "start-disabled", no_argument,       0, 'X' },
+        { "compress",       no_argument,       0, 'z' },
+        { "compress-threads", required_argument, 0, 'Z' },
+        { "aggregate",      required_argument, 0, 'A' },
         { "help",           no_argument,       0, 'h' },
         { "version",        no_argument,       0, 'V' },
         { 0, 0, 0, 0 }
     };
 
-    while ( (option = getopt_long(argc, argv, "t:s:c:e:S:r:T:M:DxX?V",
+    while ( (option = getopt_long(argc, argv, "t:s:c:e:S:r:T:M:DxXzZ:A:?V",
                     long_options, NULL)) != -1) 
     {
         switch ( option )
@@ -1146,6 +1502,23 @@ static void parse_args(int argc, char **argv)
             opts.memory_buffer = sargtol(optarg, 0);
             break;
 
+        case 'z':
+            opts.compress = 1;
+            break;
+
+        case 'Z':
+            opts.compress_threads = argtol(optarg, 0);
+            if ( opts.compress_threads < 1 )
+            {
+                fprintf(stderr, "Need at least one compression thread.\n\n");
+                usage(EXIT_FAILURE);
+            }
+            break;
+
+        case 'A':
+            opts.aggregate = optarg;
+            break;
+
         case 'h':
             usage(EXIT_SUCCESS);
             break;
@@ -1158,6 +1531,19 @@ static void parse_args(int argc, char **argv)
     /* get outfile (optional last argument) */
     if (argc > optind)
         opts.outfile = argv[optind];
+
+    if ( opts.compress && opts.memory_buffer )
+    {
+        fprintf(stderr, "--compress and --memory-buffer are mutually exclusive.\n\n");
+        usage(EXIT_FAILURE);
+    }
+
+    if ( opts.aggregate &&
+         (opts.outfile || opts.compress || opts.memory_buffer) )
+    {
+        fprintf(stderr, "--aggregate doesn't write a trace.\n\n");
+        usage(EXIT_FAILURE);
+    }
 }
 
 /* *BSD has no O_LARGEFILE */
@@ -1177,6 +1563,7 @@ int main(int argc, char **argv)
     opts.disable_tracing = 1;
     opts.start_disabled = 0;
     opts.timeout = 0;
+    opts.compress_threads = DEFAULT_COMPRESS_THREADS;
 
     parse_args(argc, argv);
 
@@ -1199,18 +1586,20 @@ int main(int argc, char **argv)
     if ( opts.timeout != 0 ) 
         alarm(opts.timeout);
 
-    if ( opts.outfile )
+    if ( opts.aggregate )
+        outfd = -1;
+    else if ( opts.outfile )
         outfd = open(opts.outfile,
                      O_WRONLY | O_CREAT | O_TRUNC | O_LARGEFILE,
                      0644);
 
-    if ( outfd < 0 )
+    if ( outfd < 0 && !opts.aggregate )
     {
         perror("Could not open output file");
         exit(EXIT_FAILURE);
     }        
 
-    if ( isatty(outfd) )
+    if ( outfd >= 0 && isatty(outfd) )
     {
         fprintf(stderr, "Cannot output to a TTY, specify a log file.\n");
         exit(EXIT_FAILURE);
@@ -1230,7 +1619,8 @@ int main(int argc, char **argv)
 
     monitor_tbufs();
 
-    close(outfd);
+    if ( outfd >= 0 )
+        close(outfd);
     return 0;
 }
 
@@ -0,0 +1,440 @@
+/*
+ * xtagg.c: Live aggregation of xentrace records
+ *
+ * Records never straddle the end of a trace buffer (Xen pads it with a
+ * TRC_TRACE_WRAP_BUFFER record instead), so each part of a window can be
+ * decoded on its own.  All times are in tsc cycles until reported.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+
+#include <xen/xen.h>
+#include <xen/trace.h>
+#include <xen/vcpu.h>
+
+#include "xtagg.h"
+
+#define NR_DOMIDS        (DOMID_IDLE + 1)
+#define NR_RUNSTATES     4
+#define NR_EXIT_REASONS  0x500 /* Covers SVM's VMEXIT_NPF (0x400). */
+#define NR_HYPERCALLS    64
+#define RATE_SLOTS       10    /* Seconds the rates are averaged over. */
+
+struct xtagg_vcpu {
+    uint64_t tsc;              /* Of the last runstate change. */
+    unsigned int epoch;        /* The runstate is unknown if stale. */
+    unsigned int state;
+};
+
+struct xtagg_dom {
+    unsigned int nr_vcpus;
+    struct xtagg_vcpu *vcpus;
+    uint64_t runstate[NR_RUNSTATES];
+    uint64_t exits, hypercalls;
+};
+
+struct xtagg_totals {
+    uint64_t records, lost, exits, hypercalls;
+};
+
+struct xtagg_sample {
+    struct timespec ts;
+    struct xtagg_totals t;
+};
+
+static struct {
+    int fd;
+    char *path;
+    uint64_t tsc_khz;
+    unsigned int nr_cpus;
+
+    /* Per pcpu: last tsc seen and domain running, for records without. */
+    uint64_t *cpu_tsc;
+    uint16_t *cpu_dom;
+
+    uint64_t last_tsc;
+    unsigned int epoch;        /* Bumped on lost records, from 1. */
+    struct xtagg_dom *doms[NR_DOMIDS];
+    struct xtagg_totals t;
+    uint64_t lost_events;
+    uint64_t vmx_exits[NR_EXIT_REASONS], svm_exits[NR_EXIT_REASONS];
+    uint64_t hypercalls[NR_HYPERCALLS + 1]; /* Last one for the others. */
+
+    struct timespec start;
+    struct xtagg_sample rates[RATE_SLOTS];
+    unsigned int rate_idx, nr_rates;
+} agg = { .fd = -1, .epoch = 1 };
+
+static const char *const runstate_name[NR_RUNSTATES] = {
+    [RUNSTATE_running]  = "running",
+    [RUNSTATE_runnable] = "runnable",
+    [RUNSTATE_blocked]  = "blocked",
+    [RUNSTATE_offline]  = "offline",
+};
+
+static struct xtagg_dom *get_dom(unsigned int domid)
+{
+    struct xtagg_dom *d;
+
+    if ( domid >= NR_DOMIDS || domid == DOMID_INVALID )
+        return NULL;
+
+    d = agg.doms[domid];
+    if ( !d )
+        d = agg.doms[domid] = calloc(1, sizeof(*d));
+
+    return d;
+}
+
+static struct xtagg_vcpu *get_vcpu(struct xtagg_dom *d, unsigned int vcpuid)
+{
+    if ( vcpuid >= d->nr_vcpus )
+    {
+        unsigned int nr = vcpuid + 1 > 2 * d->nr_vcpus ? vcpuid + 1
+                                                       : 2 * d->nr_vcpus;
+        struct xtagg_vcpu *v = realloc(d->vcpus, nr * sizeof(*v));
+
+        if ( !v )
+            return NULL;
+        memset(&v[d->nr_vcpus], 0, (nr - d->nr_vcpus) * sizeof(*v));
+        d->vcpus = v;
+        d->nr_vcpus = nr;
+    }
+
+    return &d->vcpus[vcpuid];
+}
+
+static void runstate_change(unsigned int cpu, uint32_t event,
+                            const uint32_t *data, uint64_t tsc)
+{
+    unsigned int domid = data[0] >> 16, vcpuid = data[0] & 0xffff;
+    unsigned int new_state = (event >> 4) & 3;
+    struct xtagg_dom *d = get_dom(domid);
+    struct xtagg_vcpu *v = d ? get_vcpu(d, vcpuid) : NULL;
+
+    if ( !v )
+        return;
+
+    if ( v->epoch == agg.epoch && tsc >= v->tsc )
+        d->runstate[v->state] += tsc - v->tsc;
+
+    v->tsc = tsc;
+    v->state = new_state;
+    v->epoch = agg.epoch;
+
+    if ( new_state == RUNSTATE_running )
+        agg.cpu_dom[cpu] = domid;
+}
+
+static void account_exit(unsigned int cpu, uint64_t *exits, uint32_t reason)
+{
+    struct xtagg_dom *d = get_dom(agg.cpu_dom[cpu]);
+
+    agg.t.exits++;
+    if ( d )
+        d->exits++;
+    exits[reason < NR_EXIT_REASONS ? reason : NR_EXIT_REASONS - 1]++;
+}
+
+static void account_hypercall(unsigned int cpu, uint32_t op)
+{
+    struct xtagg_dom *d = get_dom(agg.cpu_dom[cpu]);
+
+    agg.t.hypercalls++;
+    if ( d )
+        d->hypercalls++;
+    agg.hypercalls[op < NR_HYPERCALLS ? op : NR_HYPERCALLS]++;
+}
+
+static void decode(unsigned int cpu, uint32_t event, unsigned int extra,
+                   const uint32_t *data, uint64_t tsc)
+{
+    uint32_t base = event & ~(TRC_64_FLAG | TRC_HVM_NESTEDFLAG);
+
+    if ( (event & ~0x330) == TRC_SCHED_RUNSTATE_CHANGE )
+    {
+        if ( extra >= 1 )
+            runstate_change(cpu, event, data, tsc);
+        return;
+    }
+
+    if ( !extra )
+        return;
+
+    switch ( base )
+    {
+    case TRC_HVM_VMX_EXIT:
+        account_exit(cpu, agg.vmx_exits, data[0] & 0xffff);
+        break;
+
+    case TRC_HVM_SVM_EXIT:
+        account_exit(cpu, agg.svm_exits, data[0]);
+        break;
+
+    case TRC_PV_HYPERCALL_V2:
+        account_hypercall(cpu, data[0] & ~TRC_PV_HYPERCALL_V2_ARG_MASK);
+        break;
+
+    case TRC_HVM_VMMCALL:
+        account_hypercall(cpu, data[0]);
+        break;
+
+    case TRC_LOST_RECORDS:
+        agg.t.lost += data[0];
+        agg.lost_events++;
+        /* Runstate changes may have been lost: restart all the timings. */
+        agg.epoch++;
+        break;
+    }
+}
+
+void xtagg_window(unsigned int cpu, const void *buf, size_t size)
+{
+    const uint32_t *p = buf, *end = p + size / sizeof(uint32_t);
+
+    if ( cpu >= agg.nr_cpus )
+        return;
+
+    while ( p < end )
+    {
+        uint32_t hdr = *p;
+        unsigned int extra = TRC_HD_EXTRA(hdr);
+        bool cycles = TRC_HD_INCLUDES_CYCLE_COUNT(hdr);
+        const uint32_t *data = p + 1 + (cycles ? 2 : 0);
+
+        if ( data + extra > end )
+            break;
+
+        if ( cycles )
+        {
+            agg.cpu_tsc[cpu] = p[1] | ((uint64_t)p[2] << 32);
+            if ( agg.cpu_tsc[cpu] > agg.last_tsc )
+                agg.last_tsc = agg.cpu_tsc[cpu];
+        }
+
+        agg.t.records++;
+        decode(cpu, TRC_HD_TO_EVENT(hdr), extra, data, agg.cpu_tsc[cpu]);
+
+        p = data + extra;
+    }
+}
+
+static double elapsed(const struct timespec *from, const struct timespec *to)
+{
+    return (to->tv_sec - from->tv_sec) + (to->tv_nsec - from->tv_nsec) / 1e9;
+}
+
+void xtagg_tick(void)
+{
+    const struct xtagg_sample *last =
+        &agg.rates[(agg.rate_idx + RATE_SLOTS - 1) % RATE_SLOTS];
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    if ( agg.nr_rates && elapsed(&last->ts, &now) < 1 )
+        return;
+
+    agg.rates[agg.rate_idx].ts = now;
+    agg.rates[agg.rate_idx].t = agg.t;
+    agg.rate_idx = (agg.rate_idx + 1) % RATE_SLOTS;
+    if ( agg.nr_rates < RATE_SLOTS )
+        agg.nr_rates++;
+}
+
+static double tsc_to_ms(uint64_t tsc)
+{
+    return agg.tsc_khz ? (double)tsc / agg.tsc_khz : 0;
+}
+
+void xtagg_report(FILE *f)
+{
+    const struct xtagg_sample *oldest =
+        &agg.rates[agg.nr_rates < RATE_SLOTS ? 0 : agg.rate_idx];
+    struct timespec now;
+    double secs;
+    unsigned int i, j;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    fprintf(f, "uptime_s %.3f\n", elapsed(&agg.start, &now));
+    fprintf(f, "records %"PRIu64"\n", agg.t.records);
+    fprintf(f, "lost_records %"PRIu64"\n", agg.t.lost);
+    fprintf(f, "lost_events %"PRIu64"\n", agg.lost_events);
+    fprintf(f, "exits %"PRIu64"\n", agg.t.exits);
+    fprintf(f, "hypercalls %"PRIu64"\n", agg.t.hypercalls);
+
+    secs = agg.nr_rates ? elapsed(&oldest->ts, &now) : 0;
+    if ( secs >= 1 )
+    {
+        fprintf(f, "rate_window_s %.3f\n", secs);
+        fprintf(f, "record_rate %.1f\n",
+                (agg.t.records - oldest->t.records) / secs);
+        fprintf(f, "lost_rate %.1f\n", (agg.t.lost - oldest->t.lost) / secs);
+        fprintf(f, "exit_rate %.1f\n", (agg.t.exits - oldest->t.exits) / secs);
+        fprintf(f, "hypercall_rate %.1f\n",
+                (agg.t.hypercalls - oldest->t.hypercalls) / secs);
+    }
+
+    for ( i = 0; i < NR_DOMIDS; i++ )
+    {
+        const struct xtagg_dom *d = agg.doms[i];
+        uint64_t runstate[NR_RUNSTATES];
+
+        if ( !d )
+            continue;
+
+        /* Account the current runstates up to the last record seen. */
+        memcpy(runstate, d->runstate, sizeof(runstate));
+        for ( j = 0; j < d->nr_vcpus; j++ )
+        {
+            const struct xtagg_vcpu *v = &d->vcpus[j];
+
+            if ( v->epoch == agg.epoch && agg.last_tsc >= v->tsc )
+                runstate[v->state] += agg.last_tsc - v->tsc;
+        }
+
+        fprintf(f, "domain %u", i);
+        for ( j = 0; j < NR_RUNSTATES; j++ )
+            fprintf(f, " %s_ms %.3f", runstate_name[j],
+                    tsc_to_ms(runstate[j]));
+        fprintf(f, " exits %"PRIu64" hypercalls %"PRIu64"\n",
+                d->exits, d->hypercalls);
+    }
+
+    for ( i = 0; i < NR_EXIT_REASONS; i++ )
+    {
+        if ( agg.vmx_exits[i] )
+            fprintf(f, "vmx_exit %#x %"PRIu64"\n", i, agg.vmx_exits[i]);
+        if ( agg.svm_exits[i] )
+            fprintf(f, "svm_exit %#x %"PRIu64"\n", i, agg.svm_exits[i]);
+    }
+
+    for ( i = 0; i < NR_HYPERCALLS; i++ )
+        if ( agg.hypercalls[i] )
+            fprintf(f, "hypercall %u %"PRIu64"\n", i, agg.hypercalls[i]);
+    if ( agg.hypercalls[NR_HYPERCALLS] )
+        fprintf(f, "hypercall other %"PRIu64"\n",
+                agg.hypercalls[NR_HYPERCALLS]);
+}
+
+void xtagg_serve(void)
+{
+    /* Don't let a client stall the reading of the trace buffers. */
+    struct timeval tv = { .tv_usec = 100000 };
+    char *buf = NULL;
+    size_t size = 0, done = 0;
+    FILE *f;
+    int fd;
+
+    fd = accept(agg.fd, NULL, NULL);
+    if ( fd < 0 )
+        return;
+
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+
+    f = open_memstream(&buf, &size);
+    if ( f )
+    {
+        xtagg_report(f);
+        fclose(f);
+
+        while ( done < size )
+        {
+            ssize_t n = send(fd, buf + done, size - done, MSG_NOSIGNAL);
+
+            if ( n <= 0 )
+                break;
+            done += n;
+        }
+        free(buf);
+    }
+
+    close(fd);
+}
+
+int xtagg_init(const char *path, unsigned int nr_cpus, uint64_t tsc_khz)
+{
+    struct sockaddr_un addr = { .sun_family = AF_UNIX };
+    struct stat st;
+
+    if ( strlen(path) >= sizeof(addr.sun_path) )
+    {
+        errno = ENAMETOOLONG;
+        return -1;
+    }
+    strcpy(addr.sun_path, path);
+
+    agg.nr_cpus = nr_cpus;
+    agg.tsc_khz = tsc_khz;
+    agg.cpu_tsc = calloc(nr_cpus, sizeof(*agg.cpu_tsc));
+    agg.cpu_dom = calloc(nr_cpus, sizeof(*agg.cpu_dom));
+    agg.path = strdup(path);
+    if ( !agg.cpu_tsc || !agg.cpu_dom || !agg.path )
+        return -1;
+
+    /* No domain is known to be running on any pcpu yet. */
+    for ( nr_cpus = 0; nr_cpus < agg.nr_cpus; nr_cpus++ )
+        agg.cpu_dom[nr_cpus] = DOMID_INVALID;
+
+    clock_gettime(CLOCK_MONOTONIC, &agg.start);
+    xtagg_tick();
+
+    agg.fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC | SOCK_NONBLOCK, 0);
+    if ( agg.fd < 0 )
+        return -1;
+
+    /* Replace the socket of a previous instance, but nothing else. */
+    if ( !lstat(path, &st) )
+    {
+        if ( !S_ISSOCK(st.st_mode) )
+        {
+            close(agg.fd);
+            agg.fd = -1;
+            errno = EEXIST;
+            return -1;
+        }
+        unlink(path);
+    }
+    if ( bind(agg.fd, (struct sockaddr *)&addr, sizeof(addr)) ||
+         listen(agg.fd, 16) )
+    {
+        int saved_errno = errno;
+
+        close(agg.fd);
+        agg.fd = -1;
+        errno = saved_errno;
+    }
+
+    return agg.fd;
+}
+
+void xtagg_finish(void)
+{
+    if ( agg.fd < 0 )
+        return;
+
+    close(agg.fd);
+    unlink(agg.path);
+    agg.fd = -1;
+}
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * tab-width: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
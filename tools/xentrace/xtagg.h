@@ -0,0 +1,47 @@
+/*
+ * xtagg.h: Live aggregation of xentrace records
+ *
+ * Instead of writing the trace buffers out, xentrace --aggregate decodes
+ * each window of records as it is read and maintains running totals:
+ * per-domain runstate times, VM exit and hypercall counts and lost records.
+ * They are reported, as "key value" text lines, to every client connecting
+ * to a UNIX socket.
+ */
+#ifndef __XENTRACE_XTAGG_H__
+#define __XENTRACE_XTAGG_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/*
+ * @tsc_khz converts tsc deltas to time.  Return the fd to poll for clients,
+ * or -1 on error with errno set.
+ */
+int xtagg_init(const char *path, unsigned int nr_cpus, uint64_t tsc_khz);
+
+/* Decode the whole records in @buf, read from @cpu's trace buffer. */
+void xtagg_window(unsigned int cpu, const void *buf, size_t size);
+
+/* Called at least once a second, to sample the totals for the rates. */
+void xtagg_tick(void);
+
+/* Accept a client on the socket and send it the report. */
+void xtagg_serve(void);
+
+void xtagg_report(FILE *f);
+
+/* Remove the socket. */
+void xtagg_finish(void);
+
+#endif /* __XENTRACE_XTAGG_H__ */
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * tab-width: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1,139 @@
+/*
+ * xtc.c: Compression helpers for the compressed xentrace format
+ */
+
+#include <string.h>
+#include <zlib.h>
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+#include "xtc.h"
+
+uint32_t xtc_default_codec(void)
+{
+#ifdef HAVE_ZSTD
+    return XTC_CODEC_ZSTD;
+#else
+    return XTC_CODEC_ZLIB;
+#endif
+}
+
+const char *xtc_codec_name(uint32_t codec)
+{
+    switch ( codec )
+    {
+    case XTC_CODEC_ZLIB: return "zlib";
+    case XTC_CODEC_ZSTD: return "zstd";
+    default:             return "unknown";
+    }
+}
+
+size_t xtc_compress_bound(uint32_t codec, size_t size)
+{
+    switch ( codec )
+    {
+    case XTC_CODEC_ZLIB:
+        return compressBound(size);
+#ifdef HAVE_ZSTD
+    case XTC_CODEC_ZSTD:
+        return ZSTD_compressBound(size);
+#endif
+    default:
+        return 0;
+    }
+}
+
+size_t xtc_compress(uint32_t codec, void *dst, size_t dst_size,
+                    const void *src, size_t src_size)
+{
+    switch ( codec )
+    {
+    case XTC_CODEC_ZLIB:
+    {
+        uLongf len = dst_size;
+
+        /* Trace records compress well even at the fastest setting. */
+        if ( compress2(dst, &len, src, src_size, Z_BEST_SPEED) != Z_OK )
+            return 0;
+        return len;
+    }
+#ifdef HAVE_ZSTD
+    case XTC_CODEC_ZSTD:
+    {
+        size_t len = ZSTD_compress(dst, dst_size, src, src_size, 1);
+
+        return ZSTD_isError(len) ? 0 : len;
+    }
+#endif
+    default:
+        return 0;
+    }
+}
+
+int xtc_decompress(uint32_t codec, void *dst, size_t dst_size,
+                   const void *src, size_t src_size)
+{
+    switch ( codec )
+    {
+    case XTC_CODEC_ZLIB:
+    {
+        uLongf len = dst_size;
+
+        if ( uncompress(dst, &len, src, src_size) != Z_OK )
+            return -1;
+        return len == dst_size ? 0 : -1;
+    }
+#ifdef HAVE_ZSTD
+    case XTC_CODEC_ZSTD:
+    {
+        size_t len = ZSTD_decompress(dst, dst_size, src, src_size);
+
+        return !ZSTD_isError(len) && len == dst_size ? 0 : -1;
+    }
+#endif
+    default:
+        return -1;
+    }
+}
+
+void xtc_scan_tsc(const void *buf, size_t size,
+                  uint64_t *first_tsc, uint64_t *last_tsc)
+{
+    const unsigned char *p = buf, *end = p + size;
+
+    *first_tsc = *last_tsc = 0;
+
+    while ( end - p >= sizeof(uint32_t) )
+    {
+        uint32_t hdr, tsc[2];
+        size_t len;
+
+        memcpy(&hdr, p, sizeof(hdr));
+        len = sizeof(hdr) + ((hdr >> 28) & 7) * sizeof(uint32_t);
+
+        if ( hdr >> 31 )
+        {
+            len += sizeof(tsc);
+            if ( end - p < len )
+                break;
+
+            memcpy(tsc, p + sizeof(hdr), sizeof(tsc));
+            *last_tsc = ((uint64_t)tsc[1] << 32) | tsc[0];
+            if ( !*first_tsc )
+                *first_tsc = *last_tsc;
+        }
+
+        p += len;
+    }
+}
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * tab-width: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1,86 @@
+/*
+ * xtc.h: Compressed, indexed xentrace output format
+ *
+ * A compressed trace starts with a struct xtc_file_header, followed by
+ * chunks.  Each chunk is a struct xtc_chunk_header followed by comp_size
+ * bytes of compressed data.  Decompressed, a chunk is one or more windows of
+ * a single pcpu in the plain xentrace format, i.e. a cpu_change record
+ * followed by that pcpu's records.
+ *
+ * Chunks are written as they are compressed, so they are in no particular
+ * order in the file.  When xentrace exits cleanly, it appends an index of
+ * all chunks and a struct xtc_trailer.  If the trailer is missing, the
+ * index can be rebuilt by walking the chunk headers.
+ *
+ * All fields are in host byte order, as for the plain format.
+ */
+#ifndef __XENTRACE_XTC_H__
+#define __XENTRACE_XTC_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define XTC_MAGIC         "XENTRCZ1"
+#define XTC_CHUNK_MAGIC   0x4b435458U /* "XTCK" */
+#define XTC_TRAILER_MAGIC 0x49435458U /* "XTCI" */
+
+#define XTC_CODEC_ZLIB    1
+#define XTC_CODEC_ZSTD    2
+
+struct xtc_file_header {
+    char magic[8];
+    uint32_t version;
+    uint32_t codec;
+};
+
+struct xtc_chunk_header {
+    uint32_t magic;
+    uint32_t cpu;
+    uint64_t first_tsc, last_tsc; /* 0 if no record in the chunk has a tsc */
+    uint32_t raw_size;
+    uint32_t comp_size;
+};
+
+struct xtc_index_entry {
+    uint64_t offset; /* of the struct xtc_chunk_header */
+    uint64_t first_tsc, last_tsc;
+    uint32_t cpu;
+    uint32_t raw_size;
+};
+
+struct xtc_trailer {
+    uint32_t magic;
+    uint32_t nr_entries;
+    uint64_t index_offset;
+};
+
+/* Codec used for new traces: zstd if available, zlib otherwise. */
+uint32_t xtc_default_codec(void);
+const char *xtc_codec_name(uint32_t codec);
+
+/* Upper bound of the compressed size of @size bytes. */
+size_t xtc_compress_bound(uint32_t codec, size_t size);
+
+/* Return the compressed size, or 0 on error. */
+size_t xtc_compress(uint32_t codec, void *dst, size_t dst_size,
+                    const void *src, size_t src_size);
+
+/* Return 0 if exactly @dst_size bytes were decompressed. */
+int xtc_decompress(uint32_t codec, void *dst, size_t dst_size,
+                   const void *src, size_t src_size);
+
+/* Find the first and last tsc of the plain format records in @buf. */
+void xtc_scan_tsc(const void *buf, size_t size,
+                  uint64_t *first_tsc, uint64_t *last_tsc);
+
+#endif /* __XENTRACE_XTC_H__ */
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * tab-width: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1 @@
+cmd_prelink.o := ld    -melf_x86_64 --no-warn-rwx-segments -r -o prelink.o common/built_in.o drivers/built_in.o lib/built_in.o xsm/built_in.o arch/x86/built_in.o --start-group arch/x86/lib/lib.a arch/x86/lib/cpu-policy/lib.a lib/lib.a --end-group
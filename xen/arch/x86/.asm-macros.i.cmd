@@ -0,0 +1,43 @@
+cmd_arch/x86/asm-macros.i := gcc -E -MMD -MP -MF arch/x86/.asm-macros.i.d -m64 -DBUILD_ID -fno-strict-aliasing -Wall -Wstrict-prototypes -Wno-unused-but-set-variable -Wno-unused-local-typedefs -O1 -fno-omit-frame-pointer -nostdinc -fno-builtin -fno-common -Werror -Wredundant-decls -Wwrite-strings -Wno-pointer-arith -Wdeclaration-after-statement -Wuninitialized -Wvla -Winit-self -pipe -D__XEN__ -include ./include/xen/config.h -ffunction-sections -fdata-sections -g -malign-data=abi -mindirect-branch=thunk-extern -mindirect-branch-register -fno-jump-tables -mfunction-return=thunk-extern -fno-stack-protector -I./include -I./arch/x86/include -I./arch/x86/include/generated -DXEN_IMG_OFFSET=0x200000 -msoft-float -fno-pie -fno-exceptions -fno-asynchronous-unwind-tables -Wnested-externs -DHAVE_AS_QUOTED_SYM -DHAVE_AS_MOVDIR -DHAVE_AS_ENQCMD -DHAVE_AS_NOPS_DIRECTIVE -mno-red-zone -fpic -mno-mmx -mno-sse -mskip-rax-setup -fcf-protection=branch -mmanual-endbr -fno-jump-tables -mmemcpy-strategy=unrolled_loop:16:noalign,libcall:-1:noalign -mmemset-strategy=unrolled_loop:16:noalign,libcall:-1:noalign '-D__OBJECT_LABEL__=arch/x86/asm-macros.i' -DXEN_BUILD_EFI -DBUILD_ID_EFI -P -MQ arch/x86/asm-macros.i -o arch/x86/asm-macros.i arch/x86/asm-macros.S
+
+source_arch/x86/asm-macros.i := arch/x86/asm-macros.S
+
+deps_arch/x86/asm-macros.i := \
+  include/xen/config.h \
+    $(wildcard include/config/enforce/unique/symbols.h) \
+    $(wildcard include/config/nr/cpus.h) \
+    $(wildcard include/config/debug.h) \
+  include/xen/kconfig.h \
+    $(wildcard include/config/booger.h) \
+    $(wildcard include/config/foo.h) \
+  arch/x86/include/asm/config.h \
+    $(wildcard include/config/paging/levels.h) \
+    $(wildcard include/config/have/efficient/unaligned/access.h) \
+    $(wildcard include/config/numa/emu.h) \
+    $(wildcard include/config/pagealloc/max/order.h) \
+    $(wildcard include/config/domu/max/order.h) \
+    $(wildcard include/config/hwdom/max/order.h) \
+    $(wildcard include/config/x86/l1/cache/shift.h) \
+    $(wildcard include/config/acpi/cstate.h) \
+    $(wildcard include/config/watchdog.h) \
+    $(wildcard include/config/multiboot.h) \
+    $(wildcard include/config/pv32.h) \
+    $(wildcard include/config/bigmem.h) \
+  include/xen/const.h \
+  arch/x86/include/asm/asm-defns.h \
+    $(wildcard include/config/indirect/thunk.h) \
+    $(wildcard include/config/return/thunk.h) \
+    $(wildcard include/config/xen/ibt.h) \
+    $(wildcard include/config/speculative/harden/guest/access.h) \
+    $(wildcard include/config/pv.h) \
+  arch/x86/include/asm/page-bits.h \
+  arch/x86/include/asm/alternative-asm.h \
+  arch/x86/include/asm/nops.h \
+  arch/x86/include/asm/spec_ctrl_asm.h \
+    $(wildcard include/config/xen/shstk.h) \
+  arch/x86/include/asm/msr-index.h \
+  arch/x86/include/asm/spec_ctrl.h \
+
+arch/x86/asm-macros.i: $(deps_arch/x86/asm-macros.i)
+
+$(deps_arch/x86/asm-macros.i):
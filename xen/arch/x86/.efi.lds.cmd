@@ -0,0 +1,55 @@
+cmd_arch/x86/efi.lds := gcc -E -P -MMD -MP -MF arch/x86/.efi.lds.d -m64 -DBUILD_ID -fno-strict-aliasing -Wall -Wstrict-prototypes -Wno-unused-but-set-variable -Wno-unused-local-typedefs -O1 -fno-omit-frame-pointer -nostdinc -fno-builtin -fno-common -Werror -Wredundant-decls -Wwrite-strings -Wno-pointer-arith -Wdeclaration-after-statement -Wuninitialized -Wvla -Winit-self -pipe -D__XEN__ -include ./include/xen/config.h -ffunction-sections -fdata-sections -g -malign-data=abi -mindirect-branch=thunk-extern -mindirect-branch-register -fno-jump-tables -mfunction-return=thunk-extern -fno-stack-protector -I./include -I./arch/x86/include -I./arch/x86/include/generated -DXEN_IMG_OFFSET=0x200000 -msoft-float -fno-pie -fno-exceptions -fno-asynchronous-unwind-tables -Wnested-externs -DHAVE_AS_QUOTED_SYM -DHAVE_AS_MOVDIR -DHAVE_AS_ENQCMD -DHAVE_AS_NOPS_DIRECTIVE -mno-red-zone -fpic -mno-mmx -mno-sse -mskip-rax-setup -fcf-protection=branch -mmanual-endbr -fno-jump-tables -mmemcpy-strategy=unrolled_loop:16:noalign,libcall:-1:noalign -mmemset-strategy=unrolled_loop:16:noalign,libcall:-1:noalign '-D__OBJECT_LABEL__=arch/x86/efi.lds' -DXEN_BUILD_EFI -DBUILD_ID_EFI -DEFI -DLINKER_SCRIPT -MQ arch/x86/efi.lds -o arch/x86/efi.lds arch/x86/xen.lds.S
+
+source_arch/x86/efi.lds := arch/x86/xen.lds.S
+
+deps_arch/x86/efi.lds := \
+    $(wildcard include/config/xen/align/2m.h) \
+    $(wildcard include/config/cc/split/sections.h) \
+    $(wildcard include/config/pvh/guest.h) \
+    $(wildcard include/config/hyperv/guest.h) \
+    $(wildcard include/config/kexec.h) \
+  include/xen/config.h \
+    $(wildcard include/config/enforce/unique/symbols.h) \
+    $(wildcard include/config/nr/cpus.h) \
+    $(wildcard include/config/debug.h) \
+  include/xen/kconfig.h \
+    $(wildcard include/config/booger.h) \
+    $(wildcard include/config/foo.h) \
+  arch/x86/include/asm/config.h \
+    $(wildcard include/config/paging/levels.h) \
+    $(wildcard include/config/have/efficient/unaligned/access.h) \
+    $(wildcard include/config/numa/emu.h) \
+    $(wildcard include/config/pagealloc/max/order.h) \
+    $(wildcard include/config/domu/max/order.h) \
+    $(wildcard include/config/hwdom/max/order.h) \
+    $(wildcard include/config/x86/l1/cache/shift.h) \
+    $(wildcard include/config/acpi/cstate.h) \
+    $(wildcard include/config/watchdog.h) \
+    $(wildcard include/config/multiboot.h) \
+    $(wildcard include/config/pv32.h) \
+    $(wildcard include/config/bigmem.h) \
+  include/xen/const.h \
+  include/xen/cache.h \
+  arch/x86/include/asm/cache.h \
+  include/xen/lib.h \
+    $(wildcard include/config/debug/trace.h) \
+  include/xen/macros.h \
+  include/xen/xen.lds.h \
+    $(wildcard include/config/ld/is/gnu.h) \
+    $(wildcard include/config/cc/is/clang.h) \
+    $(wildcard include/config/coverage.h) \
+    $(wildcard include/config/hypfs.h) \
+    $(wildcard include/config/debug/lock/profile.h) \
+    $(wildcard include/config/has/vpci.h) \
+  arch/x86/include/asm/gen-idt.lds.h \
+  arch/x86/include/asm/gen-idt.h \
+    $(wildcard include/config/pv.h) \
+  arch/x86/include/asm/page.h \
+  include/xen/page-size.h \
+  arch/x86/include/asm/page-bits.h \
+  arch/x86/include/asm/x86_64/page.h \
+  arch/x86/include/asm/trampoline.h \
+
+arch/x86/efi.lds: $(deps_arch/x86/efi.lds)
+
+$(deps_arch/x86/efi.lds):
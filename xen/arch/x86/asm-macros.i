@@ -0,0 +1,221 @@
+.macro clzero
+    .byte 0x0f, 0x01, 0xfc
+.endm
+.macro eretu
+    .byte 0xf3, 0x0f, 0x01, 0xca
+.endm
+.macro erets
+    .byte 0xf2, 0x0f, 0x01, 0xca
+.endm
+.macro tailcall fn:req
+    call \fn
+    BUG
+.endm
+.macro INDIRECT_CALL arg:req
+    .if 1 == 1
+        $done = 0
+        .irp reg, ax, cx, dx, bx, bp, si, di, 8, 9, 10, 11, 12, 13, 14, 15
+        .ifeqs "\arg", "%r\reg"
+            call __x86_indirect_thunk_r\reg
+            $done = 1
+           .exitm
+        .endif
+        .endr
+        .if $done != 1
+            .error "Bad register arg \arg"
+        .endif
+    .else
+        call *\arg
+    .endif
+.endm
+.macro guest_access_mask_ptr ptr:req, scratch1:req, scratch2:req
+    mov $((((((256 >> 8) * 0xffff000000000000) | (256 << 39))) + (1 << 39)*16) - 1), \scratch1
+    mov $(48 - 1), \scratch2
+    cmp \ptr, \scratch1
+    cmovnb \scratch2, \scratch1
+    xor \scratch2, \scratch2
+    btr \scratch1, \ptr
+    rcr $1, \scratch2
+    or \scratch2, \ptr
+.endm
+.macro altinstruction_entry orig, repl, feature, orig_len, repl_len, pad_len
+    .if ((\feature) & ~ALT_FLAG_NOT) >= NCAPINTS * 32
+        .error "alternative feature outside of featureset range"
+    .endif
+    .long \orig - .
+    .long \repl - .
+    .word \feature
+    .byte \orig_len
+    .byte \repl_len
+    .byte \pad_len
+    .byte 0
+.endm
+.macro mknops nr_bytes
+    .nops \nr_bytes, 9
+.endm
+.macro ALTERNATIVE oldinstr, newinstr, feature
+    .L\@_orig_s: \oldinstr; .L\@_orig_e: .L\@_diff = (.L\@_repl_e\()1 - .L\@_repl_s\()1) - (.L\@_orig_e - .L\@_orig_s); mknops (((.L\@_diff > 0) & 1) * .L\@_diff); .L\@_orig_p:
+    .pushsection .altinstructions, "a", @progbits
+    altinstruction_entry .L\@_orig_s, .L\@_repl_s1, \feature, (.L\@_orig_e - .L\@_orig_s), (.L\@_repl_e\()1 - .L\@_repl_s\()1), (.L\@_orig_p - .L\@_orig_e)
+    .section .discard, "a", @progbits
+    .byte (.L\@_orig_p - .L\@_orig_s)
+    .byte 0xff + (.L\@_repl_e\()1 - .L\@_repl_s\()1) - (.L\@_orig_p - .L\@_orig_s)
+    .section .altinstr_replacement, "ax", @progbits
+    .L\@_repl_s\()1: \newinstr; .L\@_repl_e\()1:
+    .popsection
+.endm
+.macro ALTERNATIVE_2 oldinstr, newinstr1, feature1, newinstr2, feature2
+    .L\@_orig_s: \oldinstr; .L\@_orig_e: .L\@_diff = (((.L\@_repl_e\()1 - .L\@_repl_s\()1)) ^ ((((.L\@_repl_e\()1 - .L\@_repl_s\()1)) ^ ((.L\@_repl_e\()2 - .L\@_repl_s\()2))) & -((((.L\@_repl_e\()1 - .L\@_repl_s\()1)) < ((.L\@_repl_e\()2 - .L\@_repl_s\()2))) & 1))) - (.L\@_orig_e - .L\@_orig_s); mknops (((.L\@_diff > 0) & 1) * .L\@_diff); .L\@_orig_p:
+    .pushsection .altinstructions, "a", @progbits
+    altinstruction_entry .L\@_orig_s, .L\@_repl_s1, \feature1, (.L\@_orig_e - .L\@_orig_s), (.L\@_repl_e\()1 - .L\@_repl_s\()1), (.L\@_orig_p - .L\@_orig_e)
+    altinstruction_entry .L\@_orig_s, .L\@_repl_s2, \feature2, (.L\@_orig_e - .L\@_orig_s), (.L\@_repl_e\()2 - .L\@_repl_s\()2), (.L\@_orig_p - .L\@_orig_e)
+    .section .discard, "a", @progbits
+    .byte (.L\@_orig_p - .L\@_orig_s)
+    .byte 0xff + (.L\@_repl_e\()1 - .L\@_repl_s\()1) - (.L\@_orig_p - .L\@_orig_s)
+    .byte 0xff + (.L\@_repl_e\()2 - .L\@_repl_s\()2) - (.L\@_orig_p - .L\@_orig_s)
+    .section .altinstr_replacement, "ax", @progbits
+    .L\@_repl_s\()1: \newinstr1; .L\@_repl_e\()1:
+    .ifnes "\newinstr2", "\newinstr1"
+    .L\@_repl_s\()2: \newinstr2; .L\@_repl_e\()2:
+    .else
+    .equiv .L\@_repl_s\()2, .L\@_repl_s\()1; .equiv .L\@_repl_e\()2, .L\@_repl_e\()1
+    .endif
+    .popsection
+.endm
+.macro DO_COND_IBPB
+    testb $(1 << 5), %bl
+    jz .L\@_skip
+    mov $0x00000049, %ecx
+    mov $(1 << 0), %eax
+    wrmsr
+.L\@_skip:
+.endm
+.macro DO_OVERWRITE_RSB tmp=rax, xu
+    mov $16, %ecx
+    mov %rsp, %\tmp
+.L\@_fill_rsb_loop\xu:
+    .irp n, 1, 2
+    call .L\@_insert_rsb_entry\xu\n
+    int3
+.L\@_insert_rsb_entry\xu\n:
+    .endr
+    sub $1, %ecx
+    jnz .L\@_fill_rsb_loop\xu
+    mov %\tmp, %rsp
+    mov $1, %ecx
+    rdsspd %ecx
+    cmp $1, %ecx
+    je .L\@_shstk_done\xu
+    mov $64, %ecx
+    incsspd %ecx
+.L\@_shstk_done\xu:
+.endm
+.macro SPEC_CTRL_COND_VERW scf=((CPUINFO_scf) - (CPUINFO_error_code)), sel=((CPUINFO_verw_sel) - (CPUINFO_error_code))
+    testb $(1 << 3), \scf(%rsp)
+    jz .L\@_verw_skip
+    verw \sel(%rsp)
+.L\@_verw_skip:
+.endm
+.macro DO_SPEC_CTRL_DIV
+    mov $1, %eax
+    div %al
+.endm
+.macro DO_SPEC_CTRL_ENTRY maybexen:req
+    mov $0x00000048, %ecx
+    xor %edx, %edx
+    .if \maybexen
+        xor %eax, %eax
+        testb $3, UREGS_cs(%rsp)
+        setnz %al
+        not %eax
+        and %al, STACK_CPUINFO_FIELD(scf)(%r14)
+        mov STACK_CPUINFO_FIELD(xen_spec_ctrl)(%r14), %eax
+    .else
+        andb $~(1 << 0), CPUINFO_scf(%rsp)
+        mov CPUINFO_xen_spec_ctrl(%rsp), %eax
+    .endif
+    wrmsr
+.endm
+.macro DO_SPEC_CTRL_EXIT_TO_GUEST
+    mov %eax, CPUINFO_shadow_spec_ctrl(%rsp)
+    orb $(1 << 0), CPUINFO_scf(%rsp)
+    mov $0x00000048, %ecx
+    xor %edx, %edx
+    wrmsr
+.endm
+.macro SPEC_CTRL_ENTRY_FROM_PV
+    movzbl STACK_CPUINFO_FIELD(scf)(%r14), %ebx
+    ALTERNATIVE "", DO_COND_IBPB, X86_FEATURE_IBPB_ENTRY_PV
+    ALTERNATIVE "", DO_OVERWRITE_RSB, X86_FEATURE_SC_RSB_PV
+    ALTERNATIVE "", __stringify(DO_SPEC_CTRL_ENTRY maybexen=0), X86_FEATURE_SC_MSR_PV
+    testb $(1 << 6), %bl
+    jz .L\@_skip_bhb
+    ALTERNATIVE_2 "", "call clear_bhb_loops", X86_SPEC_BHB_LOOPS, "call clear_bhb_tsx", X86_SPEC_BHB_TSX
+.L\@_skip_bhb:
+    ALTERNATIVE "lfence", "", X86_SPEC_NO_LFENCE_ENTRY_PV
+.endm
+.macro SPEC_CTRL_ENTRY_FROM_INTR
+    movzbl STACK_CPUINFO_FIELD(scf)(%r14), %ebx
+    testb $3, UREGS_cs(%rsp)
+    jz .L\@_skip
+    ALTERNATIVE "", DO_COND_IBPB, X86_FEATURE_IBPB_ENTRY_PV
+    ALTERNATIVE "", DO_OVERWRITE_RSB, X86_FEATURE_SC_RSB_PV
+.L\@_skip:
+    ALTERNATIVE "", __stringify(DO_SPEC_CTRL_ENTRY maybexen=1), X86_FEATURE_SC_MSR_PV
+    testb $(1 << 6), %bl
+    jz .L\@_skip_bhb
+    ALTERNATIVE_2 "", "call clear_bhb_loops", X86_SPEC_BHB_LOOPS, "call clear_bhb_tsx", X86_SPEC_BHB_TSX
+.L\@_skip_bhb:
+    ALTERNATIVE "lfence", "", X86_SPEC_NO_LFENCE_ENTRY_INTR
+.endm
+.macro SPEC_CTRL_EXIT_TO_PV
+    ALTERNATIVE "", DO_SPEC_CTRL_EXIT_TO_GUEST, X86_FEATURE_SC_MSR_PV
+    ALTERNATIVE "", DO_SPEC_CTRL_DIV, X86_FEATURE_SC_DIV
+.endm
+.macro SPEC_CTRL_ENTRY_FROM_INTR_IST
+    movzbl STACK_CPUINFO_FIELD(scf)(%r14), %ebx
+    test $(1 << 4), %bl
+    jz .L\@_skip_ibpb
+    mov $0x00000049, %ecx
+    mov $(1 << 0), %eax
+    wrmsr
+.L\@_skip_ibpb:
+    test $(1 << 2), %bl
+    jz .L\@_skip_rsb
+    DO_OVERWRITE_RSB
+.L\@_skip_rsb:
+    test $(1 << 1), %bl
+    jz .L\@_skip_msr_spec_ctrl
+    xor %eax, %eax
+    testb $3, UREGS_cs(%rsp)
+    setnz %al
+    not %eax
+    and %al, STACK_CPUINFO_FIELD(scf)(%r14)
+    mov $0x00000048, %ecx
+    mov STACK_CPUINFO_FIELD(xen_spec_ctrl)(%r14), %eax
+    wrmsr
+.L\@_skip_msr_spec_ctrl:
+    testb $(1 << 6), %bl
+    jz .L\@_skip_bhb
+    ALTERNATIVE_2 "", "call clear_bhb_loops", X86_SPEC_BHB_LOOPS, "call clear_bhb_tsx", X86_SPEC_BHB_TSX
+.L\@_skip_bhb:
+    lfence
+.endm
+.macro SPEC_CTRL_EXIT_TO_XEN
+    movzbl STACK_CPUINFO_FIELD(scf)(%r14), %ebx
+    testb $(1 << 1), %bl
+    jz .L\@_skip_sc_msr
+    xor %edx, %edx
+    testb $(1 << 0), %bl
+    jz .L\@_skip_sc_msr
+    mov STACK_CPUINFO_FIELD(shadow_spec_ctrl)(%r14), %eax
+    mov $0x00000048, %ecx
+    wrmsr
+.L\@_skip_sc_msr:
+    test %r12, %r12
+    jz .L\@_skip_ist_exit
+    or $(0xe010 << 16), %ebx
+    mov %ebx, UREGS_eflags + 4(%rsp)
+    ALTERNATIVE "", DO_SPEC_CTRL_DIV, X86_FEATURE_SC_DIV
+.L\@_skip_ist_exit:
+.endm
@@ -0,0 +1 @@
+cmd_arch/x86/boot/built_in.o := ld    -melf_x86_64 --no-warn-rwx-segments -r -o arch/x86/boot/built_in.o arch/x86/boot/head.o arch/x86/boot/built-in-32.o arch/x86/boot/reloc-trampoline.o
@@ -0,0 +1,44 @@
+cmd_arch/x86/boot/reloc-trampoline.32.o := gcc -MMD -MP -MF arch/x86/boot/.reloc-trampoline.32.o.d -m32 -march=i686 -DBUILD_ID -fno-strict-aliasing -std=gnu99 -Wall -Wstrict-prototypes -Wno-unused-but-set-variable -Wno-unused-local-typedefs   -fno-pie -fno-exceptions -fno-asynchronous-unwind-tables -Werror -fno-builtin -g0 -msoft-float -mregparm=3 -fno-stack-protector -nostdinc -include ./include/xen/config.h -O1 -I./include -I./arch/x86/include -I./arch/x86/include/generated -D__XEN__ -fpic '-D__OBJECT_LABEL__=arch/x86/boot/reloc-trampoline.32.o'    -c arch/x86/boot/reloc-trampoline.c -o arch/x86/boot/.reloc-trampoline.32.o.tmp -MQ arch/x86/boot/reloc-trampoline.32.o
+
+source_arch/x86/boot/reloc-trampoline.32.o := arch/x86/boot/reloc-trampoline.c
+
+deps_arch/x86/boot/reloc-trampoline.32.o := \
+  include/xen/config.h \
+    $(wildcard include/config/enforce/unique/symbols.h) \
+    $(wildcard include/config/nr/cpus.h) \
+    $(wildcard include/config/debug.h) \
+  include/xen/kconfig.h \
+    $(wildcard include/config/booger.h) \
+    $(wildcard include/config/foo.h) \
+  include/xen/compiler.h \
+    $(wildcard include/config/cc/is/gcc.h) \
+    $(wildcard include/config/riscv.h) \
+    $(wildcard include/config/gcc/version.h) \
+    $(wildcard include/config/cc/is/clang.h) \
+    $(wildcard include/config/clang/version.h) \
+    $(wildcard include/config/xen/ibt.h) \
+    $(wildcard include/config/cc/has/asm/inline.h) \
+  arch/x86/include/asm/config.h \
+    $(wildcard include/config/paging/levels.h) \
+    $(wildcard include/config/have/efficient/unaligned/access.h) \
+    $(wildcard include/config/numa/emu.h) \
+    $(wildcard include/config/pagealloc/max/order.h) \
+    $(wildcard include/config/domu/max/order.h) \
+    $(wildcard include/config/hwdom/max/order.h) \
+    $(wildcard include/config/x86/l1/cache/shift.h) \
+    $(wildcard include/config/acpi/cstate.h) \
+    $(wildcard include/config/watchdog.h) \
+    $(wildcard include/config/multiboot.h) \
+    $(wildcard include/config/pv32.h) \
+    $(wildcard include/config/bigmem.h) \
+  include/xen/const.h \
+  include/xen/stdint.h \
+  arch/x86/include/asm/boot-helpers.h \
+  arch/x86/include/asm/trampoline.h \
+  include/xen/types.h \
+  include/xen/stdbool.h \
+  arch/x86/include/asm/types.h \
+
+arch/x86/boot/reloc-trampoline.32.o: $(deps_arch/x86/boot/reloc-trampoline.32.o)
+
+$(deps_arch/x86/boot/reloc-trampoline.32.o):
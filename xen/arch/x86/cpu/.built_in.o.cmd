@@ -0,0 +1 @@
+cmd_arch/x86/cpu/built_in.o := ld    -melf_x86_64 --no-warn-rwx-segments -r -o arch/x86/cpu/built_in.o arch/x86/cpu/mcheck/built_in.o arch/x86/cpu/microcode/built_in.o arch/x86/cpu/mtrr/built_in.o arch/x86/cpu/amd.o arch/x86/cpu/centaur.o arch/x86/cpu/common.o arch/x86/cpu/hygon.o arch/x86/cpu/intel.o arch/x86/cpu/intel_cacheinfo.o arch/x86/cpu/mwait-idle.o arch/x86/cpu/shanghai.o arch/x86/cpu/vpmu.o arch/x86/cpu/vpmu_amd.o arch/x86/cpu/vpmu_intel.o
@@ -44,6 +44,7 @@
 #include <asm/cpuidle.h>
 #include <asm/debugreg.h>
 #include <asm/desc.h>
+#include <asm/exit-stats.h>
 #include <asm/fsgsbase.h>
 #include <asm/guest-msr.h>
 #include <asm/hvm/hvm.h>
@@ -528,6 +529,9 @@ int arch_vcpu_create(struct vcpu *v)
 
         if ( (rc = init_vcpu_msr_policy(v)) )
             goto fail;
+
+        if ( (rc = exit_stats_vcpu_init(v)) )
+            goto fail;
     }
     else if ( (rc = xstate_alloc_save_area(v)) != 0 )
         return rc;
@@ -568,6 +572,7 @@ int arch_vcpu_create(struct vcpu *v)
     vcpu_destroy_fpu(v);
     xfree(v->arch.msrs);
     v->arch.msrs = NULL;
+    exit_stats_vcpu_destroy(v);
 
     return rc;
 }
@@ -582,6 +587,8 @@ void arch_vcpu_destroy(struct vcpu *v)
     xfree(v->arch.msrs);
     v->arch.msrs = NULL;
 
+    exit_stats_vcpu_destroy(v);
+
     if ( is_hvm_vcpu(v) )
         hvm_vcpu_destroy(v);
     else if ( IS_ENABLED(CONFIG_PV) )
@@ -24,6 +24,7 @@
 
 #include <asm/acpi.h>
 #include <asm/cpu-policy.h>
+#include <asm/exit-stats.h>
 #include <asm/gdbsx.h>
 #include <asm/guest-msr.h>
 #include <asm/hvm/emulate.h>
@@ -1318,6 +1319,21 @@ long arch_do_domctl(
 
         break;
 
+    case XEN_DOMCTL_get_exit_stats:
+    {
+        struct xen_domctl_exit_stats *es = &domctl->u.exit_stats;
+        struct vcpu *v;
+
+        ret = -ESRCH;
+        if ( (es->vcpu >= d->max_vcpus) || ((v = d->vcpu[es->vcpu]) == NULL) )
+            break;
+
+        ret = exit_stats_get(v, es);
+        if ( !ret )
+            copyback = true;
+        break;
+    }
+
     case XEN_DOMCTL_get_cpu_policy:
         /* Process the CPUID leaves. */
         if ( guest_handle_is_null(domctl->u.cpu_policy.leaves) )
@@ -0,0 +1 @@
+../../../common/efi/ebmalloc.c
\ No newline at end of file
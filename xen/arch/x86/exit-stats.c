@@ -0,0 +1,84 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/*
+ * exit-stats.c: Per-vCPU VM exit and hypercall statistics.
+ *
+ * The statistics of a vCPU are only updated by the vCPU itself, so they need
+ * no locking.  They are read racily by XEN_DOMCTL_get_exit_stats, which may
+ * see a count and time of an exit being accounted that do not match.
+ */
+
+#include <xen/guest_access.h>
+#include <xen/sched.h>
+#include <xen/xvmalloc.h>
+
+#include <asm/exit-stats.h>
+#include <asm/hvm/hvm.h>
+
+int exit_stats_vcpu_init(struct vcpu *v)
+{
+    v->arch.exit_stats =
+        xvzalloc_flex_struct(struct vcpu_exit_stats, exits,
+                             is_hvm_vcpu(v) ? EXIT_STATS_NR_EXITS : 0);
+
+    return v->arch.exit_stats ? 0 : -ENOMEM;
+}
+
+void exit_stats_vcpu_destroy(struct vcpu *v)
+{
+    XVFREE(v->arch.exit_stats);
+}
+
+void exit_stats_account(struct xen_domctl_exit_stat *stat, s_time_t delta)
+{
+    unsigned int bucket = delta >> 7 ? flsl(delta >> 7) : 0;
+
+    stat->count++;
+    stat->ns += delta;
+    stat->hist[min(bucket, XEN_DOMCTL_EXIT_STATS_BUCKETS - 1U)]++;
+}
+
+static int copy_stats(XEN_GUEST_HANDLE_64(xen_domctl_exit_stat_t) hnd,
+                      uint32_t *nr, const struct xen_domctl_exit_stat *stats,
+                      unsigned int nr_stats)
+{
+    unsigned int n = min(*nr, nr_stats);
+
+    *nr = nr_stats;
+
+    return n && copy_to_guest(hnd, stats, n) ? -EFAULT : 0;
+}
+
+int exit_stats_get(struct vcpu *v, struct xen_domctl_exit_stats *op)
+{
+    const struct vcpu_exit_stats *stats = v->arch.exit_stats;
+    int rc;
+
+    if ( !stats )
+        return -ENODATA;
+
+    if ( !is_hvm_vcpu(v) )
+        op->type = XEN_DOMCTL_EXIT_STATS_pv;
+    else if ( using_vmx() )
+        op->type = XEN_DOMCTL_EXIT_STATS_vmx;
+    else
+        op->type = XEN_DOMCTL_EXIT_STATS_svm;
+
+    rc = copy_stats(op->exits, &op->nr_exits, stats->exits,
+                    op->type == XEN_DOMCTL_EXIT_STATS_pv ? 0
+                                                         : EXIT_STATS_NR_EXITS);
+    if ( !rc )
+        rc = copy_stats(op->hypercalls, &op->nr_hypercalls, stats->hypercalls,
+                        NR_hypercalls);
+
+    return rc;
+}
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * tab-width: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1 @@
+cmd_arch/x86/genapic/built_in.o := ld    -melf_x86_64 --no-warn-rwx-segments -r -o arch/x86/genapic/built_in.o arch/x86/genapic/bigsmp.o arch/x86/genapic/x2apic.o arch/x86/genapic/default.o arch/x86/genapic/delivery.o arch/x86/genapic/probe.o
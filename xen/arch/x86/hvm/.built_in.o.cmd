@@ -0,0 +1 @@
+cmd_arch/x86/hvm/built_in.o := ld    -melf_x86_64 --no-warn-rwx-segments -r -o arch/x86/hvm/built_in.o arch/x86/hvm/svm/built_in.o arch/x86/hvm/viridian/built_in.o arch/x86/hvm/vmx/built_in.o arch/x86/hvm/asid.o arch/x86/hvm/dm.o arch/x86/hvm/domain.o arch/x86/hvm/emulate.o arch/x86/hvm/grant_table.o arch/x86/hvm/hpet.o arch/x86/hvm/hvm.o arch/x86/hvm/hypercall.o arch/x86/hvm/intercept.o arch/x86/hvm/io.o arch/x86/hvm/ioreq.o arch/x86/hvm/irq.o arch/x86/hvm/mmio.o arch/x86/hvm/monitor.o arch/x86/hvm/mtrr.o arch/x86/hvm/nestedhvm.o arch/x86/hvm/pmtimer.o arch/x86/hvm/quirks.o arch/x86/hvm/rtc.o arch/x86/hvm/save.o arch/x86/hvm/stdvga.o arch/x86/hvm/vioapic.o arch/x86/hvm/vlapic.o arch/x86/hvm/vm_event.o arch/x86/hvm/vmsi.o arch/x86/hvm/vpic.o arch/x86/hvm/vpt.o arch/x86/hvm/dom0_build.init.o
@@ -7,8 +7,10 @@
 #include <xen/guest_access.h>
 #include <xen/dm.h>
 #include <xen/hypercall.h>
+#include <xen/iommu.h>
 #include <xen/ioreq.h>
 #include <xen/nospec.h>
+#include <xen/pci.h>
 #include <xen/sched.h>
 
 #include <asm/hap.h>
@@ -415,12 +417,16 @@ int dm_op(const struct dmop_args *op_args)
         /*
          * Iterate p2m table when an ioreq server unmaps from p2m_ioreq_server,
          * and reset the remaining p2m_ioreq_server entries back to p2m_ram_rw.
+         * Entries still marked for re-calculation may also block DMA through
+         * an IOMMU sharing the p2m, so with devices assigned all of them get
+         * resolved.
          */
         if ( rc == 0 && data->flags == 0 )
         {
             struct p2m_domain *p2m = p2m_get_hostp2m(d);
+            bool resolve_all = iommu_use_hap_pt(d) && has_arch_pdevs(d);
 
-            while ( read_atomic(&p2m->ioreq.entry_count) &&
+            while ( (read_atomic(&p2m->ioreq.entry_count) || resolve_all) &&
                     first_gfn <= p2m->max_mapped_pfn )
             {
                 /* Iterate p2m table for 256 gfns each time. */
@@ -439,6 +445,10 @@ int dm_op(const struct dmop_args *op_args)
                     break;
                 }
             }
+
+            /* The entries resolved may be cached with their old permissions. */
+            if ( rc == 0 && resolve_all )
+                rc = iommu_iotlb_flush_all(d, IOMMU_FLUSHF_modified);
         }
 
         break;
@@ -11,6 +11,7 @@
 #include <xen/ioreq.h>
 #include <xen/nospec.h>
 
+#include <asm/exit-stats.h>
 #include <asm/hvm/emulate.h>
 #include <asm/hvm/support.h>
 #include <asm/hvm/viridian.h>
@@ -109,6 +110,7 @@ int hvm_hypercall(struct cpu_user_regs *regs)
     int mode = hvm_guest_x86_mode(curr);
     unsigned long eax = regs->eax;
     unsigned int token;
+    s_time_t start;
 
     switch ( mode )
     {
@@ -155,6 +157,8 @@ int hvm_hypercall(struct cpu_user_regs *regs)
 
     curr->hcall_preempted = false;
 
+    start = exit_stats_hypercall_start();
+
     if ( mode == X86_MODE_64BIT )
     {
         HVM_DBG_LOG(DBG_LEVEL_HCALL, "hcall%lu(%lx, %lx, %lx, %lx, %lx)",
@@ -180,6 +184,8 @@ int hvm_hypercall(struct cpu_user_regs *regs)
             clobber_regs(regs, eax, hvm, 32);
     }
 
+    exit_stats_hypercall_end(curr, eax, start);
+
     hvmemul_cache_restore(curr, token);
 
     HVM_DBG_LOG(DBG_LEVEL_HCALL, "hcall%lu -> %lx", eax, regs->rax);
@@ -0,0 +1 @@
+cmd_arch/x86/hvm/svm/built_in.o := ld    -melf_x86_64 --no-warn-rwx-segments -r -o arch/x86/hvm/svm/built_in.o arch/x86/hvm/svm/asid.o arch/x86/hvm/svm/emulate.o arch/x86/hvm/svm/intr.o arch/x86/hvm/svm/nestedsvm.o arch/x86/hvm/svm/svm.o arch/x86/hvm/svm/vmcb.o arch/x86/hvm/svm/entry.o
@@ -18,6 +18,7 @@
 #include <asm/cpufeature.h>
 #include <asm/current.h>
 #include <asm/debugreg.h>
+#include <asm/exit-stats.h>
 #include <asm/gdbsx.h>
 #include <asm/guest-msr.h>
 #include <asm/hvm/emulate.h>
@@ -972,6 +973,8 @@ void asmlinkage svm_vmenter_helper(void)
 
     svm_asid_handle_vmrun();
 
+    exit_stats_entry(curr);
+
     TRACE_TIME(TRC_HVM_VMENTRY |
                (nestedhvm_vcpu_in_guestmode(curr) ? TRC_HVM_NESTEDFLAG : 0));
 
@@ -2613,6 +2616,10 @@ void asmlinkage svm_vmexit_handler(void)
                 exit_reason < VMEXIT_NPF
                 ? exit_reason
                 : exit_reason - VMEXIT_NPF + VMEXIT_NPF_PERFC);
+    exit_stats_exit(v,
+                    exit_reason < XEN_DOMCTL_EXIT_STATS_SVM_NPF ? exit_reason :
+                    exit_reason < VMEXIT_NPF ? ~0U :
+                    exit_reason - VMEXIT_NPF + XEN_DOMCTL_EXIT_STATS_SVM_NPF);
 
     hvm_maybe_deassert_evtchn_irq();
 
@@ -0,0 +1,162 @@
+/*
+ * DO NOT MODIFY.
+ *
+ * This file was auto-generated from asm-offsets.s
+ *
+ */
+
+#ifndef __ASM_OFFSETS_H__
+#define __ASM_OFFSETS_H__
+
+#define UREGS_r15 0 /* offsetof(struct cpu_user_regs, r15) */
+#define UREGS_r14 8 /* offsetof(struct cpu_user_regs, r14) */
+#define UREGS_r13 16 /* offsetof(struct cpu_user_regs, r13) */
+#define UREGS_r12 24 /* offsetof(struct cpu_user_regs, r12) */
+#define UREGS_rbp 32 /* offsetof(struct cpu_user_regs, rbp) */
+#define UREGS_rbx 40 /* offsetof(struct cpu_user_regs, rbx) */
+#define UREGS_r11 48 /* offsetof(struct cpu_user_regs, r11) */
+#define UREGS_r10 56 /* offsetof(struct cpu_user_regs, r10) */
+#define UREGS_r9 64 /* offsetof(struct cpu_user_regs, r9) */
+#define UREGS_r8 72 /* offsetof(struct cpu_user_regs, r8) */
+#define UREGS_rax 80 /* offsetof(struct cpu_user_regs, rax) */
+#define UREGS_rcx 88 /* offsetof(struct cpu_user_regs, rcx) */
+#define UREGS_rdx 96 /* offsetof(struct cpu_user_regs, rdx) */
+#define UREGS_rsi 104 /* offsetof(struct cpu_user_regs, rsi) */
+#define UREGS_rdi 112 /* offsetof(struct cpu_user_regs, rdi) */
+#define UREGS_error_code 120 /* offsetof(struct cpu_user_regs, error_code) */
+#define UREGS_entry_vector 124 /* offsetof(struct cpu_user_regs, entry_vector) */
+#define UREGS_rip 128 /* offsetof(struct cpu_user_regs, rip) */
+#define UREGS_cs 136 /* offsetof(struct cpu_user_regs, cs) */
+#define UREGS_eflags 144 /* offsetof(struct cpu_user_regs, rflags) */
+#define UREGS_rsp 152 /* offsetof(struct cpu_user_regs, rsp) */
+#define UREGS_ss 160 /* offsetof(struct cpu_user_regs, ss) */
+#define UREGS_kernel_sizeof 168 /* sizeof(struct cpu_user_regs) */
+
+#define EFRAME_entry_vector 4 /* offsetof(struct cpu_user_regs, entry_vector) - offsetof(struct cpu_user_regs, error_code) */
+#define EFRAME_rip 8 /* offsetof(struct cpu_user_regs, rip) - offsetof(struct cpu_user_regs, error_code) */
+#define EFRAME_cs 16 /* offsetof(struct cpu_user_regs, cs) - offsetof(struct cpu_user_regs, error_code) */
+#define EFRAME_eflags 24 /* offsetof(struct cpu_user_regs, eflags) - offsetof(struct cpu_user_regs, error_code) */
+#define EFRAME_shadow_scf 28 /* offsetof(struct cpu_user_regs, eflags) - offsetof(struct cpu_user_regs, error_code) +4 */
+#define EFRAME_shadow_sel 30 /* offsetof(struct cpu_user_regs, eflags) - offsetof(struct cpu_user_regs, error_code) +6 */
+#define EFRAME_rsp 32 /* offsetof(struct cpu_user_regs, rsp) - offsetof(struct cpu_user_regs, error_code) */
+
+#define VCPU_processor 4 /* offsetof(struct vcpu, processor) */
+#define VCPU_domain 24 /* offsetof(struct vcpu, domain) */
+#define VCPU_vcpu_info 16 /* offsetof(struct vcpu, vcpu_info_area.map) */
+#define VCPU_trap_bounce 1400 /* offsetof(struct vcpu, arch.pv.trap_bounce) */
+#define VCPU_thread_flags 848 /* offsetof(struct vcpu, arch.flags) */
+#define VCPU_event_addr 1320 /* offsetof(struct vcpu, arch.pv.event_callback_eip) */
+#define VCPU_event_sel 1336 /* offsetof(struct vcpu, arch.pv.event_callback_cs) */
+#define VCPU_syscall_addr 1336 /* offsetof(struct vcpu, arch.pv.syscall_callback_eip) */
+#define VCPU_syscall32_addr 1344 /* offsetof(struct vcpu, arch.pv.syscall32_callback_eip) */
+#define VCPU_syscall32_sel 1360 /* offsetof(struct vcpu, arch.pv.syscall32_callback_cs) */
+#define VCPU_syscall32_disables_events 1364 /* offsetof(struct vcpu, arch.pv.syscall32_disables_events) */
+#define VCPU_sysenter_addr 1352 /* offsetof(struct vcpu, arch.pv.sysenter_callback_eip) */
+#define VCPU_sysenter_sel 1362 /* offsetof(struct vcpu, arch.pv.sysenter_callback_cs) */
+#define VCPU_sysenter_disables_events 1365 /* offsetof(struct vcpu, arch.pv.sysenter_disables_events) */
+#define VCPU_trap_ctxt 1104 /* offsetof(struct vcpu, arch.pv.trap_ctxt) */
+#define VCPU_kernel_sp 1248 /* offsetof(struct vcpu, arch.pv.kernel_sp) */
+#define VCPU_kernel_ss 1240 /* offsetof(struct vcpu, arch.pv.kernel_ss) */
+#define VCPU_iopl 1428 /* offsetof(struct vcpu, arch.pv.iopl) */
+#define VCPU_guest_context_flags 1096 /* offsetof(struct vcpu, arch.pv.vgc_flags) */
+#define VCPU_cr3 2536 /* offsetof(struct vcpu, arch.cr3) */
+#define VCPU_arch_msrs 3120 /* offsetof(struct vcpu, arch.msrs) */
+#define VCPU_nmi_pending 920 /* offsetof(struct vcpu, arch.async_exception_state[(1)-1].pending) */
+#define VCPU_mce_pending 922 /* offsetof(struct vcpu, arch.async_exception_state[(2)-1].pending) */
+#define VCPU_nmi_old_mask 921 /* offsetof(struct vcpu, arch.async_exception_state[(1)-1].old_mask) */
+#define VCPU_mce_old_mask 923 /* offsetof(struct vcpu, arch.async_exception_state[(2)-1].old_mask) */
+#define VCPU_async_exception_mask 924 /* offsetof(struct vcpu, arch.async_exception_mask) */
+#define VCPU_TRAP_NMI 1 /* VCPU_TRAP_NMI */
+#define VCPU_TRAP_MCE 2 /* VCPU_TRAP_MCE */
+#define _VGCF_syscall_disables_events 4 /* _VGCF_syscall_disables_events */
+
+#define VCPU_svm_vmcb_pa 1424 /* offsetof(struct vcpu, arch.hvm.svm.vmcb_pa) */
+#define VCPU_svm_vmcb 1408 /* offsetof(struct vcpu, arch.hvm.svm.vmcb) */
+
+#define VCPU_vmx_launched 1452 /* offsetof(struct vcpu, arch.hvm.vmx.launched) */
+#define VCPU_vmx_realmode 1666 /* offsetof(struct vcpu, arch.hvm.vmx.vmx_realmode) */
+#define VCPU_vmx_emulate 1667 /* offsetof(struct vcpu, arch.hvm.vmx.vmx_emulate) */
+#define VCPU_vm86_seg_mask 1670 /* offsetof(struct vcpu, arch.hvm.vmx.vm86_segment_mask) */
+#define VCPU_hvm_guest_cr2 976 /* offsetof(struct vcpu, arch.hvm.guest_cr[2]) */
+
+#define VCPU_nhvm_guestmode 1896 /* offsetof(struct vcpu, arch.hvm.nvcpu.nv_guestmode) */
+#define VCPU_nhvm_p2m 2096 /* offsetof(struct vcpu, arch.hvm.nvcpu.nv_p2m) */
+#define VCPU_nsvm_hap_enabled 2053 /* offsetof(struct vcpu, arch.hvm.nvcpu.u.nsvm.ns_hap_enabled) */
+
+#define VCPUINFO_upcall_pending 0 /* offsetof(struct vcpu_info, evtchn_upcall_pending) */
+#define VCPUINFO_upcall_mask 1 /* offsetof(struct vcpu_info, evtchn_upcall_mask) */
+
+#define CPUINFO_guest_cpu_user_regs 0 /* offsetof(struct cpu_info, guest_cpu_user_regs) */
+#define CPUINFO_error_code 120 /* offsetof(struct cpu_info, guest_cpu_user_regs.error_code) */
+#define CPUINFO_rip 128 /* offsetof(struct cpu_info, guest_cpu_user_regs.rip) */
+#define CPUINFO_processor_id 184 /* offsetof(struct cpu_info, processor_id) */
+#define CPUINFO_verw_sel 188 /* offsetof(struct cpu_info, verw_sel) */
+#define CPUINFO_current_vcpu 192 /* offsetof(struct cpu_info, current_vcpu) */
+#define CPUINFO_per_cpu_offset 200 /* offsetof(struct cpu_info, per_cpu_offset) */
+#define CPUINFO_cr4 208 /* offsetof(struct cpu_info, cr4) */
+#define CPUINFO_xen_cr3 216 /* offsetof(struct cpu_info, xen_cr3) */
+#define CPUINFO_pv_cr3 224 /* offsetof(struct cpu_info, pv_cr3) */
+#define CPUINFO_shadow_spec_ctrl 232 /* offsetof(struct cpu_info, shadow_spec_ctrl) */
+#define CPUINFO_xen_spec_ctrl 236 /* offsetof(struct cpu_info, xen_spec_ctrl) */
+#define CPUINFO_last_spec_ctrl 240 /* offsetof(struct cpu_info, last_spec_ctrl) */
+#define CPUINFO_scf 244 /* offsetof(struct cpu_info, scf) */
+#define CPUINFO_root_pgt_changed 245 /* offsetof(struct cpu_info, root_pgt_changed) */
+#define CPUINFO_use_pv_cr3 246 /* offsetof(struct cpu_info, use_pv_cr3) */
+#define CPUINFO_sizeof 248 /* sizeof(struct cpu_info) */
+
+#define TRAPINFO_eip 8 /* offsetof(struct trap_info, address) */
+#define TRAPINFO_cs 2 /* offsetof(struct trap_info, cs) */
+#define TRAPINFO_flags 1 /* offsetof(struct trap_info, flags) */
+#define TRAPINFO_sizeof 16 /* sizeof(struct trap_info) */
+
+#define TRAPBOUNCE_error_code 0 /* offsetof(struct trap_bounce, error_code) */
+#define TRAPBOUNCE_flags 4 /* offsetof(struct trap_bounce, flags) */
+#define TRAPBOUNCE_cs 6 /* offsetof(struct trap_bounce, cs) */
+#define TRAPBOUNCE_eip 8 /* offsetof(struct trap_bounce, eip) */
+
+#define VCPUMSR_spec_ctrl_raw 0 /* offsetof(struct vcpu_msrs, spec_ctrl.raw) */
+
+#define ASM_PERFC_exceptions 0 /* PERFC_exceptions */
+
+#define IRQSTAT_shift 7 /* ilog2(sizeof(irq_cpustat_t)) */
+#define IRQSTAT_softirq_pending 0 /* offsetof(irq_cpustat_t, __softirq_pending) */
+
+#define CPUINFO_features 16 /* offsetof(struct cpuinfo_x86, x86_capability) */
+
+#define MB_flags 0 /* offsetof(multiboot_info_t, flags) */
+#define MB_cmdline 16 /* offsetof(multiboot_info_t, cmdline) */
+#define MB_mem_lower 4 /* offsetof(multiboot_info_t, mem_lower) */
+
+#define MB2_fixed_sizeof 8 /* sizeof(multiboot2_fixed_t) */
+#define MB2_fixed_total_size 0 /* offsetof(multiboot2_fixed_t, total_size) */
+#define MB2_tag_type 0 /* offsetof(multiboot2_tag_t, type) */
+#define MB2_tag_size 4 /* offsetof(multiboot2_tag_t, size) */
+#define MB2_load_base_addr 8 /* offsetof(multiboot2_tag_load_base_addr_t, load_base_addr) */
+#define MB2_mem_lower 8 /* offsetof(multiboot2_tag_basic_meminfo_t, mem_lower) */
+#define MB2_efi64_st 8 /* offsetof(multiboot2_tag_efi64_t, pointer) */
+#define MB2_efi64_ih 8 /* offsetof(multiboot2_tag_efi64_ih_t, pointer) */
+#define MB2_tag_string 8 /* offsetof(multiboot2_tag_string_t, string) */
+
+#define DOMAIN_vm_assist 616 /* offsetof(struct domain, vm_assist) */
+
+#define BVI_cursor_pos 0 /* offsetof(struct boot_video_info, orig_x) */
+#define BVI_video_mode 2 /* offsetof(struct boot_video_info, orig_video_mode) */
+#define BVI_video_cols 3 /* offsetof(struct boot_video_info, orig_video_cols) */
+#define BVI_video_lines 4 /* offsetof(struct boot_video_info, orig_video_lines) */
+#define BVI_have_vga 5 /* offsetof(struct boot_video_info, orig_video_isVGA) */
+#define BVI_font_points 6 /* offsetof(struct boot_video_info, orig_video_points) */
+#define BVI_capabilities 8 /* offsetof(struct boot_video_info, capabilities) */
+#define BVI_lfb_linelength 12 /* offsetof(struct boot_video_info, lfb_linelength) */
+#define BVI_lfb_width 14 /* offsetof(struct boot_video_info, lfb_width) */
+#define BVI_lfb_height 16 /* offsetof(struct boot_video_info, lfb_height) */
+#define BVI_lfb_depth 18 /* offsetof(struct boot_video_info, lfb_depth) */
+#define BVI_lfb_base 20 /* offsetof(struct boot_video_info, lfb_base) */
+#define BVI_lfb_size 24 /* offsetof(struct boot_video_info, lfb_size) */
+#define BVI_lfb_colors 28 /* offsetof(struct boot_video_info, colors) */
+#define BVI_vesapm_seg 36 /* offsetof(struct boot_video_info, vesapm.seg) */
+#define BVI_vesapm_off 38 /* offsetof(struct boot_video_info, vesapm.off) */
+#define BVI_vesa_attrib 40 /* offsetof(struct boot_video_info, vesa_attrib) */
+#define BVI_size 44 /* sizeof(struct boot_video_info) */
+
+
+#endif
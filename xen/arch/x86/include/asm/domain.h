@@ -680,6 +680,10 @@ struct arch_vcpu
 
     struct arch_vm_event *vm_event;
 
+#ifdef CONFIG_EXIT_STATS
+    struct vcpu_exit_stats *exit_stats;
+#endif
+
     struct vcpu_msrs *msrs;
 
     struct {
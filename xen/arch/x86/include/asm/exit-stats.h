@@ -0,0 +1,94 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+#ifndef ASM_X86_EXIT_STATS_H
+#define ASM_X86_EXIT_STATS_H
+
+#include <xen/errno.h>
+#include <xen/nospec.h>
+#include <xen/sched.h>
+#include <xen/time.h>
+
+#include <public/domctl.h>
+
+struct xen_domctl_exit_stats;
+
+#ifdef CONFIG_EXIT_STATS
+
+#define EXIT_STATS_NR_EXITS   (XEN_DOMCTL_EXIT_STATS_SVM_NPF + 1)
+
+struct vcpu_exit_stats {
+    s_time_t exit_start;          /* 0 when not handling an exit. */
+    unsigned int exit_reason;
+    struct xen_domctl_exit_stat hypercalls[NR_hypercalls];
+    /* EXIT_STATS_NR_EXITS for HVM vCPUs, none for PV ones. */
+    struct xen_domctl_exit_stat exits[];
+};
+
+int exit_stats_vcpu_init(struct vcpu *v);
+void exit_stats_vcpu_destroy(struct vcpu *v);
+int exit_stats_get(struct vcpu *v, struct xen_domctl_exit_stats *op);
+
+void exit_stats_account(struct xen_domctl_exit_stat *stat, s_time_t delta);
+
+/*
+ * Called by the VM exit handlers with the exit reason, and when entering
+ * the guest.  An exit reason out of range is not accounted.
+ */
+static inline void exit_stats_exit(struct vcpu *v, unsigned int reason)
+{
+    struct vcpu_exit_stats *stats = v->arch.exit_stats;
+
+    if ( stats && reason < EXIT_STATS_NR_EXITS )
+    {
+        stats->exit_reason = reason;
+        stats->exit_start = NOW();
+    }
+}
+
+static inline void exit_stats_entry(struct vcpu *v)
+{
+    struct vcpu_exit_stats *stats = v->arch.exit_stats;
+
+    if ( stats && stats->exit_start )
+    {
+        exit_stats_account(&stats->exits[stats->exit_reason],
+                           NOW() - stats->exit_start);
+        stats->exit_start = 0;
+    }
+}
+
+/* Bracket the dispatch of a hypercall. */
+static inline s_time_t exit_stats_hypercall_start(void)
+{
+    return NOW();
+}
+
+static inline void exit_stats_hypercall_end(struct vcpu *v, unsigned long nr,
+                                            s_time_t start)
+{
+    struct vcpu_exit_stats *stats = v->arch.exit_stats;
+
+    if ( stats && nr < NR_hypercalls )
+    {
+        nr = array_index_nospec(nr, NR_hypercalls);
+        exit_stats_account(&stats->hypercalls[nr], NOW() - start);
+    }
+}
+
+#else
+
+static inline int exit_stats_vcpu_init(struct vcpu *v) { return 0; }
+static inline void exit_stats_vcpu_destroy(struct vcpu *v) {}
+static inline int exit_stats_get(struct vcpu *v,
+                                 struct xen_domctl_exit_stats *op)
+{
+    return -EOPNOTSUPP;
+}
+static inline void exit_stats_exit(struct vcpu *v, unsigned int reason) {}
+static inline void exit_stats_entry(struct vcpu *v) {}
+static inline s_time_t exit_stats_hypercall_start(void) { return 0; }
+static inline void exit_stats_hypercall_end(struct vcpu *v, unsigned long nr,
+                                            s_time_t start) {}
+
+#endif /* CONFIG_EXIT_STATS */
+
+#endif /* ASM_X86_EXIT_STATS_H */
@@ -52,6 +52,7 @@ struct arch_iommu
         struct {
             unsigned int paging_mode;
             struct page_info *root_table;
+            struct page_info *gcr3_table; /* when sharing HAP tables */
         } amd;
     };
 };
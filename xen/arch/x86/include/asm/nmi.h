@@ -43,4 +43,15 @@ void trigger_nmi_continuation(void);
 
 /* Check for NMI continuation pending. */
 bool nmi_check_continuation(void);
+
+/* Highest watchdog NMI rate accepted for sampling. */
+#define NMI_SAMPLE_HZ_MAX 10000
+
+/**
+ * nmi_set_sample_rate
+ *
+ * Run the LAPIC NMI watchdog at @hz for sampling, or at its normal rate if
+ * @hz is 0.
+ */
+int nmi_set_sample_rate(unsigned int hz);
 #endif /* ASM_NMI_H */
@@ -300,6 +300,13 @@ struct p2m_domain {
     /* Highest guest frame that's ever been mapped in the p2m */
     unsigned long max_mapped_pfn;
 
+    /*
+     * First GFN from which entries marked for type re-calculation, which an
+     * IOMMU sharing the p2m can't DMA through, may remain while no device
+     * is assigned (INVALID_GFN if none).  See p2m_resolve_iommu_recalc().
+     */
+    gfn_t iommu_recalc_gfn;
+
     /*
      * Alternate p2m's only: range of gfn's for which underlying
      * mfn may have duplicate mappings
@@ -665,6 +672,9 @@ int p2m_finish_type_change(struct domain *d,
                            gfn_t first_gfn,
                            unsigned long max_nr);
 
+/* Resolve the re-calculations blocking DMA, before assigning a device */
+int p2m_resolve_iommu_recalc(struct domain *d);
+
 static inline bool p2m_is_global_logdirty(const struct domain *d)
 {
 #ifdef CONFIG_HVM
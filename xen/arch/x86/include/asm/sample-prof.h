@@ -0,0 +1,21 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+#ifndef ASM_X86_SAMPLE_PROF_H
+#define ASM_X86_SAMPLE_PROF_H
+
+struct cpu_user_regs;
+struct xen_sysctl_sample_prof_op;
+
+#ifdef CONFIG_SAMPLE_PROFILE
+
+/* Record a sample of @regs, called from the watchdog NMI. */
+void sample_prof_nmi(const struct cpu_user_regs *regs);
+
+int sample_prof_control(struct xen_sysctl_sample_prof_op *op);
+
+#else
+
+static inline void sample_prof_nmi(const struct cpu_user_regs *regs) {}
+
+#endif /* CONFIG_SAMPLE_PROFILE */
+
+#endif /* ASM_X86_SAMPLE_PROF_H */
@@ -0,0 +1,4 @@
+#ifndef X86_GENERIC_DIV64_H
+#define X86_GENERIC_DIV64_H
+#include <asm-generic/div64.h>
+#endif /* X86_GENERIC_DIV64_H */
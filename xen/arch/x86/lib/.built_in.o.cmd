@@ -0,0 +1 @@
+cmd_arch/x86/lib/built_in.o := ld    -melf_x86_64 --no-warn-rwx-segments -r -o arch/x86/lib/built_in.o arch/x86/lib/cpu-policy/built_in.o
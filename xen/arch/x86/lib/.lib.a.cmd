@@ -0,0 +1 @@
+cmd_arch/x86/lib/lib.a := rm -f arch/x86/lib/lib.a; ar cr arch/x86/lib/lib.a arch/x86/lib/clear-page.o arch/x86/lib/copy-guest.o arch/x86/lib/copy-page.o arch/x86/lib/copy-unsafe.o arch/x86/lib/generic-hweightl.o arch/x86/lib/memcpy.o arch/x86/lib/memset.o arch/x86/lib/scrub-page.o
@@ -0,0 +1 @@
+cmd_arch/x86/lib/cpu-policy/lib.a := rm -f arch/x86/lib/cpu-policy/lib.a; ar cr arch/x86/lib/cpu-policy/lib.a arch/x86/lib/cpu-policy/copy-from-buffer.o arch/x86/lib/cpu-policy/copy-to-buffer.o arch/x86/lib/cpu-policy/cpuid.o arch/x86/lib/cpu-policy/policy.o
@@ -0,0 +1 @@
+cmd_arch/x86/mm/built_in.o := ld    -melf_x86_64 --no-warn-rwx-segments -r -o arch/x86/mm/built_in.o arch/x86/mm/shadow/built_in.o arch/x86/mm/hap/built_in.o arch/x86/mm/altp2m.o arch/x86/mm/guest_walk_2.o arch/x86/mm/guest_walk_3.o arch/x86/mm/guest_walk_4.o arch/x86/mm/mem_access.o arch/x86/mm/nested.o arch/x86/mm/p2m.o arch/x86/mm/p2m-basic.o arch/x86/mm/p2m-ept.o arch/x86/mm/p2m-pod.o arch/x86/mm/p2m-pt.o arch/x86/mm/paging.o arch/x86/mm/physmap.o
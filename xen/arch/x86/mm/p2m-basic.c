@@ -33,6 +33,7 @@ static int p2m_initialise(struct domain *d, struct p2m_domain *p2m)
     p2m->domain = d;
     p2m->default_access = p2m_access_rwx;
     p2m->p2m_class = p2m_host;
+    p2m->iommu_recalc_gfn = INVALID_GFN;
 
     if ( !is_hvm_domain(d) )
         return 0;
@@ -88,12 +89,18 @@ static int p2m_init_hostp2m(struct domain *d)
 
     rc = p2m_init_logdirty(p2m);
 
-    if ( !rc )
-        d->arch.p2m = p2m;
-    else
+    if ( rc )
+    {
         p2m_free_one(p2m);
+        return rc;
+    }
 
-    return rc;
+    d->arch.p2m = p2m;
+#ifdef CONFIG_HVM
+    rwlock_profile_add(d, &p2m->lock.lock.rwlock, "p2m->lock");
+#endif
+
+    return 0;
 }
 
 static void p2m_teardown_hostp2m(struct domain *d)
@@ -103,6 +110,9 @@ static void p2m_teardown_hostp2m(struct domain *d)
 
     if ( p2m )
     {
+#ifdef CONFIG_HVM
+        rwlock_profile_remove(d, &p2m->lock.lock.rwlock);
+#endif
         p2m_free_one(p2m);
         d->arch.p2m = NULL;
     }
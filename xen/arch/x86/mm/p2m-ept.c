@@ -974,7 +974,15 @@ out:
     if ( rc == 0 && p2m_is_hostp2m(p2m) &&
          need_modify_vtd_table )
     {
-        if ( iommu_use_hap_pt(d) && !this_cpu(iommu_dont_flush_iotlb) )
+        /*
+         * Intermediate tables replaced by a superpage are freed below, so
+         * their flush can't be deferred to an IOTLB flush batch.
+         */
+        if ( iommu_use_hap_pt(d) && !this_cpu(iommu_dont_flush_iotlb) &&
+             target && is_epte_present(&old_entry) &&
+             !is_epte_superpage(&old_entry) )
+            rc = iommu_iotlb_flush_all(d, IOMMU_FLUSHF_modified);
+        else if ( iommu_use_hap_pt(d) && !this_cpu(iommu_dont_flush_iotlb) )
             rc = iommu_iotlb_flush(d, _dfn(gfn), 1ul << order,
                                    (iommu_flags ? IOMMU_FLUSHF_added : 0) |
                                    (vtd_pte_present ? IOMMU_FLUSHF_modified
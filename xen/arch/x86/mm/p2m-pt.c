@@ -14,6 +14,8 @@
 
 #include <xen/vm_event.h>
 #include <xen/event.h>
+#include <xen/iommu.h>
+#include <xen/pci.h>
 #include <xen/trace.h>
 #include <public/hvm/dm_op.h>
 #include <public/vm_event.h>
@@ -744,8 +746,25 @@ p2m_pt_set_entry(struct p2m_domain *p2m, gfn_t gfn_, mfn_t mfn,
          && (gfn + (1UL << page_order) - 1 > p2m->max_mapped_pfn) )
         p2m->max_mapped_pfn = gfn + (1UL << page_order) - 1;
 
-    if ( need_iommu_pt_sync(p2m->domain) &&
-         (iommu_old_flags != iommu_pte_flags || old_mfn != mfn_x(mfn)) )
+    if ( iommu_old_flags == iommu_pte_flags && old_mfn == mfn_x(mfn) )
+        /* Nothing to tell the IOMMU. */;
+    else if ( iommu_use_hap_pt(d) && p2m_is_hostp2m(p2m) )
+    {
+        /*
+         * The IOMMU walks these very tables, it only needs its TLB flushed:
+         * right away if an intermediate table is about to be freed below.
+         */
+        if ( this_cpu(iommu_dont_flush_iotlb) )
+            /* The caller flushes. */;
+        else if ( l1e_get_flags(intermediate_entry) & _PAGE_PRESENT )
+            rc = iommu_iotlb_flush_all(d, IOMMU_FLUSHF_modified);
+        else
+            rc = iommu_iotlb_flush(d, _dfn(gfn), 1UL << page_order,
+                                   (iommu_pte_flags ? IOMMU_FLUSHF_added : 0) |
+                                   (iommu_old_flags ? IOMMU_FLUSHF_modified
+                                                    : 0));
+    }
+    else if ( need_iommu_pt_sync(p2m->domain) )
         rc = iommu_pte_flags
              ? iommu_legacy_map(d, _dfn(gfn), mfn, 1UL << page_order,
                                 iommu_pte_flags)
@@ -939,7 +958,7 @@ static void cf_check p2m_pt_change_entry_type_global(
     l1_pgentry_t *tab;
     unsigned long gfn = 0;
     unsigned int i, changed;
-    const struct domain *d = p2m->domain;
+    struct domain *d = p2m->domain;
 
     if ( pagetable_get_pfn(p2m_get_pagetable(p2m)) == 0 )
         return;
@@ -969,8 +988,32 @@ static void cf_check p2m_pt_change_entry_type_global(
     }
     unmap_domain_page(tab);
 
-    if ( changed )
-         guest_flush_tlb_mask(d, d->dirty_cpumask);
+    if ( !changed )
+        return;
+
+    guest_flush_tlb_mask(d, d->dirty_cpumask);
+
+    if ( !iommu_use_hap_pt(d) || !p2m_is_hostp2m(p2m) )
+        return;
+
+    /*
+     * An IOMMU sharing the tables takes no fault on entries marked for
+     * re-calculation, DMA is merely blocked until they get resolved.  With
+     * no device assigned, they only need to be by the time one is.  With
+     * devices assigned, log-dirty mode is refused: what remains is the
+     * reset of p2m_ioreq_server entries, which
+     * XEN_DMOP_map_mem_type_to_ioreq_server then completes preemptibly
+     * with p2m_finish_type_change().
+     */
+    if ( !has_arch_pdevs(d) )
+        p2m->iommu_recalc_gfn = _gfn(0);
+    else
+    {
+        int rc = iommu_iotlb_flush_all(d, IOMMU_FLUSHF_modified);
+
+        /* The flush reports failures, crashing the domain unless dom0. */
+        ASSERT(!rc || d->is_shutting_down || is_hardware_domain(d));
+    }
 }
 
 static int cf_check p2m_pt_change_entry_type_range(
@@ -983,6 +1026,12 @@ static int cf_check p2m_pt_change_entry_type_range(
 
     ASSERT(hap_enabled(p2m->domain));
 
+    /* See p2m_pt_change_entry_type_global(). */
+    if ( iommu_use_hap_pt(p2m->domain) && p2m_is_hostp2m(p2m) &&
+         !has_arch_pdevs(p2m->domain) )
+        p2m->iommu_recalc_gfn = gfn_min(p2m->iommu_recalc_gfn,
+                                        _gfn(first_gfn));
+
     for ( i = 1; i <= 4; )
     {
         if ( first_gfn & mask )
@@ -1010,6 +1059,13 @@ static int cf_check p2m_pt_change_entry_type_range(
         }
     }
 
+    /*
+     * The marked entries block DMA (as with shared EPT, devices can't use
+     * ranges tracked through page faults), and lost their write access.
+     */
+    if ( !err && iommu_use_hap_pt(p2m->domain) && p2m_is_hostp2m(p2m) )
+        err = iommu_iotlb_flush_all(p2m->domain, IOMMU_FLUSHF_modified);
+
     return err;
 }
 
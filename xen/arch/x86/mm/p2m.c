@@ -1049,6 +1049,51 @@ int p2m_finish_type_change(struct domain *d,
     return rc;
 }
 
+/*
+ * Entries marked for type re-calculation while no device was assigned are
+ * left to be resolved lazily, as the vCPUs touch them, but an IOMMU sharing
+ * the p2m would never touch them, and merely be denied DMA to them.  Resolve
+ * them all before assigning a device, 256 GFNs at a time.
+ * Returns: 0 once done, -ERESTART if preempted, negative for failure
+ */
+int p2m_resolve_iommu_recalc(struct domain *d)
+{
+    struct p2m_domain *p2m = p2m_get_hostp2m(d);
+    gfn_t gfn;
+    int rc;
+
+    for ( ; ; )
+    {
+        p2m_lock(p2m);
+
+        gfn = p2m->iommu_recalc_gfn;
+        if ( gfn_x(gfn) > p2m->max_mapped_pfn )
+        {
+            p2m->iommu_recalc_gfn = INVALID_GFN;
+            p2m_unlock(p2m);
+            break;
+        }
+
+        rc = finish_type_change(p2m, gfn, 256);
+        if ( !rc )
+            p2m->iommu_recalc_gfn = gfn_add(gfn, 256);
+
+        p2m_unlock(p2m);
+
+        if ( rc < 0 )
+            return rc;
+
+        if ( hypercall_preempt_check() )
+            return -ERESTART;
+    }
+
+    /* The entries resolved may be cached with their old permissions. */
+    if ( gfn_eq(gfn, INVALID_GFN) )
+        return 0;
+
+    return iommu_iotlb_flush_all(d, IOMMU_FLUSHF_modified);
+}
+
 /*
  * Returns:
  *    0              for success
@@ -1713,6 +1758,7 @@ int map_mmio_regions(struct domain *d,
                      unsigned long nr,
                      mfn_t mfn)
 {
+    struct p2m_domain *p2m = p2m_get_hostp2m(d);
     int ret = 0;
     unsigned long i;
     unsigned int iter, order;
@@ -1723,6 +1769,9 @@ int map_mmio_regions(struct domain *d,
         return -EOPNOTSUPP;
     }
 
+    /* Hold the lock across all entries, for the TLB to only be flushed once. */
+    p2m_lock(p2m);
+
     for ( iter = i = 0; i < nr && iter < MAP_MMIO_MAX_ITER;
           i += 1UL << order, ++iter )
     {
@@ -1740,6 +1789,8 @@ int map_mmio_regions(struct domain *d,
             break;
     }
 
+    p2m_unlock(p2m);
+
     return i == nr ? 0 : i ?: ret;
 }
 
@@ -1748,6 +1799,7 @@ int unmap_mmio_regions(struct domain *d,
                        unsigned long nr,
                        mfn_t mfn)
 {
+    struct p2m_domain *p2m = p2m_get_hostp2m(d);
     int ret = 0;
     unsigned long i;
     unsigned int iter, order;
@@ -1758,6 +1810,9 @@ int unmap_mmio_regions(struct domain *d,
         return -EOPNOTSUPP;
     }
 
+    /* Hold the lock across all entries, for the TLB to only be flushed once. */
+    p2m_lock(p2m);
+
     for ( iter = i = 0; i < nr && iter < MAP_MMIO_MAX_ITER;
           i += 1UL << order, ++iter )
     {
@@ -1775,6 +1830,8 @@ int unmap_mmio_regions(struct domain *d,
             break;
     }
 
+    p2m_unlock(p2m);
+
     return i == nr ? 0 : i ?: ret;
 }
 
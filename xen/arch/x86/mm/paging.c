@@ -595,6 +595,214 @@ static int paging_log_dirty_op(struct domain *d,
     return rv;
 }
 
+/*
+ * Copy a batch of dirty pfns, all covered by the leaf @l1 starting at pfn
+ * @base, to the caller's list, and only then clear their bits, so that none
+ * gets lost if the copy fails.
+ */
+static int log_dirty_list_flush(struct xen_domctl_shadow_op *sc,
+                                unsigned long done, const uint64_t *batch,
+                                unsigned int nr, unsigned long *l1,
+                                unsigned long base)
+{
+    unsigned int i;
+
+    if ( copy_to_guest_offset(sc->dirty_bitmap, done * sizeof(*batch),
+                              (const uint8_t *)batch, nr * sizeof(*batch)) )
+        return -EFAULT;
+
+    for ( i = 0; i < nr; i++ )
+        __clear_bit(batch[i] - base, l1);
+
+    return 0;
+}
+
+/*
+ * Report the dirty pfns as a list rather than a bitmap, clearing exactly the
+ * bits which have been reported.  Only populated leaves of the log-dirty trie
+ * are visited, and the amount of data copied is proportional to the number of
+ * dirty pages.  If the caller's list fills up, the remaining dirty pfns stay
+ * logged and are returned by the next call.
+ */
+static int paging_log_dirty_list_op(struct domain *d,
+                                    struct xen_domctl_shadow_op *sc,
+                                    bool resuming)
+{
+    uint64_t batch[64];
+    unsigned int nr = 0;
+    unsigned long done;
+    mfn_t *l4 = NULL, *l3 = NULL, *l2 = NULL;
+    unsigned long *l1 = NULL;
+    int rv = 0, i4, i3, i2;
+
+    if ( guest_handle_is_null(sc->dirty_bitmap) )
+        return -EINVAL;
+
+    if ( !resuming )
+    {
+        if ( is_hvm_domain(d) &&
+             (sc->mode & XEN_DOMCTL_SHADOW_LOGDIRTY_FINAL) )
+            hvm_mapped_guest_frames_mark_dirty(d);
+
+        domain_pause(d);
+        p2m_flush_hardware_cached_dirty(d);
+    }
+
+    paging_lock(d);
+
+    if ( !d->arch.paging.preempt.dom )
+        memset(&d->arch.paging.preempt.log_dirty, 0,
+               sizeof(d->arch.paging.preempt.log_dirty));
+    else if ( d->arch.paging.preempt.dom != current->domain ||
+              d->arch.paging.preempt.op != sc->op )
+    {
+        paging_unlock(d);
+        if ( !resuming )
+            domain_unpause(d);
+        return -EBUSY;
+    }
+
+    sc->stats.fault_count = min(d->arch.paging.log_dirty.fault_count,
+                                UINT32_MAX + 0UL);
+    sc->stats.dirty_count = min(d->arch.paging.log_dirty.dirty_count,
+                                UINT32_MAX + 0UL);
+
+    if ( unlikely(d->arch.paging.log_dirty.failed_allocs) )
+    {
+        printk(XENLOG_WARNING
+               "%u failed page allocs while logging dirty pages of d%d\n",
+               d->arch.paging.log_dirty.failed_allocs, d->domain_id);
+        rv = -ENOMEM;
+        goto out;
+    }
+
+    l4 = paging_map_log_dirty_bitmap(d);
+    i4 = d->arch.paging.preempt.log_dirty.i4;
+    i3 = d->arch.paging.preempt.log_dirty.i3;
+    done = d->arch.paging.preempt.log_dirty.done;
+
+    for ( ; l4 && done < sc->pages && i4 < LOGDIRTY_NODE_ENTRIES;
+          i4++, i3 = 0 )
+    {
+        if ( mfn_eq(l4[i4], INVALID_MFN) )
+            continue;
+
+        l3 = map_domain_page(l4[i4]);
+        for ( ; done < sc->pages && i3 < LOGDIRTY_NODE_ENTRIES; i3++ )
+        {
+            if ( mfn_eq(l3[i3], INVALID_MFN) )
+                continue;
+
+            l2 = map_domain_page(l3[i3]);
+            for ( i2 = 0; done + nr < sc->pages && i2 < LOGDIRTY_NODE_ENTRIES;
+                  i2++ )
+            {
+                unsigned long base, i1;
+
+                if ( mfn_eq(l2[i2], INVALID_MFN) )
+                    continue;
+
+                base = (((unsigned long)i4 * LOGDIRTY_NODE_ENTRIES + i3) *
+                        LOGDIRTY_NODE_ENTRIES + i2) << (PAGE_SHIFT + 3);
+                l1 = map_domain_page(l2[i2]);
+
+                for ( i1 = find_first_bit(l1, PAGE_SIZE * 8);
+                      i1 < PAGE_SIZE * 8 && done + nr < sc->pages;
+                      i1 = find_next_bit(l1, PAGE_SIZE * 8, i1 + 1) )
+                {
+                    batch[nr++] = base + i1;
+
+                    if ( nr == ARRAY_SIZE(batch) )
+                    {
+                        rv = log_dirty_list_flush(sc, done, batch, nr, l1,
+                                                  base);
+                        if ( rv )
+                            goto out;
+                        done += nr;
+                        nr = 0;
+                    }
+                }
+
+                if ( nr )
+                {
+                    rv = log_dirty_list_flush(sc, done, batch, nr, l1, base);
+                    if ( rv )
+                        goto out;
+                    done += nr;
+                    nr = 0;
+                }
+
+                unmap_domain_page(l1);
+                l1 = NULL;
+            }
+            unmap_domain_page(l2);
+            l2 = NULL;
+
+            if ( i3 < LOGDIRTY_NODE_ENTRIES - 1 && hypercall_preempt_check() )
+            {
+                d->arch.paging.preempt.log_dirty.i4 = i4;
+                d->arch.paging.preempt.log_dirty.i3 = i3 + 1;
+                rv = -ERESTART;
+                break;
+            }
+        }
+        unmap_domain_page(l3);
+        l3 = NULL;
+
+        if ( !rv && i4 < LOGDIRTY_NODE_ENTRIES - 1 &&
+             hypercall_preempt_check() )
+        {
+            d->arch.paging.preempt.log_dirty.i4 = i4 + 1;
+            d->arch.paging.preempt.log_dirty.i3 = 0;
+            rv = -ERESTART;
+        }
+        if ( rv )
+            break;
+    }
+    if ( l4 )
+        unmap_domain_page(l4);
+
+    if ( rv )
+    {
+        ASSERT(rv == -ERESTART);
+        d->arch.paging.preempt.dom = current->domain;
+        d->arch.paging.preempt.op = sc->op;
+        d->arch.paging.preempt.log_dirty.done = done;
+        paging_unlock(d);
+        return rv;
+    }
+
+    d->arch.paging.preempt.dom = NULL;
+    d->arch.paging.log_dirty.fault_count = 0;
+    d->arch.paging.log_dirty.dirty_count = 0;
+
+    paging_unlock(d);
+
+    sc->pages = done;
+
+    /* As for XEN_DOMCTL_SHADOW_OP_CLEAN.  Safe because the domain is paused. */
+    d->arch.paging.log_dirty.ops->clean(d);
+    domain_unpause(d);
+
+    return 0;
+
+ out:
+    d->arch.paging.preempt.dom = NULL;
+    paging_unlock(d);
+    domain_unpause(d);
+
+    if ( l1 )
+        unmap_domain_page(l1);
+    if ( l2 )
+        unmap_domain_page(l2);
+    if ( l3 )
+        unmap_domain_page(l3);
+    if ( l4 )
+        unmap_domain_page(l4);
+
+    return rv;
+}
+
 /*
  * Callers must supply log_dirty_ops for the log dirty code to call. This
  * function usually is invoked when paging is enabled. Check shadow_enable()
@@ -720,6 +928,11 @@ int paging_domctl(struct domain *d, struct xen_domctl_shadow_op *sc,
         if ( sc->mode & ~XEN_DOMCTL_SHADOW_LOGDIRTY_FINAL )
             return -EINVAL;
         return paging_log_dirty_op(d, sc, resuming);
+
+    case XEN_DOMCTL_SHADOW_OP_CLEAN_LIST:
+        if ( sc->mode & ~XEN_DOMCTL_SHADOW_LOGDIRTY_FINAL )
+            return -EINVAL;
+        return paging_log_dirty_list_op(d, sc, resuming);
     }
 
     /* Here, dispatch domctl to the appropriate paging code */
@@ -33,9 +33,12 @@
 #include <asm/nmi.h>
 #include <asm/div64.h>
 #include <asm/apic.h>
+#include <asm/sample-prof.h>
 
 unsigned int nmi_watchdog = NMI_NONE;
 static unsigned int nmi_hz = HZ;
+/* Watchdog NMI rate while the sampling profiler is active, or 0. */
+static unsigned int __read_mostly nmi_sample_hz;
 static unsigned int nmi_perfctr_msr;	/* the MSR to reset in NMI handler */
 static unsigned int nmi_p4_cccr_val;
 static unsigned int nmi_p6_event_width;
@@ -287,9 +290,14 @@ static void clear_msr_range(unsigned int base, unsigned int n)
         wrmsrns(base + i, 0);
 }
 
+static unsigned int nmi_rate(void)
+{
+    return nmi_sample_hz ?: nmi_hz;
+}
+
 static inline void write_watchdog_counter(const char *descr)
 {
-    uint64_t count = cpu_khz * 1000ULL / nmi_hz;
+    uint64_t count = cpu_khz * 1000ULL / nmi_rate();
 
     if ( descr )
         Dprintk("setting %s to -%#"PRIx64"\n", descr, count);
@@ -449,6 +457,7 @@ static struct notifier_block cpu_nmi_nfb = {
 
 static DEFINE_PER_CPU(unsigned int, last_irq_sums);
 static DEFINE_PER_CPU(unsigned int, alert_counter);
+static DEFINE_PER_CPU(unsigned int, last_nmi_rate);
 
 static atomic_t watchdog_disable_count = ATOMIC_INIT(1);
 
@@ -486,16 +495,26 @@ void __init watchdog_setup(void)
 bool nmi_watchdog_tick(const struct cpu_user_regs *regs)
 {
     bool watchdog_tick = true;
-    unsigned int sum = this_cpu(nmi_timer_ticks);
+    unsigned int sum = this_cpu(nmi_timer_ticks), rate = nmi_rate();
 
-    if ( (this_cpu(last_irq_sums) == sum) && watchdog_enabled() )
+    /*
+     * NMIs counted at another rate (sampling having been switched on or off)
+     * don't compare with the new threshold: start counting afresh.
+     */
+    if ( this_cpu(last_nmi_rate) != rate )
+    {
+        this_cpu(last_nmi_rate) = rate;
+        this_cpu(last_irq_sums) = sum;
+        this_cpu(alert_counter) = 0;
+    }
+    else if ( (this_cpu(last_irq_sums) == sum) && watchdog_enabled() )
     {
         /*
          * Ayiee, looks like this CPU is stuck ... wait for the timeout
          * before doing the oops ...
          */
         this_cpu(alert_counter)++;
-        if ( this_cpu(alert_counter) == opt_watchdog_timeout*nmi_hz )
+        if ( this_cpu(alert_counter) >= opt_watchdog_timeout * rate )
         {
             console_force_unlock();
             printk("Watchdog timer detects that CPU%d is stuck!\n",
@@ -549,11 +568,33 @@ bool nmi_watchdog_tick(const struct cpu_user_regs *regs)
                 watchdog_tick = false;
         }
         write_watchdog_counter(NULL);
+
+        if ( watchdog_tick && nmi_sample_hz )
+            sample_prof_nmi(regs);
     }
 
     return watchdog_tick;
 }
 
+/*
+ * Switch the LAPIC watchdog to @hz NMIs per second for sampling, or back to
+ * its normal rate if @hz is 0.  Each CPU picks the new rate up when it next
+ * re-arms its counter.
+ */
+int nmi_set_sample_rate(unsigned int hz)
+{
+    if ( nmi_watchdog != NMI_LOCAL_APIC || !nmi_perfctr_msr )
+        return -ENODEV;
+
+    /* See check_nmi_watchdog() for the lower bound. */
+    if ( hz && (hz < nmi_hz || hz > NMI_SAMPLE_HZ_MAX) )
+        return -ERANGE;
+
+    nmi_sample_hz = hz;
+
+    return 0;
+}
+
 /*
  * For some reason the destination shorthand for self is not valid
  * when used with the NMI delivery mode. This is documented in Tables
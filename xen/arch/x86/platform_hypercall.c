@@ -934,6 +934,68 @@ ret_t do_platform_op(
         break;
     }
 
+    case XENPF_get_symtab:
+    {
+        static char name[KSYM_NAME_LEN + 1]; /* protected by xenpf_lock */
+        XEN_GUEST_HANDLE(xenpf_symtab_entry_t) entries;
+        XEN_GUEST_HANDLE(char) names;
+        uint32_t symnum = op->u.symtab.first, nr = 0, used = 0;
+        bool sizing;
+
+        guest_from_compat_handle(entries, op->u.symtab.entries);
+        guest_from_compat_handle(names, op->u.symtab.names);
+        sizing = guest_handle_is_null(entries);
+
+        /*
+         * Sequential xensyms_read() calls don't rescan the name stream.  Stop
+         * early when preemption is needed, the caller carrying on from the
+         * symbol returned in 'first'.
+         */
+        while ( sizing || nr < op->u.symtab.nr_entries )
+        {
+            xenpf_symtab_entry_t e = {};
+            uint32_t next = symnum, len;
+            unsigned long addr;
+
+            if ( nr && hypercall_preempt_check() )
+                break;
+
+            ret = xensyms_read(&next, &e.type, &addr, name);
+            if ( ret || !name[0] )
+                break;
+
+            len = strlen(name) + 1;
+            if ( !sizing )
+            {
+                if ( len > op->u.symtab.names_size - used )
+                    break;
+
+                e.address = addr;
+                e.name = used;
+                if ( copy_to_guest_offset(entries, nr, &e, 1) ||
+                     copy_to_guest_offset(names, used, name, len) )
+                {
+                    ret = -EFAULT;
+                    break;
+                }
+            }
+
+            symnum = next;
+            used += len;
+            nr++;
+        }
+
+        if ( ret )
+            break;
+
+        op->u.symtab.first = symnum;
+        op->u.symtab.nr_entries = nr;
+        op->u.symtab.names_size = used;
+        if ( __copy_field_to_guest(u_xenpf_op, op, u.symtab) )
+            ret = -EFAULT;
+        break;
+    }
+
     case XENPF_get_dom0_console:
         BUILD_BUG_ON(sizeof(op->u.dom0_console) > sizeof(op->u.pad));
 
@@ -0,0 +1 @@
+cmd_arch/x86/pv/built_in.o := ld    -melf_x86_64 --no-warn-rwx-segments -r -o arch/x86/pv/built_in.o arch/x86/pv/callback.o arch/x86/pv/descriptor-tables.o arch/x86/pv/domain.o arch/x86/pv/emulate.o arch/x86/pv/emul-inv-op.o arch/x86/pv/emul-priv-op.o arch/x86/pv/grant_table.o arch/x86/pv/hypercall.o arch/x86/pv/iret.o arch/x86/pv/misc-hypercalls.o arch/x86/pv/mm.o arch/x86/pv/ro-page-fault.o arch/x86/pv/trace.o arch/x86/pv/traps.o arch/x86/pv/dom0_build.init.o arch/x86/pv/gpr_switch.o
@@ -13,6 +13,7 @@
 #include <xen/trace.h>
 
 #include <asm/apic.h>
+#include <asm/exit-stats.h>
 #include <asm/irq-vectors.h>
 #include <asm/multicall.h>
 
@@ -22,11 +23,14 @@ _pv_hypercall(struct cpu_user_regs *regs, bool compat)
 {
     struct vcpu *curr = current;
     unsigned long eax = -1; /* Clang -Wsometimes-uninitialized */
+    s_time_t start;
 
     ASSERT(guest_kernel_mode(curr, regs));
 
     curr->hcall_preempted = false;
 
+    start = exit_stats_hypercall_start();
+
     if ( !compat )
     {
         unsigned long rdi = regs->rdi;
@@ -76,6 +80,8 @@ _pv_hypercall(struct cpu_user_regs *regs, bool compat)
     }
 #endif /* CONFIG_PV32 */
 
+    exit_stats_hypercall_end(curr, eax, start);
+
     /*
      * PV guests use SYSCALL or INT $0x82 to make a hypercall, both of which
      * have trap semantics.  If the hypercall has been preempted, rewind the
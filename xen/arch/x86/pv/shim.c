@@ -613,6 +613,35 @@ long pv_shim_event_channel_op(int cmd, XEN_GUEST_HANDLE_PARAM(void) arg)
         break;
     }
 
+    case EVTCHNOP_send_batch: {
+        struct evtchn_send_batch batch;
+        unsigned int i;
+
+        if ( copy_from_guest(&batch, arg, 1) != 0 )
+            return -EFAULT;
+
+        if ( batch.nr_ports > ARRAY_SIZE(batch.ports) )
+            return -EINVAL;
+
+        /* The console port is local, and L0 may not know the operation. */
+        rc = 0;
+        for ( i = 0; i < batch.nr_ports; i++ )
+        {
+            struct evtchn_send send = { .port = batch.ports[i] };
+            int ret;
+
+            if ( pv_console && send.port == pv_console_evtchn() )
+                ret = consoled_guest_rx();
+            else
+                ret = xen_hypercall_event_channel_op(EVTCHNOP_send, &send);
+
+            if ( ret && !rc )
+                rc = ret;
+        }
+
+        break;
+    }
+
     case EVTCHNOP_reset: {
         struct evtchn_reset reset;
 
@@ -624,6 +653,22 @@ long pv_shim_event_channel_op(int cmd, XEN_GUEST_HANDLE_PARAM(void) arg)
         break;
     }
 
+    case EVTCHNOP_set_moderation: {
+        struct evtchn_set_moderation set;
+
+        if ( copy_from_guest(&set, arg, 1) != 0 )
+            return -EFAULT;
+
+        /* Events on the console port are raised by the shim itself. */
+        if ( pv_console && set.port == pv_console_evtchn() )
+            rc = -EINVAL;
+        else
+            rc = xen_hypercall_event_channel_op(EVTCHNOP_set_moderation,
+                                                &set);
+
+        break;
+    }
+
     default:
         /* No FIFO or PIRQ support for now */
         rc = -EOPNOTSUPP;
@@ -0,0 +1,213 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/*
+ * sample-prof.c: Sampling profiler driven by the NMI watchdog.
+ *
+ * Each watchdog NMI on a pCPU records one sample into that pCPU's ring.  The
+ * NMI handler is the only producer of a ring and XEN_SYSCTL_sample_prof_op
+ * (serialised by sample_prof_lock) its only consumer, so the rings need no
+ * locking on the NMI path.  Rings are allocated on first use and kept, so
+ * that samples can still be read after sampling has been disabled.
+ */
+
+#include <xen/cpumask.h>
+#include <xen/errno.h>
+#include <xen/guest_access.h>
+#include <xen/sched.h>
+#include <xen/spinlock.h>
+#include <xen/vmap.h>
+
+#include <asm/current.h>
+#include <asm/nmi.h>
+#include <asm/sample-prof.h>
+
+#include <public/sysctl.h>
+
+#define SAMPLE_RING_SIZE 2048 /* Power of 2. */
+
+struct sample_ring {
+    unsigned int prod;        /* Written by the NMI handler only. */
+    unsigned int lost;        /* Written by the NMI handler only. */
+    unsigned int cons;
+    unsigned int lost_seen;
+    struct xen_sysctl_sample s[SAMPLE_RING_SIZE];
+};
+
+static DEFINE_PER_CPU_READ_MOSTLY(struct sample_ring *, sample_ring);
+static DEFINE_SPINLOCK(sample_prof_lock);
+static unsigned int sample_rate;
+
+static unsigned int sample_frames(const struct cpu_user_regs *regs,
+                                  uint64_t *frames)
+{
+    unsigned int n = 0;
+#ifdef CONFIG_FRAME_POINTER
+    unsigned long low = regs->rsp, high = get_stack_trace_bottom(low);
+    unsigned long next = regs->rbp;
+
+    /*
+     * The NMI may have hit anywhere, including code not maintaining a frame
+     * pointer, so only follow frames (both their words) lying within the
+     * stack.
+     */
+    while ( n < XEN_SYSCTL_SAMPLE_PROF_FRAMES &&
+            next >= low && next + 2 * BYTES_PER_LONG <= high &&
+            !(next & (BYTES_PER_LONG - 1)) )
+    {
+        const unsigned long *frame = (const unsigned long *)next;
+
+        frames[n++] = frame[1];
+        next = frame[0];
+        low = (unsigned long)&frame[2];
+    }
+#endif
+
+    return n;
+}
+
+void sample_prof_nmi(const struct cpu_user_regs *regs)
+{
+    struct sample_ring *ring = this_cpu(sample_ring);
+    const struct vcpu *curr = current;
+    struct xen_sysctl_sample *s;
+    unsigned int prod;
+
+    if ( !ring )
+        return;
+
+    prod = ring->prod;
+    if ( prod - ACCESS_ONCE(ring->cons) >= SAMPLE_RING_SIZE )
+    {
+        ring->lost++;
+        return;
+    }
+
+    s = &ring->s[prod & (SAMPLE_RING_SIZE - 1)];
+    s->rip = regs->rip;
+    s->domid = curr->domain->domain_id;
+    s->vcpu = curr->vcpu_id;
+    s->flags = is_idle_vcpu(curr) ? XEN_SYSCTL_SAMPLE_idle : 0;
+
+    if ( guest_mode(regs) )
+    {
+        s->flags |= XEN_SYSCTL_SAMPLE_guest;
+        s->nr_frames = 0;
+    }
+    else
+        s->nr_frames = sample_frames(regs, s->frames);
+
+    smp_wmb(); /* Sample before producer index. */
+    ACCESS_ONCE(ring->prod) = prod + 1;
+}
+
+static int sample_prof_enable(unsigned int rate)
+{
+    unsigned int cpu;
+    int rc;
+
+    for_each_online_cpu ( cpu )
+    {
+        struct sample_ring *ring = per_cpu(sample_ring, cpu);
+
+        if ( !ring )
+        {
+            ring = vzalloc(sizeof(*ring));
+            if ( !ring )
+                return -ENOMEM;
+            per_cpu(sample_ring, cpu) = ring;
+        }
+
+        /* Discard what is left from a previous run. */
+        ring->cons = ACCESS_ONCE(ring->prod);
+        ring->lost_seen = ACCESS_ONCE(ring->lost);
+    }
+
+    rc = nmi_set_sample_rate(rate);
+    if ( !rc )
+        sample_rate = rate;
+
+    return rc;
+}
+
+static int sample_prof_read(struct xen_sysctl_sample_prof_op *op)
+{
+    struct sample_ring *ring;
+    unsigned int prod, cons, lost, i, n;
+
+    if ( op->cpu >= nr_cpu_ids || !cpu_online(op->cpu) )
+        return -EINVAL;
+
+    ring = per_cpu(sample_ring, op->cpu);
+    if ( !ring )
+    {
+        op->nr_samples = 0;
+        op->lost = 0;
+        return 0;
+    }
+
+    prod = ACCESS_ONCE(ring->prod);
+    smp_rmb(); /* Producer index before samples. */
+    cons = ring->cons;
+    n = min(prod - cons, op->nr_samples);
+
+    for ( i = 0; i < n; i++ )
+        if ( copy_to_guest_offset(op->samples, i,
+                                  &ring->s[(cons + i) & (SAMPLE_RING_SIZE - 1)],
+                                  1) )
+            return -EFAULT;
+
+    smp_mb(); /* Samples read before releasing the slots. */
+    ACCESS_ONCE(ring->cons) = cons + n;
+
+    lost = ACCESS_ONCE(ring->lost);
+    op->lost = lost - ring->lost_seen;
+    ring->lost_seen = lost;
+    op->nr_samples = n;
+
+    return 0;
+}
+
+int sample_prof_control(struct xen_sysctl_sample_prof_op *op)
+{
+    int rc;
+
+    if ( op->pad )
+        return -EINVAL;
+
+    spin_lock(&sample_prof_lock);
+
+    switch ( op->cmd )
+    {
+    case XEN_SYSCTL_SAMPLE_PROF_enable:
+        rc = op->rate ? sample_prof_enable(op->rate) : -EINVAL;
+        break;
+
+    case XEN_SYSCTL_SAMPLE_PROF_disable:
+        rc = sample_rate ? nmi_set_sample_rate(0) : 0;
+        if ( !rc )
+            sample_rate = 0;
+        break;
+
+    case XEN_SYSCTL_SAMPLE_PROF_read:
+        rc = sample_prof_read(op);
+        op->rate = sample_rate;
+        break;
+
+    default:
+        rc = -EOPNOTSUPP;
+        break;
+    }
+
+    spin_unlock(&sample_prof_lock);
+
+    return rc;
+}
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * tab-width: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -30,6 +30,7 @@
 #include <xen/cpu.h>
 #include <xsm/xsm.h>
 #include <asm/psr.h>
+#include <asm/sample-prof.h>
 #include <asm/cpu-policy.h>
 
 struct l3_cache_info {
@@ -419,6 +420,14 @@ long arch_do_sysctl(
         break;
     }
 
+#ifdef CONFIG_SAMPLE_PROFILE
+    case XEN_SYSCTL_sample_prof_op:
+        ret = sample_prof_control(&sysctl->u.sample_prof_op);
+        if ( __copy_field_to_guest(u_sysctl, sysctl, u.sample_prof_op) )
+            ret = -EFAULT;
+        break;
+#endif
+
     default:
         ret = -ENOSYS;
         break;
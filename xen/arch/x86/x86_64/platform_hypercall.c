@@ -43,6 +43,10 @@ CHECK_pf_enter_acpi_sleep;
 CHECK_pf_resource_entry;
 #undef xen_pf_resource_entry
 
+#define xen_pf_symtab_entry xenpf_symtab_entry
+CHECK_pf_symtab_entry;
+#undef xen_pf_symtab_entry
+
 #define COMPAT
 #define _XEN_GUEST_HANDLE(t) XEN_GUEST_HANDLE(t)
 #define _XEN_GUEST_HANDLE_PARAM(t) XEN_GUEST_HANDLE_PARAM(t)
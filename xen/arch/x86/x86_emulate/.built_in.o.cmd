@@ -0,0 +1 @@
+cmd_arch/x86/x86_emulate/built_in.o := ld    -melf_x86_64 --no-warn-rwx-segments -r -o arch/x86/x86_emulate/built_in.o arch/x86/x86_emulate/0f01.o arch/x86/x86_emulate/0fae.o arch/x86/x86_emulate/0fc7.o arch/x86/x86_emulate/blk.o arch/x86/x86_emulate/decode.o arch/x86/x86_emulate/fpu.o arch/x86/x86_emulate/util.o arch/x86/x86_emulate/util-xen.o
@@ -26,7 +26,10 @@
 #include <xen/guest_access.h>
 #include <xen/hypercall.h>
 #include <xen/keyhandler.h>
+#include <xen/perfc.h>
 #include <xen/sections.h>
+#include <xen/timer.h>
+#include <xen/xmalloc.h>
 
 #include <asm/current.h>
 
@@ -51,6 +54,10 @@ static always_inline void evtchn_write_lock(struct evtchn *evtchn)
 {
     write_lock(&evtchn->lock);
 
+    /* Make lockless readers of the channel retry, see evtchn_send(). */
+    evtchn->seq++;
+    smp_wmb();
+
 #ifndef NDEBUG
     evtchn->old_state = evtchn->state;
 #endif
@@ -71,6 +78,9 @@ static inline void evtchn_write_unlock(struct evtchn *evtchn)
     ASSERT(old_state(evtchn) == ECS_FREE || old_state(evtchn) == ECS_UNBOUND ||
            evtchn->state == ECS_FREE || evtchn->state == ECS_UNBOUND);
 
+    smp_wmb();
+    evtchn->seq++;
+
     write_unlock(&evtchn->lock);
 }
 
@@ -700,10 +710,189 @@ static int evtchn_bind_pirq(evtchn_bind_pirq_t *bind)
 }
 
 
+/*
+ * Moderation of a port, see EVTCHNOP_set_moderation.  Allocated on first use
+ * and kept until the port is closed: the pointer in struct evtchn is only set
+ * with the domain's event lock held, and cleared with the channel write
+ * locked as well, but it is read by senders holding neither.  Each costs an
+ * allocation and a timer, hence the per-domain limit.
+ */
+#define EVTCHN_MODERATION_MAX_PORTS 64
+
+struct evtchn_moderation {
+    spinlock_t lock;
+    bool deferred;          /* An event is held back until the timer fires. */
+    s_time_t interval;
+    s_time_t next;          /* Earliest time of the next delivery. */
+    struct domain *d;
+    struct evtchn *chn;
+    struct timer timer;
+    struct rcu_head rcu;
+};
+
+/* Deliver the events held back on the port, as a single one. */
+static void cf_check evtchn_moderation_timer(void *data)
+{
+    struct evtchn_moderation *mod = data;
+    struct evtchn *chn = mod->chn;
+    struct domain *d = mod->d;
+    unsigned long flags;
+
+    spin_lock_irqsave(&mod->lock, flags);
+    mod->deferred = false;
+    mod->next = NOW() + mod->interval;
+    spin_unlock_irqrestore(&mod->lock, flags);
+
+    perfc_incr(evtchn_moderation_timer);
+
+    evtchn_read_lock(chn);
+
+    /* Nothing to deliver if the port was closed meanwhile. */
+    if ( chn->moderation == mod && evtchn_usable(chn) )
+        d->evtchn_port_ops->set_pending(d->vcpu[chn->notify_vcpu_id], chn);
+
+    evtchn_read_unlock(chn);
+}
+
+/*
+ * Called from evtchn_port_set_pending(), possibly with interrupts disabled:
+ * deliver the event if the interval since the previous delivery has elapsed,
+ * or hold it back until it has, with any further event coalesced into it.
+ */
+void evtchn_moderate(struct domain *d, unsigned int vcpu_id,
+                     struct evtchn *evtchn, struct evtchn_moderation *mod)
+{
+    s_time_t now = NOW();
+    unsigned long flags;
+    bool deliver = false;
+
+    spin_lock_irqsave(&mod->lock, flags);
+
+    if ( mod->deferred )
+        perfc_incr(evtchn_moderated);
+    else if ( now >= mod->next )
+    {
+        mod->next = now + mod->interval;
+        deliver = true;
+    }
+    else
+    {
+        mod->deferred = true;
+        set_timer(&mod->timer, mod->next);
+        perfc_incr(evtchn_moderated);
+    }
+
+    spin_unlock_irqrestore(&mod->lock, flags);
+
+    if ( deliver )
+        d->evtchn_port_ops->set_pending(d->vcpu[vcpu_id], evtchn);
+}
+
+/* With the event lock held and the channel write locked, on close. */
+static struct evtchn_moderation *evtchn_moderation_detach(struct domain *d,
+                                                          struct evtchn *chn)
+{
+    struct evtchn_moderation *mod = chn->moderation;
+
+    if ( !mod )
+        return NULL;
+
+    write_atomic(&chn->moderation, NULL);
+    ASSERT(d->moderated_evtchns);
+    d->moderated_evtchns--;
+
+    return mod;
+}
+
+static void cf_check evtchn_moderation_free_rcu(struct rcu_head *head)
+{
+    xfree(container_of(head, struct evtchn_moderation, rcu));
+}
+
+/*
+ * With no locks held.  Lockless senders may still be using @mod until the end
+ * of their RCU read section, but can't re-arm the killed timer.
+ */
+static void evtchn_moderation_free(struct evtchn_moderation *mod)
+{
+    kill_timer(&mod->timer);
+    call_rcu(&mod->rcu, evtchn_moderation_free_rcu);
+}
+
+static int evtchn_set_moderation(const struct evtchn_set_moderation *set)
+{
+    struct domain *d = current->domain;
+    struct evtchn *chn = _evtchn_from_port(d, set->port);
+    struct evtchn_moderation *mod = NULL;
+    unsigned long flags;
+    int rc = 0;
+
+    if ( !chn || set->interval_us > EVTCHN_MODERATION_MAX_US )
+        return -EINVAL;
+
+    /* Allocate ahead, as the port is unlikely to be moderated already. */
+    if ( set->interval_us && !ACCESS_ONCE(chn->moderation) )
+    {
+        if ( ACCESS_ONCE(d->moderated_evtchns) >= EVTCHN_MODERATION_MAX_PORTS )
+            return -ENOSPC;
+
+        mod = xzalloc(struct evtchn_moderation);
+        if ( !mod )
+            return -ENOMEM;
+
+        spin_lock_init(&mod->lock);
+        mod->d = d;
+        mod->chn = chn;
+        init_timer(&mod->timer, evtchn_moderation_timer, mod,
+                   smp_processor_id());
+    }
+
+    write_lock(&d->event_lock);
+
+    if ( (chn->state != ECS_UNBOUND && chn->state != ECS_INTERDOMAIN) ||
+         consumer_is_xen(chn) )
+    {
+        rc = -EINVAL;
+        goto out;
+    }
+
+    if ( chn->moderation )
+    {
+        spin_lock_irqsave(&chn->moderation->lock, flags);
+        chn->moderation->interval = MICROSECS(set->interval_us);
+        /* Let the next event through, unless one is held back already. */
+        chn->moderation->next = 0;
+        spin_unlock_irqrestore(&chn->moderation->lock, flags);
+    }
+    else if ( mod && d->moderated_evtchns >= EVTCHN_MODERATION_MAX_PORTS )
+        rc = -ENOSPC;
+    else if ( mod )
+    {
+        d->moderated_evtchns++;
+        mod->interval = MICROSECS(set->interval_us);
+        /* Initialise @mod before senders can see it. */
+        smp_wmb();
+        write_atomic(&chn->moderation, mod);
+        mod = NULL;
+    }
+
+ out:
+    write_unlock(&d->event_lock);
+
+    if ( mod )
+    {
+        kill_timer(&mod->timer);
+        xfree(mod);
+    }
+
+    return rc;
+}
+
 int evtchn_close(struct domain *d1, int port1, bool guest)
 {
     struct domain *d2 = NULL;
     struct evtchn *chn1 = _evtchn_from_port(d1, port1), *chn2;
+    struct evtchn_moderation *mod = NULL;
     int            rc = 0;
 
     if ( !chn1 )
@@ -814,6 +1003,7 @@ int evtchn_close(struct domain *d1, int port1, bool guest)
         double_evtchn_lock(chn1, chn2);
 
         evtchn_free(d1, chn1);
+        mod = evtchn_moderation_detach(d1, chn1);
 
         chn2->state = ECS_UNBOUND;
         chn2->u.unbound.remote_domid = d1->domain_id;
@@ -828,6 +1018,7 @@ int evtchn_close(struct domain *d1, int port1, bool guest)
 
     evtchn_write_lock(chn1);
     evtchn_free(d1, chn1);
+    mod = evtchn_moderation_detach(d1, chn1);
     evtchn_write_unlock(chn1);
 
  out:
@@ -840,9 +1031,117 @@ int evtchn_close(struct domain *d1, int port1, bool guest)
 
     write_unlock(&d1->event_lock);
 
+    if ( mod )
+        evtchn_moderation_free(mod);
+
     return rc;
 }
 
+static DEFINE_RCU_READ_LOCK(evtchn_send_rcu_lock);
+
+/*
+ * Send on a bound interdomain channel without taking its lock.  Both ends of
+ * the binding are read consistently by checking that no writer held their
+ * locks meanwhile, and are used within an RCU read section:
+ * evtchn_send_quiesce() waits for such senders before the remote's FIFO state
+ * goes away, and the domain itself is freed via RCU.  The checks are repeated
+ * after marking the remote port pending, the slow path then delivering again
+ * should the port have been closed (and possibly rebound) in between.  The
+ * stale event left behind is a spurious one, which guests have to cope with
+ * anyway.
+ *
+ * Returns false if the slow path has to be taken.
+ */
+static bool evtchn_send_fast(struct domain *ld, struct evtchn *lchn)
+{
+    struct domain *rd;
+    struct evtchn *rchn;
+    evtchn_port_t rport;
+    unsigned int lseq, rseq;
+    bool done = false;
+
+    /* Leave the errors to the slow path. */
+    if ( xsm_evtchn_send(XSM_HOOK, ld, lchn) )
+        return false;
+
+    rcu_read_lock(&evtchn_send_rcu_lock);
+
+    lseq = read_atomic(&lchn->seq);
+    if ( lseq & 1 )
+        goto out;
+    smp_rmb();
+
+    if ( lchn->state != ECS_INTERDOMAIN || consumer_is_xen(lchn) )
+        goto out;
+    rd = lchn->u.interdomain.remote_dom;
+    rport = lchn->u.interdomain.remote_port;
+
+    smp_rmb();
+    if ( read_atomic(&lchn->seq) != lseq ||
+         read_atomic(&rd->evtchn_send_stopped) )
+        goto out;
+    smp_rmb();
+
+    rchn = evtchn_from_port(rd, rport);
+    rseq = read_atomic(&rchn->seq);
+    if ( rseq & 1 )
+        goto out;
+    smp_rmb();
+
+    if ( rchn->state != ECS_INTERDOMAIN || consumer_is_xen(rchn) ||
+         rchn->u.interdomain.remote_dom != ld ||
+         rchn->u.interdomain.remote_port != lchn->port )
+        goto out;
+
+    evtchn_port_set_pending(rd, rchn->notify_vcpu_id, rchn);
+
+    /* Have the slow path deliver again if either end changed meanwhile. */
+    smp_mb();
+    done = read_atomic(&lchn->seq) == lseq && read_atomic(&rchn->seq) == rseq;
+
+ out:
+    rcu_read_unlock(&evtchn_send_rcu_lock);
+
+    return done;
+}
+
+static void cf_check evtchn_send_quiesced(struct rcu_head *head)
+{
+    struct domain *d = container_of(head, struct domain, evtchn_send_rcu);
+
+    write_atomic(&d->evtchn_send_quiesced, true);
+}
+
+/*
+ * With the event lock held.  Stop lockless senders from targeting @d, and
+ * return whether those which may have been doing so are done, which is the
+ * case once an RCU grace period has elapsed.
+ */
+static bool evtchn_send_quiesce(struct domain *d)
+{
+    ASSERT(rw_is_write_locked(&d->event_lock));
+
+    if ( !d->evtchn_send_stopped )
+    {
+        write_atomic(&d->evtchn_send_stopped, true);
+        smp_mb();
+        call_rcu(&d->evtchn_send_rcu, evtchn_send_quiesced);
+        return false;
+    }
+
+    return read_atomic(&d->evtchn_send_quiesced);
+}
+
+/* With the event lock held, once quiesced. */
+static void evtchn_send_resume(struct domain *d)
+{
+    ASSERT(d->evtchn_send_quiesced);
+
+    d->evtchn_send_quiesced = false;
+    smp_wmb();
+    write_atomic(&d->evtchn_send_stopped, false);
+}
+
 int evtchn_send(struct domain *ld, unsigned int lport)
 {
     struct evtchn *lchn = _evtchn_from_port(ld, lport), *rchn;
@@ -852,6 +1151,9 @@ int evtchn_send(struct domain *ld, unsigned int lport)
     if ( !lchn )
         return -EINVAL;
 
+    if ( evtchn_send_fast(ld, lchn) )
+        return 0;
+
     evtchn_read_lock(lchn);
 
     /* Guest cannot send via a Xen-attached event channel. */
@@ -902,6 +1204,26 @@ out:
     return ret;
 }
 
+static int evtchn_send_batch(struct domain *ld,
+                             const struct evtchn_send_batch *batch)
+{
+    unsigned int i;
+    int rc = 0;
+
+    if ( batch->nr_ports > ARRAY_SIZE(batch->ports) )
+        return -EINVAL;
+
+    for ( i = 0; i < batch->nr_ports; i++ )
+    {
+        int ret = evtchn_send(ld, batch->ports[i]);
+
+        if ( ret && !rc )
+            rc = ret;
+    }
+
+    return rc;
+}
+
 bool evtchn_virq_enabled(const struct vcpu *v, unsigned int virq)
 {
     if ( !v )
@@ -1296,6 +1618,10 @@ int evtchn_reset(struct domain *d, bool resuming)
     if ( i > d->next_evtchn )
         d->next_evtchn = i;
 
+    /* Lockless senders may still target the ports being closed. */
+    if ( i && d->evtchn_fifo )
+        evtchn_send_quiesce(d);
+
     write_unlock(&d->event_lock);
 
     if ( !i )
@@ -1317,17 +1643,25 @@ int evtchn_reset(struct domain *d, bool resuming)
 
     write_lock(&d->event_lock);
 
-    d->next_evtchn = 0;
-
     if ( d->active_evtchns > d->xen_evtchns )
         rc = -EAGAIN;
+    else if ( d->evtchn_fifo && !evtchn_send_quiesce(d) )
+    {
+        /* Wait for the lockless senders, keeping the reset in progress. */
+        d->next_evtchn = i;
+        rc = -ERESTART;
+    }
     else if ( d->evtchn_fifo )
     {
         /* Switching back to 2-level ABI. */
         evtchn_fifo_destroy(d);
         evtchn_2l_init(d);
+        evtchn_send_resume(d);
     }
 
+    if ( rc != -ERESTART )
+        d->next_evtchn = 0;
+
     write_unlock(&d->event_lock);
 
     return rc;
@@ -1428,6 +1762,14 @@ long do_event_channel_op(int cmd, XEN_GUEST_HANDLE_PARAM(void) arg)
         break;
     }
 
+    case EVTCHNOP_send_batch: {
+        struct evtchn_send_batch batch;
+        if ( copy_from_guest(&batch, arg, 1) != 0 )
+            return -EFAULT;
+        rc = evtchn_send_batch(current->domain, &batch);
+        break;
+    }
+
     case EVTCHNOP_status: {
         struct evtchn_status status;
         if ( copy_from_guest(&status, arg, 1) != 0 )
@@ -1496,6 +1838,14 @@ long do_event_channel_op(int cmd, XEN_GUEST_HANDLE_PARAM(void) arg)
         break;
     }
 
+    case EVTCHNOP_set_moderation: {
+        struct evtchn_set_moderation set_moderation;
+        if ( copy_from_guest(&set_moderation, arg, 1) != 0 )
+            return -EFAULT;
+        rc = evtchn_set_moderation(&set_moderation);
+        break;
+    }
+
     case EVTCHNOP_set_priority: {
         struct evtchn_set_priority set_priority;
         if ( copy_from_guest(&set_priority, arg, 1) != 0 )
@@ -1632,7 +1982,7 @@ int evtchn_init(struct domain *d, unsigned int max_port)
         return -ENOMEM;
     d->valid_evtchns = EVTCHNS_PER_BUCKET;
 
-    rwlock_init(&d->event_lock);
+    rwlock_init_prof(d, event_lock);
 
     if ( get_free_port(d) != 0 )
     {
@@ -1657,11 +2007,17 @@ int evtchn_init(struct domain *d, unsigned int max_port)
 int evtchn_destroy(struct domain *d)
 {
     unsigned int i;
+    bool quiesced = true;
 
-    /* After this kind-of-barrier no new event-channel allocations can occur. */
+    /*
+     * After this kind-of-barrier no new event-channel allocations can occur.
+     * Lockless senders are also stopped, to be waited for below.
+     */
     BUG_ON(!d->is_dying);
-    read_lock(&d->event_lock);
-    read_unlock(&d->event_lock);
+    write_lock(&d->event_lock);
+    if ( d->evtchn_fifo )
+        quiesced = evtchn_send_quiesce(d);
+    write_unlock(&d->event_lock);
 
     /* Close all existing event channels. */
     for ( i = d->valid_evtchns; --i; )
@@ -1682,6 +2038,13 @@ int evtchn_destroy(struct domain *d)
 
     ASSERT(!d->active_evtchns);
 
+    if ( !quiesced )
+    {
+        /* All ports are closed, don't walk them again when resuming. */
+        write_atomic(&d->valid_evtchns, 1);
+        return -ERESTART;
+    }
+
     clear_global_virq_handlers(d);
 
     evtchn_fifo_destroy(d);
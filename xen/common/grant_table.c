@@ -429,6 +429,19 @@ static inline void gnttab_flush_tlb(const struct domain *d)
         arch_flush_tlb_mask(d->dirty_cpumask);
 }
 
+/*
+ * Unmapping grants batches the IOTLB flushes of the domain's IOMMU mappings
+ * as well: they are flushed along with the TLBs, before unmap_common_complete()
+ * can release the pages.
+ */
+static void gnttab_unmap_flush(struct iommu_flush_batch *batch)
+{
+    gnttab_flush_tlb(current->domain);
+
+    /* Failures are logged, and crash the domain unless it's the hwdom. */
+    iommu_flush_batch_finish(batch);
+}
+
 static inline unsigned int
 num_act_frames_from_sha_frames(const unsigned int num)
 {
@@ -1682,11 +1695,13 @@ gnttab_unmap_grant_ref(
     int i, c, partial_done, done = 0;
     struct gnttab_unmap_grant_ref op;
     struct gnttab_unmap_common common[GNTTAB_UNMAP_BATCH_SIZE];
+    struct iommu_flush_batch batch;
 
     while ( count != 0 )
     {
         c = min(count, (unsigned int)GNTTAB_UNMAP_BATCH_SIZE);
         partial_done = 0;
+        iommu_flush_batch_start(&batch, current->domain);
 
         for ( i = 0; i < c; i++ )
         {
@@ -1699,7 +1714,7 @@ gnttab_unmap_grant_ref(
             guest_handle_add_offset(uop, 1);
         }
 
-        gnttab_flush_tlb(current->domain);
+        gnttab_unmap_flush(&batch);
 
         for ( i = 0; i < partial_done; i++ )
             unmap_common_complete(&common[i]);
@@ -1714,7 +1729,7 @@ gnttab_unmap_grant_ref(
     return 0;
 
 fault:
-    gnttab_flush_tlb(current->domain);
+    gnttab_unmap_flush(&batch);
 
     for ( i = 0; i < partial_done; i++ )
         unmap_common_complete(&common[i]);
@@ -1747,11 +1762,13 @@ gnttab_unmap_and_replace(
     int i, c, partial_done, done = 0;
     struct gnttab_unmap_and_replace op;
     struct gnttab_unmap_common common[GNTTAB_UNMAP_BATCH_SIZE];
+    struct iommu_flush_batch batch;
 
     while ( count != 0 )
     {
         c = min(count, (unsigned int)GNTTAB_UNMAP_BATCH_SIZE);
         partial_done = 0;
+        iommu_flush_batch_start(&batch, current->domain);
 
         for ( i = 0; i < c; i++ )
         {
@@ -1764,7 +1781,7 @@ gnttab_unmap_and_replace(
             guest_handle_add_offset(uop, 1);
         }
 
-        gnttab_flush_tlb(current->domain);
+        gnttab_unmap_flush(&batch);
 
         for ( i = 0; i < partial_done; i++ )
             unmap_common_complete(&common[i]);
@@ -1779,7 +1796,7 @@ gnttab_unmap_and_replace(
     return 0;
 
 fault:
-    gnttab_flush_tlb(current->domain);
+    gnttab_unmap_flush(&batch);
 
     for ( i = 0; i < partial_done; i++ )
         unmap_common_complete(&common[i]);
@@ -2002,6 +2019,7 @@ int grant_table_init(struct domain *d, int max_grant_frames,
 
     /* Simple stuff. */
     percpu_rwlock_resource_init(&gt->lock, grant_rwlock);
+    rwlock_profile_add(d, &gt->lock.rwlock, "grant_table->lock");
     spin_lock_init(&gt->maptrack_lock);
 
     gt->gt_version = 1;
@@ -4036,6 +4054,7 @@ grant_table_destroy(
         free_xenheap_page(t->status[i]);
     xvfree(t->status);
 
+    rwlock_profile_remove(d, &t->lock.rwlock);
     xvfree(t);
 }
 
@@ -0,0 +1 @@
+cmd_common/gzip/built_in.o := ld    -melf_x86_64 --no-warn-rwx-segments -r -o common/gzip/built_in.o common/gzip/gunzip.init.o
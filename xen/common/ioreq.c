@@ -24,7 +24,10 @@
 #include <xen/irq.h>
 #include <xen/lib.h>
 #include <xen/paging.h>
+#include <xen/perfc.h>
+#include <xen/rangeset.h>
 #include <xen/sched.h>
+#include <xen/sort.h>
 #include <xen/trace.h>
 
 #include <asm/guest_atomics.h>
@@ -93,6 +96,165 @@ static struct ioreq_server *get_ioreq_server(const struct domain *d,
             continue; \
         else
 
+/*
+ * The dispatch index partitions the ranges of the enabled servers, for each
+ * range type, into sorted disjoint pieces each handled by a single server:
+ * where ranges of several servers overlap, the piece belongs to the one
+ * FOR_EACH_IOREQ_SERVER() visits first.  An access within a piece goes to
+ * its server, an access not starting in any piece to none.  Only accesses
+ * straddling pieces need the full scan, as a lower priority server may
+ * still contain them whole.
+ */
+struct ioreq_index_range {
+    unsigned long s, e;
+    unsigned int id;
+};
+
+struct ioreq_index {
+    /* The pieces of type t are ranges[start[t]] to ranges[start[t + 1]-1]. */
+    unsigned int start[NR_IO_RANGE_TYPES + 1];
+    struct ioreq_index_range ranges[];
+};
+
+struct ioreq_index_build {
+    struct ioreq_index *index;
+    unsigned int nr, id;
+};
+
+static int cf_check count_range(unsigned long s, unsigned long e, void *arg)
+{
+    unsigned int *nr = arg;
+
+    ++*nr;
+
+    return 0;
+}
+
+static int cf_check add_index_range(unsigned long s, unsigned long e,
+                                    void *arg)
+{
+    struct ioreq_index_build *b = arg;
+
+    b->index->ranges[b->nr++] = (struct ioreq_index_range){
+        .s = s, .e = e, .id = b->id,
+    };
+
+    return 0;
+}
+
+static int cf_check cmp_index_range(const void *a, const void *b)
+{
+    const struct ioreq_index_range *x = a, *y = b;
+
+    return x->s < y->s ? -1 : x->s > y->s;
+}
+
+static void cf_check swap_index_range(void *a, void *b)
+{
+    SWAP(*(struct ioreq_index_range *)a, *(struct ioreq_index_range *)b);
+}
+
+static struct ioreq_index *ioreq_index_build(const struct domain *d)
+{
+    const struct ioreq_server *s;
+    struct ioreq_index_build b = {};
+    struct rangeset *covered, *piece;
+    unsigned int id, type, nr = 0;
+
+    /* Each piece boundary is a range boundary: at most 2 pieces per range. */
+    FOR_EACH_IOREQ_SERVER(d, id, s)
+        if ( s->enabled )
+            for ( type = 0; type < NR_IO_RANGE_TYPES; type++ )
+                rangeset_report_ranges(s->range[type], 0, ~0UL, count_range,
+                                       &nr);
+
+    b.index = xmalloc_flex_struct(struct ioreq_index, ranges, 2 * nr);
+    covered = rangeset_new(NULL, NULL, 0);
+    piece = rangeset_new(NULL, NULL, 0);
+    if ( !b.index || !covered || !piece )
+        goto fail;
+
+    for ( type = 0; type < NR_IO_RANGE_TYPES; type++ )
+    {
+        b.index->start[type] = b.nr;
+        rangeset_purge(covered);
+
+        FOR_EACH_IOREQ_SERVER(d, id, s)
+        {
+            if ( !s->enabled )
+                continue;
+
+            rangeset_purge(piece);
+            if ( rangeset_merge(piece, s->range[type]) ||
+                 rangeset_subtract(piece, covered) ||
+                 rangeset_merge(covered, s->range[type]) )
+                goto fail;
+
+            b.id = id;
+            rangeset_report_ranges(piece, 0, ~0UL, add_index_range, &b);
+        }
+
+        ASSERT(b.nr <= 2 * nr);
+        sort(&b.index->ranges[b.index->start[type]],
+             b.nr - b.index->start[type], sizeof(*b.index->ranges),
+             cmp_index_range, swap_index_range);
+    }
+    b.index->start[type] = b.nr;
+
+    rangeset_destroy(covered);
+    rangeset_destroy(piece);
+
+    return b.index;
+
+ fail:
+    rangeset_destroy(covered);
+    rangeset_destroy(piece);
+    xfree(b.index);
+
+    return NULL;
+}
+
+/*
+ * Rebuild the dispatch index after a change to the servers, their state or
+ * their ranges.  Without memory for it, ioreq_server_select() falls back to
+ * scanning the servers.
+ */
+static void ioreq_index_update(struct domain *d)
+{
+    struct ioreq_index *index = ioreq_index_build(d), *old;
+
+    ASSERT(rspin_is_locked(&d->ioreq_server.lock));
+
+    perfc_incr(ioreq_index_rebuild);
+
+    write_lock(&d->ioreq_server.index_lock);
+    old = d->ioreq_server.index;
+    d->ioreq_server.index = index;
+    d->ioreq_server.generation++;
+    write_unlock(&d->ioreq_server.index_lock);
+
+    xfree(old);
+}
+
+/* Find the piece containing addr, or the one preceding it. */
+static const struct ioreq_index_range *ioreq_index_find(
+    const struct ioreq_index *index, unsigned int type, unsigned long addr)
+{
+    unsigned int lo = index->start[type], hi = index->start[type + 1];
+
+    while ( lo < hi )
+    {
+        unsigned int mid = lo + (hi - lo) / 2;
+
+        if ( index->ranges[mid].s > addr )
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+
+    return lo > index->start[type] ? &index->ranges[lo - 1] : NULL;
+}
+
 static ioreq_t *get_ioreq(struct ioreq_server *s, struct vcpu *v)
 {
     shared_iopage_t *p = s->ioreq.va;
@@ -647,10 +809,12 @@ static int ioreq_server_create(struct domain *d, int bufioreq_handling,
     unsigned int i;
     int rc;
 
-    if ( !IS_ENABLED(CONFIG_X86) && bufioreq_handling )
+    /* The legacy buffered formats are only used by x86 emulation. */
+    if ( !IS_ENABLED(CONFIG_X86) && bufioreq_handling &&
+         bufioreq_handling != HVM_IOREQSRV_BUFIOREQ_RING )
         return -EINVAL;
 
-    if ( bufioreq_handling > HVM_IOREQSRV_BUFIOREQ_ATOMIC )
+    if ( bufioreq_handling > HVM_IOREQSRV_BUFIOREQ_RING )
         return -EINVAL;
 
     s = xzalloc(struct ioreq_server);
@@ -729,6 +893,8 @@ static int ioreq_server_destroy(struct domain *d, ioservid_t id)
     ioreq_server_deinit(s);
     set_ioreq_server(d, id, NULL);
 
+    ioreq_index_update(d);
+
     domain_unpause(d);
 
     xfree(s);
@@ -884,6 +1050,8 @@ static int ioreq_server_map_io_range(struct domain *d, ioservid_t id,
         goto out;
 
     rc = rangeset_add_range(r, start, end);
+    if ( !rc && s->enabled )
+        ioreq_index_update(d);
 
  out:
     rspin_unlock(&d->ioreq_server.lock);
@@ -936,6 +1104,8 @@ static int ioreq_server_unmap_io_range(struct domain *d, ioservid_t id,
         goto out;
 
     rc = rangeset_remove_range(r, start, end);
+    if ( !rc && s->enabled )
+        ioreq_index_update(d);
 
  out:
     rspin_unlock(&d->ioreq_server.lock);
@@ -1011,6 +1181,8 @@ static int ioreq_server_set_state(struct domain *d, ioservid_t id,
     else
         ioreq_server_disable(s);
 
+    ioreq_index_update(d);
+
     domain_unpause(d);
 
     rc = 0;
@@ -1094,63 +1266,136 @@ void ioreq_server_destroy_all(struct domain *d)
         xfree(s);
     }
 
+    write_lock(&d->ioreq_server.index_lock);
+    xfree(d->ioreq_server.index);
+    d->ioreq_server.index = NULL;
+    write_unlock(&d->ioreq_server.index_lock);
+
     rspin_unlock(&d->ioreq_server.lock);
 }
 
+/*
+ * Look the access up in the vCPU's cache of recently hit pieces of the
+ * dispatch index, then in the index itself.  Return false if the servers
+ * have to be scanned.
+ */
+static bool ioreq_server_lookup(struct domain *d, uint8_t type,
+                                unsigned long start, unsigned long end,
+                                struct ioreq_server **sp)
+{
+    struct vcpu *v = current;
+    struct ioreq_cache_entry *c = NULL;
+    const struct ioreq_index *index;
+    const struct ioreq_index_range *r;
+    unsigned int generation;
+    bool found = false;
+
+    if ( v->domain == d )
+    {
+        c = &v->io.ioreq_cache[(type ^ (start >> PAGE_SHIFT)) %
+                               ARRAY_SIZE(v->io.ioreq_cache)];
+        if ( c->generation == read_atomic(&d->ioreq_server.generation) &&
+             c->type == type && c->s <= start && end <= c->e )
+        {
+            struct ioreq_server *s = GET_IOREQ_SERVER(d, c->id);
+
+            if ( s && s->enabled )
+            {
+                perfc_incr(ioreq_cache_hit);
+                *sp = s;
+                return true;
+            }
+        }
+    }
+
+    read_lock(&d->ioreq_server.index_lock);
+
+    index = d->ioreq_server.index;
+    generation = d->ioreq_server.generation;
+    r = index ? ioreq_index_find(index, type, start) : NULL;
+
+    if ( !index )
+        /* No index (out of memory): scan. */;
+    else if ( !r || r->e < start )
+    {
+        /* No server has a range containing start. */
+        *sp = NULL;
+        found = true;
+    }
+    else if ( end <= r->e )
+    {
+        *sp = GET_IOREQ_SERVER(d, r->id);
+        found = true;
+
+        if ( c )
+            *c = (struct ioreq_cache_entry){
+                .s = r->s, .e = r->e, .generation = generation,
+                .type = type, .id = r->id,
+            };
+    }
+
+    read_unlock(&d->ioreq_server.index_lock);
+
+    if ( found )
+        perfc_incr(ioreq_index_hit);
+    else
+        perfc_incr(ioreq_index_miss);
+
+    return found;
+}
+
 struct ioreq_server *ioreq_server_select(struct domain *d,
                                          ioreq_t *p)
 {
     struct ioreq_server *s;
     uint8_t type;
     uint64_t addr;
+    unsigned long start, end;
     unsigned int id;
 
     if ( !arch_ioreq_server_get_type_addr(d, p, &type, &addr) )
         return NULL;
 
-    FOR_EACH_IOREQ_SERVER(d, id, s)
+    switch ( type )
     {
-        struct rangeset *r;
-
-        if ( !s->enabled )
-            continue;
-
-        r = s->range[type];
-
-        switch ( type )
-        {
-            unsigned long start, end;
+    case XEN_DMOP_IO_RANGE_PORT:
+        start = addr;
+        end = start + p->size - 1;
+        break;
 
-        case XEN_DMOP_IO_RANGE_PORT:
-            start = addr;
-            end = start + p->size - 1;
-            if ( rangeset_contains_range(r, start, end) )
-                return s;
+    case XEN_DMOP_IO_RANGE_MEMORY:
+        start = ioreq_mmio_first_byte(p);
+        end = ioreq_mmio_last_byte(p);
+        break;
 
-            break;
+    case XEN_DMOP_IO_RANGE_PCI:
+        start = end = addr >> 32;
+        break;
 
-        case XEN_DMOP_IO_RANGE_MEMORY:
-            start = ioreq_mmio_first_byte(p);
-            end = ioreq_mmio_last_byte(p);
+    default:
+        ASSERT_UNREACHABLE();
+        return NULL;
+    }
 
-            if ( rangeset_contains_range(r, start, end) )
-                return s;
+    if ( ioreq_server_lookup(d, type, start, end, &s) )
+        goto found;
 
-            break;
+    FOR_EACH_IOREQ_SERVER(d, id, s)
+    {
+        if ( s->enabled && rangeset_contains_range(s->range[type], start, end) )
+            goto found;
+    }
 
-        case XEN_DMOP_IO_RANGE_PCI:
-            if ( rangeset_contains_singleton(r, addr >> 32) )
-            {
-                p->type = IOREQ_TYPE_PCI_CONFIG;
-                p->addr = addr;
-                return s;
-            }
+    return NULL;
 
-            break;
-        }
+ found:
+    if ( s && type == XEN_DMOP_IO_RANGE_PCI )
+    {
+        p->type = IOREQ_TYPE_PCI_CONFIG;
+        p->addr = addr;
     }
 
-    return NULL;
+    return s;
 }
 
 static int ioreq_send_buffered(struct ioreq_server *s, ioreq_t *p)
@@ -1246,6 +1491,63 @@ static int ioreq_send_buffered(struct ioreq_server *s, ioreq_t *p)
     return IOREQ_STATUS_HANDLED;
 }
 
+/* Requests which complete for the guest once queued, see ioreq_ring_t. */
+static bool ioreq_is_posted(const ioreq_t *p)
+{
+    return p->type == IOREQ_TYPE_COPY && p->dir == IOREQ_WRITE &&
+           !p->data_is_ptr && p->count == 1;
+}
+
+static int ioreq_send_ring(struct ioreq_server *s, const ioreq_t *p)
+{
+    struct domain *d = current->domain;
+    ioreq_ring_t *ring = s->bufioreq.va;
+    uint32_t prod, cons, event;
+
+    BUILD_BUG_ON(sizeof(ioreq_ring_t) > PAGE_SIZE);
+    BUILD_BUG_ON(IOREQ_RING_SLOT_NUM & (IOREQ_RING_SLOT_NUM - 1));
+
+    if ( !ring )
+        return IOREQ_STATUS_UNHANDLED;
+
+    spin_lock(&s->bufioreq_lock);
+
+    prod = ring->req_prod;
+    cons = ACCESS_ONCE(ring->req_cons);
+
+    if ( prod - cons >= IOREQ_RING_SLOT_NUM )
+    {
+        /* The ring is full: send the request through the normal path. */
+        spin_unlock(&s->bufioreq_lock);
+        perfc_incr(ioreq_ring_full);
+        return IOREQ_STATUS_UNHANDLED;
+    }
+
+    ring->req[prod % IOREQ_RING_SLOT_NUM] = *p;
+    ring->req[prod % IOREQ_RING_SLOT_NUM].state = STATE_IOREQ_READY;
+
+    /* Make the ioreq_t visible /before/ req_prod ... */
+    smp_wmb();
+    ring->req_prod = ++prod;
+
+    /* ... and req_prod before reading req_event. */
+    smp_mb();
+    event = ACCESS_ONCE(ring->req_event);
+
+    /* Only notify if the device model asked to be woken at this request. */
+    if ( event == prod )
+    {
+        perfc_incr(ioreq_ring_notify);
+        notify_via_xen_event_channel(d, s->bufioreq_evtchn);
+    }
+
+    spin_unlock(&s->bufioreq_lock);
+
+    perfc_incr(ioreq_ring_posted);
+
+    return IOREQ_STATUS_HANDLED;
+}
+
 int ioreq_send(struct ioreq_server *s, ioreq_t *proto_p,
                bool buffered)
 {
@@ -1256,7 +1558,16 @@ int ioreq_send(struct ioreq_server *s, ioreq_t *proto_p,
 
     ASSERT(s);
 
-    if ( buffered )
+    if ( s->bufioreq_handling == HVM_IOREQSRV_BUFIOREQ_RING &&
+         (buffered || ioreq_is_posted(proto_p)) )
+    {
+        int rc = ioreq_send_ring(s, proto_p);
+
+        /* Posted writes fall back to a synchronous request. */
+        if ( buffered || rc != IOREQ_STATUS_UNHANDLED )
+            return rc;
+    }
+    else if ( buffered )
         return ioreq_send_buffered(s, proto_p);
 
     if ( unlikely(!vcpu_start_shutdown_deferral(curr)) )
@@ -1332,6 +1643,9 @@ unsigned int ioreq_broadcast(ioreq_t *p, bool buffered)
 void ioreq_domain_init(struct domain *d)
 {
     rspin_lock_init(&d->ioreq_server.lock);
+    rwlock_init(&d->ioreq_server.index_lock);
+    /* vCPU cache entries start out at generation 0, i.e. invalid. */
+    d->ioreq_server.generation = 1;
 
     arch_ioreq_domain_init(d);
 }
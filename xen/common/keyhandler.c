@@ -312,6 +312,8 @@ static void cf_check dump_domains(unsigned char key)
 
         rangeset_domain_printk(d);
 
+        iommu_domain_printk(d);
+
         dump_pageframe_info(d);
 
         printk("NODE affinity for domain %d: [%*pbl]\n",
@@ -0,0 +1 @@
+cmd_common/libelf/built_in.o := ld    -melf_x86_64 --no-warn-rwx-segments -r -o common/libelf/built_in.o common/libelf/libelf.o
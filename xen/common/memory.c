@@ -549,7 +549,9 @@ int guest_remove_page(struct domain *d, unsigned long gmfn)
     if ( !rc && !is_domain_direct_mapped(d) )
         put_page_alloc_ref(page);
 
-    put_page(page);
+    /* With flushes batched, the page can't be freed before the IOTLB is. */
+    if ( !iommu_flush_batch_put_page(d, page) )
+        put_page(page);
 
 #ifdef CONFIG_X86
  out_put_gfn:
@@ -567,12 +569,16 @@ static void decrease_reservation(struct memop_args *a)
 {
     unsigned long i, j;
     xen_pfn_t gmfn;
+    struct iommu_flush_batch batch;
 
     if ( !guest_handle_subrange_okay(a->extent_list, a->nr_done,
                                      a->nr_extents-1) ||
          a->extent_order > max_order(current->domain) )
         return;
 
+    /* Flushed before returning, hence also before any preemption. */
+    iommu_flush_batch_start(&batch, a->domain);
+
     for ( i = a->nr_done; i < a->nr_extents; i++ )
     {
         unsigned long pod_done;
@@ -631,6 +637,8 @@ static void decrease_reservation(struct memop_args *a)
     }
 
  out:
+    iommu_flush_batch_finish(&batch);
+
     a->nr_done = i;
 }
 
@@ -0,0 +1,396 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+/*
+ * microbench.c: Microbenchmarks of hot hypervisor primitives.
+ *
+ * Each benchmark runs batches of operations on the current pCPU, timed with
+ * get_cycles(), with interrupts enabled: the fastest batch is the figure to
+ * compare between releases, the slowest shows the noise.  Runs are
+ * serialised by the sysctl lock, or happen at boot, so the benchmarks share
+ * a static context.
+ */
+
+#include <xen/domain_page.h>
+#include <xen/errno.h>
+#include <xen/event.h>
+#include <xen/init.h>
+#include <xen/lib.h>
+#include <xen/microbench.h>
+#include <xen/mm.h>
+#include <xen/param.h>
+#include <xen/rcupdate.h>
+#include <xen/rwlock.h>
+#include <xen/sched.h>
+#include <xen/softirq.h>
+#include <xen/spinlock.h>
+#include <xen/tasklet.h>
+#include <xen/time.h>
+#include <xen/timer.h>
+#include <xen/vmap.h>
+
+#include <public/sysctl.h>
+
+#define DEFAULT_BATCHES 16
+#define MAX_BATCHES     1024
+
+/*
+ * Bounds on the work done by one run, as the sysctl isn't preemptible: its
+ * total operations, in batches of a benchmark's max_iterations, and its
+ * duration, past which it stops after the current batch.
+ */
+#define MAX_RUN_BATCHES 4
+#define MAX_RUN_TIME    SECONDS(1)
+
+static struct {
+    spinlock_t lock;
+    rwlock_t rwlock;
+    struct page_info *pg;
+    struct timer timer;
+    struct tasklet tasklet;
+    struct rcu_head rcu;
+    unsigned int done;
+    evtchn_port_t port;
+    s_time_t deadline;  /* The current run stops past it. */
+    bool timed_out;     /* The current run gave up. */
+    bool rcu_queued;    /* A timed out RCU callback is still pending. */
+} ctx = {
+    .lock = SPIN_LOCK_UNLOCKED,
+    .rwlock = RW_LOCK_UNLOCKED,
+};
+
+struct microbench {
+    const char *name;
+    unsigned int iterations;     /* Default per batch. */
+    unsigned int max_iterations;
+    int (*init)(void);
+    void (*run)(unsigned int iterations);
+    void (*fini)(void);
+};
+
+static void cf_check run_spin_lock(unsigned int n)
+{
+    while ( n-- )
+    {
+        spin_lock(&ctx.lock);
+        spin_unlock(&ctx.lock);
+    }
+}
+
+static void cf_check run_read_lock(unsigned int n)
+{
+    while ( n-- )
+    {
+        read_lock(&ctx.rwlock);
+        read_unlock(&ctx.rwlock);
+    }
+}
+
+static void cf_check run_write_lock(unsigned int n)
+{
+    while ( n-- )
+    {
+        write_lock(&ctx.rwlock);
+        write_unlock(&ctx.rwlock);
+    }
+}
+
+static void cf_check run_alloc_page(unsigned int n)
+{
+    while ( n-- )
+    {
+        struct page_info *pg = alloc_domheap_page(NULL, 0);
+
+        if ( pg )
+            free_domheap_page(pg);
+    }
+}
+
+static int cf_check init_page(void)
+{
+    ctx.pg = alloc_domheap_page(NULL, 0);
+
+    return ctx.pg ? 0 : -ENOMEM;
+}
+
+static void cf_check fini_page(void)
+{
+    free_domheap_page(ctx.pg);
+    ctx.pg = NULL;
+}
+
+static void cf_check run_map_domain_page(unsigned int n)
+{
+    mfn_t mfn = page_to_mfn(ctx.pg);
+
+    while ( n-- )
+        unmap_domain_page(map_domain_page(mfn));
+}
+
+static void cf_check run_vmap(unsigned int n)
+{
+    mfn_t mfn = page_to_mfn(ctx.pg);
+
+    while ( n-- )
+    {
+        void *va = vmap(&mfn, 1);
+
+        if ( va )
+            vunmap(va);
+    }
+}
+
+static void cf_check timer_fn(void *unused)
+{
+}
+
+static int cf_check init_timer_bench(void)
+{
+    init_timer(&ctx.timer, timer_fn, NULL, smp_processor_id());
+
+    return 0;
+}
+
+static void cf_check fini_timer_bench(void)
+{
+    kill_timer(&ctx.timer);
+}
+
+/* Insertion into, and removal from, the pCPU's timer heap. */
+static void cf_check run_set_timer(unsigned int n)
+{
+    while ( n-- )
+    {
+        set_timer(&ctx.timer, NOW() + SECONDS(10));
+        stop_timer(&ctx.timer);
+    }
+}
+
+/* Raising TIMER_SOFTIRQ, with no timer due, and dispatching it. */
+static void cf_check run_raise_softirq(unsigned int n)
+{
+    while ( n-- )
+    {
+        raise_softirq(TIMER_SOFTIRQ);
+        process_pending_softirqs();
+    }
+}
+
+static void cf_check tasklet_fn(void *unused)
+{
+    ctx.done++;
+}
+
+static int cf_check init_tasklet_bench(void)
+{
+    softirq_tasklet_init(&ctx.tasklet, tasklet_fn, NULL);
+
+    return 0;
+}
+
+static void cf_check fini_tasklet_bench(void)
+{
+    tasklet_kill(&ctx.tasklet);
+}
+
+/* Scheduling a softirq tasklet on this pCPU, and running it. */
+static void cf_check run_tasklet(unsigned int n)
+{
+    while ( n-- )
+    {
+        tasklet_schedule(&ctx.tasklet);
+        process_pending_softirqs();
+    }
+}
+
+static void cf_check rcu_fn(struct rcu_head *head)
+{
+    ctx.done++;
+    ctx.rcu_queued = false;
+}
+
+/* Time from call_rcu() to its callback running on this pCPU. */
+static void cf_check run_rcu(unsigned int n)
+{
+    while ( n-- )
+    {
+        unsigned int done = ctx.done;
+
+        call_rcu(&ctx.rcu, rcu_fn);
+        while ( ctx.done == done )
+        {
+            process_pending_softirqs();
+            if ( NOW() > ctx.deadline )
+            {
+                /* The callback stays queued, so ctx.rcu can't be reused. */
+                ctx.rcu_queued = true;
+                ctx.timed_out = true;
+                return;
+            }
+            cpu_relax();
+        }
+    }
+}
+
+static int cf_check init_rcu(void)
+{
+    return ctx.rcu_queued ? -EBUSY : 0;
+}
+
+/* The port is bound by the caller, and one send checks it is usable. */
+static int cf_check init_evtchn(void)
+{
+    return ctx.port ? evtchn_send(current->domain, ctx.port) : -ENODATA;
+}
+
+static void cf_check run_evtchn_send(unsigned int n)
+{
+    while ( n-- )
+        evtchn_send(current->domain, ctx.port);
+}
+
+static const struct microbench benchmarks[] = {
+    { "spin_lock",        1000, 1000000, NULL, run_spin_lock },
+    { "read_lock",        1000, 1000000, NULL, run_read_lock },
+    { "write_lock",       1000, 1000000, NULL, run_write_lock },
+    { "alloc_domheap_page", 100, 100000, NULL, run_alloc_page },
+    { "map_domain_page",  1000, 1000000, init_page, run_map_domain_page,
+      fini_page },
+    { "vmap",              100,  100000, init_page, run_vmap, fini_page },
+    { "set_timer",        1000,  100000, init_timer_bench, run_set_timer,
+      fini_timer_bench },
+    { "raise_softirq",    1000,  100000, NULL, run_raise_softirq },
+    { "tasklet_schedule", 1000,  100000, init_tasklet_bench, run_tasklet,
+      fini_tasklet_bench },
+    { "rcu_grace_period",    1,       4, init_rcu, run_rcu },
+    { "evtchn_send",      1000, 1000000, init_evtchn, run_evtchn_send },
+};
+
+static int microbench_run(const struct microbench *b,
+                          struct xen_sysctl_microbench_op *op)
+{
+    unsigned int i, max_batches;
+    int rc;
+
+    if ( !op->iterations )
+        op->iterations = b->iterations;
+    op->iterations = min(op->iterations, b->max_iterations);
+    max_batches = MAX_RUN_BATCHES * b->max_iterations / op->iterations;
+    if ( !op->nr_batches )
+        op->nr_batches = DEFAULT_BATCHES;
+    op->nr_batches = min(op->nr_batches, min(max_batches, MAX_BATCHES + 0U));
+
+    op->cycles_min = ~0ULL;
+    op->cycles_max = 0;
+    op->cycles_total = 0;
+    op->cycles_khz = cpu_khz;
+    ctx.deadline = NOW() + MAX_RUN_TIME;
+    ctx.timed_out = false;
+
+    rc = b->init ? b->init() : 0;
+    if ( rc )
+        return rc;
+
+    /* Warm up caches and lazily allocated structures. */
+    b->run(1);
+    if ( ctx.timed_out )
+        rc = -ETIMEDOUT;
+
+    for ( i = 0; !rc && i < op->nr_batches; i++ )
+    {
+        cycles_t start = get_cycles(), delta;
+
+        b->run(op->iterations);
+        delta = get_cycles() - start;
+
+        if ( ctx.timed_out )
+        {
+            rc = -ETIMEDOUT;
+            break;
+        }
+
+        op->cycles_min = min_t(uint64_t, op->cycles_min, delta);
+        op->cycles_max = max_t(uint64_t, op->cycles_max, delta);
+        op->cycles_total += delta;
+
+        /* Don't hold up softirqs, nor trip the watchdog, on long runs. */
+        process_pending_softirqs();
+
+        if ( NOW() > ctx.deadline )
+        {
+            op->nr_batches = i + 1;
+            break;
+        }
+    }
+
+    if ( b->fini )
+        b->fini();
+
+    return rc;
+}
+
+int microbench_control(struct xen_sysctl_microbench_op *op)
+{
+    const struct microbench *b;
+
+    op->nr_benchmarks = ARRAY_SIZE(benchmarks);
+    if ( op->index >= ARRAY_SIZE(benchmarks) )
+        return -ENOENT;
+
+    b = &benchmarks[op->index];
+    safe_strcpy(op->name, b->name);
+
+    switch ( op->cmd )
+    {
+    case XEN_SYSCTL_MICROBENCH_info:
+        op->iterations = b->iterations;
+        op->nr_batches = DEFAULT_BATCHES;
+        return 0;
+
+    case XEN_SYSCTL_MICROBENCH_run:
+        ctx.port = op->evtchn_port;
+        return microbench_run(b, op);
+
+    default:
+        return -EOPNOTSUPP;
+    }
+}
+
+static bool __initdata opt_microbench;
+boolean_param("microbench", opt_microbench);
+
+static int __init cf_check microbench_boot(void)
+{
+    unsigned int i;
+
+    if ( !opt_microbench )
+        return 0;
+
+    printk("Microbenchmarks on CPU%u, cycles per operation:\n",
+           smp_processor_id());
+
+    for ( i = 0; i < ARRAY_SIZE(benchmarks); i++ )
+    {
+        struct xen_sysctl_microbench_op op = { .index = i };
+        int rc = microbench_run(&benchmarks[i], &op);
+        unsigned long ops = (unsigned long)op.iterations * op.nr_batches;
+
+        if ( rc )
+            printk("  %-20s skipped (%d)\n", benchmarks[i].name, rc);
+        else
+            printk("  %-20s min %8"PRIu64" avg %8"PRIu64" max %8"PRIu64"\n",
+                   benchmarks[i].name, op.cycles_min / op.iterations,
+                   op.cycles_total / ops, op.cycles_max / op.iterations);
+    }
+
+    return 0;
+}
+__initcall(microbench_boot);
+
+/*
+ * Local variables:
+ * mode: C
+ * c-file-style: "BSD"
+ * c-basic-offset: 4
+ * tab-width: 4
+ * indent-tabs-mode: nil
+ * End:
+ */
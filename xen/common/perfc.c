@@ -3,9 +3,13 @@
 #include <xen/errno.h>
 #include <xen/guest_access.h>
 #include <xen/lib.h>
+#include <xen/mm.h>
 #include <xen/perfc.h>
+#include <xen/pfn.h>
 #include <xen/spinlock.h>
 #include <xen/time.h>
+#include <xen/timer.h>
+#include <xen/vmap.h>
 
 #include <public/sysctl.h>
 
@@ -27,6 +31,8 @@ static const struct {
 
 DEFINE_PER_CPU(perfc_t[NUM_PERFCOUNTERS], perfcounters);
 
+static unsigned int perfc_resets;
+
 void cf_check perfc_printall(unsigned char key)
 {
     unsigned int i, j;
@@ -122,6 +128,8 @@ void cf_check perfc_reset(unsigned char key)
     if ( key != '\0' )
         printk("Xen performance counters RESET (now = %"PRI_stime")\n", now);
 
+    perfc_resets++;
+
     /* leave STATUS counters alone -- don't reset */
 
     for ( i = j = 0; i < NR_PERFCTRS; i++ )
@@ -235,6 +243,166 @@ static int perfc_copy_info(XEN_GUEST_HANDLE_64(xen_sysctl_perfc_desc_t) desc,
     return 0;
 }
 
+/*
+ * Snapshot shared with the control domain.  Only the timer writes to it once
+ * it is allocated, and perfc_control()'s lock serialises the rest.
+ */
+static struct {
+    struct xen_perfc_snapshot *s;
+    mfn_t *mfns;
+    unsigned int nr_frames;
+    unsigned int period_ms;
+    struct timer timer;
+} snap;
+
+static void cf_check perfc_snapshot_refresh(void *unused)
+{
+    struct xen_perfc_snapshot *s = snap.s;
+    perfc_t *vals = (void *)s + s->vals_offset;
+    unsigned int cpu, period_ms = ACCESS_ONCE(snap.period_ms);
+
+    write_atomic(&s->seq, s->seq + 1);
+    smp_wmb();
+
+    for ( cpu = 0; cpu < s->nr_cpus; cpu++, vals += NUM_PERFCOUNTERS )
+    {
+        if ( cpu_online(cpu) )
+            memcpy(vals, per_cpu(perfcounters, cpu),
+                   NUM_PERFCOUNTERS * sizeof(perfc_t));
+        else
+            memset(vals, 0, NUM_PERFCOUNTERS * sizeof(perfc_t));
+    }
+    s->resets = perfc_resets;
+    s->period_ms = period_ms;
+    s->stime = NOW();
+
+    smp_wmb();
+    write_atomic(&s->seq, s->seq + 1);
+
+    if ( period_ms )
+        set_timer(&snap.timer, NOW() + MILLISECS(period_ms));
+}
+
+static int perfc_snapshot_alloc(void)
+{
+    unsigned int vals_offset =
+        ROUNDUP(offsetof(struct xen_perfc_snapshot, desc[NR_PERFCTRS]),
+                sizeof(uint64_t));
+    unsigned int i, j, nr_frames =
+        PFN_UP(vals_offset + nr_cpu_ids * NUM_PERFCOUNTERS * sizeof(perfc_t));
+    struct xen_perfc_snapshot *s;
+    mfn_t *mfns = xmalloc_array(mfn_t, nr_frames);
+
+    if ( !mfns )
+        return -ENOMEM;
+
+    for ( i = 0; i < nr_frames; i++ )
+    {
+        void *p = alloc_xenheap_page();
+
+        if ( !p )
+            goto fail;
+        clear_page(p);
+        mfns[i] = _mfn(virt_to_mfn(p));
+    }
+
+    s = vmap(mfns, nr_frames);
+    if ( !s )
+        goto fail;
+
+    s->nr_counters = NR_PERFCTRS;
+    s->nr_vals = NUM_PERFCOUNTERS;
+    s->nr_cpus = nr_cpu_ids;
+    s->vals_offset = vals_offset;
+
+    for ( i = j = 0; i < NR_PERFCTRS; i++ )
+    {
+        struct xen_perfc_snapshot_desc *d = &s->desc[i];
+
+        safe_strcpy(d->name, perfc_info[i].name);
+        d->offset = j;
+        switch ( perfc_info[i].type )
+        {
+        case TYPE_S_SINGLE:
+            d->flags = XEN_PERFC_SNAPSHOT_status;
+            fallthrough;
+        case TYPE_SINGLE:
+            d->nr_vals = 1;
+            break;
+        case TYPE_S_ARRAY:
+            d->flags = XEN_PERFC_SNAPSHOT_status;
+            fallthrough;
+        case TYPE_ARRAY:
+            d->nr_vals = perfc_info[i].nr_elements;
+            break;
+        }
+        j += d->nr_vals;
+    }
+    BUG_ON(j != NUM_PERFCOUNTERS);
+
+    for ( i = 0; i < nr_frames; i++ )
+        share_xen_page_with_privileged_guests(mfn_to_page(mfns[i]), SHARE_ro);
+
+    init_timer(&snap.timer, perfc_snapshot_refresh, NULL, smp_processor_id());
+    snap.mfns = mfns;
+    snap.nr_frames = nr_frames;
+    snap.s = s;
+
+    return 0;
+
+ fail:
+    while ( i-- )
+        free_xenheap_page(mfn_to_virt(mfn_x(mfns[i])));
+    xfree(mfns);
+
+    return -ENOMEM;
+}
+
+static int perfc_snapshot(struct xen_sysctl_perfc_op *pc)
+{
+    unsigned int i;
+    int rc;
+
+    if ( !snap.s && (rc = perfc_snapshot_alloc()) != 0 )
+        return rc;
+
+    if ( !guest_handle_is_null(pc->frames) )
+    {
+        if ( pc->nr_frames < snap.nr_frames )
+        {
+            pc->nr_frames = snap.nr_frames;
+            return -ENOBUFS;
+        }
+
+        for ( i = 0; i < snap.nr_frames; i++ )
+        {
+            uint64_t mfn = mfn_x(snap.mfns[i]);
+
+            if ( copy_to_guest_offset(pc->frames, i, &mfn, 1) )
+                return -EFAULT;
+        }
+    }
+    pc->nr_frames = snap.nr_frames;
+
+    /* The timer is the only writer: refresh from it, straight away. */
+    ACCESS_ONCE(snap.period_ms) = pc->period_ms;
+    if ( pc->period_ms )
+        set_timer(&snap.timer, NOW());
+    else
+    {
+        /*
+         * A refresh running meanwhile may re-arm the timer, and publish the
+         * old period: wait for it to finish.
+         */
+        kill_timer(&snap.timer);
+        init_timer(&snap.timer, perfc_snapshot_refresh, NULL,
+                   smp_processor_id());
+        snap.s->period_ms = 0;
+    }
+
+    return 0;
+}
+
 /* Dom0 control of perf counters */
 int perfc_control(struct xen_sysctl_perfc_op *pc)
 {
@@ -254,6 +422,10 @@ int perfc_control(struct xen_sysctl_perfc_op *pc)
         rc = perfc_copy_info(pc->desc, pc->val);
         break;
 
+    case XEN_SYSCTL_PERFCOP_snapshot:
+        rc = perfc_snapshot(pc);
+        break;
+
     default:
         rc = -EINVAL;
         break;
@@ -10,11 +10,17 @@
 #include <xen/sched.h>
 #include <xen/errno.h>
 #include <xen/rangeset.h>
+#include <xen/rbtree.h>
 #include <xsm/xsm.h>
 
-/* An inclusive range [s,e] and pointer to next range in ascending order. */
+/*
+ * An inclusive range [s,e], linked to the next range in ascending order and
+ * indexed by s in a tree.  Ranges never overlap, so adjusting s in place
+ * doesn't reorder them.
+ */
 struct range {
     struct list_head list;
+    struct rb_node node;
     unsigned long s, e;
 };
 
@@ -23,8 +29,9 @@ struct rangeset {
     struct list_head rangeset_list;
     struct domain   *domain;
 
-    /* Ordered list of ranges contained in this set, and protecting lock. */
+    /* Ordered list and tree of ranges contained in this set, and lock. */
     struct list_head range_list;
+    struct rb_root   range_tree;
 
     /* Number of ranges that can be allocated */
     long             nr_ranges;
@@ -38,20 +45,27 @@ struct rangeset {
 };
 
 /*****************************
- * Private range functions hide the underlying linked-list implementation.
+ * Private range functions hide the underlying list and tree implementation.
  */
 
 /* Find highest range lower than or containing s. NULL if no such range. */
 static struct range *find_range(
     struct rangeset *r, unsigned long s)
 {
-    struct range *x = NULL, *y;
+    struct rb_node *n = r->range_tree.rb_node;
+    struct range *x = NULL;
 
-    list_for_each_entry ( y, &r->range_list, list )
+    while ( n )
     {
+        struct range *y = rb_entry(n, struct range, node);
+
         if ( y->s > s )
-            break;
-        x = y;
+            n = n->rb_left;
+        else
+        {
+            x = y;
+            n = n->rb_right;
+        }
     }
 
     return x;
@@ -79,15 +93,30 @@ static struct range *next_range(
 static void insert_range(
     struct rangeset *r, struct range *x, struct range *y)
 {
+    struct rb_node **link = &r->range_tree.rb_node, *parent = NULL;
+
     list_add(&y->list, (x != NULL) ? &x->list : &r->range_list);
+
+    while ( *link )
+    {
+        parent = *link;
+        if ( y->s < rb_entry(parent, struct range, node)->s )
+            link = &parent->rb_left;
+        else
+            link = &parent->rb_right;
+    }
+
+    rb_link_node(&y->node, parent, link);
+    rb_insert_color(&y->node, &r->range_tree);
 }
 
-/* Remove a range from its list and free it. */
+/* Remove a range from its list and tree, and free it. */
 static void destroy_range(
     struct rangeset *r, struct range *x)
 {
     r->nr_ranges++;
 
+    rb_erase(&x->node, &r->range_tree);
     list_del(&x->list);
     xfree(x);
 }
@@ -444,6 +473,7 @@ struct rangeset *rangeset_new(
 
     rwlock_init(&r->lock);
     INIT_LIST_HEAD(&r->range_list);
+    r->range_tree = RB_ROOT;
     r->nr_ranges = -1;
 
     BUG_ON(flags & ~(RANGESETF_prettyprint_hex | RANGESETF_no_print));
@@ -526,6 +556,7 @@ void rangeset_domain_destroy(
 void rangeset_swap(struct rangeset *a, struct rangeset *b)
 {
     LIST_HEAD(tmp);
+    struct rb_root tmp_tree;
 
     if ( a < b )
     {
@@ -542,6 +573,10 @@ void rangeset_swap(struct rangeset *a, struct rangeset *b)
     list_splice_init(&b->range_list, &a->range_list);
     list_splice(&tmp, &b->range_list);
 
+    tmp_tree = a->range_tree;
+    a->range_tree = b->range_tree;
+    b->range_tree = tmp_tree;
+
     write_unlock(&a->lock);
     write_unlock(&b->lock);
 }
@@ -26,6 +26,7 @@ static inline void rspin_until_writer_unlock(rwlock_t *lock, u32 cnts)
 void queue_read_lock_slowpath(rwlock_t *lock)
 {
     u32 cnts;
+    s_time_t block = rw_profile_block_start(lock);
 
     /*
      * Readers come here when they cannot get the lock without waiting.
@@ -59,6 +60,7 @@ void queue_read_lock_slowpath(rwlock_t *lock)
     spin_unlock(&lock->lock);
 
     lock_enter(&lock->lock.debug);
+    rw_profile_read_got(lock, block);
 }
 
 /*
@@ -68,6 +70,7 @@ void queue_read_lock_slowpath(rwlock_t *lock)
 void queue_write_lock_slowpath(rwlock_t *lock)
 {
     u32 cnts;
+    s_time_t block = rw_profile_block_start(lock);
 
     /*
      * Put the writer into the wait queue.
@@ -112,6 +115,7 @@ void queue_write_lock_slowpath(rwlock_t *lock)
     spin_unlock(&lock->lock);
 
     lock_enter(&lock->lock.debug);
+    rw_profile_got(lock, block);
 }
 
 
@@ -122,6 +126,8 @@ void _percpu_write_lock(percpu_rwlock_t **per_cpudata,
 {
     unsigned int cpu;
     cpumask_t *rwlock_readers = &this_cpu(percpu_rwlock_readers);
+    s_time_t block;
+    bool waited = false;
 
     /* Validate the correct per_cpudata variable has been provided. */
     _percpu_rwlock_owner_check(per_cpudata, percpu_rwlock);
@@ -143,6 +149,7 @@ void _percpu_write_lock(percpu_rwlock_t **per_cpudata,
     /* Using a per cpu cpumask is only safe if there is no nesting. */
     ASSERT(!in_irq());
     cpumask_copy(rwlock_readers, &cpu_online_map);
+    block = rw_profile_block_start(&percpu_rwlock->rwlock);
 
     /* Check if there are any percpu readers in progress on this rwlock. */
     for ( ; ; )
@@ -161,7 +168,15 @@ void _percpu_write_lock(percpu_rwlock_t **per_cpudata,
             break;
         /* Give the coherency fabric a break. */
         cpu_relax();
+        waited = true;
     };
 
+    /*
+     * Account waiting for the percpu readers to drain as blocking rather than
+     * holding the lock.
+     */
+    if ( waited )
+        rw_profile_got(&percpu_rwlock->rwlock, block);
+
     lock_enter(&percpu_rwlock->rwlock.lock.debug);
 }
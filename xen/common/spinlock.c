@@ -9,6 +9,8 @@
 #include <xen/spinlock.h>
 #include <xen/guest_access.h>
 #include <xen/preempt.h>
+#include <xen/rwlock.h>
+#include <xen/xmalloc.h>
 #include <public/sysctl.h>
 #include <asm/processor.h>
 #include <asm/atomic.h>
@@ -262,27 +264,66 @@ void spin_debug_disable(void)
 
 #ifdef CONFIG_DEBUG_LOCK_PROFILE
 
-#define LOCK_PROFILE_PAR lock->profile
-#define LOCK_PROFILE_REL                                                     \
-    if ( profile )                                                           \
-    {                                                                        \
-        profile->time_hold += NOW() - profile->time_locked;                  \
-        profile->lock_cnt++;                                                 \
+bool __read_mostly lock_profile_active;
+boolean_param("lock-profile", lock_profile_active);
+
+static unsigned int lock_profile_bucket(s_time_t t)
+{
+    return t > 0 ? min_t(unsigned int, flsl(t), LOCKPROF_HIST_BUCKETS - 1)
+                 : 0;
+}
+
+/*
+ * The lock is held when accounting the acquisition or the release, which
+ * serialises the updates to the profile data.
+ */
+void _lock_profile_got(struct lock_profile *profile, s_time_t block)
+{
+    s_time_t now = NOW();
+
+    profile->time_locked = now;
+
+    if ( block )
+    {
+        profile->time_block += now - block;
+        profile->block_cnt++;
+        profile->block_hist[lock_profile_bucket(now - block)]++;
     }
+}
+
+void _lock_profile_rel(struct lock_profile *profile)
+{
+    s_time_t held = NOW() - profile->time_locked;
+
+    profile->time_locked = 0;
+    profile->time_hold += held;
+    profile->lock_cnt++;
+    profile->hold_hist[lock_profile_bucket(held)]++;
+}
+
+/* Accounting for waits of shared (read) acquisitions, made concurrently. */
+void _lock_profile_block_shared(struct lock_profile *profile, s_time_t block)
+{
+    s_time_t waited = NOW() - block;
+
+    (void)arch_fetch_and_add(&profile->time_block, waited);
+    (void)arch_fetch_and_add(&profile->block_cnt, 1);
+    (void)arch_fetch_and_add(&profile->block_hist[lock_profile_bucket(waited)],
+                             1);
+}
+
+#define LOCK_PROFILE_PAR lock->profile
+#define LOCK_PROFILE_REL              lock_profile_rel(profile)
 #define LOCK_PROFILE_VAR(var, val)    s_time_t var = (val)
-#define LOCK_PROFILE_BLOCK(var)       (var) = (var) ? : NOW()
+#define LOCK_PROFILE_BLOCK(var)                                              \
+    (var) = (var) ? : lock_profile_block_start(profile)
 #define LOCK_PROFILE_BLKACC(tst, val)                                        \
-    if ( tst )                                                               \
+    if ( (tst) && (val) && lock_profile_active )                             \
     {                                                                        \
-        profile->time_block += profile->time_locked - (val);                 \
+        profile->time_block += NOW() - (val);                                \
         profile->block_cnt++;                                                \
     }
-#define LOCK_PROFILE_GOT(val)                                                \
-    if ( profile )                                                           \
-    {                                                                        \
-        profile->time_locked = NOW();                                        \
-        LOCK_PROFILE_BLKACC(val, val);                                       \
-    }
+#define LOCK_PROFILE_GOT(val)         lock_profile_got(profile, val)
 
 #else
 
@@ -444,7 +485,7 @@ static void always_inline spin_barrier_common(spinlock_tickets_t *t,
                                               struct lock_profile *profile)
 {
     spinlock_tickets_t sample;
-    LOCK_PROFILE_VAR(block, NOW());
+    LOCK_PROFILE_VAR(block, lock_profile_block_start(profile));
 
     check_barrier(debug);
     smp_mb();
@@ -633,30 +674,52 @@ static void spinlock_profile_iterate(lock_profile_subfunc *sub, void *par)
 static void cf_check spinlock_profile_print_elem(struct lock_profile *data,
     int32_t type, int32_t idx, void *par)
 {
-    unsigned int cpu;
+    unsigned int cpu = SPINLOCK_NO_CPU;
     unsigned int lockval;
+    bool locked;
 
-    if ( data->is_rlock )
+    switch ( data->type )
     {
+    case LOCK_PROFILE_RSPIN:
+#ifdef CONFIG_DEBUG_LOCKS
         cpu = data->ptr.rlock->debug.cpu;
+#endif
         lockval = data->ptr.rlock->tickets.head_tail;
-    }
-    else
+        locked = spin_is_locked_common(&data->ptr.rlock->tickets);
+        break;
+
+    case LOCK_PROFILE_RW:
     {
+        const rwlock_t *rwlock = data->ptr.rwlock;
+
+        lockval = atomic_read(&rwlock->cnts);
+        locked = lockval;
+        if ( (lockval & _QW_WMASK) == _QW_LOCKED )
+            cpu = lockval & _QW_CPUMASK;
+        break;
+    }
+
+    default:
+#ifdef CONFIG_DEBUG_LOCKS
         cpu = data->ptr.lock->debug.cpu;
+#endif
         lockval = data->ptr.lock->tickets.head_tail;
+        locked = spin_is_locked_common(&data->ptr.lock->tickets);
+        break;
     }
 
     printk("%s ", lock_profile_ancs[type].name);
     if ( type != LOCKPROF_TYPE_GLOBAL )
         printk("%d ", idx);
     printk("%s: addr=%p, lockval=%08x, ", data->name, data->ptr.lock, lockval);
-    if ( cpu == SPINLOCK_NO_CPU )
+    if ( !locked )
         printk("not locked\n");
+    else if ( cpu == SPINLOCK_NO_CPU )
+        printk("locked\n");
     else
         printk("cpu=%u\n", cpu);
     printk("  lock:%" PRIu64 "(%" PRI_stime "), block:%" PRIu64 "(%" PRI_stime ")\n",
-           data->lock_cnt, data->time_hold, (uint64_t)data->block_cnt,
+           data->lock_cnt, data->time_hold, data->block_cnt,
            data->time_block);
 }
 
@@ -667,7 +730,8 @@ void cf_check spinlock_profile_printall(unsigned char key)
 
     diff = now - lock_profile_start;
     printk("Xen lock profile info SHOW  (now = %"PRI_stime" total = "
-           "%"PRI_stime")\n", now, diff);
+           "%"PRI_stime")%s\n", now, diff,
+           lock_profile_active ? "" : ", profiling inactive");
     spinlock_profile_iterate(spinlock_profile_print_elem, NULL);
 }
 
@@ -678,6 +742,8 @@ static void cf_check spinlock_profile_reset_elem(struct lock_profile *data,
     data->block_cnt = 0;
     data->time_hold = 0;
     data->time_block = 0;
+    memset(data->hold_hist, 0, sizeof(data->hold_hist));
+    memset(data->block_hist, 0, sizeof(data->block_hist));
 }
 
 void cf_check spinlock_profile_reset(unsigned char key)
@@ -714,6 +780,8 @@ static void cf_check spinlock_profile_ucopy_elem(struct lock_profile *data,
         elem.block_cnt = data->block_cnt;
         elem.lock_time = data->time_hold;
         elem.block_time = data->time_block;
+        memcpy(elem.hold_hist, data->hold_hist, sizeof(elem.hold_hist));
+        memcpy(elem.block_hist, data->block_hist, sizeof(elem.block_hist));
         if ( copy_to_guest_offset(p->pc->data, p->pc->nr_elem, &elem, 1) )
             p->rc = -EFAULT;
     }
@@ -743,11 +811,25 @@ int spinlock_profile_control(struct xen_sysctl_lockprof_op *pc)
         rc = par.rc;
         break;
 
+    case XEN_SYSCTL_LOCKPROF_enable:
+        if ( !lock_profile_active )
+        {
+            spinlock_profile_reset('\0');
+            lock_profile_active = true;
+        }
+        break;
+
+    case XEN_SYSCTL_LOCKPROF_disable:
+        lock_profile_active = false;
+        break;
+
     default:
         rc = -EINVAL;
         break;
     }
 
+    pc->active = lock_profile_active;
+
     return rc;
 }
 #endif /* CONFIG_SYSCTL */
@@ -766,6 +848,7 @@ void _lock_profile_deregister_struct(
     int32_t type, struct lock_profile_qhead *qhead)
 {
     struct lock_profile_qhead **q;
+    struct lock_profile *elem;
 
     spin_lock(&lock_profile_lock);
     for ( q = &lock_profile_ancs[type].head_q; *q; q = &(*q)->head_q )
@@ -777,6 +860,59 @@ void _lock_profile_deregister_struct(
         }
     }
     spin_unlock(&lock_profile_lock);
+
+    /* The elements of a registered structure are all dynamically allocated. */
+    while ( (elem = qhead->elem_q) != NULL )
+    {
+        qhead->elem_q = elem->next;
+        xfree(elem);
+    }
+}
+
+void _rwlock_profile_add(struct lock_profile_qhead *qhead, rwlock_t *lock,
+                         const char *name)
+{
+    struct lock_profile *prof = xzalloc(struct lock_profile);
+
+    if ( !prof )
+    {
+        printk(XENLOG_WARNING "lock profiling unavailable for %d's %s\n",
+               qhead->idx, name);
+        return;
+    }
+
+    prof->name = name;
+    prof->ptr.rwlock = lock;
+    prof->type = LOCK_PROFILE_RW;
+
+    spin_lock(&lock_profile_lock);
+    prof->next = qhead->elem_q;
+    qhead->elem_q = prof;
+    spin_unlock(&lock_profile_lock);
+
+    lock->profile = prof;
+}
+
+void _rwlock_profile_remove(struct lock_profile_qhead *qhead, rwlock_t *lock)
+{
+    struct lock_profile **q, *prof = lock->profile;
+
+    if ( !prof )
+        return;
+
+    spin_lock(&lock_profile_lock);
+    for ( q = &qhead->elem_q; *q; q = &(*q)->next )
+    {
+        if ( *q == prof )
+        {
+            *q = prof->next;
+            break;
+        }
+    }
+    spin_unlock(&lock_profile_lock);
+
+    lock->profile = NULL;
+    xfree(prof);
 }
 
 extern struct lock_profile *__lock_profile_start[];
@@ -793,10 +929,18 @@ static int __init cf_check lock_prof_init(void)
         (*q)->next = lock_profile_glb_q.elem_q;
         lock_profile_glb_q.elem_q = *q;
 
-        if ( (*q)->is_rlock )
+        switch ( (*q)->type )
+        {
+        case LOCK_PROFILE_RSPIN:
             (*q)->ptr.rlock->profile = *q;
-        else
+            break;
+        case LOCK_PROFILE_RW:
+            ((rwlock_t *)(*q)->ptr.rwlock)->profile = *q;
+            break;
+        default:
             (*q)->ptr.lock->profile = *q;
+            break;
+        }
     }
 
     _lock_profile_register_struct(LOCKPROF_TYPE_GLOBAL,
@@ -39,6 +39,14 @@ extern const uint16_t symbols_token_index[];
 
 extern const unsigned int symbols_markers[];
 
+#ifdef CONFIG_FAST_SYMBOL_NAMES
+extern const unsigned int symbols_plain_offsets[];
+extern const char symbols_plain_names[];
+
+/* "<type><name>" of the symbol at address index @idx, "" for END symbols. */
+#define symbol_plain_name(idx) (&symbols_plain_names[symbols_plain_offsets[idx]])
+#endif
+
 /* expand a compressed symbol data into the resulting uncompressed string,
    given the offset to where the symbol is in the compressed stream */
 static unsigned int symbols_expand_symbol(unsigned int off, char *result)
@@ -99,6 +107,24 @@ static unsigned int get_symbol_offset(unsigned long pos)
     return name - symbols_names;
 }
 
+static bool symbol_is_end(unsigned int idx)
+{
+#ifdef CONFIG_FAST_SYMBOL_NAMES
+    return !*symbol_plain_name(idx);
+#else
+    return !symbols_names[get_symbol_offset(idx)];
+#endif
+}
+
+static void symbol_get_name(unsigned int idx, char *namebuf)
+{
+#ifdef CONFIG_FAST_SYMBOL_NAMES
+    strlcpy(namebuf, symbol_plain_name(idx) + 1, KSYM_NAME_LEN + 1);
+#else
+    symbols_expand_symbol(get_symbol_offset(idx), namebuf);
+#endif
+}
+
 bool is_active_kernel_text(unsigned long addr)
 {
     return !!find_text_region(addr);
@@ -109,7 +135,7 @@ const char *symbols_lookup(unsigned long addr,
                            unsigned long *offset,
                            char *namebuf)
 {
-    unsigned int i, low, high, mid;
+    unsigned int low, high, mid;
     unsigned long symbol_end = 0;
     const struct virtual_region *region;
 
@@ -134,7 +160,7 @@ const char *symbols_lookup(unsigned long addr,
     }
 
     /* If we hit an END symbol, move to the previous (real) one. */
-    if (!symbols_names[get_symbol_offset(low)]) {
+    if (symbol_is_end(low)) {
         ASSERT(low);
         symbol_end = symbols_address(low);
         --low;
@@ -146,17 +172,11 @@ const char *symbols_lookup(unsigned long addr,
         --low;
 
         /* Grab name */
-    symbols_expand_symbol(get_symbol_offset(low), namebuf);
-
-    if (!symbol_end) {
-        /* Search for next non-aliased symbol */
-        for (i = low + 1; i < symbols_num_addrs; i++) {
-            if (symbols_address(i) > symbols_address(low)) {
-                symbol_end = symbols_address(i);
-                break;
-            }
-        }
-    }
+    symbol_get_name(low, namebuf);
+
+    /* The binary search leaves high at the next non-aliased symbol. */
+    if (!symbol_end && high < symbols_num_addrs)
+        symbol_end = symbols_address(high);
 
     /* if we found no next symbol, we use the end of the section */
     if (!symbol_end)
@@ -247,7 +267,9 @@ int xensyms_read(uint32_t *symnum, char *type,
 
 unsigned long symbols_lookup_by_name(const char *symname)
 {
+#if !defined(CONFIG_FAST_SYMBOL_LOOKUP) || !defined(CONFIG_FAST_SYMBOL_NAMES)
     char name[KSYM_NAME_LEN + 1];
+#endif
 #ifdef CONFIG_FAST_SYMBOL_LOOKUP
     unsigned long low, high;
 #else
@@ -270,9 +292,13 @@ unsigned long symbols_lookup_by_name(const char *symname)
         int rc;
 
         s = &symbols_sorted_offsets[mid];
+#ifdef CONFIG_FAST_SYMBOL_NAMES
+        rc = strcmp(symname, symbol_plain_name(s->addr) + 1);
+#else
         (void)symbols_expand_symbol(s->stream, name);
         /* Format is: [filename]#<symbol>. symbols_expand_symbol eats type.*/
         rc = strcmp(symname, name);
+#endif
         if ( rc < 0 )
             high = mid;
         else if ( rc > 0 )
@@ -28,6 +28,7 @@
 #include <xen/pmstat.h>
 #include <xen/livepatch.h>
 #include <xen/coverage.h>
+#include <xen/microbench.h>
 
 long do_sysctl(XEN_GUEST_HANDLE_PARAM(xen_sysctl_t) u_sysctl)
 {
@@ -124,6 +125,13 @@ long do_sysctl(XEN_GUEST_HANDLE_PARAM(xen_sysctl_t) u_sysctl)
         ret = spinlock_profile_control(&op->u.lockprof_op);
         break;
 #endif
+
+#ifdef CONFIG_MICROBENCH
+    case XEN_SYSCTL_microbench_op:
+        ret = microbench_control(&op->u.microbench_op);
+        break;
+#endif
+
     case XEN_SYSCTL_debug_keys:
     {
         char c;
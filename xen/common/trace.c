@@ -30,7 +30,6 @@
 #include <xen/percpu.h>
 #include <xen/pfn.h>
 #include <xen/sections.h>
-#include <xen/cpu.h>
 #include <asm/atomic.h>
 #include <public/sysctl.h>
 
@@ -54,9 +53,18 @@ static struct t_info *t_info;
 static unsigned int t_info_pages;
 
 static DEFINE_PER_CPU_READ_MOSTLY(struct t_buf *, t_bufs);
-static DEFINE_PER_CPU_READ_MOSTLY(spinlock_t, t_lock);
 static u32 data_size __read_mostly;
 
+/*
+ * Each CPU's buffer is only written by that CPU.  Space is reserved by
+ * advancing t_reserve with interrupts disabled, and the record is then
+ * written with interrupts enabled.  As an interrupt may trace while a record
+ * is being written, t_nesting counts writers in progress, and the last one to
+ * finish publishes everything reserved so far to the consumer via buf->prod.
+ */
+static DEFINE_PER_CPU(uint32_t, t_reserve);
+static DEFINE_PER_CPU(unsigned int, t_nesting);
+
 /* High water mark for trace buffers; */
 /* Send virtual interrupt when buffer level reaches this point */
 static u32 t_buf_highwater;
@@ -75,20 +83,47 @@ static cpumask_t tb_cpu_mask;
 /* which tracing events are enabled */
 static u32 tb_event_mask = TRC_ALL;
 
-static int cf_check cpu_callback(
-    struct notifier_block *nfb, unsigned long action, void *hcpu)
+/*
+ * tb_event_mask expanded into a bitmap indexed by the class and subclass bits
+ * of an event, so filtering an event is a single bit test.
+ */
+#define TRC_FILTER_SHIFT TRC_SUBCLS_SHIFT
+#define TRC_FILTER_BITS  16
+static DECLARE_BITMAP(tb_event_filter, 1U << TRC_FILTER_BITS) __read_mostly;
+
+static inline bool event_filtered(uint32_t event)
+{
+    return test_bit((event >> TRC_FILTER_SHIFT) &
+                    ((1U << TRC_FILTER_BITS) - 1), tb_event_filter);
+}
+
+/*
+ * An event matches the mask if it shares at least one class bit and one
+ * subclass bit with it.
+ */
+static void set_event_mask(uint32_t mask)
 {
-    unsigned int cpu = (unsigned long)hcpu;
+    unsigned int cls_mask = (mask >> TRC_CLS_SHIFT) & 0xfff;
+    unsigned int sub_mask = (mask >> TRC_SUBCLS_SHIFT) & 0xf;
+    unsigned int i, j;
 
-    if ( action == CPU_UP_PREPARE )
-        spin_lock_init(&per_cpu(t_lock, cpu));
+    tb_event_mask = mask;
 
-    return NOTIFY_DONE;
-}
+    for ( i = 0; i < ARRAY_SIZE(tb_event_filter); i++ )
+    {
+        unsigned long word = 0;
 
-static struct notifier_block cpu_nfb = {
-    .notifier_call = cpu_callback
-};
+        for ( j = 0; j < BITS_PER_LONG; j++ )
+        {
+            unsigned int idx = i * BITS_PER_LONG + j;
+
+            if ( ((idx >> 4) & cls_mask) && (idx & sub_mask) )
+                word |= 1UL << j;
+        }
+
+        write_atomic(&tb_event_filter[i], word);
+    }
+}
 
 static uint32_t calc_tinfo_first_offset(void)
 {
@@ -225,13 +260,12 @@ static int alloc_trace_bufs(unsigned int pages)
     {
         struct t_buf *buf;
 
-        spin_lock_init(&per_cpu(t_lock, cpu));
-
         offset = t_info->mfn_offset[cpu];
 
         /* Initialize the buffer metadata */
         per_cpu(t_bufs, cpu) = buf = mfn_to_virt(t_info_mfn_list[offset]);
         buf->cons = buf->prod = 0;
+        per_cpu(t_reserve, cpu) = 0;
 
         printk(XENLOG_INFO "xentrace: p%d mfn %x offset %u\n",
                    cpu, t_info_mfn_list[offset], offset);
@@ -308,19 +342,7 @@ int trace_will_trace_event(u32 event)
     if ( !tb_init_done )
         return 0;
 
-    /*
-     * Copied from __trace_var()
-     */
-    if ( (tb_event_mask & event) == 0 )
-        return 0;
-
-    /* match class */
-    if ( ((tb_event_mask >> TRC_CLS_SHIFT) & (event >> TRC_CLS_SHIFT)) == 0 )
-        return 0;
-
-    /* then match subclass */
-    if ( (((tb_event_mask >> TRC_SUBCLS_SHIFT) & 0xf )
-                & ((event >> TRC_SUBCLS_SHIFT) & 0xf )) == 0 )
+    if ( !event_filtered(event) )
         return 0;
 
     if ( !cpumask_test_cpu(smp_processor_id(), &tb_cpu_mask) )
@@ -341,7 +363,7 @@ int trace_will_trace_event(u32 event)
 static void __init __constructor init_trace_bufs(void)
 {
     cpumask_setall(&tb_cpu_mask);
-    register_cpu_notifier(&cpu_nfb);
+    set_event_mask(tb_event_mask);
 
     if ( opt_tbuf_size )
     {
@@ -355,12 +377,17 @@ static void __init __constructor init_trace_bufs(void)
         {
             printk("xentrace: Starting tracing, enabling mask %x\n",
                    opt_tevt_mask);
-            tb_event_mask = opt_tevt_mask;
+            set_event_mask(opt_tevt_mask);
             tb_init_done=1;
         }
     }
 }
 
+static void cf_check clear_lost_records(void *unused)
+{
+    this_cpu(lost_records) = 0;
+}
+
 /**
  * tb_control - sysctl operations on trace buffers.
  * @tbc: a pointer to a struct xen_sysctl_tbuf_op to be filled out
@@ -392,7 +419,7 @@ int tb_control(struct xen_sysctl_tbuf_op *tbc)
     }
         break;
     case XEN_SYSCTL_TBUFOP_set_evt_mask:
-        tb_event_mask = tbc->evt_mask;
+        set_event_mask(tbc->evt_mask);
         break;
     case XEN_SYSCTL_TBUFOP_set_size:
         rc = tb_set_size(tbc->size);
@@ -410,20 +437,13 @@ int tb_control(struct xen_sysctl_tbuf_op *tbc)
          * Disable trace buffers. Just stops new records from being written,
          * does not deallocate any memory.
          */
-        int i;
-
         tb_init_done = 0;
         smp_wmb();
         /* Clear any lost-record info so we don't get phantom lost records next time we
-         * start tracing.  Grab the lock to make sure we're not racing anyone.  After this
-         * hypercall returns, no more records should be placed into the buffers. */
-        for_each_online_cpu(i)
-        {
-            unsigned long flags;
-            spin_lock_irqsave(&per_cpu(t_lock, i), flags);
-            per_cpu(lost_records, i)=0;
-            spin_unlock_irqrestore(&per_cpu(t_lock, i), flags);
-        }
+         * start tracing.  Do it on each CPU, as lost_records is only updated
+         * with interrupts disabled there.  After this hypercall returns, no
+         * more records should be placed into the buffers. */
+        on_each_cpu(clear_lost_records, NULL, 1);
     }
         break;
     default:
@@ -459,12 +479,10 @@ static inline bool bogus(u32 prod, u32 cons)
     return 0;
 }
 
-static inline u32 calc_unconsumed_bytes(const struct t_buf *buf)
+static inline u32 calc_unconsumed_bytes(uint32_t prod, uint32_t cons)
 {
-    uint32_t prod = buf->prod, cons = buf->cons;
     int32_t x;
 
-    barrier(); /* must read buf->prod and buf->cons only once */
     if ( bogus(prod, cons) )
         return data_size;
 
@@ -478,15 +496,10 @@ static inline u32 calc_unconsumed_bytes(const struct t_buf *buf)
     return x;
 }
 
-static inline u32 calc_bytes_to_wrap(const struct t_buf *buf)
+static inline u32 calc_bytes_to_wrap(uint32_t prod)
 {
-    uint32_t prod = buf->prod, cons = buf->cons;
     int32_t x;
 
-    barrier(); /* must read buf->prod and buf->cons only once */
-    if ( bogus(prod, cons) )
-        return 0;
-
     x = data_size - prod;
     if ( x <= 0 )
         x += data_size;
@@ -497,27 +510,25 @@ static inline u32 calc_bytes_to_wrap(const struct t_buf *buf)
     return x;
 }
 
-static inline u32 calc_bytes_avail(const struct t_buf *buf)
+static inline uint32_t advance_prod(uint32_t prod, unsigned int bytes)
 {
-    return data_size - calc_unconsumed_bytes(buf);
+    prod += bytes;
+    if ( prod >= 2*data_size )
+        prod -= 2*data_size;
+    ASSERT(prod < 2*data_size);
+
+    return prod;
 }
 
-static unsigned char *next_record(const struct t_buf *buf, uint32_t *next,
-                                 unsigned char **next_page,
-                                 uint32_t *offset_in_page)
+static unsigned char *next_record(uint32_t x, unsigned char **next_page,
+                                  uint32_t *offset_in_page)
 {
-    u32 x = buf->prod, cons = buf->cons;
     uint16_t per_cpu_mfn_offset;
     uint32_t per_cpu_mfn_nr;
     uint32_t *mfn_list;
     uint32_t mfn;
     unsigned char *this_page;
 
-    barrier(); /* must read buf->prod and buf->cons only once */
-    *next = x;
-    if ( !tb_init_done || bogus(x, cons) )
-        return NULL;
-
     if ( x >= data_size )
         x -= data_size;
 
@@ -546,28 +557,26 @@ static unsigned char *next_record(const struct t_buf *buf, uint32_t *next,
     return this_page;
 }
 
-static inline void __insert_record(struct t_buf *buf,
-                                   unsigned long event,
-                                   unsigned int extra,
-                                   bool cycles,
-                                   unsigned int rec_size,
-                                   const void *extra_data)
+/* Write a record at @prod, in reserved space.  Returns the new position. */
+static inline uint32_t __insert_record(uint32_t prod,
+                                       unsigned long event,
+                                       unsigned int extra,
+                                       bool cycles,
+                                       unsigned int rec_size,
+                                       const void *extra_data)
 {
     struct t_rec split_rec, *rec;
     uint32_t *dst;
     unsigned char *this_page, *next_page;
     unsigned int extra_word = extra / sizeof(u32);
     unsigned int local_rec_size = calc_rec_size(cycles, extra);
-    uint32_t next;
     uint32_t offset;
     uint32_t remaining;
 
     BUG_ON(local_rec_size != rec_size);
     BUG_ON(extra & 3);
 
-    this_page = next_record(buf, &next, &next_page, &offset);
-    if ( !this_page )
-        return;
+    this_page = next_record(prod, &next_page, &offset);
 
     remaining = PAGE_SIZE - offset;
 
@@ -577,9 +586,9 @@ static inline void __insert_record(struct t_buf *buf,
         {
             /* access beyond end of buffer */
             printk(XENLOG_WARNING
-                   "%s: size=%08x prod=%08x cons=%08x rec=%u remaining=%u\n",
-                   __func__, data_size, next, buf->cons, rec_size, remaining);
-            return;
+                   "%s: size=%08x prod=%08x rec=%u remaining=%u\n",
+                   __func__, data_size, prod, rec_size, remaining);
+            return advance_prod(prod, rec_size);
         }
         rec = &split_rec;
     } else {
@@ -606,19 +615,12 @@ static inline void __insert_record(struct t_buf *buf,
         memcpy(next_page, (char *)rec + remaining, rec_size - remaining);
     }
 
-    smp_wmb();
-
-    next += rec_size;
-    if ( next >= 2*data_size )
-        next -= 2*data_size;
-    ASSERT(next < 2*data_size);
-    buf->prod = next;
+    return advance_prod(prod, rec_size);
 }
 
-static inline void insert_wrap_record(struct t_buf *buf,
-                                      unsigned int size)
+static inline uint32_t insert_wrap_record(uint32_t prod, unsigned int size)
 {
-    u32 space_left = calc_bytes_to_wrap(buf);
+    u32 space_left = calc_bytes_to_wrap(prod);
     unsigned int extra_space = space_left - sizeof(u32);
     bool cycles = false;
 
@@ -632,13 +634,15 @@ static inline void insert_wrap_record(struct t_buf *buf,
         ASSERT((extra_space/sizeof(u32)) <= TRACE_EXTRA_MAX);
     }
 
-    __insert_record(buf, TRC_TRACE_WRAP_BUFFER, extra_space, cycles,
-                    space_left, NULL);
+    return __insert_record(prod, TRC_TRACE_WRAP_BUFFER, extra_space, cycles,
+                           space_left, NULL);
 }
 
 #define LOST_REC_SIZE (4 + 8 + 16) /* header + tsc + sizeof(struct ed) */
 
-static inline void insert_lost_records(struct t_buf *buf)
+static inline uint32_t insert_lost_records(uint32_t prod,
+                                           unsigned long lost_records,
+                                           uint64_t first_tsc)
 {
     struct __packed {
         u32 lost_records;
@@ -648,13 +652,11 @@ static inline void insert_lost_records(struct t_buf *buf)
 
     ed.vid = current->vcpu_id;
     ed.did = current->domain->domain_id;
-    ed.lost_records = this_cpu(lost_records);
-    ed.first_tsc = this_cpu(lost_records_first_tsc);
+    ed.lost_records = lost_records;
+    ed.first_tsc = first_tsc;
 
-    this_cpu(lost_records) = 0;
-
-    __insert_record(buf, TRC_LOST_RECORDS, sizeof(ed), 1 /* cycles */,
-                    LOST_REC_SIZE, &ed);
+    return __insert_record(prod, TRC_LOST_RECORDS, sizeof(ed), 1 /* cycles */,
+                           LOST_REC_SIZE, &ed);
 }
 
 /*
@@ -679,10 +681,11 @@ static DECLARE_SOFTIRQ_TASKLET(trace_notify_dom0_tasklet,
 void trace(uint32_t event, unsigned int extra, const void *extra_data)
 {
     struct t_buf *buf;
-    unsigned long flags;
-    u32 bytes_to_tail, bytes_to_wrap;
+    unsigned long flags, lost;
+    uint64_t lost_first_tsc = 0;
+    u32 prod, cons, bytes_to_tail, bytes_to_wrap;
     unsigned int rec_size, total_size;
-    bool started_below_highwater;
+    bool started_below_highwater, published = false;
     bool cycles = event & TRC_HD_CYCLE_FLAG;
 
     if( !tb_init_done )
@@ -699,52 +702,53 @@ void trace(uint32_t event, unsigned int extra, const void *extra_data)
                            "Trace event %#x bad size %u, discarding\n",
                            event, extra);
 
-    if ( (tb_event_mask & event) == 0 )
-        return;
-
-    /* match class */
-    if ( ((tb_event_mask >> TRC_CLS_SHIFT) & (event >> TRC_CLS_SHIFT)) == 0 )
+    if ( !event_filtered(event) )
         return;
 
-    /* then match subclass */
-    if ( (((tb_event_mask >> TRC_SUBCLS_SHIFT) & 0xf )
-                & ((event >> TRC_SUBCLS_SHIFT) & 0xf )) == 0 )
+    if ( !cpumask_test_cpu(smp_processor_id(), &tb_cpu_mask) )
         return;
 
-    if ( !cpumask_test_cpu(smp_processor_id(), &tb_cpu_mask) )
+    buf = this_cpu(t_bufs);
+    if ( unlikely(!buf) )
         return;
 
-    spin_lock_irqsave(&this_cpu(t_lock), flags);
+    /* Calculate the record size */
+    rec_size = calc_rec_size(cycles, extra);
 
-    buf = this_cpu(t_bufs);
+    /*
+     * Reserve space for the record, and any wrap and lost records needed
+     * ahead of it.  This is the only part which needs to be atomic with
+     * respect to interrupts tracing on this CPU.
+     */
+    local_irq_save(flags);
 
-    if ( unlikely(!buf) )
+    prod = this_cpu(t_reserve);
+    cons = ACCESS_ONCE(buf->cons);
+    if ( bogus(prod, cons) )
     {
-        /* Make gcc happy */
-        started_below_highwater = 0;
-        goto unlock;
+        local_irq_restore(flags);
+        return;
     }
 
-    started_below_highwater = (calc_unconsumed_bytes(buf) < t_buf_highwater);
-
-    /* Calculate the record size */
-    rec_size = calc_rec_size(cycles, extra);
+    started_below_highwater =
+        (calc_unconsumed_bytes(prod, cons) < t_buf_highwater);
 
     /* How many bytes are available in the buffer? */
-    bytes_to_tail = calc_bytes_avail(buf);
+    bytes_to_tail = data_size - calc_unconsumed_bytes(prod, cons);
 
     /* How many bytes until the next wrap-around? */
-    bytes_to_wrap = calc_bytes_to_wrap(buf);
+    bytes_to_wrap = calc_bytes_to_wrap(prod);
 
     /*
      * Calculate expected total size to commit this record by
      * doing a dry-run.
      */
     total_size = 0;
+    lost = this_cpu(lost_records);
 
     /* First, check to see if we need to include a lost_record.
      */
-    if ( this_cpu(lost_records) )
+    if ( lost )
     {
         if ( LOST_REC_SIZE > bytes_to_wrap )
         {
@@ -770,23 +774,34 @@ void trace(uint32_t event, unsigned int extra, const void *extra_data)
     {
         if ( ++this_cpu(lost_records) == 1 )
             this_cpu(lost_records_first_tsc)=(u64)get_cycles();
-        started_below_highwater = 0;
-        goto unlock;
+        local_irq_restore(flags);
+        return;
     }
 
+    if ( lost )
+    {
+        lost_first_tsc = this_cpu(lost_records_first_tsc);
+        this_cpu(lost_records) = 0;
+    }
+
+    this_cpu(t_reserve) = advance_prod(prod, total_size);
+    this_cpu(t_nesting)++;
+
+    local_irq_restore(flags);
+
     /*
      * Now, actually write information
      */
-    bytes_to_wrap = calc_bytes_to_wrap(buf);
+    bytes_to_wrap = calc_bytes_to_wrap(prod);
 
-    if ( this_cpu(lost_records) )
+    if ( lost )
     {
         if ( LOST_REC_SIZE > bytes_to_wrap )
         {
-            insert_wrap_record(buf, LOST_REC_SIZE);
+            prod = insert_wrap_record(prod, LOST_REC_SIZE);
             bytes_to_wrap = data_size;
         }
-        insert_lost_records(buf);
+        prod = insert_lost_records(prod, lost, lost_first_tsc);
         bytes_to_wrap -= LOST_REC_SIZE;
 
         /* LOST_REC might line up perfectly with the buffer wrap */
@@ -795,18 +810,28 @@ void trace(uint32_t event, unsigned int extra, const void *extra_data)
     }
 
     if ( rec_size > bytes_to_wrap )
-        insert_wrap_record(buf, rec_size);
+        prod = insert_wrap_record(prod, rec_size);
 
     /* Write the original record */
-    __insert_record(buf, event, extra, cycles, rec_size, extra_data);
+    __insert_record(prod, event, extra, cycles, rec_size, extra_data);
 
-unlock:
-    spin_unlock_irqrestore(&this_cpu(t_lock), flags);
+    /*
+     * Publish the records, unless we interrupted another writer on this CPU,
+     * in which case it will publish ours along with its own.
+     */
+    local_irq_save(flags);
+    if ( !--this_cpu(t_nesting) )
+    {
+        smp_wmb();
+        buf->prod = this_cpu(t_reserve);
+        published = true;
+    }
+    local_irq_restore(flags);
 
     /* Notify trace buffer consumer that we've crossed the high water mark. */
-    if ( likely(buf!=NULL)
-         && started_below_highwater
-         && (calc_unconsumed_bytes(buf) >= t_buf_highwater) )
+    if ( published && started_below_highwater &&
+         (calc_unconsumed_bytes(buf->prod, ACCESS_ONCE(buf->cons)) >=
+          t_buf_highwater) )
         tasklet_schedule(&trace_notify_dom0_tasklet);
 }
 
@@ -0,0 +1 @@
+cmd_drivers/built_in.o := ld    -melf_x86_64 --no-warn-rwx-segments -r -o drivers/built_in.o drivers/char/built_in.o drivers/cpufreq/built_in.o drivers/pci/built_in.o drivers/vpci/built_in.o drivers/passthrough/built_in.o drivers/acpi/built_in.o drivers/video/built_in.o
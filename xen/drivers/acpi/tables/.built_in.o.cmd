@@ -0,0 +1 @@
+cmd_drivers/acpi/tables/built_in.o := ld    -melf_x86_64 --no-warn-rwx-segments -r -o drivers/acpi/tables/built_in.o drivers/acpi/tables/tbutils.o drivers/acpi/tables/tbfadt.init.o drivers/acpi/tables/tbinstal.init.o drivers/acpi/tables/tbxface.init.o drivers/acpi/tables/tbxfroot.init.o
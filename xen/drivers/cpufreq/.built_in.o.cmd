@@ -0,0 +1 @@
+cmd_drivers/cpufreq/built_in.o := ld    -melf_x86_64 --no-warn-rwx-segments -r -o drivers/cpufreq/built_in.o drivers/cpufreq/cpufreq.o drivers/cpufreq/cpufreq_ondemand.o drivers/cpufreq/cpufreq_misc_governors.o drivers/cpufreq/utility.o
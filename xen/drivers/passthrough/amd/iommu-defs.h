@@ -154,6 +154,12 @@ struct amd_iommu_dte {
     unsigned int snoop_attr:8;
 };
 
+/*
+ * Guest CR3 table entry: the (v2, x86-64 format) page table used for the
+ * requests of one PASID, or for untagged ones when DTE.GIoV is set.
+ */
+#define IOMMU_GCR3_VALID	0x1ULL
+
 /* Command Buffer */
 #define IOMMU_CMD_BUFFER_BASE_LOW_OFFSET	0x08
 #define IOMMU_CMD_BUFFER_BASE_HIGH_OFFSET	0x0C
@@ -193,6 +199,8 @@ struct amd_iommu_dte {
 #define IOMMU_INV_IOMMU_PAGES_S_FLAG_SHIFT	0
 #define IOMMU_INV_IOMMU_PAGES_PDE_FLAG_MASK	0x00000002U
 #define IOMMU_INV_IOMMU_PAGES_PDE_FLAG_SHIFT	1
+#define IOMMU_INV_IOMMU_PAGES_GN_FLAG_MASK	0x00000004U
+#define IOMMU_INV_IOMMU_PAGES_GN_FLAG_SHIFT	2
 #define IOMMU_INV_IOMMU_PAGES_ADDR_LOW_MASK	0xFFFFF000U
 #define IOMMU_INV_IOMMU_PAGES_ADDR_LOW_SHIFT	12
 #define IOMMU_INV_IOMMU_PAGES_ADDR_HIGH_MASK	0xFFFFFFFFU
@@ -223,6 +231,8 @@ struct amd_iommu_dte {
 #define IOMMU_INV_IOTLB_PAGES_ADDR_HIGH_SHIFT       0
 #define IOMMU_INV_IOTLB_PAGES_S_FLAG_MASK           0x00000001U
 #define IOMMU_INV_IOTLB_PAGES_S_FLAG_SHIFT          0
+#define IOMMU_INV_IOTLB_PAGES_GN_FLAG_MASK          0x00000004U
+#define IOMMU_INV_IOTLB_PAGES_GN_FLAG_SHIFT         2
 
 /* Event Log */
 #define IOMMU_EVENT_LOG_BASE_LOW_OFFSET		0x10
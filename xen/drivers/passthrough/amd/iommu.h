@@ -220,11 +220,19 @@ void amd_iommu_set_intremap_table(struct amd_iommu_dte *dte,
                                   bool valid);
 #define SET_ROOT_VALID          (1u << 0)
 #define SET_ROOT_WITH_UNITY_MAP (1u << 1)
+#define SET_ROOT_GCR3           (1u << 2) /* root_ptr is a GCR3 table */
 int __must_check amd_iommu_set_root_page_table(struct amd_iommu_dte *dte,
                                                uint64_t root_ptr,
                                                uint16_t domain_id,
                                                uint8_t paging_mode,
                                                unsigned int flags);
+
+static inline paddr_t dte_gcr3_table(const struct amd_iommu_dte *dte)
+{
+    return ((paddr_t)dte->gcr3_trp_14_12 << 12) |
+           ((paddr_t)dte->gcr3_trp_30_15 << 15) |
+           ((paddr_t)dte->gcr3_trp_51_31 << 31);
+}
 void iommu_dte_add_device_entry(struct amd_iommu_dte *dte,
                                 const struct ivrs_mappings *ivrs_dev);
 
@@ -102,7 +102,8 @@ static void flush_command_buffer(struct amd_iommu *iommu,
 
 /* Build low level iommu command messages */
 static void invalidate_iommu_pages(struct amd_iommu *iommu,
-                                   u64 io_addr, u16 domain_id, u16 order)
+                                   u64 io_addr, u16 domain_id, u16 order,
+                                   bool gn)
 {
     u64 addr_lo, addr_hi;
     u32 cmd[4], entry;
@@ -143,6 +144,10 @@ static void invalidate_iommu_pages(struct amd_iommu *iommu,
     set_field_in_reg_u32(pde, entry,
                          IOMMU_INV_IOMMU_PAGES_PDE_FLAG_MASK,
                          IOMMU_INV_IOMMU_PAGES_PDE_FLAG_SHIFT, &entry);
+    /* Guest (v2) translations are tagged with PASID 0, left in cmd[0]. */
+    set_field_in_reg_u32(gn, entry,
+                         IOMMU_INV_IOMMU_PAGES_GN_FLAG_MASK,
+                         IOMMU_INV_IOMMU_PAGES_GN_FLAG_SHIFT, &entry);
     set_field_in_reg_u32((u32)addr_lo >> PAGE_SHIFT, entry,
                          IOMMU_INV_IOMMU_PAGES_ADDR_LOW_MASK,
                          IOMMU_INV_IOMMU_PAGES_ADDR_LOW_SHIFT, &entry);
@@ -159,7 +164,8 @@ static void invalidate_iommu_pages(struct amd_iommu *iommu,
 
 static void invalidate_iotlb_pages(struct amd_iommu *iommu,
                                    u16 maxpend, u32 pasid, u16 queueid,
-                                   u64 io_addr, u16 dev_id, u16 order)
+                                   u64 io_addr, u16 dev_id, u16 order,
+                                   bool gn)
 {
     u64 addr_lo, addr_hi;
     u32 cmd[4], entry;
@@ -214,6 +220,10 @@ static void invalidate_iotlb_pages(struct amd_iommu *iommu,
                          IOMMU_INV_IOTLB_PAGES_S_FLAG_MASK,
                          IOMMU_INV_IOTLB_PAGES_S_FLAG_MASK, &entry);
 
+    set_field_in_reg_u32(gn, entry,
+                         IOMMU_INV_IOTLB_PAGES_GN_FLAG_MASK,
+                         IOMMU_INV_IOTLB_PAGES_GN_FLAG_SHIFT, &entry);
+
     set_field_in_reg_u32((u32)addr_lo >> PAGE_SHIFT, entry,
                          IOMMU_INV_IOTLB_PAGES_ADDR_LOW_MASK,
                          IOMMU_INV_IOTLB_PAGES_ADDR_LOW_SHIFT, &entry);
@@ -280,6 +290,7 @@ void amd_iommu_flush_iotlb(u8 devfn, const struct pci_dev *pdev,
                            daddr_t daddr, unsigned int order)
 {
     struct amd_iommu *iommu;
+    const struct amd_iommu_dte *dte;
     unsigned int req_id, queueid, maxpend;
 
     if ( !ats_enabled )
@@ -303,9 +314,11 @@ void amd_iommu_flush_iotlb(u8 devfn, const struct pci_dev *pdev,
     req_id = get_dma_requestor_id(iommu->sbdf.seg, PCI_BDF(pdev->bus, devfn));
     queueid = req_id;
     maxpend = pdev->ats.queue_depth & 0xff;
+    dte = &((const struct amd_iommu_dte *)iommu->dev_table.buffer)[req_id];
 
     /* send INVALIDATE_IOTLB_PAGES command */
-    invalidate_iotlb_pages(iommu, maxpend, 0, queueid, daddr, req_id, order);
+    invalidate_iotlb_pages(iommu, maxpend, 0, queueid, daddr, req_id, order,
+                           dte->gv);
     flush_command_buffer(iommu, iommu_dev_iotlb_timeout);
 }
 
@@ -332,11 +345,12 @@ static void _amd_iommu_flush_pages(struct domain *d,
 {
     struct amd_iommu *iommu;
     unsigned int dom_id = d->domain_id;
+    bool gn = iommu_use_hap_pt(d);
 
     /* send INVALIDATE_IOMMU_PAGES command */
     for_each_amd_iommu ( iommu )
     {
-        invalidate_iommu_pages(iommu, daddr, dom_id, order);
+        invalidate_iommu_pages(iommu, daddr, dom_id, order, gn);
         flush_command_buffer(iommu, 0);
     }
 
@@ -373,7 +387,12 @@ void amd_iommu_flush_device(struct amd_iommu *iommu, uint16_t bdf,
     /* Also invalidate IOMMU TLB entries when flushing the DTE. */
     if ( domid != DOMID_INVALID )
     {
-        invalidate_iommu_pages(iommu, INV_IOMMU_ALL_PAGES_ADDRESS, domid, 0);
+        invalidate_iommu_pages(iommu, INV_IOMMU_ALL_PAGES_ADDRESS, domid, 0,
+                               false);
+        /* The DTE may have been switched to or from shared HAP tables. */
+        if ( iommu->features.flds.gt_sup )
+            invalidate_iommu_pages(iommu, INV_IOMMU_ALL_PAGES_ADDRESS, domid,
+                                   0, true);
         flush_command_buffer(iommu, 0);
     }
 }
@@ -1450,6 +1450,7 @@ int __init amd_iommu_prepare(bool xt)
 int __init amd_iommu_init(bool xt)
 {
     struct amd_iommu *iommu;
+    bool share_hap_pt = true;
     int rc = amd_iommu_prepare(xt);
 
     if ( rc )
@@ -1462,13 +1463,23 @@ int __init amd_iommu_init(bool xt)
         goto error_out;
 
     /*
-     * Disable sharing HAP page tables with AMD IOMMU,
-     * since it only supports p2m_ram_rw, and this would
-     * prevent doing IO to/from mapped grant frames.
+     * HAP page tables can only be shared when all IOMMUs can walk them as
+     * guest (v2) page tables for DMA without PASID, with host translation
+     * disabled in the DTE.  The host page table format has no room for the
+     * p2m type, which would prevent doing I/O to/from mapped grant frames.
      */
-    clear_iommu_hap_pt_share();
+    for_each_amd_iommu ( iommu )
+        if ( !iommu->features.flds.gt_sup || !iommu->features.flds.gio_sup )
+            share_hap_pt = false;
 
-    printk(XENLOG_DEBUG "AMD-Vi: Disabled HAP memory map sharing with IOMMU\n");
+    if ( !share_hap_pt )
+    {
+        clear_iommu_hap_pt_share();
+        printk(XENLOG_DEBUG
+               "AMD-Vi: Disabled HAP memory map sharing with IOMMU\n");
+    }
+    else if ( iommu_hap_pt_share )
+        printk(XENLOG_INFO "AMD-Vi: Sharing HAP page tables\n");
 
     /* per iommu initialization  */
     for_each_amd_iommu ( iommu )
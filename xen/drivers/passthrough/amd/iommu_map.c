@@ -161,6 +161,27 @@ static void set_iommu_ptes_present(unsigned long pt_mfn,
  * - 1 for a successful but non-atomic update, which may need to be warned
  *   about by the caller.
  */
+/*
+ * Point a DTE at host (v1) page tables, or with SET_ROOT_GCR3 at a GCR3 table
+ * whose entry 0 translates untagged requests, with host translation off.
+ */
+static void dte_set_root(struct amd_iommu_dte *dte, uint64_t root_ptr,
+                         uint8_t paging_mode, unsigned int flags)
+{
+    bool gcr3 = flags & SET_ROOT_GCR3;
+
+    dte->pt_root = gcr3 ? 0 : paddr_to_pfn(root_ptr);
+    dte->paging_mode = gcr3 ? 0 : paging_mode;
+    dte->gv = gcr3;
+    dte->giov = gcr3;
+    dte->glx = 0;
+    if ( !gcr3 )
+        root_ptr = 0;
+    dte->gcr3_trp_14_12 = root_ptr >> 12;
+    dte->gcr3_trp_30_15 = root_ptr >> 15;
+    dte->gcr3_trp_51_31 = root_ptr >> 31;
+}
+
 int amd_iommu_set_root_page_table(struct amd_iommu_dte *dte,
                                   uint64_t root_ptr, uint16_t domain_id,
                                   uint8_t paging_mode, unsigned int flags)
@@ -178,10 +199,9 @@ int amd_iommu_set_root_page_table(struct amd_iommu_dte *dte,
         int ret = 0;
 
         ldte.dte.domain_id = domain_id;
-        ldte.dte.pt_root = paddr_to_pfn(root_ptr);
+        dte_set_root(&ldte.dte, root_ptr, paging_mode, flags);
         ldte.dte.iw = true;
         ldte.dte.ir = true;
-        ldte.dte.paging_mode = paging_mode;
         ldte.dte.v = valid;
 
         res = cmpxchg16b(dte, &old, &ldte.raw128[0]);
@@ -210,10 +230,9 @@ int amd_iommu_set_root_page_table(struct amd_iommu_dte *dte,
         smp_wmb();
     }
     dte->domain_id = domain_id;
-    dte->pt_root = paddr_to_pfn(root_ptr);
+    dte_set_root(dte, root_ptr, paging_mode, flags);
     dte->iw = true;
     dte->ir = true;
-    dte->paging_mode = paging_mode;
     smp_wmb();
     dte->tv = true;
     dte->v = valid;
@@ -410,6 +429,10 @@ int cf_check amd_iommu_map_page(
     ASSERT((hd->platform_ops->page_sizes >> IOMMUF_order(flags)) &
            PAGE_SIZE_4K);
 
+    /* Do nothing if the IOMMU walks the HAP page tables. */
+    if ( iommu_use_hap_pt(d) )
+        return 0;
+
     spin_lock(&hd->arch.mapping_lock);
 
     /*
@@ -496,6 +519,10 @@ int cf_check amd_iommu_unmap_page(
      */
     ASSERT((hd->platform_ops->page_sizes >> order) & PAGE_SIZE_4K);
 
+    /* Do nothing if the IOMMU walks the HAP page tables. */
+    if ( iommu_use_hap_pt(d) )
+        return 0;
+
     spin_lock(&hd->arch.mapping_lock);
 
     if ( !hd->arch.amd.root_table )
@@ -562,6 +589,14 @@ void amd_iommu_print_entries(const struct amd_iommu *iommu, unsigned int dev_id,
         return;
     }
 
+    if ( dt[dev_id].gv )
+    {
+        printk("%pp GCR3 @ %"PRIpaddr" (HAP tables shared) dfn=%"PRI_dfn"\n",
+               &PCI_SBDF(iommu->sbdf.seg, dev_id),
+               dte_gcr3_table(&dt[dev_id]), dfn_x(dfn));
+        return;
+    }
+
     pt_mfn = _mfn(dt[dev_id].pt_root);
     level = dt[dev_id].paging_mode;
     printk("%pp root @ %"PRI_mfn" (%u levels) dfn=%"PRI_dfn"\n",
@@ -21,6 +21,7 @@
 #include <xen/softirq.h>
 
 #include <asm/acpi.h>
+#include <asm/p2m.h>
 
 #include "iommu.h"
 #include "../ats.h"
@@ -84,13 +85,38 @@ int get_dma_requestor_id(uint16_t seg, uint16_t bdf)
     return req_id;
 }
 
+/*
+ * A domain sharing its HAP page tables gets a single entry GCR3 table, whose
+ * entry 0 (used for DMA without PASID) points at the root of the host p2m.
+ */
+static int amd_iommu_alloc_gcr3_table(struct domain *d)
+{
+    struct domain_iommu *hd = dom_iommu(d);
+    uint64_t *gcr3;
+
+    if ( hd->arch.amd.gcr3_table )
+        return 0;
+
+    hd->arch.amd.gcr3_table = iommu_alloc_pgtable(hd, 0);
+    if ( !hd->arch.amd.gcr3_table )
+        return -ENOMEM;
+
+    gcr3 = __map_domain_page(hd->arch.amd.gcr3_table);
+    gcr3[0] = pagetable_get_paddr(p2m_get_pagetable(p2m_get_hostp2m(d))) |
+              IOMMU_GCR3_VALID;
+    unmap_domain_page(gcr3);
+
+    return 0;
+}
+
 static int __must_check allocate_domain_resources(struct domain *d)
 {
     struct domain_iommu *hd = dom_iommu(d);
     int rc;
 
     spin_lock(&hd->arch.mapping_lock);
-    rc = amd_iommu_alloc_root(d);
+    rc = iommu_use_hap_pt(d) ? amd_iommu_alloc_gcr3_table(d)
+                             : amd_iommu_alloc_root(d);
     spin_unlock(&hd->arch.mapping_lock);
 
     return rc;
@@ -114,6 +140,11 @@ static bool any_pdev_behind_iommu(const struct domain *d,
     return false;
 }
 
+static paddr_t dte_root(const struct amd_iommu_dte *dte)
+{
+    return dte->gv ? dte_gcr3_table(dte) : pfn_to_paddr(dte->pt_root);
+}
+
 static bool use_ats(
     const struct pci_dev *pdev,
     const struct amd_iommu *iommu,
@@ -135,7 +166,7 @@ static int __must_check amd_iommu_setup_domain_device(
     u8 bus = pdev->bus;
     struct domain_iommu *hd = dom_iommu(domain);
     const struct ivrs_mappings *ivrs_dev;
-    const struct page_info *root_pg;
+    paddr_t root;
     domid_t domid;
 
     if ( QUARANTINE_SKIP(domain, pdev) )
@@ -159,15 +190,21 @@ static int __must_check amd_iommu_setup_domain_device(
     dte = &table[req_id];
     ivrs_dev = &get_ivrs_mappings(iommu->sbdf.seg)[req_id];
 
-    if ( domain != dom_io )
+    if ( domain == dom_io )
+    {
+        root = page_to_maddr(pdev->arch.amd.root_table);
+        domid = pdev->arch.pseudo_domid;
+    }
+    else if ( iommu_use_hap_pt(domain) )
     {
-        root_pg = hd->arch.amd.root_table;
+        root = page_to_maddr(hd->arch.amd.gcr3_table);
         domid = domain->domain_id;
+        sr_flags |= SET_ROOT_GCR3;
     }
     else
     {
-        root_pg = pdev->arch.amd.root_table;
-        domid = pdev->arch.pseudo_domid;
+        root = page_to_maddr(hd->arch.amd.root_table);
+        domid = domain->domain_id;
     }
 
     spin_lock_irqsave(&iommu->lock, flags);
@@ -176,8 +213,7 @@ static int __must_check amd_iommu_setup_domain_device(
     {
         /* bind DTE to domain page-tables */
         rc = amd_iommu_set_root_page_table(
-                 dte, page_to_maddr(root_pg), domid,
-                 hd->arch.amd.paging_mode, sr_flags);
+                 dte, root, domid, hd->arch.amd.paging_mode, sr_flags);
         if ( rc )
         {
             ASSERT(rc < 0);
@@ -203,7 +239,7 @@ static int __must_check amd_iommu_setup_domain_device(
         /* DTE didn't have DMA translations enabled, do not flush the TLB. */
         amd_iommu_flush_device(iommu, req_id, DOMID_INVALID);
     }
-    else if ( dte->pt_root != mfn_x(page_to_mfn(root_pg)) )
+    else if ( dte_root(dte) != root )
     {
         domid_t prev_domid = dte->domain_id;
 
@@ -218,8 +254,7 @@ static int __must_check amd_iommu_setup_domain_device(
             rc = -EOPNOTSUPP;
         else
             rc = amd_iommu_set_root_page_table(
-                     dte, page_to_maddr(root_pg), domid,
-                     hd->arch.amd.paging_mode, sr_flags);
+                     dte, root, domid, hd->arch.amd.paging_mode, sr_flags);
         if ( rc < 0 )
         {
             spin_unlock_irqrestore(&iommu->lock, flags);
@@ -267,10 +302,11 @@ static int __must_check amd_iommu_setup_domain_device(
         spin_unlock_irqrestore(&iommu->lock, flags);
 
     AMD_IOMMU_DEBUG("Setup I/O page table: device id = %#x, type = %#x, "
-                    "root table = %#"PRIx64", "
+                    "%s = %#"PRIx64", "
                     "domain = %d, paging mode = %d\n",
-                    req_id, pdev->type, page_to_maddr(root_pg),
-                    domid, hd->arch.amd.paging_mode);
+                    req_id, pdev->type,
+                    sr_flags & SET_ROOT_GCR3 ? "GCR3 table" : "root table",
+                    root, domid, hd->arch.amd.paging_mode);
 
     ASSERT(pcidevs_locked());
 
@@ -555,6 +591,7 @@ static void cf_check amd_iommu_clear_root_pgtable(struct domain *d)
 
     spin_lock(&hd->arch.mapping_lock);
     hd->arch.amd.root_table = NULL;
+    hd->arch.amd.gcr3_table = NULL;
     spin_unlock(&hd->arch.mapping_lock);
 }
 
@@ -562,6 +599,7 @@ static void cf_check amd_iommu_domain_destroy(struct domain *d)
 {
     iommu_identity_map_teardown(d);
     ASSERT(!dom_iommu(d)->arch.amd.root_table);
+    ASSERT(!dom_iommu(d)->arch.amd.gcr3_table);
 }
 
 static int cf_check amd_iommu_add_device(u8 devfn, struct pci_dev *pdev)
@@ -755,6 +793,13 @@ static void cf_check amd_dump_page_tables(struct domain *d)
 {
     const struct domain_iommu *hd = dom_iommu(d);
 
+    if ( hd->arch.amd.gcr3_table )
+    {
+        printk("AMD IOMMU %pd shares HAP tables, GCR3 @ %"PRIpaddr"\n",
+               d, page_to_maddr(hd->arch.amd.gcr3_table));
+        return;
+    }
+
     if ( !hd->arch.amd.root_table )
         return;
 
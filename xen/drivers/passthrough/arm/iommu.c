@@ -153,6 +153,11 @@ bool arch_iommu_use_permitted(const struct domain *d)
     return true;
 }
 
+int arch_iommu_prepare_assign(struct domain *d)
+{
+    return 0;
+}
+
 int iommu_add_pci_sideband_ids(struct pci_dev *pdev)
 {
     int ret = -EOPNOTSUPP;
@@ -65,6 +65,8 @@ bool __read_mostly iommu_debug;
 
 DEFINE_PER_CPU(bool, iommu_dont_flush_iotlb);
 
+static DEFINE_PER_CPU(struct iommu_flush_batch *, iommu_flush_batch);
+
 static int __init cf_check parse_iommu_param(const char *s)
 {
     const char *ss;
@@ -475,10 +477,173 @@ int iommu_lookup_page(struct domain *d, dfn_t dfn, mfn_t *mfn,
     return iommu_call(hd->platform_ops, lookup_page, d, dfn, mfn, flags);
 }
 
+/*
+ * Flush the ranges accumulated in @batch, and release the pages which were
+ * waiting for it.  The batch is left inactive on this CPU: releasing pages
+ * may require further flushes, which must not be deferred.
+ */
+static int iommu_flush_batch_issue(struct iommu_flush_batch *batch)
+{
+    struct domain *d = batch->d;
+    struct domain_iommu *hd = dom_iommu(d);
+    unsigned int i;
+    int rc = 0;
+
+    if ( batch->nr_ranges )
+    {
+        hd->flush_stats.batches++;
+
+        if ( hd->platform_ops->iotlb_flush_batch )
+        {
+            hd->flush_stats.issued++;
+            rc = iommu_call(hd->platform_ops, iotlb_flush_batch, d, batch);
+        }
+        else
+        {
+            for ( i = 0; i < batch->nr_ranges; i++ )
+            {
+                int err = iommu_call(hd->platform_ops, iotlb_flush, d,
+                                     batch->ranges[i].dfn,
+                                     batch->ranges[i].count,
+                                     batch->flush_flags);
+
+                hd->flush_stats.issued++;
+                if ( !rc )
+                    rc = err;
+            }
+        }
+
+        for ( i = 0; i < batch->nr_ranges; i++ )
+            hd->flush_stats.pages += batch->ranges[i].count;
+
+        if ( unlikely(rc) )
+        {
+            if ( !d->is_shutting_down && printk_ratelimit() )
+                printk(XENLOG_ERR
+                       "d%d: IOMMU IOTLB batch flush failed: %d, %u ranges flags %x\n",
+                       d->domain_id, rc, batch->nr_ranges, batch->flush_flags);
+
+            if ( !is_hardware_domain(d) )
+                domain_crash(d);
+        }
+
+        batch->nr_ranges = 0;
+        batch->flush_flags = 0;
+    }
+
+    this_cpu(iommu_flush_batch) = NULL;
+
+    for ( i = 0; i < batch->nr_pages; i++ )
+        put_page(batch->pages[i]);
+    batch->nr_pages = 0;
+
+    return rc;
+}
+
+static int iommu_flush_batch_add(struct iommu_flush_batch *batch, dfn_t dfn,
+                                 unsigned long page_count,
+                                 unsigned int flush_flags)
+{
+    struct iommu_flush_range *r =
+        batch->nr_ranges ? &batch->ranges[batch->nr_ranges - 1] : NULL;
+    unsigned long start = dfn_x(dfn), end = start + page_count;
+    int rc = 0;
+
+    dom_iommu(batch->d)->flush_stats.deferred++;
+
+    /* Merge with the previous range if they overlap or are adjacent. */
+    if ( r && start <= dfn_x(r->dfn) + r->count && end >= dfn_x(r->dfn) )
+    {
+        end = max(end, dfn_x(r->dfn) + r->count);
+        start = min(start, dfn_x(r->dfn));
+        r->dfn = _dfn(start);
+        r->count = end - start;
+    }
+    else
+    {
+        if ( batch->nr_ranges == ARRAY_SIZE(batch->ranges) )
+        {
+            rc = iommu_flush_batch_issue(batch);
+            this_cpu(iommu_flush_batch) = batch;
+        }
+
+        r = &batch->ranges[batch->nr_ranges++];
+        r->dfn = dfn;
+        r->count = page_count;
+    }
+
+    batch->flush_flags |= flush_flags;
+
+    return rc;
+}
+
+void iommu_flush_batch_start(struct iommu_flush_batch *batch, struct domain *d)
+{
+    batch->d = d;
+    batch->flush_flags = 0;
+    batch->nr_ranges = 0;
+    batch->nr_pages = 0;
+
+    ASSERT(!this_cpu(iommu_flush_batch));
+    if ( is_iommu_enabled(d) && dom_iommu(d)->platform_ops->iotlb_flush )
+        this_cpu(iommu_flush_batch) = batch;
+}
+
+int iommu_flush_batch_finish(struct iommu_flush_batch *batch)
+{
+    if ( this_cpu(iommu_flush_batch) != batch )
+        return 0;
+
+    return iommu_flush_batch_issue(batch);
+}
+
+/*
+ * Take over the caller's last reference to @pg, which it just unmapped from
+ * @d, until the batch is flushed.  Returns false if the caller has to drop
+ * the reference itself, no batch being active for @d.
+ *
+ * The reference is taken even if no flush is pending yet: dropping it may
+ * unmap the page from the IOMMU (PV guests), and that flush would otherwise
+ * be deferred into the batch while the page got freed right away.
+ */
+bool iommu_flush_batch_put_page(struct domain *d, struct page_info *pg)
+{
+    struct iommu_flush_batch *batch = this_cpu(iommu_flush_batch);
+
+    if ( !batch || batch->d != d )
+        return false;
+
+    if ( batch->nr_pages == ARRAY_SIZE(batch->pages) )
+    {
+        /* Failures are dealt with by the flush itself, crashing @d. */
+        iommu_flush_batch_issue(batch);
+        this_cpu(iommu_flush_batch) = batch;
+    }
+
+    batch->pages[batch->nr_pages++] = pg;
+
+    return true;
+}
+
+void iommu_domain_printk(const struct domain *d)
+{
+    const struct domain_iommu *hd = dom_iommu(d);
+
+    if ( !is_iommu_enabled(d) )
+        return;
+
+    printk("    IOTLB flushes: %lu requested, %lu deferred into %lu batches, "
+           "%lu issued for %lu pages\n",
+           hd->flush_stats.requests, hd->flush_stats.deferred,
+           hd->flush_stats.batches, hd->flush_stats.issued,
+           hd->flush_stats.pages);
+}
+
 int iommu_iotlb_flush(struct domain *d, dfn_t dfn, unsigned long page_count,
                       unsigned int flush_flags)
 {
-    const struct domain_iommu *hd = dom_iommu(d);
+    struct domain_iommu *hd = dom_iommu(d);
+    struct iommu_flush_batch *batch = this_cpu(iommu_flush_batch);
     int rc;
 
     if ( !is_iommu_enabled(d) || !hd->platform_ops->iotlb_flush ||
@@ -488,6 +653,14 @@ int iommu_iotlb_flush(struct domain *d, dfn_t dfn, unsigned long page_count,
     if ( dfn_eq(dfn, INVALID_DFN) )
         return -EINVAL;
 
+    hd->flush_stats.requests++;
+
+    if ( batch && batch->d == d )
+        return iommu_flush_batch_add(batch, dfn, page_count, flush_flags);
+
+    hd->flush_stats.issued++;
+    hd->flush_stats.pages += page_count;
+
     rc = iommu_call(hd->platform_ops, iotlb_flush, d, dfn, page_count,
                     flush_flags);
     if ( unlikely(rc) )
@@ -506,13 +679,16 @@ int iommu_iotlb_flush(struct domain *d, dfn_t dfn, unsigned long page_count,
 
 int iommu_iotlb_flush_all(struct domain *d, unsigned int flush_flags)
 {
-    const struct domain_iommu *hd = dom_iommu(d);
+    struct domain_iommu *hd = dom_iommu(d);
     int rc;
 
     if ( !is_iommu_enabled(d) || !hd->platform_ops->iotlb_flush ||
          !flush_flags )
         return 0;
 
+    hd->flush_stats.requests++;
+    hd->flush_stats.issued++;
+
     rc = iommu_call(hd->platform_ops, iotlb_flush, d, INVALID_DFN, 0,
                     flush_flags | IOMMU_FLUSHF_all);
     if ( unlikely(rc) )
@@ -1602,6 +1602,10 @@ static int assign_device(struct domain *d, u16 seg, u8 bus, u8 devfn, u32 flag)
     if ( !arch_iommu_use_permitted(d) )
         return -EXDEV;
 
+    rc = arch_iommu_prepare_assign(d);
+    if ( rc )
+        return rc;
+
     /* device_assigned() should already have cleared the device for assignment */
     ASSERT(pcidevs_locked());
     pdev = pci_get_pdev(NULL, PCI_SBDF(seg, bus, devfn));
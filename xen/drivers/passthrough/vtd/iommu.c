@@ -723,6 +723,19 @@ static int __must_check iommu_flush_all(void)
     return rc;
 }
 
+static int __must_check flush_iotlb_range(struct vtd_iommu *iommu, int did,
+                                          dfn_t dfn, unsigned long page_count,
+                                          unsigned int flush_flags)
+{
+    if ( !page_count || (page_count & (page_count - 1)) ||
+         dfn_eq(dfn, INVALID_DFN) || !IS_ALIGNED(dfn_x(dfn), page_count) )
+        return iommu_flush_iotlb_dsi(iommu, did, 0);
+
+    return iommu_flush_iotlb_psi(iommu, did, dfn_to_daddr(dfn),
+                                 get_order_from_pages(page_count),
+                                 !(flush_flags & IOMMU_FLUSHF_modified));
+}
+
 static int __must_check cf_check iommu_flush_iotlb(struct domain *d, dfn_t dfn,
                                                    unsigned long page_count,
                                                    unsigned int flush_flags)
@@ -761,14 +774,8 @@ static int __must_check cf_check iommu_flush_iotlb(struct domain *d, dfn_t dfn,
         if ( iommu_domid == -1 )
             continue;
 
-        if ( !page_count || (page_count & (page_count - 1)) ||
-             dfn_eq(dfn, INVALID_DFN) || !IS_ALIGNED(dfn_x(dfn), page_count) )
-            rc = iommu_flush_iotlb_dsi(iommu, iommu_domid, 0);
-        else
-            rc = iommu_flush_iotlb_psi(iommu, iommu_domid,
-                                       dfn_to_daddr(dfn),
-                                       get_order_from_pages(page_count),
-                                       !(flush_flags & IOMMU_FLUSHF_modified));
+        rc = flush_iotlb_range(iommu, iommu_domid, dfn, page_count,
+                               flush_flags);
 
         if ( rc > 0 )
             iommu_flush_write_buffer(iommu);
@@ -779,6 +786,60 @@ static int __must_check cf_check iommu_flush_iotlb(struct domain *d, dfn_t dfn,
     return ret;
 }
 
+/*
+ * With queued invalidation, and no device IOTLBs to invalidate as well, the
+ * whole batch is waited for once per IOMMU.  Otherwise ranges are flushed
+ * one by one, as by iommu_flush_iotlb().
+ */
+static int __must_check cf_check iommu_flush_iotlb_batch(
+    struct domain *d, const struct iommu_flush_batch *batch)
+{
+    struct domain_iommu *hd = dom_iommu(d);
+    struct acpi_drhd_unit *drhd;
+    int ret = 0;
+
+    for_each_drhd_unit ( drhd )
+    {
+        struct vtd_iommu *iommu = drhd->iommu;
+        unsigned int i;
+        int iommu_domid, rc;
+
+        if ( !test_bit(iommu->index, hd->arch.vtd.iommu_bitmap) )
+            continue;
+
+        iommu_domid = get_iommu_did(d->domain_id, iommu, !d->is_dying);
+        if ( iommu_domid == -1 )
+            continue;
+
+        if ( iommu->flush.iotlb_batch && !iommu->flush_dev_iotlb )
+        {
+            vtd_ops_preamble_quirk(iommu);
+            rc = iommu->flush.iotlb_batch(iommu, iommu_domid, batch);
+            vtd_ops_postamble_quirk(iommu);
+
+            if ( rc > 0 )
+                iommu_flush_write_buffer(iommu);
+            else if ( !ret )
+                ret = rc;
+
+            continue;
+        }
+
+        for ( i = 0; i < batch->nr_ranges; i++ )
+        {
+            rc = flush_iotlb_range(iommu, iommu_domid, batch->ranges[i].dfn,
+                                   batch->ranges[i].count, batch->flush_flags);
+
+            if ( rc > 0 )
+                iommu_flush_write_buffer(iommu);
+            else if ( !ret )
+                ret = rc;
+        }
+    }
+
+    return ret;
+}
+
 static void queue_free_pt(struct domain_iommu *hd, mfn_t mfn, unsigned int level)
 {
     if ( level > 1 )
@@ -3275,6 +3336,7 @@ static const struct iommu_ops __initconst_cf_clobber vtd_ops = {
     .resume = vtd_resume,
     .crash_shutdown = vtd_crash_shutdown,
     .iotlb_flush = iommu_flush_iotlb,
+    .iotlb_flush_batch = iommu_flush_iotlb_batch,
     .get_reserved_device_memory = intel_iommu_get_reserved_device_memory,
     .dump_page_tables = vtd_dump_page_tables,
     .quiesce = vtd_quiesce,
@@ -503,6 +503,9 @@ struct vtd_iommu {
         int __must_check (*iotlb)(struct vtd_iommu *iommu, u16 did, u64 addr,
                                   unsigned int size_order, u64 type,
                                   bool flush_non_present_entry);
+        /* With queued invalidation only. */
+        int __must_check (*iotlb_batch)(struct vtd_iommu *iommu, uint16_t did,
+                                        const struct iommu_flush_batch *batch);
     } flush;
 
     struct list_head ats_devices;
@@ -32,6 +32,12 @@
 /* Each entry is 16 bytes, and there can be up to 2^7 pages. */
 #define QINVAL_MAX_ENTRY_NR (1u << (7 + PAGE_SHIFT_4K - 4))
 
+/*
+ * Invalidation descriptors queued by flush_iotlb_batch_qi() ahead of its wait
+ * descriptor.
+ */
+#define QINVAL_BATCH_MAX 32
+
 /* Status data flag */
 #define QINVAL_STAT_INIT  0
 #define QINVAL_STAT_DONE  1
@@ -116,10 +122,10 @@ static int __must_check queue_invalidate_context_sync(struct vtd_iommu *iommu,
     return invalidate_sync(iommu);
 }
 
-static int __must_check queue_invalidate_iotlb_sync(struct vtd_iommu *iommu,
-                                                    u8 granu, u8 dr, u8 dw,
-                                                    u16 did, u8 am, u8 ih,
-                                                    u64 addr)
+static void queue_invalidate_iotlb(struct vtd_iommu *iommu,
+                                   uint8_t granu, uint8_t dr, uint8_t dw,
+                                   uint16_t did, uint8_t am, uint8_t ih,
+                                   uint64_t addr)
 {
     unsigned long flags;
     unsigned int index;
@@ -146,6 +152,14 @@ static int __must_check queue_invalidate_iotlb_sync(struct vtd_iommu *iommu,
     spin_unlock_irqrestore(&iommu->register_lock, flags);
 
     unmap_vtd_domain_page(qinval_entry);
+}
+
+static int __must_check queue_invalidate_iotlb_sync(struct vtd_iommu *iommu,
+                                                    u8 granu, u8 dr, u8 dw,
+                                                    u16 did, u8 am, u8 ih,
+                                                    u64 addr)
+{
+    queue_invalidate_iotlb(iommu, granu, dr, dw, did, am, ih, addr);
 
     return invalidate_sync(iommu);
 }
@@ -487,6 +501,73 @@ static int __must_check cf_check flush_iotlb_qi(
     return ret;
 }
 
+/* Order of the largest aligned block at @dfn, of at most @count pages. */
+static unsigned int block_order(unsigned long dfn, unsigned long count,
+                                unsigned int max_order)
+{
+    unsigned int order = min(flsl(count) - 1U, max_order);
+
+    if ( dfn )
+        order = min(order, ffsl(dfn) - 1U);
+
+    return order;
+}
+
+/*
+ * Invalidate the ranges of a batch with page selective invalidations of
+ * aligned blocks, all waited for with a single wait descriptor.  When that
+ * takes more than QINVAL_BATCH_MAX descriptors, a domain selective
+ * invalidation is cheaper for the hardware as well as for the ring.
+ */
+static int __must_check cf_check flush_iotlb_batch_qi(
+    struct vtd_iommu *iommu, uint16_t did,
+    const struct iommu_flush_batch *batch)
+{
+    unsigned int i, order, nr = 0, max_order = cap_max_amask_val(iommu->cap);
+    uint8_t dr = cap_read_drain(iommu->cap), dw = cap_write_drain(iommu->cap);
+    bool psi = cap_pgsel_inv(iommu->cap);
+
+    ASSERT(iommu->qinval_maddr);
+
+    /* As for flush_iotlb_qi(), with only non-present entries replaced. */
+    if ( !(batch->flush_flags & IOMMU_FLUSHF_modified) &&
+         !cap_caching_mode(iommu->cap) )
+        return 1;
+
+    for ( i = 0; psi && i < batch->nr_ranges; i++ )
+    {
+        unsigned long dfn = dfn_x(batch->ranges[i].dfn);
+        unsigned long count = batch->ranges[i].count;
+
+        for ( ; count && psi; dfn += 1UL << order, count -= 1UL << order )
+        {
+            order = block_order(dfn, count, max_order);
+            psi = ++nr <= QINVAL_BATCH_MAX;
+        }
+    }
+
+    if ( !psi )
+        queue_invalidate_iotlb(iommu,
+                               DMA_TLB_DSI_FLUSH >> DMA_TLB_FLUSH_GRANU_OFFSET,
+                               dr, dw, did, 0, 0, 0);
+    else
+        for ( i = 0; i < batch->nr_ranges; i++ )
+        {
+            unsigned long dfn = dfn_x(batch->ranges[i].dfn);
+            unsigned long count = batch->ranges[i].count;
+
+            for ( ; count; dfn += 1UL << order, count -= 1UL << order )
+            {
+                order = block_order(dfn, count, max_order);
+                queue_invalidate_iotlb(
+                    iommu, DMA_TLB_PSI_FLUSH >> DMA_TLB_FLUSH_GRANU_OFFSET,
+                    dr, dw, did, order, 0, dfn_to_daddr(_dfn(dfn)));
+            }
+        }
+
+    return invalidate_sync(iommu);
+}
+
 int enable_qinval(struct vtd_iommu *iommu)
 {
     u32 sts;
@@ -509,11 +590,16 @@ int enable_qinval(struct vtd_iommu *iommu)
              * operation (the operation itself and a wait descriptor).  There
              * can be one such pair of requests pending per CPU.  One extra
              * entry is needed as the ring is considered full when there's
-             * only one entry left.
+             * only one entry left.  Batches queue up to QINVAL_BATCH_MAX
+             * operations ahead of their wait descriptor: room is made for
+             * them as far as the ring's maximum size allows, beyond which
+             * batches on many CPUs at once may have to wait for free slots.
              */
             BUILD_BUG_ON(CONFIG_NR_CPUS * 2 >= QINVAL_MAX_ENTRY_NR);
-            qi_pg_order = get_order_from_bytes((num_present_cpus() * 2 + 1) *
-                                               sizeof(struct qinval_entry));
+            qi_pg_order = get_order_from_bytes(
+                min_t(unsigned int,
+                      num_present_cpus() * (QINVAL_BATCH_MAX + 1) + 1,
+                      QINVAL_MAX_ENTRY_NR) * sizeof(struct qinval_entry));
             qi_entry_nr = (PAGE_SIZE << qi_pg_order) /
                           sizeof(struct qinval_entry);
 
@@ -535,6 +621,7 @@ int enable_qinval(struct vtd_iommu *iommu)
 
     iommu->flush.context = flush_context_qi;
     iommu->flush.iotlb   = flush_iotlb_qi;
+    iommu->flush.iotlb_batch = flush_iotlb_batch_qi;
 
     spin_lock_irqsave(&iommu->register_lock, flags);
 
@@ -604,6 +691,7 @@ out:
      * Assign callbacks to noop to catch errors if register-based invalidation
      * isn't supported.
      */
+    iommu->flush.iotlb_batch = NULL;
     if ( has_register_based_invalidation(iommu) )
     {
         iommu->flush.context = vtd_flush_context_reg;
@@ -782,6 +782,17 @@ bool arch_iommu_use_permitted(const struct domain *d)
             likely(!p2m_is_global_logdirty(d)));
 }
 
+int arch_iommu_prepare_assign(struct domain *d)
+{
+#ifdef CONFIG_HVM
+    /* Entries blocking DMA may have been left in a p2m shared by the IOMMU. */
+    if ( iommu_use_hap_pt(d) )
+        return p2m_resolve_iommu_recalc(d);
+#endif
+
+    return 0;
+}
+
 static int __init cf_check adjust_irq_affinities(void)
 {
     iommu_adjust_irq_affinities();
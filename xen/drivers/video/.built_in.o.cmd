@@ -0,0 +1 @@
+cmd_drivers/video/built_in.o := ld    -melf_x86_64 --no-warn-rwx-segments -r -o drivers/video/built_in.o drivers/video/vga.o drivers/video/font_8x14.o drivers/video/font_8x16.o drivers/video/font_8x8.o drivers/video/lfb.o drivers/video/vesa.o
@@ -178,7 +178,9 @@ bool vpci_process_pending(struct vcpu *v)
 {
     const struct pci_dev *pdev = v->vpci.pdev;
     struct vpci_header *header = NULL;
+    struct iommu_flush_batch batch;
     unsigned int i;
+    int rc = 0, err;
 
     if ( !pdev )
         return false;
@@ -193,7 +195,15 @@ bool vpci_process_pending(struct vcpu *v)
     }
 
     header = &pdev->vpci->header;
-    for ( i = 0; i < ARRAY_SIZE(header->bars); i++ )
+
+    /*
+     * Issue a single IOTLB flush for all the BARs (until preempted), rather
+     * than one per p2m update.  The batch is flushed before the command
+     * register is written, hence before the guest can access the BARs.
+     */
+    iommu_flush_batch_start(&batch, v->domain);
+
+    for ( i = 0; !rc && i < ARRAY_SIZE(header->bars); i++ )
     {
         struct vpci_bar *bar = &header->bars[i];
         struct map_data data = {
@@ -201,43 +211,45 @@ bool vpci_process_pending(struct vcpu *v)
             .map = v->vpci.cmd & PCI_COMMAND_MEMORY,
             .bar = bar,
         };
-        int rc;
 
         if ( rangeset_is_empty(bar->mem) )
             continue;
 
         rc = rangeset_consume_ranges(bar->mem, map_range, &data);
+    }
 
-        if ( rc == -ERESTART )
-        {
-            read_unlock(&v->domain->pci_lock);
-            return true;
-        }
+    /* Also when preempted, batches can't be carried over. */
+    err = iommu_flush_batch_finish(&batch);
+    if ( !rc )
+        rc = err;
 
-        if ( rc )
-        {
-            spin_lock(&pdev->vpci->lock);
-            /* Disable memory decoding unconditionally on failure. */
-            modify_decoding(pdev, v->vpci.cmd & ~PCI_COMMAND_MEMORY,
-                            false);
-            spin_unlock(&pdev->vpci->lock);
+    if ( rc == -ERESTART )
+    {
+        read_unlock(&v->domain->pci_lock);
+        return true;
+    }
 
-            /* Clean all the rangesets */
-            for ( i = 0; i < ARRAY_SIZE(header->bars); i++ )
-                if ( !rangeset_is_empty(header->bars[i].mem) )
-                     rangeset_purge(header->bars[i].mem);
+    v->vpci.pdev = NULL;
 
-            v->vpci.pdev = NULL;
+    if ( rc )
+    {
+        spin_lock(&pdev->vpci->lock);
+        /* Disable memory decoding unconditionally on failure. */
+        modify_decoding(pdev, v->vpci.cmd & ~PCI_COMMAND_MEMORY, false);
+        spin_unlock(&pdev->vpci->lock);
 
-            read_unlock(&v->domain->pci_lock);
+        /* Clean all the rangesets */
+        for ( i = 0; i < ARRAY_SIZE(header->bars); i++ )
+            if ( !rangeset_is_empty(header->bars[i].mem) )
+                 rangeset_purge(header->bars[i].mem);
 
-            if ( !is_hardware_domain(v->domain) )
-                domain_crash(v->domain);
+        read_unlock(&v->domain->pci_lock);
 
-            return false;
-        }
+        if ( !is_hardware_domain(v->domain) )
+            domain_crash(v->domain);
+
+        return false;
     }
-    v->vpci.pdev = NULL;
 
     spin_lock(&pdev->vpci->lock);
     modify_decoding(pdev, v->vpci.cmd, v->vpci.rom_only);
@@ -252,11 +264,15 @@ static int __init apply_map(struct domain *d, const struct pci_dev *pdev,
                             uint16_t cmd)
 {
     struct vpci_header *header = &pdev->vpci->header;
-    int rc = 0;
+    struct iommu_flush_batch batch;
+    int rc = 0, err;
     unsigned int i;
 
     ASSERT(rw_is_write_locked(&d->pci_lock));
 
+    /* As in vpci_process_pending(), flush the IOTLB once for all BARs. */
+    iommu_flush_batch_start(&batch, d);
+
     for ( i = 0; i < ARRAY_SIZE(header->bars); i++ )
     {
         struct vpci_bar *bar = &header->bars[i];
@@ -271,13 +287,20 @@ static int __init apply_map(struct domain *d, const struct pci_dev *pdev,
             /*
              * It's safe to drop and reacquire the lock in this context
              * without risking pdev disappearing because devices cannot be
-             * removed until the initial domain has been started.
+             * removed until the initial domain has been started.  The flush
+             * batch isn't kept across softirq processing.
              */
+            iommu_flush_batch_finish(&batch);
             write_unlock(&d->pci_lock);
             process_pending_softirqs();
             write_lock(&d->pci_lock);
+            iommu_flush_batch_start(&batch, d);
         }
     }
+
+    err = iommu_flush_batch_finish(&batch);
+    if ( !rc )
+        rc = err;
     if ( !rc )
         modify_decoding(pdev, cmd, false);
 
@@ -21,6 +21,7 @@
 
 #include <xen/io.h>
 #include <xen/lib.h>
+#include <xen/perfc.h>
 #include <xen/sched.h>
 
 #include <asm/msi.h>
@@ -85,6 +86,8 @@ static void cf_check control_write(
     if ( new_masked == msix->masked && new_enabled == msix->enabled )
         return;
 
+    write_lock(&msix->entries_lock);
+
     /*
      * According to the PCI 3.0 specification, switching the enable bit to 1
      * or the function mask bit to 0 should cause all the cached addresses
@@ -131,6 +134,7 @@ static void cf_check control_write(
                 /* Ignore non-present entry. */
                 break;
             default:
+                write_unlock(&msix->entries_lock);
                 gprintk(XENLOG_WARNING, "%pp: unable to disable entry %u: %d\n",
                         &pdev->sbdf, i, rc);
                 return;
@@ -148,6 +152,8 @@ static void cf_check control_write(
     msix->masked = new_masked;
     msix->enabled = new_enabled;
 
+    write_unlock(&msix->entries_lock);
+
     val = control_read(pdev, reg, data);
     if ( pci_msi_conf_write_intercept(msix->pdev, reg, 2, &val) >= 0 )
         pci_conf_write16(pdev->sbdf, reg, val);
@@ -380,10 +386,19 @@ static int cf_check msix_read(
         return X86EMUL_OKAY;
     }
 
-    spin_lock(&msix->pdev->vpci->lock);
     entry = get_entry(msix, addr);
     offset = addr & (PCI_MSIX_ENTRY_SIZE - 1);
 
+    if ( offset == PCI_MSIX_ENTRY_VECTOR_CTRL_OFFSET )
+    {
+        /* E.g. flushing a mask bit write: no need for the vPCI lock. */
+        *data = ACCESS_ONCE(entry->masked) ? PCI_MSIX_VECTOR_BITMASK : 0;
+        read_unlock(&d->pci_lock);
+        return X86EMUL_OKAY;
+    }
+
+    spin_lock(&msix->pdev->vpci->lock);
+
     switch ( offset )
     {
     case PCI_MSIX_ENTRY_LOWER_ADDR_OFFSET:
@@ -401,10 +416,6 @@ static int cf_check msix_read(
                 (uint64_t)(entry->masked ? PCI_MSIX_VECTOR_BITMASK : 0) << 32;
         break;
 
-    case PCI_MSIX_ENTRY_VECTOR_CTRL_OFFSET:
-        *data = entry->masked ? PCI_MSIX_VECTOR_BITMASK : 0;
-        break;
-
     default:
         ASSERT_UNREACHABLE();
         break;
@@ -475,6 +486,38 @@ static int adjacent_write(const struct domain *d, const struct vpci_msix *msix,
     return X86EMUL_OKAY;
 }
 
+/*
+ * Handle a write to the vector control register of an entry without taking
+ * the vPCI lock, which guests masking and unmasking vectors (e.g. around
+ * interrupt migration) would otherwise contend on.  The interrupt bound to the
+ * entry can't change while the entries lock is read locked.  Returns false if
+ * the entry needs to be (re)bound, which is left to the slow path.
+ */
+static bool mask_entry_fast(struct vpci_msix *msix,
+                            struct vpci_msix_entry *entry, bool new_masked)
+{
+    bool done = true;
+
+    read_lock(&msix->entries_lock);
+
+    if ( entry->masked == new_masked )
+        /* No change in the mask bit, nothing to do. */;
+    else if ( !new_masked && msix->enabled && !msix->masked && entry->updated )
+        done = false;
+    else
+    {
+        entry->masked = new_masked;
+        vpci_msix_arch_mask_entry(entry, msix->pdev, new_masked);
+    }
+
+    read_unlock(&msix->entries_lock);
+
+    if ( done )
+        perfc_incr(vpci_msix_mask_fast);
+
+    return done;
+}
+
 static int cf_check msix_write(
     struct vcpu *v, unsigned long addr, unsigned int len, unsigned long data)
 {
@@ -506,10 +549,18 @@ static int cf_check msix_write(
         return X86EMUL_OKAY;
     }
 
-    spin_lock(&msix->pdev->vpci->lock);
     entry = get_entry(msix, addr);
     offset = addr & (PCI_MSIX_ENTRY_SIZE - 1);
 
+    if ( offset == PCI_MSIX_ENTRY_VECTOR_CTRL_OFFSET &&
+         mask_entry_fast(msix, entry, data & PCI_MSIX_VECTOR_BITMASK) )
+    {
+        read_unlock(&d->pci_lock);
+        return X86EMUL_OKAY;
+    }
+
+    spin_lock(&msix->pdev->vpci->lock);
+
     /*
      * NB: Xen allows writes to the data/address registers with the entry
      * unmasked. The specification says this is undefined behavior, and Xen
@@ -554,6 +605,8 @@ static int cf_check msix_write(
             /* No change in the mask bit, nothing to do. */
             break;
 
+        write_lock(&msix->entries_lock);
+
         /*
          * Update the masked state before calling vpci_msix_arch_enable_entry,
          * so that it picks the new state.
@@ -572,6 +625,8 @@ static int cf_check msix_write(
         else
             vpci_msix_arch_mask_entry(entry, pdev, entry->masked);
 
+        write_unlock(&msix->entries_lock);
+
         break;
     }
 
@@ -784,6 +839,7 @@ static int cf_check init_msix(struct pci_dev *pdev)
 
     msix->max_entries = max_entries;
     msix->pdev = pdev;
+    rwlock_init(&msix->entries_lock);
 
     for ( i = 0; i < max_entries; i++)
     {
@@ -0,0 +1 @@
+cmd_include/headers99.chk := 	rm -f include/headers99.chk.new; get_prereq() { case $$1 in   include/public/io/9pfs.h) echo " -include string.h";;   include/public/io/pvcalls.h) echo " -include string.h";; *) ;; esac; }; for i in include/public/io/9pfs.h include/public/io/pvcalls.h; do echo "$(pound)include "\"$$i\" | gcc -x c -std=c99 -Wall -Werror -include stdint.h $$(get_prereq $$i) -S -o /dev/null - || exit $$?; echo $$i >> include/headers99.chk.new; done; mv include/headers99.chk.new include/headers99.chk
@@ -0,0 +1 @@
+cmd_include/compat/event_channel.c := /root/.pyenv/shims/python3 ./tools/compat-build-source.py ./include/xlat.lst <include/public/event_channel.h >include/compat/event_channel.c.new; mv -f include/compat/event_channel.c.new include/compat/event_channel.c
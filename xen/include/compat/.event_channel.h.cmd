@@ -0,0 +1 @@
+cmd_include/compat/event_channel.h := /root/.pyenv/shims/python3 ./tools/compat-build-header.py <include/compat/event_channel.i compat/event_channel.h >>include/compat/event_channel.h.new; mv -f include/compat/event_channel.h.new include/compat/event_channel.h
@@ -0,0 +1 @@
+cmd_include/compat/kexec.c := /root/.pyenv/shims/python3 ./tools/compat-build-source.py ./include/xlat.lst <include/public/kexec.h >include/compat/kexec.c.new; mv -f include/compat/kexec.c.new include/compat/kexec.c
@@ -0,0 +1 @@
+cmd_include/compat/kexec.h := /root/.pyenv/shims/python3 ./tools/compat-build-header.py <include/compat/kexec.i compat/kexec.h >>include/compat/kexec.h.new; mv -f include/compat/kexec.h.new include/compat/kexec.h
@@ -0,0 +1 @@
+cmd_include/compat/nmi.c := /root/.pyenv/shims/python3 ./tools/compat-build-source.py ./include/xlat.lst <include/public/nmi.h >include/compat/nmi.c.new; mv -f include/compat/nmi.c.new include/compat/nmi.c
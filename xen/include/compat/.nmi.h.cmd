@@ -0,0 +1 @@
+cmd_include/compat/nmi.h := /root/.pyenv/shims/python3 ./tools/compat-build-header.py <include/compat/nmi.i compat/nmi.h >>include/compat/nmi.h.new; mv -f include/compat/nmi.h.new include/compat/nmi.h
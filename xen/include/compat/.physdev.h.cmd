@@ -0,0 +1 @@
+cmd_include/compat/physdev.h := /root/.pyenv/shims/python3 ./tools/compat-build-header.py <include/compat/physdev.i compat/physdev.h >>include/compat/physdev.h.new; mv -f include/compat/physdev.h.new include/compat/physdev.h
@@ -0,0 +1 @@
+cmd_include/compat/platform.c := /root/.pyenv/shims/python3 ./tools/compat-build-source.py ./include/xlat.lst <include/public/platform.h >include/compat/platform.c.new; mv -f include/compat/platform.c.new include/compat/platform.c
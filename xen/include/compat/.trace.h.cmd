@@ -0,0 +1 @@
+cmd_include/compat/trace.h := /root/.pyenv/shims/python3 ./tools/compat-build-header.py <include/compat/trace.i compat/trace.h >>include/compat/trace.h.new; mv -f include/compat/trace.h.new include/compat/trace.h
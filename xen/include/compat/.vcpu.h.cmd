@@ -0,0 +1 @@
+cmd_include/compat/vcpu.h := /root/.pyenv/shims/python3 ./tools/compat-build-header.py <include/compat/vcpu.i compat/vcpu.h >>include/compat/vcpu.h.new; mv -f include/compat/vcpu.h.new include/compat/vcpu.h
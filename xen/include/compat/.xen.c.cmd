@@ -0,0 +1 @@
+cmd_include/compat/xen.c := /root/.pyenv/shims/python3 ./tools/compat-build-source.py ./include/xlat.lst <include/public/xen.h >include/compat/xen.c.new; mv -f include/compat/xen.c.new include/compat/xen.c
@@ -0,0 +1 @@
+cmd_include/compat/.xlat/event_channel.h := /root/.pyenv/shims/python3 ./tools/compat-xlat-header.py include/compat/event_channel.h include/compat/.xlat/event_channel.lst > include/compat/.xlat/event_channel.h.new; mv -f include/compat/.xlat/event_channel.h.new include/compat/.xlat/event_channel.h
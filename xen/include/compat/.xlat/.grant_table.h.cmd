@@ -0,0 +1 @@
+cmd_include/compat/.xlat/grant_table.h := /root/.pyenv/shims/python3 ./tools/compat-xlat-header.py include/compat/grant_table.h include/compat/.xlat/grant_table.lst > include/compat/.xlat/grant_table.h.new; mv -f include/compat/.xlat/grant_table.h.new include/compat/.xlat/grant_table.h
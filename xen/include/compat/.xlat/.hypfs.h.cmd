@@ -0,0 +1 @@
+cmd_include/compat/.xlat/hypfs.h := /root/.pyenv/shims/python3 ./tools/compat-xlat-header.py include/compat/hypfs.h include/compat/.xlat/hypfs.lst > include/compat/.xlat/hypfs.h.new; mv -f include/compat/.xlat/hypfs.h.new include/compat/.xlat/hypfs.h
@@ -0,0 +1 @@
+cmd_include/compat/.xlat/kexec.h := /root/.pyenv/shims/python3 ./tools/compat-xlat-header.py include/compat/kexec.h include/compat/.xlat/kexec.lst > include/compat/.xlat/kexec.h.new; mv -f include/compat/.xlat/kexec.h.new include/compat/.xlat/kexec.h
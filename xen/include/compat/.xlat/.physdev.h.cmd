@@ -0,0 +1 @@
+cmd_include/compat/.xlat/physdev.h := /root/.pyenv/shims/python3 ./tools/compat-xlat-header.py include/compat/physdev.h include/compat/.xlat/physdev.lst > include/compat/.xlat/physdev.h.new; mv -f include/compat/.xlat/physdev.h.new include/compat/.xlat/physdev.h
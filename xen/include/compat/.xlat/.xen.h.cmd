@@ -0,0 +1 @@
+cmd_include/compat/.xlat/xen.h := /root/.pyenv/shims/python3 ./tools/compat-xlat-header.py include/compat/xen.h include/compat/.xlat/xen.lst > include/compat/.xlat/xen.h.new; mv -f include/compat/.xlat/xen.h.new include/compat/.xlat/xen.h
@@ -0,0 +1,22 @@
+
+#define CHECK_build_id \
+    CHECK_SIZE_(struct, build_id); \
+    CHECK_FIELD_(struct, build_id, len); \
+    CHECK_FIELD_(struct, build_id, buf)
+
+#define CHECK_compile_info \
+    CHECK_SIZE_(struct, compile_info); \
+    CHECK_FIELD_(struct, compile_info, compiler); \
+    CHECK_FIELD_(struct, compile_info, compile_by); \
+    CHECK_FIELD_(struct, compile_info, compile_domain); \
+    CHECK_FIELD_(struct, compile_info, compile_date)
+
+#define CHECK_feature_info \
+    CHECK_SIZE_(struct, feature_info); \
+    CHECK_FIELD_(struct, feature_info, submap_idx); \
+    CHECK_FIELD_(struct, feature_info, submap)
+
+#define CHECK_varbuf \
+    CHECK_SIZE_(struct, varbuf); \
+    CHECK_FIELD_(struct, varbuf, len); \
+    CHECK_FIELD_(struct, varbuf, buf)
@@ -0,0 +1 @@
+cmd_include/compat/arch-x86/pmu.h := /root/.pyenv/shims/python3 ./tools/compat-build-header.py <include/compat/arch-x86/pmu.i compat/arch-x86/pmu.h >>include/compat/arch-x86/pmu.h.new; mv -f include/compat/arch-x86/pmu.h.new include/compat/arch-x86/pmu.h
@@ -0,0 +1 @@
+cmd_include/compat/arch-x86/xen-x86_32.c := /root/.pyenv/shims/python3 ./tools/compat-build-source.py ./include/xlat.lst <include/public/arch-x86/xen-x86_32.h >include/compat/arch-x86/xen-x86_32.c.new; mv -f include/compat/arch-x86/xen-x86_32.c.new include/compat/arch-x86/xen-x86_32.c
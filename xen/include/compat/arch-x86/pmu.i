@@ -0,0 +1,113 @@
+# 0 "include/compat/arch-x86/pmu.c"
+# 1 "/root/repo/xen//"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "./include/public/xen-compat.h" 1
+# 0 "<command-line>" 2
+# 1 "include/compat/arch-x86/pmu.c"
+# 12 "include/compat/arch-x86/pmu.c"
+struct xen_pmu_amd_ctxt {
+
+
+
+
+    uint32_t counters;
+    uint32_t ctrls;
+
+
+    uint64_t regs[XEN_FLEX_ARRAY_DIM];
+};
+typedef struct @KeeP@xen_pmu_amd_ctxt xen_pmu_amd_ctxt_t;
+DEFINE_COMPAT_HANDLE(xen_pmu_amd_ctxt_t);
+
+
+struct xen_pmu_cntr_pair {
+    uint64_t counter;
+    uint64_t control;
+};
+typedef struct @KeeP@xen_pmu_cntr_pair xen_pmu_cntr_pair_t;
+DEFINE_COMPAT_HANDLE(xen_pmu_cntr_pair_t);
+
+struct xen_pmu_intel_ctxt {
+
+
+
+
+
+    uint32_t fixed_counters;
+    uint32_t arch_counters;
+
+
+    uint64_t global_ctrl;
+    uint64_t global_ovf_ctrl;
+    uint64_t global_status;
+    uint64_t fixed_ctrl;
+    uint64_t ds_area;
+    uint64_t pebs_enable;
+    uint64_t debugctl;
+
+
+    uint64_t regs[XEN_FLEX_ARRAY_DIM];
+};
+typedef struct @KeeP@xen_pmu_intel_ctxt xen_pmu_intel_ctxt_t;
+DEFINE_COMPAT_HANDLE(xen_pmu_intel_ctxt_t);
+
+
+struct xen_pmu_regs {
+    uint64_t ip;
+    uint64_t sp;
+    uint64_t flags;
+    uint16_t cs;
+    uint16_t ss;
+    uint8_t cpl;
+    uint8_t pad[3];
+};
+typedef struct @KeeP@xen_pmu_regs xen_pmu_regs_t;
+DEFINE_COMPAT_HANDLE(xen_pmu_regs_t);
+# 85 "include/compat/arch-x86/pmu.c"
+struct xen_pmu_arch {
+    union {
+
+
+
+
+        xen_pmu_regs_t regs;
+
+
+        uint8_t pad[64];
+    } r;
+
+
+    uint64_t pmu_flags;
+
+
+
+
+
+
+
+    union {
+        uint32_t lapic_lvtpc;
+        uint64_t pad;
+    } l;
+
+
+
+
+
+
+
+    union {
+        xen_pmu_amd_ctxt_t amd;
+        xen_pmu_intel_ctxt_t intel;
+
+
+
+
+
+
+        uint8_t pad[128];
+    } c;
+};
+typedef struct @KeeP@xen_pmu_arch xen_pmu_arch_t;
+DEFINE_COMPAT_HANDLE(xen_pmu_arch_t);
@@ -0,0 +1,231 @@
+# 0 "include/compat/arch-x86/xen-mca.c"
+# 1 "/root/repo/xen//"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "./include/public/xen-compat.h" 1
+# 0 "<command-line>" 2
+# 1 "include/compat/arch-x86/xen-mca.c"
+# 94 "include/compat/arch-x86/xen-mca.c"
+struct mcinfo_common {
+    uint16_t type;
+    uint16_t size;
+};
+typedef struct @KeeP@mcinfo_common xen_mcinfo_common_t;
+# 108 "include/compat/arch-x86/xen-mca.c"
+struct mcinfo_global {
+    xen_mcinfo_common_t common;
+
+
+    uint16_t mc_domid;
+    uint16_t mc_vcpuid;
+    uint32_t mc_socketid;
+    uint16_t mc_coreid;
+    uint16_t mc_core_threadid;
+    uint32_t mc_apicid;
+    uint32_t mc_flags;
+    uint64_t mc_gstatus;
+};
+
+
+struct mcinfo_bank {
+    xen_mcinfo_common_t common;
+
+    uint16_t mc_bank;
+    uint16_t mc_domid;
+
+    uint64_t mc_status;
+    uint64_t mc_addr;
+
+    uint64_t mc_misc;
+    uint64_t mc_ctrl2;
+    uint64_t mc_tsc;
+};
+
+
+struct mcinfo_msr {
+    uint64_t reg;
+    uint64_t value;
+};
+typedef struct @KeeP@mcinfo_msr xen_mcinfo_msr_t;
+
+
+
+struct mcinfo_extended {
+    xen_mcinfo_common_t common;
+
+
+
+
+
+    uint32_t mc_msrs;
+
+
+
+
+
+    xen_mcinfo_msr_t mc_msr[32];
+};
+# 189 "include/compat/arch-x86/xen-mca.c"
+struct page_offline_action
+{
+
+    uint64_t mfn;
+    uint64_t status;
+};
+typedef struct @KeeP@page_offline_action xen_page_offline_action_t;
+
+struct cpu_offline_action
+{
+
+    uint32_t mc_socketid;
+    uint16_t mc_coreid;
+    uint16_t mc_core_threadid;
+};
+typedef struct @KeeP@cpu_offline_action xen_cpu_offline_action_t;
+
+
+struct mcinfo_recovery
+{
+    xen_mcinfo_common_t common;
+    uint16_t mc_bank;
+    uint8_t action_flags;
+    uint8_t action_types;
+    union {
+        xen_page_offline_action_t page_retire;
+        xen_cpu_offline_action_t cpu_offline;
+        uint8_t pad[16];
+    } action_info;
+};
+
+
+
+
+
+
+struct mc_info {
+
+    uint32_t mi_nentries;
+    uint32_t flags;
+    uint64_t mi_data[(768 - 1) / 8];
+};
+typedef struct @KeeP@mc_info mc_info_t;
+DEFINE_COMPAT_HANDLE(mc_info_t);
+# 247 "include/compat/arch-x86/xen-mca.c"
+struct mcinfo_logical_cpu {
+    uint32_t mc_cpunr;
+    uint32_t mc_chipid;
+    uint16_t mc_coreid;
+    uint16_t mc_threadid;
+    uint32_t mc_apicid;
+    uint32_t mc_clusterid;
+    uint32_t mc_ncores;
+    uint32_t mc_ncores_active;
+    uint32_t mc_nthreads;
+    int32_t mc_cpuid_level;
+    uint32_t mc_family;
+    uint32_t mc_vendor;
+    uint32_t mc_model;
+    uint32_t mc_step;
+    char mc_vendorid[16];
+    char mc_brandid[64];
+    uint32_t mc_cpu_caps[7];
+    uint32_t mc_cache_size;
+    uint32_t mc_cache_alignment;
+    int32_t mc_nmsrvals;
+    xen_mcinfo_msr_t mc_msrvalues[8];
+};
+typedef struct @KeeP@mcinfo_logical_cpu xen_mc_logical_cpu_t;
+DEFINE_COMPAT_HANDLE(xen_mc_logical_cpu_t);
+# 334 "include/compat/arch-x86/xen-mca.c"
+struct xen_mc_fetch {
+
+    uint32_t flags;
+
+
+
+    uint32_t _pad0;
+    uint64_t fetch_id;
+
+
+    COMPAT_HANDLE(mc_info_t) data;
+};
+typedef struct xen_mc_fetch xen_mc_fetch_t;
+DEFINE_COMPAT_HANDLE(xen_mc_fetch_t);
+
+
+
+
+
+
+struct xen_mc_notifydomain {
+
+    uint16_t mc_domid;
+    uint16_t mc_vcpuid;
+
+
+
+    uint32_t flags;
+
+
+
+};
+typedef struct @KeeP@xen_mc_notifydomain xen_mc_notifydomain_t;
+DEFINE_COMPAT_HANDLE(xen_mc_notifydomain_t);
+
+
+struct xen_mc_physcpuinfo {
+
+    uint32_t ncpus;
+    uint32_t _pad0;
+
+    COMPAT_HANDLE(xen_mc_logical_cpu_t) info;
+};
+typedef struct xen_mc_physcpuinfo xen_mc_physcpuinfo_t;
+
+
+
+struct xen_mc_msrinject {
+
+    uint32_t mcinj_cpunr;
+    uint32_t mcinj_flags;
+    uint32_t mcinj_count;
+    domid_t mcinj_domid;
+
+    uint16_t _pad0;
+    xen_mcinfo_msr_t mcinj_msr[8];
+};
+typedef struct @KeeP@xen_mc_msrinject xen_mc_msrinject_t;
+
+
+
+
+
+
+struct xen_mc_mceinject {
+    unsigned int mceinj_cpunr;
+};
+typedef struct @KeeP@xen_mc_mceinject xen_mc_mceinject_t;
+# 412 "include/compat/arch-x86/xen-mca.c"
+struct xen_mc_inject_v2 {
+    uint32_t flags;
+    xenctl_bitmap_t cpumap;
+};
+typedef struct @KeeP@xen_mc_inject_v2 xen_mc_inject_v2_t;
+
+
+struct xen_mc {
+    uint32_t cmd;
+    uint32_t interface_version;
+    union {
+        xen_mc_fetch_t mc_fetch;
+        xen_mc_notifydomain_t mc_notifydomain;
+        xen_mc_physcpuinfo_t mc_physcpuinfo;
+        xen_mc_msrinject_t mc_msrinject;
+        xen_mc_mceinject_t mc_mceinject;
+
+        xen_mc_inject_v2_t mc_inject_v2;
+
+    } u;
+};
+typedef struct @KeeP@xen_mc xen_mc_t;
+DEFINE_COMPAT_HANDLE(xen_mc_t);
@@ -0,0 +1,136 @@
+# 0 "include/compat/arch-x86/xen.c"
+# 1 "/root/repo/xen//"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "./include/public/xen-compat.h" 1
+# 0 "<command-line>" 2
+# 1 "include/compat/arch-x86/xen.c"
+# 42 "include/compat/arch-x86/xen.c"
+__DeFiNe__ __DECL_REG_LO8(which) uint32_t e ## which ## x
+__DeFiNe__ __DECL_REG_LO16(name) union { uint32_t e ## name; }
+
+__InClUdE__ "xen-x86_32.h"
+
+__UnDeF__ __DECL_REG_LO8
+__UnDeF__ __DECL_REG_LO16
+__DeFiNe__ __DECL_REG_LO8(which) e ## which ## x
+__DeFiNe__ __DECL_REG_LO16(name) e ## name
+
+
+
+
+
+
+typedef unsigned long xen_pfn_t;
+# 102 "include/compat/arch-x86/xen.c"
+typedef unsigned long xen_ulong_t;
+# 138 "include/compat/arch-x86/xen.c"
+struct trap_info {
+    uint8_t vector;
+    uint8_t flags;
+    uint16_t cs;
+    unsigned long address;
+};
+typedef struct trap_info trap_info_t;
+DEFINE_COMPAT_HANDLE(trap_info_t);
+
+typedef uint64_t tsc_timestamp_t;
+# 160 "include/compat/arch-x86/xen.c"
+struct vcpu_guest_context {
+
+    struct { char x[512]; } fpu_ctxt;
+# 173 "include/compat/arch-x86/xen.c"
+    unsigned long flags;
+
+
+
+
+
+
+
+    struct guest_user_regs user_regs;
+
+
+
+
+    struct trap_info trap_ctxt[256];
+    unsigned long ldt_base, ldt_ents;
+    unsigned long gdt_frames[16], gdt_ents;
+    unsigned long kernel_ss, kernel_sp;
+
+    unsigned long ctrlreg[8];
+    unsigned long debugreg[8];
+
+    unsigned long event_callback_cs;
+    unsigned long event_callback_eip;
+    unsigned long failsafe_callback_cs;
+    unsigned long failsafe_callback_eip;
+# 213 "include/compat/arch-x86/xen.c"
+    unsigned long vm_assist;
+
+
+
+
+
+
+};
+typedef struct vcpu_guest_context vcpu_guest_context_t;
+DEFINE_COMPAT_HANDLE(vcpu_guest_context_t);
+
+struct arch_shared_info {
+
+
+
+
+    unsigned long max_pfn;
+
+
+
+
+
+
+
+    xen_pfn_t pfn_to_mfn_frame_list_list;
+    unsigned long nmi_reason;
+# 257 "include/compat/arch-x86/xen.c"
+    unsigned long p2m_cr3;
+    unsigned long p2m_vaddr;
+    unsigned long p2m_generation;
+
+
+    uint32_t wc_sec_hi;
+
+};
+typedef struct arch_shared_info arch_shared_info_t;
+
+
+
+
+
+
+struct xen_arch_domainconfig {
+# 302 "include/compat/arch-x86/xen.c"
+    uint32_t emulation_flags;
+
+
+
+
+
+
+
+    uint32_t misc_flags;
+};
+# 322 "include/compat/arch-x86/xen.c"
+typedef struct xen_cpuid_leaf {
+
+    uint32_t leaf, subleaf;
+    uint32_t a, b, c, d;
+} xen_cpuid_leaf_t;
+DEFINE_COMPAT_HANDLE(xen_cpuid_leaf_t);
+
+typedef struct xen_msr_entry {
+    uint32_t idx;
+    uint32_t flags;
+    uint64_t val;
+} xen_msr_entry_t;
+DEFINE_COMPAT_HANDLE(xen_msr_entry_t);
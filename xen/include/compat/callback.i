@@ -0,0 +1,24 @@
+# 0 "include/compat/callback.c"
+# 1 "/root/repo/xen//"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "./include/public/xen-compat.h" 1
+# 0 "<command-line>" 2
+# 1 "include/compat/callback.c"
+# 13 "include/compat/callback.c"
+__InClUdE__ "xen.h"
+# 67 "include/compat/callback.c"
+struct callback_register {
+    uint16_t type;
+    uint16_t flags;
+    xen_callback_t address;
+};
+typedef struct callback_register callback_register_t;
+DEFINE_COMPAT_HANDLE(callback_register_t);
+# 82 "include/compat/callback.c"
+struct callback_unregister {
+    uint16_t type;
+    uint16_t _unused;
+};
+typedef struct callback_unregister callback_unregister_t;
+DEFINE_COMPAT_HANDLE(callback_unregister_t);
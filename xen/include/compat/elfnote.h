@@ -0,0 +1,5 @@
+#ifndef _COMPAT_ELFNOTE_H
+#define _COMPAT_ELFNOTE_H
+#include <xen/compat.h>
+#include <public/elfnote.h>
+#endif /* _COMPAT_ELFNOTE_H */
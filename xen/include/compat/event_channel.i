@@ -0,0 +1,215 @@
+# 0 "include/compat/event_channel.c"
+# 1 "/root/repo/xen//"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "./include/public/xen-compat.h" 1
+# 0 "<command-line>" 2
+# 1 "include/compat/event_channel.c"
+# 13 "include/compat/event_channel.c"
+__InClUdE__ "xen.h"
+# 67 "include/compat/event_channel.c"
+typedef uint32_t evtchn_port_t;
+DEFINE_COMPAT_HANDLE(evtchn_port_t);
+# 78 "include/compat/event_channel.c"
+struct evtchn_alloc_unbound {
+
+    domid_t dom, remote_dom;
+
+    evtchn_port_t port;
+};
+typedef struct @KeeP@evtchn_alloc_unbound evtchn_alloc_unbound_t;
+# 106 "include/compat/event_channel.c"
+struct evtchn_bind_interdomain {
+
+    domid_t remote_dom;
+    evtchn_port_t remote_port;
+
+    evtchn_port_t local_port;
+};
+typedef struct @KeeP@evtchn_bind_interdomain evtchn_bind_interdomain_t;
+# 127 "include/compat/event_channel.c"
+struct evtchn_bind_virq {
+
+    uint32_t virq;
+    uint32_t vcpu;
+
+    evtchn_port_t port;
+};
+typedef struct @KeeP@evtchn_bind_virq evtchn_bind_virq_t;
+
+
+
+
+
+
+
+struct evtchn_bind_pirq {
+
+    uint32_t pirq;
+
+    uint32_t flags;
+
+    evtchn_port_t port;
+};
+typedef struct @KeeP@evtchn_bind_pirq evtchn_bind_pirq_t;
+
+
+
+
+
+
+
+struct evtchn_bind_ipi {
+    uint32_t vcpu;
+
+    evtchn_port_t port;
+};
+typedef struct @KeeP@evtchn_bind_ipi evtchn_bind_ipi_t;
+
+
+
+
+
+
+struct evtchn_close {
+
+    evtchn_port_t port;
+};
+typedef struct @KeeP@evtchn_close evtchn_close_t;
+
+
+
+
+
+struct evtchn_send {
+
+    evtchn_port_t port;
+};
+typedef struct @KeeP@evtchn_send evtchn_send_t;
+# 196 "include/compat/event_channel.c"
+struct evtchn_send_batch {
+
+    uint32_t nr_ports;
+    evtchn_port_t ports[64];
+};
+typedef struct @KeeP@evtchn_send_batch evtchn_send_batch_t;
+# 211 "include/compat/event_channel.c"
+struct evtchn_status {
+
+    domid_t dom;
+    evtchn_port_t port;
+
+
+
+
+
+
+
+    uint32_t status;
+    uint32_t vcpu;
+    union {
+        struct {
+            domid_t dom;
+        } unbound;
+        struct {
+            domid_t dom;
+            evtchn_port_t port;
+        } interdomain;
+        uint32_t pirq;
+        uint32_t virq;
+    } u;
+};
+typedef struct @KeeP@evtchn_status evtchn_status_t;
+# 250 "include/compat/event_channel.c"
+struct evtchn_bind_vcpu {
+
+    evtchn_port_t port;
+    uint32_t vcpu;
+};
+typedef struct @KeeP@evtchn_bind_vcpu evtchn_bind_vcpu_t;
+
+
+
+
+
+struct evtchn_unmask {
+
+    evtchn_port_t port;
+};
+typedef struct @KeeP@evtchn_unmask evtchn_unmask_t;
+# 277 "include/compat/event_channel.c"
+struct evtchn_reset {
+
+    domid_t dom;
+};
+typedef struct @KeeP@evtchn_reset evtchn_reset_t;
+# 290 "include/compat/event_channel.c"
+struct evtchn_init_control {
+
+    uint64_t control_gfn;
+    uint32_t offset;
+    uint32_t vcpu;
+
+    uint8_t link_bits;
+    uint8_t _pad[7];
+};
+typedef struct @KeeP@evtchn_init_control evtchn_init_control_t;
+
+
+
+
+struct evtchn_expand_array {
+
+    uint64_t array_gfn;
+};
+typedef struct @KeeP@evtchn_expand_array evtchn_expand_array_t;
+
+
+
+
+struct evtchn_set_priority {
+
+    evtchn_port_t port;
+    uint32_t priority;
+};
+typedef struct @KeeP@evtchn_set_priority evtchn_set_priority_t;
+# 334 "include/compat/event_channel.c"
+struct evtchn_set_moderation {
+
+    evtchn_port_t port;
+    uint32_t interval_us;
+};
+typedef struct @KeeP@evtchn_set_moderation evtchn_set_moderation_t;
+
+
+
+
+
+
+
+struct evtchn_op {
+    uint32_t cmd;
+    union {
+        evtchn_alloc_unbound_t alloc_unbound;
+        evtchn_bind_interdomain_t bind_interdomain;
+        evtchn_bind_virq_t bind_virq;
+        evtchn_bind_pirq_t bind_pirq;
+        evtchn_bind_ipi_t bind_ipi;
+        evtchn_close_t close;
+        evtchn_send_t send;
+        evtchn_status_t status;
+        evtchn_bind_vcpu_t bind_vcpu;
+        evtchn_unmask_t unmask;
+    } u;
+};
+typedef struct @KeeP@evtchn_op evtchn_op_t;
+DEFINE_COMPAT_HANDLE(evtchn_op_t);
+# 382 "include/compat/event_channel.c"
+typedef uint32_t event_word_t;
+# 394 "include/compat/event_channel.c"
+struct evtchn_fifo_control_block {
+    uint32_t ready;
+    uint32_t _rsvd;
+    uint32_t head[(15 + 1)];
+};
+typedef struct evtchn_fifo_control_block evtchn_fifo_control_block_t;
@@ -0,0 +1 @@
+cmd_include/compat/hvm/hvm_vcpu.c := /root/.pyenv/shims/python3 ./tools/compat-build-source.py ./include/xlat.lst <include/public/hvm/hvm_vcpu.h >include/compat/hvm/hvm_vcpu.c.new; mv -f include/compat/hvm/hvm_vcpu.c.new include/compat/hvm/hvm_vcpu.c
@@ -0,0 +1,24 @@
+#ifndef _COMPAT_HYPFS_H
+#define _COMPAT_HYPFS_H
+#include <xen/compat.h>
+#include <public/hypfs.h>
+#include "xen.h"
+struct compat_hypfs_direntry {
+    uint8_t type;
+
+    uint8_t encoding;
+
+    uint16_t pad;
+    uint32_t content_len;
+    uint32_t max_write_len;
+};
+typedef struct xen_hypfs_direntry __attribute__((__aligned__(__alignof( struct compat_hypfs_direntry)))) compat_hypfs_direntry_t;
+
+struct compat_hypfs_dirlistentry {
+    compat_hypfs_direntry_t e;
+
+    uint16_t off_next;
+
+    char name[COMPAT_FLEX_ARRAY_DIM];
+};
+#endif /* _COMPAT_HYPFS_H */
@@ -0,0 +1,34 @@
+# 0 "include/compat/hypfs.c"
+# 1 "/root/repo/xen//"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "./include/public/xen-compat.h" 1
+# 0 "<command-line>" 2
+# 1 "include/compat/hypfs.c"
+# 12 "include/compat/hypfs.c"
+__InClUdE__ "xen.h"
+# 24 "include/compat/hypfs.c"
+struct xen_hypfs_direntry {
+    uint8_t type;
+
+
+
+
+
+
+    uint8_t encoding;
+
+
+    uint16_t pad;
+    uint32_t content_len;
+    uint32_t max_write_len;
+};
+typedef struct @KeeP@xen_hypfs_direntry xen_hypfs_direntry_t;
+
+struct xen_hypfs_dirlistentry {
+    xen_hypfs_direntry_t e;
+
+    uint16_t off_next;
+
+    char name[XEN_FLEX_ARRAY_DIM];
+};
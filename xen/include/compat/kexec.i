@@ -0,0 +1,78 @@
+# 0 "include/compat/kexec.c"
+# 1 "/root/repo/xen//"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "./include/public/xen-compat.h" 1
+# 0 "<command-line>" 2
+# 1 "include/compat/kexec.c"
+# 42 "include/compat/kexec.c"
+__InClUdE__ "xen.h"
+# 79 "include/compat/kexec.c"
+typedef struct xen_kexec_image {
+
+    unsigned long page_list[17];
+
+    unsigned long indirection_page;
+    unsigned long start_address;
+} xen_kexec_image_t;
+# 107 "include/compat/kexec.c"
+typedef struct xen_kexec_exec {
+    int type;
+} xen_kexec_exec_t;
+# 118 "include/compat/kexec.c"
+typedef struct xen_kexec_load_v1 {
+    int type;
+    xen_kexec_image_t image;
+} xen_kexec_load_v1_t;
+# 145 "include/compat/kexec.c"
+typedef struct xen_kexec_range {
+    int range;
+    int nr;
+    unsigned long size;
+    unsigned long start;
+} xen_kexec_range_t;
+
+
+
+
+
+
+typedef struct xen_kexec_segment {
+    union {
+        COMPAT_HANDLE(const_void) h;
+        uint64_t _pad;
+    } buf;
+    uint64_t buf_size;
+    uint64_t dest_maddr;
+    uint64_t dest_size;
+} xen_kexec_segment_t;
+DEFINE_COMPAT_HANDLE(xen_kexec_segment_t);
+# 189 "include/compat/kexec.c"
+typedef struct xen_kexec_load {
+    uint8_t type;
+    uint8_t _pad;
+    uint16_t arch;
+    uint32_t nr_segments;
+    union {
+        COMPAT_HANDLE(xen_kexec_segment_t) h;
+        uint64_t _pad;
+    } segments;
+    uint64_t entry_maddr;
+} xen_kexec_load_t;
+DEFINE_COMPAT_HANDLE(xen_kexec_load_t);
+
+
+
+
+
+
+
+typedef struct xen_kexec_unload {
+    uint8_t type;
+} xen_kexec_unload_t;
+DEFINE_COMPAT_HANDLE(xen_kexec_unload_t);
+# 222 "include/compat/kexec.c"
+typedef struct xen_kexec_status {
+    uint8_t type;
+} xen_kexec_status_t;
+DEFINE_COMPAT_HANDLE(xen_kexec_status_t);
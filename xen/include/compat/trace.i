@@ -0,0 +1,43 @@
+# 0 "include/compat/trace.c"
+# 1 "/root/repo/xen//"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "./include/public/xen-compat.h" 1
+# 0 "<command-line>" 2
+# 1 "include/compat/trace.c"
+# 273 "include/compat/trace.c"
+struct t_rec {
+    uint32_t event:28;
+    uint32_t extra_u32:3;
+    uint32_t cycles_included:1;
+    union {
+        struct {
+            uint32_t cycles_lo, cycles_hi;
+            uint32_t extra_u32[7];
+        } cycles;
+        struct {
+            uint32_t extra_u32[7];
+        } nocycles;
+    } u;
+};
+
+
+
+
+
+struct t_buf {
+# 301 "include/compat/trace.c"
+    uint32_t cons;
+    uint32_t prod;
+
+};
+
+
+
+
+
+struct t_info {
+    uint16_t tbuf_size;
+    uint16_t mfn_offset[];
+
+};
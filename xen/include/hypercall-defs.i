@@ -0,0 +1,228 @@
+# 0 "include/hypercall-defs.c"
+# 1 "/root/repo/xen//"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "././include/xen/config.h" 1
+# 14 "././include/xen/config.h"
+# 1 "./include/xen/kconfig.h" 1
+
+
+
+# 1 "./include/generated/autoconf.h" 1
+# 5 "./include/xen/kconfig.h" 2
+# 15 "././include/xen/config.h" 2
+
+
+# 1 "./include/xen/compiler.h" 1
+# 21 "./include/xen/compiler.h"
+#pragma GCC visibility push(hidden)
+# 18 "././include/xen/config.h" 2
+# 27 "././include/xen/config.h"
+# 1 "./arch/x86/include/asm/config.h" 1
+# 59 "./arch/x86/include/asm/config.h"
+# 1 "./include/xen/const.h" 1
+# 60 "./arch/x86/include/asm/config.h" 2
+# 241 "./arch/x86/include/asm/config.h"
+extern unsigned long xen_phys_start;
+# 28 "././include/xen/config.h" 2
+# 0 "<command-line>" 2
+# 1 "include/hypercall-defs.c"
+# 78 "include/hypercall-defs.c"
+rettype: compat int
+# 92 "include/hypercall-defs.c"
+handle: uint unsigned int
+handle: const_void const void
+handle: const_char const char
+
+
+defhandle: multicall_entry_compat_t
+
+defhandle: compat_platform_op_t
+
+
+
+
+
+
+
+prefix: do hvm compat
+physdev_op(int cmd, void *arg)
+
+prefix: do hvm compat
+
+grant_table_op(unsigned int cmd, void *uop, unsigned int count)
+
+
+prefix: do hvm
+memory_op(unsigned long cmd, void *arg)
+
+prefix: do compat
+xen_version(int cmd, void *arg)
+vcpu_op(int cmd, unsigned int vcpuid, void *arg)
+sched_op(int cmd, void *arg)
+xsm_op(void *op)
+callback_op(int cmd, const void *arg)
+
+
+
+
+iret()
+nmi_op(unsigned int cmd, void *arg)
+
+
+
+prefix: compat
+set_timer_op(uint32_t lo, uint32_t hi)
+multicall(multicall_entry_compat_t *call_list, unsigned long nr_calls)
+memory_op(unsigned int cmd, void *arg)
+
+dm_op(domid_t domid, unsigned int nr_bufs, void *bufs)
+
+mmuext_op(void *arg, unsigned int count, uint *pdone, unsigned int foreigndom)
+# 151 "include/hypercall-defs.c"
+platform_op(compat_platform_op_t *u_xenpf_op)
+
+
+kexec_op(unsigned int op, void *uarg)
+
+
+
+
+prefix: do
+event_channel_op_compat(evtchn_op_t *uop)
+physdev_op_compat(physdev_op_t *uop)
+
+sched_op_compat(int cmd, unsigned long arg)
+
+
+prefix: do
+set_timer_op(s_time_t timeout)
+console_io(unsigned int cmd, unsigned int count, char *buffer)
+vm_assist(unsigned int cmd, unsigned int type)
+event_channel_op(int cmd, void *arg)
+mmuext_op(mmuext_op_t *uops, unsigned int count, unsigned int *pdone, unsigned int foreigndom)
+multicall(multicall_entry_t *call_list, unsigned long nr_calls)
+
+mmu_update(mmu_update_t *ureqs, unsigned int count, unsigned int *pdone, unsigned int foreigndom)
+stack_switch(unsigned long ss, unsigned long esp)
+fpu_taskswitch(int set)
+set_debugreg(int reg, unsigned long value)
+get_debugreg(int reg)
+set_segment_base(unsigned int which, unsigned long base)
+mca(xen_mc_t *u_xen_mc)
+set_trap_table(const_trap_info_t *traps)
+set_gdt(xen_ulong_t *frame_list, unsigned int entries)
+set_callbacks(unsigned long event_address, unsigned long failsafe_address, unsigned long syscall_address)
+update_descriptor(uint64_t gaddr, uint64_t desc)
+update_va_mapping(unsigned long va, uint64_t val64, unsigned long flags)
+update_va_mapping_otherdomain(unsigned long va, uint64_t val64, unsigned long flags, domid_t domid)
+
+
+kexec_op(unsigned long op, void *uarg)
+
+
+dm_op(domid_t domid, unsigned int nr_bufs, xen_dm_op_buf_t *bufs)
+
+
+sysctl(xen_sysctl_t *u_sysctl)
+
+
+paging_domctl_cont(xen_domctl_t *u_domctl)
+
+
+domctl(xen_domctl_t *u_domctl)
+platform_op(xen_platform_op_t *u_xenpf_op)
+
+
+hvm_op(unsigned long op, void *arg)
+
+
+hypfs_op(unsigned int cmd, const char *arg1, unsigned long arg2, void *arg3, unsigned long arg4)
+
+
+xenpmu_op(unsigned int op, xen_pmu_params_t *arg)
+
+
+
+caller: pv64
+
+
+
+
+
+caller: hvm64
+
+caller: hvm32
+
+
+
+
+
+
+table: pv32 pv64 hvm32 hvm64 arm
+set_trap_table compat do - - -
+mmu_update do:1 do:1 - - -
+set_gdt compat do - - -
+stack_switch do:2 do:2 - - -
+set_callbacks compat do - - -
+fpu_taskswitch do do - - -
+sched_op_compat do do - - dep
+
+platform_op compat do compat do do
+
+set_debugreg do do - - -
+get_debugreg do do - - -
+update_descriptor compat do - - -
+memory_op compat do hvm hvm do
+multicall compat:2 do:2 compat do do
+update_va_mapping compat do - - -
+set_timer_op compat do compat do -
+event_channel_op_compat do do - - dep
+xen_version do do do do do
+console_io do do do do do
+physdev_op_compat compat do - - dep
+
+grant_table_op compat do hvm hvm do
+
+
+
+vm_assist do do do do do
+update_va_mapping_otherdomain compat do - - -
+iret compat:1 do:1 - - -
+vcpu_op compat do compat:1 do:1 do
+set_segment_base do:2 do:2 - - -
+
+mmuext_op compat:2 do:2 compat do -
+
+xsm_op compat do compat do do
+nmi_op compat do - - -
+sched_op compat do compat do do
+callback_op compat do - - -
+event_channel_op do do do:1 do:1 do:1
+physdev_op compat do hvm hvm do_arm
+
+hvm_op do do do do do
+
+
+sysctl do do do do do
+
+
+domctl do do do do do
+
+
+kexec_op compat do - - -
+
+tmem_op - - - - -
+
+
+
+xenpmu_op do do do do -
+
+dm_op compat do compat do do
+
+
+hypfs_op do do do do do
+
+mca do do - - -
+
+paging_domctl_cont do do do do -
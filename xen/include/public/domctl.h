@@ -232,6 +232,13 @@ struct xen_domctl_getpageframeinfo3 {
 #define XEN_DOMCTL_SHADOW_OP_CLEAN       11
  /* Return the bitmap but do not modify internal copy. */
 #define XEN_DOMCTL_SHADOW_OP_PEEK        12
+ /*
+  * Return the dirty pfns as an array of uint64_t in dirty_bitmap, and clean
+  * them from the internal copy.  'pages' is the capacity of the array on
+  * input, and the number of pfns returned on output.  If the array fills up,
+  * the remaining dirty pfns stay logged for the next call.
+  */
+#define XEN_DOMCTL_SHADOW_OP_CLEAN_LIST  13
 
 /*
  * Memory allocation accessors.  These APIs are broken and will be removed.
@@ -272,7 +279,7 @@ struct xen_domctl_getpageframeinfo3 {
   */
 #define XEN_DOMCTL_SHADOW_ENABLE_EXTERNAL  (1 << 4)
 
-/* Mode flags for XEN_DOMCTL_SHADOW_OP_{CLEAN,PEEK}. */
+/* Mode flags for XEN_DOMCTL_SHADOW_OP_{CLEAN,PEEK,CLEAN_LIST}. */
  /*
   * This is the final iteration: Requesting to include pages mapped
   * writably by the hypervisor in the dirty bitmap.
@@ -289,13 +296,13 @@ struct xen_domctl_shadow_op {
     uint32_t       op;       /* XEN_DOMCTL_SHADOW_OP_* */
 
     /* OP_ENABLE: XEN_DOMCTL_SHADOW_ENABLE_* */
-    /* OP_PEAK / OP_CLEAN: XEN_DOMCTL_SHADOW_LOGDIRTY_* */
+    /* OP_PEAK / OP_CLEAN / OP_CLEAN_LIST: XEN_DOMCTL_SHADOW_LOGDIRTY_* */
     uint32_t       mode;
 
     /* OP_GET_ALLOCATION / OP_SET_ALLOCATION */
     uint32_t       mb;       /* Shadow memory allocation in MB */
 
-    /* OP_PEEK / OP_CLEAN */
+    /* OP_PEEK / OP_CLEAN / OP_CLEAN_LIST */
     XEN_GUEST_HANDLE_64(uint8) dirty_bitmap;
     uint64_aligned_t pages; /* Size of buffer. Updated with actual size. */
     struct xen_domctl_shadow_op_stats stats;
@@ -1276,6 +1283,56 @@ struct xen_domctl_get_domain_state {
     uint64_t unique_id;      /* Unique domain identifier. */
 };
 
+#if defined(__i386__) || defined(__x86_64__)
+/*
+ * XEN_DOMCTL_get_exit_stats
+ *
+ * Get the cumulative VM exit and hypercall statistics of a vCPU.
+ *
+ * Exits are indexed by VMX basic exit reason for 'vmx' vCPUs and by exit
+ * code for 'svm' vCPUs, except that SVM exit codes from VMEXIT_NPF (0x400)
+ * upwards are reported from XEN_DOMCTL_EXIT_STATS_SVM_NPF upwards.  PV vCPUs
+ * have no exit statistics.  Hypercalls are indexed by hypercall number.
+ *
+ * The time of an exit runs from the start of the exit handler to the next
+ * VM entry of the vCPU, so it includes any time the vCPU was descheduled.
+ * The time of a hypercall is that of its handler only, and each invocation
+ * of a preempted hypercall is accounted separately.
+ *
+ * Bucket 0 of the histograms counts durations below 128ns, bucket n > 0
+ * durations in [2^(n+6), 2^(n+7)) ns, and the last bucket all longer ones.
+ *
+ * Input:
+ * - 'nr_exits' and 'nr_hypercalls' are the number of entries in 'exits' and
+ *   'hypercalls'.  Either handle may be NULL, with a count of 0.
+ *
+ * Output:
+ * - The first 'nr_exits' and 'nr_hypercalls' entries are written, and the
+ *   counts are updated to the number of entries Xen has.
+ */
+#define XEN_DOMCTL_EXIT_STATS_BUCKETS  16
+#define XEN_DOMCTL_EXIT_STATS_SVM_NPF  0xa6
+struct xen_domctl_exit_stat {
+    uint64_aligned_t count;
+    uint64_aligned_t ns;          /* Total time. */
+    uint32_t hist[XEN_DOMCTL_EXIT_STATS_BUCKETS];
+};
+typedef struct xen_domctl_exit_stat xen_domctl_exit_stat_t;
+DEFINE_XEN_GUEST_HANDLE(xen_domctl_exit_stat_t);
+
+struct xen_domctl_exit_stats {
+    uint32_t vcpu;                                            /* IN     */
+#define XEN_DOMCTL_EXIT_STATS_pv   0
+#define XEN_DOMCTL_EXIT_STATS_vmx  1
+#define XEN_DOMCTL_EXIT_STATS_svm  2
+    uint32_t type;                                            /* OUT    */
+    uint32_t nr_exits;                                        /* IN/OUT */
+    uint32_t nr_hypercalls;                                   /* IN/OUT */
+    XEN_GUEST_HANDLE_64(xen_domctl_exit_stat_t) exits;        /* OUT    */
+    XEN_GUEST_HANDLE_64(xen_domctl_exit_stat_t) hypercalls;   /* OUT    */
+};
+#endif
+
 struct xen_domctl {
 /* Stable domctl ops: interface_version is required to be 0.  */
     uint32_t cmd;
@@ -1368,6 +1425,7 @@ struct xen_domctl {
 #define XEN_DOMCTL_gsi_permission                88
 #define XEN_DOMCTL_set_llc_colors                89
 #define XEN_DOMCTL_get_domain_state              90 /* stable interface */
+#define XEN_DOMCTL_get_exit_stats                91
 #define XEN_DOMCTL_gdbsx_guestmemio            1000
 #define XEN_DOMCTL_gdbsx_pausevcpu             1001
 #define XEN_DOMCTL_gdbsx_unpausevcpu           1002
@@ -1415,6 +1473,7 @@ struct xen_domctl {
         struct xen_domctl_cpu_policy        cpu_policy;
         struct xen_domctl_vcpuextstate      vcpuextstate;
         struct xen_domctl_vcpu_msrs         vcpu_msrs;
+        struct xen_domctl_exit_stats        exit_stats;
 #endif
         struct xen_domctl_set_access_required access_required;
         struct xen_domctl_audit_p2m         audit_p2m;
@@ -60,6 +60,8 @@
 #ifdef __XEN__
 #define EVTCHNOP_reset_cont      14
 #endif
+#define EVTCHNOP_send_batch      15
+#define EVTCHNOP_set_moderation  16
 /* ` } */
 
 typedef uint32_t evtchn_port_t;
@@ -181,6 +183,23 @@ struct evtchn_send {
 };
 typedef struct evtchn_send evtchn_send_t;
 
+/*
+ * EVTCHNOP_send_batch: Send an event on each of the channels whose local
+ * endpoints are <ports[0]> to <ports[nr_ports - 1]>, as EVTCHNOP_send.
+ * NOTES:
+ *  1. All the ports are sent on, even past a failure: the error of the first
+ *     port which fails is returned.
+ *  2. As with separate sends, a vCPU receiving several of the events is only
+ *     notified of the first, unless it handled it in between.
+ */
+#define EVTCHN_SEND_BATCH_MAX 64
+struct evtchn_send_batch {
+    /* IN parameters. */
+    uint32_t nr_ports;
+    evtchn_port_t ports[EVTCHN_SEND_BATCH_MAX];
+};
+typedef struct evtchn_send_batch evtchn_send_batch_t;
+
 /*
  * EVTCHNOP_status: Get the current status of the communication channel which
  * has an endpoint at <dom, port>.
@@ -298,6 +317,27 @@ struct evtchn_set_priority {
 };
 typedef struct evtchn_set_priority evtchn_set_priority_t;
 
+/*
+ * EVTCHNOP_set_moderation: Moderate the delivery of events on the local
+ * port <port>: once an event has been delivered, further events are held back
+ * for <interval_us> microseconds, and the ones sent meanwhile are delivered as
+ * a single event when it expires.  An <interval_us> of 0 delivers each event
+ * as it is sent again.
+ * NOTES:
+ *  1. Only unbound and interdomain channels may be moderated.
+ *  2. Moderation is dropped when the port is closed.
+ *  3. <interval_us> may be at most EVTCHN_MODERATION_MAX_US.
+ *  4. The number of ports a domain may moderate at a time is limited: further
+ *     ones fail with -ENOSPC.
+ */
+#define EVTCHN_MODERATION_MAX_US 1000000
+struct evtchn_set_moderation {
+    /* IN parameters. */
+    evtchn_port_t port;
+    uint32_t interval_us;
+};
+typedef struct evtchn_set_moderation evtchn_set_moderation_t;
+
 /*
  * ` enum neg_errnoval
  * ` HYPERVISOR_event_channel_op_compat(struct evtchn_op *op)
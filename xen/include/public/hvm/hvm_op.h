@@ -181,6 +181,11 @@ DEFINE_XEN_GUEST_HANDLE(xen_hvm_get_mem_type_t);
  * the pointer pair gets read atomically:
  */
 #define HVM_IOREQSRV_BUFIOREQ_ATOMIC 2
+/*
+ * The buffered ioreq page is an ioreq_ring_t (see hvm/ioreq.h), which also
+ * carries posted MMIO writes:
+ */
+#define HVM_IOREQSRV_BUFIOREQ_RING   3
 
 #endif /* defined(__XEN__) || defined(__XEN_TOOLS__) */
 
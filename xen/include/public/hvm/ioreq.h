@@ -81,6 +81,32 @@ struct buffered_iopage {
 }; /* NB. Size of this structure must be no greater than one page. */
 typedef struct buffered_iopage buffered_iopage_t;
 
+/*
+ * Request ring, in place of the buffered_iopage for servers created with
+ * HVM_IOREQSRV_BUFIOREQ_RING.  It carries whole ioreqs, so any buffered
+ * request fits, and Xen also posts to it the MMIO writes which need no
+ * response (count 1, !data_is_ptr): like PCI memory writes, they complete
+ * for the guest once queued, and a vCPU may have many of them in flight.
+ * When the ring is full, Xen sends the request synchronously instead.
+ *
+ * Xen produces requests at req_prod, the device model consumes them at
+ * req_cons, both free running and taken modulo IOREQ_RING_SLOT_NUM.  The
+ * device model may advance req_cons once for a whole batch.  Xen notifies
+ * bufioreq_port only when req_prod reaches req_event, so before waiting
+ * the device model sets req_event to req_cons + 1 and checks req_prod
+ * again.  It must also drain the ring before handling any synchronous
+ * request, which may depend on the writes posted ahead of it.
+ */
+#define IOREQ_RING_SLOT_NUM 64
+struct ioreq_ring {
+    uint32_t req_prod;   /* Written by Xen. */
+    uint32_t req_cons;   /* Written by the device model. */
+    uint32_t req_event;  /* Written by the device model. */
+    uint32_t pad[13];
+    struct ioreq req[IOREQ_RING_SLOT_NUM];
+};
+typedef struct ioreq_ring ioreq_ring_t;
+
 /*
  * ACPI Control/Event register locations. Location is controlled by a
  * version number in HVM_PARAM_ACPI_IOPORTS_LOCATION.
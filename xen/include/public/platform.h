@@ -663,6 +663,39 @@ struct xenpf_microcode_update2 {
 typedef struct xenpf_microcode_update2 xenpf_microcode_update2_t;
 DEFINE_XEN_GUEST_HANDLE(xenpf_microcode_update2_t);
 
+/*
+ * Read many hypervisor symbols at once, numbered as for XENPF_get_symbol.
+ * Symbols from 'first' on are copied until either buffer is full, or Xen
+ * needs to preempt the call.  With a null 'entries' handle nothing is
+ * copied, and the number of symbols and the size of their names are
+ * returned instead, for sizing the buffers.  Either way 'first' is updated
+ * to the next symbol, for the caller to carry on from.  A call returning
+ * no entries (with non-empty buffers) has reached the end of the table.
+ */
+#define XENPF_get_symtab   67
+struct xenpf_symtab_entry {
+    uint64_t address;
+    uint32_t name;    /* Offset of the NUL terminated name in 'names'. */
+    char type;
+    uint8_t pad[3];
+};
+typedef struct xenpf_symtab_entry xenpf_symtab_entry_t;
+DEFINE_XEN_GUEST_HANDLE(xenpf_symtab_entry_t);
+
+struct xenpf_symtab {
+    uint32_t first;      /* IN:  Symbol to start at.                     */
+                         /* OUT: Next symbol to read.                    */
+    uint32_t nr_entries; /* IN:  Size of 'entries'.                      */
+                         /* OUT: Number of symbols read (or counted).    */
+    uint32_t names_size; /* IN:  Size of 'names'.                        */
+                         /* OUT: Bytes used (or needed).                 */
+    uint32_t pad;
+    XEN_GUEST_HANDLE(xenpf_symtab_entry_t) entries;
+    XEN_GUEST_HANDLE(char) names;
+};
+typedef struct xenpf_symtab xenpf_symtab_t;
+DEFINE_XEN_GUEST_HANDLE(xenpf_symtab_t);
+
 /*
  * ` enum neg_errnoval
  * ` HYPERVISOR_platform_op(const struct xen_platform_op*);
@@ -696,6 +729,7 @@ struct xen_platform_op {
         xenpf_dom0_console_t          dom0_console;
         xenpf_ucode_revision_t        ucode_revision;
         xenpf_microcode_update2_t     microcode2;
+        xenpf_symtab_t                symtab;
         uint8_t                       pad[128];
     } u;
 };
@@ -28,7 +28,7 @@
  *
  * Last version bump: Xen 4.21
  */
-#define XEN_SYSCTL_INTERFACE_VERSION 0x00000016
+#define XEN_SYSCTL_INTERFACE_VERSION 0x00000017
 
 /*
  * Read console content from Xen buffer ring.
@@ -141,6 +141,7 @@ struct xen_sysctl_sched_id {
 /* Sub-operations: */
 #define XEN_SYSCTL_PERFCOP_reset 1   /* Reset all counters to zero. */
 #define XEN_SYSCTL_PERFCOP_query 2   /* Get perfctr information. */
+#define XEN_SYSCTL_PERFCOP_snapshot 3 /* Share a snapshot of all counters. */
 struct xen_sysctl_perfc_desc {
     char         name[80];             /* name of perf counter */
     uint32_t     nr_vals;              /* number of values for this counter */
@@ -160,8 +161,51 @@ struct xen_sysctl_perfc_op {
     XEN_GUEST_HANDLE_64(xen_sysctl_perfc_desc_t) desc;
     /* counter values (or NULL) */
     XEN_GUEST_HANDLE_64(xen_sysctl_perfc_val_t) val;
+    /* XEN_SYSCTL_PERFCOP_snapshot only. */
+    uint32_t       period_ms;         /*  IN: refresh period, 0 to stop  */
+    uint32_t       nr_frames;         /*  IN: size of frames, OUT: needed  */
+    XEN_GUEST_HANDLE_64(uint64) frames; /*  OUT: frames of the snapshot  */
 };
 
+/*
+ * XEN_SYSCTL_PERFCOP_snapshot
+ *
+ * Share with the control domain, read-only, a region holding the values of
+ * all counters of all CPUs, which Xen refreshes in place every period_ms.
+ * The region is allocated on first use and never freed, and is mapped from
+ * DOMID_XEN using the returned frames.  It starts with a struct
+ * xen_perfc_snapshot, followed by nr_counters descriptors, and holds at
+ * vals_offset the nr_vals values of each of the nr_cpus CPUs in turn.
+ * Offline CPUs have all their values 0.
+ *
+ * Readers copy the values between two reads of seq, retrying if it was odd
+ * or has changed.  Counter values wrap at 2^32, and restart from 0 when
+ * resets changes.
+ */
+struct xen_perfc_snapshot_desc {
+    char         name[80];
+    uint32_t     offset;              /* of the first value in a CPU block */
+    uint32_t     nr_vals;             /* 1, or the size of an array */
+#define XEN_PERFC_SNAPSHOT_status 1   /* A status rather than a counter. */
+    uint32_t     flags;
+    uint32_t     pad;
+};
+typedef struct xen_perfc_snapshot_desc xen_perfc_snapshot_desc_t;
+
+struct xen_perfc_snapshot {
+    uint32_t     seq;                 /* Odd while being refreshed. */
+    uint32_t     resets;              /* Number of counter resets. */
+    uint32_t     nr_counters;
+    uint32_t     nr_vals;             /* Values per CPU. */
+    uint32_t     nr_cpus;
+    uint32_t     vals_offset;         /* Bytes from the start of the region. */
+    uint32_t     period_ms;           /* 0 if no longer refreshed. */
+    uint32_t     pad;
+    uint64_t     stime;               /* Xen system time of the refresh. */
+    xen_perfc_snapshot_desc_t desc[XEN_FLEX_ARRAY_DIM];
+};
+typedef struct xen_perfc_snapshot xen_perfc_snapshot_t;
+
 /* XEN_SYSCTL_getdomaininfolist */
 struct xen_sysctl_getdomaininfolist {
     /* IN variables. */
@@ -610,10 +654,19 @@ struct xen_sysctl_page_offline_op {
 /* Sub-operations: */
 #define XEN_SYSCTL_LOCKPROF_reset 1   /* Reset all profile data to zero. */
 #define XEN_SYSCTL_LOCKPROF_query 2   /* Get lock profile information. */
+#define XEN_SYSCTL_LOCKPROF_enable 3  /* Reset and start collecting data. */
+#define XEN_SYSCTL_LOCKPROF_disable 4 /* Stop collecting data. */
 /* Record-type: */
 #define LOCKPROF_TYPE_GLOBAL      0   /* global lock, idx meaningless */
 #define LOCKPROF_TYPE_PERDOM      1   /* per-domain lock, idx is domid */
 #define LOCKPROF_TYPE_N           2   /* number of types */
+/*
+ * Bucket 0 of the histograms counts durations of 0ns, bucket n > 0 durations
+ * in [2^(n-1), 2^n) ns, and the last bucket all longer durations.  For
+ * rwlocks, hold times are those of write acquisitions, while wait times
+ * include read acquisitions which had to wait.
+ */
+#define LOCKPROF_HIST_BUCKETS     32
 struct xen_sysctl_lockprof_data {
     char     name[40];     /* lock name (may include up to 2 %d specifiers) */
     int32_t  type;         /* LOCKPROF_TYPE_??? */
@@ -622,6 +675,8 @@ struct xen_sysctl_lockprof_data {
     uint64_aligned_t block_cnt;    /* # of wait for lock */
     uint64_aligned_t lock_time;    /* nsecs lock held */
     uint64_aligned_t block_time;   /* nsecs waited for lock */
+    uint32_t hold_hist[LOCKPROF_HIST_BUCKETS];  /* lock held, log2(ns) */
+    uint32_t block_hist[LOCKPROF_HIST_BUCKETS]; /* waited for lock, log2(ns) */
 };
 typedef struct xen_sysctl_lockprof_data xen_sysctl_lockprof_data_t;
 DEFINE_XEN_GUEST_HANDLE(xen_sysctl_lockprof_data_t);
@@ -631,6 +686,7 @@ struct xen_sysctl_lockprof_op {
     uint32_t       max_elem;          /* size of output buffer */
     /* OUT variables (query only). */
     uint32_t       nr_elem;           /* number of elements available */
+    uint32_t       active;            /* data being collected (all cmds) */
     uint64_aligned_t time;            /* nsecs of profile measurement */
     /* profile information (or NULL) */
     XEN_GUEST_HANDLE_64(xen_sysctl_lockprof_data_t) data;
@@ -1208,8 +1264,79 @@ struct xen_sysctl_cpu_policy {
 };
 typedef struct xen_sysctl_cpu_policy xen_sysctl_cpu_policy_t;
 DEFINE_XEN_GUEST_HANDLE(xen_sysctl_cpu_policy_t);
+
+/*
+ * XEN_SYSCTL_sample_prof_op (x86 specific)
+ *
+ * Sampling profiler driven by the local APIC NMI watchdog, which must have
+ * been enabled with the "watchdog" command line option.  While enabled, each
+ * watchdog NMI records the interrupted context in a per-pCPU ring, which is
+ * drained with XEN_SYSCTL_SAMPLE_PROF_read.  As the watchdog counts unhalted
+ * cycles, idle pCPUs in a halted state are not sampled.
+ */
+#define XEN_SYSCTL_SAMPLE_PROF_enable   1 /* Sample at 'rate' Hz per pCPU. */
+#define XEN_SYSCTL_SAMPLE_PROF_disable  2
+#define XEN_SYSCTL_SAMPLE_PROF_read     3 /* Drain the ring of 'cpu'. */
+#define XEN_SYSCTL_SAMPLE_PROF_FRAMES   6
+struct xen_sysctl_sample {
+    uint64_aligned_t rip;
+    /* Return addresses of the callers, Xen samples only. */
+    uint64_aligned_t frames[XEN_SYSCTL_SAMPLE_PROF_FRAMES];
+    uint16_t domid;               /* Domain of the running vCPU. */
+    uint16_t vcpu;                /* Running vCPU. */
+    uint8_t  nr_frames;           /* Valid entries in 'frames'. */
+#define XEN_SYSCTL_SAMPLE_guest (1U << 0) /* 'rip' is a guest address. */
+#define XEN_SYSCTL_SAMPLE_idle  (1U << 1) /* The idle vCPU was running. */
+    uint8_t  flags;
+    uint16_t pad;
+};
+typedef struct xen_sysctl_sample xen_sysctl_sample_t;
+DEFINE_XEN_GUEST_HANDLE(xen_sysctl_sample_t);
+struct xen_sysctl_sample_prof_op {
+    uint32_t cmd;         /* IN: XEN_SYSCTL_SAMPLE_PROF_* */
+    uint32_t rate;        /* IN: enable: samples per second.
+                             OUT: read: current rate, 0 when disabled. */
+    uint32_t cpu;         /* IN: read: pCPU whose ring to drain. */
+    uint32_t nr_samples;  /* IN: read: size of 'samples'.
+                             OUT: read: samples written. */
+    uint32_t lost;        /* OUT: read: samples dropped because the ring was
+                             full since the previous read. */
+    uint32_t pad;
+    XEN_GUEST_HANDLE_64(xen_sysctl_sample_t) samples; /* OUT */
+};
 #endif
 
+/*
+ * XEN_SYSCTL_microbench_op
+ *
+ * Time a hot hypervisor primitive on the pCPU running the caller.  A run
+ * consists of nr_batches batches of 'iterations' operations each, and
+ * reports the cycles taken by the fastest and slowest batches, and in total.
+ * Cycles are counted with get_cycles(), at cycles_khz.  The number of batches
+ * is lowered as needed to bound the operations and the time taken by a run.
+ */
+#define XEN_SYSCTL_MICROBENCH_info     1 /* Describe benchmark 'index'. */
+#define XEN_SYSCTL_MICROBENCH_run      2 /* Run benchmark 'index'. */
+#define XEN_SYSCTL_MICROBENCH_NAME_LEN 32
+struct xen_sysctl_microbench_op {
+    uint32_t cmd;           /* IN: XEN_SYSCTL_MICROBENCH_* */
+    uint32_t index;         /* IN */
+    uint32_t nr_benchmarks; /* OUT */
+    uint32_t iterations;    /* IN: run: per batch, 0 for the default.
+                               OUT: the number used. */
+    uint32_t nr_batches;    /* IN: run: 0 for the default.
+                               OUT: the number used. */
+    uint32_t evtchn_port;   /* IN: run: a port of the caller to send to, for
+                               the benchmarks needing one. */
+    char name[XEN_SYSCTL_MICROBENCH_NAME_LEN]; /* OUT */
+    uint64_aligned_t cycles_min;   /* OUT: run: fastest batch. */
+    uint64_aligned_t cycles_max;   /* OUT: run: slowest batch. */
+    uint64_aligned_t cycles_total; /* OUT: run: all batches. */
+    uint32_t cycles_khz;    /* OUT */
+    uint32_t pad;
+};
+typedef struct xen_sysctl_microbench_op xen_sysctl_microbench_op_t;
+
 #if defined(__arm__) || defined(__aarch64__)
 /*
  * XEN_SYSCTL_dt_overlay
@@ -1257,6 +1384,8 @@ struct xen_sysctl {
 /* #define XEN_SYSCTL_set_parameter              28 */
 #define XEN_SYSCTL_get_cpu_policy                29
 #define XEN_SYSCTL_dt_overlay                    30
+#define XEN_SYSCTL_sample_prof_op                31
+#define XEN_SYSCTL_microbench_op                 32
     uint32_t interface_version; /* XEN_SYSCTL_INTERFACE_VERSION */
     union {
         struct xen_sysctl_readconsole       readconsole;
@@ -1285,7 +1414,9 @@ struct xen_sysctl {
         struct xen_sysctl_livepatch_op      livepatch;
 #if defined(__i386__) || defined(__x86_64__)
         struct xen_sysctl_cpu_policy        cpu_policy;
+        struct xen_sysctl_sample_prof_op    sample_prof_op;
 #endif
+        struct xen_sysctl_microbench_op     microbench_op;
 
 #if defined(__arm__) || defined(__aarch64__)
         struct xen_sysctl_dt_overlay        dt_overlay;
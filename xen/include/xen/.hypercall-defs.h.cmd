@@ -0,0 +1 @@
+cmd_include/xen/hypercall-defs.h :=     awk -f ./scripts/gen_hypercall.awk <include/hypercall-defs.i >include/xen/hypercall-defs.h
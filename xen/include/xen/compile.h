@@ -0,0 +1,20 @@
+#ifndef XEN_COMPILE_H
+#define XEN_COMPILE_H
+
+#define XEN_COMPILE_DATE	"Sun Oct 18 17:41:06 UTC 2026"
+#define XEN_COMPILE_TIME	"17:41:06"
+#define XEN_COMPILE_BY		""
+#define XEN_COMPILE_DOMAIN	""
+#define XEN_COMPILE_HOST	"vm"
+#define XEN_COMPILER		"gcc (Debian 12.2.0-14+deb12u1) 12.2.0"
+
+#define XEN_VERSION		4
+#define XEN_SUBVERSION		22
+#define XEN_VERSION_STRING	"4.22"
+#define XEN_EXTRAVERSION	"-unstable"
+
+#define XEN_CHANGESET		"Sun Oct 18 17:40:46 2026 +0000 git:402c35e-dirty"
+#define XEN_BANNER		\
+"Xen 4.22-unstable\n"
+
+#endif /* XEN_COMPILE_H */
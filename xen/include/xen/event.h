@@ -245,11 +245,23 @@ static inline void evtchn_port_init(struct domain *d, struct evtchn *evtchn)
         d->evtchn_port_ops->init(d, evtchn);
 }
 
+/* Deliver, or hold back, an event on a port with moderation set. */
+void evtchn_moderate(struct domain *d, unsigned int vcpu_id,
+                     struct evtchn *evtchn, struct evtchn_moderation *mod);
+
 static inline void evtchn_port_set_pending(struct domain *d,
                                            unsigned int vcpu_id,
                                            struct evtchn *evtchn)
 {
-    if ( evtchn_usable(evtchn) )
+    struct evtchn_moderation *mod;
+
+    if ( !evtchn_usable(evtchn) )
+        return;
+
+    mod = ACCESS_ONCE(evtchn->moderation);
+    if ( unlikely(mod) )
+        evtchn_moderate(d, vcpu_id, evtchn, mod);
+    else
         d->evtchn_port_ops->set_pending(d->vcpu[vcpu_id], evtchn);
 }
 
@@ -207,6 +207,53 @@ int __must_check iommu_iotlb_flush(struct domain *d, dfn_t dfn,
 int __must_check iommu_iotlb_flush_all(struct domain *d,
                                        unsigned int flush_flags);
 
+/*
+ * Batching of IOTLB flushes: between iommu_flush_batch_start() and
+ * iommu_flush_batch_finish(), the flushes requested for the domain on this
+ * CPU are accumulated, adjacent ranges merged, and issued together when the
+ * batch is full or finished, so that the IOMMU is only waited for once.
+ * Pages no longer mapped may only be freed once flushed: callers hand their
+ * last reference to the batch with iommu_flush_batch_put_page().  Batches
+ * don't outlive a hypercall, and have to be finished before preemption.
+ */
+struct page_info;
+
+#define IOMMU_FLUSH_BATCH_RANGES 32
+#define IOMMU_FLUSH_BATCH_PAGES  32
+
+struct iommu_flush_batch {
+    struct domain *d;
+    unsigned int flush_flags;
+    unsigned int nr_ranges;
+    unsigned int nr_pages;
+    struct iommu_flush_range {
+        dfn_t dfn;
+        unsigned long count;
+    } ranges[IOMMU_FLUSH_BATCH_RANGES];
+    struct page_info *pages[IOMMU_FLUSH_BATCH_PAGES];
+};
+
+#ifdef CONFIG_HAS_PASSTHROUGH
+void iommu_flush_batch_start(struct iommu_flush_batch *batch,
+                             struct domain *d);
+int iommu_flush_batch_finish(struct iommu_flush_batch *batch);
+bool iommu_flush_batch_put_page(struct domain *d, struct page_info *pg);
+void iommu_domain_printk(const struct domain *d);
+#else
+static inline void iommu_flush_batch_start(struct iommu_flush_batch *batch,
+                                           struct domain *d) {}
+static inline int iommu_flush_batch_finish(struct iommu_flush_batch *batch)
+{
+    return 0;
+}
+static inline bool iommu_flush_batch_put_page(struct domain *d,
+                                              struct page_info *pg)
+{
+    return false;
+}
+static inline void iommu_domain_printk(const struct domain *d) {}
+#endif
+
 enum iommu_feature
 {
     IOMMU_FEAT_COHERENT_WALK,
@@ -373,6 +420,9 @@ struct iommu_ops {
     int __must_check (*iotlb_flush)(struct domain *d, dfn_t dfn,
                                     unsigned long page_count,
                                     unsigned int flush_flags);
+    /* Optional, flushing the ranges of a batch with one wait. */
+    int __must_check (*iotlb_flush_batch)(struct domain *d,
+                                          const struct iommu_flush_batch *b);
     int (*get_reserved_device_memory)(iommu_grdm_t *func, void *ctxt);
     void (*dump_page_tables)(struct domain *d);
 
@@ -448,6 +498,17 @@ struct domain_iommu {
      * necessarily imply this is true.
      */
     bool need_sync;
+
+#ifdef CONFIG_HAS_PASSTHROUGH
+    /* IOTLB flush statistics, updated without locking. */
+    struct {
+        unsigned long requests;     /* Flushes requested... */
+        unsigned long deferred;     /* ...of which accumulated in a batch. */
+        unsigned long batches;      /* Batches flushed. */
+        unsigned long issued;       /* Flush operations of the IOMMU driver. */
+        unsigned long pages;        /* Pages covered by the above. */
+    } flush_stats;
+#endif
 };
 
 #define dom_iommu(d)              (&(d)->iommu)
@@ -503,6 +564,8 @@ void iommu_dev_iotlb_flush_timeout(struct domain *d, struct pci_dev *pdev);
 DECLARE_PER_CPU(bool, iommu_dont_flush_iotlb);
 
 bool arch_iommu_use_permitted(const struct domain *d);
+/* Get @d ready for a device to be assigned; may return -ERESTART. */
+int arch_iommu_prepare_assign(struct domain *d);
 
 #ifdef CONFIG_X86
 /*
@@ -0,0 +1,9 @@
+/* SPDX-License-Identifier: GPL-2.0-only */
+#ifndef XEN_MICROBENCH_H
+#define XEN_MICROBENCH_H
+
+struct xen_sysctl_microbench_op;
+
+int microbench_control(struct xen_sysctl_microbench_op *op);
+
+#endif /* XEN_MICROBENCH_H */
@@ -85,4 +85,21 @@ PERFCOUNTER(tickled_cpu_overridden, "csched2: tickled_cpu_overridden")
 
 PERFCOUNTER(need_flush_tlb_flush,   "PG_need_flush tlb flushes")
 
+PERFCOUNTER(evtchn_moderated,       "evtchn: events held back")
+PERFCOUNTER(evtchn_moderation_timer,"evtchn: held back events delivered")
+
+#ifdef CONFIG_HAS_VPCI
+PERFCOUNTER(vpci_msix_mask_fast,    "vpci: MSI-X mask bit fast path")
+#endif
+
+#ifdef CONFIG_IOREQ_SERVER
+PERFCOUNTER(ioreq_cache_hit,        "ioreq: dispatch cache hits")
+PERFCOUNTER(ioreq_index_hit,        "ioreq: dispatch index hits")
+PERFCOUNTER(ioreq_index_miss,       "ioreq: dispatch server scans")
+PERFCOUNTER(ioreq_index_rebuild,    "ioreq: dispatch index rebuilds")
+PERFCOUNTER(ioreq_ring_posted,      "ioreq: requests posted to ring")
+PERFCOUNTER(ioreq_ring_full,        "ioreq: ring full, sent synchronously")
+PERFCOUNTER(ioreq_ring_notify,      "ioreq: ring notifications")
+#endif
+
 /*#endif*/ /* __XEN_PERFC_DEFN_H__ */
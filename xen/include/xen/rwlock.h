@@ -12,6 +12,9 @@
 typedef struct {
     atomic_t cnts;
     spinlock_t lock;
+#ifdef CONFIG_DEBUG_LOCK_PROFILE
+    struct lock_profile *profile;
+#endif
 } rwlock_t;
 
 #define    RW_LOCK_UNLOCKED {           \
@@ -19,9 +22,69 @@ typedef struct {
     .lock = SPIN_LOCK_UNLOCKED          \
 }
 
-#define DEFINE_RWLOCK(l) rwlock_t l = RW_LOCK_UNLOCKED
 #define rwlock_init(l) (*(l) = (rwlock_t)RW_LOCK_UNLOCKED)
 
+#ifdef CONFIG_DEBUG_LOCK_PROFILE
+
+#define RWLOCK_PROFILE_(lockname) { .name = #lockname,                        \
+                                    .ptr.rwlock = &(lockname),                \
+                                    .type = LOCK_PROFILE_RW, }
+#define DEFINE_RWLOCK(l)                                                      \
+    rwlock_t l = RW_LOCK_UNLOCKED;                                            \
+    static struct lock_profile lock_profile_data__##l = RWLOCK_PROFILE_(l);   \
+    LOCK_PROFILE_PTR_(l)
+
+void _rwlock_profile_add(struct lock_profile_qhead *qhead, rwlock_t *lock,
+                         const char *name);
+void _rwlock_profile_remove(struct lock_profile_qhead *qhead, rwlock_t *lock);
+
+/*
+ * Profile an (already initialised) rwlock as part of the structure pointed
+ * to by s, e.g. a domain.
+ */
+#define rwlock_profile_add(s, lock, name)                                     \
+    _rwlock_profile_add(&(s)->profile_head, lock, name)
+/* Needed if the lock is freed before s is deregistered. */
+#define rwlock_profile_remove(s, lock)                                        \
+    _rwlock_profile_remove(&(s)->profile_head, lock)
+#define rwlock_init_prof(s, l) do {                                           \
+        rwlock_init(&(s)->l);                                                 \
+        rwlock_profile_add(s, &(s)->l, #l);                                   \
+    } while ( 0 )
+
+#define rw_profile_block_start(l) lock_profile_block_start((l)->profile)
+
+static always_inline void rw_profile_got(rwlock_t *lock, s_time_t block)
+{
+    lock_profile_got(lock->profile, block);
+}
+
+static always_inline void rw_profile_rel(rwlock_t *lock)
+{
+    lock_profile_rel(lock->profile);
+}
+
+static always_inline void rw_profile_read_got(rwlock_t *lock, s_time_t block)
+{
+    if ( block )
+        _lock_profile_block_shared(lock->profile, block);
+}
+
+#else
+
+#define DEFINE_RWLOCK(l) rwlock_t l = RW_LOCK_UNLOCKED
+
+#define rwlock_profile_add(s, lock, name) ((void)0)
+#define rwlock_profile_remove(s, lock) ((void)0)
+#define rwlock_init_prof(s, l) rwlock_init(&(s)->l)
+
+#define rw_profile_block_start(l) ((s_time_t)0)
+#define rw_profile_got(l, b) ((void)(b))
+#define rw_profile_rel(l) ((void)0)
+#define rw_profile_read_got(l, b) ((void)(b))
+
+#endif /* CONFIG_DEBUG_LOCK_PROFILE */
+
 /* Writer states & reader shift and bias. */
 #define    _QW_SHIFT    14                      /* Writer flags shift */
 #define    _QW_CPUMASK  ((1U << _QW_SHIFT) - 1) /* Writer CPU mask */
@@ -184,6 +247,7 @@ static inline void _write_lock(rwlock_t *lock)
         /* The slow path calls check_lock() via spin_lock(). */
         check_lock(&lock->lock.debug, false);
         lock_enter(&lock->lock.debug);
+        rw_profile_got(lock, 0);
         return;
     }
 
@@ -230,6 +294,7 @@ static inline int _write_trylock(rwlock_t *lock)
     }
 
     lock_enter(&lock->lock.debug);
+    rw_profile_got(lock, 0);
 
     /*
      * atomic_cmpxchg() is a full barrier so no need for an
@@ -242,6 +307,7 @@ static inline void _write_unlock(rwlock_t *lock)
 {
     ASSERT(_is_write_locked_by_me(atomic_read(&lock->cnts)));
 
+    rw_profile_rel(lock);
     lock_exit(&lock->lock.debug);
 
     arch_lock_release_barrier();
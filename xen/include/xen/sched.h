@@ -93,6 +93,7 @@ enum virq_type {
 struct evtchn
 {
     rwlock_t lock;
+    unsigned int seq;      /* Odd while write locked, see evtchn_send(). */
 #define ECS_FREE         0 /* Channel is available for use.                  */
 #define ECS_RESERVED     1 /* Channel is reserved.                           */
 #define ECS_UNBOUND      2 /* Channel is waiting to bind to a remote domain. */
@@ -126,6 +127,7 @@ struct evtchn
     unsigned char priority;        /* FIFO event channels only. */
     unsigned short notify_vcpu_id; /* VCPU for local delivery notification */
     uint32_t fifo_lastq;           /* Data for identifying last queue. */
+    struct evtchn_moderation *moderation; /* EVTCHNOP_set_moderation state. */
 
 #ifdef CONFIG_XSM
     union {
@@ -174,6 +176,14 @@ struct vcpu_io {
     ioreq_t              req;
     /* Arch specific info pertaining to the io request */
     struct arch_vcpu_io  info;
+#ifdef CONFIG_IOREQ_SERVER
+    /* Recently hit ioreq server ranges, see ioreq_server_select(). */
+    struct ioreq_cache_entry {
+        unsigned long    s, e;
+        unsigned int     generation;
+        uint8_t          type, id;
+    } ioreq_cache[4];
+#endif
 };
 
 struct vcpu
@@ -452,11 +462,20 @@ struct domain
      * EVTCHNOP_reset).  Read/write access like for active_evtchns.
      */
     unsigned int     xen_evtchns;
+    /* Number of moderated event channels, with event_lock held. */
+    unsigned int     moderated_evtchns;
     /* Port to resume from in evtchn_reset(), when in a continuation. */
     unsigned int     next_evtchn;
     rwlock_t         event_lock;
     const struct evtchn_port_ops *evtchn_port_ops;
     struct evtchn_fifo_domain *evtchn_fifo;
+    /*
+     * Lockless senders to the domain's ports are stopped, and waited for via
+     * an RCU callback, before its FIFO state may be torn down.
+     */
+    bool             evtchn_send_stopped;
+    bool             evtchn_send_quiesced;
+    struct rcu_head  evtchn_send_rcu;
 
     struct grant_table *grant_table;
 
@@ -650,6 +669,13 @@ struct domain
     struct {
         rspinlock_t             lock;
         struct ioreq_server     *server[MAX_NR_IOREQ_SERVERS];
+        /*
+         * Which server handles which range, rebuilt when they change.
+         * The generation invalidates the vCPUs' ioreq caches.
+         */
+        rwlock_t                index_lock;
+        struct ioreq_index      *index;
+        unsigned int            generation;
     } ioreq_server;
 #endif
 
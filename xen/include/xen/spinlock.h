@@ -74,9 +74,21 @@ union lock_debug { };
     - removing of a structure is done via
 
       lock_profile_deregister_struct(type, ptr);
+
+    rwlocks (including the rwlock of a percpu_rwlock) are handled the same
+    way via DEFINE_RWLOCK, rwlock_init_prof(ptr, lock) or
+    rwlock_profile_add(ptr, lockptr, name), see xen/rwlock.h.
+
+    Data is only collected while profiling is active, see the "lock-profile"
+    command line option and XEN_SYSCTL_LOCKPROF_enable.
 */
 
 struct spinlock;
+struct rspinlock;
+
+#define LOCK_PROFILE_SPIN  0
+#define LOCK_PROFILE_RSPIN 1
+#define LOCK_PROFILE_RW    2
 
 struct lock_profile {
     struct lock_profile *next;       /* forward link */
@@ -84,13 +96,17 @@ struct lock_profile {
     union {
         struct spinlock *lock;       /* the lock itself */
         struct rspinlock *rlock;     /* the recursive lock itself */
+        void *rwlock;                /* the rwlock itself */
     } ptr;
     uint64_t            lock_cnt;    /* # of complete locking ops */
-    uint64_t            block_cnt:63; /* # of complete wait for lock */
-    bool                is_rlock:1;  /* use rlock pointer */
+    uint64_t            block_cnt;   /* # of complete wait for lock */
+    unsigned int        type;        /* LOCK_PROFILE_*, selects ptr */
     s_time_t            time_hold;   /* cumulated lock time */
     s_time_t            time_block;  /* cumulated wait time */
-    s_time_t            time_locked; /* system time of last locking */
+    s_time_t            time_locked; /* system time of last locking, or 0 */
+    /* log2(ns) histograms, see struct xen_sysctl_lockprof_data. */
+    uint32_t            hold_hist[LOCKPROF_HIST_BUCKETS];
+    uint32_t            block_hist[LOCKPROF_HIST_BUCKETS];
 };
 
 struct lock_profile_qhead {
@@ -102,7 +118,7 @@ struct lock_profile_qhead {
 #define LOCK_PROFILE_(lockname) { .name = #lockname, .ptr.lock = &(lockname), }
 #define RLOCK_PROFILE_(lockname) { .name = #lockname,                         \
                                    .ptr.rlock = &(lockname),                  \
-                                   .is_rlock = true, }
+                                   .type = LOCK_PROFILE_RSPIN, }
 #define LOCK_PROFILE_PTR_(name)                                               \
     static struct lock_profile * const lock_profile__##name                   \
     __used_section(".lockprofile.data") =                                     \
@@ -127,7 +143,7 @@ struct lock_profile_qhead {
     static struct lock_profile lock_profile_data__##l = RLOCK_PROFILE_(l);    \
     LOCK_PROFILE_PTR_(l)
 
-#define spin_lock_init_prof__(s, l, lockptr, locktype, isr)                   \
+#define spin_lock_init_prof__(s, l, lockptr, locktype, ltype)                 \
     do {                                                                      \
         struct lock_profile *prof;                                            \
         prof = xzalloc(struct lock_profile);                                  \
@@ -141,15 +157,15 @@ struct lock_profile_qhead {
         }                                                                     \
         prof->name = #l;                                                      \
         prof->ptr.lockptr = &(s)->l;                                          \
-        prof->is_rlock = (isr);                                               \
+        prof->type = (ltype);                                                 \
         prof->next = (s)->profile_head.elem_q;                                \
         (s)->profile_head.elem_q = prof;                                      \
     } while( 0 )
 
 #define spin_lock_init_prof(s, l)                                             \
-    spin_lock_init_prof__(s, l, lock, spinlock_t, false)
+    spin_lock_init_prof__(s, l, lock, spinlock_t, LOCK_PROFILE_SPIN)
 #define rspin_lock_init_prof(s, l) do {                                       \
-        spin_lock_init_prof__(s, l, rlock, rspinlock_t, true);                \
+        spin_lock_init_prof__(s, l, rlock, rspinlock_t, LOCK_PROFILE_RSPIN);  \
         (s)->l.recurse_cpu = SPINLOCK_NO_CPU;                                 \
         (s)->l.recurse_cnt = 0;                                               \
     } while (0)
@@ -164,6 +180,34 @@ void _lock_profile_deregister_struct(int32_t type,
 #define lock_profile_deregister_struct(type, ptr)                             \
     _lock_profile_deregister_struct(type, &((ptr)->profile_head))
 
+/* Whether lock profiling data is being collected. */
+extern bool lock_profile_active;
+
+void _lock_profile_got(struct lock_profile *profile, s_time_t block);
+void _lock_profile_rel(struct lock_profile *profile);
+void _lock_profile_block_shared(struct lock_profile *profile, s_time_t block);
+
+static always_inline s_time_t lock_profile_block_start(
+    const struct lock_profile *profile)
+{
+    return unlikely(profile) && unlikely(lock_profile_active) ? NOW() : 0;
+}
+
+/* Only call out of line when there is something to account. */
+static always_inline void lock_profile_got(struct lock_profile *profile,
+                                           s_time_t block)
+{
+    if ( unlikely(profile) && unlikely(lock_profile_active) )
+        _lock_profile_got(profile, block);
+}
+
+/* Profiling may have been (de)activated while the lock was held. */
+static always_inline void lock_profile_rel(struct lock_profile *profile)
+{
+    if ( unlikely(profile) && unlikely(profile->time_locked) )
+        _lock_profile_rel(profile);
+}
+
 extern int spinlock_profile_control(struct xen_sysctl_lockprof_op *pc);
 extern void cf_check spinlock_profile_printall(unsigned char key);
 extern void cf_check spinlock_profile_reset(unsigned char key);
@@ -122,6 +122,12 @@ struct vpci {
         bool enabled         : 1;
         /* Masked? */
         bool masked          : 1;
+        /*
+         * Write locked when binding or unbinding the entries' interrupts,
+         * and when changing the enabled or masked state above, i.e. whenever
+         * the mask bit fast path couldn't run without the vPCI lock.
+         */
+        rwlock_t entries_lock;
         /* Partial table map. */
 #define VPCI_MSIX_TBL_HEAD 0
 #define VPCI_MSIX_TBL_TAIL 1
@@ -132,8 +138,9 @@ struct vpci {
         struct vpci_msix_entry {
             uint64_t addr;
             uint32_t data;
-            bool masked  : 1;
-            bool updated : 1;
+            /* Not bit-fields: 'masked' is updated without the vPCI lock. */
+            bool masked;
+            bool updated;
             struct vpci_arch_msix_entry arch;
         } entries[];
     } *msix;
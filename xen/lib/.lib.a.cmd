@@ -0,0 +1 @@
+cmd_lib/lib.a := rm -f lib/lib.a; ar cr lib/lib.a lib/bsearch.o lib/ctors.o lib/ctype.o lib/earlycpio.init.o lib/find-next-bit.o lib/generic-ffsl.o lib/generic-flsl.o lib/generic-hweightl.o lib/guest-strcpy.o lib/list-sort.o lib/memchr.o lib/memchr_inv.o lib/memcmp.o lib/memcpy.o lib/memmove.o lib/memset.o lib/muldiv64.o lib/parse-size.o lib/rbtree.o lib/sha1.o lib/sha2-256.o lib/sort.o lib/strcasecmp.o lib/strchr.o lib/strcmp.o lib/strcspn.o lib/strlcat.o lib/strlcpy.o lib/strlen.o lib/strncasecmp.o lib/strncmp.o lib/strnlen.o lib/strpbrk.o lib/strrchr.o lib/strsep.o lib/strspn.o lib/strstr.o lib/strtol.o lib/strtoll.o lib/strtoul.o lib/strtoull.o lib/xxhash32.o lib/xxhash64.o
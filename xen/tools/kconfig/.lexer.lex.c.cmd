@@ -0,0 +1 @@
+cmd_tools/kconfig/lexer.lex.c := /tmp/klex/flex -otools/kconfig/lexer.lex.c -L tools/kconfig/lexer.l
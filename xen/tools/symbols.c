@@ -55,6 +55,7 @@ static unsigned int table_size, table_cnt;
 static unsigned long long _stext, _etext, _sinittext, _einittext, _sextratext, _eextratext;
 static int all_symbols = 0;
 static int sort_by_name = 0;
+static int plain_names = 0;
 static int map_only = 0;
 static char symbol_prefix_char = '\0';
 static enum { fmt_bsd, fmt_sysv } input_format;
@@ -69,7 +70,7 @@ unsigned char best_table_len[256];
 
 static void usage(void)
 {
-	fprintf(stderr, "Usage: symbols [--all-symbols] [--symbol-prefix=<prefix char>] < in.map > out.S\n");
+	fprintf(stderr, "Usage: symbols [--all-symbols] [--plain-names] [--symbol-prefix=<prefix char>] < in.map > out.S\n");
 	exit(1);
 }
 
@@ -436,6 +437,32 @@ static void write_src(void)
 	for (i = 0; i < 256; i++)
 		printf("\t.short\t%d\n", best_idx[i]);
 
+	if (plain_names) {
+		char name[1024];
+
+		/* Uncompressed "<type><name>" strings, indexed like
+		 * symbols_addresses.  END symbols share the empty string at
+		 * offset 0. */
+		output_label("symbols_plain_offsets", "4", false);
+		for (i = 0, off = 1; i < table_cnt; i++) {
+			printf("\t.long\t%u\n", off);
+			off += expand_symbol(table[i].sym, table[i].len, name) + 1;
+			if (want_symbol_end(i))
+				printf("\t.long\t0\n");
+		}
+
+		output_label("symbols_plain_names", "1", false);
+		printf("\t.byte\t0\n");
+		for (i = 0; i < table_cnt; i++) {
+			expand_symbol(table[i].sym, table[i].len, name);
+			printf("\t.asciz\t\"");
+			for (k = 0; name[k]; k++)
+				printf(name[k] == '"' || name[k] == '\\' ?
+				       "\\%c" : "%c", name[k]);
+			printf("\"\n");
+		}
+	}
+
 	if (sort_by_name) {
 		output_label("symbols_num_names", "4", false);
 		printf("\t.long\t%d\n", table_cnt);
@@ -679,6 +706,8 @@ int main(int argc, char **argv)
 				unsorted = true;
 			else if (strcmp(argv[i], "--sort-by-name") == 0)
 				sort_by_name = 1;
+			else if (strcmp(argv[i], "--plain-names") == 0)
+				plain_names = 1;
 			else if (strcmp(argv[i], "--warn-dup") == 0)
 				warn_dup = true;
 			else if (strcmp(argv[i], "--error-dup") == 0)
@@ -723,6 +723,7 @@ static int cf_check flask_domctl(struct domain *d, unsigned int cmd,
         return current_has_perm(d, SECCLASS_DOMAIN, DOMAIN__GETVCPUCONTEXT);
 
     case XEN_DOMCTL_getvcpuinfo:
+    case XEN_DOMCTL_get_exit_stats:
         return current_has_perm(d, SECCLASS_DOMAIN, DOMAIN__GETVCPUINFO);
 
     case XEN_DOMCTL_settimeoffset:
@@ -894,6 +895,12 @@ static int cf_check flask_sysctl(int cmd)
     case XEN_SYSCTL_coverage_op:
         return avc_current_has_perm(SECINITSID_XEN, SECCLASS_XEN2,
                                     XEN2__COVERAGE_OP, NULL);
+    case XEN_SYSCTL_sample_prof_op:
+        return avc_current_has_perm(SECINITSID_XEN, SECCLASS_XEN2,
+                                    XEN2__SAMPLE_PROF_OP, NULL);
+    case XEN_SYSCTL_microbench_op:
+        return avc_current_has_perm(SECINITSID_XEN, SECCLASS_XEN2,
+                                    XEN2__MICROBENCH_OP, NULL);
 
     default:
         return avc_unknown_permission("sysctl", cmd);
@@ -1550,6 +1557,7 @@ static int cf_check flask_platform_op(uint32_t op)
                                     XEN2__RESOURCE_OP, NULL);
 
     case XENPF_get_symbol:
+    case XENPF_get_symtab:
         return avc_has_perm(domain_sid(current->domain), SECINITSID_XEN,
                             SECCLASS_XEN2, XEN2__GET_SYMBOL, NULL);
 
@@ -1586,6 +1594,7 @@ static int cf_check flask_shadow_control(struct domain *d, uint32_t op)
     case XEN_DOMCTL_SHADOW_OP_ENABLE_LOGDIRTY:
     case XEN_DOMCTL_SHADOW_OP_PEEK:
     case XEN_DOMCTL_SHADOW_OP_CLEAN:
+    case XEN_DOMCTL_SHADOW_OP_CLEAN_LIST:
         perm = SHADOW__LOGDIRTY;
         break;
     default: